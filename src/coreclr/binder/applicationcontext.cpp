@@ -98,6 +98,19 @@ namespace BINDER_SPACE
 
         sTrustedPlatformAssemblies.Normalize();
 
+        // Size the map for the whole list up front. TPA lists of large apps have hundreds of entries, and growing
+        // the map one step at a time would rehash every simple name several times.
+        {
+            const SString &tpaList = sTrustedPlatformAssemblies;
+            COUNT_T pathCount = 1;
+            for (SString::CIterator i = tpaList.Begin(); tpaList.Find(i, PATH_SEPARATOR_CHAR_W); i++)
+            {
+                pathCount++;
+            }
+
+            m_pTrustedPlatformAssemblyMap->Reallocate(pathCount * SimpleNameToFileNameMapTraits::s_density_factor_denominator / SimpleNameToFileNameMapTraits::s_density_factor_numerator + 1);
+        }
+
         for (SString::Iterator i = sTrustedPlatformAssemblies.Begin(); i != sTrustedPlatformAssemblies.End(); )
         {
             SString fileName;
@@ -2,9 +2,20 @@
 // The .NET Foundation licenses this file to you under the MIT license.
 
 #include "createdump.h"
+#include <atomic>
+#include <pthread.h>
 
 extern int g_readProcessMemoryErrno;
 
+struct MemoryWriterContext
+{
+    DumpWriter* writer;
+    const std::vector<MemoryWriterItem>* items;
+    std::atomic<size_t> nextItem;
+    std::atomic<bool> failed;
+    std::atomic<uint64_t> skipped;
+};
+
 // Write the core dump file:
 //   ELF header
 //   Single section header (Shdr) for 64 bit program header count
@@ -112,6 +123,9 @@ DumpWriter::WriteDump()
 
     TRACE("Writing memory region headers to core file\n");
 
+    // The memory regions are laid down right after the PT_NOTE section
+    uint64_t memoryOffset = offset + filesz;
+
     // Write memory region note headers
     for (const MemoryRegion& memoryRegion : m_crashInfo.MemoryRegions())
     {
@@ -168,7 +182,205 @@ DumpWriter::WriteDump()
 
     TRACE("Writing %" PRIu64 " memory regions to core file\n", phnum - 1);
 
-    // Read from target process and write memory regions to core
+    return WriteMemoryRegions(memoryOffset);
+}
+
+// Read from target process and write memory regions to core. On a regular file the regions
+// are read in parallel and written at their offset, leaving holes for all-zero pages (which
+// includes pages never touched by the target), so the file is sparse.
+bool
+DumpWriter::WriteMemoryRegions(uint64_t offset)
+{
+    struct stat st;
+    if (fstat(m_fd, &st) != 0 || !S_ISREG(st.st_mode) || lseek(m_fd, 0, SEEK_CUR) != (off_t)offset)
+    {
+        // Pipes and devices are written sequentially
+        return WriteMemoryRegionsSequential();
+    }
+
+    std::vector<MemoryWriterItem> items;
+    uint64_t total = 0;
+    for (const MemoryRegion& memoryRegion : m_crashInfo.MemoryRegions())
+    {
+        uint64_t address = memoryRegion.StartAddress();
+        size_t size = memoryRegion.Size();
+        total += size;
+
+        while (size > 0)
+        {
+            size_t itemSize = std::min(size, (size_t)MEMORY_WRITER_ITEM_SIZE);
+            items.push_back({ address, itemSize, offset });
+            address += itemSize;
+            offset += itemSize;
+            size -= itemSize;
+        }
+    }
+
+    MemoryWriterContext context;
+    context.writer = this;
+    context.items = &items;
+    context.nextItem = 0;
+    context.failed = false;
+    context.skipped = 0;
+
+    long processors = sysconf(_SC_NPROCESSORS_ONLN);
+    size_t threadCount = std::min(std::min(items.size(), (size_t)MEMORY_WRITER_MAX_THREADS), (size_t)std::max(processors, 1L));
+
+    // This thread is one of the writers
+    std::vector<pthread_t> threads;
+    for (size_t i = 1; i < threadCount; i++)
+    {
+        pthread_t thread;
+        if (pthread_create(&thread, nullptr, WriteMemoryItemsWorker, &context) != 0)
+        {
+            break;
+        }
+        threads.push_back(thread);
+    }
+    TRACE("Writing %zu memory items with %zu threads\n", items.size(), threads.size() + 1);
+
+    WriteMemoryItemsWorker(&context);
+    for (pthread_t thread : threads)
+    {
+        pthread_join(thread, nullptr);
+    }
+
+    if (context.failed)
+    {
+        return false;
+    }
+
+    // Trailing zero pages weren't written, extend the file to the end of the last region
+    if (ftruncate(m_fd, offset) != 0)
+    {
+        printf_error("Error setting the dump file size: %s (%d)\n", strerror(errno), errno);
+        return false;
+    }
+
+    uint64_t skipped = context.skipped;
+    printf_status("Written %" PRId64 " bytes (%" PRId64 " pages, %" PRId64 " zero pages left sparse) to core file\n", total, total / PAGE_SIZE, skipped / PAGE_SIZE);
+    return true;
+}
+
+void*
+DumpWriter::WriteMemoryItemsWorker(void* param)
+{
+    MemoryWriterContext* context = (MemoryWriterContext*)param;
+
+    BYTE* buffer = (BYTE*)malloc(MEMORY_WRITER_BUFFER_SIZE);
+    if (buffer == nullptr)
+    {
+        // The remaining threads pick up the work
+        return nullptr;
+    }
+
+    while (!context->failed)
+    {
+        size_t index = context->nextItem++;
+        if (index >= context->items->size())
+        {
+            break;
+        }
+
+        uint64_t skipped = 0;
+        if (!context->writer->WriteMemoryItem((*context->items)[index], buffer, MEMORY_WRITER_BUFFER_SIZE, &skipped))
+        {
+            context->failed = true;
+        }
+        context->skipped += skipped;
+    }
+
+    free(buffer);
+    return nullptr;
+}
+
+// Returns true if size is a whole page of zeros
+static bool
+IsZeroPage(const BYTE* buffer, size_t size)
+{
+    if (size < (size_t)PAGE_SIZE)
+    {
+        return false;
+    }
+
+    // The first 8 bytes are zero and every 8 bytes equal the previous 8
+    uint64_t first;
+    memcpy(&first, buffer, sizeof(first));
+    return first == 0 && memcmp(buffer, buffer + sizeof(first), PAGE_SIZE - sizeof(first)) == 0;
+}
+
+bool
+DumpWriter::WriteMemoryItem(const MemoryWriterItem& item, BYTE* buffer, size_t bufferSize, uint64_t* skipped)
+{
+    uint64_t address = item.address;
+    uint64_t offset = item.offset;
+    size_t size = item.size;
+
+    while (size > 0)
+    {
+        size_t bytesToRead = std::min(size, bufferSize);
+        size_t read = 0;
+
+        if (!m_crashInfo.ReadProcessMemory((void*)address, buffer, bytesToRead, &read)) {
+            printf_error("Error reading memory at %" PRIA PRIx64 " size %08zx FAILED %s (%d)\n", address, bytesToRead, strerror(g_readProcessMemoryErrno), g_readProcessMemoryErrno);
+            return false;
+        }
+
+        // This can happen if the target process dies before createdump is finished
+        if (read == 0) {
+            printf_error("Error reading memory at %" PRIA PRIx64 " size %08zx returned 0 bytes read: %s (%d)\n", address, bytesToRead, strerror(g_readProcessMemoryErrno), g_readProcessMemoryErrno);
+            return false;
+        }
+
+        // Write the runs of pages that aren't all zero
+        size_t position = 0;
+        while (position < read)
+        {
+            size_t runStart = position;
+            bool zero = IsZeroPage(buffer + position, read - position);
+            while (position < read)
+            {
+                size_t pageSize = std::min((size_t)PAGE_SIZE, read - position);
+                if (IsZeroPage(buffer + position, pageSize) != zero)
+                {
+                    break;
+                }
+                position += pageSize;
+            }
+
+            if (zero)
+            {
+                *skipped += position - runStart;
+                continue;
+            }
+
+            size_t done = runStart;
+            while (done < position)
+            {
+                ssize_t written;
+                do {
+                    written = pwrite64(m_fd, buffer + done, position - done, (off64_t)(offset + done));
+                } while (written == -1 && errno == EINTR);
+
+                if (written < 1) {
+                    printf_error("Error writing data to dump file: %s (%d)\n", strerror(errno), errno);
+                    return false;
+                }
+                done += written;
+            }
+        }
+
+        address += read;
+        offset += read;
+        size -= read;
+    }
+
+    return true;
+}
+
+bool
+DumpWriter::WriteMemoryRegionsSequential()
+{
     uint64_t total = 0;
     for (const MemoryRegion& memoryRegion : m_crashInfo.MemoryRegions())
     {
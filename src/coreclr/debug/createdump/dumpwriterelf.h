@@ -31,6 +31,19 @@
 #define NT_FILE		0x46494c45
 #endif
 
+// Memory regions are split into work items of at most this size, read and written by up to
+// MEMORY_WRITER_MAX_THREADS threads when the dump file is seekable.
+#define MEMORY_WRITER_ITEM_SIZE (64 * 1024 * 1024)
+#define MEMORY_WRITER_MAX_THREADS 8
+#define MEMORY_WRITER_BUFFER_SIZE (1024 * 1024)
+
+struct MemoryWriterItem
+{
+    uint64_t address;
+    size_t size;
+    uint64_t offset;        // offset in the dump file
+};
+
 class DumpWriter
 {
 private:
@@ -55,6 +68,10 @@ private:
     size_t GetNTFileInfoSize(size_t* alignmentBytes = nullptr);
     bool WriteNTFileInfo();
     bool WriteThread(const ThreadInfo& thread, int fatal_signal);
+    bool WriteMemoryRegions(uint64_t offset);
+    bool WriteMemoryRegionsSequential();
+    bool WriteMemoryItem(const MemoryWriterItem& item, BYTE* buffer, size_t bufferSize, uint64_t* skipped);
+    static void* WriteMemoryItemsWorker(void* context);
     bool WriteData(const void* buffer, size_t length) { return WriteData(m_fd, buffer, length); }
 
     size_t GetProcessInfoSize() const { return sizeof(Nhdr) + 8 + sizeof(prpsinfo_t); }
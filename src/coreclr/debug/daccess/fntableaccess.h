@@ -64,6 +64,9 @@ typedef struct _FakeHpRealCodeHdr
     LPVOID              pCalledMethods;
 #endif
     LPVOID              hdrMDesc;       // changed from MethodDesc*
+#if defined(TARGET_AMD64) || defined(TARGET_ARM64)
+    LPVOID              hdrColdCodeInfo; // changed from ColdCodeInfo*
+#endif
     DWORD               nUnwindInfos;
     T_RUNTIME_FUNCTION  unwindInfos[0];
 } FakeRealCodeHeader;
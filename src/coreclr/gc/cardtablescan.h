@@ -0,0 +1,67 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+#ifndef __CARD_TABLE_SCAN_H__
+#define __CARD_TABLE_SCAN_H__
+
+// This is included outside of the WKS/SVR namespaces since it needs the
+// intrinsics headers; it only deals with uint32_t words so it does not depend
+// on any GC types and can be used by the benchmarks in gc/sample as well.
+
+#if defined(TARGET_AMD64)
+#include <emmintrin.h>
+#define CARD_SCAN_SSE2
+#elif defined(TARGET_ARM64)
+#include <arm_neon.h>
+#define CARD_SCAN_NEON
+#endif
+
+// Returns the first non-zero word in [word, word_end), or word_end if they are
+// all zero. Both the card table and the card bundle table are mostly zero during
+// ephemeral GCs over a big gen2, so we skip zero words 32 bytes at a time. SSE2
+// and NEON are part of the baseline ISA so there's nothing to detect, and this
+// loop is bound by memory bandwidth long before wider vectors would help.
+inline
+uint32_t* find_non_zero_card_word (uint32_t* word, uint32_t* word_end)
+{
+#if defined(CARD_SCAN_SSE2) || defined(CARD_SCAN_NEON)
+    // get to a 16 byte boundary one word at a time
+    while ((word < word_end) && (((size_t)word & 15) != 0))
+    {
+        if (*word != 0)
+        {
+            return word;
+        }
+        word++;
+    }
+
+    while ((word_end - word) >= 8)
+    {
+#ifdef CARD_SCAN_SSE2
+        __m128i v = _mm_or_si128 (_mm_load_si128 ((const __m128i*)word),
+                                  _mm_load_si128 ((const __m128i*)(word + 4)));
+        if (_mm_movemask_epi8 (_mm_cmpeq_epi32 (v, _mm_setzero_si128 ())) != 0xFFFF)
+        {
+            break;
+        }
+#else //CARD_SCAN_SSE2
+        uint32x4_t v = vorrq_u32 (vld1q_u32 (word), vld1q_u32 (word + 4));
+        if (vmaxvq_u32 (v) != 0)
+        {
+            break;
+        }
+#endif //CARD_SCAN_SSE2
+        word += 8;
+    }
+#endif //CARD_SCAN_SSE2 || CARD_SCAN_NEON
+
+    // the tail, or the vector that had a non-zero word in it
+    while ((word < word_end) && (*word == 0))
+    {
+        word++;
+    }
+
+    return word;
+}
+
+#endif // __CARD_TABLE_SCAN_H__
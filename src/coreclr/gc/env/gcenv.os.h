@@ -289,6 +289,15 @@ public:
     //  true if it has succeeded, false if it has failed
     static bool VirtualDecommit(void *address, size_t size);
 
+    // Advise the OS to back a committed virtual memory range with huge pages where it can (transparent
+    // huge pages on Linux). Calling it with a null address and 0 size checks whether the OS supports it.
+    // Parameters:
+    //  address - starting virtual address
+    //  size    - size of the virtual memory range
+    // Return:
+    //  true if the OS accepted the advice, false if it has failed or is not supported
+    static bool VirtualAdviseHugePages(void *address, size_t size);
+
     // Reset virtual memory range. Indicates that data in the memory range specified by address and size is no
     // longer of interest, but it should not be decommitted.
     // Parameters:
@@ -324,6 +333,26 @@ public:
     //  true if it has succeeded, false if it has failed
     static bool GetWriteWatch(bool resetState, void* address, size_t size, void** pageAddresses, uintptr_t* pageAddressesCount);
 
+    // Check if the OS tracks writes to all memory of the process by itself, without the memory
+    // being reserved with VirtualReserveFlags::WriteWatch (soft-dirty page bits on Linux)
+    static bool SupportsProcessWriteWatch();
+
+    // Reset the process wide write tracking state. This resets it for all memory in the process,
+    // not just a range, and can make the next write to every page take a page fault.
+    static void ResetProcessWriteWatch();
+
+    // Retrieve addresses of the pages in a region of virtual memory that were written to since
+    // the last ResetProcessWriteWatch
+    // Parameters:
+    //  address            - starting virtual address
+    //  size               - size of the virtual memory range
+    //  pageAddresses      - buffer that receives an array of page addresses in the memory region
+    //  pageAddressesCount - on input, size of the lpAddresses array, in array elements
+    //                       on output, the number of page addresses that are returned in the array.
+    // Return:
+    //  true if it has succeeded, false if it has failed
+    static bool GetProcessWriteWatch(void* address, size_t size, void** pageAddresses, uintptr_t* pageAddressesCount);
+
     //
     // Thread and process
     //
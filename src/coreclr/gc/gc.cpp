@@ -18,7 +18,7 @@
 
 #include "gcpriv.h"
 
-#if defined(TARGET_AMD64) && defined(TARGET_WINDOWS)
+#if (defined(TARGET_AMD64) && defined(TARGET_WINDOWS)) || defined(TARGET_ARM64)
 #define USE_VXSORT
 #else
 #define USE_INTROSORT
@@ -76,6 +76,10 @@ BOOL bgc_heap_walk_for_etw_p = FALSE;
 // If the survived due to cards from old generations / region_size is 90+%,
 // we don't compact this region, also we immediately promote it to gen2.
 #define sip_old_card_surv_ratio_th (90)
+// If BGC finds the survived / region_size of a gen2 region is less than 25%, it's sparse.
+#define sparse_region_surv_ratio_th (25)
+// If what's not live in sparse gen2 regions is 10+% of gen2, we compact them.
+#define sparse_region_reclaim_ratio_th (10)
 #else
 #define demotion_plug_len_th (6*1024*1024)
 #endif //USE_REGIONS
@@ -1275,6 +1279,13 @@ void reset_memory (uint8_t* o, size_t sizeo);
 
 #ifndef FEATURE_USE_SOFTWARE_WRITE_WATCH_FOR_GC_HEAP
 static bool virtual_alloc_hardware_write_watch = false;
+#else // !FEATURE_USE_SOFTWARE_WRITE_WATCH_FOR_GC_HEAP
+// With GCOSWriteWatch the OS tracks the pages BGC needs to revisit for the whole process
+// (soft-dirty bits on Linux) so we never switch the write barrier to its write watch
+// version. The tracking state can only be reset for the whole process, so we reset it
+// once when BGC starts and the concurrent revisits don't reset what they looked at -
+// the final revisit looks at everything written since the BGC started.
+static bool os_write_watch_for_gc_heap_p = false;
 #endif // !FEATURE_USE_SOFTWARE_WRITE_WATCH_FOR_GC_HEAP
 
 static bool hardware_write_watch_capability = false;
@@ -1844,6 +1855,12 @@ uint8_t* gc_heap::pad_for_alignment_large (uint8_t* newAlloc, int requiredAlignm
 #define CLR_SIZE ((size_t)(8*1024+32))
 #endif //SERVER_GC
 
+// Allocation contexts that are refilled often get up to 2^MAX_ALLOC_QUANTUM_SHIFT times the
+// allocation quantum, bounded by 1/MAX_ALLOC_QUANTUM_BUDGET_DIVISOR of the gen0 budget.
+#define MAX_ALLOC_QUANTUM_SHIFT 6
+#define MAX_ALLOC_QUANTUM_BUDGET_DIVISOR 16
+#define MIN_ALLOC_QUANTUM ((size_t)1024)
+
 #define END_SPACE_AFTER_GC (loh_size_threshold + MAX_STRUCTALIGN)
 // When we fit into the free list we need an extra of a min obj
 #define END_SPACE_AFTER_GC_FL (END_SPACE_AFTER_GC + Align (min_obj_size))
@@ -1901,6 +1918,16 @@ const size_t fgn_check_quantum = 2*1024*1024;
 
 #ifdef MH_SC_MARK
 const int max_snoop_level = 128;
+
+// Each heap's mark deque holds up to this many objects shared with other heaps.
+const int32_t mark_deque_capacity = 4096;
+
+// Once this many objects are waiting in its deque a heap keeps the rest of its
+// work on its own mark stack, so the deque only holds what the idle heaps can take.
+const int32_t mark_deque_share_limit = 256;
+
+// How many objects a heap takes from another heap's deque at a time.
+const int mark_steal_batch_size = 16;
 #endif //MH_SC_MARK
 
 #ifdef CARD_BUNDLE
@@ -1942,6 +1969,23 @@ uint8_t* align_lower_page (uint8_t* add)
     return (uint8_t*)align_lower_page ((size_t)add);
 }
 
+#ifdef USE_REGIONS
+// the huge page size we align region commits and decommits to when use_region_huge_pages_p is set
+const size_t huge_page_size = 2 * 1024 * 1024;
+
+inline
+uint8_t* align_on_huge_page (uint8_t* add)
+{
+    return (uint8_t*)(((size_t)add + huge_page_size - 1) & ~(huge_page_size - 1));
+}
+
+inline
+uint8_t* align_lower_huge_page (uint8_t* add)
+{
+    return (uint8_t*)((size_t)add & ~(huge_page_size - 1));
+}
+#endif //USE_REGIONS
+
 inline
 size_t align_write_watch_lower_page (size_t add)
 {
@@ -2202,14 +2246,38 @@ int         gc_heap::n_heaps;
 
 gc_heap**   gc_heap::g_heaps;
 
+#ifdef DYNAMIC_HEAP_COUNT
+int         gc_heap::n_active_heaps;
+bool        gc_heap::dynamic_heap_count_p = false;
+float       gc_heap::dynamic_heap_count_target_cost = 0;
+float       gc_heap::dynamic_heap_count_samples[dynamic_heap_count_sample_count];
+size_t      gc_heap::dynamic_heap_count_sample_index = 0;
+size_t      gc_heap::dynamic_heap_count_samples_since_change = 0;
+uint64_t    gc_heap::dynamic_heap_count_last_gc_end = 0;
+#endif //DYNAMIC_HEAP_COUNT
+
 #if !defined(USE_REGIONS) || defined(_DEBUG)
 size_t*     gc_heap::g_promoted;
 #endif //!USE_REGIONS || _DEBUG
 
 #ifdef MH_SC_MARK
 int*        gc_heap::g_mark_stack_busy;
+
+VOLATILE(int32_t) gc_heap::mark_steal_idle_heaps = 0;
 #endif //MH_SC_MARK
 
+#ifdef FEATURE_BGC_SWEEP_STEALING
+bool        gc_heap::bgc_sweep_stealing_p = false;
+#endif //FEATURE_BGC_SWEEP_STEALING
+
+bool        gc_heap::adaptive_alloc_quantum_p = true;
+
+#if defined(BACKGROUND_GC) && defined(USE_REGIONS)
+bool        gc_heap::sparse_region_compaction_p = false;
+
+bool        gc_heap::sparse_region_compaction_pending_p = false;
+#endif //BACKGROUND_GC && USE_REGIONS
+
 #ifdef BACKGROUND_GC
 size_t*     gc_heap::g_bpromoted;
 #endif //BACKGROUND_GC
@@ -2290,6 +2358,10 @@ double      gc_heap::short_plugs_pad_ratio = 0;
 int         gc_heap::generation_skip_ratio_threshold = 0;
 int         gc_heap::conserve_mem_setting = 0;
 
+uint64_t    gc_heap::pause_target_us = 0;
+
+double      gc_heap::full_blocking_pause_us_per_mb[2];
+
 uint64_t    gc_heap::suspended_start_time = 0;
 uint64_t    gc_heap::end_gc_time = 0;
 uint64_t    gc_heap::total_suspended_time = 0;
@@ -2727,10 +2799,21 @@ size_t gc_heap::eph_gen_starts_size = 0;
 #if defined(USE_REGIONS)
 region_free_list gc_heap::global_regions_to_decommit[count_free_region_kinds];
 region_free_list gc_heap::global_free_huge_regions;
+region_free_list gc_heap::global_regions_to_lazy_decommit[count_free_region_kinds];
+int gc_heap::lazy_decommit_gcs = 0;
+size_t gc_heap::lazy_decommit_reset_size = 0;
+size_t gc_heap::hard_decommit_size = 0;
+VOLATILE(size_t) gc_heap::decommit_churn_size = 0;
+decommitted_range gc_heap::recent_decommits[DECOMMIT_CHURN_HISTORY];
+int gc_heap::recent_decommit_index = 0;
 #else
 heap_segment* gc_heap::segment_standby_list;
 #endif //USE_REGIONS
 bool          gc_heap::use_large_pages_p = 0;
+
+#ifdef USE_REGIONS
+bool          gc_heap::use_region_huge_pages_p = false;
+#endif //USE_REGIONS
 #ifdef HEAP_BALANCE_INSTRUMENTATION
 size_t        gc_heap::last_gc_end_time_us = 0;
 #endif //HEAP_BALANCE_INSTRUMENTATION
@@ -2786,7 +2869,7 @@ BOOL        gc_heap::heap_analyze_enabled = FALSE;
 #ifndef MULTIPLE_HEAPS
 
 alloc_list gc_heap::loh_alloc_list [NUM_LOH_ALIST-1];
-alloc_list gc_heap::gen2_alloc_list[NUM_GEN2_ALIST-1];
+alloc_list gc_heap::gen2_alloc_list[NUM_GEN2_SC_ALIST-1];
 alloc_list gc_heap::poh_alloc_list [NUM_POH_ALIST-1];
 
 #ifdef DOUBLY_LINKED_FL
@@ -2796,7 +2879,7 @@ size_t gc_heap::saved_pinned_plug_index = INVALID_SAVED_PINNED_PLUG_INDEX;
 #endif //DOUBLY_LINKED_FL
 
 #ifdef FEATURE_EVENT_TRACE
-etw_bucket_info gc_heap::bucket_info[NUM_GEN2_ALIST];
+etw_bucket_info gc_heap::bucket_info[NUM_GEN2_SC_ALIST];
 #endif //FEATURE_EVENT_TRACE
 
 dynamic_data gc_heap::dynamic_data_table [total_generation_count];
@@ -2809,6 +2892,10 @@ uint8_t* gc_heap::alloc_allocated = 0;
 
 size_t gc_heap::allocation_quantum = CLR_SIZE;
 
+size_t gc_heap::max_allocation_quantum = CLR_SIZE;
+
+size_t gc_heap::soh_alloc_refills = 0;
+
 GCSpinLock gc_heap::more_space_lock_soh;
 GCSpinLock gc_heap::more_space_lock_uoh;
 
@@ -2863,6 +2950,10 @@ size_t     gc_heap::interesting_mechanism_bits_per_heap[max_gc_mechanism_bits_co
 
 mark_queue_t gc_heap::mark_queue;
 
+#ifdef BACKGROUND_GC
+mark_queue_t gc_heap::background_mark_queue;
+#endif //BACKGROUND_GC
+
 #ifdef USE_REGIONS
 bool gc_heap::special_sweep_p = false;
 #endif //USE_REGIONS
@@ -4177,8 +4268,202 @@ void seg_mapping_table_remove_ro_segment (heap_segment* seg)
 #endif //0
 }
 
+// Frozen segments are usually registered outside [g_gc_lowest_address, g_gc_highest_address) so
+// the seg_mapping_table doesn't cover them, and seg_table is a binary search over all of them.
+// ro_seg_map maps every 4MB of the address space to the (at most 2) frozen segments that
+// intersect it so looking up an address takes the same time however many frozen segments
+// there are. It's 2 levels so we only allocate the part of it that has frozen segments in it.
+// A granule that would need more than 2 segments is marked as overflowing and looked up in
+// seg_table instead, and so is everything if a segment lands beyond what the map covers or
+// we couldn't allocate the map.
+//
+// Readers don't take a lock. The entries are only changed with the gc_lock held, a segment is
+// in seg_table before it shows up in an entry, and whatever a reader finds in an entry is
+// checked against the address, so a reader racing with an insert or removal doesn't find a
+// segment the address isn't on.
+#define ro_seg_map_granule_shr  22
+#define ro_seg_map_chunk_shr    34
+// covers a 48-bit address space
+#define ro_seg_map_chunk_count  ((size_t)1 << (48 - ro_seg_map_chunk_shr))
+#define ro_seg_map_chunk_length ((size_t)1 << (ro_seg_map_chunk_shr - ro_seg_map_granule_shr))
+#define ro_seg_map_overflow     ((heap_segment*)1)
+
+struct ro_seg_mapping
+{
+    heap_segment* seg0;
+    heap_segment* seg1;
+};
+
+static ro_seg_mapping** ro_seg_map = nullptr;
+static bool ro_seg_map_incomplete_p = false;
+
+inline
+uint64_t ro_seg_map_granule_of (uint8_t* add)
+{
+    return (uint64_t)(size_t)add >> ro_seg_map_granule_shr;
+}
+
+// returns the entry for the granule, or nullptr if no frozen segment was ever added to that part of the map
+inline
+ro_seg_mapping* ro_seg_map_entry_of (uint64_t granule)
+{
+    size_t chunk = (size_t)(granule >> (ro_seg_map_chunk_shr - ro_seg_map_granule_shr));
+    ro_seg_mapping** map = VolatileLoad (&ro_seg_map);
+    if ((map == nullptr) || (chunk >= ro_seg_map_chunk_count))
+        return nullptr;
+
+    ro_seg_mapping* entries = VolatileLoad (&map[chunk]);
+    if (entries == nullptr)
+        return nullptr;
+
+    return &entries[granule & (ro_seg_map_chunk_length - 1)];
+}
+
+// called with the gc_lock held
+static bool ro_seg_map_ensure_chunk (uint64_t granule)
+{
+    size_t chunk = (size_t)(granule >> (ro_seg_map_chunk_shr - ro_seg_map_granule_shr));
+    if (chunk >= ro_seg_map_chunk_count)
+        return false;
+
+    if (ro_seg_map == nullptr)
+    {
+        ro_seg_mapping** map = new (nothrow) ro_seg_mapping* [ro_seg_map_chunk_count];
+        if (map == nullptr)
+            return false;
+        memset (map, 0, ro_seg_map_chunk_count * sizeof (ro_seg_mapping*));
+        VolatileStore (&ro_seg_map, map);
+    }
+
+    if (ro_seg_map[chunk] == nullptr)
+    {
+        ro_seg_mapping* entries = new (nothrow) ro_seg_mapping [ro_seg_map_chunk_length];
+        if (entries == nullptr)
+            return false;
+        memset (entries, 0, ro_seg_map_chunk_length * sizeof (ro_seg_mapping));
+        VolatileStore (&ro_seg_map[chunk], entries);
+    }
+
+    return true;
+}
+
+// An entry is empty, has the same segment in both slots or has 2 segments. When we add the
+// second one or remove one of 2 the other one stays in one of the slots the whole time.
+static void ro_seg_map_add_to_entry (ro_seg_mapping* entry, heap_segment* seg)
+{
+    heap_segment* seg0 = entry->seg0;
+    if (seg0 == ro_seg_map_overflow)
+        return;
+
+    if (seg0 == nullptr)
+    {
+        entry->seg1 = seg;
+        VolatileStore (&entry->seg0, seg);
+    }
+    else if (seg0 != entry->seg1)
+    {
+        VolatileStore (&entry->seg0, ro_seg_map_overflow);
+    }
+    else if (heap_segment_mem (seg) < heap_segment_mem (seg0))
+    {
+        VolatileStore (&entry->seg0, seg);
+    }
+    else
+    {
+        VolatileStore (&entry->seg1, seg);
+    }
+}
+
+static void ro_seg_map_remove_from_entry (ro_seg_mapping* entry, heap_segment* seg)
+{
+    heap_segment* seg0 = entry->seg0;
+    heap_segment* seg1 = entry->seg1;
+    if (seg0 == ro_seg_map_overflow)
+        return;
+
+    if ((seg0 == seg) && (seg1 == seg))
+    {
+        VolatileStore (&entry->seg0, (heap_segment*)nullptr);
+        entry->seg1 = nullptr;
+    }
+    else if (seg0 == seg)
+    {
+        VolatileStore (&entry->seg0, seg1);
+    }
+    else if (seg1 == seg)
+    {
+        VolatileStore (&entry->seg1, seg0);
+    }
+}
+
+void ro_seg_map_add_segment (heap_segment* seg)
+{
+    if (ro_seg_map_incomplete_p)
+        return;
+
+    uint64_t begin_granule = ro_seg_map_granule_of (heap_segment_mem (seg));
+    uint64_t end_granule = ro_seg_map_granule_of (heap_segment_reserved (seg) - 1);
+    if (!ro_seg_map_ensure_chunk (begin_granule) || !ro_seg_map_ensure_chunk (end_granule))
+    {
+        dprintf (1, ("ro seg %p-%p can't be added to the ro seg map, looking up all ro segs in seg_table",
+            heap_segment_mem (seg), heap_segment_reserved (seg)));
+        ro_seg_map_incomplete_p = true;
+        return;
+    }
+
+    for (uint64_t granule = begin_granule; granule <= end_granule; granule++)
+    {
+        ro_seg_mapping* entry = ro_seg_map_entry_of (granule);
+        if (entry == nullptr)
+        {
+            // a segment this big spans a chunk boundary
+            if (!ro_seg_map_ensure_chunk (granule))
+            {
+                ro_seg_map_incomplete_p = true;
+                return;
+            }
+            entry = ro_seg_map_entry_of (granule);
+        }
+        ro_seg_map_add_to_entry (entry, seg);
+    }
+}
+
+void ro_seg_map_remove_segment (heap_segment* seg)
+{
+    uint64_t begin_granule = ro_seg_map_granule_of (heap_segment_mem (seg));
+    uint64_t end_granule = ro_seg_map_granule_of (heap_segment_reserved (seg) - 1);
+    for (uint64_t granule = begin_granule; granule <= end_granule; granule++)
+    {
+        ro_seg_mapping* entry = ro_seg_map_entry_of (granule);
+        if (entry != nullptr)
+        {
+            ro_seg_map_remove_from_entry (entry, seg);
+        }
+    }
+}
+
 heap_segment* ro_segment_lookup (uint8_t* o)
 {
+    if (!VolatileLoad (&ro_seg_map_incomplete_p))
+    {
+        ro_seg_mapping* entry = ro_seg_map_entry_of (ro_seg_map_granule_of (o));
+        if (entry == nullptr)
+            return 0;
+
+        heap_segment* seg0 = VolatileLoad (&entry->seg0);
+        if (seg0 != ro_seg_map_overflow)
+        {
+            if (seg0 && in_range_for_segment (o, seg0))
+                return seg0;
+
+            heap_segment* seg1 = VolatileLoad (&entry->seg1);
+            if (seg1 && (seg1 != ro_seg_map_overflow) && in_range_for_segment (o, seg1))
+                return seg1;
+
+            return 0;
+        }
+    }
+
     uint8_t* ro_seg_start = o;
     heap_segment* seg = (heap_segment*)gc_heap::seg_table->lookup (ro_seg_start);
 
@@ -6178,7 +6463,13 @@ public:
         if (GCToOSInterface::CanGetCurrentProcessorNumber())
         {
             uint32_t proc_no = GCToOSInterface::GetCurrentProcessorNumber();
+#ifdef DYNAMIC_HEAP_COUNT
+            // with fewer active heaps than procs multiple procs share a heap, same as when
+            // GCHeapCount is less than the number of procs.
+            return proc_no_to_heap_no[proc_no] % gc_heap::n_active_heaps;
+#else //DYNAMIC_HEAP_COUNT
             return proc_no_to_heap_no[proc_no];
+#endif //DYNAMIC_HEAP_COUNT
         }
 
         unsigned sniff_index = Interlocked::Increment(&cur_sniff_index);
@@ -6190,7 +6481,12 @@ public:
 
         uint8_t *l_sniff_buffer = sniff_buffer;
         unsigned l_n_sniff_buffers = n_sniff_buffers;
-        for (int heap_number = 0; heap_number < gc_heap::n_heaps; heap_number++)
+#ifdef DYNAMIC_HEAP_COUNT
+        int n_selectable_heaps = gc_heap::n_active_heaps;
+#else //DYNAMIC_HEAP_COUNT
+        int n_selectable_heaps = gc_heap::n_heaps;
+#endif //DYNAMIC_HEAP_COUNT
+        for (int heap_number = 0; heap_number < n_selectable_heaps; heap_number++)
         {
             int this_access_time = access_time(l_sniff_buffer, heap_number, sniff_index, l_n_sniff_buffers);
             if (this_access_time < best_access_time)
@@ -7023,6 +7319,20 @@ bool gc_heap::virtual_commit (void* address, size_t size, int bucket, int h_numb
                               virtual_alloc_commit_for_heap (address, size, h_number)) :
                               GCToOSInterface::VirtualCommit(address, size));
 
+#ifdef USE_REGIONS
+    if (commit_succeeded_p && use_region_huge_pages_p && (h_number >= 0))
+    {
+        // VirtualDecommit remaps the range so the advice needs to be given again every time
+        // we commit. Failing to take it is fine, we just get normal pages.
+        GCToOSInterface::VirtualAdviseHugePages (address, size);
+    }
+
+    if (commit_succeeded_p && (h_number >= 0))
+    {
+        record_recommit ((uint8_t*)address, size);
+    }
+#endif //USE_REGIONS
+
     if (!commit_succeeded_p && heap_hard_limit)
     {
         check_commit_cs.Enter();
@@ -7354,6 +7664,9 @@ void gc_mechanisms::init_mechanisms()
     found_finalizers = FALSE;
 #ifdef BACKGROUND_GC
     background_p = gc_heap::background_running_p() != FALSE;
+#ifdef USE_REGIONS
+    sparse_region_compaction = FALSE;
+#endif //USE_REGIONS
 #endif //BACKGROUND_GC
 
     entry_memory_load = 0;
@@ -7453,6 +7766,12 @@ void gc_heap::fix_allocation_context (alloc_context* acontext, BOOL for_gc_p,
                  (size_t)acontext,
                  (size_t)acontext->alloc_ptr, (size_t)acontext->alloc_limit));
 
+    if (for_gc_p)
+    {
+        // Decay the refill count so it reflects how much this context allocated recently.
+        acontext->alloc_refill_count /= 2;
+    }
+
     if (acontext->alloc_ptr == 0)
     {
         return;
@@ -9597,6 +9916,7 @@ BOOL gc_heap::insert_ro_segment (heap_segment* seg)
     seg_table->insert (heap_segment_mem(seg), (size_t)seg);
 
     seg_mapping_table_add_ro_segment (seg);
+    ro_seg_map_add_segment (seg);
 
     if ((heap_segment_reserved (seg) > lowest_address) &&
         (heap_segment_mem (seg) < highest_address))
@@ -9626,6 +9946,7 @@ void gc_heap::remove_ro_segment (heap_segment* seg)
 
     enter_spin_lock (&gc_heap::gc_lock);
 
+    ro_seg_map_remove_segment (seg);
     seg_table->remove (heap_segment_mem (seg));
     seg_mapping_table_remove_ro_segment (seg);
 
@@ -9912,6 +10233,25 @@ private:
 #ifdef USE_VXSORT
 static void do_vxsort (uint8_t** item_array, ptrdiff_t item_count, uint8_t* range_low, uint8_t* range_high)
 {
+#ifdef TARGET_ARM64
+    // NEON vectors are only half as wide as AVX2 ones, but there is no
+    // downclocking to pay for, so use the same threshold as AVX2
+    const size_t NEON_THRESHOLD_SIZE = 8 * 1024;
+
+    if (item_count <= 1)
+        return;
+
+    if (IsSupportedInstructionSet (InstructionSet::NEON) && (item_count > NEON_THRESHOLD_SIZE))
+    {
+        dprintf(3, ("Sorting mark lists"));
+        do_vxsort_neon (item_array, &item_array[item_count - 1], range_low, range_high);
+    }
+    else
+    {
+        dprintf (3, ("Sorting mark lists"));
+        introsort::sort (item_array, &item_array[item_count - 1], 0);
+    }
+#else //TARGET_ARM64
     // above this threshold, using AVX2 for sorting will likely pay off
     // despite possible downclocking on some devices
     const size_t AVX2_THRESHOLD_SIZE = 8 * 1024;
@@ -9942,6 +10282,7 @@ static void do_vxsort (uint8_t** item_array, ptrdiff_t item_count, uint8_t* rang
         dprintf (3, ("Sorting mark lists"));
         introsort::sort (item_array, &item_array[item_count - 1], 0);
     }
+#endif //TARGET_ARM64
 #ifdef _DEBUG
     // check the array is sorted
     for (ptrdiff_t i = 0; i < item_count - 1; i++)
@@ -10555,11 +10896,16 @@ void gc_heap::grow_mark_list ()
 {
     // with vectorized sorting, we can use bigger mark lists
 #ifdef USE_VXSORT
+#ifdef TARGET_ARM64
+    const bool vxsort_supported = IsSupportedInstructionSet (InstructionSet::NEON);
+#else //TARGET_ARM64
+    const bool vxsort_supported = IsSupportedInstructionSet (InstructionSet::AVX2);
+#endif //TARGET_ARM64
 #ifdef MULTIPLE_HEAPS
-    const size_t MAX_MARK_LIST_SIZE = IsSupportedInstructionSet (InstructionSet::AVX2) ?
+    const size_t MAX_MARK_LIST_SIZE = vxsort_supported ?
         (1000 * 1024) : (200 * 1024);
 #else //MULTIPLE_HEAPS
-    const size_t MAX_MARK_LIST_SIZE = IsSupportedInstructionSet (InstructionSet::AVX2) ?
+    const size_t MAX_MARK_LIST_SIZE = vxsort_supported ?
         (32 * 1024) : (16 * 1024);
 #endif //MULTIPLE_HEAPS
 #else //USE_VXSORT
@@ -11371,6 +11717,10 @@ void gc_heap::return_free_region (heap_segment* region)
     }
     clear_region_info (region);
 
+#ifdef MULTIPLE_HEAPS
+    heap_segment_numa_node (region) = heap_select::find_numa_node_from_heap_no (heap_number);
+#endif //MULTIPLE_HEAPS
+
     region_free_list::add_region_descending (region, free_regions);
 
     uint8_t* region_start = get_region_start (region);
@@ -11859,6 +12209,7 @@ void gc_heap::init_heap_segment (heap_segment* seg, gc_heap* hp
     set_region_gen_num (seg, gen_num_for_region);
     heap_segment_plan_gen_num (seg) = gen_num_for_region;
     heap_segment_swept_in_plan (seg) = false;
+    heap_segment_lazy_decommit_gc (seg) = 0;
 #endif //USE_REGIONS
 
 #ifdef USE_REGIONS
@@ -11980,6 +12331,13 @@ size_t gc_heap::decommit_heap_segment_pages_worker (heap_segment* seg,
 {
     assert (!use_large_pages_p);
     uint8_t* page_start = align_on_page (new_committed);
+#ifdef USE_REGIONS
+    if (use_region_huge_pages_p)
+    {
+        // don't decommit part of a huge page, the OS would have to split it
+        page_start = align_on_huge_page (page_start);
+    }
+#endif //USE_REGIONS
     ptrdiff_t size = heap_segment_committed (seg) - page_start;
     if (size > 0)
     {
@@ -12197,8 +12555,47 @@ void gc_heap::rearrange_heap_segments(BOOL compacting)
 #endif //!USE_REGIONS
 
 #if defined(USE_REGIONS)
-// trim down the list of free regions pointed at by free_list down to target_count, moving the extra ones to surplus_list
-static void remove_surplus_regions (region_free_list* free_list, region_free_list* surplus_list, size_t target_count)
+// While distributing free regions the surplus regions are kept per NUMA node so a heap
+// gets regions from its own node first and only takes regions from other nodes as a last
+// resort - otherwise its allocating threads would pay remote memory latency.
+#ifdef MULTIPLE_HEAPS
+#define MAX_SURPLUS_NUMA_NODES MAX_SUPPORTED_NODES
+#else
+#define MAX_SURPLUS_NUMA_NODES 1
+#endif //MULTIPLE_HEAPS
+
+static int get_surplus_numa_node (heap_segment* region)
+{
+#ifdef MULTIPLE_HEAPS
+    return heap_segment_numa_node (region) % MAX_SURPLUS_NUMA_NODES;
+#else
+    return 0;
+#endif //MULTIPLE_HEAPS
+}
+
+static size_t get_num_surplus_regions (region_free_list surplus_lists[MAX_SURPLUS_NUMA_NODES])
+{
+    size_t num_regions = 0;
+    for (int node = 0; node < MAX_SURPLUS_NUMA_NODES; node++)
+    {
+        num_regions += surplus_lists[node].get_num_free_regions();
+    }
+    return num_regions;
+}
+
+// move all regions on from_list to the surplus list of their NUMA node
+static void add_surplus_regions (region_free_list* from_list, region_free_list surplus_lists[MAX_SURPLUS_NUMA_NODES])
+{
+    while (from_list->get_num_free_regions() > 0)
+    {
+        heap_segment* region = from_list->unlink_region_front();
+        surplus_lists[get_surplus_numa_node (region)].add_region_front (region);
+    }
+}
+
+// trim down the list of free regions pointed at by free_list down to target_count, moving the extra ones to the surplus
+// list of their NUMA node
+static void remove_surplus_regions (region_free_list* free_list, region_free_list surplus_lists[MAX_SURPLUS_NUMA_NODES], size_t target_count)
 {
     while (free_list->get_num_free_regions() > target_count)
     {
@@ -12206,26 +12603,39 @@ static void remove_surplus_regions (region_free_list* free_list, region_free_lis
         heap_segment* region = free_list->unlink_region_front();
 
         // and put it on the surplus list
-        surplus_list->add_region_front (region);
+        surplus_lists[get_surplus_numa_node (region)].add_region_front (region);
     }
 }
 
-// add regions from surplus_list to free_list, trying to reach target_count
-static int64_t add_regions (region_free_list* free_list, region_free_list* surplus_list, size_t target_count)
+// add regions from the surplus lists to free_list, trying to reach target_count. Regions from home_node are
+// used first, regions from the other nodes only when home_node has run out and local_only is false -
+// num_remote_regions is incremented by the number of those.
+static int64_t add_regions (region_free_list* free_list, region_free_list surplus_lists[MAX_SURPLUS_NUMA_NODES],
+                            int home_node, bool local_only, size_t target_count, size_t* num_remote_regions)
 {
     int64_t added_count = 0;
-    while (free_list->get_num_free_regions() < target_count)
+    int node_count = local_only ? 1 : MAX_SURPLUS_NUMA_NODES;
+    for (int i = 0; i < node_count; i++)
     {
-        if (surplus_list->get_num_free_regions() == 0)
-            break;
+        int node = (home_node + i) % MAX_SURPLUS_NUMA_NODES;
+        region_free_list* surplus_list = &surplus_lists[node];
+        while (free_list->get_num_free_regions() < target_count)
+        {
+            if (surplus_list->get_num_free_regions() == 0)
+                break;
 
-        added_count++;
+            added_count++;
+            if (node != home_node)
+            {
+                (*num_remote_regions)++;
+            }
 
-        // remove one region from the surplus list
-        heap_segment* region = surplus_list->unlink_region_front();
+            // remove one region from the surplus list
+            heap_segment* region = surplus_list->unlink_region_front();
 
-        // and put it on the heap's free list
-        free_list->add_region_front (region);
+            // and put it on the heap's free list
+            free_list->add_region_front (region);
+        }
     }
     return added_count;
 }
@@ -12742,6 +13152,11 @@ void gc_heap::distribute_free_regions()
                 global_regions_to_decommit[kind].transfer_regions (&hp->free_regions[kind]);
             }
         }
+        for (int kind = basic_free_region; kind < count_free_region_kinds; kind++)
+        {
+            global_regions_to_decommit[kind].transfer_regions (&global_regions_to_lazy_decommit[kind]);
+        }
+        // lazy_decommit_p is false for aggressive GCs so these all get decommitted now
         while (decommit_step(DECOMMIT_TIME_STEP_MILLISECONDS))
         {
         }
@@ -12788,12 +13203,17 @@ void gc_heap::distribute_free_regions()
     size_t heap_budget_in_region_units[MAX_SUPPORTED_CPUS][kind_count];
     size_t min_heap_budget_in_region_units[MAX_SUPPORTED_CPUS];
     size_t region_size[kind_count] = { global_region_allocator.get_region_alignment(), global_region_allocator.get_large_region_alignment() };
-    region_free_list surplus_regions[kind_count];
+    region_free_list surplus_regions[kind_count][MAX_SURPLUS_NUMA_NODES];
     for (int kind = basic_free_region; kind < kind_count; kind++)
     {
         // we may still have regions left on the regions_to_decommit list -
         // use these to fill the budget as well
-        surplus_regions[kind].transfer_regions (&global_regions_to_decommit[kind]);
+        add_surplus_regions (&global_regions_to_decommit[kind], surplus_regions[kind]);
+
+        // and the ones we reset but haven't decommitted - whatever we don't hand
+        // out goes back on the decommit list and decommit_step decides whether
+        // they've been idle long enough to decommit.
+        add_surplus_regions (&global_regions_to_lazy_decommit[kind], surplus_regions[kind]);
     }
 #ifdef MULTIPLE_HEAPS
     for (int i = 0; i < n_heaps; i++)
@@ -12843,13 +13263,13 @@ void gc_heap::distribute_free_regions()
     {
         if ((gen <= soh_gen2) &&
             total_budget_in_region_units[basic_free_region] >= (total_num_free_regions[basic_free_region] +
-                                                                surplus_regions[basic_free_region].get_num_free_regions()))
+                                                                get_num_surplus_regions (surplus_regions[basic_free_region])))
         {
             // don't accumulate budget from higher soh generations if we cannot cover lower ones
             dprintf (REGIONS_LOG, ("out of free regions - skipping gen %d budget = %zd >= avail %zd",
                 gen,
                 total_budget_in_region_units[basic_free_region],
-                total_num_free_regions[basic_free_region] + surplus_regions[basic_free_region].get_num_free_regions()));
+                total_num_free_regions[basic_free_region] + get_num_surplus_regions (surplus_regions[basic_free_region])));
             continue;
         }
 #ifdef MULTIPLE_HEAPS
@@ -12864,6 +13284,14 @@ void gc_heap::distribute_free_regions()
             const int n_heaps = 1;
 #endif //MULTIPLE_HEAPS
             ptrdiff_t budget_gen = max (hp->estimate_gen_growth (gen), 0);
+#ifdef DYNAMIC_HEAP_COUNT
+            if ((i >= n_active_heaps) && (gen == soh_gen0))
+            {
+                // retired heaps don't allocate so their free regions should go to the active heaps
+                // or get decommitted.
+                budget_gen = 0;
+            }
+#endif //DYNAMIC_HEAP_COUNT
             int kind = gen >= loh_generation;
             size_t budget_gen_in_region_units = (budget_gen + (region_size[kind] - 1)) / region_size[kind];
             dprintf (REGIONS_LOG, ("h%2d gen %d has an estimated growth of %zd bytes (%zd regions)", i, gen, budget_gen, budget_gen_in_region_units));
@@ -12880,6 +13308,7 @@ void gc_heap::distribute_free_regions()
     dprintf (1, ("moved %2zd regions (%8zd) to decommit based on time", num_decommit_regions_by_time, size_decommit_regions_by_time));
 
     global_free_huge_regions.transfer_regions (&global_regions_to_decommit[huge_free_region]);
+    global_free_huge_regions.transfer_regions (&global_regions_to_lazy_decommit[huge_free_region]);
 
     size_t free_space_in_huge_regions = global_free_huge_regions.get_size_free_regions();
 
@@ -12898,7 +13327,7 @@ void gc_heap::distribute_free_regions()
 
     for (int kind = basic_free_region; kind < kind_count; kind++)
     {
-        num_regions_to_decommit[kind] = surplus_regions[kind].get_num_free_regions();
+        num_regions_to_decommit[kind] = get_num_surplus_regions (surplus_regions[kind]);
 
         dprintf(REGIONS_LOG, ("%zd %s free regions, %zd regions budget, %zd regions on decommit list, %zd huge regions to consider",
             total_num_free_regions[kind],
@@ -13012,6 +13441,8 @@ void gc_heap::distribute_free_regions()
 
     for (int kind = basic_free_region; kind < kind_count; kind++)
     {
+        size_t num_local_regions_added[MAX_SURPLUS_NUMA_NODES] = {};
+        size_t num_remote_regions_added[MAX_SURPLUS_NUMA_NODES] = {};
 #ifdef MULTIPLE_HEAPS
         // now go through all the heaps and remove any free regions above the target count
         for (int i = 0; i < n_heaps; i++)
@@ -13027,10 +13458,26 @@ void gc_heap::distribute_free_regions()
                     hp->free_regions[kind].get_num_free_regions(),
                     heap_budget_in_region_units[i][kind]));
 
-                remove_surplus_regions (&hp->free_regions[kind], &surplus_regions[kind], heap_budget_in_region_units[i][kind]);
+                remove_surplus_regions (&hp->free_regions[kind], surplus_regions[kind], heap_budget_in_region_units[i][kind]);
+            }
+        }
+        // then give the heaps having too few free regions the surplus regions of their own NUMA node
+        for (int i = 0; i < n_heaps; i++)
+        {
+            gc_heap* hp = g_heaps[i];
+            int home_node = heap_select::find_numa_node_from_heap_no (i) % MAX_SURPLUS_NUMA_NODES;
+
+            if (hp->free_regions[kind].get_num_free_regions() < heap_budget_in_region_units[i][kind])
+            {
+                size_t num_remote_regions = 0;
+                int64_t num_added_regions = add_regions (&hp->free_regions[kind], surplus_regions[kind], home_node, true,
+                                                         heap_budget_in_region_units[i][kind], &num_remote_regions);
+                assert (num_remote_regions == 0);
+                num_local_regions_added[home_node] += (size_t)num_added_regions;
             }
         }
-        // finally go through all the heaps and distribute any surplus regions to heaps having too few free regions
+        // finally go through all the heaps and distribute any surplus regions to heaps having too few free regions,
+        // taking them from other NUMA nodes if we have to
         for (int i = 0; i < n_heaps; i++)
         {
             gc_heap* hp = g_heaps[i];
@@ -13039,26 +13486,63 @@ void gc_heap::distribute_free_regions()
             gc_heap* hp = pGenGCHeap;
             const int i = 0;
 #endif //MULTIPLE_HEAPS
+#ifdef MULTIPLE_HEAPS
+            int home_node = heap_select::find_numa_node_from_heap_no (i) % MAX_SURPLUS_NUMA_NODES;
+#else
+            int home_node = 0;
+#endif //MULTIPLE_HEAPS
 
             // second pass: fill all the regions having less than budget
             if (hp->free_regions[kind].get_num_free_regions() < heap_budget_in_region_units[i][kind])
             {
-                int64_t num_added_regions = add_regions (&hp->free_regions[kind], &surplus_regions[kind], heap_budget_in_region_units[i][kind]);
-                dprintf (REGIONS_LOG, ("added %zd %s regions to heap %d - now has %zd, budget is %zd",
+                size_t num_remote_regions = 0;
+                int64_t num_added_regions = add_regions (&hp->free_regions[kind], surplus_regions[kind], home_node, false,
+                                                         heap_budget_in_region_units[i][kind], &num_remote_regions);
+                num_local_regions_added[home_node] += (size_t)num_added_regions - num_remote_regions;
+                num_remote_regions_added[home_node] += num_remote_regions;
+                dprintf (REGIONS_LOG, ("added %zd %s regions to heap %d (%zd from other numa nodes) - now has %zd, budget is %zd",
                     (size_t)num_added_regions,
                     kind_name[kind],
                     i,
+                    num_remote_regions,
                     hp->free_regions[kind].get_num_free_regions(),
                     heap_budget_in_region_units[i][kind]));
             }
             hp->free_regions[kind].sort_by_committed_and_age();
         }
 
-        if (surplus_regions[kind].get_num_free_regions() > 0)
+        if (get_num_surplus_regions (surplus_regions[kind]) > 0)
         {
             assert (!"should have exhausted the surplus_regions");
-            global_regions_to_decommit[kind].transfer_regions (&surplus_regions[kind]);
+            for (int node = 0; node < MAX_SURPLUS_NUMA_NODES; node++)
+            {
+                global_regions_to_decommit[kind].transfer_regions (&surplus_regions[kind][node]);
+            }
+        }
+
+#ifdef MULTIPLE_HEAPS
+        if (EVENT_ENABLED (GCFreeRegionNumaLocality))
+        {
+            size_t num_free_regions_on_node[MAX_SURPLUS_NUMA_NODES] = {};
+            for (int i = 0; i < n_heaps; i++)
+            {
+                int node = heap_select::find_numa_node_from_heap_no (i) % MAX_SURPLUS_NUMA_NODES;
+                num_free_regions_on_node[node] += g_heaps[i]->free_regions[kind].get_num_free_regions();
+            }
+            for (int node = 0; node < MAX_SURPLUS_NUMA_NODES; node++)
+            {
+                if ((num_free_regions_on_node[node] + num_local_regions_added[node] + num_remote_regions_added[node]) != 0)
+                {
+                    FIRE_EVENT(GCFreeRegionNumaLocality,
+                               (uint32_t)node,
+                               (uint32_t)kind,
+                               (uint32_t)num_free_regions_on_node[node],
+                               (uint32_t)num_local_regions_added[node],
+                               (uint32_t)num_remote_regions_added[node]);
+                }
+            }
         }
+#endif //MULTIPLE_HEAPS
     }
 
 #ifdef MULTIPLE_HEAPS
@@ -13096,6 +13580,8 @@ void gc_heap::distribute_free_regions()
         }
     }
 #endif //MULTIPLE_HEAPS
+
+    fire_decommit_churn_event();
 #endif //USE_REGIONS
 }
 
@@ -13233,6 +13719,8 @@ void gc_heap::update_card_table_bundle()
 void gc_heap::reset_write_watch_for_gc_heap(void* base_address, size_t region_size)
 {
 #ifdef FEATURE_USE_SOFTWARE_WRITE_WATCH_FOR_GC_HEAP
+    // OS write watch can't be reset for a range, see os_write_watch_for_gc_heap_p
+    assert (!os_write_watch_for_gc_heap_p);
     SoftwareWriteWatch::ClearDirty(base_address, region_size);
 #else // !FEATURE_USE_SOFTWARE_WRITE_WATCH_FOR_GC_HEAP
     GCToOSInterface::ResetWriteWatch(base_address, region_size);
@@ -13245,6 +13733,16 @@ void gc_heap::get_write_watch_for_gc_heap(bool reset, void *base_address, size_t
                                           bool is_runtime_suspended)
 {
 #ifdef FEATURE_USE_SOFTWARE_WRITE_WATCH_FOR_GC_HEAP
+    if (os_write_watch_for_gc_heap_p)
+    {
+        // We can't reset just this range so pages stay dirty till the next BGC resets
+        // them all; revisiting a page again only costs time.
+        bool success = GCToOSInterface::GetProcessWriteWatch(base_address, region_size, dirty_pages,
+                                                            dirty_page_count_ref);
+        assert(success);
+        return;
+    }
+
     SoftwareWriteWatch::GetDirty(base_address, region_size, dirty_pages, dirty_page_count_ref,
                                  reset, is_runtime_suspended);
 #else // !FEATURE_USE_SOFTWARE_WRITE_WATCH_FOR_GC_HEAP
@@ -13651,6 +14149,9 @@ HRESULT gc_heap::initialize_gc (size_t soh_segment_size,
         gc_can_use_concurrent = true;
 #ifndef FEATURE_USE_SOFTWARE_WRITE_WATCH_FOR_GC_HEAP
         virtual_alloc_hardware_write_watch = true;
+#else // !FEATURE_USE_SOFTWARE_WRITE_WATCH_FOR_GC_HEAP
+        os_write_watch_for_gc_heap_p = GCConfig::GetGCOSWriteWatch() && GCToOSInterface::SupportsProcessWriteWatch();
+        dprintf (1, ("BGC uses %s write watch", (os_write_watch_for_gc_heap_p ? "OS" : "software")));
 #endif // !FEATURE_USE_SOFTWARE_WRITE_WATCH_FOR_GC_HEAP
     }
     else
@@ -14090,6 +14591,38 @@ gc_heap::init_semi_shared()
 
     dprintf (1, ("conserve_mem_setting = %d", conserve_mem_setting));
 
+    pause_target_us = (uint64_t)GCConfig::GetGCPauseTargetMs() * 1000;
+    full_blocking_pause_us_per_mb[0] = 0.0;
+    full_blocking_pause_us_per_mb[1] = 0.0;
+
+    dprintf (1, ("pause_target_us = %zd", (size_t)pause_target_us));
+
+#ifdef USE_REGIONS
+    // with a hard limit we want the commit to go away when we say it does, and
+    // large pages can't be reset or decommitted anyway.
+    if (!heap_hard_limit && !use_large_pages_p)
+    {
+        lazy_decommit_gcs = (int)min (max (GCConfig::GetGCLazyDecommitGCs(), (int64_t)0), (int64_t)MAX_AGE_IN_FREE);
+    }
+
+    dprintf (1, ("lazy_decommit_gcs = %d", lazy_decommit_gcs));
+#endif //USE_REGIONS
+
+#ifdef DYNAMIC_HEAP_COUNT
+    n_active_heaps = n_heaps;
+    dynamic_heap_count_p = GCConfig::GetGCDynamicHeapCount() && (n_heaps > 1);
+    if (dynamic_heap_count_p)
+    {
+        int target = (int)GCConfig::GetGCDynamicHeapCountTarget();
+        dynamic_heap_count_target_cost = (float)min (max (target, 1), 50);
+        // start small, we'll grow quickly if GC turns out to be expensive.
+        n_active_heaps = 1;
+    }
+
+    dprintf (1, ("dynamic heap count %s, target %d%%, starting with %d/%d heaps",
+        (dynamic_heap_count_p ? "on" : "off"), (int)dynamic_heap_count_target_cost, n_active_heaps, n_heaps));
+#endif //DYNAMIC_HEAP_COUNT
+
     ret = 1;
 
 cleanup:
@@ -14377,6 +14910,10 @@ gc_heap::init_gc_heap (int h_number)
 
     allocation_quantum = CLR_SIZE;
 
+    max_allocation_quantum = CLR_SIZE;
+
+    soh_alloc_refills = 0;
+
     more_space_lock_soh = gc_lock;
 
     more_space_lock_uoh = gc_lock;
@@ -14560,7 +15097,14 @@ gc_heap::init_gc_heap (int h_number)
 
 #endif //MULTIPLE_HEAPS
 
-    generation_of (max_generation)->free_list_allocator = allocator(NUM_GEN2_ALIST, BASE_GEN2_ALIST_BITS, gen2_alloc_list, max_generation);
+    if (GCConfig::GetGCGen2SizeClasses())
+    {
+        generation_of (max_generation)->free_list_allocator = allocator(NUM_GEN2_SC_ALIST, BASE_GEN2_SC_ALIST_BITS, gen2_alloc_list, max_generation, GEN2_SIZE_CLASS_BITS);
+    }
+    else
+    {
+        generation_of (max_generation)->free_list_allocator = allocator(NUM_GEN2_ALIST, BASE_GEN2_ALIST_BITS, gen2_alloc_list, max_generation);
+    }
     generation_of (loh_generation)->free_list_allocator = allocator(NUM_LOH_ALIST, BASE_LOH_ALIST_BITS, loh_alloc_list);
     generation_of (poh_generation)->free_list_allocator = allocator(NUM_POH_ALIST, BASE_POH_ALIST_BITS, poh_alloc_list);
 
@@ -14581,6 +15125,28 @@ gc_heap::init_gc_heap (int h_number)
 
     make_mark_stack(arr);
 
+    size_t mark_prefetch_depth = (size_t)GCConfig::GetGCMarkPrefetchDepth();
+    mark_queue.set_depth (mark_prefetch_depth);
+#ifdef BACKGROUND_GC
+    background_mark_queue.set_depth (mark_prefetch_depth);
+#endif //BACKGROUND_GC
+
+#ifdef MH_SC_MARK
+    uint8_t** mark_deque_arr = new (nothrow) (uint8_t* [mark_deque_capacity]);
+    if (!mark_deque_arr)
+        return 0;
+
+    mark_deque.init (mark_deque_arr, mark_deque_capacity);
+#endif //MH_SC_MARK
+
+#ifdef FEATURE_BGC_SWEEP_STEALING
+    bgc_sweep_regions = nullptr;
+    bgc_sweep_regions_capacity = 0;
+    bgc_sweep_region_count = 0;
+    bgc_sweep_steal_index = 0;
+    bgc_sweep_stealers = 0;
+#endif //FEATURE_BGC_SWEEP_STEALING
+
 #ifdef BACKGROUND_GC
 #ifdef BGC_SERVO_TUNING
     loh_a_no_bgc = 0;
@@ -14764,6 +15330,14 @@ gc_heap::self_destroy()
     // destroy the mark stack
     delete mark_stack_array;
 
+#ifdef MH_SC_MARK
+    mark_deque.destroy();
+#endif //MH_SC_MARK
+
+#ifdef FEATURE_BGC_SWEEP_STEALING
+    delete[] bgc_sweep_regions;
+#endif //FEATURE_BGC_SWEEP_STEALING
+
 #ifdef FEATURE_PREMORTEM_FINALIZATION
     if (finalize_queue)
         delete finalize_queue;
@@ -14872,6 +15446,13 @@ BOOL gc_heap::grow_heap_segment (heap_segment* seg, uint8_t* high_address, bool*
 
     size_t c_size = align_on_page ((size_t)(high_address - heap_segment_committed (seg)));
     c_size = max (c_size, commit_min_th);
+#ifdef USE_REGIONS
+    if (use_region_huge_pages_p)
+    {
+        // commit up to a huge page boundary so the OS can back the whole huge page at once
+        c_size = (size_t)(align_on_huge_page (heap_segment_committed (seg) + c_size) - heap_segment_committed (seg));
+    }
+#endif //USE_REGIONS
     c_size = min (c_size, (size_t)(heap_segment_reserved (seg) - heap_segment_committed (seg)));
 
     if (c_size == 0)
@@ -15248,13 +15829,27 @@ void gc_heap::check_batch_mark_array_bits (uint8_t* start, uint8_t* end)
 }
 #endif //VERIFY_HEAP && BACKGROUND_GC
 
-allocator::allocator (unsigned int num_b, int fbb, alloc_list* b, int gen)
+allocator::allocator (unsigned int num_b, int fbb, alloc_list* b, int gen, int scb)
 {
     assert (num_b < MAX_BUCKET_COUNT);
     num_buckets = num_b;
     first_bucket_bits = fbb;
     buckets = b;
     gen_number = gen;
+
+    size_class_bits = scb;
+    if (scb != 0)
+    {
+        size_class_limit = first_bucket_size();
+        // bucket 0 of the power of 2 buckets is covered by the size classes
+        size_class_offset = (unsigned int)(size_class_limit >> scb) - 1;
+        assert (size_class_offset < num_buckets);
+    }
+    else
+    {
+        size_class_limit = 0;
+        size_class_offset = 0;
+    }
 }
 
 alloc_list& allocator::alloc_list_of (unsigned int bn)
@@ -15943,6 +16538,12 @@ void gc_heap::adjust_limit_clr (uint8_t* start, size_t limit_size, size_t size,
     }
 #endif //MULTIPLE_HEAPS
 
+    if (gen_number == 0)
+    {
+        acontext->alloc_refill_count++;
+        soh_alloc_refills++;
+    }
+
     dprintf (3, ("Expanding segment allocation [%zx, %zx[", (size_t)start,
                (size_t)start + limit_size - aligned_min_obj_size));
 
@@ -16138,8 +16739,35 @@ size_t gc_heap::new_allocation_limit (size_t size, size_t physical_limit, int ge
     return limit;
 }
 
+// The allocation quantum is sized per context from how often the context was refilled recently.
+// Contexts that come back for more space often get larger quantums so they take the slow path
+// less often, and contexts that rarely allocate get smaller ones so they don't hold on to gen0
+// space they won't use.
+size_t gc_heap::soh_allocation_quantum (alloc_context* acontext)
+{
+    if (!adaptive_alloc_quantum_p)
+    {
+        return allocation_quantum;
+    }
+
+    int refills = acontext->alloc_refill_count;
+    size_t quantum = allocation_quantum;
+
+    if (refills <= 0)
+    {
+        quantum /= 2;
+    }
+    else
+    {
+        quantum <<= min (index_of_highest_set_bit ((size_t)refills + 1) - 1, MAX_ALLOC_QUANTUM_SHIFT);
+        quantum = min (quantum, max_allocation_quantum);
+    }
+
+    return Align (max (quantum, MIN_ALLOC_QUANTUM), get_alignment_constant (TRUE));
+}
+
 size_t gc_heap::limit_from_size (size_t size, uint32_t flags, size_t physical_limit, int gen_number,
-                                 int align_const)
+                                 int align_const, alloc_context* acontext)
 {
     size_t padded_size = size + Align (min_obj_size, align_const);
     // for LOH this is not true...we could select a physical_limit that's exactly the same
@@ -16148,7 +16776,7 @@ size_t gc_heap::limit_from_size (size_t size, uint32_t flags, size_t physical_li
 
     // For SOH if the size asked for is very small, we want to allocate more than just what's asked for if possible.
     // Unless we were told not to clean, then we will not force it.
-    size_t min_size_to_allocate = ((gen_number == 0 && !(flags & GC_ALLOC_ZEROING_OPTIONAL)) ? allocation_quantum : 0);
+    size_t min_size_to_allocate = ((gen_number == 0 && !(flags & GC_ALLOC_ZEROING_OPTIONAL)) ? soh_allocation_quantum (acontext) : 0);
 
     size_t desired_size_to_allocate  = max (padded_size, min_size_to_allocate);
     size_t new_physical_limit = min (physical_limit, desired_size_to_allocate);
@@ -16510,7 +17138,7 @@ BOOL gc_heap::a_fit_free_list_p (int gen_number,
                 // We ask for more Align (min_obj_size)
                 // to make sure that we can insert a free object
                 // in adjust_limit will set the limit lower
-                size_t limit = limit_from_size (size, flags, free_list_size, gen_number, align_const);
+                size_t limit = limit_from_size (size, flags, free_list_size, gen_number, align_const, acontext);
                 dd_new_allocation (dynamic_data_of (gen_number)) -= limit;
 
                 uint8_t*  remain = (free_list + limit);
@@ -16697,7 +17325,7 @@ BOOL gc_heap::a_fit_free_list_uoh_p (size_t size,
 
                 // Subtract min obj size because limit_from_size adds it. Not needed for LOH
                 size_t limit = limit_from_size (size - Align(min_obj_size, align_const), flags, free_list_size,
-                                                gen_number, align_const);
+                                                gen_number, align_const, acontext);
                 dd_new_allocation (dynamic_data_of (gen_number)) -= limit;
 
 #ifdef FEATURE_LOH_COMPACTION
@@ -16793,7 +17421,7 @@ BOOL gc_heap::a_fit_segment_end_p (int gen_number,
         limit = limit_from_size (size,
                                  flags,
                                  (end - allocated),
-                                 gen_number, align_const);
+                                 gen_number, align_const, acontext);
         goto found_fit;
     }
 
@@ -16804,7 +17432,7 @@ BOOL gc_heap::a_fit_segment_end_p (int gen_number,
         limit = limit_from_size (size,
                                  flags,
                                  (end - allocated),
-                                 gen_number, align_const);
+                                 gen_number, align_const, acontext);
 
         if (grow_heap_segment (seg, (allocated + limit), &hard_limit_short_seg_end_p))
         {
@@ -18208,6 +18836,23 @@ void gc_heap::balance_heaps (alloc_context* acontext)
                 int org_hp_num = org_hp->heap_number;
                 int final_alloc_hp_num = org_hp_num;
 
+#ifdef DYNAMIC_HEAP_COUNT
+                if (org_hp_num >= n_active_heaps)
+                {
+                    // this heap was retired, don't bother balancing, just go to our home heap
+                    // which select_heap only picks from the active ones.
+                    gc_heap* new_home_hp = gc_heap::g_heaps[heap_select::select_heap (acontext)];
+                    dprintf (HEAP_BALANCE_TEMP_LOG, ("TEMPRetired h%d->h%d", org_hp_num, new_home_hp->heap_number));
+
+                    acontext->set_home_heap (new_home_hp->vm_heap);
+                    acontext->set_alloc_heap (new_home_hp->vm_heap);
+                    org_hp->alloc_context_count--;
+                    new_home_hp->alloc_context_count++;
+                    acontext->alloc_count++;
+                    return;
+                }
+#endif //DYNAMIC_HEAP_COUNT
+
                 dynamic_data* dd = org_hp->dynamic_data_of (0);
                 ptrdiff_t org_size = dd_new_allocation (dd);
                 ptrdiff_t total_size = (ptrdiff_t)dd_desired_allocation (dd);
@@ -18330,6 +18975,10 @@ void gc_heap::balance_heaps (alloc_context* acontext)
                                 heap_num -= n_heaps;
 
                             assert (heap_num < n_heaps);
+#ifdef DYNAMIC_HEAP_COUNT
+                            if (heap_num >= n_active_heaps)
+                                continue;
+#endif //DYNAMIC_HEAP_COUNT
                             gc_heap* hp = gc_heap::g_heaps[heap_num];
                             dd = hp->dynamic_data_of(0);
                             ptrdiff_t size = dd_new_allocation(dd);
@@ -18479,6 +19128,10 @@ try_again:
 
     for (int i = start; i < end; i++)
     {
+#ifdef DYNAMIC_HEAP_COUNT
+        if ((i % n_heaps) >= n_active_heaps)
+            continue;
+#endif //DYNAMIC_HEAP_COUNT
         gc_heap* hp = GCHeap::GetHeap(i%n_heaps)->pGenGCHeap;
         const ptrdiff_t size = hp->get_balance_heaps_uoh_effective_budget (generation_num);
 
@@ -18894,7 +19547,10 @@ uint8_t* gc_heap::allocate_in_older_generation (generation* gen, size_t size,
     if (! (size_fit_p (size REQD_ALIGN_AND_OFFSET_ARG, generation_allocation_pointer (gen),
                        generation_allocation_limit (gen), old_loc, USE_PADDING_TAIL | pad_in_front)))
     {
-        for (unsigned int a_l_idx = gen_allocator->first_suitable_bucket(real_size * 2);
+        // with size classes we can start where everything fits including the tail padding,
+        // otherwise we skip the bucket real_size is in since many of its items will be too small
+        size_t fit_size = gen_allocator->size_classes_p() ? (real_size + Align (min_obj_size)) : real_size;
+        for (unsigned int a_l_idx = gen_allocator->first_fitting_bucket (fit_size);
              a_l_idx < gen_allocator->number_of_buckets(); a_l_idx++)
         {
             uint8_t* free_list = 0;
@@ -19984,6 +20640,21 @@ int gc_heap::joined_generation_to_condemn (BOOL should_evaluate_elevation,
         }
     }
 
+#if defined(BACKGROUND_GC) && defined(USE_REGIONS)
+    if (sparse_region_compaction_pending_p &&
+        !gc_heap::background_running_p() &&
+        (settings.pause_mode != pause_sustained_low_latency))
+    {
+        dprintf (GTC_LOG, ("last BGC found enough sparse gen2 regions, gen%d->gen2 blocking", n));
+        gc_data_global.gen_to_condemn_reasons.set_condition (gen_joined_sparse_regions);
+
+        n = max_generation;
+        *blocking_collection_p = TRUE;
+        settings.sparse_region_compaction = TRUE;
+        sparse_region_compaction_pending_p = false;
+    }
+#endif //BACKGROUND_GC && USE_REGIONS
+
     if ((conserve_mem_setting != 0) && (n == max_generation))
     {
         float frag_limit = 1.0f - conserve_mem_setting / 10.0f;
@@ -20130,6 +20801,148 @@ size_t gc_heap::get_total_survived_size()
     return total_surv_size;
 }
 
+#ifdef DYNAMIC_HEAP_COUNT
+// This is called at the end of every blocking GC by the last thread to join, before we
+// equalize the budgets and distribute the free regions, so a new heap count takes effect
+// right away. We measure the cost of GC as the % of the time since the end of the previous
+// GC that was spent in this one; memory is what we pay for each active heap since each of
+// them gets its own gen0 budget and free regions. So when GC is expensive we add heaps (as
+// long as we are not short on memory) and when it's cheap we retire heaps.
+void gc_heap::update_dynamic_heap_count()
+{
+    if (!dynamic_heap_count_p)
+    {
+        return;
+    }
+
+    uint64_t now = GetHighPrecisionTimeStamp();
+    uint64_t gc_start = dd_time_clock (g_heaps[0]->dynamic_data_of (0));
+    uint64_t last_gc_end = dynamic_heap_count_last_gc_end;
+    dynamic_heap_count_last_gc_end = now;
+
+    // induced GCs don't tell us anything about what the allocation rate costs us.
+    if ((last_gc_end == 0) || (last_gc_end >= gc_start) || (settings.reason == reason_induced) ||
+        (settings.reason == reason_induced_compacting) || (settings.reason == reason_induced_aggressive))
+    {
+        return;
+    }
+
+    float cost = (float)((double)(now - gc_start) * 100.0 / (double)(now - last_gc_end));
+    dynamic_heap_count_samples[dynamic_heap_count_sample_index] = cost;
+    dynamic_heap_count_sample_index = (dynamic_heap_count_sample_index + 1) % dynamic_heap_count_sample_count;
+    dynamic_heap_count_samples_since_change++;
+
+    dprintf (REGIONS_LOG, ("GC#%zd cost %.2f%% with %d/%d heaps", (size_t)settings.gc_index, cost, n_active_heaps, n_heaps));
+
+    if (dynamic_heap_count_samples_since_change < dynamic_heap_count_sample_count)
+    {
+        return;
+    }
+
+    // the median is less influenced by the occasional long gen2 than the average
+    float s0 = dynamic_heap_count_samples[0];
+    float s1 = dynamic_heap_count_samples[1];
+    float s2 = dynamic_heap_count_samples[2];
+    float median_cost = max (min (s0, s1), min (max (s0, s1), s2));
+
+    int new_n_active_heaps = n_active_heaps;
+    if (median_cost > dynamic_heap_count_target_cost)
+    {
+        bool high_memory_load_p = (settings.entry_memory_load >= high_memory_load_th);
+        if (!high_memory_load_p)
+        {
+            // way above the target means we are probably just starting up or the load just went up a
+            // lot, so grow fast; otherwise grow by a quarter.
+            int step = (median_cost > (2 * dynamic_heap_count_target_cost)) ?
+                n_active_heaps : max ((n_active_heaps / 4), 1);
+            new_n_active_heaps = min ((n_active_heaps + step), n_heaps);
+        }
+    }
+    else if (median_cost < (dynamic_heap_count_target_cost / 3))
+    {
+        // shrink slowly, each heap we retire makes the remaining ones do more GCs.
+        new_n_active_heaps = max ((n_active_heaps - max ((n_active_heaps / 8), 1)), 1);
+    }
+
+    if (new_n_active_heaps != n_active_heaps)
+    {
+        dprintf (REGIONS_LOG, ("median cost %.2f%% (target %.2f%%), changing active heaps %d->%d",
+            median_cost, dynamic_heap_count_target_cost, n_active_heaps, new_n_active_heaps));
+
+        if (EVENT_ENABLED (GCDynamicHeapCountChange))
+        {
+            FIRE_EVENT(GCDynamicHeapCountChange, (uint32_t)n_active_heaps, (uint32_t)new_n_active_heaps,
+                (uint32_t)(median_cost * 100));
+        }
+
+        n_active_heaps = new_n_active_heaps;
+        dynamic_heap_count_samples_since_change = 0;
+    }
+}
+#endif //DYNAMIC_HEAP_COUNT
+
+// The cost of a blocking gen2 is dominated by marking and then compacting or sweeping
+// what survives, so we model its pause as linear in the promoted bytes with a separate
+// rate for compacting and sweeping gen2s.
+void gc_heap::update_full_blocking_pause_model (bool compact_p, size_t pause_duration, size_t promoted)
+{
+    const double mb = 1024.0 * 1024.0;
+    double sample = (double)pause_duration / max (((double)promoted / mb), 1.0);
+    double& rate = full_blocking_pause_us_per_mb[compact_p ? 1 : 0];
+
+    // weigh the new sample at 1/4 so one unusual GC doesn't swing our decisions
+    rate = ((rate == 0.0) ? sample : ((rate * 3.0 + sample) / 4.0));
+
+    dprintf (GTC_LOG, ("full blocking %s: %zd us for %zd MB promoted, now %.1f us/MB",
+        (compact_p ? "compact" : "sweep"), pause_duration, (promoted / 1024 / 1024), rate));
+}
+
+// Returns the predicted pause in us of a blocking gen2 done now or 0 if we have no
+// data to base it on.
+uint64_t gc_heap::predict_full_blocking_pause (bool compact_p)
+{
+    double rate = full_blocking_pause_us_per_mb[compact_p ? 1 : 0];
+    if (rate == 0.0)
+    {
+        return 0;
+    }
+
+    // what survived the last GC of each generation is our best guess at what a full
+    // GC would promote now.
+    size_t estimated_survived = 0;
+#ifdef MULTIPLE_HEAPS
+    for (int i = 0; i < gc_heap::n_heaps; i++)
+    {
+        gc_heap* hp = gc_heap::g_heaps[i];
+#else //MULTIPLE_HEAPS
+    {
+        gc_heap* hp = pGenGCHeap;
+#endif //MULTIPLE_HEAPS
+        for (int gen_number = 0; gen_number < total_generation_count; gen_number++)
+        {
+            estimated_survived += dd_current_size (hp->dynamic_data_of (gen_number));
+        }
+    }
+
+    return (uint64_t)(rate * ((double)estimated_survived / (1024.0 * 1024.0)));
+}
+
+bool gc_heap::full_blocking_pause_exceeds_target_p (bool compact_p)
+{
+    if (pause_target_us == 0)
+    {
+        return false;
+    }
+
+    uint64_t predicted_pause = predict_full_blocking_pause (compact_p);
+    bool exceeds_p = (predicted_pause > pause_target_us);
+
+    dprintf (GTC_LOG, ("predicted full blocking %s pause %zd us, target %zd us%s",
+        (compact_p ? "compact" : "sweep"), (size_t)predicted_pause, (size_t)pause_target_us,
+        (exceeds_p ? " - exceeded" : "")));
+    return exceeds_p;
+}
+
 size_t gc_heap::get_total_allocated_since_last_gc()
 {
     size_t total_allocated_size = 0;
@@ -20895,7 +21708,18 @@ int gc_heap::generation_to_condemn (int n_initial,
             local_condemn_reasons->set_condition (gen_max_high_frag_p);
             if (local_settings->pause_mode != pause_sustained_low_latency)
             {
-                *blocking_collection_p = TRUE;
+#ifdef BACKGROUND_GC
+                // With a pause target we'd rather leave the fragmentation to a BGC than do a
+                // compacting gen2 we predict would take longer than that.
+                if (gc_can_use_concurrent && full_blocking_pause_exceeds_target_p (true))
+                {
+                    dprintf (GTC_LOG, ("h%d: g%d too frag but over pause target - no BLOCK", heap_number, n));
+                }
+                else
+#endif //BACKGROUND_GC
+                {
+                    *blocking_collection_p = TRUE;
+                }
             }
         }
     }
@@ -21421,8 +22245,20 @@ void gc_heap::gc1()
             allocation_quantum = Align (min ((size_t)CLR_SIZE,
                                             (size_t)max (1024, get_new_allocation (0) / (2 * alloc_contexts_used))),
                                             get_alignment_constant(FALSE));
-            dprintf (3, ("New allocation quantum: %zd(0x%zx)", allocation_quantum, allocation_quantum));
+            max_allocation_quantum = Align (max (allocation_quantum,
+                                                 dd_desired_allocation (dynamic_data_of (0)) / MAX_ALLOC_QUANTUM_BUDGET_DIVISOR),
+                                            get_alignment_constant(FALSE));
+            dprintf (3, ("New allocation quantum: %zd(0x%zx), max %zd", allocation_quantum, allocation_quantum,
+                max_allocation_quantum));
         }
+
+        FIRE_EVENT(GCAllocQuantumStats,
+                   (uint32_t)heap_number,
+                   (uint32_t)soh_alloc_refills,
+                   (uint32_t)alloc_contexts_used,
+                   (uint32_t)allocation_quantum,
+                   (uint32_t)max_allocation_quantum);
+        soh_alloc_refills = 0;
     }
 #ifdef USE_REGIONS
     if (end_gen0_region_space == uninitialized_end_gen0_region_space)
@@ -21568,6 +22404,10 @@ void gc_heap::gc1()
         {
             gc_heap::internal_gc_done = false;
 
+#ifdef DYNAMIC_HEAP_COUNT
+            update_dynamic_heap_count();
+#endif //DYNAMIC_HEAP_COUNT
+
             //equalize the new desired size of the generations
             int limit = settings.condemned_generation;
             if (limit == max_generation)
@@ -21579,7 +22419,18 @@ void gc_heap::gc1()
                 size_t total_desired = 0;
                 size_t total_already_consumed = 0;
 
-                for (int i = 0; i < gc_heap::n_heaps; i++)
+                // Only the active heaps share the gen0 budget, the retired ones just keep the min
+                // budget. Older generations are still equalized over all heaps as we still promote
+                // into them on the retired heaps.
+                int n_budget_heaps = gc_heap::n_heaps;
+#ifdef DYNAMIC_HEAP_COUNT
+                if (gen == 0)
+                {
+                    n_budget_heaps = n_active_heaps;
+                }
+#endif //DYNAMIC_HEAP_COUNT
+
+                for (int i = 0; i < n_budget_heaps; i++)
                 {
                     gc_heap* hp = gc_heap::g_heaps[i];
                     dynamic_data* dd = hp->dynamic_data_of (gen);
@@ -21602,10 +22453,10 @@ void gc_heap::gc1()
                     total_already_consumed = temp_total_already_consumed;
                 }
 
-                size_t desired_per_heap = Align (total_desired/gc_heap::n_heaps,
+                size_t desired_per_heap = Align (total_desired/n_budget_heaps,
                                                     get_alignment_constant (gen <= max_generation));
 
-                size_t already_consumed_per_heap = total_already_consumed / gc_heap::n_heaps;
+                size_t already_consumed_per_heap = total_already_consumed / n_budget_heaps;
 
                 if (gen == 0)
                 {
@@ -21648,6 +22499,16 @@ void gc_heap::gc1()
                 {
                     gc_heap* hp = gc_heap::g_heaps[i];
                     dynamic_data* dd = hp->dynamic_data_of (gen);
+#ifdef DYNAMIC_HEAP_COUNT
+                    if (i >= n_budget_heaps)
+                    {
+                        dd_desired_allocation (dd) = dd_min_size (dd);
+                        dd_gc_new_allocation (dd) = dd_min_size (dd);
+                        dd_new_allocation (dd) = dd_min_size (dd);
+                        hp->fgn_last_alloc = dd_min_size (dd);
+                        continue;
+                    }
+#endif //DYNAMIC_HEAP_COUNT
                     dd_desired_allocation (dd) = desired_per_heap;
                     dd_gc_new_allocation (dd) = desired_per_heap;
 #ifdef USE_REGIONS
@@ -22936,7 +23797,10 @@ void gc_heap::garbage_collect (int n)
             if (do_concurrent_p)
             {
 #ifdef FEATURE_USE_SOFTWARE_WRITE_WATCH_FOR_GC_HEAP
-                SoftwareWriteWatch::EnableForGCHeap();
+                if (!os_write_watch_for_gc_heap_p)
+                {
+                    SoftwareWriteWatch::EnableForGCHeap();
+                }
 #endif //FEATURE_USE_SOFTWARE_WRITE_WATCH_FOR_GC_HEAP
 
 #ifdef MULTIPLE_HEAPS
@@ -24169,14 +25033,29 @@ BOOL ref_p (uint8_t* r)
     return (straight_ref_p (r) || partial_object_p (r));
 }
 
-mark_queue_t::mark_queue_t() : curr_slot_index(0)
+mark_queue_t::mark_queue_t() : curr_slot_index(0), slot_mask(default_slot_count - 1)
 {
-    for (size_t i = 0; i < slot_count; i++)
+    for (size_t i = 0; i < max_slot_count; i++)
     {
         slot_table[i] = nullptr;
     }
 }
 
+// how far ahead of marking an object we prefetch it - deeper queues hide more
+// latency but the objects may get evicted again before we get to them
+void mark_queue_t::set_depth (size_t depth)
+{
+    verify_empty();
+
+    size_t slot_count = 1;
+    while ((slot_count * 2 <= depth) && (slot_count < max_slot_count))
+    {
+        slot_count *= 2;
+    }
+    slot_mask = slot_count - 1;
+    curr_slot_index = 0;
+}
+
 // place an object in the mark queue
 // returns a *different* object or nullptr
 // if a non-null object is returned, that object is newly marked
@@ -24193,7 +25072,7 @@ uint8_t *mark_queue_t::queue_mark(uint8_t *o)
     uint8_t* old_o = slot_table[slot_index];
     slot_table[slot_index] = o;
 
-    curr_slot_index = (slot_index + 1) % slot_count;
+    curr_slot_index = (slot_index + 1) & slot_mask;
     if (old_o == nullptr)
         return nullptr;
 
@@ -24249,11 +25128,11 @@ uint8_t* mark_queue_t::get_next_marked()
 {
     size_t slot_index = curr_slot_index;
     size_t empty_slot_count = 0;
-    while (empty_slot_count < slot_count)
+    while (empty_slot_count <= slot_mask)
     {
         uint8_t* o = slot_table[slot_index];
         slot_table[slot_index] = nullptr;
-        slot_index = (slot_index + 1) % slot_count;
+        slot_index = (slot_index + 1) & slot_mask;
         if (o != nullptr)
         {
             BOOL already_marked = marked (o);
@@ -24269,14 +25148,177 @@ uint8_t* mark_queue_t::get_next_marked()
     return nullptr;
 }
 
+#ifdef BACKGROUND_GC
+// place an object in the mark queue without marking it
+// returns the object that has been sitting in the queue the longest or nullptr,
+// it's up to the caller to mark it
+FORCEINLINE
+uint8_t* mark_queue_t::queue_prefetch (uint8_t* o)
+{
+    Prefetch (o);
+
+    size_t slot_index = curr_slot_index;
+    uint8_t* old_o = slot_table[slot_index];
+    slot_table[slot_index] = o;
+
+    curr_slot_index = (slot_index + 1) & slot_mask;
+    return old_o;
+}
+
+// retrieve an object from the queue without marking it
+// returns nullptr if the queue is empty
+uint8_t* mark_queue_t::get_next_queued()
+{
+    size_t slot_index = curr_slot_index;
+    for (size_t i = 0; i <= slot_mask; i++)
+    {
+        uint8_t* o = slot_table[slot_index];
+        slot_table[slot_index] = nullptr;
+        slot_index = (slot_index + 1) & slot_mask;
+        if (o != nullptr)
+        {
+            curr_slot_index = slot_index;
+            return o;
+        }
+    }
+    return nullptr;
+}
+
+// the objects parked in the queue are roots for a foreground GC that happens
+// while they are waiting to be marked, and they need to be relocated if it compacts
+void mark_queue_t::scan_queued (promote_func* fn, ScanContext* sc)
+{
+    for (size_t slot_index = 0; slot_index <= slot_mask; slot_index++)
+    {
+        if (slot_table[slot_index] != nullptr)
+        {
+            (*fn) ((Object**)&slot_table[slot_index], sc, 0);
+        }
+    }
+}
+#endif //BACKGROUND_GC
+
 void mark_queue_t::verify_empty()
 {
-    for (size_t slot_index = 0; slot_index < slot_count; slot_index++)
+    for (size_t slot_index = 0; slot_index < max_slot_count; slot_index++)
     {
         assert(slot_table[slot_index] == nullptr);
     }
 }
 
+#ifdef MH_SC_MARK
+mark_deque_t::mark_deque_t() : buffer(nullptr), mask(0), top(0), bottom(0)
+{
+}
+
+void mark_deque_t::init (uint8_t** arr, int32_t capacity)
+{
+    assert ((capacity & (capacity - 1)) == 0);
+    buffer = arr;
+    mask = capacity - 1;
+    reset();
+}
+
+void mark_deque_t::destroy()
+{
+    delete [] (uint8_t**)buffer;
+    buffer = nullptr;
+}
+
+// must only be called when no other heap can be stealing from this deque
+void mark_deque_t::reset()
+{
+    top = 0;
+    bottom = 0;
+}
+
+int32_t mark_deque_t::count()
+{
+    return (VolatileLoad (&bottom) - VolatileLoad (&top));
+}
+
+// only called by the owning heap
+bool mark_deque_t::push (uint8_t* o)
+{
+    int32_t b = bottom;
+    int32_t t = VolatileLoad (&top);
+    if ((b - t) > mask)
+    {
+        return false;
+    }
+
+    buffer[b & mask] = o;
+    // publish the entry before the new bottom
+    VolatileStore (&bottom, b + 1);
+    return true;
+}
+
+// only called by the owning heap
+uint8_t* mark_deque_t::pop()
+{
+    int32_t b = bottom - 1;
+    VolatileStore (&bottom, b);
+    // the store to bottom must be visible before we read top, otherwise we and
+    // a thief could both take the last entry.
+    MemoryBarrier();
+    int32_t t = VolatileLoad (&top);
+
+    if (t > b)
+    {
+        // empty
+        VolatileStore (&bottom, t);
+        return nullptr;
+    }
+
+    uint8_t* o = buffer[b & mask];
+    if (t == b)
+    {
+        // this is the last entry - race the thieves for it
+        if (Interlocked::CompareExchange (&top, t + 1, t) != t)
+        {
+            o = nullptr;
+        }
+        VolatileStore (&bottom, t + 1);
+    }
+    return o;
+}
+
+// called by other heaps; returns nullptr if the deque is empty or we lost
+// the race for the top entry.
+uint8_t* mark_deque_t::steal()
+{
+    int32_t t = VolatileLoad (&top);
+    MemoryBarrier();
+    int32_t b = VolatileLoad (&bottom);
+
+    if (t >= b)
+    {
+        return nullptr;
+    }
+
+    uint8_t* o = buffer[t & mask];
+    if (Interlocked::CompareExchange (&top, t + 1, t) != t)
+    {
+        return nullptr;
+    }
+    return o;
+}
+
+// When other heaps are idle in mark_steal, hand them o (already marked, with its
+// children still to be marked) through our mark deque instead of pushing it on the
+// mark stack. Returns false if o should go on the mark stack as usual.
+inline
+bool gc_heap::share_mark (uint8_t* o)
+{
+    if ((mark_steal_idle_heaps == 0) || (mark_deque.count() >= mark_deque_share_limit))
+    {
+        return false;
+    }
+
+    return mark_deque.push (o);
+}
+#endif //MH_SC_MARK
+
 void gc_heap::mark_object_simple1 (uint8_t* oo, uint8_t* start THREAD_NUMBER_DCL)
 {
     SERVER_SC_MARK_VOLATILE(uint8_t*)* mark_stack_tos = (SERVER_SC_MARK_VOLATILE(uint8_t*)*)mark_stack_array;
@@ -24348,7 +25390,11 @@ void gc_heap::mark_object_simple1 (uint8_t* oo, uint8_t* start THREAD_NUMBER_DCL
                                                       m_boundary (o);
                                                   }
                                                   add_to_promoted_bytes (o, thread);
+#ifdef MH_SC_MARK
+                                                  if (contain_pointers_or_collectible (o) && !share_mark (o))
+#else //MH_SC_MARK
                                                   if (contain_pointers_or_collectible (o))
+#endif //MH_SC_MARK
                                                   {
                                                       *(mark_stack_tos++) = o;
                                                   }
@@ -24445,7 +25491,11 @@ void gc_heap::mark_object_simple1 (uint8_t* oo, uint8_t* start THREAD_NUMBER_DCL
                                                     m_boundary (o);
                                                 }
                                                 add_to_promoted_bytes (o, thread);
+#ifdef MH_SC_MARK
+                                                if (contain_pointers_or_collectible (o) && !share_mark (o))
+#else //MH_SC_MARK
                                                 if (contain_pointers_or_collectible (o))
+#endif //MH_SC_MARK
                                                 {
                                                     *(mark_stack_tos++) = o;
                                                     if (--i == 0)
@@ -24506,6 +25556,14 @@ more_to_do:
             sorted_tos = min ((size_t)sorted_tos, (size_t)mark_stack_tos);
 #endif //SORT_MARK_STACK
         }
+#ifdef MH_SC_MARK
+        // our mark stack is empty, take back whatever the other heaps have not
+        // stolen from our deque yet.
+        else if ((oo = mark_deque.pop()) != nullptr)
+        {
+            start = oo;
+        }
+#endif //MH_SC_MARK
         else
             break;
     }
@@ -24542,6 +25600,9 @@ gc_heap::mark_steal()
     //pick the next heap as our buddy
     int thpn = find_next_buddy_heap (heap_number, heap_number, n_heaps);
 
+    uint64_t steal_start_time = GetHighPrecisionTimeStamp();
+    Interlocked::Increment (&mark_steal_idle_heaps);
+
 #ifdef SNOOP_STATS
         dprintf (SNOOP_LOG, ("(GC%d)heap%d: start snooping %d", settings.gc_index, heap_number, (heap_number+1)%n_heaps));
         uint64_t begin_tick = GCToOSInterface::GetLowPrecisionTimeStamp();
@@ -24556,6 +25617,14 @@ gc_heap::mark_steal()
         int level = first_not_ready_level;
         first_not_ready_level = 0;
 
+        // work hp has shared through its mark deque is cheaper to take than
+        // snooping its mark stack.
+        if (steal_mark_batch (hp))
+        {
+            idle_loop_count = 0;
+            continue;
+        }
+
         while (check_next_mark_stack (hp) && (level < (max_snoop_level-1)))
         {
             idle_loop_count = 0;
@@ -24650,8 +25719,14 @@ gc_heap::mark_steal()
                     uint64_t start_tick = GCToOSInterface::GetLowPrecisionTimeStamp();
 #endif //SNOOP_STATS
 
+                    Interlocked::Decrement (&mark_steal_idle_heaps);
+                    uint64_t work_start_time = GetHighPrecisionTimeStamp();
+
                     mark_object_simple1 (o, start, heap_number);
 
+                    mark_steal_work_time += GetHighPrecisionTimeStamp() - work_start_time;
+                    Interlocked::Increment (&mark_steal_idle_heaps);
+
 #ifdef SNOOP_STATS
                     dprintf (SNOOP_LOG, ("heap%d: done marking %zx from %d [%d] %dms tl:%dms",
                             heap_number, (size_t)o, (heap_number+1)%n_heaps, level,
@@ -24726,6 +25801,80 @@ gc_heap::mark_steal()
             }
         }
     }
+
+    Interlocked::Decrement (&mark_steal_idle_heaps);
+    assert (mark_deque.count() == 0);
+
+    uint64_t steal_time = GetHighPrecisionTimeStamp() - steal_start_time;
+    mark_steal_idle_time = (steal_time > mark_steal_work_time) ? (steal_time - mark_steal_work_time) : 0;
+
+    dprintf (3, ("h%d mark steal: %zd us marking, %zd us idle, %zd objects stolen in %zd batches",
+        heap_number, (size_t)mark_steal_work_time, (size_t)mark_steal_idle_time,
+        mark_steal_object_count, mark_steal_batch_count));
+
+    FIRE_EVENT(GCMarkStealStats,
+               (uint32_t)heap_number,
+               (uint32_t)mark_steal_work_time,
+               (uint32_t)mark_steal_idle_time,
+               (uint32_t)mark_steal_object_count,
+               (uint32_t)mark_steal_batch_count);
+}
+
+// Take up to mark_steal_batch_size objects from victim's mark deque and mark
+// through them. Returns FALSE if there was nothing to take.
+BOOL gc_heap::steal_mark_batch (gc_heap* victim)
+{
+    if (victim->mark_deque.count() <= 0)
+    {
+        return FALSE;
+    }
+
+    // we hold stolen work from here on, so we must look busy to the other heaps
+    // or they could decide marking is done.
+    mark_stack_busy() = 1;
+
+    uint8_t* batch[mark_steal_batch_size];
+    int batch_count = 0;
+    while (batch_count < mark_steal_batch_size)
+    {
+        uint8_t* o = victim->mark_deque.steal();
+        if (o == nullptr)
+        {
+            break;
+        }
+        batch[batch_count++] = o;
+    }
+
+    if (batch_count == 0)
+    {
+        mark_stack_busy() = 0;
+        return FALSE;
+    }
+
+    Interlocked::Decrement (&mark_steal_idle_heaps);
+    uint64_t work_start_time = GetHighPrecisionTimeStamp();
+
+    for (int i = 0; i < batch_count; i++)
+    {
+        mark_object_simple1 (batch[i], batch[i], heap_number);
+    }
+
+    mark_steal_work_time += GetHighPrecisionTimeStamp() - work_start_time;
+    mark_steal_batch_count++;
+    mark_steal_object_count += batch_count;
+    Interlocked::Increment (&mark_steal_idle_heaps);
+
+    //clear the mark stack in snooping range, mark_object_simple1 used it
+    for (int i = 0; i < max_snoop_level; i++)
+    {
+        if (((uint8_t**)mark_stack_array)[i] != 0)
+        {
+            ((VOLATILE(uint8_t*)*)(mark_stack_array))[i] = 0;
+        }
+    }
+
+    mark_stack_busy() = 0;
+    return TRUE;
 }
 
 inline
@@ -24971,6 +26120,67 @@ void gc_heap::set_background_overflow_p (uint8_t* oo)
 }
 #endif //USE_REGIONS
 
+// Parks o in the background mark queue while it and its mark array word are being
+// prefetched, and marks the object that has been parked the longest instead.
+// Returns that object if it got newly marked and needs to be marked through.
+inline
+uint8_t* gc_heap::background_queue_mark (uint8_t* o THREAD_NUMBER_DCL)
+{
+#ifndef MULTIPLE_HEAPS
+    const int thread = 0;
+#endif //MULTIPLE_HEAPS
+
+    if (o == nullptr)
+        return nullptr;
+
+    Prefetch (&mark_array[mark_word_of (o)]);
+    o = background_mark_queue.queue_prefetch (o);
+
+    if (background_mark (o,
+                         background_saved_lowest_address,
+                         background_saved_highest_address))
+    {
+        //m_boundary (o);
+        size_t obj_size = size (o);
+        bpromoted_bytes (thread) += obj_size;
+        if (contain_pointers_or_collectible (o))
+        {
+            return o;
+        }
+    }
+
+    return nullptr;
+}
+
+// Marks what's left in the background mark queue until it finds an object that needs
+// to be marked through, or returns nullptr once the queue is empty.
+uint8_t* gc_heap::background_next_queued_mark()
+{
+#ifdef MULTIPLE_HEAPS
+    THREAD_FROM_HEAP;
+#else
+    const int thread = 0;
+#endif //MULTIPLE_HEAPS
+
+    uint8_t* o;
+    while ((o = background_mark_queue.get_next_queued()) != nullptr)
+    {
+        if (background_mark (o,
+                             background_saved_lowest_address,
+                             background_saved_highest_address))
+        {
+            size_t obj_size = size (o);
+            bpromoted_bytes (thread) += obj_size;
+            if (contain_pointers_or_collectible (o))
+            {
+                return o;
+            }
+        }
+    }
+
+    return nullptr;
+}
+
 void gc_heap::background_mark_simple1 (uint8_t* oo THREAD_NUMBER_DCL)
 {
     uint8_t** mark_stack_limit = &background_mark_stack_array[background_mark_stack_array_length];
@@ -25017,20 +26227,10 @@ void gc_heap::background_mark_simple1 (uint8_t* oo THREAD_NUMBER_DCL)
 
                     go_through_object_cl (method_table(oo), oo, s, ppslot,
                     {
-                        uint8_t* o = *ppslot;
-                        Prefetch(o);
-                        if (background_mark (o,
-                                             background_saved_lowest_address,
-                                             background_saved_highest_address))
+                        uint8_t* o = background_queue_mark (*ppslot THREAD_NUMBER_ARG);
+                        if (o != nullptr)
                         {
-                            //m_boundary (o);
-                            size_t obj_size = size (o);
-                            bpromoted_bytes (thread) += obj_size;
-                            if (contain_pointers_or_collectible (o))
-                            {
-                                *(background_mark_stack_tos++) = o;
-
-                            }
+                            *(background_mark_stack_tos++) = o;
                         }
                     }
                         );
@@ -25116,26 +26316,15 @@ void gc_heap::background_mark_simple1 (uint8_t* oo THREAD_NUMBER_DCL)
                     go_through_object (method_table(oo), oo, s, ppslot,
                                        start, use_start, (oo + s),
                     {
-                        uint8_t* o = *ppslot;
-                        Prefetch(o);
-
-                        if (background_mark (o,
-                                            background_saved_lowest_address,
-                                            background_saved_highest_address))
+                        uint8_t* o = background_queue_mark (*ppslot THREAD_NUMBER_ARG);
+                        if (o != nullptr)
                         {
-                            //m_boundary (o);
-                            size_t obj_size = size (o);
-                            bpromoted_bytes (thread) += obj_size;
-                            if (contain_pointers_or_collectible (o))
+                            *(background_mark_stack_tos++) = o;
+                            if (--num_pushed_refs == 0)
                             {
-                                *(background_mark_stack_tos++) = o;
-                                if (--num_pushed_refs == 0)
-                                {
-                                    //update the start
-                                    *place = (uint8_t*)(ppslot+1);
-                                    goto more_to_do;
-                                }
-
+                                //update the start
+                                *place = (uint8_t*)(ppslot+1);
+                                goto more_to_do;
                             }
                         }
                         if (--num_processed_refs == 0)
@@ -25186,11 +26375,12 @@ next_level:
             sorted_tos = (uint8_t**)min ((size_t)sorted_tos, (size_t)background_mark_stack_tos);
 #endif //SORT_MARK_STACK
         }
-        else
+        else if ((oo = background_next_queued_mark()) == nullptr)
             break;
     }
 
     assert (background_mark_stack_tos == background_mark_stack_array);
+    background_mark_queue.verify_empty();
 
 
 }
@@ -25377,6 +26567,8 @@ gc_heap::scan_background_roots (promote_func* fn, int hn, ScanContext *pSC)
         (*fn) ((Object**)finger, pSC, 0);
         finger++;
     }
+
+    background_mark_queue.scan_queued (fn, pSC);
 }
 
 void gc_heap::grow_bgc_mark_stack (size_t new_size)
@@ -26100,6 +27292,9 @@ void gc_heap::scan_dependent_handles (int condemned_gen_number, ScanContext *sc,
     // based on the how the scanning proceeded).
     s_fUnscannedPromotions = TRUE;
 
+    // the initial scan was pass 0
+    int dh_pass = 0;
+
     // We don't know how many times we need to loop yet. In particular we can't base the loop condition on
     // the state of this thread's portion of the dependent handle table. That's because promotions on other
     // threads could cause handle promotions to become necessary here. Even if there are definitely no more
@@ -26146,6 +27341,12 @@ void gc_heap::scan_dependent_handles (int condemned_gen_number, ScanContext *sc,
             // one thread has a dependent handle table with a potential handle promotion possible.
             s_fScanRequired = s_fUnscannedPromotions && s_fUnpromotedHandles;
 
+            // shared rescans claim segments from the start again on every pass
+            if (s_fScanRequired && GCScan::GcDhReScanShared(sc))
+            {
+                GCScan::GcDhBeginReScan();
+            }
+
             // Reset our shared state variables (ready to be set again on this scan or with a good initial
             // value for the next call if we're terminating the loop).
             s_fUnscannedPromotions = FALSE;
@@ -26204,10 +27405,16 @@ void gc_heap::scan_dependent_handles (int condemned_gen_number, ScanContext *sc,
 
         // If the portion of the dependent handle table managed by this worker has handles that could still be
         // promoted perform a rescan. If the rescan resulted in at least one promotion note this fact since it
-        // could require a rescan of handles on this or other workers.
-        if (GCScan::GcDhUnpromotedHandlesExist(sc))
-            if (GCScan::GcDhReScan(sc))
+        // could require a rescan of handles on this or other workers. When the rescans are shared every worker
+        // takes part since the handles it scans aren't just its own.
+        if (GCScan::GcDhReScanShared(sc) || GCScan::GcDhUnpromotedHandlesExist(sc))
+        {
+            uint64_t pass_start = dh_scan_pass_start();
+            bool promoted_p = GCScan::GcDhReScan(sc);
+            fire_dh_scan_pass_event (++dh_pass, pass_start, promoted_p);
+            if (promoted_p)
                 s_fUnscannedPromotions = TRUE;
+        }
     }
 }
 #else //MULTIPLE_HEAPS
@@ -26222,6 +27429,9 @@ void gc_heap::scan_dependent_handles (int condemned_gen_number, ScanContext *sc,
     // based on the how the scanning proceeded).
     bool fUnscannedPromotions = true;
 
+    // the initial scan was pass 0
+    int dh_pass = 0;
+
     // Loop until there are either no more dependent handles that can have their secondary promoted or we've
     // managed to perform a scan without promoting anything new.
     while (GCScan::GcDhUnpromotedHandlesExist(sc) && fUnscannedPromotions)
@@ -26238,7 +27448,10 @@ void gc_heap::scan_dependent_handles (int condemned_gen_number, ScanContext *sc,
         drain_mark_queue();
 
         // Perform the scan and set the flag if any promotions resulted.
-        if (GCScan::GcDhReScan(sc))
+        uint64_t pass_start = dh_scan_pass_start();
+        bool promoted_p = GCScan::GcDhReScan(sc);
+        fire_dh_scan_pass_event (++dh_pass, pass_start, promoted_p);
+        if (promoted_p)
             fUnscannedPromotions = true;
     }
 
@@ -26312,6 +27525,42 @@ void gc_heap::fire_mark_event (int root_type, size_t& current_promoted_bytes, si
 #endif // FEATURE_EVENT_TRACE
 }
 
+// Returns the start time of a dependent handle scan pass for GCDependentHandleScanPass, or 0 if nobody
+// is listening.
+inline
+uint64_t gc_heap::dh_scan_pass_start()
+{
+#ifdef FEATURE_EVENT_TRACE
+    if (EVENT_ENABLED (GCDependentHandleScanPass))
+    {
+        return GetHighPrecisionTimeStamp();
+    }
+#endif //FEATURE_EVENT_TRACE
+    return 0;
+}
+
+// pass 0 is the initial scan, the rest are the rescans we do till no more secondaries get promoted.
+void gc_heap::fire_dh_scan_pass_event (int pass, uint64_t start_time, bool promoted_p)
+{
+#ifdef FEATURE_EVENT_TRACE
+    if ((start_time != 0) && EVENT_ENABLED (GCDependentHandleScanPass))
+    {
+        uint64_t elapsed = GetHighPrecisionTimeStamp() - start_time;
+        dprintf (3, ("h%d dependent handle scan pass %d took %zdus, promoted: %d",
+            heap_number, pass, (size_t)elapsed, promoted_p));
+        FIRE_EVENT(GCDependentHandleScanPass,
+                   (uint32_t)heap_number,
+                   (uint32_t)pass,
+                   limit_time_to_uint32 (elapsed),
+                   (uint32_t)promoted_p);
+    }
+#else
+    UNREFERENCED_PARAMETER(pass);
+    UNREFERENCED_PARAMETER(start_time);
+    UNREFERENCED_PARAMETER(promoted_p);
+#endif //FEATURE_EVENT_TRACE
+}
+
 #ifdef FEATURE_EVENT_TRACE
 inline
 void gc_heap::record_mark_time (uint64_t& mark_time,
@@ -26508,6 +27757,13 @@ void gc_heap::mark_phase (int condemned_gen_number, BOOL mark_only_p)
 
         mark_stack_busy() = 1;
     }
+
+    // nobody is marking yet so nobody can be stealing from us either
+    mark_deque.reset();
+    mark_steal_work_time = 0;
+    mark_steal_idle_time = 0;
+    mark_steal_batch_count = 0;
+    mark_steal_object_count = 0;
 #endif //MH_SC_MARK
 
     static uint32_t num_sizedrefs = 0;
@@ -26864,7 +28120,9 @@ void gc_heap::mark_phase (int condemned_gen_number, BOOL mark_only_p)
     // to optimize away further scans. The call to scan_dependent_handles is what will cycle through more
     // iterations if required and will also perform processing of any mark stack overflow once the dependent
     // handle table has been fully promoted.
+    uint64_t dh_initial_start = dh_scan_pass_start();
     GCScan::GcDhInitialScan(GCHeap::Promote, condemned_gen_number, max_generation, &sc);
+    fire_dh_scan_pass_event (0, dh_initial_start, false);
     scan_dependent_handles(condemned_gen_number, &sc, true);
     drain_mark_queue();
     fire_mark_event (ETW::GC_ROOT_DH_HANDLES, current_promoted_bytes, last_promoted_bytes);
@@ -30728,7 +31986,8 @@ void gc_heap::plan_phase (int condemned_gen_number)
                 // For plugs allocated in condemned we kept track of each one but only fire the
                 // event for buckets with non zero items.
                 uint16_t non_zero_buckets = 0;
-                for (uint16_t bucket_index = 0; bucket_index < NUM_GEN2_ALIST; bucket_index++)
+                uint16_t bucket_count = (uint16_t)generation_allocator (older_gen)->number_of_buckets();
+                for (uint16_t bucket_index = 0; bucket_index < bucket_count; bucket_index++)
                 {
                     if (bucket_info[bucket_index].count != 0)
                     {
@@ -31780,13 +33039,23 @@ bool gc_heap::should_sweep_in_plan (heap_segment* region)
         size_t basic_region_size = (size_t)1 << min_segment_size_shr;
         assert (heap_segment_gen_num (region) == heap_segment_plan_gen_num (region));
 
+        int surv_ratio_th = sip_surv_ratio_th;
+#if defined(BACKGROUND_GC) && defined(USE_REGIONS)
+        // when we are here to compact the sparse gen2 regions the last BGC found, everything
+        // else in gen2 is swept so we only move the sparse ones.
+        if (settings.sparse_region_compaction && (gen_num == max_generation))
+        {
+            surv_ratio_th = sparse_region_surv_ratio_th;
+        }
+#endif //BACKGROUND_GC && USE_REGIONS
+
         int surv_ratio = (int)(((double)heap_segment_survived (region) * 100.0) / (double)basic_region_size);
         dprintf (2222, ("SSIP: region %p surv %d / %zd = %d%%(%d)",
             heap_segment_mem (region),
             heap_segment_survived (region),
             basic_region_size,
-            surv_ratio, sip_surv_ratio_th));
-        if (surv_ratio >= sip_surv_ratio_th)
+            surv_ratio, surv_ratio_th));
+        if (surv_ratio >= surv_ratio_th)
         {
             set_region_plan_gen_num (region, new_gen_num);
             sip_p = true;
@@ -34340,6 +35609,9 @@ void gc_heap::background_scan_dependent_handles (ScanContext *sc)
     // based on the how the scanning proceeded).
     s_fUnscannedPromotions = TRUE;
 
+    // the initial scan was pass 0
+    int dh_pass = 0;
+
     // We don't know how many times we need to loop yet. In particular we can't base the loop condition on
     // the state of this thread's portion of the dependent handle table. That's because promotions on other
     // threads could cause handle promotions to become necessary here. Even if there are definitely no more
@@ -34384,6 +35656,12 @@ void gc_heap::background_scan_dependent_handles (ScanContext *sc)
             // one thread has a dependent handle table with a potential handle promotion possible.
             s_fScanRequired = s_fUnscannedPromotions && s_fUnpromotedHandles;
 
+            // shared rescans claim segments from the start again on every pass
+            if (s_fScanRequired && GCScan::GcDhReScanShared(sc))
+            {
+                GCScan::GcDhBeginReScan();
+            }
+
             // Reset our shared state variables (ready to be set again on this scan or with a good initial
             // value for the next call if we're terminating the loop).
             s_fUnscannedPromotions = FALSE;
@@ -34450,10 +35728,16 @@ void gc_heap::background_scan_dependent_handles (ScanContext *sc)
 
         // If the portion of the dependent handle table managed by this worker has handles that could still be
         // promoted perform a rescan. If the rescan resulted in at least one promotion note this fact since it
-        // could require a rescan of handles on this or other workers.
-        if (GCScan::GcDhUnpromotedHandlesExist(sc))
-            if (GCScan::GcDhReScan(sc))
+        // could require a rescan of handles on this or other workers. When the rescans are shared every worker
+        // takes part since the handles it scans aren't just its own.
+        if (GCScan::GcDhReScanShared(sc) || GCScan::GcDhUnpromotedHandlesExist(sc))
+        {
+            uint64_t pass_start = dh_scan_pass_start();
+            bool promoted_p = GCScan::GcDhReScan(sc);
+            fire_dh_scan_pass_event (++dh_pass, pass_start, promoted_p);
+            if (promoted_p)
                 s_fUnscannedPromotions = TRUE;
+        }
     }
 }
 #else
@@ -34464,6 +35748,9 @@ void gc_heap::background_scan_dependent_handles (ScanContext *sc)
     // based on the how the scanning proceeded).
     bool fUnscannedPromotions = true;
 
+    // the initial scan was pass 0
+    int dh_pass = 0;
+
     // Scan dependent handles repeatedly until there are no further promotions that can be made or we made a
     // scan without performing any new promotions.
     while (GCScan::GcDhUnpromotedHandlesExist(sc) && fUnscannedPromotions)
@@ -34478,7 +35765,10 @@ void gc_heap::background_scan_dependent_handles (ScanContext *sc)
             fUnscannedPromotions = true;
 
         // Perform the scan and set the flag if any promotions resulted.
-        if (GCScan::GcDhReScan (sc))
+        uint64_t pass_start = dh_scan_pass_start();
+        bool promoted_p = GCScan::GcDhReScan (sc);
+        fire_dh_scan_pass_event (++dh_pass, pass_start, promoted_p);
+        if (promoted_p)
             fUnscannedPromotions = true;
     }
 
@@ -35034,14 +36324,21 @@ void gc_heap::background_mark_phase ()
         // the runtime is suspended. The reset for hardware write watch is done after the runtime is restarted below.
         concurrent_print_time_delta ("CRWW begin");
 
-#ifdef MULTIPLE_HEAPS
-        for (int i = 0; i < n_heaps; i++)
+        if (os_write_watch_for_gc_heap_p)
         {
-            g_heaps[i]->reset_write_watch (FALSE);
+            GCToOSInterface::ResetProcessWriteWatch();
         }
+        else
+        {
+#ifdef MULTIPLE_HEAPS
+            for (int i = 0; i < n_heaps; i++)
+            {
+                g_heaps[i]->reset_write_watch (FALSE);
+            }
 #else
-        reset_write_watch (FALSE);
+            reset_write_watch (FALSE);
 #endif //MULTIPLE_HEAPS
+        }
 
         concurrent_print_time_delta ("CRWW");
 #endif // FEATURE_USE_SOFTWARE_WRITE_WATCH_FOR_GC_HEAP
@@ -35355,7 +36652,9 @@ void gc_heap::background_mark_phase ()
     // required and will also perform processing of any mark stack overflow once the dependent handle
     // table has been fully promoted.
     dprintf (2, ("1st dependent handle scan and process mark overflow"));
+    uint64_t dh_initial_start = dh_scan_pass_start();
     GCScan::GcDhInitialScan(background_promote, max_generation, max_generation, &sc);
+    fire_dh_scan_pass_event (0, dh_initial_start, false);
     background_scan_dependent_handles (&sc);
     //concurrent_print_time_delta ("1st nonconcurrent dependent handle scan and process mark overflow");
     concurrent_print_time_delta ("NR 1st Hov");
@@ -35376,7 +36675,10 @@ void gc_heap::background_mark_phase ()
 #ifdef FEATURE_USE_SOFTWARE_WRITE_WATCH_FOR_GC_HEAP
         // The runtime is suspended, take this opportunity to pause tracking written pages to
         // avoid further perf penalty after the runtime is restarted
-        SoftwareWriteWatch::DisableForGCHeap();
+        if (!os_write_watch_for_gc_heap_p)
+        {
+            SoftwareWriteWatch::DisableForGCHeap();
+        }
 #endif // FEATURE_USE_SOFTWARE_WRITE_WATCH_FOR_GC_HEAP
 
         GCToEEInterface::AfterGcScanRoots (max_generation, max_generation, &sc);
@@ -37849,6 +39151,15 @@ BOOL gc_heap::find_card_dword (size_t& cardw, size_t cardw_end)
                 else
                 {
                     cardb += sizeof(cbw)*8 - card_bundle_bit (cardb);
+
+                    // we are at the start of a bundle word now, skip the empty ones in bulk
+                    if (cardb < end_cardb)
+                    {
+                        uint32_t* bundle_word = &card_bundle_table[card_bundle_word (cardb)];
+                        uint32_t* bundle_word_end = &card_bundle_table[card_bundle_word (end_cardb - 1) + 1];
+                        bundle_word = find_non_zero_card_word (bundle_word, bundle_word_end);
+                        cardb = (bundle_word - card_bundle_table) * card_bundle_word_width;
+                    }
                 }
             }
             if (cardb >= end_cardb)
@@ -37856,10 +39167,7 @@ BOOL gc_heap::find_card_dword (size_t& cardw, size_t cardw_end)
 
             uint32_t* card_word = &card_table[max(card_bundle_cardw (cardb),cardw)];
             uint32_t* card_word_end = &card_table[min(card_bundle_cardw (cardb+1),cardw_end)];
-            while ((card_word < card_word_end) && !(*card_word))
-            {
-                card_word++;
-            }
+            card_word = find_non_zero_card_word (card_word, card_word_end);
 
             if (card_word != card_word_end)
             {
@@ -37873,10 +39181,7 @@ BOOL gc_heap::find_card_dword (size_t& cardw, size_t cardw_end)
             }
             // explore the end of the card bundle so we can possibly clear it
             card_word_end = &card_table[card_bundle_cardw (cardb+1)];
-            while ((card_word < card_word_end) && !(*card_word))
-            {
-                card_word++;
-            }
+            card_word = find_non_zero_card_word (card_word, card_word_end);
             if ((cardw <= card_bundle_cardw (cardb)) &&
                 (card_word == card_word_end))
             {
@@ -37896,15 +39201,11 @@ BOOL gc_heap::find_card_dword (size_t& cardw, size_t cardw_end)
         uint32_t* card_word = &card_table[cardw];
         uint32_t* card_word_end = &card_table [cardw_end];
 
-        while (card_word < card_word_end)
+        card_word = find_non_zero_card_word (card_word, card_word_end);
+        if (card_word < card_word_end)
         {
-            if ((*card_word) != 0)
-            {
-                cardw = (card_word - &card_table [0]);
-                return TRUE;
-            }
-
-            card_word++;
+            cardw = (card_word - &card_table [0]);
+            return TRUE;
         }
         return FALSE;
 
@@ -37964,12 +39265,7 @@ BOOL gc_heap::find_card(uint32_t* card_table,
 #else //CARD_BUNDLE
         // Go through the remaining card words between here and card_word_end until we find
         // one that is non-zero.
-        do
-        {
-            ++last_card_word;
-        }
-
-        while ((last_card_word < &card_table [card_word_end]) && !(*last_card_word));
+        last_card_word = find_non_zero_card_word (last_card_word + 1, &card_table [card_word_end]);
         if (last_card_word < &card_table [card_word_end])
         {
             card_word_value = *last_card_word;
@@ -38019,6 +39315,11 @@ BOOL gc_heap::find_card(uint32_t* card_table,
 
     //dprintf (3, ("find_card: [%zx, %zx[ set", card, end_card));
     dprintf (3, ("fc: [%zx, %zx[", card, end_card));
+
+    // the caller looks up the first object under this card next, start bringing
+    // in the brick entry and the memory it's going to walk.
+    Prefetch (&brick_table[brick_of (card_address (card))]);
+    Prefetch (card_address (card));
     return TRUE;
 }
 
@@ -41088,10 +42389,50 @@ bool gc_heap::decommit_step (uint64_t step_milliseconds)
             uint8_t* page_start = align_lower_page(get_region_start(region));
             uint8_t* end = use_large_pages_p ? heap_segment_used(region) : heap_segment_committed(region);
             size_t size = end - page_start;
+
+            if (lazy_decommit_p())
+            {
+                size_t reset_gc = heap_segment_lazy_decommit_gc (region);
+                if (reset_gc == 0)
+                {
+                    // Let the OS take the pages back when it needs them but keep them
+                    // committed so reusing the region soon doesn't cost a recommit.
+                    // Reset pages read back either as they were or as zeros, so
+                    // everything past heap_segment_used is still zeroed.
+                    GCToOSInterface::VirtualReset (page_start, size, false /* unlock */);
+                    heap_segment_lazy_decommit_gc (region) = max ((size_t)settings.gc_index, (size_t)1);
+                    global_regions_to_lazy_decommit[kind].add_region_front (region);
+                    lazy_decommit_reset_size += size;
+                    dprintf (REGIONS_LOG, ("reset region %p(%p-%p) (%zu bytes)",
+                        region,
+                        page_start,
+                        end,
+                        size));
+
+                    decommit_size += size;
+                    if (decommit_size >= max_decommit_step_size)
+                    {
+                        return true;
+                    }
+                    continue;
+                }
+
+                if ((settings.gc_index - reset_gc) < (size_t)lazy_decommit_gcs)
+                {
+                    // not idle for long enough yet
+                    global_regions_to_lazy_decommit[kind].add_region_front (region);
+                    continue;
+                }
+            }
+
             bool decommit_succeeded_p = false;
             if (!use_large_pages_p)
             {
                 decommit_succeeded_p = virtual_decommit(page_start, size, recorded_committed_free_bucket);
+                if (decommit_succeeded_p)
+                {
+                    record_decommit (page_start, size);
+                }
                 dprintf(REGIONS_LOG, ("decommitted region %p(%p-%p) (%zu bytes) - success: %d",
                     region,
                     page_start,
@@ -41135,6 +42476,77 @@ bool gc_heap::decommit_step (uint64_t step_milliseconds)
     return (decommit_size != 0);
 }
 
+#ifdef USE_REGIONS
+inline
+bool gc_heap::lazy_decommit_p()
+{
+    // an aggressive GC wants the memory gone now
+    return ((lazy_decommit_gcs != 0) && (settings.reason != reason_induced_aggressive));
+}
+
+// Only called by decommit_step so there's only ever one writer.
+void gc_heap::record_decommit (uint8_t* start, size_t size)
+{
+    hard_decommit_size += size;
+
+    decommitted_range* range = &recent_decommits[recent_decommit_index];
+    range->start = start;
+    range->end = start + size;
+    range->gc_index = settings.gc_index;
+    recent_decommit_index = (recent_decommit_index + 1) % DECOMMIT_CHURN_HISTORY;
+}
+
+// Called on every successful commit. Reading recent_decommits while decommit_step
+// updates it can at worst miscount a range, which is fine for an event.
+void gc_heap::record_recommit (uint8_t* start, size_t size)
+{
+    if (!EVENT_ENABLED (GCDecommitChurn))
+    {
+        return;
+    }
+
+    uint8_t* end = start + size;
+    size_t recommitted = 0;
+    for (int i = 0; i < DECOMMIT_CHURN_HISTORY; i++)
+    {
+        decommitted_range* range = &recent_decommits[i];
+        if ((range->start < end) && (start < range->end) &&
+            ((settings.gc_index - range->gc_index) <= DECOMMIT_CHURN_GCS))
+        {
+            recommitted += min (end, range->end) - max (start, range->start);
+        }
+    }
+
+    if (recommitted != 0)
+    {
+        Interlocked::ExchangeAddPtr (&decommit_churn_size, recommitted);
+    }
+}
+
+void gc_heap::fire_decommit_churn_event()
+{
+    if ((lazy_decommit_reset_size + hard_decommit_size + decommit_churn_size) == 0)
+    {
+        return;
+    }
+
+    dprintf (REGIONS_LOG, ("since last GC: reset %zd, decommitted %zd, recommitted within %d GCs %zd",
+        lazy_decommit_reset_size, hard_decommit_size, DECOMMIT_CHURN_GCS, (size_t)decommit_churn_size));
+
+    if (EVENT_ENABLED (GCDecommitChurn))
+    {
+        FIRE_EVENT(GCDecommitChurn,
+                   (uint32_t)(lazy_decommit_reset_size / 1024 / 1024),
+                   (uint32_t)(hard_decommit_size / 1024 / 1024),
+                   (uint32_t)(decommit_churn_size / 1024 / 1024));
+    }
+
+    lazy_decommit_reset_size = 0;
+    hard_decommit_size = 0;
+    decommit_churn_size = 0;
+}
+#endif //USE_REGIONS
+
 #ifdef MULTIPLE_HEAPS
 // return the decommitted size
 size_t gc_heap::decommit_ephemeral_segment_pages_step ()
@@ -41499,6 +42911,15 @@ BOOL gc_heap::decide_on_compacting (int condemned_gen_number,
         get_gc_data_per_heap()->set_mechanism (gc_heap_compact, compact_aggressive_compacting);
     }
 
+#if defined(BACKGROUND_GC) && defined(USE_REGIONS)
+    if (settings.sparse_region_compaction && (condemned_gen_number == max_generation))
+    {
+        dprintf (GTC_LOG, ("h%d compacting sparse gen2 regions", heap_number));
+        should_compact = TRUE;
+        get_gc_data_per_heap()->set_mechanism (gc_heap_compact, compact_sparse_regions);
+    }
+#endif //BACKGROUND_GC && USE_REGIONS
+
     if (settings.reason == reason_pm_full_gc)
     {
         assert (condemned_gen_number == max_generation);
@@ -41562,6 +42983,15 @@ BOOL gc_heap::decide_on_compacting (int condemned_gen_number,
         BOOL frag_exceeded = ((fragmentation >= dd_fragmentation_limit (dd)) &&
                                 (fragmentation_burden >= dd_fragmentation_burden_limit (dd)));
 
+        // With a pause target we sweep a fragmented gen2 instead if we predict compacting
+        // it would take longer than the target - memory pressure can still make us compact below.
+        if (frag_exceeded && (condemned_gen_number == max_generation) &&
+            full_blocking_pause_exceeds_target_p (true))
+        {
+            dprintf (GTC_LOG, ("h%d: frag exceeded but compacting is over pause target - sweeping", heap_number));
+            frag_exceeded = FALSE;
+        }
+
         if (frag_exceeded)
         {
 #ifdef BACKGROUND_GC
@@ -42658,6 +44088,425 @@ void gc_heap::background_ephemeral_sweep()
     generation_allocator (youngest_gen)->copy_with_no_repair (&youngest_free_list);
 }
 
+#ifdef FEATURE_BGC_SWEEP_STEALING
+// An entry in bgc_sweep_regions is the region itself while nobody has claimed it, the region
+// tagged with bgc_sweep_own_tag once this heap's BGC thread claimed it and tagged with
+// bgc_sweep_stolen_tag once another heap's did. Regions are at least pointer aligned so the
+// low bits are free.
+const size_t bgc_sweep_own_tag = 1;
+const size_t bgc_sweep_stolen_tag = 2;
+const size_t bgc_sweep_tag_mask = bgc_sweep_own_tag | bgc_sweep_stolen_tag;
+
+inline
+heap_segment* bgc_sweep_region_of (heap_segment* entry)
+{
+    return (heap_segment*)((size_t)entry & ~bgc_sweep_tag_mask);
+}
+
+// This is called while the EE is still suspended, before any BGC thread starts
+// sweeping gen2 so every heap's list is ready by the time anyone tries to steal.
+void gc_heap::init_bgc_sweep_regions()
+{
+    bgc_sweep_region_count = 0;
+    bgc_sweep_steal_index = 0;
+    bgc_sweep_stealers = 0;
+    bgc_sweep_stolen_survived = 0;
+    bgc_sweep_stolen_free_obj_removed = 0;
+    bgc_sweep_steal_count = 0;
+    bgc_sweep_steal_size = 0;
+
+    if (!bgc_sweep_stealing_p || (n_heaps == 1))
+    {
+        return;
+    }
+
+    int32_t count = 0;
+    for (heap_segment* region = heap_segment_rw (generation_start_segment (generation_of (max_generation)));
+         region; region = heap_segment_next (region))
+    {
+        count++;
+    }
+
+    if (count > bgc_sweep_regions_capacity)
+    {
+        // grow a bit more than we need so we don't reallocate every BGC while gen2 grows.
+        int32_t new_capacity = max (count + count / 2, 64);
+        heap_segment** new_regions = new (nothrow) heap_segment* [new_capacity];
+        if (!new_regions)
+        {
+            // we just sweep all our regions ourselves this time.
+            dprintf (REGIONS_LOG, ("h%d: no memory for %d BGC sweep regions", heap_number, count));
+            return;
+        }
+
+        delete[] bgc_sweep_regions;
+        bgc_sweep_regions = new_regions;
+        bgc_sweep_regions_capacity = new_capacity;
+    }
+
+    for (heap_segment* region = heap_segment_rw (generation_start_segment (generation_of (max_generation)));
+         region; region = heap_segment_next (region))
+    {
+        // Only regions BGC mark saw need sweeping. We always start our own sweep with
+        // the start region so there's no point in letting anyone steal it.
+        if ((heap_segment_background_allocated (region) != 0) &&
+            !heap_segment_read_only_p (region) &&
+            (region != generation_start_segment (generation_of (max_generation))))
+        {
+            bgc_sweep_regions[bgc_sweep_region_count++] = region;
+        }
+    }
+
+    bgc_sweep_steal_index = bgc_sweep_region_count;
+    dprintf (REGIONS_LOG, ("h%d: %d gen2 regions can be stolen during BGC sweep", heap_number, bgc_sweep_region_count));
+}
+
+// Returns true if this heap's BGC thread should sweep region, false if another heap's
+// BGC thread already claimed it. We sweep in region list order so index_hint is normally
+// right where region is; regions that aren't in bgc_sweep_regions can't be stolen.
+bool gc_heap::claim_own_bgc_sweep_region (heap_segment* region, int* index_hint)
+{
+    int index = *index_hint;
+
+    if ((index >= bgc_sweep_region_count) || (bgc_sweep_region_of (bgc_sweep_regions[index]) != region))
+    {
+        for (index = 0; index < bgc_sweep_region_count; index++)
+        {
+            if (bgc_sweep_region_of (bgc_sweep_regions[index]) == region)
+            {
+                break;
+            }
+        }
+
+        if (index == bgc_sweep_region_count)
+        {
+            return true;
+        }
+    }
+
+    *index_hint = index + 1;
+    heap_segment* claimed = (heap_segment*)((size_t)region | bgc_sweep_own_tag);
+    return (Interlocked::CompareExchangePointer (&bgc_sweep_regions[index], claimed, region) == region);
+}
+
+// Stealers take victim's regions from the back of its list while victim takes them from
+// the front so we rarely race with it for the same region, and never with other stealers
+// since each index is only handed out once.
+heap_segment* gc_heap::steal_bgc_sweep_region (gc_heap* victim)
+{
+    if (VolatileLoad (&victim->bgc_sweep_steal_index) <= 0)
+    {
+        return 0;
+    }
+
+    int index = Interlocked::Decrement (&victim->bgc_sweep_steal_index);
+    if (index < 0)
+    {
+        return 0;
+    }
+
+    heap_segment* region = bgc_sweep_region_of (victim->bgc_sweep_regions[index]);
+    heap_segment* stolen_entry = (heap_segment*)((size_t)region | bgc_sweep_stolen_tag);
+    if (Interlocked::CompareExchangePointer (&victim->bgc_sweep_regions[index], stolen_entry, region) != region)
+    {
+        // victim got here first which means it's already swept everything before this too.
+        victim->bgc_sweep_steal_index = 0;
+        return 0;
+    }
+
+    return region;
+}
+
+// Free spaces in a stolen region are threaded onto the region's own free list, the same
+// way sweep in plan does, and victim threads them onto its gen2 free list once the stealers
+// are done - see merge_stolen_bgc_sweep_regions.
+void gc_heap::thread_stolen_gap (heap_segment* region, uint8_t* gap_start, size_t size)
+{
+    if (size > 0)
+    {
+        assert (size >= Align (min_obj_size));
+        make_unused_array (gap_start, size, FALSE, TRUE);
+        region->thread_free_obj (gap_start, size);
+        dprintf (3, ("stolen fr: [%zx, %zx[", (size_t)gap_start, (size_t)gap_start+size));
+    }
+}
+
+#ifdef USE_REGIONS
+// BGC is the only time we know how much is live in each gen2 region without a blocking gen2 so
+// this is where we find the sparse ones. Compacting them concurrently would need a read or copy
+// barrier we don't have, so instead we remember how much we'd get back and let the next gen2
+// compact just those regions - see decide_on_sparse_region_compaction.
+size_t gc_heap::sparse_region_reclaimable (heap_segment* region, size_t survived)
+{
+    if (!sparse_region_compaction_p)
+    {
+        return 0;
+    }
+
+    // large regions are not worth moving.
+    size_t basic_region_size = (size_t)1 << min_segment_size_shr;
+    if (get_region_size (region) > basic_region_size)
+    {
+        return 0;
+    }
+
+    if ((survived * 100) >= (basic_region_size * sparse_region_surv_ratio_th))
+    {
+        return 0;
+    }
+
+    size_t region_used = heap_segment_allocated (region) - heap_segment_mem (region);
+    size_t reclaimable = (region_used > survived) ? (region_used - survived) : 0;
+    dprintf (REGIONS_LOG, ("h%d sparse gen2 region %p surv %zd, reclaimable %zd",
+        heap_number, heap_segment_mem (region), survived, reclaimable));
+    return reclaimable;
+}
+
+void gc_heap::decide_on_sparse_region_compaction()
+{
+    sparse_region_compaction_pending_p = false;
+
+    if (!sparse_region_compaction_p)
+    {
+        return;
+    }
+
+    size_t total_reclaimable = 0;
+#ifdef MULTIPLE_HEAPS
+    for (int i = 0; i < n_heaps; i++)
+    {
+        gc_heap* hp = g_heaps[i];
+#else //MULTIPLE_HEAPS
+    {
+        gc_heap* hp = pGenGCHeap;
+#endif //MULTIPLE_HEAPS
+        total_reclaimable += hp->bgc_sparse_regions_reclaimable;
+    }
+
+    size_t gen2_size = get_total_gen_size (max_generation);
+    if ((gen2_size != 0) && ((total_reclaimable * 100) >= (gen2_size * sparse_region_reclaim_ratio_th)))
+    {
+        sparse_region_compaction_pending_p = true;
+    }
+
+    dprintf (GTC_LOG, ("BGC#%zd sparse gen2 regions reclaimable %zd / gen2 %zd, %s",
+        VolatileLoad (&settings.gc_index), total_reclaimable, gen2_size,
+        (sparse_region_compaction_pending_p ? "next gen2 compacts them" : "not worth compacting")));
+}
+#endif //USE_REGIONS
+
+// This sweeps a gen2 region of victim on our BGC thread. It's the gen2 part of background_sweep
+// except that -
+//
+// + we don't allow an FGC while we are in the middle of the region. FGCs decide what's live in a
+// region that's not being swept by its heap's BGC thread by whether it's swept, so it should be
+// either not started or done by the time an FGC looks at it. Regions are small enough that this
+// doesn't hold up an FGC for long.
+// + victim's BGC thread can be threading onto or unlinking from its gen2 free list at the same time
+// so we don't touch that list at all. Free objects that are on it are left alone, as if they were
+// plugs, so we don't coalesce gaps around them.
+// + we never delete the region and leave decommitting its end to victim.
+void gc_heap::background_sweep_stolen_region (gc_heap* victim, heap_segment* region)
+{
+    int align_const = get_alignment_constant (TRUE);
+    uint8_t* o = heap_segment_mem (region);
+    uint8_t* end = heap_segment_background_allocated (region);
+    uint8_t* plug_end = o;
+    size_t survived = 0;
+    size_t free_obj_removed = 0;
+    // free objects not on the FL in the current gap, they are already counted in free_obj_space.
+    size_t free_obj_size_gap = 0;
+
+    dprintf (3333, ("h%d sweeping h%d's region %p [%p, %p[", heap_number, victim->heap_number,
+        region, heap_segment_mem (region), end));
+
+    region->init_free_list();
+
+    while (o < end)
+    {
+        if (background_object_marked (o, TRUE))
+        {
+            uint8_t* plug_start = o;
+            thread_stolen_gap (region, plug_end, plug_start - plug_end);
+            free_obj_removed += free_obj_size_gap;
+            free_obj_size_gap = 0;
+
+            fix_brick_to_highest (plug_end, plug_start);
+            fix_brick_to_highest (plug_start, plug_start);
+
+            do
+            {
+                o = o + Align (size (o), align_const);
+            } while ((o < end) && background_object_marked (o, TRUE));
+
+            survived += o - plug_start;
+            plug_end = o;
+        }
+
+        while ((o < end) && !background_object_marked (o, FALSE))
+        {
+            size_t size_o = Align (size (o), align_const);
+
+            if (method_table (o) == g_gc_pFreeObjectMethodTable)
+            {
+                if (is_on_free_list (o, size_o))
+                {
+                    thread_stolen_gap (region, plug_end, o - plug_end);
+                    free_obj_removed += free_obj_size_gap;
+                    free_obj_size_gap = 0;
+
+                    fix_brick_to_highest (plug_end, o);
+                    fix_brick_to_highest (o, o);
+
+                    plug_end = o + size_o;
+                }
+                else
+                {
+                    free_obj_size_gap += size_o;
+                }
+            }
+
+            o = o + size_o;
+        }
+    }
+
+    if (heap_segment_allocated (region) != end)
+    {
+        // FGCs promoted objects after what BGC mark saw, which means this region was in use by victim's gen2
+        // allocation context - make the last gap a free object that goes up to them.
+        thread_stolen_gap (region, plug_end, end - plug_end);
+        free_obj_removed += free_obj_size_gap;
+        fix_brick_to_highest (plug_end, end);
+        fix_brick_to_highest (end, end);
+    }
+    else
+    {
+        // Any free objects at the end go away with the allocated we are trimming.
+        free_obj_removed += free_obj_size_gap;
+        heap_segment_allocated (region) = plug_end;
+        set_mem_verify (heap_segment_allocated (region) - plug_skew, heap_segment_used (region), 0xbb);
+    }
+
+    bgc_verify_mark_array_cleared (region);
+    region->flags |= heap_segment_flags_swept;
+
+    Interlocked::ExchangeAddPtr (&victim->bgc_sweep_stolen_survived, survived);
+    Interlocked::ExchangeAddPtr (&victim->bgc_sweep_stolen_free_obj_removed, free_obj_removed);
+    size_t reclaimable = sparse_region_reclaimable (region, survived);
+    if (reclaimable)
+    {
+        Interlocked::ExchangeAddPtr (&victim->bgc_sparse_regions_reclaimable, reclaimable);
+    }
+
+    bgc_sweep_steal_count++;
+    bgc_sweep_steal_size += end - heap_segment_mem (region);
+
+    dprintf (3333, ("h%d swept h%d's region %p: surv %zd, FL %zd, FO %zd, FO- %zd", heap_number, victim->heap_number,
+        region, survived, heap_segment_free_list_size (region), heap_segment_free_obj_size (region), free_obj_removed));
+}
+
+// Called by a BGC thread that's done sweeping its own gen2 regions. We keep going round the
+// other heaps, one region at a time so we spread out over the heaps that are furthest behind,
+// until nobody has any regions left to steal.
+void gc_heap::bgc_sweep_steal()
+{
+    if (!bgc_sweep_stealing_p || (n_heaps == 1))
+    {
+        return;
+    }
+
+    bool stole_p = true;
+    while (stole_p)
+    {
+        stole_p = false;
+
+        for (int i = 1; i < n_heaps; i++)
+        {
+            gc_heap* victim = g_heaps[(heap_number + i) % n_heaps];
+
+            Interlocked::Increment (&victim->bgc_sweep_stealers);
+            heap_segment* region = steal_bgc_sweep_region (victim);
+            if (region)
+            {
+                background_sweep_stolen_region (victim, region);
+                stole_p = true;
+            }
+            Interlocked::Decrement (&victim->bgc_sweep_stealers);
+
+            allow_fgc();
+        }
+    }
+
+    dprintf (REGIONS_LOG, ("h%d: swept %zd regions (%zd bytes) for other heaps",
+        heap_number, bgc_sweep_steal_count, bgc_sweep_steal_size));
+
+    if (EVENT_ENABLED (BGCSweepStealStats))
+    {
+        FIRE_EVENT(BGCSweepStealStats, (uint32_t)heap_number, (uint32_t)bgc_sweep_steal_count,
+            (uint32_t)(bgc_sweep_steal_size / 1024 / 1024));
+    }
+}
+
+// Called by a BGC thread that's done going through its own gen2 regions, before it steals.
+// After this nobody can claim our regions anymore, and once the stealers that are still
+// sweeping them are done we take what they found onto our gen2 free list and dynamic data.
+void gc_heap::merge_stolen_bgc_sweep_regions()
+{
+    if (bgc_sweep_region_count == 0)
+    {
+        return;
+    }
+
+    // We've normally claimed or skipped every region already; this is for any we didn't see.
+    // They'd be left unswept just like they would be without stealing.
+    bgc_sweep_steal_index = 0;
+    for (int i = 0; i < bgc_sweep_region_count; i++)
+    {
+        heap_segment* entry = bgc_sweep_regions[i];
+        if (bgc_sweep_region_of (entry) == entry)
+        {
+            Interlocked::CompareExchangePointer (&bgc_sweep_regions[i],
+                (heap_segment*)((size_t)entry | bgc_sweep_own_tag), entry);
+        }
+    }
+
+    int spin_count = yp_spin_count_unit;
+    while (VolatileLoad (&bgc_sweep_stealers) != 0)
+    {
+        spin_and_switch (spin_count, (VolatileLoad (&bgc_sweep_stealers) == 0));
+    }
+
+    generation* gen = generation_of (max_generation);
+    size_t stolen_regions = 0;
+
+    for (int i = 0; i < bgc_sweep_region_count; i++)
+    {
+        heap_segment* entry = bgc_sweep_regions[i];
+        if (((size_t)entry & bgc_sweep_stolen_tag) == 0)
+        {
+            continue;
+        }
+
+        heap_segment* region = bgc_sweep_region_of (entry);
+        generation_allocator (gen)->thread_sip_fl (region);
+        generation_free_list_space (gen) += heap_segment_free_list_size (region);
+        generation_free_obj_space (gen) += heap_segment_free_obj_size (region);
+        region->init_free_list();
+
+        decommit_heap_segment_pages (region, 0);
+        stolen_regions++;
+    }
+
+    assert (generation_free_obj_space (gen) >= bgc_sweep_stolen_free_obj_removed);
+    generation_free_obj_space (gen) -= bgc_sweep_stolen_free_obj_removed;
+    dd_survived_size (dynamic_data_of (max_generation)) += bgc_sweep_stolen_survived;
+
+    dprintf (REGIONS_LOG, ("h%d: %zd of %d gen2 regions were swept by other heaps, surv %zd, FO- %zd",
+        heap_number, stolen_regions, bgc_sweep_region_count,
+        (size_t)bgc_sweep_stolen_survived, (size_t)bgc_sweep_stolen_free_obj_removed));
+}
+#endif //FEATURE_BGC_SWEEP_STEALING
+
 void gc_heap::background_sweep()
 {
     //concurrent_print_time_delta ("finished with mark and start with sweep");
@@ -42734,6 +44583,14 @@ void gc_heap::background_sweep()
         }
     }
 
+#ifdef FEATURE_BGC_SWEEP_STEALING
+    init_bgc_sweep_regions();
+#endif //FEATURE_BGC_SWEEP_STEALING
+
+#ifdef USE_REGIONS
+    bgc_sparse_regions_reclaimable = 0;
+#endif //USE_REGIONS
+
 #ifdef MULTIPLE_HEAPS
     bgc_t_join.join(this, gc_join_restart_ee);
     if (bgc_t_join.joined())
@@ -42784,6 +44641,9 @@ void gc_heap::background_sweep()
     dynamic_data* dd     = dynamic_data_of (max_generation);
     const int num_objs   = 256;
     int current_num_objs = 0;
+#ifdef FEATURE_BGC_SWEEP_STEALING
+    int own_sweep_index = 0;
+#endif //FEATURE_BGC_SWEEP_STEALING
 
     for (int i = max_generation; i < total_generation_count; i++)
     {
@@ -42851,6 +44711,21 @@ void gc_heap::background_sweep()
 #endif //DOUBLY_LINKED_FL
                 )
         {
+#ifdef FEATURE_BGC_SWEEP_STEALING
+            if ((i == max_generation) && !claim_own_bgc_sweep_region (seg, &own_sweep_index))
+            {
+                dprintf (3333, ("h%d: region %p is swept by another heap", heap_number, heap_segment_mem (seg)));
+                prev_seg = seg;
+                next_seg = heap_segment_next (seg);
+                while (next_seg && heap_segment_background_allocated (next_seg) == 0)
+                {
+                    next_seg = heap_segment_next (next_seg);
+                }
+                seg = next_seg;
+                continue;
+            }
+#endif //FEATURE_BGC_SWEEP_STEALING
+
             uint8_t* o = heap_segment_mem (seg);
             if (seg == gen_start_seg)
             {
@@ -42872,6 +44747,9 @@ void gc_heap::background_sweep()
             // in the gap and it gets set to 0 when we encounter a plug. If the last gap we saw
             // on a seg is unmarked, we will process this in process_background_segment_end.
             size_t free_obj_size_last_gap = 0;
+#ifdef USE_REGIONS
+            size_t region_survived = 0;
+#endif //USE_REGIONS
 
             allow_fgc();
             uint8_t* end = background_next_end (seg, (i > max_generation));
@@ -42930,6 +44808,9 @@ void gc_heap::background_sweep()
                     {
                         add_gen_plug (max_generation, plug_end-plug_start);
                         dd_survived_size (dd) += (plug_end - plug_start);
+#ifdef USE_REGIONS
+                        region_survived += (plug_end - plug_start);
+#endif //USE_REGIONS
                     }
                     dprintf (3, ("bgs: plug [%zx, %zx[", (size_t)plug_start, (size_t)plug_end));
                 }
@@ -43044,6 +44925,12 @@ void gc_heap::background_sweep()
                 dprintf (2, ("seg %p (%p) has been swept", seg, heap_segment_mem (seg)));
                 seg->flags |= heap_segment_flags_swept;
                 current_sweep_pos = end;
+#ifdef USE_REGIONS
+                if (i == max_generation)
+                {
+                    bgc_sparse_regions_reclaimable += sparse_region_reclaimable (seg, region_survived);
+                }
+#endif //USE_REGIONS
             }
 
             verify_soh_segment_list();
@@ -43069,6 +44956,11 @@ void gc_heap::background_sweep()
 
         if (i == max_generation)
         {
+#ifdef FEATURE_BGC_SWEEP_STEALING
+            merge_stolen_bgc_sweep_regions();
+            bgc_sweep_steal();
+#endif //FEATURE_BGC_SWEEP_STEALING
+
             dprintf (2, ("bgs: sweeping uoh objects"));
             concurrent_print_time_delta ("Swe SOH");
             FIRE_EVENT(BGC1stSweepEnd, 0);
@@ -43149,6 +45041,10 @@ void gc_heap::background_sweep()
         // this state can live with per heap state like should_check_bgc_mark.
         current_c_gc_state = c_gc_state_free;
 
+#ifdef USE_REGIONS
+        decide_on_sparse_region_compaction();
+#endif //USE_REGIONS
+
 #ifdef BGC_SERVO_TUNING
         if (bgc_tuning::enable_fl_tuning)
         {
@@ -44291,7 +46187,6 @@ gc_heap::verify_free_lists ()
     {
         dprintf (3, ("Verifying free list for gen:%d", gen_num));
         allocator* gen_alloc = generation_allocator (generation_of (gen_num));
-        size_t sz = gen_alloc->first_bucket_size();
         bool verify_undo_slot = (gen_num != 0) && (gen_num <= max_generation) && !gen_alloc->discard_if_no_fit_p();
 
         for (unsigned int a_l_number = 0; a_l_number < gen_alloc->number_of_buckets(); a_l_number++)
@@ -44306,8 +46201,7 @@ gc_heap::verify_free_lists ()
                                  (size_t)free_list));
                     FATAL_GC_ERROR();
                 }
-                if (((a_l_number < (gen_alloc->number_of_buckets()-1))&& (unused_array_size (free_list) >= sz))
-                    || ((a_l_number != 0) && (unused_array_size (free_list) < sz/2)))
+                if (gen_alloc->first_suitable_bucket (unused_array_size (free_list)) != a_l_number)
                 {
                     dprintf (1, ("Verifiying Heap: curr free list item %zx isn't in the right bucket",
                                  (size_t)free_list));
@@ -44358,8 +46252,6 @@ gc_heap::verify_free_lists ()
                     FATAL_GC_ERROR();
                 }
             }
-
-            sz *=2;
         }
     }
 }
@@ -45192,6 +47084,23 @@ HRESULT GCHeap::Initialize()
 
     gc_heap::use_large_pages_p = GCConfig::GetGCLargePages();
 
+#ifdef USE_REGIONS
+    // large pages are committed upfront so there's nothing to advise for them
+    gc_heap::use_region_huge_pages_p = !gc_heap::use_large_pages_p &&
+        GCConfig::GetGCRegionHugePages() &&
+        GCToOSInterface::VirtualAdviseHugePages (nullptr, 0);
+#endif //USE_REGIONS
+
+#ifdef FEATURE_BGC_SWEEP_STEALING
+    gc_heap::bgc_sweep_stealing_p = GCConfig::GetBGCSweepStealing();
+#endif //FEATURE_BGC_SWEEP_STEALING
+
+#if defined(BACKGROUND_GC) && defined(USE_REGIONS)
+    gc_heap::sparse_region_compaction_p = GCConfig::GetGCSparseRegionCompaction();
+#endif //BACKGROUND_GC && USE_REGIONS
+
+    gc_heap::adaptive_alloc_quantum_p = GCConfig::GetGCAdaptiveAllocQuantum();
+
     if (gc_heap::heap_hard_limit_oh[soh] || gc_heap::heap_hard_limit_oh[loh] || gc_heap::heap_hard_limit_oh[poh])
     {
         if (!gc_heap::heap_hard_limit_oh[soh])
@@ -47130,6 +49039,48 @@ void gc_heap::update_recorded_gen_data (last_recorded_gc_info* gc_info)
     }
 }
 
+#ifdef USE_REGIONS
+// Returns how much memory is committed for the regions in use and how much of that
+// is in whole huge pages, ie, memory the OS could back with huge pages.
+void gc_heap::get_region_huge_page_coverage (size_t* committed, size_t* huge_page_committed)
+{
+    size_t total_committed = 0;
+    size_t total_huge_page_committed = 0;
+
+#ifdef MULTIPLE_HEAPS
+    for (int i = 0; i < n_heaps; i++)
+    {
+        gc_heap* hp = g_heaps[i];
+#else //MULTIPLE_HEAPS
+    {
+        gc_heap* hp = pGenGCHeap;
+#endif //MULTIPLE_HEAPS
+        for (int gen_idx = 0; gen_idx < total_generation_count; gen_idx++)
+        {
+            heap_segment* region = heap_segment_rw (generation_start_segment (hp->generation_of (gen_idx)));
+            while (region)
+            {
+                uint8_t* start = get_region_start (region);
+                uint8_t* end = heap_segment_committed (region);
+                total_committed += end - start;
+
+                uint8_t* huge_start = align_on_huge_page (start);
+                uint8_t* huge_end = align_lower_huge_page (end);
+                if (huge_end > huge_start)
+                {
+                    total_huge_page_committed += huge_end - huge_start;
+                }
+
+                region = heap_segment_next_rw (region);
+            }
+        }
+    }
+
+    *committed = total_committed;
+    *huge_page_committed = total_huge_page_committed;
+}
+#endif //USE_REGIONS
+
 void gc_heap::do_post_gc()
 {
 #ifdef MULTIPLE_HEAPS
@@ -47238,6 +49189,11 @@ void gc_heap::do_post_gc()
         last_gc_info->pause_durations[0] = pause_duration;
         total_suspended_time += pause_duration;
         last_gc_info->pause_durations[1] = 0;
+
+        if (settings.condemned_generation == max_generation)
+        {
+            update_full_blocking_pause_model (!!settings.compaction, pause_duration, last_gc_info->promoted);
+        }
     }
 
     uint64_t total_process_time = end_gc_time - process_start_time;
@@ -47259,6 +49215,18 @@ void gc_heap::do_post_gc()
     is_last_recorded_bgc = settings.concurrent;
 #endif //BACKGROUND_GC
 
+#ifdef USE_REGIONS
+    if (use_region_huge_pages_p && EVENT_ENABLED (GCRegionHugePageCoverage))
+    {
+        size_t committed = 0;
+        size_t huge_page_committed = 0;
+        get_region_huge_page_coverage (&committed, &huge_page_committed);
+        FIRE_EVENT(GCRegionHugePageCoverage,
+                   (uint32_t)(committed / (1024 * 1024)),
+                   (uint32_t)(huge_page_committed / (1024 * 1024)));
+    }
+#endif //USE_REGIONS
+
 #ifdef TRACE_GC
     if (heap_hard_limit)
     {
@@ -47701,6 +49669,17 @@ int GCHeap::GetHomeHeapNumber ()
 #endif //MULTIPLE_HEAPS
 }
 
+int GCHeap::GetAllocContextHeapNumber (gc_alloc_context* acontext)
+{
+#ifdef MULTIPLE_HEAPS
+    GCHeap *hp = static_cast<alloc_context*>(acontext)->get_alloc_heap();
+    return (hp ? hp->pGenGCHeap->heap_number : 0);
+#else
+    UNREFERENCED_PARAMETER(acontext);
+    return 0;
+#endif //MULTIPLE_HEAPS
+}
+
 unsigned int GCHeap::GetCondemnedGeneration()
 {
     return gc_heap::settings.condemned_generation;
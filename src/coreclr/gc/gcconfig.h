@@ -77,12 +77,22 @@ public:
     BOOL_CONFIG  (GCNumaAware,               "GCNumaAware",               NULL,                                true,               "Enables numa allocations in the GC")                                                     \
     BOOL_CONFIG  (GCCpuGroup,                "GCCpuGroup",                "System.GC.CpuGroup",                false,              "Enables CPU groups in the GC")                                                            \
     BOOL_CONFIG  (GCLargePages,              "GCLargePages",              "System.GC.LargePages",              false,              "Enables using Large Pages in the GC")                                                     \
+    BOOL_CONFIG  (GCRegionHugePages,         "GCRegionHugePages",         "System.GC.RegionHugePages",         false,              "Specifies whether GC should ask the OS to back region memory with huge pages")             \
+    INT_CONFIG   (GCLazyDecommitGCs,         "GCLazyDecommitGCs",         NULL,                                0,                  "Specifies the number of GCs a free region stays reset (MADV_FREE) before it gets decommitted, 0 decommits right away") \
     INT_CONFIG   (HeapVerifyLevel,           "HeapVerify",                NULL,                                HEAPVERIFY_NONE,    "When set verifies the integrity of the managed heap on entry and exit of each GC")       \
     INT_CONFIG   (LOHCompactionMode,         "GCLOHCompact",              NULL,                                0,                  "Specifies the LOH compaction mode")                                                      \
     INT_CONFIG   (LOHThreshold,              "GCLOHThreshold",            NULL,                                LARGE_OBJECT_SIZE,  "Specifies the size that will make objects go on LOH")                                     \
+    BOOL_CONFIG  (GCGen2SizeClasses,         "GCGen2SizeClasses",         NULL,                                false,              "Specifies whether the gen2 free list should have a bucket per size for small sizes instead of power of 2 buckets") \
+    INT_CONFIG   (GCMarkPrefetchDepth,       "GCMarkPrefetchDepth",       NULL,                                16,                 "Specifies how many objects marking prefetches ahead of marking them, rounded down to a power of 2 up to 64") \
     INT_CONFIG   (BGCSpinCount,              "BGCSpinCount",              NULL,                                140,                "Specifies the bgc spin count")                                                           \
+    BOOL_CONFIG  (GCOSWriteWatch,            "GCOSWriteWatch",            NULL,                                false,              "Specifies whether BGC should have the OS track written pages (soft-dirty bits on Linux) instead of the write barrier") \
+    BOOL_CONFIG  (BGCSweepStealing,          "GCBGCSweepStealing",        NULL,                                false,              "Allows server GC BGC threads that finished sweeping their own heap to sweep other heaps' gen2 regions") \
+    BOOL_CONFIG  (GCAdaptiveAllocQuantum,    "GCAdaptiveAllocQuantum",    NULL,                                true,               "Specifies whether the SOH allocation quantum is sized per allocation context from how often it was refilled recently, instead of being the same for every context") \
+    BOOL_CONFIG  (GCSparseRegionCompaction,  "GCSparseRegionCompaction",  NULL,                                false,              "Specifies whether a BGC that finds enough mostly empty gen2 regions makes the next GC a blocking gen2 that only compacts those regions") \
     INT_CONFIG   (BGCSpin,                   "BGCSpin",                   NULL,                                2,                  "Specifies the bgc spin time")                                                            \
     INT_CONFIG   (HeapCount,                 "GCHeapCount",               "System.GC.HeapCount",               0,                  "Specifies the number of server GC heaps")                                                 \
+    BOOL_CONFIG  (GCDynamicHeapCount,        "GCDynamicHeapCount",        "System.GC.DynamicHeapCount",        false,              "Specifies whether server GC should grow and shrink the number of heaps it allocates on based on how much time it spends in GC") \
+    INT_CONFIG   (GCDynamicHeapCountTarget,  "GCDynamicHeapCountTarget",  NULL,                                5,                  "Specifies the % of time in blocking GCs GCDynamicHeapCount aims for")                   \
     INT_CONFIG   (Gen0Size,                  "GCgen0size",                NULL,                                0,                  "Specifies the smallest gen0 budget")                                                     \
     INT_CONFIG   (SegmentSize,               "GCSegmentSize",             NULL,                                0,                  "Specifies the managed heap segment size")                                                \
     INT_CONFIG   (LatencyMode,               "GCLatencyMode",             NULL,                                -1,                 "Specifies the GC latency mode - batch, interactive or low latency (note that the same "   \
@@ -133,8 +143,9 @@ public:
     INT_CONFIG   (GCHeapHardLimitSOHPercent, "GCHeapHardLimitSOHPercent", "System.GC.HeapHardLimitSOHPercent", 0,                  "Specifies the GC heap SOH usage as a percentage of the total memory")                    \
     INT_CONFIG   (GCHeapHardLimitLOHPercent, "GCHeapHardLimitLOHPercent", "System.GC.HeapHardLimitLOHPercent", 0,                  "Specifies the GC heap LOH usage as a percentage of the total memory")                    \
     INT_CONFIG   (GCHeapHardLimitPOHPercent, "GCHeapHardLimitPOHPercent", "System.GC.HeapHardLimitPOHPercent", 0,                  "Specifies the GC heap POH usage as a percentage of the total memory")                    \
-    INT_CONFIG   (GCEnabledInstructionSets,  "GCEnabledInstructionSets",  NULL,                                -1,                 "Specifies whether GC can use AVX2 or AVX512F - 0 for neither, 1 for AVX2, 3 for AVX512F")\
+    INT_CONFIG   (GCEnabledInstructionSets,  "GCEnabledInstructionSets",  NULL,                                -1,                 "Specifies whether GC can use AVX2, AVX512F or NEON - 0 for none, 1 for AVX2, 3 for AVX512F, 4 for NEON")\
     INT_CONFIG   (GCConserveMem,             "GCConserveMemory",          "System.GC.ConserveMemory",          0,                  "Specifies how hard GC should try to conserve memory - values 0-9")                       \
+    INT_CONFIG   (GCPauseTargetMs,           "GCPauseTargetMs",           "System.GC.PauseTargetMs",           0,                  "Specifies a target for blocking gen2 pauses in ms - GC prefers BGC or sweeping when a blocking gen2 is predicted to exceed it") \
     INT_CONFIG   (GCWriteBarrier,            "GCWriteBarrier",            NULL,                                0,                  "Specifies whether GC should use more precise but slower write barrier")                  \
     STRING_CONFIG(GCName,                    "GCName",                    "System.GC.Name",                                        "Specifies the path of the standalone GC implementation.")                                
 // This class is responsible for retreiving configuration information
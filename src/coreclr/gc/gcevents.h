@@ -48,5 +48,34 @@ KNOWN_EVENT(PrvSetGCHandle, GCEventProvider_Private, GCEventLevel_Information, G
 KNOWN_EVENT(PrvDestroyGCHandle, GCEventProvider_Private, GCEventLevel_Information, GCEventKeyword_GCHandlePrivate)
 KNOWN_EVENT(PinPlugAtGCTime, GCEventProvider_Private, GCEventLevel_Verbose, GCEventKeyword_GCPrivate)
 
+// NUMA node, free region kind, free regions on the node's heaps, regions handed out from the node's
+// own surplus, regions handed out from another node's surplus
+DYNAMIC_EVENT(GCFreeRegionNumaLocality, GCEventLevel_Information, GCEventKeyword_GC, uint32_t, uint32_t, uint32_t, uint32_t, uint32_t)
+
+// heap, time spent marking stolen work (us), time spent idle looking for work (us),
+// objects stolen from other heaps' mark deques, batches they were stolen in
+DYNAMIC_EVENT(GCMarkStealStats, GCEventLevel_Information, GCEventKeyword_GC, uint32_t, uint32_t, uint32_t, uint32_t, uint32_t)
+
+// MB committed for the regions in use, MB of that in whole huge pages (only fired with GCRegionHugePages)
+DYNAMIC_EVENT(GCRegionHugePageCoverage, GCEventLevel_Information, GCEventKeyword_GC, uint32_t, uint32_t)
+
+// heap, gen2 regions it swept for other heaps during BGC sweep, MB in those regions
+DYNAMIC_EVENT(BGCSweepStealStats, GCEventLevel_Information, GCEventKeyword_GC, uint32_t, uint32_t, uint32_t)
+
+// old active heap count, new active heap count, median % of time in GC (in 1/100th of a %) it was based on
+DYNAMIC_EVENT(GCDynamicHeapCountChange, GCEventLevel_Information, GCEventKeyword_GC, uint32_t, uint32_t, uint32_t)
+
+// MB of free regions reset instead of decommitted, MB decommitted, MB of decommitted memory committed
+// again within DECOMMIT_CHURN_GCS GCs of being decommitted - all since the previous event
+DYNAMIC_EVENT(GCDecommitChurn, GCEventLevel_Information, GCEventKeyword_GC, uint32_t, uint32_t, uint32_t)
+
+// heap, dependent handle scan pass (0 is the initial scan), time the pass took on this heap (us),
+// whether it promoted any secondaries
+DYNAMIC_EVENT(GCDependentHandleScanPass, GCEventLevel_Information, GCEventKeyword_GC, uint32_t, uint32_t, uint32_t, uint32_t)
+
+// heap, SOH allocation context refills since the previous event, allocation contexts in use at this GC,
+// base allocation quantum, max allocation quantum of contexts that are refilled often
+DYNAMIC_EVENT(GCAllocQuantumStats, GCEventLevel_Information, GCEventKeyword_GC, uint32_t, uint32_t, uint32_t, uint32_t, uint32_t)
+
 #undef KNOWN_EVENT
 #undef DYNAMIC_EVENT
@@ -201,7 +201,13 @@ private:
  * FireDynamicEvent is a variadic function that fires a dynamic event with the
  * given name and event payload. This function serializes the arguments into
  * a binary payload that is then passed to IGCToCLREventSink::FireDynamicEvent.
+ *
+ * Dynamic events are mostly fired during the pause, so payloads that fit in
+ * DynamicEventStackBufferSize are serialized on the stack instead of a heap
+ * buffer - the sink copies the payload into the event buffers before it returns.
  */
+const size_t DynamicEventStackBufferSize = 256;
+
 template<typename... EventArgument>
 void FireDynamicEvent(const char* name, EventArgument... arguments)
 {
@@ -213,20 +219,29 @@ void FireDynamicEvent(const char* name, EventArgument... arguments)
         return;
     }
 
-    uint8_t* buf = new (nothrow) uint8_t[size];
-    if (!buf)
+    uint8_t stack_buf[DynamicEventStackBufferSize];
+    uint8_t* buf = stack_buf;
+    if (size > sizeof(stack_buf))
     {
-        // best effort - if we're OOM, don't bother with the event.
-        return;
+        buf = new (nothrow) uint8_t[size];
+        if (!buf)
+        {
+            // best effort - if we're OOM, don't bother with the event.
+            return;
+        }
     }
 
-    memset(buf, 0, size);
+    // every byte of the payload is written by the serializers
     uint8_t* cursor = buf;
     gc_event::Serialize(&cursor, arguments...);
+    assert(static_cast<size_t>(cursor - buf) == size);
     IGCToCLREventSink* sink = GCToEEInterface::EventSink();
     assert(sink != nullptr);
     sink->FireDynamicEvent(name, buf, static_cast<uint32_t>(size));
-    delete[] buf;
+    if (buf != stack_buf)
+    {
+        delete[] buf;
+    }
 };
 
 /*
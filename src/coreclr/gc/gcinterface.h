@@ -11,7 +11,7 @@
 // The minor version of the GC/EE interface. Non-breaking changes are required
 // to bump the minor version number. GCs and EEs with minor version number
 // mismatches can still interopate correctly, with some care.
-#define GC_INTERFACE_MINOR_VERSION 1
+#define GC_INTERFACE_MINOR_VERSION 3
 
 struct ScanContext;
 struct gc_alloc_context;
@@ -166,6 +166,7 @@ struct gc_alloc_context
     void*          gc_reserved_1;
     void*          gc_reserved_2;
     int            alloc_count;
+    int            alloc_refill_count; // Decaying count of the times the GC refilled this context on SOH
 public:
 
     void init()
@@ -179,6 +180,7 @@ public:
         gc_reserved_1 = 0;
         gc_reserved_2 = 0;
         alloc_count = 0;
+        alloc_refill_count = 0;
     }
 };
 
@@ -969,6 +971,9 @@ public:
 
     // Updates given frozen segment
     virtual void UpdateFrozenSegment(segment_handle seg, uint8_t* allocated, uint8_t* committed) PURE_VIRTUAL
+
+    // Gets the number of the heap an allocation context allocates on. Added in version 5.2.
+    virtual int GetAllocContextHeapNumber(gc_alloc_context* acontext) PURE_VIRTUAL
 };
 
 #ifdef WRITE_BARRIER_CHECK
@@ -337,6 +337,18 @@ class recursive_gc_sync;
 //#endif //!USE_REGIONS
 #endif //MULTIPLE_HEAPS
 
+#if defined(MULTIPLE_HEAPS) && defined(USE_REGIONS) && defined(DOUBLY_LINKED_FL)
+// BGC threads that are done sweeping gen2 on their own heap sweep gen2 regions
+// that other heaps' BGC threads haven't gotten to yet.
+#define FEATURE_BGC_SWEEP_STEALING
+#endif //MULTIPLE_HEAPS && USE_REGIONS && DOUBLY_LINKED_FL
+
+#if defined(MULTIPLE_HEAPS) && defined(USE_REGIONS)
+// Server GC can retire heaps, ie, stop allocating on them and give their free regions
+// back, when GC is cheap and bring them back when it isn't - see GCDynamicHeapCount.
+#define DYNAMIC_HEAP_COUNT
+#endif //MULTIPLE_HEAPS && USE_REGIONS
+
 #ifdef FEATURE_CARD_MARKING_STEALING
 class card_marking_enumerator;
 #define CARD_MARKING_STEALING_ARG(a)    ,a
@@ -506,6 +518,9 @@ public:
     int elevation_locked_count;
     BOOL elevation_reduced;
     BOOL minimal_gc;
+#if defined(BACKGROUND_GC) && defined(USE_REGIONS)
+    BOOL sparse_region_compaction;
+#endif //BACKGROUND_GC && USE_REGIONS
     gc_reason reason;
     gc_pause_mode pause_mode;
     BOOL found_finalizers;
@@ -608,9 +623,11 @@ typedef DPTR(class CFinalize)                  PTR_CFinalize;
 //-------------------------------------
 //generation free list. It is an array of free lists bucketed by size, starting at sizes lower than (1 << first_bucket_bits)
 //and doubling each time. The last bucket (index == num_buckets) is for largest sizes with no limit
+//With size classes the sizes lower than (1 << (first_bucket_bits + 1)) are spread over buckets (1 << size_class_bits)
+//apart instead of all going to bucket 0, and the doubling buckets come after them.
 
-#define MAX_SOH_BUCKET_COUNT (13)//Max number of buckets for the SOH generations.
-#define MAX_BUCKET_COUNT (20)//Max number of buckets.
+#define MAX_SOH_BUCKET_COUNT (NUM_GEN2_SC_ALIST)//Max number of buckets for the SOH generations.
+#define MAX_BUCKET_COUNT (NUM_GEN2_SC_ALIST + 1)//Max number of buckets.
 class alloc_list
 {
 #ifdef DOUBLY_LINKED_FL
@@ -667,6 +684,10 @@ class allocator
 {
     int first_bucket_bits;
     unsigned int num_buckets;
+    int size_class_bits;
+    // both 0 unless we use size classes
+    size_t size_class_limit;
+    unsigned int size_class_offset;
     alloc_list first_bucket;
     alloc_list* buckets;
     int gen_number;
@@ -675,12 +696,15 @@ class allocator
     void thread_free_item_end (uint8_t* free_item, uint8_t*& head, uint8_t*& tail, int bn);
 
 public:
-    allocator (unsigned int num_b, int fbb, alloc_list* b, int gen=-1);
+    allocator (unsigned int num_b, int fbb, alloc_list* b, int gen=-1, int scb=0);
 
     allocator()
     {
         num_buckets = 1;
         first_bucket_bits = sizeof(size_t) * 8 - 1;
+        size_class_bits = 0;
+        size_class_limit = 0;
+        size_class_offset = 0;
         // for young gens we just set it to 0 since we don't treat
         // them differently from each other
         gen_number = 0;
@@ -695,6 +719,12 @@ public:
     // there is always such bucket since the last one fits everything
     unsigned int first_suitable_bucket (size_t size)
     {
+        // with size classes the small sizes are mapped straight to their class
+        if (size < size_class_limit)
+        {
+            return (unsigned int)(size >> size_class_bits);
+        }
+
         // sizes taking first_bucket_bits or less are mapped to bucket 0
         // others are mapped to buckets 0, 1, 2 respectively
         size = (size >> first_bucket_bits) | 1;
@@ -706,7 +736,25 @@ public:
         BitScanReverse(&highest_set_bit_index, size);
     #endif
 
-        return min ((unsigned int)highest_set_bit_index, (num_buckets - 1));
+        return min ((unsigned int)highest_set_bit_index + size_class_offset, (num_buckets - 1));
+    }
+
+    // return the first bucket whose items are all at least "size" so the first
+    // item we look at fits. With power of 2 buckets that's the one "size * 2"
+    // goes to, with size classes it's the next class boundary at or above "size".
+    unsigned int first_fitting_bucket (size_t size)
+    {
+        if (size < size_class_limit)
+        {
+            return (unsigned int)((size + ((size_t)1 << size_class_bits) - 1) >> size_class_bits);
+        }
+
+        return first_suitable_bucket (size * 2);
+    }
+
+    bool size_classes_p()
+    {
+        return (size_class_limit != 0);
     }
 
     size_t first_bucket_size()
@@ -1198,6 +1246,15 @@ public:
     void sort_by_committed_and_age();
     static bool is_on_free_list (heap_segment* region, region_free_list free_list[count_free_region_kinds]);
 };
+
+// A range we decommitted recently, so we can tell when we commit it again
+// shortly after.
+struct decommitted_range
+{
+    uint8_t* start;
+    uint8_t* end;
+    size_t   gc_index;
+};
 #endif
 
 enum bookkeeping_element
@@ -1222,21 +1279,66 @@ enum bookkeeping_element
 
 class mark_queue_t
 {
-    static const size_t slot_count = 16;
-    uint8_t* slot_table[slot_count];
+    // the depth is GCMarkPrefetchDepth rounded down to a power of 2
+    static const size_t max_slot_count = 64;
+    static const size_t default_slot_count = 16;
+    uint8_t* slot_table[max_slot_count];
     size_t curr_slot_index;
+    size_t slot_mask;
 
 public:
     mark_queue_t();
 
+    void set_depth (size_t depth);
+
     uint8_t *queue_mark(uint8_t *o);
     uint8_t *queue_mark(uint8_t *o, int condemned_gen);
 
     uint8_t* get_next_marked();
 
+#ifdef BACKGROUND_GC
+    // BGC marks in the mark array so these leave the marking to the caller
+    uint8_t* queue_prefetch (uint8_t* o);
+    uint8_t* get_next_queued();
+    void scan_queued (promote_func* fn, ScanContext* sc);
+#endif //BACKGROUND_GC
+
     void verify_empty();
 };
 
+#ifdef MH_SC_MARK
+// A fixed size Chase-Lev work stealing deque of marked objects whose children still
+// need to be marked. The owning heap pushes and pops at the bottom without interlocked
+// operations (except when racing a thief for the last entry) while other heaps steal
+// from the top. When the deque is full the owner simply keeps the object on its own
+// mark stack.
+class mark_deque_t
+{
+    uint8_t* volatile* buffer;
+    int32_t mask;
+
+    // top is written by thieves and bottom only by the owner so keep them on separate
+    // cache lines.
+    uint8_t pad0[HS_CACHE_LINE_SIZE];
+    int32_t top;
+    uint8_t pad1[HS_CACHE_LINE_SIZE];
+    int32_t bottom;
+    uint8_t pad2[HS_CACHE_LINE_SIZE];
+
+public:
+    mark_deque_t();
+
+    void init (uint8_t** arr, int32_t capacity);
+    void destroy();
+    void reset();
+
+    int32_t count();
+    bool push (uint8_t* o);
+    uint8_t* pop();
+    uint8_t* steal();
+};
+#endif //MH_SC_MARK
+
 //class definition of the internal class
 class gc_heap
 {
@@ -1823,9 +1925,17 @@ protected:
                           size_t& current_promoted_bytes,
                           size_t& last_promoted_bytes);
 
+    PER_HEAP_ISOLATED
+    uint64_t dh_scan_pass_start();
+
+    PER_HEAP
+    void fire_dh_scan_pass_event (int pass, uint64_t start_time, bool promoted_p);
+
+    PER_HEAP
+    size_t soh_allocation_quantum (alloc_context* acontext);
     PER_HEAP
     size_t limit_from_size (size_t size, uint32_t flags, size_t room, int gen_number,
-                            int align_const);
+                            int align_const, alloc_context* acontext);
     PER_HEAP
     allocation_state try_allocate_more_space (alloc_context* acontext, size_t jsize, uint32_t flags,
                                               int alloc_generation_number);
@@ -2072,6 +2182,16 @@ protected:
     size_t decommit_heap_segment_pages_worker (heap_segment* seg, uint8_t *new_committed);
     PER_HEAP_ISOLATED
     bool decommit_step (uint64_t step_milliseconds);
+#ifdef USE_REGIONS
+    PER_HEAP_ISOLATED
+    bool lazy_decommit_p();
+    PER_HEAP_ISOLATED
+    void record_decommit (uint8_t* start, size_t size);
+    PER_HEAP_ISOLATED
+    void record_recommit (uint8_t* start, size_t size);
+    PER_HEAP_ISOLATED
+    void fire_decommit_churn_event();
+#endif //USE_REGIONS
     PER_HEAP
     void decommit_heap_segment (heap_segment* seg);
     PER_HEAP_ISOLATED
@@ -2459,6 +2579,10 @@ protected:
     void background_mark_simple (uint8_t* o THREAD_NUMBER_DCL);
     PER_HEAP
     void background_mark_simple1 (uint8_t* o THREAD_NUMBER_DCL);
+    PER_HEAP
+    uint8_t* background_queue_mark (uint8_t* o THREAD_NUMBER_DCL);
+    PER_HEAP
+    uint8_t* background_next_queued_mark();
     PER_HEAP_ISOLATED
     void background_promote (Object**, ScanContext* , uint32_t);
     PER_HEAP
@@ -2503,6 +2627,29 @@ protected:
     void background_ephemeral_sweep();
     PER_HEAP
     void background_sweep ();
+
+#ifdef FEATURE_BGC_SWEEP_STEALING
+    PER_HEAP
+    void init_bgc_sweep_regions();
+    PER_HEAP
+    bool claim_own_bgc_sweep_region (heap_segment* region, int* index_hint);
+    PER_HEAP
+    heap_segment* steal_bgc_sweep_region (gc_heap* victim);
+    PER_HEAP
+    void background_sweep_stolen_region (gc_heap* victim, heap_segment* region);
+    PER_HEAP
+    void thread_stolen_gap (heap_segment* region, uint8_t* gap_start, size_t size);
+    PER_HEAP
+    void bgc_sweep_steal();
+    PER_HEAP
+    void merge_stolen_bgc_sweep_regions();
+#endif //FEATURE_BGC_SWEEP_STEALING
+#ifdef USE_REGIONS
+    PER_HEAP
+    size_t sparse_region_reclaimable (heap_segment* region, size_t survived);
+    PER_HEAP_ISOLATED
+    void decide_on_sparse_region_compaction();
+#endif //USE_REGIONS
     // Check if we should grow the mark stack proactively to avoid mark stack
     // overflow and grow if necessary.
     PER_HEAP
@@ -2815,6 +2962,12 @@ protected:
 #ifdef MH_SC_MARK
     PER_HEAP
     BOOL check_next_mark_stack (gc_heap* next_heap);
+
+    PER_HEAP
+    bool share_mark (uint8_t* o);
+
+    PER_HEAP
+    BOOL steal_mark_batch (gc_heap* victim);
 #endif //MH_SC_MARK
 
     PER_HEAP
@@ -3316,6 +3469,16 @@ protected:
     size_t generation_size (int gen_number);
     PER_HEAP_ISOLATED
     size_t get_total_survived_size();
+    PER_HEAP_ISOLATED
+    void update_full_blocking_pause_model (bool compact_p, size_t pause_duration, size_t promoted);
+    PER_HEAP_ISOLATED
+    uint64_t predict_full_blocking_pause (bool compact_p);
+    PER_HEAP_ISOLATED
+    bool full_blocking_pause_exceeds_target_p (bool compact_p);
+#ifdef DYNAMIC_HEAP_COUNT
+    PER_HEAP_ISOLATED
+    void update_dynamic_heap_count();
+#endif //DYNAMIC_HEAP_COUNT
     PER_HEAP
     bool update_alloc_info (int gen_number,
                             size_t allocated_size,
@@ -4140,6 +4303,16 @@ public:
     PER_HEAP_ISOLATED
     bool use_large_pages_p;
 
+#ifdef USE_REGIONS
+    // This is if we should ask the OS to back region memory with (transparent) huge pages;
+    // we then commit and decommit region memory in whole huge pages.
+    PER_HEAP_ISOLATED
+    bool use_region_huge_pages_p;
+
+    PER_HEAP_ISOLATED
+    void get_region_huge_page_coverage (size_t* committed, size_t* huge_page_committed);
+#endif //USE_REGIONS
+
 #ifdef HEAP_BALANCE_INSTRUMENTATION
     PER_HEAP_ISOLATED
     size_t last_gc_end_time_us;
@@ -4547,6 +4720,18 @@ protected:
     PER_HEAP
     size_t allocation_quantum;
 
+    // Upper bound of the allocation quantum of contexts that are refilled often.
+    PER_HEAP
+    size_t max_allocation_quantum;
+
+    // Number of times allocation contexts were refilled on SOH since the last GCAllocQuantumStats event.
+    PER_HEAP
+    size_t soh_alloc_refills;
+
+    // If false, every allocation context gets allocation_quantum, as it did before the quantum was sized per context.
+    PER_HEAP_ISOLATED
+    bool adaptive_alloc_quantum_p;
+
     PER_HEAP
     size_t alloc_contexts_used;
 
@@ -4664,12 +4849,21 @@ protected:
 #ifdef HOST_64BIT
     // bucket 0 contains sizes less than 256
 #define BASE_GEN2_ALIST_BITS (7)
+    // with GCGen2SizeClasses every pointer size multiple under 1k gets its own bucket
+#define GEN2_SIZE_CLASS_BITS (3)
 #else
     // bucket 0 contains sizes less than 128
 #define BASE_GEN2_ALIST_BITS (6)
+    // with GCGen2SizeClasses every pointer size multiple under 512 gets its own bucket
+#define GEN2_SIZE_CLASS_BITS (2)
 #endif // HOST_64BIT
+    // the size classes replace the first 3 power of 2 buckets, the last bucket
+    // starts at the same size in both modes
+#define BASE_GEN2_SC_ALIST_BITS (BASE_GEN2_ALIST_BITS + 2)
+#define NUM_GEN2_SIZE_CLASSES (1 << (BASE_GEN2_SC_ALIST_BITS + 1 - GEN2_SIZE_CLASS_BITS))
+#define NUM_GEN2_SC_ALIST (NUM_GEN2_SIZE_CLASSES + NUM_GEN2_ALIST - 3)
     PER_HEAP
-    alloc_list gen2_alloc_list[NUM_GEN2_ALIST-1];
+    alloc_list gen2_alloc_list[NUM_GEN2_SC_ALIST-1];
 
 #define NUM_POH_ALIST (19)
     // bucket 0 contains sizes less than 256
@@ -4746,7 +4940,7 @@ protected:
     // items or plugs that we had to allocate in condemned. We only fire
     // these events on verbose level and stop at max_etw_item_count items.
     PER_HEAP
-    etw_bucket_info bucket_info[NUM_GEN2_ALIST];
+    etw_bucket_info bucket_info[NUM_GEN2_SC_ALIST];
 
     PER_HEAP
     void init_bucket_info();
@@ -4861,6 +5055,16 @@ protected:
     PER_HEAP_ISOLATED
     int conserve_mem_setting;
 
+    // Pause target (in us) from GCPauseTargetMs, 0 if not specified. When set we predict
+    // how long a blocking gen2 would take and prefer BGC or sweeping if that exceeds it.
+    PER_HEAP_ISOLATED
+    uint64_t pause_target_us;
+
+    // How many us a blocking gen2 took per MB promoted, averaged over the recent ones;
+    // [0] is for sweeping and [1] for compacting gen2s. 0 means we haven't seen one yet.
+    PER_HEAP_ISOLATED
+    double full_blocking_pause_us_per_mb[2];
+
     PER_HEAP
     BOOL gen0_bricks_cleared;
     PER_HEAP
@@ -4960,6 +5164,62 @@ protected:
     PER_HEAP
     heap_segment* current_sweep_seg;
 #endif //DOUBLY_LINKED_FL
+
+#ifdef FEATURE_BGC_SWEEP_STEALING
+    PER_HEAP_ISOLATED
+    bool bgc_sweep_stealing_p;
+
+    // The gen2 regions this heap had when BGC sweep started, in the order they are on
+    // the gen2 region list. Each entry is claimed exactly once, by this heap's BGC thread
+    // which goes from the front or by another heap's which goes from the back (in which
+    // case the entry is tagged with bgc_sweep_stolen_tag) - see claim_own_bgc_sweep_region
+    // and steal_bgc_sweep_region.
+    PER_HEAP
+    heap_segment** bgc_sweep_regions;
+    PER_HEAP
+    int32_t bgc_sweep_regions_capacity;
+    PER_HEAP
+    int32_t bgc_sweep_region_count;
+
+    // The next entry another heap can steal is the one before this index.
+    PER_HEAP
+    VOLATILE(int32_t) bgc_sweep_steal_index;
+
+    // How many other heaps' BGC threads are trying to steal or are sweeping one of our
+    // regions; we wait for this to drop to 0 before threading what they swept onto our
+    // gen2 free list.
+    PER_HEAP
+    VOLATILE(int32_t) bgc_sweep_stealers;
+
+    // What the other heaps found sweeping our regions that we need to add to our gen2
+    // dynamic data and free obj space (the free list space is recorded in the regions).
+    PER_HEAP
+    VOLATILE(size_t) bgc_sweep_stolen_survived;
+    PER_HEAP
+    VOLATILE(size_t) bgc_sweep_stolen_free_obj_removed;
+
+    // How many regions (and bytes of them) this heap swept for other heaps, for the
+    // BGCSweepStealStats event.
+    PER_HEAP
+    size_t bgc_sweep_steal_count;
+    PER_HEAP
+    size_t bgc_sweep_steal_size;
+#endif //FEATURE_BGC_SWEEP_STEALING
+
+#ifdef USE_REGIONS
+    PER_HEAP_ISOLATED
+    bool sparse_region_compaction_p;
+
+    // Set at the end of a BGC that found enough space in sparse gen2 regions that only
+    // compacting them would get back; the next GC becomes a blocking gen2 that compacts
+    // the sparse regions and sweeps the rest in plan.
+    PER_HEAP_ISOLATED
+    bool sparse_region_compaction_pending_p;
+
+    // What's not live in the sparse gen2 regions this heap's BGC sweep went through.
+    PER_HEAP
+    VOLATILE(size_t) bgc_sparse_regions_reclaimable;
+#endif //USE_REGIONS
 #endif //BACKGROUND_GC
 
     PER_HEAP
@@ -5000,6 +5260,36 @@ protected:
 
     PER_HEAP_ISOLATED
     region_free_list global_free_huge_regions;
+
+    // Regions decommit_step reset (MADV_FREE on Linux) instead of decommitting.
+    // They are still committed as far as we are concerned and can be handed out
+    // again without a recommit; they get decommitted for real if they are still
+    // here lazy_decommit_gcs GCs after being reset.
+    PER_HEAP_ISOLATED
+    region_free_list global_regions_to_lazy_decommit[count_free_region_kinds];
+
+    // GCLazyDecommitGCs, 0 means we decommit right away.
+    PER_HEAP_ISOLATED
+    int lazy_decommit_gcs;
+
+    // What decommit_step did since the last GCDecommitChurn event, and how much
+    // of what we decommitted got committed again within DECOMMIT_CHURN_GCS GCs.
+    PER_HEAP_ISOLATED
+    size_t lazy_decommit_reset_size;
+
+    PER_HEAP_ISOLATED
+    size_t hard_decommit_size;
+
+    PER_HEAP_ISOLATED
+    VOLATILE(size_t) decommit_churn_size;
+
+#define DECOMMIT_CHURN_HISTORY 64
+#define DECOMMIT_CHURN_GCS 10
+    PER_HEAP_ISOLATED
+    decommitted_range recent_decommits[DECOMMIT_CHURN_HISTORY];
+
+    PER_HEAP_ISOLATED
+    int recent_decommit_index;
 #endif //USE_REGIONS
 
     PER_HEAP
@@ -5088,6 +5378,38 @@ public:
     static
     int n_heaps;
 
+#ifdef DYNAMIC_HEAP_COUNT
+    // Allocation contexts are only directed to heaps below this and only they get a gen0
+    // budget and free regions. The rest still take part in every GC since they can still
+    // have objects in older generations. This is n_heaps unless GCDynamicHeapCount is on.
+    static
+    int n_active_heaps;
+
+    PER_HEAP_ISOLATED
+    bool dynamic_heap_count_p;
+
+    // The % of time spent in blocking GCs we aim for; we add heaps when we are above it and
+    // retire heaps when we are well below it.
+    PER_HEAP_ISOLATED
+    float dynamic_heap_count_target_cost;
+
+    // The % of time spent in each of the last few blocking GCs, from the end of the GC before.
+    #define dynamic_heap_count_sample_count 3
+    PER_HEAP_ISOLATED
+    float dynamic_heap_count_samples[dynamic_heap_count_sample_count];
+
+    PER_HEAP_ISOLATED
+    size_t dynamic_heap_count_sample_index;
+
+    // We only change the heap count again once we've got new samples for all of
+    // dynamic_heap_count_samples, so they reflect the current count.
+    PER_HEAP_ISOLATED
+    size_t dynamic_heap_count_samples_since_change;
+
+    PER_HEAP_ISOLATED
+    uint64_t dynamic_heap_count_last_gc_end;
+#endif //DYNAMIC_HEAP_COUNT
+
     static
     gc_heap** g_heaps;
 
@@ -5103,6 +5425,11 @@ public:
 #ifdef MH_SC_MARK
     PER_HEAP_ISOLATED
     int*  g_mark_stack_busy;
+
+    // Number of heaps currently in mark_steal looking for work; while this is non zero
+    // heaps that are marking share objects through their mark deque.
+    PER_HEAP_ISOLATED
+    VOLATILE(int32_t) mark_steal_idle_heaps;
 #endif //MH_SC_MARK
 #else
 #if !defined(USE_REGIONS) || defined(_DEBUG)
@@ -5184,6 +5511,29 @@ protected:
 #endif //USE_REGIONS
     PER_HEAP
     mark_queue_t mark_queue;
+
+#ifdef BACKGROUND_GC
+    // separate from mark_queue since a foreground GC can happen while BGC is marking
+    PER_HEAP
+    mark_queue_t background_mark_queue;
+#endif //BACKGROUND_GC
+
+#ifdef MH_SC_MARK
+    PER_HEAP
+    mark_deque_t mark_deque;
+
+    // Time (in us) this heap spent in mark_steal marking stolen work and finding
+    // nothing to do, and how much it stole from other heaps' mark deques, for the
+    // GCMarkStealStats event.
+    PER_HEAP
+    uint64_t mark_steal_work_time;
+    PER_HEAP
+    uint64_t mark_steal_idle_time;
+    PER_HEAP
+    size_t mark_steal_batch_count;
+    PER_HEAP
+    size_t mark_steal_object_count;
+#endif //MH_SC_MARK
 }; // class gc_heap
 
 #ifdef FEATURE_PREMORTEM_FINALIZATION
@@ -5765,6 +6115,9 @@ public:
     #define MAX_AGE_IN_FREE 99
     #define AGE_IN_FREE_TO_DECOMMIT 20
     int             age_in_free;
+    // With GCLazyDecommitGCs this is the GC index at which decommit_step reset
+    // this free region instead of decommitting it, 0 if it hasn't been reset.
+    size_t          lazy_decommit_gc;
     // This is currently only used by regions that are swept in plan -
     // we then thread this list onto the generation's free list.
     // We may keep per region free list later which requires more work.
@@ -5775,6 +6128,12 @@ public:
 
     PTR_heap_segment prev_free_region;
     region_free_list* containing_free_list;
+#ifdef MULTIPLE_HEAPS
+    // The NUMA node of the heap that last used this region. Most of its
+    // committed pages were touched there so this is where we'd like to
+    // reuse it when it's on the free list.
+    uint16_t        numa_node;
+#endif //MULTIPLE_HEAPS
 
     // Fields that we need to provide in response to a
     // random address that might land anywhere on the region.
@@ -6194,6 +6553,18 @@ int& heap_segment_age_in_free (heap_segment* inst)
     return inst->age_in_free;
 }
 inline
+size_t& heap_segment_lazy_decommit_gc (heap_segment* inst)
+{
+    return inst->lazy_decommit_gc;
+}
+#ifdef MULTIPLE_HEAPS
+inline
+uint16_t& heap_segment_numa_node (heap_segment* inst)
+{
+    return inst->numa_node;
+}
+#endif //MULTIPLE_HEAPS
+inline
 int& heap_segment_survived (heap_segment* inst)
 {
     return inst->survived;
@@ -73,12 +73,13 @@ enum gc_condemn_reason_condition
     gen_joined_servo_postpone = 27,
     gen_joined_stress_mix = 28,
     gen_joined_stress = 29,
-    gcrc_max = 30
+    gen_joined_sparse_regions = 30,
+    gcrc_max = 31
 };
 
 #ifdef DT_LOG
 static char* record_condemn_reasons_gen_header = "[cg]i|f|a|t|";
-static char* record_condemn_reasons_condition_header = "[cc]i|e|h|v|l|l|e|m|m|m|m|g|o|s|n|b|a|1|2|3|4|5|6|7|8|9|0|a|b";
+static char* record_condemn_reasons_condition_header = "[cc]i|e|h|v|l|l|e|m|m|m|m|g|o|s|n|b|a|1|2|3|4|5|6|7|8|9|0|a|b|c";
 static char char_gen_number[4] = {'0', '1', '2', '3'};
 #endif //DT_LOG
 
@@ -249,7 +250,8 @@ enum gc_heap_compact_reason
     compact_vhigh_mem_frag = 9,
     compact_no_gc_mode = 10,
     compact_aggressive_compacting = 11,
-    max_compact_reasons_count = 12
+    compact_sparse_regions = 12,
+    max_compact_reasons_count = 13
 };
 
 #ifndef DACCESS_COMPILE
@@ -266,7 +268,8 @@ static BOOL gc_heap_compact_reason_mandatory_p[] =
     TRUE, //compact_high_mem_frag = 8,
     TRUE, //compact_vhigh_mem_frag = 9,
     TRUE, //compact_no_gc_mode = 10,
-    TRUE //compact_aggressive_compacting = 11
+    TRUE, //compact_aggressive_compacting = 11
+    TRUE //compact_sparse_regions = 12
 };
 
 static BOOL gc_expand_mechanism_mandatory_p[] =
@@ -293,7 +296,9 @@ static char* str_heap_compact_reasons[] =
     "high memory load (ephemeral GC)",
     "high memory load and frag",
     "very high memory load and frag",
-    "no gc mode"
+    "no gc mode",
+    "aggressive compacting GC",
+    "sparse gen2 regions"
 };
 #endif //DT_LOG
 
@@ -90,7 +90,22 @@ bool GCScan::GcDhReScan(ScanContext* sc)
     // Locate our dependent handle context based on the GC context.
     DhContext *pDhContext = Ref_GetDependentHandleContext(sc);
 
-    return Ref_ScanDependentHandlesForPromotion(pDhContext);
+    return Ref_RescanDependentHandlesForPromotion(pDhContext);
+}
+
+// Returns true if GcDhReScan shares out the handles of all GC threads between them instead of each thread
+// scanning its own (see Ref_RescanDependentHandlesForPromotion).
+bool GCScan::GcDhReScanShared(ScanContext* sc)
+{
+    WRAPPER_NO_CONTRACT;
+    return Ref_DependentHandleRescansShared(sc);
+}
+
+// Called by a single GC thread before each round of shared rescans.
+void GCScan::GcDhBeginReScan()
+{
+    WRAPPER_NO_CONTRACT;
+    Ref_BeginSharedDependentHandleRescan();
 }
 
 /*
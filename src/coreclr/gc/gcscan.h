@@ -28,6 +28,8 @@ struct DhContext
     int             m_iCondemned;               // The condemned generation
     int             m_iMaxGen;                  // The maximum generation
     ScanContext    *m_pScanContext;             // The GC's scan context for this phase
+    int32_t         m_iNextSegment;             // Shared rescans: index of the next segment this thread walks past
+    int32_t         m_iClaimedSegment;          // Shared rescans: index of the segment this thread claimed last
 };
 
 class GCScan
@@ -74,6 +76,12 @@ class GCScan
     // any objects were promoted as a result.
     static bool GcDhReScan(ScanContext* sc);
 
+    // Under server GC the rescans can share out the handles of all GC threads between them. In that case
+    // every thread has to call GcDhReScan, not just the ones whose own handles have unpromoted secondaries,
+    // and a single thread has to call GcDhBeginReScan before each round of GcDhReScan calls.
+    static bool GcDhReScanShared(ScanContext* sc);
+    static void GcDhBeginReScan();
+
     // post-promotions callback
     static void GcPromotionsGranted (int condemned, int max_gen,
                                      ScanContext* sc);
@@ -17,10 +17,11 @@
 #include "handletable.inl"
 #include "gcenv.inl"
 #include "gceventstatus.h"
+#include "cardtablescan.h"
 
 #define SERVER_GC 1
 
-#if defined(TARGET_AMD64) && defined(TARGET_WINDOWS)
+#if (defined(TARGET_AMD64) && defined(TARGET_WINDOWS)) || defined(TARGET_ARM64)
 #include "vxsort/do_vxsort.h"
 #endif
 
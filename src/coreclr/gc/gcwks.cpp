@@ -15,12 +15,13 @@
 #include "handletable.inl"
 #include "gcenv.inl"
 #include "gceventstatus.h"
+#include "cardtablescan.h"
 
 #ifdef SERVER_GC
 #undef SERVER_GC
 #endif
 
-#if defined(TARGET_AMD64) && defined(TARGET_WINDOWS)
+#if (defined(TARGET_AMD64) && defined(TARGET_WINDOWS)) || defined(TARGET_ARM64)
 #include "vxsort/do_vxsort.h"
 #endif
 
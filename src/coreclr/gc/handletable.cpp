@@ -35,6 +35,8 @@ void DEBUG_PostGCScanHandler(HandleTable *pTable, const uint32_t *types, uint32_
 void DEBUG_LogScanningStatistics(HandleTable *pTable, uint32_t level);
 #endif
 
+extern int getNumberOfSlots();
+
 /*--------------------------------------------------------------------------*/
 
 
@@ -138,6 +140,25 @@ HHANDLETABLE HndCreateHandleTable(const uint32_t *pTypeFlags, uint32_t uTypeCoun
     // remember how many types we are supporting
     pTable->uTypeCount = uTypeCount;
 
+    // without server GC every thread allocates from this one table, so give
+    // each processor its own cache; failing to allocate them is not fatal
+    if ((getNumberOfSlots() == 1) && GCToOSInterface::CanGetCurrentProcessorNumber())
+    {
+        uint32_t uProcessorCacheCount = GCToOSInterface::GetTotalProcessorCount();
+        if (uProcessorCacheCount > MAX_PROCESSOR_CACHES)
+            uProcessorCacheCount = MAX_PROCESSOR_CACHES;
+
+        if (uProcessorCacheCount > 1)
+        {
+            pTable->pProcessorCaches = new (nothrow) HandleProcessorCache[uProcessorCacheCount];
+            if (pTable->pProcessorCaches)
+            {
+                memset((void*)pTable->pProcessorCaches, 0, uProcessorCacheCount * sizeof(HandleProcessorCache));
+                pTable->uProcessorCacheCount = uProcessorCacheCount;
+            }
+        }
+    }
+
     // Store user data
     pTable->uTableIndex = (uint32_t) -1;
 
@@ -209,6 +230,9 @@ void HndDestroyHandleTable(HHANDLETABLE hTable)
         pSegment = pNextSegment;
     }
 
+    // free the processor caches, the handles in them went with the segments
+    delete [] pTable->pProcessorCaches;
+
     // free the table's memory
     delete [] (uint8_t*) pTable;
 }
@@ -795,6 +819,78 @@ void HndScanHandlesForGC(HHANDLETABLE hTable, HANDLESCANPROC scanProc, uintptr_t
 #ifndef DACCESS_COMPILE
 
 
+/*
+ * HndScanClaimedHandlesForGC
+ *
+ * Single type scanning entrypoint for GC threads that share out the segments of
+ * a table between them.
+ *
+ * Each segment is only scanned if pfnClaim says the calling thread should scan it,
+ * so every thread must walk the tables and their segments in the same order. This
+ * does none of the segment maintenance HndScanHandlesForGC does so the segment list
+ * can't change under the threads walking it; the table must already have been
+ * scanned with HndScanHandlesForGC earlier in this GC.
+ *
+ */
+void HndScanClaimedHandlesForGC(HHANDLETABLE hTable, HANDLESCANPROC scanProc, uintptr_t param1, uintptr_t param2,
+                                uint32_t type, uint32_t condemned, uint32_t maxgen, uint32_t flags,
+                                HANDLESEGMENTCLAIMPROC pfnClaim, uintptr_t claimParam)
+{
+    WRAPPER_NO_CONTRACT;
+
+    // tables are only shared between threads while the EE is suspended
+    _ASSERTE(!(flags & HNDGCF_ASYNC));
+    _ASSERTE(scanProc);
+
+    // fetch the table pointer
+    PTR_HandleTable pTable = Table(hTable);
+
+    // pick the same block callback HndScanHandlesForGC would
+    BOOL enumUserData =
+        ((flags & HNDGCF_EXTRAINFO) &&
+        TypesRequireUserDataScanning(pTable, &type, 1));
+
+    BLOCKSCANPROC pfnBlock;
+    if (condemned >= maxgen)
+    {
+        pfnBlock = enumUserData ? BlockScanBlocksWithUserData : BlockScanBlocksWithoutUserData;
+    }
+    else
+    {
+        pfnBlock = BlockScanBlocksEphemeral;
+    }
+
+    // set up parameters for scan callbacks
+    ScanCallbackInfo info;
+
+    info.uFlags          = flags;
+    info.fEnumUserData   = enumUserData;
+    info.dwAgeMask       = BuildAgeMask(condemned, maxgen);
+    info.pCurrentSegment = NULL;
+    info.pfnScan         = scanProc;
+    info.param1          = param1;
+    info.param2          = param2;
+
+#if defined(_DEBUG)
+    info.DEBUG_BlocksScanned                = 0;
+    info.DEBUG_BlocksScannedNonTrivially    = 0;
+    info.DEBUG_HandleSlotsScanned           = 0;
+    info.DEBUG_HandlesActuallyScanned       = 0;
+#endif
+
+    PTR_TableSegment pSegment = NULL;
+    while ((pSegment = QuickSegmentIterator(pTable, pSegment)) != NULL)
+    {
+        if (pfnClaim(claimParam))
+        {
+            info.pCurrentSegment = pSegment;
+            SegmentScanByTypeChain(pSegment, type, pfnBlock, &info);
+            info.pCurrentSegment = NULL;
+        }
+    }
+}
+
+
 /*
  * HndResetAgeMap
  *
@@ -906,8 +1002,6 @@ void HndNotifyGcCycleComplete(HHANDLETABLE hTable, uint32_t condemned, uint32_t
 #endif
 }
 
-extern int getNumberOfSlots();
-
 
 /*
  * HndCountHandles
@@ -964,6 +1058,13 @@ uint32_t HndCountHandles(HHANDLETABLE hTable)
         if (*pQuickCache)
             ++uCacheCount;
 
+    // the processor caches are read without their locks as well
+    for (uint32_t u = 0; u < pTable->uProcessorCacheCount; u++)
+    {
+        for (uint32_t uType = 0; uType < pTable->uTypeCount; uType++)
+            uCacheCount += pTable->pProcessorCaches[u].rgCount[uType];
+    }
+
     // return the number of handles marked as "used" that are not
     // residing in the cache
     return (uCount - uCacheCount);
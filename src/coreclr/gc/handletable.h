@@ -123,6 +123,23 @@ void            HndScanHandlesForGC(HHANDLETABLE hTable,
                                     uint32_t maxgen,
                                     uint32_t flags);
 
+/*
+ * Callback that says whether the calling thread should scan the next segment of a table in
+ * HndScanClaimedHandlesForGC.
+ */
+typedef bool (CALLBACK *HANDLESEGMENTCLAIMPROC)(uintptr_t lParam);
+
+void            HndScanClaimedHandlesForGC(HHANDLETABLE hTable,
+                                           HANDLESCANPROC scanProc,
+                                           uintptr_t param1,
+                                           uintptr_t param2,
+                                           uint32_t type,
+                                           uint32_t condemned,
+                                           uint32_t maxgen,
+                                           uint32_t flags,
+                                           HANDLESEGMENTCLAIMPROC pfnClaim,
+                                           uintptr_t claimParam);
+
 void            HndResetAgeMap(HHANDLETABLE hTable, const uint32_t *types, uint32_t typeCount, uint32_t condemned, uint32_t maxgen, uint32_t flags);
 void            HndVerifyTable(HHANDLETABLE hTable, const uint32_t *types, uint32_t typeCount, uint32_t condemned, uint32_t maxgen, uint32_t flags);
 
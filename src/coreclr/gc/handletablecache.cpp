@@ -704,14 +704,14 @@ void TableCacheMissOnFree(HandleTable *pTable, HandleTypeCache *pCache, uint32_t
 
 
 /*
- * TableAllocSingleHandleFromCache
+ * TableAllocSingleHandleFromSharedCache
  *
  * Gets a single handle of the specified type from the handle table by
  * trying to fetch it from the reserve cache for that handle type.  If the
  * reserve cache is empty, this routine calls TableCacheMissOnAlloc.
  *
  */
-OBJECTHANDLE TableAllocSingleHandleFromCache(HandleTable *pTable, uint32_t uType)
+static OBJECTHANDLE TableAllocSingleHandleFromSharedCache(HandleTable *pTable, uint32_t uType)
 {
     WRAPPER_NO_CONTRACT;
 
@@ -756,12 +756,141 @@ OBJECTHANDLE TableAllocSingleHandleFromCache(HandleTable *pTable, uint32_t uType
 }
 
 
+/*
+ * TableFreeSingleHandleToSharedCache
+ *
+ * Returns a single cleared handle of the specified type to the handle
+ * table by trying to store it in the free cache for that handle type.  If
+ * the free cache is full, this routine calls TableCacheMissOnFree.
+ *
+ */
+static void TableFreeSingleHandleToSharedCache(HandleTable *pTable, uint32_t uType, OBJECTHANDLE handle)
+{
+    WRAPPER_NO_CONTRACT;
+
+    // is there room in the quick cache?
+    if (!pTable->rgQuickCache[uType])
+    {
+        // yup - try to stuff our handle in the slot we saw
+        handle = Interlocked::ExchangePointer(&pTable->rgQuickCache[uType], handle);
+
+        // if we didn't end up with another handle then we're done
+        if (!handle)
+            return;
+    }
+
+    // ok, get the main handle cache for this type
+    HandleTypeCache *pCache = pTable->rgMainCache + uType;
+
+    // try to take a free slot from the main cache
+    int32_t lFreeIndex = Interlocked::Decrement(&pCache->lFreeIndex);
+
+    // did we underflow?
+    if (lFreeIndex < 0)
+    {
+        // yep - we're out of free slots
+        TableCacheMissOnFree(pTable, pCache, uType, handle);
+        return;
+    }
+
+    // we got a slot - save the handle in the free bank
+    pCache->rgFreeBank[lFreeIndex] = handle;
+}
+
+
+/*
+ * TableGetProcessorCache
+ *
+ * Acquires the processor cache of the current processor.  Returns NULL if
+ * the table has no processor caches or if the cache is in use by another
+ * thread.
+ *
+ */
+static HandleProcessorCache *TableGetProcessorCache(HandleTable *pTable)
+{
+    WRAPPER_NO_CONTRACT;
+
+    if (!pTable->pProcessorCaches)
+        return NULL;
+
+    uint32_t uProcessor = GCToOSInterface::GetCurrentProcessorNumber() % pTable->uProcessorCacheCount;
+    HandleProcessorCache *pProcessorCache = pTable->pProcessorCaches + uProcessor;
+
+    // never wait for the cache - the shared caches are always an option
+    if ((pProcessorCache->lLock != 0) || (Interlocked::CompareExchange(&pProcessorCache->lLock, 1, 0) != 0))
+        return NULL;
+
+    return pProcessorCache;
+}
+
+
+/*
+ * TableReleaseProcessorCache
+ *
+ * Releases a processor cache acquired by TableGetProcessorCache.
+ *
+ */
+static void TableReleaseProcessorCache(HandleProcessorCache *pProcessorCache)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    // NOTE: we use an interlocked exchange here to publish the cache contents before the release
+    Interlocked::Exchange(&pProcessorCache->lLock, 0);
+}
+
+
+/*
+ * TableAllocSingleHandleFromCache
+ *
+ * Gets a single handle of the specified type from the handle table.  The
+ * handle is taken from the current processor's cache if the table has one,
+ * refilling half of it from the shared caches when it is empty.  Otherwise
+ * the handle comes from the shared caches.
+ *
+ */
+OBJECTHANDLE TableAllocSingleHandleFromCache(HandleTable *pTable, uint32_t uType)
+{
+    WRAPPER_NO_CONTRACT;
+
+    HandleProcessorCache *pProcessorCache = TableGetProcessorCache(pTable);
+    if (!pProcessorCache)
+        return TableAllocSingleHandleFromSharedCache(pTable, uType);
+
+    OBJECTHANDLE *pHandles = pProcessorCache->rgHandles[uType];
+    uint32_t uCount = pProcessorCache->rgCount[uType];
+
+    // refill in a batch so the shared caches are only touched every few allocations
+    while (uCount < (HANDLES_PER_PROCESSOR_CACHE / 2))
+    {
+        OBJECTHANDLE handle = TableAllocSingleHandleFromSharedCache(pTable, uType);
+        if (!handle)
+            break;
+
+        pHandles[uCount++] = handle;
+    }
+
+    OBJECTHANDLE handle = NULL;
+    if (uCount)
+    {
+        uCount--;
+        handle = pHandles[uCount];
+        pHandles[uCount] = NULL;
+    }
+
+    pProcessorCache->rgCount[uType] = uCount;
+    TableReleaseProcessorCache(pProcessorCache);
+
+    return handle;
+}
+
+
 /*
  * TableFreeSingleHandleToCache
  *
- * Returns a single handle of the specified type to the handle table
- * by trying to store it in the free cache for that handle type.  If the
- * free cache is full, this routine calls TableCacheMissOnFree.
+ * Returns a single handle of the specified type to the handle table.  The
+ * handle is stored in the current processor's cache if the table has one,
+ * draining half of it to the shared caches when it is full.  Otherwise the
+ * handle goes to the shared caches.
  *
  */
 void TableFreeSingleHandleToCache(HandleTable *pTable, uint32_t uType, OBJECTHANDLE handle)
@@ -786,33 +915,31 @@ void TableFreeSingleHandleToCache(HandleTable *pTable, uint32_t uType, OBJECTHAN
     if (TypeHasUserData(pTable, uType))
         HandleQuickSetUserData(handle, 0L);
 
-    // is there room in the quick cache?
-    if (!pTable->rgQuickCache[uType])
+    HandleProcessorCache *pProcessorCache = TableGetProcessorCache(pTable);
+    if (!pProcessorCache)
     {
-        // yup - try to stuff our handle in the slot we saw
-        handle = Interlocked::ExchangePointer(&pTable->rgQuickCache[uType], handle);
-
-        // if we didn't end up with another handle then we're done
-        if (!handle)
-            return;
+        TableFreeSingleHandleToSharedCache(pTable, uType, handle);
+        return;
     }
 
-    // ok, get the main handle cache for this type
-    HandleTypeCache *pCache = pTable->rgMainCache + uType;
-
-    // try to take a free slot from the main cache
-    int32_t lFreeIndex = Interlocked::Decrement(&pCache->lFreeIndex);
+    OBJECTHANDLE *pHandles = pProcessorCache->rgHandles[uType];
+    uint32_t uCount = pProcessorCache->rgCount[uType];
 
-    // did we underflow?
-    if (lFreeIndex < 0)
+    // drain in a batch so the shared caches are only touched every few frees
+    if (uCount == HANDLES_PER_PROCESSOR_CACHE)
     {
-        // yep - we're out of free slots
-        TableCacheMissOnFree(pTable, pCache, uType, handle);
-        return;
+        while (uCount > (HANDLES_PER_PROCESSOR_CACHE / 2))
+        {
+            uCount--;
+            TableFreeSingleHandleToSharedCache(pTable, uType, pHandles[uCount]);
+            pHandles[uCount] = NULL;
+        }
     }
 
-    // we got a slot - save the handle in the free bank
-    pCache->rgFreeBank[lFreeIndex] = handle;
+    pHandles[uCount++] = handle;
+
+    pProcessorCache->rgCount[uType] = uCount;
+    TableReleaseProcessorCache(pProcessorCache);
 }
 
 
@@ -113,6 +113,10 @@ C_ASSERT (HANDLE_HANDLES_PER_MASK * 2 == HANDLE_HANDLES_PER_BLOCK);
 // bulk alloc policy defines
 #define SMALL_ALLOC_COUNT               (HANDLES_PER_CACHE_BANK / 10)
 
+// per-processor cache defines
+#define HANDLES_PER_PROCESSOR_CACHE     8   // refilled and drained by half at a time
+#define MAX_PROCESSOR_CACHES            64
+
 // misc constants
 #define MASK_FULL                       (0)
 #define MASK_EMPTY                      (0xFFFFFFFF)
@@ -344,6 +348,34 @@ struct HandleTypeCache
     int32_t lFreeIndex;
 };
 
+
+/*
+ * Handle Processor Cache
+ *
+ * Defines the layout of a per-processor handle cache.  Each processor owns a
+ * small magazine of handles for every type, which is refilled from and drained
+ * to the table's shared caches in batches.  The lock is only ever acquired with
+ * a try-lock; a thread that finds it taken (e.g. because it was rescheduled on
+ * another processor) just falls back to the shared caches.
+ */
+struct HandleProcessorCache
+{
+    /*
+     * try-lock owning this cache
+     */
+    int32_t lLock;
+
+    /*
+     * number of handles of each type in this cache
+     */
+    uint32_t rgCount[HANDLE_MAX_INTERNAL_TYPES];
+
+    /*
+     * handles of each type in this cache
+     */
+    OBJECTHANDLE rgHandles[HANDLE_MAX_INTERNAL_TYPES][HANDLES_PER_PROCESSOR_CACHE];
+};
+
 /*---------------------------------------------------------------------------*/
 
 
@@ -519,6 +551,12 @@ struct HandleTable
      */
     OBJECTHANDLE rgQuickCache[HANDLE_MAX_INTERNAL_TYPES];   // interlocked ops used here
 
+    /*
+     * per-processor handle caches, NULL if the table doesn't use them
+     */
+    HandleProcessorCache *pProcessorCaches;
+    uint32_t uProcessorCacheCount;
+
     /*
      * debug-only statistics
      */
@@ -886,6 +924,15 @@ void TableFreeHandlesToCache(HandleTable *pTable, uint32_t uType, const OBJECTHA
  *
  ****************************************************************************/
 
+/*
+ * SegmentScanByTypeChain
+ *
+ * Implements the single-type block scanning loop for a single segment.
+ *
+ */
+void SegmentScanByTypeChain(PTR_TableSegment pSegment, uint32_t uType, BLOCKSCANPROC pfnBlockHandler, ScanCallbackInfo *pInfo);
+
+
 /*
  * TableScanHandles
  *
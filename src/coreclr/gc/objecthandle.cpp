@@ -1260,6 +1260,96 @@ bool Ref_ScanDependentHandlesForPromotion(DhContext *pDhContext)
     return fAnyPromotions;
 }
 
+// Under server GC each thread's dependent handles are in the tables for its slot, and when one thread
+// created most of them (filling a big ConditionalWeakTable, say) the other threads spend every rescan
+// waiting for it in the GC's join. So apart from the initial scan, which does the table maintenance, the
+// rescans share out the segments of all slots' tables: every thread walks them in the same order and only
+// scans the ones it claims by bumping g_dhRescanNextSegment.
+static int32_t volatile g_dhRescanNextSegment = 0;
+
+bool Ref_DependentHandleRescansShared(ScanContext* sc)
+{
+    WRAPPER_NO_CONTRACT;
+
+    // only while the EE is suspended, otherwise handles can be allocated under us
+    return (IsServerHeap() && (getNumberOfSlots() > 1) && !sc->concurrent);
+}
+
+void Ref_BeginSharedDependentHandleRescan()
+{
+    LIMITED_METHOD_CONTRACT;
+    g_dhRescanNextSegment = 0;
+}
+
+static bool CALLBACK ClaimDependentHandleSegment(uintptr_t lParam)
+{
+    WRAPPER_NO_CONTRACT;
+
+    DhContext *pDhContext = (DhContext *)lParam;
+
+    // claim the next segment once we've walked past the one we claimed last
+    if (pDhContext->m_iClaimedSegment < pDhContext->m_iNextSegment)
+    {
+        pDhContext->m_iClaimedSegment = Interlocked::Increment(&g_dhRescanNextSegment) - 1;
+    }
+
+    return (pDhContext->m_iNextSegment++ == pDhContext->m_iClaimedSegment);
+}
+
+// Rescan the dependent handles after the initial scan (see Ref_ScanDependentHandlesForPromotion). When the
+// rescans are shared this does a single pass over the segments this thread claims, the GC loops until no
+// thread promotes anything.
+//
+// Returns true if any promotions resulted from this scan.
+bool Ref_RescanDependentHandlesForPromotion(DhContext *pDhContext)
+{
+    if (!Ref_DependentHandleRescansShared(pDhContext->m_pScanContext))
+    {
+        return Ref_ScanDependentHandlesForPromotion(pDhContext);
+    }
+
+    LOG((LF_GC, LL_INFO10000, "Sharing out rescan of dependent handles in generation %u\n", pDhContext->m_iCondemned));
+
+    pDhContext->m_fUnpromotedPrimaries = false;
+    pDhContext->m_fPromoted = false;
+    pDhContext->m_iNextSegment = 0;
+    pDhContext->m_iClaimedSegment = -1;
+
+    uint32_t flags = HNDGCF_NORMAL | HNDGCF_EXTRAINFO;
+    int n_slots = getNumberOfSlots();
+
+    HandleTableMap *walk = &g_HandleTableMap;
+    while (walk)
+    {
+        for (uint32_t i = 0; i < INITIAL_HANDLE_TABLE_ARRAY_SIZE; i ++)
+        {
+            if (walk->pBuckets[i] != NULL)
+            {
+                for (int uCPUindex = 0; uCPUindex < n_slots; uCPUindex++)
+                {
+                    HHANDLETABLE hTable = walk->pBuckets[i]->pTable[uCPUindex];
+                    if (hTable)
+                    {
+                        HndScanClaimedHandlesForGC(hTable,
+                                                   PromoteDependentHandle,
+                                                   uintptr_t(pDhContext->m_pScanContext),
+                                                   uintptr_t(pDhContext->m_pfnPromoteFunction),
+                                                   HNDTYPE_DEPENDENT,
+                                                   pDhContext->m_iCondemned,
+                                                   pDhContext->m_iMaxGen,
+                                                   flags,
+                                                   ClaimDependentHandleSegment,
+                                                   uintptr_t(pDhContext));
+                    }
+                }
+            }
+        }
+        walk = walk->pNext;
+    }
+
+    return pDhContext->m_fPromoted;
+}
+
 // Perform a scan of dependent handles for the purpose of clearing any that haven't had their primary
 // promoted.
 void Ref_ScanDependentHandlesForClearing(uint32_t condemned, uint32_t maxgen, ScanContext* sc)
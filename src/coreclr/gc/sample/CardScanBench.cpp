@@ -0,0 +1,101 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+//
+// Microbenchmark for skipping clear card words the way find_card and
+// find_card_dword do, comparing the word at a time loop they used to have
+// with find_non_zero_card_word on sparse and dense card tables.
+//
+// Usage: gccardscanbench [card table MB]
+//
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include <vector>
+
+#include "cardtablescan.h"
+
+static uint32_t* find_non_zero_card_word_scalar (uint32_t* word, uint32_t* word_end)
+{
+    while ((word < word_end) && (*word == 0))
+    {
+        word++;
+    }
+    return word;
+}
+
+typedef uint32_t* (*find_fn) (uint32_t*, uint32_t*);
+
+// Visits every non-zero word the way find_card does and returns how many it found
+// so the compiler can't throw the scan away.
+static size_t scan (find_fn fn, uint32_t* table, size_t count)
+{
+    size_t found = 0;
+    uint32_t* end = table + count;
+    uint32_t* word = table;
+    while ((word = fn (word, end)) < end)
+    {
+        found++;
+        word++;
+    }
+    return found;
+}
+
+static double time_scan_ms (find_fn fn, uint32_t* table, size_t count, int iterations, size_t* found)
+{
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < iterations; i++)
+    {
+        *found = scan (fn, table, count);
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration<double, std::milli>(end - start).count() / iterations;
+}
+
+int main (int argc, char* argv[])
+{
+    size_t table_mb = (argc > 1) ? (size_t)atoi (argv[1]) : 16;
+    if (table_mb == 0)
+    {
+        table_mb = 16;
+    }
+
+    size_t count = table_mb * 1024 * 1024 / sizeof (uint32_t);
+    std::vector<uint32_t> table (count + 4);
+    // the card table is page aligned in the GC, match its alignment
+    uint32_t* aligned_table = (uint32_t*)(((size_t)table.data() + 15) & ~(size_t)15);
+
+    // one set card word in this many
+    const size_t densities[] = { 100000, 10000, 1000, 64, 8 };
+    const int iterations = 20;
+
+    printf ("%-12s %12s %12s %12s %8s\n", "1 set in", "set words", "scalar ms", "vector ms", "speedup");
+    for (size_t density : densities)
+    {
+        memset (aligned_table, 0, count * sizeof (uint32_t));
+        srand (1);
+        for (size_t i = 0; i < count; i += density)
+        {
+            aligned_table[i + (rand () % density) % (count - i)] = 1u << (rand () % 32);
+        }
+
+        size_t found_scalar = 0;
+        size_t found_vector = 0;
+        double scalar_ms = time_scan_ms (find_non_zero_card_word_scalar, aligned_table, count, iterations, &found_scalar);
+        double vector_ms = time_scan_ms (find_non_zero_card_word, aligned_table, count, iterations, &found_vector);
+
+        if (found_scalar != found_vector)
+        {
+            printf ("mismatch: scalar found %zu set words, vector found %zu\n", found_scalar, found_vector);
+            return 1;
+        }
+
+        printf ("%-12zu %12zu %12.3f %12.3f %7.2fx\n",
+            density, found_scalar, scalar_ms, vector_ms, (vector_ms > 0) ? (scalar_ms / vector_ms) : 0.0);
+    }
+
+    return 0;
+}
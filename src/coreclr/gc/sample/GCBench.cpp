@@ -0,0 +1,454 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+//
+// GCBench.cpp
+//
+
+//
+// A GC benchmark that runs the GC the same way GCSample does, without the rest of CoreCLR, and drives it
+// with a synthetic object graph so GC changes can be A/B tested without building and running a runtime.
+// The workload is described by a handful of knobs:
+//
+//  * -alloc <MB>      total to allocate (default 2048)
+//  * -live <MB>       size of the survivor table the allocated objects are kept alive in (default 64)
+//  * -survive <pct>   % of small objects that get stored into the survivor table (default 10)
+//  * -cards <pct>     % of small objects that also get stored into a random survivor, which is how
+//                     old to young references and set cards are generated (default 5)
+//  * -pins <count>    number of pinned handles (default 16)
+//  * -pinchurn <pct>  % of small objects that get pinned by retargeting a random pinned handle (default 0)
+//  * -loh <pct>       % of the allocated bytes that are LOH arrays, kept in a small LOH survivor table
+//                     so they are freed as they get replaced (default 5)
+//  * -seed <n>        seed for the random choices (default 1)
+//
+// GC settings come from DOTNET_GC* environment variables the same way they do for the runtime, e.g.
+// DOTNET_GCgen0size=4000000. Each GC is timed through the EE callbacks in gcenv.ee.cpp, and at the
+// end the pause percentiles are printed per generation along with where the time in the pauses went:
+// suspend (up to marking), mark (strong roots, cards and handles), plan (weak handles, finalization,
+// planning and compacting or sweeping) and restart.
+//
+
+#include "common.h"
+
+#include "gcenv.h"
+
+#include "gc.h"
+#include "objecthandle.h"
+
+#include "gcdesc.h"
+
+#if defined(HOST_64BIT)
+#define card_byte_shift     11
+#else
+#define card_byte_shift     10
+#endif
+
+#define card_byte(addr) (((size_t)(addr)) >> card_byte_shift)
+
+// The GC puts objects bigger than this on the LOH, unless GCLOHThreshold says otherwise.
+#define LOH_THRESHOLD       85000
+#define MAX_LOH_OBJECT_SIZE (1024 * 1024)
+#define LOH_SURVIVORS       64
+#define MAX_PAUSES          (64 * 1024)
+
+inline void ErectWriteBarrier(Object ** dst, Object * ref)
+{
+    if (((uint8_t*)dst < g_gc_lowest_address) || ((uint8_t*)dst >= g_gc_highest_address))
+        return;
+
+    uint8_t* pCardByte = (uint8_t *)*(volatile uint8_t **)(&g_gc_card_table) + card_byte((uint8_t *)dst);
+    if (*pCardByte != 0xFF)
+        *pCardByte = 0xFF;
+}
+
+void WriteBarrier(Object ** dst, Object * ref)
+{
+    *dst = ref;
+    ErectWriteBarrier(dst, ref);
+}
+
+Object * AllocateObject(MethodTable * pMT, size_t size, uint32_t flags)
+{
+    alloc_context * acontext = GetThread()->GetAllocContext();
+    Object * pObject;
+
+    uint8_t* result = acontext->alloc_ptr;
+    uint8_t* advance = result + size;
+    if ((flags == 0) && (advance <= acontext->alloc_limit))
+    {
+        acontext->alloc_ptr = advance;
+        pObject = (Object *)result;
+    }
+    else
+    {
+        pObject = g_theGCHeap->Alloc(acontext, size, flags);
+        if (pObject == NULL)
+            return NULL;
+    }
+
+    pObject->RawSetMethodTable(pMT);
+
+    return pObject;
+}
+
+Object * AllocateArray(MethodTable * pMT, uint32_t length)
+{
+    size_t size = ((size_t)pMT->GetBaseSize() + (size_t)length * pMT->RawGetComponentSize() + sizeof(void*) - 1) & ~(sizeof(void*) - 1);
+    Object * pObject = AllocateObject(pMT, size, (size >= LOH_THRESHOLD) ? GC_ALLOC_LARGE_OBJECT_HEAP : 0);
+    if (pObject != NULL)
+        *(uint32_t*)((uint8_t*)pObject + ArrayBase::GetOffsetOfNumComponents()) = length;
+
+    return pObject;
+}
+
+class Node : Object {
+public:
+    Object * m_pOther1;
+    Object * m_pOther2;
+    uintptr_t m_payload[2];
+};
+
+static struct Node_MethodTable
+{
+    CGCDescSeries m_series[1];
+    size_t m_numSeries;
+    MethodTable m_MT;
+}
+Node_MethodTable;
+
+// Object[] and byte[]; the GCDesc series of a reference array covers everything past the base size
+static struct RefArray_MethodTable
+{
+    CGCDescSeries m_series[1];
+    size_t m_numSeries;
+    MethodTable m_MT;
+}
+RefArray_MethodTable;
+
+static MethodTable ByteArray_MethodTable;
+
+static void InitMethodTables()
+{
+    uint32_t nodeSize = sizeof(Node) + sizeof(ObjHeader);
+    Node_MethodTable.m_MT.m_baseSize = max(nodeSize, (uint32_t)MIN_OBJECT_SIZE);
+    Node_MethodTable.m_MT.m_componentSize = 0;
+    Node_MethodTable.m_MT.m_flags = MTFlag_ContainsPointers;
+    Node_MethodTable.m_numSeries = 1;
+    Node_MethodTable.m_series[0].SetSeriesOffset(offsetof(Node, m_pOther1));
+    Node_MethodTable.m_series[0].SetSeriesCount(2);
+    Node_MethodTable.m_series[0].seriessize -= Node_MethodTable.m_MT.m_baseSize;
+
+    uint32_t arrayBaseSize = sizeof(ArrayBase) + sizeof(ObjHeader);
+    RefArray_MethodTable.m_MT.m_baseSize = max(arrayBaseSize, (uint32_t)MIN_OBJECT_SIZE);
+    RefArray_MethodTable.m_MT.m_componentSize = sizeof(Object*);
+    RefArray_MethodTable.m_MT.m_flags = MTFlag_HasComponentSize | MTFlag_IsArray | MTFlag_ContainsPointers;
+    RefArray_MethodTable.m_numSeries = 1;
+    RefArray_MethodTable.m_series[0].SetSeriesOffset(sizeof(ArrayBase));
+    RefArray_MethodTable.m_series[0].SetSeriesCount(0);
+    RefArray_MethodTable.m_series[0].seriessize -= RefArray_MethodTable.m_MT.m_baseSize;
+
+    ByteArray_MethodTable.m_baseSize = max(arrayBaseSize, (uint32_t)MIN_OBJECT_SIZE);
+    ByteArray_MethodTable.m_componentSize = 1;
+    ByteArray_MethodTable.m_flags = MTFlag_HasComponentSize | MTFlag_IsArray;
+}
+
+inline Object ** ArrayElement(OBJECTHANDLE array, size_t index)
+{
+    return (Object **)((uint8_t*)HndFetchHandle(array) + sizeof(ArrayBase)) + index;
+}
+
+// xorshift, so runs with the same seed make the same choices everywhere
+static uint64_t g_random;
+
+inline uint64_t NextRandom()
+{
+    g_random ^= g_random << 13;
+    g_random ^= g_random >> 7;
+    g_random ^= g_random << 17;
+    return g_random;
+}
+
+inline bool Chance(uint32_t pct)
+{
+    return (NextRandom() % 100) < pct;
+}
+
+//
+// Pause timing
+//
+
+struct PauseRecord
+{
+    int64_t suspend;
+    int64_t markStart;
+    int64_t markEnd;
+    int64_t done;
+    int64_t restart;
+    int condemned;
+};
+
+static PauseRecord* g_pauses;
+static size_t g_pauseCount;
+static PauseRecord g_currentPause;
+
+static void OnGCPhase(GCSamplePhase phase, int condemned)
+{
+    int64_t now = GCToOSInterface::QueryPerformanceCounter();
+    switch (phase)
+    {
+    case GCSamplePhase::Suspend:
+        memset(&g_currentPause, 0, sizeof(g_currentPause));
+        g_currentPause.suspend = now;
+        g_currentPause.condemned = -1;
+        break;
+    case GCSamplePhase::MarkStart:
+        g_currentPause.markStart = now;
+        g_currentPause.condemned = condemned;
+        break;
+    case GCSamplePhase::MarkEnd:
+        g_currentPause.markEnd = now;
+        break;
+    case GCSamplePhase::Done:
+        g_currentPause.done = now;
+        break;
+    case GCSamplePhase::Restart:
+        g_currentPause.restart = now;
+        // suspensions that didn't do a GC don't count
+        if ((g_currentPause.condemned >= 0) && (g_pauseCount < MAX_PAUSES))
+            g_pauses[g_pauseCount++] = g_currentPause;
+        break;
+    }
+}
+
+static double g_usPerTick;
+
+inline double TicksToUs(int64_t start, int64_t end)
+{
+    return ((start != 0) && (end >= start)) ? (double)(end - start) * g_usPerTick : 0.0;
+}
+
+static int CompareDouble(const void* a, const void* b)
+{
+    double x = *(const double*)a;
+    double y = *(const double*)b;
+    return (x < y) ? -1 : ((x > y) ? 1 : 0);
+}
+
+inline double Percentile(double* sorted, size_t count, double pct)
+{
+    size_t index = (size_t)(pct / 100.0 * (double)(count - 1) + 0.5);
+    return sorted[index];
+}
+
+// Prints the pause percentiles for the GCs of one generation, or all of them when gen is -1
+static void ReportPauses(int gen, double* scratch)
+{
+    size_t count = 0;
+    double phaseUs[4] = {};
+    for (size_t i = 0; i < g_pauseCount; i++)
+    {
+        PauseRecord* p = &g_pauses[i];
+        if ((gen != -1) && (p->condemned != gen))
+            continue;
+
+        scratch[count++] = TicksToUs(p->suspend, p->restart);
+        phaseUs[0] += TicksToUs(p->suspend, p->markStart);
+        phaseUs[1] += TicksToUs(p->markStart, p->markEnd);
+        phaseUs[2] += TicksToUs(p->markEnd, p->done);
+        phaseUs[3] += TicksToUs(p->done, p->restart);
+    }
+
+    if (count == 0)
+        return;
+
+    double total = 0;
+    for (size_t i = 0; i < count; i++)
+        total += scratch[i];
+
+    qsort(scratch, count, sizeof(double), CompareDouble);
+
+    char name[8];
+    if (gen == -1)
+        snprintf(name, sizeof(name), "all");
+    else
+        snprintf(name, sizeof(name), "gen%d", gen);
+
+    printf("%-6s %6zu %10.1f %10.1f %10.1f %10.1f %10.1f | %6.1f%% %6.1f%% %6.1f%% %6.1f%%\n",
+        name, count,
+        Percentile(scratch, count, 50), Percentile(scratch, count, 90), Percentile(scratch, count, 99),
+        scratch[count - 1], total / 1000.0,
+        (total > 0) ? (phaseUs[0] * 100.0 / total) : 0.0,
+        (total > 0) ? (phaseUs[1] * 100.0 / total) : 0.0,
+        (total > 0) ? (phaseUs[2] * 100.0 / total) : 0.0,
+        (total > 0) ? (phaseUs[3] * 100.0 / total) : 0.0);
+}
+
+static void Usage()
+{
+    printf("Usage: gcbench [-alloc MB] [-live MB] [-survive pct] [-cards pct] [-pins count] [-pinchurn pct] [-loh pct] [-seed n]\n");
+}
+
+extern "C" HRESULT GC_Initialize(IGCToCLR* clrToGC, IGCHeap** gcHeap, IGCHandleManager** gcHandleManager, GcDacVars* gcDacVars);
+
+int __cdecl main(int argc, char* argv[])
+{
+    uint64_t allocMB = 2048;
+    uint64_t liveMB = 64;
+    uint32_t survivePct = 10;
+    uint32_t cardsPct = 5;
+    uint32_t pinCount = 16;
+    uint32_t pinChurnPct = 0;
+    uint32_t lohPct = 5;
+    uint64_t seed = 1;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (i + 1 == argc)
+        {
+            Usage();
+            return -1;
+        }
+
+        const char* arg = argv[i];
+        uint64_t value = strtoull(argv[++i], NULL, 10);
+        if (strcmp(arg, "-alloc") == 0)
+            allocMB = value;
+        else if (strcmp(arg, "-live") == 0)
+            liveMB = value;
+        else if (strcmp(arg, "-survive") == 0)
+            survivePct = (uint32_t)min(value, (uint64_t)100);
+        else if (strcmp(arg, "-cards") == 0)
+            cardsPct = (uint32_t)min(value, (uint64_t)100);
+        else if (strcmp(arg, "-pins") == 0)
+            pinCount = (uint32_t)value;
+        else if (strcmp(arg, "-pinchurn") == 0)
+            pinChurnPct = (uint32_t)min(value, (uint64_t)100);
+        else if (strcmp(arg, "-loh") == 0)
+            lohPct = (uint32_t)min(value, (uint64_t)100);
+        else if (strcmp(arg, "-seed") == 0)
+            seed = value;
+        else
+        {
+            Usage();
+            return -1;
+        }
+    }
+
+    g_random = (seed != 0) ? seed : 1;
+
+    if (!GCToOSInterface::Initialize())
+    {
+        return -1;
+    }
+
+    GcDacVars dacVars;
+    IGCHeap *pGCHeap;
+    IGCHandleManager *pGCHandleManager;
+    if (GC_Initialize(nullptr, &pGCHeap, &pGCHandleManager, &dacVars) != S_OK)
+    {
+        return -1;
+    }
+
+    if (FAILED(pGCHeap->Initialize()))
+        return -1;
+
+    if (!pGCHandleManager->Initialize())
+        return -1;
+
+    ThreadStore::AttachCurrentThread();
+
+    InitMethodTables();
+
+    g_pauses = new PauseRecord[MAX_PAUSES];
+    double* scratch = new double[MAX_PAUSES];
+    if ((g_pauses == NULL) || (scratch == NULL))
+        return -1;
+
+    g_usPerTick = 1000000.0 / (double)GCToOSInterface::QueryPerformanceFrequency();
+    g_pfnGCSamplePhase = OnGCPhase;
+
+    HHANDLETABLE hTable = g_HandleTableMap.pBuckets[0]->pTable[GetCurrentThreadHomeHeapNumber()];
+
+    uint32_t nodeSize = Node_MethodTable.m_MT.GetBaseSize();
+    uint32_t liveSlots = (uint32_t)max((uint64_t)1, liveMB * 1024 * 1024 / nodeSize);
+
+    Object * pSurvivors = AllocateArray(&RefArray_MethodTable.m_MT, liveSlots);
+    Object * pLohSurvivors = AllocateArray(&RefArray_MethodTable.m_MT, LOH_SURVIVORS);
+    if ((pSurvivors == NULL) || (pLohSurvivors == NULL))
+        return -1;
+
+    OBJECTHANDLE survivors = HndCreateHandle(hTable, HNDTYPE_DEFAULT, pSurvivors);
+    OBJECTHANDLE lohSurvivors = HndCreateHandle(hTable, HNDTYPE_DEFAULT, pLohSurvivors);
+    if ((survivors == NULL) || (lohSurvivors == NULL))
+        return -1;
+
+    OBJECTHANDLE* pins = new OBJECTHANDLE[max(pinCount, (uint32_t)1)];
+    if (pins == NULL)
+        return -1;
+
+    for (uint32_t i = 0; i < pinCount; i++)
+    {
+        pins[i] = HndCreateHandle(hTable, HNDTYPE_PINNED, NULL);
+        if (pins[i] == NULL)
+            return -1;
+    }
+
+    // only count the GCs the workload triggers
+    g_pauseCount = 0;
+
+    uint64_t allocBytes = allocMB * 1024 * 1024;
+    uint64_t allocated = 0;
+    uint64_t lohAllocated = 0;
+    int64_t start = GCToOSInterface::QueryPerformanceCounter();
+
+    while (allocated < allocBytes)
+    {
+        if ((lohPct != 0) && (lohAllocated * 100 < allocated * lohPct))
+        {
+            uint32_t length = (uint32_t)(LOH_THRESHOLD + NextRandom() % (MAX_LOH_OBJECT_SIZE - LOH_THRESHOLD));
+            Object * p = AllocateArray(&ByteArray_MethodTable, length);
+            if (p == NULL)
+                return -1;
+
+            WriteBarrier(ArrayElement(lohSurvivors, NextRandom() % LOH_SURVIVORS), p);
+            allocated += length;
+            lohAllocated += length;
+            continue;
+        }
+
+        Object * p = AllocateObject(&Node_MethodTable.m_MT, nodeSize, 0);
+        if (p == NULL)
+            return -1;
+
+        allocated += nodeSize;
+
+        if (Chance(cardsPct))
+        {
+            Node * pOld = (Node *)*ArrayElement(survivors, NextRandom() % liveSlots);
+            if (pOld != NULL)
+                WriteBarrier(&pOld->m_pOther1, p);
+        }
+
+        if (Chance(survivePct))
+            WriteBarrier(ArrayElement(survivors, NextRandom() % liveSlots), p);
+
+        if ((pinCount != 0) && Chance(pinChurnPct))
+            HndAssignHandle(pins[NextRandom() % pinCount], p);
+    }
+
+    double elapsedMs = TicksToUs(start, GCToOSInterface::QueryPerformanceCounter()) / 1000.0;
+
+    printf("allocated %llu MB (%llu MB LOH) in %.1f ms, %u live slots, %zu GCs%s\n",
+        (unsigned long long)(allocated / (1024 * 1024)), (unsigned long long)(lohAllocated / (1024 * 1024)),
+        elapsedMs, liveSlots, g_pauseCount, (g_pauseCount == MAX_PAUSES) ? " (only the first ones were recorded)" : "");
+    printf("%-6s %6s %10s %10s %10s %10s %10s | %7s %7s %7s %7s\n",
+        "", "count", "p50 us", "p90 us", "p99 us", "max us", "total ms", "suspend", "mark", "plan", "restart");
+
+    for (int gen = 0; gen <= 2; gen++)
+    {
+        ReportPauses(gen, scratch);
+    }
+    ReportPauses(-1, scratch);
+
+    return 0;
+}
@@ -124,8 +124,18 @@ void ThreadStore::AttachCurrentThread()
     g_pThreadList = pThread;
 }
 
+GCSamplePhaseCallback g_pfnGCSamplePhase = NULL;
+
+static void NotifyGCPhase(GCSamplePhase phase, int condemned)
+{
+    if (g_pfnGCSamplePhase != NULL)
+        g_pfnGCSamplePhase(phase, condemned);
+}
+
 void GCToEEInterface::SuspendEE(SUSPEND_REASON reason)
 {
+    NotifyGCPhase(GCSamplePhase::Suspend, -1);
+
     g_theGCHeap->SetGCInProgress(true);
 
     // TODO: Implement
@@ -136,6 +146,8 @@ void GCToEEInterface::RestartEE(bool bFinishedGC)
     // TODO: Implement
 
     g_theGCHeap->SetGCInProgress(false);
+
+    NotifyGCPhase(GCSamplePhase::Restart, -1);
 }
 
 void GCToEEInterface::GcScanRoots(promote_func* fn,  int condemned, int max_gen, ScanContext* sc)
@@ -149,14 +161,17 @@ void GCToEEInterface::GcStartWork(int condemned, int max_gen)
 
 void GCToEEInterface::BeforeGcScanRoots(int condemned, bool is_bgc, bool is_concurrent)
 {
+    NotifyGCPhase(GCSamplePhase::MarkStart, condemned);
 }
 
 void GCToEEInterface::AfterGcScanRoots(int condemned, int max_gen, ScanContext* sc)
 {
+    NotifyGCPhase(GCSamplePhase::MarkEnd, condemned);
 }
 
 void GCToEEInterface::GcDone(int condemned)
 {
+    NotifyGCPhase(GCSamplePhase::Done, condemned);
 }
 
 bool GCToEEInterface::RefCountedHandleCallbacks(Object * pObject)
@@ -274,14 +289,41 @@ bool GCToEEInterface::EagerFinalized(Object* obj)
     return false;
 }
 
+// GC settings come from DOTNET_<privateKey> environment variables, as hex like the runtime's, so the
+// sample and gcbench can be run with different GC configurations without a runtime config.
+static const char* GetConfigFromEnvironment(const char* privateKey)
+{
+    char name[256];
+    if (snprintf(name, sizeof(name), "DOTNET_%s", privateKey) >= (int)sizeof(name))
+        return NULL;
+
+    const char* value = getenv(name);
+    return ((value != NULL) && (*value != '\0')) ? value : NULL;
+}
+
 bool GCToEEInterface::GetBooleanConfigValue(const char* privateKey, const char* publicKey, bool* value)
 {
-    return false;
+    const char* config = GetConfigFromEnvironment(privateKey);
+    if (config == NULL)
+        return false;
+
+    *value = strtoull(config, NULL, 16) != 0;
+    return true;
 }
 
 bool GCToEEInterface::GetIntConfigValue(const char* privateKey, const char* publicKey, int64_t* value)
 {
-    return false;
+    const char* config = GetConfigFromEnvironment(privateKey);
+    if (config == NULL)
+        return false;
+
+    char* end;
+    int64_t result = (int64_t)strtoull(config, &end, 16);
+    if (*end != '\0')
+        return false;
+
+    *value = result;
+    return true;
 }
 
 bool GCToEEInterface::GetStringConfigValue(const char* privateKey, const char* publicKey, const char** value)
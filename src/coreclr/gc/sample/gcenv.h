@@ -137,6 +137,26 @@ public:
     static void AttachCurrentThread();
 };
 
+// -----------------------------------------------------------------------------------------------------------
+// GC phase notifications
+//
+// The GC calls into the EE at these points of every GC. gcbench hooks them to time the phases of each
+// pause; the condemned generation is -1 where the EE callback doesn't get told what it is.
+//
+
+enum class GCSamplePhase
+{
+    Suspend,        // SuspendEE
+    MarkStart,      // BeforeGcScanRoots
+    MarkEnd,        // AfterGcScanRoots, strong marking is done
+    Done,           // GcDone, plan/relocate/compact or sweep is done
+    Restart,        // RestartEE
+};
+
+typedef void (*GCSamplePhaseCallback)(GCSamplePhase phase, int condemned);
+
+extern GCSamplePhaseCallback g_pfnGCSamplePhase;
+
 // -----------------------------------------------------------------------------------------------------------
 // Config file enumulation
 //
@@ -92,6 +92,7 @@ extern "C"
 
 #ifdef __linux__
 #include <sys/syscall.h> // __NR_membarrier
+#include <fcntl.h> // open for /proc/self/pagemap
 // Ensure __NR_membarrier is defined for portable builds.
 # if !defined(__NR_membarrier)
 #  if defined(__amd64__)
@@ -786,6 +787,23 @@ bool GCToOSInterface::VirtualDecommit(void* address, size_t size)
     return  bRetVal;
 }
 
+// Advise the OS to back a committed virtual memory range with huge pages where it can.
+// Parameters:
+//  address - starting virtual address
+//  size    - size of the virtual memory range
+// Return:
+//  true if it has succeeded, false if it has failed or is not supported
+bool GCToOSInterface::VirtualAdviseHugePages(void* address, size_t size)
+{
+#ifdef MADV_HUGEPAGE
+    // MADV_HUGEPAGE fails with EINVAL if the kernel was built without transparent huge
+    // pages; a 0 size range succeeds without doing anything otherwise.
+    return (madvise(address, size, MADV_HUGEPAGE) == 0);
+#else
+    return false;
+#endif
+}
+
 // Reset virtual memory range. Indicates that data in the memory range specified by address and size is no
 // longer of interest, but it should not be decommitted.
 // Parameters:
@@ -856,6 +874,167 @@ bool GCToOSInterface::GetWriteWatch(bool resetState, void* address, size_t size,
     return false;
 }
 
+#if defined(__linux__)
+// Bit 55 of a /proc/self/pagemap entry is the page's soft-dirty bit, see
+// Documentation/admin-guide/mm/soft-dirty.rst in the kernel.
+#define PAGEMAP_ENTRY_SOFT_DIRTY ((uint64_t)1 << 55)
+
+static int g_pagemapFd = -1;
+static int g_clearRefsFd = -1;
+
+static bool ClearSoftDirtyBits()
+{
+    // Writing 4 to clear_refs clears the soft-dirty bits of every page in the process
+    return (write(g_clearRefsFd, "4", 1) == 1);
+}
+
+static bool IsPageSoftDirty(void* address, bool* softDirty)
+{
+    uint64_t entry;
+    off_t offset = (off_t)(((size_t)address / OS_PAGE_SIZE) * sizeof(entry));
+    if (pread(g_pagemapFd, &entry, sizeof(entry), offset) != sizeof(entry))
+    {
+        return false;
+    }
+
+    *softDirty = ((entry & PAGEMAP_ENTRY_SOFT_DIRTY) != 0);
+    return true;
+}
+
+// Kernels built without CONFIG_MEM_SOFT_DIRTY still have both files and report every page as
+// clean, so check that a write to a page we cleared actually shows up.
+static bool InitializeSoftDirtyWriteWatch()
+{
+    g_pagemapFd = open("/proc/self/pagemap", O_RDONLY | O_CLOEXEC);
+    g_clearRefsFd = open("/proc/self/clear_refs", O_WRONLY | O_CLOEXEC);
+
+    bool supported = false;
+    if ((g_pagemapFd != -1) && (g_clearRefsFd != -1))
+    {
+        void* page = mmap(nullptr, OS_PAGE_SIZE, PROT_READ | PROT_WRITE, MAP_ANON | MAP_PRIVATE, -1, 0);
+        if (page != MAP_FAILED)
+        {
+            bool dirtyAfterReset = true;
+            bool dirtyAfterWrite = false;
+
+            *(volatile uint8_t*)page = 1;
+            if (ClearSoftDirtyBits() && IsPageSoftDirty(page, &dirtyAfterReset))
+            {
+                *(volatile uint8_t*)page = 2;
+                IsPageSoftDirty(page, &dirtyAfterWrite);
+            }
+
+            supported = (!dirtyAfterReset && dirtyAfterWrite);
+            munmap(page, OS_PAGE_SIZE);
+        }
+    }
+
+    if (!supported)
+    {
+        if (g_pagemapFd != -1)
+        {
+            close(g_pagemapFd);
+            g_pagemapFd = -1;
+        }
+        if (g_clearRefsFd != -1)
+        {
+            close(g_clearRefsFd);
+            g_clearRefsFd = -1;
+        }
+    }
+
+    return supported;
+}
+#endif // __linux__
+
+// Check if the OS tracks writes to all memory of the process by itself, without the memory
+// being reserved with VirtualReserveFlags::WriteWatch
+bool GCToOSInterface::SupportsProcessWriteWatch()
+{
+#if defined(__linux__)
+    static bool s_initialized = false;
+    static bool s_supported = false;
+
+    // This is only called during GC initialization so there's no race here
+    if (!s_initialized)
+    {
+        s_supported = InitializeSoftDirtyWriteWatch();
+        s_initialized = true;
+    }
+
+    return s_supported;
+#else
+    return false;
+#endif
+}
+
+// Reset the process wide write tracking state. This resets it for all memory in the process,
+// not just a range, and can make the next write to every page take a page fault.
+void GCToOSInterface::ResetProcessWriteWatch()
+{
+#if defined(__linux__)
+    assert(g_clearRefsFd != -1);
+    bool success = ClearSoftDirtyBits();
+    assert(success);
+#else
+    assert(!"should never call ResetProcessWriteWatch on this platform");
+#endif
+}
+
+// Retrieve addresses of the pages in a region of virtual memory that were written to since
+// the last ResetProcessWriteWatch
+// Parameters:
+//  address            - starting virtual address
+//  size               - size of the virtual memory range
+//  pageAddresses      - buffer that receives an array of page addresses in the memory region
+//  pageAddressesCount - on input, size of the lpAddresses array, in array elements
+//                       on output, the number of page addresses that are returned in the array.
+// Return:
+//  true if it has succeeded, false if it has failed
+bool GCToOSInterface::GetProcessWriteWatch(void* address, size_t size, void** pageAddresses, uintptr_t* pageAddressesCount)
+{
+#if defined(__linux__)
+    assert(g_pagemapFd != -1);
+    assert(((size_t)address % OS_PAGE_SIZE) == 0);
+
+    const size_t EntriesPerRead = 512;
+    uint64_t entries[EntriesPerRead];
+
+    uint8_t* page = (uint8_t*)address;
+    size_t pageCount = (size + OS_PAGE_SIZE - 1) / OS_PAGE_SIZE;
+    uintptr_t capacity = *pageAddressesCount;
+    uintptr_t count = 0;
+
+    while ((pageCount > 0) && (count < capacity))
+    {
+        size_t entryCount = std::min(pageCount, EntriesPerRead);
+        off_t offset = (off_t)(((size_t)page / OS_PAGE_SIZE) * sizeof(uint64_t));
+        ssize_t bytesRead = pread(g_pagemapFd, entries, entryCount * sizeof(uint64_t), offset);
+        if (bytesRead != (ssize_t)(entryCount * sizeof(uint64_t)))
+        {
+            return false;
+        }
+
+        for (size_t i = 0; (i < entryCount) && (count < capacity); i++)
+        {
+            if ((entries[i] & PAGEMAP_ENTRY_SOFT_DIRTY) != 0)
+            {
+                pageAddresses[count++] = page + (i * OS_PAGE_SIZE);
+            }
+        }
+
+        page += entryCount * OS_PAGE_SIZE;
+        pageCount -= entryCount;
+    }
+
+    *pageAddressesCount = count;
+    return true;
+#else
+    assert(!"should never call GetProcessWriteWatch on this platform");
+    return false;
+#endif
+}
+
 bool ReadMemoryValueFromFile(const char* filename, uint64_t* val)
 {
     bool result = false;
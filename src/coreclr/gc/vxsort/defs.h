@@ -13,6 +13,7 @@
 #endif
 #ifdef _M_ARM64
 #define ARCH_ARM
+#define ARCH_ARM64
 #endif
 #else
 #ifdef __i386__
@@ -24,6 +25,23 @@
 #ifdef __arm__
 #define ARCH_ARM
 #endif
+#ifdef __aarch64__
+#define ARCH_ARM
+#define ARCH_ARM64
+#endif
+#endif
+
+#ifdef ARCH_ARM64
+#ifdef _MSC_VER
+#define popcnt_u32(x) ((int)_CountOneBits(x))
+#define popcnt_u64(x) ((int)_CountOneBits64(x))
+#else
+#define popcnt_u32(x) ((int)__builtin_popcount(x))
+#define popcnt_u64(x) ((int)__builtin_popcountll(x))
+#endif
+#else
+#define popcnt_u32(x) _mm_popcnt_u32(x)
+#define popcnt_u64(x) _mm_popcnt_u64(x)
 #endif
 
 #ifdef _MSC_VER
@@ -70,9 +88,9 @@ public:
 template <>
 class numeric_limits<int64_t> {
    public:
-    static constexpr int64_t Max() { return 0x7fffffffffffffffi64; }
+    static constexpr int64_t Max() { return 0x7fffffffffffffffLL; }
 
-    static constexpr int64_t Min() { return -0x7fffffffffffffffi64 - 1; }
+    static constexpr int64_t Min() { return -0x7fffffffffffffffLL - 1; }
 };
 }  // namespace std
 
@@ -14,6 +14,7 @@ enum vector_machine {
     NONE,
     AVX2,
     AVX512,
+    NEON,
     SVE,
 };
 
@@ -0,0 +1,41 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+#include "common.h"
+#include "machine_traits.neon.h"
+
+namespace vxsort {
+
+// byte shuffles for vqtbl1q_u8 that move the elements not greater than the pivot to the
+// lower lanes and the ones greater than the pivot to the upper lanes, keeping their order
+alignas(16) const uint8_t neon_perm_table_64[NEON_T64_SIZE] = {
+         0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14, 15,  // 0b00 (0)
+         8,  9, 10, 11, 12, 13, 14, 15,  0,  1,  2,  3,  4,  5,  6,  7,  // 0b01 (1)
+         0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14, 15,  // 0b10 (2)
+         0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14, 15,  // 0b11 (3)
+};
+
+alignas(16) const uint8_t neon_perm_table_32[NEON_T32_SIZE] = {
+         0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14, 15,  // 0b0000 (0)
+         4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14, 15,  0,  1,  2,  3,  // 0b0001 (1)
+         0,  1,  2,  3,  8,  9, 10, 11, 12, 13, 14, 15,  4,  5,  6,  7,  // 0b0010 (2)
+         8,  9, 10, 11, 12, 13, 14, 15,  0,  1,  2,  3,  4,  5,  6,  7,  // 0b0011 (3)
+         0,  1,  2,  3,  4,  5,  6,  7, 12, 13, 14, 15,  8,  9, 10, 11,  // 0b0100 (4)
+         4,  5,  6,  7, 12, 13, 14, 15,  0,  1,  2,  3,  8,  9, 10, 11,  // 0b0101 (5)
+         0,  1,  2,  3, 12, 13, 14, 15,  4,  5,  6,  7,  8,  9, 10, 11,  // 0b0110 (6)
+        12, 13, 14, 15,  0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11,  // 0b0111 (7)
+         0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14, 15,  // 0b1000 (8)
+         4,  5,  6,  7,  8,  9, 10, 11,  0,  1,  2,  3, 12, 13, 14, 15,  // 0b1001 (9)
+         0,  1,  2,  3,  8,  9, 10, 11,  4,  5,  6,  7, 12, 13, 14, 15,  // 0b1010 (10)
+         8,  9, 10, 11,  0,  1,  2,  3,  4,  5,  6,  7, 12, 13, 14, 15,  // 0b1011 (11)
+         0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14, 15,  // 0b1100 (12)
+         4,  5,  6,  7,  0,  1,  2,  3,  8,  9, 10, 11, 12, 13, 14, 15,  // 0b1101 (13)
+         0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14, 15,  // 0b1110 (14)
+         0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14, 15,  // 0b1111 (15)
+};
+
+// the bit each lane contributes to the mask returned by get_cmpgt_mask
+alignas(16) const uint64_t neon_mask_bits_64[2] = { 1, 2 };
+alignas(16) const uint32_t neon_mask_bits_32[4] = { 1, 2, 4, 8 };
+
+}
@@ -0,0 +1,184 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+#ifndef VXSORT_MACHINE_TRAITS_NEON_H
+#define VXSORT_MACHINE_TRAITS_NEON_H
+
+#include <arm_neon.h>
+#include <assert.h>
+#include <inttypes.h>
+#include <type_traits>
+#include "defs.h"
+#include "machine_traits.h"
+
+namespace vxsort {
+
+// NEON has no permute-by-index instruction for 32/64-bit lanes like vpermd,
+// so partitioning goes through a byte shuffle (vqtbl1q_u8) instead, with
+// one 16 byte shuffle control per mask value
+const int NEON_T64_SIZE = 4 * 16;
+const int NEON_T32_SIZE = 16 * 16;
+
+extern const uint8_t neon_perm_table_64[NEON_T64_SIZE];
+extern const uint8_t neon_perm_table_32[NEON_T32_SIZE];
+extern const uint64_t neon_mask_bits_64[2];
+extern const uint32_t neon_mask_bits_32[4];
+
+static void not_supported()
+{
+    assert(!"operation is unsupported");
+}
+
+#ifdef _DEBUG
+// in _DEBUG, we #define return to be something more complicated,
+// containing a statement, so #define away constexpr for _DEBUG
+#define constexpr
+#endif  //_DEBUG
+
+template <>
+class vxsort_machine_traits<int32_t, NEON> {
+   public:
+    typedef int32_t T;
+    typedef int32x4_t TV;
+    typedef uint32_t TMASK;
+    typedef int32_t TPACK;
+    typedef typename std::make_unsigned<T>::type TU;
+
+    static constexpr bool supports_compress_writes() { return false; }
+
+    static constexpr bool supports_packing() { return false; }
+
+    template <int Shift>
+    static constexpr bool can_pack(T span) { return false; }
+
+    static INLINE TV load_vec(TV* p) { return vld1q_s32((const int32_t*)p); }
+
+    static INLINE void store_vec(TV* ptr, TV v) { vst1q_s32((int32_t*)ptr, v); }
+
+    static void store_compress_vec(TV* ptr, TV v, TMASK mask) { not_supported(); }
+
+    static INLINE TV partition_vector(TV v, int mask) {
+        assert(mask >= 0);
+        assert(mask <= 15);
+        return vreinterpretq_s32_u8(vqtbl1q_u8(vreinterpretq_u8_s32(v), vld1q_u8(neon_perm_table_32 + mask * 16)));
+    }
+
+    static INLINE TV broadcast(int32_t pivot) { return vdupq_n_s32(pivot); }
+    static INLINE TMASK get_cmpgt_mask(TV a, TV b) {
+        return vaddvq_u32(vandq_u32(vcgtq_s32(a, b), vld1q_u32(neon_mask_bits_32)));
+    }
+
+    // the shift amounts are not immediates here, so use the register forms -
+    // a negative count shifts right, and shifting as unsigned matches the
+    // logical shifts the other machines use
+    static TV shift_right(TV v, int i) { return vreinterpretq_s32_u32(vshlq_u32(vreinterpretq_u32_s32(v), vdupq_n_s32(-i))); }
+    static TV shift_left(TV v, int i) { return vshlq_s32(v, vdupq_n_s32(i)); }
+
+    static INLINE TV add(TV a, TV b) { return vaddq_s32(a, b); }
+    static INLINE TV sub(TV a, TV b) { return vsubq_s32(a, b); };
+
+    static INLINE TV pack_ordered(TV a, TV b) { return a; }
+    static INLINE TV pack_unordered(TV a, TV b) { return a; }
+    static INLINE void unpack_ordered(TV p, TV& u1, TV& u2) { }
+
+    template <int Shift>
+    static T shift_n_sub(T v, T sub) {
+        if (Shift > 0)
+            v >>= Shift;
+        v -= sub;
+        return v;
+    }
+
+    template <int Shift>
+    static T unshift_and_add(TPACK from, T add) {
+        add += from;
+        if (Shift > 0)
+            add = (T) (((TU) add) << Shift);
+        return add;
+    }
+};
+
+template <>
+class vxsort_machine_traits<int64_t, NEON> {
+   public:
+    typedef int64_t T;
+    typedef int64x2_t TV;
+    typedef uint32_t TMASK;
+    typedef int32_t TPACK;
+    typedef typename std::make_unsigned<T>::type TU;
+
+    static constexpr bool supports_compress_writes() { return false; }
+
+    // with only 2 lanes per vector, packing to 32 bits when the range allows
+    // it doubles the throughput of partitioning, so this matters even more
+    // than it does for AVX2
+    static constexpr bool supports_packing() { return true; }
+
+    template <int Shift>
+    static constexpr bool can_pack(T span) {
+        const auto PACK_LIMIT = (((TU) std::numeric_limits<uint32_t>::Max() + 1)) << Shift;
+        return ((TU) span) < PACK_LIMIT;
+    }
+
+    static INLINE TV load_vec(TV* p) { return vld1q_s64((const int64_t*)p); }
+
+    static INLINE void store_vec(TV* ptr, TV v) { vst1q_s64((int64_t*)ptr, v); }
+
+    static void store_compress_vec(TV* ptr, TV v, TMASK mask) { not_supported(); }
+
+    static INLINE TV partition_vector(TV v, int mask) {
+        assert(mask >= 0);
+        assert(mask <= 3);
+        return vreinterpretq_s64_u8(vqtbl1q_u8(vreinterpretq_u8_s64(v), vld1q_u8(neon_perm_table_64 + mask * 16)));
+    }
+
+    static INLINE TV broadcast(int64_t pivot) { return vdupq_n_s64(pivot); }
+    static INLINE TMASK get_cmpgt_mask(TV a, TV b) {
+        return (TMASK)vaddvq_u64(vandq_u64(vcgtq_s64(a, b), vld1q_u64(neon_mask_bits_64)));
+    }
+
+    static TV shift_right(TV v, int i) { return vreinterpretq_s64_u64(vshlq_u64(vreinterpretq_u64_s64(v), vdupq_n_s64(-i))); }
+    static TV shift_left(TV v, int i) { return vshlq_s64(v, vdupq_n_s64(i)); }
+
+    static INLINE TV add(TV a, TV b) { return vaddq_s64(a, b); }
+    static INLINE TV sub(TV a, TV b) { return vsubq_s64(a, b); };
+
+    // the packed vector holds the low halves of a followed by the low halves of b,
+    // which is both the ordered and the cheapest unordered layout on NEON
+    static INLINE TV pack_ordered(TV a, TV b) {
+        return vreinterpretq_s64_s32(vuzp1q_s32(vreinterpretq_s32_s64(a), vreinterpretq_s32_s64(b)));
+    }
+
+    static INLINE TV pack_unordered(TV a, TV b) { return pack_ordered(a, b); }
+
+    static INLINE void unpack_ordered(TV p, TV& u1, TV& u2) {
+        auto p32 = vreinterpretq_s32_s64(p);
+
+        u1 = vmovl_s32(vget_low_s32(p32));
+        u2 = vmovl_high_s32(p32);
+    }
+
+    template <int Shift>
+    static T shift_n_sub(T v, T sub) {
+        if (Shift > 0)
+            v >>= Shift;
+        v -= sub;
+        return v;
+    }
+
+    template <int Shift>
+    static T unshift_and_add(TPACK from, T add) {
+        add += from;
+        if (Shift > 0)
+            add = (T) (((TU) add) << Shift);
+        return add;
+    }
+};
+
+}
+
+#ifdef _DEBUG
+#undef constexpr
+#endif //_DEBUG
+
+#endif  // VXSORT_MACHINE_TRAITS_NEON_H
@@ -8,7 +8,9 @@
 #include "alignment.h"
 #include "machine_traits.h"
 
+#ifndef ARCH_ARM64
 #include <immintrin.h>
+#endif
 
 namespace vxsort {
 
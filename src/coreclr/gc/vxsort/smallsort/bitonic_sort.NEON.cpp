@@ -0,0 +1,50 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+#include "common.h"
+#include "bitonic_sort.h"
+
+using namespace vxsort;
+
+namespace vxsort {
+namespace smallsort {
+
+template<> struct bitonic<int64_t, NEON> {
+public:
+    static void sort(int64_t* ptr, size_t length);
+};
+
+template<> struct bitonic<int32_t, NEON> {
+public:
+    static void sort(int32_t* ptr, size_t length);
+};
+
+}  // namespace smallsort
+}  // namespace vxsort
+
+// NEON vectors only hold 2 64-bit (or 4 32-bit) elements and there is no
+// 64-bit vector min/max, so a bitonic network over at most 16 vectors does
+// not beat a plain insertion sort for the small partitions vxsort hands us.
+template <typename T>
+static void insertion_sort(T* ptr, size_t length)
+{
+    for (size_t i = 1; i < length; i++)
+    {
+        T v = ptr[i];
+        size_t j = i;
+        while ((j > 0) && (ptr[j - 1] > v))
+        {
+            ptr[j] = ptr[j - 1];
+            j--;
+        }
+        ptr[j] = v;
+    }
+}
+
+void vxsort::smallsort::bitonic<int64_t, vector_machine::NEON >::sort(int64_t *ptr, size_t length) {
+    insertion_sort (ptr, length);
+}
+
+void vxsort::smallsort::bitonic<int32_t, vector_machine::NEON >::sort(int32_t *ptr, size_t length) {
+    insertion_sort (ptr, length);
+}
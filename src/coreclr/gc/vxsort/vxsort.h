@@ -4,7 +4,9 @@
 #ifndef VXSORT_VXSORT_H
 #define VXSORT_VXSORT_H
 
-#ifdef __GNUC__
+#include "defs.h"
+
+#if defined(__GNUC__) && !defined(ARCH_ARM64)
 #ifdef __clang__
 #pragma clang attribute push (__attribute__((target("popcnt"))), apply_to = any(function))
 #else
@@ -15,9 +17,12 @@
 
 
 #include <assert.h>
+#ifdef ARCH_ARM64
+#include <arm_neon.h>
+#else
 #include <immintrin.h>
+#endif
 
-#include "defs.h"
 #include "alignment.h"
 #include "machine_traits.h"
 #ifdef VXSORT_STATS
@@ -309,7 +314,7 @@ private:
         dataVec = MT::partition_vector(dataVec, mask);
         MT::store_vec(reinterpret_cast<TV*>(left), dataVec);
         MT::store_vec(reinterpret_cast<TV*>(right), dataVec);
-        auto popCount = -_mm_popcnt_u64(mask);
+        auto popCount = -popcnt_u64(mask);
         right += popCount;
         left += popCount + N;
     }
@@ -319,7 +324,7 @@ private:
                                                      T*& left,
                                                      T*& right) {
         auto mask = MT::get_cmpgt_mask(dataVec, P);
-        auto popCount = -_mm_popcnt_u64(mask);
+        auto popCount = -popcnt_u64(mask);
         MT::store_compress_vec(reinterpret_cast<TV*>(left), dataVec, ~mask);
         MT::store_compress_vec(reinterpret_cast<TV*>(right + N + popCount), dataVec, mask);
         right += popCount;
@@ -558,8 +563,8 @@ private:
         auto LT0 = MT::load_vec(preAlignedLeft);
         auto rtMask = MT::get_cmpgt_mask(RT0, P);
         auto ltMask = MT::get_cmpgt_mask(LT0, P);
-        const auto rtPopCountRightPart = max(_mm_popcnt_u32(rtMask), rightAlign);
-        const auto ltPopCountRightPart = _mm_popcnt_u32(ltMask);
+        const auto rtPopCountRightPart = max(popcnt_u32(rtMask), rightAlign);
+        const auto ltPopCountRightPart = popcnt_u32(ltMask);
         const auto rtPopCountLeftPart  = N - rtPopCountRightPart;
         const auto ltPopCountLeftPart  = N - ltPopCountRightPart;
 
@@ -633,6 +638,8 @@ private:
 
 }  // namespace gcsort
 
+#ifndef ARCH_ARM64
 #include "vxsort_targets_disable.h"
+#endif
 
 #endif
@@ -781,6 +781,18 @@ bool GCToOSInterface::VirtualDecommit(void* address, size_t size)
     return !!::VirtualFree(address, size, MEM_DECOMMIT);
 }
 
+// Advise the OS to back a committed virtual memory range with huge pages where it can.
+// Parameters:
+//  address - starting virtual address
+//  size    - size of the virtual memory range
+// Return:
+//  true if it has succeeded, false if it has failed or is not supported
+bool GCToOSInterface::VirtualAdviseHugePages(void* address, size_t size)
+{
+    // Windows only has large pages that are committed upfront (see VirtualReserveAndCommitLargePages).
+    return false;
+}
+
 // Reset virtual memory range. Indicates that data in the memory range specified by address and size is no
 // longer of interest, but it should not be decommitted.
 // Parameters:
@@ -847,6 +859,27 @@ bool GCToOSInterface::GetWriteWatch(bool resetState, void* address, size_t size,
     return success;
 }
 
+// Check if the OS tracks writes to all memory of the process by itself
+bool GCToOSInterface::SupportsProcessWriteWatch()
+{
+    // Windows has write watch for memory reserved with MEM_WRITE_WATCH instead (see SupportsWriteWatch).
+    return false;
+}
+
+// Reset the process wide write tracking state
+void GCToOSInterface::ResetProcessWriteWatch()
+{
+    assert(!"should never call ResetProcessWriteWatch on Windows");
+}
+
+// Retrieve addresses of the pages in a region of virtual memory that were written to since
+// the last ResetProcessWriteWatch
+bool GCToOSInterface::GetProcessWriteWatch(void* address, size_t size, void** pageAddresses, uintptr_t* pageAddressesCount)
+{
+    assert(!"should never call GetProcessWriteWatch on Windows");
+    return false;
+}
+
 // Get size of the largest cache on the processor die
 // Parameters:
 //  trueSize - true to return true cache size, false to return scaled up size based on
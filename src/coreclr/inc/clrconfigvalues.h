@@ -273,6 +273,7 @@ RETAIL_CONFIG_DWORD_INFO(EXTERNAL_GCStress, W("GCStress"), 0, "Trigger GCs at re
 CONFIG_DWORD_INFO(INTERNAL_GcStressOnDirectCalls, W("GcStressOnDirectCalls"), 0, "Whether to trigger a GC on direct calls")
 RETAIL_CONFIG_DWORD_INFO(UNSUPPORTED_HeapVerify, W("HeapVerify"), 0, "When set verifies the integrity of the managed heap on entry and exit of each GC")
 RETAIL_CONFIG_DWORD_INFO(EXTERNAL_GCCpuGroup, W("GCCpuGroup"), 0, "Specifies if to enable GC to support CPU groups")
+RETAIL_CONFIG_DWORD_INFO(EXTERNAL_FinalizerThreadCount, W("FinalizerThreadCount"), 1, "Number of threads that run finalizers. Values greater than 1 start helper threads that drain the finalization queue in parallel with the finalizer thread, bounded by the number of processors.")
 RETAIL_CONFIG_STRING_INFO(EXTERNAL_GCName, W("GCName"), "")
 /**
  * This flag allows us to force the runtime to use global allocation context on Windows x86/amd64 instead of thread allocation context just for testing purpose.
@@ -314,6 +315,9 @@ RETAIL_CONFIG_DWORD_INFO(UNSUPPORTED_StackSamplingEnabled, W("StackSamplingEnabl
 RETAIL_CONFIG_DWORD_INFO(UNSUPPORTED_StackSamplingAfter, W("StackSamplingAfter"), 0, "When to start sampling (for some sort of app steady state), i.e., initial delay for sampling start in milliseconds.")
 RETAIL_CONFIG_DWORD_INFO(UNSUPPORTED_StackSamplingEvery, W("StackSamplingEvery"), 100, "How frequent should thread stacks be sampled in milliseconds.")
 RETAIL_CONFIG_DWORD_INFO(UNSUPPORTED_StackSamplingNumMethods, W("StackSamplingNumMethods"), 32, "Number of evolving methods to track as hot and JIT them in the background at a given point of execution.")
+RETAIL_CONFIG_DWORD_INFO(UNSUPPORTED_StackSamplingProfile, W("StackSamplingProfile"), 0, "If set, sampled stacks are merged into a stack trie that is reported with StackSamplingNodes and StackSamplingCounts events, independently of StackSamplingEnabled.")
+RETAIL_CONFIG_DWORD_INFO(UNSUPPORTED_StackSamplingMaxFrames, W("StackSamplingMaxFrames"), 64, "Maximum number of frames recorded from the top of each thread's stack in a sample.")
+RETAIL_CONFIG_DWORD_INFO(UNSUPPORTED_StackSamplingReportEvery, W("StackSamplingReportEvery"), 10, "Number of samples between reports of the stack trie when StackSamplingProfile is set.")
 #endif // defined(FEATURE_JIT_SAMPLING)
 
 #if defined(ALLOW_SXS_JIT_NGEN)
@@ -353,6 +357,7 @@ RETAIL_CONFIG_DWORD_INFO(INTERNAL_JitVNMapSelBudget, W("JitVNMapSelBudget"), 100
 #endif // !(defined(TARGET_AMD64) || defined(TARGET_X86) || defined(TARGET_ARM64))
 RETAIL_CONFIG_DWORD_INFO(INTERNAL_SIMD16ByteOnly, W("SIMD16ByteOnly"), 0, "Limit maximum SIMD vector length to 16 bytes (used by x64_arm64_altjit)")
 RETAIL_CONFIG_DWORD_INFO(UNSUPPORTED_TrackDynamicMethodDebugInfo, W("TrackDynamicMethodDebugInfo"), 0, "Specifies whether debug info should be generated and tracked for dynamic methods")
+RETAIL_CONFIG_DWORD_INFO(EXTERNAL_ReflectionInvokeStubThreshold, W("ReflectionInvokeStubThreshold"), 0, "Number of times a method is invoked through reflection before an IL stub specialized to its signature is used to invoke it. Zero disables the IL stubs.")
 
 #ifdef FEATURE_MULTICOREJIT
 
@@ -360,6 +365,8 @@ RETAIL_CONFIG_STRING_INFO(INTERNAL_MultiCoreJitProfile, W("MultiCoreJitProfile")
 RETAIL_CONFIG_DWORD_INFO(INTERNAL_MultiCoreJitProfileWriteDelay, W("MultiCoreJitProfileWriteDelay"), 12, "Set the delay after which the multi-core JIT profile will be written to disk.")
 RETAIL_CONFIG_DWORD_INFO(INTERNAL_MultiCoreJitMinNumCpus, W("MultiCoreJitMinNumCpus"), 2, "Minimum number of cpus that must be present to allow MultiCoreJit usage.")
 RETAIL_CONFIG_DWORD_INFO(INTERNAL_MultiCoreJitNoProfileGather, W("MultiCoreJitNoProfileGather"), 0, "Set to 1 to disable profile gathering (but leave possibly enabled profile usage).")
+RETAIL_CONFIG_DWORD_INFO(INTERNAL_MultiCoreJitProfileWriteOnTieringIdle, W("MultiCoreJitProfileWriteOnTieringIdle"), 1, "Set to 0 to disable writing the multi-core JIT profile being recorded whenever tiered compilation runs out of background work.")
+RETAIL_CONFIG_DWORD_INFO(INTERNAL_MultiCoreJitPlaybackThreads, W("MultiCoreJitPlaybackThreads"), 0, "Number of threads that jit methods from the multi-core JIT profile, including the playback thread. Zero to use a quarter of the processor count, up to 4.")
 
 #endif
 
@@ -396,6 +403,7 @@ RETAIL_CONFIG_DWORD_INFO(INTERNAL_InterpreterFallback, W("InterpreterFallback"),
 ///
 CONFIG_DWORD_INFO(INTERNAL_LoaderHeapCallTracing, W("LoaderHeapCallTracing"), 0, "Loader heap troubleshooting")
 RETAIL_CONFIG_DWORD_INFO(INTERNAL_CodeHeapReserveForJumpStubs, W("CodeHeapReserveForJumpStubs"), 1, "Percentage of code heap to reserve for jump stubs")
+RETAIL_CONFIG_DWORD_INFO(EXTERNAL_CodeHeapHugePages, W("CodeHeapHugePages"), 0, "Allocate tier 1 code from separate code heaps that are reserved in 2MB chunks and backed by transparent huge pages where the OS supports it")
 RETAIL_CONFIG_DWORD_INFO(INTERNAL_BreakOnOutOfMemoryWithinRange, W("BreakOnOutOfMemoryWithinRange"), 0, "Break before out of memory within range exception is thrown")
 
 ///
@@ -443,6 +451,7 @@ RETAIL_CONFIG_DWORD_INFO(EXTERNAL_SpinLimitProcFactor, W("SpinLimitProcFactor"),
 RETAIL_CONFIG_DWORD_INFO(EXTERNAL_SpinLimitConstant, W("SpinLimitConstant"), 0x0, "Hex value specifying the constant to add when calculating the maximum spin duration")
 RETAIL_CONFIG_DWORD_INFO(EXTERNAL_SpinRetryCount, W("SpinRetryCount"), 0xA, "Hex value specifying the number of times the entire spin process is repeated (when applicable)")
 RETAIL_CONFIG_DWORD_INFO(INTERNAL_Monitor_SpinCount, W("Monitor_SpinCount"), 0x1e, "Hex value specifying the maximum number of spin iterations Monitor may perform upon contention on acquiring the lock before waiting.")
+RETAIL_CONFIG_DWORD_INFO(INTERNAL_Monitor_AdaptiveSpin, W("Monitor_AdaptiveSpin"), 1, "If set, the number of spin iterations Monitor performs upon contention is adjusted per lock, up to Monitor_SpinCount, based on whether spinning recently acquired the lock.")
 
 ///
 /// Native Binder
@@ -482,7 +491,7 @@ RETAIL_CONFIG_STRING_INFO(UNSUPPORTED_ETW_ObjectAllocationEventsPerTypePerSec, W
 RETAIL_CONFIG_DWORD_INFO(UNSUPPORTED_ProfAPI_ValidateNGENInstrumentation, W("ProfAPI_ValidateNGENInstrumentation"), 0, "This flag enables additional validations when using the IMetaDataEmit APIs for NGEN'ed images to ensure only supported edits are made.")
 
 #ifdef FEATURE_PERFMAP
-RETAIL_CONFIG_DWORD_INFO(EXTERNAL_PerfMapEnabled, W("PerfMapEnabled"), 0, "This flag is used on Linux to enable writing /tmp/perf-$pid.map. It is disabled by default")
+RETAIL_CONFIG_DWORD_INFO(EXTERNAL_PerfMapEnabled, W("PerfMapEnabled"), 0, "This flag is used on Linux to enable writing /tmp/perf-$pid.map and the jit-$pid.dump jitdump file: 1 writes both, 2 only the jitdump file, 3 only the perf map and perfinfo files. It is disabled by default")
 RETAIL_CONFIG_STRING_INFO(EXTERNAL_PerfMapJitDumpPath, W("PerfMapJitDumpPath"), "Specifies a path to write the perf jitdump file. Defaults to GetTempPathA()")
 RETAIL_CONFIG_DWORD_INFO(EXTERNAL_PerfMapIgnoreSignal, W("PerfMapIgnoreSignal"), 0, "When perf map is enabled, this option will configure the specified signal to be accepted and ignored as a marker in the perf logs.  It is disabled by default")
 RETAIL_CONFIG_DWORD_INFO(EXTERNAL_PerfMapShowOptimizationTiers, W("PerfMapShowOptimizationTiers"), 1, "Shows optimization tiers in the perf map for methods, as part of the symbol name. Useful for seeing separate stack frames for different optimization tiers of each method.")
@@ -490,6 +499,7 @@ RETAIL_CONFIG_STRING_INFO(EXTERNAL_NativeImagePerfMapFormat, W("NativeImagePerfM
 #endif
 
 RETAIL_CONFIG_STRING_INFO(EXTERNAL_StartupDelayMS, W("StartupDelayMS"), "")
+RETAIL_CONFIG_STRING_INFO(EXTERNAL_StartupTimelineFile, W("StartupTimelineFile"), "If set, the time taken by each phase of EE startup is written to this file once startup completes or fails.")
 
 ///
 /// Stress
@@ -574,12 +584,17 @@ RETAIL_CONFIG_DWORD_INFO(UNSUPPORTED_TC_QuickJitForLoops, W("TC_QuickJitForLoops
 #endif // defined(TARGET_AMD64) || defined(TARGET_ARM64)
 RETAIL_CONFIG_DWORD_INFO(EXTERNAL_TC_AggressiveTiering, W("TC_AggressiveTiering"), 0, "Transition through tiers aggressively.")
 RETAIL_CONFIG_DWORD_INFO(INTERNAL_TC_BackgroundWorkerTimeoutMs, W("TC_BackgroundWorkerTimeoutMs"), TC_BackgroundWorkerTimeoutMs, "How long in milliseconds the background worker thread may remain idle before exiting.")
+RETAIL_CONFIG_DWORD_INFO(INTERNAL_TC_BackgroundWorkerMaxCount, W("TC_BackgroundWorkerMaxCount"), 0, "Maximum number of background workers that may jit methods queued for promotion concurrently. Zero to use a quarter of the processor count.")
+RETAIL_CONFIG_DWORD_INFO(INTERNAL_TC_BackgroundWorkerBacklogPerWorker, W("TC_BackgroundWorkerBacklogPerWorker"), 32, "Number of methods queued for promotion that justifies each additional background worker.")
 RETAIL_CONFIG_DWORD_INFO(INTERNAL_TC_CallCountThreshold, W("TC_CallCountThreshold"), TC_CallCountThreshold, "Number of times a method must be called in tier 0 after which it is promoted to the next tier.")
 RETAIL_CONFIG_DWORD_INFO(INTERNAL_TC_CallCountingDelayMs, W("TC_CallCountingDelayMs"), TC_CallCountingDelayMs, "A perpetual delay in milliseconds that is applied to call counting in tier 0 and jitting at higher tiers, while there is startup-like activity.")
 RETAIL_CONFIG_DWORD_INFO(INTERNAL_TC_DelaySingleProcMultiplier, W("TC_DelaySingleProcMultiplier"), TC_DelaySingleProcMultiplier, "Multiplier for TC_CallCountingDelayMs that is applied on a single-processor machine or when the process is affinitized to a single processor.")
 RETAIL_CONFIG_DWORD_INFO(INTERNAL_TC_CallCounting, W("TC_CallCounting"), 1, "Enabled by default (only activates when TieredCompilation is also enabled). If disabled immediately backpatches prestub, and likely prevents any promotion to higher tiers")
 RETAIL_CONFIG_DWORD_INFO(INTERNAL_TC_UseCallCountingStubs, W("TC_UseCallCountingStubs"), 1, "Uses call counting stubs for faster call counting.")
 RETAIL_CONFIG_DWORD_INFO(INTERNAL_TC_DeleteCallCountingStubsAfter, W("TC_DeleteCallCountingStubsAfter"), 0, "Deletes call counting stubs after this many have completed. Zero to disable deleting.")
+RETAIL_CONFIG_DWORD_INFO(INTERNAL_TC_SamplingTierUp, W("TC_SamplingTierUp"), 0, "Promotes tier 0 methods that are seen often in periodic stack samples instead of counting their calls with call counting stubs.")
+RETAIL_CONFIG_DWORD_INFO(INTERNAL_TC_SamplingIntervalMs, W("TC_SamplingIntervalMs"), 10, "With TC_SamplingTierUp, the interval in milliseconds between stack samples.")
+RETAIL_CONFIG_DWORD_INFO(INTERNAL_TC_SampleThreshold, W("TC_SampleThreshold"), 3, "With TC_SamplingTierUp, the number of samples a tier 0 method must be seen in before it is promoted to the next tier.")
 #undef TC_BackgroundWorkerTimeoutMs
 #undef TC_CallCountThreshold
 #undef TC_CallCountingDelayMs
@@ -593,6 +608,7 @@ RETAIL_CONFIG_DWORD_INFO(INTERNAL_TC_DeleteCallCountingStubsAfter, W("TC_DeleteC
 #ifdef FEATURE_ON_STACK_REPLACEMENT
 RETAIL_CONFIG_DWORD_INFO(INTERNAL_OSR_CounterBump, W("OSR_CounterBump"), 1000, "Counter reload value when a patchpoint is hit")
 RETAIL_CONFIG_DWORD_INFO(INTERNAL_OSR_HitLimit, W("OSR_HitLimit"), 10, "Number of times a patchpoint must call back to trigger an OSR transition")
+RETAIL_CONFIG_DWORD_INFO(INTERNAL_OSR_TimeLimitMs, W("OSR_TimeLimitMs"), 20, "Milliseconds after the first call back from a patchpoint after which the next one triggers an OSR transition, even if OSR_HitLimit was not reached. 0 to only use OSR_HitLimit.")
 CONFIG_DWORD_INFO(INTERNAL_OSR_LowId, W("OSR_LowId"), (DWORD)-1, "Low end of enabled patchpoint range (inclusive)");
 CONFIG_DWORD_INFO(INTERNAL_OSR_HighId, W("OSR_HighId"), 10000000, "High end of enabled patchpoint range (inclusive)");
 #endif
@@ -613,6 +629,11 @@ RETAIL_CONFIG_DWORD_INFO(EXTERNAL_TieredPGO, W("TieredPGO"), 0, "Instrument Tier
 RETAIL_CONFIG_DWORD_INFO(UNSUPPORTED_TieredPGO_InstrumentOnlyHotCode, W("TieredPGO_InstrumentOnlyHotCode"), 1, "Strategy for TieredPGO, see comments in clrconfigvalues.h")
 #endif
 
+///
+/// Hot/cold splitting of jitted code
+///
+RETAIL_CONFIG_DWORD_INFO(UNSUPPORTED_TC_HotColdSplitting, W("TC_HotColdSplitting"), 0, "Allow the JIT to move the cold blocks of Tier1 methods to the top of the code heap, away from the hot code. Only on x64 and ARM64.")
+
 ///
 /// Entry point slot backpatch
 ///
@@ -632,6 +653,7 @@ CONFIG_DWORD_INFO(INTERNAL_VirtualCallStubDumpLogCounter, W("VirtualCallStubDump
 CONFIG_DWORD_INFO(INTERNAL_VirtualCallStubDumpLogIncr, W("VirtualCallStubDumpLogIncr"), 0, "Used only when STUB_LOGGING is defined, which by default is not.")
 RETAIL_CONFIG_DWORD_INFO(EXTERNAL_VirtualCallStubLogging, W("VirtualCallStubLogging"), 0, "Worth keeping, but should be moved into \"#ifdef STUB_LOGGING\" blocks. This goes for most (or all) of the stub logging infrastructure.")
 CONFIG_DWORD_INFO(INTERNAL_VirtualCallStubMissCount, W("VirtualCallStubMissCount"), 100, "Used only when STUB_LOGGING is defined, which by default is not.")
+CONFIG_DWORD_INFO(INTERNAL_VirtualCallStubPolymorphicTypes, W("VirtualCallStubPolymorphicTypes"), 4, "Number of receiver types (at most 4) a virtual stub dispatch call site checks inline before it switches to the resolve cache. 1 disables polymorphic call sites.")
 CONFIG_DWORD_INFO(INTERNAL_VirtualCallStubResetCacheCounter, W("VirtualCallStubResetCacheCounter"), 0, "Used only when STUB_LOGGING is defined, which by default is not.")
 CONFIG_DWORD_INFO(INTERNAL_VirtualCallStubResetCacheIncr, W("VirtualCallStubResetCacheIncr"), 0, "Used only when STUB_LOGGING is defined, which by default is not.")
 
@@ -660,6 +682,8 @@ RETAIL_CONFIG_STRING_INFO(INTERNAL_NativeImageSearchPaths, W("NativeImageSearchP
 RETAIL_CONFIG_DWORD_INFO(EXTERNAL_ReadyToRun, W("ReadyToRun"), 1, "Enable/disable use of ReadyToRun native code") // On by default for CoreCLR
 RETAIL_CONFIG_STRING_INFO(EXTERNAL_ReadyToRunExcludeList, W("ReadyToRunExcludeList"), "List of assemblies that cannot use Ready to Run images")
 RETAIL_CONFIG_STRING_INFO(EXTERNAL_ReadyToRunLogFile, W("ReadyToRunLogFile"), "Name of file to log success/failure of using Ready to Run images")
+RETAIL_CONFIG_DWORD_INFO(EXTERNAL_ReadyToRunPrefetchSections, W("ReadyToRunPrefetchSections"), 0, "If set, the metadata and the Ready to Run sections of images are prefetched asynchronously once the images are mapped, instead of being paged in on first access")
+RETAIL_CONFIG_DWORD_INFO(INTERNAL_ReadyToRunFixupResolverThreads, W("ReadyToRunFixupResolverThreads"), 0, "Number of background threads that resolve the fixup cells of Ready to Run images ahead of use once they are loaded. Zero to resolve fixups lazily only.")
 
 #if defined(FEATURE_EVENT_TRACE) || defined(FEATURE_EVENTSOURCE_XPLAT)
 RETAIL_CONFIG_DWORD_INFO(EXTERNAL_EnableEventLog, W("EnableEventLog"), 0, "Enable/disable use of EnableEventLogging mechanism ") // Off by default
@@ -686,6 +710,7 @@ RETAIL_CONFIG_DWORD_INFO(INTERNAL_EventPipeRundown, W("EventPipeRundown"), 1, "E
 RETAIL_CONFIG_DWORD_INFO(INTERNAL_EventPipeCircularMB, W("EventPipeCircularMB"), 1024, "The EventPipe circular buffer size in megabytes.")
 RETAIL_CONFIG_DWORD_INFO(INTERNAL_EventPipeProcNumbers, W("EventPipeProcNumbers"), 0, "Enable/disable capturing processor numbers in EventPipe event headers")
 RETAIL_CONFIG_DWORD_INFO(INTERNAL_EventPipeOutputStreaming, W("EventPipeOutputStreaming"), 0, "Enable/disable streaming for trace file set in DOTNET_EventPipeOutputPath.  Non-zero values enable streaming.")
+RETAIL_CONFIG_DWORD_INFO(INTERNAL_EventPipeOutputUserEvents, W("EventPipeOutputUserEvents"), 0, "Write the events enabled by DOTNET_EventPipeConfig to Linux user_events tracepoints instead of a trace file.  Non-zero values enable it.")
 
 #ifdef FEATURE_AUTO_TRACE
 RETAIL_CONFIG_DWORD_INFO_EX(INTERNAL_AutoTrace_N_Tracers, W("AutoTrace_N_Tracers"), 0, "", CLRConfig::LookupOptions::ParseIntegerAsBase10)
@@ -546,6 +546,8 @@ enum CorInfoHelpFunc
     CORINFO_HELP_GETSHARED_NONGCTHREADSTATIC_BASE_NOCTOR,
     CORINFO_HELP_GETSHARED_GCTHREADSTATIC_BASE_DYNAMICCLASS,
     CORINFO_HELP_GETSHARED_NONGCTHREADSTATIC_BASE_DYNAMICCLASS,
+    CORINFO_HELP_GETSHARED_GCTHREADSTATIC_BASE_NOCTOR_OPTIMIZED,    // Takes the class's thread static block index (see getThreadLocalStaticBlockIndex)
+    CORINFO_HELP_GETSHARED_NONGCTHREADSTATIC_BASE_NOCTOR_OPTIMIZED, // Takes the class's thread static block index (see getThreadLocalStaticBlockIndex)
 
     /* Debugger */
 
@@ -650,6 +652,8 @@ enum CorInfoHelpFunc
     CORINFO_HELP_DELEGATEPROFILE64,         // Update 64-bit method profile for a delegate call site
     CORINFO_HELP_VTABLEPROFILE32,           // Update 32-bit method profile for a vtable call site
     CORINFO_HELP_VTABLEPROFILE64,           // Update 64-bit method profile for a vtable call site
+    CORINFO_HELP_COUNTPROFILE32,            // Update 32-bit block or edge count profile
+    CORINFO_HELP_COUNTPROFILE64,            // Update 64-bit block or edge count profile
 
     CORINFO_HELP_VALIDATE_INDIRECT_CALL,    // CFG: Validate function pointer
     CORINFO_HELP_DISPATCH_INDIRECT_CALL,    // CFG: Validate and dispatch to pointer
@@ -657,6 +661,10 @@ enum CorInfoHelpFunc
     CORINFO_HELP_COUNT,
 };
 
+// Block and edge counts below this are incremented inline, CORINFO_HELP_COUNTPROFILE32/64
+// are only called for larger counts.
+#define CORINFO_COUNTPROFILE_EXACT_LIMIT 0x2000
+
 //This describes the signature for a helper method.
 enum CorInfoHelpSig
 {
@@ -3188,6 +3196,12 @@ public:
                     void                  **ppIndirection = NULL
                     ) = 0;
 
+    // returns the index of the class's entry in the per-thread table of thread static bases, which is passed to
+    // CORINFO_HELP_GETSHARED_GCTHREADSTATIC_BASE_NOCTOR_OPTIMIZED and CORINFO_HELP_GETSHARED_NONGCTHREADSTATIC_BASE_NOCTOR_OPTIMIZED
+    virtual uint32_t getThreadLocalStaticBlockIndex (
+                    CORINFO_CLASS_HANDLE    cls
+                    ) = 0;
+
 
     // return the data's address (for static fields only)
     virtual void* getFieldAddress(
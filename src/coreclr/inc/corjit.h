@@ -160,6 +160,26 @@ struct AllocMemArgs
     void* roDataBlockRW;
 };
 
+// Per-method throughput and memory telemetry, passed to reportJitPhaseTelemetry
+// when the JIT is invoked with CORJIT_FLAG_PHASE_TELEMETRY.
+//
+// Phase ids are the JIT's Phases values (see jit/compphases.h) and memory kind ids
+// are its CompMemKind values (see jit/compmemkind.h); they are only meaningful for
+// the JIT that reported them. Only phases that ran and kinds that allocated are listed.
+struct JitPhaseTelemetry
+{
+    uint64_t totalCycles;     // Cycles spent compiling the method
+    uint64_t totalArenaBytes; // Bytes of arena pages the JIT got from the host
+
+    uint32_t        phaseCount;
+    const uint16_t* phaseIds;
+    const uint64_t* phaseCycles;
+
+    uint32_t        memKindCount;
+    const uint16_t* memKindIds;
+    const uint64_t* memKindBytes;
+};
+
 #include "corjithost.h"
 
 extern "C" void jitStartup(ICorJitHost* host);
@@ -498,6 +518,13 @@ public:
         uint32_t        sizeInBytes   /* IN: The size of the buffer. Note that this is effectively a
                                           version number for the CORJIT_FLAGS value. */
         ) = 0;
+
+    // Reports the phase timings and arena usage of the method being compiled. Only
+    // called when the JIT was invoked with CORJIT_FLAG_PHASE_TELEMETRY. The arrays in
+    // `telemetry` do not remain valid after the call returns.
+    virtual void reportJitPhaseTelemetry(
+        const JitPhaseTelemetry* telemetry /* IN */
+        ) = 0;
 };
 
 /**********************************************************************************/
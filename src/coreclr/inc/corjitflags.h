@@ -97,7 +97,7 @@ public:
         CORJIT_FLAG_UNUSED16                = 43,
 #endif // !defined(TARGET_ARM)
 
-        CORJIT_FLAG_UNUSED17                = 44,
+        CORJIT_FLAG_PHASE_TELEMETRY         = 44, // JIT should time its phases and call reportJitPhaseTelemetry
         CORJIT_FLAG_UNUSED18                = 45,
         CORJIT_FLAG_UNUSED19                = 46,
         CORJIT_FLAG_UNUSED20                = 47,
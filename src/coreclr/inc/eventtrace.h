@@ -35,6 +35,8 @@
 #include "eventtracebase.h"
 #include "gcinterface.h"
 
+class TypeKey;
+
 #if defined(GC_PROFILING) || defined(FEATURE_EVENT_TRACE)
 struct ProfilingScanContext : ScanContext
 {
@@ -174,6 +176,8 @@ namespace ETW
         static VOID FlushObjectAllocationEvents();
         static UINT32 TypeLoadBegin();
         static VOID TypeLoadEnd(UINT32 typeLoad, TypeHandle th, UINT16 loadLevel);
+        static UINT64 TypeLoadWaitBegin();
+        static VOID TypeLoadWaitEnd(UINT64 waitStart, TypeKey *pTypeKey, TypeHandle th, UINT16 loadLevel);
 
     private:
         static BOOL ShouldLogType(TypeHandle th);
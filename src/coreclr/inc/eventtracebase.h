@@ -879,12 +879,16 @@ namespace ETW
 
         static VOID DomainUnload(AppDomain *pDomain);
         static VOID CollectibleLoaderAllocatorUnload(AssemblyLoaderAllocator *pLoaderAllocator);
+        static VOID CollectibleLoaderAllocatorsUnloaded(UINT32 count, UINT64 assemblyCleanupMicroseconds, UINT64 suspendMicroseconds, UINT64 codeAndStubsMicroseconds, UINT64 handlesMicroseconds);
+        static VOID CollectibleLoaderAllocatorsFreed(UINT32 count, UINT64 freeMicroseconds);
         static VOID ModuleLoad(Module *pModule, LONG liReportedSharedModule);
 #else
     public:
         static VOID DomainLoad(BaseDomain *pDomain, _In_opt_ LPWSTR wszFriendlyName=NULL) {};
         static VOID DomainUnload(AppDomain *pDomain) {};
         static VOID CollectibleLoaderAllocatorUnload(AssemblyLoaderAllocator *pLoaderAllocator) {};
+        static VOID CollectibleLoaderAllocatorsUnloaded(UINT32 count, UINT64 assemblyCleanupMicroseconds, UINT64 suspendMicroseconds, UINT64 codeAndStubsMicroseconds, UINT64 handlesMicroseconds) {};
+        static VOID CollectibleLoaderAllocatorsFreed(UINT32 count, UINT64 freeMicroseconds) {};
         static VOID ModuleLoad(Module *pModule, LONG liReportedSharedModule) {};
 #endif // FEATURE_EVENT_TRACE
     };
@@ -1261,6 +1265,9 @@ namespace ETW
                 static void SendResume(UINT32 newMethodCount);
                 static void SendBackgroundJitStart(UINT32 pendingMethodCount);
                 static void SendBackgroundJitStop(UINT32 pendingMethodCount, UINT32 jittedMethodCount);
+                static void SendBackgroundWorkers(UINT32 pendingMethodCount, UINT32 workerCount);
+                static void SendMethodPromoted(MethodDesc *methodDesc, UINT16 optimizationTier, UINT64 queueMicroseconds, UINT64 compileMicroseconds);
+                static void SendOsrTransition(MethodDesc *methodDesc, UINT32 ilOffset, UINT32 hitCount, UINT64 tier0Milliseconds, UINT32 flags);
 #else
                 static bool IsEnabled() { return false; }
                 static void SendSettings() {}
@@ -1268,6 +1275,9 @@ namespace ETW
                 static void SendResume(UINT32 newMethodCount) {}
                 static void SendBackgroundJitStart(UINT32 pendingMethodCount) {}
                 static void SendBackgroundJitStop(UINT32 pendingMethodCount, UINT32 jittedMethodCount) {}
+                static void SendBackgroundWorkers(UINT32 pendingMethodCount, UINT32 workerCount) {}
+                static void SendMethodPromoted(MethodDesc *methodDesc, UINT16 optimizationTier, UINT64 queueMicroseconds, UINT64 compileMicroseconds) {}
+                static void SendOsrTransition(MethodDesc *methodDesc, UINT32 ilOffset, UINT32 hitCount, UINT64 tier0Milliseconds, UINT32 flags) {}
 #endif
 
                 DISABLE_CONSTRUCT_COPY(Runtime);
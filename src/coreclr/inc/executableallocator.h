@@ -102,18 +102,32 @@ class ExecutableAllocator
     // for platforms that don't use shared memory.
     size_t m_freeOffset = 0;
 
-    // Last RW mapping cached so that it can be reused for the next mapping
-    // request if it goes into the same range.
-    BlockRW* m_cachedMapping = NULL;
+    // Number of RW mappings kept cached. Stubs, precodes, and jitted code are usually written
+    // to a few different heaps in turns, so caching only the last mapping would unmap it
+    // and map it again over and over.
+    static const int CachedMappingCount = 4;
+
+    // RW mappings are created for aligned windows of this size (clipped to the RX block) rather
+    // than just the requested range, so that the following writes to the same heap find the
+    // cached mapping instead of creating a new one.
+    static const size_t RWMappingWindowSize = 256 * 1024;
+
+    // Most recently used RW mappings, the most recent first, cached so that they can be reused
+    // for the next mapping requests that go into the same ranges. Each holds a reference to
+    // its block until it is evicted or the RX block it maps is released.
+    BlockRW* m_cachedMappings[CachedMappingCount] = {};
 
     // Synchronization of the public allocator methods
     CRITSEC_COOKIE m_CriticalSection;
 
-    // Update currently cached mapping. If the passed in block is the same as the one
-    // in the cache, it keeps it cached. Otherwise it destroys the currently cached one
-    // and replaces it by the passed in one.
+    // Update the cached mappings. If the passed in block is already cached, it becomes the
+    // most recently used one. Otherwise it is added to the cache, and the least recently
+    // used mapping is evicted if the cache is full.
     void UpdateCachedMapping(BlockRW *pBlock);
 
+    // Drop the reference the cache holds on the block and unmap it if it is not used anymore.
+    void ReleaseCachedMapping(BlockRW *pBlock);
+
     // Find existing RW block that maps the whole specified range of RX memory.
     // Return NULL if no such block exists.
     void* FindRWBlock(void* baseRX, size_t size);
@@ -226,6 +240,10 @@ public:
     // by one of the ReserveXXX methods.
     void Release(void* pRX);
 
+    // Ask the OS to back the specified range of reserved executable memory with huge pages where it can.
+    // This is only a hint, the memory works the same way whether the OS follows it or not.
+    void AdviseHugePages(void* pRX, size_t size);
+
     // Map the specified block of executable memory as RW
     void* MapRW(void* pRX, size_t size);
 
@@ -472,6 +472,60 @@ private:
 };
 
 #ifdef USE_GC_INFO_DECODER
+
+#if defined(PARTIALLY_INTERRUPTIBLE_GC_SUPPORTED) && !defined(DACCESS_COMPILE) && !defined(FEATURE_NATIVEAOT) && !defined(GCINFODECODER_NO_EE)
+#define GCINFODECODER_LIVE_SLOT_CACHE
+#endif
+
+#ifdef GCINFODECODER_LIVE_SLOT_CACHE
+//
+// Remembers the slots reported at recently decoded safepoints while the current
+// thread scans stacks for a GC. Deep stacks tend to stop at the same few call
+// sites over and over, and finding those here avoids decoding the slot table and
+// the live states again for every frame. Code can't be unloaded while stacks are
+// being scanned, so the cache only lives for the duration of one scan.
+//
+class GcInfoLiveSlotCache
+{
+public:
+    static const UINT32 NUM_ENTRIES = 64;
+    static const UINT32 MAX_SLOTS_PER_ENTRY = 16;
+
+    struct Entry
+    {
+        PTR_CBYTE   GcInfo;             // NULL if the entry is not valid
+        UINT32      InstructionOffset;
+        UINT32      NumSlots;
+        UINT32      NumLiveTracked;     // the live tracked slots come first, then the untracked ones
+        UINT32      RegisterMask;       // bit i is set if Slots[i] is a register
+        GcSlotDesc  Slots[MAX_SLOTS_PER_ENTRY];
+    };
+
+    // Enables the cache on the current thread for the lifetime of the holder.
+    class ScanHolder
+    {
+    public:
+        ScanHolder();
+        ~ScanHolder();
+
+    private:
+        GcInfoLiveSlotCache* m_pCache;
+    };
+
+    // Returns the cache of the current thread, or NULL if it is not scanning stacks.
+    static GcInfoLiveSlotCache* GetCurrent();
+
+    // Returns the entry that a safepoint maps to, it holds that safepoint only if the keys match.
+    Entry* GetEntry(PTR_CBYTE gcInfo, UINT32 instructionOffset);
+
+    // Adds a slot to an entry being filled, returns NULL if the entry is full.
+    static Entry* AddSlot(Entry* pEntry, const GcSlotDesc* pSlot, bool isRegister);
+
+private:
+    Entry m_Entries[NUM_ENTRIES];
+};
+#endif // GCINFODECODER_LIVE_SLOT_CACHE
+
 class GcInfoDecoder
 {
 public:
@@ -596,8 +650,8 @@ private:
 
 #ifdef _DEBUG
     GcInfoDecoderFlags m_Flags;
-    PTR_CBYTE m_GcInfoAddress;
 #endif
+    PTR_CBYTE m_GcInfoAddress;
     UINT32 m_Version;
 
     static bool SetIsInterruptibleCB (UINT32 startOffset, UINT32 stopOffset, void * hCallback);
@@ -655,6 +709,18 @@ private:
                                 );
 
 
+#ifdef GCINFODECODER_LIVE_SLOT_CACHE
+    void ReportCachedSlots(
+                const GcInfoLiveSlotCache::Entry* pEntry,
+                UINT32              firstSlot,
+                PREGDISPLAY         pRD,
+                bool                reportScratchSlots,
+                unsigned            inputFlags,
+                GCEnumCallback      pCallBack,
+                void *              hCallBack
+                );
+#endif // GCINFODECODER_LIVE_SLOT_CACHE
+
     inline void ReportSlotToGC(
                     GcSlotDecoder&      slotDecoder,
                     UINT32              slotIndex,
@@ -666,9 +732,29 @@ private:
                     )
     {
         _ASSERTE(slotIndex < slotDecoder.GetNumSlots());
-        const GcSlotDesc* pSlot = slotDecoder.GetSlotDesc(slotIndex);
 
-        if(slotIndex < slotDecoder.GetNumRegisters())
+        ReportSlotDescToGC(
+                    slotDecoder.GetSlotDesc(slotIndex),
+                    slotIndex < slotDecoder.GetNumRegisters(),
+                    pRD,
+                    reportScratchSlots,
+                    inputFlags,
+                    pCallBack,
+                    hCallBack
+                    );
+    }
+
+    inline void ReportSlotDescToGC(
+                    const GcSlotDesc*   pSlot,
+                    bool                isRegister,
+                    PREGDISPLAY         pRD,
+                    bool                reportScratchSlots,
+                    unsigned            inputFlags,
+                    GCEnumCallback      pCallBack,
+                    void *              hCallBack
+                    )
+    {
+        if(isRegister)
         {
             UINT32 regNum = pSlot->Slot.RegisterNumber;
             if( reportScratchSlots || !IsScratchRegister( regNum, pRD ) )
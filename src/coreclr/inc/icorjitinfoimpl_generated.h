@@ -617,6 +617,9 @@ unsigned getClassDomainID(
           CORINFO_CLASS_HANDLE cls,
           void** ppIndirection) override;
 
+uint32_t getThreadLocalStaticBlockIndex(
+          CORINFO_CLASS_HANDLE cls) override;
+
 void* getFieldAddress(
           CORINFO_FIELD_HANDLE field,
           void** ppIndirection) override;
@@ -755,6 +758,9 @@ uint32_t getJitFlags(
           CORJIT_FLAGS* flags,
           uint32_t sizeInBytes) override;
 
+void reportJitPhaseTelemetry(
+          const JitPhaseTelemetry* telemetry) override;
+
 /**********************************************************************************/
 // clang-format on
 /**********************************************************************************/
@@ -43,11 +43,11 @@ typedef const GUID *LPCGUID;
 #define GUID_DEFINED
 #endif // !GUID_DEFINED
 
-constexpr GUID JITEEVersionIdentifier = { /* da097b39-7f43-458a-990a-0b65406d5ff3 */
-    0xda097b39,
-    0x7f43,
-    0x458a,
-    {0x99, 0xa, 0xb, 0x65, 0x40, 0x6d, 0x5f, 0xf3}
+constexpr GUID JITEEVersionIdentifier = { /* 6f3d1c52-9b8e-4a27-8d41-3e5a7c90b2f6 */
+    0x6f3d1c52,
+    0x9b8e,
+    0x4a27,
+    {0x8d, 0x41, 0x3e, 0x5a, 0x7c, 0x90, 0xb2, 0xf6}
   };
 
 //////////////////////////////////////////////////////////////////////////////////////////////////////////
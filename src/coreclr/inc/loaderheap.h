@@ -211,6 +211,11 @@ private:
     PTR_BYTE            m_pPtrToEndOfCommittedRegion;
     PTR_BYTE            m_pEndReservedRegion;
 
+    // Allocation pointer and end of the chunk that cold code is currently allocated from. Cold code
+    // chunks are carved off the top of the reserved region, see UnlockedAllocMemForColdCode_NoThrow.
+    PTR_BYTE            m_pColdAllocPtr;
+    PTR_BYTE            m_pEndColdRegion;
+
     // When we need to ClrVirtualAlloc() MEM_RESERVE a new set of pages, number of bytes to reserve
     DWORD               m_dwReserveBlockSize;
 
@@ -439,6 +444,8 @@ public:
 protected:
     void *UnlockedAllocMemForCode_NoThrow(size_t dwHeaderSize, size_t dwCodeSize, DWORD dwCodeAlignment, size_t dwReserveForJumpStubs);
 
+    void *UnlockedAllocMemForColdCode_NoThrow(size_t dwHeaderSize, size_t dwCodeSize, DWORD dwCodeAlignment);
+
     void UnlockedSetReservedRegion(BYTE* dwReservedRegionAddress, SIZE_T dwReservedRegionSize, BOOL fReleaseMemory);
 };
 
@@ -861,6 +868,12 @@ public:
         return UnlockedAllocMemForCode_NoThrow(dwHeaderSize, dwCodeSize, dwCodeAlignment, dwReserveForJumpStubs);
     }
 
+    void *AllocMemForColdCode_NoThrow(size_t dwHeaderSize, size_t dwCodeSize, DWORD dwCodeAlignment)
+    {
+        WRAPPER_NO_CONTRACT;
+        return UnlockedAllocMemForColdCode_NoThrow(dwHeaderSize, dwCodeSize, dwCodeAlignment);
+    }
+
     void SetReservedRegion(BYTE* dwReservedRegionAddress, SIZE_T dwReservedRegionSize, BOOL fReleaseMemory)
     {
         WRAPPER_NO_CONTRACT;
@@ -16,7 +16,7 @@
 
 // Keep these in sync with src/coreclr/tools/Common/Internal/Runtime/ModuleHeaders.cs
 #define READYTORUN_MAJOR_VERSION 0x0008
-#define READYTORUN_MINOR_VERSION 0x0000
+#define READYTORUN_MINOR_VERSION 0x0001
 
 #define MINIMUM_READYTORUN_MAJOR_VERSION 0x008
 
@@ -27,6 +27,7 @@
 // R2R Version 6.0 changes managed layout for sequential types with any unmanaged non-blittable fields.
 //     R2R 6.0 is not backward compatible with 5.x or earlier.
 // R2R Version 8.0 Changes the alignment of the Int128 type
+// R2R Version 8.1 adds the FrozenObjects section and the FrozenObject fixup
 
 struct READYTORUN_CORE_HEADER
 {
@@ -88,6 +89,7 @@ enum class ReadyToRunSectionType : uint32_t
     ManifestAssemblyMvids       = 118, // Added in V5.3
     CrossModuleInlineInfo       = 119, // Added in V6.2
     HotColdMap                  = 120, // Added in V8.0
+    FrozenObjects               = 121, // Added in V8.1
 
     // If you add a new section consider whether it is a breaking or non-breaking change.
     // Usually it is non-breaking, but if it is preferable to have older runtimes fail
@@ -246,6 +248,8 @@ enum ReadyToRunFixupKind
 
     READYTORUN_FIXUP_Check_IL_Body              = 0x35, /* Check to see if an IL method is defined the same at runtime as at compile time. A failed match will cause code not to be used. */
     READYTORUN_FIXUP_Verify_IL_Body             = 0x36, /* Verify an IL body is defined the same at compile time and runtime. A failed match will cause a hard runtime failure. */
+
+    READYTORUN_FIXUP_FrozenObject               = 0x37, /* Address of an object in the FrozenObjects section */
 };
 
 //
@@ -435,6 +439,30 @@ struct READYTORUN_EXCEPTION_CLAUSE
     };
 };
 
+//
+// Frozen objects
+//
+
+// The FrozenObjects section holds objects (typically preinitialized static arrays and strings) that
+// are already laid out the way the GC expects to find them on a frozen segment, so the runtime can
+// register them with the GC where they are in the image instead of allocating and copying them at
+// startup. The header is followed by NumberOfTypes type tokens (TypeDef, TypeRef or TypeSpec in the
+// metadata of the component the section belongs to), and the objects start ObjectsOffset bytes from
+// the start of the section. Each object is preceded by its ObjHeader and is pointer size aligned, and
+// has the index of its type in the token array where its MethodTable pointer goes. The runtime
+// replaces the indices with MethodTable pointers before the objects are used, so the objects must be
+// in a writable part of the image. The GC doesn't scan frozen segments, so the objects can't be of
+// types that contain object references.
+struct READYTORUN_FROZEN_OBJECTS_HEADER
+{
+    DWORD   NumberOfTypes;
+    DWORD   ObjectsOffset;  // offset of the ObjHeader of the first object
+    DWORD   ObjectsSize;    // size of all the objects plus the size of an ObjHeader, which is how
+                            // the GC describes the allocated part of a frozen segment
+
+    // mdToken Types[NumberOfTypes];
+};
+
 enum ReadyToRunRuntimeConstants : DWORD
 {
     READYTORUN_PInvokeTransitionFrameSizeInPointerUnits = 11,
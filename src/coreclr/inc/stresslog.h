@@ -394,7 +394,7 @@ public:
     static void Enter(CRITSEC_COOKIE dummy = NULL);
     static void Leave(CRITSEC_COOKIE dummy = NULL);
     static ThreadStressLog* CreateThreadStressLog();
-    static ThreadStressLog* CreateThreadStressLogHelper();
+    static ThreadStressLog* CreateThreadStressLogHelper(BOOL fRecycleDeadLogs);
 
     static BOOL InlinedStressLogOn(unsigned facility, unsigned level);
     static BOOL InlinedETWLogOn(unsigned facility, unsigned level);
@@ -31,12 +31,23 @@ public:
     static const unsigned int MaxOptimalMaxNormalizedYieldsPerSpinIteration =
         TargetMaxNsPerSpinIteration * 3 / (TargetNsPerNormalizedYield * 2) + 1;
 
+    // Processors with a number below this may be normalized separately, see s_hasPerProcessorNormalization
+    static const unsigned int MaxPerProcessorNormalizationCount = 256;
+
 private:
     static bool s_isMeasurementScheduled;
 
     static unsigned int s_yieldsPerNormalizedYield;
     static unsigned int s_optimalMaxNormalizedYieldsPerSpinIteration;
 
+    // On processors with cores of different types (for instance performance and efficiency cores), the latency of a yield may
+    // differ several times between cores. Measurements are also recorded per processor, and once processors are found to
+    // differ significantly, spin-waits use the values of the processor they start on, or the values above for processors that
+    // have not been measured yet. Each entry is 0 when the processor has not been measured, or otherwise has the yields per
+    // normalized yield in the low 16 bits and the optimal max normalized yields per spin iteration in the high 16 bits.
+    static bool s_hasPerProcessorNormalization;
+    static UINT32 s_perProcessorNormalization[MaxPerProcessorNormalizationCount];
+
 public:
     static bool IsMeasurementScheduled()
     {
@@ -57,6 +68,27 @@ public:
     static void FireMeasurementEvents();
 
 private:
+    static void GetPerProcessorNormalization(
+        unsigned int *yieldsPerNormalizedYieldRef,
+        unsigned int *optimalMaxNormalizedYieldsPerSpinIterationRef)
+    {
+        // On Windows, this is the number within the processor group, processors of different groups share entries
+        DWORD processorNumber = GetCurrentProcessorNumber();
+        if (processorNumber >= MaxPerProcessorNormalizationCount)
+        {
+            return;
+        }
+
+        UINT32 normalization = s_perProcessorNormalization[processorNumber];
+        if (normalization != 0)
+        {
+            *yieldsPerNormalizedYieldRef = normalization & 0xffff;
+            *optimalMaxNormalizedYieldsPerSpinIterationRef = normalization >> 16;
+        }
+    }
+
+    static void RecordPerProcessorMeasurement(DWORD processorNumber, double nsPerYield);
+
     static double AtomicLoad(double *valueRef);
     static void AtomicStore(double *valueRef, double value);
 
@@ -76,9 +108,16 @@ private:
 public:
     YieldProcessorNormalizationInfo()
         : yieldsPerNormalizedYield(YieldProcessorNormalization::s_yieldsPerNormalizedYield),
-        optimalMaxNormalizedYieldsPerSpinIteration(YieldProcessorNormalization::s_optimalMaxNormalizedYieldsPerSpinIteration),
-        optimalMaxYieldsPerSpinIteration(yieldsPerNormalizedYield * optimalMaxNormalizedYieldsPerSpinIteration)
+        optimalMaxNormalizedYieldsPerSpinIteration(YieldProcessorNormalization::s_optimalMaxNormalizedYieldsPerSpinIteration)
     {
+        if (YieldProcessorNormalization::s_hasPerProcessorNormalization)
+        {
+            YieldProcessorNormalization::GetPerProcessorNormalization(
+                &yieldsPerNormalizedYield,
+                &optimalMaxNormalizedYieldsPerSpinIteration);
+        }
+
+        optimalMaxYieldsPerSpinIteration = yieldsPerNormalizedYield * optimalMaxNormalizedYieldsPerSpinIteration;
         YieldProcessorNormalization::ScheduleMeasurementIfNecessary();
     }
 
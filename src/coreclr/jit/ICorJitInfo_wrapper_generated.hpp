@@ -1474,6 +1474,15 @@ unsigned WrapICorJitInfo::getClassDomainID(
     return temp;
 }
 
+uint32_t WrapICorJitInfo::getThreadLocalStaticBlockIndex(
+          CORINFO_CLASS_HANDLE cls)
+{
+    API_ENTER(getThreadLocalStaticBlockIndex);
+    uint32_t temp = wrapHnd->getThreadLocalStaticBlockIndex(cls);
+    API_LEAVE(getThreadLocalStaticBlockIndex);
+    return temp;
+}
+
 void* WrapICorJitInfo::getFieldAddress(
           CORINFO_FIELD_HANDLE field,
           void** ppIndirection)
@@ -1787,6 +1796,14 @@ uint32_t WrapICorJitInfo::getJitFlags(
     return temp;
 }
 
+void WrapICorJitInfo::reportJitPhaseTelemetry(
+          const JitPhaseTelemetry* telemetry)
+{
+    API_ENTER(reportJitPhaseTelemetry);
+    wrapHnd->reportJitPhaseTelemetry(telemetry);
+    API_LEAVE(reportJitPhaseTelemetry);
+}
+
 /**********************************************************************************/
 // clang-format on
 /**********************************************************************************/
@@ -7,6 +7,31 @@
 #pragma hdrstop
 #endif // defined(_MSC_VER)
 
+extern bool g_jitInitialized;
+
+thread_local ArenaAllocator::PageCache ArenaAllocator::t_pageCache;
+
+//------------------------------------------------------------------------
+// ArenaAllocator::PageCache::~PageCache:
+//    Returns a thread's cached pages to the host when the thread exits.
+ArenaAllocator::PageCache::~PageCache()
+{
+    // If the JIT has already shut down the process is going away, and the
+    // host may be gone too.
+    if (!g_jitInitialized)
+    {
+        return;
+    }
+
+    for (PageDescriptor* next; m_pages != nullptr; m_pages = next)
+    {
+        next = m_pages->m_next;
+        freeHostMemory(m_pages, m_pages->m_pageBytes);
+    }
+
+    m_count = 0;
+}
+
 //------------------------------------------------------------------------
 // ArenaAllocator::bypassHostAllocator:
 //    Indicates whether or not the ArenaAllocator should bypass the JIT
@@ -42,7 +67,11 @@ size_t ArenaAllocator::getDefaultPageSize()
 // ArenaAllocator::ArenaAllocator:
 //    Default-constructs an arena allocator.
 ArenaAllocator::ArenaAllocator()
-    : m_firstPage(nullptr), m_lastPage(nullptr), m_nextFreeByte(nullptr), m_lastFreeByte(nullptr)
+    : m_firstPage(nullptr)
+    , m_lastPage(nullptr)
+    , m_nextFreeByte(nullptr)
+    , m_lastFreeByte(nullptr)
+    , m_bytesByKind(nullptr)
 {
 #if MEASURE_MEM_ALLOC
     memset(&m_stats, 0, sizeof(m_stats));
@@ -86,8 +115,18 @@ void* ArenaAllocator::allocateNewPage(size_t size)
         pageSize = roundUp(pageSize, DEFAULT_PAGE_SIZE);
     }
 
-    // Allocate the new page
-    PageDescriptor* newPage = static_cast<PageDescriptor*>(allocateHostMemory(pageSize, &pageSize));
+    // Allocate the new page, preferring one this thread cached.
+    PageDescriptor* newPage = t_pageCache.m_pages;
+    if ((pageSize == DEFAULT_PAGE_SIZE) && (newPage != nullptr))
+    {
+        assert(newPage->m_pageBytes == DEFAULT_PAGE_SIZE);
+        t_pageCache.m_pages = newPage->m_next;
+        t_pageCache.m_count--;
+    }
+    else
+    {
+        newPage = static_cast<PageDescriptor*>(allocateHostMemory(pageSize, &pageSize));
+    }
 
     // Append the new page to the end of the list
     newPage->m_next      = nullptr;
@@ -122,11 +161,26 @@ void ArenaAllocator::destroy()
 {
     PageDescriptor* page = m_firstPage;
 
-    // Free all of the allocated pages
+    // Pages from the OS should go back right away so that page heap can catch
+    // use-after-free bugs.
+    const unsigned cacheLimit = bypassHostAllocator() ? 0 : (unsigned)JitConfig.JitArenaPageCacheLimit();
+
+    // Cache default-sized pages for this thread's next compilation, and free
+    // the rest.
     for (PageDescriptor* next; page != nullptr; page = next)
     {
         next = page->m_next;
-        freeHostMemory(page, page->m_pageBytes);
+
+        if ((page->m_pageBytes == DEFAULT_PAGE_SIZE) && (t_pageCache.m_count < cacheLimit))
+        {
+            page->m_next        = t_pageCache.m_pages;
+            t_pageCache.m_pages = page;
+            t_pageCache.m_count++;
+        }
+        else
+        {
+            freeHostMemory(page, page->m_pageBytes);
+        }
     }
 
     // Clear out the allocator's fields
@@ -134,6 +188,7 @@ void ArenaAllocator::destroy()
     m_lastPage     = nullptr;
     m_nextFreeByte = nullptr;
     m_lastFreeByte = nullptr;
+    m_bytesByKind  = nullptr;
 }
 
 //------------------------------------------------------------------------
@@ -49,6 +49,23 @@ private:
     BYTE* m_nextFreeByte;
     BYTE* m_lastFreeByte;
 
+    // Bytes allocated by kind, for JIT phase telemetry. Null unless enabled.
+    size_t* m_bytesByKind;
+
+    // Default-sized pages that this thread's finished compilations left behind.
+    // The next compilation on the thread reuses them instead of going back to the
+    // host. At most JitArenaPageCacheLimit pages are kept; the rest go back to the
+    // host, as do all cached pages when the thread exits.
+    struct PageCache
+    {
+        PageDescriptor* m_pages;
+        unsigned        m_count;
+
+        ~PageCache();
+    };
+
+    static thread_local PageCache t_pageCache;
+
     void* allocateNewPage(size_t size);
 
     static void* allocateHostMemory(size_t size, size_t* pActualSize);
@@ -111,7 +128,7 @@ public:
         void* allocateMemory(size_t sz)
         {
             m_arena->m_stats.AddAlloc(sz, m_kind);
-            return m_arena->allocateMemory(sz);
+            return m_arena->allocateMemory(sz, m_kind);
         }
     };
 
@@ -144,6 +161,14 @@ public:
     void destroy();
 
     inline void* allocateMemory(size_t sz);
+    inline void* allocateMemory(size_t sz, CompMemKind kind);
+
+    // Start counting bytes allocated by kind into `bytesByKind`, which must
+    // have CMK_Count entries and outlive this allocator's use.
+    void trackBytesByKind(size_t* bytesByKind)
+    {
+        m_bytesByKind = bytesByKind;
+    }
 
     size_t getTotalBytesAllocated();
     size_t getTotalBytesUsed();
@@ -201,6 +226,27 @@ inline void* ArenaAllocator::allocateMemory(size_t size)
     return block;
 }
 
+//------------------------------------------------------------------------
+// ArenaAllocator::allocateMemory:
+//    Allocates memory of the given kind using an `ArenaAllocator`.
+//
+// Arguments:
+//    size - The number of bytes to allocate.
+//    kind - The kind of the allocation.
+//
+// Return Value:
+//    A pointer to the allocated memory.
+//
+inline void* ArenaAllocator::allocateMemory(size_t size, CompMemKind kind)
+{
+    if (m_bytesByKind != nullptr)
+    {
+        m_bytesByKind[kind] += size;
+    }
+
+    return allocateMemory(size);
+}
+
 // Allows general purpose code (e.g. collection classes) to allocate
 // memory of a pre-determined kind via an arena allocator.
 
@@ -210,6 +256,7 @@ class CompAllocator
     ArenaAllocator::MemStatsAllocator* m_arena;
 #else
     ArenaAllocator* m_arena;
+    CompMemKind     m_kind;
 #endif
 
 public:
@@ -217,7 +264,7 @@ public:
 #if MEASURE_MEM_ALLOC
         : m_arena(arena->getMemStatsAllocator(cmk))
 #else
-        : m_arena(arena)
+        : m_arena(arena), m_kind(cmk)
 #endif
     {
     }
@@ -233,7 +280,11 @@ public:
             NOMEM();
         }
 
+#if MEASURE_MEM_ALLOC
         void* p = m_arena->allocateMemory(count * sizeof(T));
+#else
+        void* p = m_arena->allocateMemory(count * sizeof(T), m_kind);
+#endif
 
         // Ensure that the allocator returned sizeof(size_t) aligned memory.
         assert((size_t(p) & (sizeof(size_t) - 1)) == 0);
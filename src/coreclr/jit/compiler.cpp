@@ -4597,6 +4597,10 @@ void Compiler::compCompile(void** methodCodePtr, uint32_t* methodCodeSize, JitFl
     //
     DoPhase(this, PHASE_STR_ADRLCL, &Compiler::fgMarkAddressExposedLocals);
 
+    // Promote the hot fields of struct locals that weren't promoted.
+    //
+    DoPhase(this, PHASE_PHYSICAL_PROMOTION, &Compiler::PhysicalPromotion);
+
     // Run a simple forward substitution pass.
     //
     DoPhase(this, PHASE_FWD_SUB, &Compiler::fgForwardSub);
@@ -4698,10 +4702,18 @@ void Compiler::compCompile(void** methodCodePtr, uint32_t* methodCodeSize, JitFl
         //
         DoPhase(this, PHASE_CLONE_LOOPS, &Compiler::optCloneLoops);
 
+        // Vectorize simple counted loops over arrays and spans
+        //
+        DoPhase(this, PHASE_VECTORIZE_LOOPS, &Compiler::optVectorizeLoops);
+
         // Unroll loops
         //
         DoPhase(this, PHASE_UNROLL_LOOPS, &Compiler::optUnrollLoops);
 
+        // Widen int induction variables so indexing with them needs no sign extension
+        //
+        DoPhase(this, PHASE_WIDEN_IVS, &Compiler::optWidenInductionVariables);
+
         // Clear loop table info that is not used after this point, and might become invalid.
         //
         DoPhase(this, PHASE_CLEAR_LOOP_INFO, &Compiler::optClearLoopIterInfo);
@@ -4904,6 +4916,9 @@ void Compiler::compCompile(void** methodCodePtr, uint32_t* methodCodeSize, JitFl
     // Insert GC Polls
     DoPhase(this, PHASE_INSERT_GC_POLLS, &Compiler::fgInsertGCPolls);
 
+    // Find ref stores into objects that no GC can have seen yet
+    DoPhase(this, PHASE_MARK_NEW_OBJ_STORES, &Compiler::fgMarkNewObjectStores);
+
     if (opts.OptimizationEnabled())
     {
         // Optimize boolean conditions
@@ -5502,9 +5517,19 @@ int Compiler::compCompile(CORINFO_MODULE_HANDLE classPtr,
 
         checkedForJitTimeLog = true;
     }
-    if ((Compiler::compJitTimeLogFilename != nullptr) || (JitTimeLogCsv() != nullptr))
+
+    // The EE asks for phase telemetry when a trace session wants it. Inlinees are
+    // timed as part of the root method's phases.
+    const bool reportPhaseTelemetry = compileFlags->IsSet(JitFlags::JIT_FLAG_PHASE_TELEMETRY) && !compIsForInlining();
+
+    if ((Compiler::compJitTimeLogFilename != nullptr) || (JitTimeLogCsv() != nullptr) || reportPhaseTelemetry)
     {
         pCompJitTimer = JitTimer::Create(this, info.compMethodInfo->ILCodeSize);
+
+        if (reportPhaseTelemetry)
+        {
+            compArenaAllocator->trackBytesByKind(pCompJitTimer->BytesByKind());
+        }
     }
 #endif // FEATURE_JIT_METHOD_PERF
 
@@ -8309,6 +8334,8 @@ void CompTimeSummaryInfo::Print(FILE* f)
 
 JitTimer::JitTimer(unsigned byteCodeSize) : m_info(byteCodeSize)
 {
+    memset(m_bytesByKind, 0, sizeof(m_bytesByKind));
+
 #if MEASURE_CLRAPI_CALLS
     m_CLRcallInvokes = 0;
     m_CLRcallCycles  = 0;
@@ -8638,9 +8665,70 @@ void JitTimer::Shutdown()
     }
 }
 
+// Reports the timing and arena usage of the current method to the EE.
+void JitTimer::ReportPhaseTelemetry(Compiler* comp)
+{
+    if (m_info.m_timerFailure)
+    {
+        return;
+    }
+
+    uint16_t phaseIds[PHASE_NUMBER_OF];
+    uint64_t phaseCycles[PHASE_NUMBER_OF];
+    uint32_t phaseCount = 0;
+
+    for (int i = 0; i < PHASE_NUMBER_OF; i++)
+    {
+        // Parent phases just sum up their children, so only report leaves.
+        if (!PhaseHasChildren[i] && (m_info.m_invokesByPhase[i] > 0))
+        {
+            phaseIds[phaseCount]    = (uint16_t)i;
+            phaseCycles[phaseCount] = m_info.m_cyclesByPhase[i];
+            phaseCount++;
+        }
+    }
+
+    uint16_t memKindIds[CMK_Count];
+    uint64_t memKindBytes[CMK_Count];
+    uint32_t memKindCount = 0;
+
+    for (int i = 0; i < CMK_Count; i++)
+    {
+        if (m_bytesByKind[i] > 0)
+        {
+            memKindIds[memKindCount]   = (uint16_t)i;
+            memKindBytes[memKindCount] = m_bytesByKind[i];
+            memKindCount++;
+        }
+    }
+
+    JitPhaseTelemetry telemetry;
+    telemetry.totalCycles     = m_info.m_totalCycles;
+    telemetry.totalArenaBytes = comp->compArenaAllocator->getTotalBytesAllocated();
+    telemetry.phaseCount      = phaseCount;
+    telemetry.phaseIds        = phaseIds;
+    telemetry.phaseCycles     = phaseCycles;
+    telemetry.memKindCount    = memKindCount;
+    telemetry.memKindIds      = memKindIds;
+    telemetry.memKindBytes    = memKindBytes;
+
+    comp->info.compCompHnd->reportJitPhaseTelemetry(&telemetry);
+}
+
 // Completes the timing of the current method, and adds it to "sum".
 void JitTimer::Terminate(Compiler* comp, CompTimeSummaryInfo& sum, bool includePhases)
 {
+    if (includePhases && comp->opts.jitFlags->IsSet(JitFlags::JIT_FLAG_PHASE_TELEMETRY))
+    {
+        ReportPhaseTelemetry(comp);
+    }
+
+    // Telemetry alone doesn't need the process-wide summary, nor its lock.
+    if ((Compiler::compJitTimeLogFilename == nullptr) && (Compiler::JitTimeLogCsv() == nullptr))
+    {
+        return;
+    }
+
     if (includePhases)
     {
         PrintCsvMethodStats(comp);
@@ -9373,6 +9461,10 @@ void cTreeFlags(Compiler* comp, GenTree* tree)
                 {
                     chars += printf("[IND_TGT_HEAP]");
                 }
+                if (tree->gtFlags & GTF_IND_TGT_NEW_OBJ)
+                {
+                    chars += printf("[IND_TGT_NEW_OBJ]");
+                }
                 if (tree->gtFlags & GTF_IND_REQ_ADDR_IN_REG)
                 {
                     chars += printf("[IND_REQ_ADDR_IN_REG]");
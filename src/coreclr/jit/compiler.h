@@ -1597,9 +1597,12 @@ class JitTimer
 #endif
     CompTimeInfo m_info; // The CompTimeInfo for this compilation.
 
+    size_t m_bytesByKind[CMK_Count]; // Arena bytes by CompMemKind, for phase telemetry.
+
     static CritSecObject s_csvLock; // Lock to protect the time log file.
     static FILE*         s_csvFile; // The time log file handle.
     void PrintCsvMethodStats(Compiler* comp);
+    void ReportPhaseTelemetry(Compiler* comp);
 
 private:
     void* operator new(size_t);
@@ -1627,8 +1630,14 @@ public:
     void CLRApiCallLeave(unsigned apix);
 #endif // MEASURE_CLRAPI_CALLS
 
+    // Returns the array the arena allocator should count bytes by CompMemKind into.
+    size_t* BytesByKind()
+    {
+        return m_bytesByKind;
+    }
+
     // Completes the timing of the current method, which is assumed to have "byteCodeBytes" bytes of bytecode,
-    // and adds it to "sum".
+    // and adds it to "sum". If the EE asked for phase telemetry, also reports the timing to the EE.
     void Terminate(Compiler* comp, CompTimeSummaryInfo& sum, bool includePhases);
 
     // Attempts to query the cycle counter of the current thread.  If successful, returns "true" and sets
@@ -1884,6 +1893,7 @@ class Compiler
     friend class IndirectCallTransformer;
 
 #ifdef FEATURE_HW_INTRINSICS
+    friend class LoopVectorizer;
     friend struct HWIntrinsicInfo;
     friend struct SimdAsHWIntrinsicInfo;
 #endif // FEATURE_HW_INTRINSICS
@@ -3363,6 +3373,7 @@ public:
     // If the local is a TYP_STRUCT, get/set a class handle describing it
     CORINFO_CLASS_HANDLE lvaGetStruct(unsigned varNum);
     void lvaSetStruct(unsigned varNum, CORINFO_CLASS_HANDLE typeHnd, bool unsafeValueClsCheck);
+    void lvaSetStruct(unsigned varNum, ClassLayout* layout, bool unsafeValueClsCheck);
     void lvaSetStructUsedAsVarArg(unsigned varNum);
 
     // If the local is TYP_REF, set or update the associated class information.
@@ -4212,6 +4223,8 @@ private:
 
     GenTree* impInlineFetchArg(unsigned lclNum, InlArgInfo* inlArgInfo, InlLclVarInfo* lclTypeInfo);
 
+    void impImportPartialInlineColdBlock(BasicBlock* block);
+
     bool impInlineIsThis(GenTree* tree, InlArgInfo* inlArgInfo);
 
     bool impInlineIsGuaranteedThisDerefBeforeAnySideEffects(GenTree*    additionalTree,
@@ -5132,6 +5145,7 @@ public:
     void fgInitBlockVarSets();
 
     PhaseStatus fgInsertGCPolls();
+    PhaseStatus fgMarkNewObjectStores();
     BasicBlock* fgCreateGCPoll(GCPollType pollType, BasicBlock* block);
 
     // Requires that "block" is a block that returns from
@@ -5337,6 +5351,8 @@ public:
     PhaseStatus fgComputeEdgeWeights();
 
     bool fgReorderBlocks(bool useProfile);
+    bool fgReorderBlocksExtTSP();
+    bool fgReorderRunExtTSP(BasicBlock* runFirst, unsigned runLength);
 
 #ifdef FEATURE_EH_FUNCLETS
     bool fgFuncletsAreCold();
@@ -5488,6 +5504,8 @@ protected:
 
     void fgFindJumpTargets(const BYTE* codeAddr, IL_OFFSET codeSize, FixedBitVect* jumpTarget);
 
+    void fgFindPartialInlineSplit(const BYTE* codeAddr, IL_OFFSET codeSize);
+
     void fgMarkBackwardJump(BasicBlock* startBlock, BasicBlock* endBlock);
 
     void fgLinkBasicBlocks();
@@ -5526,6 +5544,7 @@ protected:
     bool fgHaveProfileData();
     bool fgHaveProfileWeights();
     bool fgGetProfileWeightForBasicBlock(IL_OFFSET offset, weight_t* weight);
+    bool fgProfileEdgeIsNeverTaken(IL_OFFSET sourceOffset, IL_OFFSET targetOffset);
 
     Instrumentor* fgCountInstrumentor;
     Instrumentor* fgHistogramInstrumentor;
@@ -5937,6 +5956,8 @@ private:
     PhaseStatus fgMarkAddressExposedLocals();
     void fgMarkAddressExposedLocals(Statement* stmt);
 
+    PhaseStatus PhysicalPromotion();
+
     PhaseStatus fgForwardSub();
     bool fgForwardSubBlock(BasicBlock* block);
     bool fgForwardSubStatement(Statement* statement);
@@ -6078,6 +6099,7 @@ private:
     // Returns false if we encounter a block that is not marked as being inside a loop.
     //
     bool optComputeLoopSideEffectsOfBlock(BasicBlock* blk);
+    MemoryKindSet optComputeLoopSideEffectsOfStore(unsigned lnum, GenTree* addr, unsigned storeSize);
 
     // Hoist the expression "expr" out of loop "lnum".
     void optPerformHoistExpr(GenTree* expr, BasicBlock* exprBb, unsigned lnum);
@@ -6097,7 +6119,13 @@ public:
     PhaseStatus optCloneLoops();
     void optCloneLoop(unsigned loopInd, LoopCloneContext* context);
     void optEnsureUniqueHead(unsigned loopInd, weight_t ambientWeight);
+    PhaseStatus optVectorizeLoops(); // Vectorizes simple counted loops
     PhaseStatus optUnrollLoops(); // Unrolls loops (needs to have cost info)
+    PhaseStatus optWidenInductionVariables();
+#ifdef TARGET_AMD64
+    bool optWidenIV(unsigned lclNum, uint64_t loops, GenTree** iterTrees);
+#endif
+    bool        optPartialUnrollLoop(unsigned lnum);
     void        optRemoveRedundantZeroInits();
     PhaseStatus optIfConversion(); // If conversion
 
@@ -6898,12 +6926,16 @@ public:
         optMethodFlags |= OMF_HAS_GUARDEDDEVIRT;
     }
 
+    // Upper bound on JitGuardedDevirtualizationMaxTypeChecks
+    static const unsigned MAX_GDV_TYPE_CHECKS = 5;
+
     void pickGDV(GenTreeCall*           call,
                  IL_OFFSET              ilOffset,
                  bool                   isInterface,
-                 CORINFO_CLASS_HANDLE*  classGuess,
-                 CORINFO_METHOD_HANDLE* methodGuess,
-                 unsigned*              likelihood);
+                 CORINFO_CLASS_HANDLE*  classGuesses,
+                 CORINFO_METHOD_HANDLE* methodGuesses,
+                 unsigned*              likelihoods,
+                 unsigned*              numberOfGuesses);
 
     void considerGuardedDevirtualization(GenTreeCall*            call,
                                          IL_OFFSET               ilOffset,
@@ -7018,6 +7050,8 @@ public:
     bool optRedundantBranch(BasicBlock* const block);
     bool optJumpThreadDom(BasicBlock* const block, BasicBlock* const domBlock, bool domIsSameRelop);
     bool optJumpThreadPhi(BasicBlock* const block, GenTree* tree, ValueNum treeNormVN);
+    ValueNum optJumpThreadPhiSubstVN(
+        BasicBlock* block, BasicBlock* predBlock, ValueNum vn, unsigned depth, bool* foundPhi);
     bool optJumpThreadCheck(BasicBlock* const block, BasicBlock* const domBlock);
     bool optJumpThreadCore(JumpThreadInfo& jti);
     bool optReachable(BasicBlock* const fromBlock, BasicBlock* const toBlock, BasicBlock* const excludedBlock);
@@ -9904,7 +9938,8 @@ public:
 
     bool compObjectStackAllocation()
     {
-        return (JitConfig.JitObjectStackAllocation() != 0);
+        const int mode = JitConfig.JitObjectStackAllocation();
+        return (mode == 1) || ((mode == 2) && opts.jitFlags->IsSet(JitFlags::JIT_FLAG_TIER1));
     }
 
     // Returns true if the method requires a PInvoke prolog and epilog
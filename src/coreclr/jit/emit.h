@@ -747,6 +747,10 @@ protected:
         unsigned _idLclVar : 1; // access a local on stack.
 #endif
 
+#ifdef TARGET_XARCH
+        unsigned _idEvexbContext : 1; // does EVEX.b need to be set (embedded broadcast)
+#endif
+
 #ifdef TARGET_ARM
         insSize  _idInsSize : 2;   // size of instruction: 16, 32 or 48 bits
         insFlags _idInsFlags : 1;  // will this instruction set the flags
@@ -760,8 +764,11 @@ protected:
 #elif defined(TARGET_ARM64)
 // For Arm64, we have used 17 bits from the second DWORD.
 #define ID_EXTRA_BITFIELD_BITS (17)
-#elif defined(TARGET_XARCH) || defined(TARGET_LOONGARCH64)
-                                 // For xarch and LoongArch64, we have used 14 bits from the second DWORD.
+#elif defined(TARGET_XARCH)
+// For xarch, we have used 15 bits from the second DWORD.
+#define ID_EXTRA_BITFIELD_BITS (15)
+#elif defined(TARGET_LOONGARCH64)
+// For LoongArch64, we have used 14 bits from the second DWORD.
 #define ID_EXTRA_BITFIELD_BITS (14)
 #else
 #error Unsupported or unset target architecture
@@ -769,8 +776,8 @@ protected:
 
         ////////////////////////////////////////////////////////////////////////
         // Space taken up to here:
-        // x86:   46 bits
-        // amd64: 46 bits
+        // x86:   47 bits
+        // amd64: 47 bits
         // arm:   48 bits
         // arm64: 49 bits
         // loongarch64: 46 bits
@@ -782,8 +789,8 @@ protected:
 
         ////////////////////////////////////////////////////////////////////////
         // Space taken up to here:
-        // x86:   48 bits
-        // amd64: 48 bits
+        // x86:   49 bits
+        // amd64: 49 bits
         // arm:   50 bits
         // arm64: 51 bits
         // loongarch64: 48 bits
@@ -1305,6 +1312,17 @@ protected:
         }
 #endif // TARGET_LOONGARCH64
 
+#ifdef TARGET_XARCH
+        bool idIsEvexbContext() const
+        {
+            return _idEvexbContext != 0;
+        }
+        void idSetEvexbContext()
+        {
+            _idEvexbContext = 1;
+        }
+#endif // TARGET_XARCH
+
         bool idIsCnsReloc() const
         {
             return _idCnsReloc != 0;
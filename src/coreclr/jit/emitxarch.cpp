@@ -796,6 +796,28 @@ bool emitter::TakesEvexPrefix(instruction ins) const
     return IsEvexEncodedInstruction(ins) && !HasKMaskRegisterDest(ins);
 }
 
+//------------------------------------------------------------------------
+// TakesEvexPrefix: Checks if the instruction described by `id` should be EVEX encoded.
+// On top of the per-instruction answer, this accounts for the features only the EVEX
+// encoding can express, such as embedded broadcast.
+//
+// Arguments:
+//    id -- instruction descriptor to check
+//
+// Return Value:
+//    true if this instruction requires a EVEX prefix.
+//
+bool emitter::TakesEvexPrefix(const instrDesc* id) const
+{
+    if (HasEmbeddedBroadcast(id))
+    {
+        assert(IsEvexEncodedInstruction(id->idIns()));
+        return true;
+    }
+
+    return TakesEvexPrefix(id->idIns());
+}
+
 // Intel AVX-512 encoding is defined in "Intel 64 and ia-32 architectures software developer's manual volume 2", Section
 // 2.6.
 // Add base EVEX prefix without setting W, R, X, or B bits
@@ -827,6 +849,29 @@ bool emitter::TakesEvexPrefix(instruction ins) const
 #define DEFAULT_BYTE_EVEX_PREFIX_MASK 0xFFFFFFFF00000000ULL
 #define LBIT_IN_BYTE_EVEX_PREFIX 0x0000002000000000ULL
 
+#define BBIT_IN_BYTE_EVEX_PREFIX 0x0000001000000000ULL
+
+//------------------------------------------------------------------------
+// AddEvexbBitIfNeeded: Set the EVEX.b bit if the instruction does embedded broadcast.
+//
+// Arguments:
+//    id -- instruction descriptor being encoded.
+//    code -- opcode bits, with the EVEX prefix already added.
+//
+// Return Value:
+//    encoded code with the EVEX.b bit set if required.
+//
+emitter::code_t emitter::AddEvexbBitIfNeeded(const instrDesc* id, code_t code)
+{
+    assert(hasEvexPrefix(code));
+
+    if (HasEmbeddedBroadcast(id))
+    {
+        code |= BBIT_IN_BYTE_EVEX_PREFIX;
+    }
+    return code;
+}
+
 //------------------------------------------------------------------------
 // AddEvexPrefix: Add default EVEX perfix with only LL' bits set.
 //
@@ -1139,7 +1184,7 @@ emitter::code_t emitter::AddRexWPrefix(instruction ins, code_t code)
 {
     if (UseEvexEncoding() && IsEvexEncodedInstruction(ins))
     {
-        if (TakesEvexPrefix(ins) && codeEvexMigrationCheck(code)) // TODO-XArch-AVX512: Remove codeEvexMigrationCheck().
+        if (codeEvexMigrationCheck(code)) // TODO-XArch-AVX512: Remove codeEvexMigrationCheck().
         {
             // W-bit is available in 4-byte EVEX prefix that starts with byte 62.
             assert(hasEvexPrefix(code));
@@ -1173,7 +1218,7 @@ emitter::code_t emitter::AddRexRPrefix(instruction ins, code_t code)
 {
     if (UseEvexEncoding() && IsEvexEncodedInstruction(ins))
     {
-        if (TakesEvexPrefix(ins) && codeEvexMigrationCheck(code)) // TODO-XArch-AVX512: Remove codeEvexMigrationCheck().
+        if (codeEvexMigrationCheck(code)) // TODO-XArch-AVX512: Remove codeEvexMigrationCheck().
         {
             // R-bit is available in 4-byte EVEX prefix that starts with byte 62.
             assert(hasEvexPrefix(code));
@@ -1201,7 +1246,7 @@ emitter::code_t emitter::AddRexXPrefix(instruction ins, code_t code)
 {
     if (UseEvexEncoding() && IsEvexEncodedInstruction(ins))
     {
-        if (TakesEvexPrefix(ins))
+        if (TakesEvexPrefix(ins) || hasEvexPrefix(code))
         {
             // X-bit is available in 4-byte EVEX prefix that starts with byte 62.
             assert(hasEvexPrefix(code));
@@ -1228,7 +1273,7 @@ emitter::code_t emitter::AddRexBPrefix(instruction ins, code_t code)
 {
     if (UseEvexEncoding() && IsEvexEncodedInstruction(ins))
     {
-        if (TakesEvexPrefix(ins) && codeEvexMigrationCheck(code)) // TODO-XArch-AVX512: Remove codeEvexMigrationCheck().
+        if (codeEvexMigrationCheck(code)) // TODO-XArch-AVX512: Remove codeEvexMigrationCheck().
         {
             // B-bit is available in 4-byte EVEX prefix that starts with byte 62.
             assert(hasEvexPrefix(code));
@@ -1972,50 +2017,7 @@ unsigned emitter::emitGetAdjustedSizeEvexAware(instruction ins, emitAttr attr, c
     // asked for EVEX.
     if (IsEvexEncodedInstruction(ins) && TakesEvexPrefix(ins))
     {
-        // EVEX prefix encodes some bytes of the opcode and as a result, overall size of the instruction reduces.
-        // Therefore, to estimate the size adding EVEX prefix size and size of instruction opcode bytes will always
-        // overstimate.
-        // Instead this routine will adjust the size of EVEX prefix based on the number of bytes of opcode it encodes so
-        // that
-        // instruction size estimate will be accurate.
-        // Basically this  will decrease the evexPrefixSize, so that opcodeSize + evexPrefixAdjustedSize will be the
-        // right size.
-        //
-        // rightOpcodeSize + evexPrefixSize
-        //  = (opcodeSize - ExtrabytesSize) + evexPrefixSize
-        //  = opcodeSize + (evexPrefixSize - ExtrabytesSize)
-        //  = opcodeSize + evexPrefixAdjustedSize
-
-        unsigned evexPrefixAdjustedSize = emitGetEvexPrefixSize(ins);
-        assert(evexPrefixAdjustedSize == 4);
-
-        // In this case, opcode will contains escape prefix at least one byte,
-        // simdPrefixAdjustedSize should be minus one.
-        evexPrefixAdjustedSize -= 1;
-
-        // Get the fourth byte in Opcode.
-        // If this byte is non-zero, then we should check whether the opcode contains SIMD prefix or not.
-        BYTE check = (code >> 24) & 0xFF;
-        if (check != 0)
-        {
-            // 3-byte opcode: with the bytes ordered as 0x2211RM33 or
-            // 4-byte opcode: with the bytes ordered as 0x22114433
-            // Simd prefix is at the first byte.
-            BYTE sizePrefix = (code >> 16) & 0xFF;
-            if (sizePrefix != 0 && isPrefix(sizePrefix))
-            {
-                evexPrefixAdjustedSize -= 1;
-            }
-
-            // If the opcode size is 4 bytes, then the second escape prefix is at fourth byte in opcode.
-            // But in this case the opcode has not counted R\M part.
-            // opcodeSize + evexPrefixAdjustedSize - ExtraEscapePrefixSize + ModR\MSize
-            //=opcodeSize + evexPrefixAdjustedSize -1 + 1
-            //=opcodeSize + evexPrefixAdjustedSize
-            // So although we may have second byte escape prefix, we won't decrease evexPrefixAdjustedSize.
-        }
-
-        adjustedSize = evexPrefixAdjustedSize;
+        adjustedSize = emitGetEvexPrefixAdjustedSize(ins, code);
     }
     else if (IsVexEncodedInstruction(ins))
     {
@@ -2087,6 +2089,87 @@ unsigned emitter::emitGetAdjustedSizeEvexAware(instruction ins, emitAttr attr, c
     return adjustedSize;
 }
 
+//------------------------------------------------------------------------
+// emitGetEvexPrefixAdjustedSize: Gets the size the EVEX prefix adds to an instruction once the
+// opcode bytes it encodes are accounted for.
+//
+// Arguments:
+//    ins   -- The instruction being emitted
+//    code  -- The current opcode and any known prefixes
+//
+// Returns:
+//    Size adjustment in bytes.
+//
+unsigned emitter::emitGetEvexPrefixAdjustedSize(instruction ins, code_t code)
+{
+    // EVEX prefix encodes some bytes of the opcode and as a result, overall size of the instruction reduces.
+    // Therefore, to estimate the size adding EVEX prefix size and size of instruction opcode bytes will always
+    // overstimate.
+    // Instead this routine will adjust the size of EVEX prefix based on the number of bytes of opcode it encodes so
+    // that
+    // instruction size estimate will be accurate.
+    // Basically this  will decrease the evexPrefixSize, so that opcodeSize + evexPrefixAdjustedSize will be the
+    // right size.
+    //
+    // rightOpcodeSize + evexPrefixSize
+    //  = (opcodeSize - ExtrabytesSize) + evexPrefixSize
+    //  = opcodeSize + (evexPrefixSize - ExtrabytesSize)
+    //  = opcodeSize + evexPrefixAdjustedSize
+
+    unsigned evexPrefixAdjustedSize = emitGetEvexPrefixSize(ins);
+    assert(evexPrefixAdjustedSize == 4);
+
+    // In this case, opcode will contains escape prefix at least one byte,
+    // simdPrefixAdjustedSize should be minus one.
+    evexPrefixAdjustedSize -= 1;
+
+    // Get the fourth byte in Opcode.
+    // If this byte is non-zero, then we should check whether the opcode contains SIMD prefix or not.
+    BYTE check = (code >> 24) & 0xFF;
+    if (check != 0)
+    {
+        // 3-byte opcode: with the bytes ordered as 0x2211RM33 or
+        // 4-byte opcode: with the bytes ordered as 0x22114433
+        // Simd prefix is at the first byte.
+        BYTE sizePrefix = (code >> 16) & 0xFF;
+        if (sizePrefix != 0 && isPrefix(sizePrefix))
+        {
+            evexPrefixAdjustedSize -= 1;
+        }
+
+        // If the opcode size is 4 bytes, then the second escape prefix is at fourth byte in opcode.
+        // But in this case the opcode has not counted R\M part.
+        // opcodeSize + evexPrefixAdjustedSize - ExtraEscapePrefixSize + ModR\MSize
+        //=opcodeSize + evexPrefixAdjustedSize -1 + 1
+        //=opcodeSize + evexPrefixAdjustedSize
+        // So although we may have second byte escape prefix, we won't decrease evexPrefixAdjustedSize.
+    }
+
+    return evexPrefixAdjustedSize;
+}
+
+//------------------------------------------------------------------------
+// emitGetAdjustedSizeEvexAware: Determines any size adjustment needed for the instruction described by `id`.
+// Unlike the instruction based overload, this accounts for the EVEX-only features recorded on the descriptor,
+// such as embedded broadcast, that force an EVEX prefix.
+//
+// Arguments:
+//    id    -- The instruction descriptor being emitted
+//    code  -- The current opcode and any known prefixes
+//
+// Returns:
+//    Updated size.
+//
+unsigned emitter::emitGetAdjustedSizeEvexAware(const instrDesc* id, code_t code)
+{
+    if (HasEmbeddedBroadcast(id))
+    {
+        return emitGetEvexPrefixAdjustedSize(id->idIns(), code);
+    }
+
+    return emitGetAdjustedSizeEvexAware(id->idIns(), id->idOpSize(), code);
+}
+
 //------------------------------------------------------------------------
 // emitGetAdjustedSize: Determines any size adjustment needed for a given instruction based on the current
 // configuration.
@@ -2632,6 +2715,41 @@ inline insTupleType insTupleTypeInfo(instruction ins)
     return insTupleTypeInfos[ins];
 }
 
+//------------------------------------------------------------------------
+// IsEmbeddedBroadcastCompatible: Checks if the EVEX form of the instruction can broadcast
+// a single memory element of the given size to all lanes of its memory operand.
+//
+// Arguments:
+//    ins      -- processor instruction to check
+//    elemSize -- size in bytes of the element to broadcast
+//
+// Return Value:
+//    true if `ins` supports embedded broadcast of `elemSize` elements.
+//
+bool emitter::IsEmbeddedBroadcastCompatible(instruction ins, unsigned elemSize) const
+{
+    if (!IsEvexEncodedInstruction(ins) || HasKMaskRegisterDest(ins) || !hasTupleTypeInfo(ins))
+    {
+        return false;
+    }
+
+    // Only the full and half vector tuple types have a broadcast form.
+    if ((insTupleTypeInfo(ins) & INS_TT_IS_BROADCAST) == 0)
+    {
+        return false;
+    }
+
+    switch (CodeGenInterface::instInfo[ins] & Input_Mask)
+    {
+        case Input_32Bit:
+            return elemSize == 4;
+        case Input_64Bit:
+            return elemSize == 8;
+        default:
+            return false;
+    }
+}
+
 // Return true if the instruction uses the SSE38 or SSE3A macro in instrsXArch.h.
 bool emitter::EncodedBySSE38orSSE3A(instruction ins)
 {
@@ -2755,9 +2873,9 @@ inline emitter::code_t emitter::insEncodeReg3456(instruction ins, regNumber reg,
     assert(regBits <= 0xF);
     if (UseEvexEncoding() && IsEvexEncodedInstruction(ins))
     {
-        if (TakesEvexPrefix(ins) && codeEvexMigrationCheck(code))
+        if (codeEvexMigrationCheck(code))
         {
-            assert(hasEvexPrefix(code) && TakesEvexPrefix(ins));
+            assert(hasEvexPrefix(code));
 
             // Shift count = 5-bytes of opcode + 0-2 bits for EVEX
             regBits <<= 43;
@@ -3299,7 +3417,7 @@ inline UNATIVE_OFFSET emitter::emitInsSizeSVCalcDisp(instrDesc* id, code_t code,
                 assert(emitComp->lvaTempsHaveLargerOffsetThanVars());
 
                 // Check whether we can use compressed displacement if EVEX.
-                if (TakesEvexPrefix(id->idIns()))
+                if (TakesEvexPrefix(id))
                 {
                     bool compressedFitsInByte = false;
                     TryEvexCompressDisp8Byte(id, ssize_t(offs), &compressedFitsInByte);
@@ -3343,7 +3461,7 @@ inline UNATIVE_OFFSET emitter::emitInsSizeSVCalcDisp(instrDesc* id, code_t code,
 #endif // !FEATURE_FIXED_OUT_ARGS
 
     bool useSmallEncoding = false;
-    if (TakesEvexPrefix(id->idIns()))
+    if (TakesEvexPrefix(id))
     {
         TryEvexCompressDisp8Byte(id, ssize_t(offs), &useSmallEncoding);
     }
@@ -3372,7 +3490,7 @@ inline UNATIVE_OFFSET emitter::emitInsSizeSV(instrDesc* id, code_t code, int var
     assert(id->idIns() != INS_invalid);
     instruction    ins      = id->idIns();
     emitAttr       attrSize = id->idOpSize();
-    UNATIVE_OFFSET prefix   = emitGetAdjustedSizeEvexAware(ins, attrSize, code);
+    UNATIVE_OFFSET prefix   = emitGetAdjustedSizeEvexAware(id, code);
 
     // REX prefix
     if (TakesRexWPrefix(ins, attrSize) || IsExtendedReg(id->idReg1(), attrSize) ||
@@ -3390,7 +3508,7 @@ inline UNATIVE_OFFSET emitter::emitInsSizeSV(instrDesc* id, code_t code, int var
     instruction    ins       = id->idIns();
     emitAttr       attrSize  = id->idOpSize();
     UNATIVE_OFFSET valSize   = EA_SIZE_IN_BYTES(attrSize);
-    UNATIVE_OFFSET prefix    = emitGetAdjustedSizeEvexAware(ins, attrSize, code);
+    UNATIVE_OFFSET prefix    = emitGetAdjustedSizeEvexAware(id, code);
     bool           valInByte = ((signed char)val == val) && (ins != INS_mov) && (ins != INS_test);
 
 #ifdef TARGET_AMD64
@@ -3496,7 +3614,7 @@ UNATIVE_OFFSET emitter::emitInsSizeAM(instrDesc* id, code_t code)
     }
     else
     {
-        if (TakesEvexPrefix(ins))
+        if (TakesEvexPrefix(id))
         {
             dsp = TryEvexCompressDisp8Byte(id, dsp, &dspInByte);
         }
@@ -3523,7 +3641,7 @@ UNATIVE_OFFSET emitter::emitInsSizeAM(instrDesc* id, code_t code)
         size = 2;
     }
 
-    size += emitGetAdjustedSizeEvexAware(ins, attrSize, code);
+    size += emitGetAdjustedSizeEvexAware(id, code);
 
     if (hasRexPrefix(code))
     {
@@ -3741,7 +3859,7 @@ inline UNATIVE_OFFSET emitter::emitInsSizeCV(instrDesc* id, code_t code)
     // can be reached via RIP-relative addressing.
     UNATIVE_OFFSET size = sizeof(INT32);
 
-    size += emitGetAdjustedSizeEvexAware(ins, attrSize, code);
+    size += emitGetAdjustedSizeEvexAware(id, code);
 
     bool includeRexPrefixSize = true;
 
@@ -6122,7 +6240,8 @@ void emitter::emitIns_R_S_I(instruction ins, emitAttr attr, regNumber reg1, int
     emitCurIGsize += sz;
 }
 
-void emitter::emitIns_R_R_A(instruction ins, emitAttr attr, regNumber reg1, regNumber reg2, GenTreeIndir* indir)
+void emitter::emitIns_R_R_A(
+    instruction ins, emitAttr attr, regNumber reg1, regNumber reg2, GenTreeIndir* indir, insOpts instOptions)
 {
     assert(IsAvx512OrPriorInstruction(ins));
     assert(IsThreeOperandAVXInstruction(ins));
@@ -6134,6 +6253,12 @@ void emitter::emitIns_R_R_A(instruction ins, emitAttr attr, regNumber reg1, regN
     id->idReg1(reg1);
     id->idReg2(reg2);
 
+    if (instOptions == INS_OPTS_EVEX_b)
+    {
+        assert(UseEvexEncoding() && IsEvexEncodedInstruction(ins));
+        id->idSetEvexbContext();
+    }
+
     emitHandleMemOp(indir, id, IF_RWR_RRD_ARD, ins);
 
     UNATIVE_OFFSET sz = emitInsSizeAM(id, insCodeRM(ins));
@@ -6233,8 +6358,13 @@ void emitter::emitIns_R_AR_R(instruction ins,
     emitCurIGsize += sz;
 }
 
-void emitter::emitIns_R_R_C(
-    instruction ins, emitAttr attr, regNumber reg1, regNumber reg2, CORINFO_FIELD_HANDLE fldHnd, int offs)
+void emitter::emitIns_R_R_C(instruction          ins,
+                            emitAttr             attr,
+                            regNumber            reg1,
+                            regNumber            reg2,
+                            CORINFO_FIELD_HANDLE fldHnd,
+                            int                  offs,
+                            insOpts              instOptions)
 {
     assert(IsAvx512OrPriorInstruction(ins));
     assert(IsThreeOperandAVXInstruction(ins));
@@ -6253,6 +6383,12 @@ void emitter::emitIns_R_R_C(
     id->idReg2(reg2);
     id->idAddr()->iiaFieldHnd = fldHnd;
 
+    if (instOptions == INS_OPTS_EVEX_b)
+    {
+        assert(UseEvexEncoding() && IsEvexEncodedInstruction(ins));
+        id->idSetEvexbContext();
+    }
+
     UNATIVE_OFFSET sz = emitInsSizeCV(id, insCodeRM(ins));
     id->idCodeSize(sz);
 
@@ -6284,7 +6420,8 @@ void emitter::emitIns_R_R_R(instruction ins, emitAttr attr, regNumber targetReg,
     emitCurIGsize += sz;
 }
 
-void emitter::emitIns_R_R_S(instruction ins, emitAttr attr, regNumber reg1, regNumber reg2, int varx, int offs)
+void emitter::emitIns_R_R_S(
+    instruction ins, emitAttr attr, regNumber reg1, regNumber reg2, int varx, int offs, insOpts instOptions)
 {
     assert(IsAvx512OrPriorInstruction(ins));
     assert(IsThreeOperandAVXInstruction(ins));
@@ -6297,6 +6434,12 @@ void emitter::emitIns_R_R_S(instruction ins, emitAttr attr, regNumber reg1, regN
     id->idReg2(reg2);
     id->idAddr()->iiaLclVar.initLclVarAddr(varx, offs);
 
+    if (instOptions == INS_OPTS_EVEX_b)
+    {
+        assert(UseEvexEncoding() && IsEvexEncodedInstruction(ins));
+        id->idSetEvexbContext();
+    }
+
 #ifdef DEBUG
     id->idDebugOnlyInfo()->idVarRefOffs = emitVarRefOffs;
 #endif
@@ -7600,21 +7743,27 @@ void emitter::emitIns_SIMD_R_R_I(instruction ins, emitAttr attr, regNumber targe
 //                     and that returns a value in register
 //
 // Arguments:
-//    ins       -- The instruction being emitted
-//    attr      -- The emit attribute
-//    targetReg -- The target register
-//    op1Reg    -- The register of the first operand
-//    indir     -- The GenTreeIndir used for the memory address
+//    ins         -- The instruction being emitted
+//    attr        -- The emit attribute
+//    targetReg   -- The target register
+//    op1Reg      -- The register of the first operand
+//    indir       -- The GenTreeIndir used for the memory address
+//    instOptions -- The options, such as embedded broadcast, the EVEX encoding should use
 //
-void emitter::emitIns_SIMD_R_R_A(
-    instruction ins, emitAttr attr, regNumber targetReg, regNumber op1Reg, GenTreeIndir* indir)
+void emitter::emitIns_SIMD_R_R_A(instruction   ins,
+                                 emitAttr      attr,
+                                 regNumber     targetReg,
+                                 regNumber     op1Reg,
+                                 GenTreeIndir* indir,
+                                 insOpts       instOptions)
 {
     if (UseSimdEncoding())
     {
-        emitIns_R_R_A(ins, attr, targetReg, op1Reg, indir);
+        emitIns_R_R_A(ins, attr, targetReg, op1Reg, indir, instOptions);
     }
     else
     {
+        assert(instOptions == INS_OPTS_NONE);
         emitIns_Mov(INS_movaps, attr, targetReg, op1Reg, /* canSkip */ true);
         emitIns_R_A(ins, attr, targetReg, indir);
     }
@@ -7651,22 +7800,29 @@ void emitter::emitIns_SIMD_R_R_AR(
 //                     and that returns a value in register
 //
 // Arguments:
-//    ins       -- The instruction being emitted
-//    attr      -- The emit attribute
-//    targetReg -- The target register
-//    op1Reg    -- The register of the first operand
-//    fldHnd    -- The CORINFO_FIELD_HANDLE used for the memory address
-//    offs      -- The offset added to the memory address from fldHnd
+//    ins         -- The instruction being emitted
+//    attr        -- The emit attribute
+//    targetReg   -- The target register
+//    op1Reg      -- The register of the first operand
+//    fldHnd      -- The CORINFO_FIELD_HANDLE used for the memory address
+//    offs        -- The offset added to the memory address from fldHnd
+//    instOptions -- The options, such as embedded broadcast, the EVEX encoding should use
 //
-void emitter::emitIns_SIMD_R_R_C(
-    instruction ins, emitAttr attr, regNumber targetReg, regNumber op1Reg, CORINFO_FIELD_HANDLE fldHnd, int offs)
+void emitter::emitIns_SIMD_R_R_C(instruction          ins,
+                                 emitAttr             attr,
+                                 regNumber            targetReg,
+                                 regNumber            op1Reg,
+                                 CORINFO_FIELD_HANDLE fldHnd,
+                                 int                  offs,
+                                 insOpts              instOptions)
 {
     if (UseSimdEncoding())
     {
-        emitIns_R_R_C(ins, attr, targetReg, op1Reg, fldHnd, offs);
+        emitIns_R_R_C(ins, attr, targetReg, op1Reg, fldHnd, offs, instOptions);
     }
     else
     {
+        assert(instOptions == INS_OPTS_NONE);
         emitIns_Mov(INS_movaps, attr, targetReg, op1Reg, /* canSkip */ true);
         emitIns_R_C(ins, attr, targetReg, fldHnd, offs);
     }
@@ -7713,22 +7869,24 @@ void emitter::emitIns_SIMD_R_R_R(
 //                     and that returns a value in register
 //
 // Arguments:
-//    ins       -- The instruction being emitted
-//    attr      -- The emit attribute
-//    targetReg -- The target register
-//    op1Reg    -- The register of the first operand
-//    varx      -- The variable index used for the memory address
-//    offs      -- The offset added to the memory address from varx
+//    ins         -- The instruction being emitted
+//    attr        -- The emit attribute
+//    targetReg   -- The target register
+//    op1Reg      -- The register of the first operand
+//    varx        -- The variable index used for the memory address
+//    offs        -- The offset added to the memory address from varx
+//    instOptions -- The options, such as embedded broadcast, the EVEX encoding should use
 //
 void emitter::emitIns_SIMD_R_R_S(
-    instruction ins, emitAttr attr, regNumber targetReg, regNumber op1Reg, int varx, int offs)
+    instruction ins, emitAttr attr, regNumber targetReg, regNumber op1Reg, int varx, int offs, insOpts instOptions)
 {
     if (UseSimdEncoding())
     {
-        emitIns_R_R_S(ins, attr, targetReg, op1Reg, varx, offs);
+        emitIns_R_R_S(ins, attr, targetReg, op1Reg, varx, offs, instOptions);
     }
     else
     {
+        assert(instOptions == INS_OPTS_NONE);
         emitIns_Mov(INS_movaps, attr, targetReg, op1Reg, /* canSkip */ true);
         emitIns_R_S(ins, attr, targetReg, varx, offs);
     }
@@ -10102,7 +10260,16 @@ void emitter::emitDispIns(
     else
     {
         attr = id->idOpSize();
-        sstr = codeGen->genSizeStr(emitGetMemOpSize(id));
+
+        if (HasEmbeddedBroadcast(id))
+        {
+            // The memory operand is the single element broadcast to every lane.
+            sstr = codeGen->genSizeStr(EA_ATTR(GetInputSizeInBytes(id)));
+        }
+        else
+        {
+            sstr = codeGen->genSizeStr(emitGetMemOpSize(id));
+        }
 
         if (ins == INS_lea)
         {
@@ -10299,6 +10466,10 @@ void emitter::emitDispIns(
         case IF_RWR_RRD_ARD:
             printf("%s, %s, %s", emitRegName(id->idReg1(), attr), emitRegName(id->idReg2(), attr), sstr);
             emitDispAddrMode(id);
+            if (HasEmbeddedBroadcast(id))
+            {
+                printf(" {1to%d}", (int)(EA_SIZE_IN_BYTES(attr) / GetInputSizeInBytes(id)));
+            }
             break;
 
         case IF_RWR_ARD_RRD:
@@ -10539,6 +10710,10 @@ void emitter::emitDispIns(
             printf("%s, %s, %s", emitRegName(id->idReg1(), attr), emitRegName(id->idReg2(), attr), sstr);
             emitDispFrameRef(id->idAddr()->iiaLclVar.lvaVarNum(), id->idAddr()->iiaLclVar.lvaOffset(),
                              id->idDebugOnlyInfo()->idVarRefOffs, asmfm);
+            if (HasEmbeddedBroadcast(id))
+            {
+                printf(" {1to%d}", (int)(EA_SIZE_IN_BYTES(attr) / GetInputSizeInBytes(id)));
+            }
             break;
 
         case IF_RWR_RRD_SRD_CNS:
@@ -10857,6 +11032,10 @@ void emitter::emitDispIns(
             printf("%s, %s, %s", emitRegName(id->idReg1(), attr), emitRegName(id->idReg2(), attr), sstr);
             offs = emitGetInsDsp(id);
             emitDispClsVar(id->idAddr()->iiaFieldHnd, offs, ID_INFO_DSP_RELOC);
+            if (HasEmbeddedBroadcast(id))
+            {
+                printf(" {1to%d}", (int)(EA_SIZE_IN_BYTES(attr) / GetInputSizeInBytes(id)));
+            }
             break;
 
         case IF_RWR_RRD_MRD_CNS:
@@ -11423,7 +11602,7 @@ BYTE* emitter::emitOutputAM(BYTE* dst, instrDesc* id, code_t code, CnsVal* addc)
     // Emit SIMD prefix if required
     // There are some callers who already add SIMD prefix and call this routine.
     // Therefore, add SIMD prefix is one is not already present.
-    code = AddSimdPrefixIfNeededAndNotPresent(ins, code, size);
+    code = AddSimdPrefixIfNeededAndNotPresent(id, code, size);
 
     // For this format, moves do not support a third operand, so we only need to handle the binary ops.
     if (TakesSimdPrefix(ins))
@@ -11647,7 +11826,7 @@ GOT_DSP:
     }
     else
     {
-        if (TakesEvexPrefix(ins))
+        if (TakesEvexPrefix(id))
         {
             dsp = TryEvexCompressDisp8Byte(id, dsp, &dspInByte);
         }
@@ -12284,7 +12463,7 @@ BYTE* emitter::emitOutputSV(BYTE* dst, instrDesc* id, code_t code, CnsVal* addc)
     // Add VEX or EVEX prefix if required.
     // There are some callers who already add prefix and call this routine.
     // Therefore, add VEX or EVEX prefix if one is not already present.
-    code = AddSimdPrefixIfNeededAndNotPresent(ins, code, size);
+    code = AddSimdPrefixIfNeededAndNotPresent(id, code, size);
 
     // Compute the REX prefix
     // TODO-XARCH-AVX512 : Update this check once all paths have EVEX support.
@@ -12451,9 +12630,8 @@ BYTE* emitter::emitOutputSV(BYTE* dst, instrDesc* id, code_t code, CnsVal* addc)
 
     // TODO-XARCH-AVX512 : working to wrap up all adjusted disp8 compression logic into the following
     // function, to which the remainder of the emitter logic should handle properly.
-    // TODO-XARCH-AVX512 : embedded broadcast might change this
     int dspAsByte = dsp;
-    if (TakesEvexPrefix(ins))
+    if (TakesEvexPrefix(id))
     {
         dspAsByte = int(TryEvexCompressDisp8Byte(id, ssize_t(dsp), &dspInByte));
     }
@@ -12506,8 +12684,7 @@ BYTE* emitter::emitOutputSV(BYTE* dst, instrDesc* id, code_t code, CnsVal* addc)
 
         // TODO-XARCH-AVX512 : working to wrap up all adjusted disp8 compression logic into the following
         // function, to which the remainder of the emitter logic should handle properly.
-        // TODO-XARCH-AVX512 : embedded broadcast might change this
-        if (TakesEvexPrefix(ins))
+        if (TakesEvexPrefix(id))
         {
             dspAsByte = int(TryEvexCompressDisp8Byte(id, ssize_t(dsp), &dspInByte));
         }
@@ -12733,7 +12910,7 @@ BYTE* emitter::emitOutputCV(BYTE* dst, instrDesc* id, code_t code, CnsVal* addc)
     // Compute VEX/EVEX prefix
     // Some of its callers already add EVEX/VEX prefix and then call this routine.
     // Therefore add EVEX/VEX prefix is not already present.
-    code = AddSimdPrefixIfNeededAndNotPresent(ins, code, size);
+    code = AddSimdPrefixIfNeededAndNotPresent(id, code, size);
 
     // Compute the REX prefix
     if (TakesRexWPrefix(ins, size) || (codeEvexMigrationCheck(code) && IsWEvexOpcodeExtension(ins)))
@@ -14709,7 +14886,7 @@ ssize_t emitter::GetInputSizeInBytes(instrDesc* id)
 //
 ssize_t emitter::TryEvexCompressDisp8Byte(instrDesc* id, ssize_t dsp, bool* dspInByte)
 {
-    assert(TakesEvexPrefix(id->idIns()));
+    assert(TakesEvexPrefix(id));
     insTupleType tt = insTupleTypeInfo(id->idIns());
     assert(hasTupleTypeInfo(id->idIns()));
 
@@ -14720,7 +14897,6 @@ ssize_t emitter::TryEvexCompressDisp8Byte(instrDesc* id, ssize_t dsp, bool* dspI
         return dsp;
     }
 
-    // Only handling non-broadcast forms right now
     ssize_t vectorLength = EA_SIZE_IN_BYTES(id->idOpSize());
 
     ssize_t inputSize = GetInputSizeInBytes(id);
@@ -15466,7 +15642,7 @@ size_t emitter::emitOutputInstr(insGroup* ig, instrDesc* id, BYTE** dp)
             }
             else
             {
-                code    = AddSimdPrefixIfNeeded(ins, code, size);
+                code    = AddSimdPrefixIfNeeded(id, code, size);
                 regcode = (insEncodeReg345(ins, id->idReg1(), size, &code) << 8);
                 dst     = emitOutputAM(dst, id, code | regcode);
             }
@@ -15662,7 +15838,7 @@ size_t emitter::emitOutputInstr(insGroup* ig, instrDesc* id, BYTE** dp)
             assert(IsVexOrEvexEncodedInstruction(ins));
 
             code = insCodeRM(ins);
-            code = AddSimdPrefixIfNeeded(ins, code, size);
+            code = AddSimdPrefixIfNeeded(id, code, size);
             code = insEncodeReg3456(ins, id->idReg2(), size,
                                     code); // encode source operand reg in 'vvvv' bits in 1's complement form
 
@@ -15827,7 +16003,7 @@ size_t emitter::emitOutputInstr(insGroup* ig, instrDesc* id, BYTE** dp)
             assert(IsVexOrEvexEncodedInstruction(ins));
 
             code = insCodeRM(ins);
-            code = AddSimdPrefixIfNeeded(ins, code, size);
+            code = AddSimdPrefixIfNeeded(id, code, size);
             code = insEncodeReg3456(ins, id->idReg2(), size,
                                     code); // encode source operand reg in 'vvvv' bits in 1's complement form
 
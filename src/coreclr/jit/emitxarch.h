@@ -73,6 +73,8 @@ unsigned emitGetEvexPrefixSize(instruction ins);
 unsigned emitGetPrefixSize(code_t code, bool includeRexPrefixSize);
 unsigned emitGetAdjustedSize(instruction ins, emitAttr attr, code_t code);
 unsigned emitGetAdjustedSizeEvexAware(instruction ins, emitAttr attr, code_t code);
+unsigned emitGetAdjustedSizeEvexAware(const instrDesc* id, code_t code);
+unsigned emitGetEvexPrefixAdjustedSize(instruction ins, code_t code);
 
 unsigned insEncodeReg012(instruction ins, regNumber reg, emitAttr size, code_t* code);
 unsigned insEncodeReg345(instruction ins, regNumber reg, emitAttr size, code_t* code);
@@ -101,6 +103,7 @@ static regNumber getSseShiftRegNumber(instruction ins);
 bool IsVexEncodedInstruction(instruction ins) const;
 bool IsEvexEncodedInstruction(instruction ins) const;
 bool IsVexOrEvexEncodedInstruction(instruction ins) const;
+bool IsEmbeddedBroadcastCompatible(instruction ins, unsigned elemSize) const;
 
 code_t insEncodeMIreg(instruction ins, regNumber reg, emitAttr size, code_t code);
 
@@ -486,6 +489,7 @@ bool UseSimdEncoding() const
 #define EVEX_PREFIX_CODE 0x6200000000000000ULL
 
 bool TakesEvexPrefix(instruction ins) const;
+bool TakesEvexPrefix(const instrDesc* id) const;
 
 //------------------------------------------------------------------------
 // hasEvexPrefix: Returns true if the instruction encoding already
@@ -502,6 +506,7 @@ bool hasEvexPrefix(code_t code)
     return (code & EVEX_PREFIX_MASK) == EVEX_PREFIX_CODE;
 }
 code_t AddEvexPrefix(instruction ins, code_t code, emitAttr attr);
+code_t AddEvexbBitIfNeeded(const instrDesc* id, code_t code);
 
 //------------------------------------------------------------------------
 // AddSimdPrefixIfNeeded: Add the correct SIMD prefix if required.
@@ -526,6 +531,32 @@ code_t AddSimdPrefixIfNeeded(instruction ins, code_t code, emitAttr size)
     return code;
 }
 
+//------------------------------------------------------------------------
+// AddSimdPrefixIfNeeded: Add the correct SIMD prefix if required, taking into
+// account the EVEX-only features (such as embedded broadcast) used by the instruction.
+//
+// Arguments:
+//    id - the instruction descriptor being encoded.
+//    code - opcode + prefixes bits at some stage of encoding.
+//    size - operand size
+//
+// Returns:
+//    code with prefix added.
+code_t AddSimdPrefixIfNeeded(const instrDesc* id, code_t code, emitAttr size)
+{
+    instruction ins = id->idIns();
+
+    if (TakesEvexPrefix(id))
+    {
+        code = AddEvexbBitIfNeeded(id, AddEvexPrefix(ins, code, size));
+    }
+    else if (TakesVexPrefix(ins))
+    {
+        code = AddVexPrefix(ins, code, size);
+    }
+    return code;
+}
+
 //------------------------------------------------------------------------
 // AddSimdPrefixIfNeeded: Add the correct SIMD prefix.
 // Check if the prefix already exists befpre adding.
@@ -551,6 +582,32 @@ code_t AddSimdPrefixIfNeededAndNotPresent(instruction ins, code_t code, emitAttr
     return code;
 }
 
+//------------------------------------------------------------------------
+// AddSimdPrefixIfNeededAndNotPresent: Same as above, but for an instruction descriptor.
+//
+// Arguments:
+//    id - the instruction descriptor being encoded.
+//    code - opcode + prefixes bits at some stage of encoding.
+//    size - operand size
+//
+// Returns:
+//    code with prefix added.
+//
+code_t AddSimdPrefixIfNeededAndNotPresent(const instrDesc* id, code_t code, emitAttr size)
+{
+    instruction ins = id->idIns();
+
+    if (TakesEvexPrefix(id))
+    {
+        code = !hasEvexPrefix(code) ? AddEvexbBitIfNeeded(id, AddEvexPrefix(ins, code, size)) : code;
+    }
+    else if (TakesVexPrefix(ins))
+    {
+        code = !hasVexPrefix(code) ? AddVexPrefix(ins, code, size) : code;
+    }
+    return code;
+}
+
 bool TakesSimdPrefix(instruction ins) const;
 
 //------------------------------------------------------------------------
@@ -770,7 +827,12 @@ void emitIns_R_C_I(instruction ins, emitAttr attr, regNumber reg1, CORINFO_FIELD
 
 void emitIns_R_S_I(instruction ins, emitAttr attr, regNumber reg1, int varx, int offs, int ival);
 
-void emitIns_R_R_A(instruction ins, emitAttr attr, regNumber reg1, regNumber reg2, GenTreeIndir* indir);
+void emitIns_R_R_A(instruction   ins,
+                   emitAttr      attr,
+                   regNumber     reg1,
+                   regNumber     reg2,
+                   GenTreeIndir* indir,
+                   insOpts       instOptions = INS_OPTS_NONE);
 
 void emitIns_R_R_AR(instruction ins, emitAttr attr, regNumber reg1, regNumber reg2, regNumber base, int offs);
 
@@ -783,10 +845,21 @@ void emitIns_R_AR_R(instruction ins,
                     int         scale,
                     int         offs);
 
-void emitIns_R_R_C(
-    instruction ins, emitAttr attr, regNumber reg1, regNumber reg2, CORINFO_FIELD_HANDLE fldHnd, int offs);
-
-void emitIns_R_R_S(instruction ins, emitAttr attr, regNumber reg1, regNumber reg2, int varx, int offs);
+void emitIns_R_R_C(instruction          ins,
+                   emitAttr             attr,
+                   regNumber            reg1,
+                   regNumber            reg2,
+                   CORINFO_FIELD_HANDLE fldHnd,
+                   int                  offs,
+                   insOpts              instOptions = INS_OPTS_NONE);
+
+void emitIns_R_R_S(instruction ins,
+                   emitAttr    attr,
+                   regNumber   reg1,
+                   regNumber   reg2,
+                   int         varx,
+                   int         offs,
+                   insOpts     instOptions = INS_OPTS_NONE);
 
 void emitIns_R_R_R(instruction ins, emitAttr attr, regNumber reg1, regNumber reg2, regNumber reg3);
 
@@ -886,13 +959,29 @@ void emitIns_AX_R(instruction ins, emitAttr attr, regNumber ireg, regNumber reg,
 
 void emitIns_SIMD_R_R_I(instruction ins, emitAttr attr, regNumber targetReg, regNumber op1Reg, int ival);
 
-void emitIns_SIMD_R_R_A(instruction ins, emitAttr attr, regNumber targetReg, regNumber op1Reg, GenTreeIndir* indir);
+void emitIns_SIMD_R_R_A(instruction   ins,
+                        emitAttr      attr,
+                        regNumber     targetReg,
+                        regNumber     op1Reg,
+                        GenTreeIndir* indir,
+                        insOpts       instOptions = INS_OPTS_NONE);
 void emitIns_SIMD_R_R_AR(
     instruction ins, emitAttr attr, regNumber targetReg, regNumber op1Reg, regNumber base, int offset);
-void emitIns_SIMD_R_R_C(
-    instruction ins, emitAttr attr, regNumber targetReg, regNumber op1Reg, CORINFO_FIELD_HANDLE fldHnd, int offs);
+void emitIns_SIMD_R_R_C(instruction          ins,
+                        emitAttr             attr,
+                        regNumber            targetReg,
+                        regNumber            op1Reg,
+                        CORINFO_FIELD_HANDLE fldHnd,
+                        int                  offs,
+                        insOpts              instOptions = INS_OPTS_NONE);
 void emitIns_SIMD_R_R_R(instruction ins, emitAttr attr, regNumber targetReg, regNumber op1Reg, regNumber op2Reg);
-void emitIns_SIMD_R_R_S(instruction ins, emitAttr attr, regNumber targetReg, regNumber op1Reg, int varx, int offs);
+void emitIns_SIMD_R_R_S(instruction ins,
+                        emitAttr    attr,
+                        regNumber   targetReg,
+                        regNumber   op1Reg,
+                        int         varx,
+                        int         offs,
+                        insOpts     instOptions = INS_OPTS_NONE);
 
 #ifdef FEATURE_HW_INTRINSICS
 void emitIns_SIMD_R_R_A_I(
@@ -1010,7 +1099,6 @@ inline bool emitIsUncondJump(instrDesc* jmp)
 
 //------------------------------------------------------------------------
 // HasEmbeddedBroadcast: Do we consider embedded broadcast while encoding.
-// TODO-XArch-AVX512: Add eventual check on the instrDesc
 //
 // Arguments:
 //    id - Instruction descriptor.
@@ -1018,9 +1106,9 @@ inline bool emitIsUncondJump(instrDesc* jmp)
 // Returns:
 //    `true` if the instruction does embedded broadcast.
 //
-inline bool HasEmbeddedBroadcast(instrDesc* id)
+inline bool HasEmbeddedBroadcast(const instrDesc* id) const
 {
-    return false;
+    return id->idIsEvexbContext();
 }
 
 #endif // TARGET_XARCH
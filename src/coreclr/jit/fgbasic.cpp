@@ -961,6 +961,12 @@ void Compiler::fgFindJumpTargets(const BYTE* codeAddr, IL_OFFSET codeSize, Fixed
 
         INDEBUG(ilInstsSet->bitVectSet((UINT)(codeAddr - codeBegp)));
 
+        // The cold part of a partial inline won't be imported, so keep it
+        // out of the inline policy's size and cost estimates.
+        const IL_OFFSET opcodeOffs = (IL_OFFSET)(codeAddr - codeBegp);
+        const bool      inColdPart = isInlining && (opcodeOffs >= impInlineInfo->partialInlineColdOffs) &&
+                                (opcodeOffs < impInlineInfo->partialInlineColdEndOffs);
+
         codeAddr += sizeof(__int8);
 
         if (!handled && preciseScan)
@@ -2103,7 +2109,7 @@ void Compiler::fgFindJumpTargets(const BYTE* codeAddr, IL_OFFSET codeSize, Fixed
     OBSERVE_OPCODE:
 
         // Note the opcode we just saw
-        if (makeInlineObservations)
+        if (makeInlineObservations && !inColdPart)
         {
             InlineObservation obs =
                 typeIsNormed ? InlineObservation::CALLEE_OPCODE_NORMED : InlineObservation::CALLEE_OPCODE;
@@ -2214,6 +2220,419 @@ void Compiler::fgFindJumpTargets(const BYTE* codeAddr, IL_OFFSET codeSize, Fixed
     }
 }
 
+//------------------------------------------------------------------------
+// fgFindPartialInlineSplit: see if only the hot part of an inlinee needs
+//   to be inlined.
+//
+// Arguments:
+//   codeAddr -- starting address of the inlinee's IL stream
+//   codeSize -- length of the IL stream
+//
+// Notes:
+//   Looks for inlinees that start with a block without side effects that
+//   ends in a conditional branch, where the profile says one side of the
+//   branch is never taken and that side can only be reached from the branch.
+//   That side is the "cold part": the inline policy doesn't look at it and
+//   impImportPartialInlineColdBlock imports it as a call to the inlinee.
+//   Since nothing observable happened before the branch, the inlinee is
+//   free to start over with the original arguments.
+//
+//   This is typical of fast path checks in front of a large slow path, which
+//   would otherwise be too big to inline as a whole.
+//
+//   On success, sets the cold part's IL range in impInlineInfo.
+//
+void Compiler::fgFindPartialInlineSplit(const BYTE* codeAddr, IL_OFFSET codeSize)
+{
+    assert(compIsForInlining());
+
+    if ((JitConfig.JitPartialInlining() == 0) || ((info.compFlags & CORINFO_FLG_FORCEINLINE) != 0) ||
+        opts.IsReadyToRun())
+    {
+        return;
+    }
+
+    // We need to be able to pass the original arguments back to the inlinee
+    // with a plain call, and to return what it returns.
+    //
+    if (varTypeIsStruct(info.compRetType) || info.compMethodInfo->args.hasTypeArg() ||
+        info.compMethodInfo->args.isVarArg())
+    {
+        return;
+    }
+
+    for (unsigned argNum = 0; argNum < impInlineInfo->argCnt; argNum++)
+    {
+        if (varTypeIsStruct(impInlineInfo->lclVarInfo[argNum].lclTypeInfo))
+        {
+            return;
+        }
+    }
+
+    // Decode the instruction at "offs", returning its opcode and the offset of
+    // the next instruction, or false if it runs past the end of the method.
+    //
+    auto decode = [=](IL_OFFSET offs, OPCODE* opcode, IL_OFFSET* nextOffs) {
+        OPCODE    op   = (OPCODE)getU1LittleEndian(codeAddr + offs);
+        IL_OFFSET next = offs + sizeof(__int8);
+
+        if (op == CEE_PREFIX1)
+        {
+            if (next >= codeSize)
+            {
+                return false;
+            }
+
+            op = (OPCODE)(256 + getU1LittleEndian(codeAddr + next));
+            next += sizeof(__int8);
+        }
+
+        if ((unsigned)op >= CEE_COUNT)
+        {
+            return false;
+        }
+
+        if (op == CEE_SWITCH)
+        {
+            if (next + sizeof(DWORD) > codeSize)
+            {
+                return false;
+            }
+
+            const unsigned jmpCnt = getU4LittleEndian(codeAddr + next);
+            if (jmpCnt > codeSize / sizeof(DWORD))
+            {
+                return false;
+            }
+
+            next += (1 + jmpCnt) * sizeof(DWORD);
+        }
+        else
+        {
+            next += opcodeSizes[op];
+        }
+
+        if (next > codeSize)
+        {
+            return false;
+        }
+
+        *opcode   = op;
+        *nextOffs = next;
+        return true;
+    };
+
+    // Walk the entry block, making sure it has no side effects and ends in a
+    // conditional branch with an empty stack.
+    //
+    IL_OFFSET offs       = 0;
+    IL_OFFSET nextOffs   = 0;
+    OPCODE    opcode     = CEE_NOP;
+    int       stackDepth = 0;
+    bool      foundCond  = false;
+
+    while (!foundCond && (offs < codeSize))
+    {
+        if (!decode(offs, &opcode, &nextOffs))
+        {
+            return;
+        }
+
+        switch (opcode)
+        {
+            case CEE_LDARG_0:
+            case CEE_LDARG_1:
+            case CEE_LDARG_2:
+            case CEE_LDARG_3:
+            case CEE_LDARG_S:
+            case CEE_LDARG:
+            case CEE_LDLOC_0:
+            case CEE_LDLOC_1:
+            case CEE_LDLOC_2:
+            case CEE_LDLOC_3:
+            case CEE_LDLOC_S:
+            case CEE_LDLOC:
+            case CEE_LDNULL:
+            case CEE_LDC_I4_M1:
+            case CEE_LDC_I4_0:
+            case CEE_LDC_I4_1:
+            case CEE_LDC_I4_2:
+            case CEE_LDC_I4_3:
+            case CEE_LDC_I4_4:
+            case CEE_LDC_I4_5:
+            case CEE_LDC_I4_6:
+            case CEE_LDC_I4_7:
+            case CEE_LDC_I4_8:
+            case CEE_LDC_I4_S:
+            case CEE_LDC_I4:
+            case CEE_LDC_I8:
+            case CEE_LDC_R4:
+            case CEE_LDC_R8:
+            case CEE_DUP:
+                stackDepth++;
+                break;
+
+            case CEE_STLOC_0:
+            case CEE_STLOC_1:
+            case CEE_STLOC_2:
+            case CEE_STLOC_3:
+            case CEE_STLOC_S:
+            case CEE_STLOC:
+            case CEE_POP:
+                stackDepth--;
+                break;
+
+            // These may throw, but then we never get to the cold part.
+            case CEE_LDFLD:
+            case CEE_LDLEN:
+            case CEE_NEG:
+            case CEE_NOT:
+            case CEE_CONV_I1:
+            case CEE_CONV_I2:
+            case CEE_CONV_I4:
+            case CEE_CONV_I8:
+            case CEE_CONV_R4:
+            case CEE_CONV_R8:
+            case CEE_CONV_U4:
+            case CEE_CONV_U8:
+            case CEE_CONV_R_UN:
+            case CEE_CONV_U2:
+            case CEE_CONV_U1:
+            case CEE_CONV_I:
+            case CEE_CONV_U:
+            case CEE_NOP:
+                break;
+
+            case CEE_ADD:
+            case CEE_SUB:
+            case CEE_MUL:
+            case CEE_DIV:
+            case CEE_DIV_UN:
+            case CEE_REM:
+            case CEE_REM_UN:
+            case CEE_AND:
+            case CEE_OR:
+            case CEE_XOR:
+            case CEE_SHL:
+            case CEE_SHR:
+            case CEE_SHR_UN:
+            case CEE_CEQ:
+            case CEE_CGT:
+            case CEE_CGT_UN:
+            case CEE_CLT:
+            case CEE_CLT_UN:
+                stackDepth--;
+                break;
+
+            case CEE_BRFALSE:
+            case CEE_BRFALSE_S:
+            case CEE_BRTRUE:
+            case CEE_BRTRUE_S:
+                stackDepth--;
+                foundCond = true;
+                break;
+
+            case CEE_BEQ:
+            case CEE_BEQ_S:
+            case CEE_BGE:
+            case CEE_BGE_S:
+            case CEE_BGE_UN:
+            case CEE_BGE_UN_S:
+            case CEE_BGT:
+            case CEE_BGT_S:
+            case CEE_BGT_UN:
+            case CEE_BGT_UN_S:
+            case CEE_BLE:
+            case CEE_BLE_S:
+            case CEE_BLE_UN:
+            case CEE_BLE_UN_S:
+            case CEE_BLT:
+            case CEE_BLT_S:
+            case CEE_BLT_UN:
+            case CEE_BLT_UN_S:
+            case CEE_BNE_UN:
+            case CEE_BNE_UN_S:
+                stackDepth -= 2;
+                foundCond = true;
+                break;
+
+            default:
+                return;
+        }
+
+        if (stackDepth < 0)
+        {
+            return;
+        }
+
+        if (!foundCond)
+        {
+            offs = nextOffs;
+        }
+    }
+
+    if (!foundCond || (stackDepth != 0))
+    {
+        return;
+    }
+
+    const signed jmpDist = (opcodeSizes[opcode] == 1) ? getI1LittleEndian(codeAddr + offs + 1)
+                                                      : getI4LittleEndian(codeAddr + offs + 1);
+    const IL_OFFSET prefixEnd = nextOffs;
+    const IL_OFFSET jmpAddr   = prefixEnd + jmpDist;
+
+    // Only forward branches; the branch target and the fall through are the
+    // two candidates for the cold part, and everything after the other one is hot.
+    //
+    if ((jmpAddr <= prefixEnd) || (jmpAddr >= codeSize))
+    {
+        return;
+    }
+
+    IL_OFFSET coldOffs;
+    IL_OFFSET coldEndOffs;
+    IL_OFFSET hotOffs;
+    IL_OFFSET hotEndOffs;
+
+    if (fgProfileEdgeIsNeverTaken(0, jmpAddr) && !fgProfileEdgeIsNeverTaken(0, prefixEnd))
+    {
+        coldOffs    = jmpAddr;
+        coldEndOffs = codeSize;
+        hotOffs     = prefixEnd;
+        hotEndOffs  = jmpAddr;
+    }
+    else if (fgProfileEdgeIsNeverTaken(0, prefixEnd) && !fgProfileEdgeIsNeverTaken(0, jmpAddr))
+    {
+        coldOffs    = prefixEnd;
+        coldEndOffs = jmpAddr;
+        hotOffs     = jmpAddr;
+        hotEndOffs  = codeSize;
+    }
+    else
+    {
+        return;
+    }
+
+    // Don't bother unless the cold part is a good deal bigger than the call
+    // that replaces it.
+    //
+    if ((coldEndOffs - coldOffs) <= InlineStrategy::ALWAYS_INLINE_SIZE)
+    {
+        return;
+    }
+
+    // Make sure the hot part can't get to the cold part or back to the entry
+    // block, which would mean the cold part could run after side effects.
+    //
+    bool foundColdStart = (coldOffs == prefixEnd);
+
+    for (offs = prefixEnd; offs < codeSize; offs = nextOffs)
+    {
+        if (!decode(offs, &opcode, &nextOffs))
+        {
+            return;
+        }
+
+        foundColdStart |= (offs == coldOffs);
+
+        if ((offs < hotOffs) || (offs >= hotEndOffs))
+        {
+            continue;
+        }
+
+        auto isHotTarget = [=](IL_OFFSET target) {
+            return (target >= hotOffs) && (target < hotEndOffs);
+        };
+
+        switch (opcode)
+        {
+            case CEE_SWITCH:
+            {
+                const unsigned  jmpCnt  = getU4LittleEndian(codeAddr + offs + 1);
+                const IL_OFFSET jmpBase = nextOffs;
+
+                for (unsigned i = 0; i < jmpCnt; i++)
+                {
+                    if (!isHotTarget(jmpBase + getI4LittleEndian(codeAddr + offs + 1 + (1 + i) * sizeof(DWORD))))
+                    {
+                        return;
+                    }
+                }
+
+                if (!isHotTarget(nextOffs))
+                {
+                    return;
+                }
+                break;
+            }
+
+            case CEE_BR:
+            case CEE_BR_S:
+            case CEE_BRFALSE:
+            case CEE_BRFALSE_S:
+            case CEE_BRTRUE:
+            case CEE_BRTRUE_S:
+            case CEE_BEQ:
+            case CEE_BEQ_S:
+            case CEE_BGE:
+            case CEE_BGE_S:
+            case CEE_BGE_UN:
+            case CEE_BGE_UN_S:
+            case CEE_BGT:
+            case CEE_BGT_S:
+            case CEE_BGT_UN:
+            case CEE_BGT_UN_S:
+            case CEE_BLE:
+            case CEE_BLE_S:
+            case CEE_BLE_UN:
+            case CEE_BLE_UN_S:
+            case CEE_BLT:
+            case CEE_BLT_S:
+            case CEE_BLT_UN:
+            case CEE_BLT_UN_S:
+            case CEE_BNE_UN:
+            case CEE_BNE_UN_S:
+            case CEE_LEAVE:
+            case CEE_LEAVE_S:
+            {
+                const signed dist = (opcodeSizes[opcode] == 1) ? getI1LittleEndian(codeAddr + offs + 1)
+                                                               : getI4LittleEndian(codeAddr + offs + 1);
+                if (!isHotTarget(nextOffs + dist))
+                {
+                    return;
+                }
+
+                if ((opcode == CEE_BR) || (opcode == CEE_BR_S) || (opcode == CEE_LEAVE) || (opcode == CEE_LEAVE_S))
+                {
+                    break;
+                }
+
+                FALLTHROUGH;
+            }
+
+            default:
+                // The last instruction of the hot part can't fall into the cold part.
+                //
+                if ((nextOffs == hotEndOffs) && (hotEndOffs != codeSize) && (opcode != CEE_RET) &&
+                    (opcode != CEE_THROW) && (opcode != CEE_RETHROW))
+                {
+                    return;
+                }
+                break;
+        }
+    }
+
+    if (!foundColdStart)
+    {
+        return;
+    }
+
+    JITDUMP("Partial inline: IL_%04x..IL_%04x is cold and will be a call to the inlinee\n", coldOffs, coldEndOffs);
+
+    impInlineInfo->partialInlineColdOffs    = coldOffs;
+    impInlineInfo->partialInlineColdEndOffs = coldEndOffs;
+}
+
 //------------------------------------------------------------------------
 // fgAdjustForAddressExposedOrWrittenThis: update var table for cases
 //   where the this pointer value can change.
@@ -2983,6 +3402,12 @@ void Compiler::fgFindBasicBlocks()
     // Allocate the 'jump target' bit vector
     FixedBitVect* jumpTarget = FixedBitVect::bitVectInit(info.compILCodeSize + 1, this);
 
+    // See if we only need to inline part of the method
+    if (compIsForInlining())
+    {
+        fgFindPartialInlineSplit(info.compCode, info.compILCodeSize);
+    }
+
     // Walk the instrs to find all jump targets
     fgFindJumpTargets(info.compCode, info.compILCodeSize, jumpTarget);
     if (compDonotInline())
@@ -3095,6 +3520,12 @@ void Compiler::fgFindBasicBlocks()
         compHndBBtabCount    = impInlineInfo->InlinerCompiler->compHndBBtabCount;
         info.compXcptnsCount = impInlineInfo->InlinerCompiler->info.compXcptnsCount;
 
+        // The call that replaces the cold part of a partial inline is one more return.
+        if (impInlineInfo->partialInlineColdOffs != BAD_IL_OFFSET)
+        {
+            retBlocks++;
+        }
+
         // Use a spill temp for the return value if there are multiple return blocks,
         // or if the inlinee has GC ref locals.
         if ((info.compRetNativeType != TYP_VOID) && ((retBlocks > 1) || impInlineInfo->HasGcRefLocals()))
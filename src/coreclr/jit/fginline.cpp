@@ -841,14 +841,16 @@ void Compiler::fgInvokeInlineeCompiler(GenTreeCall* call, InlineResult* inlineRe
     InlineInfo            inlineInfo{};
     CORINFO_METHOD_HANDLE fncHandle = call->gtCallMethHnd;
 
-    inlineInfo.fncHandle              = fncHandle;
-    inlineInfo.iciCall                = call;
-    inlineInfo.iciStmt                = fgMorphStmt;
-    inlineInfo.iciBlock               = compCurBB;
-    inlineInfo.thisDereferencedFirst  = false;
-    inlineInfo.retExprClassHnd        = nullptr;
-    inlineInfo.retExprClassHndIsExact = false;
-    inlineInfo.inlineResult           = inlineResult;
+    inlineInfo.fncHandle                = fncHandle;
+    inlineInfo.iciCall                  = call;
+    inlineInfo.iciStmt                  = fgMorphStmt;
+    inlineInfo.iciBlock                 = compCurBB;
+    inlineInfo.thisDereferencedFirst    = false;
+    inlineInfo.partialInlineColdOffs    = BAD_IL_OFFSET;
+    inlineInfo.partialInlineColdEndOffs = BAD_IL_OFFSET;
+    inlineInfo.retExprClassHnd          = nullptr;
+    inlineInfo.retExprClassHndIsExact   = false;
+    inlineInfo.inlineResult             = inlineResult;
 #ifdef FEATURE_SIMD
     inlineInfo.hasSIMDTypeArgLocalOrReturn = false;
 #endif // FEATURE_SIMD
@@ -5926,6 +5926,523 @@ bool Compiler::fgReorderBlocks(bool useProfile)
 #pragma warning(pop)
 #endif
 
+//-----------------------------------------------------------------------------
+// fgExtTSPScore: ext-TSP score of a single edge for a given layout.
+//
+// Arguments:
+//   weight         - weight of the edge
+//   srcEnd         - offset of the end of the source block
+//   dstStart       - offset of the start of the target block
+//   canFallThrough - true if the edge can be a fall through edge
+//
+// Returns:
+//   The full edge weight for a fall through, a fraction of it for a short
+//   jump, dropping off with the distance of the jump, and zero for a long jump.
+//
+static weight_t fgExtTSPScore(weight_t weight, unsigned srcEnd, unsigned dstStart, bool canFallThrough)
+{
+    // Jump distances (in code size estimate units) past which we give up on locality,
+    // and the fraction of the weight a short jump is worth, as in the ext-TSP model.
+    const unsigned forwardDistance  = 1024;
+    const unsigned backwardDistance = 640;
+    const weight_t jumpWeight       = 0.1;
+
+    if (dstStart == srcEnd)
+    {
+        return canFallThrough ? weight : (weight * jumpWeight);
+    }
+
+    if (dstStart > srcEnd)
+    {
+        const unsigned distance = dstStart - srcEnd;
+        return (distance < forwardDistance) ? (weight * jumpWeight * (1.0 - (weight_t)distance / forwardDistance))
+                                            : 0.0;
+    }
+
+    const unsigned distance = srcEnd - dstStart;
+    return (distance < backwardDistance) ? (weight * jumpWeight * (1.0 - (weight_t)distance / backwardDistance)) : 0.0;
+}
+
+//-----------------------------------------------------------------------------
+// fgReorderBlocksExtTSP: reorder the hot blocks of the method using the
+//   profile edge weights and an ext-TSP cost model.
+//
+// Returns:
+//   True if the block order changed.
+//
+// Notes:
+//   fgReorderBlocks looks at a block and its successors at a time. This instead
+//   looks for the order with the best ext-TSP score over all the edges: a fall
+//   through edge scores its full weight, and a short forward or backward jump
+//   scores a fraction of its weight that drops off with the distance of the jump,
+//   which accounts for i-cache locality.
+//
+//   Only runs of hot blocks outside of EH regions are reordered, and the first
+//   block of each run stays in place, so flow into the run from the rest of the
+//   method is not disturbed. This runs after fgReorderBlocks has moved the rarely
+//   run blocks out of the way.
+//
+bool Compiler::fgReorderBlocksExtTSP()
+{
+    if (!fgIsUsingProfileWeights() || !fgHaveValidEdgeWeights || (compCodeOpt() == SMALL_CODE))
+    {
+        return false;
+    }
+
+    if (!JitConfig.JitDoExtTSPLayout())
+    {
+        JITDUMP("Ext-TSP layout disabled\n");
+        return false;
+    }
+
+    // Small runs have few enough orders that fgReorderBlocks does fine, and the
+    // cost of finding the layout grows quadratically with the size of the run.
+    //
+    const unsigned minRunLength = 4;
+    const unsigned maxRunLength = 1024;
+
+    auto isCandidate = [](BasicBlock* block) {
+        return !block->hasTryIndex() && !block->hasHndIndex() && !block->isRunRarely() &&
+               !block->KindIs(BBJ_CALLFINALLY) && ((block->bbFlags & BBF_KEEP_BBJ_ALWAYS) == 0);
+    };
+
+    bool        changed = false;
+    BasicBlock* block   = fgFirstBB;
+
+    while (block != nullptr)
+    {
+        if (!isCandidate(block))
+        {
+            block = block->bbNext;
+            continue;
+        }
+
+        BasicBlock* runLast   = block;
+        unsigned    runLength = 1;
+
+        while ((runLast->bbNext != nullptr) && isCandidate(runLast->bbNext))
+        {
+            runLast = runLast->bbNext;
+            runLength++;
+        }
+
+        // Reordering may add jump blocks to the run, so find the next run first.
+        //
+        BasicBlock* const nextBlock = runLast->bbNext;
+
+        if ((runLength >= minRunLength) && (runLength <= maxRunLength))
+        {
+            changed |= fgReorderRunExtTSP(block, runLength);
+        }
+
+        block = nextBlock;
+    }
+
+#if DEBUG
+    if (changed)
+    {
+        if (verbose)
+        {
+            printf("\nAfter ext-TSP layout the BB graph is:");
+            fgDispBasicBlocks(verboseTrees);
+            printf("\n");
+        }
+
+        // Make sure that the predecessor lists are accurate
+        if (expensiveDebugCheckLevel >= 2)
+        {
+            fgDebugCheckBBlist();
+        }
+    }
+#endif // DEBUG
+
+    return changed;
+}
+
+//-----------------------------------------------------------------------------
+// fgReorderRunExtTSP: reorder a run of blocks for the best ext-TSP score.
+//
+// Arguments:
+//   runFirst  - first block of the run; it stays first
+//   runLength - number of blocks in the run
+//
+// Returns:
+//   True if the block order changed.
+//
+// Notes:
+//   The layout is built by greedily merging chains of blocks, starting with a
+//   chain per block, and each time picking the concatenation of two chains that
+//   adds the most to the score. This is the variant of the algorithm without
+//   chain splitting. The chains that are left are then ordered by how hot they
+//   are for their size.
+//
+bool Compiler::fgReorderRunExtTSP(BasicBlock* runFirst, unsigned runLength)
+{
+    const unsigned NONE  = UINT_MAX;
+    CompAllocator  alloc = getAllocator(CMK_BasicBlock);
+
+    BasicBlock** blocks    = new (alloc) BasicBlock*[runLength];
+    BasicBlock** fallThrus = new (alloc) BasicBlock*[runLength];
+    unsigned*    sizes     = new (alloc) unsigned[runLength];
+    unsigned*    indexOf   = new (alloc) unsigned[fgBBNumMax + 1];
+
+    for (unsigned i = 0; i <= fgBBNumMax; i++)
+    {
+        indexOf[i] = NONE;
+    }
+
+    BasicBlock* block = runFirst;
+    for (unsigned i = 0; i < runLength; i++, block = block->bbNext)
+    {
+        blocks[i]             = block;
+        fallThrus[i]          = block->bbFallsThrough() ? block->bbNext : nullptr;
+        sizes[i]              = max(1u, fgGetCodeEstimate(block));
+        indexOf[block->bbNum] = i;
+    }
+
+    // Gather the edges between blocks of the run, with lists of the edges out of
+    // and into each block.
+    //
+    struct Edge
+    {
+        unsigned src;
+        unsigned dst;
+        unsigned nextOut;
+        unsigned nextIn;
+        weight_t weight;
+        bool     canFallThrough;
+    };
+
+    ArrayStack<Edge> edges(alloc);
+    unsigned*        outHead = new (alloc) unsigned[runLength];
+    unsigned*        inHead  = new (alloc) unsigned[runLength];
+
+    for (unsigned i = 0; i < runLength; i++)
+    {
+        outHead[i] = NONE;
+        inHead[i]  = NONE;
+    }
+
+    for (unsigned i = 0; i < runLength; i++)
+    {
+        BasicBlock* const src = blocks[i];
+
+        for (BasicBlock* const succ : src->Succs(this))
+        {
+            const unsigned j = indexOf[succ->bbNum];
+
+            // Edges out of the run, and self loops, score the same for any order.
+            //
+            if ((j == NONE) || (j == i))
+            {
+                continue;
+            }
+
+            flowList* const flowEdge = fgGetPredForBlock(succ, src);
+            noway_assert(flowEdge != nullptr);
+            const weight_t weight = (flowEdge->edgeWeightMin() + flowEdge->edgeWeightMax()) / 2;
+
+            if (weight <= BB_ZERO_WEIGHT)
+            {
+                continue;
+            }
+
+            Edge edge;
+            edge.src            = i;
+            edge.dst            = j;
+            edge.nextOut        = outHead[i];
+            edge.nextIn         = inHead[j];
+            edge.weight         = weight;
+            edge.canFallThrough = !src->KindIs(BBJ_SWITCH);
+
+            outHead[i] = edges.Height();
+            inHead[j]  = edges.Height();
+            edges.Push(edge);
+        }
+    }
+
+    if (edges.Height() == 0)
+    {
+        return false;
+    }
+
+    // Per block: the chain it is in, its offset in the chain, and the next block
+    // in the chain. Per chain (named by the block it started with): the first and
+    // last block, and the size. The chain of the first block has to stay first.
+    //
+    unsigned* chainOf     = new (alloc) unsigned[runLength];
+    unsigned* offset      = new (alloc) unsigned[runLength];
+    unsigned* nextInChain = new (alloc) unsigned[runLength];
+    unsigned* chainHead   = new (alloc) unsigned[runLength];
+    unsigned* chainTail   = new (alloc) unsigned[runLength];
+    unsigned* chainSize   = new (alloc) unsigned[runLength];
+
+    for (unsigned i = 0; i < runLength; i++)
+    {
+        chainOf[i]     = i;
+        offset[i]      = 0;
+        nextInChain[i] = NONE;
+        chainHead[i]   = i;
+        chainTail[i]   = i;
+        chainSize[i]   = sizes[i];
+    }
+
+    // Scratch space for the scores of the edges between a chain X and each of the
+    // chains Y above it, when laid out as XY and as YX.
+    //
+    weight_t*            scoreXY   = new (alloc) weight_t[runLength];
+    weight_t*            scoreYX   = new (alloc) weight_t[runLength];
+    bool*                isTouched = new (alloc) bool[runLength];
+    ArrayStack<unsigned> touched(alloc);
+
+    for (unsigned i = 0; i < runLength; i++)
+    {
+        scoreXY[i]   = 0;
+        scoreYX[i]   = 0;
+        isTouched[i] = false;
+    }
+
+    while (true)
+    {
+        weight_t bestGain   = 0;
+        unsigned bestFirst  = NONE;
+        unsigned bestSecond = NONE;
+
+        for (unsigned x = 0; x < runLength; x++)
+        {
+            if (chainHead[x] == NONE)
+            {
+                continue;
+            }
+
+            // Concatenating chains doesn't change the score of the edges within
+            // either one, so the gain is just the score of the edges between them.
+            // Look at each pair of chains from the lower numbered one only.
+            //
+            for (unsigned m = chainHead[x]; m != NONE; m = nextInChain[m])
+            {
+                for (unsigned e = outHead[m]; e != NONE; e = edges.BottomRef(e).nextOut)
+                {
+                    const Edge&    edge = edges.BottomRef(e);
+                    const unsigned y    = chainOf[edge.dst];
+
+                    if (y <= x)
+                    {
+                        continue;
+                    }
+
+                    if (!isTouched[y])
+                    {
+                        isTouched[y] = true;
+                        touched.Push(y);
+                    }
+
+                    scoreXY[y] += fgExtTSPScore(edge.weight, offset[m] + sizes[m], chainSize[x] + offset[edge.dst],
+                                                edge.canFallThrough);
+                    scoreYX[y] += fgExtTSPScore(edge.weight, chainSize[y] + offset[m] + sizes[m], offset[edge.dst],
+                                                edge.canFallThrough);
+                }
+
+                for (unsigned e = inHead[m]; e != NONE; e = edges.BottomRef(e).nextIn)
+                {
+                    const Edge&    edge = edges.BottomRef(e);
+                    const unsigned y    = chainOf[edge.src];
+
+                    if (y <= x)
+                    {
+                        continue;
+                    }
+
+                    if (!isTouched[y])
+                    {
+                        isTouched[y] = true;
+                        touched.Push(y);
+                    }
+
+                    scoreXY[y] += fgExtTSPScore(edge.weight, chainSize[x] + offset[edge.src] + sizes[edge.src],
+                                                offset[m], edge.canFallThrough);
+                    scoreYX[y] += fgExtTSPScore(edge.weight, offset[edge.src] + sizes[edge.src],
+                                                chainSize[y] + offset[m], edge.canFallThrough);
+                }
+            }
+
+            while (!touched.Empty())
+            {
+                const unsigned y = touched.Pop();
+
+                if (scoreXY[y] > bestGain)
+                {
+                    bestGain   = scoreXY[y];
+                    bestFirst  = x;
+                    bestSecond = y;
+                }
+
+                // y is above x, so it can't be the chain that has to stay first.
+                //
+                if ((x != 0) && (scoreYX[y] > bestGain))
+                {
+                    bestGain   = scoreYX[y];
+                    bestFirst  = y;
+                    bestSecond = x;
+                }
+
+                scoreXY[y]   = 0;
+                scoreYX[y]   = 0;
+                isTouched[y] = false;
+            }
+        }
+
+        if (bestFirst == NONE)
+        {
+            break;
+        }
+
+        // Append the second chain to the first.
+        //
+        for (unsigned m = chainHead[bestSecond]; m != NONE; m = nextInChain[m])
+        {
+            chainOf[m] = bestFirst;
+            offset[m] += chainSize[bestFirst];
+        }
+
+        nextInChain[chainTail[bestFirst]] = chainHead[bestSecond];
+        chainTail[bestFirst]              = chainTail[bestSecond];
+        chainSize[bestFirst] += chainSize[bestSecond];
+        chainHead[bestSecond] = NONE;
+    }
+
+    // Lay out the first chain, then the rest by decreasing weight per unit of size.
+    //
+    unsigned* chains      = new (alloc) unsigned[runLength];
+    weight_t* chainWeight = new (alloc) weight_t[runLength];
+    unsigned  chainCount  = 0;
+
+    for (unsigned x = 0; x < runLength; x++)
+    {
+        if (chainHead[x] == NONE)
+        {
+            continue;
+        }
+
+        weight_t weight = 0;
+        for (unsigned m = chainHead[x]; m != NONE; m = nextInChain[m])
+        {
+            weight += blocks[m]->bbWeight * sizes[m];
+        }
+
+        chainWeight[x]       = weight / chainSize[x];
+        chains[chainCount++] = x;
+    }
+
+    assert((chainCount > 0) && (chains[0] == 0));
+    jitstd::sort(chains + 1, chains + chainCount, [chainWeight](unsigned a, unsigned b) {
+        return (chainWeight[a] > chainWeight[b]) || ((chainWeight[a] == chainWeight[b]) && (a < b));
+    });
+
+    unsigned* order    = new (alloc) unsigned[runLength];
+    unsigned  position = 0;
+
+    for (unsigned c = 0; c < chainCount; c++)
+    {
+        for (unsigned m = chainHead[chains[c]]; m != NONE; m = nextInChain[m])
+        {
+            order[position++] = m;
+        }
+    }
+
+    assert(position == runLength);
+
+    // Keep the current order unless the new one scores better.
+    //
+    unsigned* oldStart = new (alloc) unsigned[runLength];
+    unsigned* newStart = new (alloc) unsigned[runLength];
+    unsigned  oldPos   = 0;
+    unsigned  newPos   = 0;
+
+    for (unsigned i = 0; i < runLength; i++)
+    {
+        oldStart[i] = oldPos;
+        oldPos += sizes[i];
+        newStart[order[i]] = newPos;
+        newPos += sizes[order[i]];
+    }
+
+    weight_t oldScore = 0;
+    weight_t newScore = 0;
+
+    for (unsigned e = 0; e < (unsigned)edges.Height(); e++)
+    {
+        const Edge& edge = edges.BottomRef(e);
+        oldScore += fgExtTSPScore(edge.weight, oldStart[edge.src] + sizes[edge.src], oldStart[edge.dst],
+                                  edge.canFallThrough);
+        newScore += fgExtTSPScore(edge.weight, newStart[edge.src] + sizes[edge.src], newStart[edge.dst],
+                                  edge.canFallThrough);
+    }
+
+    JITDUMP("Ext-TSP layout of the %u block run starting at " FMT_BB ": score " FMT_WT " -> " FMT_WT "\n", runLength,
+            runFirst->bbNum, oldScore, newScore);
+
+    if (newScore <= oldScore)
+    {
+        return false;
+    }
+
+    // Move the blocks into the new order.
+    //
+    BasicBlock* insertAfter = runFirst;
+    for (unsigned i = 1; i < runLength; i++)
+    {
+        BasicBlock* const next = blocks[order[i]];
+
+        if (insertAfter->bbNext != next)
+        {
+            fgUnlinkBlock(next);
+            fgInsertBBafter(insertAfter, next);
+        }
+
+        insertAfter = next;
+    }
+
+    // Fix up the blocks that no longer fall through to their old successor. For
+    // conditional blocks now followed by their jump target, reverse the condition.
+    //
+    for (unsigned i = 0; i < runLength; i++)
+    {
+        BasicBlock* const src      = blocks[i];
+        BasicBlock* const fallThru = fallThrus[i];
+
+        if ((fallThru == nullptr) || (src->bbNext == fallThru))
+        {
+            continue;
+        }
+
+        if (src->KindIs(BBJ_COND) && (src->bbJumpDest == src->bbNext))
+        {
+            Statement* const condTestStmt = src->lastStmt();
+            GenTree* const   condTest     = condTestStmt->GetRootNode();
+
+            noway_assert(condTest->gtOper == GT_JTRUE);
+            condTest->AsOp()->gtOp1 = gtReverseCond(condTest->AsOp()->gtOp1);
+
+            // may need to rethread
+            //
+            if (fgStmtListThreaded)
+            {
+                JITDUMP("Rethreading " FMT_STMT "\n", condTestStmt->GetID());
+                gtSetStmtInfo(condTestStmt);
+                fgSetStmtSeq(condTestStmt);
+            }
+
+            src->bbJumpDest = fallThru;
+            continue;
+        }
+
+        fgConnectFallThrough(src, fallThru);
+    }
+
+    return true;
+}
+
 //-------------------------------------------------------------
 // fgUpdateFlowGraphPhase: run flow graph optimization as a
 //   phase, with no tail duplication
@@ -6609,6 +7126,12 @@ void Compiler::fgCompDominatedByExceptionalEntryBlocks()
 //   the canonical, and delete the copies in the cross jump blocks.
 //   Then retry merging on the canonical block.
 //
+//   With JitTailMergeReturns, return blocks are handled as if they were
+//   preds of a common exit: return blocks ending in the same return are
+//   cross jumped too, and then we retry merging on the canonical return
+//   block. Also, with profile data we never make a hot block take an
+//   extra jump by cross jumping it, so merging only shrinks the cold paths.
+//
 //   We set a mergeLimit to try and get most of the benefit while not
 //   incurring too much TP overhead. It's possible to make the merging
 //   more efficient and if so it might be worth revising this value.
@@ -6653,6 +7176,22 @@ PhaseStatus Compiler::fgTailMerge()
     ArrayStack<PredInfo>    matchedPredInfo(getAllocator(CMK_ArrayStack));
     ArrayStack<BasicBlock*> retryBlocks(getAllocator(CMK_ArrayStack));
 
+    // Would cross jumping predBlock add a jump to a hot path?
+    //
+    // A pred that jumps to block keeps the same number of jumps as long as
+    // the cross jump target falls through to block.
+    //
+    const bool mergeReturnsEnabled = (JitConfig.JitTailMergeReturns() != 0);
+
+    auto addsHotJump = [this, mergeReturnsEnabled](BasicBlock* predBlock, bool targetFallsThrough) -> bool {
+        if (!mergeReturnsEnabled || !fgIsUsingProfileWeights() || predBlock->isRunRarely())
+        {
+            return false;
+        }
+
+        return (predBlock->bbJumpKind != BBJ_ALWAYS) || !targetFallsThrough;
+    };
+
     // Try tail merging a block.
     // If return value is true, retry.
     // May also add to retryBlocks.
@@ -6849,6 +7388,25 @@ PhaseStatus Compiler::fgTailMerge()
                 }
             }
 
+            // Make sure some pred will actually get merged.
+            //
+            int numCrossJumps = 0;
+            for (int j = 0; j < matchedPredInfo.Height(); j++)
+            {
+                BasicBlock* const predBlock = matchedPredInfo.TopRef(j).m_block;
+                if ((predBlock != crossJumpVictim) && !addsHotJump(predBlock, haveFallThroughVictim))
+                {
+                    numCrossJumps++;
+                }
+            }
+
+            if (numCrossJumps == 0)
+            {
+                JITDUMP("Cross jumping would add jumps to hot preds, not merging\n");
+                i++;
+                continue;
+            }
+
             BasicBlock* crossJumpTarget = crossJumpVictim;
 
             // If this block requires splitting, then split it.
@@ -6874,7 +7432,7 @@ PhaseStatus Compiler::fgTailMerge()
                 BasicBlock* const predBlock = info.m_block;
                 Statement* const  stmt      = info.m_stmt;
 
-                if (predBlock == crossJumpVictim)
+                if ((predBlock == crossJumpVictim) || addsHotJump(predBlock, haveFallThroughVictim))
                 {
                     continue;
                 }
@@ -6945,6 +7503,148 @@ PhaseStatus Compiler::fgTailMerge()
         iterateTailMerge(retryBlocks.Pop());
     }
 
+    // Cross jump between return blocks that end with the same return.
+    //
+    auto tailMergeReturns = [&]() -> void {
+
+        predInfo.Reset();
+
+        for (BasicBlock* const block : Blocks())
+        {
+            if ((block->bbJumpKind != BBJ_RETURN) || (block == genReturnBB) || ((block->bbFlags & BBF_HAS_JMP) != 0))
+            {
+                continue;
+            }
+
+            Statement* const lastStmt = block->lastStmt();
+            if ((lastStmt == nullptr) || !lastStmt->GetRootNode()->OperIs(GT_RETURN))
+            {
+                continue;
+            }
+
+            predInfo.Emplace(block, lastStmt);
+        }
+
+        if ((predInfo.Height() < 2) || (predInfo.Height() > mergeLimit))
+        {
+            return;
+        }
+
+        for (int i = 0; i < predInfo.Height() - 1; i++)
+        {
+            PredInfo& baseInfo = predInfo.TopRef(i);
+            if (baseInfo.m_block->bbJumpKind != BBJ_RETURN)
+            {
+                // Already cross jumped.
+                continue;
+            }
+
+            matchedPredInfo.Reset();
+            matchedPredInfo.Emplace(baseInfo);
+
+            for (int j = i + 1; j < predInfo.Height(); j++)
+            {
+                PredInfo& otherInfo = predInfo.TopRef(j);
+                if ((otherInfo.m_block->bbJumpKind == BBJ_RETURN) &&
+                    BasicBlock::sameEHRegion(baseInfo.m_block, otherInfo.m_block) &&
+                    GenTree::Compare(baseInfo.m_stmt->GetRootNode(), otherInfo.m_stmt->GetRootNode()))
+                {
+                    matchedPredInfo.Emplace(otherInfo);
+                }
+            }
+
+            if (matchedPredInfo.Height() < 2)
+            {
+                continue;
+            }
+
+            // Pick the victim: preferably one that needs no split, and the
+            // hottest, since every other return will now take a jump.
+            //
+            BasicBlock* crossJumpVictim   = nullptr;
+            Statement*  crossJumpStmt     = nullptr;
+            bool        haveNoSplitVictim = false;
+
+            for (int j = 0; j < matchedPredInfo.Height(); j++)
+            {
+                PredInfo&  info      = matchedPredInfo.TopRef(j);
+                bool const isNoSplit = info.m_stmt == info.m_block->firstStmt();
+
+                if ((crossJumpVictim == nullptr) || (isNoSplit && !haveNoSplitVictim) ||
+                    ((isNoSplit == haveNoSplitVictim) && (info.m_block->bbWeight > crossJumpVictim->bbWeight)))
+                {
+                    crossJumpVictim   = info.m_block;
+                    crossJumpStmt     = info.m_stmt;
+                    haveNoSplitVictim = isNoSplit;
+                }
+            }
+
+            int numCrossJumps = 0;
+            for (int j = 0; j < matchedPredInfo.Height(); j++)
+            {
+                BasicBlock* const block = matchedPredInfo.TopRef(j).m_block;
+                if ((block != crossJumpVictim) && !addsHotJump(block, /* targetFallsThrough */ false))
+                {
+                    numCrossJumps++;
+                }
+            }
+
+            if (numCrossJumps == 0)
+            {
+                continue;
+            }
+
+            JITDUMP("A set of %d return blocks end with the same return\n", matchedPredInfo.Height());
+            JITDUMPEXEC(gtDispStmt(crossJumpStmt));
+
+            BasicBlock* crossJumpTarget = crossJumpVictim;
+            if (!haveNoSplitVictim)
+            {
+                crossJumpTarget = fgSplitBlockAfterStatement(crossJumpVictim, crossJumpStmt->GetPrevStmt());
+            }
+
+            JITDUMP("Will cross-jump to " FMT_BB "\n", crossJumpTarget->bbNum);
+
+            for (int j = 0; j < matchedPredInfo.Height(); j++)
+            {
+                PredInfo&         info  = matchedPredInfo.TopRef(j);
+                BasicBlock* const block = info.m_block;
+
+                if ((block == crossJumpVictim) || addsHotJump(block, /* targetFallsThrough */ false))
+                {
+                    continue;
+                }
+
+                fgUnlinkStmt(block, info.m_stmt);
+
+                block->bbJumpKind = BBJ_ALWAYS;
+                block->bbJumpDest = crossJumpTarget;
+                fgAddRefPred(crossJumpTarget, block);
+
+                // One fewer epilog.
+                //
+                assert(fgReturnCount > 0);
+                fgReturnCount--;
+            }
+
+            madeChanges = true;
+
+            // Now the cross jump target has preds that may share more statements.
+            //
+            retryBlocks.Push(crossJumpTarget);
+        }
+    };
+
+    if (mergeReturnsEnabled)
+    {
+        tailMergeReturns();
+
+        while (retryBlocks.Height() > 0)
+        {
+            iterateTailMerge(retryBlocks.Pop());
+        }
+    }
+
     // If we altered flow, reset fgModified. Given where we sit in the
     // phase list, flow-dependent side data hasn't been built yet, so
     // nothing needs invalidation.
@@ -285,6 +285,81 @@ bool Compiler::fgGetProfileWeightForBasicBlock(IL_OFFSET offset, weight_t* weigh
     return true;
 }
 
+//------------------------------------------------------------------------
+// fgProfileEdgeIsNeverTaken: check if profile data shows that flow from
+//   one IL offset to another never happened, even though the method ran
+//
+// Arguments:
+//   sourceOffset - IL offset of the source block
+//   targetOffset - IL offset of the target block
+//
+// Returns:
+//   true if so
+//
+// Notes:
+//   Runs before the flow graph exists, so works directly on the schema.
+//   With block counts the source must have run and the target must not
+//   have; with edge counts the edge must have been instrumented (so not on
+//   the spanning tree) and have a zero count while some other edge has not.
+//   Either way, false just means we can't tell.
+//
+bool Compiler::fgProfileEdgeIsNeverTaken(IL_OFFSET sourceOffset, IL_OFFSET targetOffset)
+{
+    if (!fgHaveProfileWeights() && (fgStressBBProf() == 0))
+    {
+        return false;
+    }
+
+    bool haveEdgeCount = false;
+    bool edgeTaken     = false;
+    bool methodRan     = false;
+
+    for (UINT32 i = 0; (fgStressBBProf() == 0) && (i < fgPgoSchemaCount); i++)
+    {
+        const ICorJitInfo::PgoInstrumentationSchema& entry = fgPgoSchema[i];
+
+        uint64_t count;
+        if (entry.InstrumentationKind == ICorJitInfo::PgoInstrumentationKind::EdgeIntCount)
+        {
+            count = *(uint32_t*)(fgPgoData + entry.Offset);
+        }
+        else if (entry.InstrumentationKind == ICorJitInfo::PgoInstrumentationKind::EdgeLongCount)
+        {
+            count = *(uint64_t*)(fgPgoData + entry.Offset);
+        }
+        else
+        {
+            continue;
+        }
+
+        methodRan |= (count > 0);
+
+        if (((IL_OFFSET)entry.ILOffset == sourceOffset) && ((IL_OFFSET)entry.Other == targetOffset))
+        {
+            haveEdgeCount = true;
+            edgeTaken     = (count > 0);
+        }
+    }
+
+    if (haveEdgeCount)
+    {
+        return !edgeTaken && methodRan;
+    }
+
+    // Fall back on block counts, if there are any.
+    //
+    weight_t sourceWeight = BB_ZERO_WEIGHT;
+    weight_t targetWeight = BB_ZERO_WEIGHT;
+
+    if (!fgGetProfileWeightForBasicBlock(sourceOffset, &sourceWeight) ||
+        !fgGetProfileWeightForBasicBlock(targetOffset, &targetWeight))
+    {
+        return false;
+    }
+
+    return (sourceWeight > BB_ZERO_WEIGHT) && (targetWeight == BB_ZERO_WEIGHT);
+}
+
 typedef jitstd::vector<ICorJitInfo::PgoInstrumentationSchema> Schema;
 
 //------------------------------------------------------------------------
@@ -341,8 +416,63 @@ public:
     {
         return m_modifiedFlow;
     }
+
+protected:
+    GenTree* CreateCounterIncrement(size_t addrOfCount, var_types countType);
 };
 
+//------------------------------------------------------------------------
+// Instrumentor::CreateCounterIncrement: create a tree that increments
+//   a block or edge count
+//
+// Arguments:
+//   addrOfCount -- address of the count
+//   countType -- type of the count, TYP_INT or TYP_LONG
+//
+// Returns:
+//   Tree incrementing the count
+//
+// Notes:
+//   With JitScalableProfiling counts are still incremented inline until they
+//   reach CORINFO_COUNTPROFILE_EXACT_LIMIT, and only then updated by a helper
+//   that switches to sampled increments, so that hot Tier0 code running on
+//   many cores doesn't contend on the counters. Prejitted code always uses
+//   the inline increment, since the helper isn't available there.
+//
+GenTree* Instrumentor::CreateCounterIncrement(size_t addrOfCount, var_types countType)
+{
+    assert((countType == TYP_INT) || (countType == TYP_LONG));
+
+    // Read count value
+    GenTree* valueNode = m_comp->gtNewIndOfIconHandleNode(countType, addrOfCount, GTF_ICON_BBC_PTR, false);
+
+    // Increment value by 1
+    GenTree* rhsNode = m_comp->gtNewOperNode(GT_ADD, countType, valueNode, m_comp->gtNewIconNode(1, countType));
+
+    // Write new count value
+    GenTree* lhsNode = m_comp->gtNewIndOfIconHandleNode(countType, addrOfCount, GTF_ICON_BBC_PTR, false);
+    GenTree* asgNode = m_comp->gtNewAssignNode(lhsNode, rhsNode);
+
+    if ((JitConfig.JitScalableProfiling() == 0) || m_comp->opts.jitFlags->IsSet(JitFlags::JIT_FLAG_PREJIT))
+    {
+        return asgNode;
+    }
+
+    // Compare count value against the limit of exact counts
+    //
+    GenTree* countNode = m_comp->gtNewIndOfIconHandleNode(countType, addrOfCount, GTF_ICON_BBC_PTR, false);
+    GenTree* relop     = m_comp->gtNewOperNode(GT_LT, TYP_INT, countNode,
+                                           m_comp->gtNewIconNode(CORINFO_COUNTPROFILE_EXACT_LIMIT, countType));
+    relop->gtFlags |= GTF_UNSIGNED;
+
+    const unsigned helper   = (countType == TYP_INT) ? CORINFO_HELP_COUNTPROFILE32 : CORINFO_HELP_COUNTPROFILE64;
+    GenTree* const addrNode = m_comp->gtNewIconHandleNode(addrOfCount, GTF_ICON_BBC_PTR);
+    GenTreeCall*   call     = m_comp->gtNewHelperCallNode(helper, TYP_VOID, addrNode);
+
+    GenTreeColon* colon = new (m_comp, GT_COLON) GenTreeColon(TYP_VOID, asgNode, call);
+    return m_comp->gtNewQmarkNode(TYP_VOID, relop, colon);
+}
+
 //------------------------------------------------------------------------
 // NonInstrumentor: instrumentor that does not instrument anything
 //
@@ -622,15 +752,7 @@ void BlockCountInstrumentor::Instrument(BasicBlock* block, Schema& schema, uint8
 
     var_types typ =
         entry.InstrumentationKind == ICorJitInfo::PgoInstrumentationKind::BasicBlockIntCount ? TYP_INT : TYP_LONG;
-    // Read Basic-Block count value
-    GenTree* valueNode = m_comp->gtNewIndOfIconHandleNode(typ, addrOfCurrentExecutionCount, GTF_ICON_BBC_PTR, false);
-
-    // Increment value by 1
-    GenTree* rhsNode = m_comp->gtNewOperNode(GT_ADD, typ, valueNode, m_comp->gtNewIconNode(1, typ));
-
-    // Write new Basic-Block count value
-    GenTree* lhsNode = m_comp->gtNewIndOfIconHandleNode(typ, addrOfCurrentExecutionCount, GTF_ICON_BBC_PTR, false);
-    GenTree* asgNode = m_comp->gtNewAssignNode(lhsNode, rhsNode);
+    GenTree* incNode = CreateCounterIncrement(addrOfCurrentExecutionCount, typ);
 
     if ((block->bbFlags & BBF_TAILCALL_SUCCESSOR) != 0)
     {
@@ -652,16 +774,16 @@ void BlockCountInstrumentor::Instrument(BasicBlock* block, Schema& schema, uint8
                 JITDUMP("Placing copy of block probe for " FMT_BB " in pred " FMT_BB "\n", block->bbNum, pred->bbNum);
                 if (!first)
                 {
-                    asgNode = m_comp->gtCloneExpr(asgNode);
+                    incNode = m_comp->gtCloneExpr(incNode);
                 }
-                m_comp->fgNewStmtAtBeg(pred, asgNode);
+                m_comp->fgNewStmtAtBeg(pred, incNode);
                 first = false;
             }
         }
     }
     else
     {
-        m_comp->fgNewStmtAtBeg(block, asgNode);
+        m_comp->fgNewStmtAtBeg(block, incNode);
     }
 
     m_instrCount++;
@@ -1420,18 +1542,9 @@ void EfficientEdgeCountInstrumentor::Instrument(BasicBlock* block, Schema& schem
 
         var_types typ =
             entry.InstrumentationKind == ICorJitInfo::PgoInstrumentationKind::EdgeIntCount ? TYP_INT : TYP_LONG;
-        // Read Basic-Block count value
-        GenTree* valueNode =
-            m_comp->gtNewIndOfIconHandleNode(typ, addrOfCurrentExecutionCount, GTF_ICON_BBC_PTR, false);
-
-        // Increment value by 1
-        GenTree* rhsNode = m_comp->gtNewOperNode(GT_ADD, typ, valueNode, m_comp->gtNewIconNode(1, typ));
-
-        // Write new Basic-Block count value
-        GenTree* lhsNode = m_comp->gtNewIndOfIconHandleNode(typ, addrOfCurrentExecutionCount, GTF_ICON_BBC_PTR, false);
-        GenTree* asgNode = m_comp->gtNewAssignNode(lhsNode, rhsNode);
+        GenTree* incNode = CreateCounterIncrement(addrOfCurrentExecutionCount, typ);
 
-        m_comp->fgNewStmtAtBeg(instrumentedBlock, asgNode);
+        m_comp->fgNewStmtAtBeg(instrumentedBlock, incNode);
 
         m_instrCount++;
     }
@@ -184,6 +184,127 @@ PhaseStatus Compiler::fgInsertGCPolls()
     return result;
 }
 
+//------------------------------------------------------------------------------
+// fgMarkNewObjectStores : Mark GC ref stores into objects that were just
+//                         allocated, with no GC safe point since the allocation.
+//
+// Notes:
+//    Objects allocated with the fast SOH helpers always start out in gen0, and
+//    an object in gen0 never needs its cards set. So as long as nothing can
+//    have promoted it, a store into it needs no card marking. Background GC
+//    also relies on the barrier to track written pages, but it can only ever
+//    see the object after a GC suspension or once the object is reachable
+//    from the heap, so we stop looking as soon as the object is used by
+//    anything other than the address of a store of ours.
+//
+//    We only look at the statements right after the allocation in the same
+//    block, and stop at the first one that may contain a call. That makes the
+//    marked stores safe in partially interruptible code only, so nothing is
+//    marked if the method is fully interruptible. Interruptibility is final by
+//    now except for StackLevelSetter, which can only make the method partially
+//    interruptible, so lowering, LSRA and codegen all see the same barriers.
+//
+//    The checked runtime's heap verification (HeapVerify) relies on every ref
+//    store going through the barrier to keep its shadow heap up to date, so
+//    the barriers are kept when it is on.
+//
+//    This must run after any transformations that would move code between
+//    the allocation and the stores.
+//
+// Returns:
+//    PhaseStatus indicating what, if anything, was changed.
+//
+PhaseStatus Compiler::fgMarkNewObjectStores()
+{
+    if (!opts.OptimizationEnabled() || (JitConfig.JitElideNewObjWriteBarriers() == 0) ||
+        (JitConfig.HeapVerify() != 0) || GetInterruptible())
+    {
+        return PhaseStatus::MODIFIED_NOTHING;
+    }
+
+    // Is this statement an allocation of a (gen0) object into an unexposed local?
+    //
+    auto getNewObjectLocal = [this](Statement* stmt) {
+        GenTree* const root = stmt->GetRootNode();
+        if (!root->OperIs(GT_ASG) || !root->gtGetOp1()->OperIs(GT_LCL_VAR) || !root->gtGetOp2()->IsCall())
+        {
+            return BAD_VAR_NUM;
+        }
+
+        GenTreeCall* const call = root->gtGetOp2()->AsCall();
+        if (!call->IsHelperCall(this, CORINFO_HELP_NEWSFAST) && !call->IsHelperCall(this, CORINFO_HELP_NEWSFAST_ALIGN8))
+        {
+            return BAD_VAR_NUM;
+        }
+
+        unsigned const   lclNum = root->gtGetOp1()->AsLclVar()->GetLclNum();
+        LclVarDsc* const varDsc = lvaGetDesc(lclNum);
+        if (!varDsc->TypeIs(TYP_REF) || varDsc->IsAddressExposed())
+        {
+            return BAD_VAR_NUM;
+        }
+
+        return lclNum;
+    };
+
+    // Is this the address of a field of the given local's object?
+    //
+    auto isFieldOfLocal = [](GenTree* addr, unsigned lclNum) {
+        if (addr->OperIs(GT_ADD) && addr->gtGetOp2()->IsCnsIntOrI())
+        {
+            addr = addr->gtGetOp1();
+        }
+
+        return addr->OperIs(GT_LCL_VAR) && (addr->AsLclVar()->GetLclNum() == lclNum);
+    };
+
+    bool changed = false;
+
+    for (BasicBlock* const block : Blocks())
+    {
+        for (Statement* const stmt : block->Statements())
+        {
+            unsigned const lclNum = getNewObjectLocal(stmt);
+            if (lclNum == BAD_VAR_NUM)
+            {
+                continue;
+            }
+
+            for (Statement* next = stmt->GetNextStmt(); next != nullptr; next = next->GetNextStmt())
+            {
+                GenTree* const root = next->GetRootNode();
+                if (!root->OperIs(GT_ASG) || varTypeIsStruct(root) || ((root->gtFlags & GTF_CALL) != 0))
+                {
+                    break;
+                }
+
+                GenTree* const dst = root->gtGetOp1();
+                if (gtHasRef(root->gtGetOp2(), lclNum))
+                {
+                    break;
+                }
+
+                if (dst->OperIs(GT_IND) && isFieldOfLocal(dst->AsIndir()->Addr(), lclNum))
+                {
+                    if (dst->TypeIs(TYP_REF))
+                    {
+                        JITDUMP("Store [%06u] in " FMT_STMT " is to a new object in V%02u\n", dspTreeID(dst),
+                                next->GetID(), lclNum);
+                        dst->gtFlags |= GTF_IND_TGT_NEW_OBJ;
+                        changed = true;
+                    }
+                }
+                else if (gtHasRef(dst, lclNum))
+                {
+                    break;
+                }
+            }
+        }
+    }
+
+    return changed ? PhaseStatus::MODIFIED_EVERYTHING : PhaseStatus::MODIFIED_NOTHING;
+}
+
 //------------------------------------------------------------------------------
 // fgCreateGCPoll : Insert a GC poll of the specified type for the given basic block.
 //
@@ -795,8 +916,9 @@ GenTreeLclVar* Compiler::fgIsIndirOfAddrOfLocal(GenTree* tree)
 
 GenTreeCall* Compiler::fgGetStaticsCCtorHelper(CORINFO_CLASS_HANDLE cls, CorInfoHelpFunc helper)
 {
-    bool         bNeedClassID = true;
-    GenTreeFlags callFlags    = GTF_EMPTY;
+    bool         bNeedClassID          = true;
+    bool         bNeedStaticBlockIndex = false;
+    GenTreeFlags callFlags             = GTF_EMPTY;
 
     var_types type = TYP_BYREF;
 
@@ -804,6 +926,17 @@ GenTreeCall* Compiler::fgGetStaticsCCtorHelper(CORINFO_CLASS_HANDLE cls, CorInfo
     // We need the return type.
     switch (helper)
     {
+        case CORINFO_HELP_GETSHARED_GCTHREADSTATIC_BASE_NOCTOR_OPTIMIZED:
+            bNeedStaticBlockIndex = true;
+            callFlags |= GTF_CALL_HOISTABLE;
+            break;
+
+        case CORINFO_HELP_GETSHARED_NONGCTHREADSTATIC_BASE_NOCTOR_OPTIMIZED:
+            bNeedStaticBlockIndex = true;
+            callFlags |= GTF_CALL_HOISTABLE;
+            type = TYP_I_IMPL;
+            break;
+
         case CORINFO_HELP_GETSHARED_GCSTATIC_BASE_NOCTOR:
             bNeedClassID = false;
             FALLTHROUGH;
@@ -840,6 +973,17 @@ GenTreeCall* Compiler::fgGetStaticsCCtorHelper(CORINFO_CLASS_HANDLE cls, CorInfo
             break;
     }
 
+    if (bNeedStaticBlockIndex)
+    {
+        // The helper looks the base up in the thread's table of thread static bases, it needs neither the module
+        // nor the class ID
+        uint32_t staticBlockIndex = info.compCompHnd->getThreadLocalStaticBlockIndex(cls);
+
+        GenTreeCall* result = gtNewHelperCallNode(helper, type, gtNewIconNode(staticBlockIndex, TYP_INT));
+        result->gtFlags |= callFlags;
+        return result;
+    }
+
     GenTree* opModuleIDArg;
     GenTree* opClassIDArg;
 
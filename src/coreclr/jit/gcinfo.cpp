@@ -259,6 +259,13 @@ GCInfo::WriteBarrierForm GCInfo::gcIsWriteBarrierCandidate(GenTreeStoreInd* stor
         return WBF_NoBarrier;
     }
 
+    // Stores into an object that is still in gen0 don't need cards. fgMarkNewObjectStores
+    // only marks them in partially interruptible methods.
+    if ((store->gtFlags & GTF_IND_TGT_NEW_OBJ) != 0)
+    {
+        return WBF_NoBarrier;
+    }
+
     WriteBarrierForm wbf = gcWriteBarrierFormFromTargetAddress(store->Addr());
 
     if (wbf == WBF_BarrierUnknown)
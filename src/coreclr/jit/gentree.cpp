@@ -15687,7 +15687,7 @@ GenTree* Compiler::gtNewTempAssign(
             ok = true;
         }
         // - TYP_BYREF = TYP_REF when object stack allocation is enabled
-        else if (JitConfig.JitObjectStackAllocation() && (dstTyp == TYP_BYREF) && (valTyp == TYP_REF))
+        else if (compObjectStackAllocation() && (dstTyp == TYP_BYREF) && (valTyp == TYP_REF))
         {
             ok = true;
         }
@@ -19051,6 +19051,13 @@ bool GenTree::isContainableHWIntrinsic() const
             return true;
         }
 
+        case NI_AVX2_BroadcastScalarToVector128:
+        case NI_AVX2_BroadcastScalarToVector256:
+        {
+            // These HWIntrinsic operations are contained as an EVEX embedded broadcast operand
+            return true;
+        }
+
         default:
         {
             return false;
@@ -23689,6 +23696,28 @@ bool GenTreeHWIntrinsic::OperIsMemoryLoadOrStore() const
     return OperIsMemoryLoad() || OperIsMemoryStore();
 }
 
+#ifdef TARGET_XARCH
+//------------------------------------------------------------------------
+// OperIsBroadcastScalar: Does this HWI node broadcast a single element to all lanes?
+//
+// Return Value:
+//    Whether "this" is a BroadcastScalarToVector* intrinsic. When contained, such
+//    a node is emitted as the EVEX embedded broadcast operand of its user.
+//
+bool GenTreeHWIntrinsic::OperIsBroadcastScalar() const
+{
+    switch (GetHWIntrinsicId())
+    {
+        case NI_AVX2_BroadcastScalarToVector128:
+        case NI_AVX2_BroadcastScalarToVector256:
+            return true;
+
+        default:
+            return false;
+    }
+}
+#endif // TARGET_XARCH
+
 //------------------------------------------------------------------------
 // GetLayout: Get the layout for this TYP_STRUCT HWI node.
 //
@@ -6521,6 +6521,15 @@ void Compiler::impImportBlockCode(BasicBlock* block)
 
 #endif // FEATURE_ON_STACK_REPLACEMENT
 
+    // The cold part of a partial inline just calls the inlinee.
+    //
+    if (compIsForInlining() && (block->bbCodeOffs == impInlineInfo->partialInlineColdOffs) &&
+        (verCurrentState.esStackDepth == 0))
+    {
+        impImportPartialInlineColdBlock(block);
+        return;
+    }
+
     /* Walk the opcodes that comprise the basic block */
 
     const BYTE* codeAddr = info.compCode + block->bbCodeOffs;
@@ -13909,6 +13918,60 @@ unsigned Compiler::impInlineFetchLocal(unsigned lclNum DEBUGARG(const char* reas
 //    This method will side effect inlArgInfo. It should only be called
 //    for actual uses of the argument in the inlinee.
 
+//------------------------------------------------------------------------
+// impImportPartialInlineColdBlock: import the start of the cold part of a
+//   partial inline as a call to the inlinee itself
+//
+// Arguments:
+//    block - first block of the cold part
+//
+// Notes:
+//    fgFindPartialInlineSplit made sure the cold part can only be reached
+//    from an entry block with no side effects, so the inlinee can start over
+//    with the original arguments. Block becomes a return, so the rest of the
+//    cold part is never imported.
+//
+void Compiler::impImportPartialInlineColdBlock(BasicBlock* block)
+{
+    assert(compIsForInlining());
+    assert(verCurrentState.esStackDepth == 0);
+
+    JITDUMP("\n" FMT_BB " starts the cold part of a partial inline -- importing as a call to the inlinee\n",
+            block->bbNum);
+
+    impCurStmtOffsSet(block->bbCodeOffs);
+
+    GenTreeCall* const call = gtNewCallNode(CT_USER_FUNC, info.compMethodHnd, info.compRetType, impCurStmtDI);
+
+    for (unsigned argNum = 0; argNum < impInlineInfo->argCnt; argNum++)
+    {
+        GenTree* const argNode = impInlineFetchArg(argNum, impInlineInfo->inlArgInfo, impInlineInfo->lclVarInfo);
+        NewCallArg     arg     = NewCallArg::Primitive(argNode, impInlineInfo->lclVarInfo[argNum].lclTypeInfo);
+
+        if (impInlineInfo->inlArgInfo[argNum].argIsThis)
+        {
+            arg = arg.WellKnown(WellKnownArg::ThisPointer);
+        }
+
+        call->gtArgs.PushBack(this, arg);
+    }
+
+    block->bbJumpKind = BBJ_RETURN;
+
+    if (info.compRetType == TYP_VOID)
+    {
+        impAppendTree(call, CHECK_SPILL_NONE, impCurStmtDI);
+    }
+    else
+    {
+        CORINFO_SIG_INFO* const sig = &info.compMethodInfo->args;
+        impPushOnStack(call, verMakeTypeInfo(sig->retType, sig->retTypeClass));
+    }
+
+    OPCODE opcode = CEE_RET;
+    impReturnInstruction(0, opcode);
+}
+
 GenTree* Compiler::impInlineFetchArg(unsigned lclNum, InlArgInfo* inlArgInfo, InlLclVarInfo* lclVarInfo)
 {
     // Cache the relevant arg and lcl info for this argument.
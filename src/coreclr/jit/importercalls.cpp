@@ -4624,26 +4624,30 @@ void Compiler::addFatPointerCandidate(GenTreeCall* call)
 }
 
 //------------------------------------------------------------------------
-// pickGDV: Use profile information to pick a GDV candidate for a call site.
+// pickGDV: Use profile information to pick GDV candidates for a call site.
 //
 // Arguments:
-//    call        - the call
-//    ilOffset    - exact IL offset of the call
-//    isInterface - whether or not the call target is defined on an interface
-//    classGuess  - [out] the class to guess for (mutually exclusive with methodGuess)
-//    methodGuess - [out] the method to guess for (mutually exclusive with classGuess)
-//    likelihood  - [out] an estimate of the likelihood that the guess will succeed
+//    call            - the call
+//    ilOffset        - exact IL offset of the call
+//    isInterface     - whether or not the call target is defined on an interface
+//    classGuesses    - [out] the classes to guess for (a guess is for either a class or a method)
+//    methodGuesses   - [out] the methods to guess for
+//    likelihoods     - [out] an estimate of the likelihood that each guess will succeed
+//    numberOfGuesses - [out] the number of guesses, at most MAX_GDV_TYPE_CHECKS
+//
+// Notes:
+//    Guesses are returned most likely first. Only class guesses are chained;
+//    a method guess is always the only guess.
 //
 void Compiler::pickGDV(GenTreeCall*           call,
                        IL_OFFSET              ilOffset,
                        bool                   isInterface,
-                       CORINFO_CLASS_HANDLE*  classGuess,
-                       CORINFO_METHOD_HANDLE* methodGuess,
-                       unsigned*              likelihood)
+                       CORINFO_CLASS_HANDLE*  classGuesses,
+                       CORINFO_METHOD_HANDLE* methodGuesses,
+                       unsigned*              likelihoods,
+                       unsigned*              numberOfGuesses)
 {
-    *classGuess  = NO_CLASS_HANDLE;
-    *methodGuess = NO_METHOD_HANDLE;
-    *likelihood  = 0;
+    *numberOfGuesses = 0;
 
     const int               maxLikelyClasses = 32;
     LikelyClassMethodRecord likelyClasses[maxLikelyClasses];
@@ -4743,18 +4747,20 @@ void Compiler::pickGDV(GenTreeCall*           call,
         CLRRandom* const random =
             impInlineRoot()->m_inlineStrategy->GetRandom(JitConfig.JitRandomGuardedDevirtualization());
         unsigned index = static_cast<unsigned>(random->Next(static_cast<int>(numberOfClasses + numberOfMethods)));
+        *numberOfGuesses = 1;
+        *likelihoods     = 100;
         if (index < numberOfClasses)
         {
-            *classGuess = (CORINFO_CLASS_HANDLE)likelyClasses[index].handle;
-            *likelihood = 100;
-            JITDUMP("Picked random class for GDV: %p (%s)\n", *classGuess, eeGetClassName(*classGuess));
+            *classGuesses  = (CORINFO_CLASS_HANDLE)likelyClasses[index].handle;
+            *methodGuesses = NO_METHOD_HANDLE;
+            JITDUMP("Picked random class for GDV: %p (%s)\n", *classGuesses, eeGetClassName(*classGuesses));
             return;
         }
         else
         {
-            *methodGuess = (CORINFO_METHOD_HANDLE)likelyMethods[index - numberOfClasses].handle;
-            *likelihood  = 100;
-            JITDUMP("Picked random method for GDV: %p (%s)\n", *methodGuess, eeGetMethodFullName(*methodGuess));
+            *classGuesses  = NO_CLASS_HANDLE;
+            *methodGuesses = (CORINFO_METHOD_HANDLE)likelyMethods[index - numberOfClasses].handle;
+            JITDUMP("Picked random method for GDV: %p (%s)\n", *methodGuesses, eeGetMethodFullName(*methodGuesses));
             return;
         }
     }
@@ -4763,11 +4769,36 @@ void Compiler::pickGDV(GenTreeCall*           call,
     // Prefer class guess as it is cheaper
     if (numberOfClasses > 0)
     {
-        unsigned likelihoodThreshold = isInterface ? 25 : 30;
-        if (likelyClasses[0].likelihood >= likelihoodThreshold)
+        // We may chain type tests for several of the likely classes. Each guess
+        // after the first has to be likely enough to pay for its test, and all
+        // the guesses together have to be likely enough to pay for the expansion.
+        //
+        const unsigned maxTypeChecks =
+            max(1u, min((unsigned)JitConfig.JitGuardedDevirtualizationMaxTypeChecks(), MAX_GDV_TYPE_CHECKS));
+        const unsigned extraGuessThreshold = (unsigned)JitConfig.JitGuardedDevirtualizationExtraGuessLikelihood();
+        unsigned       likelihoodThreshold = isInterface ? 25 : 30;
+        unsigned       totalLikelihood     = 0;
+        unsigned       guesses             = 0;
+
+        while ((guesses < numberOfClasses) && (guesses < maxTypeChecks))
         {
-            *classGuess = (CORINFO_CLASS_HANDLE)likelyClasses[0].handle;
-            *likelihood = likelyClasses[0].likelihood;
+            if ((guesses > 0) && (likelyClasses[guesses].likelihood < extraGuessThreshold))
+            {
+                break;
+            }
+
+            classGuesses[guesses]  = (CORINFO_CLASS_HANDLE)likelyClasses[guesses].handle;
+            methodGuesses[guesses] = NO_METHOD_HANDLE;
+            likelihoods[guesses]   = likelyClasses[guesses].likelihood;
+            totalLikelihood += likelyClasses[guesses].likelihood;
+            guesses++;
+        }
+
+        if (totalLikelihood >= likelihoodThreshold)
+        {
+            JITDUMP("Guessing for %u class%s with total likelihood %u%%\n", guesses, (guesses > 1) ? "es" : "",
+                    totalLikelihood);
+            *numberOfGuesses = guesses;
             return;
         }
 
@@ -4780,8 +4811,10 @@ void Compiler::pickGDV(GenTreeCall*           call,
         unsigned likelihoodThreshold = 30;
         if (likelyMethods[0].likelihood >= likelihoodThreshold)
         {
-            *methodGuess = (CORINFO_METHOD_HANDLE)likelyMethods[0].handle;
-            *likelihood  = likelyMethods[0].likelihood;
+            *classGuesses    = NO_CLASS_HANDLE;
+            *methodGuesses   = (CORINFO_METHOD_HANDLE)likelyMethods[0].handle;
+            *likelihoods     = likelyMethods[0].likelihood;
+            *numberOfGuesses = 1;
             return;
         }
 
@@ -4891,8 +4924,8 @@ bool Compiler::isCompatibleMethodGDV(GenTreeCall* call, CORINFO_METHOD_HANDLE gd
 //    pContextHandle - context handle for the call
 //
 // Notes:
-//    Consults with VM to see if there's a likely class at runtime,
-//    if so, adds a candidate for guarded devirtualization.
+//    Consults with VM to see if there are likely classes at runtime,
+//    if so, adds a candidate for guarded devirtualization for each.
 //
 void Compiler::considerGuardedDevirtualization(GenTreeCall*            call,
                                                IL_OFFSET               ilOffset,
@@ -4912,113 +4945,126 @@ void Compiler::considerGuardedDevirtualization(GenTreeCall*            call,
         return;
     }
 
-    CORINFO_CLASS_HANDLE  likelyClass;
-    CORINFO_METHOD_HANDLE likelyMethod;
-    unsigned              likelihood;
-    pickGDV(call, ilOffset, isInterface, &likelyClass, &likelyMethod, &likelihood);
-
-    if ((likelyClass == NO_CLASS_HANDLE) && (likelyMethod == NO_METHOD_HANDLE))
-    {
-        return;
-    }
+    CORINFO_CLASS_HANDLE  likelyClasses[MAX_GDV_TYPE_CHECKS];
+    CORINFO_METHOD_HANDLE likelyMethods[MAX_GDV_TYPE_CHECKS];
+    unsigned              likelihoods[MAX_GDV_TYPE_CHECKS];
+    unsigned              numberOfGuesses = 0;
+    pickGDV(call, ilOffset, isInterface, likelyClasses, likelyMethods, likelihoods, &numberOfGuesses);
 
-    uint32_t likelyClassAttribs = 0;
-    if (likelyClass != NO_CLASS_HANDLE)
+    // Add a candidate for each guess. Guesses we can't use are skipped; the
+    // type tests for the others are chained in the order they were picked.
+    //
+    for (unsigned guess = 0; guess < numberOfGuesses; guess++)
     {
-        likelyClassAttribs = info.compCompHnd->getClassAttribs(likelyClass);
+        CORINFO_CLASS_HANDLE  likelyClass  = likelyClasses[guess];
+        CORINFO_METHOD_HANDLE likelyMethod = likelyMethods[guess];
 
-        if ((likelyClassAttribs & CORINFO_FLG_ABSTRACT) != 0)
+        uint32_t likelyClassAttribs = 0;
+        if (likelyClass != NO_CLASS_HANDLE)
         {
-            // We may see an abstract likely class, if we have a stale profile.
-            // No point guessing for this.
+            likelyClassAttribs = info.compCompHnd->getClassAttribs(likelyClass);
+
+            if ((likelyClassAttribs & CORINFO_FLG_ABSTRACT) != 0)
+            {
+                // We may see an abstract likely class, if we have a stale profile.
+                // No point guessing for this.
+                //
+                JITDUMP("Not guessing for class; abstract (stale profile)\n");
+                continue;
+            }
+
+            // Figure out which method will be called.
             //
-            JITDUMP("Not guessing for class; abstract (stale profile)\n");
-            return;
-        }
+            CORINFO_DEVIRTUALIZATION_INFO dvInfo;
+            dvInfo.virtualMethod               = baseMethod;
+            dvInfo.objClass                    = likelyClass;
+            dvInfo.context                     = *pContextHandle;
+            dvInfo.exactContext                = *pContextHandle;
+            dvInfo.pResolvedTokenVirtualMethod = nullptr;
 
-        // Figure out which method will be called.
-        //
-        CORINFO_DEVIRTUALIZATION_INFO dvInfo;
-        dvInfo.virtualMethod               = baseMethod;
-        dvInfo.objClass                    = likelyClass;
-        dvInfo.context                     = *pContextHandle;
-        dvInfo.exactContext                = *pContextHandle;
-        dvInfo.pResolvedTokenVirtualMethod = nullptr;
+            const bool canResolve = info.compCompHnd->resolveVirtualMethod(&dvInfo);
 
-        const bool canResolve = info.compCompHnd->resolveVirtualMethod(&dvInfo);
+            if (!canResolve)
+            {
+                JITDUMP("Can't figure out which method would be invoked, sorry\n");
+                continue;
+            }
 
-        if (!canResolve)
-        {
-            JITDUMP("Can't figure out which method would be invoked, sorry\n");
-            return;
+            likelyMethod = dvInfo.devirtualizedMethod;
         }
 
-        likelyMethod = dvInfo.devirtualizedMethod;
-    }
-
-    uint32_t likelyMethodAttribs = info.compCompHnd->getMethodAttribs(likelyMethod);
+        uint32_t likelyMethodAttribs = info.compCompHnd->getMethodAttribs(likelyMethod);
 
-    if (likelyClass == NO_CLASS_HANDLE)
-    {
-        // For method GDV do a few more checks that we get for free in the
-        // resolve call above for class-based GDV.
-        if ((likelyMethodAttribs & CORINFO_FLG_STATIC) != 0)
+        if (likelyClass == NO_CLASS_HANDLE)
         {
-            assert((fgPgoSource != ICorJitInfo::PgoSource::Dynamic) || call->IsDelegateInvoke());
-            JITDUMP("Cannot currently handle devirtualizing static delegate calls, sorry\n");
-            return;
-        }
+            // For method GDV do a few more checks that we get for free in the
+            // resolve call above for class-based GDV.
+            if ((likelyMethodAttribs & CORINFO_FLG_STATIC) != 0)
+            {
+                assert((fgPgoSource != ICorJitInfo::PgoSource::Dynamic) || call->IsDelegateInvoke());
+                JITDUMP("Cannot currently handle devirtualizing static delegate calls, sorry\n");
+                continue;
+            }
 
-        CORINFO_CLASS_HANDLE definingClass = info.compCompHnd->getMethodClass(likelyMethod);
-        likelyClassAttribs                 = info.compCompHnd->getClassAttribs(definingClass);
+            CORINFO_CLASS_HANDLE definingClass = info.compCompHnd->getMethodClass(likelyMethod);
+            likelyClassAttribs                 = info.compCompHnd->getClassAttribs(definingClass);
 
-        // For instance methods on value classes we need an extended check to
-        // check for the unboxing stub. This is NYI.
-        // Note: For dynamic PGO likelyMethod above will be the unboxing stub
-        // which would fail GDV for other reasons.
-        // However, with static profiles or textual PGO input it is still
-        // possible that likelyMethod is not the unboxing stub. So we do need
-        // this explicit check.
-        if ((likelyClassAttribs & CORINFO_FLG_VALUECLASS) != 0)
-        {
-            JITDUMP("Cannot currently handle devirtualizing delegate calls on value types, sorry\n");
-            return;
+            // For instance methods on value classes we need an extended check to
+            // check for the unboxing stub. This is NYI.
+            // Note: For dynamic PGO likelyMethod above will be the unboxing stub
+            // which would fail GDV for other reasons.
+            // However, with static profiles or textual PGO input it is still
+            // possible that likelyMethod is not the unboxing stub. So we do need
+            // this explicit check.
+            if ((likelyClassAttribs & CORINFO_FLG_VALUECLASS) != 0)
+            {
+                JITDUMP("Cannot currently handle devirtualizing delegate calls on value types, sorry\n");
+                continue;
+            }
+
+            // Verify that the call target and args look reasonable so that the JIT
+            // does not blow up during inlining/call morphing.
+            //
+            // NOTE: Once we want to support devirtualization of delegate calls to
+            // static methods and remove the check above we will start failing here
+            // for delegates pointing to static methods that have the first arg
+            // bound. For example:
+            //
+            // public static void E(this C c) ...
+            // Action a = new C().E;
+            //
+            // The delegate instance looks exactly like one pointing to an instance
+            // method in this case and the call will have zero args while the
+            // signature has 1 arg.
+            //
+            if (!isCompatibleMethodGDV(call, likelyMethod))
+            {
+                JITDUMP("Target for method-based GDV is incompatible (stale profile?)\n");
+                assert((fgPgoSource != ICorJitInfo::PgoSource::Dynamic) &&
+                       "Unexpected stale profile in dynamic PGO data");
+                continue;
+            }
         }
 
-        // Verify that the call target and args look reasonable so that the JIT
-        // does not blow up during inlining/call morphing.
-        //
-        // NOTE: Once we want to support devirtualization of delegate calls to
-        // static methods and remove the check above we will start failing here
-        // for delegates pointing to static methods that have the first arg
-        // bound. For example:
-        //
-        // public static void E(this C c) ...
-        // Action a = new C().E;
+#ifdef DEBUG
+        char buffer[256];
+        JITDUMP("%s call would invoke method %s\n",
+                isInterface ? "interface" : call->IsDelegateInvoke() ? "delegate" : "virtual",
+                eeGetMethodFullName(likelyMethod, true, true, buffer, sizeof(buffer)));
+#endif
+
+        // Add this as a potential candidate.
         //
-        // The delegate instance looks exactly like one pointing to an instance
-        // method in this case and the call will have zero args while the
-        // signature has 1 arg.
+        addGuardedDevirtualizationCandidate(call, likelyMethod, likelyClass, likelyMethodAttribs, likelyClassAttribs,
+                                            likelihoods[guess]);
+
+        // If the call couldn't be marked, it won't be for the later guesses either.
         //
-        if (!isCompatibleMethodGDV(call, likelyMethod))
+        if (!call->IsGuardedDevirtualizationCandidate())
         {
-            JITDUMP("Target for method-based GDV is incompatible (stale profile?)\n");
-            assert((fgPgoSource != ICorJitInfo::PgoSource::Dynamic) && "Unexpected stale profile in dynamic PGO data");
             return;
         }
     }
-
-#ifdef DEBUG
-    char buffer[256];
-    JITDUMP("%s call would invoke method %s\n",
-            isInterface ? "interface" : call->IsDelegateInvoke() ? "delegate" : "virtual",
-            eeGetMethodFullName(likelyMethod, true, true, buffer, sizeof(buffer)));
-#endif
-
-    // Add this as a potential candidate.
-    //
-    addGuardedDevirtualizationCandidate(call, likelyMethod, likelyClass, likelyMethodAttribs, likelyClassAttribs,
-                                        likelihood);
 }
 
 //------------------------------------------------------------------------
@@ -5034,6 +5080,9 @@ void Compiler::considerGuardedDevirtualization(GenTreeCall*            call,
 // child tree, because and we need to clone all these trees when we clone the call
 // as part of guarded devirtualization, and these IR nodes can't be cloned.
 //
+// If the call is already a candidate, the new guess is chained after the
+// existing ones, and is tested only when they fail.
+//
 // Arguments:
 //    call - potential guarded devirtualization candidate
 //    methodHandle - method that will be invoked if the class test succeeds
@@ -5100,16 +5149,22 @@ void Compiler::addGuardedDevirtualizationCandidate(GenTreeCall*          call,
 
     // We're all set, proceed with candidate creation.
     //
-    JITDUMP("Marking call [%06u] as guarded devirtualization candidate; will guess for %s %s\n", dspTreeID(call),
+    const bool isFirstGuess = !call->IsGuardedDevirtualizationCandidate();
+    JITDUMP("%s call [%06u] as guarded devirtualization candidate; will guess for %s %s\n",
+            isFirstGuess ? "Marking" : "Extending", dspTreeID(call),
             classHandle != NO_CLASS_HANDLE ? "class" : "method",
             classHandle != NO_CLASS_HANDLE ? eeGetClassName(classHandle) : eeGetMethodFullName(methodHandle));
-    setMethodHasGuardedDevirtualization();
-    call->SetGuardedDevirtualizationCandidate();
 
-    // Spill off any GT_RET_EXPR subtrees so we can clone the call.
-    //
-    SpillRetExprHelper helper(this);
-    helper.StoreRetExprResultsInArgs(call);
+    if (isFirstGuess)
+    {
+        setMethodHasGuardedDevirtualization();
+        call->SetGuardedDevirtualizationCandidate();
+
+        // Spill off any GT_RET_EXPR subtrees so we can clone the call.
+        //
+        SpillRetExprHelper helper(this);
+        helper.StoreRetExprResultsInArgs(call);
+    }
 
     // Gather some information for later. Note we actually allocate InlineCandidateInfo
     // here, as the devirtualized half of this call will likely become an inline candidate.
@@ -5119,6 +5174,7 @@ void Compiler::addGuardedDevirtualizationCandidate(GenTreeCall*          call,
     pInfo->guardedMethodHandle             = methodHandle;
     pInfo->guardedMethodUnboxedEntryHandle = nullptr;
     pInfo->guardedClassHandle              = classHandle;
+    pInfo->nextGuess                       = nullptr;
     pInfo->likelihood                      = likelihood;
     pInfo->requiresInstMethodTableArg      = false;
 
@@ -5139,7 +5195,21 @@ void Compiler::addGuardedDevirtualizationCandidate(GenTreeCall*          call,
         }
     }
 
-    call->gtGuardedDevirtualizationCandidateInfo = pInfo;
+    if (isFirstGuess)
+    {
+        call->gtGuardedDevirtualizationCandidateInfo = pInfo;
+    }
+    else
+    {
+        GuardedDevirtualizationCandidateInfo* lastGuess = call->gtGuardedDevirtualizationCandidateInfo;
+
+        while (lastGuess->nextGuess != nullptr)
+        {
+            lastGuess = lastGuess->nextGuess;
+        }
+
+        lastGuess->nextGuess = pInfo;
+    }
 }
 
 //------------------------------------------------------------------------
@@ -5155,7 +5225,9 @@ void Compiler::addGuardedDevirtualizationCandidate(GenTreeCall*          call,
 // Notes:
 //    Mostly a wrapper for impMarkInlineCandidateHelper that also undoes
 //    guarded devirtualization for virtual calls where the method we'd
-//    devirtualize to cannot be inlined.
+//    devirtualize to cannot be inlined. When there are several guesses,
+//    each is evaluated on its own, and the ones that cannot be inlined
+//    are dropped.
 
 void Compiler::impMarkInlineCandidate(GenTree*               callNode,
                                       CORINFO_CONTEXT_HANDLE exactContextHnd,
@@ -5165,6 +5237,52 @@ void Compiler::impMarkInlineCandidate(GenTree*               callNode,
 {
     GenTreeCall* call = callNode->AsCall();
 
+    if (call->IsGuardedDevirtualizationCandidate() &&
+        (call->gtGuardedDevirtualizationCandidateInfo->nextGuess != nullptr))
+    {
+        GuardedDevirtualizationCandidateInfo*  firstGuess = call->gtGuardedDevirtualizationCandidateInfo;
+        GuardedDevirtualizationCandidateInfo*  keptGuesses = nullptr;
+        GuardedDevirtualizationCandidateInfo** lastKept    = &keptGuesses;
+
+        for (GuardedDevirtualizationCandidateInfo* guess = firstGuess; guess != nullptr;)
+        {
+            GuardedDevirtualizationCandidateInfo* const nextGuess = guess->nextGuess;
+
+            // The helper looks at (and fills in) the call's candidate info.
+            //
+            call->gtGuardedDevirtualizationCandidateInfo = guess;
+            call->gtFlags &= ~GTF_CALL_INLINE_CANDIDATE;
+            impMarkInlineCandidateHelper(call, exactContextHnd, exactContextNeedsRuntimeLookup, callInfo, ilOffset);
+
+            if (call->IsInlineCandidate())
+            {
+                guess->nextGuess = nullptr;
+                *lastKept        = guess;
+                lastKept         = &guess->nextGuess;
+            }
+            else
+            {
+                JITDUMP("Dropping guess for call [%06u]: target method can't be inlined\n", dspTreeID(call));
+            }
+
+            guess = nextGuess;
+        }
+
+        if (keptGuesses != nullptr)
+        {
+            call->gtGuardedDevirtualizationCandidateInfo = keptGuesses;
+            call->gtFlags |= GTF_CALL_INLINE_CANDIDATE;
+            return;
+        }
+
+        JITDUMP("Revoking guarded devirtualization candidacy for call [%06u]: no target method can be inlined\n",
+                dspTreeID(call));
+
+        call->gtGuardedDevirtualizationCandidateInfo = firstGuess;
+        call->ClearGuardedDevirtualizationCandidate();
+        return;
+    }
+
     // Do the actual evaluation
     impMarkInlineCandidateHelper(call, exactContextHnd, exactContextNeedsRuntimeLookup, callInfo, ilOffset);
 
@@ -6739,6 +6857,7 @@ void Compiler::impCheckCanInline(GenTreeCall*           call,
                 pInfo->guardedClassHandle              = nullptr;
                 pInfo->guardedMethodHandle             = nullptr;
                 pInfo->guardedMethodUnboxedEntryHandle = nullptr;
+                pInfo->nextGuess                       = nullptr;
                 pInfo->likelihood                      = 0;
                 pInfo->requiresInstMethodTableArg      = false;
             }
@@ -451,8 +451,14 @@ private:
     class GuardedDevirtualizationTransformer final : public Transformer
     {
     public:
-        GuardedDevirtualizationTransformer(Compiler* compiler, BasicBlock* block, Statement* stmt)
-            : Transformer(compiler, block, stmt), returnTemp(BAD_VAR_NUM)
+        GuardedDevirtualizationTransformer(Compiler*   compiler,
+                                           BasicBlock* block,
+                                           Statement*  stmt,
+                                           unsigned    earlierLikelihood = 0)
+            : Transformer(compiler, block, stmt)
+            , returnTemp(BAD_VAR_NUM)
+            , nextGuess(nullptr)
+            , priorLikelihood(earlierLikelihood)
         {
         }
 
@@ -475,9 +481,27 @@ private:
                 return;
             }
 
-            likelihood = origCall->gtGuardedDevirtualizationCandidateInfo->likelihood;
-            assert((likelihood >= 0) && (likelihood <= 100));
-            JITDUMP("Likelihood of correct guess is %u\n", likelihood);
+            GuardedDevirtualizationCandidateInfo* const guardedInfo = origCall->gtGuardedDevirtualizationCandidateInfo;
+            const unsigned                              guessLikelihood = guardedInfo->likelihood;
+            assert((guessLikelihood >= 0) && (guessLikelihood <= 100));
+            JITDUMP("Likelihood of correct guess is %u\n", guessLikelihood);
+
+            nextGuess = guardedInfo->nextGuess;
+
+            if ((priorLikelihood == 0) && (JitConfig.JitGuardedDevirtualizationSummary() != 0))
+            {
+                ReportGuesses(guardedInfo);
+            }
+
+            // Only the calls that failed the earlier type tests get here, so for
+            // block weights we want the likelihood among those.
+            //
+            likelihood = guessLikelihood;
+            if (priorLikelihood > 0)
+            {
+                likelihood = (priorLikelihood < 100) ? min(100u, guessLikelihood * 100 / (100 - priorLikelihood)) : 100;
+                JITDUMP("Likelihood among calls that failed the earlier guesses is %u\n", likelihood);
+            }
 
             const bool isChainedGdv = (origCall->gtCallMoreFlags & GTF_CALL_M_GUARDED_DEVIRT_CHAIN) != 0;
 
@@ -493,9 +517,24 @@ private:
                 TransformForChainedGdv();
             }
 
+            // If there's another guess, CreateElse left the call in the else block
+            // as a candidate for it. Expand that now.
+            //
+            if (nextGuess != nullptr)
+            {
+                GuardedDevirtualizationTransformer nextTransformer(compiler, elseBlock, elseBlock->firstStmt(),
+                                                                   priorLikelihood + guessLikelihood);
+                nextTransformer.Run();
+                return;
+            }
+
             // Look ahead and see if there's another Gdv we might chain to this one.
+            // This needs a single cold block, so we don't do it for multiple guesses.
             //
-            ScoutForChainedGdv();
+            if (priorLikelihood == 0)
+            {
+                ScoutForChainedGdv();
+            }
         }
 
     protected:
@@ -904,7 +943,8 @@ private:
         }
 
         //------------------------------------------------------------------------
-        // CreateElse: create else block. This executes the original indirect call.
+        // CreateElse: create else block. This executes the original indirect call,
+        //   or, if there is another guess, makes the call a candidate for it.
         //
         virtual void CreateElse()
         {
@@ -913,6 +953,43 @@ private:
             GenTreeCall* call    = origCall;
             Statement*   newStmt = compiler->gtNewStmt(call, stmt->GetDebugInfo());
 
+            if (nextGuess != nullptr)
+            {
+                // CreateThen gave the direct call a new GT_RET_EXPR if the original call had one.
+                //
+                const bool hasRetExpr = call->gtInlineCandidateInfo->retExpr != nullptr;
+
+                call->gtGuardedDevirtualizationCandidateInfo = nextGuess;
+                call->gtCallMoreFlags &= ~GTF_CALL_M_GUARDED_DEVIRT_CHAIN;
+                call->SetGuardedDevirtualizationCandidate();
+
+                JITDUMP("Call [%06u] moved to block " FMT_BB " to guess again\n", compiler->dspTreeID(call),
+                        elseBlock->bbNum);
+
+                compiler->fgInsertStmtAtEnd(elseBlock, newStmt);
+
+                // Like the direct call in the then block, the call needs its own
+                // GT_RET_EXPR, and returns its value via our return temp.
+                //
+                InlineCandidateInfo* const nextInfo = call->gtInlineCandidateInfo;
+                nextInfo->preexistingSpillTemp      = returnTemp;
+
+                if (hasRetExpr)
+                {
+                    nextInfo->retExpr   = compiler->gtNewInlineCandidateReturnExpr(call, call->TypeGet());
+                    GenTree* newRetExpr = nextInfo->retExpr;
+
+                    if (returnTemp != BAD_VAR_NUM)
+                    {
+                        newRetExpr = compiler->gtNewTempAssign(returnTemp, newRetExpr);
+                    }
+                    compiler->fgNewStmtAtEnd(elseBlock, newRetExpr);
+                }
+
+                stmt->SetRootNode(compiler->gtNewNothingNode());
+                return;
+            }
+
             call->gtFlags &= ~GTF_CALL_INLINE_CANDIDATE;
             call->SetIsGuarded();
 
@@ -1141,10 +1218,62 @@ private:
             }
         }
 
+        //------------------------------------------------------------------------
+        // ReportGuesses: print the guesses for this call site, and the fraction
+        //   of the calls the profile data expects them to catch.
+        //
+        // Arguments:
+        //    guardedInfo - the first guess for the call
+        //
+        void ReportGuesses(GuardedDevirtualizationCandidateInfo* guardedInfo)
+        {
+            unsigned numberOfGuesses = 0;
+            unsigned hitRate         = 0;
+
+            for (GuardedDevirtualizationCandidateInfo* guess = guardedInfo; guess != nullptr; guess = guess->nextGuess)
+            {
+                numberOfGuesses++;
+                hitRate += guess->likelihood;
+            }
+
+#ifdef DEBUG
+            const char* methodName = compiler->info.compFullName;
+#else
+            const char* methodName =
+                compiler->eeGetMethodFullName(compiler->info.compMethodHnd, /* includeReturnType */ false,
+                                              /* includeThisSpecifier */ false);
+#endif
+
+            printf("GDV site in %s at IL offset 0x%x: %u guess%s, expected hit rate %u%%\n", methodName,
+                   origCall->gtInlineCandidateInfo->ilOffset, numberOfGuesses, (numberOfGuesses > 1) ? "es" : "",
+                   min(hitRate, 100u));
+
+            unsigned index = 1;
+            for (GuardedDevirtualizationCandidateInfo* guess = guardedInfo; guess != nullptr; guess = guess->nextGuess)
+            {
+                if (guess->guardedClassHandle != NO_CLASS_HANDLE)
+                {
+                    printf("  %u) class %s [likelihood:%u%%]\n", index,
+                           compiler->eeGetClassName(guess->guardedClassHandle), guess->likelihood);
+                }
+                else
+                {
+                    printf("  %u) method %s [likelihood:%u%%]\n", index,
+                           compiler->eeGetMethodFullName(guess->guardedMethodHandle), guess->likelihood);
+                }
+                index++;
+            }
+        }
+
     private:
         unsigned   returnTemp;
         Statement* lastStmt;
 
+        // The guess to make if this one fails, and the likelihood of all the
+        // guesses made before this one.
+        GuardedDevirtualizationCandidateInfo* nextGuess;
+        unsigned                              priorLikelihood;
+
         //------------------------------------------------------------------------
         // CreateTreeForLookup: Create a tree representing a lookup of a method address.
         //
@@ -1218,18 +1218,63 @@ void InlineStrategy::NoteOutcome(InlineContext* context)
 
 bool InlineStrategy::BudgetCheck(unsigned ilSize)
 {
-    const int  timeDelta = EstimateInlineTime(ilSize);
-    const bool result    = (timeDelta + m_CurrentTimeEstimate > m_CurrentTimeBudget);
+    const int  timeDelta  = EstimateInlineTime(ilSize);
+    const int  timeBudget = GetCallSiteTimeBudget();
+    const bool result     = (timeDelta + m_CurrentTimeEstimate > timeBudget);
 
     if (result)
     {
-        JITDUMP("\nBudgetCheck: for IL Size %d, timeDelta %d +  currentEstimate %d > currentBudget %d\n", ilSize,
-                timeDelta, m_CurrentTimeEstimate, m_CurrentTimeBudget);
+        JITDUMP("\nBudgetCheck: for IL Size %d, timeDelta %d +  currentEstimate %d > callsite budget %d (current "
+                "budget %d)\n",
+                ilSize, timeDelta, m_CurrentTimeEstimate, timeBudget, m_CurrentTimeBudget);
     }
 
     return result;
 }
 
+//------------------------------------------------------------------------
+// GetCallSiteTimeBudget: get the jit time budget for an inline at the
+//     call site currently being considered
+//
+// Return Value:
+//     Time budget to check the inline against.
+//
+// Notes:
+//     Without profile data, or unless JitInlineBudgetByWeight is set,
+//     every call site gets the current budget.
+//
+//     With profile data, the headroom over the time estimate for the
+//     method without inlining is scaled by how often the call site runs
+//     relative to the method entry, so cold sites can't exhaust the
+//     budget before hot sites are reached, and hot ones can go further.
+//
+//     Inline attempts are made while walking the root method's blocks,
+//     so compCurBB is the block with the call.
+
+int InlineStrategy::GetCallSiteTimeBudget()
+{
+    BasicBlock* const callSiteBlock = m_Compiler->compCurBB;
+
+    if ((JitConfig.JitInlineBudgetByWeight() == 0) || (callSiteBlock == nullptr) ||
+        !m_Compiler->fgHaveSufficientProfileWeights())
+    {
+        return m_CurrentTimeBudget;
+    }
+
+    const weight_t entryWeight = m_Compiler->fgFirstBB->bbWeight;
+
+    if (entryWeight <= BB_ZERO_WEIGHT)
+    {
+        return m_CurrentTimeBudget;
+    }
+
+    const double frequency = callSiteBlock->bbWeight / entryWeight;
+    const double scale     = max(1.0 / COLD_BUDGET_DIVISOR, min(frequency, (double)HOT_BUDGET_MULTIPLIER));
+    const int    headroom  = max(0, m_CurrentTimeBudget - m_InitialTimeEstimate);
+
+    return m_InitialTimeEstimate + (int)(headroom * scale);
+}
+
 //------------------------------------------------------------------------
 // NewRoot: construct an InlineContext for the root method
 //
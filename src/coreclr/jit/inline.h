@@ -589,13 +589,17 @@ struct HandleHistogramProfileCandidateInfo
 // GuardedDevirtualizationCandidateInfo provides information about
 // a potential target of a virtual or interface call.
 //
+// A call may have several guesses, tested in order; likelihood is the
+// fraction of all calls at the site the profile expects each one to catch.
+//
 struct GuardedDevirtualizationCandidateInfo : HandleHistogramProfileCandidateInfo
 {
-    CORINFO_CLASS_HANDLE  guardedClassHandle;
-    CORINFO_METHOD_HANDLE guardedMethodHandle;
-    CORINFO_METHOD_HANDLE guardedMethodUnboxedEntryHandle;
-    unsigned              likelihood;
-    bool                  requiresInstMethodTableArg;
+    CORINFO_CLASS_HANDLE                  guardedClassHandle;
+    CORINFO_METHOD_HANDLE                 guardedMethodHandle;
+    CORINFO_METHOD_HANDLE                 guardedMethodUnboxedEntryHandle;
+    GuardedDevirtualizationCandidateInfo* nextGuess;
+    unsigned                              likelihood;
+    bool                                  requiresInstMethodTableArg;
 };
 
 // InlineCandidateInfo provides basic information about a particular
@@ -705,6 +709,11 @@ struct InlineInfo
 
     bool thisDereferencedFirst;
 
+    // IL range of the cold part of a partial inline, which is imported as a call
+    // to the inlinee instead. BAD_IL_OFFSET if the whole method is inlined.
+    IL_OFFSET partialInlineColdOffs;
+    IL_OFFSET partialInlineColdEndOffs;
+
 #ifdef FEATURE_SIMD
     bool hasSIMDTypeArgLocalOrReturn;
 #endif // FEATURE_SIMD
@@ -1054,11 +1063,23 @@ private:
     // Cap on allowable increase in jit time due to inlining.
     // Multiplicative, so BUDGET = 10 means up to 10x increase
     // in jit time.
+    //
+    // With profile data and JitInlineBudgetByWeight, call sites that
+    // run less often than the method entry only get a share of the
+    // headroom the budget allows (down to 1/COLD_BUDGET_DIVISOR), so
+    // they can't use it all up before the hot ones are reached. Sites
+    // that run more often get more (up to HOT_BUDGET_MULTIPLIER times
+    // as much).
     enum
     {
-        BUDGET = 10
+        BUDGET                = 10,
+        COLD_BUDGET_DIVISOR   = 4,
+        HOT_BUDGET_MULTIPLIER = 2
     };
 
+    // Time budget available to an inline at the current call site.
+    int GetCallSiteTimeBudget();
+
     // Estimate the jit time change because of this inline.
     int EstimateTime(InlineContext* context);
 
@@ -690,6 +690,14 @@ CodeGen::OperandDesc CodeGen::genOperandDesc(GenTree* op)
 
         regSet.tmpRlsTemp(tmpDsc);
     }
+#if defined(FEATURE_HW_INTRINSICS) && defined(TARGET_XARCH)
+    else if (op->OperIsHWIntrinsic() && op->AsHWIntrinsic()->OperIsBroadcastScalar() &&
+             !op->AsHWIntrinsic()->OperIsMemoryLoad())
+    {
+        // An embedded broadcast operand is described by the scalar it broadcasts.
+        return genOperandDesc(op->AsHWIntrinsic()->Op(1));
+    }
+#endif // FEATURE_HW_INTRINSICS && TARGET_XARCH
     else if (op->isIndir() || op->OperIsHWIntrinsic())
     {
         GenTree*      addr;
@@ -990,15 +998,25 @@ void CodeGen::inst_RV_RV_TT(
     // TODO-XArch-CQ: Commutative operations can have op1 be contained
     // TODO-XArch-CQ: Non-VEX encoded instructions can have both ops contained
 
+    insOpts instOptions = INS_OPTS_NONE;
+#if defined(FEATURE_HW_INTRINSICS)
+    if (op2->isContained() && op2->OperIsHWIntrinsic() && op2->AsHWIntrinsic()->OperIsBroadcastScalar())
+    {
+        // Lowering only contains the broadcast when the EVEX form of "ins" can broadcast the element itself.
+        instOptions = INS_OPTS_EVEX_b;
+    }
+#endif // FEATURE_HW_INTRINSICS
+
     OperandDesc op2Desc = genOperandDesc(op2);
     switch (op2Desc.GetKind())
     {
         case OperandKind::ClsVar:
-            emit->emitIns_SIMD_R_R_C(ins, size, targetReg, op1Reg, op2Desc.GetFieldHnd(), 0);
+            emit->emitIns_SIMD_R_R_C(ins, size, targetReg, op1Reg, op2Desc.GetFieldHnd(), 0, instOptions);
             break;
 
         case OperandKind::Local:
-            emit->emitIns_SIMD_R_R_S(ins, size, targetReg, op1Reg, op2Desc.GetVarNum(), op2Desc.GetLclOffset());
+            emit->emitIns_SIMD_R_R_S(ins, size, targetReg, op1Reg, op2Desc.GetVarNum(), op2Desc.GetLclOffset(),
+                                     instOptions);
             break;
 
         case OperandKind::Indir:
@@ -1007,7 +1025,7 @@ void CodeGen::inst_RV_RV_TT(
             // temporary GT_IND to generate code with.
             GenTreeIndir  indirForm;
             GenTreeIndir* indir = op2Desc.GetIndirForm(&indirForm);
-            emit->emitIns_SIMD_R_R_A(ins, size, targetReg, op1Reg, indir);
+            emit->emitIns_SIMD_R_R_A(ins, size, targetReg, op1Reg, indir, instOptions);
         }
         break;
 
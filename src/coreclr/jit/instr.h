@@ -337,6 +337,13 @@ enum insBarrier : unsigned
     INS_BARRIER_REL   =  INS_BARRIER_FULL,//18,
     INS_BARRIER_RMB   =  INS_BARRIER_FULL,//19,
 };
+#elif defined(TARGET_XARCH)
+enum insOpts : unsigned
+{
+    INS_OPTS_NONE,
+
+    INS_OPTS_EVEX_b, // Broadcast the memory operand's single element to all lanes (EVEX.b).
+};
 #endif
 
 #if defined(TARGET_XARCH)
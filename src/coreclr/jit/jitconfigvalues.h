@@ -374,6 +374,16 @@ CONFIG_INTEGER(JitConstCSE, W("JitConstCSE"), 0)
 #define CONST_CSE_ENABLE_ALL 3
 #define CONST_CSE_ENABLE_ALL_NO_SHARING 4
 
+// Policy used to decide which CSE candidates to promote:
+// Default 0, use the cost model
+// If 1, use the cost model, costing candidates likely to be spilled under register pressure as stack homes
+// If 2, promote candidates whose features, weighted by JitCSEParameters, sum to a positive score
+//
+CONFIG_INTEGER(JitCSEPolicy, W("JitCSEPolicy"), 0)
+
+// Comma separated weights for JitCSEPolicy=2, one per feature in the order of CSE_Heuristic::CSE_Feature
+CONFIG_STRING(JitCSEParameters, W("JitCSEParameters"))
+
 ///
 /// JIT
 ///
@@ -410,6 +420,13 @@ CONFIG_INTEGER(JitInlineSIMDMultiplier, W("JitInlineSIMDMultiplier"), 3)
 // Ex lclMAX_TRACKED constant.
 CONFIG_INTEGER(JitMaxLocalsToTrack, W("JitMaxLocalsToTrack"), 0x400)
 
+// LSRA throughput mode for huge methods: when the number of basic blocks times the number of tracked
+// locals exceeds JitLsraThroughputModeSize, only the JitLsraThroughputModeCandidates hottest tracked
+// locals are register candidates and the costlier register selection heuristics are skipped.
+// 0 disables the throughput mode.
+CONFIG_INTEGER(JitLsraThroughputModeSize, W("JitLsraThroughputModeSize"), 0x200000)
+CONFIG_INTEGER(JitLsraThroughputModeCandidates, W("JitLsraThroughputModeCandidates"), 0x100)
+
 #if defined(FEATURE_ENABLE_NO_RANGE_CHECKS)
 CONFIG_INTEGER(JitNoRngChks, W("JitNoRngChks"), 0) // If 1, don't generate range checks
 #endif                                             // defined(FEATURE_ENABLE_NO_RANGE_CHECKS)
@@ -436,6 +453,14 @@ CONFIG_INTEGER(JitOptRepeatCount, W("JitOptRepeatCount"), 2) // Number of times
 CONFIG_INTEGER(JitDoIfConversion, W("JitDoIfConversion"), 1) // Perform If conversion
 #endif                                                       // defined(OPT_CONFIG)
 
+CONFIG_INTEGER(JitDoExtTSPLayout, W("JitDoExtTSPLayout"), 0)           // Lay out hot blocks with an ext-TSP model on PGO data
+CONFIG_INTEGER(JitDoLoopVectorization, W("JitDoLoopVectorization"), 0) // Vectorize simple counted loops
+CONFIG_INTEGER(JitPartialUnrollLoops, W("JitPartialUnrollLoops"), 0)   // Partially unroll hot loops with PGO data
+CONFIG_INTEGER(JitWidenIVs, W("JitWidenIVs"), 0)                       // Widen int induction variables to long
+CONFIG_INTEGER(JitRangeCheckDerivedIVs, W("JitRangeCheckDerivedIVs"), 0) // Bound i + cns indices by an increasing IV
+CONFIG_INTEGER(JitJumpThreadComputedPhis, W("JitJumpThreadComputedPhis"), 0) // Jump thread relops computed from phis
+CONFIG_INTEGER(JitTailMergeReturns, W("JitTailMergeReturns"), 0) // Tail merge returns, keep cross jumps off hot paths
+
 CONFIG_INTEGER(JitTelemetry, W("JitTelemetry"), 1) // If non-zero, gather JIT telemetry data
 
 // Max # of MapSelect's considered for a particular top-level invocation.
@@ -495,6 +520,14 @@ CONFIG_INTEGER(JitExtDefaultPolicyMaxIL, W("JitExtDefaultPolicyMaxIL"), 0x80)
 CONFIG_INTEGER(JitExtDefaultPolicyMaxILProf, W("JitExtDefaultPolicyMaxILProf"), 0x400)
 CONFIG_INTEGER(JitExtDefaultPolicyMaxBB, W("JitExtDefaultPolicyMaxBB"), 7)
 
+// Inline only the hot prefix of callees whose profile shows an early branch
+// is never taken, and call the callee for the rest.
+CONFIG_INTEGER(JitPartialInlining, W("JitPartialInlining"), 0)
+
+// Scale the inline time budget available at a call site by the site's profile weight
+// relative to the method entry.
+CONFIG_INTEGER(JitInlineBudgetByWeight, W("JitInlineBudgetByWeight"), 0)
+
 // Inliner uses the following formula for PGO-driven decisions:
 //
 //    BM = BM * ((1.0 - ProfTrust) + ProfWeight * ProfScale)
@@ -509,6 +542,7 @@ CONFIG_INTEGER(JitExtDefaultPolicyProfScale, W("JitExtDefaultPolicyProfScale"),
 CONFIG_INTEGER(JitInlinePolicyModel, W("JitInlinePolicyModel"), 0)
 CONFIG_INTEGER(JitInlinePolicyProfile, W("JitInlinePolicyProfile"), 0)
 CONFIG_INTEGER(JitInlinePolicyProfileThreshold, W("JitInlinePolicyProfileThreshold"), 40)
+// Allocate non-escaping objects on the stack: 0 - never, 1 - when optimizing, 2 - in Tier1 code
 CONFIG_INTEGER(JitObjectStackAllocation, W("JitObjectStackAllocation"), 0)
 
 CONFIG_INTEGER(JitEECallTimingInfo, W("JitEECallTimingInfo"), 0)
@@ -524,6 +558,13 @@ CONFIG_INTEGER(JitEnableGuardedDevirtualization, W("JitEnableGuardedDevirtualiza
 // Various policies for GuardedDevirtualization
 CONFIG_INTEGER(JitGuardedDevirtualizationChainLikelihood, W("JitGuardedDevirtualizationChainLikelihood"), 0x4B) // 75
 CONFIG_INTEGER(JitGuardedDevirtualizationChainStatements, W("JitGuardedDevirtualizationChainStatements"), 4)
+CONFIG_INTEGER(JitGuardedDevirtualizationMaxTypeChecks, W("JitGuardedDevirtualizationMaxTypeChecks"), 1)
+CONFIG_INTEGER(JitGuardedDevirtualizationExtraGuessLikelihood,
+               W("JitGuardedDevirtualizationExtraGuessLikelihood"),
+               10) // Min likelihood for guesses after the first
+CONFIG_INTEGER(JitGuardedDevirtualizationSummary, W("JitGuardedDevirtualizationSummary"), 0) // Prints the guesses and
+                                                                                              // expected hit rate of
+                                                                                              // each GDV call site
 #if defined(DEBUG)
 CONFIG_STRING(JitGuardedDevirtualizationRange, W("JitGuardedDevirtualizationRange"))
 CONFIG_INTEGER(JitRandomGuardedDevirtualization, W("JitRandomGuardedDevirtualization"), 0)
@@ -576,6 +617,8 @@ CONFIG_INTEGER(JitDelegateProfiling, W("JitDelegateProfiling"), 1)   // Profile
 CONFIG_INTEGER(JitVTableProfiling, W("JitVTableProfiling"), 0)       // Profile resolved vtable call targets
 CONFIG_INTEGER(JitEdgeProfiling, W("JitEdgeProfiling"), 1)           // Profile edges instead of blocks
 CONFIG_INTEGER(JitCollect64BitCounts, W("JitCollect64BitCounts"), 0) // Collect counts as 64-bit values.
+CONFIG_INTEGER(JitScalableProfiling, W("JitScalableProfiling"), 0)   // Count with sampled increments once counts
+                                                                     // are large
 
 // Profile consumption options
 CONFIG_INTEGER(JitDisablePgo, W("JitDisablePgo"), 0) // Ignore pgo data for all methods
@@ -599,9 +642,20 @@ CONFIG_INTEGER(JitForceControlFlowGuard, W("JitForceControlFlowGuard"), 0);
 // 2: Default behavior, depends on platform (yes on x64, no on arm64)
 CONFIG_INTEGER(JitCFGUseDispatcher, W("JitCFGUseDispatcher"), 2)
 
+// Skip write barriers for stores into objects just allocated in gen0
+CONFIG_INTEGER(JitElideNewObjWriteBarriers, W("JitElideNewObjWriteBarriers"), 0)
+// Runtime heap verification level, the checked write barriers keep a shadow copy of the heap up to date
+CONFIG_INTEGER(HeapVerify, W("HeapVerify"), 0)
+
 // Enable tail merging
 CONFIG_INTEGER(JitEnableTailMerge, W("JitEnableTailMerge"), 1)
 
+// Enable promotion of the hot fields of struct locals that regular struct promotion did not promote
+CONFIG_INTEGER(JitEnablePhysicalPromotion, W("JitEnablePhysicalPromotion"), 0)
+
+// Number of default-sized arena pages each thread keeps for its next compilation; 0 disables the cache
+CONFIG_INTEGER(JitArenaPageCacheLimit, W("JitArenaPageCacheLimit"), 0)
+
 #if defined(DEBUG)
 // JitFunctionFile: Name of a file that contains a list of functions. If the currently compiled function is in the
 // file, certain other JIT config variables will be active. If the currently compiled function is not in the file,
@@ -87,7 +87,7 @@ public:
         JIT_FLAG_UNUSED16                = 43,
 #endif // !defined(TARGET_ARM)
 
-        JIT_FLAG_UNUSED17                = 44,
+        JIT_FLAG_PHASE_TELEMETRY         = 44, // JIT should time its phases and call reportJitPhaseTelemetry
         JIT_FLAG_UNUSED18                = 45,
         JIT_FLAG_UNUSED19                = 46,
         JIT_FLAG_UNUSED20                = 47,
@@ -221,6 +221,8 @@ public:
 
 #endif // TARGET_ARM
 
+        FLAGS_EQUAL(CORJIT_FLAGS::CORJIT_FLAG_PHASE_TELEMETRY, JIT_FLAG_PHASE_TELEMETRY);
+
 #undef FLAGS_EQUAL
     }
 
@@ -3073,6 +3073,37 @@ void Compiler::makeExtraStructQueries(CORINFO_CLASS_HANDLE structHandle, int lev
 }
 #endif // DEBUG
 
+//------------------------------------------------------------------------
+// lvaSetStruct: Set the layout of a struct local variable.
+//
+// Arguments:
+//    varNum              - the local variable number
+//    layout              - the layout, a block layout or the layout of a class
+//    unsafeValueClsCheck - as for lvaSetStruct with a class handle
+//
+// Notes:
+//    Block layouts have no class handle, the local is an untyped block of
+//    memory without gc pointers.
+//
+void Compiler::lvaSetStruct(unsigned varNum, ClassLayout* layout, bool unsafeValueClsCheck)
+{
+    if (!layout->IsBlockLayout())
+    {
+        lvaSetStruct(varNum, layout->GetClassHandle(), unsafeValueClsCheck);
+        return;
+    }
+
+    LclVarDsc* varDsc = lvaGetDesc(varNum);
+    assert((varDsc->lvType == TYP_UNDEF) || (varDsc->lvType == TYP_STRUCT));
+    assert(varDsc->GetLayout() == nullptr);
+    assert(varDsc->lvExactSize == 0);
+
+    varDsc->lvType = TYP_STRUCT;
+    varDsc->SetLayout(layout);
+    varDsc->lvExactSize = layout->GetSize();
+    assert(varDsc->lvExactSize != 0);
+}
+
 //------------------------------------------------------------------------
 // lvaSetStructUsedAsVarArg: update hfa information for vararg struct args
 //
@@ -462,6 +462,7 @@ public:
                                         GenTree**           pNode,
                                         bool*               supportsRegOptional,
                                         GenTreeHWIntrinsic* transparentParentNode = nullptr);
+    bool IsContainableEmbeddedBroadcast(GenTreeHWIntrinsic* containingNode, GenTreeHWIntrinsic* broadcast);
 #endif // FEATURE_HW_INTRINSICS
 
     static void TransformUnusedIndirection(GenTreeIndir* ind, Compiler* comp, BasicBlock* block);
@@ -6457,6 +6457,12 @@ bool Lowering::TryGetContainableHWIntrinsicOp(GenTreeHWIntrinsic* containingNode
             return true;
         }
 
+        case NI_AVX2_BroadcastScalarToVector128:
+        case NI_AVX2_BroadcastScalarToVector256:
+        {
+            return IsContainableEmbeddedBroadcast(containingNode, hwintrinsic);
+        }
+
         case NI_SSE_LoadAlignedVector128:
         case NI_SSE2_LoadAlignedVector128:
         case NI_AVX_LoadAlignedVector256:
@@ -6491,6 +6497,90 @@ bool Lowering::TryGetContainableHWIntrinsicOp(GenTreeHWIntrinsic* containingNode
     }
 }
 
+//----------------------------------------------------------------------------------------------
+// IsContainableEmbeddedBroadcast: Determines whether a scalar broadcast can be folded into the
+//    memory operand of containingNode using the EVEX embedded broadcast ({1toN}) form.
+//
+//  Arguments:
+//     containingNode - The hardware intrinsic node which would contain 'broadcast'
+//     broadcast      - The BroadcastScalarToVector* node
+//
+// Return Value:
+//    true if the broadcast only exists to feed a single element from memory into containingNode
+//    and containingNode's instruction can broadcast that element itself; otherwise, false.
+//
+bool Lowering::IsContainableEmbeddedBroadcast(GenTreeHWIntrinsic* containingNode, GenTreeHWIntrinsic* broadcast)
+{
+    if (!comp->canUseEvexEncoding() || !comp->compOpportunisticallyDependsOn(InstructionSet_AVX512F_VL))
+    {
+        return false;
+    }
+
+    NamedIntrinsic containingIntrinsicId = containingNode->GetHWIntrinsicId();
+
+    // Only the binary, table driven, forms go through the codegen that knows to request the broadcast.
+    if ((HWIntrinsicInfo::lookupCategory(containingIntrinsicId) != HW_Category_SimpleSIMD) ||
+        HWIntrinsicInfo::HasSpecialCodegen(containingIntrinsicId) || (containingNode->GetOperandCount() != 2))
+    {
+        return false;
+    }
+
+    if ((broadcast->TypeGet() != containingNode->TypeGet()) ||
+        (genTypeSize(broadcast->GetSimdBaseType()) != genTypeSize(containingNode->GetSimdBaseType())))
+    {
+        return false;
+    }
+
+    instruction ins = HWIntrinsicInfo::lookupIns(containingIntrinsicId, containingNode->GetSimdBaseType());
+
+    if (!comp->GetEmitter()->IsEmbeddedBroadcastCompatible(ins, genTypeSize(broadcast->GetSimdBaseType())))
+    {
+        return false;
+    }
+
+    switch (ins)
+    {
+        case INS_andps:
+        case INS_andpd:
+        case INS_andnps:
+        case INS_andnpd:
+        case INS_orps:
+        case INS_orpd:
+        case INS_xorps:
+        case INS_xorpd:
+        {
+            // The EVEX forms of the floating-point bitwise operations were introduced by AVX512DQ.
+            if (!comp->compOpportunisticallyDependsOn(InstructionSet_AVX512DQ_VL))
+            {
+                return false;
+            }
+            break;
+        }
+
+        default:
+        {
+            break;
+        }
+    }
+
+    if (broadcast->OperIsMemoryLoad())
+    {
+        // The memory form already reads a single element from its address.
+        return IsSafeToContainMem(containingNode, broadcast);
+    }
+
+    // Otherwise the broadcast must already have folded its scalar operand from memory, there
+    // is nothing to gain from containing a broadcast of a value that lives in a register.
+    GenTree* scalar = broadcast->Op(1);
+
+    if (!scalar->isContained() || scalar->OperIsHWIntrinsic())
+    {
+        return false;
+    }
+
+    return IsContainableMemoryOp(scalar) ? IsSafeToContainMem(containingNode, scalar) : scalar->IsCnsFltOrDbl();
+}
+
 //----------------------------------------------------------------------------------------------
 // ContainCheckHWIntrinsicAddr: Perform containment analysis for an address operand of a hardware
 //                              intrinsic node.
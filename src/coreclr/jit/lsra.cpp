@@ -662,7 +662,9 @@ LinearScan::LinearScan(Compiler* theCompiler)
     // after the first liveness analysis - either by optimizations or by Lowering, and the tracked
     // set won't be recomputed until after Lowering (and this constructor is called prior to Lowering),
     // so we don't want to check that yet.
-    enregisterLocalVars = compiler->compEnregLocals();
+    enregisterLocalVars      = compiler->compEnregLocals();
+    throughputMode           = false;
+    throughputModeCandidates = 0;
 #ifdef TARGET_ARM64
     availableIntRegs = (RBM_ALLINT & ~(RBM_PR | RBM_FP | RBM_LR) & ~compiler->codeGen->regSet.rsMaskResvd);
 #elif TARGET_LOONGARCH64
@@ -1235,6 +1237,20 @@ PhaseStatus LinearScan::doLinearScan()
         enregisterLocalVars = false;
     }
 
+    // The live set processing at block boundaries and the number of intervals to pick registers
+    // for both grow with the number of blocks times the number of tracked locals. Past a size
+    // threshold, only allocate registers to the hottest locals so that huge methods (generated
+    // serializers, large switch-based parsers) don't take superlinear time to allocate.
+    const size_t throughputModeSize = JitConfig.JitLsraThroughputModeSize();
+    if (enregisterLocalVars && (throughputModeSize != 0) &&
+        ((size_t)compiler->fgBBcount * compiler->lvaTrackedCount > throughputModeSize))
+    {
+        throughputMode           = true;
+        throughputModeCandidates = JitConfig.JitLsraThroughputModeCandidates();
+        JITDUMP("LSRA throughput mode: %u blocks, %u tracked locals, at most %u candidates\n", compiler->fgBBcount,
+                compiler->lvaTrackedCount, throughputModeCandidates);
+    }
+
     splitBBNumToTargetBBNumMap = nullptr;
 
     // This is complicated by the fact that physical registers have refs associated
@@ -1446,6 +1462,12 @@ bool LinearScan::isRegCandidate(LclVarDsc* varDsc)
         return false;
     }
 
+    // Tracked locals are sorted by weighted ref count, so this keeps the hottest ones.
+    if (throughputMode && (varDsc->lvVarIndex >= throughputModeCandidates))
+    {
+        return false;
+    }
+
 #if !defined(TARGET_64BIT)
     if (varDsc->lvType == TYP_LONG)
     {
@@ -11271,6 +11293,13 @@ void LinearScan::RegisterSelection::try_BEST_FIT()
         return;
     }
 
+    // Finding the best fit looks up the next reference of every candidate; in throughput
+    // mode leave the choice to the register order instead.
+    if (linearScan->throughputMode)
+    {
+        return;
+    }
+
     regMaskTP bestFitSet = RBM_NONE;
     // If the best score includes COVERS_FULL, pick the one that's killed soonest.
     // If none cover the full range, the BEST_FIT is the one that's killed later.
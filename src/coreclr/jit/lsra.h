@@ -1574,6 +1574,12 @@ private:
     // True if there are any register candidate lclVars available for allocation.
     bool enregisterLocalVars;
 
+    // True if the method is so large that allocation trades code quality for throughput:
+    // only the hottest tracked lclVars are register candidates, and register selection
+    // skips the heuristics that have to look at the upcoming references of each register.
+    bool     throughputMode;
+    unsigned throughputModeCandidates;
+
     virtual bool willEnregisterLocalVars() const
     {
         return enregisterLocalVars;
@@ -3212,6 +3212,15 @@ int LinearScan::BuildOperandUses(GenTree* node, regMaskTP candidates)
             return BuildAddrUses(hwintrinsic->Op(1));
         }
 
+#ifdef TARGET_XARCH
+        if (hwintrinsic->OperIsBroadcastScalar())
+        {
+            // An embedded broadcast reads its element straight from the memory its operand was contained from
+            assert(hwintrinsic->Op(1)->isContained());
+            return BuildOperandUses(hwintrinsic->Op(1));
+        }
+#endif // TARGET_XARCH
+
         size_t numArgs = hwintrinsic->GetOperandCount();
 
         if (numArgs != 1)
@@ -20,20 +20,25 @@ XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
 //------------------------------------------------------------------------
 // DoPhase: Run analysis (if object stack allocation is enabled) and then
 //          morph each GT_ALLOCOBJ node either into an allocation helper
-//          call or stack allocation.
+//          call or stack allocation, and move small non-escaping arrays
+//          to the stack.
 //
 // Returns:
 //    PhaseStatus indicating, what, if anything, was modified
 //
 // Notes:
-//    Runs only if Compiler::optMethodFlags has flag OMF_HAS_NEWOBJ set.
+//    Runs only if Compiler::optMethodFlags has flag OMF_HAS_NEWOBJ or
+//    OMF_HAS_NEWARRAY set.
 //
 PhaseStatus ObjectAllocator::DoPhase()
 {
     if ((comp->optMethodFlags & OMF_HAS_NEWOBJ) == 0)
     {
-        JITDUMP("no newobjs in this method; punting\n");
-        return PhaseStatus::MODIFIED_NOTHING;
+        if (((comp->optMethodFlags & OMF_HAS_NEWARRAY) == 0) || !IsObjectStackAllocationEnabled())
+        {
+            JITDUMP("no newobjs in this method; punting\n");
+            return PhaseStatus::MODIFIED_NOTHING;
+        }
     }
 
     if (IsObjectStackAllocationEnabled())
@@ -98,6 +103,25 @@ void ObjectAllocator::MarkLclVarAsDefinitelyStackPointing(unsigned int lclNum)
     BitVecOps::AddElemD(&m_bitVecTraits, m_DefinitelyStackPointingPointers, lclNum);
 }
 
+//------------------------------------------------------------------------------
+// MarkLclVarAsDefined : Record an assignment to a local variable.
+//
+//
+// Arguments:
+//    lclNum  - Assigned local variable number
+
+void ObjectAllocator::MarkLclVarAsDefined(unsigned int lclNum)
+{
+    if (BitVecOps::IsMember(&m_bitVecTraits, m_DefinedPointers, lclNum))
+    {
+        BitVecOps::AddElemD(&m_bitVecTraits, m_MultiplyDefinedPointers, lclNum);
+    }
+    else
+    {
+        BitVecOps::AddElemD(&m_bitVecTraits, m_DefinedPointers, lclNum);
+    }
+}
+
 //------------------------------------------------------------------------------
 // AddConnGraphEdge : Record that the source local variable may point to the same set of objects
 //                    as the set pointed to by target local variable.
@@ -123,6 +147,8 @@ void ObjectAllocator::DoAnalysis()
     if (comp->lvaCount > 0)
     {
         m_EscapingPointers         = BitVecOps::MakeEmpty(&m_bitVecTraits);
+        m_DefinedPointers          = BitVecOps::MakeEmpty(&m_bitVecTraits);
+        m_MultiplyDefinedPointers  = BitVecOps::MakeEmpty(&m_bitVecTraits);
         m_ConnGraphAdjacencyMatrix = new (comp->getAllocator(CMK_ObjectAllocator)) BitSetShortLongRep[comp->lvaCount];
 
         MarkEscapingVarsAndBuildConnGraph();
@@ -179,6 +205,11 @@ void ObjectAllocator::MarkEscapingVarsAndBuildConnGraph()
                 unsigned int lclNum = tree->AsLclVar()->GetLclNum();
                 assert(tree == m_ancestors.Top());
 
+                if ((user != nullptr) && user->OperIs(GT_ASG) && (user->gtGetOp1() == tree))
+                {
+                    m_allocator->MarkLclVarAsDefined(lclNum);
+                }
+
                 if (m_allocator->CanLclVarEscapeViaParentStack(&m_ancestors, lclNum))
                 {
                     if (!m_allocator->CanLclVarEscape(lclNum))
@@ -338,12 +369,15 @@ bool ObjectAllocator::MorphAllocObjNodes()
     m_PossiblyStackPointingPointers   = BitVecOps::MakeEmpty(&m_bitVecTraits);
     m_DefinitelyStackPointingPointers = BitVecOps::MakeEmpty(&m_bitVecTraits);
 
+    // Blocks aren't flagged for array allocations so we have to look at all of them.
+    const bool methodHasNewArr = IsObjectStackAllocationEnabled() && ((comp->optMethodFlags & OMF_HAS_NEWARRAY) != 0);
+
     for (BasicBlock* const block : comp->Blocks())
     {
         const bool basicBlockHasNewObj       = (block->bbFlags & BBF_HAS_NEWOBJ) == BBF_HAS_NEWOBJ;
         const bool basicBlockHasBackwardJump = (block->bbFlags & BBF_BACKWARD_JUMP) == BBF_BACKWARD_JUMP;
 #ifndef DEBUG
-        if (!basicBlockHasNewObj)
+        if (!basicBlockHasNewObj && !methodHasNewArr)
         {
             continue;
         }
@@ -354,7 +388,8 @@ bool ObjectAllocator::MorphAllocObjNodes()
             GenTree* stmtExpr = stmt->GetRootNode();
             GenTree* op2      = nullptr;
 
-            bool canonicalAllocObjFound = false;
+            bool         canonicalAllocObjFound = false;
+            GenTreeCall* newArr                 = nullptr;
 
             if (stmtExpr->OperGet() == GT_ASG && stmtExpr->TypeGet() == TYP_REF)
             {
@@ -364,6 +399,10 @@ bool ObjectAllocator::MorphAllocObjNodes()
                 {
                     canonicalAllocObjFound = true;
                 }
+                else if (methodHasNewArr && op2->IsHelperCall() && stmtExpr->gtGetOp1()->OperIs(GT_LCL_VAR))
+                {
+                    newArr = op2->AsCall();
+                }
             }
 
             if (canonicalAllocObjFound)
@@ -419,6 +458,52 @@ bool ObjectAllocator::MorphAllocObjNodes()
                 stmtExpr->AsOp()->gtOp2 = op2;
                 stmtExpr->gtFlags |= op2->gtFlags & GTF_ALL_EFFECT;
             }
+            else if (newArr != nullptr)
+            {
+                //------------------------------------------------------------------------
+                // We expect the following expression tree at this point
+                //  STMTx (IL 0x... ???)
+                //    * ASG       ref
+                //    +--*  LCL_VAR   ref
+                //    \--*  CALL help ref    CORINFO_HELP_NEWARR_1_VC
+                //       +--*  CNS_INT(h) long
+                //       \--*  CNS_INT   long
+                //------------------------------------------------------------------------
+
+                unsigned int lclNum    = stmtExpr->gtGetOp1()->AsLclVar()->GetLclNum();
+                unsigned int blockSize = 0;
+
+                // Uses of the local are replaced with the stack address, so the assignment has to
+                // come first. That's always true for temps. For other locals we check the assignment
+                // is in the first block, ahead of any uses there.
+                bool assignedBeforeUses = comp->lvaGetDesc(lclNum)->lvIsTemp;
+                if (!assignedBeforeUses && (block == comp->fgFirstBB))
+                {
+                    assignedBeforeUses = true;
+                    for (Statement* prevStmt = block->firstStmt(); prevStmt != stmt; prevStmt = prevStmt->GetNextStmt())
+                    {
+                        if (Compiler::gtHasRef(prevStmt->GetRootNode(), lclNum))
+                        {
+                            assignedBeforeUses = false;
+                            break;
+                        }
+                    }
+                }
+
+                if (!basicBlockHasBackwardJump && assignedBeforeUses &&
+                    CanAllocateArrayOnStack(lclNum, newArr, &blockSize))
+                {
+                    JITDUMP("Allocating array V%02u on the stack\n", lclNum);
+
+                    const unsigned int stackLclNum = MorphNewArrIntoStackAlloc(newArr, blockSize, block, stmt);
+                    m_HeapLocalToStackLocalMap.AddOrUpdate(lclNum, stackLclNum);
+                    MarkLclVarAsDefinitelyStackPointing(lclNum);
+                    MarkLclVarAsPossiblyStackPointing(lclNum);
+                    stmt->GetRootNode()->gtBashToNOP();
+                    comp->optMethodFlags |= OMF_HAS_OBJSTACKALLOC;
+                    didStackAllocate = true;
+                }
+            }
 
 #ifdef DEBUG
             else
@@ -507,10 +592,105 @@ unsigned int ObjectAllocator::MorphAllocObjNodeIntoStackAlloc(GenTreeAllocObj* a
     assert(allocObj != nullptr);
     assert(m_AnalysisDone);
 
+    // A box is the method table pointer followed by the struct.
+    CORINFO_CLASS_HANDLE clsHnd    = allocObj->gtAllocObjClsHnd;
+    unsigned int         blockSize = 0;
+    if ((comp->info.compCompHnd->getClassAttribs(clsHnd) & CORINFO_FLG_VALUECLASS) != 0)
+    {
+        blockSize = roundUp(TARGET_POINTER_SIZE + comp->info.compCompHnd->getClassSize(clsHnd), TARGET_POINTER_SIZE);
+    }
+
+    const unsigned int lclNum = CreateStackAllocLocal(clsHnd, blockSize, block, stmt);
+
+    //------------------------------------------------------------------------
+    // STMTx (IL 0x... ???)
+    //   * ASG       long
+    //   +--*  LCL_FLD    long
+    //   \--*  CNS_INT(h) long
+    //------------------------------------------------------------------------
+
+    // Initialize the method table pointer.
+    GenTree* tree = comp->gtNewLclFldNode(lclNum, TYP_I_IMPL, 0);
+    tree          = comp->gtNewAssignNode(tree, allocObj->gtGetOp1());
+
+    Statement* newStmt = comp->gtNewStmt(tree);
+
+    comp->fgInsertStmtBefore(block, stmt, newStmt);
+
+    return lclNum;
+}
+
+//------------------------------------------------------------------------
+// MorphNewArrIntoStackAlloc: Replace an array allocation helper call with
+//                            a stack allocation.
+// Arguments:
+//    newArr    - the CORINFO_HELP_NEWARR_1_* call
+//    blockSize - the size of the array, including the header
+//    block     - a basic block where newArr is
+//    stmt      - a statement where newArr is
+//
+// Return Value:
+//    local num for the new stack allocated local
+//
+// Notes:
+//    This function can insert additional statements before stmt.
+
+unsigned int ObjectAllocator::MorphNewArrIntoStackAlloc(GenTreeCall* newArr,
+                                                        unsigned int blockSize,
+                                                        BasicBlock*  block,
+                                                        Statement*   stmt)
+{
+    assert(newArr != nullptr);
+    assert(m_AnalysisDone);
+
+    const unsigned int lclNum = CreateStackAllocLocal(NO_CLASS_HANDLE, blockSize, block, stmt);
+
+    // Initialize the method table pointer and the length.
+    GenTree* tree = comp->gtNewLclFldNode(lclNum, TYP_I_IMPL, 0);
+    tree          = comp->gtNewAssignNode(tree, newArr->gtArgs.GetArgByIndex(0)->GetNode());
+    comp->fgInsertStmtBefore(block, stmt, comp->gtNewStmt(tree));
+
+    GenTree* length = newArr->gtArgs.GetArgByIndex(1)->GetNode();
+    tree            = comp->gtNewLclFldNode(lclNum, TYP_INT, OFFSETOF__CORINFO_Array__length);
+    tree = comp->gtNewAssignNode(tree, comp->gtNewIconNode((ssize_t)length->AsIntConCommon()->IntegralValue()));
+    comp->fgInsertStmtBefore(block, stmt, comp->gtNewStmt(tree));
+
+    return lclNum;
+}
+
+//------------------------------------------------------------------------
+// CreateStackAllocLocal: Create the struct local that holds a stack
+//                        allocated object, and zero it if necessary.
+// Arguments:
+//    clsHnd    - the class of the object
+//    blockSize - if not zero, the local is a block of this size rather
+//                than an instance of clsHnd
+//    block     - a basic block where the object is allocated
+//    stmt      - a statement where the object is allocated
+//
+// Return Value:
+//    local num for the new stack allocated local
+//
+// Notes:
+//    This function can insert additional statements before stmt.
+
+unsigned int ObjectAllocator::CreateStackAllocLocal(CORINFO_CLASS_HANDLE clsHnd,
+                                                    unsigned int         blockSize,
+                                                    BasicBlock*          block,
+                                                    Statement*           stmt)
+{
     const bool         shortLifetime = false;
-    const unsigned int lclNum     = comp->lvaGrabTemp(shortLifetime DEBUGARG("MorphAllocObjNodeIntoStackAlloc temp"));
+    const unsigned int lclNum = comp->lvaGrabTemp(shortLifetime DEBUGARG("MorphAllocObjNodeIntoStackAlloc temp"));
+
     const int unsafeValueClsCheck = true;
-    comp->lvaSetStruct(lclNum, allocObj->gtAllocObjClsHnd, unsafeValueClsCheck);
+    if (blockSize == 0)
+    {
+        comp->lvaSetStruct(lclNum, clsHnd, unsafeValueClsCheck);
+    }
+    else
+    {
+        comp->lvaSetStruct(lclNum, comp->typGetBlkLayout(blockSize), unsafeValueClsCheck);
+    }
 
     // Initialize the object memory if necessary.
     bool             bbInALoop  = (block->bbFlags & BBF_BACKWARD_JUMP) != 0;
@@ -541,22 +721,81 @@ unsigned int ObjectAllocator::MorphAllocObjNodeIntoStackAlloc(GenTreeAllocObj* a
         comp->compSuppressedZeroInit = true;
     }
 
-    //------------------------------------------------------------------------
-    // STMTx (IL 0x... ???)
-    //   * ASG       long
-    //   +--*  LCL_FLD    long
-    //   \--*  CNS_INT(h) long
-    //------------------------------------------------------------------------
+    return lclNum;
+}
 
-    // Initialize the method table pointer.
-    GenTree* tree = comp->gtNewLclFldNode(lclNum, TYP_I_IMPL, 0);
-    tree          = comp->gtNewAssignNode(tree, allocObj->gtGetOp1());
+//------------------------------------------------------------------------
+// CanAllocateArrayOnStack: Returns true iff an array allocation can be
+//                          replaced with a stack allocation.
+//
+// Arguments:
+//    lclNum    - Local variable the array is assigned to
+//    newArr    - The allocation helper call
+//    blockSize - [out] the size of the array, including the header
+//
+// Return Value:
+//    Returns true iff the array can be allocated on the stack.
+//
+// Notes:
+//    Only arrays with a constant length and primitive elements are handled,
+//    so the stack copy doesn't need a gc layout. The local must be assigned
+//    just once, uses of it are replaced with the stack address.
 
-    Statement* newStmt = comp->gtNewStmt(tree);
+bool ObjectAllocator::CanAllocateArrayOnStack(unsigned int lclNum, GenTreeCall* newArr, unsigned int* blockSize)
+{
+    assert(m_AnalysisDone);
 
-    comp->fgInsertStmtBefore(block, stmt, newStmt);
+    if (!newArr->IsHelperCall(comp, CORINFO_HELP_NEWARR_1_VC) &&
+        !newArr->IsHelperCall(comp, CORINFO_HELP_NEWARR_1_DIRECT))
+    {
+        return false;
+    }
 
-    return lclNum;
+    if (CanLclVarEscape(lclNum) || comp->lvaGetDesc(lclNum)->lvIsParam ||
+        BitVecOps::IsMember(&m_bitVecTraits, m_MultiplyDefinedPointers, lclNum))
+    {
+        return false;
+    }
+
+    if (newArr->gtArgs.CountArgs() != 2)
+    {
+        return false;
+    }
+
+    GenTree* const handle = newArr->gtArgs.GetArgByIndex(0)->GetNode();
+    GenTree* const length = newArr->gtArgs.GetArgByIndex(1)->GetNode();
+    if (!handle->IsIconHandle(GTF_ICON_CLASS_HDL) || !length->IsIntegralConst())
+    {
+        return false;
+    }
+
+    CORINFO_CLASS_HANDLE arrayHnd = (CORINFO_CLASS_HANDLE)newArr->compileTimeHelperArgumentHandle;
+    if (arrayHnd == NO_CLASS_HANDLE)
+    {
+        return false;
+    }
+
+    CORINFO_CLASS_HANDLE elemHnd  = NO_CLASS_HANDLE;
+    var_types            elemType = JITtype2varType(comp->info.compCompHnd->getChildType(arrayHnd, &elemHnd));
+    if (!varTypeIsArithmetic(elemType))
+    {
+        return false;
+    }
+
+    const INT64 elemCount = length->AsIntConCommon()->IntegralValue();
+    if ((elemCount < 0) || (elemCount > (INT64)(s_StackAllocMaxSize / genTypeSize(elemType))))
+    {
+        return false;
+    }
+
+    const unsigned int size = OFFSETOF__CORINFO_Array__data + (unsigned int)elemCount * genTypeSize(elemType);
+    if (size > s_StackAllocMaxSize)
+    {
+        return false;
+    }
+
+    *blockSize = roundUp(size, TARGET_POINTER_SIZE);
+    return true;
 }
 
 //------------------------------------------------------------------------
@@ -573,6 +812,8 @@ unsigned int ObjectAllocator::MorphAllocObjNodeIntoStackAlloc(GenTreeAllocObj* a
 // Notes:
 //    The method currently treats all locals assigned to a field as escaping.
 //    The can potentially be tracked by special field edges in the connection graph.
+//    Passing a local to a call makes it escape unless the call was inlined, in which
+//    case the inlinee's uses are already part of this method's trees.
 
 bool ObjectAllocator::CanLclVarEscapeViaParentStack(ArrayStack<GenTree*>* parentStack, unsigned int lclNum)
 {
@@ -642,6 +883,8 @@ bool ObjectAllocator::CanLclVarEscapeViaParentStack(ArrayStack<GenTree*>* parent
 
             case GT_EQ:
             case GT_NE:
+            case GT_NULLCHECK:
+            case GT_ARR_LENGTH:
                 canLclVarEscapeViaParentStack = false;
                 break;
 
@@ -657,6 +900,8 @@ bool ObjectAllocator::CanLclVarEscapeViaParentStack(ArrayStack<GenTree*>* parent
             case GT_QMARK:
             case GT_ADD:
             case GT_FIELD_ADDR:
+            case GT_INDEX_ADDR:
+            case GT_BOX:
                 // Check whether the local escapes via its grandparent.
                 ++parentIndex;
                 keepChecking = true;
@@ -664,6 +909,8 @@ bool ObjectAllocator::CanLclVarEscapeViaParentStack(ArrayStack<GenTree*>* parent
 
             case GT_FIELD:
             case GT_IND:
+            case GT_OBJ:
+            case GT_BLK:
             {
                 int grandParentIndex = parentIndex + 1;
                 if ((parentStack->Height() > grandParentIndex) &&
@@ -750,6 +997,12 @@ void ObjectAllocator::UpdateAncestorTypes(GenTree* tree, ArrayStack<GenTree*>* p
 
             case GT_EQ:
             case GT_NE:
+            case GT_NULLCHECK:
+            case GT_ARR_LENGTH:
+                break;
+
+            case GT_INDEX_ADDR:
+                // This is already a byref, which is fine for an element of a stack allocated array.
                 break;
 
             case GT_COMMA:
@@ -763,6 +1016,7 @@ void ObjectAllocator::UpdateAncestorTypes(GenTree* tree, ArrayStack<GenTree*>* p
             case GT_QMARK:
             case GT_ADD:
             case GT_FIELD_ADDR:
+            case GT_BOX:
                 if (parent->TypeGet() == TYP_REF)
                 {
                     parent->ChangeType(newType);
@@ -773,6 +1027,8 @@ void ObjectAllocator::UpdateAncestorTypes(GenTree* tree, ArrayStack<GenTree*>* p
 
             case GT_FIELD:
             case GT_IND:
+            case GT_OBJ:
+            case GT_BLK:
             {
                 // The new target could be *not* on the heap.
                 parent->gtFlags &= ~GTF_IND_TGT_HEAP;
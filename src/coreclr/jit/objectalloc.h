@@ -29,6 +29,9 @@ class ObjectAllocator final : public Phase
     bool         m_AnalysisDone;
     BitVecTraits m_bitVecTraits;
     BitVec       m_EscapingPointers;
+    // Pointers that are assigned, and those assigned more than once.
+    BitVec m_DefinedPointers;
+    BitVec m_MultiplyDefinedPointers;
     // We keep the set of possibly-stack-pointing pointers as a superset of the set of
     // definitely-stack-pointing pointers. All definitely-stack-pointing pointers are in both sets.
     BitVec              m_PossiblyStackPointingPointers;
@@ -48,6 +51,7 @@ protected:
 
 private:
     bool CanAllocateLclVarOnStack(unsigned int lclNum, CORINFO_CLASS_HANDLE clsHnd);
+    bool CanAllocateArrayOnStack(unsigned int lclNum, GenTreeCall* newArr, unsigned int* blockSize);
     bool CanLclVarEscape(unsigned int lclNum);
     void MarkLclVarAsPossiblyStackPointing(unsigned int lclNum);
     void MarkLclVarAsDefinitelyStackPointing(unsigned int lclNum);
@@ -55,6 +59,7 @@ private:
     bool DoesLclVarPointToStack(unsigned int lclNum);
     void DoAnalysis();
     void MarkLclVarAsEscaping(unsigned int lclNum);
+    void MarkLclVarAsDefined(unsigned int lclNum);
     void MarkEscapingVarsAndBuildConnGraph();
     void AddConnGraphEdge(unsigned int sourceLclNum, unsigned int targetLclNum);
     void ComputeEscapingNodes(BitVecTraits* bitVecTraits, BitVec& escapingNodes);
@@ -63,6 +68,14 @@ private:
     void     RewriteUses();
     GenTree* MorphAllocObjNodeIntoHelperCall(GenTreeAllocObj* allocObj);
     unsigned int MorphAllocObjNodeIntoStackAlloc(GenTreeAllocObj* allocObj, BasicBlock* block, Statement* stmt);
+    unsigned int MorphNewArrIntoStackAlloc(GenTreeCall* newArr,
+                                           unsigned int blockSize,
+                                           BasicBlock*  block,
+                                           Statement*   stmt);
+    unsigned int CreateStackAllocLocal(CORINFO_CLASS_HANDLE clsHnd,
+                                       unsigned int         blockSize,
+                                       BasicBlock*          block,
+                                       Statement*           stmt);
     struct BuildConnGraphVisitorCallbackData;
     bool CanLclVarEscapeViaParentStack(ArrayStack<GenTree*>* parentStack, unsigned int lclNum);
     void UpdateAncestorTypes(GenTree* tree, ArrayStack<GenTree*>* parentStack, var_types newType);
@@ -82,6 +95,8 @@ inline ObjectAllocator::ObjectAllocator(Compiler* comp)
     , m_HeapLocalToStackLocalMap(comp->getAllocator())
 {
     m_EscapingPointers                = BitVecOps::UninitVal();
+    m_DefinedPointers                 = BitVecOps::UninitVal();
+    m_MultiplyDefinedPointers         = BitVecOps::UninitVal();
     m_PossiblyStackPointingPointers   = BitVecOps::UninitVal();
     m_DefinitelyStackPointingPointers = BitVecOps::UninitVal();
     m_ConnGraphAdjacencyMatrix        = nullptr;
@@ -118,26 +133,34 @@ inline void ObjectAllocator::EnableObjectStackAllocation()
 //    Returns true iff local variable can be allocated on the stack.
 //
 // Notes:
-//    Stack allocation of objects with gc fields and boxed objects is currently disabled.
+//    A value class handle means the allocation is a box. Boxes of structs with gc fields
+//    are not allocated on the stack since the stack copy has no gc layout.
 
 inline bool ObjectAllocator::CanAllocateLclVarOnStack(unsigned int lclNum, CORINFO_CLASS_HANDLE clsHnd)
 {
     assert(m_AnalysisDone);
 
-    DWORD classAttribs = comp->info.compCompHnd->getClassAttribs(clsHnd);
+    DWORD        classAttribs = comp->info.compCompHnd->getClassAttribs(clsHnd);
+    unsigned int classSize;
 
     if ((classAttribs & CORINFO_FLG_VALUECLASS) != 0)
     {
-        // TODO-ObjectStackAllocation: enable stack allocation of boxed structs
-        return false;
-    }
+        if ((classAttribs & CORINFO_FLG_CONTAINS_GC_PTR) != 0)
+        {
+            return false;
+        }
 
-    if (!comp->info.compCompHnd->canAllocateOnStack(clsHnd))
-    {
-        return false;
+        classSize = TARGET_POINTER_SIZE + comp->info.compCompHnd->getClassSize(clsHnd);
     }
+    else
+    {
+        if (!comp->info.compCompHnd->canAllocateOnStack(clsHnd))
+        {
+            return false;
+        }
 
-    const unsigned int classSize = comp->info.compCompHnd->getHeapClassSize(clsHnd);
+        classSize = comp->info.compCompHnd->getHeapClassSize(clsHnd);
+    }
 
     return !CanLclVarEscape(lclNum) && (classSize <= s_StackAllocMaxSize);
 }
@@ -1721,8 +1721,41 @@ void Compiler::optValnumCSE_Availability()
 //
 class CSE_Heuristic
 {
-    Compiler* m_pCompiler;
-    unsigned  m_addCSEcount;
+public:
+    // The policy used to decide whether a candidate is promoted, selected by JitCSEPolicy
+    enum CSE_Policy
+    {
+        CSE_POLICY_DEFAULT       = 0, // cost model
+        CSE_POLICY_PRESSURE      = 1, // cost model, treating candidates likely to be spilled as stack homes
+        CSE_POLICY_PARAMETERIZED = 2, // linear model over the candidate's features, weights from JitCSEParameters
+    };
+
+    // The features fed to the parameterized policy, in the order JitCSEParameters lists their weights
+    enum CSE_Feature
+    {
+        CSE_FEATURE_BIAS,             // always 1
+        CSE_FEATURE_COST,             // execution cost of the expression (code size when optimizing for size)
+        CSE_FEATURE_SIZE,             // code size of the expression
+        CSE_FEATURE_DEF_COUNT,        // weighted def count, in units of BB_UNITY_WEIGHT
+        CSE_FEATURE_USE_COUNT,        // weighted use count, in units of BB_UNITY_WEIGHT
+        CSE_FEATURE_LIVE_ACROSS_CALL, // 1 if the CSE is live across a call
+        CSE_FEATURE_FLOATING,         // 1 if the CSE needs a floating point or SIMD register
+        CSE_FEATURE_SHARED_CONST,     // 1 if the CSE is a shared constant
+        CSE_FEATURE_PRESSURE,         // estimated register pressure where the CSE occurs, over the register budget
+        CSE_FEATURE_ENREG_COUNT,      // predicted enregistered integer locals, over CNT_CALLEE_ENREG
+        CSE_FEATURE_COUNT
+    };
+
+private:
+    Compiler*  m_pCompiler;
+    unsigned   m_addCSEcount;
+    CSE_Policy m_policy;
+    double     m_parameters[CSE_FEATURE_COUNT];
+
+    // Estimated register pressure per block, indexed by bbNum; nullptr when not estimated
+    unsigned* m_intPressure;
+    unsigned* m_floatPressure;
+    unsigned  m_pressureBBNumMax;
 
     weight_t               aggressiveRefCnt;
     weight_t               moderateRefCnt;
@@ -1742,6 +1775,25 @@ public:
     CSE_Heuristic(Compiler* pCompiler) : m_pCompiler(pCompiler)
     {
         codeOptKind = m_pCompiler->compCodeOpt();
+        m_policy    = CSE_POLICY_DEFAULT;
+
+        switch (JitConfig.JitCSEPolicy())
+        {
+            case CSE_POLICY_PRESSURE:
+                m_policy = CSE_POLICY_PRESSURE;
+                break;
+
+            case CSE_POLICY_PARAMETERIZED:
+                // Without any weights there is no model to evaluate, so stay with the default policy
+                if (ParseParameters(JitConfig.JitCSEParameters()))
+                {
+                    m_policy = CSE_POLICY_PARAMETERIZED;
+                }
+                break;
+
+            default:
+                break;
+        }
     }
 
     Compiler::codeOptimize CodeOptKind()
@@ -2006,6 +2058,173 @@ public:
             printf("We have a %s frame\n", hugeFrame ? "huge" : (largeFrame ? "large" : "small"));
         }
 #endif
+
+        InitializeRegisterPressure();
+    }
+
+    //------------------------------------------------------------------------
+    // ParseParameters: parse the weights of the parameterized policy
+    //
+    // Arguments:
+    //    str - comma separated list of decimal numbers, one per CSE_Feature
+    //
+    // Returns:
+    //    true if at least one weight was given; missing trailing weights are zero.
+    //
+    // Notes:
+    //    The weights are meant to come from a model trained offline, e.g. on the
+    //    candidate features and spill outcomes dumped by JitDump during SuperPMI replay.
+    //
+    bool ParseParameters(const WCHAR* str)
+    {
+        for (unsigned i = 0; i < CSE_FEATURE_COUNT; i++)
+        {
+            m_parameters[i] = 0.0;
+        }
+
+        if (str == nullptr)
+        {
+            return false;
+        }
+
+        const WCHAR* p     = str;
+        unsigned     count = 0;
+
+        while ((*p != 0) && (count < CSE_FEATURE_COUNT))
+        {
+            while ((*p == W(' ')) || (*p == W(',')))
+            {
+                p++;
+            }
+
+            if (*p == 0)
+            {
+                break;
+            }
+
+            bool negative = false;
+            if ((*p == W('-')) || (*p == W('+')))
+            {
+                negative = (*p == W('-'));
+                p++;
+            }
+
+            double value  = 0.0;
+            double scale  = 1.0;
+            bool   digits = false;
+            bool   point  = false;
+
+            for (; ((W('0') <= *p) && (*p <= W('9'))) || ((*p == W('.')) && !point); p++)
+            {
+                if (*p == W('.'))
+                {
+                    point = true;
+                    continue;
+                }
+
+                digits = true;
+                if (point)
+                {
+                    scale /= 10.0;
+                    value += (*p - W('0')) * scale;
+                }
+                else
+                {
+                    value = (value * 10.0) + (*p - W('0'));
+                }
+            }
+
+            if (!digits || ((*p != 0) && (*p != W(',')) && (*p != W(' '))))
+            {
+                JITDUMP("Ignoring malformed JitCSEParameters\n");
+                return false;
+            }
+
+            m_parameters[count++] = negative ? -value : value;
+        }
+
+        return count > 0;
+    }
+
+    //------------------------------------------------------------------------
+    // InitializeRegisterPressure: estimate the register pressure in each block
+    //
+    // Notes:
+    //    LSRA has not run yet, so we approximate the pressure it will see in a block by the
+    //    number of register candidates live into or out of it, per register class. When all
+    //    occurrences of a CSE sit where this already uses up the registers LSRA can hand out,
+    //    either the CSE temp or something live next to it will be spilled.
+    //
+    //    The liveness sets are the ones computed when building SSA. Later phases can leave them
+    //    slightly stale, which is fine for an estimate.
+    //
+    void InitializeRegisterPressure()
+    {
+        m_intPressure      = nullptr;
+        m_floatPressure    = nullptr;
+        m_pressureBBNumMax = 0;
+
+        if ((m_policy == CSE_POLICY_DEFAULT) || (CodeOptKind() == Compiler::SMALL_CODE) ||
+            !m_pCompiler->fgLocalVarLivenessDone)
+        {
+            return;
+        }
+
+        m_pressureBBNumMax = m_pCompiler->fgBBNumMax;
+        m_intPressure      = new (m_pCompiler, CMK_CSE) unsigned[m_pressureBBNumMax + 1]();
+        m_floatPressure    = new (m_pCompiler, CMK_CSE) unsigned[m_pressureBBNumMax + 1]();
+
+        for (BasicBlock* const block : m_pCompiler->Blocks())
+        {
+            if ((block->bbNum > m_pressureBBNumMax) || VarSetOps::MayBeUninit(block->bbLiveIn) ||
+                VarSetOps::MayBeUninit(block->bbLiveOut))
+            {
+                continue;
+            }
+
+            unsigned intIn    = 0;
+            unsigned floatIn  = 0;
+            unsigned intOut   = 0;
+            unsigned floatOut = 0;
+
+            CountRegisterCandidates(block->bbLiveIn, &intIn, &floatIn);
+            CountRegisterCandidates(block->bbLiveOut, &intOut, &floatOut);
+
+            m_intPressure[block->bbNum]   = max(intIn, intOut);
+            m_floatPressure[block->bbNum] = max(floatIn, floatOut);
+        }
+    }
+
+    // Count the tracked locals in 'vars' that may be enregistered, by register class.
+    //
+    void CountRegisterCandidates(VARSET_VALARG_TP vars, unsigned* intCount, unsigned* floatCount)
+    {
+        VarSetOps::Iter iter(m_pCompiler, vars);
+        unsigned        varIndex = 0;
+        while (iter.NextElem(&varIndex))
+        {
+            LclVarDsc* varDsc = m_pCompiler->lvaGetDescByTrackedIndex(varIndex);
+
+            if (varDsc->lvDoNotEnregister || varDsc->TypeIs(TYP_STRUCT))
+            {
+                continue;
+            }
+
+            if (varTypeUsesFloatReg(varDsc->TypeGet()))
+            {
+                (*floatCount)++;
+            }
+            else
+            {
+                (*intCount)++;
+#ifndef TARGET_64BIT
+                if (varDsc->TypeIs(TYP_LONG))
+                {
+                    (*intCount)++; // on 32-bit targets longs use two registers
+                }
+#endif
+            }
+        }
     }
 
     void SortCandidates()
@@ -2303,6 +2522,152 @@ public:
     }
 #endif
 
+    // Returns the number of registers LSRA can give a CSE temp of the candidate's register class
+    // without evicting anything; only the callee saved registers are available across a call.
+    //
+    unsigned RegisterBudget(CSE_Candidate* candidate)
+    {
+        if (varTypeUsesFloatReg(candidate->Expr()->TypeGet()))
+        {
+            return candidate->LiveAcrossCall() ? CNT_CALLEE_SAVED_FLOAT : (CNT_CALLEE_SAVED_FLOAT + CNT_CALLEE_TRASH_FLOAT);
+        }
+
+        return candidate->LiveAcrossCall() ? CNT_CALLEE_ENREG : (CNT_CALLEE_ENREG + CNT_CALLEE_TRASH);
+    }
+
+    // Returns the highest estimated register pressure over the blocks holding an occurrence of the candidate.
+    //
+    unsigned CandidatePressure(CSE_Candidate* candidate)
+    {
+        if (m_intPressure == nullptr)
+        {
+            return 0;
+        }
+
+        unsigned* pressure = varTypeUsesFloatReg(candidate->Expr()->TypeGet()) ? m_floatPressure : m_intPressure;
+        unsigned  result   = 0;
+
+        for (Compiler::treeStmtLst* lst = candidate->CseDsc()->csdTreeList; lst != nullptr; lst = lst->tslNext)
+        {
+            unsigned bbNum = lst->tslBlock->bbNum;
+            if (bbNum <= m_pressureBBNumMax)
+            {
+                result = max(result, pressure[bbNum]);
+            }
+        }
+
+        return result;
+    }
+
+    // Returns true if the register pressure estimate predicts that LSRA will not find a register
+    // for the candidate's CSE temp.
+    //
+    bool IsLikelySpilled(CSE_Candidate* candidate)
+    {
+        if (m_intPressure == nullptr)
+        {
+            return false;
+        }
+
+        // With no callee saved registers of this class, a CSE live across a call is always
+        // spilled; PromotionCheck already adds that cost.
+        unsigned budget = RegisterBudget(candidate);
+        if (budget == 0)
+        {
+            return false;
+        }
+
+        return CandidatePressure(candidate) >= budget;
+    }
+
+    // Account for the register a promoted CSE occupies in the blocks where it occurs, so that
+    // the candidates considered after it see the pressure it adds.
+    //
+    void UpdateRegisterPressure(CSE_Candidate* candidate)
+    {
+        if (m_intPressure == nullptr)
+        {
+            return;
+        }
+
+        bool        isFloat   = varTypeUsesFloatReg(candidate->Expr()->TypeGet());
+        unsigned*   pressure  = isFloat ? m_floatPressure : m_intPressure;
+        BasicBlock* lastBlock = nullptr;
+
+        for (Compiler::treeStmtLst* lst = candidate->CseDsc()->csdTreeList; lst != nullptr; lst = lst->tslNext)
+        {
+            // Occurrences are listed in block order, so this counts each block once.
+            BasicBlock* block = lst->tslBlock;
+            if ((block != lastBlock) && (block->bbNum <= m_pressureBBNumMax))
+            {
+                pressure[block->bbNum]++;
+            }
+            lastBlock = block;
+        }
+    }
+
+    // Compute the values of the features describing a candidate, see CSE_Feature.
+    //
+    void GetFeatures(CSE_Candidate* candidate, double* features)
+    {
+        unsigned budget = RegisterBudget(candidate);
+
+        features[CSE_FEATURE_BIAS]             = 1.0;
+        features[CSE_FEATURE_COST]             = candidate->Cost();
+        features[CSE_FEATURE_SIZE]             = candidate->Size();
+        features[CSE_FEATURE_DEF_COUNT]        = candidate->DefCount() / BB_UNITY_WEIGHT;
+        features[CSE_FEATURE_USE_COUNT]        = candidate->UseCount() / BB_UNITY_WEIGHT;
+        features[CSE_FEATURE_LIVE_ACROSS_CALL] = candidate->LiveAcrossCall() ? 1.0 : 0.0;
+        features[CSE_FEATURE_FLOATING]         = varTypeUsesFloatReg(candidate->Expr()->TypeGet()) ? 1.0 : 0.0;
+        features[CSE_FEATURE_SHARED_CONST]     = candidate->IsSharedConst() ? 1.0 : 0.0;
+        features[CSE_FEATURE_PRESSURE]         = (budget == 0) ? 1.0 : ((double)CandidatePressure(candidate) / budget);
+        features[CSE_FEATURE_ENREG_COUNT]      = (double)enregCount / CNT_CALLEE_ENREG;
+    }
+
+#ifdef DEBUG
+    // Dump the features of a candidate in a form that is easy to scrape from SuperPMI replay dumps
+    // when training the weights for JitCSEParameters.
+    //
+    void DumpFeatures(CSE_Candidate* candidate)
+    {
+        double features[CSE_FEATURE_COUNT];
+        GetFeatures(candidate, features);
+
+        printf("CSE features " FMT_CSE ":", candidate->CseIndex());
+        for (unsigned i = 0; i < CSE_FEATURE_COUNT; i++)
+        {
+            printf("%s%g", (i == 0) ? " " : ",", features[i]);
+        }
+        printf("\n");
+    }
+#endif
+
+    // Decide whether to promote a candidate by evaluating the linear model given by JitCSEParameters:
+    // the candidate is promoted when the weighted sum of its features is positive.
+    //
+    bool ParameterizedPromotionCheck(CSE_Candidate* candidate)
+    {
+        if (candidate->Expr()->TypeIs(TYP_STRUCT) &&
+            (m_pCompiler->gtGetStructHandleIfPresent(candidate->Expr()) == NO_CLASS_HANDLE))
+        {
+            JITDUMP("Can't determine the struct size, so we can't consider it for CSE promotion\n");
+            return false;
+        }
+
+        double features[CSE_FEATURE_COUNT];
+        GetFeatures(candidate, features);
+
+        double score = 0.0;
+        for (unsigned i = 0; i < CSE_FEATURE_COUNT; i++)
+        {
+            score += m_parameters[i] * features[i];
+        }
+
+        JITDUMP("Parameterized CSE score %g %s\n", score, (score > 0.0) ? "passes" : "fails");
+
+        return score > 0.0;
+    }
+
     // Given a CSE candidate decide whether it passes or fails the profitability heuristic
     // return true if we believe that it is profitable to promote this candidate to a CSE
     //
@@ -2326,8 +2691,18 @@ public:
         {
             return false; // skip this CSE
         }
+
+        if (m_pCompiler->verbose)
+        {
+            DumpFeatures(candidate);
+        }
 #endif
 
+        if (m_policy == CSE_POLICY_PARAMETERIZED)
+        {
+            return ParameterizedPromotionCheck(candidate);
+        }
+
         /*
             Our calculation is based on the following cost estimate formula
 
@@ -2610,6 +2985,19 @@ public:
             }
         }
 
+        // If the registers LSRA can give this CSE are already taken up where it occurs, the CSE temp
+        // (or something live next to it) will likely be spilled, so cost it as having a stack home.
+        // Aggressive candidates outweigh most of what is live there and are expected to keep a register.
+        //
+        if (canEnregister && !candidate->IsAggressive() && IsLikelySpilled(candidate))
+        {
+            JITDUMP("CSE is likely to be spilled (pressure %u, budget %u)\n", CandidatePressure(candidate),
+                    RegisterBudget(candidate));
+
+            cse_def_cost = max(cse_def_cost, 2U);
+            cse_use_cost = max(cse_use_cost, 3U);
+        }
+
         if (slotCount > 1)
         {
             cse_def_cost *= slotCount;
@@ -3429,6 +3817,7 @@ public:
             if (doCSE)
             {
                 PerformCSE(&candidate);
+                UpdateRegisterPressure(&candidate);
                 madeChanges = true;
             }
         }
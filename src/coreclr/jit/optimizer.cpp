@@ -3980,6 +3980,1076 @@ bool Compiler::optComputeLoopRep(int        constInit,
     return false;
 }
 
+#if defined(FEATURE_HW_INTRINSICS) && defined(TARGET_64BIT) && (defined(TARGET_XARCH) || defined(TARGET_ARM64))
+#define FEATURE_LOOP_VECTORIZATION 1
+#endif
+
+#ifdef FEATURE_LOOP_VECTORIZATION
+//------------------------------------------------------------------------
+// LoopVectorizer: checks whether one loop can be vectorized and, if so,
+// does it. See optVectorizeLoops for the loops we handle.
+//
+class LoopVectorizer
+{
+    // The most statements we vectorize in one loop body (not including the
+    // increment and the test).
+    static const unsigned MAX_BODY_STMTS = 8;
+
+    Compiler*          m_comp;
+    unsigned           m_loopInd;
+    Compiler::LoopDsc& m_loop;
+    unsigned           m_ivLclNum;
+    var_types          m_elemType;
+    bool               m_hasStores;
+    bool               m_hasNonArrayAccess;
+    bool               m_hasAccessOffset;
+    ssize_t            m_accessOffset;
+    bool               m_accessOffsetsDiffer;
+    unsigned           m_bodyStmtCount;
+    Statement*         m_bodyStmts[MAX_BODY_STMTS];
+    // The local each body statement reduces into, or BAD_VAR_NUM for stores.
+    unsigned m_reductionLcls[MAX_BODY_STMTS];
+
+public:
+    LoopVectorizer(Compiler* comp, unsigned loopInd)
+        : m_comp(comp)
+        , m_loopInd(loopInd)
+        , m_loop(comp->optLoopTable[loopInd])
+        , m_ivLclNum(BAD_VAR_NUM)
+        , m_elemType(TYP_UNDEF)
+        , m_hasStores(false)
+        , m_hasNonArrayAccess(false)
+        , m_hasAccessOffset(false)
+        , m_accessOffset(0)
+        , m_accessOffsetsDiffer(false)
+        , m_bodyStmtCount(0)
+    {
+    }
+
+    bool CanVectorize();
+    void Vectorize();
+
+private:
+    unsigned VectorLength() const
+    {
+        return 16 / genTypeSize(m_elemType);
+    }
+
+    CorInfoType SimdBaseJitType() const
+    {
+        switch (m_elemType)
+        {
+            case TYP_INT:
+                return CORINFO_TYPE_INT;
+            case TYP_LONG:
+                return CORINFO_TYPE_LONG;
+            case TYP_FLOAT:
+                return CORINFO_TYPE_FLOAT;
+            default:
+                assert(m_elemType == TYP_DOUBLE);
+                return CORINFO_TYPE_DOUBLE;
+        }
+    }
+
+    bool IsInvariantLocal(unsigned lclNum)
+    {
+        return !m_comp->lvaGetDesc(lclNum)->IsAddressExposed() && !m_comp->optIsVarAssgLoop(m_loopInd, lclNum);
+    }
+
+    bool IsIvUse(GenTree* tree);
+    bool IsIndex(GenTree* tree, ssize_t* pScale);
+    bool CheckLimit(GenTree* limit);
+    GenTree* SkipChecks(GenTree* tree, bool* pValid);
+    bool CollectAddressTerms(GenTree* tree, GenTree** pBase, ssize_t* pScale, ssize_t* pOffset);
+    bool CheckAddress(GenTree* addr);
+    bool CheckValue(GenTree* tree);
+    bool CheckStatement(Statement* stmt, unsigned* pReductionLcl);
+
+    GenTree* VectorizeAddress(GenTree* addr);
+    GenTree* VectorizeValue(GenTree* tree);
+    void InsertStmt(BasicBlock* block, GenTree* tree);
+};
+
+//------------------------------------------------------------------------
+// IsIvUse: Is this a use of the loop's induction variable?
+//
+bool LoopVectorizer::IsIvUse(GenTree* tree)
+{
+    return tree->OperIs(GT_LCL_VAR) && (tree->AsLclVarCommon()->GetLclNum() == m_ivLclNum);
+}
+
+//------------------------------------------------------------------------
+// IsIndex: Does this tree compute "iv * scale" for an address?
+//
+// Arguments:
+//    tree   - the tree
+//    pScale - [out] the scale
+//
+bool LoopVectorizer::IsIndex(GenTree* tree, ssize_t* pScale)
+{
+    ssize_t scale = 1;
+
+    if (tree->OperIs(GT_LSH) && tree->gtGetOp2()->IsCnsIntOrI())
+    {
+        ssize_t shift = tree->gtGetOp2()->AsIntCon()->IconValue();
+        if ((shift < 0) || (shift > 3))
+        {
+            return false;
+        }
+        scale = (ssize_t)1 << shift;
+        tree  = tree->gtGetOp1();
+    }
+    else if (tree->OperIs(GT_MUL) && !tree->gtOverflow() && tree->gtGetOp2()->IsCnsIntOrI())
+    {
+        scale = tree->gtGetOp2()->AsIntCon()->IconValue();
+        tree  = tree->gtGetOp1();
+    }
+
+    if (tree->OperIs(GT_CAST) && !tree->gtOverflow() && tree->TypeIs(TYP_LONG))
+    {
+        tree = tree->AsCast()->CastOp();
+    }
+
+    if (!IsIvUse(tree))
+    {
+        return false;
+    }
+
+    *pScale = scale;
+    return true;
+}
+
+//------------------------------------------------------------------------
+// CheckLimit: Can we evaluate the loop limit once, before the vector loop?
+//
+bool LoopVectorizer::CheckLimit(GenTree* limit)
+{
+    if (limit->IsCnsIntOrI())
+    {
+        return true;
+    }
+
+    if (limit->OperIs(GT_LCL_VAR))
+    {
+        return IsInvariantLocal(limit->AsLclVarCommon()->GetLclNum());
+    }
+
+    if (limit->OperIs(GT_ARR_LENGTH) && limit->AsArrLen()->ArrRef()->OperIs(GT_LCL_VAR))
+    {
+        return IsInvariantLocal(limit->AsArrLen()->ArrRef()->AsLclVarCommon()->GetLclNum());
+    }
+
+    return false;
+}
+
+//------------------------------------------------------------------------
+// SkipChecks: Skip over the bounds checks in front of a tree.
+//
+// Arguments:
+//    tree   - the tree
+//    pValid - [out] set to false if there's a check we can't drop
+//
+// Returns:
+//    The tree after the checks.
+//
+// Notes:
+//    A check of "iv" against the loop limit can't fail in the vector loop as
+//    it only runs while "iv + VL - 1 < limit", and the iv never goes below
+//    its (non-negative, constant) initial value.
+//
+GenTree* LoopVectorizer::SkipChecks(GenTree* tree, bool* pValid)
+{
+    while (tree->OperIs(GT_COMMA))
+    {
+        GenTree* check = tree->gtGetOp1();
+        if (check->OperIs(GT_BOUNDS_CHECK))
+        {
+            GenTreeBoundsChk* boundsChk = check->AsBoundsChk();
+            if (((m_loop.lpFlags & LPFLG_CONST_INIT) == 0) || (m_loop.lpConstInit < 0) ||
+                !IsIvUse(boundsChk->GetIndex()) || !GenTree::Compare(boundsChk->GetArrayLength(), m_loop.lpLimit()))
+            {
+                *pValid = false;
+                return tree;
+            }
+        }
+        else if (!check->OperIs(GT_NOP))
+        {
+            *pValid = false;
+            return tree;
+        }
+
+        tree = tree->gtGetOp2();
+    }
+
+    return tree;
+}
+
+//------------------------------------------------------------------------
+// CollectAddressTerms: Break an address down into "base + iv * scale + offset".
+//
+// Arguments:
+//    tree    - the address, or a part of it
+//    pBase   - [in, out] the base local
+//    pScale  - [in, out] the scale of the index, 0 if none was found yet
+//    pOffset - [in, out] the constant offset
+//
+// Returns:
+//    true if the address has that form.
+//
+bool LoopVectorizer::CollectAddressTerms(GenTree* tree, GenTree** pBase, ssize_t* pScale, ssize_t* pOffset)
+{
+    if (tree->OperIs(GT_ADD) && !tree->gtOverflow())
+    {
+        return CollectAddressTerms(tree->gtGetOp1(), pBase, pScale, pOffset) &&
+               CollectAddressTerms(tree->gtGetOp2(), pBase, pScale, pOffset);
+    }
+
+    if (tree->IsCnsIntOrI() && !tree->IsIconHandle())
+    {
+        *pOffset += tree->AsIntCon()->IconValue();
+        return true;
+    }
+
+    ssize_t scale;
+    if (IsIndex(tree, &scale))
+    {
+        if (*pScale != 0)
+        {
+            return false;
+        }
+        *pScale = scale;
+        return true;
+    }
+
+    if (tree->OperIs(GT_LCL_VAR) && tree->TypeIs(TYP_REF, TYP_BYREF, TYP_I_IMPL) && (*pBase == nullptr) &&
+        IsInvariantLocal(tree->AsLclVarCommon()->GetLclNum()))
+    {
+        *pBase = tree;
+        return true;
+    }
+
+    return false;
+}
+
+//------------------------------------------------------------------------
+// CheckAddress: Is this the address of element "iv" of an array or span?
+//
+bool LoopVectorizer::CheckAddress(GenTree* addr)
+{
+    bool valid = true;
+    addr       = SkipChecks(addr, &valid);
+    if (!valid)
+    {
+        return false;
+    }
+
+    if (addr->OperIs(GT_ARR_ADDR))
+    {
+        addr = addr->AsArrAddr()->Addr();
+    }
+
+    GenTree* base   = nullptr;
+    ssize_t  scale  = 0;
+    ssize_t  offset = 0;
+    if (!CollectAddressTerms(addr, &base, &scale, &offset) || (base == nullptr) ||
+        (scale != (ssize_t)genTypeSize(m_elemType)))
+    {
+        return false;
+    }
+
+    if (!base->TypeIs(TYP_REF))
+    {
+        m_hasNonArrayAccess = true;
+    }
+
+    if (m_hasAccessOffset && (offset != m_accessOffset))
+    {
+        m_accessOffsetsDiffer = true;
+    }
+    m_hasAccessOffset = true;
+    m_accessOffset    = offset;
+
+    return true;
+}
+
+//------------------------------------------------------------------------
+// CheckValue: Can we compute this value for VL iterations at once?
+//
+bool LoopVectorizer::CheckValue(GenTree* tree)
+{
+    bool valid = true;
+    tree       = SkipChecks(tree, &valid);
+    if (!valid || (tree->TypeGet() != m_elemType))
+    {
+        return false;
+    }
+
+    switch (tree->OperGet())
+    {
+        case GT_IND:
+            return ((tree->gtFlags & GTF_IND_VOLATILE) == 0) && CheckAddress(tree->AsIndir()->Addr());
+
+        case GT_LCL_VAR:
+            return !IsIvUse(tree) && IsInvariantLocal(tree->AsLclVarCommon()->GetLclNum());
+
+        case GT_CNS_INT:
+            return !tree->IsIconHandle();
+
+        case GT_CNS_LNG:
+        case GT_CNS_DBL:
+            return true;
+
+        case GT_ADD:
+        case GT_SUB:
+            break;
+
+        case GT_AND:
+        case GT_OR:
+        case GT_XOR:
+            if (varTypeIsFloating(m_elemType))
+            {
+                return false;
+            }
+            break;
+
+        case GT_MUL:
+        case GT_DIV:
+            // Vector multiplies of ints need more than the baseline ISA on x64, so we leave them alone.
+            if (!varTypeIsFloating(m_elemType))
+            {
+                return false;
+            }
+            break;
+
+        default:
+            return false;
+    }
+
+    return !tree->gtOverflow() && CheckValue(tree->gtGetOp1()) && CheckValue(tree->gtGetOp2());
+}
+
+//------------------------------------------------------------------------
+// CheckStatement: Can we vectorize this statement of the loop body? We handle
+// element-wise stores "a[i] = <value>" and reductions "sum = sum + <value>".
+//
+// Arguments:
+//    stmt          - the statement
+//    pReductionLcl - [out] the local the statement reduces into, or BAD_VAR_NUM for stores
+//
+bool LoopVectorizer::CheckStatement(Statement* stmt, unsigned* pReductionLcl)
+{
+    GenTree* root = stmt->GetRootNode();
+    if (!root->OperIs(GT_ASG))
+    {
+        return false;
+    }
+
+    GenTree* dst = root->gtGetOp1();
+    GenTree* src = root->gtGetOp2();
+
+    if (dst->OperIs(GT_IND))
+    {
+        if (((dst->gtFlags & GTF_IND_VOLATILE) != 0) || !dst->TypeIs(TYP_INT, TYP_LONG, TYP_FLOAT, TYP_DOUBLE))
+        {
+            return false;
+        }
+
+        var_types elemType = dst->TypeGet();
+        if (m_elemType == TYP_UNDEF)
+        {
+            m_elemType = elemType;
+        }
+
+        m_hasStores    = true;
+        *pReductionLcl = BAD_VAR_NUM;
+        return (elemType == m_elemType) && CheckAddress(dst->AsIndir()->Addr()) && CheckValue(src);
+    }
+
+    if (!dst->OperIs(GT_LCL_VAR) || IsIvUse(dst))
+    {
+        return false;
+    }
+
+    // Adding ints in a different order gives the same sum, adding floating point values doesn't.
+    unsigned const lclNum = dst->AsLclVarCommon()->GetLclNum();
+    if (!dst->TypeIs(TYP_INT, TYP_LONG) || m_comp->lvaGetDesc(lclNum)->IsAddressExposed() ||
+        !src->OperIs(GT_ADD) || src->gtOverflow())
+    {
+        return false;
+    }
+
+    GenTree* value;
+    if (src->gtGetOp1()->OperIs(GT_LCL_VAR) && (src->gtGetOp1()->AsLclVarCommon()->GetLclNum() == lclNum))
+    {
+        value = src->gtGetOp2();
+    }
+    else if (src->gtGetOp2()->OperIs(GT_LCL_VAR) && (src->gtGetOp2()->AsLclVarCommon()->GetLclNum() == lclNum))
+    {
+        value = src->gtGetOp1();
+    }
+    else
+    {
+        return false;
+    }
+
+    for (unsigned i = 0; i < m_bodyStmtCount; i++)
+    {
+        if (m_reductionLcls[i] == lclNum)
+        {
+            return false;
+        }
+    }
+
+    var_types elemType = dst->TypeGet();
+    if (m_elemType == TYP_UNDEF)
+    {
+        m_elemType = elemType;
+    }
+
+    // CheckValue only allows locals that aren't assigned in the loop so it also
+    // makes sure the value doesn't use the sum.
+    *pReductionLcl = lclNum;
+    return (elemType == m_elemType) && CheckValue(value);
+}
+
+//------------------------------------------------------------------------
+// CanVectorize: Check the loop is one we can vectorize, see optVectorizeLoops.
+//
+bool LoopVectorizer::CanVectorize()
+{
+    const unsigned requiredFlags = LPFLG_ITER | LPFLG_HAS_PREHEAD;
+    if (((m_loop.lpFlags & requiredFlags) != requiredFlags) ||
+        ((m_loop.lpFlags & (LPFLG_REMOVED | LPFLG_CONTAINS_CALL)) != 0))
+    {
+        return false;
+    }
+
+    if (m_loop.lpChild != BasicBlock::NOT_IN_LOOP)
+    {
+        JITDUMP("  " FMT_LP " not vectorized: not an innermost loop\n", m_loopInd);
+        return false;
+    }
+
+    // The body has to be a single block that ends with the increment and the test.
+    BasicBlock* head   = m_loop.lpHead;
+    BasicBlock* top    = m_loop.lpTop;
+    BasicBlock* bottom = m_loop.lpBottom;
+    if ((top != bottom) || (m_loop.lpEntry != top) || !bottom->KindIs(BBJ_COND) || (bottom->bbJumpDest != top) ||
+        (m_loop.lpExitCnt != 1) || (bottom->bbNext == nullptr) || !head->KindIs(BBJ_NONE) ||
+        (head->bbNext != top) || !BasicBlock::sameEHRegion(head, top) || top->isRunRarely())
+    {
+        JITDUMP("  " FMT_LP " not vectorized: not a single block loop\n", m_loopInd);
+        return false;
+    }
+
+    m_ivLclNum = m_loop.lpIterVar();
+    if ((m_loop.lpIterOper() != GT_ADD) || (m_loop.lpIterConst() != 1) || (m_loop.lpTestOper() != GT_LT) ||
+        ((m_loop.lpTestTree->gtFlags & GTF_UNSIGNED) != 0) || (m_comp->lvaGetDesc(m_ivLclNum)->TypeGet() != TYP_INT) ||
+        m_comp->lvaGetDesc(m_ivLclNum)->IsAddressExposed() || !IsIvUse(m_loop.lpIterator()) ||
+        !CheckLimit(m_loop.lpLimit()))
+    {
+        JITDUMP("  " FMT_LP " not vectorized: not a unit stride counted loop\n", m_loopInd);
+        return false;
+    }
+
+    // We evaluate the limit before the first iteration. That's only safe if the
+    // zero trip test already did.
+    Statement* initTestStmt = m_loop.lpInitBlock->lastStmt();
+    if ((initTestStmt == nullptr) || !initTestStmt->GetRootNode()->OperIs(GT_JTRUE))
+    {
+        JITDUMP("  " FMT_LP " not vectorized: no zero trip test\n", m_loopInd);
+        return false;
+    }
+
+    Statement* testStmt = bottom->lastStmt();
+    Statement* incrStmt = (testStmt == nullptr) ? nullptr : testStmt->GetPrevStmt();
+    if ((testStmt == nullptr) || (testStmt->GetRootNode()->gtGetOp1() != m_loop.lpTestTree) ||
+        (incrStmt == testStmt) || (incrStmt->GetRootNode() != m_loop.lpIterTree))
+    {
+        JITDUMP("  " FMT_LP " not vectorized: increment isn't right before the test\n", m_loopInd);
+        return false;
+    }
+
+    for (Statement* const stmt : bottom->Statements())
+    {
+        if (stmt == incrStmt)
+        {
+            break;
+        }
+
+        if (m_bodyStmtCount == MAX_BODY_STMTS)
+        {
+            JITDUMP("  " FMT_LP " not vectorized: too many statements\n", m_loopInd);
+            return false;
+        }
+
+        unsigned reductionLcl;
+        if (!CheckStatement(stmt, &reductionLcl))
+        {
+            JITDUMP("  " FMT_LP " not vectorized: can't vectorize " FMT_STMT "\n", m_loopInd, stmt->GetID());
+            return false;
+        }
+
+        m_reductionLcls[m_bodyStmtCount] = reductionLcl;
+        m_bodyStmts[m_bodyStmtCount++]   = stmt;
+    }
+
+    if (m_bodyStmtCount == 0)
+    {
+        return false;
+    }
+
+    // Different locals may point to the same array. If every access is to element
+    // "iv" of an array, that means two accesses are to the same element or to
+    // different arrays, either way doing VL iterations at once gives the same
+    // result. Spans can overlap at any offset so we don't vectorize stores when
+    // there are any.
+    if (m_hasStores && (m_hasNonArrayAccess || m_accessOffsetsDiffer))
+    {
+        JITDUMP("  " FMT_LP " not vectorized: stores may alias other accesses\n", m_loopInd);
+        return false;
+    }
+
+    // Loops with small constant trip counts are better left to the unroller.
+    if (((m_loop.lpFlags & (LPFLG_CONST_INIT | LPFLG_CONST_LIMIT)) == (LPFLG_CONST_INIT | LPFLG_CONST_LIMIT)) &&
+        ((m_loop.lpConstLimit() - m_loop.lpConstInit) < (int)(2 * VectorLength())))
+    {
+        JITDUMP("  " FMT_LP " not vectorized: too few iterations\n", m_loopInd);
+        return false;
+    }
+
+    return true;
+}
+
+//------------------------------------------------------------------------
+// VectorizeAddress: Clone an address for the vector loop, without the checks.
+//
+GenTree* LoopVectorizer::VectorizeAddress(GenTree* addr)
+{
+    bool valid = true;
+    addr       = SkipChecks(addr, &valid);
+    assert(valid);
+
+    // Don't keep the ARR_ADDR, it describes a single element.
+    if (addr->OperIs(GT_ARR_ADDR))
+    {
+        addr = addr->AsArrAddr()->Addr();
+    }
+
+    return m_comp->gtCloneExpr(addr);
+}
+
+//------------------------------------------------------------------------
+// VectorizeValue: Build the tree that computes a value for VL iterations at once.
+//
+GenTree* LoopVectorizer::VectorizeValue(GenTree* tree)
+{
+    bool valid = true;
+    tree       = SkipChecks(tree, &valid);
+    assert(valid);
+
+    CorInfoType const simdBaseJitType = SimdBaseJitType();
+
+    switch (tree->OperGet())
+    {
+        case GT_IND:
+            return m_comp->gtNewIndir(TYP_SIMD16, VectorizeAddress(tree->AsIndir()->Addr()));
+
+        case GT_LCL_VAR:
+        case GT_CNS_INT:
+        case GT_CNS_LNG:
+        case GT_CNS_DBL:
+            return m_comp->gtNewSimdCreateBroadcastNode(TYP_SIMD16, m_comp->gtCloneExpr(tree), simdBaseJitType, 16);
+
+        default:
+            return m_comp->gtNewSimdBinOpNode(tree->OperGet(), TYP_SIMD16, VectorizeValue(tree->gtGetOp1()),
+                                              VectorizeValue(tree->gtGetOp2()), simdBaseJitType, 16,
+                                              /* isSimdAsHWIntrinsic */ false);
+    }
+}
+
+//------------------------------------------------------------------------
+// InsertStmt: Add a new statement at the end of a block, and morph it.
+//
+void LoopVectorizer::InsertStmt(BasicBlock* block, GenTree* tree)
+{
+    Statement* stmt = m_comp->fgNewStmtFromTree(tree);
+    m_comp->fgInsertStmtAtEnd(block, stmt);
+    DBEXEC(m_comp->verbose, m_comp->gtDispStmt(stmt));
+    m_comp->fgMorphBlockStmt(block, stmt DEBUGARG("Loop vectorization"));
+}
+
+//------------------------------------------------------------------------
+// Vectorize: Vectorize the loop. We transform
+//
+//   H  (preheader)
+//   T  body; i = i + 1; if (i < limit) goto T
+//   X
+//
+// into
+//
+//   H  vlimit = (long)limit - (VL - 1); vacc = 0 (for each reduction)
+//   V1 if ((long)i >= vlimit) goto V3
+//   V2 vector body; i = i + VL; if ((long)i < vlimit) goto V2
+//   V3 sum = sum + vacc[0] + ... + vacc[VL - 1] (for each reduction); if (i >= limit) goto X
+//   H2 (new preheader)
+//   T  body; i = i + 1; if (i < limit) goto T    (the scalar remainder loop)
+//   X
+//
+// The limit is computed in long so "limit - (VL - 1)" can't overflow.
+//
+void LoopVectorizer::Vectorize()
+{
+    Compiler* const comp   = m_comp;
+    BasicBlock*     head   = m_loop.lpHead;
+    BasicBlock*     top    = m_loop.lpTop;
+    BasicBlock*     exit   = m_loop.lpBottom->bbNext;
+    unsigned const  vl     = VectorLength();
+    unsigned char   parent = m_loop.lpParent;
+
+    JITDUMP("Vectorizing " FMT_LP " with %u x %s\n", m_loopInd, vl, varTypeName(m_elemType));
+
+    comp->setUsesSIMDTypes(true);
+
+    unsigned const vlimitLclNum               = comp->lvaGrabTemp(true DEBUGARG("vector loop limit"));
+    comp->lvaGetDesc(vlimitLclNum)->lvType    = TYP_LONG;
+    unsigned       accLclNums[MAX_BODY_STMTS] = {};
+
+    // H: compute the vector loop limit and clear the accumulators.
+    GenTree* limit = comp->gtNewCastNode(TYP_LONG, comp->gtCloneExpr(m_loop.lpLimit()), false, TYP_LONG);
+    limit          = comp->gtNewOperNode(GT_SUB, TYP_LONG, limit, comp->gtNewIconNode(vl - 1, TYP_LONG));
+    InsertStmt(head, comp->gtNewTempAssign(vlimitLclNum, limit));
+
+    for (unsigned i = 0; i < m_bodyStmtCount; i++)
+    {
+        if (m_reductionLcls[i] != BAD_VAR_NUM)
+        {
+            accLclNums[i]                         = comp->lvaGrabTemp(true DEBUGARG("vector loop accumulator"));
+            comp->lvaGetDesc(accLclNums[i])->lvType = TYP_SIMD16;
+            InsertStmt(head, comp->gtNewTempAssign(accLclNums[i], comp->gtNewZeroConNode(TYP_SIMD16)));
+        }
+    }
+
+    // Make the new blocks.
+    BasicBlock* vtest = comp->fgNewBBafter(BBJ_COND, head, /*extendRegion*/ true);
+    BasicBlock* vbody = comp->fgNewBBafter(BBJ_COND, vtest, /*extendRegion*/ true);
+    BasicBlock* vexit = comp->fgNewBBafter(BBJ_COND, vbody, /*extendRegion*/ true);
+    BasicBlock* head2 = comp->fgNewBBafter(BBJ_NONE, vexit, /*extendRegion*/ true);
+
+    vtest->inheritWeight(head);
+    vexit->inheritWeight(head);
+    head2->inheritWeight(head);
+    vbody->inheritWeight(top);
+    vbody->scaleBBWeight(1.0 / vl);
+    weight_t const remainderWeight = head->bbWeight * (vl - 1);
+    if (top->bbWeight > remainderWeight)
+    {
+        top->scaleBBWeight(remainderWeight / top->bbWeight);
+    }
+
+    vtest->bbNatLoopNum = parent;
+    vbody->bbNatLoopNum = parent;
+    vexit->bbNatLoopNum = parent;
+    head2->bbNatLoopNum = parent;
+    vbody->bbFlags |= BBF_LOOP_HEAD;
+
+    head->bbFlags &= ~BBF_LOOP_PREHEADER;
+    head2->bbFlags |= BBF_INTERNAL | BBF_LOOP_PREHEADER;
+    comp->optUpdateLoopHead(m_loopInd, head, head2);
+
+    vtest->bbJumpDest = vexit;
+    vbody->bbJumpDest = vbody;
+    vexit->bbJumpDest = exit;
+
+    comp->fgReplacePred(top, head, head2);
+    comp->fgAddRefPred(vtest, head);
+    comp->fgAddRefPred(vbody, vtest);
+    comp->fgAddRefPred(vexit, vtest);
+    comp->fgAddRefPred(vbody, vbody);
+    comp->fgAddRefPred(vexit, vbody);
+    comp->fgAddRefPred(head2, vexit);
+    comp->fgAddRefPred(exit, vexit);
+
+    // V1: skip the vector loop if there aren't VL iterations left.
+    GenTree* iv   = comp->gtNewCastNode(TYP_LONG, comp->gtNewLclvNode(m_ivLclNum, TYP_INT), false, TYP_LONG);
+    GenTree* cond = comp->gtNewOperNode(GT_GE, TYP_INT, iv, comp->gtNewLclvNode(vlimitLclNum, TYP_LONG));
+    InsertStmt(vtest, comp->gtNewOperNode(GT_JTRUE, TYP_VOID, cond));
+
+    // V2: the vector body.
+    CorInfoType const simdBaseJitType = SimdBaseJitType();
+    for (unsigned i = 0; i < m_bodyStmtCount; i++)
+    {
+        GenTree* root = m_bodyStmts[i]->GetRootNode();
+        GenTree* dst  = root->gtGetOp1();
+        GenTree* src  = root->gtGetOp2();
+
+        if (m_reductionLcls[i] == BAD_VAR_NUM)
+        {
+            GenTree* vdst = comp->gtNewIndir(TYP_SIMD16, VectorizeAddress(dst->AsIndir()->Addr()));
+            InsertStmt(vbody, comp->gtNewAssignNode(vdst, VectorizeValue(src)));
+        }
+        else
+        {
+            bool     sumIsOp1 = src->gtGetOp1()->OperIs(GT_LCL_VAR) &&
+                            (src->gtGetOp1()->AsLclVarCommon()->GetLclNum() == m_reductionLcls[i]);
+            GenTree* value = VectorizeValue(sumIsOp1 ? src->gtGetOp2() : src->gtGetOp1());
+            GenTree* acc   = comp->gtNewSimdBinOpNode(GT_ADD, TYP_SIMD16, comp->gtNewLclvNode(accLclNums[i], TYP_SIMD16),
+                                                    value, simdBaseJitType, 16, /* isSimdAsHWIntrinsic */ false);
+            InsertStmt(vbody, comp->gtNewTempAssign(accLclNums[i], acc));
+        }
+    }
+
+    GenTree* incr = comp->gtNewOperNode(GT_ADD, TYP_INT, comp->gtNewLclvNode(m_ivLclNum, TYP_INT),
+                                        comp->gtNewIconNode(vl));
+    InsertStmt(vbody, comp->gtNewTempAssign(m_ivLclNum, incr));
+
+    iv   = comp->gtNewCastNode(TYP_LONG, comp->gtNewLclvNode(m_ivLclNum, TYP_INT), false, TYP_LONG);
+    cond = comp->gtNewOperNode(GT_LT, TYP_INT, iv, comp->gtNewLclvNode(vlimitLclNum, TYP_LONG));
+    InsertStmt(vbody, comp->gtNewOperNode(GT_JTRUE, TYP_VOID, cond));
+
+    // V3: fold the accumulators into the sums and skip the remainder loop if we're done.
+    for (unsigned i = 0; i < m_bodyStmtCount; i++)
+    {
+        if (m_reductionLcls[i] == BAD_VAR_NUM)
+        {
+            continue;
+        }
+
+        // Going through memory is the simplest way to get at the elements with just the baseline ISA,
+        // and it's done once per loop. Use a copy so the accumulator can stay in a register.
+        unsigned const spillLclNum               = comp->lvaGrabTemp(true DEBUGARG("vector loop accumulator copy"));
+        comp->lvaGetDesc(spillLclNum)->lvType    = TYP_SIMD16;
+        comp->lvaSetVarDoNotEnregister(spillLclNum DEBUGARG(DoNotEnregisterReason::LocalField));
+        InsertStmt(vexit, comp->gtNewTempAssign(spillLclNum, comp->gtNewLclvNode(accLclNums[i], TYP_SIMD16)));
+
+        GenTree* sum = comp->gtNewLclvNode(m_reductionLcls[i], m_elemType);
+        for (unsigned lane = 0; lane < vl; lane++)
+        {
+            GenTree* element = comp->gtNewLclFldNode(spillLclNum, m_elemType, lane * genTypeSize(m_elemType));
+            sum              = comp->gtNewOperNode(GT_ADD, m_elemType, sum, element);
+        }
+        InsertStmt(vexit, comp->gtNewTempAssign(m_reductionLcls[i], sum));
+    }
+
+    cond = comp->gtReverseCond(comp->gtCloneExpr(m_loop.lpTestTree));
+    InsertStmt(vexit, comp->gtNewOperNode(GT_JTRUE, TYP_VOID, cond));
+
+    // What's left is the remainder loop. It no longer starts at the initial value,
+    // so the unroller can't treat it as a constant trip count loop.
+    m_loop.lpFlags &= ~LPFLG_CONST_INIT;
+    m_loop.lpFlags |= LPFLG_DONT_UNROLL;
+}
+#endif // FEATURE_LOOP_VECTORIZATION
+
+//-----------------------------------------------------------------------------
+// optVectorizeLoops: Vectorize innermost counted loops over arrays and spans.
+//
+// Loops must be of the form:
+//   for (i = init; i < limit; i++) { ... }
+//
+// with a single block body and a zero trip test, where each statement of the
+// body is either
+//   a[i] = <value>
+// or
+//   sum = sum + <value>   (for int and long sums)
+//
+// and <value> is made of a[i] loads, locals and constants that don't change in
+// the loop, and adds, subtracts and bitwise ops (or adds, subtracts,
+// multiplies and divides for floating point). All the accesses must be to
+// elements of the same type, and bounds checks on "i" must be against the loop
+// limit, with a constant, non-negative initial value. The vector loop uses
+// Vector128 so it only needs the baseline ISA, and the original loop handles
+// the iterations that are left over.
+//
+// Returns:
+//   suitable phase status
+//
+PhaseStatus Compiler::optVectorizeLoops()
+{
+#ifdef FEATURE_LOOP_VECTORIZATION
+    if ((optLoopCount == 0) || (compCodeOpt() == SMALL_CODE) || !IsBaselineSimdIsaSupported())
+    {
+        return PhaseStatus::MODIFIED_NOTHING;
+    }
+
+    if (!JitConfig.JitDoLoopVectorization())
+    {
+        JITDUMP("Loop vectorization disabled\n");
+        return PhaseStatus::MODIFIED_NOTHING;
+    }
+
+    unsigned vectorizedCount = 0;
+    for (unsigned lnum = 0; lnum < optLoopCount; lnum++)
+    {
+        LoopVectorizer vectorizer(this, lnum);
+        if (vectorizer.CanVectorize())
+        {
+            vectorizer.Vectorize();
+            vectorizedCount++;
+        }
+    }
+
+    if (vectorizedCount == 0)
+    {
+        return PhaseStatus::MODIFIED_NOTHING;
+    }
+
+    JITDUMP("Loops vectorized: %u\n", vectorizedCount);
+    constexpr bool computePreds = false;
+    fgUpdateChangedFlowGraph(computePreds);
+
+    return PhaseStatus::MODIFIED_EVERYTHING;
+#else  // !FEATURE_LOOP_VECTORIZATION
+    return PhaseStatus::MODIFIED_NOTHING;
+#endif // !FEATURE_LOOP_VECTORIZATION
+}
+
+//-----------------------------------------------------------------------------
+// optPartialUnrollLoop: Try to partially unroll a hot loop whose trip count
+// isn't known until run time.
+//
+// Arguments:
+//   lnum - the loop to unroll
+//
+// Returns:
+//   true if the loop was unrolled.
+//
+// Notes:
+//   Loops must be single block counted loops of the form:
+//     for (i = init; i < limit; i += c) { ... }
+//
+//   (or "i <= limit") where the limit doesn't change in the loop, and must have
+//   a zero trip test. We transform
+//
+//     H  (preheader)
+//     T  body; i = i + c; if (i < limit) goto T
+//     X
+//
+//   into
+//
+//     H  ulimit = (long)limit - (N - 1) * c
+//     U1 if ((long)i >= ulimit) goto U3
+//     U2 (body; i = i + c;) x N; if ((long)i < ulimit) goto U2
+//     U3 if (i >= limit) goto X
+//     H2 (new preheader)
+//     T  body; i = i + c; if (i < limit) goto T    (the remainder loop)
+//     X
+//
+//   The body grows N times, so we only do this when profile data shows the
+//   loop is hot and usually runs enough iterations for the unrolled loop to
+//   be used. The limit is computed in long so it can't overflow.
+//
+bool Compiler::optPartialUnrollLoop(unsigned lnum)
+{
+    LoopDsc& loop = optLoopTable[lnum];
+
+    const unsigned requiredFlags = LPFLG_ITER | LPFLG_HAS_PREHEAD;
+    if (((loop.lpFlags & requiredFlags) != requiredFlags) ||
+        ((loop.lpFlags & (LPFLG_DONT_UNROLL | LPFLG_REMOVED)) != 0) ||
+        ((loop.lpFlags & (LPFLG_CONST_LIMIT | LPFLG_VAR_LIMIT | LPFLG_ARRLEN_LIMIT)) == 0) ||
+        (loop.lpChild != BasicBlock::NOT_IN_LOOP))
+    {
+        // Don't print to the JitDump about this common case.
+        return false;
+    }
+
+    if (!JitConfig.JitPartialUnrollLoops())
+    {
+        return false;
+    }
+
+    // Code size only grows where profile data says the loop is hot.
+    BasicBlock* head   = loop.lpHead;
+    BasicBlock* top    = loop.lpTop;
+    BasicBlock* bottom = loop.lpBottom;
+    if (!fgHaveProfileWeights() || !head->hasProfileWeight() || !top->hasProfileWeight() || top->isRunRarely() ||
+        (head->bbWeight <= BB_ZERO_WEIGHT))
+    {
+        JITDUMP("Failed to partially unroll loop " FMT_LP ": no profile data\n", lnum);
+        return false;
+    }
+
+    if ((top != bottom) || (loop.lpEntry != top) || !bottom->KindIs(BBJ_COND) || (bottom->bbJumpDest != top) ||
+        (loop.lpExitCnt != 1) || (bottom->bbNext == nullptr) || !head->KindIs(BBJ_NONE) || (head->bbNext != top) ||
+        !BasicBlock::sameEHRegion(head, top))
+    {
+        JITDUMP("Failed to partially unroll loop " FMT_LP ": not a single block loop\n", lnum);
+        return false;
+    }
+
+    unsigned const   lvar     = loop.lpIterVar();
+    int const        iterInc  = loop.lpIterConst();
+    genTreeOps const testOper = loop.lpTestOper();
+    if ((loop.lpIterOper() != GT_ADD) || (iterInc <= 0) || ((testOper != GT_LT) && (testOper != GT_LE)) ||
+        ((loop.lpTestTree->gtFlags & GTF_UNSIGNED) != 0) || (lvaGetDesc(lvar)->TypeGet() != TYP_INT) ||
+        lvaGetDesc(lvar)->IsAddressExposed() || lvaGetDesc(lvar)->lvIsStructField)
+    {
+        JITDUMP("Failed to partially unroll loop " FMT_LP ": not an increasing counted loop\n", lnum);
+        return false;
+    }
+
+    // We evaluate the limit before the first iteration. That's only safe if the
+    // zero trip test already did.
+    Statement* initTestStmt = loop.lpInitBlock->lastStmt();
+    if ((initTestStmt == nullptr) || !initTestStmt->GetRootNode()->OperIs(GT_JTRUE))
+    {
+        JITDUMP("Failed to partially unroll loop " FMT_LP ": no zero trip test\n", lnum);
+        return false;
+    }
+
+    Statement* testStmt = bottom->lastStmt();
+    Statement* incrStmt = testStmt->GetPrevStmt();
+    if ((testStmt->GetRootNode()->gtGetOp1() != loop.lpTestTree) || (incrStmt == testStmt) ||
+        (incrStmt->GetRootNode() != loop.lpIterTree))
+    {
+        JITDUMP("Failed to partially unroll loop " FMT_LP ": increment isn't right before the test\n", lnum);
+        return false;
+    }
+
+    // Pick the unroll factor from the average trip count and the size of the body.
+    static const unsigned UNROLL_LIMIT_SZ[COUNT_OPT_CODE + 1] = {
+        150, // BLENDED_CODE
+        0,   // SMALL_CODE
+        300, // FAST_CODE
+        0    // COUNT_OPT_CODE
+    };
+
+    ClrSafeInt<unsigned> loopCostSz;
+    for (Statement* const stmt : bottom->Statements())
+    {
+        gtSetStmtInfo(stmt);
+        loopCostSz += stmt->GetCostSz();
+    }
+
+    weight_t const tripCount = top->bbWeight / head->bbWeight;
+    unsigned       factor    = 0;
+    for (unsigned candidate = 4; candidate >= 2; candidate /= 2)
+    {
+        ClrSafeInt<unsigned> unrollCostSz = loopCostSz * ClrSafeInt<unsigned>(candidate - 1);
+        if ((tripCount >= 4 * candidate) && !unrollCostSz.IsOverflow() &&
+            (unrollCostSz.Value() <= UNROLL_LIMIT_SZ[compCodeOpt()]))
+        {
+            factor = candidate;
+            break;
+        }
+    }
+
+    if (factor == 0)
+    {
+        JITDUMP("Failed to partially unroll loop " FMT_LP ": trip count " FMT_WT " or size %u too big (heuristic)\n",
+                lnum, tripCount, loopCostSz.IsOverflow() ? UINT_MAX : loopCostSz.Value());
+        return false;
+    }
+
+    // Clone the body before changing anything, gtCloneExpr may fail.
+    ArrayStack<GenTree*> clones(getAllocator(CMK_LoopOpt));
+    for (unsigned copy = 0; copy < factor; copy++)
+    {
+        for (Statement* const stmt : bottom->Statements())
+        {
+            if (stmt == testStmt)
+            {
+                break;
+            }
+
+            GenTree* clone = gtCloneExpr(stmt->GetRootNode());
+            if (clone == nullptr)
+            {
+                JITDUMP("Failed to partially unroll loop " FMT_LP ": can't clone " FMT_STMT "\n", lnum,
+                        stmt->GetID());
+                loop.lpFlags |= LPFLG_DONT_UNROLL;
+                return false;
+            }
+            clones.Push(clone);
+        }
+    }
+
+    JITDUMP("Partially unrolling loop " FMT_LP " by %u, average trip count " FMT_WT "\n", lnum, factor, tripCount);
+
+    BasicBlock*   exit   = bottom->bbNext;
+    unsigned char parent = loop.lpParent;
+
+    auto insertStmt = [this](BasicBlock* block, GenTree* tree) {
+        Statement* stmt = fgNewStmtFromTree(tree);
+        fgInsertStmtAtEnd(block, stmt);
+        DBEXEC(verbose, gtDispStmt(stmt));
+        fgMorphBlockStmt(block, stmt DEBUGARG("Partial loop unrolling"));
+    };
+
+    // H: compute the unrolled loop limit.
+    unsigned const ulimitLclNum      = lvaGrabTemp(true DEBUGARG("unrolled loop limit"));
+    lvaGetDesc(ulimitLclNum)->lvType = TYP_LONG;
+    GenTree* limit = gtNewCastNode(TYP_LONG, gtCloneExpr(loop.lpLimit()), false, TYP_LONG);
+    limit          = gtNewOperNode(GT_SUB, TYP_LONG, limit, gtNewIconNode((ssize_t)(factor - 1) * iterInc, TYP_LONG));
+    insertStmt(head, gtNewTempAssign(ulimitLclNum, limit));
+
+    // Make the new blocks.
+    BasicBlock* utest = fgNewBBafter(BBJ_COND, head, /*extendRegion*/ true);
+    BasicBlock* ubody = fgNewBBafter(BBJ_COND, utest, /*extendRegion*/ true);
+    BasicBlock* uexit = fgNewBBafter(BBJ_COND, ubody, /*extendRegion*/ true);
+    BasicBlock* head2 = fgNewBBafter(BBJ_NONE, uexit, /*extendRegion*/ true);
+
+    utest->inheritWeight(head);
+    uexit->inheritWeight(head);
+    head2->inheritWeight(head);
+    ubody->inheritWeight(top);
+    ubody->scaleBBWeight(1.0 / factor);
+    weight_t const remainderWeight = head->bbWeight * (factor - 1);
+    if (top->bbWeight > remainderWeight)
+    {
+        top->scaleBBWeight(remainderWeight / top->bbWeight);
+    }
+
+    utest->bbNatLoopNum = parent;
+    ubody->bbNatLoopNum = parent;
+    uexit->bbNatLoopNum = parent;
+    head2->bbNatLoopNum = parent;
+    ubody->bbFlags |= BBF_LOOP_HEAD | (top->bbFlags & BBF_COPY_PROPAGATE);
+
+    head->bbFlags &= ~BBF_LOOP_PREHEADER;
+    head2->bbFlags |= BBF_INTERNAL | BBF_LOOP_PREHEADER;
+    optUpdateLoopHead(lnum, head, head2);
+
+    utest->bbJumpDest = uexit;
+    ubody->bbJumpDest = ubody;
+    uexit->bbJumpDest = exit;
+
+    fgReplacePred(top, head, head2);
+    fgAddRefPred(utest, head);
+    fgAddRefPred(ubody, utest);
+    fgAddRefPred(uexit, utest);
+    fgAddRefPred(ubody, ubody);
+    fgAddRefPred(uexit, ubody);
+    fgAddRefPred(head2, uexit);
+    fgAddRefPred(exit, uexit);
+
+    // U1: skip the unrolled loop if there aren't enough iterations left.
+    GenTree* iv   = gtNewCastNode(TYP_LONG, gtNewLclvNode(lvar, TYP_INT), false, TYP_LONG);
+    GenTree* cond = gtNewOperNode(GenTree::ReverseRelop(testOper), TYP_INT, iv, gtNewLclvNode(ulimitLclNum, TYP_LONG));
+    insertStmt(utest, gtNewOperNode(GT_JTRUE, TYP_VOID, cond));
+
+    // U2: the unrolled body. The clones are already morphed.
+    for (int i = 0; i < clones.Height(); i++)
+    {
+        fgInsertStmtAtEnd(ubody, fgNewStmtFromTree(clones.Bottom(i)));
+    }
+
+    iv   = gtNewCastNode(TYP_LONG, gtNewLclvNode(lvar, TYP_INT), false, TYP_LONG);
+    cond = gtNewOperNode(testOper, TYP_INT, iv, gtNewLclvNode(ulimitLclNum, TYP_LONG));
+    insertStmt(ubody, gtNewOperNode(GT_JTRUE, TYP_VOID, cond));
+
+    // U3: skip the remainder loop if we're done.
+    cond = gtReverseCond(gtCloneExpr(loop.lpTestTree));
+    insertStmt(uexit, gtNewOperNode(GT_JTRUE, TYP_VOID, cond));
+
+    // What's left is the remainder loop. It no longer starts at the initial value,
+    // so it can't be treated as a constant trip count loop.
+    loop.lpFlags &= ~LPFLG_CONST_INIT;
+    loop.lpFlags |= LPFLG_DONT_UNROLL;
+
+    return true;
+}
+
 #ifdef _PREFAST_
 #pragma warning(push)
 #pragma warning(disable : 21000) // Suppress PREFast warning about overly large function
@@ -3991,7 +5061,8 @@ bool Compiler::optComputeLoopRep(int        constInit,
 // Loops must be of the form:
 //   for (i=icon; i<icon; i++) { ... }
 //
-// Loops handled are fully unrolled; there is no partial unrolling.
+// Loops handled here are fully unrolled. Hot loops whose trip count is only known at run time
+// may be partially unrolled instead, see optPartialUnrollLoop.
 //
 // Limitations: only the following loop types are handled:
 // 1. "while" loops (top entry)
@@ -4113,6 +5184,12 @@ PhaseStatus Compiler::optUnrollLoops()
         const unsigned requiredFlags = LPFLG_CONST_INIT | LPFLG_CONST_LIMIT;
         if ((loopFlags & requiredFlags) != requiredFlags)
         {
+            if (optPartialUnrollLoop(lnum))
+            {
+                INDEBUG(++unrollCount);
+                change = true;
+            }
+
             // Don't print to the JitDump about this common case.
             continue;
         }
@@ -4499,100 +5576,460 @@ PhaseStatus Compiler::optUnrollLoops()
             }
             else
             {
-                /* the loop must execute */
-                noway_assert(head->bbJumpKind == BBJ_NONE);
+                /* the loop must execute */
+                noway_assert(head->bbJumpKind == BBJ_NONE);
+            }
+
+#ifdef DEBUG
+            if (verbose)
+            {
+                printf("Whole unrolled loop:\n");
+
+                gtDispTree(initStmt->GetRootNode());
+                printf("\n");
+                fgDumpTrees(top, insertAfter);
+
+                if (anyNestedLoopsUnrolledThisLoop)
+                {
+                    printf("Unrolled loop " FMT_LP " contains nested loops\n", lnum);
+                }
+            }
+#endif // DEBUG
+
+            // Update loop table.
+            optMarkLoopRemoved(lnum);
+
+            // Note if we created new BBJ_RETURNs (or removed some).
+            if (totalIter > 0)
+            {
+                fgReturnCount += loopRetCount * (totalIter - 1);
+            }
+            else
+            {
+                assert(totalIter == 0);
+                assert(fgReturnCount >= loopRetCount);
+                fgReturnCount -= loopRetCount;
+            }
+
+            // Remember that something has changed.
+            INDEBUG(++unrollCount);
+            change = true;
+        }
+
+    DONE_LOOP:;
+    }
+
+    if (change)
+    {
+#ifdef DEBUG
+        if (verbose)
+        {
+            printf("\nFinished unrolling %d loops", unrollCount);
+            if (unrollFailures > 0)
+            {
+                printf(", %d failures due to block cloning", unrollFailures);
+            }
+            printf("\n");
+            if (anyNestedLoopsUnrolled)
+            {
+                printf("At least one unrolled loop contains nested loops; recomputing loop table\n");
+            }
+        }
+#endif // DEBUG
+
+        // If we unrolled any nested loops, we rebuild the loop table (including recomputing the
+        // return blocks list).
+
+        constexpr bool computePreds        = true;
+        constexpr bool computeDoms         = true;
+        const bool     computeReturnBlocks = anyNestedLoopsUnrolled;
+        const bool     computeLoops        = anyNestedLoopsUnrolled;
+        fgUpdateChangedFlowGraph(computePreds, computeDoms, computeReturnBlocks, computeLoops);
+
+        DBEXEC(verbose, fgDispBasicBlocks());
+    }
+    else
+    {
+#ifdef DEBUG
+        assert(unrollCount == 0);
+        assert(!anyNestedLoopsUnrolled);
+
+        if (unrollFailures > 0)
+        {
+            printf("\nFinished loop unrolling, %d failures due to block cloning\n", unrollFailures);
+        }
+#endif // DEBUG
+    }
+
+#ifdef DEBUG
+    fgDebugCheckBBlist(true);
+#endif // DEBUG
+
+    return PhaseStatus::MODIFIED_EVERYTHING;
+}
+#ifdef _PREFAST_
+#pragma warning(pop)
+#endif
+
+#ifdef TARGET_AMD64
+//-----------------------------------------------------------------------------
+// IVWidenVisitor: finds and rewrites the references to an int induction
+// variable that optWidenInductionVariables retypes to long.
+//
+class IVWidenVisitor final : public GenTreeVisitor<IVWidenVisitor>
+{
+    const unsigned m_lclNum;
+    const bool     m_rewrite;
+    GenTree*       m_iterTree; // increment of the loop that owns the current statement, if any
+
+public:
+    enum
+    {
+        DoPostOrder = true
+    };
+
+    bool     m_bail       = false;
+    unsigned m_extensions = 0; // number of sign extensions that become free
+
+    IVWidenVisitor(Compiler* comp, unsigned lclNum, bool rewrite)
+        : GenTreeVisitor(comp), m_lclNum(lclNum), m_rewrite(rewrite), m_iterTree(nullptr)
+    {
+    }
+
+    void SetIterTree(GenTree* iterTree)
+    {
+        m_iterTree = iterTree;
+    }
+
+    fgWalkResult PostOrderVisit(GenTree** use, GenTree* user)
+    {
+        GenTree* const node = *use;
+
+        if (node->OperIsLocal() || node->OperIsLocalAddr())
+        {
+            if (node->AsLclVarCommon()->GetLclNum() != m_lclNum)
+            {
+                return fgWalkResult::WALK_CONTINUE;
             }
 
-#ifdef DEBUG
-            if (verbose)
+            if (!node->OperIs(GT_LCL_VAR))
             {
-                printf("Whole unrolled loop:\n");
+                m_bail = true;
+                return fgWalkResult::WALK_ABORT;
+            }
 
-                gtDispTree(initStmt->GetRootNode());
-                printf("\n");
-                fgDumpTrees(top, insertAfter);
+            if ((node->gtFlags & GTF_VAR_DEF) != 0)
+            {
+                // Inside the loop the increment has to be the only def, otherwise we
+                // don't know the value stays in [0, INT_MAX].
+                if (!user->OperIs(GT_ASG) || user->gtGetOp2()->OperIs(GT_QMARK) ||
+                    ((m_iterTree != nullptr) && (user != m_iterTree)))
+                {
+                    m_bail = true;
+                    return fgWalkResult::WALK_ABORT;
+                }
 
-                if (anyNestedLoopsUnrolledThisLoop)
+                if (m_rewrite)
                 {
-                    printf("Unrolled loop " FMT_LP " contains nested loops\n", lnum);
+                    node->ChangeType(TYP_LONG);
                 }
+                return fgWalkResult::WALK_CONTINUE;
             }
-#endif // DEBUG
 
-            // Update loop table.
-            optMarkLoopRemoved(lnum);
+            // Range check can't see through the truncation, so it would no longer remove
+            // bounds checks that are done with the IV.
+            if ((m_iterTree != nullptr) && (user != nullptr) && user->OperIs(GT_BOUNDS_CHECK))
+            {
+                m_bail = true;
+                return fgWalkResult::WALK_ABORT;
+            }
 
-            // Note if we created new BBJ_RETURNs (or removed some).
-            if (totalIter > 0)
+            if (IsFoldableExtension(user))
             {
-                fgReturnCount += loopRetCount * (totalIter - 1);
+                m_extensions++;
             }
-            else
+
+            if (m_rewrite)
             {
-                assert(totalIter == 0);
-                assert(fgReturnCount >= loopRetCount);
-                fgReturnCount -= loopRetCount;
+                node->ChangeType(TYP_LONG);
+                if (!IsFoldableExtension(user) && !IsIncrement(user))
+                {
+                    *use = m_compiler->gtNewCastNode(TYP_INT, node, false, TYP_INT);
+                }
             }
+            return fgWalkResult::WALK_CONTINUE;
+        }
 
-            // Remember that something has changed.
-            INDEBUG(++unrollCount);
-            change = true;
+        if (!m_rewrite)
+        {
+            return fgWalkResult::WALK_CONTINUE;
         }
 
-    DONE_LOOP:;
+        if (node->OperIs(GT_CAST) && node->AsCast()->CastOp()->OperIs(GT_LCL_VAR) &&
+            (node->AsCast()->CastOp()->AsLclVar()->GetLclNum() == m_lclNum))
+        {
+            // We only get here for extensions that were kept, the others got a truncation in between.
+            assert(m_iterTree != nullptr);
+            *use = node->AsCast()->CastOp();
+        }
+        else if (IsIncrement(node))
+        {
+            node->ChangeType(TYP_LONG);
+            node->gtGetOp2()->ChangeType(TYP_LONG);
+        }
+        else if (node->OperIs(GT_ASG) && node->gtGetOp1()->OperIs(GT_LCL_VAR) &&
+                 (node->gtGetOp1()->AsLclVar()->GetLclNum() == m_lclNum))
+        {
+            node->ChangeType(TYP_LONG);
+            if (node != m_iterTree)
+            {
+                GenTree*& value = node->AsOp()->gtOp2;
+                if (value->IsCnsIntOrI())
+                {
+                    value = m_compiler->gtNewIconNode(value->AsIntCon()->IconValue(), TYP_LONG);
+                }
+                else
+                {
+                    value = m_compiler->gtNewCastNode(TYP_LONG, value, false, TYP_LONG);
+                }
+            }
+        }
+
+        return fgWalkResult::WALK_CONTINUE;
     }
 
-    if (change)
+private:
+    // Is "user" a sign (or zero) extension of the IV that we can replace with the wide IV?
+    // That's only known to be exact inside the loop.
+    bool IsFoldableExtension(GenTree* user) const
     {
-#ifdef DEBUG
-        if (verbose)
+        return (m_iterTree != nullptr) && (user != nullptr) && user->OperIs(GT_CAST) && !user->gtOverflow() &&
+               varTypeIsLong(user->AsCast()->CastToType());
+    }
+
+    // Is "node" the "i + c" of the loop increment?
+    bool IsIncrement(GenTree* node) const
+    {
+        return (m_iterTree != nullptr) && (node == m_iterTree->gtGetOp2());
+    }
+};
+
+//-----------------------------------------------------------------------------
+// optWidenIV: Retype an int induction variable to long.
+//
+// Arguments:
+//   lclNum - the induction variable
+//   loops  - the loops it is the iterator of that were proven not to overflow
+//   iterTrees - the increments of those loops, indexed by loop number
+//
+// Returns:
+//   true if the induction variable was widened.
+//
+// Notes:
+//   Outside of "loops" every def becomes a sign extension and every use a
+//   truncation so the value is unchanged. Inside them the value stays in
+//   [0, INT_MAX], where extending is a no-op, so "(long)i" is just the wide
+//   local. That is the sign extension this saves, for every array access
+//   indexed by the IV.
+//
+bool Compiler::optWidenIV(unsigned lclNum, uint64_t loops, GenTree** iterTrees)
+{
+    LclVarDsc* const varDsc = lvaGetDesc(lclNum);
+    if ((varDsc->TypeGet() != TYP_INT) || varDsc->IsAddressExposed() || varDsc->lvIsStructField ||
+        varDsc->lvIsParam || varDsc->lvPinned || lvaIsOSRLocal(lclNum))
+    {
+        return false;
+    }
+
+    // Find the loop in "loops" that contains the block, if any. Loops in "loops"
+    // can't nest, the inner loop's increment would be a second def in the outer one.
+    bool nested      = false;
+    auto getIterTree = [=, &nested](BasicBlock* block) -> GenTree* {
+        GenTree* iterTree = nullptr;
+        for (unsigned lnum = block->bbNatLoopNum; lnum != BasicBlock::NOT_IN_LOOP; lnum = optLoopTable[lnum].lpParent)
         {
-            printf("\nFinished unrolling %d loops", unrollCount);
-            if (unrollFailures > 0)
+            if ((loops & ((uint64_t)1 << lnum)) != 0)
             {
-                printf(", %d failures due to block cloning", unrollFailures);
+                nested |= (iterTree != nullptr);
+                iterTree = iterTrees[lnum];
             }
-            printf("\n");
-            if (anyNestedLoopsUnrolled)
+        }
+        return iterTree;
+    };
+
+    IVWidenVisitor checker(this, lclNum, /* rewrite */ false);
+    for (BasicBlock* const block : Blocks())
+    {
+        checker.SetIterTree(getIterTree(block));
+        if (nested)
+        {
+            JITDUMP("Not widening V%02u: iterator of nested loops\n", lclNum);
+            return false;
+        }
+
+        for (Statement* const stmt : block->Statements())
+        {
+            checker.WalkTree(stmt->GetRootNodePointer(), nullptr);
+            if (checker.m_bail)
             {
-                printf("At least one unrolled loop contains nested loops; recomputing loop table\n");
+                JITDUMP("Not widening V%02u: address taken, assigned or bounds checked in the loop\n", lclNum);
+                return false;
             }
         }
-#endif // DEBUG
+    }
 
-        // If we unrolled any nested loops, we rebuild the loop table (including recomputing the
-        // return blocks list).
+    if (checker.m_extensions == 0)
+    {
+        JITDUMP("Not widening V%02u: not extended in the loop\n", lclNum);
+        return false;
+    }
 
-        constexpr bool computePreds        = true;
-        constexpr bool computeDoms         = true;
-        const bool     computeReturnBlocks = anyNestedLoopsUnrolled;
-        const bool     computeLoops        = anyNestedLoopsUnrolled;
-        fgUpdateChangedFlowGraph(computePreds, computeDoms, computeReturnBlocks, computeLoops);
+    JITDUMP("Widening V%02u, saves %u extensions\n", lclNum, checker.m_extensions);
 
-        DBEXEC(verbose, fgDispBasicBlocks());
+    IVWidenVisitor rewriter(this, lclNum, /* rewrite */ true);
+    for (BasicBlock* const block : Blocks())
+    {
+        rewriter.SetIterTree(getIterTree(block));
+        for (Statement* const stmt : block->Statements())
+        {
+            rewriter.WalkTree(stmt->GetRootNodePointer(), nullptr);
+        }
     }
-    else
+
+    varDsc->lvType = TYP_LONG;
+    return true;
+}
+#endif // TARGET_AMD64
+
+//-----------------------------------------------------------------------------
+// optWidenInductionVariables: Widen int induction variables to long where
+// that is exact, so that indexing with them doesn't need a sign extension.
+//
+// Returns:
+//   suitable phase status
+//
+// Notes:
+//   This runs while the loop table still describes the iterators. A loop
+//       for (i = init; i < limit; i += c) { ... }
+//   (or "i <= limit" with a constant limit) with a non-negative constant init,
+//   no other def of i in the loop and no chance of "i += c" overflowing keeps
+//   i in [0, INT_MAX], the same thing range check would prove for it.
+//
+//   Loops that still bounds check with the IV are left alone, range check
+//   needs the int IV to remove those checks.
+//
+//   Only done for x64, arm64 already folds the extension into the address mode.
+//
+PhaseStatus Compiler::optWidenInductionVariables()
+{
+#ifdef TARGET_AMD64
+    if (optLoopCount == 0)
     {
-#ifdef DEBUG
-        assert(unrollCount == 0);
-        assert(!anyNestedLoopsUnrolled);
+        return PhaseStatus::MODIFIED_NOTHING;
+    }
 
-        if (unrollFailures > 0)
+    if (!JitConfig.JitWidenIVs())
+    {
+        JITDUMP("IV widening disabled\n");
+        return PhaseStatus::MODIFIED_NOTHING;
+    }
+
+    // Look at all the loops before changing anything, widening one IV changes the
+    // trees of other loops that use it as the limit.
+    GenTree* iterTrees[BasicBlock::MAX_LOOP_NUM] = {};
+    uint64_t candidates                          = 0;
+    for (unsigned lnum = 0; lnum < optLoopCount; lnum++)
+    {
+        LoopDsc& loop = optLoopTable[lnum];
+
+        const unsigned requiredFlags = LPFLG_ITER | LPFLG_CONST_INIT;
+        if (((loop.lpFlags & requiredFlags) != requiredFlags) || ((loop.lpFlags & LPFLG_REMOVED) != 0))
         {
-            printf("\nFinished loop unrolling, %d failures due to block cloning\n", unrollFailures);
+            continue;
         }
-#endif // DEBUG
+
+        int const iterInc = loop.lpIterConst();
+        if ((loop.lpIterOper() != GT_ADD) || (iterInc <= 0) || loop.lpIterTree->gtGetOp2()->gtOverflow() ||
+            ((loop.lpTestTree->gtFlags & GTF_UNSIGNED) != 0) || (loop.lpConstInit < 0) ||
+            (loop.lpConstInit > INT_MAX - iterInc))
+        {
+            continue;
+        }
+
+        // The test has to pass before every increment but the first. It gives
+        // i < limit <= INT_MAX, so "i + c" can't overflow when c is 1; other
+        // increments need a constant limit to tell.
+        genTreeOps const testOper = loop.lpTestOper();
+        int              maxLimit;
+        if (testOper == GT_LT)
+        {
+            maxLimit = (iterInc == 1) ? INT_MAX : (INT_MAX - iterInc + 1);
+        }
+        else if (testOper == GT_LE)
+        {
+            maxLimit = INT_MAX - iterInc;
+        }
+        else
+        {
+            continue;
+        }
+
+        if ((maxLimit != INT_MAX) && (((loop.lpFlags & LPFLG_CONST_LIMIT) == 0) || (loop.lpConstLimit() > maxLimit)))
+        {
+            continue;
+        }
+
+        // The increment is right before the test at the bottom, and the loop continues on the test.
+        BasicBlock* const bottom   = loop.lpBottom;
+        Statement* const  testStmt = bottom->lastStmt();
+        if (!bottom->KindIs(BBJ_COND) || (bottom->bbJumpDest != loop.lpTop) || (testStmt == nullptr) ||
+            (testStmt->GetRootNode()->gtGetOp1() != loop.lpTestTree) || (testStmt->GetPrevStmt() == testStmt) ||
+            (testStmt->GetPrevStmt()->GetRootNode() != loop.lpIterTree))
+        {
+            continue;
+        }
+
+        JITDUMP(FMT_LP ": V%02u stays in [0, INT_MAX]\n", lnum, loop.lpIterVar());
+        iterTrees[lnum] = loop.lpIterTree;
+        candidates |= (uint64_t)1 << lnum;
     }
 
-#ifdef DEBUG
-    fgDebugCheckBBlist(true);
-#endif // DEBUG
+    bool changed = false;
+    for (unsigned lnum = 0; lnum < optLoopCount; lnum++)
+    {
+        if ((candidates & ((uint64_t)1 << lnum)) == 0)
+        {
+            continue;
+        }
+
+        // Handle all the loops that use the same IV at once.
+        unsigned const lclNum = iterTrees[lnum]->gtGetOp1()->AsLclVar()->GetLclNum();
+        uint64_t       loops  = 0;
+        for (unsigned other = lnum; other < optLoopCount; other++)
+        {
+            if (((candidates & ((uint64_t)1 << other)) != 0) &&
+                (iterTrees[other]->gtGetOp1()->AsLclVar()->GetLclNum() == lclNum))
+            {
+                loops |= (uint64_t)1 << other;
+            }
+        }
+        candidates &= ~loops;
+
+        changed |= optWidenIV(lclNum, loops, iterTrees);
+    }
+
+    if (!changed)
+    {
+        return PhaseStatus::MODIFIED_NOTHING;
+    }
 
+    // The iterator info no longer matches the trees.
+    optClearLoopIterInfo();
     return PhaseStatus::MODIFIED_EVERYTHING;
+#else  // !TARGET_AMD64
+    return PhaseStatus::MODIFIED_NOTHING;
+#endif // !TARGET_AMD64
 }
-#ifdef _PREFAST_
-#pragma warning(pop)
-#endif
 
 //-----------------------------------------------------------------------------
 // optIfConvert
@@ -5616,7 +7053,8 @@ PhaseStatus Compiler::optOptimizeFlow()
 //   suitable phase status
 //
 // Notes:
-//   Reorders using profile data, if available.
+//   Reorders using profile data, if available. With profile data, the hot
+//   blocks then get an ext-TSP layout over the edge weights.
 //
 PhaseStatus Compiler::optOptimizeLayout()
 {
@@ -5626,6 +7064,7 @@ PhaseStatus Compiler::optOptimizeLayout()
 
     madeChanges |= fgUpdateFlowGraph(/* allowTailDuplication */ false);
     madeChanges |= fgReorderBlocks(/* useProfile */ true);
+    madeChanges |= fgReorderBlocksExtTSP();
     madeChanges |= fgUpdateFlowGraph();
 
     // fgReorderBlocks can cause IR changes even if it does not modify
@@ -8830,6 +10269,113 @@ void Compiler::optRecordLoopNestsMemoryHavoc(unsigned lnum, MemoryKindSet memory
     }
 }
 
+//------------------------------------------------------------------------
+// optComputeLoopSideEffectsOfStore: Record the memory modified by a store
+//    through an address in the loops containing the store.
+//
+// Arguments:
+//    lnum      - the most nested loop containing the store
+//    addr      - address stored to
+//    storeSize - number of bytes stored
+//
+// Returns:
+//    The memory kinds the store has arbitrary effects on. Stores to fields
+//    and array elements are recorded as modifying just that field or array
+//    element type, so they don't prevent hoisting of loads of other fields
+//    or element types out of the loop.
+//
+// Notes:
+//    Like value numbering (see "VNForStore"), stores that extend past the
+//    end of the field or array element they start in are treated as having
+//    arbitrary effects on GcHeap and ByrefExposed.
+//
+MemoryKindSet Compiler::optComputeLoopSideEffectsOfStore(unsigned lnum, GenTree* addr, unsigned storeSize)
+{
+    GenTree* arg = addr->gtEffectiveVal(/*commaOnly*/ true);
+
+    if (arg->TypeGet() == TYP_BYREF && arg->OperGet() == GT_LCL_VAR)
+    {
+        // If it's a local byref for which we recorded a value number, use that...
+        GenTreeLclVar* argLcl = arg->AsLclVar();
+        if (argLcl->HasSsaName())
+        {
+            ValueNum argVN = lvaTable[argLcl->GetLclNum()].GetPerSsaData(argLcl->GetSsaNum())->m_vnPair.GetLiberal();
+            VNFuncApp funcApp;
+            if (argVN != ValueNumStore::NoVN && vnStore->GetVNFunc(argVN, &funcApp) &&
+                funcApp.m_func == VNF_PtrToArrElem)
+            {
+                assert(vnStore->IsVNHandle(funcApp.m_args[0]));
+                CORINFO_CLASS_HANDLE elemType = CORINFO_CLASS_HANDLE(vnStore->ConstantValue<size_t>(funcApp.m_args[0]));
+                ssize_t              offset   = vnStore->ConstantValue<ssize_t>(funcApp.m_args[3]);
+                var_types            elemVarType = DecodeElemType(elemType);
+                unsigned             elemSize =
+                    (elemVarType == TYP_STRUCT) ? info.compCompHnd->getClassSize(elemType) : genTypeSize(elemVarType);
+
+                if ((offset < 0) || (elemSize < (static_cast<unsigned>(offset) + storeSize)))
+                {
+                    return memoryKindSet(GcHeap, ByrefExposed);
+                }
+
+                AddModifiedElemTypeAllContainingLoops(lnum, elemType);
+                // Don't set memoryHavoc for GcHeap below.  Do set memoryHavoc for ByrefExposed
+                // (conservatively assuming that a byref may alias the array element)
+                return memoryKindSet(ByrefExposed);
+            }
+        }
+
+        // Otherwise...
+        return memoryKindSet(GcHeap, ByrefExposed);
+    }
+
+    GenTreeArrAddr* arrAddr  = nullptr;
+    GenTree*        baseAddr = nullptr;
+    FieldSeq*       fldSeq   = nullptr;
+    ssize_t         offset   = 0;
+
+    if (arg->IsArrayAddr(&arrAddr))
+    {
+        var_types elemType = arrAddr->GetElemType();
+        unsigned  elemSize = (elemType == TYP_STRUCT) ? info.compCompHnd->getClassSize(arrAddr->GetElemClassHandle())
+                                                      : genTypeSize(elemType);
+
+        // The offset within the element isn't known here, so only stores no bigger than an element
+        // are known to stay within elements of this array type.
+        if (elemSize < storeSize)
+        {
+            return memoryKindSet(GcHeap, ByrefExposed);
+        }
+
+        // We will not collect "fldSeq" -- any modification to an S[], at
+        // any field of "S", will lose all information about the array type.
+        CORINFO_CLASS_HANDLE elemTypeEq = EncodeElemType(elemType, arrAddr->GetElemClassHandle());
+        AddModifiedElemTypeAllContainingLoops(lnum, elemTypeEq);
+        // Conservatively assume byrefs may alias this array element
+        return memoryKindSet(ByrefExposed);
+    }
+
+    if (arg->IsFieldAddr(this, &baseAddr, &fldSeq, &offset))
+    {
+        assert(fldSeq != nullptr);
+
+        CORINFO_CLASS_HANDLE fieldClass = NO_CLASS_HANDLE;
+        var_types            fieldType  = eeGetFieldType(fldSeq->GetFieldHandle(), &fieldClass);
+        unsigned             fieldSize =
+            (fieldType == TYP_STRUCT) ? info.compCompHnd->getClassSize(fieldClass) : genTypeSize(fieldType);
+
+        if ((offset < 0) || (fieldSize < (static_cast<unsigned>(offset) + storeSize)))
+        {
+            return memoryKindSet(GcHeap, ByrefExposed);
+        }
+
+        FieldKindForVN fieldKind = (baseAddr != nullptr) ? FieldKindForVN::WithBaseAddr : FieldKindForVN::SimpleStatic;
+        AddModifiedFieldAllContainingLoops(lnum, fldSeq->GetFieldHandle(), fieldKind);
+        // Conservatively assume byrefs may alias this object.
+        return memoryKindSet(ByrefExposed);
+    }
+
+    return memoryKindSet(GcHeap, ByrefExposed);
+}
+
 bool Compiler::optComputeLoopSideEffectsOfBlock(BasicBlock* blk)
 {
     unsigned mostNestedLoop = blk->bbNatLoopNum;
@@ -8883,71 +10429,14 @@ bool Compiler::optComputeLoopSideEffectsOfBlock(BasicBlock* blk)
 
                 if (lhs->OperGet() == GT_IND)
                 {
-                    GenTree* arg = lhs->AsOp()->gtOp1->gtEffectiveVal(/*commaOnly*/ true);
-
                     if ((tree->gtFlags & GTF_IND_VOLATILE) != 0)
                     {
                         memoryHavoc |= memoryKindSet(GcHeap, ByrefExposed);
                         continue;
                     }
 
-                    if (arg->TypeGet() == TYP_BYREF && arg->OperGet() == GT_LCL_VAR)
-                    {
-                        // If it's a local byref for which we recorded a value number, use that...
-                        GenTreeLclVar* argLcl = arg->AsLclVar();
-                        if (argLcl->HasSsaName())
-                        {
-                            ValueNum argVN =
-                                lvaTable[argLcl->GetLclNum()].GetPerSsaData(argLcl->GetSsaNum())->m_vnPair.GetLiberal();
-                            VNFuncApp funcApp;
-                            if (argVN != ValueNumStore::NoVN && vnStore->GetVNFunc(argVN, &funcApp) &&
-                                funcApp.m_func == VNF_PtrToArrElem)
-                            {
-                                assert(vnStore->IsVNHandle(funcApp.m_args[0]));
-                                CORINFO_CLASS_HANDLE elemType =
-                                    CORINFO_CLASS_HANDLE(vnStore->ConstantValue<size_t>(funcApp.m_args[0]));
-                                AddModifiedElemTypeAllContainingLoops(mostNestedLoop, elemType);
-                                // Don't set memoryHavoc for GcHeap below.  Do set memoryHavoc for ByrefExposed
-                                // (conservatively assuming that a byref may alias the array element)
-                                memoryHavoc |= memoryKindSet(ByrefExposed);
-                                continue;
-                            }
-                        }
-                        // Otherwise...
-                        memoryHavoc |= memoryKindSet(GcHeap, ByrefExposed);
-                    }
-                    else
-                    {
-                        GenTreeArrAddr* arrAddr  = nullptr;
-                        GenTree*        baseAddr = nullptr;
-                        FieldSeq*       fldSeq   = nullptr;
-                        ssize_t         offset   = 0;
-
-                        if (arg->IsArrayAddr(&arrAddr))
-                        {
-                            // We will not collect "fldSeq" -- any modification to an S[], at
-                            // any field of "S", will lose all information about the array type.
-                            CORINFO_CLASS_HANDLE elemTypeEq =
-                                EncodeElemType(arrAddr->GetElemType(), arrAddr->GetElemClassHandle());
-                            AddModifiedElemTypeAllContainingLoops(mostNestedLoop, elemTypeEq);
-                            // Conservatively assume byrefs may alias this array element
-                            memoryHavoc |= memoryKindSet(ByrefExposed);
-                        }
-                        else if (arg->IsFieldAddr(this, &baseAddr, &fldSeq, &offset))
-                        {
-                            assert(fldSeq != nullptr);
-
-                            FieldKindForVN fieldKind =
-                                (baseAddr != nullptr) ? FieldKindForVN::WithBaseAddr : FieldKindForVN::SimpleStatic;
-                            AddModifiedFieldAllContainingLoops(mostNestedLoop, fldSeq->GetFieldHandle(), fieldKind);
-                            // Conservatively assume byrefs may alias this object.
-                            memoryHavoc |= memoryKindSet(ByrefExposed);
-                        }
-                        else
-                        {
-                            memoryHavoc |= memoryKindSet(GcHeap, ByrefExposed);
-                        }
-                    }
+                    memoryHavoc |= optComputeLoopSideEffectsOfStore(mostNestedLoop, lhs->AsIndir()->Addr(),
+                                                                     lhs->AsIndir()->Size());
                 }
                 else if (lhs->OperIsBlk())
                 {
@@ -8955,8 +10444,15 @@ bool Compiler::optComputeLoopSideEffectsOfBlock(BasicBlock* blk)
                     bool                 isEntire;
                     if (!tree->DefinesLocal(this, &lclVarTree, &isEntire))
                     {
-                        // For now, assume arbitrary side effects on GcHeap/ByrefExposed...
-                        memoryHavoc |= memoryKindSet(GcHeap, ByrefExposed);
+                        if (lhs->AsBlk()->IsVolatile())
+                        {
+                            memoryHavoc |= memoryKindSet(GcHeap, ByrefExposed);
+                            continue;
+                        }
+
+                        // Struct stores to fields and array elements only modify those, like scalar stores.
+                        memoryHavoc |= optComputeLoopSideEffectsOfStore(mostNestedLoop, lhs->AsBlk()->Addr(),
+                                                                         lhs->AsBlk()->Size());
                     }
                     else if (lvaVarAddrExposed(lclVarTree->GetLclNum()))
                     {
@@ -0,0 +1,727 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+#include "jitpch.h"
+
+#ifdef _MSC_VER
+#pragma hdrstop
+#endif
+
+//------------------------------------------------------------------------
+// Physical Promotion
+//
+// Regular struct promotion is all or nothing: every field of the struct
+// becomes its own local, and structs with more than
+// MAX_NumOfFieldsInPromotableStruct fields, or with fields that are
+// themselves structs, are not promoted at all. For large structs of which
+// only a couple of fields are used in hot code this leaves every access
+// as a stack load or store.
+//
+// This phase runs after the local address visitor, so every field access of
+// a non-promoted, non-exposed struct local is now a LCL_FLD. We look at
+// those accesses and, for the (offset, type) pairs that are used often
+// enough (weighted by block weight, so by PGO data when we have it), we
+// create a new primitive local -- a "replacement" -- and rewrite the
+// accesses to use it:
+//
+//  Statement(n):
+//    ... LCL_FLD int V03 [+8] ...
+//
+// becomes
+//
+//  Statement(n):
+//    ... LCL_VAR int V12 ...
+//
+// The struct itself stays where it is. Wherever the struct is used as a
+// whole (copied, passed to a call, returned) we first write the
+// replacements back to the struct, and wherever it is defined as a whole we
+// read the replacements back afterwards. Struct parameters read their
+// replacements on entry.
+//
+// A replacement is only kept if its accesses outweigh these extra copies.
+// To keep the rewrite simple we give up on a local if the same statement
+// touches both one of its fields and the whole struct, if the struct is
+// defined anywhere other than at the root of a statement, or if its address
+// is taken; and we never promote a field that overlaps some other access.
+//
+// Like forward substitution this runs before global morph, so it has to
+// keep the early ref counts accurate for the phases that rely on them.
+//
+
+// A single (offset, type) access pattern of a candidate struct local.
+//
+struct PromotionAccess
+{
+    unsigned  Offset;
+    var_types Type;
+    unsigned  Count;
+    weight_t  Weight;
+    unsigned  Replacement;
+
+    PromotionAccess(unsigned offset, var_types type)
+        : Offset(offset), Type(type), Count(0), Weight(0), Replacement(BAD_VAR_NUM)
+    {
+    }
+
+    unsigned Size() const
+    {
+        return genTypeSize(Type);
+    }
+
+    bool Overlaps(unsigned offset, unsigned size) const
+    {
+        return (Offset < offset + size) && (offset < Offset + Size());
+    }
+};
+
+// Everything we know about a candidate struct local.
+//
+struct PromotionLocal
+{
+    ArrayStack<PromotionAccess> Accesses;
+    // Summed weight of accesses to the struct as a whole.
+    weight_t WholeWeight;
+    // Statements we last saw a field access and a whole access in.
+    Statement* LastFieldStmt;
+    Statement* LastWholeStmt;
+    bool       Excluded;
+    bool       HasReplacements;
+
+    PromotionLocal(CompAllocator alloc)
+        : Accesses(alloc)
+        , WholeWeight(0)
+        , LastFieldStmt(nullptr)
+        , LastWholeStmt(nullptr)
+        , Excluded(false)
+        , HasReplacements(false)
+    {
+    }
+
+    PromotionAccess* FindAccess(unsigned offset, var_types type)
+    {
+        for (int i = 0; i < Accesses.Height(); i++)
+        {
+            PromotionAccess* access = &Accesses.BottomRef(i);
+            if ((access->Offset == offset) && (access->Type == type))
+            {
+                return access;
+            }
+        }
+
+        return nullptr;
+    }
+};
+
+// Upper bound on the distinct access patterns we track for one local.
+static const int MAX_PROMOTION_ACCESSES = 32;
+
+class Promotion
+{
+    Compiler*        m_compiler;
+    PromotionLocal** m_locals;
+    unsigned         m_lclCount;
+
+public:
+    Promotion(Compiler* compiler) : m_compiler(compiler), m_locals(nullptr), m_lclCount(compiler->lvaCount)
+    {
+    }
+
+    PhaseStatus Run();
+
+    PromotionLocal* GetLocal(unsigned lclNum)
+    {
+        return (lclNum < m_lclCount) ? m_locals[lclNum] : nullptr;
+    }
+
+    //------------------------------------------------------------------------
+    // IsPromotableAccessType: can an access of this type get a replacement?
+    //
+    static bool IsPromotableAccessType(var_types type)
+    {
+        return !varTypeIsSmall(type) && !varTypeIsStruct(type) && (type != TYP_VOID);
+    }
+
+    static void UpdateEarlyRefCount(LclVarDsc* varDsc, int delta)
+    {
+        unsigned short refCnt = varDsc->lvRefCnt(RCS_EARLY);
+
+        // Like the local address visitor we don't bother keeping large counts accurate.
+        //
+        if (refCnt == USHRT_MAX)
+        {
+            return;
+        }
+
+        if (delta > 0)
+        {
+            varDsc->incLvRefCnt(1, RCS_EARLY);
+        }
+        else if (refCnt > 0)
+        {
+            varDsc->setLvRefCnt(refCnt - 1, RCS_EARLY);
+        }
+    }
+
+private:
+    bool IsCandidate(unsigned lclNum);
+    bool PickReplacements(unsigned lclNum, PromotionLocal* local, weight_t entryWeight);
+    void InsertWriteBacks(BasicBlock* block, Statement* stmt, unsigned lclNum);
+    void InsertReadBacks(BasicBlock* block, Statement* stmt, unsigned lclNum, bool zeroInit);
+    Statement* NewFieldCopy(unsigned lclNum, const PromotionAccess& access, bool toStruct);
+};
+
+//------------------------------------------------------------------------
+// PromotionAnalysisVisitor: collects the accesses of the candidate locals
+//   in a single statement.
+//
+class PromotionAnalysisVisitor final : public GenTreeVisitor<PromotionAnalysisVisitor>
+{
+    Promotion* m_promotion;
+    Statement* m_stmt;
+    weight_t   m_weight;
+
+public:
+    enum
+    {
+        DoPreOrder    = true,
+        DoLclVarsOnly = true,
+    };
+
+    PromotionAnalysisVisitor(Compiler* compiler, Promotion* promotion, Statement* stmt, weight_t weight)
+        : GenTreeVisitor<PromotionAnalysisVisitor>(compiler), m_promotion(promotion), m_stmt(stmt), m_weight(weight)
+    {
+    }
+
+    fgWalkResult PreOrderVisit(GenTree** use, GenTree* user)
+    {
+        GenTreeLclVarCommon* const lclNode = (*use)->AsLclVarCommon();
+        PromotionLocal* const      local   = m_promotion->GetLocal(lclNode->GetLclNum());
+
+        if ((local == nullptr) || local->Excluded)
+        {
+            return fgWalkResult::WALK_CONTINUE;
+        }
+
+        if (lclNode->OperIs(GT_LCL_VAR_ADDR, GT_LCL_FLD_ADDR) || ((user != nullptr) && user->OperIs(GT_ADDR)))
+        {
+            JITDUMP("  V%02u: address taken in " FMT_STMT "\n", lclNode->GetLclNum(), m_stmt->GetID());
+            local->Excluded = true;
+            return fgWalkResult::WALK_CONTINUE;
+        }
+
+        bool const isDef = (lclNode->gtFlags & GTF_VAR_DEF) != 0;
+
+        if (lclNode->OperIs(GT_LCL_FLD) && Promotion::IsPromotableAccessType(lclNode->TypeGet()))
+        {
+            if (local->LastWholeStmt == m_stmt)
+            {
+                JITDUMP("  V%02u: field and whole accesses in " FMT_STMT "\n", lclNode->GetLclNum(),
+                        m_stmt->GetID());
+                local->Excluded = true;
+                return fgWalkResult::WALK_CONTINUE;
+            }
+
+            local->LastFieldStmt = m_stmt;
+
+            unsigned const   offset = lclNode->AsLclFld()->GetLclOffs();
+            var_types const  type   = lclNode->TypeGet();
+            PromotionAccess* access = local->FindAccess(offset, type);
+
+            if (access == nullptr)
+            {
+                if (local->Accesses.Height() >= MAX_PROMOTION_ACCESSES)
+                {
+                    JITDUMP("  V%02u: too many distinct accesses\n", lclNode->GetLclNum());
+                    local->Excluded = true;
+                    return fgWalkResult::WALK_CONTINUE;
+                }
+
+                local->Accesses.Emplace(offset, type);
+                access = &local->Accesses.TopRef();
+            }
+
+            access->Count++;
+            access->Weight += m_weight;
+            return fgWalkResult::WALK_CONTINUE;
+        }
+
+        // Everything else (the struct itself, struct or small typed fields) counts as a whole
+        // access: the replacements are copied back to the struct before it, and from the
+        // struct after it if it is a def. Small typed fields never get a replacement of their
+        // own, but we still need to remember them so we don't promote something they overlap.
+        //
+        if (lclNode->OperIs(GT_LCL_FLD) && !varTypeIsStruct(lclNode))
+        {
+            unsigned const  offset = lclNode->AsLclFld()->GetLclOffs();
+            var_types const type   = lclNode->TypeGet();
+
+            if (local->FindAccess(offset, type) == nullptr)
+            {
+                if (local->Accesses.Height() >= MAX_PROMOTION_ACCESSES)
+                {
+                    local->Excluded = true;
+                    return fgWalkResult::WALK_CONTINUE;
+                }
+
+                // Count stays zero, so this pattern is never promoted.
+                local->Accesses.Emplace(offset, type);
+            }
+
+            return fgWalkResult::WALK_CONTINUE;
+        }
+
+        if (local->LastFieldStmt == m_stmt)
+        {
+            JITDUMP("  V%02u: field and whole accesses in " FMT_STMT "\n", lclNode->GetLclNum(), m_stmt->GetID());
+            local->Excluded = true;
+            return fgWalkResult::WALK_CONTINUE;
+        }
+
+        if (isDef && (m_stmt->GetRootNode() != user))
+        {
+            JITDUMP("  V%02u: embedded def in " FMT_STMT "\n", lclNode->GetLclNum(), m_stmt->GetID());
+            local->Excluded = true;
+            return fgWalkResult::WALK_CONTINUE;
+        }
+
+        local->LastWholeStmt = m_stmt;
+        local->WholeWeight += m_weight;
+        return fgWalkResult::WALK_CONTINUE;
+    }
+};
+
+//------------------------------------------------------------------------
+// PromotionReplaceVisitor: rewrites promoted field accesses in a statement
+//   and notes which candidate locals it uses or defines as a whole.
+//
+class PromotionReplaceVisitor final : public GenTreeVisitor<PromotionReplaceVisitor>
+{
+    Promotion* m_promotion;
+
+public:
+    enum
+    {
+        DoPreOrder    = true,
+        DoLclVarsOnly = true,
+    };
+
+    // Locals that need their replacements written back before the statement.
+    ArrayStack<unsigned> WriteBacks;
+    // Locals that need their replacements read back after the statement.
+    ArrayStack<unsigned> ReadBacks;
+    bool                 ZeroInit;
+
+    PromotionReplaceVisitor(Compiler* compiler, Promotion* promotion)
+        : GenTreeVisitor<PromotionReplaceVisitor>(compiler)
+        , m_promotion(promotion)
+        , WriteBacks(compiler->getAllocator(CMK_Promotion))
+        , ReadBacks(compiler->getAllocator(CMK_Promotion))
+        , ZeroInit(false)
+    {
+    }
+
+    void Reset()
+    {
+        WriteBacks.Reset();
+        ReadBacks.Reset();
+        ZeroInit = false;
+    }
+
+    fgWalkResult PreOrderVisit(GenTree** use, GenTree* user)
+    {
+        GenTreeLclVarCommon* const lclNode = (*use)->AsLclVarCommon();
+        unsigned const             lclNum  = lclNode->GetLclNum();
+        PromotionLocal* const      local   = m_promotion->GetLocal(lclNum);
+
+        if ((local == nullptr) || !local->HasReplacements)
+        {
+            return fgWalkResult::WALK_CONTINUE;
+        }
+
+        bool const isDef = (lclNode->gtFlags & GTF_VAR_DEF) != 0;
+
+        if (lclNode->OperIs(GT_LCL_FLD))
+        {
+            PromotionAccess* const access = local->FindAccess(lclNode->AsLclFld()->GetLclOffs(), lclNode->TypeGet());
+
+            if ((access != nullptr) && (access->Replacement != BAD_VAR_NUM))
+            {
+                JITDUMP("  [%06u] V%02u [+%u] -> V%02u\n", m_compiler->dspTreeID(lclNode), lclNum, access->Offset,
+                        access->Replacement);
+
+                lclNode->ChangeOper(GT_LCL_VAR);
+                lclNode->SetLclNum(access->Replacement);
+                lclNode->gtFlags &= ~GTF_VAR_USEASG;
+
+                Promotion::UpdateEarlyRefCount(m_compiler->lvaGetDesc(lclNum), -1);
+                Promotion::UpdateEarlyRefCount(m_compiler->lvaGetDesc(access->Replacement), 1);
+                return fgWalkResult::WALK_CONTINUE;
+            }
+
+            if (access != nullptr)
+            {
+                // No replacement, but also no overlap with any of them, so memory is up to date.
+                return fgWalkResult::WALK_CONTINUE;
+            }
+        }
+
+        // A whole or struct typed access. A partial def still needs the struct to be
+        // complete beforehand since the read back copies every replacement.
+        //
+        if (!isDef || ((lclNode->gtFlags & GTF_VAR_USEASG) != 0))
+        {
+            AddUnique(WriteBacks, lclNum);
+        }
+
+        if (isDef)
+        {
+            AddUnique(ReadBacks, lclNum);
+
+            GenTree* const src = user->gtGetOp2();
+            ZeroInit = lclNode->OperIs(GT_LCL_VAR) && src->IsIntegralConst(0);
+        }
+
+        return fgWalkResult::WALK_CONTINUE;
+    }
+
+private:
+    static void AddUnique(ArrayStack<unsigned>& stack, unsigned lclNum)
+    {
+        for (int i = 0; i < stack.Height(); i++)
+        {
+            if (stack.Bottom(i) == lclNum)
+            {
+                return;
+            }
+        }
+
+        stack.Push(lclNum);
+    }
+};
+
+//------------------------------------------------------------------------
+// IsCandidate: see if a local can be considered for physical promotion
+//
+// Arguments:
+//    lclNum - the local
+//
+// Returns:
+//    true if the local's field accesses should be analyzed.
+//
+bool Promotion::IsCandidate(unsigned lclNum)
+{
+    LclVarDsc* const varDsc = m_compiler->lvaGetDesc(lclNum);
+
+    if (!varDsc->TypeIs(TYP_STRUCT) || varDsc->lvPromoted || varDsc->IsAddressExposed())
+    {
+        return false;
+    }
+
+    if (varDsc->lvIsMultiRegRet || varDsc->lvIsUnsafeBuffer || varDsc->lvPinned || varDsc->lvIsStructField)
+    {
+        return false;
+    }
+
+    if (m_compiler->lvaIsImplicitByRefLocal(lclNum))
+    {
+        return false;
+    }
+
+    // Parameters need their replacements initialized on entry, and jmp needs
+    // the incoming values to still be in their homes.
+    //
+    if (varDsc->lvIsParam && m_compiler->compJmpOpUsed)
+    {
+        return false;
+    }
+
+    return true;
+}
+
+//------------------------------------------------------------------------
+// PickReplacements: decide which access patterns of a local get their own
+//   replacement local, and create them.
+//
+// Arguments:
+//    lclNum      - the struct local
+//    local       - the accesses we collected for it
+//    entryWeight - weight of the method entry, for initializing parameters
+//
+// Returns:
+//    true if any replacement was created.
+//
+bool Promotion::PickReplacements(unsigned lclNum, PromotionLocal* local, weight_t entryWeight)
+{
+    LclVarDsc* const varDsc = m_compiler->lvaGetDesc(lclNum);
+
+    // Every whole access costs a copy of each replacement, as does the
+    // initialization of a parameter on entry.
+    //
+    weight_t const copyWeight = local->WholeWeight + (varDsc->lvIsParam ? entryWeight : 0);
+
+    for (int i = 0; i < local->Accesses.Height(); i++)
+    {
+        PromotionAccess& access = local->Accesses.BottomRef(i);
+
+        // With a single access there's nothing to keep in a register.
+        //
+        if ((access.Count < 2) || (access.Weight <= copyWeight))
+        {
+            continue;
+        }
+
+        // Any other access overlapping this one would see stale memory.
+        //
+        bool overlaps = false;
+        for (int j = 0; j < local->Accesses.Height(); j++)
+        {
+            if ((i != j) && local->Accesses.Bottom(j).Overlaps(access.Offset, access.Size()))
+            {
+                overlaps = true;
+                break;
+            }
+        }
+
+        if (overlaps)
+        {
+            JITDUMP("  V%02u [+%u] %s overlaps another access\n", lclNum, access.Offset, varTypeName(access.Type));
+            continue;
+        }
+
+        if (m_compiler->lvaCount >= (unsigned)JitConfig.JitMaxLocalsToTrack())
+        {
+            JITDUMP("  Out of locals\n");
+            break;
+        }
+
+        unsigned const replacement = m_compiler->lvaGrabTemp(false DEBUGARG("physically promoted field"));
+        m_compiler->lvaGetDesc(replacement)->lvType = access.Type;
+        access.Replacement = replacement;
+        local->HasReplacements = true;
+
+        JITDUMP("  V%02u [+%u] %s (weight " FMT_WT ", %u accesses, copy weight " FMT_WT ") -> V%02u\n", lclNum,
+                access.Offset, varTypeName(access.Type), access.Weight, access.Count, copyWeight, replacement);
+    }
+
+    return local->HasReplacements;
+}
+
+//------------------------------------------------------------------------
+// NewFieldCopy: create a statement copying a replacement to or from its
+//   struct local.
+//
+// Arguments:
+//    lclNum   - the struct local
+//    access   - the promoted access
+//    toStruct - true to write the replacement back to the struct
+//
+// Returns:
+//    The new statement.
+//
+Statement* Promotion::NewFieldCopy(unsigned lclNum, const PromotionAccess& access, bool toStruct)
+{
+    GenTree* const field = m_compiler->gtNewLclFldNode(lclNum, access.Type, access.Offset);
+    GenTree* const repl  = m_compiler->gtNewLclvNode(access.Replacement, access.Type);
+    GenTree* const asg =
+        toStruct ? m_compiler->gtNewAssignNode(field, repl) : m_compiler->gtNewAssignNode(repl, field);
+
+    UpdateEarlyRefCount(m_compiler->lvaGetDesc(lclNum), 1);
+    UpdateEarlyRefCount(m_compiler->lvaGetDesc(access.Replacement), 1);
+
+    return m_compiler->fgNewStmtFromTree(asg);
+}
+
+//------------------------------------------------------------------------
+// InsertWriteBacks: make the struct local current before a statement that
+//   uses it as a whole.
+//
+void Promotion::InsertWriteBacks(BasicBlock* block, Statement* stmt, unsigned lclNum)
+{
+    PromotionLocal* const local = m_locals[lclNum];
+
+    for (int i = 0; i < local->Accesses.Height(); i++)
+    {
+        const PromotionAccess& access = local->Accesses.BottomRef(i);
+        if (access.Replacement != BAD_VAR_NUM)
+        {
+            m_compiler->fgInsertStmtBefore(block, stmt, NewFieldCopy(lclNum, access, /* toStruct */ true));
+        }
+    }
+}
+
+//------------------------------------------------------------------------
+// InsertReadBacks: make the replacements current after a statement that
+//   defines the struct local as a whole.
+//
+// Arguments:
+//    block    - the block
+//    stmt     - the defining statement, or nullptr to insert at the end
+//               of the block
+//    lclNum   - the struct local
+//    zeroInit - the struct was just zeroed, so the replacements can be too
+//
+void Promotion::InsertReadBacks(BasicBlock* block, Statement* stmt, unsigned lclNum, bool zeroInit)
+{
+    PromotionLocal* const local = m_locals[lclNum];
+
+    for (int i = local->Accesses.Height() - 1; i >= 0; i--)
+    {
+        const PromotionAccess& access = local->Accesses.BottomRef(i);
+        if (access.Replacement == BAD_VAR_NUM)
+        {
+            continue;
+        }
+
+        Statement* newStmt;
+        if (zeroInit)
+        {
+            GenTree* const repl = m_compiler->gtNewLclvNode(access.Replacement, access.Type);
+            GenTree* const zero = m_compiler->gtNewZeroConNode(access.Type);
+            UpdateEarlyRefCount(m_compiler->lvaGetDesc(access.Replacement), 1);
+            newStmt = m_compiler->fgNewStmtFromTree(m_compiler->gtNewAssignNode(repl, zero));
+        }
+        else
+        {
+            newStmt = NewFieldCopy(lclNum, access, /* toStruct */ false);
+        }
+
+        if (stmt == nullptr)
+        {
+            m_compiler->fgInsertStmtAtEnd(block, newStmt);
+        }
+        else
+        {
+            m_compiler->fgInsertStmtAfter(block, stmt, newStmt);
+        }
+    }
+}
+
+//------------------------------------------------------------------------
+// Run: run physical promotion over the method
+//
+// Returns:
+//    Suitable phase status.
+//
+PhaseStatus Promotion::Run()
+{
+    CompAllocator alloc     = m_compiler->getAllocator(CMK_Promotion);
+    bool          anyLocals = false;
+    m_locals                = new (alloc) PromotionLocal*[m_lclCount];
+
+    for (unsigned lclNum = 0; lclNum < m_lclCount; lclNum++)
+    {
+        m_locals[lclNum] = nullptr;
+        if (IsCandidate(lclNum))
+        {
+            m_locals[lclNum] = new (alloc) PromotionLocal(alloc);
+            anyLocals        = true;
+        }
+    }
+
+    if (!anyLocals)
+    {
+        JITDUMP("No candidate struct locals\n");
+        return PhaseStatus::MODIFIED_NOTHING;
+    }
+
+    for (BasicBlock* const block : m_compiler->Blocks())
+    {
+        weight_t const weight = block->getBBWeight(m_compiler);
+        for (Statement* const stmt : block->Statements())
+        {
+            PromotionAnalysisVisitor visitor(m_compiler, this, stmt, weight);
+            visitor.WalkTree(stmt->GetRootNodePointer(), nullptr);
+        }
+    }
+
+    weight_t const entryWeight     = m_compiler->fgFirstBB->getBBWeight(m_compiler);
+    bool           anyReplacements = false;
+    bool           anyParams       = false;
+
+    for (unsigned lclNum = 0; lclNum < m_lclCount; lclNum++)
+    {
+        PromotionLocal* const local = m_locals[lclNum];
+        if ((local == nullptr) || local->Excluded || (local->Accesses.Height() == 0))
+        {
+            continue;
+        }
+
+        if (PickReplacements(lclNum, local, entryWeight))
+        {
+            anyReplacements = true;
+            anyParams |= m_compiler->lvaGetDesc(lclNum)->lvIsParam;
+        }
+    }
+
+    if (!anyReplacements)
+    {
+        JITDUMP("Nothing worth promoting\n");
+        return PhaseStatus::MODIFIED_NOTHING;
+    }
+
+    PromotionReplaceVisitor visitor(m_compiler, this);
+
+    for (BasicBlock* const block : m_compiler->Blocks())
+    {
+        for (Statement* stmt = block->firstStmt(); stmt != nullptr;)
+        {
+            Statement* const next = stmt->GetNextStmt();
+
+            visitor.Reset();
+            visitor.WalkTree(stmt->GetRootNodePointer(), nullptr);
+
+            for (int i = 0; i < visitor.WriteBacks.Height(); i++)
+            {
+                InsertWriteBacks(block, stmt, visitor.WriteBacks.Bottom(i));
+            }
+
+            for (int i = 0; i < visitor.ReadBacks.Height(); i++)
+            {
+                InsertReadBacks(block, stmt, visitor.ReadBacks.Bottom(i), visitor.ZeroInit);
+            }
+
+            stmt = next;
+        }
+    }
+
+    // Parameters start out with their values in the struct.
+    //
+    if (anyParams)
+    {
+        m_compiler->fgEnsureFirstBBisScratch();
+
+        for (unsigned lclNum = 0; lclNum < m_lclCount; lclNum++)
+        {
+            PromotionLocal* const local = m_locals[lclNum];
+            if ((local != nullptr) && local->HasReplacements && m_compiler->lvaGetDesc(lclNum)->lvIsParam)
+            {
+                InsertReadBacks(m_compiler->fgFirstBB, nullptr, lclNum, /* zeroInit */ false);
+            }
+        }
+    }
+
+    return PhaseStatus::MODIFIED_EVERYTHING;
+}
+
+//------------------------------------------------------------------------
+// PhysicalPromotion: promote the hot fields of struct locals that regular
+//   struct promotion left alone.
+//
+// Returns:
+//    Suitable phase status.
+//
+PhaseStatus Compiler::PhysicalPromotion()
+{
+    if (!opts.OptimizationEnabled() || opts.IsOSR())
+    {
+        return PhaseStatus::MODIFIED_NOTHING;
+    }
+
+    if (JitConfig.JitEnablePhysicalPromotion() == 0)
+    {
+        return PhaseStatus::MODIFIED_NOTHING;
+    }
+
+    Promotion promotion(this);
+    return promotion.Run();
+}
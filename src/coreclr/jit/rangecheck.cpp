@@ -339,6 +339,45 @@ void RangeCheck::Widen(BasicBlock* block, GenTree* tree, Range* pRange)
             GetRangeMap()->RemoveAll();
             *pRange = GetRange(block, tree, true DEBUGARG(0));
         }
+        else if ((JitConfig.JitRangeCheckDerivedIVs() != 0) && tree->OperIs(GT_ADD) && tree->TypeIs(TYP_INT) &&
+                 !tree->gtOverflow() && tree->gtGetOp1()->OperIs(GT_LCL_VAR) &&
+                 tree->gtGetOp2()->IsIntCnsFitsInI32() && IsMonotonicallyIncreasing(tree->gtGetOp1(), false))
+        {
+            // An index derived from an increasing IV, like a[i - 1] in a loop that starts at 1.
+            // The IV never goes below its initial value, so neither does "i + cns" go below
+            // the initial value + cns, as long as neither the IV nor the add wraps around.
+            // The upper limit we have already comes from the assertions at this use, so keep it.
+            JITDUMP("[%06d] is derived from a monotonically increasing IV.\n", Compiler::dspTreeID(tree));
+            GenTree* iv  = tree->gtGetOp1();
+            Limit    cns = Limit(Limit::keConstant, (int)tree->gtGetOp2()->AsIntCon()->IconValue());
+
+            GetRangeMap()->RemoveAll();
+            GetOverflowMap()->RemoveAll();
+            m_pSearchPath->RemoveAll();
+            Range ivRange = GetRange(block, iv, true DEBUGARG(0));
+
+            m_pSearchPath->RemoveAll();
+            if (DoesOverflow(block, iv))
+            {
+                JITDUMP("IV [%06d] may overflow.\n", Compiler::dspTreeID(iv));
+                return;
+            }
+
+            // A negative constant can only make the add wrap below the lower limit, which
+            // AddConstantLimit rejects. A positive one can wrap at the top of the IV's range.
+            if ((cns.GetConstant() > 0) && AddOverflows(ivRange.UpperLimit(), cns))
+            {
+                JITDUMP("[%06d] may overflow.\n", Compiler::dspTreeID(tree));
+                return;
+            }
+
+            Limit lower = ivRange.LowerLimit().IsConstant() ? RangeOps::AddConstantLimit(ivRange.LowerLimit(), cns)
+                                                            : Limit(Limit::keUnknown);
+            if (lower.IsConstant())
+            {
+                range.lLimit = lower;
+            }
+        }
     }
 }
 
@@ -752,6 +752,10 @@ struct JumpThreadInfo
     ValueNum m_ambiguousVN;
 };
 
+// How many levels of func apps optJumpThreadPhi looks through to find phi uses. Without
+// JitJumpThreadComputedPhis only the relop's own operands can be phi uses.
+static const unsigned JUMP_THREAD_PHI_DEPTH = 3;
+
 //------------------------------------------------------------------------
 // optJumpThreadCheck: see if block is suitable for jump threading.
 //
@@ -817,6 +821,11 @@ bool Compiler::optJumpThreadCheck(BasicBlock* const block, BasicBlock* const dom
     // any PHI is locally consumed, so that if we bypass the block we
     // don't need to make SSA updates.
     //
+    // With JitJumpThreadComputedPhis, side effect free defs of locals that are
+    // only used within block are fine too: bypassing block just means we don't
+    // compute a value nobody else needs. This covers blocks that compute the
+    // predicate into a temp.
+    //
     // TODO: handle blocks with side effects. For those predecessors that are
     // favorable (ones that don't reach block via a critical edge), consider
     // duplicating block's IR into the predecessor. This is the jump threading
@@ -872,6 +881,22 @@ bool Compiler::optJumpThreadCheck(BasicBlock* const block, BasicBlock* const dom
 
         // This is a "real" statement.
         //
+        if ((JitConfig.JitJumpThreadComputedPhis() != 0) && tree->OperIs(GT_ASG) &&
+            tree->gtGetOp1()->OperIs(GT_LCL_VAR) && ((tree->gtGetOp2()->gtFlags & GTF_SIDE_EFFECT) == 0))
+        {
+            GenTreeLclVarCommon* const lclDef = tree->gtGetOp1()->AsLclVarCommon();
+            unsigned const             lclNum = lclDef->GetLclNum();
+            LclVarDsc* const           varDsc = lvaGetDesc(lclNum);
+
+            if (lvaInSsa(lclNum) && lclDef->HasSsaName() && !varDsc->lvIsStructField &&
+                !varDsc->GetPerSsaData(lclDef->GetSsaNum())->HasGlobalUse())
+            {
+                JITDUMP(FMT_BB " has block-local def of V%02u.%u; ok to bypass\n", block->bbNum, lclNum,
+                        lclDef->GetSsaNum());
+                continue;
+            }
+        }
+
         // We can ignore exception side effects in the jump tree.
         //
         // They are covered by the exception effects in the dominating compare.
@@ -1167,70 +1192,14 @@ bool Compiler::optJumpThreadPhi(BasicBlock* block, GenTree* tree, ValueNum treeN
         return false;
     }
 
-    // Find occurrences of phi def VNs in the relop VN.
-    // We currently just do one level of func destructuring.
+    // Find occurrences of local phi def VNs in the relop VN. With
+    // JitJumpThreadComputedPhis we look through a few levels of arithmetic,
+    // so that we also handle relops on values computed from the phis, like
+    // ((state & 1) == 0). Otherwise only the relop operands are considered.
     //
-    unsigned funcArgToPhiLocalMap[]   = {BAD_VAR_NUM, BAD_VAR_NUM};
-    GenTree* funcArgToPhiDefNodeMap[] = {nullptr, nullptr};
-    bool     foundPhiDef              = false;
-
-    for (int i = 0; i < 2; i++)
-    {
-        const ValueNum phiDefVN = treeNormVNFuncApp.m_args[i];
-        VNFuncApp      phiDefFuncApp;
-        if (!vnStore->GetVNFunc(phiDefVN, &phiDefFuncApp) || (phiDefFuncApp.m_func != VNF_PhiDef))
-        {
-            // This input is not a phi def. If it's a func app it might depend on
-            // transitively on a phi def; consider a general search utility.
-            //
-            continue;
-        }
-
-        // The PhiDef args tell us which local and which SSA def of that local.
-        //
-        assert(phiDefFuncApp.m_arity == 3);
-        const unsigned lclNum    = unsigned(phiDefFuncApp.m_args[0]);
-        const unsigned ssaDefNum = unsigned(phiDefFuncApp.m_args[1]);
-        const ValueNum phiVN     = ValueNum(phiDefFuncApp.m_args[2]);
-        JITDUMP("... JT-PHI [interestingVN] in " FMT_BB " relop %s operand VN is PhiDef for V%02u:%u " FMT_VN "\n",
-                block->bbNum, i == 0 ? "first" : "second", lclNum, ssaDefNum, phiVN);
-        if (!foundPhiDef)
-        {
-            DISPTREE(tree);
-        }
-
-        // Find the PHI for lclNum local in the current block.
-        //
-        GenTree* phiNode = nullptr;
-        for (Statement* const stmt : block->Statements())
-        {
-            // If the tree is not an SSA def, break out of the loop: we're done.
-            if (!stmt->IsPhiDefnStmt())
-            {
-                break;
-            }
-
-            GenTree* const phiDefNode = stmt->GetRootNode();
-            assert(phiDefNode->IsPhiDefn());
-            GenTreeLclVarCommon* const phiDefLclNode = phiDefNode->AsOp()->gtOp1->AsLclVarCommon();
-            if (phiDefLclNode->GetLclNum() == lclNum)
-            {
-                if (phiDefLclNode->GetSsaNum() == ssaDefNum)
-                {
-                    funcArgToPhiLocalMap[i]   = lclNum;
-                    funcArgToPhiDefNodeMap[i] = phiDefNode;
-                    foundPhiDef               = true;
-                    JITDUMP("Found local PHI [%06u] for V%02u\n", dspTreeID(phiDefNode), lclNum);
-                }
-                else
-                {
-                    // Relop input is phi def from some other block.
-                    //
-                    break;
-                }
-            }
-        }
-    }
+    const unsigned phiDepth    = (JitConfig.JitJumpThreadComputedPhis() != 0) ? JUMP_THREAD_PHI_DEPTH : 1;
+    bool           foundPhiDef = false;
+    optJumpThreadPhiSubstVN(block, nullptr, treeNormVN, phiDepth, &foundPhiDef);
 
     if (!foundPhiDef)
     {
@@ -1240,6 +1209,10 @@ bool Compiler::optJumpThreadPhi(BasicBlock* block, GenTree* tree, ValueNum treeN
         return false;
     }
 
+    JITDUMP("... JT-PHI [interestingVN] in " FMT_BB " relop " FMT_VN " depends on local phis\n", block->bbNum,
+            treeNormVN);
+    DISPTREE(tree);
+
     // At least one relop input depends on a local phi. Walk pred by pred and
     // see if the relop value is correlated with the pred.
     //
@@ -1248,45 +1221,10 @@ bool Compiler::optJumpThreadPhi(BasicBlock* block, GenTree* tree, ValueNum treeN
     {
         jti.m_numPreds++;
 
-        // Find VNs for the relevant phi inputs from this block.
+        // Substitute the VNs for the relevant phi inputs from this block.
         //
-        ValueNum newRelopArgs[] = {treeNormVNFuncApp.m_args[0], treeNormVNFuncApp.m_args[1]};
-        bool     updatedArg     = false;
-
-        for (int i = 0; i < 2; i++)
-        {
-            if (funcArgToPhiLocalMap[i] == BAD_VAR_NUM)
-            {
-                // this relop VN arg not phi dependent
-                continue;
-            }
-
-            GenTree* const    phiNode = funcArgToPhiDefNodeMap[i];
-            GenTreePhi* const phi     = phiNode->gtGetOp2()->AsPhi();
-            for (GenTreePhi::Use& use : phi->Uses())
-            {
-                GenTreePhiArg* const phiArgNode = use.GetNode()->AsPhiArg();
-                assert(phiArgNode->GetLclNum() == funcArgToPhiLocalMap[i]);
-
-                if (phiArgNode->gtPredBB == predBlock)
-                {
-                    ValueNum phiArgVN = phiArgNode->GetVN(VNK_Liberal);
-
-                    // We sometimes see cases where phi args do not have VNs.
-                    // (I recall seeing this before... track down why)
-                    //
-                    if (phiArgVN != ValueNumStore::NoVN)
-                    {
-                        newRelopArgs[i] = phiArgVN;
-                        updatedArg      = true;
-
-                        // paranoia: keep walking uses to make sure no other
-                        // comes from this pred
-                        break;
-                    }
-                }
-            }
-        }
+        bool           updatedArg = false;
+        const ValueNum substVN    = optJumpThreadPhiSubstVN(block, predBlock, treeNormVN, phiDepth, &updatedArg);
 
         // We may not find predBlock in the phi args, as we only have one phi
         // arg per ssa num, not one per pred.
@@ -1302,15 +1240,10 @@ bool Compiler::optJumpThreadPhi(BasicBlock* block, GenTree* tree, ValueNum treeN
             continue;
         }
 
-        // We have a refined set of args for the relop VN for this
-        // pred. See if that simplifies the relop.
+        // We have a refined relop VN for this pred. See if that simplifies the relop.
         //
-        const ValueNum substVN =
-            vnStore->VNForFunc(tree->TypeGet(), treeNormVNFuncApp.m_func, newRelopArgs[0], newRelopArgs[1]);
-
-        JITDUMP("... substituting (" FMT_VN "," FMT_VN ") for (" FMT_VN "," FMT_VN ") in " FMT_VN " gives " FMT_VN "\n",
-                newRelopArgs[0], newRelopArgs[1], treeNormVNFuncApp.m_args[0], treeNormVNFuncApp.m_args[1], treeNormVN,
-                substVN);
+        JITDUMP("... substituting phi inputs from " FMT_BB " in " FMT_VN " gives " FMT_VN "\n", predBlock->bbNum,
+                treeNormVN, substVN);
 
         // If this VN is constant, we're all set!
         //
@@ -1388,6 +1321,130 @@ bool Compiler::optJumpThreadPhi(BasicBlock* block, GenTree* tree, ValueNum treeN
     return optJumpThreadCore(jti);
 }
 
+//------------------------------------------------------------------------
+// optJumpThreadPhiSubstVN: find the value a VN has when block is entered
+//   from a particular pred, by substituting the pred's inputs for the phis
+//   of block.
+//
+// Arguments:
+//   block - block with the phis
+//   predBlock - pred of block, or nullptr to only look for phi uses
+//   vn - normal VN to substitute in
+//   depth - how many more levels of func apps to look through
+//   foundPhi - [out] set to true if vn depends on a phi of block (and,
+//              if predBlock is not nullptr, it had an input from predBlock)
+//
+// Returns:
+//   The VN with the phi inputs from predBlock substituted, or vn if
+//   nothing could be substituted.
+//
+// Notes:
+//   We only look through plain operator func apps; for those it is fine
+//   to rebuild the func app from the substituted args.
+//
+ValueNum Compiler::optJumpThreadPhiSubstVN(
+    BasicBlock* block, BasicBlock* predBlock, ValueNum vn, unsigned depth, bool* foundPhi)
+{
+    VNFuncApp funcApp;
+    if (!vnStore->GetVNFunc(vn, &funcApp))
+    {
+        return vn;
+    }
+
+    if (funcApp.m_func == VNF_PhiDef)
+    {
+        // The PhiDef args tell us which local and which SSA def of that local.
+        //
+        assert(funcApp.m_arity == 3);
+        const unsigned lclNum    = unsigned(funcApp.m_args[0]);
+        const unsigned ssaDefNum = unsigned(funcApp.m_args[1]);
+
+        // Find the PHI for lclNum local in the current block.
+        //
+        GenTreePhi* phi = nullptr;
+        for (Statement* const stmt : block->Statements())
+        {
+            // If the tree is not an SSA def, break out of the loop: we're done.
+            if (!stmt->IsPhiDefnStmt())
+            {
+                break;
+            }
+
+            GenTree* const phiDefNode = stmt->GetRootNode();
+            assert(phiDefNode->IsPhiDefn());
+            GenTreeLclVarCommon* const phiDefLclNode = phiDefNode->AsOp()->gtOp1->AsLclVarCommon();
+            if (phiDefLclNode->GetLclNum() == lclNum)
+            {
+                // If the ssa nums differ, the input is a phi def from some other block.
+                //
+                if (phiDefLclNode->GetSsaNum() == ssaDefNum)
+                {
+                    phi = phiDefNode->gtGetOp2()->AsPhi();
+                }
+                break;
+            }
+        }
+
+        if (phi == nullptr)
+        {
+            return vn;
+        }
+
+        if (predBlock == nullptr)
+        {
+            JITDUMP("Found local PHI for V%02u.%u\n", lclNum, ssaDefNum);
+            *foundPhi = true;
+            return vn;
+        }
+
+        for (GenTreePhi::Use& use : phi->Uses())
+        {
+            GenTreePhiArg* const phiArgNode = use.GetNode()->AsPhiArg();
+            assert(phiArgNode->GetLclNum() == lclNum);
+
+            if (phiArgNode->gtPredBB == predBlock)
+            {
+                ValueNum phiArgVN = phiArgNode->GetVN(VNK_Liberal);
+
+                // We sometimes see cases where phi args do not have VNs.
+                //
+                if (phiArgVN != ValueNumStore::NoVN)
+                {
+                    *foundPhi = true;
+                    return vnStore->VNNormalValue(phiArgVN);
+                }
+            }
+        }
+
+        return vn;
+    }
+
+    // Unsigned relops are VNFuncs past VNF_Boundary; they're as safe to rebuild as the oper based ones.
+    if ((depth == 0) || ((funcApp.m_func >= VNF_Boundary) && !ValueNumStore::VNFuncIsComparison(funcApp.m_func)) ||
+        (funcApp.m_arity < 1) || (funcApp.m_arity > 2))
+    {
+        return vn;
+    }
+
+    ValueNum newArgs[2] = {funcApp.m_args[0], (funcApp.m_arity == 2) ? funcApp.m_args[1] : ValueNumStore::NoVN};
+    bool     changed    = false;
+
+    for (unsigned i = 0; i < funcApp.m_arity; i++)
+    {
+        newArgs[i] = optJumpThreadPhiSubstVN(block, predBlock, newArgs[i], depth - 1, foundPhi);
+        changed |= (newArgs[i] != funcApp.m_args[i]);
+    }
+
+    if (!changed)
+    {
+        return vn;
+    }
+
+    var_types const type = vnStore->TypeOfVN(vn);
+    return (funcApp.m_arity == 1) ? vnStore->VNForFunc(type, funcApp.m_func, newArgs[0])
+                                  : vnStore->VNForFunc(type, funcApp.m_func, newArgs[0], newArgs[1]);
+}
+
 //------------------------------------------------------------------------
 // optJumpThreadCore: restructure block flow based on jump thread information
 //
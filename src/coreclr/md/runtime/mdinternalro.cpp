@@ -60,6 +60,9 @@ HRESULT MDApplyEditAndContinue(         // S_OK or error.
 //*****************************************************************************
 MDInternalRO::MDInternalRO()
  :  m_pMethodSemanticsMap(0),
+    m_pTypeDefHash(0),
+    m_pTypeRefHash(0),
+    m_pMethodDefHash(0),
     m_cRefs(1)
 {
 } // MDInternalRO::MDInternalRO
@@ -75,6 +78,15 @@ MDInternalRO::~MDInternalRO()
     if (m_pMethodSemanticsMap)
         delete[] m_pMethodSemanticsMap;
     m_pMethodSemanticsMap = 0;
+    if (m_pTypeDefHash)
+        delete m_pTypeDefHash;
+    m_pTypeDefHash = 0;
+    if (m_pTypeRefHash)
+        delete m_pTypeRefHash;
+    m_pTypeRefHash = 0;
+    if (m_pMethodDefHash)
+        delete m_pMethodDefHash;
+    m_pMethodDefHash = 0;
 } // MDInternalRO::~MDInternalRO
 
 //*****************************************************************************
@@ -838,15 +850,10 @@ HRESULT MDInternalRO::FindMethodDefUsingCompare(    // S_OK or error.
         pvSigBlob = (PCCOR_SIGNATURE) qbSig.Ptr();
     }
 
-    // Do a linear search on compressed version
-    //
     RID         ridMax;
-    MethodRec   *pMethodRec;
-    LPCUTF8     szCurMethodName;
-    void const  *pvCurMethodSig;
-    ULONG       cbSig;
     TypeDefRec  *pRec;
     RID         ridStart;
+    CMemberDefHash *pHash;
 
     // get the typedef record
     IfFailGo(m_LiteWeightStgdb.m_MiniMd.GetTypeDefRecord(RidFromToken(classdef), &pRec));
@@ -855,39 +862,141 @@ HRESULT MDInternalRO::FindMethodDefUsingCompare(    // S_OK or error.
     ridStart = m_LiteWeightStgdb.m_MiniMd.getMethodListOfTypeDef(pRec);
     IfFailGo(m_LiteWeightStgdb.m_MiniMd.getEndMethodListOfTypeDef(RidFromToken(classdef), &ridMax));
 
-    // loop through each methoddef
-    for (; ridStart < ridMax; ridStart++)
+    // Only classes with many methods are worth the hash, the others are searched linearly
+    pHash = (ridMax - ridStart > s_cMinRecordsForLookupHash) ? GetMethodDefHash() : NULL;
+    if (pHash != NULL)
     {
-        IfFailGo(m_LiteWeightStgdb.m_MiniMd.GetMethodRecord(ridStart, &pMethodRec));
-        IfFailGo(m_LiteWeightStgdb.m_MiniMd.getNameOfMethod(pMethodRec, &szCurMethodName));
-        if (strcmp(szCurMethodName, szName) == 0)
+        mdTypeDef tkParent = TokenFromRid(RidFromToken(classdef), mdtTypeDef);
+        ULONG iHash = HashMethodName(tkParent, szName);
+        int pos;
+        for (MEMBERDEFHASHENTRY *pEntry = pHash->FindFirst(iHash, pos); pEntry != NULL; pEntry = pHash->FindNext(pos))
         {
-            // name match, now check the signature if specified.
-            if (cbSigBlob && SigCompare)
+            if (pEntry->ulHash != iHash || pEntry->tkParent != tkParent)
+                continue;
+
+            IfFailGo(CompareMethodDef(RidFromToken(pEntry->tok), szName, pvSigBlob, cbSigBlob, SigCompare, pSigArgs));
+            if (hr == S_OK)
             {
-                IfFailGo(m_LiteWeightStgdb.m_MiniMd.getSignatureOfMethod(pMethodRec, (PCCOR_SIGNATURE *)&pvCurMethodSig, &cbSig));
-                // Signature comparison is required
-                // Note that if pvSigBlob is vararg, we already preprocess it so that
-                // it only contains the fix part. Therefore, it still should be an exact
-                // match!!!.
-                //
-                if(SigCompare((PCCOR_SIGNATURE) pvCurMethodSig, cbSig, pvSigBlob, cbSigBlob, pSigArgs) == FALSE)
-                    continue;
+                *pmethoddef = pEntry->tok;
+                goto ErrExit;
             }
-            // Ignore PrivateScope methods.
-            if (IsMdPrivateScope(m_LiteWeightStgdb.m_MiniMd.getFlagsOfMethod(pMethodRec)))
-               continue;
-                    // found the match
-                    *pmethoddef = TokenFromRid(ridStart, mdtMethodDef);
-                    goto ErrExit;
-                }
+        }
+    }
+    else
+    {
+        // Do a linear search on compressed version
+        for (; ridStart < ridMax; ridStart++)
+        {
+            IfFailGo(CompareMethodDef(ridStart, szName, pvSigBlob, cbSigBlob, SigCompare, pSigArgs));
+            if (hr == S_OK)
+            {
+                // found the match
+                *pmethoddef = TokenFromRid(ridStart, mdtMethodDef);
+                goto ErrExit;
             }
+        }
+    }
     hr = CLDB_E_RECORD_NOTFOUND;
 
 ErrExit:
     return hr;
 }
 
+//*****************************************************************************
+// Check whether a MethodDef has the given name and signature. The signature
+// of a vararg method must already be reduced to its fixed part.
+//*****************************************************************************
+__checkReturn
+HRESULT MDInternalRO::CompareMethodDef( // S_OK match, S_FALSE no match.
+    RID         rid,                    // [IN] MethodDef to check.
+    LPCSTR      szName,                 // [IN] Name of the member in utf8.
+    PCCOR_SIGNATURE pvSigBlob,          // [IN] Fixed part of the signature, or NULL.
+    ULONG       cbSigBlob,              // [IN] count of bytes in the signature blob
+    PSIGCOMPARE SigCompare,             // [IN] Signature comparison routine
+    void*       pSigArgs)               // [IN] Additional arguments passed to signature compare
+{
+    HRESULT     hr;
+    MethodRec   *pMethodRec;
+    LPCUTF8     szCurMethodName;
+    void const  *pvCurMethodSig;
+    ULONG       cbSig;
+
+    IfFailRet(m_LiteWeightStgdb.m_MiniMd.GetMethodRecord(rid, &pMethodRec));
+    IfFailRet(m_LiteWeightStgdb.m_MiniMd.getNameOfMethod(pMethodRec, &szCurMethodName));
+    if (strcmp(szCurMethodName, szName) != 0)
+        return S_FALSE;
+
+    // name match, now check the signature if specified.
+    if (cbSigBlob && SigCompare)
+    {
+        IfFailRet(m_LiteWeightStgdb.m_MiniMd.getSignatureOfMethod(pMethodRec, (PCCOR_SIGNATURE *)&pvCurMethodSig, &cbSig));
+        // Signature comparison is required
+        // Note that if pvSigBlob is vararg, we already preprocess it so that
+        // it only contains the fix part. Therefore, it still should be an exact
+        // match!!!.
+        //
+        if (SigCompare((PCCOR_SIGNATURE) pvCurMethodSig, cbSig, pvSigBlob, cbSigBlob, pSigArgs) == FALSE)
+            return S_FALSE;
+    }
+
+    // Ignore PrivateScope methods.
+    if (IsMdPrivateScope(m_LiteWeightStgdb.m_MiniMd.getFlagsOfMethod(pMethodRec)))
+        return S_FALSE;
+
+    return S_OK;
+} // MDInternalRO::CompareMethodDef
+
+//*****************************************************************************
+// Return the hash of MethodDefs by parent and name, building it on first use.
+// NULL if it cannot be built, in which case the caller searches linearly.
+//*****************************************************************************
+CMemberDefHash *MDInternalRO::GetMethodDefHash()
+{
+    HRESULT hr = S_OK;
+
+    if (m_pMethodDefHash == NULL)
+    {
+        ULONG        cTypeDefRecs = m_LiteWeightStgdb.m_MiniMd.getCountTypeDefs();
+        RID          ridStart;
+        RID          ridEnd;
+        TypeDefRec * pRec;
+        MethodRec *  pMethod;
+        LPCUTF8      szMethodName;
+        MEMBERDEFHASHENTRY *pEntry;
+
+        NewHolder<CMemberDefHash> pMethodDefHash = new (nothrow) CMemberDefHash();
+        IfNullGo(pMethodDefHash);
+        IfFailGo(pMethodDefHash->NewInit(m_LiteWeightStgdb.m_MiniMd.getCountMethods() + 1));
+
+        for (RID iType = cTypeDefRecs; iType >= 1; iType--)
+        {
+            IfFailGo(m_LiteWeightStgdb.m_MiniMd.GetTypeDefRecord(iType, &pRec));
+            ridStart = m_LiteWeightStgdb.m_MiniMd.getMethodListOfTypeDef(pRec);
+            IfFailGo(m_LiteWeightStgdb.m_MiniMd.getEndMethodListOfTypeDef(iType, &ridEnd));
+
+            // add the methods of this typedef in descending order
+            for (RID rid = ridEnd; rid > ridStart; )
+            {
+                rid--;
+                IfFailGo(m_LiteWeightStgdb.m_MiniMd.GetMethodRecord(rid, &pMethod));
+                IfFailGo(m_LiteWeightStgdb.m_MiniMd.getNameOfMethod(pMethod, &szMethodName));
+
+                pEntry = pMethodDefHash->Add(HashMethodName(TokenFromRid(iType, mdtTypeDef), szMethodName));
+                IfNullGo(pEntry);
+                pEntry->tok = TokenFromRid(rid, mdtMethodDef);
+                pEntry->tkParent = TokenFromRid(iType, mdtTypeDef);
+            }
+        }
+
+        if (InterlockedCompareExchangeT<CMemberDefHash *>(&m_pMethodDefHash, pMethodDefHash, NULL) == NULL)
+        {   // We won the initialization race
+            pMethodDefHash.SuppressRelease();
+        }
+    }
+ErrExit:
+    return m_pMethodDefHash;
+} // MDInternalRO::GetMethodDefHash
+
 //*****************************************************************************
 // Find a given param of a Method.
 //*****************************************************************************
@@ -1153,37 +1262,40 @@ HRESULT MDInternalRO::FindTypeRefByName(  // S_OK or error.
     if (!szNamespace)
         szNamespace = "";
 
-    // Do a linear search on compressed version as we do not want to
-    // depends on ICR.
-    //
     ULONG       cTypeRefRecs = m_LiteWeightStgdb.m_MiniMd.getCountTypeRefs();
-    TypeRefRec *pTypeRefRec;
-    LPCUTF8     szNamespaceTmp;
-    LPCUTF8     szNameTmp;
-    mdToken     tkRes;
+    CMetaDataHashBase *pHash;
 
-    for (ULONG i = 1; i <= cTypeRefRecs; i++)
+    pHash = (cTypeRefRecs > s_cMinRecordsForLookupHash) ? GetTypeRefHash() : NULL;
+    if (pHash != NULL)
     {
-        IfFailGo(m_LiteWeightStgdb.m_MiniMd.GetTypeRefRecord(i, &pTypeRefRec));
-        tkRes = m_LiteWeightStgdb.m_MiniMd.getResolutionScopeOfTypeRef(pTypeRefRec);
-
-        if (IsNilToken(tkRes))
+        ULONG iHash = HashTypeName(szNamespace, szName);
+        int pos;
+        for (TOKENHASHENTRY *pEntry = pHash->FindFirst(iHash, pos); pEntry != NULL; pEntry = pHash->FindNext(pos))
         {
-            if (!IsNilToken(tkResolutionScope))
+            if (pEntry->ulHash != iHash)
                 continue;
-        }
-        else if (tkRes != tkResolutionScope)
-            continue;
-
-        IfFailGo(m_LiteWeightStgdb.m_MiniMd.getNamespaceOfTypeRef(pTypeRefRec, &szNamespaceTmp));
-        if (strcmp(szNamespace, szNamespaceTmp))
-            continue;
 
-        IfFailGo(m_LiteWeightStgdb.m_MiniMd.getNameOfTypeRef(pTypeRefRec, &szNameTmp));
-        if (!strcmp(szNameTmp, szName))
+            IfFailGo(CompareTypeRef(RidFromToken(pEntry->tok), szNamespace, szName, tkResolutionScope));
+            if (hr == S_OK)
+            {
+                *ptk = pEntry->tok;
+                goto ErrExit;
+            }
+        }
+    }
+    else
+    {
+        // Do a linear search on compressed version as we do not want to
+        // depends on ICR.
+        //
+        for (ULONG i = 1; i <= cTypeRefRecs; i++)
         {
-            *ptk = TokenFromRid(i, mdtTypeRef);
-            goto ErrExit;
+            IfFailGo(CompareTypeRef(i, szNamespace, szName, tkResolutionScope));
+            if (hr == S_OK)
+            {
+                *ptk = TokenFromRid(i, mdtTypeRef);
+                goto ErrExit;
+            }
         }
     }
 
@@ -1193,6 +1305,84 @@ ErrExit:
     return hr;
 }
 
+//*****************************************************************************
+// Check whether a TypeRef has the given name and resolution scope.
+//*****************************************************************************
+__checkReturn
+HRESULT MDInternalRO::CompareTypeRef(   // S_OK match, S_FALSE no match.
+    RID         rid,                    // [IN] TypeRef to check.
+    LPCSTR      szNamespace,            // [IN] Namespace for the TypeRef.
+    LPCSTR      szName,                 // [IN] Name of the TypeRef.
+    mdToken     tkResolutionScope)      // [IN] Resolution Scope fo the TypeRef.
+{
+    HRESULT     hr;
+    TypeRefRec *pTypeRefRec;
+    LPCUTF8     szNamespaceTmp;
+    LPCUTF8     szNameTmp;
+    mdToken     tkRes;
+
+    IfFailRet(m_LiteWeightStgdb.m_MiniMd.GetTypeRefRecord(rid, &pTypeRefRec));
+    tkRes = m_LiteWeightStgdb.m_MiniMd.getResolutionScopeOfTypeRef(pTypeRefRec);
+
+    if (IsNilToken(tkRes))
+    {
+        if (!IsNilToken(tkResolutionScope))
+            return S_FALSE;
+    }
+    else if (tkRes != tkResolutionScope)
+        return S_FALSE;
+
+    IfFailRet(m_LiteWeightStgdb.m_MiniMd.getNamespaceOfTypeRef(pTypeRefRec, &szNamespaceTmp));
+    if (strcmp(szNamespace, szNamespaceTmp))
+        return S_FALSE;
+
+    IfFailRet(m_LiteWeightStgdb.m_MiniMd.getNameOfTypeRef(pTypeRefRec, &szNameTmp));
+    if (strcmp(szNameTmp, szName))
+        return S_FALSE;
+
+    return S_OK;
+} // MDInternalRO::CompareTypeRef
+
+//*****************************************************************************
+// Return the hash of TypeRefs by namespace and name, building it on first use.
+// NULL if it cannot be built, in which case the caller searches linearly.
+//*****************************************************************************
+CMetaDataHashBase *MDInternalRO::GetTypeRefHash()
+{
+    HRESULT hr = S_OK;
+
+    if (m_pTypeRefHash == NULL)
+    {
+        ULONG        cTypeRefRecs = m_LiteWeightStgdb.m_MiniMd.getCountTypeRefs();
+        TypeRefRec * pTypeRefRec;
+        LPCUTF8      szNamespace;
+        LPCUTF8      szName;
+        TOKENHASHENTRY *pEntry;
+
+        NewHolder<CMetaDataHashBase> pTypeRefHash = new (nothrow) CMetaDataHashBase();
+        IfNullGo(pTypeRefHash);
+        IfFailGo(pTypeRefHash->NewInit(cTypeRefRecs + 1));
+
+        for (RID rid = cTypeRefRecs; rid >= 1; rid--)
+        {
+            IfFailGo(m_LiteWeightStgdb.m_MiniMd.GetTypeRefRecord(rid, &pTypeRefRec));
+            IfFailGo(m_LiteWeightStgdb.m_MiniMd.getNamespaceOfTypeRef(pTypeRefRec, &szNamespace));
+            IfFailGo(m_LiteWeightStgdb.m_MiniMd.getNameOfTypeRef(pTypeRefRec, &szName));
+
+            pEntry = pTypeRefHash->Add(HashTypeName(szNamespace, szName));
+            IfNullGo(pEntry);
+            pEntry->tok = TokenFromRid(rid, mdtTypeRef);
+        }
+
+        if (InterlockedCompareExchangeT<CMetaDataHashBase *>(&m_pTypeRefHash, pTypeRefHash, NULL) == NULL)
+        {   // We won the initialization race
+            pTypeRefHash.SuppressRelease();
+        }
+    }
+ErrExit:
+    return m_pTypeRefHash;
+} // MDInternalRO::GetTypeRefHash
+
 //*****************************************************************************
 // return flags for a given class
 //*****************************************************************************
@@ -1728,12 +1918,10 @@ MDInternalRO::FindTypeDef(
     if (szTypeDefNamespace == NULL)
         szTypeDefNamespace = "";
 
-    // Do a linear search
     ULONG        cTypeDefRecs = m_LiteWeightStgdb.m_MiniMd.getCountTypeDefs();
-    TypeDefRec * pTypeDefRec;
     LPCUTF8      szName;
     LPCUTF8      szNamespace;
-    DWORD        dwFlags;
+    CMetaDataHashBase *pHash;
 
     // Get TypeDef of the tkEnclosingClass passed in
     if (TypeFromToken(tkEnclosingClass) == mdtTypeRef)
@@ -1755,45 +1943,31 @@ MDInternalRO::FindTypeDef(
         _ASSERTE(TypeFromToken(tkEnclosingClass) == mdtTypeDef);
     }
 
-    // Search for the TypeDef
-    for (ULONG i = 1; i <= cTypeDefRecs; i++)
+    pHash = (cTypeDefRecs > s_cMinRecordsForLookupHash) ? GetTypeDefHash() : NULL;
+    if (pHash != NULL)
     {
-        IfFailRet(m_LiteWeightStgdb.m_MiniMd.GetTypeDefRecord(i, &pTypeDefRec));
-
-        dwFlags = m_LiteWeightStgdb.m_MiniMd.getFlagsOfTypeDef(pTypeDefRec);
-
-        if (!IsTdNested(dwFlags) && !IsNilToken(tkEnclosingClass))
+        ULONG iHash = HashTypeName(szTypeDefNamespace, szTypeDefName);
+        int pos;
+        for (TOKENHASHENTRY *pEntry = pHash->FindFirst(iHash, pos); pEntry != NULL; pEntry = pHash->FindNext(pos))
         {
-            // If the class is not Nested and EnclosingClass passed in is not nil
-            continue;
-        }
-        else if (IsTdNested(dwFlags) && IsNilToken(tkEnclosingClass))
-        {
-            // If the class is nested and EnclosingClass passed is nil
-            continue;
-        }
-        else if (!IsNilToken(tkEnclosingClass))
-        {
-            _ASSERTE(TypeFromToken(tkEnclosingClass) == mdtTypeDef);
-
-            RID              iNestedClassRec;
-            NestedClassRec * pNestedClassRec;
-            mdTypeDef        tkEnclosingClassTmp;
-
-            IfFailRet(m_LiteWeightStgdb.m_MiniMd.FindNestedClassFor(i, &iNestedClassRec));
-            if (InvalidRid(iNestedClassRec))
+            if (pEntry->ulHash != iHash)
                 continue;
-            IfFailRet(m_LiteWeightStgdb.m_MiniMd.GetNestedClassRecord(iNestedClassRec, &pNestedClassRec));
-            tkEnclosingClassTmp = m_LiteWeightStgdb.m_MiniMd.getEnclosingClassOfNestedClass(pNestedClassRec);
-            if (tkEnclosingClass != tkEnclosingClassTmp)
-                continue;
-        }
 
-        IfFailRet(m_LiteWeightStgdb.m_MiniMd.getNameOfTypeDef(pTypeDefRec, &szName));
-        if (strcmp(szTypeDefName, szName) == 0)
+            IfFailRet(CompareTypeDef(RidFromToken(pEntry->tok), szTypeDefNamespace, szTypeDefName, tkEnclosingClass));
+            if (hr == S_OK)
+            {
+                *ptkTypeDef = pEntry->tok;
+                return S_OK;
+            }
+        }
+    }
+    else
+    {
+        // Do a linear search
+        for (ULONG i = 1; i <= cTypeDefRecs; i++)
         {
-            IfFailRet(m_LiteWeightStgdb.m_MiniMd.getNamespaceOfTypeDef(pTypeDefRec, &szNamespace));
-            if (strcmp(szTypeDefNamespace, szNamespace) == 0)
+            IfFailRet(CompareTypeDef(i, szTypeDefNamespace, szTypeDefName, tkEnclosingClass));
+            if (hr == S_OK)
             {
                 *ptkTypeDef = TokenFromRid(i, mdtTypeDef);
                 return S_OK;
@@ -1804,6 +1978,104 @@ MDInternalRO::FindTypeDef(
     return CLDB_E_RECORD_NOTFOUND;
 } // MDInternalRO::FindTypeDef
 
+//*****************************************************************************
+// Check whether a TypeDef has the given name and enclosing class.
+//*****************************************************************************
+__checkReturn
+HRESULT MDInternalRO::CompareTypeDef(   // S_OK match, S_FALSE no match.
+    RID         rid,                    // [IN] TypeDef to check.
+    LPCSTR      szTypeDefNamespace,     // [IN] Namespace for the TypeDef.
+    LPCSTR      szTypeDefName,          // [IN] Name of the TypeDef.
+    mdToken     tkEnclosingClass)       // [IN] TypeDef of enclosing class, or nil.
+{
+    HRESULT      hr;
+    TypeDefRec * pTypeDefRec;
+    LPCUTF8      szName;
+    LPCUTF8      szNamespace;
+    DWORD        dwFlags;
+
+    IfFailRet(m_LiteWeightStgdb.m_MiniMd.GetTypeDefRecord(rid, &pTypeDefRec));
+
+    dwFlags = m_LiteWeightStgdb.m_MiniMd.getFlagsOfTypeDef(pTypeDefRec);
+
+    if (!IsTdNested(dwFlags) && !IsNilToken(tkEnclosingClass))
+    {
+        // If the class is not Nested and EnclosingClass passed in is not nil
+        return S_FALSE;
+    }
+    else if (IsTdNested(dwFlags) && IsNilToken(tkEnclosingClass))
+    {
+        // If the class is nested and EnclosingClass passed is nil
+        return S_FALSE;
+    }
+    else if (!IsNilToken(tkEnclosingClass))
+    {
+        _ASSERTE(TypeFromToken(tkEnclosingClass) == mdtTypeDef);
+
+        RID              iNestedClassRec;
+        NestedClassRec * pNestedClassRec;
+        mdTypeDef        tkEnclosingClassTmp;
+
+        IfFailRet(m_LiteWeightStgdb.m_MiniMd.FindNestedClassFor(rid, &iNestedClassRec));
+        if (InvalidRid(iNestedClassRec))
+            return S_FALSE;
+        IfFailRet(m_LiteWeightStgdb.m_MiniMd.GetNestedClassRecord(iNestedClassRec, &pNestedClassRec));
+        tkEnclosingClassTmp = m_LiteWeightStgdb.m_MiniMd.getEnclosingClassOfNestedClass(pNestedClassRec);
+        if (tkEnclosingClass != tkEnclosingClassTmp)
+            return S_FALSE;
+    }
+
+    IfFailRet(m_LiteWeightStgdb.m_MiniMd.getNameOfTypeDef(pTypeDefRec, &szName));
+    if (strcmp(szTypeDefName, szName) != 0)
+        return S_FALSE;
+
+    IfFailRet(m_LiteWeightStgdb.m_MiniMd.getNamespaceOfTypeDef(pTypeDefRec, &szNamespace));
+    if (strcmp(szTypeDefNamespace, szNamespace) != 0)
+        return S_FALSE;
+
+    return S_OK;
+} // MDInternalRO::CompareTypeDef
+
+//*****************************************************************************
+// Return the hash of TypeDefs by namespace and name, building it on first use.
+// NULL if it cannot be built, in which case the caller searches linearly.
+//*****************************************************************************
+CMetaDataHashBase *MDInternalRO::GetTypeDefHash()
+{
+    HRESULT hr = S_OK;
+
+    if (m_pTypeDefHash == NULL)
+    {
+        ULONG        cTypeDefRecs = m_LiteWeightStgdb.m_MiniMd.getCountTypeDefs();
+        TypeDefRec * pTypeDefRec;
+        LPCUTF8      szNamespace;
+        LPCUTF8      szName;
+        TOKENHASHENTRY *pEntry;
+
+        NewHolder<CMetaDataHashBase> pTypeDefHash = new (nothrow) CMetaDataHashBase();
+        IfNullGo(pTypeDefHash);
+        IfFailGo(pTypeDefHash->NewInit(cTypeDefRecs + 1));
+
+        for (RID rid = cTypeDefRecs; rid >= 1; rid--)
+        {
+            IfFailGo(m_LiteWeightStgdb.m_MiniMd.GetTypeDefRecord(rid, &pTypeDefRec));
+            IfFailGo(m_LiteWeightStgdb.m_MiniMd.getNamespaceOfTypeDef(pTypeDefRec, &szNamespace));
+            IfFailGo(m_LiteWeightStgdb.m_MiniMd.getNameOfTypeDef(pTypeDefRec, &szName));
+
+            pEntry = pTypeDefHash->Add(HashTypeName(szNamespace, szName));
+            IfNullGo(pEntry);
+            pEntry->tok = TokenFromRid(rid, mdtTypeDef);
+        }
+
+        if (InterlockedCompareExchangeT<CMetaDataHashBase *>(&m_pTypeDefHash, pTypeDefHash, NULL) == NULL)
+        {   // We won the initialization race
+            pTypeDefHash.SuppressRelease();
+        }
+    }
+ErrExit:
+    return m_pTypeDefHash;
+} // MDInternalRO::GetTypeDefHash
+
 //*****************************************************************************
 // Given a memberref, return a pointer to memberref's name and signature
 //*****************************************************************************
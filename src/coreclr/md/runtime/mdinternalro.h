@@ -12,6 +12,7 @@
 #define __MDInternalRO__h__
 
 #include "metamodel.h"
+#include "metadatahash.h"
 
 #ifdef FEATURE_METADATA_INTERNAL_APIS
 
@@ -774,6 +775,48 @@ private:
                                   PCCOR_SIGNATURE pvSecondSigBlob, DWORD cbSecondSigBlob,
                                   void* SigARguments);
 
+    // Tables with more records than this are searched by name through a lazily built hash rather than linearly.
+    static const ULONG s_cMinRecordsForLookupHash = 16;
+
+    // Lazily built indexes for name based lookups, NULL until built. Entries are added in descending RID order so that
+    // the records of a hash chain are visited in ascending RID order, the order of the linear search.
+    CMetaDataHashBase   *m_pTypeDefHash;    // TypeDefs hashed by namespace and name.
+    CMetaDataHashBase   *m_pTypeRefHash;    // TypeRefs hashed by namespace and name.
+    CMemberDefHash      *m_pMethodDefHash;  // MethodDefs hashed by parent and name.
+
+    static ULONG HashTypeName(LPCUTF8 szNamespace, LPCUTF8 szName)
+    {   return HashStringA(szNamespace) * 31 + HashStringA(szName); }
+
+    static ULONG HashMethodName(mdTypeDef tkParent, LPCUTF8 szName)
+    {   return HashBytes((const BYTE *) &tkParent, sizeof(mdToken)) + HashStringA(szName); }
+
+    CMetaDataHashBase *GetTypeDefHash();
+    CMetaDataHashBase *GetTypeRefHash();
+    CMemberDefHash *GetMethodDefHash();
+
+    __checkReturn
+    HRESULT CompareTypeDef(                 // S_OK match, S_FALSE no match.
+        RID         rid,                    // [IN] TypeDef to check.
+        LPCSTR      szNamespace,            // [IN] Namespace for the TypeDef.
+        LPCSTR      szName,                 // [IN] Name of the TypeDef.
+        mdToken     tkEnclosingClass);      // [IN] TypeDef of enclosing class, or nil.
+
+    __checkReturn
+    HRESULT CompareTypeRef(                 // S_OK match, S_FALSE no match.
+        RID         rid,                    // [IN] TypeRef to check.
+        LPCSTR      szNamespace,            // [IN] Namespace for the TypeRef.
+        LPCSTR      szName,                 // [IN] Name of the TypeRef.
+        mdToken     tkResolutionScope);     // [IN] Resolution Scope fo the TypeRef.
+
+    __checkReturn
+    HRESULT CompareMethodDef(               // S_OK match, S_FALSE no match.
+        RID         rid,                    // [IN] MethodDef to check.
+        LPCSTR      szName,                 // [IN] Name of the member in utf8.
+        PCCOR_SIGNATURE pvSigBlob,          // [IN] Fixed part of the signature, or NULL.
+        ULONG       cbSigBlob,              // [IN] count of bytes in the signature blob
+        PSIGCOMPARE SigCompare,             // [IN] Signature comparison routine
+        void*       pSigArgs);              // [IN] Additional arguments passed to signature compare
+
     mdTypeDef           m_tdModule;         // <Module> typedef value.
     LONG                m_cRefs;            // Ref count.
 
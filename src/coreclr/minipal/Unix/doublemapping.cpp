@@ -249,3 +249,14 @@ bool VMToOSInterface::ReleaseRWMapping(void* pStart, size_t size)
 {
     return munmap(pStart, size) != -1;
 }
+
+bool VMToOSInterface::AdviseHugePages(void* pStart, size_t size)
+{
+#ifdef MADV_HUGEPAGE
+    // Transparent huge pages are used for the 2MB aligned parts of the range once they are touched. For the shared memory
+    // used by double mapping, they also need to be enabled for shmem (/sys/kernel/mm/transparent_hugepage/shmem_enabled).
+    return madvise(pStart, size, MADV_HUGEPAGE) == 0;
+#else
+    return false;
+#endif
+}
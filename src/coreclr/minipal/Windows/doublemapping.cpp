@@ -203,3 +203,10 @@ bool VMToOSInterface::ReleaseRWMapping(void* pStart, size_t size)
 {
     return UnmapViewOfFile(pStart);
 }
+
+bool VMToOSInterface::AdviseHugePages(void* pStart, size_t size)
+{
+    // Large pages can only be allocated committed as a whole with MEM_LARGE_PAGES, which does not fit memory that is
+    // reserved and then committed incrementally
+    return false;
+}
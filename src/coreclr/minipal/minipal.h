@@ -75,4 +75,12 @@ public:
     // Return:
     //  true if it succeeded, false if it failed
     static bool ReleaseRWMapping(void* pStart, size_t size);
+
+    // Ask the OS to back a block of reserved memory with huge pages where it can
+    // Parameters:
+    //  pStart       - start address of the virtual address range
+    //  size         - size of the memory block
+    // Return:
+    //  true if the OS accepted the request, false if it failed or is not supported
+    static bool AdviseHugePages(void* pStart, size_t size);
 };
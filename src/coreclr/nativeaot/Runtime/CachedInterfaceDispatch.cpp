@@ -41,6 +41,13 @@
 #define CID_MAX_CACHE_SIZE_LOG2 6
 #define CID_MAX_CACHE_SIZE      (1 << CID_MAX_CACHE_SIZE_LOG2)
 
+// Cells whose cache has grown to the maximum size fall back on a global hashed cache shared by all such
+// (megamorphic) cells. An entry is looked up by probing at most CID_MEGAMORPHIC_CACHE_PROBES entries from the
+// hash of the cell and the instance type.
+#define CID_MEGAMORPHIC_CACHE_SIZE_LOG2 12
+#define CID_MEGAMORPHIC_CACHE_SIZE      (1 << CID_MEGAMORPHIC_CACHE_SIZE_LOG2)
+#define CID_MEGAMORPHIC_CACHE_PROBES    8
+
 //#define FEATURE_CID_STATS 1
 
 #ifdef FEATURE_CID_STATS
@@ -55,6 +62,10 @@ extern "C"
     uint32_t CID_g_cCacheReallocates = 0;
     uint32_t CID_g_cCacheAllocates = 0;
     uint32_t CID_g_cCacheDiscards = 0;
+    uint32_t CID_g_cMegamorphicCacheHits = 0;
+    uint32_t CID_g_cMegamorphicCacheMisses = 0;
+    uint32_t CID_g_cMegamorphicCacheInserts = 0;
+    uint32_t CID_g_cMegamorphicCacheFull = 0;
     uint32_t CID_g_cInterfaceDispatches = 0;
     uint32_t CID_g_cbMemoryAllocated = 0;
     uint32_t CID_g_rgAllocatesBySize[CID_MAX_CACHE_SIZE_LOG2 + 1] = { 0 };
@@ -432,6 +443,117 @@ void ReclaimUnusedInterfaceDispatchCaches()
     g_pDiscardedCacheList = NULL;
 }
 
+//
+// Megamorphic cache.
+//
+// Caches of a cell can't grow past CID_MAX_CACHE_SIZE entries, and a cell whose cache is full would otherwise
+// resolve every type that isn't in it again on each dispatch. Mappings of such cells are added to a single
+// open addressed hash table instead, which is searched once the cell's own cache misses.
+//
+// Entries are claimed by setting their cell pointer and are then filled in with the same atomic pair update
+// used for cache entries, so a reader sees either an empty pair or the final mapping. Like cache entries they
+// are never updated once set: cells, types and code are never unloaded, so a mapping remains valid for the
+// lifetime of the process. When all the entries a mapping hashes to are taken the mapping is simply not
+// cached, as is the case for full caches without the megamorphic cache.
+//
+
+struct MegamorphicCacheEntry
+{
+    InterfaceDispatchCell * volatile    m_pCell;    // Cell the mapping belongs to, set when the entry is claimed
+    void *                              m_pUnused;  // Keeps m_entry aligned to twice the alignment of a pointer
+    InterfaceDispatchCacheEntry         m_entry;
+};
+
+// Lazily allocated the first time a cell's cache overflows.
+static MegamorphicCacheEntry * volatile g_pMegamorphicCache = NULL;
+
+static uint32_t MegamorphicCacheIndex(InterfaceDispatchCell * pCell, MethodTable * pInstanceType)
+{
+    uint32_t hash = (uint32_t)(((uintptr_t)pCell >> 3) ^ ((uintptr_t)pInstanceType >> 3));
+    return (hash * 0x9E3779B1) >> (32 - CID_MEGAMORPHIC_CACHE_SIZE_LOG2);
+}
+
+static MegamorphicCacheEntry * GetOrAllocateMegamorphicCache()
+{
+    MegamorphicCacheEntry * pMegamorphicCache = g_pMegamorphicCache;
+    if (pMegamorphicCache != NULL)
+        return pMegamorphicCache;
+
+    CrstHolder lh(&g_sListLock);
+
+    pMegamorphicCache = g_pMegamorphicCache;
+    if (pMegamorphicCache == NULL)
+    {
+        pMegamorphicCache = (MegamorphicCacheEntry *)g_pAllocHeap->AllocAligned(sizeof(MegamorphicCacheEntry) * CID_MEGAMORPHIC_CACHE_SIZE,
+                                                                               sizeof(void*) * 2);
+        if (pMegamorphicCache == NULL)
+            return NULL;
+
+        memset(pMegamorphicCache, 0, sizeof(MegamorphicCacheEntry) * CID_MEGAMORPHIC_CACHE_SIZE);
+#ifdef FEATURE_CID_STATS
+        CID_g_cbMemoryAllocated += sizeof(MegamorphicCacheEntry) * CID_MEGAMORPHIC_CACHE_SIZE;
+#endif
+
+        // The interlocked operation publishes the zeroed entries before the pointer to them.
+        PalInterlockedCompareExchangePointer((void * volatile *)&g_pMegamorphicCache, pMegamorphicCache, NULL);
+    }
+
+    return pMegamorphicCache;
+}
+
+static void AddMegamorphicCacheEntry(InterfaceDispatchCell * pCell, MethodTable * pInstanceType, void * pTargetCode)
+{
+    MegamorphicCacheEntry * pMegamorphicCache = GetOrAllocateMegamorphicCache();
+    if (pMegamorphicCache == NULL)
+    {
+        CID_COUNTER_INC(CacheOutOfMemory);
+        return;
+    }
+
+    uint32_t index = MegamorphicCacheIndex(pCell, pInstanceType);
+    for (uint32_t i = 0; i < CID_MEGAMORPHIC_CACHE_PROBES; i++)
+    {
+        MegamorphicCacheEntry * pEntry = &pMegamorphicCache[(index + i) & (CID_MEGAMORPHIC_CACHE_SIZE - 1)];
+        if (pEntry->m_pCell == NULL &&
+            PalInterlockedCompareExchangePointer((void * volatile *)&pEntry->m_pCell, pCell, NULL) == NULL)
+        {
+            // The entry is ours now, nobody else can race with this update.
+            UpdateCacheEntryAtomically(&pEntry->m_entry, pInstanceType, pTargetCode);
+            CID_COUNTER_INC(MegamorphicCacheInserts);
+            return;
+        }
+    }
+
+    CID_COUNTER_INC(MegamorphicCacheFull);
+}
+
+static void * LookupMegamorphicCacheEntry(InterfaceDispatchCell * pCell, MethodTable * pInstanceType)
+{
+    MegamorphicCacheEntry * pMegamorphicCache = g_pMegamorphicCache;
+    if (pMegamorphicCache == NULL)
+        return NULL;
+
+    uint32_t index = MegamorphicCacheIndex(pCell, pInstanceType);
+    for (uint32_t i = 0; i < CID_MEGAMORPHIC_CACHE_PROBES; i++)
+    {
+        MegamorphicCacheEntry * pEntry = &pMegamorphicCache[(index + i) & (CID_MEGAMORPHIC_CACHE_SIZE - 1)];
+        InterfaceDispatchCell * pEntryCell = pEntry->m_pCell;
+
+        // Entries are claimed in probe order, so there is nothing past an unclaimed one.
+        if (pEntryCell == NULL)
+            break;
+
+        if (pEntryCell == pCell && pEntry->m_entry.m_pInstanceType == pInstanceType)
+        {
+            CID_COUNTER_INC(MegamorphicCacheHits);
+            return pEntry->m_entry.m_pTargetCode;
+        }
+    }
+
+    CID_COUNTER_INC(MegamorphicCacheMisses);
+    return NULL;
+}
+
 // One time initialization of interface dispatch.
 bool InitializeInterfaceDispatch()
 {
@@ -475,12 +597,11 @@ COOP_PINVOKE_HELPER(PTR_Code, RhpUpdateDispatchCellCache, (InterfaceDispatchCell
 
     if (cOldCacheEntries == CID_MAX_CACHE_SIZE)
     {
-        // We already reached the maximum cache size we wish to allocate. For now don't attempt to cache
-        // the mapping we just did: there's no safe way to update the existing cache right now if it
-        // doesn't have an empty entries. There are schemes that would let us do this at the next GC point
-        // but it's not clear whether we should do this or re-tune the cache max size, we need to measure
-        // this.
+        // We already reached the maximum cache size we wish to allocate. There's no safe way to update the
+        // existing cache right now if it doesn't have an empty entries, so the mapping goes into the global
+        // megamorphic cache instead, which is searched when the cell's cache misses.
         CID_COUNTER_INC(CacheSizeOverflows);
+        AddMegamorphicCacheEntry(pCell, pInstanceType, pTargetCode);
         return (PTR_Code)pTargetCode;
     }
 
@@ -528,6 +649,10 @@ COOP_PINVOKE_HELPER(PTR_Code, RhpSearchDispatchCellCache, (InterfaceDispatchCell
         for (uint32_t i = 0; i < pCache->m_cEntries; i++, pCacheEntry++)
             if (pCacheEntry->m_pInstanceType == pInstanceType)
                 return (PTR_Code)pCacheEntry->m_pTargetCode;
+
+        // Only cells whose cache is full have mappings in the megamorphic cache.
+        if (pCache->m_cEntries == CID_MAX_CACHE_SIZE)
+            return (PTR_Code)LookupMegamorphicCacheEntry(pCell, pInstanceType);
     }
 
     return nullptr;
@@ -3,6 +3,14 @@
 
 #include "volatile.h"
 
+#if defined(HOST_AMD64)
+#include "emmintrin.h"
+#define USE_INTEL_INTRINSICS_FOR_GC_SAFE_COPY
+#elif defined(HOST_ARM64) && !defined(TARGET_UNIX) // The Mac and Linux build environments are not setup for NEON simd.
+#include "arm64_neon.h"
+#define USE_ARM_INTRINSICS_FOR_GC_SAFE_COPY
+#endif
+
 //
 // Unmanaged GC memory helpers
 //
@@ -34,6 +42,27 @@ FORCEINLINE void InlineGCSafeFillMemory(void * mem, size_t size, size_t pv)
     while (!IS_ALIGNED(memBytes, sizeof(void *)) && (memBytes < endBytes))
         *memBytes++ = (uint8_t)pv;
 
+#if defined(USE_INTEL_INTRINSICS_FOR_GC_SAFE_COPY) || defined(USE_ARM_INTRINSICS_FOR_GC_SAFE_COPY)
+    // write 32 bytes at a time, a vector store of pointer aligned memory is made of pointer sized stores that
+    // are each atomic
+#if defined(USE_INTEL_INTRINSICS_FOR_GC_SAFE_COPY)
+    __m128i vpv = _mm_set1_epi64x((int64_t)pv);
+#else
+    uint64x2_t vpv = vdupq_n_u64((uint64_t)pv);
+#endif
+    while (endBytes - memBytes >= 32)
+    {
+#if defined(USE_INTEL_INTRINSICS_FOR_GC_SAFE_COPY)
+        _mm_storeu_si128((__m128i *)memBytes, vpv);
+        _mm_storeu_si128((__m128i *)(memBytes + 16), vpv);
+#else
+        vst1q_u64((uint64_t *)memBytes, vpv);
+        vst1q_u64((uint64_t *)(memBytes + 16), vpv);
+#endif
+        memBytes += 32;
+    }
+#endif
+
     // now write pointer sized pieces
     // volatile ensures that this doesn't get optimized back into a memset call
     size_t nPtrs = (endBytes - memBytes) / sizeof(void *);
@@ -50,6 +79,33 @@ FORCEINLINE void InlineGCSafeFillMemory(void * mem, size_t size, size_t pv)
 // These functions copy memory in a GC safe way.  They makes the guarantee
 // that the memory is copies in at least pointer sized chunks.
 
+// Copies 4 pointers. On 64-bit hosts with SIMD support this is done with two 16 byte vector moves, a vector
+// access of pointer aligned memory is made of pointer sized accesses that are each atomic. Both halves are
+// loaded before either is stored, so overlapping copies in either direction are fine.
+FORCEINLINE void InlineGCSafeCopyFourPointers(uint8_t * dmem, const uint8_t * smem)
+{
+#if defined(USE_INTEL_INTRINSICS_FOR_GC_SAFE_COPY)
+    __m128i v0 = _mm_loadu_si128((const __m128i *)smem);
+    __m128i v1 = _mm_loadu_si128((const __m128i *)(smem + 16));
+    _mm_storeu_si128((__m128i *)dmem, v0);
+    _mm_storeu_si128((__m128i *)(dmem + 16), v1);
+#elif defined(USE_ARM_INTRINSICS_FOR_GC_SAFE_COPY)
+    uint64x2_t v0 = vld1q_u64((const uint64_t *)smem);
+    uint64x2_t v1 = vld1q_u64((const uint64_t *)(smem + 16));
+    vst1q_u64((uint64_t *)dmem, v0);
+    vst1q_u64((uint64_t *)(dmem + 16), v1);
+#else
+    size_t p0 = ((size_t *)smem)[0];
+    size_t p1 = ((size_t *)smem)[1];
+    size_t p2 = ((size_t *)smem)[2];
+    size_t p3 = ((size_t *)smem)[3];
+    ((size_t *)dmem)[0] = p0;
+    ((size_t *)dmem)[1] = p1;
+    ((size_t *)dmem)[2] = p2;
+    ((size_t *)dmem)[3] = p3;
+#endif
+}
+
 FORCEINLINE void InlineForwardGCSafeCopy(void * dest, const void *src, size_t len)
 {
     // All parameters must be pointer-size-aligned
@@ -68,10 +124,7 @@ FORCEINLINE void InlineForwardGCSafeCopy(void * dest, const void *src, size_t le
     while (size >= 4 * sizeof(size_t))
     {
         size -= 4 * sizeof(size_t);
-        ((size_t *)dmem)[0] = ((size_t *)smem)[0];
-        ((size_t *)dmem)[1] = ((size_t *)smem)[1];
-        ((size_t *)dmem)[2] = ((size_t *)smem)[2];
-        ((size_t *)dmem)[3] = ((size_t *)smem)[3];
+        InlineGCSafeCopyFourPointers(dmem, smem);
         smem += 4 * sizeof(size_t);
         dmem += 4 * sizeof(size_t);
     }
@@ -112,10 +165,7 @@ FORCEINLINE void InlineBackwardGCSafeCopy(void * dest, const void *src, size_t l
         size -= 4 * sizeof(size_t);
         smem -= 4 * sizeof(size_t);
         dmem -= 4 * sizeof(size_t);
-        ((size_t *)dmem)[3] = ((size_t *)smem)[3];
-        ((size_t *)dmem)[2] = ((size_t *)smem)[2];
-        ((size_t *)dmem)[1] = ((size_t *)smem)[1];
-        ((size_t *)dmem)[0] = ((size_t *)smem)[0];
+        InlineGCSafeCopyFourPointers(dmem, smem);
     }
 
     // copy 2 trailing pointers, if needed
@@ -208,6 +258,44 @@ FORCEINLINE void InlineCheckedWriteBarrier(void * dst, void * ref)
     InlineWriteBarrier(dst, ref);
 }
 
+// Sets a range of card (or card bundle) bytes. To avoid cache line thrashing we check whether the bytes have
+// already been set before writing, a pointer sized word of them at a time where the range allows it.
+FORCEINLINE void InlineSetCardRange(uint8_t* card, size_t count)
+{
+    while (count != 0 && !IS_ALIGNED(card, sizeof(uintptr_t)))
+    {
+        if (*card != 0xff)
+        {
+            *card = 0xff;
+        }
+
+        card++;
+        count--;
+    }
+
+    while (count >= sizeof(uintptr_t))
+    {
+        if (*(uintptr_t*)card != ~(uintptr_t)0)
+        {
+            *(uintptr_t*)card = ~(uintptr_t)0;
+        }
+
+        card += sizeof(uintptr_t);
+        count -= sizeof(uintptr_t);
+    }
+
+    while (count != 0)
+    {
+        if (*card != 0xff)
+        {
+            *card = 0xff;
+        }
+
+        card++;
+        count--;
+    }
+}
+
 FORCEINLINE void InlinedBulkWriteBarrier(void* pMemStart, size_t cbMemSize)
 {
     // Check whether the writes were even into the heap. If not there's no card update required.
@@ -290,19 +378,8 @@ FORCEINLINE void InlinedBulkWriteBarrier(void* pMemStart, size_t cbMemSize)
     // with g_lowest/highest_address check at the beginning of this function.
     uint8_t* card = ((uint8_t*)VolatileLoadWithoutBarrier(&g_card_table)) + startingClump;
 
-    // Fill the cards. To avoid cache line thrashing we check whether the cards have already been set before
-    // writing.
-    do
-    {
-        if (*card != 0xff)
-        {
-            *card = 0xff;
-        }
-
-        card++;
-        clumpCount--;
-    }
-    while (clumpCount != 0);
+    // Fill the cards.
+    InlineSetCardRange(card, clumpCount);
 
 #ifdef FEATURE_MANUALLY_MANAGED_CARD_BUNDLES
     size_t startBundleByte = startAddress >> card_bundle_byte_shift;
@@ -311,16 +388,7 @@ FORCEINLINE void InlinedBulkWriteBarrier(void* pMemStart, size_t cbMemSize)
 
     uint8_t* pBundleByte = ((uint8_t*)VolatileLoadWithoutBarrier(&g_card_bundle_table)) + startBundleByte;
 
-    do
-    {
-        if (*pBundleByte != 0xFF)
-        {
-            *pBundleByte = 0xFF;
-        }
-
-        pBundleByte++;
-        bundleByteCount--;
-    } while (bundleByteCount != 0);
+    InlineSetCardRange(pBundleByte, bundleByteCount);
 #endif
 }
 #endif // DACCESS_COMPILE
@@ -39,35 +39,63 @@ TypeManager * TypeManager::Create(HANDLE osModule, void * pModuleHeader, void**
     return new (nothrow) TypeManager(osModule, pReadyToRunHeader, pClasslibFunctions, nClasslibFunctions);
 }
 
+TypeManager::ModuleInfoRow TypeManager::s_missingSectionRow = { 0, (int32_t)ModuleInfoFlags::HasEndPointer, nullptr, nullptr };
+
 TypeManager::TypeManager(HANDLE osModule, ReadyToRunHeader * pHeader, void** pClasslibFunctions, uint32_t nClasslibFunctions)
     : m_osModule(osModule), m_pHeader(pHeader),
       m_pClasslibFunctions(pClasslibFunctions), m_nClasslibFunctions(nClasslibFunctions)
 {
+    // Every module is registered before Main runs, so only the dispatch map, which the managed side reads
+    // directly from this layout, is looked up here. The other sections are found when first asked for.
+    memset(m_pSectionRows, 0, sizeof(m_pSectionRows));
+
     int length;
-    m_pStaticsGCDataSection = (uint8_t*)GetModuleSection(ReadyToRunSectionType::GCStaticRegion, &length);
-    m_pThreadStaticsDataSection = (uint8_t*)GetModuleSection(ReadyToRunSectionType::ThreadStaticRegion, &length);
     m_pDispatchMapTable = (DispatchMap **)GetModuleSection(ReadyToRunSectionType::InterfaceDispatchTable, &length);
 }
 
-void * TypeManager::GetModuleSection(ReadyToRunSectionType sectionId, int * length)
+TypeManager::ModuleInfoRow * TypeManager::FindModuleInfoRow(ReadyToRunSectionType sectionId)
 {
     ModuleInfoRow * pModuleInfoRows = (ModuleInfoRow *)(m_pHeader + 1);
 
     ASSERT(m_pHeader->EntrySize == sizeof(ModuleInfoRow));
 
-    // TODO: Binary search
     for (int i = 0; i < m_pHeader->NumberOfSections; i++)
     {
         ModuleInfoRow * pCurrent = pModuleInfoRows + i;
         if ((int32_t)sectionId == pCurrent->SectionId)
+            return pCurrent;
+    }
+
+    return nullptr;
+}
+
+void * TypeManager::GetModuleSection(ReadyToRunSectionType sectionId, int * length)
+{
+    ModuleInfoRow * pRow;
+
+    int index = (int)sectionId - FirstIndexedSectionId;
+    if (index >= 0 && index <= LastIndexedSectionId - FirstIndexedSectionId)
+    {
+        // The startup code asks for the same few sections of every module, so remember where each one is.
+        // Racing threads find the same row, so the cache can be filled without synchronization.
+        pRow = m_pSectionRows[index];
+        if (pRow == nullptr)
         {
-            *length = pCurrent->GetLength();
-            return pCurrent->Start;
+            pRow = FindModuleInfoRow(sectionId);
+            if (pRow == nullptr)
+                pRow = &s_missingSectionRow;
+            m_pSectionRows[index] = pRow;
         }
     }
+    else
+    {
+        pRow = FindModuleInfoRow(sectionId);
+        if (pRow == nullptr)
+            pRow = &s_missingSectionRow;
+    }
 
-    *length = 0;
-    return nullptr;
+    *length = pRow->GetLength();
+    return pRow->Start;
 }
 
 void * TypeManager::GetClasslibFunction(ClasslibFunctionId functionId)
@@ -12,11 +12,18 @@ class TypeManager
     HANDLE                      m_osModule;
     ReadyToRunHeader *          m_pHeader;
     DispatchMap**               m_pDispatchMapTable;
-    uint8_t*                    m_pStaticsGCDataSection;
-    uint8_t*                    m_pThreadStaticsDataSection;
     void**                      m_pClasslibFunctions;
     uint32_t                    m_nClasslibFunctions;
 
+    struct ModuleInfoRow;
+
+    // Rows of the sections with fixed ids, found on the first lookup of each. Null means not looked up yet.
+    static const int FirstIndexedSectionId = (int)ReadyToRunSectionType::StringTable;
+    static const int LastIndexedSectionId = (int)ReadyToRunSectionType::ImportAddressTables;
+    ModuleInfoRow *             m_pSectionRows[LastIndexedSectionId - FirstIndexedSectionId + 1];
+
+    ModuleInfoRow * FindModuleInfoRow(ReadyToRunSectionType sectionId);
+
     TypeManager(HANDLE osModule, ReadyToRunHeader * pHeader, void** pClasslibFunctions, uint32_t nClasslibFunctions);
 
 public:
@@ -37,6 +44,9 @@ private:
         bool HasEndPointer();
         int GetLength();
     };
+
+    // Cached in m_pSectionRows for sections the module does not have
+    static ModuleInfoRow s_missingSectionRow;
 };
 
 // TypeManagerHandle represents an AOT module in MRT based runtimes.
@@ -70,11 +70,11 @@ void GCToCLREventSink::FireGCHeapStats_V2(
 {
     LIMITED_METHOD_CONTRACT;
 
-    // TODO: FireEtwGCHeapStats_V2
-    FireEtwGCHeapStats_V1(generationSize0, totalPromotedSize0, generationSize1, totalPromotedSize1,
+    FireEtwGCHeapStats_V2(generationSize0, totalPromotedSize0, generationSize1, totalPromotedSize1,
                           generationSize2, totalPromotedSize2, generationSize3, totalPromotedSize3,
                           finalizationPromotedSize, finalizationPromotedCount, pinnedObjectCount,
-                          sinkBlockCount, gcHandleCount, GetClrInstanceId());
+                          sinkBlockCount, gcHandleCount, GetClrInstanceId(),
+                          generationSize4, totalPromotedSize4);
 }
 
 void GCToCLREventSink::FireGCCreateSegment_V1(void* address, size_t size, uint32_t type)
@@ -260,7 +260,7 @@ void GCToCLREventSink::FireBGC1stConEnd()
 
 void GCToCLREventSink::FireBGC1stSweepEnd(uint32_t genNumber)
 {
-    //FireEtwBGC1stSweepEnd(genNumber, GetClrInstanceId()); TODO
+    FireEtwBGC1stSweepEnd(genNumber, GetClrInstanceId());
 }
 
 void GCToCLREventSink::FireBGC2ndNonConBegin()
@@ -295,8 +295,7 @@ void GCToCLREventSink::FireBGCRevisit(uint64_t pages, uint64_t objects, uint32_t
 
 void GCToCLREventSink::FireBGCOverflow_V1(uint64_t min, uint64_t max, uint64_t objects, uint32_t isLarge, uint32_t genNumber)
 {
-    // TODO: FireBGCOverflow_V1
-    FireEtwBGCOverflow(min, max, objects, isLarge, GetClrInstanceId());
+    FireEtwBGCOverflow_V1(min, max, objects, isLarge, GetClrInstanceId(), genNumber);
 }
 
 void GCToCLREventSink::FireBGCAllocWaitBegin(uint32_t reason)
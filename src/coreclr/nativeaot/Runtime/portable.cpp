@@ -47,6 +47,7 @@ struct gc_alloc_context
     void*          gc_reserved_1;
     void*          gc_reserved_2;
     int            alloc_count;
+    int            alloc_refill_count;
 };
 
 //
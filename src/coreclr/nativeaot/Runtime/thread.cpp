@@ -649,6 +649,8 @@ void Thread::HijackCallback(NATIVE_CONTEXT* pThreadContext, void* pThreadToHijac
     }
 
     void* pvAddress = (void*)pThreadContext->GetIp();
+    pThread->m_pvLastHijackIP = pvAddress;
+
     RuntimeInstance* runtime = GetRuntimeInstance();
     if (!runtime->IsManaged(pvAddress))
     {
@@ -99,6 +99,7 @@ struct ThreadBuffer
     EEThreadId              m_threadId;
     PTR_VOID                m_pThreadStressLog;                     // pointer to head of thread's StressLogChunks
     NATIVE_CONTEXT*         m_interruptedContext;                   // context for an asynchronously interrupted thread.
+    void *                  m_pvLastHijackIP;                       // IP the thread was at when last interrupted for a hijack, for diagnostics
 #ifdef FEATURE_SUSPEND_REDIRECTION
     uint8_t*                m_redirectionContextBuffer;             // storage for redirection context, allocated on demand
 #endif //FEATURE_SUSPEND_REDIRECTION
@@ -26,6 +26,8 @@
 
 #include "slist.inl"
 #include "GCMemoryHelpers.h"
+#include "stressLog.h"
+#include "RhVolatile.h"
 
 EXTERN_C volatile uint32_t RhpTrapThreads;
 volatile uint32_t RhpTrapThreads = (uint32_t)TrapThreadsFlags::None;
@@ -230,6 +232,31 @@ void SpinWait(int iteration, int usecLimit)
     }
 }
 
+// Threads that take longer than this to suspend are reported in the stress log, once per suspension.
+static const int64_t SlowSuspensionReportThresholdUsec = 1000;
+
+// Reports a thread that is holding up the suspension along with the method it was last seen in. Threads
+// running long loops in methods without safe points, where hijacking the return address does not stop
+// them until the loop ends, are the usual cause of slow suspensions.
+static void ReportSlowSuspension(Thread * pTargetThread, void * pvLastHijackIP, int64_t usecElapsed)
+{
+    void * pvMethodStart = NULL;
+
+    RuntimeInstance * runtime = GetRuntimeInstance();
+    if (pvLastHijackIP != NULL && runtime->IsManaged(pvLastHijackIP))
+    {
+        ICodeManager * codeManager = runtime->GetCodeManagerForAddress(pvLastHijackIP);
+        MethodInfo methodInfo;
+        if (codeManager->FindMethodInfo(pvLastHijackIP, &methodInfo))
+        {
+            pvMethodStart = codeManager->GetMethodStartAddress(&methodInfo);
+        }
+    }
+
+    STRESS_LOG4(LF_GC, LL_WARNING, "SuspendAllThreads: TgtThread = %llx not suspended after %lld usec, IP = %p, Method = %p\n",
+        pTargetThread->GetPalThreadIdForLogging(), usecElapsed, pvLastHijackIP, pvMethodStart);
+}
+
 void ThreadStore::SuspendAllThreads(bool waitForGCEvent)
 {
     Thread * pThisThread = GetCurrentThreadIfAvailable();
@@ -255,11 +282,24 @@ void ThreadStore::SuspendAllThreads(bool waitForGCEvent)
     int remaining = 0;
     bool observeOnly = false;
 
+    int64_t startTicks = PalQueryPerformanceCounter();
+    int64_t ticksPerSecond = PalQueryPerformanceFrequency();
+    bool reportedSlowSuspension = false;
+
     while(true)
     {
         prevRemaining = remaining;
         remaining = 0;
 
+        int64_t usecElapsed = 0;
+        bool reportSlowSuspension = false;
+        if (!reportedSlowSuspension && prevRemaining != 0)
+        {
+            usecElapsed = ((PalQueryPerformanceCounter() - startTicks) * 1000000) / ticksPerSecond;
+            reportSlowSuspension = usecElapsed >= SlowSuspensionReportThresholdUsec;
+            reportedSlowSuspension = reportSlowSuspension;
+        }
+
         FOREACH_THREAD(pTargetThread)
         {
             if (pTargetThread == pThisThread)
@@ -268,6 +308,11 @@ void ThreadStore::SuspendAllThreads(bool waitForGCEvent)
             if (!pTargetThread->CacheTransitionFrameForSuspend())
             {
                 remaining++;
+                if (reportSlowSuspension)
+                {
+                    ReportSlowSuspension(pTargetThread, VolatileLoadWithoutBarrier(&pTargetThread->m_pvLastHijackIP), usecElapsed);
+                }
+
                 if (!observeOnly)
                 {
                     pTargetThread->Hijack();
@@ -409,7 +409,8 @@ enum
     GenerateDumpFlagsLoggingEnabled = 0x01,
     GenerateDumpFlagsVerboseLoggingEnabled = 0x02,
     GenerateDumpFlagsCrashReportEnabled = 0x04,
-    GenerateDumpFlagsCrashReportOnlyEnabled = 0x08
+    GenerateDumpFlagsCrashReportOnlyEnabled = 0x08,
+    GenerateDumpFlagsForkSnapshotEnabled = 0x10
 };
 
 PALIMPORT
@@ -422,6 +423,20 @@ PAL_GenerateCoreDump(
     LPSTR errorMessageBuffer,
     INT cbErrorMessageBuffer);
 
+typedef VOID (*PPAL_SNAPSHOT_FORKED_CALLBACK)(PVOID parameter);
+
+PALIMPORT
+BOOL
+PALAPI
+PAL_GenerateSnapshotCoreDump(
+    IN LPCSTR dumpName,
+    IN INT dumpType,
+    IN ULONG32 flags,
+    IN PPAL_SNAPSHOT_FORKED_CALLBACK forkedCallback,
+    IN PVOID parameter,
+    LPSTR errorMessageBuffer,
+    INT cbErrorMessageBuffer);
+
 typedef VOID (*PPAL_STARTUP_CALLBACK)(
     char *modulePath,
     HMODULE hModule,
@@ -2965,6 +2980,20 @@ VirtualProtect(
            IN DWORD flNewProtect,
            OUT PDWORD lpflOldProtect);
 
+typedef struct _WIN32_MEMORY_RANGE_ENTRY {
+    PVOID VirtualAddress;
+    SIZE_T NumberOfBytes;
+} WIN32_MEMORY_RANGE_ENTRY, *PWIN32_MEMORY_RANGE_ENTRY;
+
+PALIMPORT
+BOOL
+PALAPI
+PrefetchVirtualMemory(
+           IN HANDLE hProcess,
+           IN ULONG_PTR NumberOfEntries,
+           IN PWIN32_MEMORY_RANGE_ENTRY VirtualAddresses,
+           IN ULONG Flags);
+
 typedef struct _MEMORYSTATUSEX {
   DWORD     dwLength;
   DWORD     dwMemoryLoad;
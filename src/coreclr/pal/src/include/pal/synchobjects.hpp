@@ -27,6 +27,15 @@ Abstract:
 
 #include <pthread.h>
 
+// On Linux a thread blocks for a wait directly on a futex on its native wait
+// predicate, instead of on the condition/mutex pair. Waking it up then takes a
+// single atomic exchange, plus a FUTEX_WAKE only if the thread is sleeping.
+#ifdef __linux__
+#define SYNCHMGR_USE_FUTEX 1
+#else
+#define SYNCHMGR_USE_FUTEX 0
+#endif
+
 #define SharedID SHMPTR
 #define SharedIDToPointer(shID) SHMPTR_TO_TYPED_PTR(PVOID, shID)
 #define SharedIDToTypePointer(TYPE,shID) SHMPTR_TO_TYPED_PTR(TYPE, shID)
@@ -90,6 +99,8 @@ namespace CorUnix
     {
         pthread_mutex_t     mutex;
         pthread_cond_t      cond;
+        // With SYNCHMGR_USE_FUTEX this is the futex word: FALSE, TRUE or
+        // NativeWaitPredSleeping while the owner thread is blocked on it
         int                 iPred;
         DWORD               dwObjectIndex;
         ThreadWakeupReason  twrWakeupReason;
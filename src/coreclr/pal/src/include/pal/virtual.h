@@ -29,6 +29,10 @@ typedef struct _CMI {
     struct _CMI * pNext;        /* Link to the next entry. */
     struct _CMI * pPrevious;    /* Link to the previous entry. */
 
+    struct _CMI * pLeft;        /* Links in the AVL tree indexing the */
+    struct _CMI * pRight;       /* entries by startBoundary. */
+    INT treeHeight;             /* Height of the subtree rooted at this entry. */
+
     UINT_PTR startBoundary;     /* Starting location of the region. */
     SIZE_T   memSize;           /* Size of the entire region.. */
 
@@ -28,6 +28,7 @@ SET_DEFAULT_DEBUG_CHANNEL(VIRTUAL); // some headers have code with asserts, so d
 #include "pal/seh.hpp"
 #include "pal/virtual.h"
 #include "pal/map.h"
+#include "pal/handlemgr.hpp"
 #include "pal/init.h"
 #include "pal/utils.h"
 #include "common.h"
@@ -50,6 +51,9 @@ CRITICAL_SECTION virtual_critsec;
 
 // The first node in our list of allocated blocks.
 static PCMI pVirtualMemory;
+// AVL tree over the entries of pVirtualMemory, so that looking up the
+// region of an address doesn't walk every reservation of the process.
+static PCMI pVirtualMemoryTree;
 
 static size_t s_virtualPageSize = 0;
 
@@ -172,6 +176,7 @@ VIRTUALInitialize(bool initializeExecutableMemoryAllocator)
     InternalInitializeCriticalSection(&virtual_critsec);
 
     pVirtualMemory = NULL;
+    pVirtualMemoryTree = NULL;
 
     if (initializeExecutableMemoryAllocator)
     {
@@ -209,6 +214,7 @@ void VIRTUALCleanup()
         free(pTempEntry );
     }
     pVirtualMemory = NULL;
+    pVirtualMemoryTree = NULL;
 
     InternalLeaveCriticalSection(pthrCurrent, &virtual_critsec);
 
@@ -465,6 +471,158 @@ static BOOL VIRTUALSetAllocState( UINT nAction, SIZE_T nStartingBit,
                               nNumberOfBits, pInformation->pAllocState);
 }
 
+/****
+ *
+ * Helpers maintaining pVirtualMemoryTree. The tree holds the same entries
+ * as the list, the caller must own the critical section.
+ *
+ */
+static INT VIRTUALTreeHeight( PCMI pEntry )
+{
+    return pEntry ? pEntry->treeHeight : 0;
+}
+
+static void VIRTUALTreeUpdateHeight( PCMI pEntry )
+{
+    INT leftHeight = VIRTUALTreeHeight(pEntry->pLeft);
+    INT rightHeight = VIRTUALTreeHeight(pEntry->pRight);
+    pEntry->treeHeight = 1 + ((leftHeight > rightHeight) ? leftHeight : rightHeight);
+}
+
+static PCMI VIRTUALTreeRotateLeft( PCMI pEntry )
+{
+    PCMI pRight = pEntry->pRight;
+    pEntry->pRight = pRight->pLeft;
+    pRight->pLeft = pEntry;
+    VIRTUALTreeUpdateHeight(pEntry);
+    VIRTUALTreeUpdateHeight(pRight);
+    return pRight;
+}
+
+static PCMI VIRTUALTreeRotateRight( PCMI pEntry )
+{
+    PCMI pLeft = pEntry->pLeft;
+    pEntry->pLeft = pLeft->pRight;
+    pLeft->pRight = pEntry;
+    VIRTUALTreeUpdateHeight(pEntry);
+    VIRTUALTreeUpdateHeight(pLeft);
+    return pLeft;
+}
+
+/* Rebalances the subtree rooted at pEntry, returns its new root. */
+static PCMI VIRTUALTreeBalance( PCMI pEntry )
+{
+    VIRTUALTreeUpdateHeight(pEntry);
+
+    INT balance = VIRTUALTreeHeight(pEntry->pLeft) - VIRTUALTreeHeight(pEntry->pRight);
+    if (balance > 1)
+    {
+        if (VIRTUALTreeHeight(pEntry->pLeft->pLeft) < VIRTUALTreeHeight(pEntry->pLeft->pRight))
+        {
+            pEntry->pLeft = VIRTUALTreeRotateLeft(pEntry->pLeft);
+        }
+        return VIRTUALTreeRotateRight(pEntry);
+    }
+
+    if (balance < -1)
+    {
+        if (VIRTUALTreeHeight(pEntry->pRight->pRight) < VIRTUALTreeHeight(pEntry->pRight->pLeft))
+        {
+            pEntry->pRight = VIRTUALTreeRotateRight(pEntry->pRight);
+        }
+        return VIRTUALTreeRotateLeft(pEntry);
+    }
+
+    return pEntry;
+}
+
+static PCMI VIRTUALTreeInsert( PCMI pRoot, PCMI pNewEntry )
+{
+    if (pRoot == NULL)
+    {
+        pNewEntry->pLeft = NULL;
+        pNewEntry->pRight = NULL;
+        pNewEntry->treeHeight = 1;
+        return pNewEntry;
+    }
+
+    if (pNewEntry->startBoundary < pRoot->startBoundary)
+    {
+        pRoot->pLeft = VIRTUALTreeInsert(pRoot->pLeft, pNewEntry);
+    }
+    else
+    {
+        pRoot->pRight = VIRTUALTreeInsert(pRoot->pRight, pNewEntry);
+    }
+
+    return VIRTUALTreeBalance(pRoot);
+}
+
+static PCMI VIRTUALTreeRemoveMin( PCMI pRoot, PCMI * ppMin )
+{
+    if (pRoot->pLeft == NULL)
+    {
+        *ppMin = pRoot;
+        return pRoot->pRight;
+    }
+
+    pRoot->pLeft = VIRTUALTreeRemoveMin(pRoot->pLeft, ppMin);
+    return VIRTUALTreeBalance(pRoot);
+}
+
+static PCMI VIRTUALTreeRemove( PCMI pRoot, PCMI pEntry )
+{
+    _ASSERTE(pRoot != NULL);
+
+    if (pRoot == pEntry)
+    {
+        if (pEntry->pRight == NULL)
+        {
+            return pEntry->pLeft;
+        }
+
+        /* Replace the entry by its successor. */
+        PCMI pSuccessor;
+        PCMI pRight = VIRTUALTreeRemoveMin(pEntry->pRight, &pSuccessor);
+        pSuccessor->pLeft = pEntry->pLeft;
+        pSuccessor->pRight = pRight;
+        return VIRTUALTreeBalance(pSuccessor);
+    }
+
+    if (pEntry->startBoundary < pRoot->startBoundary)
+    {
+        pRoot->pLeft = VIRTUALTreeRemove(pRoot->pLeft, pEntry);
+    }
+    else
+    {
+        pRoot->pRight = VIRTUALTreeRemove(pRoot->pRight, pEntry);
+    }
+
+    return VIRTUALTreeBalance(pRoot);
+}
+
+/* Returns the entry with the highest startBoundary <= address, NULL if none. */
+static PCMI VIRTUALTreeFindFloor( UINT_PTR address )
+{
+    PCMI pEntry = pVirtualMemoryTree;
+    PCMI pFloor = NULL;
+
+    while (pEntry)
+    {
+        if (pEntry->startBoundary <= address)
+        {
+            pFloor = pEntry;
+            pEntry = pEntry->pRight;
+        }
+        else
+        {
+            pEntry = pEntry->pLeft;
+        }
+    }
+
+    return pFloor;
+}
+
 /****
  *
  * VIRTUALFindRegionInformation( )
@@ -479,22 +637,12 @@ static PCMI VIRTUALFindRegionInformation( IN UINT_PTR address )
 
     TRACE( "VIRTUALFindRegionInformation( %#x )\n", address );
 
-    pEntry = pVirtualMemory;
+    pEntry = VIRTUALTreeFindFloor( address );
 
-    while( pEntry )
+    if ( pEntry && pEntry->startBoundary + pEntry->memSize <= address )
     {
-        if ( pEntry->startBoundary > address )
-        {
-            /* Gone past the possible location in the list. */
-            pEntry = NULL;
-            break;
-        }
-        if ( pEntry->startBoundary + pEntry->memSize > address )
-        {
-            break;
-        }
-
-        pEntry = pEntry->pNext;
+        /* The address is past the end of the closest region below it. */
+        pEntry = NULL;
     }
     return pEntry;
 }
@@ -518,6 +666,8 @@ static BOOL VIRTUALReleaseMemory( PCMI pMemoryToBeReleased )
         return FALSE;
     }
 
+    pVirtualMemoryTree = VIRTUALTreeRemove( pVirtualMemoryTree, pMemoryToBeReleased );
+
     if ( pMemoryToBeReleased == pVirtualMemory )
     {
         /* This is either the first entry, or the only entry. */
@@ -773,17 +923,12 @@ static BOOL VIRTUALStoreAllocationInfo(
         return FALSE;
     }
 
-    pMemInfo = pVirtualMemory;
+    /* The entry is inserted after the closest region below it */
+    pMemInfo = VIRTUALTreeFindFloor(startBoundary);
+    pVirtualMemoryTree = VIRTUALTreeInsert(pVirtualMemoryTree, pNewEntry);
 
-    if (pMemInfo && pMemInfo->startBoundary < startBoundary)
+    if (pMemInfo)
     {
-        /* Look for the correct insert point */
-        TRACE("Looking for the correct insert location.\n");
-        while (pMemInfo->pNext && (pMemInfo->pNext->startBoundary < startBoundary))
-        {
-            pMemInfo = pMemInfo->pNext;
-        }
-
         pNewEntry->pNext = pMemInfo->pNext;
         pNewEntry->pPrevious = pMemInfo;
 
@@ -797,7 +942,7 @@ static BOOL VIRTUALStoreAllocationInfo(
     else
     {
         /* This is the first entry in the list. */
-        pNewEntry->pNext = pMemInfo;
+        pNewEntry->pNext = pVirtualMemory;
         pNewEntry->pPrevious = nullptr;
 
         if (pNewEntry->pNext)
@@ -1784,6 +1929,62 @@ ExitVirtualProtect:
     return bRetVal;
 }
 
+/*++
+Function:
+  PrefetchVirtualMemory
+
+See MSDN doc. Only the current process is supported. The ranges are advised
+to the kernel, which reads the pages in asynchronously.
+--*/
+BOOL
+PALAPI
+PrefetchVirtualMemory(
+           IN HANDLE hProcess,
+           IN ULONG_PTR NumberOfEntries,
+           IN PWIN32_MEMORY_RANGE_ENTRY VirtualAddresses,
+           IN ULONG Flags)
+{
+    BOOL bRetVal = TRUE;
+
+    PERF_ENTRY(PrefetchVirtualMemory);
+    ENTRY("PrefetchVirtualMemory(hProcess=%p, NumberOfEntries=%u, "
+          "VirtualAddresses=%p, Flags=%#x)\n",
+          hProcess, NumberOfEntries, VirtualAddresses, Flags);
+
+    if (hProcess != hPseudoCurrentProcess || Flags != 0 ||
+        (NumberOfEntries != 0 && VirtualAddresses == NULL))
+    {
+        ERROR("Only the current process and no flags are supported.\n");
+        SetLastError(ERROR_INVALID_PARAMETER);
+        bRetVal = FALSE;
+        goto ExitPrefetchVirtualMemory;
+    }
+
+    for (ULONG_PTR i = 0; i < NumberOfEntries; i++)
+    {
+        UINT_PTR StartBoundary = (UINT_PTR)ALIGN_DOWN(VirtualAddresses[i].VirtualAddress, GetVirtualPageSize());
+        SIZE_T MemSize = ALIGN_UP((UINT_PTR)VirtualAddresses[i].VirtualAddress + VirtualAddresses[i].NumberOfBytes,
+                                  GetVirtualPageSize()) - StartBoundary;
+
+        if (MemSize == 0)
+        {
+            continue;
+        }
+
+        // The advice is only a hint, ranges that cannot be prefetched are skipped
+        int st = posix_madvise((LPVOID)StartBoundary, MemSize, POSIX_MADV_WILLNEED);
+        if (st != 0)
+        {
+            WARN("posix_madvise failed for %p, size %u with error %d\n", StartBoundary, MemSize, st);
+        }
+    }
+
+ExitPrefetchVirtualMemory:
+    LOGEXIT("PrefetchVirtualMemory returning %s.\n", bRetVal == TRUE ? "TRUE" : "FALSE");
+    PERF_EXIT(PrefetchVirtualMemory);
+    return bRetVal;
+}
+
 #if defined(HOST_OSX) && defined(HOST_ARM64)
 PALAPI VOID PAL_JitWriteProtect(bool writeEnable)
 {
@@ -133,6 +133,10 @@ namespace
     };
 };
 
+// Records are collected in a buffer and written to the file in batches, rather than with a write for each method, which adds up
+// when many methods are compiled at startup. A background thread writes the buffered records every FlushIntervalMs so that the
+// file stays close to up to date for tools that read it while the process is running, and the remaining records are written
+// when the file is finished.
 struct PerfJitDumpState
 {
     PerfJitDumpState() :
@@ -140,18 +144,31 @@ struct PerfJitDumpState
         fd(-1),
         mmapAddr(MAP_FAILED),
         mutex(PTHREAD_MUTEX_INITIALIZER),
-        codeIndex(0)
+        flushCondition(PTHREAD_COND_INITIALIZER),
+        codeIndex(0),
+        bufferCapacity(0),
+        bufferUsed(0)
     {}
 
+    static const size_t BufferSize = 64 * 1024;
+    static const long FlushIntervalMs = 100;
+
     volatile bool enabled;
     int fd;
     void *mmapAddr;
     pthread_mutex_t mutex;
+    pthread_cond_t flushCondition;
     volatile uint64_t codeIndex;
 
+    // Zero when records are written directly, if the thread writing the buffered records could not be created
+    size_t bufferCapacity;
+    size_t bufferUsed;
+    char buffer[BufferSize];
+
     int FatalError(bool locked)
     {
         enabled = false;
+        bufferUsed = 0;
 
         if (mmapAddr != MAP_FAILED)
         {
@@ -167,12 +184,110 @@ struct PerfJitDumpState
 
         if (locked)
         {
+            pthread_cond_signal(&flushCondition);
             pthread_mutex_unlock(&mutex);
         }
 
         return -1;
     }
 
+    // Writes the items to the file, must be called with the mutex held
+    int WriteItemsLocked(iovec* items, size_t itemsCount, size_t bytesRemaining)
+    {
+        size_t itemsWritten = 0;
+
+        do
+        {
+            ssize_t result = writev(fd, items + itemsWritten, itemsCount - itemsWritten);
+
+            if ((size_t)result == bytesRemaining)
+                break;
+
+            if (result == -1)
+            {
+                if (errno == EINTR)
+                    continue;
+
+                return -1;
+            }
+
+            // Detect unexpected failure cases.
+            _ASSERTE(bytesRemaining > (size_t)result);
+            _ASSERTE(result > 0);
+
+            // Handle partial write case
+
+            bytesRemaining -= result;
+
+            do
+            {
+                if ((size_t)result < items[itemsWritten].iov_len)
+                {
+                    items[itemsWritten].iov_len -= result;
+                    items[itemsWritten].iov_base = (void*)((size_t) items[itemsWritten].iov_base + result);
+                    break;
+                }
+                else
+                {
+                    result -= items[itemsWritten].iov_len;
+                    itemsWritten++;
+
+                    // Detect unexpected failure case.
+                    _ASSERTE(itemsWritten < itemsCount);
+                }
+            } while (result > 0);
+        } while (true);
+
+        return 0;
+    }
+
+    // Writes the buffered records to the file, must be called with the mutex held
+    int FlushLocked()
+    {
+        if (bufferUsed == 0)
+            return 0;
+
+        iovec item = { buffer, bufferUsed };
+        size_t bytesRemaining = bufferUsed;
+        bufferUsed = 0;
+
+        return WriteItemsLocked(&item, 1, bytesRemaining);
+    }
+
+    static void* FlushThreadProc(void* arg)
+    {
+        ((PerfJitDumpState*)arg)->FlushPeriodically();
+        return nullptr;
+    }
+
+    void FlushPeriodically()
+    {
+        if (pthread_mutex_lock(&mutex) != 0)
+            return;
+
+        while (enabled)
+        {
+            struct timespec deadline;
+            clock_gettime(CLOCK_REALTIME, &deadline);
+            deadline.tv_nsec += FlushIntervalMs * 1000000;
+            if (deadline.tv_nsec >= 1000000000)
+            {
+                deadline.tv_sec++;
+                deadline.tv_nsec -= 1000000000;
+            }
+
+            pthread_cond_timedwait(&flushCondition, &mutex, &deadline);
+
+            if (enabled && FlushLocked() == -1)
+            {
+                FatalError(true);
+                return;
+            }
+        }
+
+        pthread_mutex_unlock(&mutex);
+    }
+
     int Start(const char* path)
     {
         int result = 0;
@@ -221,6 +336,14 @@ struct PerfJitDumpState
 
         enabled = true;
 
+        // The thread waits for the mutex, which is released below, before it looks at the state
+        pthread_t flushThread;
+        if (pthread_create(&flushThread, nullptr, FlushThreadProc, this) == 0)
+        {
+            pthread_detach(flushThread);
+            bufferCapacity = BufferSize;
+        }
+
 exit:
         result = pthread_mutex_unlock(&mutex);
 
@@ -256,8 +379,6 @@ exit:
             };
             size_t itemsCount = sizeof(items) / sizeof(items[0]);
 
-            size_t itemsWritten = 0;
-
             result = pthread_mutex_lock(&mutex);
 
             if (result != 0)
@@ -269,47 +390,27 @@ exit:
             // Increment codeIndex while locked
             record.code_index = ++codeIndex;
 
-            do
+            if (bytesRemaining > bufferCapacity - bufferUsed)
             {
-                result = writev(fd, items + itemsWritten, itemsCount - itemsWritten);
-
-                if ((size_t)result == bytesRemaining)
-                    break;
-
-                if (result == -1)
-                {
-                    if (errno == EINTR)
-                        continue;
-
+                // Keep the records in order in the file
+                if (FlushLocked() == -1)
                     return FatalError(true);
-                }
-
-                // Detect unexpected failure cases.
-                _ASSERTE(bytesRemaining > (size_t)result);
-                _ASSERTE(result > 0);
-
-                // Handle partial write case
+            }
 
-                bytesRemaining -= result;
-
-                do
+            if (bytesRemaining > bufferCapacity)
+            {
+                // Records that do not fit in the buffer, which hold the code of large methods, are written directly
+                if (WriteItemsLocked(items, itemsCount, bytesRemaining) == -1)
+                    return FatalError(true);
+            }
+            else
+            {
+                for (size_t i = 0; i < itemsCount; i++)
                 {
-                    if ((size_t)result < items[itemsWritten].iov_len)
-                    {
-                        items[itemsWritten].iov_len -= result;
-                        items[itemsWritten].iov_base = (void*)((size_t) items[itemsWritten].iov_base + result);
-                        break;
-                    }
-                    else
-                    {
-                        result -= items[itemsWritten].iov_len;
-                        itemsWritten++;
-
-                        // Detect unexpected failure case.
-                        _ASSERTE(itemsWritten < itemsCount);
-                    }
-                } while (result > 0);
-            } while (true);
+                    memcpy(buffer + bufferUsed, items[i].iov_base, items[i].iov_len);
+                    bufferUsed += items[i].iov_len;
+                }
+            }
 
 exit:
             result = pthread_mutex_unlock(&mutex);
@@ -326,8 +427,6 @@ exit:
 
         if (enabled)
         {
-            enabled = false;
-
             // Lock the mutex
             result = pthread_mutex_lock(&mutex);
 
@@ -337,6 +436,15 @@ exit:
             if (!enabled)
                 goto exit;
 
+            // Write the records that are still buffered, and let the flushing thread exit
+            result = FlushLocked();
+
+            if (result == -1)
+                return FatalError(true);
+
+            enabled = false;
+            pthread_cond_signal(&flushCondition);
+
             result = munmap(mmapAddr, sizeof(FileHeader));
 
             if (result == -1)
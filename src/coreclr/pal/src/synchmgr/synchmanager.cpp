@@ -37,6 +37,10 @@ SET_DEFAULT_DEBUG_CHANNEL(SYNC); // some headers have code with asserts, so do t
 #else
 #include "pal/fakepoll.h"
 #endif // HAVE_POLL
+#if SYNCHMGR_USE_FUTEX
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#endif // SYNCHMGR_USE_FUTEX
 
 #include <algorithm>
 
@@ -450,6 +454,85 @@ namespace CorUnix
         TRACE("ThreadNativeWait(ptnwdNativeWaitData=%p, dwTimeout=%u, ...)\n",
               ptnwdNativeWaitData, dwTimeout);
 
+#if SYNCHMGR_USE_FUTEX
+        if (dwTimeout != INFINITE)
+        {
+            // FUTEX_WAIT_BITSET takes an absolute CLOCK_MONOTONIC timeout
+            iRet = clock_gettime(CLOCK_MONOTONIC, &tsAbsTmo);
+            if (0 != iRet)
+            {
+                ERROR("clock_gettime(CLOCK_MONOTONIC) failed; errno is %d (%s)\n", errno, strerror(errno));
+                palErr = ERROR_INTERNAL_ERROR;
+                *ptwrWakeupReason = WaitFailed;
+                goto TNW_exit;
+            }
+
+            tsAbsTmo.tv_sec += dwTimeout / tccSecondsToMillieSeconds;
+            tsAbsTmo.tv_nsec += (dwTimeout % tccSecondsToMillieSeconds) * tccMillieSecondsToNanoSeconds;
+            if (tsAbsTmo.tv_nsec >= tccSecondsToNanoSeconds)
+            {
+                tsAbsTmo.tv_sec += 1;
+                tsAbsTmo.tv_nsec -= tccSecondsToNanoSeconds;
+            }
+        }
+
+        // Announce that this thread is going to sleep, unless it has already
+        // been signaled. Only the owner thread resets the predicate, so it
+        // can only be FALSE or TRUE here.
+        if (FALSE == InterlockedCompareExchange((LONG *)&ptnwdNativeWaitData->iPred,
+                                                NativeWaitPredSleeping, FALSE))
+        {
+            while (NativeWaitPredSleeping == VolatileLoad(&ptnwdNativeWaitData->iPred))
+            {
+                iRet = syscall(SYS_futex, &ptnwdNativeWaitData->iPred,
+                               FUTEX_WAIT_BITSET | FUTEX_PRIVATE_FLAG,
+                               NativeWaitPredSleeping,
+                               (INFINITE == dwTimeout) ? NULL : &tsAbsTmo,
+                               NULL, FUTEX_BITSET_MATCH_ANY);
+                if (0 == iRet || EAGAIN == errno || EINTR == errno)
+                {
+                    continue;
+                }
+
+                if (ETIMEDOUT == errno)
+                {
+                    _ASSERT_MSG(INFINITE != dwTimeout,
+                                "Got ETIMEDOUT despite timeout being INFINITE\n");
+
+                    // If a signaling raced with the timeout the predicate is
+                    // already TRUE and stays set for the 'second native wait'
+                    // (see comments in BlockThread), as with the condition.
+                    InterlockedCompareExchange((LONG *)&ptnwdNativeWaitData->iPred,
+                                               FALSE, NativeWaitPredSleeping);
+                    iWaitRet = ETIMEDOUT;
+                    break;
+                }
+
+                iWaitRet = errno;
+                ERROR("futex wait returned %d [errno=%d (%s)]\n",
+                       iRet, iWaitRet, strerror(iWaitRet));
+                InterlockedCompareExchange((LONG *)&ptnwdNativeWaitData->iPred,
+                                           FALSE, NativeWaitPredSleeping);
+                palErr = ERROR_INTERNAL_ERROR;
+                break;
+            }
+        }
+
+        if (0 == iWaitRet)
+        {
+            // The wakeup reason and object index have been published before
+            // the predicate was set
+            *ptwrWakeupReason  = ptnwdNativeWaitData->twrWakeupReason;
+            *pdwSignaledObject = ptnwdNativeWaitData->dwObjectIndex;
+
+            // Reset the predicate
+            VolatileStore(&ptnwdNativeWaitData->iPred, (int)FALSE);
+        }
+        else if (ETIMEDOUT == iWaitRet)
+        {
+            *ptwrWakeupReason = WaitTimeout;
+        }
+#else // SYNCHMGR_USE_FUTEX
         if (dwTimeout != INFINITE)
         {
             // Calculate absolute timeout
@@ -541,6 +624,7 @@ namespace CorUnix
         {
             *ptwrWakeupReason = WaitTimeout;
         }
+#endif // SYNCHMGR_USE_FUTEX
 
     TNW_exit:
         TRACE("ThreadNativeWait: returning %u [WakeupReason=%u]\n", palErr, *ptwrWakeupReason);
@@ -2479,6 +2563,23 @@ namespace CorUnix
         PAL_ERROR palErr = NO_ERROR;
         int iRet;
 
+#if SYNCHMGR_USE_FUTEX
+        // Set the predicate, publishing the wakeup reason and object index
+        // along with it, and wake up the target thread if it is sleeping
+        if (NativeWaitPredSleeping == InterlockedExchange((LONG *)&ptnwdNativeWaitData->iPred, TRUE))
+        {
+            iRet = syscall(SYS_futex, &ptnwdNativeWaitData->iPred,
+                           FUTEX_WAKE | FUTEX_PRIVATE_FLAG, 1, NULL, NULL, 0);
+            if (-1 == iRet)
+            {
+                ERROR("Failed to wake up thread: futex wake failed "
+                      "[errno=%d (%s)]\n", errno, strerror(errno));
+                palErr = ERROR_INTERNAL_ERROR;
+            }
+        }
+
+        return palErr;
+#else // SYNCHMGR_USE_FUTEX
         // Lock the mutex
         iRet = pthread_mutex_lock(&ptnwdNativeWaitData->mutex);
         if (0 != iRet)
@@ -2510,6 +2611,7 @@ namespace CorUnix
         }
 
         return palErr;
+#endif // SYNCHMGR_USE_FUTEX
     }
 
     /*++
@@ -52,6 +52,12 @@ namespace CorUnix
     const DWORD WTLN_FLAG_WAIT_ALL                               = 1<<1;
     const DWORD WTLN_FLAG_DELEGATED_OBJECT_SIGNALING_IN_PROGRESS = 1<<2;
 
+#if SYNCHMGR_USE_FUTEX
+    // Value of ThreadNativeWaitData::iPred while its owner thread is (about
+    // to be) blocked on it, telling the signaling side to issue a FUTEX_WAKE
+    const int NativeWaitPredSleeping = 2;
+#endif // SYNCHMGR_USE_FUTEX
+
 #ifdef SYNCH_OBJECT_VALIDATION
     const DWORD HeadSignature  = 0x48454144;
     const DWORD TailSignature  = 0x5441494C;
@@ -2363,6 +2363,239 @@ PAL_GenerateCoreDump(
     return result;
 }
 
+#ifdef __linux__
+/*++
+Function:
+  PROCCloseSnapshotDescriptors
+
+Abstract:
+  Closes every file descriptor in the snapshot except stdio and keepFd.
+  The snapshot and createdump would otherwise hold on to every socket
+  and file the process had open at the time of the fork, so closing a
+  connection in the process wouldn't be seen by the peer until the dump
+  is written. Only makes async-signal-safe calls.
+
+Parameters:
+    keepFd
+        Descriptor to leave open
+    maxFd
+        Upper bound of the open descriptors, read before the fork
+--*/
+static void
+PROCCloseSnapshotDescriptors(int keepFd, int maxFd)
+{
+#ifdef __NR_close_range
+    int firstAfterKeep = (keepFd > STDERR_FILENO) ? keepFd + 1 : STDERR_FILENO + 1;
+    if ((keepFd <= STDERR_FILENO || syscall(__NR_close_range, STDERR_FILENO + 1, keepFd - 1, 0) == 0) &&
+        syscall(__NR_close_range, firstAfterKeep, ~0U, 0) == 0)
+    {
+        return;
+    }
+#endif // __NR_close_range
+    // close_range isn't available on kernels before 5.9
+    for (int fd = STDERR_FILENO + 1; fd < maxFd; fd++)
+    {
+        if (fd != keepFd)
+        {
+            close(fd);
+        }
+    }
+}
+#endif // __linux__
+
+/*++
+Function:
+  PAL_GenerateSnapshotCoreDump
+
+Abstract:
+  Creates a dump of a copy-on-write fork of the process instead of the
+  process itself, so the process only pauses for as long as fork takes
+  and keeps running while createdump reads the snapshot. Only the thread
+  that called this exists in the snapshot, so dumps taken this way are
+  for looking at the heap, not at what the other threads were doing.
+
+  The caller brings the process to the state it wants in the snapshot
+  (i.e. the runtime suspended) before calling this. forkedCallback is
+  called on this thread once the snapshot exists, or once we know it
+  won't, so the caller can let the process go again.
+
+Parameters:
+    dumpName
+    dumpType
+    flags
+        See PAL_GenerateCoreDump
+    forkedCallback
+    parameter
+        Passed to forkedCallback
+
+Return:
+    TRUE success
+    FALSE failed
+--*/
+BOOL
+PAL_GenerateSnapshotCoreDump(
+    LPCSTR dumpName,
+    INT dumpType,
+    ULONG32 flags,
+    PPAL_SNAPSHOT_FORKED_CALLBACK forkedCallback,
+    PVOID parameter,
+    LPSTR errorMessageBuffer,
+    INT cbErrorMessageBuffer)
+{
+#ifdef __linux__
+    std::vector<const char*> argvCreateDump;
+    BOOL result = FALSE;
+    char* program = nullptr;
+    char* pidarg = nullptr;
+    // The snapshot's pid goes here. It's only known in the snapshot, which can't allocate.
+    char snapshotPidArg[16];
+    int pipe_descs[2] = { -1, -1 };
+    pid_t snapshotpid = -1;
+    int maxFd = 0;
+    struct rlimit fdLimit;
+
+    if (dumpType < 1 || dumpType > 4)
+    {
+        goto GenerateSnapshotCoreDumpExit;
+    }
+    if (dumpName != nullptr && dumpName[0] == '\0')
+    {
+        dumpName = nullptr;
+    }
+    if (!PROCBuildCreateDumpCommandLine(argvCreateDump, &program, &pidarg, dumpName, nullptr, dumpType, flags))
+    {
+        goto GenerateSnapshotCoreDumpExit;
+    }
+    // the pid is the last argument before the terminating null
+    argvCreateDump[argvCreateDump.size() - 2] = snapshotPidArg;
+
+    if (pipe(pipe_descs) == -1)
+    {
+        if (errorMessageBuffer != nullptr)
+        {
+            sprintf_s(errorMessageBuffer, cbErrorMessageBuffer, "Problem creating snapshot: pipe() FAILED %s (%d)\n", strerror(errno), errno);
+        }
+        goto GenerateSnapshotCoreDumpExit;
+    }
+
+    // Only needed where close_range isn't available; the snapshot can't query it safely.
+    maxFd = 65536;
+    if (getrlimit(RLIMIT_NOFILE, &fdLimit) == 0 && fdLimit.rlim_cur != RLIM_INFINITY && fdLimit.rlim_cur < INT_MAX)
+    {
+        maxFd = (int)fdLimit.rlim_cur;
+    }
+
+    snapshotpid = fork();
+
+    if (snapshotpid == 0)
+    {
+        // This is the snapshot. It's a fork of a multithreaded process so only async-signal-safe
+        // calls from here on. createdump has to be our child rather than our sibling so it's
+        // allowed to ptrace us without PR_SET_PTRACER. We wait for it in waitpid which is where
+        // createdump finds our only thread.
+        close(pipe_descs[0]);
+        PROCCloseSnapshotDescriptors(pipe_descs[1], maxFd);
+
+        pid_t pid = getpid();
+        char digits[16];
+        int count = 0;
+        do
+        {
+            digits[count++] = '0' + (pid % 10);
+            pid /= 10;
+        } while (pid != 0);
+        for (int i = 0; i < count; i++)
+        {
+            snapshotPidArg[i] = digits[count - i - 1];
+        }
+        snapshotPidArg[count] = '\0';
+
+        pid_t childpid = fork();
+        if (childpid == 0)
+        {
+            if (errorMessageBuffer != nullptr)
+            {
+                dup2(pipe_descs[1], STDERR_FILENO);
+            }
+            execve(argvCreateDump[0], (char**)argvCreateDump.data(), palEnvironment);
+            _exit(-1);
+        }
+        close(pipe_descs[1]);
+
+        int wstatus = 0;
+        if (childpid != -1)
+        {
+            while (waitpid(childpid, &wstatus, 0) == -1 && errno == EINTR);
+        }
+        _exit((childpid != -1) && (!WIFEXITED(wstatus) || WEXITSTATUS(wstatus) == 0) ? 0 : 1);
+    }
+
+    // The snapshot has everything it needs, let the process go.
+    forkedCallback(parameter);
+    forkedCallback = nullptr;
+
+    close(pipe_descs[1]);
+    if (snapshotpid == -1)
+    {
+        if (errorMessageBuffer != nullptr)
+        {
+            sprintf_s(errorMessageBuffer, cbErrorMessageBuffer, "Problem creating snapshot: fork() FAILED %s (%d)\n", strerror(errno), errno);
+        }
+        close(pipe_descs[0]);
+        goto GenerateSnapshotCoreDumpExit;
+    }
+
+    // Read createdump's stderr messages (if any)
+    if (errorMessageBuffer != nullptr)
+    {
+        int bytesRead = 0;
+        int count = 0;
+        while ((count = read(pipe_descs[0], errorMessageBuffer + bytesRead, cbErrorMessageBuffer - bytesRead - 1)) > 0)
+        {
+            bytesRead += count;
+        }
+        errorMessageBuffer[bytesRead] = 0;
+        if (bytesRead > 0)
+        {
+            fputs(errorMessageBuffer, stderr);
+        }
+    }
+    close(pipe_descs[0]);
+
+    {
+        int wstatus = 0;
+        int waitResult;
+        while ((waitResult = waitpid(snapshotpid, &wstatus, 0)) == -1 && errno == EINTR);
+        if (waitResult != snapshotpid)
+        {
+            fprintf(stderr, "Problem waiting for snapshot: waitpid() FAILED result %d wstatus %08x errno %s (%d)\n",
+                waitResult, wstatus, strerror(errno), errno);
+        }
+        else
+        {
+            result = WIFEXITED(wstatus) && WEXITSTATUS(wstatus) == 0;
+        }
+    }
+
+GenerateSnapshotCoreDumpExit:
+    if (forkedCallback != nullptr)
+    {
+        forkedCallback(parameter);
+    }
+    free(program);
+    free(pidarg);
+    return result;
+#else // __linux__
+    // Without Linux's ptrace rules for descendants createdump can't attach to the snapshot.
+    forkedCallback(parameter);
+    if (errorMessageBuffer != nullptr)
+    {
+        sprintf_s(errorMessageBuffer, cbErrorMessageBuffer, "Snapshot dumps are only supported on Linux\n");
+    }
+    return FALSE;
+#endif // __linux__
+}
+
 /*++
 Function:
   PROCCreateCrashDumpIfEnabled
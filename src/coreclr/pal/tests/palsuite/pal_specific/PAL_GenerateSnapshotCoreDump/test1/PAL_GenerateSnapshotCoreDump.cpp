@@ -0,0 +1,78 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+/*=============================================================
+**
+** Source: PAL_GenerateSnapshotCoreDump.cpp
+**
+** Purpose: Smoke test for PAL_GenerateSnapshotCoreDump. Checks that
+**          the forked callback is called exactly once, on the calling
+**          thread, both when the dump type is rejected and when the
+**          snapshot is forked, and that the process keeps running
+**          afterwards. createdump isn't next to the PAL tests, so the
+**          snapshot itself fails to start it and the call fails.
+**
+**
+**============================================================*/
+#include <palsuite.h>
+
+struct CallbackState
+{
+    int count;
+    DWORD threadId;
+};
+
+static VOID SnapshotForked(PVOID parameter)
+{
+    CallbackState* state = (CallbackState*)parameter;
+    state->count++;
+    state->threadId = GetCurrentThreadId();
+}
+
+PALTEST(pal_specific_PAL_GenerateSnapshotCoreDump_test1_paltest_pal_generatesnapshotcoredump_test1, "pal_specific/PAL_GenerateSnapshotCoreDump/test1/paltest_pal_generatesnapshotcoredump_test1")
+{
+    CallbackState state;
+    char errorMessage[1024];
+    BOOL result;
+
+    if (0 != PAL_Initialize(argc, argv))
+    {
+        return FAIL;
+    }
+
+    /* An invalid dump type is rejected, but the process still has to be let go */
+    state.count = 0;
+    state.threadId = 0;
+    errorMessage[0] = '\0';
+    result = PAL_GenerateSnapshotCoreDump(nullptr, 0, GenerateDumpFlagsForkSnapshotEnabled, SnapshotForked, &state, errorMessage, sizeof(errorMessage));
+    if (result)
+    {
+        Fail("ERROR: PAL_GenerateSnapshotCoreDump succeeded with an invalid dump type\n");
+    }
+    if (state.count != 1 || state.threadId != GetCurrentThreadId())
+    {
+        Fail("ERROR: the forked callback was called %d times for an invalid dump type, expected once on this thread\n", state.count);
+    }
+
+    /* Makes the PAL find createdump's directory, so the snapshot is forked */
+    if (PAL_GetPalHostModule() == nullptr)
+    {
+        Fail("ERROR: PAL_GetPalHostModule failed\n");
+    }
+
+    state.count = 0;
+    state.threadId = 0;
+    errorMessage[0] = '\0';
+    result = PAL_GenerateSnapshotCoreDump("paltest_snapshot.dmp", 2, GenerateDumpFlagsForkSnapshotEnabled, SnapshotForked, &state, errorMessage, sizeof(errorMessage));
+    if (result)
+    {
+        Fail("ERROR: PAL_GenerateSnapshotCoreDump succeeded without createdump\n");
+    }
+    if (state.count != 1 || state.threadId != GetCurrentThreadId())
+    {
+        Fail("ERROR: the forked callback was called %d times, expected once on this thread\n", state.count);
+    }
+
+    PAL_Terminate();
+    return PASS;
+}
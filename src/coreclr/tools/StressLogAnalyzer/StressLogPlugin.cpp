@@ -568,6 +568,11 @@ static StressLog::StressLogHeader* s_hdr;
 
 static bool s_fPrintFormatStrings;
 
+// streaming mode: poll interval, and the range of time stamps collected by the current pass
+static DWORD s_streamIntervalMs;
+static uint64_t s_streamTimeStampStart;
+static uint64_t s_streamTimeStampEnd;
+
 void Usage()
 {
     printf("\n");
@@ -612,6 +617,10 @@ void Usage()
     printf("\n");
     printf(" -a: print all messages from all threads\n");
     printf("\n");
+    printf(" -s: stream, after printing the log keep printing new messages as they are\n");
+    printf("     logged, until the process is terminated\n");
+    printf(" -s:<milliseconds>: as above, polling the log at the given interval (default 1000)\n");
+    printf("\n");
 }
 
 // Translate escape sequences like "\n" - only common ones are handled
@@ -846,6 +855,26 @@ bool ParseOptions(int argc, char* argv[])
             case 'A':
                 s_showAllMessages = true;
                 break;
+
+            case 's':
+            case 'S':
+                s_streamIntervalMs = 1000;
+                if (arg[2] == ':')
+                {
+                    char* end = nullptr;
+                    s_streamIntervalMs = strtoul(&arg[3], &end, 10);
+                    if (*end != '\0' || s_streamIntervalMs == 0)
+                    {
+                        printf("expected '-s:<milliseconds>'\n");
+                        return false;
+                    }
+                }
+                else if (arg[2] != '\0')
+                {
+                    printf("expected '-s' or '-s:<milliseconds>'\n");
+                    return false;
+                }
+                break;
             case 'f':
             case 'F':
                 if (arg[2] == '\0')
@@ -1085,6 +1114,18 @@ DWORD WINAPI ProcessStresslogWorker(LPVOID)
             StressMsg* endMsg = (StressMsg*)end;
             while (msg < endMsg)
             {
+                if (s_streamTimeStampEnd != 0)
+                {
+                    // older messages have been printed by an earlier pass
+                    if (msg->timeStamp <= s_streamTimeStampStart)
+                        break;
+                    // newer ones are left for the next pass
+                    if (msg->timeStamp > s_streamTimeStampEnd)
+                    {
+                        msg = (StressMsg*)&msg->args[(msg->numberOfArgsX << 3) + msg->numberOfArgs];
+                        continue;
+                    }
+                }
                 totalMsgCount++;
                 char* format = (char*)(hdr->moduleImage + msg->formatOffset);
                 double deltaTime = ((double)(msg->timeStamp - hdr->startTimeStamp)) / hdr->tickFrequency;
@@ -1166,6 +1207,85 @@ static double FindLatestTime(StressLog::StressLogHeader* hdr)
     return latestTime;
 }
 
+static void RemoveMessagesFromOtherThreads()
+{
+    if (s_threadFilterCount == 0)
+        return;
+
+    int remMsgCount = 0;
+    for (int msgIndex = 0; msgIndex < s_msgCount; msgIndex++)
+    {
+        uint64_t threadId = s_threadMsgBuf[msgIndex].threadId;
+        for (int i = 0; i < s_threadFilterCount; i++)
+        {
+            if (threadId == s_threadFilter[i])
+            {
+                s_threadMsgBuf[remMsgCount] = s_threadMsgBuf[msgIndex];
+                remMsgCount++;
+                break;
+            }
+        }
+    }
+    s_msgCount = remMsgCount;
+}
+
+// Collects the messages passing the filters from every thread into s_threadMsgBuf
+static int CollectMessages(StressLog::StressLogHeader* hdr)
+{
+    int threadStressLogIndex = 0;
+    for (ThreadStressLog* tsl = StressLog::TranslateMemoryMappedPointer(hdr->logs.t); tsl != nullptr; tsl = StressLog::TranslateMemoryMappedPointer(tsl->next))
+    {
+        if (!tsl->IsValid())
+            continue;
+        if (!FilterThread(tsl))
+            continue;
+        if (threadStressLogIndex >= MAX_THREADSTRESSLOGS)
+        {
+            printf("too many threads\n");
+            return 1;
+        }
+        s_threadStressLogDesc[threadStressLogIndex].workStarted = 0;
+        s_threadStressLogDesc[threadStressLogIndex].workFinished = 0;
+        s_threadStressLogDesc[threadStressLogIndex].tsl = tsl;
+        threadStressLogIndex++;
+    }
+    s_threadStressLogCount = threadStressLogIndex;
+    s_wrappedWriteThreadCount = 0;
+
+    SYSTEM_INFO systemInfo;
+    GetSystemInfo(&systemInfo);
+
+    DWORD threadCount = min(systemInfo.dwNumberOfProcessors, MAXIMUM_WAIT_OBJECTS);
+    HANDLE threadHandle[64];
+    for (DWORD i = 0; i < threadCount; i++)
+    {
+        threadHandle[i] = CreateThread(NULL, 0, ProcessStresslogWorker, nullptr, 0, nullptr);
+        if (threadHandle[i] == 0)
+        {
+            printf("CreateThread failed\n");
+            return 1;
+        }
+    }
+    WaitForMultipleObjects(threadCount, threadHandle, TRUE, INFINITE);
+
+    // the interlocked increment may have increased s_msgCount beyond MAX_MESSAGE_COUNT -
+    // make sure we don't go beyond the end of the buffer
+    s_msgCount = min(s_msgCount, MAX_MESSAGE_COUNT);
+
+    return 0;
+}
+
+static uint64_t FindLatestTimeStamp(StressLog::StressLogHeader* hdr)
+{
+    uint64_t latestTimeStamp = 0;
+    for (ThreadStressLog* tsl = StressLog::TranslateMemoryMappedPointer(hdr->logs.t); tsl != nullptr; tsl = StressLog::TranslateMemoryMappedPointer(tsl->next))
+    {
+        StressMsg* msg = StressLog::TranslateMemoryMappedPointer(tsl->curPtr);
+        latestTimeStamp = max(latestTimeStamp, msg->timeStamp);
+    }
+    return latestTimeStamp;
+}
+
 static void PrintFriendlyNumber(LONGLONG n)
 {
     if (n < 1000)
@@ -1217,6 +1337,9 @@ int ProcessStressLog(void* baseAddress, int argc, char* argv[])
     s_outputFileName = nullptr;
     s_fPrintFormatStrings = false;
     s_showAllMessages = false;
+    s_streamIntervalMs = 0;
+    s_streamTimeStampStart = 0;
+    s_streamTimeStampEnd = 0;
     s_maxHeapNumberSeen = -1;
     for (int i = IS_INTERESTING; i < s_interestingStringCount; i++)
     {
@@ -1259,49 +1382,20 @@ int ProcessStressLog(void* baseAddress, int argc, char* argv[])
     auto temp = new StressThreadAndMsg[MAX_MESSAGE_COUNT];
     s_threadMsgBuf = temp;
 
-    int threadStressLogIndex = 0;
     double latestTime = FindLatestTime(hdr);
     if (s_timeFilterStart < 0)
     {
         s_timeFilterStart = max(latestTime + s_timeFilterStart, 0);
         s_timeFilterEnd = latestTime;
     }
-    for (ThreadStressLog* tsl = StressLog::TranslateMemoryMappedPointer(hdr->logs.t); tsl != nullptr; tsl = StressLog::TranslateMemoryMappedPointer(tsl->next))
-    {
-        if (!tsl->IsValid())
-            continue;
-        if (!FilterThread(tsl))
-            continue;
-        if (threadStressLogIndex >= MAX_THREADSTRESSLOGS)
-        {
-            printf("too many threads\n");
-            return 1;
-        }
-        s_threadStressLogDesc[threadStressLogIndex].tsl = tsl;
-        threadStressLogIndex++;
-    }
-    s_threadStressLogCount = threadStressLogIndex;
-    s_wrappedWriteThreadCount = 0;
-
-    SYSTEM_INFO systemInfo;
-    GetSystemInfo(&systemInfo);
-
-    DWORD threadCount = min(systemInfo.dwNumberOfProcessors, MAXIMUM_WAIT_OBJECTS);
-    HANDLE threadHandle[64];
-    for (DWORD i = 0; i < threadCount; i++)
+    if (s_streamIntervalMs != 0)
     {
-        threadHandle[i] = CreateThread(NULL, 0, ProcessStresslogWorker, nullptr, 0, nullptr);
-        if (threadHandle[i] == 0)
-        {
-            printf("CreateThread failed\n");
-            return 1;
-        }
+        s_streamTimeStampStart = 0;
+        s_streamTimeStampEnd = FindLatestTimeStamp(hdr);
     }
-    WaitForMultipleObjects(threadCount, threadHandle, TRUE, INFINITE);
-
-    // the interlocked increment may have increased s_msgCount beyond MAX_MESSAGE_COUNT -
-    // make sure we don't go beyond the end of the buffer
-    s_msgCount = min(s_msgCount, MAX_MESSAGE_COUNT);
+    int error = CollectMessages(hdr);
+    if (error != 0)
+        return error;
 
     if (s_gcFilterStart != 0)
     {
@@ -1367,25 +1461,8 @@ int ProcessStressLog(void* baseAddress, int argc, char* argv[])
         }
     }
 
-    if (s_threadFilterCount > 0)
-    {
-        // remove all messages from other threads
-        int remMsgCount = 0;
-        for (int msgIndex = 0; msgIndex < s_msgCount; msgIndex++)
-        {
-            uint64_t threadId = s_threadMsgBuf[msgIndex].threadId;
-            for (int i = 0; i < s_threadFilterCount; i++)
-            {
-                if (threadId == s_threadFilter[i])
-                {
-                    s_threadMsgBuf[remMsgCount] = s_threadMsgBuf[msgIndex];
-                    remMsgCount++;
-                    break;
-                }
-            }
-        }
-        s_msgCount = remMsgCount;
-    }
+    // remove all messages from other threads
+    RemoveMessagesFromOtherThreads();
 
     // if the sort becomes a bottleneck, we can do a bucket sort by time
     // (say fractions of a second), then sort the individual buckets,
@@ -1473,9 +1550,6 @@ int ProcessStressLog(void* baseAddress, int argc, char* argv[])
         }
     }
 
-    if (outputFile != stdout)
-        fclose(outputFile);
-
     ptrdiff_t usedSize = hdr->memoryCur - hdr->memoryBase;
     ptrdiff_t availSize = hdr->memoryLimit - hdr->memoryCur;
     printf("Used file size: %6.3f GB, still available: %6.3f GB, %d threads total, %d overwrote earlier messages\n",
@@ -1485,6 +1559,40 @@ int ProcessStressLog(void* baseAddress, int argc, char* argv[])
         printf("%lld threads did not get a log!\n", hdr->threadsWithNoLog);
     printf("Number of messages examined: "); PrintFriendlyNumber(s_totalMsgCount); printf(", printed: "); PrintFriendlyNumber(s_msgCount); printf("\n");
 
+    // The runtime keeps writing to the log while it's read, so a message being written or a chunk
+    // being overwritten by a thread that wrapped around can show up garbled.
+    // Time filters only apply to the initial output.
+    s_timeFilterStart = 0;
+    s_timeFilterEnd = 0;
+    while (s_streamIntervalMs != 0)
+    {
+        fflush(outputFile);
+        Sleep(s_streamIntervalMs);
+
+        uint64_t latestTimeStamp = FindLatestTimeStamp(hdr);
+        if (latestTimeStamp <= s_streamTimeStampEnd)
+            continue;
+        s_streamTimeStampStart = s_streamTimeStampEnd;
+        s_streamTimeStampEnd = latestTimeStamp;
+
+        s_msgCount = 0;
+        error = CollectMessages(hdr);
+        if (error != 0)
+            break;
+
+        RemoveMessagesFromOtherThreads();
+        qsort(s_threadMsgBuf, s_msgCount, sizeof(s_threadMsgBuf[0]), CmpMsg);
+        for (LONGLONG i = 0; i < s_msgCount; i++)
+        {
+            uint64_t threadId = (unsigned)s_threadMsgBuf[i].threadId;
+            StressMsg* msg = s_threadMsgBuf[i].msg;
+            PrintMessage(corClrData, outputFile, threadId, msg);
+        }
+    }
+
+    if (outputFile != stdout)
+        fclose(outputFile);
+
     delete[] s_threadMsgBuf;
 
     return 0;
@@ -161,6 +161,7 @@ struct JitInterfaceCallbacks
     bool (* canAccessFamily)(void * thisHandle, CorInfoExceptionClass** ppException, CORINFO_METHOD_HANDLE hCaller, CORINFO_CLASS_HANDLE hInstanceType);
     bool (* isRIDClassDomainID)(void * thisHandle, CorInfoExceptionClass** ppException, CORINFO_CLASS_HANDLE cls);
     unsigned (* getClassDomainID)(void * thisHandle, CorInfoExceptionClass** ppException, CORINFO_CLASS_HANDLE cls, void** ppIndirection);
+    uint32_t (* getThreadLocalStaticBlockIndex)(void * thisHandle, CorInfoExceptionClass** ppException, CORINFO_CLASS_HANDLE cls);
     void* (* getFieldAddress)(void * thisHandle, CorInfoExceptionClass** ppException, CORINFO_FIELD_HANDLE field, void** ppIndirection);
     bool (* getReadonlyStaticFieldValue)(void * thisHandle, CorInfoExceptionClass** ppException, CORINFO_FIELD_HANDLE field, uint8_t* buffer, int bufferSize, bool ignoreMovableObjects);
     CORINFO_CLASS_HANDLE (* getStaticFieldCurrentClass)(void * thisHandle, CorInfoExceptionClass** ppException, CORINFO_FIELD_HANDLE field, bool* pIsSpeculative);
@@ -192,6 +193,7 @@ struct JitInterfaceCallbacks
     uint16_t (* getRelocTypeHint)(void * thisHandle, CorInfoExceptionClass** ppException, void* target);
     uint32_t (* getExpectedTargetArchitecture)(void * thisHandle, CorInfoExceptionClass** ppException);
     uint32_t (* getJitFlags)(void * thisHandle, CorInfoExceptionClass** ppException, CORJIT_FLAGS* flags, uint32_t sizeInBytes);
+    void (* reportJitPhaseTelemetry)(void * thisHandle, CorInfoExceptionClass** ppException, const JitPhaseTelemetry* telemetry);
 
 };
 
@@ -1651,6 +1653,15 @@ public:
     return temp;
 }
 
+    virtual uint32_t getThreadLocalStaticBlockIndex(
+          CORINFO_CLASS_HANDLE cls)
+{
+    CorInfoExceptionClass* pException = nullptr;
+    uint32_t temp = _callbacks->getThreadLocalStaticBlockIndex(_thisHandle, &pException, cls);
+    if (pException != nullptr) throw pException;
+    return temp;
+}
+
     virtual void* getFieldAddress(
           CORINFO_FIELD_HANDLE field,
           void** ppIndirection)
@@ -1963,4 +1974,12 @@ public:
     if (pException != nullptr) throw pException;
     return temp;
 }
+
+    virtual void reportJitPhaseTelemetry(
+          const JitPhaseTelemetry* telemetry)
+{
+    CorInfoExceptionClass* pException = nullptr;
+    _callbacks->reportJitPhaseTelemetry(_thisHandle, &pException, telemetry);
+    if (pException != nullptr) throw pException;
+}
 };
@@ -4430,6 +4430,28 @@ unsigned MethodContext::repGetClassDomainID(CORINFO_CLASS_HANDLE cls, void** ppI
     return (unsigned)value.B;
 }
 
+void MethodContext::recGetThreadLocalStaticBlockIndex(CORINFO_CLASS_HANDLE cls, uint32_t result)
+{
+    if (GetThreadLocalStaticBlockIndex == nullptr)
+        GetThreadLocalStaticBlockIndex = new LightWeightMap<DWORDLONG, DWORD>();
+
+    DWORDLONG key = CastHandle(cls);
+    DWORD value = (DWORD)result;
+    GetThreadLocalStaticBlockIndex->Add(key, value);
+    DEBUG_REC(dmpGetThreadLocalStaticBlockIndex(key, value));
+}
+void MethodContext::dmpGetThreadLocalStaticBlockIndex(DWORDLONG key, DWORD value)
+{
+    printf("GetThreadLocalStaticBlockIndex key cls-%016llX, value res-%u", key, value);
+}
+uint32_t MethodContext::repGetThreadLocalStaticBlockIndex(CORINFO_CLASS_HANDLE cls)
+{
+    DWORDLONG key = CastHandle(cls);
+    DWORD value = LookupByKeyOrMiss(GetThreadLocalStaticBlockIndex, key, ": key %016llX", key);
+    DEBUG_REP(dmpGetThreadLocalStaticBlockIndex(key, value));
+    return (uint32_t)value;
+}
+
 void MethodContext::recGetLocationOfThisType(CORINFO_METHOD_HANDLE context, CORINFO_LOOKUP_KIND* result)
 {
     if (GetLocationOfThisType == nullptr)
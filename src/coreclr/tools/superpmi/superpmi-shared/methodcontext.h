@@ -584,6 +584,10 @@ public:
     void dmpGetClassDomainID(DWORDLONG key, DLD value);
     unsigned repGetClassDomainID(CORINFO_CLASS_HANDLE cls, void** ppIndirection);
 
+    void recGetThreadLocalStaticBlockIndex(CORINFO_CLASS_HANDLE cls, uint32_t result);
+    void dmpGetThreadLocalStaticBlockIndex(DWORDLONG key, DWORD value);
+    uint32_t repGetThreadLocalStaticBlockIndex(CORINFO_CLASS_HANDLE cls);
+
     void recGetLocationOfThisType(CORINFO_METHOD_HANDLE context, CORINFO_LOOKUP_KIND* result);
     void dmpGetLocationOfThisType(DWORDLONG key, const Agnostic_CORINFO_LOOKUP_KIND& value);
     void repGetLocationOfThisType(CORINFO_METHOD_HANDLE context, CORINFO_LOOKUP_KIND* pLookupKind);
@@ -1165,6 +1169,7 @@ enum mcPackets
     Packet_GetArrayOrStringLength = 202,
     Packet_IsEnum = 203,
     Packet_GetStringChar = 204,
+    Packet_GetThreadLocalStaticBlockIndex = 205,
 };
 
 void SetDebugDumpVariables();
@@ -277,6 +277,7 @@ std::string SpmiDumpHelper::DumpJitFlags(unsigned long long flags)
     AddFlagNumeric(RELATIVE_CODE_RELOCS, 41);
 
     AddFlag(NO_INLINING);
+    AddFlag(PHASE_TELEMETRY);
 
     // "Extra jit flag" support
     //
@@ -1700,6 +1700,15 @@ unsigned interceptor_ICJI::getClassDomainID(CORINFO_CLASS_HANDLE cls, void** ppI
     return temp;
 }
 
+// returns the index of the class's entry in the per-thread table of thread static bases
+uint32_t interceptor_ICJI::getThreadLocalStaticBlockIndex(CORINFO_CLASS_HANDLE cls)
+{
+    mc->cr->AddCall("getThreadLocalStaticBlockIndex");
+    uint32_t temp = original_ICorJitInfo->getThreadLocalStaticBlockIndex(cls);
+    mc->recGetThreadLocalStaticBlockIndex(cls, temp);
+    return temp;
+}
+
 // return the data's address (for static fields only)
 void* interceptor_ICJI::getFieldAddress(CORINFO_FIELD_HANDLE field, void** ppIndirection)
 {
@@ -1844,6 +1853,13 @@ uint32_t interceptor_ICJI::getJitFlags(CORJIT_FLAGS* jitFlags, uint32_t sizeInBy
     return result;
 }
 
+// Telemetry describes the collection run, so we forward it without recording it.
+void interceptor_ICJI::reportJitPhaseTelemetry(const JitPhaseTelemetry* telemetry)
+{
+    mc->cr->AddCall("reportJitPhaseTelemetry");
+    original_ICorJitInfo->reportJitPhaseTelemetry(telemetry);
+}
+
 // Runs the given function with the given parameter under an error trap
 // and returns true if the function completes successfully. We don't
 // record the results of the call: when this call gets played back,
@@ -23,26 +23,37 @@ CorJitResult interceptor_ICJC::compileMethod(ICorJitInfo*                comp,
     our_ICorJitInfo.mcs = mcs;
 
     mcs->AddCall("compileMethod");
+
+    LARGE_INTEGER start;
+    ::QueryPerformanceCounter(&start);
+
     CorJitResult temp =
         original_ICorJitCompiler->compileMethod(&our_ICorJitInfo, info, flags, nativeEntry, nativeSizeOfCode);
 
+    LARGE_INTEGER stop;
+    ::QueryPerformanceCounter(&stop);
+
+    int64_t ticks = stop.QuadPart - start.QuadPart;
+    mcs->AddCallTime("compileMethod", ticks);
+    mcs->AddCompiledMethod(comp, info->ftn, ticks, our_ICorJitInfo.methodCalls);
+
     return temp;
 }
 
 void interceptor_ICJC::ProcessShutdownWork(ICorStaticInfo* info)
 {
-    mcs->AddCall("ProcessShutdownWork");
+    MethodCallTimer timer(mcs, "ProcessShutdownWork");
     original_ICorJitCompiler->ProcessShutdownWork(info);
 }
 
 void interceptor_ICJC::getVersionIdentifier(GUID* versionIdentifier /* OUT */)
 {
-    mcs->AddCall("getVersionIdentifier");
+    MethodCallTimer timer(mcs, "getVersionIdentifier");
     original_ICorJitCompiler->getVersionIdentifier(versionIdentifier);
 }
 
 unsigned interceptor_ICJC::getMaxIntrinsicSIMDVectorLength(CORJIT_FLAGS cpuCompileFlags)
 {
-    mcs->AddCall("getMaxIntrinsicSIMDVectorLength");
+    MethodCallTimer timer(mcs, "getMaxIntrinsicSIMDVectorLength");
     return original_ICorJitCompiler->getMaxIntrinsicSIMDVectorLength(cpuCompileFlags);
 }
@@ -17,6 +17,9 @@ public:
     // to it.  And a simple way to keep one memory manager instance per instance.
     ICorJitInfo*          original_ICorJitInfo;
     MethodCallSummarizer* mcs;
+
+    // The calls made while compiling the method, reported by interceptor_ICJC::compileMethod.
+    CompiledMethodCalls methodCalls;
 };
 
 #endif
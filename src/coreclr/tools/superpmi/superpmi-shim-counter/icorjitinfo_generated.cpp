@@ -15,14 +15,14 @@
 bool interceptor_ICJI::isIntrinsic(
           CORINFO_METHOD_HANDLE ftn)
 {
-    mcs->AddCall("isIntrinsic");
+    MethodCallTimer timer(mcs, "isIntrinsic", &methodCalls);
     return original_ICorJitInfo->isIntrinsic(ftn);
 }
 
 uint32_t interceptor_ICJI::getMethodAttribs(
           CORINFO_METHOD_HANDLE ftn)
 {
-    mcs->AddCall("getMethodAttribs");
+    MethodCallTimer timer(mcs, "getMethodAttribs", &methodCalls);
     return original_ICorJitInfo->getMethodAttribs(ftn);
 }
 
@@ -30,7 +30,7 @@ void interceptor_ICJI::setMethodAttribs(
           CORINFO_METHOD_HANDLE ftn,
           CorInfoMethodRuntimeFlags attribs)
 {
-    mcs->AddCall("setMethodAttribs");
+    MethodCallTimer timer(mcs, "setMethodAttribs", &methodCalls);
     original_ICorJitInfo->setMethodAttribs(ftn, attribs);
 }
 
@@ -39,7 +39,7 @@ void interceptor_ICJI::getMethodSig(
           CORINFO_SIG_INFO* sig,
           CORINFO_CLASS_HANDLE memberParent)
 {
-    mcs->AddCall("getMethodSig");
+    MethodCallTimer timer(mcs, "getMethodSig", &methodCalls);
     original_ICorJitInfo->getMethodSig(ftn, sig, memberParent);
 }
 
@@ -47,7 +47,7 @@ bool interceptor_ICJI::getMethodInfo(
           CORINFO_METHOD_HANDLE ftn,
           CORINFO_METHOD_INFO* info)
 {
-    mcs->AddCall("getMethodInfo");
+    MethodCallTimer timer(mcs, "getMethodInfo", &methodCalls);
     return original_ICorJitInfo->getMethodInfo(ftn, info);
 }
 
@@ -55,7 +55,7 @@ CorInfoInline interceptor_ICJI::canInline(
           CORINFO_METHOD_HANDLE callerHnd,
           CORINFO_METHOD_HANDLE calleeHnd)
 {
-    mcs->AddCall("canInline");
+    MethodCallTimer timer(mcs, "canInline", &methodCalls);
     return original_ICorJitInfo->canInline(callerHnd, calleeHnd);
 }
 
@@ -63,7 +63,7 @@ void interceptor_ICJI::beginInlining(
           CORINFO_METHOD_HANDLE inlinerHnd,
           CORINFO_METHOD_HANDLE inlineeHnd)
 {
-    mcs->AddCall("beginInlining");
+    MethodCallTimer timer(mcs, "beginInlining", &methodCalls);
     original_ICorJitInfo->beginInlining(inlinerHnd, inlineeHnd);
 }
 
@@ -73,7 +73,7 @@ void interceptor_ICJI::reportInliningDecision(
           CorInfoInline inlineResult,
           const char* reason)
 {
-    mcs->AddCall("reportInliningDecision");
+    MethodCallTimer timer(mcs, "reportInliningDecision", &methodCalls);
     original_ICorJitInfo->reportInliningDecision(inlinerHnd, inlineeHnd, inlineResult, reason);
 }
 
@@ -83,7 +83,7 @@ bool interceptor_ICJI::canTailCall(
           CORINFO_METHOD_HANDLE exactCalleeHnd,
           bool fIsTailPrefix)
 {
-    mcs->AddCall("canTailCall");
+    MethodCallTimer timer(mcs, "canTailCall", &methodCalls);
     return original_ICorJitInfo->canTailCall(callerHnd, declaredCalleeHnd, exactCalleeHnd, fIsTailPrefix);
 }
 
@@ -94,7 +94,7 @@ void interceptor_ICJI::reportTailCallDecision(
           CorInfoTailCall tailCallResult,
           const char* reason)
 {
-    mcs->AddCall("reportTailCallDecision");
+    MethodCallTimer timer(mcs, "reportTailCallDecision", &methodCalls);
     original_ICorJitInfo->reportTailCallDecision(callerHnd, calleeHnd, fIsTailPrefix, tailCallResult, reason);
 }
 
@@ -103,21 +103,21 @@ void interceptor_ICJI::getEHinfo(
           unsigned EHnumber,
           CORINFO_EH_CLAUSE* clause)
 {
-    mcs->AddCall("getEHinfo");
+    MethodCallTimer timer(mcs, "getEHinfo", &methodCalls);
     original_ICorJitInfo->getEHinfo(ftn, EHnumber, clause);
 }
 
 CORINFO_CLASS_HANDLE interceptor_ICJI::getMethodClass(
           CORINFO_METHOD_HANDLE method)
 {
-    mcs->AddCall("getMethodClass");
+    MethodCallTimer timer(mcs, "getMethodClass", &methodCalls);
     return original_ICorJitInfo->getMethodClass(method);
 }
 
 CORINFO_MODULE_HANDLE interceptor_ICJI::getMethodModule(
           CORINFO_METHOD_HANDLE method)
 {
-    mcs->AddCall("getMethodModule");
+    MethodCallTimer timer(mcs, "getMethodModule", &methodCalls);
     return original_ICorJitInfo->getMethodModule(method);
 }
 
@@ -127,14 +127,14 @@ void interceptor_ICJI::getMethodVTableOffset(
           unsigned* offsetAfterIndirection,
           bool* isRelative)
 {
-    mcs->AddCall("getMethodVTableOffset");
+    MethodCallTimer timer(mcs, "getMethodVTableOffset", &methodCalls);
     original_ICorJitInfo->getMethodVTableOffset(method, offsetOfIndirection, offsetAfterIndirection, isRelative);
 }
 
 bool interceptor_ICJI::resolveVirtualMethod(
           CORINFO_DEVIRTUALIZATION_INFO* info)
 {
-    mcs->AddCall("resolveVirtualMethod");
+    MethodCallTimer timer(mcs, "resolveVirtualMethod", &methodCalls);
     return original_ICorJitInfo->resolveVirtualMethod(info);
 }
 
@@ -142,21 +142,21 @@ CORINFO_METHOD_HANDLE interceptor_ICJI::getUnboxedEntry(
           CORINFO_METHOD_HANDLE ftn,
           bool* requiresInstMethodTableArg)
 {
-    mcs->AddCall("getUnboxedEntry");
+    MethodCallTimer timer(mcs, "getUnboxedEntry", &methodCalls);
     return original_ICorJitInfo->getUnboxedEntry(ftn, requiresInstMethodTableArg);
 }
 
 CORINFO_CLASS_HANDLE interceptor_ICJI::getDefaultComparerClass(
           CORINFO_CLASS_HANDLE elemType)
 {
-    mcs->AddCall("getDefaultComparerClass");
+    MethodCallTimer timer(mcs, "getDefaultComparerClass", &methodCalls);
     return original_ICorJitInfo->getDefaultComparerClass(elemType);
 }
 
 CORINFO_CLASS_HANDLE interceptor_ICJI::getDefaultEqualityComparerClass(
           CORINFO_CLASS_HANDLE elemType)
 {
-    mcs->AddCall("getDefaultEqualityComparerClass");
+    MethodCallTimer timer(mcs, "getDefaultEqualityComparerClass", &methodCalls);
     return original_ICorJitInfo->getDefaultEqualityComparerClass(elemType);
 }
 
@@ -164,14 +164,14 @@ void interceptor_ICJI::expandRawHandleIntrinsic(
           CORINFO_RESOLVED_TOKEN* pResolvedToken,
           CORINFO_GENERICHANDLE_RESULT* pResult)
 {
-    mcs->AddCall("expandRawHandleIntrinsic");
+    MethodCallTimer timer(mcs, "expandRawHandleIntrinsic", &methodCalls);
     original_ICorJitInfo->expandRawHandleIntrinsic(pResolvedToken, pResult);
 }
 
 bool interceptor_ICJI::isIntrinsicType(
           CORINFO_CLASS_HANDLE classHnd)
 {
-    mcs->AddCall("isIntrinsicType");
+    MethodCallTimer timer(mcs, "isIntrinsicType", &methodCalls);
     return original_ICorJitInfo->isIntrinsicType(classHnd);
 }
 
@@ -180,7 +180,7 @@ CorInfoCallConvExtension interceptor_ICJI::getUnmanagedCallConv(
           CORINFO_SIG_INFO* callSiteSig,
           bool* pSuppressGCTransition)
 {
-    mcs->AddCall("getUnmanagedCallConv");
+    MethodCallTimer timer(mcs, "getUnmanagedCallConv", &methodCalls);
     return original_ICorJitInfo->getUnmanagedCallConv(method, callSiteSig, pSuppressGCTransition);
 }
 
@@ -188,7 +188,7 @@ bool interceptor_ICJI::pInvokeMarshalingRequired(
           CORINFO_METHOD_HANDLE method,
           CORINFO_SIG_INFO* callSiteSig)
 {
-    mcs->AddCall("pInvokeMarshalingRequired");
+    MethodCallTimer timer(mcs, "pInvokeMarshalingRequired", &methodCalls);
     return original_ICorJitInfo->pInvokeMarshalingRequired(method, callSiteSig);
 }
 
@@ -196,7 +196,7 @@ bool interceptor_ICJI::satisfiesMethodConstraints(
           CORINFO_CLASS_HANDLE parent,
           CORINFO_METHOD_HANDLE method)
 {
-    mcs->AddCall("satisfiesMethodConstraints");
+    MethodCallTimer timer(mcs, "satisfiesMethodConstraints", &methodCalls);
     return original_ICorJitInfo->satisfiesMethodConstraints(parent, method);
 }
 
@@ -207,21 +207,21 @@ bool interceptor_ICJI::isCompatibleDelegate(
           CORINFO_CLASS_HANDLE delegateCls,
           bool* pfIsOpenDelegate)
 {
-    mcs->AddCall("isCompatibleDelegate");
+    MethodCallTimer timer(mcs, "isCompatibleDelegate", &methodCalls);
     return original_ICorJitInfo->isCompatibleDelegate(objCls, methodParentCls, method, delegateCls, pfIsOpenDelegate);
 }
 
 void interceptor_ICJI::methodMustBeLoadedBeforeCodeIsRun(
           CORINFO_METHOD_HANDLE method)
 {
-    mcs->AddCall("methodMustBeLoadedBeforeCodeIsRun");
+    MethodCallTimer timer(mcs, "methodMustBeLoadedBeforeCodeIsRun", &methodCalls);
     original_ICorJitInfo->methodMustBeLoadedBeforeCodeIsRun(method);
 }
 
 CORINFO_METHOD_HANDLE interceptor_ICJI::mapMethodDeclToMethodImpl(
           CORINFO_METHOD_HANDLE method)
 {
-    mcs->AddCall("mapMethodDeclToMethodImpl");
+    MethodCallTimer timer(mcs, "mapMethodDeclToMethodImpl", &methodCalls);
     return original_ICorJitInfo->mapMethodDeclToMethodImpl(method);
 }
 
@@ -229,35 +229,35 @@ void interceptor_ICJI::getGSCookie(
           GSCookie* pCookieVal,
           GSCookie** ppCookieVal)
 {
-    mcs->AddCall("getGSCookie");
+    MethodCallTimer timer(mcs, "getGSCookie", &methodCalls);
     original_ICorJitInfo->getGSCookie(pCookieVal, ppCookieVal);
 }
 
 void interceptor_ICJI::setPatchpointInfo(
           PatchpointInfo* patchpointInfo)
 {
-    mcs->AddCall("setPatchpointInfo");
+    MethodCallTimer timer(mcs, "setPatchpointInfo", &methodCalls);
     original_ICorJitInfo->setPatchpointInfo(patchpointInfo);
 }
 
 PatchpointInfo* interceptor_ICJI::getOSRInfo(
           unsigned* ilOffset)
 {
-    mcs->AddCall("getOSRInfo");
+    MethodCallTimer timer(mcs, "getOSRInfo", &methodCalls);
     return original_ICorJitInfo->getOSRInfo(ilOffset);
 }
 
 void interceptor_ICJI::resolveToken(
           CORINFO_RESOLVED_TOKEN* pResolvedToken)
 {
-    mcs->AddCall("resolveToken");
+    MethodCallTimer timer(mcs, "resolveToken", &methodCalls);
     original_ICorJitInfo->resolveToken(pResolvedToken);
 }
 
 bool interceptor_ICJI::tryResolveToken(
           CORINFO_RESOLVED_TOKEN* pResolvedToken)
 {
-    mcs->AddCall("tryResolveToken");
+    MethodCallTimer timer(mcs, "tryResolveToken", &methodCalls);
     return original_ICorJitInfo->tryResolveToken(pResolvedToken);
 }
 
@@ -267,7 +267,7 @@ void interceptor_ICJI::findSig(
           CORINFO_CONTEXT_HANDLE context,
           CORINFO_SIG_INFO* sig)
 {
-    mcs->AddCall("findSig");
+    MethodCallTimer timer(mcs, "findSig", &methodCalls);
     original_ICorJitInfo->findSig(module, sigTOK, context, sig);
 }
 
@@ -277,14 +277,14 @@ void interceptor_ICJI::findCallSiteSig(
           CORINFO_CONTEXT_HANDLE context,
           CORINFO_SIG_INFO* sig)
 {
-    mcs->AddCall("findCallSiteSig");
+    MethodCallTimer timer(mcs, "findCallSiteSig", &methodCalls);
     original_ICorJitInfo->findCallSiteSig(module, methTOK, context, sig);
 }
 
 CORINFO_CLASS_HANDLE interceptor_ICJI::getTokenTypeAsHandle(
           CORINFO_RESOLVED_TOKEN* pResolvedToken)
 {
-    mcs->AddCall("getTokenTypeAsHandle");
+    MethodCallTimer timer(mcs, "getTokenTypeAsHandle", &methodCalls);
     return original_ICorJitInfo->getTokenTypeAsHandle(pResolvedToken);
 }
 
@@ -292,7 +292,7 @@ bool interceptor_ICJI::isValidToken(
           CORINFO_MODULE_HANDLE module,
           unsigned metaTOK)
 {
-    mcs->AddCall("isValidToken");
+    MethodCallTimer timer(mcs, "isValidToken", &methodCalls);
     return original_ICorJitInfo->isValidToken(module, metaTOK);
 }
 
@@ -300,7 +300,7 @@ bool interceptor_ICJI::isValidStringRef(
           CORINFO_MODULE_HANDLE module,
           unsigned metaTOK)
 {
-    mcs->AddCall("isValidStringRef");
+    MethodCallTimer timer(mcs, "isValidStringRef", &methodCalls);
     return original_ICorJitInfo->isValidStringRef(module, metaTOK);
 }
 
@@ -311,7 +311,7 @@ int interceptor_ICJI::getStringLiteral(
           int bufferSize,
           int startIndex)
 {
-    mcs->AddCall("getStringLiteral");
+    MethodCallTimer timer(mcs, "getStringLiteral", &methodCalls);
     return original_ICorJitInfo->getStringLiteral(module, metaTOK, buffer, bufferSize, startIndex);
 }
 
@@ -321,14 +321,14 @@ size_t interceptor_ICJI::printObjectDescription(
           size_t bufferSize,
           size_t* pRequiredBufferSize)
 {
-    mcs->AddCall("printObjectDescription");
+    MethodCallTimer timer(mcs, "printObjectDescription", &methodCalls);
     return original_ICorJitInfo->printObjectDescription(handle, buffer, bufferSize, pRequiredBufferSize);
 }
 
 CorInfoType interceptor_ICJI::asCorInfoType(
           CORINFO_CLASS_HANDLE cls)
 {
-    mcs->AddCall("asCorInfoType");
+    MethodCallTimer timer(mcs, "asCorInfoType", &methodCalls);
     return original_ICorJitInfo->asCorInfoType(cls);
 }
 
@@ -336,7 +336,7 @@ const char* interceptor_ICJI::getClassNameFromMetadata(
           CORINFO_CLASS_HANDLE cls,
           const char** namespaceName)
 {
-    mcs->AddCall("getClassNameFromMetadata");
+    MethodCallTimer timer(mcs, "getClassNameFromMetadata", &methodCalls);
     return original_ICorJitInfo->getClassNameFromMetadata(cls, namespaceName);
 }
 
@@ -344,7 +344,7 @@ CORINFO_CLASS_HANDLE interceptor_ICJI::getTypeInstantiationArgument(
           CORINFO_CLASS_HANDLE cls,
           unsigned index)
 {
-    mcs->AddCall("getTypeInstantiationArgument");
+    MethodCallTimer timer(mcs, "getTypeInstantiationArgument", &methodCalls);
     return original_ICorJitInfo->getTypeInstantiationArgument(cls, index);
 }
 
@@ -354,14 +354,14 @@ size_t interceptor_ICJI::printClassName(
           size_t bufferSize,
           size_t* pRequiredBufferSize)
 {
-    mcs->AddCall("printClassName");
+    MethodCallTimer timer(mcs, "printClassName", &methodCalls);
     return original_ICorJitInfo->printClassName(cls, buffer, bufferSize, pRequiredBufferSize);
 }
 
 bool interceptor_ICJI::isValueClass(
           CORINFO_CLASS_HANDLE cls)
 {
-    mcs->AddCall("isValueClass");
+    MethodCallTimer timer(mcs, "isValueClass", &methodCalls);
     return original_ICorJitInfo->isValueClass(cls);
 }
 
@@ -369,49 +369,49 @@ CorInfoInlineTypeCheck interceptor_ICJI::canInlineTypeCheck(
           CORINFO_CLASS_HANDLE cls,
           CorInfoInlineTypeCheckSource source)
 {
-    mcs->AddCall("canInlineTypeCheck");
+    MethodCallTimer timer(mcs, "canInlineTypeCheck", &methodCalls);
     return original_ICorJitInfo->canInlineTypeCheck(cls, source);
 }
 
 uint32_t interceptor_ICJI::getClassAttribs(
           CORINFO_CLASS_HANDLE cls)
 {
-    mcs->AddCall("getClassAttribs");
+    MethodCallTimer timer(mcs, "getClassAttribs", &methodCalls);
     return original_ICorJitInfo->getClassAttribs(cls);
 }
 
 CORINFO_MODULE_HANDLE interceptor_ICJI::getClassModule(
           CORINFO_CLASS_HANDLE cls)
 {
-    mcs->AddCall("getClassModule");
+    MethodCallTimer timer(mcs, "getClassModule", &methodCalls);
     return original_ICorJitInfo->getClassModule(cls);
 }
 
 CORINFO_ASSEMBLY_HANDLE interceptor_ICJI::getModuleAssembly(
           CORINFO_MODULE_HANDLE mod)
 {
-    mcs->AddCall("getModuleAssembly");
+    MethodCallTimer timer(mcs, "getModuleAssembly", &methodCalls);
     return original_ICorJitInfo->getModuleAssembly(mod);
 }
 
 const char* interceptor_ICJI::getAssemblyName(
           CORINFO_ASSEMBLY_HANDLE assem)
 {
-    mcs->AddCall("getAssemblyName");
+    MethodCallTimer timer(mcs, "getAssemblyName", &methodCalls);
     return original_ICorJitInfo->getAssemblyName(assem);
 }
 
 void* interceptor_ICJI::LongLifetimeMalloc(
           size_t sz)
 {
-    mcs->AddCall("LongLifetimeMalloc");
+    MethodCallTimer timer(mcs, "LongLifetimeMalloc", &methodCalls);
     return original_ICorJitInfo->LongLifetimeMalloc(sz);
 }
 
 void interceptor_ICJI::LongLifetimeFree(
           void* obj)
 {
-    mcs->AddCall("LongLifetimeFree");
+    MethodCallTimer timer(mcs, "LongLifetimeFree", &methodCalls);
     original_ICorJitInfo->LongLifetimeFree(obj);
 }
 
@@ -420,28 +420,28 @@ size_t interceptor_ICJI::getClassModuleIdForStatics(
           CORINFO_MODULE_HANDLE* pModule,
           void** ppIndirection)
 {
-    mcs->AddCall("getClassModuleIdForStatics");
+    MethodCallTimer timer(mcs, "getClassModuleIdForStatics", &methodCalls);
     return original_ICorJitInfo->getClassModuleIdForStatics(cls, pModule, ppIndirection);
 }
 
 unsigned interceptor_ICJI::getClassSize(
           CORINFO_CLASS_HANDLE cls)
 {
-    mcs->AddCall("getClassSize");
+    MethodCallTimer timer(mcs, "getClassSize", &methodCalls);
     return original_ICorJitInfo->getClassSize(cls);
 }
 
 unsigned interceptor_ICJI::getHeapClassSize(
           CORINFO_CLASS_HANDLE cls)
 {
-    mcs->AddCall("getHeapClassSize");
+    MethodCallTimer timer(mcs, "getHeapClassSize", &methodCalls);
     return original_ICorJitInfo->getHeapClassSize(cls);
 }
 
 bool interceptor_ICJI::canAllocateOnStack(
           CORINFO_CLASS_HANDLE cls)
 {
-    mcs->AddCall("canAllocateOnStack");
+    MethodCallTimer timer(mcs, "canAllocateOnStack", &methodCalls);
     return original_ICorJitInfo->canAllocateOnStack(cls);
 }
 
@@ -449,7 +449,7 @@ unsigned interceptor_ICJI::getClassAlignmentRequirement(
           CORINFO_CLASS_HANDLE cls,
           bool fDoubleAlignHint)
 {
-    mcs->AddCall("getClassAlignmentRequirement");
+    MethodCallTimer timer(mcs, "getClassAlignmentRequirement", &methodCalls);
     return original_ICorJitInfo->getClassAlignmentRequirement(cls, fDoubleAlignHint);
 }
 
@@ -457,14 +457,14 @@ unsigned interceptor_ICJI::getClassGClayout(
           CORINFO_CLASS_HANDLE cls,
           uint8_t* gcPtrs)
 {
-    mcs->AddCall("getClassGClayout");
+    MethodCallTimer timer(mcs, "getClassGClayout", &methodCalls);
     return original_ICorJitInfo->getClassGClayout(cls, gcPtrs);
 }
 
 unsigned interceptor_ICJI::getClassNumInstanceFields(
           CORINFO_CLASS_HANDLE cls)
 {
-    mcs->AddCall("getClassNumInstanceFields");
+    MethodCallTimer timer(mcs, "getClassNumInstanceFields", &methodCalls);
     return original_ICorJitInfo->getClassNumInstanceFields(cls);
 }
 
@@ -472,7 +472,7 @@ CORINFO_FIELD_HANDLE interceptor_ICJI::getFieldInClass(
           CORINFO_CLASS_HANDLE clsHnd,
           int32_t num)
 {
-    mcs->AddCall("getFieldInClass");
+    MethodCallTimer timer(mcs, "getFieldInClass", &methodCalls);
     return original_ICorJitInfo->getFieldInClass(clsHnd, num);
 }
 
@@ -481,7 +481,7 @@ bool interceptor_ICJI::checkMethodModifier(
           const char* modifier,
           bool fOptional)
 {
-    mcs->AddCall("checkMethodModifier");
+    MethodCallTimer timer(mcs, "checkMethodModifier", &methodCalls);
     return original_ICorJitInfo->checkMethodModifier(hMethod, modifier, fOptional);
 }
 
@@ -490,14 +490,14 @@ CorInfoHelpFunc interceptor_ICJI::getNewHelper(
           CORINFO_METHOD_HANDLE callerHandle,
           bool* pHasSideEffects)
 {
-    mcs->AddCall("getNewHelper");
+    MethodCallTimer timer(mcs, "getNewHelper", &methodCalls);
     return original_ICorJitInfo->getNewHelper(pResolvedToken, callerHandle, pHasSideEffects);
 }
 
 CorInfoHelpFunc interceptor_ICJI::getNewArrHelper(
           CORINFO_CLASS_HANDLE arrayCls)
 {
-    mcs->AddCall("getNewArrHelper");
+    MethodCallTimer timer(mcs, "getNewArrHelper", &methodCalls);
     return original_ICorJitInfo->getNewArrHelper(arrayCls);
 }
 
@@ -505,49 +505,49 @@ CorInfoHelpFunc interceptor_ICJI::getCastingHelper(
           CORINFO_RESOLVED_TOKEN* pResolvedToken,
           bool fThrowing)
 {
-    mcs->AddCall("getCastingHelper");
+    MethodCallTimer timer(mcs, "getCastingHelper", &methodCalls);
     return original_ICorJitInfo->getCastingHelper(pResolvedToken, fThrowing);
 }
 
 CorInfoHelpFunc interceptor_ICJI::getSharedCCtorHelper(
           CORINFO_CLASS_HANDLE clsHnd)
 {
-    mcs->AddCall("getSharedCCtorHelper");
+    MethodCallTimer timer(mcs, "getSharedCCtorHelper", &methodCalls);
     return original_ICorJitInfo->getSharedCCtorHelper(clsHnd);
 }
 
 CORINFO_CLASS_HANDLE interceptor_ICJI::getTypeForBox(
           CORINFO_CLASS_HANDLE cls)
 {
-    mcs->AddCall("getTypeForBox");
+    MethodCallTimer timer(mcs, "getTypeForBox", &methodCalls);
     return original_ICorJitInfo->getTypeForBox(cls);
 }
 
 CorInfoHelpFunc interceptor_ICJI::getBoxHelper(
           CORINFO_CLASS_HANDLE cls)
 {
-    mcs->AddCall("getBoxHelper");
+    MethodCallTimer timer(mcs, "getBoxHelper", &methodCalls);
     return original_ICorJitInfo->getBoxHelper(cls);
 }
 
 CorInfoHelpFunc interceptor_ICJI::getUnBoxHelper(
           CORINFO_CLASS_HANDLE cls)
 {
-    mcs->AddCall("getUnBoxHelper");
+    MethodCallTimer timer(mcs, "getUnBoxHelper", &methodCalls);
     return original_ICorJitInfo->getUnBoxHelper(cls);
 }
 
 CORINFO_OBJECT_HANDLE interceptor_ICJI::getRuntimeTypePointer(
           CORINFO_CLASS_HANDLE cls)
 {
-    mcs->AddCall("getRuntimeTypePointer");
+    MethodCallTimer timer(mcs, "getRuntimeTypePointer", &methodCalls);
     return original_ICorJitInfo->getRuntimeTypePointer(cls);
 }
 
 bool interceptor_ICJI::isObjectImmutable(
           CORINFO_OBJECT_HANDLE objPtr)
 {
-    mcs->AddCall("isObjectImmutable");
+    MethodCallTimer timer(mcs, "isObjectImmutable", &methodCalls);
     return original_ICorJitInfo->isObjectImmutable(objPtr);
 }
 
@@ -556,14 +556,14 @@ bool interceptor_ICJI::getStringChar(
           int index,
           uint16_t* value)
 {
-    mcs->AddCall("getStringChar");
+    MethodCallTimer timer(mcs, "getStringChar", &methodCalls);
     return original_ICorJitInfo->getStringChar(strObj, index, value);
 }
 
 CORINFO_CLASS_HANDLE interceptor_ICJI::getObjectType(
           CORINFO_OBJECT_HANDLE objPtr)
 {
-    mcs->AddCall("getObjectType");
+    MethodCallTimer timer(mcs, "getObjectType", &methodCalls);
     return original_ICorJitInfo->getObjectType(objPtr);
 }
 
@@ -573,7 +573,7 @@ bool interceptor_ICJI::getReadyToRunHelper(
           CorInfoHelpFunc id,
           CORINFO_CONST_LOOKUP* pLookup)
 {
-    mcs->AddCall("getReadyToRunHelper");
+    MethodCallTimer timer(mcs, "getReadyToRunHelper", &methodCalls);
     return original_ICorJitInfo->getReadyToRunHelper(pResolvedToken, pGenericLookupKind, id, pLookup);
 }
 
@@ -583,7 +583,7 @@ void interceptor_ICJI::getReadyToRunDelegateCtorHelper(
           CORINFO_CLASS_HANDLE delegateType,
           CORINFO_LOOKUP* pLookup)
 {
-    mcs->AddCall("getReadyToRunDelegateCtorHelper");
+    MethodCallTimer timer(mcs, "getReadyToRunDelegateCtorHelper", &methodCalls);
     original_ICorJitInfo->getReadyToRunDelegateCtorHelper(pTargetMethod, targetConstraint, delegateType, pLookup);
 }
 
@@ -592,35 +592,35 @@ CorInfoInitClassResult interceptor_ICJI::initClass(
           CORINFO_METHOD_HANDLE method,
           CORINFO_CONTEXT_HANDLE context)
 {
-    mcs->AddCall("initClass");
+    MethodCallTimer timer(mcs, "initClass", &methodCalls);
     return original_ICorJitInfo->initClass(field, method, context);
 }
 
 void interceptor_ICJI::classMustBeLoadedBeforeCodeIsRun(
           CORINFO_CLASS_HANDLE cls)
 {
-    mcs->AddCall("classMustBeLoadedBeforeCodeIsRun");
+    MethodCallTimer timer(mcs, "classMustBeLoadedBeforeCodeIsRun", &methodCalls);
     original_ICorJitInfo->classMustBeLoadedBeforeCodeIsRun(cls);
 }
 
 CORINFO_CLASS_HANDLE interceptor_ICJI::getBuiltinClass(
           CorInfoClassId classId)
 {
-    mcs->AddCall("getBuiltinClass");
+    MethodCallTimer timer(mcs, "getBuiltinClass", &methodCalls);
     return original_ICorJitInfo->getBuiltinClass(classId);
 }
 
 CorInfoType interceptor_ICJI::getTypeForPrimitiveValueClass(
           CORINFO_CLASS_HANDLE cls)
 {
-    mcs->AddCall("getTypeForPrimitiveValueClass");
+    MethodCallTimer timer(mcs, "getTypeForPrimitiveValueClass", &methodCalls);
     return original_ICorJitInfo->getTypeForPrimitiveValueClass(cls);
 }
 
 CorInfoType interceptor_ICJI::getTypeForPrimitiveNumericClass(
           CORINFO_CLASS_HANDLE cls)
 {
-    mcs->AddCall("getTypeForPrimitiveNumericClass");
+    MethodCallTimer timer(mcs, "getTypeForPrimitiveNumericClass", &methodCalls);
     return original_ICorJitInfo->getTypeForPrimitiveNumericClass(cls);
 }
 
@@ -628,7 +628,7 @@ bool interceptor_ICJI::canCast(
           CORINFO_CLASS_HANDLE child,
           CORINFO_CLASS_HANDLE parent)
 {
-    mcs->AddCall("canCast");
+    MethodCallTimer timer(mcs, "canCast", &methodCalls);
     return original_ICorJitInfo->canCast(child, parent);
 }
 
@@ -636,7 +636,7 @@ bool interceptor_ICJI::areTypesEquivalent(
           CORINFO_CLASS_HANDLE cls1,
           CORINFO_CLASS_HANDLE cls2)
 {
-    mcs->AddCall("areTypesEquivalent");
+    MethodCallTimer timer(mcs, "areTypesEquivalent", &methodCalls);
     return original_ICorJitInfo->areTypesEquivalent(cls1, cls2);
 }
 
@@ -644,7 +644,7 @@ TypeCompareState interceptor_ICJI::compareTypesForCast(
           CORINFO_CLASS_HANDLE fromClass,
           CORINFO_CLASS_HANDLE toClass)
 {
-    mcs->AddCall("compareTypesForCast");
+    MethodCallTimer timer(mcs, "compareTypesForCast", &methodCalls);
     return original_ICorJitInfo->compareTypesForCast(fromClass, toClass);
 }
 
@@ -652,7 +652,7 @@ TypeCompareState interceptor_ICJI::compareTypesForEquality(
           CORINFO_CLASS_HANDLE cls1,
           CORINFO_CLASS_HANDLE cls2)
 {
-    mcs->AddCall("compareTypesForEquality");
+    MethodCallTimer timer(mcs, "compareTypesForEquality", &methodCalls);
     return original_ICorJitInfo->compareTypesForEquality(cls1, cls2);
 }
 
@@ -660,7 +660,7 @@ CORINFO_CLASS_HANDLE interceptor_ICJI::mergeClasses(
           CORINFO_CLASS_HANDLE cls1,
           CORINFO_CLASS_HANDLE cls2)
 {
-    mcs->AddCall("mergeClasses");
+    MethodCallTimer timer(mcs, "mergeClasses", &methodCalls);
     return original_ICorJitInfo->mergeClasses(cls1, cls2);
 }
 
@@ -668,7 +668,7 @@ bool interceptor_ICJI::isMoreSpecificType(
           CORINFO_CLASS_HANDLE cls1,
           CORINFO_CLASS_HANDLE cls2)
 {
-    mcs->AddCall("isMoreSpecificType");
+    MethodCallTimer timer(mcs, "isMoreSpecificType", &methodCalls);
     return original_ICorJitInfo->isMoreSpecificType(cls1, cls2);
 }
 
@@ -676,14 +676,14 @@ TypeCompareState interceptor_ICJI::isEnum(
           CORINFO_CLASS_HANDLE cls,
           CORINFO_CLASS_HANDLE* underlyingType)
 {
-    mcs->AddCall("isEnum");
+    MethodCallTimer timer(mcs, "isEnum", &methodCalls);
     return original_ICorJitInfo->isEnum(cls, underlyingType);
 }
 
 CORINFO_CLASS_HANDLE interceptor_ICJI::getParentType(
           CORINFO_CLASS_HANDLE cls)
 {
-    mcs->AddCall("getParentType");
+    MethodCallTimer timer(mcs, "getParentType", &methodCalls);
     return original_ICorJitInfo->getParentType(cls);
 }
 
@@ -691,35 +691,35 @@ CorInfoType interceptor_ICJI::getChildType(
           CORINFO_CLASS_HANDLE clsHnd,
           CORINFO_CLASS_HANDLE* clsRet)
 {
-    mcs->AddCall("getChildType");
+    MethodCallTimer timer(mcs, "getChildType", &methodCalls);
     return original_ICorJitInfo->getChildType(clsHnd, clsRet);
 }
 
 bool interceptor_ICJI::satisfiesClassConstraints(
           CORINFO_CLASS_HANDLE cls)
 {
-    mcs->AddCall("satisfiesClassConstraints");
+    MethodCallTimer timer(mcs, "satisfiesClassConstraints", &methodCalls);
     return original_ICorJitInfo->satisfiesClassConstraints(cls);
 }
 
 bool interceptor_ICJI::isSDArray(
           CORINFO_CLASS_HANDLE cls)
 {
-    mcs->AddCall("isSDArray");
+    MethodCallTimer timer(mcs, "isSDArray", &methodCalls);
     return original_ICorJitInfo->isSDArray(cls);
 }
 
 unsigned interceptor_ICJI::getArrayRank(
           CORINFO_CLASS_HANDLE cls)
 {
-    mcs->AddCall("getArrayRank");
+    MethodCallTimer timer(mcs, "getArrayRank", &methodCalls);
     return original_ICorJitInfo->getArrayRank(cls);
 }
 
 CorInfoArrayIntrinsic interceptor_ICJI::getArrayIntrinsicID(
           CORINFO_METHOD_HANDLE ftn)
 {
-    mcs->AddCall("getArrayIntrinsicID");
+    MethodCallTimer timer(mcs, "getArrayIntrinsicID", &methodCalls);
     return original_ICorJitInfo->getArrayIntrinsicID(ftn);
 }
 
@@ -727,7 +727,7 @@ void* interceptor_ICJI::getArrayInitializationData(
           CORINFO_FIELD_HANDLE field,
           uint32_t size)
 {
-    mcs->AddCall("getArrayInitializationData");
+    MethodCallTimer timer(mcs, "getArrayInitializationData", &methodCalls);
     return original_ICorJitInfo->getArrayInitializationData(field, size);
 }
 
@@ -736,7 +736,7 @@ CorInfoIsAccessAllowedResult interceptor_ICJI::canAccessClass(
           CORINFO_METHOD_HANDLE callerHandle,
           CORINFO_HELPER_DESC* pAccessHelper)
 {
-    mcs->AddCall("canAccessClass");
+    MethodCallTimer timer(mcs, "canAccessClass", &methodCalls);
     return original_ICorJitInfo->canAccessClass(pResolvedToken, callerHandle, pAccessHelper);
 }
 
@@ -746,14 +746,14 @@ size_t interceptor_ICJI::printFieldName(
           size_t bufferSize,
           size_t* pRequiredBufferSize)
 {
-    mcs->AddCall("printFieldName");
+    MethodCallTimer timer(mcs, "printFieldName", &methodCalls);
     return original_ICorJitInfo->printFieldName(field, buffer, bufferSize, pRequiredBufferSize);
 }
 
 CORINFO_CLASS_HANDLE interceptor_ICJI::getFieldClass(
           CORINFO_FIELD_HANDLE field)
 {
-    mcs->AddCall("getFieldClass");
+    MethodCallTimer timer(mcs, "getFieldClass", &methodCalls);
     return original_ICorJitInfo->getFieldClass(field);
 }
 
@@ -762,14 +762,14 @@ CorInfoType interceptor_ICJI::getFieldType(
           CORINFO_CLASS_HANDLE* structType,
           CORINFO_CLASS_HANDLE memberParent)
 {
-    mcs->AddCall("getFieldType");
+    MethodCallTimer timer(mcs, "getFieldType", &methodCalls);
     return original_ICorJitInfo->getFieldType(field, structType, memberParent);
 }
 
 unsigned interceptor_ICJI::getFieldOffset(
           CORINFO_FIELD_HANDLE field)
 {
-    mcs->AddCall("getFieldOffset");
+    MethodCallTimer timer(mcs, "getFieldOffset", &methodCalls);
     return original_ICorJitInfo->getFieldOffset(field);
 }
 
@@ -779,21 +779,21 @@ void interceptor_ICJI::getFieldInfo(
           CORINFO_ACCESS_FLAGS flags,
           CORINFO_FIELD_INFO* pResult)
 {
-    mcs->AddCall("getFieldInfo");
+    MethodCallTimer timer(mcs, "getFieldInfo", &methodCalls);
     original_ICorJitInfo->getFieldInfo(pResolvedToken, callerHandle, flags, pResult);
 }
 
 bool interceptor_ICJI::isFieldStatic(
           CORINFO_FIELD_HANDLE fldHnd)
 {
-    mcs->AddCall("isFieldStatic");
+    MethodCallTimer timer(mcs, "isFieldStatic", &methodCalls);
     return original_ICorJitInfo->isFieldStatic(fldHnd);
 }
 
 int interceptor_ICJI::getArrayOrStringLength(
           CORINFO_OBJECT_HANDLE objHnd)
 {
-    mcs->AddCall("getArrayOrStringLength");
+    MethodCallTimer timer(mcs, "getArrayOrStringLength", &methodCalls);
     return original_ICorJitInfo->getArrayOrStringLength(objHnd);
 }
 
@@ -803,7 +803,7 @@ void interceptor_ICJI::getBoundaries(
           uint32_t** pILOffsets,
           ICorDebugInfo::BoundaryTypes* implicitBoundaries)
 {
-    mcs->AddCall("getBoundaries");
+    MethodCallTimer timer(mcs, "getBoundaries", &methodCalls);
     original_ICorJitInfo->getBoundaries(ftn, cILOffsets, pILOffsets, implicitBoundaries);
 }
 
@@ -812,7 +812,7 @@ void interceptor_ICJI::setBoundaries(
           uint32_t cMap,
           ICorDebugInfo::OffsetMapping* pMap)
 {
-    mcs->AddCall("setBoundaries");
+    MethodCallTimer timer(mcs, "setBoundaries", &methodCalls);
     original_ICorJitInfo->setBoundaries(ftn, cMap, pMap);
 }
 
@@ -822,7 +822,7 @@ void interceptor_ICJI::getVars(
           ICorDebugInfo::ILVarInfo** vars,
           bool* extendOthers)
 {
-    mcs->AddCall("getVars");
+    MethodCallTimer timer(mcs, "getVars", &methodCalls);
     original_ICorJitInfo->getVars(ftn, cVars, vars, extendOthers);
 }
 
@@ -831,7 +831,7 @@ void interceptor_ICJI::setVars(
           uint32_t cVars,
           ICorDebugInfo::NativeVarInfo* vars)
 {
-    mcs->AddCall("setVars");
+    MethodCallTimer timer(mcs, "setVars", &methodCalls);
     original_ICorJitInfo->setVars(ftn, cVars, vars);
 }
 
@@ -841,28 +841,28 @@ void interceptor_ICJI::reportRichMappings(
           ICorDebugInfo::RichOffsetMapping* mappings,
           uint32_t numMappings)
 {
-    mcs->AddCall("reportRichMappings");
+    MethodCallTimer timer(mcs, "reportRichMappings", &methodCalls);
     original_ICorJitInfo->reportRichMappings(inlineTreeNodes, numInlineTreeNodes, mappings, numMappings);
 }
 
 void* interceptor_ICJI::allocateArray(
           size_t cBytes)
 {
-    mcs->AddCall("allocateArray");
+    MethodCallTimer timer(mcs, "allocateArray", &methodCalls);
     return original_ICorJitInfo->allocateArray(cBytes);
 }
 
 void interceptor_ICJI::freeArray(
           void* array)
 {
-    mcs->AddCall("freeArray");
+    MethodCallTimer timer(mcs, "freeArray", &methodCalls);
     original_ICorJitInfo->freeArray(array);
 }
 
 CORINFO_ARG_LIST_HANDLE interceptor_ICJI::getArgNext(
           CORINFO_ARG_LIST_HANDLE args)
 {
-    mcs->AddCall("getArgNext");
+    MethodCallTimer timer(mcs, "getArgNext", &methodCalls);
     return original_ICorJitInfo->getArgNext(args);
 }
 
@@ -871,7 +871,7 @@ CorInfoTypeWithMod interceptor_ICJI::getArgType(
           CORINFO_ARG_LIST_HANDLE args,
           CORINFO_CLASS_HANDLE* vcTypeRet)
 {
-    mcs->AddCall("getArgType");
+    MethodCallTimer timer(mcs, "getArgType", &methodCalls);
     return original_ICorJitInfo->getArgType(sig, args, vcTypeRet);
 }
 
@@ -880,7 +880,7 @@ int interceptor_ICJI::getExactClasses(
           int maxExactClasses,
           CORINFO_CLASS_HANDLE* exactClsRet)
 {
-    mcs->AddCall("getExactClasses");
+    MethodCallTimer timer(mcs, "getExactClasses", &methodCalls);
     return original_ICorJitInfo->getExactClasses(baseType, maxExactClasses, exactClsRet);
 }
 
@@ -888,21 +888,21 @@ CORINFO_CLASS_HANDLE interceptor_ICJI::getArgClass(
           CORINFO_SIG_INFO* sig,
           CORINFO_ARG_LIST_HANDLE args)
 {
-    mcs->AddCall("getArgClass");
+    MethodCallTimer timer(mcs, "getArgClass", &methodCalls);
     return original_ICorJitInfo->getArgClass(sig, args);
 }
 
 CorInfoHFAElemType interceptor_ICJI::getHFAType(
           CORINFO_CLASS_HANDLE hClass)
 {
-    mcs->AddCall("getHFAType");
+    MethodCallTimer timer(mcs, "getHFAType", &methodCalls);
     return original_ICorJitInfo->getHFAType(hClass);
 }
 
 JITINTERFACE_HRESULT interceptor_ICJI::GetErrorHRESULT(
           struct _EXCEPTION_POINTERS* pExceptionPointers)
 {
-    mcs->AddCall("GetErrorHRESULT");
+    MethodCallTimer timer(mcs, "GetErrorHRESULT", &methodCalls);
     return original_ICorJitInfo->GetErrorHRESULT(pExceptionPointers);
 }
 
@@ -910,28 +910,28 @@ uint32_t interceptor_ICJI::GetErrorMessage(
           char16_t* buffer,
           uint32_t bufferLength)
 {
-    mcs->AddCall("GetErrorMessage");
+    MethodCallTimer timer(mcs, "GetErrorMessage", &methodCalls);
     return original_ICorJitInfo->GetErrorMessage(buffer, bufferLength);
 }
 
 int interceptor_ICJI::FilterException(
           struct _EXCEPTION_POINTERS* pExceptionPointers)
 {
-    mcs->AddCall("FilterException");
+    MethodCallTimer timer(mcs, "FilterException", &methodCalls);
     return original_ICorJitInfo->FilterException(pExceptionPointers);
 }
 
 void interceptor_ICJI::ThrowExceptionForJitResult(
           JITINTERFACE_HRESULT result)
 {
-    mcs->AddCall("ThrowExceptionForJitResult");
+    MethodCallTimer timer(mcs, "ThrowExceptionForJitResult", &methodCalls);
     original_ICorJitInfo->ThrowExceptionForJitResult(result);
 }
 
 void interceptor_ICJI::ThrowExceptionForHelper(
           const CORINFO_HELPER_DESC* throwHelper)
 {
-    mcs->AddCall("ThrowExceptionForHelper");
+    MethodCallTimer timer(mcs, "ThrowExceptionForHelper", &methodCalls);
     original_ICorJitInfo->ThrowExceptionForHelper(throwHelper);
 }
 
@@ -939,7 +939,7 @@ bool interceptor_ICJI::runWithErrorTrap(
           ICorJitInfo::errorTrapFunction function,
           void* parameter)
 {
-    mcs->AddCall("runWithErrorTrap");
+    MethodCallTimer timer(mcs, "runWithErrorTrap", &methodCalls);
     return original_ICorJitInfo->runWithErrorTrap(function, parameter);
 }
 
@@ -947,27 +947,27 @@ bool interceptor_ICJI::runWithSPMIErrorTrap(
           ICorJitInfo::errorTrapFunction function,
           void* parameter)
 {
-    mcs->AddCall("runWithSPMIErrorTrap");
+    MethodCallTimer timer(mcs, "runWithSPMIErrorTrap", &methodCalls);
     return original_ICorJitInfo->runWithSPMIErrorTrap(function, parameter);
 }
 
 void interceptor_ICJI::getEEInfo(
           CORINFO_EE_INFO* pEEInfoOut)
 {
-    mcs->AddCall("getEEInfo");
+    MethodCallTimer timer(mcs, "getEEInfo", &methodCalls);
     original_ICorJitInfo->getEEInfo(pEEInfoOut);
 }
 
 const char16_t* interceptor_ICJI::getJitTimeLogFilename()
 {
-    mcs->AddCall("getJitTimeLogFilename");
+    MethodCallTimer timer(mcs, "getJitTimeLogFilename", &methodCalls);
     return original_ICorJitInfo->getJitTimeLogFilename();
 }
 
 mdMethodDef interceptor_ICJI::getMethodDefFromMethod(
           CORINFO_METHOD_HANDLE hMethod)
 {
-    mcs->AddCall("getMethodDefFromMethod");
+    MethodCallTimer timer(mcs, "getMethodDefFromMethod", &methodCalls);
     return original_ICorJitInfo->getMethodDefFromMethod(hMethod);
 }
 
@@ -977,7 +977,7 @@ size_t interceptor_ICJI::printMethodName(
           size_t bufferSize,
           size_t* pRequiredBufferSize)
 {
-    mcs->AddCall("printMethodName");
+    MethodCallTimer timer(mcs, "printMethodName", &methodCalls);
     return original_ICorJitInfo->printMethodName(ftn, buffer, bufferSize, pRequiredBufferSize);
 }
 
@@ -987,14 +987,14 @@ const char* interceptor_ICJI::getMethodNameFromMetadata(
           const char** namespaceName,
           const char** enclosingClassName)
 {
-    mcs->AddCall("getMethodNameFromMetadata");
+    MethodCallTimer timer(mcs, "getMethodNameFromMetadata", &methodCalls);
     return original_ICorJitInfo->getMethodNameFromMetadata(ftn, className, namespaceName, enclosingClassName);
 }
 
 unsigned interceptor_ICJI::getMethodHash(
           CORINFO_METHOD_HANDLE ftn)
 {
-    mcs->AddCall("getMethodHash");
+    MethodCallTimer timer(mcs, "getMethodHash", &methodCalls);
     return original_ICorJitInfo->getMethodHash(ftn);
 }
 
@@ -1004,7 +1004,7 @@ size_t interceptor_ICJI::findNameOfToken(
           char* szFQName,
           size_t FQNameCapacity)
 {
-    mcs->AddCall("findNameOfToken");
+    MethodCallTimer timer(mcs, "findNameOfToken", &methodCalls);
     return original_ICorJitInfo->findNameOfToken(moduleHandle, token, szFQName, FQNameCapacity);
 }
 
@@ -1012,35 +1012,35 @@ bool interceptor_ICJI::getSystemVAmd64PassStructInRegisterDescriptor(
           CORINFO_CLASS_HANDLE structHnd,
           SYSTEMV_AMD64_CORINFO_STRUCT_REG_PASSING_DESCRIPTOR* structPassInRegDescPtr)
 {
-    mcs->AddCall("getSystemVAmd64PassStructInRegisterDescriptor");
+    MethodCallTimer timer(mcs, "getSystemVAmd64PassStructInRegisterDescriptor", &methodCalls);
     return original_ICorJitInfo->getSystemVAmd64PassStructInRegisterDescriptor(structHnd, structPassInRegDescPtr);
 }
 
 uint32_t interceptor_ICJI::getLoongArch64PassStructInRegisterFlags(
           CORINFO_CLASS_HANDLE structHnd)
 {
-    mcs->AddCall("getLoongArch64PassStructInRegisterFlags");
+    MethodCallTimer timer(mcs, "getLoongArch64PassStructInRegisterFlags", &methodCalls);
     return original_ICorJitInfo->getLoongArch64PassStructInRegisterFlags(structHnd);
 }
 
 uint32_t interceptor_ICJI::getThreadTLSIndex(
           void** ppIndirection)
 {
-    mcs->AddCall("getThreadTLSIndex");
+    MethodCallTimer timer(mcs, "getThreadTLSIndex", &methodCalls);
     return original_ICorJitInfo->getThreadTLSIndex(ppIndirection);
 }
 
 const void* interceptor_ICJI::getInlinedCallFrameVptr(
           void** ppIndirection)
 {
-    mcs->AddCall("getInlinedCallFrameVptr");
+    MethodCallTimer timer(mcs, "getInlinedCallFrameVptr", &methodCalls);
     return original_ICorJitInfo->getInlinedCallFrameVptr(ppIndirection);
 }
 
 int32_t* interceptor_ICJI::getAddrOfCaptureThreadGlobal(
           void** ppIndirection)
 {
-    mcs->AddCall("getAddrOfCaptureThreadGlobal");
+    MethodCallTimer timer(mcs, "getAddrOfCaptureThreadGlobal", &methodCalls);
     return original_ICorJitInfo->getAddrOfCaptureThreadGlobal(ppIndirection);
 }
 
@@ -1048,7 +1048,7 @@ void* interceptor_ICJI::getHelperFtn(
           CorInfoHelpFunc ftnNum,
           void** ppIndirection)
 {
-    mcs->AddCall("getHelperFtn");
+    MethodCallTimer timer(mcs, "getHelperFtn", &methodCalls);
     return original_ICorJitInfo->getHelperFtn(ftnNum, ppIndirection);
 }
 
@@ -1057,7 +1057,7 @@ void interceptor_ICJI::getFunctionEntryPoint(
           CORINFO_CONST_LOOKUP* pResult,
           CORINFO_ACCESS_FLAGS accessFlags)
 {
-    mcs->AddCall("getFunctionEntryPoint");
+    MethodCallTimer timer(mcs, "getFunctionEntryPoint", &methodCalls);
     original_ICorJitInfo->getFunctionEntryPoint(ftn, pResult, accessFlags);
 }
 
@@ -1066,7 +1066,7 @@ void interceptor_ICJI::getFunctionFixedEntryPoint(
           bool isUnsafeFunctionPointer,
           CORINFO_CONST_LOOKUP* pResult)
 {
-    mcs->AddCall("getFunctionFixedEntryPoint");
+    MethodCallTimer timer(mcs, "getFunctionFixedEntryPoint", &methodCalls);
     original_ICorJitInfo->getFunctionFixedEntryPoint(ftn, isUnsafeFunctionPointer, pResult);
 }
 
@@ -1074,14 +1074,14 @@ void* interceptor_ICJI::getMethodSync(
           CORINFO_METHOD_HANDLE ftn,
           void** ppIndirection)
 {
-    mcs->AddCall("getMethodSync");
+    MethodCallTimer timer(mcs, "getMethodSync", &methodCalls);
     return original_ICorJitInfo->getMethodSync(ftn, ppIndirection);
 }
 
 CorInfoHelpFunc interceptor_ICJI::getLazyStringLiteralHelper(
           CORINFO_MODULE_HANDLE handle)
 {
-    mcs->AddCall("getLazyStringLiteralHelper");
+    MethodCallTimer timer(mcs, "getLazyStringLiteralHelper", &methodCalls);
     return original_ICorJitInfo->getLazyStringLiteralHelper(handle);
 }
 
@@ -1089,7 +1089,7 @@ CORINFO_MODULE_HANDLE interceptor_ICJI::embedModuleHandle(
           CORINFO_MODULE_HANDLE handle,
           void** ppIndirection)
 {
-    mcs->AddCall("embedModuleHandle");
+    MethodCallTimer timer(mcs, "embedModuleHandle", &methodCalls);
     return original_ICorJitInfo->embedModuleHandle(handle, ppIndirection);
 }
 
@@ -1097,7 +1097,7 @@ CORINFO_CLASS_HANDLE interceptor_ICJI::embedClassHandle(
           CORINFO_CLASS_HANDLE handle,
           void** ppIndirection)
 {
-    mcs->AddCall("embedClassHandle");
+    MethodCallTimer timer(mcs, "embedClassHandle", &methodCalls);
     return original_ICorJitInfo->embedClassHandle(handle, ppIndirection);
 }
 
@@ -1105,7 +1105,7 @@ CORINFO_METHOD_HANDLE interceptor_ICJI::embedMethodHandle(
           CORINFO_METHOD_HANDLE handle,
           void** ppIndirection)
 {
-    mcs->AddCall("embedMethodHandle");
+    MethodCallTimer timer(mcs, "embedMethodHandle", &methodCalls);
     return original_ICorJitInfo->embedMethodHandle(handle, ppIndirection);
 }
 
@@ -1113,7 +1113,7 @@ CORINFO_FIELD_HANDLE interceptor_ICJI::embedFieldHandle(
           CORINFO_FIELD_HANDLE handle,
           void** ppIndirection)
 {
-    mcs->AddCall("embedFieldHandle");
+    MethodCallTimer timer(mcs, "embedFieldHandle", &methodCalls);
     return original_ICorJitInfo->embedFieldHandle(handle, ppIndirection);
 }
 
@@ -1122,7 +1122,7 @@ void interceptor_ICJI::embedGenericHandle(
           bool fEmbedParent,
           CORINFO_GENERICHANDLE_RESULT* pResult)
 {
-    mcs->AddCall("embedGenericHandle");
+    MethodCallTimer timer(mcs, "embedGenericHandle", &methodCalls);
     original_ICorJitInfo->embedGenericHandle(pResolvedToken, fEmbedParent, pResult);
 }
 
@@ -1130,7 +1130,7 @@ void interceptor_ICJI::getLocationOfThisType(
           CORINFO_METHOD_HANDLE context,
           CORINFO_LOOKUP_KIND* pLookupKind)
 {
-    mcs->AddCall("getLocationOfThisType");
+    MethodCallTimer timer(mcs, "getLocationOfThisType", &methodCalls);
     original_ICorJitInfo->getLocationOfThisType(context, pLookupKind);
 }
 
@@ -1138,7 +1138,7 @@ void interceptor_ICJI::getAddressOfPInvokeTarget(
           CORINFO_METHOD_HANDLE method,
           CORINFO_CONST_LOOKUP* pLookup)
 {
-    mcs->AddCall("getAddressOfPInvokeTarget");
+    MethodCallTimer timer(mcs, "getAddressOfPInvokeTarget", &methodCalls);
     original_ICorJitInfo->getAddressOfPInvokeTarget(method, pLookup);
 }
 
@@ -1146,14 +1146,14 @@ void* interceptor_ICJI::GetCookieForPInvokeCalliSig(
           CORINFO_SIG_INFO* szMetaSig,
           void** ppIndirection)
 {
-    mcs->AddCall("GetCookieForPInvokeCalliSig");
+    MethodCallTimer timer(mcs, "GetCookieForPInvokeCalliSig", &methodCalls);
     return original_ICorJitInfo->GetCookieForPInvokeCalliSig(szMetaSig, ppIndirection);
 }
 
 bool interceptor_ICJI::canGetCookieForPInvokeCalliSig(
           CORINFO_SIG_INFO* szMetaSig)
 {
-    mcs->AddCall("canGetCookieForPInvokeCalliSig");
+    MethodCallTimer timer(mcs, "canGetCookieForPInvokeCalliSig", &methodCalls);
     return original_ICorJitInfo->canGetCookieForPInvokeCalliSig(szMetaSig);
 }
 
@@ -1161,7 +1161,7 @@ CORINFO_JUST_MY_CODE_HANDLE interceptor_ICJI::getJustMyCodeHandle(
           CORINFO_METHOD_HANDLE method,
           CORINFO_JUST_MY_CODE_HANDLE** ppIndirection)
 {
-    mcs->AddCall("getJustMyCodeHandle");
+    MethodCallTimer timer(mcs, "getJustMyCodeHandle", &methodCalls);
     return original_ICorJitInfo->getJustMyCodeHandle(method, ppIndirection);
 }
 
@@ -1170,7 +1170,7 @@ void interceptor_ICJI::GetProfilingHandle(
           void** pProfilerHandle,
           bool* pbIndirectedHandles)
 {
-    mcs->AddCall("GetProfilingHandle");
+    MethodCallTimer timer(mcs, "GetProfilingHandle", &methodCalls);
     original_ICorJitInfo->GetProfilingHandle(pbHookFunction, pProfilerHandle, pbIndirectedHandles);
 }
 
@@ -1181,7 +1181,7 @@ void interceptor_ICJI::getCallInfo(
           CORINFO_CALLINFO_FLAGS flags,
           CORINFO_CALL_INFO* pResult)
 {
-    mcs->AddCall("getCallInfo");
+    MethodCallTimer timer(mcs, "getCallInfo", &methodCalls);
     original_ICorJitInfo->getCallInfo(pResolvedToken, pConstrainedResolvedToken, callerHandle, flags, pResult);
 }
 
@@ -1189,14 +1189,14 @@ bool interceptor_ICJI::canAccessFamily(
           CORINFO_METHOD_HANDLE hCaller,
           CORINFO_CLASS_HANDLE hInstanceType)
 {
-    mcs->AddCall("canAccessFamily");
+    MethodCallTimer timer(mcs, "canAccessFamily", &methodCalls);
     return original_ICorJitInfo->canAccessFamily(hCaller, hInstanceType);
 }
 
 bool interceptor_ICJI::isRIDClassDomainID(
           CORINFO_CLASS_HANDLE cls)
 {
-    mcs->AddCall("isRIDClassDomainID");
+    MethodCallTimer timer(mcs, "isRIDClassDomainID", &methodCalls);
     return original_ICorJitInfo->isRIDClassDomainID(cls);
 }
 
@@ -1204,15 +1204,22 @@ unsigned interceptor_ICJI::getClassDomainID(
           CORINFO_CLASS_HANDLE cls,
           void** ppIndirection)
 {
-    mcs->AddCall("getClassDomainID");
+    MethodCallTimer timer(mcs, "getClassDomainID", &methodCalls);
     return original_ICorJitInfo->getClassDomainID(cls, ppIndirection);
 }
 
+uint32_t interceptor_ICJI::getThreadLocalStaticBlockIndex(
+          CORINFO_CLASS_HANDLE cls)
+{
+    MethodCallTimer timer(mcs, "getThreadLocalStaticBlockIndex", &methodCalls);
+    return original_ICorJitInfo->getThreadLocalStaticBlockIndex(cls);
+}
+
 void* interceptor_ICJI::getFieldAddress(
           CORINFO_FIELD_HANDLE field,
           void** ppIndirection)
 {
-    mcs->AddCall("getFieldAddress");
+    MethodCallTimer timer(mcs, "getFieldAddress", &methodCalls);
     return original_ICorJitInfo->getFieldAddress(field, ppIndirection);
 }
 
@@ -1222,7 +1229,7 @@ bool interceptor_ICJI::getReadonlyStaticFieldValue(
           int bufferSize,
           bool ignoreMovableObjects)
 {
-    mcs->AddCall("getReadonlyStaticFieldValue");
+    MethodCallTimer timer(mcs, "getReadonlyStaticFieldValue", &methodCalls);
     return original_ICorJitInfo->getReadonlyStaticFieldValue(field, buffer, bufferSize, ignoreMovableObjects);
 }
 
@@ -1230,7 +1237,7 @@ CORINFO_CLASS_HANDLE interceptor_ICJI::getStaticFieldCurrentClass(
           CORINFO_FIELD_HANDLE field,
           bool* pIsSpeculative)
 {
-    mcs->AddCall("getStaticFieldCurrentClass");
+    MethodCallTimer timer(mcs, "getStaticFieldCurrentClass", &methodCalls);
     return original_ICorJitInfo->getStaticFieldCurrentClass(field, pIsSpeculative);
 }
 
@@ -1238,14 +1245,14 @@ CORINFO_VARARGS_HANDLE interceptor_ICJI::getVarArgsHandle(
           CORINFO_SIG_INFO* pSig,
           void** ppIndirection)
 {
-    mcs->AddCall("getVarArgsHandle");
+    MethodCallTimer timer(mcs, "getVarArgsHandle", &methodCalls);
     return original_ICorJitInfo->getVarArgsHandle(pSig, ppIndirection);
 }
 
 bool interceptor_ICJI::canGetVarArgsHandle(
           CORINFO_SIG_INFO* pSig)
 {
-    mcs->AddCall("canGetVarArgsHandle");
+    MethodCallTimer timer(mcs, "canGetVarArgsHandle", &methodCalls);
     return original_ICorJitInfo->canGetVarArgsHandle(pSig);
 }
 
@@ -1254,14 +1261,14 @@ InfoAccessType interceptor_ICJI::constructStringLiteral(
           mdToken metaTok,
           void** ppValue)
 {
-    mcs->AddCall("constructStringLiteral");
+    MethodCallTimer timer(mcs, "constructStringLiteral", &methodCalls);
     return original_ICorJitInfo->constructStringLiteral(module, metaTok, ppValue);
 }
 
 InfoAccessType interceptor_ICJI::emptyStringLiteral(
           void** ppValue)
 {
-    mcs->AddCall("emptyStringLiteral");
+    MethodCallTimer timer(mcs, "emptyStringLiteral", &methodCalls);
     return original_ICorJitInfo->emptyStringLiteral(ppValue);
 }
 
@@ -1269,7 +1276,7 @@ uint32_t interceptor_ICJI::getFieldThreadLocalStoreID(
           CORINFO_FIELD_HANDLE field,
           void** ppIndirection)
 {
-    mcs->AddCall("getFieldThreadLocalStoreID");
+    MethodCallTimer timer(mcs, "getFieldThreadLocalStoreID", &methodCalls);
     return original_ICorJitInfo->getFieldThreadLocalStoreID(field, ppIndirection);
 }
 
@@ -1277,7 +1284,7 @@ void interceptor_ICJI::addActiveDependency(
           CORINFO_MODULE_HANDLE moduleFrom,
           CORINFO_MODULE_HANDLE moduleTo)
 {
-    mcs->AddCall("addActiveDependency");
+    MethodCallTimer timer(mcs, "addActiveDependency", &methodCalls);
     original_ICorJitInfo->addActiveDependency(moduleFrom, moduleTo);
 }
 
@@ -1287,14 +1294,14 @@ CORINFO_METHOD_HANDLE interceptor_ICJI::GetDelegateCtor(
           CORINFO_METHOD_HANDLE targetMethodHnd,
           DelegateCtorArgs* pCtorData)
 {
-    mcs->AddCall("GetDelegateCtor");
+    MethodCallTimer timer(mcs, "GetDelegateCtor", &methodCalls);
     return original_ICorJitInfo->GetDelegateCtor(methHnd, clsHnd, targetMethodHnd, pCtorData);
 }
 
 void interceptor_ICJI::MethodCompileComplete(
           CORINFO_METHOD_HANDLE methHnd)
 {
-    mcs->AddCall("MethodCompileComplete");
+    MethodCallTimer timer(mcs, "MethodCompileComplete", &methodCalls);
     original_ICorJitInfo->MethodCompileComplete(methHnd);
 }
 
@@ -1304,7 +1311,7 @@ bool interceptor_ICJI::getTailCallHelpers(
           CORINFO_GET_TAILCALL_HELPERS_FLAGS flags,
           CORINFO_TAILCALL_HELPERS* pResult)
 {
-    mcs->AddCall("getTailCallHelpers");
+    MethodCallTimer timer(mcs, "getTailCallHelpers", &methodCalls);
     return original_ICorJitInfo->getTailCallHelpers(callToken, sig, flags, pResult);
 }
 
@@ -1312,7 +1319,7 @@ bool interceptor_ICJI::convertPInvokeCalliToCall(
           CORINFO_RESOLVED_TOKEN* pResolvedToken,
           bool mustConvert)
 {
-    mcs->AddCall("convertPInvokeCalliToCall");
+    MethodCallTimer timer(mcs, "convertPInvokeCalliToCall", &methodCalls);
     return original_ICorJitInfo->convertPInvokeCalliToCall(pResolvedToken, mustConvert);
 }
 
@@ -1320,21 +1327,21 @@ bool interceptor_ICJI::notifyInstructionSetUsage(
           CORINFO_InstructionSet instructionSet,
           bool supportEnabled)
 {
-    mcs->AddCall("notifyInstructionSetUsage");
+    MethodCallTimer timer(mcs, "notifyInstructionSetUsage", &methodCalls);
     return original_ICorJitInfo->notifyInstructionSetUsage(instructionSet, supportEnabled);
 }
 
 void interceptor_ICJI::updateEntryPointForTailCall(
           CORINFO_CONST_LOOKUP* entryPoint)
 {
-    mcs->AddCall("updateEntryPointForTailCall");
+    MethodCallTimer timer(mcs, "updateEntryPointForTailCall", &methodCalls);
     original_ICorJitInfo->updateEntryPointForTailCall(entryPoint);
 }
 
 void interceptor_ICJI::allocMem(
           AllocMemArgs* pArgs)
 {
-    mcs->AddCall("allocMem");
+    MethodCallTimer timer(mcs, "allocMem", &methodCalls);
     original_ICorJitInfo->allocMem(pArgs);
 }
 
@@ -1343,7 +1350,7 @@ void interceptor_ICJI::reserveUnwindInfo(
           bool isColdCode,
           uint32_t unwindSize)
 {
-    mcs->AddCall("reserveUnwindInfo");
+    MethodCallTimer timer(mcs, "reserveUnwindInfo", &methodCalls);
     original_ICorJitInfo->reserveUnwindInfo(isFunclet, isColdCode, unwindSize);
 }
 
@@ -1356,21 +1363,21 @@ void interceptor_ICJI::allocUnwindInfo(
           uint8_t* pUnwindBlock,
           CorJitFuncKind funcKind)
 {
-    mcs->AddCall("allocUnwindInfo");
+    MethodCallTimer timer(mcs, "allocUnwindInfo", &methodCalls);
     original_ICorJitInfo->allocUnwindInfo(pHotCode, pColdCode, startOffset, endOffset, unwindSize, pUnwindBlock, funcKind);
 }
 
 void* interceptor_ICJI::allocGCInfo(
           size_t size)
 {
-    mcs->AddCall("allocGCInfo");
+    MethodCallTimer timer(mcs, "allocGCInfo", &methodCalls);
     return original_ICorJitInfo->allocGCInfo(size);
 }
 
 void interceptor_ICJI::setEHcount(
           unsigned cEH)
 {
-    mcs->AddCall("setEHcount");
+    MethodCallTimer timer(mcs, "setEHcount", &methodCalls);
     original_ICorJitInfo->setEHcount(cEH);
 }
 
@@ -1378,7 +1385,7 @@ void interceptor_ICJI::setEHinfo(
           unsigned EHnumber,
           const CORINFO_EH_CLAUSE* clause)
 {
-    mcs->AddCall("setEHinfo");
+    MethodCallTimer timer(mcs, "setEHinfo", &methodCalls);
     original_ICorJitInfo->setEHinfo(EHnumber, clause);
 }
 
@@ -1387,7 +1394,7 @@ bool interceptor_ICJI::logMsg(
           const char* fmt,
           va_list args)
 {
-    mcs->AddCall("logMsg");
+    MethodCallTimer timer(mcs, "logMsg", &methodCalls);
     return original_ICorJitInfo->logMsg(level, fmt, args);
 }
 
@@ -1396,14 +1403,14 @@ int interceptor_ICJI::doAssert(
           int iLine,
           const char* szExpr)
 {
-    mcs->AddCall("doAssert");
+    MethodCallTimer timer(mcs, "doAssert", &methodCalls);
     return original_ICorJitInfo->doAssert(szFile, iLine, szExpr);
 }
 
 void interceptor_ICJI::reportFatalError(
           CorJitResult result)
 {
-    mcs->AddCall("reportFatalError");
+    MethodCallTimer timer(mcs, "reportFatalError", &methodCalls);
     original_ICorJitInfo->reportFatalError(result);
 }
 
@@ -1414,7 +1421,7 @@ JITINTERFACE_HRESULT interceptor_ICJI::getPgoInstrumentationResults(
           uint8_t** pInstrumentationData,
           ICorJitInfo::PgoSource* pgoSource)
 {
-    mcs->AddCall("getPgoInstrumentationResults");
+    MethodCallTimer timer(mcs, "getPgoInstrumentationResults", &methodCalls);
     return original_ICorJitInfo->getPgoInstrumentationResults(ftnHnd, pSchema, pCountSchemaItems, pInstrumentationData, pgoSource);
 }
 
@@ -1424,7 +1431,7 @@ JITINTERFACE_HRESULT interceptor_ICJI::allocPgoInstrumentationBySchema(
           uint32_t countSchemaItems,
           uint8_t** pInstrumentationData)
 {
-    mcs->AddCall("allocPgoInstrumentationBySchema");
+    MethodCallTimer timer(mcs, "allocPgoInstrumentationBySchema", &methodCalls);
     return original_ICorJitInfo->allocPgoInstrumentationBySchema(ftnHnd, pSchema, countSchemaItems, pInstrumentationData);
 }
 
@@ -1433,7 +1440,7 @@ void interceptor_ICJI::recordCallSite(
           CORINFO_SIG_INFO* callSig,
           CORINFO_METHOD_HANDLE methodHandle)
 {
-    mcs->AddCall("recordCallSite");
+    MethodCallTimer timer(mcs, "recordCallSite", &methodCalls);
     original_ICorJitInfo->recordCallSite(instrOffset, callSig, methodHandle);
 }
 
@@ -1445,20 +1452,20 @@ void interceptor_ICJI::recordRelocation(
           uint16_t slotNum,
           int32_t addlDelta)
 {
-    mcs->AddCall("recordRelocation");
+    MethodCallTimer timer(mcs, "recordRelocation", &methodCalls);
     original_ICorJitInfo->recordRelocation(location, locationRW, target, fRelocType, slotNum, addlDelta);
 }
 
 uint16_t interceptor_ICJI::getRelocTypeHint(
           void* target)
 {
-    mcs->AddCall("getRelocTypeHint");
+    MethodCallTimer timer(mcs, "getRelocTypeHint", &methodCalls);
     return original_ICorJitInfo->getRelocTypeHint(target);
 }
 
 uint32_t interceptor_ICJI::getExpectedTargetArchitecture()
 {
-    mcs->AddCall("getExpectedTargetArchitecture");
+    MethodCallTimer timer(mcs, "getExpectedTargetArchitecture", &methodCalls);
     return original_ICorJitInfo->getExpectedTargetArchitecture();
 }
 
@@ -1466,7 +1473,14 @@ uint32_t interceptor_ICJI::getJitFlags(
           CORJIT_FLAGS* flags,
           uint32_t sizeInBytes)
 {
-    mcs->AddCall("getJitFlags");
+    MethodCallTimer timer(mcs, "getJitFlags", &methodCalls);
     return original_ICorJitInfo->getJitFlags(flags, sizeInBytes);
 }
 
+void interceptor_ICJI::reportJitPhaseTelemetry(
+          const JitPhaseTelemetry* telemetry)
+{
+    MethodCallTimer timer(mcs, "reportJitPhaseTelemetry", &methodCalls);
+    original_ICorJitInfo->reportJitPhaseTelemetry(telemetry);
+}
+
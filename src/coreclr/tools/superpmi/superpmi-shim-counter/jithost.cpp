@@ -30,18 +30,18 @@ void JitHost::freeMemory(void* block)
 
 int JitHost::getIntConfigValue(const WCHAR* key, int defaultValue)
 {
-    mcs->AddCall("getIntConfigValue");
+    MethodCallTimer timer(mcs, "getIntConfigValue");
     return wrappedHost->getIntConfigValue(key, defaultValue);
 }
 
 const WCHAR* JitHost::getStringConfigValue(const WCHAR* key)
 {
-    mcs->AddCall("getStringConfigValue");
+    MethodCallTimer timer(mcs, "getStringConfigValue");
     return wrappedHost->getStringConfigValue(key);
 }
 
 void JitHost::freeStringConfigValue(const WCHAR* value)
 {
-    mcs->AddCall("freeStringConfigValue");
+    MethodCallTimer timer(mcs, "freeStringConfigValue");
     wrappedHost->freeStringConfigValue(value);
 }
@@ -2,31 +2,93 @@
 // The .NET Foundation licenses this file to you under the MIT license.
 
 #include "standardpch.h"
+#include "runtimedetails.h"
 #include "methodcallsummarizer.h"
 #include "logging.h"
 #include "spmiutil.h"
 
+// Holds a critical section for the enclosing scope.
+class CriticalSectionHolder
+{
+public:
+    CriticalSectionHolder(CRITICAL_SECTION* critSec) : critSec(critSec)
+    {
+        EnterCriticalSection(critSec);
+    }
+
+    ~CriticalSectionHolder()
+    {
+        LeaveCriticalSection(critSec);
+    }
+
+private:
+    CRITICAL_SECTION* critSec;
+};
+
+CompiledMethodCalls::CompiledMethodCalls()
+{
+    numCalls   = 0;
+    totalTicks = 0;
+    memset(slowestCalls, 0, sizeof(slowestCalls));
+}
+
+void CompiledMethodCalls::AddCall(const char* name, int64_t ticks)
+{
+    numCalls++;
+    totalTicks += ticks;
+
+    if (ticks <= slowestCalls[SLOWEST_CALLS_PER_METHOD - 1].ticks)
+    {
+        return;
+    }
+
+    int i = SLOWEST_CALLS_PER_METHOD - 1;
+    for (; i > 0 && ticks > slowestCalls[i - 1].ticks; i--)
+    {
+        slowestCalls[i] = slowestCalls[i - 1];
+    }
+    slowestCalls[i].name  = name;
+    slowestCalls[i].ticks = ticks;
+}
+
 MethodCallSummarizer::MethodCallSummarizer(WCHAR* logPath)
 {
-    numNames = 0;
-    names    = nullptr;
-    counts   = nullptr;
+    numNames   = 0;
+    names      = nullptr;
+    counts     = nullptr;
+    times      = nullptr;
+    methods    = new CompiledMethod[SLOWEST_METHODS];
+    numMethods = 0;
 
     const WCHAR* fileName  = GetCommandLineW();
     const WCHAR* extension = W(".csv");
 
-    dataFileName = GetResultFileName(logPath, fileName, extension);
+    dataFileName    = GetResultFileName(logPath, fileName, extension);
+    timesFileName   = GetResultFileName(logPath, fileName, W(".times.csv"));
+    methodsFileName = GetResultFileName(logPath, fileName, W(".methods.csv"));
+
+    ::QueryPerformanceFrequency(&frequency);
+    InitializeCriticalSection(&critSec);
 }
 
 MethodCallSummarizer::~MethodCallSummarizer()
 {
     delete [] dataFileName;
+    delete [] timesFileName;
+    delete [] methodsFileName;
     delete [] counts;
+    delete [] times;
     for (int i = 0; i < numNames; i++)
     {
         delete [] names[i];
     }
     delete [] names;
+    for (int i = 0; i < numMethods; i++)
+    {
+        delete [] methods[i].name;
+    }
+    delete [] methods;
+    DeleteCriticalSection(&critSec);
 }
 
 // lots of ways will be faster.. this happens to be decently simple and good enough for the task at hand and nicely
@@ -35,6 +97,8 @@ MethodCallSummarizer::~MethodCallSummarizer()
 // three slots in short runs
 void MethodCallSummarizer::AddCall(const char* name)
 {
+    CriticalSectionHolder lock(&critSec);
+
     // if we can find it already in our list, increment the count
     for (int i = 0; i < numNames; i++)
     {
@@ -50,6 +114,9 @@ void MethodCallSummarizer::AddCall(const char* name)
                     char* tempc         = names[i - 1];
                     names[i - 1]        = names[i];
                     names[i]            = tempc;
+                    CallTimes tempt     = times[i - 1];
+                    times[i - 1]        = times[i];
+                    times[i]            = tempt;
                 }
             return;
         }
@@ -58,6 +125,7 @@ void MethodCallSummarizer::AddCall(const char* name)
     // else we didn't find it, so add it
     char**        tnames  = names;
     unsigned int* tcounts = counts;
+    CallTimes*    ttimes  = times;
 
     names = new char*[numNames + 1];
     if (tnames != nullptr)
@@ -78,9 +146,94 @@ void MethodCallSummarizer::AddCall(const char* name)
     }
     counts[numNames] = 1;
 
+    times = new CallTimes[numNames + 1];
+    if (ttimes != nullptr)
+    {
+        memcpy(times, ttimes, numNames * sizeof(CallTimes));
+        delete [] ttimes;
+    }
+    memset(&times[numNames], 0, sizeof(CallTimes));
+
     numNames++;
 }
 
+void MethodCallSummarizer::AddCallTime(const char* name, int64_t ticks)
+{
+    int64_t  nanoseconds = (int64_t)(ticks * (1000000000.0 / frequency.QuadPart));
+    unsigned bucket      = 0;
+    for (int64_t bound = 256; nanoseconds >= bound && bucket < HISTOGRAM_BUCKETS - 1; bound *= 2)
+    {
+        bucket++;
+    }
+
+    CriticalSectionHolder lock(&critSec);
+
+    // The call was added by AddCall, so it's found
+    for (int i = 0; i < numNames; i++)
+    {
+        if (strcmp(name, names[i]) == 0)
+        {
+            times[i].totalTicks += ticks;
+            times[i].maxTicks = max(times[i].maxTicks, ticks);
+            times[i].histogram[bucket]++;
+            return;
+        }
+    }
+}
+
+void MethodCallSummarizer::AddCompiledMethod(ICorJitInfo*                comp,
+                                             CORINFO_METHOD_HANDLE       ftn,
+                                             int64_t                     compileTicks,
+                                             const CompiledMethodCalls&  calls)
+{
+    {
+        CriticalSectionHolder lock(&critSec);
+        if (numMethods == SLOWEST_METHODS && calls.totalTicks <= methods[numMethods - 1].calls.totalTicks)
+        {
+            return;
+        }
+    }
+
+    // Only methods that make the list are named, the name is looked up outside of the lock since it
+    // calls back into the runtime.
+    char   methodName[512];
+    size_t requiredBufferSize = 0;
+    comp->printMethodName(ftn, methodName, sizeof(methodName), &requiredBufferSize);
+
+    CriticalSectionHolder lock(&critSec);
+
+    if (numMethods == SLOWEST_METHODS)
+    {
+        // Another thread may have added a slower method in the meantime
+        if (calls.totalTicks <= methods[numMethods - 1].calls.totalTicks)
+        {
+            return;
+        }
+
+        numMethods--;
+        delete [] methods[numMethods].name;
+    }
+
+    int i = numMethods;
+    for (; i > 0 && calls.totalTicks > methods[i - 1].calls.totalTicks; i--)
+    {
+        methods[i] = methods[i - 1];
+    }
+
+    size_t tlen     = strlen(methodName);
+    methods[i].name = new char[tlen + 1];
+    memcpy(methods[i].name, methodName, tlen + 1);
+    methods[i].compileTicks = compileTicks;
+    methods[i].calls        = calls;
+
+    numMethods++;
+}
+
+double MethodCallSummarizer::TicksToMicroseconds(int64_t ticks)
+{
+    return ticks * 1000000.0 / frequency.QuadPart;
+}
+
 void MethodCallSummarizer::SaveTextFile()
 {
     char   buff[512];
@@ -103,4 +256,85 @@ void MethodCallSummarizer::SaveTextFile()
         WriteFile(hFile, buff, len, &bytesWritten, NULL);
     }
     CloseHandle(hFile);
+
+    SaveTimesFile();
+    SaveMethodsFile();
+}
+
+// Writes the time spent in each function along with a histogram of the call durations
+void MethodCallSummarizer::SaveTimesFile()
+{
+    char   buff[1024];
+    DWORD  bytesWritten = 0;
+    HANDLE hFile        = CreateFileW(timesFileName, GENERIC_READ | GENERIC_WRITE, 0, NULL, CREATE_ALWAYS,
+                               FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+
+    if (hFile == INVALID_HANDLE_VALUE)
+    {
+        LogError("Couldn't open file '%ws': error %d", timesFileName, ::GetLastError());
+        return;
+    }
+
+    int len = sprintf_s(buff, 1024, "FunctionName,Count,TotalUs,AverageUs,MaxUs");
+    for (unsigned bucket = 0; bucket < HISTOGRAM_BUCKETS - 1; bucket++)
+    {
+        len += sprintf_s(buff + len, 1024 - len, ",<%lluns", 256ULL << bucket);
+    }
+    len += sprintf_s(buff + len, 1024 - len, ",>=%lluns\n", 256ULL << (HISTOGRAM_BUCKETS - 2));
+    WriteFile(hFile, buff, (DWORD)len, &bytesWritten, NULL);
+
+    for (int i = 0; i < numNames; i++)
+    {
+        double totalUs = TicksToMicroseconds(times[i].totalTicks);
+        len = sprintf_s(buff, 1024, "%s,%u,%.3f,%.3f,%.3f", names[i], counts[i], totalUs, totalUs / counts[i],
+                        TicksToMicroseconds(times[i].maxTicks));
+        for (unsigned bucket = 0; bucket < HISTOGRAM_BUCKETS; bucket++)
+        {
+            len += sprintf_s(buff + len, 1024 - len, ",%u", times[i].histogram[bucket]);
+        }
+        len += sprintf_s(buff + len, 1024 - len, "\n");
+        WriteFile(hFile, buff, (DWORD)len, &bytesWritten, NULL);
+    }
+    CloseHandle(hFile);
+}
+
+// Writes the compiled methods that spent the most time in calls, with their slowest calls
+void MethodCallSummarizer::SaveMethodsFile()
+{
+    char   buff[1024];
+    DWORD  bytesWritten = 0;
+    HANDLE hFile        = CreateFileW(methodsFileName, GENERIC_READ | GENERIC_WRITE, 0, NULL, CREATE_ALWAYS,
+                               FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+
+    if (hFile == INVALID_HANDLE_VALUE)
+    {
+        LogError("Couldn't open file '%ws': error %d", methodsFileName, ::GetLastError());
+        return;
+    }
+
+    DWORD len = (DWORD)sprintf_s(buff, 1024, "MethodName,CompileUs,Calls,CallsUs,SlowestCalls\n");
+    WriteFile(hFile, buff, len, &bytesWritten, NULL);
+
+    for (int i = 0; i < numMethods; i++)
+    {
+        const CompiledMethodCalls& calls = methods[i].calls;
+
+        // Method names contain commas, the slowest calls are written as "name:us name:us ..."
+        int slen = sprintf_s(buff, 1024, "\"%s\",%.3f,%u,%.3f,", methods[i].name,
+                             TicksToMicroseconds(methods[i].compileTicks), calls.numCalls,
+                             TicksToMicroseconds(calls.totalTicks));
+        if (slen < 0)
+        {
+            continue;
+        }
+
+        for (int j = 0; j < SLOWEST_CALLS_PER_METHOD && calls.slowestCalls[j].name != nullptr; j++)
+        {
+            slen += sprintf_s(buff + slen, 1024 - slen, "%s%s:%.3f", j == 0 ? "" : " ", calls.slowestCalls[j].name,
+                              TicksToMicroseconds(calls.slowestCalls[j].ticks));
+        }
+        slen += sprintf_s(buff + slen, 1024 - slen, "\n");
+        WriteFile(hFile, buff, (DWORD)slen, &bytesWritten, NULL);
+    }
+    CloseHandle(hFile);
 }
@@ -4,19 +4,108 @@
 #ifndef _MethodCallSummarizer
 #define _MethodCallSummarizer
 
+// Calls are bucketed by duration in powers of two, the first bucket is below 256ns and the last
+// holds everything from 2^(8 + HISTOGRAM_BUCKETS - 2) ns up.
+#define HISTOGRAM_BUCKETS 16
+
+// Number of the slowest calls remembered for each compiled method.
+#define SLOWEST_CALLS_PER_METHOD 5
+
+// Number of compiled methods with the most time spent in calls reported.
+#define SLOWEST_METHODS 100
+
+// The interface calls made while compiling a single method.
+struct CompiledMethodCalls
+{
+    struct Call
+    {
+        const char* name;
+        int64_t     ticks;
+    };
+
+    CompiledMethodCalls();
+    void AddCall(const char* name, int64_t ticks);
+
+    unsigned int numCalls;
+    int64_t      totalTicks;
+    Call         slowestCalls[SLOWEST_CALLS_PER_METHOD]; // Sorted, slowest first
+};
+
 class MethodCallSummarizer
 {
 public:
     MethodCallSummarizer(WCHAR* name);
     ~MethodCallSummarizer();
     void AddCall(const char* name);
+    void AddCallTime(const char* name, int64_t ticks);
+    void AddCompiledMethod(ICorJitInfo* comp, CORINFO_METHOD_HANDLE ftn, int64_t compileTicks, const CompiledMethodCalls& calls);
     void SaveTextFile();
 
 private:
+    struct CallTimes
+    {
+        int64_t      totalTicks;
+        int64_t      maxTicks;
+        unsigned int histogram[HISTOGRAM_BUCKETS];
+    };
+
+    struct CompiledMethod
+    {
+        char*               name;
+        int64_t             compileTicks;
+        CompiledMethodCalls calls;
+    };
+
+    double TicksToMicroseconds(int64_t ticks);
+    void SaveTimesFile();
+    void SaveMethodsFile();
+
     char**        names;
     unsigned int* counts;
+    CallTimes*    times;
     int           numNames;
     WCHAR*        dataFileName;
+    WCHAR*        timesFileName;
+    WCHAR*        methodsFileName;
+
+    CompiledMethod* methods; // Sorted, most time spent in calls first
+    int             numMethods;
+
+    LARGE_INTEGER    frequency;
+    CRITICAL_SECTION critSec;
+};
+
+// Counts a call and records its duration when it goes out of scope.
+class MethodCallTimer
+{
+public:
+    MethodCallTimer(MethodCallSummarizer* mcs, const char* name, CompiledMethodCalls* methodCalls = nullptr)
+        : mcs(mcs)
+        , name(name)
+        , methodCalls(methodCalls)
+    {
+        mcs->AddCall(name);
+        ::QueryPerformanceCounter(&start);
+    }
+
+    ~MethodCallTimer()
+    {
+        LARGE_INTEGER stop;
+        ::QueryPerformanceCounter(&stop);
+
+        int64_t ticks = stop.QuadPart - start.QuadPart;
+        mcs->AddCallTime(name, ticks);
+        if (methodCalls != nullptr)
+        {
+            methodCalls->AddCall(name, ticks);
+        }
+    }
+
+private:
+    MethodCallSummarizer* mcs;
+    const char*           name;
+    CompiledMethodCalls*  methodCalls;
+    LARGE_INTEGER         start;
 };
 
 #endif
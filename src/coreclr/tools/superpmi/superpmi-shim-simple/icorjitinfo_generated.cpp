@@ -1058,6 +1058,12 @@ unsigned interceptor_ICJI::getClassDomainID(
     return original_ICorJitInfo->getClassDomainID(cls, ppIndirection);
 }
 
+uint32_t interceptor_ICJI::getThreadLocalStaticBlockIndex(
+          CORINFO_CLASS_HANDLE cls)
+{
+    return original_ICorJitInfo->getThreadLocalStaticBlockIndex(cls);
+}
+
 void* interceptor_ICJI::getFieldAddress(
           CORINFO_FIELD_HANDLE field,
           void** ppIndirection)
@@ -1289,3 +1295,9 @@ uint32_t interceptor_ICJI::getJitFlags(
     return original_ICorJitInfo->getJitFlags(flags, sizeInBytes);
 }
 
+void interceptor_ICJI::reportJitPhaseTelemetry(
+          const JitPhaseTelemetry* telemetry)
+{
+    original_ICorJitInfo->reportJitPhaseTelemetry(telemetry);
+}
+
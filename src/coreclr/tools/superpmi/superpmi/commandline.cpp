@@ -116,6 +116,12 @@ void CommandLine::DumpHelp(const char* program)
     printf("     For a positive 'limit' number, replay and asm diffs will exit if it sees more than 'limit' failures.\n");
     printf("     Otherwise, all methods will be compiled.\n");
     printf("\n");
+    printf(" -benchmark <passes>\n");
+    printf("     After replaying each method context, compile it 'passes' more times with each JIT\n");
+    printf("     and report the cycles and arena memory of every JIT phase, averaged over the passes.\n");
+    printf("     With two JITs, also report the per-phase change from the first JIT to the second and\n");
+    printf("     whether it is statistically significant. Not supported with -parallel.\n");
+    printf("\n");
     printf(" -skipCleanup\n");
     printf("     Skip deletion of temporary files created by child SuperPMI processes with -parallel.\n");
     printf("\n");
@@ -534,6 +540,23 @@ bool CommandLine::Parse(int argc, char* argv[], /* OUT */ Options* o)
                     return false;
                 }
             }
+            else if ((_strnicmp(&argv[i][1], "benchmark", argLen) == 0))
+            {
+                if (++i >= argc)
+                {
+                    DumpHelp(argv[0]);
+                    return false;
+                }
+
+                o->benchmarkIterations = atoi(argv[i]);
+
+                if (o->benchmarkIterations < 1)
+                {
+                    LogError("Incorrect number of passes specified for -benchmark. It must be > 0.");
+                    DumpHelp(argv[0]);
+                    return false;
+                }
+            }
             else if ((_stricmp(&argv[i][1], "skipCleanup") == 0))
             {
                 o->skipCleanup = true;
@@ -668,6 +691,12 @@ bool CommandLine::Parse(int argc, char* argv[], /* OUT */ Options* o)
             return false;
         }
     }
+    if ((o->benchmarkIterations > 0) && o->parallel)
+    {
+        LogError("-benchmark cannot be used with -parallel.");
+        DumpHelp(argv[0]);
+        return false;
+    }
     if (o->skipCleanup && !o->parallel)
     {
         LogError("-skipCleanup requires -parallel.");
@@ -34,6 +34,7 @@ public:
             , workerCount(-1)
             , indexCount(-1)
             , failureLimit(-1)
+            , benchmarkIterations(0)
             , indexes(nullptr)
             , hash(nullptr)
             , methodStatsTypes(nullptr)
@@ -68,6 +69,7 @@ public:
         int   workerCount; // Number of workers to use for /parallel mode. -1 (or 1) means don't use parallel mode.
         int   indexCount;  // If indexCount is -1 and hash points to nullptr it means compile all.
         int   failureLimit; // Number of failures after which bail out the replay/asmdiffs.
+        int   benchmarkIterations; // Number of -benchmark passes per JIT. 0 means no benchmarking.
         int*  indexes;
         char* hash;
         char* methodStatsTypes;
@@ -1481,6 +1481,13 @@ unsigned MyICJI::getClassDomainID(CORINFO_CLASS_HANDLE cls, void** ppIndirection
     return jitInstance->mc->repGetClassDomainID(cls, ppIndirection);
 }
 
+// returns the index of the class's entry in the per-thread table of thread static bases
+uint32_t MyICJI::getThreadLocalStaticBlockIndex(CORINFO_CLASS_HANDLE cls)
+{
+    jitInstance->mc->cr->AddCall("getThreadLocalStaticBlockIndex");
+    return jitInstance->mc->repGetThreadLocalStaticBlockIndex(cls);
+}
+
 // return the data's address (for static fields only)
 void* MyICJI::getFieldAddress(CORINFO_FIELD_HANDLE field, void** ppIndirection)
 {
@@ -1606,9 +1613,23 @@ uint32_t MyICJI::getJitFlags(CORJIT_FLAGS* jitFlags, uint32_t sizeInBytes)
     {
         jitFlags->Set(CORJIT_FLAGS::CORJIT_FLAG_ALT_JIT);
     }
+    if (jitInstance->benchmarkIteration >= 0)
+    {
+        jitFlags->Set(CORJIT_FLAGS::CORJIT_FLAG_PHASE_TELEMETRY);
+    }
     return ret;
 }
 
+// Nothing to replay; the telemetry is only kept by -benchmark.
+void MyICJI::reportJitPhaseTelemetry(const JitPhaseTelemetry* telemetry)
+{
+    jitInstance->mc->cr->AddCall("reportJitPhaseTelemetry");
+    if (jitInstance->benchmarkIteration >= 0)
+    {
+        jitInstance->benchmark->Record(jitInstance->benchmarkIteration, telemetry);
+    }
+}
+
 // Runs the given function with the given parameter under an error trap
 // and returns true if the function completes successfully. We fake this
 // up a bit for SuperPMI and simply catch all exceptions.
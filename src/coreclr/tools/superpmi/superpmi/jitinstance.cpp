@@ -57,6 +57,9 @@ JitInstance* JitInstance::InitJit(char*                         nameOfJit,
         }
     }
 
+    jit->benchmark          = nullptr;
+    jit->benchmarkIteration = -1;
+
     jit->environment.getIntConfigValue   = nullptr;
     jit->environment.getStingConfigValue = nullptr;
 
@@ -513,6 +516,49 @@ void JitInstance::timeResult(CORINFO_METHOD_INFO info, unsigned flags)
     }
 }
 
+//------------------------------------------------------------------------
+// BenchmarkMethod: Compile a method that already replayed successfully once more,
+// with phase telemetry enabled, and add what the JIT reports to the given pass
+// of the benchmark.
+//
+// Arguments:
+//    MethodToCompile - the method context to replay
+//    iteration       - the benchmark pass this compile belongs to
+//
+// Notes:
+//    The compile result is thrown away; MethodToCompile->cr is left untouched.
+//
+void JitInstance::BenchmarkMethod(MethodContext* MethodToCompile, int iteration)
+{
+    mc = MethodToCompile;
+
+    CORINFO_METHOD_INFO info;
+    unsigned            flags = 0;
+    CORINFO_OS          os    = CORINFO_WINNT;
+    mc->repCompileMethod(&info, &flags, &os);
+
+    CompileResult* savedCR = mc->cr;
+    mc->cr                 = new CompileResult();
+
+    uint8_t* NEntryBlock    = nullptr;
+    uint32_t NCodeSizeBlock = 0;
+
+    UINT64 insCountBefore = 0;
+    Instrumentor_GetInsCount(&insCountBefore);
+
+    benchmarkIteration = iteration;
+    pJitInstance->setTargetOS(os);
+    pJitInstance->compileMethod(icji, &info, flags, &NEntryBlock, &NCodeSizeBlock);
+    benchmarkIteration = -1;
+
+    UINT64 insCountAfter = 0;
+    Instrumentor_GetInsCount(&insCountAfter);
+    benchmark->RecordInstructions(iteration, insCountAfter - insCountBefore);
+
+    delete mc->cr;
+    mc->cr = savedCR;
+}
+
 /*-------------------------- Misc ---------------------------------------*/
 
 const WCHAR* JitInstance::getForceOption(const WCHAR* key)
@@ -8,6 +8,7 @@
 #include "simpletimer.h"
 #include "methodcontext.h"
 #include "cycletimer.h"
+#include "phasebenchmark.h"
 
 class JitInstance
 {
@@ -34,6 +35,11 @@ public:
     bool forceClearAltJitFlag;
     bool forceSetAltJitFlag;
 
+    // Collects the JIT's phase telemetry in -benchmark mode. benchmarkIteration is
+    // the pass being measured, or -1 outside of BenchmarkMethod.
+    PhaseBenchmark* benchmark;
+    int             benchmarkIteration;
+
     enum Result
     {
         RESULT_ERROR,
@@ -62,6 +68,8 @@ public:
 
     Result CompileMethod(MethodContext* MethodToCompile, int mcIndex, bool collectThroughput, struct MetricsSummary* metrics, bool* isMinOpts);
 
+    void BenchmarkMethod(MethodContext* MethodToCompile, int iteration);
+
     const WCHAR* getForceOption(const WCHAR* key);
     const WCHAR* getOption(const WCHAR* key);
     const WCHAR* getOption(const WCHAR* key, LightWeightMap<DWORD, DWORD>* options);
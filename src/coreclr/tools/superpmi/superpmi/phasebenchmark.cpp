@@ -0,0 +1,309 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+#include "standardpch.h"
+#include "phasebenchmark.h"
+#include "logging.h"
+
+// Names for the ids the JIT reports. These come from the JIT sources superpmi
+// was built with, so they only line up if the JITs being measured agree on them.
+static const char* const s_phaseNames[] = {
+#define CompPhaseNameMacro(enumName, stringName, hasChildren, parent, measureIR) stringName,
+#include "../../../jit/compphases.h"
+};
+
+static const char* const s_memKindNames[] = {
+#define CompMemKindMacro(kind) #kind,
+#include "../../../jit/compmemkind.h"
+};
+
+static void FormatId(char* buffer, size_t bufferSize, const char* const* names, size_t nameCount, size_t id)
+{
+    if (id < nameCount)
+    {
+        sprintf_s(buffer, bufferSize, "%s", names[id]);
+    }
+    else
+    {
+        sprintf_s(buffer, bufferSize, "#%u", (unsigned)id);
+    }
+}
+
+// Mean and sample standard deviation of one metric across passes.
+struct SampleStats
+{
+    double Mean   = 0;
+    double StdDev = 0;
+    int    Count  = 0;
+
+    template <typename TGetter>
+    static SampleStats Compute(const std::vector<PhaseBenchmarkSample>& samples, TGetter getter)
+    {
+        SampleStats stats;
+        stats.Count = (int)samples.size();
+        if (stats.Count == 0)
+        {
+            return stats;
+        }
+
+        for (const PhaseBenchmarkSample& sample : samples)
+        {
+            stats.Mean += (double)getter(sample);
+        }
+        stats.Mean /= stats.Count;
+
+        if (stats.Count > 1)
+        {
+            double sumSquares = 0;
+            for (const PhaseBenchmarkSample& sample : samples)
+            {
+                double delta = (double)getter(sample) - stats.Mean;
+                sumSquares += delta * delta;
+            }
+            stats.StdDev = sqrt(sumSquares / (stats.Count - 1));
+        }
+
+        return stats;
+    }
+
+    double RelativeStdDev() const
+    {
+        return (Mean == 0) ? 0 : (100.0 * StdDev / Mean);
+    }
+};
+
+//------------------------------------------------------------------------
+// IsSignificant: Welch's t-test at the two-sided 95% confidence level.
+//
+// Arguments:
+//    base  - statistics of the baseline JIT
+//    diff  - statistics of the diff JIT
+//    tStat - [out] the t statistic
+//
+// Return Value:
+//    True if the difference of the means is unlikely to be noise.
+//
+static bool IsSignificant(const SampleStats& base, const SampleStats& diff, double* tStat)
+{
+    *tStat = 0;
+    if ((base.Count < 2) || (diff.Count < 2))
+    {
+        return false;
+    }
+
+    double baseVar = (base.StdDev * base.StdDev) / base.Count;
+    double diffVar = (diff.StdDev * diff.StdDev) / diff.Count;
+    double stdErr  = sqrt(baseVar + diffVar);
+    if (stdErr == 0)
+    {
+        // No noise at all (e.g. allocation sizes); any change is real.
+        return base.Mean != diff.Mean;
+    }
+
+    *tStat = (diff.Mean - base.Mean) / stdErr;
+
+    // Welch-Satterthwaite approximation of the degrees of freedom.
+    double df = ((baseVar + diffVar) * (baseVar + diffVar)) /
+                ((baseVar * baseVar) / (base.Count - 1) + (diffVar * diffVar) / (diff.Count - 1));
+
+    // Two-sided critical values of Student's t for p = 0.05, by degrees of freedom.
+    static const double s_criticalValues[] = {12.706, 4.303, 3.182, 2.776, 2.571, 2.447, 2.365, 2.306, 2.262, 2.228,
+                                              2.201,  2.179, 2.160, 2.145, 2.131, 2.120, 2.110, 2.101, 2.093, 2.086,
+                                              2.080,  2.074, 2.069, 2.064, 2.060, 2.056, 2.052, 2.048, 2.045, 2.042};
+
+    int    dfIndex  = (int)df - 1;
+    double critical = 1.960;
+    if (dfIndex < 0)
+    {
+        critical = s_criticalValues[0];
+    }
+    else if (dfIndex < (int)ARRAY_SIZE(s_criticalValues))
+    {
+        critical = s_criticalValues[dfIndex];
+    }
+
+    return fabs(*tStat) >= critical;
+}
+
+PhaseBenchmark::PhaseBenchmark(int iterations) : samples(iterations)
+{
+}
+
+void PhaseBenchmark::Record(int iteration, const JitPhaseTelemetry* telemetry)
+{
+    PhaseBenchmarkSample& sample = samples[iteration];
+
+    sample.NumCompiles++;
+    sample.TotalCycles += telemetry->totalCycles;
+    sample.TotalArenaBytes += telemetry->totalArenaBytes;
+
+    for (uint32_t i = 0; i < telemetry->phaseCount; i++)
+    {
+        uint16_t id = telemetry->phaseIds[i];
+        if (id >= sample.PhaseCycles.size())
+        {
+            sample.PhaseCycles.resize(id + 1);
+        }
+        sample.PhaseCycles[id] += telemetry->phaseCycles[i];
+    }
+
+    for (uint32_t i = 0; i < telemetry->memKindCount; i++)
+    {
+        uint16_t id = telemetry->memKindIds[i];
+        if (id >= sample.MemKindBytes.size())
+        {
+            sample.MemKindBytes.resize(id + 1);
+        }
+        sample.MemKindBytes[id] += telemetry->memKindBytes[i];
+    }
+}
+
+void PhaseBenchmark::RecordInstructions(int iteration, unsigned long long instructions)
+{
+    samples[iteration].ExecutedInstructions += instructions;
+}
+
+// Number of phase or memory kind ids seen in any pass of either benchmark.
+template <typename TVector>
+static size_t MaxIdCount(const std::vector<PhaseBenchmarkSample>& samples, TVector PhaseBenchmarkSample::*member)
+{
+    size_t count = 0;
+    for (const PhaseBenchmarkSample& sample : samples)
+    {
+        count = std::max(count, (sample.*member).size());
+    }
+    return count;
+}
+
+static unsigned long long ValueAt(const std::vector<unsigned long long>& values, size_t id)
+{
+    return (id < values.size()) ? values[id] : 0;
+}
+
+void PhaseBenchmark::Report(const char* jitName) const
+{
+    if (samples.empty() || (samples[0].NumCompiles == 0))
+    {
+        LogInfo("Benchmark: %s did not report any phase telemetry", jitName);
+        return;
+    }
+
+    SampleStats cycles = SampleStats::Compute(samples, [](const PhaseBenchmarkSample& s) { return s.TotalCycles; });
+    SampleStats bytes =
+        SampleStats::Compute(samples, [](const PhaseBenchmarkSample& s) { return s.TotalArenaBytes; });
+    SampleStats instrs =
+        SampleStats::Compute(samples, [](const PhaseBenchmarkSample& s) { return s.ExecutedInstructions; });
+
+    LogInfo("Benchmark: %s, %d passes of %lld compiles", jitName, GetIterations(), samples[0].NumCompiles);
+    LogInfo("  Total cycles           %16.0f +/- %5.2f%%", cycles.Mean, cycles.RelativeStdDev());
+    if (instrs.Mean != 0)
+    {
+        LogInfo("  Executed instructions  %16.0f +/- %5.2f%%", instrs.Mean, instrs.RelativeStdDev());
+    }
+    LogInfo("  Arena bytes            %16.0f", bytes.Mean);
+
+    char   name[64];
+    size_t phaseCount = MaxIdCount(samples, &PhaseBenchmarkSample::PhaseCycles);
+    LogInfo("  %-36s %16s %9s %7s", "Phase", "Cycles", "Std dev", "Share");
+    for (size_t id = 0; id < phaseCount; id++)
+    {
+        SampleStats phase = SampleStats::Compute(samples, [id](const PhaseBenchmarkSample& s) {
+            return ValueAt(s.PhaseCycles, id);
+        });
+        if (phase.Mean == 0)
+        {
+            continue;
+        }
+
+        FormatId(name, sizeof(name), s_phaseNames, ARRAY_SIZE(s_phaseNames), id);
+        LogInfo("  %-36s %16.0f %8.2f%% %6.2f%%", name, phase.Mean, phase.RelativeStdDev(),
+                100.0 * phase.Mean / cycles.Mean);
+    }
+
+    size_t kindCount = MaxIdCount(samples, &PhaseBenchmarkSample::MemKindBytes);
+    LogInfo("  %-36s %16s %9s", "Memory kind", "Bytes", "Share");
+    for (size_t id = 0; id < kindCount; id++)
+    {
+        SampleStats kind = SampleStats::Compute(samples, [id](const PhaseBenchmarkSample& s) {
+            return ValueAt(s.MemKindBytes, id);
+        });
+        if (kind.Mean == 0)
+        {
+            continue;
+        }
+
+        FormatId(name, sizeof(name), s_memKindNames, ARRAY_SIZE(s_memKindNames), id);
+        LogInfo("  %-36s %16.0f %8.2f%%", name, kind.Mean, 100.0 * kind.Mean / bytes.Mean);
+    }
+}
+
+static void LogComparisonRow(const char* name, const SampleStats& base, const SampleStats& diff)
+{
+    double tStat;
+    bool   significant = IsSignificant(base, diff, &tStat);
+    double delta       = (base.Mean == 0) ? 0 : (100.0 * (diff.Mean - base.Mean) / base.Mean);
+
+    LogInfo("  %-36s %16.0f %16.0f %+8.2f%% %8.2f %s", name, base.Mean, diff.Mean, delta, tStat,
+            significant ? "yes" : "no");
+}
+
+void PhaseBenchmark::Compare(const PhaseBenchmark& base, const PhaseBenchmark& diff)
+{
+    if ((base.samples.empty() || (base.samples[0].NumCompiles == 0)) ||
+        (diff.samples.empty() || (diff.samples[0].NumCompiles == 0)))
+    {
+        return;
+    }
+
+    LogInfo("Benchmark comparison, base vs. diff (significant at p < 0.05 by Welch's t-test)");
+    LogInfo("  %-36s %16s %16s %9s %8s %s", "Metric", "Base", "Diff", "Delta", "t", "Significant");
+
+    auto totalCycles = [](const PhaseBenchmarkSample& s) { return s.TotalCycles; };
+    LogComparisonRow("Total cycles", SampleStats::Compute(base.samples, totalCycles),
+                     SampleStats::Compute(diff.samples, totalCycles));
+
+    auto instructions = [](const PhaseBenchmarkSample& s) { return s.ExecutedInstructions; };
+    SampleStats baseInstrs = SampleStats::Compute(base.samples, instructions);
+    SampleStats diffInstrs = SampleStats::Compute(diff.samples, instructions);
+    if ((baseInstrs.Mean != 0) && (diffInstrs.Mean != 0))
+    {
+        LogComparisonRow("Executed instructions", baseInstrs, diffInstrs);
+    }
+
+    auto arenaBytes = [](const PhaseBenchmarkSample& s) { return s.TotalArenaBytes; };
+    LogComparisonRow("Arena bytes", SampleStats::Compute(base.samples, arenaBytes),
+                     SampleStats::Compute(diff.samples, arenaBytes));
+
+    char   name[64];
+    size_t phaseCount = std::max(MaxIdCount(base.samples, &PhaseBenchmarkSample::PhaseCycles),
+                                 MaxIdCount(diff.samples, &PhaseBenchmarkSample::PhaseCycles));
+    for (size_t id = 0; id < phaseCount; id++)
+    {
+        auto        getter    = [id](const PhaseBenchmarkSample& s) { return ValueAt(s.PhaseCycles, id); };
+        SampleStats basePhase = SampleStats::Compute(base.samples, getter);
+        SampleStats diffPhase = SampleStats::Compute(diff.samples, getter);
+        if ((basePhase.Mean == 0) && (diffPhase.Mean == 0))
+        {
+            continue;
+        }
+
+        FormatId(name, sizeof(name), s_phaseNames, ARRAY_SIZE(s_phaseNames), id);
+        LogComparisonRow(name, basePhase, diffPhase);
+    }
+
+    size_t kindCount = std::max(MaxIdCount(base.samples, &PhaseBenchmarkSample::MemKindBytes),
+                                MaxIdCount(diff.samples, &PhaseBenchmarkSample::MemKindBytes));
+    for (size_t id = 0; id < kindCount; id++)
+    {
+        auto        getter   = [id](const PhaseBenchmarkSample& s) { return ValueAt(s.MemKindBytes, id); };
+        SampleStats baseKind = SampleStats::Compute(base.samples, getter);
+        SampleStats diffKind = SampleStats::Compute(diff.samples, getter);
+        if ((baseKind.Mean == 0) && (diffKind.Mean == 0))
+        {
+            continue;
+        }
+
+        FormatId(name, sizeof(name), s_memKindNames, ARRAY_SIZE(s_memKindNames), id);
+        LogComparisonRow(name, baseKind, diffKind);
+    }
+}
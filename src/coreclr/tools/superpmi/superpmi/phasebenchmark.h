@@ -0,0 +1,49 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+//----------------------------------------------------------
+// PhaseBenchmark.h - collects the per-phase telemetry a JIT reports
+// during -benchmark replays and compares two JITs' results.
+//----------------------------------------------------------
+#ifndef _PhaseBenchmark
+#define _PhaseBenchmark
+
+#include "runtimedetails.h"
+
+// The totals of one pass over the collection.
+struct PhaseBenchmarkSample
+{
+    long long                       NumCompiles          = 0;
+    unsigned long long              TotalCycles          = 0;
+    unsigned long long              TotalArenaBytes      = 0;
+    unsigned long long              ExecutedInstructions = 0;
+    std::vector<unsigned long long> PhaseCycles;  // Indexed by the JIT's phase id
+    std::vector<unsigned long long> MemKindBytes; // Indexed by the JIT's memory kind id
+};
+
+class PhaseBenchmark
+{
+public:
+    PhaseBenchmark(int iterations);
+
+    int GetIterations() const
+    {
+        return (int)samples.size();
+    }
+
+    // Adds the telemetry of one compile to the sample of the given pass.
+    void Record(int iteration, const JitPhaseTelemetry* telemetry);
+    void RecordInstructions(int iteration, unsigned long long instructions);
+
+    // Logs the mean and spread of every phase and memory kind across passes.
+    void Report(const char* jitName) const;
+
+    // Logs how `diff` compares with `base` phase by phase, using Welch's t-test
+    // to tell real throughput changes from run-to-run noise.
+    static void Compare(const PhaseBenchmark& base, const PhaseBenchmark& diff);
+
+private:
+    std::vector<PhaseBenchmarkSample> samples;
+};
+
+#endif
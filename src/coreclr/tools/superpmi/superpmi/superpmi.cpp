@@ -352,6 +352,11 @@ int __cdecl main(int argc, char* argv[])
                 return (int)SpmiResult::JitFailedToInit;
             }
 
+            if (o.benchmarkIterations > 0)
+            {
+                jit->benchmark = new PhaseBenchmark(o.benchmarkIterations);
+            }
+
             if (o.nameOfJit2 != nullptr)
             {
                 jit2 = JitInstance::InitJit(o.nameOfJit2, o.breakOnAssert, &stInitJit, mc, o.forceJit2Options,
@@ -361,6 +366,11 @@ int __cdecl main(int argc, char* argv[])
                     // InitJit already printed a failure message
                     return (int)SpmiResult::JitFailedToInit;
                 }
+
+                if (o.benchmarkIterations > 0)
+                {
+                    jit2->benchmark = new PhaseBenchmark(o.benchmarkIterations);
+                }
             }
         }
 
@@ -463,6 +473,21 @@ int __cdecl main(int argc, char* argv[])
             }
         }
 
+        if ((o.benchmarkIterations > 0) && (res == JitInstance::RESULT_SUCCESS) &&
+            ((o.nameOfJit2 == nullptr) || (res2 == JitInstance::RESULT_SUCCESS)))
+        {
+            // Alternate between the JITs so that drift in machine state (frequency scaling,
+            // cache contents) affects both alike instead of biasing the comparison.
+            for (int i = 0; i < o.benchmarkIterations; i++)
+            {
+                jit->BenchmarkMethod(mc, i);
+                if (jit2 != nullptr)
+                {
+                    jit2->BenchmarkMethod(mc, i);
+                }
+            }
+        }
+
         if (res == JitInstance::RESULT_SUCCESS)
         {
             if (collectThroughput)
@@ -706,6 +731,16 @@ int __cdecl main(int argc, char* argv[])
     st2.Stop();
     LogVerbose("Total time: %fms", st2.GetMilliseconds());
 
+    if ((o.benchmarkIterations > 0) && (jit != nullptr))
+    {
+        jit->benchmark->Report(o.nameOfJit);
+        if (jit2 != nullptr)
+        {
+            jit2->benchmark->Report(o.nameOfJit2);
+            PhaseBenchmark::Compare(*jit->benchmark, *jit2->benchmark);
+        }
+    }
+
     if (o.baseMetricsSummaryFile != nullptr)
     {
         totalBaseMetrics.SaveToFile(o.baseMetricsSummaryFile);
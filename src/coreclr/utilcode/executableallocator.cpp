@@ -265,30 +265,48 @@ void ExecutableAllocator::UpdateCachedMapping(BlockRW* pBlock)
 {
     LIMITED_METHOD_CONTRACT;
 #ifdef ENABLE_CACHED_MAPPINGS
-    if (m_cachedMapping == NULL)
+    int index = 0;
+    while (index < CachedMappingCount - 1 && m_cachedMappings[index] != NULL && m_cachedMappings[index] != pBlock)
     {
-        m_cachedMapping = pBlock;
-        pBlock->refCount++;
+        index++;
     }
-    else if (m_cachedMapping != pBlock)
-    {
-        void* unmapAddress = NULL;
-        size_t unmapSize;
 
-        if (!RemoveRWBlock(m_cachedMapping->baseRW, &unmapAddress, &unmapSize))
-        {
-            g_fatalErrorHandler(COR_E_EXECUTIONENGINE, W("The RW block to unmap was not found"));
-        }
-        if (unmapAddress && !VMToOSInterface::ReleaseRWMapping(unmapAddress, unmapSize))
+    if (m_cachedMappings[index] != pBlock)
+    {
+        // The block is not cached, evict the least recently used mapping if the cache is full
+        if (m_cachedMappings[index] != NULL)
         {
-            g_fatalErrorHandler(COR_E_EXECUTIONENGINE, W("Releasing the RW mapping failed"));
+            ReleaseCachedMapping(m_cachedMappings[index]);
         }
-        m_cachedMapping = pBlock;
+
         pBlock->refCount++;
     }
+
+    for (; index > 0; index--)
+    {
+        m_cachedMappings[index] = m_cachedMappings[index - 1];
+    }
+    m_cachedMappings[0] = pBlock;
 #endif // ENABLE_CACHED_MAPPINGS
 }
 
+void ExecutableAllocator::ReleaseCachedMapping(BlockRW* pBlock)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    void* unmapAddress = NULL;
+    size_t unmapSize;
+
+    if (!RemoveRWBlock(pBlock->baseRW, &unmapAddress, &unmapSize))
+    {
+        g_fatalErrorHandler(COR_E_EXECUTIONENGINE, W("The RW block to unmap was not found"));
+    }
+    if (unmapAddress && !VMToOSInterface::ReleaseRWMapping(unmapAddress, unmapSize))
+    {
+        g_fatalErrorHandler(COR_E_EXECUTIONENGINE, W("Releasing the RW mapping failed"));
+    }
+}
+
 void* ExecutableAllocator::FindRWBlock(void* baseRX, size_t size)
 {
     LIMITED_METHOD_CONTRACT;
@@ -453,6 +471,25 @@ void ExecutableAllocator::Release(void* pRX)
 
         if (pBlock != NULL)
         {
+            // Cached RW mappings of the block would otherwise be found for RX memory reserved at the same address later
+            int cachedCount = 0;
+            for (int i = 0; i < CachedMappingCount && m_cachedMappings[i] != NULL; i++)
+            {
+                BlockRW* pCachedBlock = m_cachedMappings[i];
+                if (pCachedBlock->baseRX >= pBlock->baseRX && (size_t)pCachedBlock->baseRX < (size_t)pBlock->baseRX + pBlock->size)
+                {
+                    ReleaseCachedMapping(pCachedBlock);
+                }
+                else
+                {
+                    m_cachedMappings[cachedCount++] = pCachedBlock;
+                }
+            }
+            for (int i = cachedCount; i < CachedMappingCount; i++)
+            {
+                m_cachedMappings[i] = NULL;
+            }
+
             if (!VMToOSInterface::ReleaseDoubleMappedMemory(m_doubleMemoryMapperHandle, pRX, pBlock->offset, pBlock->size))
             {
                 g_fatalErrorHandler(COR_E_EXECUTIONENGINE, W("Releasing the double mapped memory failed"));
@@ -474,6 +511,14 @@ void ExecutableAllocator::Release(void* pRX)
     }
 }
 
+void ExecutableAllocator::AdviseHugePages(void* pRX, size_t size)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    // With double mapping, only the RX mapping is advised. The RW mappings are short lived and are not executed from.
+    VMToOSInterface::AdviseHugePages(pRX, size);
+}
+
 // Find a free block with the size == the requested size.
 // Returns NULL if no such block exists.
 ExecutableAllocator::BlockRX* ExecutableAllocator::FindBestFreeBlock(size_t size)
@@ -782,9 +827,9 @@ void* ExecutableAllocator::MapRW(void* pRX, size_t size)
         // Offset of the RX address in the originally allocated block
         size_t offset = (size_t)pRX - (size_t)pBlock->baseRX;
         // Offset of the RX address that will start the newly mapped block
-        size_t mapOffset = ALIGN_DOWN(offset, Granularity());
-        // Size of the block we will map
-        size_t mapSize = ALIGN_UP(offset - mapOffset + size, Granularity());
+        size_t mapOffset = ALIGN_DOWN(offset, RWMappingWindowSize);
+        // Size of the block we will map, the block size is a multiple of the granularity
+        size_t mapSize = min(ALIGN_UP(offset + size, RWMappingWindowSize), pBlock->size) - mapOffset;
 
 #ifdef LOG_EXECUTABLE_ALLOCATOR_STATISTICS
         StopWatch sw2(&g_mapCreateTimeSum);
@@ -952,6 +952,9 @@ UnlockedLoaderHeap::UnlockedLoaderHeap(DWORD dwReserveBlockSize,
     m_pEndReservedRegion         = NULL;
     m_pAllocPtr                  = NULL;
 
+    m_pColdAllocPtr              = NULL;
+    m_pEndColdRegion             = NULL;
+
     m_pRangeList                 = pRangeList;
 
     // Round to VIRTUAL_ALLOC_RESERVE_GRANULARITY
@@ -1908,6 +1911,74 @@ void *UnlockedLoaderHeap::UnlockedAllocMemForCode_NoThrow(size_t dwHeaderSize, s
     RETURN pResult;
 }
 
+// Cold code is allocated from the top of the reserved region down, so that it stays out of the pages
+// holding the hot code that is allocated from the bottom up. Whole pages that the hot allocations have
+// not committed yet are taken off the end of the reserved region, which is what keeps the two apart:
+// GetMoreCommittedPages never commits past m_pEndReservedRegion. Whatever is left of the previous cold
+// chunk when a new one is needed is wasted.
+void *UnlockedLoaderHeap::UnlockedAllocMemForColdCode_NoThrow(size_t dwHeaderSize, size_t dwCodeSize, DWORD dwCodeAlignment)
+{
+    CONTRACT(void*)
+    {
+        INSTANCE_CHECK;
+        NOTHROW;
+        INJECT_FAULT(CONTRACT_RETURN NULL;);
+        PRECONDITION(0 == (dwCodeAlignment & (dwCodeAlignment - 1))); // require power of 2
+        POSTCONDITION(CheckPointer(RETVAL, NULL_OK));
+    }
+    CONTRACT_END;
+
+    _ASSERTE(m_fExplicitControl);
+    _ASSERTE(!IsInterleaved());
+
+    INCONTRACT(_ASSERTE(!ARE_FAULTS_FORBIDDEN()));
+
+    S_SIZE_T cbAllocSize = S_SIZE_T(dwHeaderSize) + S_SIZE_T(dwCodeSize) + S_SIZE_T(dwCodeAlignment - 1);
+    if( cbAllocSize.IsOverflow() )
+    {
+        RETURN NULL;
+    }
+
+    if (cbAllocSize.Value() > (size_t)(m_pEndColdRegion - m_pColdAllocPtr))
+    {
+        // The reserved region has not been set up yet
+        if (m_pEndReservedRegion == NULL)
+        {
+            RETURN NULL;
+        }
+
+        size_t dwSizeToCommit = ALIGN_UP(cbAllocSize.Value(), GetOsPageSize());
+        if (dwSizeToCommit > (size_t)(m_pEndReservedRegion - m_pPtrToEndOfCommittedRegion))
+        {
+            RETURN NULL;
+        }
+
+        BYTE *pColdRegion = (BYTE *)ALIGN_DOWN((SIZE_T)m_pEndReservedRegion - dwSizeToCommit, GetOsPageSize());
+        if (pColdRegion < m_pPtrToEndOfCommittedRegion)
+        {
+            RETURN NULL;
+        }
+
+        if (!CommitPages(pColdRegion, dwSizeToCommit))
+        {
+            RETURN NULL;
+        }
+
+        INDEBUG(m_dwDebugWastedBytes += (size_t)(m_pEndColdRegion - m_pColdAllocPtr);)
+
+        m_pEndReservedRegion = pColdRegion;
+        m_pColdAllocPtr = pColdRegion;
+        m_pEndColdRegion = pColdRegion + dwSizeToCommit;
+        m_dwTotalAlloc += dwSizeToCommit;
+    }
+
+    BYTE *pResult = (BYTE *)ALIGN_UP(m_pColdAllocPtr + dwHeaderSize, dwCodeAlignment);
+    EtwAllocRequest(this, pResult, (pResult + dwCodeSize) - m_pColdAllocPtr);
+    m_pColdAllocPtr = pResult + dwCodeSize;
+
+    RETURN pResult;
+}
+
 
 #endif // #ifndef DACCESS_COMPILE
 
@@ -448,6 +448,19 @@ ThreadStressLog* StressLog::CreateThreadStressLog() {
         return NULL;
     }
 
+#ifdef MEMORY_MAPPED_STRESSLOG
+    // Allocating from the memory mapped file doesn't take a lock, so unless there is a dead
+    // thread's log to recycle (which has to be serialized), don't take the lock either.
+    if (StressLogChunk::s_memoryMapped && theLog.deadCount == 0)
+    {
+        if (theLog.facilitiesToLog == 0)
+        {
+            return NULL;
+        }
+        return CreateThreadStressLogHelper(FALSE);
+    }
+#endif //MEMORY_MAPPED_STRESSLOG
+
     StressLogLockHolder lockh(theLog.lock, FALSE);
 
     class NestedCaller
@@ -492,12 +505,13 @@ ThreadStressLog* StressLog::CreateThreadStressLog() {
     PAL_CPP_ENDTRY;
 
     if (noFLSNow == FALSE && theLog.facilitiesToLog != 0)
-        msgs = CreateThreadStressLogHelper();
+        msgs = CreateThreadStressLogHelper(TRUE);
 
     return msgs;
 }
 
-ThreadStressLog* StressLog::CreateThreadStressLogHelper() {
+// fRecycleDeadLogs must only be set while holding the lock
+ThreadStressLog* StressLog::CreateThreadStressLogHelper(BOOL fRecycleDeadLogs) {
     CONTRACTL
     {
         NOTHROW;
@@ -511,7 +525,7 @@ ThreadStressLog* StressLog::CreateThreadStressLogHelper() {
     ThreadStressLog* msgs = NULL;
 
     // See if we can recycle a dead thread
-    if (theLog.deadCount > 0)
+    if (fRecycleDeadLogs && theLog.deadCount > 0)
     {
         unsigned __int64 recycleStamp = getTimeStamp() - RECYCLE_AGE;
         msgs = theLog.logs;
@@ -603,12 +617,30 @@ ThreadStressLog* StressLog::CreateThreadStressLogHelper() {
             walk = walk->next;
         }
 #endif
-        // Put it into the stress log
-        msgs->next = theLog.logs;
-        theLog.logs = msgs;
+        // Put it into the stress log, racing with threads that create their log without the lock
+        ThreadStressLog* head;
+        do
+        {
+            head = theLog.logs;
+            msgs->next = head;
+        }
+        while (InterlockedCompareExchangeT(&theLog.logs, msgs, head) != head);
 #ifdef MEMORY_MAPPED_STRESSLOG
         if (theLog.stressLogHeader != nullptr)
-        theLog.stressLogHeader->logs = msgs;
+        {
+            // Publish the newest head for readers of the file; a thread that read an older head
+            // fails its exchange against the one published after it.
+            while (true)
+            {
+                ThreadStressLog* published = theLog.stressLogHeader->logs;
+                head = theLog.logs;
+                if (published == head ||
+                    InterlockedCompareExchangeT(&theLog.stressLogHeader->logs, head, published) == published)
+                {
+                    break;
+                }
+            }
+        }
 #endif // MEMORY_MAPPED_STRESSLOG
     }
 
@@ -15,3 +15,6 @@ unsigned int YieldProcessorNormalization::s_optimalMaxNormalizedYieldsPerSpinIte
         YieldProcessorNormalization::TargetNsPerNormalizedYield +
         0.5
     );
+
+bool YieldProcessorNormalization::s_hasPerProcessorNormalization;
+UINT32 YieldProcessorNormalization::s_perProcessorNormalization[YieldProcessorNormalization::MaxPerProcessorNormalizationCount];
@@ -50,6 +50,7 @@ EXTERN_C void FastCallFinalizeWorker(Object *obj, PCODE funcPtr);
 
 // Also in CorCompile.h, FnTableAccess.h
 #define USE_INDIRECT_CODEHEADER                 // use CodeHeader, RealCodeHeader construct
+#define FEATURE_JIT_HOT_COLD_SPLITTING          // jitted code can be split into hot and cold parts, see EEJitManager::allocCode
 
 #define HAS_NDIRECT_IMPORT_PRECODE              1
 #define HAS_FIXUP_PRECODE                       1
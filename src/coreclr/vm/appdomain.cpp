@@ -4560,6 +4560,16 @@ void SystemDomain::ProcessDelayedUnloadLoaderAllocators()
         }
     }
 
+    if (pAllocatorsToDelete == NULL)
+    {
+        return;
+    }
+
+    LARGE_INTEGER li;
+    QueryPerformanceCounter(&li);
+    UINT64 startTicks = li.QuadPart;
+    UINT32 deletedCount = 0;
+
     // Delete collected loader allocators on the finalizer thread. We cannot offload it to appdomain unload thread because of
     // there is not guaranteed to be one, and it is not that expensive operation anyway.
     while (pAllocatorsToDelete != NULL)
@@ -4567,7 +4577,13 @@ void SystemDomain::ProcessDelayedUnloadLoaderAllocators()
         LoaderAllocator * pAllocator = pAllocatorsToDelete;
         pAllocatorsToDelete = pAllocator->m_pLoaderAllocatorDestroyNext;
         delete pAllocator;
+        deletedCount++;
     }
+
+    QueryPerformanceCounter(&li);
+    UINT64 endTicks = li.QuadPart;
+    QueryPerformanceFrequency(&li);
+    ETW::LoaderLog::CollectibleLoaderAllocatorsFreed(deletedCount, (endTicks - startTicks) * 1000000 / li.QuadPart);
 }
 
 
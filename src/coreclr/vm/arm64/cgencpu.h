@@ -39,6 +39,7 @@ extern PCODE GetPreStubEntryPoint();
 #define HAS_NDIRECT_IMPORT_PRECODE              1
 
 #define USE_INDIRECT_CODEHEADER
+#define FEATURE_JIT_HOT_COLD_SPLITTING
 
 #define HAS_FIXUP_PRECODE                       1
 
@@ -582,6 +582,13 @@ bool CallCountingManager::SetCodeEntryPoint(
         return true;
     }
 
+    if (g_pConfig->TieredCompilation_SamplingTierUp())
+    {
+        // Calls are not counted, the tiering sampler promotes the method once it is seen often enough in stack samples
+        methodDesc->SetCodeEntryPoint(codeEntryPoint);
+        return true;
+    }
+
     const CallCountingStub *callCountingStub;
     CallCountingManager *callCountingManager = methodDesc->GetLoaderAllocator()->GetCallCountingManager();
     CallCountingInfoByCodeVersionHash &callCountingInfoByCodeVersionHash =
@@ -12,6 +12,68 @@
 BASEARRAYREF* CastCache::s_pTableRef = NULL;
 OBJECTHANDLE CastCache::s_sentinelTable = NULL;
 DWORD CastCache::s_lastFlushSize     = INITIAL_CACHE_SIZE;
+DWORD CastCache::s_flushEpoch        = 0;
+
+// The per-thread L0 cache in front of the shared table, see castcache.h
+//
+// L0_CACHE_SIZE must be a power of two. 16 entries hold the working set of typical polymorphic
+// cast sites and keep the cache within a few cache lines.
+static const DWORD L0_CACHE_SIZE = 16;
+
+// The miss rate is measured over windows of this many lookups in the shared table, decayed by halving.
+static const DWORD MISS_RATE_WINDOW = 1024;
+
+struct CastCacheL0
+{
+    struct Entry
+    {
+        TADDR source;
+        // as in the shared table, the lowest bit of the target holds the result
+        TADDR targetAndResult;
+    };
+
+    Entry entries[L0_CACHE_SIZE];
+    DWORD epoch;
+
+    // lookups in the shared table made by this thread, and how many of them missed
+    DWORD lookups;
+    DWORD misses;
+};
+
+static thread_local CastCacheL0 t_castCacheL0;
+
+static FORCEINLINE DWORD L0Index(TADDR source, TADDR target)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    // the lower bits of type handles are mostly alignment, fold in higher bits of both.
+    TADDR hash = (source >> 4) ^ (target >> 3) ^ (source >> 11);
+    return (DWORD)hash & (L0_CACHE_SIZE - 1);
+}
+
+static FORCEINLINE CastCacheL0* GetL0Cache(DWORD flushEpoch)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    CastCacheL0* pL0 = &t_castCacheL0;
+    if (pL0->epoch != flushEpoch)
+    {
+        // the shared table was flushed since this thread last used its L0 cache.
+        memset(pL0->entries, 0, sizeof(pL0->entries));
+        pL0->epoch = flushEpoch;
+    }
+
+    return pL0;
+}
+
+static FORCEINLINE void SetL0Entry(CastCacheL0* pL0, TADDR source, TADDR target, BOOL result)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    CastCacheL0::Entry* pEntry = &pL0->entries[L0Index(source, target)];
+    pEntry->source = source;
+    pEntry->targetAndResult = target | (result & 1);
+}
 
 BASEARRAYREF CastCache::CreateCastCache(DWORD size)
 {
@@ -112,6 +174,47 @@ void CastCache::FlushCurrentCache()
     s_lastFlushSize = max(INITIAL_CACHE_SIZE, CacheElementCount(tableData));
 
     SetObjectReference((OBJECTREF *)s_pTableRef, ObjectFromHandle(s_sentinelTable));
+
+    // invalidate the L0 caches of all threads
+    InterlockedIncrement((LONG*)&s_flushEpoch);
+}
+
+bool CastCache::TryGrow(DWORD* tableData)
+{
+    CONTRACTL
+    {
+        THROWS;
+        GC_TRIGGERS;
+        MODE_COOPERATIVE;
+    }
+    CONTRACTL_END;
+
+    DWORD size = CacheElementCount(tableData);
+    if (size >= MAXIMUM_CACHE_SIZE)
+    {
+        return false;
+    }
+
+    // A new table starts out empty, so every core will miss until it refills. When this thread finds the current
+    // table good enough (under 1/64 of its lookups miss), evict an entry from the full bucket instead. When a quarter
+    // or more of its lookups miss, the working set is clearly much larger than the table, so skip a step.
+    CastCacheL0* pL0 = &t_castCacheL0;
+    DWORD growthFactor = 2;
+    if (pL0->lookups >= MISS_RATE_WINDOW / 2)
+    {
+        if (pL0->misses * 64 < pL0->lookups)
+        {
+            return false;
+        }
+
+        if (pL0->misses * 4 >= pL0->lookups)
+        {
+            growthFactor = 4;
+        }
+    }
+
+    DWORD newSize = min(size * growthFactor, MAXIMUM_CACHE_SIZE);
+    return MaybeReplaceCacheWithLarger(newSize);
 }
 
 void CastCache::Initialize()
@@ -152,6 +255,24 @@ TypeHandle::CastResult CastCache::TryGet(TADDR source, TADDR target)
     }
     CONTRACTL_END;
 
+    CastCacheL0* pL0 = GetL0Cache(VolatileLoadWithoutBarrier(&s_flushEpoch));
+    CastCacheL0::Entry* pL0Entry = &pL0->entries[L0Index(source, target)];
+    if (pL0Entry->source == source)
+    {
+        // see the same check on the shared table below.
+        TADDR entryTargetAndResult = pL0Entry->targetAndResult ^ target;
+        if (entryTargetAndResult <= 1)
+        {
+            return TypeHandle::CastResult(entryTargetAndResult);
+        }
+    }
+
+    if (++pL0->lookups >= MISS_RATE_WINDOW)
+    {
+        pL0->lookups /= 2;
+        pL0->misses /= 2;
+    }
+
     DWORD* tableData = TableData(*s_pTableRef);
 
     DWORD index = KeyToBucket(tableData, source, target);
@@ -186,6 +307,7 @@ TypeHandle::CastResult CastCache::TryGet(TADDR source, TADDR target)
                     break;
                 }
 
+                SetL0Entry(pL0, source, target, (BOOL)entryTargetAndResult);
                 return TypeHandle::CastResult(entryTargetAndResult);
             }
         }
@@ -201,6 +323,7 @@ TypeHandle::CastResult CastCache::TryGet(TADDR source, TADDR target)
         index = (index + i) & TableMask(tableData);
     }
 
+    pL0->misses++;
     return TypeHandle::MaybeCast;
 }
 
@@ -214,6 +337,9 @@ void CastCache::TrySet(TADDR source, TADDR target, BOOL result)
     }
     CONTRACTL_END;
 
+    // the result was just computed on this thread, so it is likely to be asked for again here.
+    SetL0Entry(GetL0Cache(VolatileLoadWithoutBarrier(&s_flushEpoch)), source, target, result);
+
     DWORD bucket;
     DWORD* tableData;
 
@@ -45,6 +45,16 @@
 // Whenever we need to replace or resize the table, we simply allocate a new one and atomically
 // update the static handle. The old table may be still in use, but will eventually be collected by GC.
 //
+// In front of the shared table every thread has a tiny direct-mapped cache (L0) of the results it
+// looked up or computed recently. Polymorphic cast-heavy code tends to repeat a handful of casts per
+// thread, which are then answered without touching the cache lines of the shared table that other
+// cores keep writing to. The L0 caches are invalidated lazily: flushing bumps an epoch, and a thread
+// clears its L0 cache when it notices that the epoch changed.
+//
+// Since a resize starts over with an empty table, it causes a burst of misses on every core. Each thread
+// therefore tracks how often its lookups miss the shared table, and a full bucket only grows the table
+// when misses are frequent enough to be worth it (and grows it faster when they are very frequent).
+//
 class CastCache
 {
 #if !defined(DACCESS_COMPILE)
@@ -206,6 +216,9 @@ private:
 
     static DWORD          s_lastFlushSize;
 
+    // incremented on every flush, L0 caches filled under an older epoch are stale.
+    static DWORD          s_flushEpoch;
+
     FORCEINLINE static TypeHandle::CastResult TryGetFromCache(TADDR source, TADDR target)
     {
         CONTRACTL
@@ -240,24 +253,7 @@ private:
         TrySet(source, target, result);
     }
 
-    FORCEINLINE static bool TryGrow(DWORD* tableData)
-    {
-        CONTRACTL
-        {
-            THROWS;
-            GC_TRIGGERS;
-            MODE_COOPERATIVE;
-        }
-        CONTRACTL_END;
-
-        DWORD newSize = CacheElementCount(tableData) * 2;
-        if (newSize <= MAXIMUM_CACHE_SIZE)
-        {
-            return MaybeReplaceCacheWithLarger(newSize);
-        }
-
-        return false;
-    }
+    static bool TryGrow(DWORD* tableData);
 
     FORCEINLINE static DWORD KeyToBucket(DWORD* tableData, TADDR source, TADDR target)
     {
@@ -142,6 +142,7 @@
 #include "debugdebugger.h"
 #include "cordbpriv.h"
 #include "comdelegate.h"
+#include "reflectioninvocation.h"
 #include "appdomain.hpp"
 #include "eventtrace.h"
 #include "corhost.h"
@@ -174,6 +175,9 @@
 #include "stacksampler.h"
 #endif
 
+#include "tieringsampler.h"
+#include "readytorunfixupresolver.h"
+
 #ifdef FEATURE_COMINTEROP
 #include "runtimecallablewrapper.h"
 #include "mngstdinterfaces.h"
@@ -253,6 +257,79 @@ static CLREvent * g_pEEShutDownEvent;
 
 static DangerousNonHostedSpinLock g_EEStartupLock;
 
+// #StartupTimeline
+//
+// EEStartupHelper marks the end of each of its phases with MarkStartupPhase(). When StartupTimelineFile is set, the
+// marks are written to that file once startup completes or fails, one line per phase with the time at which the
+// phase ended and its duration in microseconds, relative to the start of EEStartupHelper. The marks are recorded
+// unconditionally, they cost a few high-resolution timer reads, so that the file can be written without knowing
+// ahead of time whether configuration is available.
+
+struct StartupPhaseMark
+{
+    const char *m_name;
+    LARGE_INTEGER m_time;
+};
+
+static const int MaxStartupPhaseMarks = 32;
+static StartupPhaseMark s_startupPhaseMarks[MaxStartupPhaseMarks];
+static int s_startupPhaseMarkCount = 0;
+static LARGE_INTEGER s_startupStartTime;
+
+static void MarkStartupPhase(const char *name)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    if (s_startupPhaseMarkCount < MaxStartupPhaseMarks)
+    {
+        StartupPhaseMark *pMark = &s_startupPhaseMarks[s_startupPhaseMarkCount++];
+        pMark->m_name = name;
+        QueryPerformanceCounter(&pMark->m_time);
+    }
+}
+
+static void WriteStartupTimeline(HRESULT hr)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_ANY;
+    } CONTRACTL_END;
+
+    EX_TRY
+    {
+        NewArrayHolder<WCHAR> fileName(CLRConfig::GetConfigValue(CLRConfig::EXTERNAL_StartupTimelineFile));
+        LARGE_INTEGER frequency;
+        if (fileName != NULL && QueryPerformanceFrequency(&frequency) && frequency.QuadPart != 0)
+        {
+            FILE *timelineFile = _wfopen(fileName, W("w"));
+            if (timelineFile != NULL)
+            {
+                fprintf(timelineFile, "phase,end_us,duration_us\n");
+
+                LONGLONG previousTime = s_startupStartTime.QuadPart;
+                for (int i = 0; i < s_startupPhaseMarkCount; i++)
+                {
+                    const StartupPhaseMark &mark = s_startupPhaseMarks[i];
+                    fprintf(timelineFile, "%s,%lld,%lld\n",
+                        mark.m_name,
+                        (long long)((mark.m_time.QuadPart - s_startupStartTime.QuadPart) * 1000000 / frequency.QuadPart),
+                        (long long)((mark.m_time.QuadPart - previousTime) * 1000000 / frequency.QuadPart));
+                    previousTime = mark.m_time.QuadPart;
+                }
+
+                fprintf(timelineFile, "status,0x%08x,\n", (unsigned int)hr);
+                fclose(timelineFile);
+            }
+        }
+    }
+    EX_CATCH
+    {
+    }
+    EX_END_CATCH(SwallowAllExceptions);
+}
+
 // ---------------------------------------------------------------------------
 // %%Function: EnsureEEStarted()
 //
@@ -587,6 +664,9 @@ void EEStartupHelper()
 
     HRESULT hr = S_OK;
     static ConfigDWORD breakOnEELoad;
+
+    QueryPerformanceCounter(&s_startupStartTime);
+
     EX_TRY
     {
         g_fEEInit = true;
@@ -628,6 +708,8 @@ void EEStartupHelper()
         // This needs to be done before the EE has started
         InitializeStartupFlags();
 
+        MarkStartupPhase("Config");
+
         IfFailGo(ExecutableAllocator::StaticInitialize(FatalErrorHandler));
 
         Thread::StaticInitialize();
@@ -655,6 +737,8 @@ void EEStartupHelper()
         InitThreadManager();
         STRESS_LOG0(LF_STARTUP, LL_ALWAYS, "Returned successfully from InitThreadManager");
 
+        MarkStartupPhase("ThreadManager");
+
 #ifdef FEATURE_PERFTRACING
         // Initialize the event pipe.
         EventPipeAdapter::Initialize();
@@ -694,6 +778,8 @@ void EEStartupHelper()
         ETWFireEvent(EEStartupStart_V1);
 #endif // FEATURE_EVENT_TRACE
 
+        MarkStartupPhase("Diagnostics");
+
         InitGSCookie();
 
         Frame::Init();
@@ -775,6 +861,8 @@ void EEStartupHelper()
 
         CoreLibBinder::Startup();
 
+        MarkStartupPhase("Binder");
+
         Stub::Init();
         StubLinkerCPU::Init();
         StubPrecode::StaticInitialize();
@@ -782,6 +870,8 @@ void EEStartupHelper()
 
         InitializeGarbageCollector();
 
+        MarkStartupPhase("GCInit");
+
         if (!GCHandleUtilities::GetGCHandleManager()->Initialize())
         {
             IfFailGo(E_OUTOFMEMORY);
@@ -804,6 +894,8 @@ void EEStartupHelper()
 
         COMDelegate::Init();
 
+        ReflectionInvokeStubs::Init();
+
         ExecutionManager::Init();
 
         JitHost::Init();
@@ -852,6 +944,8 @@ void EEStartupHelper()
         }
 #endif
 
+        MarkStartupPhase("ExecutionEngine");
+
         InitPreStubManager();
 
 #ifdef FEATURE_COMINTEROP
@@ -865,12 +959,15 @@ void EEStartupHelper()
         InitJITHelpers1();
         InitJITHelpers2();
 
+        ThreadStatics::Init();
+
         SyncBlockCache::Attach();
 
         // Set up the sync block
         SyncBlockCache::Start();
 
         StackwalkCache::Init();
+        CodeInfoCache::Init();
 
         // This isn't done as part of InitializeGarbageCollector() above because it
         // requires write barriers to have been set up on x86, which happens as part
@@ -878,6 +975,8 @@ void EEStartupHelper()
         hr = g_pGCHeap->Initialize();
         IfFailGo(hr);
 
+        MarkStartupPhase("GCHeap");
+
 #ifdef FEATURE_PERFTRACING
         // Finish setting up rest of EventPipe - specifically enable SampleProfiler if it was requested at startup.
         // SampleProfiler needs to cooperate with the GC which hasn't fully finished setting up in the first part of the
@@ -912,6 +1011,8 @@ void EEStartupHelper()
 
         SystemDomain::System()->Init();
 
+        MarkStartupPhase("SystemDomain");
+
 #ifdef PROFILING_SUPPORTED
         // <TODO>This is to compensate for the DefaultDomain workaround contained in
         // SystemDomain::Attach in which the first user domain is created before profiling
@@ -927,10 +1028,20 @@ void EEStartupHelper()
 
         SystemDomain::System()->DefaultDomain()->SetupSharedStatics();
 
+        MarkStartupPhase("SystemAssemblies");
+
 #ifdef FEATURE_STACK_SAMPLING
         StackSampler::Init();
 #endif
 
+#ifdef FEATURE_TIERED_COMPILATION
+        TieringSampler::Init();
+#endif
+
+#ifdef FEATURE_READYTORUN
+        ReadyToRunFixupResolver::Init();
+#endif
+
         // Perform any once-only SafeHandle initialization.
         SafeHandle::Init();
 
@@ -948,6 +1059,8 @@ void EEStartupHelper()
 #endif // FEATURE_MINIMETADATA_IN_TRIAGEDUMPS
 
 
+        MarkStartupPhase("Services");
+
         g_fEEStarted = TRUE;
         g_EEStartupStatus = S_OK;
         hr = S_OK;
@@ -991,6 +1104,8 @@ ErrExit: ;
         g_EEStartupStatus = hr;
     }
 
+    WriteStartupTimeline(g_EEStartupStatus);
+
     if (breakOnEELoad.val(CLRConfig::UNSUPPORTED_BreakOnEELoad) == 2)
     {
 #ifdef _DEBUG
@@ -1944,7 +1944,10 @@ ClassLoader::~ClassLoader()
 
     FreeModules();
 
-    m_UnresolvedClassLock.Destroy();
+    for (DWORD i = 0; i < UNRESOLVED_CLASS_LOCK_COUNT; i++)
+    {
+        m_UnresolvedClassLocks[i].Destroy();
+    }
     m_AvailableClassLock.Destroy();
     m_AvailableTypesLock.Destroy();
 }
@@ -2004,7 +2007,12 @@ VOID ClassLoader::Init(AllocMemTracker *pamTracker)
                                                           UNRESOLVED_CLASS_HASH_BUCKETS,
                                                           pamTracker);
 
-    m_UnresolvedClassLock.Init(CrstUnresolvedClassLock);
+    // The locks are never held together, a thread only takes the one protecting the type it is loading and releases it before
+    // loading other types
+    for (DWORD i = 0; i < UNRESOLVED_CLASS_LOCK_COUNT; i++)
+    {
+        m_UnresolvedClassLocks[i].Init(CrstUnresolvedClassLock);
+    }
 
     // This lock is taken within the classloader whenever we have to enter a
     // type in one of the modules governed by the loader.
@@ -3057,10 +3065,15 @@ TypeHandle ClassLoader::PublishType(TypeKey *pTypeKey, TypeHandle typeHnd)
         Module *pLoaderModule = ComputeLoaderModule(pTypeKey);
         EETypeHashTable *pTable = pLoaderModule->GetAvailableParamTypes();
 
+        // The type could have been loaded by a different thread as side-effect of avoiding deadlocks caused by LoadsTypeViolation.
+        // Lookups are lock-free, so check before taking the lock and again under it.
+        TypeHandle existing = pTable->GetValue(pTypeKey);
+        if (!existing.IsNull())
+            return existing;
+
         CrstHolder ch(&pLoaderModule->GetClassLoader()->m_AvailableTypesLock);
 
-        // The type could have been loaded by a different thread as side-effect of avoiding deadlocks caused by LoadsTypeViolation
-        TypeHandle existing = pTable->GetValue(pTypeKey);
+        existing = pTable->GetValue(pTypeKey);
         if (!existing.IsNull())
             return existing;
 
@@ -3262,8 +3275,11 @@ TypeHandle ClassLoader::LoadTypeHandleForTypeKey(TypeKey *pTypeKey,
         SString name;
         TypeString::AppendTypeKeyDebug(name, pTypeKey);
         LOG((LF_CLASSLOADER, LL_INFO10000, "PHASEDLOAD: LoadTypeHandleForTypeKey for type %S to level %s\n", name.GetUnicode(), classLoadLevelName[targetLevel]));
-        CrstHolder unresolvedClassLockHolder(&m_UnresolvedClassLock);
-        m_pUnresolvedClassHash->Dump();
+        for (DWORD i = 0; i < UNRESOLVED_CLASS_LOCK_COUNT; i++)
+        {
+            CrstHolder unresolvedClassLockHolder(&m_UnresolvedClassLocks[i]);
+            m_pUnresolvedClassHash->Dump(i, UNRESOLVED_CLASS_LOCK_COUNT);
+        }
     }
 #endif
 
@@ -3330,6 +3346,17 @@ TypeHandle ClassLoader::LoadTypeHandleForTypeKeyNoLock(TypeKey *pTypeKey,
     return typeHnd;
 }
 
+//---------------------------------------------------------------------------------------
+//
+CrstBase *ClassLoader::GetUnresolvedClassLock(TypeKey *pTypeKey)
+{
+    WRAPPER_NO_CONTRACT;
+
+    // Each bucket maps to a single lock since the bucket count is a multiple of the lock count
+    DWORD dwBucket = HashTypeKey(pTypeKey) % UNRESOLVED_CLASS_HASH_BUCKETS;
+    return &m_UnresolvedClassLocks[dwBucket % UNRESOLVED_CLASS_LOCK_COUNT];
+}
+
 //---------------------------------------------------------------------------------------
 //
 class PendingTypeLoadHolder
@@ -3412,7 +3439,7 @@ ClassLoader::LoadTypeHandleForTypeKey_Body(
     }
 
     ReleaseHolder<PendingTypeLoadEntry> pLoadingEntry;
-    CrstHolderWithState unresolvedClassLockHolder(&m_UnresolvedClassLock, false);
+    CrstHolderWithState unresolvedClassLockHolder(GetUnresolvedClassLock(pTypeKey), false);
 
 retry:
     unresolvedClassLockHolder.Acquire();
@@ -3464,10 +3491,20 @@ retry:
         }
 
         {
-            // Wait for class to be loaded by another thread.  This is where we start tracking the
-            // entry, so there is an implicit Acquire in our use of Assign here.
-            CrstHolder loadingEntryLockHolder(&pLoadingEntry->m_Crst);
-            _ASSERTE(pLoadingEntry->HasLock());
+#if defined(FEATURE_EVENT_TRACE)
+            UINT64 waitStart = ETW::TypeSystemLog::TypeLoadWaitBegin();
+#endif
+
+            {
+                // Wait for class to be loaded by another thread.  This is where we start tracking the
+                // entry, so there is an implicit Acquire in our use of Assign here.
+                CrstHolder loadingEntryLockHolder(&pLoadingEntry->m_Crst);
+                _ASSERTE(pLoadingEntry->HasLock());
+            }
+
+#if defined(FEATURE_EVENT_TRACE)
+            ETW::TypeSystemLog::TypeLoadWaitEnd(waitStart, pTypeKey, pLoadingEntry->m_typeHandle, (UINT16)targetLevel);
+#endif
         }
 
         // Result of other thread loading the class
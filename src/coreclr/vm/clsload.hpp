@@ -41,6 +41,11 @@ class SigPointer;
 // Hash table parameter for unresolved class hash
 #define UNRESOLVED_CLASS_HASH_BUCKETS 8
 
+// Number of locks protecting the unresolved class hash. A bucket is protected by the lock whose index is the bucket's index
+// modulo the lock count, so that loads of unrelated types do not serialize on a single lock.
+#define UNRESOLVED_CLASS_LOCK_COUNT 4
+static_assert_no_msg(UNRESOLVED_CLASS_HASH_BUCKETS % UNRESOLVED_CLASS_LOCK_COUNT == 0);
+
 // This is information required to look up a type in the loader. Besides the
 // basic name there is the meta data information for the type, whether the
 // the name is case sensitive, and tokens not to load. This last item allows
@@ -494,7 +499,7 @@ class ClassLoader
 private:
     // Classes for which load is in progress
     PendingTypeLoadTable  * m_pUnresolvedClassHash;
-    CrstExplicitInit        m_UnresolvedClassLock;
+    CrstExplicitInit        m_UnresolvedClassLocks[UNRESOLVED_CLASS_LOCK_COUNT];
 
     // Protects addition of elements to module's m_pAvailableClasses.
     // (indeed thus protects addition of elements to any m_pAvailableClasses in any
@@ -1039,6 +1044,9 @@ private:
     TypeHandle LoadTypeHandleForTypeKey_Body(TypeKey *pTypeKey,
                                              TypeHandle typeHnd,
                                              ClassLoadLevel targetLevel);
+
+    // Returns the lock protecting the bucket of m_pUnresolvedClassHash that the type key hashes to
+    CrstBase *GetUnresolvedClassLock(TypeKey *pTypeKey);
 #endif //!DACCESS_COMPILE
 
 };  // class ClassLoader
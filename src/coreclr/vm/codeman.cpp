@@ -616,6 +616,12 @@ BOOL EEJitManager::CodeHeapIterator::Next()
             CodeHeader * pHdr = (CodeHeader *)(code - sizeof(CodeHeader));
             m_pCurrent = !pHdr->IsStubCodeBlock() ? pHdr->GetMethodDesc() : NULL;
 
+#ifdef FEATURE_JIT_HOT_COLD_SPLITTING
+            // The cold part of a split method is reported with its hot part
+            if (m_pCurrent && pHdr->IsColdCode())
+                continue;
+#endif
+
             // LoaderAllocator filter
             if (m_pLoaderAllocator && m_pCurrent)
             {
@@ -2463,7 +2469,8 @@ void CodeFragmentHeap::RealBackoutMem(void *pMem
 LoaderCodeHeap::LoaderCodeHeap()
     : m_LoaderHeap(NULL,                    // RangeList *pRangeList
                    TRUE),                   // BOOL fMakeExecutable
-    m_cbMinNextPad(0)
+    m_cbMinNextPad(0),
+    m_cbMinNextColdPad(0)
 {
     WRAPPER_NO_CONTRACT;
 }
@@ -2665,7 +2672,11 @@ HeapList* LoaderCodeHeap::CreateCodeHeap(CodeHeapRequestInfo *pInfo, LoaderHeap
 #if defined(TARGET_AMD64) || defined(TARGET_ARM64) || defined(TARGET_LOONGARCH64)
     allocationSize += pCodeHeap->m_LoaderHeap.AllocMem_TotalSize(JUMP_ALLOCATE_SIZE);
 #endif
-    pBaseAddr = (BYTE *)pInfo->m_pAllocator->GetCodeHeapInitialBlock(loAddr, hiAddr, (DWORD)allocationSize, &dwSizeAcquiredFromInitialBlock);
+    // Hot code heaps are reserved separately so that the whole heap can be backed by huge pages
+    if (!pInfo->IsHotCode())
+    {
+        pBaseAddr = (BYTE *)pInfo->m_pAllocator->GetCodeHeapInitialBlock(loAddr, hiAddr, (DWORD)allocationSize, &dwSizeAcquiredFromInitialBlock);
+    }
     if (pBaseAddr != NULL)
     {
         pCodeHeap->m_LoaderHeap.SetReservedRegion(pBaseAddr, dwSizeAcquiredFromInitialBlock, FALSE);
@@ -2703,6 +2714,11 @@ HeapList* LoaderCodeHeap::CreateCodeHeap(CodeHeapRequestInfo *pInfo, LoaderHeap
                 ThrowOutOfMemory();
         }
         pCodeHeap->m_LoaderHeap.SetReservedRegion(pBaseAddr, reserveSize, TRUE);
+
+        if (pInfo->IsHotCode() && !fAllocatedFromEmergencyJumpStubReserve)
+        {
+            ExecutableAllocator::Instance()->AdviseHugePages(pBaseAddr, reserveSize);
+        }
     }
 
 
@@ -2727,6 +2743,10 @@ HeapList* LoaderCodeHeap::CreateCodeHeap(CodeHeapRequestInfo *pInfo, LoaderHeap
     pHp->endAddress      = pHp->startAddress;
     pHp->maxCodeHeapSize = heapSize;
     pHp->reserveForJumpStubs = fAllocatedFromEmergencyJumpStubReserve ? pHp->maxCodeHeapSize : GetDefaultReserveForJumpStubs(pHp->maxCodeHeapSize);
+    pHp->isHotCodeHeap = pInfo->IsHotCode();
+#ifdef FEATURE_JIT_HOT_COLD_SPLITTING
+    pHp->coldStartAddress = NULL;
+#endif
 
     _ASSERTE(heapSize >= initialRequestSize);
 
@@ -2770,6 +2790,25 @@ void * LoaderCodeHeap::AllocMemForCode_NoThrow(size_t header, size_t size, DWORD
     return p;
 }
 
+void * LoaderCodeHeap::AllocMemForColdCode_NoThrow(size_t header, size_t size, DWORD alignment)
+{
+    CONTRACTL {
+        NOTHROW;
+        GC_NOTRIGGER;
+    } CONTRACTL_END;
+
+    if (m_cbMinNextColdPad > (SSIZE_T)header) header = m_cbMinNextColdPad;
+
+    void * p = m_LoaderHeap.AllocMemForColdCode_NoThrow(header, size, alignment);
+    if (p == NULL)
+        return NULL;
+
+    // Same as above, the cold code has its own headers in the nibble map
+    m_cbMinNextColdPad = ALIGN_UP((SIZE_T)p + 1, BYTES_PER_BUCKET) - ((SIZE_T)p + size);
+
+    return p;
+}
+
 void CodeHeapRequestInfo::Init()
 {
     CONTRACTL {
@@ -2784,6 +2823,7 @@ void CodeHeapRequestInfo::Init()
         m_pAllocator = m_pMD->GetLoaderAllocator();
     m_isDynamicDomain = (m_pMD != NULL) && m_pMD->IsLCGMethod();
     m_isCollectible = m_pAllocator->IsCollectible();
+    m_isHotCode = false;
     m_throwOnOutOfMemoryWithinRange = true;
 }
 
@@ -2870,6 +2910,13 @@ HeapList* EEJitManager::NewCodeHeap(CodeHeapRequestInfo *pInfo, DomainCodeHeapLi
         reserveSize = minReserveSize;
     reserveSize = ALIGN_UP(reserveSize, VIRTUAL_ALLOC_RESERVE_GRANULARITY);
 
+    if (pInfo->IsHotCode())
+    {
+        // Reservations are only aligned to VIRTUAL_ALLOC_RESERVE_GRANULARITY, so reserving two huge pages makes sure that
+        // at least one huge page aligned block is in the heap
+        reserveSize = ALIGN_UP(max(reserveSize, (size_t)(2 * CODE_HEAP_HUGE_PAGE_SIZE)), CODE_HEAP_HUGE_PAGE_SIZE);
+    }
+
     pInfo->setReserveSize(reserveSize);
 
     HeapList *pHp = NULL;
@@ -3049,13 +3096,16 @@ void* EEJitManager::allocCodeRaw(CodeHeapRequestInfo *pInfo,
     RETURN(mem);
 }
 
-void EEJitManager::allocCode(MethodDesc* pMD, size_t blockSize, size_t reserveForJumpStubs, CorJitAllocMemFlag flag, CodeHeader** ppCodeHeader, CodeHeader** ppCodeHeaderRW,
+void EEJitManager::allocCode(MethodDesc* pMD, size_t blockSize, size_t reserveForJumpStubs, CorJitAllocMemFlag flag, bool isHotCode, CodeHeader** ppCodeHeader, CodeHeader** ppCodeHeaderRW,
                              size_t* pAllocatedSize, HeapList** ppCodeHeap
 #ifdef USE_INDIRECT_CODEHEADER
                            , BYTE** ppRealHeader
 #endif
 #ifdef FEATURE_EH_FUNCLETS
                            , UINT nUnwindInfos
+#endif
+#ifdef FEATURE_JIT_HOT_COLD_SPLITTING
+                           , size_t coldBlockSize, CodeHeader** ppColdCodeHeader, CodeHeader** ppColdCodeHeaderRW, size_t* pColdAllocatedSize
 #endif
                            )
 {
@@ -3106,6 +3156,23 @@ void EEJitManager::allocCode(MethodDesc* pMD, size_t blockSize, size_t reserveFo
 #endif
     requestInfo.setReserveForJumpStubs(reserveForJumpStubs);
 
+    if (isHotCode && g_pConfig->CodeHeapHugePages() && !requestInfo.IsDynamicDomain())
+    {
+        requestInfo.SetHotCode();
+    }
+
+#ifdef FEATURE_JIT_HOT_COLD_SPLITTING
+    if (coldBlockSize > 0)
+    {
+        // Dynamic methods free their code block as a whole, so they are never split
+        _ASSERTE(!requestInfo.IsDynamicDomain());
+
+        // Make sure the code heap picked for the hot part has room left for the cold part even
+        // when it cannot go to the top of the heap, see below
+        requestInfo.setReserveForJumpStubs(reserveForJumpStubs + sizeof(CodeHeader) + coldBlockSize + (alignment - 1) + BYTES_PER_BUCKET);
+    }
+#endif // FEATURE_JIT_HOT_COLD_SPLITTING
+
 #if defined(USE_INDIRECT_CODEHEADER)
     SIZE_T realHeaderSize = offsetof(RealCodeHeader, unwindInfos[0]) + (sizeof(T_RUNTIME_FUNCTION) * nUnwindInfos);
 
@@ -3167,6 +3234,9 @@ void EEJitManager::allocCode(MethodDesc* pMD, size_t blockSize, size_t reserveFo
         pCodeHdrRW->SetEHInfo(NULL);
         pCodeHdrRW->SetGCInfo(NULL);
         pCodeHdrRW->SetMethodDesc(pMD);
+#ifdef FEATURE_JIT_HOT_COLD_SPLITTING
+        pCodeHdrRW->SetColdCodeInfo(NULL);
+#endif
 #ifdef FEATURE_EH_FUNCLETS
         pCodeHdrRW->SetNumberOfUnwindInfos(nUnwindInfos);
 #endif
@@ -3181,6 +3251,71 @@ void EEJitManager::allocCode(MethodDesc* pMD, size_t blockSize, size_t reserveFo
             *ppRealHeader = NULL;
         }
 #endif // USE_INDIRECT_CODEHEADER
+
+#ifdef FEATURE_JIT_HOT_COLD_SPLITTING
+        *ppColdCodeHeader = NULL;
+        *ppColdCodeHeaderRW = NULL;
+        *pColdAllocatedSize = 0;
+
+        if (coldBlockSize > 0)
+        {
+            HeapList *pCodeHeap = *ppCodeHeap;
+
+            // The cold part goes to the top of the code heap the hot part went to, so that it does not
+            // take up space between the hot methods growing from the bottom. Staying in the same heap keeps
+            // the unwind info of both parts relative to the same base and the jumps between them in reach.
+            // Once the top of the heap runs into the hot code, the cold part goes after the hot part instead,
+            // in the space set aside above.
+            TADDR pColdCode = (TADDR)pCodeHeap->pHeap->AllocMemForColdCode_NoThrow(sizeof(CodeHeader), coldBlockSize, alignment);
+            if (pColdCode != NULL)
+            {
+                if ((pCodeHeap->coldStartAddress == NULL) || (pColdCode < pCodeHeap->coldStartAddress))
+                {
+                    pCodeHeap->coldStartAddress = pColdCode;
+                }
+            }
+            else
+            {
+                pColdCode = (TADDR)pCodeHeap->pHeap->AllocMemForCode_NoThrow(sizeof(CodeHeader), coldBlockSize, alignment, reserveForJumpStubs);
+                if (pColdCode == NULL)
+                    ThrowOutOfMemory();
+
+                if (pColdCode + coldBlockSize > pCodeHeap->endAddress)
+                {
+                    pCodeHeap->endAddress = pColdCode + coldBlockSize;
+                }
+            }
+
+            _ASSERTE(IS_ALIGNED(pColdCode, alignment));
+
+            CodeHeader * pColdCodeHdr = ((CodeHeader *)pColdCode) - 1;
+            CodeHeader * pColdCodeHdrRW = NULL;
+
+            *pColdAllocatedSize = sizeof(CodeHeader) + coldBlockSize;
+
+            if (ExecutableAllocator::IsWXORXEnabled())
+            {
+                pColdCodeHdrRW = (CodeHeader *)new BYTE[*pColdAllocatedSize];
+            }
+            else
+            {
+                pColdCodeHdrRW = pColdCodeHdr;
+            }
+
+            // Both parts share the real header, which is not in the code heap so it is always writeable
+            pColdCodeHdrRW->SetRealCodeHeader((BYTE*)pCodeHdrRW->pRealCodeHeader);
+
+            ColdCodeInfo *pColdCodeInfo = (ColdCodeInfo*)(void*)pMD->GetLoaderAllocator()->GetLowFrequencyHeap()->AllocMem(S_SIZE_T(sizeof(ColdCodeInfo)));
+            pColdCodeInfo->hotCodeStart = pCode;
+            pColdCodeInfo->coldCodeStart = pColdCode;
+            pColdCodeInfo->coldCodeSize = (DWORD)coldBlockSize;
+            pColdCodeInfo->coldRootUnwindInfo = 0;
+            pCodeHdrRW->SetColdCodeInfo(pColdCodeInfo);
+
+            *ppColdCodeHeader = pColdCodeHdr;
+            *ppColdCodeHeaderRW = pColdCodeHdrRW;
+        }
+#endif // FEATURE_JIT_HOT_COLD_SPLITTING
     }
 
     *ppCodeHeader = pCodeHdr;
@@ -3238,6 +3373,12 @@ bool EEJitManager::CanUseCodeHeap(CodeHeapRequestInfo *pInfo, HeapList *pCodeHea
 
     bool retVal = false;
 
+    // Hot code is kept apart from the rest of the code, so that it is packed in as few huge pages as possible
+    if (pCodeHeap->isHotCodeHeap != pInfo->IsHotCode())
+    {
+        return false;
+    }
+
     if ((pInfo->m_loAddr == 0) && (pInfo->m_hiAddr == 0))
     {
         // We have no constraint so this non empty heap will be able to satisfy our request
@@ -3672,6 +3813,15 @@ void EEJitManager::RemoveJitData (CodeHeader * pCHdr, size_t GCinfo_len, size_t
             return;
 
         NibbleMapSetUnlocked(pHp, (TADDR)(pCHdr + 1), FALSE);
+
+#ifdef FEATURE_JIT_HOT_COLD_SPLITTING
+        // The cold part is in the same code heap
+        PTR_ColdCodeInfo pColdCodeInfo = pCHdr->GetColdCodeInfo();
+        if (pColdCodeInfo != NULL)
+        {
+            NibbleMapSetUnlocked(pHp, pColdCodeInfo->coldCodeStart, FALSE);
+        }
+#endif
     }
 
     // Backout the GCInfo
@@ -3835,6 +3985,9 @@ void EEJitManager::FreeCodeMemory(HostCodeHeap *pCodeHeap, void * codeStart)
     // clean up the NibbleMap
     NibbleMapSetUnlocked(pCodeHeap->m_pHeapList, (TADDR)codeStart, FALSE);
 
+    // The memory may be reused for another dynamic method
+    CodeInfoCache::Invalidate();
+
     // The caller of this method doesn't call HostCodeHeap->FreeMemForCode
     // directly because the operation should be protected by m_CodeHeapCritSec.
     pCodeHeap->FreeMemForCode(codeStart);
@@ -4161,6 +4314,22 @@ PCODE EEJitManager::GetCodeAddressForRelOffset(const METHODTOKEN& MethodToken, D
     WRAPPER_NO_CONTRACT;
 
     CodeHeader * pHeader = GetCodeHeader(MethodToken);
+
+#ifdef FEATURE_JIT_HOT_COLD_SPLITTING
+    if (pHeader->GetColdCodeInfo() != NULL)
+    {
+        MethodRegionInfo methodRegionInfo;
+        JitTokenToMethodRegionInfo(MethodToken, &methodRegionInfo);
+
+        if (relOffset >= methodRegionInfo.hotSize)
+        {
+            SIZE_T coldOffset = relOffset - methodRegionInfo.hotSize;
+            _ASSERTE(coldOffset < methodRegionInfo.coldSize);
+            return methodRegionInfo.coldStartAddress + coldOffset;
+        }
+    }
+#endif // FEATURE_JIT_HOT_COLD_SPLITTING
+
     return pHeader->GetCodeStartAddress() + relOffset;
 }
 
@@ -4190,12 +4359,30 @@ BOOL EEJitManager::JitCodeToMethodInfo(
 
     if (pCodeInfo)
     {
-        pCodeInfo->m_methodToken = METHODTOKEN(pRangeSection, dac_cast<TADDR>(pCHdr));
+#ifdef FEATURE_JIT_HOT_COLD_SPLITTING
+        if (pCHdr->IsColdCode())
+        {
+            // Report the cold part against the hot part, with the offsets continuing where
+            // the hot code ends. Both parts are in the same code heap.
+            PTR_ColdCodeInfo pColdCodeInfo = pCHdr->GetColdCodeInfo();
+            CodeHeader * pHotCHdr = GetCodeHeaderFromStartAddress(pColdCodeInfo->hotCodeStart);
+
+            pCodeInfo->m_methodToken = METHODTOKEN(pRangeSection, dac_cast<TADDR>(pHotCHdr));
 
-        // This can be counted on for Jitted code. For NGEN code in the case
-        // where we have hot/cold splitting this isn't valid and we need to
-        // take into account cold code.
-        pCodeInfo->m_relOffset = (DWORD)(PCODEToPINSTR(currentPC) - pCHdr->GetCodeStartAddress());
+            MethodRegionInfo methodRegionInfo;
+            JitTokenToMethodRegionInfo(pCodeInfo->m_methodToken, &methodRegionInfo);
+
+            pCodeInfo->m_relOffset = (DWORD)(methodRegionInfo.hotSize + (PCODEToPINSTR(currentPC) - pColdCodeInfo->coldCodeStart));
+        }
+        else
+#endif // FEATURE_JIT_HOT_COLD_SPLITTING
+        {
+            pCodeInfo->m_methodToken = METHODTOKEN(pRangeSection, dac_cast<TADDR>(pCHdr));
+
+            // This can be counted on for Jitted code outside of the cold part of a split method,
+            // which is handled above.
+            pCodeInfo->m_relOffset = (DWORD)(PCODEToPINSTR(currentPC) - pCHdr->GetCodeStartAddress());
+        }
 
 #ifdef FEATURE_EH_FUNCLETS
         // Computed lazily by code:EEJitManager::LazyGetFunctionEntry
@@ -4253,7 +4440,15 @@ TADDR EEJitManager::FindMethodCode(RangeSection * pRangeSection, PCODE currentPC
     if ((currentPC < pHp->startAddress) ||
         (currentPC > pHp->endAddress))
     {
-        return NULL;
+#ifdef FEATURE_JIT_HOT_COLD_SPLITTING
+        // Cold code is allocated from the top of the heap, above endAddress
+        if ((pHp->coldStartAddress == NULL) ||
+            (currentPC < pHp->coldStartAddress) ||
+            (currentPC >= pHp->startAddress + pHp->maxCodeHeapSize))
+#endif
+        {
+            return NULL;
+        }
     }
 
     TADDR base = pHp->mapBase;
@@ -4395,12 +4590,18 @@ PTR_RUNTIME_FUNCTION EEJitManager::LazyGetFunctionEntry(EECodeInfo * pCodeInfo)
 
     CodeHeader * pHeader = GetCodeHeader(pCodeInfo->GetMethodToken());
 
-    DWORD address = RUNTIME_FUNCTION__BeginAddress(pHeader->GetUnwindInfo(0)) + pCodeInfo->GetRelOffset();
-
     // We need the module base address to calculate the end address of a function from the functionEntry.
     // Thus, save it off right now.
     TADDR baseAddress = pCodeInfo->GetModuleBase();
 
+#ifdef FEATURE_JIT_HOT_COLD_SPLITTING
+    // The relative offset is not contiguous with the code address for the cold part of a split method
+    DWORD address = (DWORD)(PCODEToPINSTR(pCodeInfo->GetCodeAddress()) - baseAddress);
+    PTR_ColdCodeInfo pColdCodeInfo = pHeader->GetColdCodeInfo();
+#else
+    DWORD address = RUNTIME_FUNCTION__BeginAddress(pHeader->GetUnwindInfo(0)) + pCodeInfo->GetRelOffset();
+#endif
+
     // NOTE: We could binary search here, if it would be helpful (e.g., large number of funclets)
     for (UINT iUnwindInfo = 0; iUnwindInfo < pHeader->GetNumberOfUnwindInfos(); iUnwindInfo++)
     {
@@ -4410,10 +4611,16 @@ PTR_RUNTIME_FUNCTION EEJitManager::LazyGetFunctionEntry(EECodeInfo * pCodeInfo)
         {
 
 #if defined(EXCEPTION_DATA_SUPPORTS_FUNCTION_FRAGMENTS) && (defined(TARGET_ARM64) || defined(TARGET_LOONGARCH64))
-            // If we might have fragmented unwind, and we're on ARM64/LoongArch64,
-            // make sure to returning the root record,
-            // as the trailing records don't have prolog unwind codes.
-            pFunctionEntry = FindRootEntry(pFunctionEntry, baseAddress);
+#ifdef FEATURE_JIT_HOT_COLD_SPLITTING
+            // The root record of the cold part is not contiguous with the preceding records
+            if (pColdCodeInfo == NULL || iUnwindInfo != pColdCodeInfo->coldRootUnwindInfo)
+#endif
+            {
+                // If we might have fragmented unwind, and we're on ARM64/LoongArch64,
+                // make sure to returning the root record,
+                // as the trailing records don't have prolog unwind codes.
+                pFunctionEntry = FindRootEntry(pFunctionEntry, baseAddress);
+            }
 #endif
 
             return pFunctionEntry;
@@ -4439,11 +4646,32 @@ DWORD EEJitManager::GetFuncletStartOffsets(const METHODTOKEN& MethodToken, DWORD
 
     DWORD parentBeginRva = RUNTIME_FUNCTION__BeginAddress(pCH->GetUnwindInfo(0));
 
+#ifdef FEATURE_JIT_HOT_COLD_SPLITTING
+    PTR_ColdCodeInfo pColdCodeInfo = pCH->GetColdCodeInfo();
+    DWORD coldBeginRva = 0;
+    DWORD hotSize = 0;
+    if (pColdCodeInfo != NULL)
+    {
+        MethodRegionInfo regionInfo;
+        JitTokenToMethodRegionInfo(MethodToken, &regionInfo);
+        coldBeginRva = (DWORD)(pColdCodeInfo->coldCodeStart - moduleBase);
+        hotSize = (DWORD)regionInfo.hotSize;
+    }
+#endif // FEATURE_JIT_HOT_COLD_SPLITTING
+
     DWORD nFunclets = 0;
     for (COUNT_T iUnwindInfo = 1; iUnwindInfo < pCH->GetNumberOfUnwindInfos(); iUnwindInfo++)
     {
         PTR_RUNTIME_FUNCTION pFunctionEntry = pCH->GetUnwindInfo(iUnwindInfo);
 
+#ifdef FEATURE_JIT_HOT_COLD_SPLITTING
+        // The root of the cold part continues the main body, it is not a funclet
+        if (pColdCodeInfo != NULL && iUnwindInfo == pColdCodeInfo->coldRootUnwindInfo)
+        {
+            continue;
+        }
+#endif
+
 #if defined(EXCEPTION_DATA_SUPPORTS_FUNCTION_FRAGMENTS)
         if (IsFunctionFragment(moduleBase, pFunctionEntry))
         {
@@ -4455,6 +4683,14 @@ DWORD EEJitManager::GetFuncletStartOffsets(const METHODTOKEN& MethodToken, DWORD
         DWORD funcletBeginRva = RUNTIME_FUNCTION__BeginAddress(pFunctionEntry);
         DWORD relParentOffsetToFunclet = funcletBeginRva - parentBeginRva;
 
+#ifdef FEATURE_JIT_HOT_COLD_SPLITTING
+        // Offsets in the cold part continue where the hot part ends
+        if (pColdCodeInfo != NULL && funcletBeginRva >= coldBeginRva)
+        {
+            relParentOffsetToFunclet = hotSize + (funcletBeginRva - coldBeginRva);
+        }
+#endif
+
         if (nFunclets < dwLength)
             pStartFuncletOffsets[nFunclets] = relParentOffsetToFunclet;
         nFunclets++;
@@ -4463,6 +4699,25 @@ DWORD EEJitManager::GetFuncletStartOffsets(const METHODTOKEN& MethodToken, DWORD
     return nFunclets;
 }
 
+#ifdef FEATURE_JIT_HOT_COLD_SPLITTING
+TADDR EEJitManager::GetFuncletStartAddress(EECodeInfo * pCodeInfo)
+{
+    LIMITED_METHOD_DAC_CONTRACT;
+
+    CodeHeader * pHeader = GetCodeHeader(pCodeInfo->GetMethodToken());
+    PTR_ColdCodeInfo pColdCodeInfo = pHeader->GetColdCodeInfo();
+
+    // The cold part of the main body belongs to the method, not to a funclet
+    if ((pColdCodeInfo != NULL) &&
+        (pCodeInfo->GetFunctionEntry() == pHeader->GetUnwindInfo(pColdCodeInfo->coldRootUnwindInfo)))
+    {
+        return pCodeInfo->GetStartAddress();
+    }
+
+    return IJitManager::GetFuncletStartAddress(pCodeInfo);
+}
+#endif // FEATURE_JIT_HOT_COLD_SPLITTING
+
 #if defined(DACCESS_COMPILE)
 // This function is basically like RtlLookupFunctionEntry(), except that it works with DAC
 // to read the function entries out of process.  Also, it can only look up function entries
@@ -4631,6 +4886,14 @@ void EEJitManager::EnumMemoryRegions(CLRDataEnumMemoryFlags flags)
         DacEnumMemoryRegion(heap->startAddress, (ULONG32)
                             (heap->endAddress - heap->startAddress));
 
+#ifdef FEATURE_JIT_HOT_COLD_SPLITTING
+        if (heap->coldStartAddress != NULL)
+        {
+            DacEnumMemoryRegion(heap->coldStartAddress, (ULONG32)
+                                (heap->startAddress + heap->maxCodeHeapSize - heap->coldStartAddress));
+        }
+#endif
+
         if (heap->pHdrMap.IsValid())
         {
             ULONG32 nibbleMapSize = (ULONG32)
@@ -5368,6 +5631,7 @@ void ExecutionManager::Unload(LoaderAllocator *pLoaderAllocator)
     StackwalkCacheEntry corresponds to it. So flush the cache.
     */
     StackwalkCache::Invalidate(pLoaderAllocator);
+    CodeInfoCache::Invalidate();
 
     JumpStubCache * pJumpStubCache = (JumpStubCache *) pLoaderAllocator->m_pJumpStubCache;
     if (pJumpStubCache != NULL)
@@ -123,6 +123,27 @@ enum StubCodeBlockKind : int
 typedef DPTR(struct _hpRealCodeHdr) PTR_RealCodeHeader;
 typedef DPTR(struct _hpCodeHdr) PTR_CodeHeader;
 
+#ifdef FEATURE_JIT_HOT_COLD_SPLITTING
+//-----------------------------------------------------------------------------
+// Jitted methods can be split into a hot and a cold part. The cold part is
+// allocated from the top of the same code heap (see EEJitManager::allocCode)
+// and is preceded by its own CodeHeader that shares the RealCodeHeader of the
+// hot part. Offsets in the cold part continue where the hot code ends, the same
+// way as for ReadyToRun code.
+typedef DPTR(struct ColdCodeInfo) PTR_ColdCodeInfo;
+
+struct ColdCodeInfo
+{
+    TADDR               hotCodeStart;
+    TADDR               coldCodeStart;
+    DWORD               coldCodeSize;
+
+    // Index of the unwind info for the cold part of the main method body, or 0 if
+    // only funclets are cold. Index 0 is always the hot part of the main body.
+    DWORD               coldRootUnwindInfo;
+};
+#endif // FEATURE_JIT_HOT_COLD_SPLITTING
+
 #else // USE_INDIRECT_CODEHEADER
 typedef DPTR(struct _hpCodeHdr) PTR_CodeHeader;
 
@@ -148,6 +169,10 @@ public:
 
     PTR_MethodDesc      phdrMDesc;
 
+#ifdef FEATURE_JIT_HOT_COLD_SPLITTING
+    PTR_ColdCodeInfo    phdrColdCodeInfo;   // NULL unless the method was split into hot and cold parts
+#endif // FEATURE_JIT_HOT_COLD_SPLITTING
+
 #ifdef FEATURE_EH_FUNCLETS
     DWORD               nUnwindInfos;
     T_RUNTIME_FUNCTION  unwindInfos[0];
@@ -324,6 +349,25 @@ public:
         pRealCodeHeader = (PTR_RealCodeHeader)kind;
     }
 
+#ifdef FEATURE_JIT_HOT_COLD_SPLITTING
+    PTR_ColdCodeInfo        GetColdCodeInfo()
+    {
+        SUPPORTS_DAC;
+        return pRealCodeHeader->phdrColdCodeInfo;
+    }
+    void SetColdCodeInfo(PTR_ColdCodeInfo pCCI)
+    {
+        pRealCodeHeader->phdrColdCodeInfo = pCCI;
+    }
+    // Is this the CodeHeader in front of the cold part of a split method?
+    BOOL                    IsColdCode()
+    {
+        SUPPORTS_DAC;
+        PTR_ColdCodeInfo pCCI = GetColdCodeInfo();
+        return (pCCI != NULL) && (pCCI->coldCodeStart == GetCodeStartAddress());
+    }
+#endif // FEATURE_JIT_HOT_COLD_SPLITTING
+
 #if defined(FEATURE_EH_FUNCLETS)
     UINT                    GetNumberOfUnwindInfos()
     {
@@ -369,11 +413,15 @@ struct CodeHeapRequestInfo
     size_t       m_reserveForJumpStubs; // Amount to reserve for jump stubs (won't be allocated)
     bool         m_isDynamicDomain;
     bool         m_isCollectible;
+    bool         m_isHotCode;       // allocate from a hot code heap (see CodeHeapHugePages)
     bool         m_throwOnOutOfMemoryWithinRange;
 
     bool   IsDynamicDomain()                    { return m_isDynamicDomain;    }
     void   SetDynamicDomain()                   { m_isDynamicDomain = true;    }
 
+    bool   IsHotCode()                          { return m_isHotCode;          }
+    void   SetHotCode()                         { m_isHotCode = true;          }
+
     bool   IsCollectible()                      { return m_isCollectible;      }
 
     size_t getRequestSize()                     { return m_requestSize;        }
@@ -444,6 +492,14 @@ public:
     // Space for header is reserved immediately before. It is not included in size.
     virtual void* AllocMemForCode_NoThrow(size_t header, size_t size, DWORD alignment, size_t reserveForJumpStubs) = 0;
 
+    // Alloc the specified numbers of bytes for the cold part of a method, away from the hot code.
+    // Returns NULL if the heap does not keep cold code separately or the request does not fit.
+    virtual void* AllocMemForColdCode_NoThrow(size_t header, size_t size, DWORD alignment)
+    {
+        LIMITED_METHOD_CONTRACT;
+        return NULL;
+    }
+
 #ifdef DACCESS_COMPILE
     virtual void EnumMemoryRegions(CLRDataEnumMemoryFlags flags) = 0;
 #endif
@@ -461,6 +517,9 @@ protected:
 // The number of code heaps at which we increase the size of new code heaps.
 #define CODE_HEAP_SIZE_INCREASE_THRESHOLD 5
 
+// The size of the huge pages that hot code heaps are reserved in multiples of (see CodeHeapHugePages).
+#define CODE_HEAP_HUGE_PAGE_SIZE (2 * 1024 * 1024)
+
 typedef DPTR(struct HeapList) PTR_HeapList;
 
 struct HeapList
@@ -477,11 +536,16 @@ struct HeapList
 
     size_t              maxCodeHeapSize;// Size of the entire contiguous block of memory
     size_t              reserveForJumpStubs; // Amount of memory reserved for jump stubs in this block
+    bool                isHotCodeHeap;  // Holds only hot code and is backed by huge pages where the OS supports it
 
 #if defined(TARGET_AMD64) || defined(TARGET_ARM64) || defined(TARGET_LOONGARCH64)
     BYTE*               CLRPersonalityRoutine;  // jump thunk to personality routine
 #endif
 
+#ifdef FEATURE_JIT_HOT_COLD_SPLITTING
+    TADDR               coldStartAddress;       // the lowest cold code allocated from the top of the Heap, or NULL
+#endif
+
     TADDR GetModuleBase()
     {
 #if defined(TARGET_AMD64) || defined(TARGET_ARM64) || defined(TARGET_LOONGARCH64)
@@ -517,6 +581,7 @@ class LoaderCodeHeap : CodeHeap
 private:
     ExplicitControlLoaderHeap m_LoaderHeap;
     SSIZE_T m_cbMinNextPad;
+    SSIZE_T m_cbMinNextColdPad;
 
     LoaderCodeHeap();
 
@@ -530,6 +595,7 @@ public:
     }
 
     virtual void* AllocMemForCode_NoThrow(size_t header, size_t size, DWORD alignment, size_t reserveForJumpStubs) DAC_EMPTY_RET(NULL);
+    virtual void* AllocMemForColdCode_NoThrow(size_t header, size_t size, DWORD alignment) DAC_EMPTY_RET(NULL);
 
 #ifdef DACCESS_COMPILE
     virtual void EnumMemoryRegions(CLRDataEnumMemoryFlags flags)
@@ -982,13 +1048,16 @@ public:
 
     BOOL                LoadJIT();
 
-    void                allocCode(MethodDesc* pFD, size_t blockSize, size_t reserveForJumpStubs, CorJitAllocMemFlag flag, CodeHeader** ppCodeHeader, CodeHeader** ppCodeHeaderRW,
+    void                allocCode(MethodDesc* pFD, size_t blockSize, size_t reserveForJumpStubs, CorJitAllocMemFlag flag, bool isHotCode, CodeHeader** ppCodeHeader, CodeHeader** ppCodeHeaderRW,
                                   size_t* pAllocatedSize, HeapList** ppCodeHeap
 #ifdef USE_INDIRECT_CODEHEADER
                                 , BYTE** ppRealHeader
 #endif
 #ifdef FEATURE_EH_FUNCLETS
                                 , UINT nUnwindInfos
+#endif
+#ifdef FEATURE_JIT_HOT_COLD_SPLITTING
+                                , size_t coldBlockSize, CodeHeader** ppColdCodeHeader, CodeHeader** ppColdCodeHeaderRW, size_t* pColdAllocatedSize
 #endif
                                 );
     BYTE *              allocGCInfo(CodeHeader* pCodeHeader, DWORD blockSize, size_t * pAllocationSize);
@@ -1009,6 +1078,10 @@ public:
     virtual PTR_RUNTIME_FUNCTION    LazyGetFunctionEntry(EECodeInfo * pCodeInfo);
 
     virtual DWORD                   GetFuncletStartOffsets(const METHODTOKEN& MethodToken, DWORD* pStartFuncletOffsets, DWORD dwLength);
+
+#ifdef FEATURE_JIT_HOT_COLD_SPLITTING
+    virtual TADDR                   GetFuncletStartAddress(EECodeInfo * pCodeInfo);
+#endif // FEATURE_JIT_HOT_COLD_SPLITTING
 #endif // FEATURE_EH_FUNCLETS
 
     virtual StubCodeBlockKind       GetStubCodeBlockKind(RangeSection * pRangeSection, PCODE currentPC);
@@ -1503,6 +1576,18 @@ inline void EEJitManager::JitTokenToMethodRegionInfo(const METHODTOKEN& MethodTo
     methodRegionInfo->hotSize          = GetCodeManager()->GetFunctionSize(GetGCInfoToken(MethodToken));
     methodRegionInfo->coldStartAddress = 0;
     methodRegionInfo->coldSize         = 0;
+
+#ifdef FEATURE_JIT_HOT_COLD_SPLITTING
+    // The size in the GC info covers both parts of a split method
+    PTR_ColdCodeInfo pColdCodeInfo = GetCodeHeader(MethodToken)->GetColdCodeInfo();
+    if (pColdCodeInfo != NULL)
+    {
+        _ASSERTE(methodRegionInfo->hotSize > pColdCodeInfo->coldCodeSize);
+        methodRegionInfo->hotSize         -= pColdCodeInfo->coldCodeSize;
+        methodRegionInfo->coldStartAddress = pColdCodeInfo->coldCodeStart;
+        methodRegionInfo->coldSize         = pColdCodeInfo->coldCodeSize;
+    }
+#endif // FEATURE_JIT_HOT_COLD_SPLITTING
 }
 
 #if defined(FEATURE_READYTORUN)
@@ -2177,6 +2177,10 @@ FCIMPL1(PCODE, COMDelegate::GetMulticastInvoke, Object* refThisIn)
         DWORD dwInvocationCountNum = pCode->NewLocal(ELEMENT_TYPE_I4);
         DWORD dwLoopCounterNum = pCode->NewLocal(ELEMENT_TYPE_I4);
 
+        LocalDesc invocationListDesc(ELEMENT_TYPE_OBJECT);
+        invocationListDesc.MakeArray();
+        DWORD dwInvocationListNum = pCode->NewLocal(invocationListDesc);
+
         DWORD dwReturnValNum = -1;
         if(fReturnVal)
             dwReturnValNum = pCode->NewLocal(sig.GetRetTypeHandleNT());
@@ -2189,6 +2193,12 @@ FCIMPL1(PCODE, COMDelegate::GetMulticastInvoke, Object* refThisIn)
         pCode->EmitLDFLD(pCode->GetToken(CoreLibBinder::GetField(FIELD__MULTICAST_DELEGATE__INVOCATION_COUNT)));
         pCode->EmitSTLOC(dwInvocationCountNum);
 
+        // Load the invocation list once, delegates are immutable so it cannot change while the targets are called. Keeping
+        // it in a local rather than reloading the field after every call leaves only the element load in the loop.
+        pCode->EmitLoadThis();
+        pCode->EmitLDFLD(pCode->GetToken(CoreLibBinder::GetField(FIELD__MULTICAST_DELEGATE__INVOCATION_LIST)));
+        pCode->EmitSTLOC(dwInvocationListNum);
+
         // initialize counter
         pCode->EmitLDC(0);
         pCode->EmitSTLOC(dwLoopCounterNum);
@@ -2208,8 +2218,7 @@ FCIMPL1(PCODE, COMDelegate::GetMulticastInvoke, Object* refThisIn)
         pCode->EmitBEQ(endOfMethod);
 
         // Load next delegate from array using LoopCounter as index
-        pCode->EmitLoadThis();
-        pCode->EmitLDFLD(pCode->GetToken(CoreLibBinder::GetField(FIELD__MULTICAST_DELEGATE__INVOCATION_LIST)));
+        pCode->EmitLDLOC(dwInvocationListNum);
         pCode->EmitLDLOC(dwLoopCounterNum);
         pCode->EmitLDELEM_REF();
 
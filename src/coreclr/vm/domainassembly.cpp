@@ -27,6 +27,8 @@
 #include "perfmap.h"
 #endif // FEATURE_PERFMAP
 
+#include "readytorunfixupresolver.h"
+
 #ifndef DACCESS_COMPILE
 DomainAssembly::DomainAssembly(AppDomain* pDomain, PEAssembly* pPEAssembly, LoaderAllocator* pLoaderAllocator) :
     m_pAssembly(NULL),
@@ -560,6 +562,11 @@ void DomainAssembly::FinishLoad()
     // typeloads can involve types from this module. (Used for candidate instantiations.)
     GetModule()->SetIsReadyForTypeLoad();
 
+#ifdef FEATURE_READYTORUN
+    // Now that types can be loaded from the module, its fixups may be resolved ahead of use
+    ReadyToRunFixupResolver::QueueModule(GetModule());
+#endif // FEATURE_READYTORUN
+
 #ifdef FEATURE_PERFMAP
     // Notify the perfmap of the IL image load.
     PerfMap::LogImageLoad(m_pPEAssembly);
@@ -105,8 +105,11 @@ HRESULT EEConfig::Init()
     dwSpinLimitConstant = 0x0;
     dwSpinRetryCount = 0xA;
     dwMonitorSpinCount = 0;
+    fMonitorAdaptiveSpin = true;
 
     dwJitHostMaxSlabCache = 0;
+    fCodeHeapHugePages = false;
+    dwReflectionInvokeStubThreshold = 0;
 
     iJitOptimizeType = OPT_DEFAULT;
     fJitFramed = false;
@@ -232,8 +235,13 @@ HRESULT EEConfig::Init()
     fTieredCompilation_UseCallCountingStubs = false;
     tieredCompilation_CallCountThreshold = 1;
     tieredCompilation_BackgroundWorkerTimeoutMs = 0;
+    tieredCompilation_BackgroundWorkerMaxCount = 1;
+    tieredCompilation_BackgroundWorkerBacklogPerWorker = 0;
     tieredCompilation_CallCountingDelayMs = 0;
     tieredCompilation_DeleteCallCountingStubsAfter = 0;
+    fTieredCompilation_SamplingTierUp = false;
+    tieredCompilation_SamplingIntervalMs = 0;
+    tieredCompilation_SampleThreshold = 0;
 #endif
 
 #if defined(FEATURE_PGO)
@@ -248,6 +256,7 @@ HRESULT EEConfig::Init()
 #if defined(FEATURE_ON_STACK_REPLACEMENT)
     dwOSR_HitLimit = 10;
     dwOSR_CounterBump = 5000;
+    dwOSR_TimeLimitMs = 20;
 #endif
 
     backpatchEntryPointSlots = false;
@@ -538,8 +547,11 @@ HRESULT EEConfig::sync()
     dwSpinLimitConstant = CLRConfig::GetConfigValue(CLRConfig::EXTERNAL_SpinLimitConstant);
     dwSpinRetryCount = CLRConfig::GetConfigValue(CLRConfig::EXTERNAL_SpinRetryCount);
     dwMonitorSpinCount = CLRConfig::GetConfigValue(CLRConfig::INTERNAL_Monitor_SpinCount);
+    fMonitorAdaptiveSpin = CLRConfig::GetConfigValue(CLRConfig::INTERNAL_Monitor_AdaptiveSpin) != 0;
 
     dwJitHostMaxSlabCache = CLRConfig::GetConfigValue(CLRConfig::EXTERNAL_JitHostMaxSlabCache);
+    fCodeHeapHugePages = CLRConfig::GetConfigValue(CLRConfig::EXTERNAL_CodeHeapHugePages) != 0;
+    dwReflectionInvokeStubThreshold = CLRConfig::GetConfigValue(CLRConfig::EXTERNAL_ReflectionInvokeStubThreshold);
 
     fJitFramed = (CLRConfig::GetConfigValue(CLRConfig::UNSUPPORTED_JitFramed) != 0);
     fJitMinOpts = (CLRConfig::GetConfigValue(CLRConfig::UNSUPPORTED_JITMinOpts) == 1);
@@ -716,6 +728,21 @@ HRESULT EEConfig::sync()
         tieredCompilation_BackgroundWorkerTimeoutMs =
             CLRConfig::GetConfigValue(CLRConfig::INTERNAL_TC_BackgroundWorkerTimeoutMs);
 
+        tieredCompilation_BackgroundWorkerMaxCount =
+            CLRConfig::GetConfigValue(CLRConfig::INTERNAL_TC_BackgroundWorkerMaxCount);
+        if (tieredCompilation_BackgroundWorkerMaxCount == 0)
+        {
+            // A quarter of the processors leaves most of them to the foreground threads whose methods are being promoted
+            tieredCompilation_BackgroundWorkerMaxCount = max(1, GetCurrentProcessCpuCount() / 4);
+        }
+
+        tieredCompilation_BackgroundWorkerBacklogPerWorker =
+            CLRConfig::GetConfigValue(CLRConfig::INTERNAL_TC_BackgroundWorkerBacklogPerWorker);
+        if (tieredCompilation_BackgroundWorkerBacklogPerWorker == 0)
+        {
+            tieredCompilation_BackgroundWorkerBacklogPerWorker = 1;
+        }
+
         fTieredCompilation_CallCounting = CLRConfig::GetConfigValue(CLRConfig::INTERNAL_TC_CallCounting) != 0;
 
         DWORD tieredCompilation_ConfiguredCallCountThreshold =
@@ -758,6 +785,20 @@ HRESULT EEConfig::sync()
                 tieredCompilation_DeleteCallCountingStubsAfter =
                     CLRConfig::GetConfigValue(CLRConfig::INTERNAL_TC_DeleteCallCountingStubsAfter);
             }
+
+            // Sampling replaces call counting stubs as the trigger for promotion, methods are instead promoted when they are
+            // seen often enough at the top of the stacks of running threads
+            fTieredCompilation_SamplingTierUp = CLRConfig::GetConfigValue(CLRConfig::INTERNAL_TC_SamplingTierUp) != 0;
+            if (fTieredCompilation_SamplingTierUp)
+            {
+                fTieredCompilation_UseCallCountingStubs = false;
+                tieredCompilation_DeleteCallCountingStubsAfter = 0;
+
+                tieredCompilation_SamplingIntervalMs =
+                    max((DWORD)1, CLRConfig::GetConfigValue(CLRConfig::INTERNAL_TC_SamplingIntervalMs));
+                tieredCompilation_SampleThreshold =
+                    max((DWORD)1, CLRConfig::GetConfigValue(CLRConfig::INTERNAL_TC_SampleThreshold));
+            }
         }
 
         if (CLRConfig::GetConfigValue(CLRConfig::EXTERNAL_TC_AggressiveTiering) != 0)
@@ -795,6 +836,7 @@ HRESULT EEConfig::sync()
 #if defined(FEATURE_ON_STACK_REPLACEMENT)
     dwOSR_HitLimit = CLRConfig::GetConfigValue(CLRConfig::INTERNAL_OSR_HitLimit);
     dwOSR_CounterBump = CLRConfig::GetConfigValue(CLRConfig::INTERNAL_OSR_CounterBump);
+    dwOSR_TimeLimitMs = CLRConfig::GetConfigValue(CLRConfig::INTERNAL_OSR_TimeLimitMs);
 #endif
 
 #if defined(FEATURE_ON_STACK_REPLACEMENT) && defined(_DEBUG)
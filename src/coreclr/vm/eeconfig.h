@@ -68,11 +68,14 @@ public:
     DWORD         SpinLimitConstant(void)         const {LIMITED_METHOD_CONTRACT;  return dwSpinLimitConstant; }
     DWORD         SpinRetryCount(void)            const {LIMITED_METHOD_CONTRACT;  return dwSpinRetryCount; }
     DWORD         MonitorSpinCount(void)          const {LIMITED_METHOD_CONTRACT;  return dwMonitorSpinCount; }
+    bool          MonitorAdaptiveSpin(void)       const {LIMITED_METHOD_CONTRACT;  return fMonitorAdaptiveSpin; }
 
     // Jit-config
 
     DWORD         JitHostMaxSlabCache(void)                 const {LIMITED_METHOD_CONTRACT;  return dwJitHostMaxSlabCache; }
     bool          GetTrackDynamicMethodDebugInfo(void)      const {LIMITED_METHOD_CONTRACT;  return fTrackDynamicMethodDebugInfo; }
+    bool          CodeHeapHugePages(void)                   const {LIMITED_METHOD_CONTRACT;  return fCodeHeapHugePages; }
+    DWORD         ReflectionInvokeStubThreshold(void)       const {LIMITED_METHOD_CONTRACT;  return dwReflectionInvokeStubThreshold; }
     unsigned int  GenOptimizeType(void)                     const {LIMITED_METHOD_CONTRACT;  return iJitOptimizeType; }
     bool          JitFramed(void)                           const {LIMITED_METHOD_CONTRACT;  return fJitFramed; }
     bool          JitMinOpts(void)                          const {LIMITED_METHOD_CONTRACT;  return fJitMinOpts; }
@@ -83,11 +86,16 @@ public:
     bool          TieredCompilation_QuickJit() const { LIMITED_METHOD_CONTRACT; return fTieredCompilation_QuickJit; }
     bool          TieredCompilation_QuickJitForLoops() const { LIMITED_METHOD_CONTRACT; return fTieredCompilation_QuickJitForLoops; }
     DWORD         TieredCompilation_BackgroundWorkerTimeoutMs() const { LIMITED_METHOD_CONTRACT; return tieredCompilation_BackgroundWorkerTimeoutMs; }
+    DWORD         TieredCompilation_BackgroundWorkerMaxCount() const { LIMITED_METHOD_CONTRACT; return tieredCompilation_BackgroundWorkerMaxCount; }
+    DWORD         TieredCompilation_BackgroundWorkerBacklogPerWorker() const { LIMITED_METHOD_CONTRACT; return tieredCompilation_BackgroundWorkerBacklogPerWorker; }
     bool          TieredCompilation_CallCounting()  const { LIMITED_METHOD_CONTRACT; return fTieredCompilation_CallCounting; }
     UINT16        TieredCompilation_CallCountThreshold() const { LIMITED_METHOD_CONTRACT; return tieredCompilation_CallCountThreshold; }
     DWORD         TieredCompilation_CallCountingDelayMs() const { LIMITED_METHOD_CONTRACT; return tieredCompilation_CallCountingDelayMs; }
     bool          TieredCompilation_UseCallCountingStubs() const { LIMITED_METHOD_CONTRACT; return fTieredCompilation_UseCallCountingStubs; }
     DWORD         TieredCompilation_DeleteCallCountingStubsAfter() const { LIMITED_METHOD_CONTRACT; return tieredCompilation_DeleteCallCountingStubsAfter; }
+    bool          TieredCompilation_SamplingTierUp() const { LIMITED_METHOD_CONTRACT; return fTieredCompilation_SamplingTierUp; }
+    DWORD         TieredCompilation_SamplingIntervalMs() const { LIMITED_METHOD_CONTRACT; return tieredCompilation_SamplingIntervalMs; }
+    DWORD         TieredCompilation_SampleThreshold() const { LIMITED_METHOD_CONTRACT; return tieredCompilation_SampleThreshold; }
 #endif
 
 #if defined(FEATURE_PGO)
@@ -103,6 +111,7 @@ public:
     // OSR Config
     DWORD         OSR_CounterBump() const { LIMITED_METHOD_CONTRACT; return dwOSR_CounterBump; }
     DWORD         OSR_HitLimit() const { LIMITED_METHOD_CONTRACT; return dwOSR_HitLimit; }
+    DWORD         OSR_TimeLimitMs() const { LIMITED_METHOD_CONTRACT; return dwOSR_TimeLimitMs; }
 #endif
 
 #if defined(FEATURE_ON_STACK_REPLACEMENT) && defined(_DEBUG)
@@ -476,6 +485,8 @@ private: //----------------------------------------------------------------
 
     DWORD dwJitHostMaxSlabCache;       // max size for jit host slab cache
     bool fTrackDynamicMethodDebugInfo; //  Enable/Disable tracking dynamic method debug info
+    bool fCodeHeapHugePages;           // Allocate tier 1 code from hot code heaps backed by huge pages
+    DWORD dwReflectionInvokeStubThreshold; // Reflection invokes of a method before an IL stub is used to invoke it, 0 to disable
     bool fJitFramed;                   // Enable/Disable EBP based frames
     bool fJitMinOpts;                  // Enable MinOpts for all jitted methods
 
@@ -570,6 +581,7 @@ private: //----------------------------------------------------------------
     DWORD dwSpinLimitConstant;
     DWORD dwSpinRetryCount;
     DWORD dwMonitorSpinCount;
+    bool fMonitorAdaptiveSpin;
 
 #ifdef VERIFY_HEAP
     int  iGCHeapVerify;
@@ -649,8 +661,13 @@ private: //----------------------------------------------------------------
     bool fTieredCompilation_UseCallCountingStubs;
     UINT16 tieredCompilation_CallCountThreshold;
     DWORD tieredCompilation_BackgroundWorkerTimeoutMs;
+    DWORD tieredCompilation_BackgroundWorkerMaxCount;
+    DWORD tieredCompilation_BackgroundWorkerBacklogPerWorker;
     DWORD tieredCompilation_CallCountingDelayMs;
     DWORD tieredCompilation_DeleteCallCountingStubsAfter;
+    bool fTieredCompilation_SamplingTierUp;
+    DWORD tieredCompilation_SamplingIntervalMs;
+    DWORD tieredCompilation_SampleThreshold;
 #endif
 
 #if defined(FEATURE_PGO)
@@ -665,6 +682,7 @@ private: //----------------------------------------------------------------
 #if defined(FEATURE_ON_STACK_REPLACEMENT)
     DWORD dwOSR_HitLimit;
     DWORD dwOSR_CounterBump;
+    DWORD dwOSR_TimeLimitMs;
 #endif
 
 #if defined(FEATURE_ON_STACK_REPLACEMENT) && defined(_DEBUG)
@@ -1266,6 +1266,15 @@ ep_rt_atomic_dec_int64_t (volatile int64_t *value)
 	return static_cast<int64_t>(InterlockedDecrement64 ((volatile LONG64 *)(value)));
 }
 
+static
+inline
+int64_t
+ep_rt_atomic_add_int64_t (volatile int64_t *value, int64_t add)
+{
+	STATIC_CONTRACT_NOTHROW;
+	return static_cast<int64_t>(InterlockedExchangeAdd64 ((volatile LONG64 *)(value), (LONG64)(add))) + add;
+}
+
 static
 inline
 size_t
@@ -1660,6 +1669,15 @@ ep_rt_config_value_get_output_streaming (void)
 	return CLRConfig::GetConfigValue (CLRConfig::INTERNAL_EventPipeOutputStreaming) != 0;
 }
 
+static
+inline
+bool
+ep_rt_config_value_get_output_user_events (void)
+{
+	STATIC_CONTRACT_NOTHROW;
+	return CLRConfig::GetConfigValue (CLRConfig::INTERNAL_EventPipeOutputUserEvents) != 0;
+}
+
 /*
  * EventPipeSampleProfiler.
  */
@@ -1677,6 +1695,14 @@ ep_rt_sample_profiler_write_sampling_event_for_threads (
 	ep_rt_coreclr_sample_profiler_write_sampling_event_for_threads (sampling_thread, sampling_event);
 }
 
+static
+inline
+void
+ep_rt_sample_profiler_stop_sampling (void)
+{
+	STATIC_CONTRACT_NOTHROW;
+}
+
 static
 inline
 void
@@ -3221,6 +3221,61 @@ void ETW::TypeSystemLog::TypeLoadEnd(UINT32 typeLoad, TypeHandle th, UINT16 load
     }
 }
 
+// Returns the time at which a thread starts waiting for another thread to load a type, or zero if the wait is not logged
+UINT64 ETW::TypeSystemLog::TypeLoadWaitBegin()
+{
+    LIMITED_METHOD_CONTRACT;
+
+    if (!ETW_EVENT_ENABLED(MICROSOFT_WINDOWS_DOTNETRUNTIME_PROVIDER_DOTNET_Context, TypeLoadWait))
+    {
+        return 0;
+    }
+
+    LARGE_INTEGER waitStart;
+    QueryPerformanceCounter(&waitStart);
+    return (UINT64)waitStart.QuadPart;
+}
+
+void ETW::TypeSystemLog::TypeLoadWaitEnd(UINT64 waitStart, TypeKey *pTypeKey, TypeHandle th, UINT16 loadLevel)
+{
+    CONTRACTL{
+        NOTHROW;
+        GC_TRIGGERS;
+    } CONTRACTL_END;
+
+    if (waitStart == 0 || !ETW_EVENT_ENABLED(MICROSOFT_WINDOWS_DOTNETRUNTIME_PROVIDER_DOTNET_Context, TypeLoadWait))
+    {
+        return;
+    }
+
+    LARGE_INTEGER waitEnd;
+    LARGE_INTEGER frequency;
+    QueryPerformanceCounter(&waitEnd);
+    QueryPerformanceFrequency(&frequency);
+    UINT64 waitDurationMicroseconds = ((UINT64)waitEnd.QuadPart - waitStart) * 1000000 / (UINT64)frequency.QuadPart;
+
+    EX_TRY
+    {
+        // The type handle is null if the load failed on the other thread, the name is still known from the key
+        StackSString typeName;
+        TypeString::AppendTypeKey(typeName, pTypeKey, TypeString::FormatNamespace | TypeString::FormatAngleBrackets);
+
+        SCOUNT_T maxTypeNameLen = (cbMaxEtwEvent / 2) - 0x100;
+        if (typeName.GetCount() > (unsigned)maxTypeNameLen)
+        {
+            typeName.Truncate(typeName.Begin() + maxTypeNameLen);
+        }
+
+        FireEtwTypeLoadWait(
+            GetClrInstanceId(),
+            loadLevel,
+            waitDurationMicroseconds,
+            (UINT64)th.AsPtr(),
+            typeName
+            );
+    } EX_CATCH{ } EX_END_CATCH(SwallowAllExceptions);
+}
+
 //---------------------------------------------------------------------------------------
 //
 // Outermost level of ETW-type-logging.  Clients outside eventtrace.cpp call this to log
@@ -5059,6 +5114,43 @@ VOID ETW::LoaderLog::CollectibleLoaderAllocatorUnload(AssemblyLoaderAllocator *p
     } EX_CATCH { } EX_END_CATCH(SwallowAllExceptions);
 }
 
+/****************************************************************************/
+/* This is called by the runtime when it has torn down a batch of unloaded  */
+/* LoaderAllocators, with the time spent in each phase                      */
+/****************************************************************************/
+VOID ETW::LoaderLog::CollectibleLoaderAllocatorsUnloaded(UINT32 count, UINT64 assemblyCleanupMicroseconds, UINT64 suspendMicroseconds, UINT64 codeAndStubsMicroseconds, UINT64 handlesMicroseconds)
+{
+    CONTRACTL {
+        NOTHROW;
+        GC_NOTRIGGER;
+    } CONTRACTL_END;
+
+    FireEtwLoaderAllocatorUnloadPhases(
+        GetClrInstanceId(),
+        count,
+        assemblyCleanupMicroseconds,
+        suspendMicroseconds,
+        codeAndStubsMicroseconds,
+        handlesMicroseconds);
+}
+
+/****************************************************************************/
+/* This is called by the runtime when it has freed the memory of unloaded   */
+/* LoaderAllocators, once no GC heap object can refer to it anymore         */
+/****************************************************************************/
+VOID ETW::LoaderLog::CollectibleLoaderAllocatorsFreed(UINT32 count, UINT64 freeMicroseconds)
+{
+    CONTRACTL {
+        NOTHROW;
+        GC_NOTRIGGER;
+    } CONTRACTL_END;
+
+    FireEtwLoaderAllocatorsFreed(
+        GetClrInstanceId(),
+        count,
+        freeMicroseconds);
+}
+
 /****************************************************************************/
 /* This is called by the runtime when the runtime is loaded
    Function gets called by both the Callback mechanism and regular ETW events.
@@ -7791,6 +7883,60 @@ void ETW::CompilationLog::TieredCompilation::Runtime::SendBackgroundJitStop(UINT
     FireEtwTieredCompilationBackgroundJitStop(GetClrInstanceId(), pendingMethodCount, jittedMethodCount);
 }
 
+void ETW::CompilationLog::TieredCompilation::Runtime::SendBackgroundWorkers(UINT32 pendingMethodCount, UINT32 workerCount)
+{
+    CONTRACTL {
+        NOTHROW;
+        GC_NOTRIGGER;
+    } CONTRACTL_END;
+    _ASSERTE(g_pConfig->TieredCompilation());
+
+    FireEtwTieredCompilationBackgroundWorkers(GetClrInstanceId(), pendingMethodCount, workerCount);
+}
+
+void ETW::CompilationLog::TieredCompilation::Runtime::SendMethodPromoted(
+    MethodDesc *methodDesc,
+    UINT16 optimizationTier,
+    UINT64 queueMicroseconds,
+    UINT64 compileMicroseconds)
+{
+    CONTRACTL {
+        NOTHROW;
+        GC_NOTRIGGER;
+    } CONTRACTL_END;
+    _ASSERTE(g_pConfig->TieredCompilation());
+    _ASSERTE(methodDesc != nullptr);
+
+    FireEtwTieredCompilationMethodPromoted(
+        GetClrInstanceId(),
+        (UINT64)methodDesc,
+        optimizationTier,
+        queueMicroseconds,
+        compileMicroseconds);
+}
+
+void ETW::CompilationLog::TieredCompilation::Runtime::SendOsrTransition(
+    MethodDesc *methodDesc,
+    UINT32 ilOffset,
+    UINT32 hitCount,
+    UINT64 tier0Milliseconds,
+    UINT32 flags)
+{
+    CONTRACTL {
+        NOTHROW;
+        GC_NOTRIGGER;
+    } CONTRACTL_END;
+    _ASSERTE(methodDesc != nullptr);
+
+    FireEtwTieredCompilationOsrTransition(
+        GetClrInstanceId(),
+        (UINT64)methodDesc,
+        ilOffset,
+        hitCount,
+        tier0Milliseconds,
+        flags);
+}
+
 #endif // !FEATURE_NATIVEAOT
 
 #ifdef FEATURE_PERFTRACING
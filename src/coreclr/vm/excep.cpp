@@ -20,6 +20,7 @@
 #include "comutilnative.h"
 #include "siginfo.hpp"
 #include "gcheaputilities.h"
+#include "threadsuspend.h"
 #include "eedbginterfaceimpl.h" //so we can clearexception in RealCOMPlusThrow
 #include "dllimportcallback.h"
 #include "stackwalk.h" //for CrawlFrame, in SetIPFromSrcToDst
@@ -4170,6 +4171,16 @@ InitializeCrashDump()
 
 #endif // HOST_WINDOWS
 
+#ifdef TARGET_UNIX
+static VOID SnapshotForked(PVOID parameter)
+{
+    WRAPPER_NO_CONTRACT;
+
+    // The snapshot was taken (or failed to be), the process doesn't need to wait for the dump.
+    ThreadSuspend::RestartEE(FALSE, TRUE);
+}
+#endif // TARGET_UNIX
+
 bool GenerateDump(
     LPCWSTR dumpName,
     INT dumpType,
@@ -4183,6 +4194,13 @@ bool GenerateDump(
     {
         return false;
     }
+    else if (flags & GenerateDumpFlagsForkSnapshotEnabled)
+    {
+        // Fork with the runtime suspended so the snapshot has every thread at a GC safe point
+        // and a heap that can be walked. The process only pauses for the fork itself.
+        ThreadSuspend::SuspendEE(ThreadSuspend::SUSPEND_OTHER);
+        return PAL_GenerateSnapshotCoreDump(dumpNameUtf8, dumpType, flags, SnapshotForked, nullptr, errorMessageBuffer, cbErrorMessageBuffer);
+    }
     else
     {
         return PAL_GenerateCoreDump(dumpNameUtf8, dumpType, flags, errorMessageBuffer, cbErrorMessageBuffer);
@@ -202,7 +202,8 @@ enum
     GenerateDumpFlagsLoggingEnabled = 0x01,
     GenerateDumpFlagsVerboseLoggingEnabled = 0x02,
     GenerateDumpFlagsCrashReportEnabled = 0x04,
-    GenerateDumpFlagsCrashReportOnlyEnabled = 0x08
+    GenerateDumpFlagsCrashReportOnlyEnabled = 0x08,
+    GenerateDumpFlagsForkSnapshotEnabled = 0x10
 };
 
 void InitializeCrashDump();
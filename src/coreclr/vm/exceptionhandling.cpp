@@ -219,6 +219,75 @@ void HandleTerminationRequest(int terminationExitCode)
 }
 #endif
 
+// Types of the typed EH clauses that the first pass has resolved, keyed by the clause. Resolving the type token of a clause
+// loads the type through the module's token maps and the type context of the method on every throw that reaches the clause,
+// which dominates the cost of throws that are caught a few frames up the stack by the same handlers. The cache is direct-mapped,
+// an entry is replaced by a colliding clause rather than growing the table, so that lookups and updates do not allocate.
+//
+// Only clauses of code that is never freed are cached, so that a clause address is never reused for a different clause.
+// Dynamic methods cache the type in their clauses at JIT time already (see CEEJitInfo::setEHinfo()) and their code may be
+// freed, and code of collectible methods is freed when their loader allocator is unloaded.
+struct EHClauseTypeCacheEntry
+{
+    PTR_EXCEPTION_CLAUSE_TOKEN pEHClauseToken;
+    TypeHandle typeHnd;
+};
+
+static const UINT32 EHClauseTypeCacheSize = 256;
+static EHClauseTypeCacheEntry g_EHClauseTypeCache[EHClauseTypeCacheSize];
+static SpinLock g_EHClauseTypeCacheLock;
+
+static inline EHClauseTypeCacheEntry *GetEHClauseTypeCacheEntry(PTR_EXCEPTION_CLAUSE_TOKEN pEHClauseToken)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    // Clauses are at least pointer-aligned, and clauses of the same method are adjacent
+    SIZE_T hash = dac_cast<TADDR>(pEHClauseToken) / sizeof(void *);
+    return &g_EHClauseTypeCache[(hash ^ (hash / EHClauseTypeCacheSize)) % EHClauseTypeCacheSize];
+}
+
+static TypeHandle LookupEHClauseType(PTR_EXCEPTION_CLAUSE_TOKEN pEHClauseToken)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_ANY;
+    }
+    CONTRACTL_END;
+
+    EHClauseTypeCacheEntry *pEntry = GetEHClauseTypeCacheEntry(pEHClauseToken);
+
+    SpinLock::AcquireLock(&g_EHClauseTypeCacheLock);
+    TypeHandle typeHnd = pEntry->pEHClauseToken == pEHClauseToken ? pEntry->typeHnd : TypeHandle();
+    SpinLock::ReleaseLock(&g_EHClauseTypeCacheLock);
+
+    return typeHnd;
+}
+
+static void AddEHClauseType(MethodDesc *pMD, PTR_EXCEPTION_CLAUSE_TOKEN pEHClauseToken, TypeHandle typeHnd)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_ANY;
+    }
+    CONTRACTL_END;
+
+    if (typeHnd.IsNull() || pMD->IsDynamicMethod() || pMD->GetLoaderAllocator()->IsCollectible())
+    {
+        return;
+    }
+
+    EHClauseTypeCacheEntry *pEntry = GetEHClauseTypeCacheEntry(pEHClauseToken);
+
+    SpinLock::AcquireLock(&g_EHClauseTypeCacheLock);
+    pEntry->pEHClauseToken = pEHClauseToken;
+    pEntry->typeHnd = typeHnd;
+    SpinLock::ReleaseLock(&g_EHClauseTypeCacheLock);
+}
+
 void InitializeExceptionHandling()
 {
     EH_LOG((LL_INFO100, "InitializeExceptionHandling(): ExceptionTracker size: 0x%x bytes\n", sizeof(ExceptionTracker)));
@@ -230,6 +299,9 @@ void InitializeExceptionHandling()
     // Initialize the lock used for synchronizing access to the stacktrace in the exception object
     g_StackTraceArrayLock.Init(LOCK_TYPE_DEFAULT, TRUE);
 
+    // Initialize the lock used for synchronizing access to the cache of resolved EH clause types
+    g_EHClauseTypeCacheLock.Init(LOCK_TYPE_DEFAULT, TRUE);
+
 #ifdef TARGET_UNIX
     // Register handler of hardware exceptions like null reference in PAL
     PAL_SetHardwareExceptionHandler(HandleHardwareException, IsSafeToHandleHardwareException);
@@ -3023,19 +3095,24 @@ CLRUnwindStatus ExceptionTracker::ProcessManagedCallFrame(
                             }
                             else
                             {
-                                TypeHandle typeHnd;
-                                EX_TRY
-                                {
-                                    typeHnd = pJitMan->ResolveEHClause(&EHClause, pcfThisFrame);
-                                }
-                                EX_CATCH_EX(Exception)
+                                TypeHandle typeHnd = LookupEHClauseType(pEHClauseToken);
+                                if (typeHnd.IsNull())
                                 {
-                                    SString msg;
-                                    GET_EXCEPTION()->GetMessage(msg);
-                                    msg.Insert(msg.Begin(), W("Cannot resolve EH clause:\n"));
-                                    EEPOLICY_HANDLE_FATAL_ERROR_WITH_MESSAGE(COR_E_FAILFAST, msg.GetUnicode());
+                                    EX_TRY
+                                    {
+                                        typeHnd = pJitMan->ResolveEHClause(&EHClause, pcfThisFrame);
+                                    }
+                                    EX_CATCH_EX(Exception)
+                                    {
+                                        SString msg;
+                                        GET_EXCEPTION()->GetMessage(msg);
+                                        msg.Insert(msg.Begin(), W("Cannot resolve EH clause:\n"));
+                                        EEPOLICY_HANDLE_FATAL_ERROR_WITH_MESSAGE(COR_E_FAILFAST, msg.GetUnicode());
+                                    }
+                                    EX_END_CATCH(RethrowTransientExceptions);
+
+                                    AddEHClauseType(pMD, pEHClauseToken, typeHnd);
                                 }
-                                EX_END_CATCH(RethrowTransientExceptions);
 
                                 EH_LOG((LL_INFO100,
                                         "  clause type = %s\n",
@@ -31,11 +31,20 @@ CLREvent * FinalizerThread::hEventFinalizerToShutDown = NULL;
 
 HANDLE FinalizerThread::MHandles[kHandleCount];
 
+DWORD FinalizerThread::s_helperThreadLimit = 0;
+LONG FinalizerThread::s_helperThreadCount = 0;
+CLREvent ** FinalizerThread::hEventHelperStart = NULL;
+CLREvent * FinalizerThread::hEventHelpersDone = NULL;
+LONG FinalizerThread::s_activeHelperCount = 0;
+LONG FinalizerThread::s_helperFinalizedCount = 0;
+LONG FinalizerThread::s_finalizingThreadCount = 0;
+
 BOOL FinalizerThread::IsCurrentThreadFinalizer()
 {
     LIMITED_METHOD_CONTRACT;
 
-    return GetThreadNULLOk() == g_pFinalizerThread;
+    // Helper threads are finalizer threads as well, they must not wait for a pass of finalization either
+    return GetThreadNULLOk() == g_pFinalizerThread || IsFinalizerThread();
 }
 
 void FinalizerThread::EnableFinalization()
@@ -82,6 +91,19 @@ void CallFinalizer(Object* obj)
     }
 }
 
+// #ParallelFinalization
+//
+// By default a single thread runs every finalizer. When FinalizerThreadCount is greater than 1, the finalizer thread
+// starts that many threads less one as helpers once the EE is up, and each pass of finalization wakes the helpers so
+// that all of them drain the finalization queue together. The GC hands out each finalizable object once under its
+// finalize lock, so the threads only contend on that lock. The pass, and FinalizerThreadWait(), completes once the
+// helpers are done as well.
+//
+// The GC returns the objects with critical finalizers only after all the other objects of the queue, and a thread
+// that dequeues one waits until the threads that may still be running a normal finalizer are done, so critical
+// finalizers still run after the normal finalizers that were queued with them. There are no other ordering guarantees
+// between finalizers, and none are kept between threads.
+
 void FinalizerThread::FinalizeAllObjects()
 {
     STATIC_CONTRACT_THROWS;
@@ -90,28 +112,112 @@ void FinalizerThread::FinalizeAllObjects()
 
     FireEtwGCFinalizersBegin_V1(GetClrInstanceId());
 
-    unsigned int fcount = 0;
+    LONG helperThreadCount = VolatileLoad(&s_helperThreadCount);
+    if (helperThreadCount != 0)
+    {
+        s_helperFinalizedCount = 0;
+        s_activeHelperCount = helperThreadCount;
+        hEventHelpersDone->Reset();
+
+        for (LONG i = 0; i < helperThreadCount; i++)
+        {
+            hEventHelperStart[i]->Set();
+        }
+    }
+
+    unsigned int fcount = DrainFinalizationQueue();
+
+    if (helperThreadCount != 0)
+    {
+        {
+            GCX_PREEMP();
+            hEventHelpersDone->Wait(INFINITE, FALSE);
+        }
+
+        fcount += (unsigned int)VolatileLoad(&s_helperFinalizedCount);
+    }
 
-    Object* fobj = GCHeapUtilities::GetGCHeap()->GetNextFinalizable();
+    FireEtwGCFinalizersEnd_V1(fcount, GetClrInstanceId());
+}
+
+// Runs finalizers until the finalization queue is empty, on the finalizer thread or on a helper thread
+unsigned int FinalizerThread::DrainFinalizationQueue()
+{
+    STATIC_CONTRACT_THROWS;
+    STATIC_CONTRACT_GC_TRIGGERS;
+    STATIC_CONTRACT_MODE_COOPERATIVE;
+
+    unsigned int fcount = 0;
 
     Thread *pThread = GetThread();
 
     // Finalize everyone
-    while (fobj && !fQuitFinalizer)
+    while (!fQuitFinalizer)
     {
+        // Counted before dequeuing, so that a thread that dequeues a critical finalizable object afterwards sees that
+        // the object dequeued here may not be finalized yet
+        InterlockedIncrement(&s_finalizingThreadCount);
+
+        Object* fobj = GCHeapUtilities::GetGCHeap()->GetNextFinalizable();
+        if (fobj == NULL)
+        {
+            InterlockedDecrement(&s_finalizingThreadCount);
+            break;
+        }
+
         fcount++;
 
-        CallFinalizer(fobj);
+        // An exception escaping a finalizer is unhandled and takes the process down, so the count does not need to be
+        // restored on that path
+        if (fobj->GetMethodTable()->HasCriticalFinalizer())
+        {
+            InterlockedDecrement(&s_finalizingThreadCount);
+            if (VolatileLoad(&s_finalizingThreadCount) != 0)
+            {
+                WaitForFinalizingThreads(&fobj);
+            }
+
+            CallFinalizer(fobj);
+        }
+        else
+        {
+            CallFinalizer(fobj);
+
+            InterlockedDecrement(&s_finalizingThreadCount);
+        }
 
         // thread abort could be injected by the debugger,
         // but should not be allowed to "leak" out of expression evaluation
-        _ASSERTE(!GetFinalizerThread()->IsAbortRequested());
+        _ASSERTE(!pThread->IsAbortRequested());
 
         pThread->InternalReset();
+    }
+
+    return fcount;
+}
 
-        fobj = GCHeapUtilities::GetGCHeap()->GetNextFinalizable();
+// Waits for the other threads to be done with the normal finalizers they dequeued, before the critical finalizer of
+// the object is run
+void FinalizerThread::WaitForFinalizingThreads(Object **pObj)
+{
+    STATIC_CONTRACT_THROWS;
+    STATIC_CONTRACT_GC_TRIGGERS;
+    STATIC_CONTRACT_MODE_COOPERATIVE;
+
+    OBJECTREF objRef = ObjectToOBJECTREF(*pObj);
+    GCPROTECT_BEGIN(objRef);
+    {
+        GCX_PREEMP();
+
+        DWORD dwSwitchCount = 0;
+        while (VolatileLoad(&s_finalizingThreadCount) != 0)
+        {
+            __SwitchToThread(0, ++dwSwitchCount);
+        }
     }
-    FireEtwGCFinalizersEnd_V1(fcount, GetClrInstanceId());
+    GCPROTECT_END();
+
+    *pObj = OBJECTREFToObject(objRef);
 }
 
 void FinalizerThread::WaitForFinalizerEvent (CLREvent *event)
@@ -301,6 +407,12 @@ VOID FinalizerThread::FinalizerThreadWorker(void *args)
         {
             s_InitializedFinalizerThreadForPlatform = TRUE;
             Thread::InitializationForManagedThreadInNative(GetFinalizerThread());
+
+            // Helper threads are started at the same point, they run finalizers as well
+            if (s_helperThreadLimit != 0)
+            {
+                CreateHelperThreads();
+            }
         }
 
         JitHost::Reclaim();
@@ -423,6 +535,100 @@ DWORD WINAPI FinalizerThread::FinalizerThreadStart(void *args)
     return 0;
 }
 
+void FinalizerThread::CreateHelperThreads()
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_TRIGGERS;
+        MODE_PREEMPTIVE;
+    }
+    CONTRACTL_END;
+
+    // Finalization goes on with the helpers that did start, if any
+    EX_TRY
+    {
+        for (DWORD i = 0; i < s_helperThreadLimit; i++)
+        {
+            Thread *newThread = SetupUnstartedThread();
+            _ASSERTE(newThread != NULL);
+            newThread->SetBackground(TRUE);
+
+            if (!newThread->CreateNewThread(0, &FinalizerHelperThreadStart, newThread, W(".NET Finalizer Helper")))
+            {
+                newThread->DecExternalCount(false);
+                break;
+            }
+
+            if (newThread->StartThread() == 0)
+            {
+                break;
+            }
+        }
+    }
+    EX_CATCH
+    {
+    }
+    EX_END_CATCH(SwallowAllExceptions);
+}
+
+VOID FinalizerThread::FinalizerHelperThreadWorker(void *args)
+{
+    SCAN_IGNORE_THROW;
+    SCAN_IGNORE_TRIGGER;
+
+    unsigned int fcount = DrainFinalizationQueue();
+    InterlockedExchangeAdd(&s_helperFinalizedCount, (LONG)fcount);
+}
+
+DWORD WINAPI FinalizerThread::FinalizerHelperThreadStart(void *args)
+{
+    ClrFlsSetThreadType (ThreadType_Finalizer);
+
+    _ASSERTE(args != NULL);
+    Thread *pThread = (Thread *)args;
+
+    SCAN_IGNORE_THROW;
+    SCAN_IGNORE_TRIGGER;
+
+    if (!pThread->HasStarted())
+    {
+        DestroyThread(pThread);
+        return 0;
+    }
+
+    pThread->SetThreadPriority(THREAD_PRIORITY_HIGHEST);
+    Thread::InitializationForManagedThreadInNative(pThread);
+
+    // The helper takes part in the passes that start once it is counted
+    LONG helperIndex = InterlockedIncrement(&s_helperThreadCount) - 1;
+    _ASSERTE((DWORD)helperIndex < s_helperThreadLimit);
+
+    // Helpers keep waiting for passes during shutdown, the finalizer thread waits for them on its last pass as on any
+    // other and they are not torn down, like the finalizer thread
+    INSTALL_UNHANDLED_MANAGED_EXCEPTION_TRAP;
+    {
+        while (true)
+        {
+            {
+                GCX_PREEMP();
+                hEventHelperStart[helperIndex]->Wait(INFINITE, FALSE);
+            }
+
+            // Unhandled exceptions in finalizers get the same treatment as on the finalizer thread
+            ManagedThreadBase::FinalizerBase(FinalizerHelperThreadWorker);
+
+            if (InterlockedDecrement(&s_activeHelperCount) == 0)
+            {
+                hEventHelpersDone->Set();
+            }
+        }
+    }
+    UNINSTALL_UNHANDLED_MANAGED_EXCEPTION_TRAP;
+
+    return 0;
+}
+
 void FinalizerThread::FinalizerThreadCreate()
 {
     CONTRACTL{
@@ -443,6 +649,23 @@ void FinalizerThread::FinalizerThreadCreate()
     hEventFinalizerToShutDown = new CLREvent();
     hEventFinalizerToShutDown->CreateAutoEvent(FALSE);
 
+    DWORD finalizerThreadCount = CLRConfig::GetConfigValue(CLRConfig::EXTERNAL_FinalizerThreadCount);
+    finalizerThreadCount = min(finalizerThreadCount, (DWORD)GetCurrentProcessCpuCount());
+    if (finalizerThreadCount > 1)
+    {
+        hEventHelpersDone = new CLREvent();
+        hEventHelpersDone->CreateManualEvent(FALSE);
+
+        hEventHelperStart = new CLREvent*[finalizerThreadCount - 1];
+        for (DWORD i = 0; i < finalizerThreadCount - 1; i++)
+        {
+            hEventHelperStart[i] = new CLREvent();
+            hEventHelperStart[i]->CreateAutoEvent(FALSE);
+        }
+
+        s_helperThreadLimit = finalizerThreadCount - 1;
+    }
+
     _ASSERTE(g_pFinalizerThread == 0);
     g_pFinalizerThread = SetupUnstartedThread();
 
@@ -33,6 +33,24 @@ class FinalizerThread
     static void WaitForFinalizerEvent (CLREvent *event);
 
     static void FinalizeAllObjects();
+    static unsigned int DrainFinalizationQueue();
+    static void WaitForFinalizingThreads(Object **pObj);
+
+    // Helper threads run finalizers in parallel with the finalizer thread when
+    // FinalizerThreadCount is greater than 1, see code:FinalizerThread::FinalizeAllObjects
+    static DWORD s_helperThreadLimit;
+    static LONG s_helperThreadCount;
+    static CLREvent **hEventHelperStart;
+    static CLREvent *hEventHelpersDone;
+    static LONG s_activeHelperCount;
+    static LONG s_helperFinalizedCount;
+
+    // Number of threads that may be running a finalizer that is not critical
+    static LONG s_finalizingThreadCount;
+
+    static void CreateHelperThreads();
+    static DWORD WINAPI FinalizerHelperThreadStart(void *args);
+    static VOID FinalizerHelperThreadWorker(void *args);
 
 public:
     static Thread* GetFinalizerThread()
@@ -54,8 +72,8 @@ public:
         fQuitFinalizer = TRUE;
         EnableFinalization();
 
-        // Do not wait for FinalizerThread if the current one is FinalizerThread.
-        if (GetThreadNULLOk() != GetFinalizerThread())
+        // Do not wait for FinalizerThread if the current one is FinalizerThread or one of its helpers.
+        if (!IsCurrentThreadFinalizer())
         {
             // This wait must be alertable to handle cases where the current
             // thread's context is needed (i.e. RCW cleanup)
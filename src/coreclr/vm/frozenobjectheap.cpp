@@ -77,6 +77,115 @@ Object* FrozenObjectHeapManager::TryAllocateObject(PTR_MethodTable type, size_t
 #endif // !FEATURE_BASICFREEZE
 }
 
+// Registers objects that were preinitialized in a native image (see READYTORUN_FROZEN_OBJECTS_HEADER) as a
+// frozen segment where they are. [pStart, pStart + size) is laid out the way FrozenObjectSegment lays out its
+// memory, except that the MethodTable slot of each object holds an index into ppTypes. The indices are replaced
+// with the MethodTables before the segment is registered. This is done once per image, *pSegmentHandle is set
+// when it's done so callers that race with it don't do it again.
+void FrozenObjectHeapManager::RegisterPreinitializedObjects(uint8_t* pStart, size_t size, MethodTable** ppTypes, DWORD numTypes, segment_handle* pSegmentHandle)
+{
+    CONTRACTL
+    {
+        THROWS;
+        MODE_COOPERATIVE;
+    }
+    CONTRACTL_END
+
+#ifndef FEATURE_BASICFREEZE
+    // GC is required to support frozen segments
+    COMPlusThrowHR(COR_E_BADIMAGEFORMAT);
+#else // FEATURE_BASICFREEZE
+
+    CrstHolder ch(&m_Crst);
+
+    if (VolatileLoad(pSegmentHandle) != nullptr)
+    {
+        return;
+    }
+
+    if (!IS_ALIGNED(pStart, DATA_ALIGNMENT) || (size < sizeof(ObjHeader)))
+    {
+        COMPlusThrowHR(COR_E_BADIMAGEFORMAT);
+    }
+
+    uint8_t* pEnd = pStart + size;
+
+    // Validate the whole section before patching anything, so that a bad image doesn't leave
+    // objects with MethodTables behind.
+    uint8_t* pCurrent = pStart + sizeof(ObjHeader);
+    while (pCurrent < pEnd)
+    {
+        if ((size_t)(pEnd - pCurrent) < MIN_OBJECT_SIZE)
+        {
+            COMPlusThrowHR(COR_E_BADIMAGEFORMAT);
+        }
+
+        size_t typeIndex = *reinterpret_cast<size_t*>(pCurrent);
+        if (typeIndex >= numTypes)
+        {
+            COMPlusThrowHR(COR_E_BADIMAGEFORMAT);
+        }
+
+        // Frozen segments aren't scanned by the GC, so the objects can't have references to
+        // the GC heap
+        MethodTable* pMT = ppTypes[typeIndex];
+        if (pMT->ContainsPointers())
+        {
+            COMPlusThrowHR(COR_E_BADIMAGEFORMAT);
+        }
+
+        // Compute it the same way Object::GetSize does but so that the component count can't overflow it
+        size_t objectSize = pMT->GetBaseSize();
+        if (pMT->HasComponentSize())
+        {
+            size_t maxComponents = (size_t)(pEnd - pCurrent) / pMT->RawGetComponentSize();
+            size_t numComponents = reinterpret_cast<ArrayBase*>(pCurrent)->GetNumComponents();
+            if (numComponents > maxComponents)
+            {
+                COMPlusThrowHR(COR_E_BADIMAGEFORMAT);
+            }
+            objectSize += numComponents * pMT->RawGetComponentSize();
+        }
+        objectSize = ALIGN_UP(objectSize, DATA_ALIGNMENT);
+
+        if (objectSize > (size_t)(pEnd - pCurrent))
+        {
+            COMPlusThrowHR(COR_E_BADIMAGEFORMAT);
+        }
+        pCurrent += objectSize;
+    }
+
+    // The end of the last object has to be exactly where the allocated part of the segment ends
+    if (pCurrent != pEnd)
+    {
+        COMPlusThrowHR(COR_E_BADIMAGEFORMAT);
+    }
+
+    pCurrent = pStart + sizeof(ObjHeader);
+    while (pCurrent < pEnd)
+    {
+        Object* object = reinterpret_cast<Object*>(pCurrent);
+        object->SetMethodTable(ppTypes[*reinterpret_cast<size_t*>(pCurrent)]);
+        pCurrent += ALIGN_UP(object->GetSize(), DATA_ALIGNMENT);
+    }
+
+    segment_info si;
+    si.pvMem = pStart;
+    si.ibFirstObject = sizeof(ObjHeader);
+    si.ibAllocated = size;
+    si.ibCommit = size;
+    si.ibReserved = size;
+
+    segment_handle handle = GCHeapUtilities::GetGCHeap()->RegisterFrozenSegment(&si);
+    if (handle == nullptr)
+    {
+        ThrowOutOfMemory();
+    }
+
+    VolatileStore(pSegmentHandle, handle);
+#endif // !FEATURE_BASICFREEZE
+}
+
 // Reserve sizeHint bytes of memory for the given frozen segment.
 // The requested size can be be ignored in case of memory pressure and FOH_SEGMENT_DEFAULT_SIZE is used instead.
 FrozenObjectSegment::FrozenObjectSegment(size_t sizeHint) :
@@ -28,6 +28,7 @@ class FrozenObjectHeapManager
 public:
     FrozenObjectHeapManager();
     Object* TryAllocateObject(PTR_MethodTable type, size_t objectSize);
+    void RegisterPreinitializedObjects(uint8_t* pStart, size_t size, MethodTable** ppTypes, DWORD numTypes, segment_handle* pSegmentHandle);
 
 private:
     Crst m_Crst;
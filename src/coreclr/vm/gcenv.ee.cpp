@@ -11,6 +11,7 @@
  */
 
 #include "gcrefmap.h"
+#include "gcinfodecoder.h"
 
 void GCToEEInterface::SuspendEE(SUSPEND_REASON reason)
 {
@@ -253,6 +254,11 @@ void GCToEEInterface::GcScanRoots(promote_func* fn, int condemned, int max_gen,
 {
     STRESS_LOG1(LF_GCROOTS, LL_INFO10, "GCScan: Promotion Phase = %d\n", sc->promotion);
 
+#ifdef GCINFODECODER_LIVE_SLOT_CACHE
+    // Frames decoded while scanning the threads below can share their live slots
+    GcInfoLiveSlotCache::ScanHolder liveSlotCacheHolder;
+#endif
+
     Thread* pThread = NULL;
     while ((pThread = ThreadStore::GetThreadList(pThread)) != NULL)
     {
@@ -82,6 +82,12 @@ PTR_VOID GCHeapUtilities::GetGCModuleBase()
     return g_gc_module_base;
 }
 
+bool GCHeapUtilities::IsGCInterfaceVersionAtLeast(uint32_t majorVersion, uint32_t minorVersion)
+{
+    return (g_gc_version_info.MajorVersion > majorVersion) ||
+        ((g_gc_version_info.MajorVersion == majorVersion) && (g_gc_version_info.MinorVersion >= minorVersion));
+}
+
 namespace
 {
 
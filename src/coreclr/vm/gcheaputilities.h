@@ -198,6 +198,10 @@ public:
     // Gets a pointer to the module that contains the GC.
     static PTR_VOID GetGCModuleBase();
 
+    // Returns true if the loaded GC implements at least the given version of the GC interface. A standalone
+    // GC may be older than the EE, so IGCHeap methods added in a later minor version must be checked for.
+    static bool IsGCInterfaceVersionAtLeast(uint32_t majorVersion, uint32_t minorVersion);
+
     // Loads (if using a standalone GC) and initializes the GC.
     static HRESULT LoadAndInitialize();
 
@@ -305,6 +305,123 @@ inline void LogAlloc(Object* object)
 #define LogAlloc( object)
 #endif
 
+#ifdef FEATURE_EVENT_TRACE
+// Allocation sampling
+//
+// With the AllocationSampling keyword on, every thread samples an allocation after a random number of
+// allocated bytes that is geometrically distributed with a mean of ALLOCATION_SAMPLING_MEAN_BYTES, so the
+// sampled allocations are an unbiased estimate of where the bytes went no matter how the allocations are
+// sized, and the cost doesn't depend on how often the thread allocates. The bytes are counted with the
+// thread's allocation context so allocations done by the JIT helpers fast paths count as well, but those
+// don't come here; the allocation that gets sampled is the first one that comes to the slow path after
+// the sampling point, which is at most an allocation quantum later. The stack is what tells where the
+// allocation came from, EventPipe stores each distinct stack once and refers to it by id.
+#define ALLOCATION_SAMPLING_MEAN_BYTES (100 * 1024)
+
+// the number of bytes the thread's allocation context will have allocated when we take the next
+// sample, 0 until the first time the thread gets here with sampling on
+thread_local int64_t t_allocationSamplingNextSample = 0;
+thread_local uint64_t t_allocationSamplingRandomState = 0;
+
+static int64_t GetAllocationSamplingInterval()
+{
+    LIMITED_METHOD_CONTRACT;
+
+    uint64_t x = t_allocationSamplingRandomState;
+    if (x == 0)
+    {
+        x = ((uint64_t)(size_t)GetThread() ^ (uint64_t)GetTickCount64()) | 1;
+    }
+
+    // xorshift64*
+    x ^= x >> 12;
+    x ^= x << 25;
+    x ^= x >> 27;
+    t_allocationSamplingRandomState = x;
+    uint64_t r = x * 0x2545F4914F6CDD1DULL;
+
+    // 53 random bits in (0, 1]
+    double u = ((double)(r >> 11) + 1.0) / 9007199254740992.0;
+    return (int64_t)(-log(u) * ALLOCATION_SAMPLING_MEAN_BYTES) + 1;
+}
+
+inline int64_t GetAllocatedBytes(gc_alloc_context* acontext)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    // alloc_bytes counts the whole allocation context when the GC hands it out
+    return acontext->alloc_bytes + acontext->alloc_bytes_uoh - (acontext->alloc_limit - acontext->alloc_ptr);
+}
+
+static void SampleAllocation(Object* orObject, GC_ALLOC_FLAGS flags)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_COOPERATIVE;
+    }
+    CONTRACTL_END;
+
+    if (!GCHeapUtilities::UseThreadAllocationContexts())
+    {
+        return;
+    }
+
+    gc_alloc_context* acontext = GetThreadAllocContext();
+    int64_t allocated = GetAllocatedBytes(acontext);
+    int64_t nextSample = t_allocationSamplingNextSample;
+    if (nextSample == 0)
+    {
+        // sampling just got turned on for this thread, start counting from here
+        t_allocationSamplingNextSample = allocated + GetAllocationSamplingInterval();
+        return;
+    }
+
+    if (allocated < nextSample)
+    {
+        return;
+    }
+
+    t_allocationSamplingNextSample = allocated + GetAllocationSamplingInterval();
+
+    uint32_t allocationKind = 0;
+    if (flags & GC_ALLOC_LARGE_OBJECT_HEAP)
+    {
+        allocationKind = 1;
+    }
+    else if (flags & GC_ALLOC_PINNED_OBJECT_HEAP)
+    {
+        allocationKind = 2;
+    }
+
+    MethodTable* pMT = orObject->GetMethodTable();
+    InlineSString<MAX_CLASSNAME_LENGTH> strTypeName;
+    EX_TRY
+    {
+        TypeHandle(pMT).GetName(strTypeName);
+    }
+    EX_CATCH {}
+    EX_END_CATCH(SwallowAllExceptions)
+
+    // GetAllocContextHeapNumber was added in version 5.2, older standalone GCs report heap 0
+    int heapNumber = 0;
+    if (GCHeapUtilities::IsGCInterfaceVersionAtLeast(5, 2))
+    {
+        heapNumber = GCHeapUtilities::GetGCHeap()->GetAllocContextHeapNumber(acontext);
+    }
+
+    FireEtwAllocationSampled(allocationKind,
+        GetClrInstanceId(),
+        pMT,
+        strTypeName.GetUnicode(),
+        heapNumber,
+        orObject,
+        orObject->GetSize(),
+        (uint64_t)(allocated - nextSample));
+}
+#endif // FEATURE_EVENT_TRACE
+
 // signals completion of the object to GC and sends events if necessary
 template <class TObj>
 void PublishObjectAndNotify(TObj* &orObject, GC_ALLOC_FLAGS flags)
@@ -339,6 +456,11 @@ void PublishObjectAndNotify(TObj* &orObject, GC_ALLOC_FLAGS flags)
     {
         ETW::TypeSystemLog::SendObjectAllocatedEvent(orObject);
     }
+
+    if (ETW_EVENT_ENABLED(MICROSOFT_WINDOWS_DOTNETRUNTIME_PROVIDER_DOTNET_Context, AllocationSampled))
+    {
+        SampleAllocation(orObject, flags);
+    }
 #endif // FEATURE_EVENT_TRACE
 }
 
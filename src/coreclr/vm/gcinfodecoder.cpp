@@ -94,8 +94,8 @@ GcInfoDecoder::GcInfoDecoder(
             , m_ReturnKind(RT_Illegal)
 #ifdef _DEBUG
             , m_Flags( flags )
-            , m_GcInfoAddress(dac_cast<PTR_CBYTE>(gcInfoToken.Info))
 #endif
+            , m_GcInfoAddress(dac_cast<PTR_CBYTE>(gcInfoToken.Info))
            , m_Version(gcInfoToken.Version)
 {
     _ASSERTE( (flags & (DECODE_INTERRUPTIBILITY | DECODE_GC_LIFETIMES)) || (0 == breakOffset) );
@@ -638,6 +638,28 @@ bool GcInfoDecoder::EnumerateLiveSlots(
 
     _ASSERTE( m_Flags & DECODE_GC_LIFETIMES );
 
+#ifdef GCINFODECODER_LIVE_SLOT_CACHE
+    // The slots live at a safepoint are filled in below if we don't have them yet
+    GcInfoLiveSlotCache::Entry* pCacheEntry = NULL;
+    if (!executionAborted && (m_SafePointIndex != m_NumSafePoints))
+    {
+        GcInfoLiveSlotCache* pCache = GcInfoLiveSlotCache::GetCurrent();
+        if (pCache != NULL)
+        {
+            pCacheEntry = pCache->GetEntry(m_GcInfoAddress, m_InstructionOffset);
+            if ((pCacheEntry->GcInfo == m_GcInfoAddress) && (pCacheEntry->InstructionOffset == m_InstructionOffset))
+            {
+                ReportCachedSlots(pCacheEntry, 0, pRD, reportScratchSlots, inputFlags, pCallBack, hCallBack);
+                return true;
+            }
+
+            pCacheEntry->GcInfo = NULL;
+            pCacheEntry->NumSlots = 0;
+            pCacheEntry->RegisterMask = 0;
+        }
+    }
+#endif // GCINFODECODER_LIVE_SLOT_CACHE
+
     GcSlotDecoder slotDecoder;
 
     UINT32 normBreakOffset = NORMALIZE_CODE_OFFSET(m_InstructionOffset);
@@ -773,14 +795,20 @@ bool GcInfoDecoder::EnumerateLiveSlots(
                         {
                             for(UINT32 slotIndex = readSlots; slotIndex < readSlots + cnt; slotIndex++)
                             {
-                                ReportSlotToGC(slotDecoder,
-                                               slotIndex,
-                                               pRD,
-                                               reportScratchSlots,
-                                               inputFlags,
-                                               pCallBack,
-                                               hCallBack
-                                               );
+                                const GcSlotDesc* pSlot = slotDecoder.GetSlotDesc(slotIndex);
+                                bool isRegister = slotIndex < slotDecoder.GetNumRegisters();
+                                ReportSlotDescToGC(pSlot,
+                                                   isRegister,
+                                                   pRD,
+                                                   reportScratchSlots,
+                                                   inputFlags,
+                                                   pCallBack,
+                                                   hCallBack
+                                                   );
+#ifdef GCINFODECODER_LIVE_SLOT_CACHE
+                                if (pCacheEntry != NULL)
+                                    pCacheEntry = GcInfoLiveSlotCache::AddSlot(pCacheEntry, pSlot, isRegister);
+#endif
                             }
                         }
                         readSlots += cnt;
@@ -801,15 +829,21 @@ bool GcInfoDecoder::EnumerateLiveSlots(
             {
                 if(m_Reader.ReadOneFast())
                 {
-                    ReportSlotToGC(
-                            slotDecoder,
-                            slotIndex,
+                    const GcSlotDesc* pSlot = slotDecoder.GetSlotDesc(slotIndex);
+                    bool isRegister = slotIndex < slotDecoder.GetNumRegisters();
+                    ReportSlotDescToGC(
+                            pSlot,
+                            isRegister,
                             pRD,
                             reportScratchSlots,
                             inputFlags,
                             pCallBack,
                             hCallBack
                             );
+#ifdef GCINFODECODER_LIVE_SLOT_CACHE
+                    if (pCacheEntry != NULL)
+                        pCacheEntry = GcInfoLiveSlotCache::AddSlot(pCacheEntry, pSlot, isRegister);
+#endif
                 }
             }
             goto ReportUntracked;
@@ -977,6 +1011,25 @@ bool GcInfoDecoder::EnumerateLiveSlots(
 
 ReportUntracked:
 
+#ifdef GCINFODECODER_LIVE_SLOT_CACHE
+    if ((pCacheEntry != NULL) && (pCacheEntry->NumSlots + slotDecoder.GetNumUntracked() <= GcInfoLiveSlotCache::MAX_SLOTS_PER_ENTRY))
+    {
+        // We only get here with an entry from a safepoint, so the tracked slots in it are the live ones
+        pCacheEntry->NumLiveTracked = pCacheEntry->NumSlots;
+        for (UINT32 slotIndex = slotDecoder.GetNumTracked(); slotIndex < slotDecoder.GetNumSlots(); slotIndex++)
+        {
+            GcInfoLiveSlotCache::AddSlot(pCacheEntry, slotDecoder.GetSlotDesc(slotIndex), slotIndex < slotDecoder.GetNumRegisters());
+        }
+
+        pCacheEntry->InstructionOffset = m_InstructionOffset;
+        pCacheEntry->GcInfo = m_GcInfoAddress;
+
+        // The slot decoder can only hand out each slot once, so report the untracked ones from the entry
+        ReportCachedSlots(pCacheEntry, pCacheEntry->NumLiveTracked, pRD, reportScratchSlots, inputFlags, pCallBack, hCallBack);
+        goto ExitSuccess;
+    }
+#endif // GCINFODECODER_LIVE_SLOT_CACHE
+
     //------------------------------------------------------------------------------
     // Last report anything untracked
     // But only for the leaf funclet/frame
@@ -1048,6 +1101,92 @@ void GcInfoDecoder::ReportUntrackedSlots(
     }
 }
 
+#ifdef GCINFODECODER_LIVE_SLOT_CACHE
+void GcInfoDecoder::ReportCachedSlots(
+                const GcInfoLiveSlotCache::Entry* pEntry,
+                UINT32              firstSlot,
+                PREGDISPLAY         pRD,
+                bool                reportScratchSlots,
+                unsigned            inputFlags,
+                GCEnumCallback      pCallBack,
+                void *              hCallBack
+                )
+{
+    // Untracked slots are only reported for the leaf funclet/frame, same as in EnumerateLiveSlots
+    UINT32 numSlots = pEntry->NumLiveTracked;
+    if (!(inputFlags & (ParentOfFuncletStackFrame | NoReportUntracked)))
+        numSlots = pEntry->NumSlots;
+
+    for (UINT32 i = firstSlot; i < numSlots; i++)
+    {
+        ReportSlotDescToGC(&pEntry->Slots[i],
+                           (pEntry->RegisterMask & (1 << i)) != 0,
+                           pRD,
+                           (i < pEntry->NumLiveTracked) ? reportScratchSlots : true,
+                           inputFlags,
+                           pCallBack,
+                           hCallBack
+                           );
+    }
+}
+
+static thread_local GcInfoLiveSlotCache* t_pLiveSlotCache = NULL;
+
+GcInfoLiveSlotCache::ScanHolder::ScanHolder()
+{
+    m_pCache = NULL;
+
+    // Scans don't nest, but leave an outer cache alone if they ever do
+    if (t_pLiveSlotCache == NULL)
+    {
+        // The cache is only an optimization, scan without it if we are out of memory
+        m_pCache = new (nothrow) GcInfoLiveSlotCache();
+        if (m_pCache != NULL)
+        {
+            for (UINT32 i = 0; i < NUM_ENTRIES; i++)
+                m_pCache->m_Entries[i].GcInfo = NULL;
+
+            t_pLiveSlotCache = m_pCache;
+        }
+    }
+}
+
+GcInfoLiveSlotCache::ScanHolder::~ScanHolder()
+{
+    if (m_pCache != NULL)
+    {
+        _ASSERTE(t_pLiveSlotCache == m_pCache);
+        t_pLiveSlotCache = NULL;
+        delete m_pCache;
+    }
+}
+
+GcInfoLiveSlotCache* GcInfoLiveSlotCache::GetCurrent()
+{
+    return t_pLiveSlotCache;
+}
+
+GcInfoLiveSlotCache::Entry* GcInfoLiveSlotCache::GetEntry(PTR_CBYTE gcInfo, UINT32 instructionOffset)
+{
+    size_t hash = ((size_t)gcInfo >> 2) ^ ((size_t)instructionOffset * 0x9E3779B1);
+    return &m_Entries[(hash ^ (hash >> 16)) % NUM_ENTRIES];
+}
+
+GcInfoLiveSlotCache::Entry* GcInfoLiveSlotCache::AddSlot(Entry* pEntry, const GcSlotDesc* pSlot, bool isRegister)
+{
+    UINT32 i = pEntry->NumSlots;
+    if (i == MAX_SLOTS_PER_ENTRY)
+        return NULL;
+
+    pEntry->Slots[i] = *pSlot;
+    if (isRegister)
+        pEntry->RegisterMask |= (1 << i);
+
+    pEntry->NumSlots = i + 1;
+    return pEntry;
+}
+#endif // GCINFODECODER_LIVE_SLOT_CACHE
+
 void GcSlotDecoder::DecodeSlotTable(BitStreamReader& reader)
 {
     if (reader.ReadOneFast())
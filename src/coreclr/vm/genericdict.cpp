@@ -481,6 +481,11 @@ DictionaryEntryLayout::GetKind()
 }
 
 #ifndef DACCESS_COMPILE
+// Dictionaries are expanded without taking a lock. The expanded copy is published with a compare-exchange, and a thread that
+// loses the race backs out its copy and uses the dictionary published by the winner, expanding it again if the layout grew in
+// the meantime. Slots that are populated in the old dictionary while it is being copied may be missing from the new one, which
+// is fine since empty slots are populated again on their next use, as they already were when the old dictionary was populated
+// after the copy.
 Dictionary* Dictionary::GetMethodDictionaryWithSizeCheck(MethodDesc* pMD, ULONG slotIndex)
 {
     CONTRACT(Dictionary*)
@@ -496,44 +501,41 @@ Dictionary* Dictionary::GetMethodDictionaryWithSizeCheck(MethodDesc* pMD, ULONG
     Dictionary* pDictionary = pMD->GetMethodDictionary();
     DWORD currentDictionarySize = pDictionary->GetDictionarySlotsSize(numGenericArgs);
 
-    if (currentDictionarySize <= (slotIndex * sizeof(DictionaryEntry)))
+    // Only expand the dictionary if the current slot we're trying to use is beyond the size of the dictionary
+    while (currentDictionarySize <= (slotIndex * sizeof(DictionaryEntry)))
     {
-        // Only expand the dictionary if the current slot we're trying to use is beyond the size of the dictionary
+        DictionaryLayout* pDictLayout = pMD->GetDictionaryLayout();
+        InstantiatedMethodDesc* pIMD = pMD->AsInstantiatedMethodDesc();
+        _ASSERTE(pDictLayout != NULL && pDictLayout->GetMaxSlots() > 0);
 
-        // Take lock and check for size again, just in case another thread already resized the dictionary
-        CrstHolder ch(&SystemDomain::SystemModule()->m_DictionaryCrst);
+        DWORD expectedDictionarySlotSize;
+        DWORD expectedDictionaryAllocSize = DictionaryLayout::GetDictionarySizeFromLayout(numGenericArgs, pDictLayout, &expectedDictionarySlotSize);
+        _ASSERT(currentDictionarySize < expectedDictionarySlotSize);
 
-        pDictionary = pMD->GetMethodDictionary();
-        currentDictionarySize = pDictionary->GetDictionarySlotsSize(numGenericArgs);
+        AllocMemHolder<Dictionary> pNewDictionary(pIMD->GetLoaderAllocator()->GetHighFrequencyHeap()->AllocMem(S_SIZE_T(expectedDictionaryAllocSize)));
 
-        if (currentDictionarySize <= (slotIndex * sizeof(DictionaryEntry)))
+        // Copy old dictionary entry contents
+        for (DWORD i = 0; i < currentDictionarySize / sizeof(DictionaryEntry); i++)
         {
-            DictionaryLayout* pDictLayout = pMD->GetDictionaryLayout();
-            InstantiatedMethodDesc* pIMD = pMD->AsInstantiatedMethodDesc();
-            _ASSERTE(pDictLayout != NULL && pDictLayout->GetMaxSlots() > 0);
-
-            DWORD expectedDictionarySlotSize;
-            DWORD expectedDictionaryAllocSize = DictionaryLayout::GetDictionarySizeFromLayout(numGenericArgs, pDictLayout, &expectedDictionarySlotSize);
-            _ASSERT(currentDictionarySize < expectedDictionarySlotSize);
-
-            Dictionary* pNewDictionary = (Dictionary*)(void*)pIMD->GetLoaderAllocator()->GetHighFrequencyHeap()->AllocMem(S_SIZE_T(expectedDictionaryAllocSize));
-
-            // Copy old dictionary entry contents
-            for (DWORD i = 0; i < currentDictionarySize / sizeof(DictionaryEntry); i++)
-            {
-                // Use VolatileLoadWithoutBarrier to ensure that the compiler won't turn this into memcpy that is not guaranteed to copy pointers atomically
-                *((DictionaryEntry*)pNewDictionary + i) = VolatileLoadWithoutBarrier((DictionaryEntry*)pDictionary + i);
-            }
-
-            DWORD* pSizeSlot = (DWORD*)(pNewDictionary + numGenericArgs);
-            *pSizeSlot = expectedDictionarySlotSize;
-            *pNewDictionary->GetBackPointerSlot(numGenericArgs) = pDictionary;
+            // Use VolatileLoadWithoutBarrier to ensure that the compiler won't turn this into memcpy that is not guaranteed to copy pointers atomically
+            *((DictionaryEntry*)(Dictionary*)pNewDictionary + i) = VolatileLoadWithoutBarrier((DictionaryEntry*)pDictionary + i);
+        }
 
-            // Publish the new dictionary slots to the type.
-            InterlockedExchangeT(&pIMD->m_pPerInstInfo, pNewDictionary);
+        DWORD* pSizeSlot = (DWORD*)((Dictionary*)pNewDictionary + numGenericArgs);
+        *pSizeSlot = expectedDictionarySlotSize;
+        *pNewDictionary->GetBackPointerSlot(numGenericArgs) = pDictionary;
 
+        // Publish the new dictionary slots to the method, unless another thread expanded the dictionary first
+        Dictionary* pPublishedDictionary = InterlockedCompareExchangeT(&pIMD->m_pPerInstInfo, (Dictionary*)pNewDictionary, pDictionary);
+        if (pPublishedDictionary == pDictionary)
+        {
+            pNewDictionary.SuppressRelease();
             pDictionary = pNewDictionary;
+            break;
         }
+
+        pDictionary = pPublishedDictionary;
+        currentDictionarySize = pDictionary->GetDictionarySlotsSize(numGenericArgs);
     }
 
     RETURN pDictionary;
@@ -554,46 +556,43 @@ Dictionary* Dictionary::GetTypeDictionaryWithSizeCheck(MethodTable* pMT, ULONG s
     Dictionary* pDictionary = pMT->GetDictionary();
     DWORD currentDictionarySize = pDictionary->GetDictionarySlotsSize(numGenericArgs);
 
-    if (currentDictionarySize <= (slotIndex * sizeof(DictionaryEntry)))
+    // Only expand the dictionary if the current slot we're trying to use is beyond the size of the dictionary
+    while (currentDictionarySize <= (slotIndex * sizeof(DictionaryEntry)))
     {
-        // Only expand the dictionary if the current slot we're trying to use is beyond the size of the dictionary
+        DictionaryLayout* pDictLayout = pMT->GetClass()->GetDictionaryLayout();
+        _ASSERTE(pDictLayout != NULL && pDictLayout->GetMaxSlots() > 0);
 
-        // Take lock and check for size again, just in case another thread already resized the dictionary
-        CrstHolder ch(&SystemDomain::SystemModule()->m_DictionaryCrst);
+        DWORD expectedDictionarySlotSize;
+        DWORD expectedDictionaryAllocSize = DictionaryLayout::GetDictionarySizeFromLayout(numGenericArgs, pDictLayout, &expectedDictionarySlotSize);
+        _ASSERT(currentDictionarySize < expectedDictionarySlotSize);
 
-        pDictionary = pMT->GetDictionary();
-        currentDictionarySize = pDictionary->GetDictionarySlotsSize(numGenericArgs);
+        // Expand type dictionary
+        AllocMemHolder<Dictionary> pNewDictionary(pMT->GetLoaderAllocator()->GetHighFrequencyHeap()->AllocMem(S_SIZE_T(expectedDictionaryAllocSize)));
 
-        if (currentDictionarySize <= (slotIndex * sizeof(DictionaryEntry)))
+        // Copy old dictionary entry contents
+        for (DWORD i = 0; i < currentDictionarySize / sizeof(DictionaryEntry); i++)
         {
-            DictionaryLayout* pDictLayout = pMT->GetClass()->GetDictionaryLayout();
-            _ASSERTE(pDictLayout != NULL && pDictLayout->GetMaxSlots() > 0);
-
-            DWORD expectedDictionarySlotSize;
-            DWORD expectedDictionaryAllocSize = DictionaryLayout::GetDictionarySizeFromLayout(numGenericArgs, pDictLayout, &expectedDictionarySlotSize);
-            _ASSERT(currentDictionarySize < expectedDictionarySlotSize);
-
-            // Expand type dictionary
-            Dictionary* pNewDictionary = (Dictionary*)(void*)pMT->GetLoaderAllocator()->GetHighFrequencyHeap()->AllocMem(S_SIZE_T(expectedDictionaryAllocSize));
-
-            // Copy old dictionary entry contents
-            for (DWORD i = 0; i < currentDictionarySize / sizeof(DictionaryEntry); i++)
-            {
-                // Use VolatileLoadWithoutBarrier to ensure that the compiler won't turn this into memcpy that is not guaranteed to copy pointers atomically
-                *((DictionaryEntry*)pNewDictionary + i) = VolatileLoadWithoutBarrier((DictionaryEntry*)pDictionary + i);
-            }
-
-            DWORD* pSizeSlot = (DWORD*)(pNewDictionary + numGenericArgs);
-            *pSizeSlot = expectedDictionarySlotSize;
-            *pNewDictionary->GetBackPointerSlot(numGenericArgs) = pDictionary;
+            // Use VolatileLoadWithoutBarrier to ensure that the compiler won't turn this into memcpy that is not guaranteed to copy pointers atomically
+            *((DictionaryEntry*)(Dictionary*)pNewDictionary + i) = VolatileLoadWithoutBarrier((DictionaryEntry*)pDictionary + i);
+        }
 
-            // Publish the new dictionary slots to the type.
-            ULONG dictionaryIndex = pMT->GetNumDicts() - 1;
-            Dictionary** pPerInstInfo = pMT->GetPerInstInfo();
-            InterlockedExchangeT(pPerInstInfo + dictionaryIndex, pNewDictionary);
+        DWORD* pSizeSlot = (DWORD*)((Dictionary*)pNewDictionary + numGenericArgs);
+        *pSizeSlot = expectedDictionarySlotSize;
+        *pNewDictionary->GetBackPointerSlot(numGenericArgs) = pDictionary;
 
+        // Publish the new dictionary slots to the type, unless another thread expanded the dictionary first
+        ULONG dictionaryIndex = pMT->GetNumDicts() - 1;
+        Dictionary** pPerInstInfo = pMT->GetPerInstInfo();
+        Dictionary* pPublishedDictionary = InterlockedCompareExchangeT(pPerInstInfo + dictionaryIndex, (Dictionary*)pNewDictionary, pDictionary);
+        if (pPublishedDictionary == pDictionary)
+        {
+            pNewDictionary.SuppressRelease();
             pDictionary = pNewDictionary;
+            break;
         }
+
+        pDictionary = pPublishedDictionary;
+        currentDictionarySize = pDictionary->GetDictionarySlotsSize(numGenericArgs);
     }
 
     RETURN pDictionary;
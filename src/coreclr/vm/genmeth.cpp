@@ -333,19 +333,12 @@ InstantiatedMethodDesc::NewInstantiatedMethodDesc(MethodTable *pExactMT,
     pAllocator->EnsureInstantiation(pExactMT->GetLoaderModule(), pExactMT->GetInstantiation());
     pAllocator->EnsureInstantiation(pGenericMDescInRepMT->GetLoaderModule(), methodInst);
 
-    {
-        // Acquire crst to prevent tripping up other threads searching in the same hashtable
-        CrstHolder ch(&pExactMDLoaderModule->m_InstMethodHashTableCrst);
-
-        // Check whether another thread beat us to it!
-        pNewMD = FindLoadedInstantiatedMethodDesc(pExactMT,
-                                                  pGenericMDescInRepMT->GetMemberDef(),
-                                                  methodInst,
-                                                  getWrappedCode);
-
-        // Crst goes out of scope here
-        // We don't need to hold the crst while we build the MethodDesc, but we reacquire it later
-    }
+    // Check whether another thread beat us to it! Lookups in the hash table are lock-free, the crst is
+    // only taken later to insert the new MethodDesc.
+    pNewMD = FindLoadedInstantiatedMethodDesc(pExactMT,
+                                              pGenericMDescInRepMT->GetMemberDef(),
+                                              methodInst,
+                                              getWrappedCode);
 
     if (pNewMD != NULL)
     {
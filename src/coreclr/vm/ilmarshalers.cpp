@@ -4231,6 +4231,84 @@ void ILNativeArrayMarshaler::EmitConvertSpaceCLRToNative(ILCodeStream* pslILEmit
     ILMngdMarshaler::EmitConvertSpaceCLRToNative(pslILEmit);
 }
 
+void ILNativeArrayMarshaler::EmitConvertSpaceCLRToNativeTemp(ILCodeStream* pslILEmit)
+{
+    STANDARD_VM_CONTRACT;
+
+    CREATE_MARSHALER_CARRAY_OPERANDS mops;
+    m_pargs->m_pMarshalInfo->GetMops(&mops);
+
+    // Arrays passed by value that cannot be pinned are converted into a temporary native buffer, which is allocated on
+    // the stack when it is small enough instead of with CoTaskMemAlloc. The element size is only known here for
+    // element types that MngdNativeArrayMarshaler::ConvertSpaceToNative would not reject.
+    UINT cbElement = IsByref(m_dwMarshalFlags) ? 0 : OleVariant::GetElementSizeForVarType(mops.elementType, mops.methodTable);
+    if (cbElement == 0 || cbElement > MAX_LOCAL_BUFFER_LENGTH)
+    {
+        EmitConvertSpaceCLRToNative(pslILEmit);
+        return;
+    }
+
+    ILCodeLabel* pNoOptimize = pslILEmit->NewCodeLabel();
+    ILCodeLabel* pAllocRejoin = pslILEmit->NewCodeLabel();
+    DWORD dwSizeLocalNum = pslILEmit->NewLocal(ELEMENT_TYPE_I4);
+    m_dwLocalBuffer = pslILEmit->NewLocal(ELEMENT_TYPE_I);
+
+    // LocalBuffer = 0
+    pslILEmit->EmitLoadNullPtr();
+    pslILEmit->EmitSTLOC(m_dwLocalBuffer);
+
+    // if (managed == null) goto NoOptimize
+    EmitLoadManagedValue(pslILEmit);
+    pslILEmit->EmitBRFALSE(pNoOptimize);
+
+    // Empty arrays are marshaled as non-null pointers, which localloc does not guarantee
+    // if (length == 0 || length > MAX_LOCAL_BUFFER_LENGTH / cbElement) goto NoOptimize
+    EmitLoadManagedValue(pslILEmit);
+    pslILEmit->EmitLDLEN();
+    pslILEmit->EmitCONV_I4();
+    pslILEmit->EmitSTLOC(dwSizeLocalNum);
+    pslILEmit->EmitLDLOC(dwSizeLocalNum);
+    pslILEmit->EmitBRFALSE(pNoOptimize);
+    pslILEmit->EmitLDLOC(dwSizeLocalNum);
+    pslILEmit->EmitLDC(MAX_LOCAL_BUFFER_LENGTH / cbElement);
+    pslILEmit->EmitCGT_UN();
+    pslILEmit->EmitBRTRUE(pNoOptimize);
+
+    // alloc_size_in_bytes = length * cbElement
+    pslILEmit->EmitLDLOC(dwSizeLocalNum);
+    pslILEmit->EmitLDC(cbElement);
+    pslILEmit->EmitMUL();
+    pslILEmit->EmitSTLOC(dwSizeLocalNum);
+
+    pslILEmit->EmitLDLOC(dwSizeLocalNum);
+    pslILEmit->EmitLOCALLOC();
+    pslILEmit->EmitSTLOC(m_dwLocalBuffer);
+
+    // The native array is zero-initialized, as it is by ConvertSpaceToNative
+    pslILEmit->EmitLDLOC(m_dwLocalBuffer);
+    pslILEmit->EmitLDC(0);
+    pslILEmit->EmitLDLOC(dwSizeLocalNum);
+    pslILEmit->EmitINITBLK();
+
+    pslILEmit->EmitLDLOC(m_dwLocalBuffer);
+    EmitStoreNativeValue(pslILEmit);
+    pslILEmit->EmitBR(pAllocRejoin);
+
+    pslILEmit->EmitLabel(pNoOptimize);
+
+    EmitConvertSpaceCLRToNative(pslILEmit);
+
+    pslILEmit->EmitLabel(pAllocRejoin);
+}
+
+void ILNativeArrayMarshaler::EmitConvertSpaceAndContentsCLRToNativeTemp(ILCodeStream* pslILEmit)
+{
+    STANDARD_VM_CONTRACT;
+
+    EmitConvertSpaceCLRToNativeTemp(pslILEmit);
+    EmitConvertContentsCLRToNative(pslILEmit);
+}
+
 void ILNativeArrayMarshaler::EmitClearNative(ILCodeStream* pslILEmit)
 {
     STANDARD_VM_CONTRACT;
@@ -4243,6 +4321,33 @@ void ILNativeArrayMarshaler::EmitClearNative(ILCodeStream* pslILEmit)
     pslILEmit->EmitCALL(pslILEmit->GetToken(GetClearNativeMethod()), 3, 0);
 }
 
+void ILNativeArrayMarshaler::EmitClearNativeTemp(ILCodeStream* pslILEmit)
+{
+    STANDARD_VM_CONTRACT;
+
+    if (m_dwLocalBuffer == LOCAL_NUM_UNUSED)
+    {
+        EmitClearNative(pslILEmit);
+        return;
+    }
+
+    ILCodeLabel* pHeapBuffer = pslILEmit->NewCodeLabel();
+    ILCodeLabel* pDone = pslILEmit->NewCodeLabel();
+
+    // if (LocalBuffer == 0) goto HeapBuffer
+    pslILEmit->EmitLDLOC(m_dwLocalBuffer);
+    pslILEmit->EmitBRFALSE(pHeapBuffer);
+
+    // The elements of a stack buffer are cleared, the buffer itself goes away with the stub's frame
+    EmitClearNativeContents(pslILEmit);
+    pslILEmit->EmitBR(pDone);
+
+    pslILEmit->EmitLabel(pHeapBuffer);
+    EmitClearNative(pslILEmit);
+
+    pslILEmit->EmitLabel(pDone);
+}
+
 void ILNativeArrayMarshaler::EmitLoadNativeSize(ILCodeStream* pslILEmit)
 {
     STANDARD_VM_CONTRACT;
@@ -3214,6 +3214,9 @@ public:
     enum
     {
         c_fInOnly               = FALSE,
+
+        // If required buffer length > MAX_LOCAL_BUFFER_LENGTH, don't optimize by allocating memory on stack
+        MAX_LOCAL_BUFFER_LENGTH = (MAX_PATH_FNAME + 1) * 2,
     };
 
     ILNativeArrayMarshaler() :
@@ -3229,6 +3232,7 @@ public:
     {
         LIMITED_METHOD_CONTRACT;
         m_dwSavedSizeArg = LOCAL_NUM_UNUSED;
+        m_dwLocalBuffer = LOCAL_NUM_UNUSED;
     }
 
     bool CanMarshalViaPinning() override;
@@ -3237,7 +3241,10 @@ public:
     void EmitSetupArgumentForMarshalling(ILCodeStream* pslILEmit) override;
     void EmitConvertSpaceNativeToCLR(ILCodeStream* pslILEmit) override;
     void EmitConvertSpaceCLRToNative(ILCodeStream* pslILEmit) override;
+    void EmitConvertSpaceCLRToNativeTemp(ILCodeStream* pslILEmit) override;
+    void EmitConvertSpaceAndContentsCLRToNativeTemp(ILCodeStream* pslILEmit) override;
     void EmitClearNative(ILCodeStream* pslILEmit) override;
+    void EmitClearNativeTemp(ILCodeStream* pslILEmit) override;
     void EmitClearNativeContents(ILCodeStream* pslILEmit) override;
 
     bool SupportsFieldMarshal(UINT* pErrorResID) override
@@ -3259,6 +3266,7 @@ protected:
 
 private :
     DWORD m_dwSavedSizeArg;
+    DWORD m_dwLocalBuffer;      // localloc'ed temp buffer variable or LOCAL_NUM_UNUSED if not used
 };
 
 class MngdNativeArrayMarshaler
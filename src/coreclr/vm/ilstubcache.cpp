@@ -159,6 +159,7 @@ namespace
             case DynamicMethodDesc::StubWrapperDelegate:    return "IL_STUB_WrapperDelegate_Invoke";
             case DynamicMethodDesc::StubTailCallStoreArgs:  return "IL_STUB_StoreTailCallArgs";
             case DynamicMethodDesc::StubTailCallCallTarget: return "IL_STUB_CallTailCallTarget";
+            case DynamicMethodDesc::StubReflectionInvoke:   return "IL_STUB_ReflectionInvoke";
             default:
                 UNREACHABLE_MSG("Unknown stub type");
         }
@@ -276,6 +277,11 @@ MethodDesc* ILStubCache::CreateNewMethodDesc(LoaderHeap* pCreationHeap, MethodTa
         pMD->SetILStubType(DynamicMethodDesc::StubTailCallCallTarget);
     }
     else
+    if (SF_IsReflectionInvokeStub(dwStubFlags))
+    {
+        pMD->SetILStubType(DynamicMethodDesc::StubReflectionInvoke);
+    }
+    else
 #ifdef FEATURE_COMINTEROP
     if (SF_IsCOMStub(dwStubFlags))
     {
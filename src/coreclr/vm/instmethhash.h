@@ -36,7 +36,8 @@ class AllocMemTracker;
 // the way!)
 //
 // The table is safe for multiple readers and a single writer i.e. only one thread
-// can be in InsertMethodDesc but multiple threads can be in FindMethodDesc.
+// can be in InsertMethodDesc (under the module's m_InstMethodHashTableCrst) but multiple
+// threads can be in FindMethodDesc without taking any lock, including while the table grows.
 //========================================================================================
 
 class InstMethodHashTable;
@@ -1830,6 +1830,130 @@ HCIMPL2(void*, JIT_GetSharedGCThreadStaticBase, DomainLocalModule *pDomainLocalM
 HCIMPLEND
 #include <optdefault.h>
 
+// Records the thread static bases of the class in the current thread's table of thread static bases once the class is
+// initialized on the thread, so that the optimized helpers below return them without taking the slow path again. A class
+// whose constructor is still running on the thread, or has recursively accessed its own statics, is not recorded yet.
+static void SetThreadStaticBlockIfInitialized(UINT32 staticBlockIndex, MethodTable * pMT, ThreadLocalModule * pThreadLocalModule)
+{
+    CONTRACTL {
+        THROWS;
+        GC_NOTRIGGER;
+        MODE_COOPERATIVE;
+    } CONTRACTL_END;
+
+    if (pThreadLocalModule->IsClassInitialized(pMT))
+    {
+        ThreadStatics::GetCurrentTLB()->SetThreadStaticBlock(staticBlockIndex, pThreadLocalModule);
+    }
+}
+
+HCIMPL1(void*, JIT_GetNonGCThreadStaticBaseOptimized_Helper, UINT32 staticBlockIndex)
+{
+    FCALL_CONTRACT;
+
+    void* base = NULL;
+
+    HELPER_METHOD_FRAME_BEGIN_RET_0();
+
+    MethodTable * pMT = ThreadStatics::GetThreadStaticBlockType(staticBlockIndex);
+
+    // Get the TLM
+    ThreadLocalModule * pThreadLocalModule = ThreadStatics::GetTLM(pMT);
+    _ASSERTE(pThreadLocalModule != NULL);
+
+    // Check if the class constructor needs to be run
+    pThreadLocalModule->CheckRunClassInitThrowing(pMT);
+
+    // Lookup the non-GC statics base pointer
+    base = (void*) pMT->GetNonGCThreadStaticsBasePointer();
+    CONSISTENCY_CHECK(base != NULL);
+
+    SetThreadStaticBlockIfInitialized(staticBlockIndex, pMT, pThreadLocalModule);
+
+    HELPER_METHOD_FRAME_END();
+
+    return base;
+}
+HCIMPLEND
+
+HCIMPL1(void*, JIT_GetGCThreadStaticBaseOptimized_Helper, UINT32 staticBlockIndex)
+{
+    FCALL_CONTRACT;
+
+    void* base = NULL;
+
+    HELPER_METHOD_FRAME_BEGIN_RET_0();
+
+    MethodTable * pMT = ThreadStatics::GetThreadStaticBlockType(staticBlockIndex);
+
+    // Get the TLM
+    ThreadLocalModule * pThreadLocalModule = ThreadStatics::GetTLM(pMT);
+    _ASSERTE(pThreadLocalModule != NULL);
+
+    // Check if the class constructor needs to be run
+    pThreadLocalModule->CheckRunClassInitThrowing(pMT);
+
+    SetThreadStaticBlockIfInitialized(staticBlockIndex, pMT, pThreadLocalModule);
+
+    // Lookup the GC statics base pointer, after anything that may trigger a GC
+    base = (void*) pMT->GetGCThreadStaticsBasePointer();
+    CONSISTENCY_CHECK(base != NULL);
+
+    HELPER_METHOD_FRAME_END();
+
+    return base;
+}
+HCIMPLEND
+
+// *** This helper corresponds to CORINFO_HELP_GETSHARED_NONGCTHREADSTATIC_BASE_NOCTOR_OPTIMIZED. It is used instead of
+//     CORINFO_HELP_GETSHARED_NONGCTHREADSTATIC_BASE_NOCTOR for classes that have a thread static block index, and reads
+//     the base from the thread's table of thread static bases instead of looking up the ThreadLocalModule and the class
+//     init flags.
+
+#include <optsmallperfcritical.h>
+HCIMPL1(void*, JIT_GetSharedNonGCThreadStaticBaseOptimized, UINT32 staticBlockIndex)
+{
+    FCALL_CONTRACT;
+
+    // If the class has been initialized on this thread, its base is in the table
+    if (staticBlockIndex < t_ThreadStaticBlockInfo.cThreadStaticBlocks)
+    {
+        TADDR base = t_ThreadStaticBlockInfo.pThreadStaticBlocks[staticBlockIndex].pNonGCStaticsBase;
+        if (base != NULL)
+            return (void*)base;
+    }
+
+    // Otherwise go through the slow path, which records the base in the table once the class is initialized
+    ENDFORBIDGC();
+    return HCCALL1(JIT_GetNonGCThreadStaticBaseOptimized_Helper, staticBlockIndex);
+}
+HCIMPLEND
+#include <optdefault.h>
+
+// *** This helper corresponds to CORINFO_HELP_GETSHARED_GCTHREADSTATIC_BASE_NOCTOR_OPTIMIZED, the GC statics counterpart
+//     of JIT_GetSharedNonGCThreadStaticBaseOptimized. The table holds the handle to the GC statics array rather than the
+//     base pointer, as the array may be moved by the GC.
+
+#include <optsmallperfcritical.h>
+HCIMPL1(void*, JIT_GetSharedGCThreadStaticBaseOptimized, UINT32 staticBlockIndex)
+{
+    FCALL_CONTRACT;
+
+    // If the class has been initialized on this thread, the handle to its GC statics is in the table
+    if (staticBlockIndex < t_ThreadStaticBlockInfo.cThreadStaticBlocks)
+    {
+        OBJECTHANDLE hGCStatics = t_ThreadStaticBlockInfo.pThreadStaticBlocks[staticBlockIndex].hGCStatics;
+        if (hGCStatics != NULL)
+            return (void*)((PTRARRAYREF)ObjectFromHandle(hGCStatics))->GetDataPtr();
+    }
+
+    // Otherwise go through the slow path, which records the handle in the table once the class is initialized
+    ENDFORBIDGC();
+    return HCCALL1(JIT_GetGCThreadStaticBaseOptimized_Helper, staticBlockIndex);
+}
+HCIMPLEND
+#include <optdefault.h>
+
 // *** This helper corresponds to CORINFO_HELP_GETSHARED_NONGCTHREADSTATIC_BASE_DYNAMICCLASS
 
 #include <optsmallperfcritical.h>
@@ -4914,6 +5038,13 @@ HCIMPLEND
 // Currently, counter is a pointer into the Tier0 method stack
 // frame so we have exclusive access.
 
+// Flags of the TieredCompilationOsrTransition event
+enum
+{
+    OSR_TRANSITION_TIME_LIMIT = 0x1, // Triggered by OSR_TimeLimitMs before OSR_HitLimit was reached
+    OSR_TRANSITION_FAILED     = 0x2, // The OSR method couldn't be created, the method keeps running Tier0 code
+};
+
 void JIT_Patchpoint(int* counter, int ilOffset)
 {
     // BEGIN_PRESERVE_LAST_ERROR;
@@ -5026,8 +5157,22 @@ void JIT_Patchpoint(int* counter, int ilOffset)
         LOG((LF_TIEREDCOMPILATION, hitLogLevel, "Jit_Patchpoint: patchpoint [%d] (0x%p) hit %d in Method=0x%pM (%s::%s) [il offset %d] (limit %d)\n",
             ppId, ip, hitCount, pMD, pMD->m_pszDebugClassName, pMD->m_pszDebugMethodName, ilOffset, hitLimit));
 
+        // The hit limit is a number of loop iterations, which can take a long time to run
+        // if the loop body is expensive. So also trigger once the patchpoint has been hit
+        // for long enough, with the iteration rate deciding which limit is reached first.
+        const ULONGLONG nowMs = CLRGetTickCount64();
+        if (hitCount == 1)
+        {
+            ppInfo->m_firstHitMs = nowMs;
+        }
+
+        const ULONGLONG firstHitMs = ppInfo->m_firstHitMs;
+        const ULONGLONG tier0Ms = (firstHitMs != 0) && (nowMs > firstHitMs) ? nowMs - firstHitMs : 0;
+        const DWORD timeLimitMs = g_pConfig->OSR_TimeLimitMs();
+        const bool timeLimitReached = (timeLimitMs != 0) && (hitCount > 1) && (tier0Ms >= timeLimitMs);
+
         // Defer, if we haven't yet reached the limit
-        if (hitCount < hitLimit)
+        if ((hitCount < hitLimit) && !timeLimitReached)
         {
             goto DONE;
         }
@@ -5063,11 +5208,26 @@ void JIT_Patchpoint(int* counter, int ilOffset)
         //
         // In this prototype we want to expose bugs in the jitted code
         // for OSR methods, so we stick with synchronous creation.
-        LOG((LF_TIEREDCOMPILATION, LL_INFO10, "Jit_Patchpoint: patchpoint [%d] (0x%p) TRIGGER at count %d\n", ppId, ip, hitCount));
+        LOG((LF_TIEREDCOMPILATION, LL_INFO10, "Jit_Patchpoint: patchpoint [%d] (0x%p) TRIGGER at count %d after %u ms\n", ppId, ip, hitCount, (unsigned)tier0Ms));
 
         // Invoke the helper to build the OSR method
         osrMethodCode = HCCALL3(JIT_Patchpoint_Framed, pMD, codeInfo, ilOffset);
 
+        if (ETW::CompilationLog::TieredCompilation::Runtime::IsEnabled())
+        {
+            UINT32 transitionFlags = 0;
+            if (hitCount < hitLimit)
+            {
+                transitionFlags |= OSR_TRANSITION_TIME_LIMIT;
+            }
+            if (osrMethodCode == NULL)
+            {
+                transitionFlags |= OSR_TRANSITION_FAILED;
+            }
+
+            ETW::CompilationLog::TieredCompilation::Runtime::SendOsrTransition(pMD, ilOffset, hitCount, tier0Ms, transitionFlags);
+        }
+
         // If that failed, mark the patchpoint as invalid.
         if (osrMethodCode == NULL)
         {
@@ -5762,6 +5922,110 @@ HCIMPL3(void, JIT_VTableProfile64, Object* obj, CORINFO_METHOD_HANDLE baseMethod
 }
 HCIMPLEND
 
+// Random number generator for the count profile helpers. Unlike the one used for the handle
+// histograms it is per thread, so that hot counters don't also contend on the generator state.
+// Zero means not seeded yet.
+static thread_local unsigned t_countProfileRand = 0;
+
+static unsigned CountProfileRand()
+{
+    unsigned x = t_countProfileRand;
+    if (x == 0)
+    {
+        // Seed each thread differently, so that threads running the same code don't all
+        // update a counter on the same executions.
+        x = (GetCurrentThreadId() * 2654435761u) ^ GetTickCount();
+        if (x == 0)
+        {
+            x = 100;
+        }
+    }
+
+    // generate a random number (xorshift32)
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    t_countProfileRand = x;
+    return x;
+}
+
+// Counts are exact until they reach 2^COUNT_PROFILE_EXACT_BITS. Jitted code increments them
+// inline until then, so the helpers are normally only called for larger counts.
+#define COUNT_PROFILE_EXACT_BITS 13
+static_assert_no_msg((1 << COUNT_PROFILE_EXACT_BITS) == CORINFO_COUNTPROFILE_EXACT_LIMIT);
+
+// Gets the amount to add to a profile counter of the given value, or 0 if this execution
+// shouldn't update the counter.
+//
+// Past 2^COUNT_PROFILE_EXACT_BITS the counter is increased by 2^k with probability 2^-k,
+// where k grows with the count so that the relative error stays small. The expected count
+// is still exact, but only one in 2^k executions writes the counter, so threads running
+// hot Tier0 code on many cores don't keep stealing the counter's cache line from each other.
+template<typename T>
+static T GetCountProfileDelta(T count)
+{
+    static_assert_no_msg((std::is_same<T, uint32_t>::value || std::is_same<T, uint64_t>::value));
+
+    if (count < ((T)1 << COUNT_PROFILE_EXACT_BITS))
+    {
+        return 1;
+    }
+
+    unsigned logCount = 0;
+    for (T c = count >> COUNT_PROFILE_EXACT_BITS; c != 0; c >>= 1)
+    {
+        logCount++;
+    }
+
+    // Keep k within what the 32-bit random number can sample.
+    unsigned shift = min(logCount, 31u);
+    if ((CountProfileRand() & ((1u << shift) - 1)) != 0)
+    {
+        return 0;
+    }
+
+    return (T)1 << shift;
+}
+
+HCIMPL1(void, JIT_CountProfile32, volatile LONG* pCounter)
+{
+    FCALL_CONTRACT;
+    FC_GC_POLL_NOT_NEEDED();
+
+    uint32_t count = (uint32_t)*pCounter;
+    uint32_t delta = GetCountProfileDelta<uint32_t>(count);
+    if (delta == 1)
+    {
+        // Exact counts are racy, like the inline increment.
+        *pCounter = (LONG)(count + 1);
+    }
+    else if (delta != 0)
+    {
+        InterlockedExchangeAdd(pCounter, (LONG)delta);
+    }
+}
+HCIMPLEND
+
+// Version of helper above used when the count is 64-bit
+HCIMPL1(void, JIT_CountProfile64, volatile LONG64* pCounter)
+{
+    FCALL_CONTRACT;
+    FC_GC_POLL_NOT_NEEDED();
+
+    uint64_t count = (uint64_t)*pCounter;
+    uint64_t delta = GetCountProfileDelta<uint64_t>(count);
+    if (delta == 1)
+    {
+        // Exact counts are racy, like the inline increment.
+        *pCounter = (LONG64)(count + 1);
+    }
+    else if (delta != 0)
+    {
+        InterlockedExchangeAdd64(pCounter, (LONG64)delta);
+    }
+}
+HCIMPLEND
+
 //========================================================================
 //
 //      INTEROP HELPERS
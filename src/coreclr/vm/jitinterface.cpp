@@ -1540,6 +1540,20 @@ void CEEInfo::getFieldInfo (CORINFO_RESOLVED_TOKEN * pResolvedToken,
                 fieldAccessor = CORINFO_FIELD_STATIC_SHARED_STATIC_HELPER;
 
                 pResult->helper = getSharedStaticsHelper(pField, pFieldMT);
+
+                // Thread statics of classes that are not collectible are looked up in the thread's table of thread static
+                // bases (see getThreadLocalStaticBlockIndex)
+                if (!pFieldMT->Collectible())
+                {
+                    if (pResult->helper == CORINFO_HELP_GETSHARED_NONGCTHREADSTATIC_BASE_NOCTOR)
+                    {
+                        pResult->helper = CORINFO_HELP_GETSHARED_NONGCTHREADSTATIC_BASE_NOCTOR_OPTIMIZED;
+                    }
+                    else if (pResult->helper == CORINFO_HELP_GETSHARED_GCTHREADSTATIC_BASE_NOCTOR)
+                    {
+                        pResult->helper = CORINFO_HELP_GETSHARED_GCTHREADSTATIC_BASE_NOCTOR_OPTIMIZED;
+                    }
+                }
             }
             else
             {
@@ -5722,6 +5736,26 @@ unsigned CEEInfo::getClassDomainID (CORINFO_CLASS_HANDLE clsHnd,
     return result;
 }
 
+/***********************************************************************/
+uint32_t CEEInfo::getThreadLocalStaticBlockIndex (CORINFO_CLASS_HANDLE clsHnd)
+{
+    CONTRACTL {
+        THROWS;
+        GC_TRIGGERS;
+        MODE_PREEMPTIVE;
+    } CONTRACTL_END;
+
+    uint32_t result = 0;
+
+    JIT_TO_EE_TRANSITION();
+
+    result = ThreadStatics::GetThreadStaticBlockIndex(TypeHandle(clsHnd).AsMethodTable());
+
+    EE_TO_JIT_TRANSITION();
+
+    return result;
+}
+
 //---------------------------------------------------------------------------------------
 //
 // Used by the JIT to determine whether the profiler or IBC is tracking object
@@ -10715,6 +10749,39 @@ uint32_t CEEInfo::getJitFlags(CORJIT_FLAGS* jitFlags, uint32_t sizeInBytes)
     return sizeof(m_jitFlags);
 }
 
+/*********************************************************************/
+void CEEInfo::reportJitPhaseTelemetry(const JitPhaseTelemetry* telemetry)
+{
+    CONTRACTL {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_PREEMPTIVE;
+    } CONTRACTL_END;
+
+    JIT_TO_EE_TRANSITION_LEAF();
+
+    // The session may have gone away since we set CORJIT_FLAG_PHASE_TELEMETRY.
+    if (ETW_EVENT_ENABLED(MICROSOFT_WINDOWS_DOTNETRUNTIME_PROVIDER_DOTNET_Context, MethodJitPhaseTelemetry))
+    {
+        // Keep the counts within the event's UInt16 fields; the JIT reports far fewer
+        // phases and memory kinds than that.
+        _ASSERTE((telemetry->phaseCount <= USHRT_MAX) && (telemetry->memKindCount <= USHRT_MAX));
+
+        FireEtwMethodJitPhaseTelemetry((ULONGLONG)m_pMethodBeingCompiled,
+                                       telemetry->totalCycles,
+                                       telemetry->totalArenaBytes,
+                                       (USHORT)telemetry->phaseCount,
+                                       telemetry->phaseIds,
+                                       telemetry->phaseCycles,
+                                       (USHORT)telemetry->memKindCount,
+                                       telemetry->memKindIds,
+                                       telemetry->memKindBytes,
+                                       GetClrInstanceId());
+    }
+
+    EE_TO_JIT_TRANSITION_LEAF();
+}
+
 /*********************************************************************/
 #if !defined(TARGET_UNIX)
 
@@ -11096,6 +11163,14 @@ void CEEJitInfo::WriteCodeBytes()
         ExecutableWriterHolder<void> codeWriterHolder((void *)m_CodeHeader, m_codeWriteBufferSize);
         memcpy(codeWriterHolder.GetRW(), m_CodeHeaderRW, m_codeWriteBufferSize);
     }
+
+#ifdef FEATURE_JIT_HOT_COLD_SPLITTING
+    if (m_ColdCodeHeaderRW != m_ColdCodeHeader)
+    {
+        ExecutableWriterHolder<void> coldCodeWriterHolder((void *)m_ColdCodeHeader, m_coldCodeWriteBufferSize);
+        memcpy(coldCodeWriterHolder.GetRW(), m_ColdCodeHeaderRW, m_coldCodeWriteBufferSize);
+    }
+#endif
 }
 
 /*********************************************************************/
@@ -11133,6 +11208,12 @@ void CEEJitInfo::WriteCode(EEJitManager * jitMgr)
 
     // Now that the code header was written to the final location, publish the code via the nibble map
     jitMgr->NibbleMapSet(m_pCodeHeap, m_CodeHeader->GetCodeStartAddress(), TRUE);
+#ifdef FEATURE_JIT_HOT_COLD_SPLITTING
+    if (m_ColdCodeHeader != NULL)
+    {
+        jitMgr->NibbleMapSet(m_pCodeHeap, m_ColdCodeHeader->GetCodeStartAddress(), TRUE);
+    }
+#endif
 
 #if defined(TARGET_AMD64)
     // Publish the new unwind information in a way that the ETW stack crawler can find
@@ -11367,7 +11448,9 @@ void CEEJitInfo::reserveUnwindInfo(bool isFunclet, bool isColdCode, uint32_t unw
 
     JIT_TO_EE_TRANSITION_LEAF();
 
+#ifndef FEATURE_JIT_HOT_COLD_SPLITTING
     CONSISTENCY_CHECK_MSG(!isColdCode, "Hot/Cold splitting is not supported in jitted code");
+#endif
     _ASSERTE_MSG(m_theUnwindBlock == NULL,
         "reserveUnwindInfo() can only be called before allocMem(), but allocMem() has already been called. "
         "This may indicate the JIT has hit a NO_WAY assert after calling allocMem(), and is re-JITting. "
@@ -11375,6 +11458,16 @@ void CEEJitInfo::reserveUnwindInfo(bool isFunclet, bool isColdCode, uint32_t unw
 
     uint32_t currentSize  = unwindSize;
 
+#if defined(FEATURE_JIT_HOT_COLD_SPLITTING) && defined(TARGET_AMD64)
+    if (isColdCode && !isFunclet)
+    {
+        // The JIT does not give us unwind codes for the cold part of the main body,
+        // we chain it to the hot part in allocUnwindInfo
+        _ASSERTE(unwindSize == 0);
+        currentSize = offsetof(UNWIND_INFO, UnwindCode) + sizeof(T_RUNTIME_FUNCTION);
+    }
+#endif
+
     reservePersonalityRoutineSpace(currentSize);
 
     m_totalUnwindSize += currentSize;
@@ -11401,9 +11494,9 @@ void CEEJitInfo::reserveUnwindInfo(bool isFunclet, bool isColdCode, uint32_t unw
 // Parameters:
 //
 //    pHotCode        main method code buffer, always filled in
-//    pColdCode       always NULL for jitted code
-//    startOffset     start of code block, relative to pHotCode
-//    endOffset       end of code block, relative to pHotCode
+//    pColdCode       cold code buffer, only filled in if this is cold code
+//    startOffset     start of code block, relative to pHotCode or to pColdCode for cold code
+//    endOffset       end of code block, relative to pHotCode or to pColdCode for cold code
 //    unwindSize      size of unwind info pointed to by pUnwindBlock
 //    pUnwindBlock    pointer to unwind info
 //    funcKind        type of funclet (main method code, handler, filter)
@@ -11426,10 +11519,18 @@ void CEEJitInfo::allocUnwindInfo (
         PRECONDITION(m_theUnwindBlock != NULL);
         PRECONDITION(m_usedUnwindSize < m_totalUnwindSize);
         PRECONDITION(m_usedUnwindInfos < m_totalUnwindInfos);
+#ifdef FEATURE_JIT_HOT_COLD_SPLITTING
+        PRECONDITION(endOffset <= ((pColdCode != NULL) ? m_coldCodeSize : m_codeSize));
+#else
         PRECONDITION(endOffset <= m_codeSize);
+#endif
     } CONTRACTL_END;
 
+#ifdef FEATURE_JIT_HOT_COLD_SPLITTING
+    _ASSERTE(pColdCode == NULL || (m_ColdCodeHeader != NULL && pColdCode == (uint8_t *)m_ColdCodeHeader->GetCodeStartAddress()));
+#else
     CONSISTENCY_CHECK_MSG(pColdCode == NULL, "Hot/Cold code splitting not supported for jitted code");
+#endif
 
     JIT_TO_EE_TRANSITION();
 
@@ -11462,6 +11563,21 @@ void CEEJitInfo::allocUnwindInfo (
     UNWIND_INFO * pUnwindInfo = (UNWIND_INFO *) &(m_theUnwindBlock[m_usedUnwindSize]);
     UNWIND_INFO * pUnwindInfoRW = (UNWIND_INFO *)((BYTE*)pUnwindInfo + writeableOffset);
 
+#ifdef FEATURE_JIT_HOT_COLD_SPLITTING
+    bool isColdRoot = (pColdCode != NULL) && (funcKind == CORJIT_FUNC_ROOT);
+    if (isColdRoot)
+    {
+        // Remember which unwind info starts the cold part of the main body
+        m_CodeHeaderRW->GetColdCodeInfo()->coldRootUnwindInfo = m_usedUnwindInfos - 1;
+
+#ifdef TARGET_AMD64
+        // Matches the space reserved in reserveUnwindInfo
+        _ASSERTE(unwindSize == 0);
+        unwindSize = offsetof(UNWIND_INFO, UnwindCode) + sizeof(T_RUNTIME_FUNCTION);
+#endif
+    }
+#endif // FEATURE_JIT_HOT_COLD_SPLITTING
+
     m_usedUnwindSize += unwindSize;
 
     reservePersonalityRoutineSpace(m_usedUnwindSize);
@@ -11475,7 +11591,12 @@ void CEEJitInfo::allocUnwindInfo (
 
     TADDR baseAddress = m_moduleBase;
 
+#ifdef FEATURE_JIT_HOT_COLD_SPLITTING
+    // Both parts of a split method are in the same code heap, so they share the base
+    size_t currentCodeSizeT = (size_t)((pColdCode != NULL) ? pColdCode : pHotCode) - baseAddress;
+#else
     size_t currentCodeSizeT = (size_t)pHotCode - baseAddress;
+#endif
 
     /* Check if currentCodeSizeT offset fits in 32-bits */
     if (!FitsInU4(currentCodeSizeT))
@@ -11527,41 +11648,61 @@ void CEEJitInfo::allocUnwindInfo (
     }
 #endif // _DEBUG
 
-    memcpy(pUnwindInfoRW, pUnwindBlock, unwindSize);
+#if defined(FEATURE_JIT_HOT_COLD_SPLITTING) && defined(TARGET_AMD64)
+    if (isColdRoot)
+    {
+        // Chain the cold part to the unwind info of the hot part, which is always the first one.
+        // Chained unwind info takes the handler from the primary one, so there are no flags to set.
+        PT_RUNTIME_FUNCTION pHotRuntimeFunction = m_CodeHeaderRW->GetUnwindInfo(0);
+        UNWIND_INFO * pHotUnwindInfoRW = (UNWIND_INFO *)(baseAddress + RUNTIME_FUNCTION__GetUnwindInfoAddress(pHotRuntimeFunction) + writeableOffset);
+
+        pUnwindInfoRW->Version = 1;
+        pUnwindInfoRW->Flags = UNW_FLAG_CHAININFO;
+        pUnwindInfoRW->SizeOfProlog = 0;
+        pUnwindInfoRW->CountOfUnwindCodes = 0;
+        pUnwindInfoRW->FrameRegister = pHotUnwindInfoRW->FrameRegister;
+        pUnwindInfoRW->FrameOffset = pHotUnwindInfoRW->FrameOffset;
+        memcpy(&pUnwindInfoRW->UnwindCode[0], pHotRuntimeFunction, sizeof(T_RUNTIME_FUNCTION));
+    }
+    else
+#endif
+    {
+        memcpy(pUnwindInfoRW, pUnwindBlock, unwindSize);
 
 #if defined(TARGET_X86)
 
-    // Do NOTHING
+        // Do NOTHING
 
 #elif defined(TARGET_AMD64)
 
-    pUnwindInfoRW->Flags = UNW_FLAG_EHANDLER | UNW_FLAG_UHANDLER;
+        pUnwindInfoRW->Flags = UNW_FLAG_EHANDLER | UNW_FLAG_UHANDLER;
 
-    ULONG * pPersonalityRoutineRW = (ULONG*)ALIGN_UP(&(pUnwindInfoRW->UnwindCode[pUnwindInfoRW->CountOfUnwindCodes]), sizeof(ULONG));
-    *pPersonalityRoutineRW = ExecutionManager::GetCLRPersonalityRoutineValue();
+        ULONG * pPersonalityRoutineRW = (ULONG*)ALIGN_UP(&(pUnwindInfoRW->UnwindCode[pUnwindInfoRW->CountOfUnwindCodes]), sizeof(ULONG));
+        *pPersonalityRoutineRW = ExecutionManager::GetCLRPersonalityRoutineValue();
 
 #elif defined(TARGET_ARM64)
 
-    *(LONG *)pUnwindInfoRW |= (1 << 20); // X bit
+        *(LONG *)pUnwindInfoRW |= (1 << 20); // X bit
 
-    ULONG * pPersonalityRoutineRW = (ULONG*)((BYTE *)pUnwindInfoRW + ALIGN_UP(unwindSize, sizeof(ULONG)));
-    *pPersonalityRoutineRW = ExecutionManager::GetCLRPersonalityRoutineValue();
+        ULONG * pPersonalityRoutineRW = (ULONG*)((BYTE *)pUnwindInfoRW + ALIGN_UP(unwindSize, sizeof(ULONG)));
+        *pPersonalityRoutineRW = ExecutionManager::GetCLRPersonalityRoutineValue();
 
 #elif defined(TARGET_ARM)
 
-    *(LONG *)pUnwindInfoRW |= (1 << 20); // X bit
+        *(LONG *)pUnwindInfoRW |= (1 << 20); // X bit
 
-    ULONG * pPersonalityRoutineRW = (ULONG*)((BYTE *)pUnwindInfoRW + ALIGN_UP(unwindSize, sizeof(ULONG)));
-    *pPersonalityRoutineRW = (TADDR)ProcessCLRException - baseAddress;
+        ULONG * pPersonalityRoutineRW = (ULONG*)((BYTE *)pUnwindInfoRW + ALIGN_UP(unwindSize, sizeof(ULONG)));
+        *pPersonalityRoutineRW = (TADDR)ProcessCLRException - baseAddress;
 
 #elif defined(TARGET_LOONGARCH64)
 
-    *(LONG *)pUnwindInfoRW |= (1 << 20); // X bit
+        *(LONG *)pUnwindInfoRW |= (1 << 20); // X bit
 
-    ULONG * pPersonalityRoutineRW = (ULONG*)((BYTE *)pUnwindInfoRW + ALIGN_UP(unwindSize, sizeof(ULONG)));
-    *pPersonalityRoutineRW = ExecutionManager::GetCLRPersonalityRoutineValue();
+        ULONG * pPersonalityRoutineRW = (ULONG*)((BYTE *)pUnwindInfoRW + ALIGN_UP(unwindSize, sizeof(ULONG)));
+        *pPersonalityRoutineRW = ExecutionManager::GetCLRPersonalityRoutineValue();
 
 #endif
+    }
 
     EE_TO_JIT_TRANSITION();
 #else // FEATURE_EH_FUNCLETS
@@ -12288,7 +12429,12 @@ void CEEJitInfo::allocMem (AllocMemArgs *pArgs)
 
     JIT_TO_EE_TRANSITION();
 
+#ifdef FEATURE_JIT_HOT_COLD_SPLITTING
+    // Only set by getJitFlags, which never asks for dynamic methods to be split
+    _ASSERTE(pArgs->coldCodeSize == 0 || !m_pMethodBeingCompiled->IsLCGMethod());
+#else
     _ASSERTE(pArgs->coldCodeSize == 0);
+#endif
     if (pArgs->coldCodeBlock)
     {
         pArgs->coldCodeBlock = NULL;
@@ -12368,12 +12514,18 @@ void CEEJitInfo::allocMem (AllocMemArgs *pArgs)
             pArgs->hotCodeSize + pArgs->coldCodeSize, pArgs->roDataSize, totalSize.Value(), pArgs->flag, GetClrInstanceId());
     }
 
-    m_jitManager->allocCode(m_pMethodBeingCompiled, totalSize.Value(), GetReserveForJumpStubs(), pArgs->flag, &m_CodeHeader, &m_CodeHeaderRW, &m_codeWriteBufferSize, &m_pCodeHeap
+    // Tier 1 code is only produced for methods that were found to be called often
+    bool isHotCode = m_jitFlags.IsSet(CORJIT_FLAGS::CORJIT_FLAG_TIER1);
+
+    m_jitManager->allocCode(m_pMethodBeingCompiled, totalSize.Value(), GetReserveForJumpStubs(), pArgs->flag, isHotCode, &m_CodeHeader, &m_CodeHeaderRW, &m_codeWriteBufferSize, &m_pCodeHeap
 #ifdef USE_INDIRECT_CODEHEADER
                           , &m_pRealCodeHeader
 #endif
 #ifdef FEATURE_EH_FUNCLETS
                           , m_totalUnwindInfos
+#endif
+#ifdef FEATURE_JIT_HOT_COLD_SPLITTING
+                          , pArgs->coldCodeSize, &m_ColdCodeHeader, &m_ColdCodeHeaderRW, &m_coldCodeWriteBufferSize
 #endif
                           );
 
@@ -12410,8 +12562,18 @@ void CEEJitInfo::allocMem (AllocMemArgs *pArgs)
 
     _ASSERTE((SIZE_T)(current - (BYTE *)m_CodeHeader->GetCodeStartAddress()) <= totalSize.Value());
 
+#ifdef FEATURE_JIT_HOT_COLD_SPLITTING
+    if (m_ColdCodeHeader != NULL)
+    {
+        BYTE* coldCode = (BYTE *)m_ColdCodeHeader->GetCodeStartAddress();
+        pArgs->coldCodeBlock = coldCode;
+        pArgs->coldCodeBlockRW = coldCode + ((BYTE *)m_ColdCodeHeaderRW - (BYTE *)m_ColdCodeHeader);
+    }
+#endif
+
 #ifdef _DEBUG
     m_codeSize = codeSize;
+    m_coldCodeSize = pArgs->coldCodeSize;
 #endif  // _DEBUG
 
     EE_TO_JIT_TRANSITION();
@@ -12945,6 +13107,22 @@ CORJIT_FLAGS GetCompileFlags(MethodDesc * ftn, CORJIT_FLAGS flags, CORINFO_METHO
         flags.Set(CORJIT_FLAGS::CORJIT_FLAG_BBOPT);
     }
 
+#endif
+
+    // Phase timing is cheap but not free, so only ask for it when someone is listening.
+    if (ETW_EVENT_ENABLED(MICROSOFT_WINDOWS_DOTNETRUNTIME_PROVIDER_DOTNET_Context, MethodJitPhaseTelemetry))
+    {
+        flags.Set(CORJIT_FLAGS::CORJIT_FLAG_PHASE_TELEMETRY);
+    }
+
+#ifdef FEATURE_JIT_HOT_COLD_SPLITTING
+    // Dynamic methods release their code as a whole, so only split code that stays around.
+    // Tier1 code is where the block weights are good enough to tell hot from cold.
+    if (flags.IsSet(CORJIT_FLAGS::CORJIT_FLAG_TIER1) && !ftn->IsLCGMethod() &&
+        CLRConfig::GetConfigValue(CLRConfig::UNSUPPORTED_TC_HotColdSplitting) != 0)
+    {
+        flags.Set(CORJIT_FLAGS::CORJIT_FLAG_PROCSPLIT);
+    }
 #endif
 
     return flags;
@@ -14356,6 +14534,18 @@ BOOL LoadDynamicInfoEntry(Module *currentModule,
             }
             break;
         }
+
+    case ENCODE_FROZEN_OBJECT:
+        {
+            DWORD offset = CorSigUncompressData(pBlob);
+            Object * pObject = currentModule->GetReadyToRunInfo()->GetFrozenObject(offset);
+            if (pObject == NULL)
+            {
+                return FALSE;
+            }
+            result = (size_t)pObject;
+        }
+        break;
 #endif // FEATURE_READYTORUN
     default:
         STRESS_LOG1(LF_ZAP, LL_WARNING, "Unknown FIXUP_BLOB_KIND %d\n", kind);
@@ -715,6 +715,16 @@ public:
         m_CodeHeaderRW = NULL;
 
         m_codeWriteBufferSize = 0;
+#ifdef FEATURE_JIT_HOT_COLD_SPLITTING
+        if (m_ColdCodeHeaderRW != m_ColdCodeHeader)
+        {
+            delete [] (BYTE*)m_ColdCodeHeaderRW;
+        }
+
+        m_ColdCodeHeader = NULL;
+        m_ColdCodeHeaderRW = NULL;
+        m_coldCodeWriteBufferSize = 0;
+#endif
 #ifdef USE_INDIRECT_CODEHEADER
         m_pRealCodeHeader = NULL;
 #endif
@@ -828,6 +838,11 @@ public:
           m_CodeHeader(NULL),
           m_CodeHeaderRW(NULL),
           m_codeWriteBufferSize(0),
+#ifdef FEATURE_JIT_HOT_COLD_SPLITTING
+          m_ColdCodeHeader(NULL),
+          m_ColdCodeHeaderRW(NULL),
+          m_coldCodeWriteBufferSize(0),
+#endif
 #ifdef USE_INDIRECT_CODEHEADER
           m_pRealCodeHeader(NULL),
 #endif
@@ -887,6 +902,13 @@ public:
             delete [] (BYTE*)m_CodeHeaderRW;
         }
 
+#ifdef FEATURE_JIT_HOT_COLD_SPLITTING
+        if (m_ColdCodeHeaderRW != m_ColdCodeHeader)
+        {
+            delete [] (BYTE*)m_ColdCodeHeaderRW;
+        }
+#endif
+
         if (m_pOffsetMapping != NULL)
             freeArrayInternal(m_pOffsetMapping);
 
@@ -982,6 +1004,11 @@ protected :
     CodeHeader*             m_CodeHeader;   // descriptor for JITTED code - read/execute address
     CodeHeader*             m_CodeHeaderRW; // descriptor for JITTED code - code write scratch buffer address
     size_t                  m_codeWriteBufferSize;
+#ifdef FEATURE_JIT_HOT_COLD_SPLITTING
+    CodeHeader*             m_ColdCodeHeader;   // descriptor for the cold part of split JITTED code - read/execute address
+    CodeHeader*             m_ColdCodeHeaderRW; // descriptor for the cold part of split JITTED code - code write scratch buffer address
+    size_t                  m_coldCodeWriteBufferSize;
+#endif
 #ifdef USE_INDIRECT_CODEHEADER
     BYTE*                   m_pRealCodeHeader;
 #endif
@@ -1007,6 +1034,7 @@ protected :
 
 #if defined(_DEBUG)
     ULONG                   m_codeSize;     // Code size requested via allocMem
+    ULONG                   m_coldCodeSize; // Cold code size requested via allocMem
 #endif
 
     size_t                  m_GCinfo_len;   // Cached copy of GCinfo_len so we can backout in BackoutJitData()
@@ -553,6 +553,11 @@ void LoaderAllocator::GCLoaderAllocators(LoaderAllocator* pOriginalLoaderAllocat
         pFirstDestroyedLoaderAllocator = pOriginalLoaderAllocator;
     }
 
+    LARGE_INTEGER li;
+    QueryPerformanceCounter(&li);
+    UINT64 startTicks = li.QuadPart;
+    UINT32 destroyedCount = 0;
+
     // Iterate through free list, deleting DomainAssemblies
     pDomainLoaderAllocatorDestroyIterator = pFirstDestroyedLoaderAllocator;
     while (pDomainLoaderAllocatorDestroyIterator != NULL)
@@ -575,17 +580,29 @@ void LoaderAllocator::GCLoaderAllocators(LoaderAllocator* pOriginalLoaderAllocat
         // handles first
         pDomainLoaderAllocatorDestroyIterator->CleanupDependentHandlesToNativeObjects();
 
-        // The following code was previously happening on delete ~DomainAssembly->Terminate
-        // We are moving this part here in order to make sure that we can unload a LoaderAllocator
-        // that didn't have a DomainAssembly
-        // (we have now a LoaderAllocator with 0-n DomainAssembly)
+        destroyedCount++;
+        pDomainLoaderAllocatorDestroyIterator = pDomainLoaderAllocatorDestroyIterator->m_pLoaderAllocatorDestroyNext;
+    }
+
+    QueryPerformanceCounter(&li);
+    UINT64 suspendStartTicks = li.QuadPart;
+    UINT64 teardownStartTicks = suspendStartTicks;
+
+    // The following code was previously happening on delete ~DomainAssembly->Terminate
+    // We are moving this part here in order to make sure that we can unload a LoaderAllocator
+    // that didn't have a DomainAssembly
+    // (we have now a LoaderAllocator with 0-n DomainAssembly)
 
-        // This cleanup code starts resembling parts of AppDomain::Terminate too much.
-        // It would be useful to reduce duplication and also establish clear responsibilities
-        // for LoaderAllocator::Destroy, Assembly::Terminate, LoaderAllocator::Terminate
-        // and LoaderAllocator::~LoaderAllocator. We need to establish how these
-        // cleanup paths interact with app-domain unload and process tear-down, too.
+    // This cleanup code starts resembling parts of AppDomain::Terminate too much.
+    // It would be useful to reduce duplication and also establish clear responsibilities
+    // for LoaderAllocator::Destroy, Assembly::Terminate, LoaderAllocator::Terminate
+    // and LoaderAllocator::~LoaderAllocator. We need to establish how these
+    // cleanup paths interact with app-domain unload and process tear-down, too.
 
+    // The code and stubs of all the LoaderAllocators being deleted are torn down under a single
+    // suspension, and the caches that may refer to them are flushed once for all of them.
+    if (pFirstDestroyedLoaderAllocator != NULL)
+    {
         if (!IsAtProcessExit())
         {
             // Suspend the EE to do some clean up that can only occur
@@ -600,10 +617,18 @@ void LoaderAllocator::GCLoaderAllocators(LoaderAllocator* pOriginalLoaderAllocat
             CastCache::FlushCurrentCache();
         }
 
-        ExecutionManager::Unload(pDomainLoaderAllocatorDestroyIterator);
-        pDomainLoaderAllocatorDestroyIterator->UninitVirtualCallStubManager();
+        QueryPerformanceCounter(&li);
+        teardownStartTicks = li.QuadPart;
+
+        pDomainLoaderAllocatorDestroyIterator = pFirstDestroyedLoaderAllocator;
+        while (pDomainLoaderAllocatorDestroyIterator != NULL)
+        {
+            ExecutionManager::Unload(pDomainLoaderAllocatorDestroyIterator);
+            pDomainLoaderAllocatorDestroyIterator->UninitVirtualCallStubManager();
+
+            pDomainLoaderAllocatorDestroyIterator = pDomainLoaderAllocatorDestroyIterator->m_pLoaderAllocatorDestroyNext;
+        }
 
-        // TODO: Do we really want to perform this on each LoaderAllocator?
         MethodTable::ClearMethodDataCache();
         ClearJitGenericHandleCache(pAppDomain);
 
@@ -612,7 +637,14 @@ void LoaderAllocator::GCLoaderAllocators(LoaderAllocator* pOriginalLoaderAllocat
             // Resume the EE.
             ThreadSuspend::RestartEE(FALSE, TRUE);
         }
+    }
+
+    QueryPerformanceCounter(&li);
+    UINT64 handlesStartTicks = li.QuadPart;
 
+    pDomainLoaderAllocatorDestroyIterator = pFirstDestroyedLoaderAllocator;
+    while (pDomainLoaderAllocatorDestroyIterator != NULL)
+    {
         // Because RegisterLoaderAllocatorForDeletion is modifying m_pLoaderAllocatorDestroyNext, we are saving it here
         LoaderAllocator* pLoaderAllocatorDestroyNext = pDomainLoaderAllocatorDestroyIterator->m_pLoaderAllocatorDestroyNext;
 
@@ -626,6 +658,21 @@ void LoaderAllocator::GCLoaderAllocators(LoaderAllocator* pOriginalLoaderAllocat
     // Deleting the DomainAssemblies will have created a list of LoaderAllocator's on the AppDomain
     // Call this shutdown function to clean those up.
     pAppDomain->ShutdownFreeLoaderAllocators();
+
+    if (destroyedCount != 0)
+    {
+        QueryPerformanceCounter(&li);
+        UINT64 endTicks = li.QuadPart;
+        QueryPerformanceFrequency(&li);
+        UINT64 ticksPerS = li.QuadPart;
+
+        ETW::LoaderLog::CollectibleLoaderAllocatorsUnloaded(
+            destroyedCount,
+            (suspendStartTicks - startTicks) * 1000000 / ticksPerS,
+            (teardownStartTicks - suspendStartTicks) * 1000000 / ticksPerS,
+            (handlesStartTicks - teardownStartTicks) * 1000000 / ticksPerS,
+            (endTicks - handlesStartTicks) * 1000000 / ticksPerS);
+    }
 } // LoaderAllocator::GCLoaderAllocators
 
 //---------------------------------------------------------------------------------------
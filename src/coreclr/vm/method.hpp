@@ -2127,9 +2127,10 @@ class MulticoreJitPrepareCodeConfig : public PrepareCodeConfig
 {
 private:
     bool m_wasTier0;
+    bool m_jitOptimized;
 
 public:
-    MulticoreJitPrepareCodeConfig(MethodDesc* pMethod);
+    MulticoreJitPrepareCodeConfig(MethodDesc* pMethod, bool mayUsePrecompiledCode, bool jitOptimized);
 
     bool WasTier0() const
     {
@@ -2137,6 +2138,13 @@ public:
         return m_wasTier0;
     }
 
+    // The method was running optimized code when the profile was recorded, so it is jitted optimized instead of at tier 0
+    bool ShouldJitOptimized() const
+    {
+        LIMITED_METHOD_CONTRACT;
+        return m_jitOptimized;
+    }
+
     void SetWasTier0()
     {
         LIMITED_METHOD_CONTRACT;
@@ -2489,6 +2497,7 @@ public:
 #endif
         StubTailCallStoreArgs,
         StubTailCallCallTarget,
+        StubReflectionInvoke,
 
         StubLast
     };
@@ -367,6 +367,40 @@ HRESULT MulticoreJitRecorder::WriteModuleRecord(IStream * pStream, const Recorde
 }
 
 
+// Returns true if the method was running optimized code by the time the profile is written, either because it was promoted
+// from tier 0 or because its initial code was optimized. Playback may then jit the method optimized right away.
+static bool IsMethodRunningOptimizedCode(MethodDesc * pMethod)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_ANY;
+    }
+    CONTRACTL_END;
+
+#ifdef FEATURE_TIERED_COMPILATION
+    if (!pMethod->IsEligibleForTieredCompilation())
+    {
+        // Eligible methods are the only ones that are jitted at tier 0 during playback
+        return false;
+    }
+
+    CodeVersionManager::LockHolder codeVersioningLockHolder;
+
+    NativeCodeVersion defaultCodeVersion(pMethod);
+    if (defaultCodeVersion.IsFinalTier())
+    {
+        return true;
+    }
+
+    ILCodeVersion ilCodeVersion = defaultCodeVersion.GetILCodeVersion();
+    return ilCodeVersion.HasAnyOptimizedNativeCodeVersion(defaultCodeVersion);
+#else
+    return false;
+#endif
+}
+
 HRESULT MulticoreJitRecorder::WriteOutput(IStream * pStream)
 {
     CONTRACTL
@@ -383,20 +417,35 @@ HRESULT MulticoreJitRecorder::WriteOutput(IStream * pStream)
     _ASSERTE(m_JitInfoArray != nullptr);
     _ASSERTE(m_ModuleList != nullptr);
 
+    // Preprocessing is done on a copy that keeps the MethodDescs, so that the profile can be written again later with
+    // up-to-date tier information (see MulticoreJitManager::WriteProfileSnapshot)
+    RecorderInfo * pJitInfoArray = new (nothrow) RecorderInfo[m_JitInfoCount];
+    if (pJitInfoArray == nullptr)
+    {
+        return E_OUTOFMEMORY;
+    }
+
+    memcpy(pJitInfoArray, m_JitInfoArray, m_JitInfoCount * sizeof(RecorderInfo));
+
     // Preprocessing Methods
     LONG skipped = 0;
 
     for (LONG i = 0 ; i < m_JitInfoCount; i++)
     {
-        if (m_JitInfoArray[i].IsModuleInfo())
+        if (pJitInfoArray[i].IsModuleInfo())
         {
             // Module records don't need preprocessing
             continue;
         }
 
-        MethodDesc * pMethod = m_JitInfoArray[i].GetMethodDescAndClean();
+        MethodDesc * pMethod = pJitInfoArray[i].GetMethodDescAndClean();
 
-        if (m_JitInfoArray[i].IsGenericMethodInfo())
+        if (IsMethodRunningOptimizedCode(pMethod))
+        {
+            pJitInfoArray[i].MarkMethodOptimized();
+        }
+
+        if (pJitInfoArray[i].IsGenericMethodInfo())
         {
             SigBuilder sigBuilder;
 
@@ -432,14 +481,14 @@ HRESULT MulticoreJitRecorder::WriteOutput(IStream * pStream)
             }
 
             memcpy(pSignature, pBlob, dwLength);
-            m_JitInfoArray[i].PackSignatureForGenericMethod(pSignature, dwLength);
+            pJitInfoArray[i].PackSignatureForGenericMethod(pSignature, dwLength);
         }
         else
         {
-            _ASSERTE(m_JitInfoArray[i].IsNonGenericMethodInfo());
+            _ASSERTE(pJitInfoArray[i].IsNonGenericMethodInfo());
 
             unsigned token = pMethod->GetMemberDef_NoLogging();
-            m_JitInfoArray[i].PackTokenForNonGenericMethod(token);
+            pJitInfoArray[i].PackTokenForNonGenericMethod(token);
         }
     }
 
@@ -488,20 +537,20 @@ HRESULT MulticoreJitRecorder::WriteOutput(IStream * pStream)
 
     for (LONG i = 0 ; i < m_JitInfoCount && SUCCEEDED(hr); i++)
     {
-        if (m_JitInfoArray[i].IsModuleInfo())
+        if (pJitInfoArray[i].IsModuleInfo())
         {
             // Module record
-            _ASSERTE(m_JitInfoArray[i].IsFullyInitialized());
+            _ASSERTE(pJitInfoArray[i].IsFullyInitialized());
 
-            DWORD data1 = m_JitInfoArray[i].GetRawModuleData();
+            DWORD data1 = pJitInfoArray[i].GetRawModuleData();
             hr = WriteData(pStream, &data1, sizeof(data1));
         }
-        else if (m_JitInfoArray[i].IsGenericMethodInfo())
+        else if (pJitInfoArray[i].IsGenericMethodInfo())
         {
             // Method record
-            DWORD data1 = m_JitInfoArray[i].GetRawMethodData1();
-            unsigned short data2 = m_JitInfoArray[i].GetRawMethodData2Generic();
-            BYTE * pSignature = m_JitInfoArray[i].GetRawMethodSignature();
+            DWORD data1 = pJitInfoArray[i].GetRawMethodData1();
+            unsigned short data2 = pJitInfoArray[i].GetRawMethodData2Generic();
+            BYTE * pSignature = pJitInfoArray[i].GetRawMethodSignature();
 
             if (pSignature == nullptr)
             {
@@ -509,8 +558,8 @@ HRESULT MulticoreJitRecorder::WriteOutput(IStream * pStream)
                 continue;
             }
 
-            DWORD sigSize = m_JitInfoArray[i].GetMethodSignatureSize();
-            DWORD paddingSize = m_JitInfoArray[i].GetMethodRecordPaddingSize();
+            DWORD sigSize = pJitInfoArray[i].GetMethodSignatureSize();
+            DWORD paddingSize = pJitInfoArray[i].GetMethodRecordPaddingSize();
 
             hr = WriteData(pStream, &data1, sizeof(data1));
             if (SUCCEEDED(hr))
@@ -529,11 +578,11 @@ HRESULT MulticoreJitRecorder::WriteOutput(IStream * pStream)
         }
         else
         {
-            _ASSERTE(m_JitInfoArray[i].IsNonGenericMethodInfo());
+            _ASSERTE(pJitInfoArray[i].IsNonGenericMethodInfo());
 
             // Method record
-            DWORD data1 = m_JitInfoArray[i].GetRawMethodData1();
-            unsigned data2 = m_JitInfoArray[i].GetRawMethodData2NonGeneric();
+            DWORD data1 = pJitInfoArray[i].GetRawMethodData1();
+            unsigned data2 = pJitInfoArray[i].GetRawMethodData2NonGeneric();
 
             hr = WriteData(pStream, &data1, sizeof(data1));
             if (SUCCEEDED(hr))
@@ -545,12 +594,14 @@ HRESULT MulticoreJitRecorder::WriteOutput(IStream * pStream)
 
     for (LONG i = 0; i < m_JitInfoCount; i++)
     {
-        if (m_JitInfoArray[i].IsGenericMethodInfo())
+        if (pJitInfoArray[i].IsGenericMethodInfo())
         {
-            delete[] m_JitInfoArray[i].GetRawMethodSignature();
+            delete[] pJitInfoArray[i].GetRawMethodSignature();
         }
     }
 
+    delete[] pJitInfoArray;
+
     MulticoreJitTrace(("New profile: %d modules, %d methods", m_ModuleCount, m_JitInfoCount));
 
     _FireEtwMulticoreJit(W("WRITEPROFILE"), m_fullFileName.GetUnicode(), m_ModuleCount, m_JitInfoCount, 0);
@@ -600,7 +651,7 @@ unsigned MulticoreJitRecorder::GetOrAddModuleIndex(Module * pModule)
     return slot;
 }
 
-void MulticoreJitRecorder::RecordMethodInfo(unsigned moduleIndex, MethodDesc * pMethod, bool application)
+void MulticoreJitRecorder::RecordMethodInfo(unsigned moduleIndex, MethodDesc * pMethod, bool application, bool readyToRunRejected)
 {
     LIMITED_METHOD_CONTRACT;
 
@@ -610,7 +661,7 @@ void MulticoreJitRecorder::RecordMethodInfo(unsigned moduleIndex, MethodDesc * p
     if (m_JitInfoCount < (LONG) MAX_METHODS)
     {
         m_ModuleList[moduleIndex].methodCount++;
-        m_JitInfoArray[m_JitInfoCount++].PackMethod(moduleIndex, pMethod, application);
+        m_JitInfoArray[m_JitInfoCount++].PackMethod(moduleIndex, pMethod, application, readyToRunRejected);
     }
 }
 
@@ -863,7 +914,7 @@ void MulticoreJitRecorder::PreRecordFirstMethod()
 }
 
 
-void MulticoreJitRecorder::RecordMethodJitOrLoad(MethodDesc * pMethod, bool application)
+void MulticoreJitRecorder::RecordMethodJitOrLoad(MethodDesc * pMethod, bool application, bool readyToRunRejected)
 {
     STANDARD_VM_CONTRACT;
 
@@ -882,7 +933,7 @@ void MulticoreJitRecorder::RecordMethodJitOrLoad(MethodDesc * pMethod, bool appl
         return;
     }
 
-    RecordMethodInfo(moduleIndex, pMethod, application);
+    RecordMethodInfo(moduleIndex, pMethod, application, readyToRunRejected);
 }
 
 
@@ -925,6 +976,30 @@ HRESULT MulticoreJitRecorder::StopProfile(bool appDomainShutdown)
 }
 
 
+// Write the profile recorded so far and keep recording. Tier information is captured at the time the profile is written,
+// so a profile written once tiering has settled lets playback jit the methods that were promoted optimized right away.
+HRESULT MulticoreJitRecorder::WriteSnapshot()
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        CAN_TAKE_LOCK;
+    }
+    CONTRACTL_END;
+
+    if (m_fAborted || m_fullFileName.IsEmpty())
+    {
+        return S_OK;
+    }
+
+    HRESULT hr = WriteOutput();
+
+    MulticoreJitTrace(("WriteSnapshot: Save profile to %S, hr=0x%x", m_fullFileName.GetUnicode(), hr));
+
+    return hr;
+}
+
+
 // suffix (>= 0) is used for AutoStartProfile, to support multiple AppDomains. It's set to -1 for normal API call path
 HRESULT MulticoreJitRecorder::StartProfile(const WCHAR * pRoot, const WCHAR * pFile, int suffix, LONG nSession)
 {
@@ -1103,7 +1178,13 @@ MulticoreJitCodeInfo MulticoreJitRecorder::RequestMethodCode(MethodDesc * pMetho
 
     if (!codeInfo.IsNull() && pManager->IsRecorderActive()) // recorder may be off when player is on (e.g. for Appx)
     {
-        RecordMethodJitOrLoad(pMethod, false); // JITTed by background thread, returned to application
+        // A non-generic method of a ReadyToRun module that was jitted in the background had no usable ReadyToRun code
+        bool readyToRunRejected =
+            pMethod->GetModule_NoLogging()->IsReadyToRun() &&
+            !pMethod->HasClassOrMethodInstantiation() &&
+            !ExecutionManager::IsReadyToRunCode(codeInfo.GetEntryPoint());
+
+        RecordMethodJitOrLoad(pMethod, false, readyToRunRejected); // JITTed by background thread, returned to application
     }
 
     return codeInfo;
@@ -1421,7 +1502,7 @@ MulticoreJitCodeInfo MulticoreJitManager::RequestMethodCode(MethodDesc * pMethod
 // Call back from MethodDesc::MakeJitWorker for
 // Threading: protected by m_playerLock
 
-void MulticoreJitManager::RecordMethodJitOrLoad(MethodDesc * pMethod)
+void MulticoreJitManager::RecordMethodJitOrLoad(MethodDesc * pMethod, bool readyToRunRejected)
 {
     STANDARD_VM_CONTRACT;
 
@@ -1429,7 +1510,7 @@ void MulticoreJitManager::RecordMethodJitOrLoad(MethodDesc * pMethod)
 
     if (m_pMulticoreJitRecorder != NULL)
     {
-        m_pMulticoreJitRecorder->RecordMethodJitOrLoad(pMethod, true);
+        m_pMulticoreJitRecorder->RecordMethodJitOrLoad(pMethod, true, readyToRunRejected);
 
         if (m_pMulticoreJitRecorder->IsAtFullCapacity())
         {
@@ -1475,6 +1556,33 @@ void MulticoreJitManager::StopProfileAll()
     }
 }
 
+// Called by the tiering background worker when it runs out of work, so that the profile reflects which methods were
+// promoted to tier 1. The profile is also written by StopProfile, but on Unix that only happens on a clean shutdown.
+void MulticoreJitManager::WriteProfileSnapshot()
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_TRIGGERS;
+        MODE_PREEMPTIVE;
+        CAN_TAKE_LOCK;
+    }
+    CONTRACTL_END;
+
+    if (m_fSetProfileRootCalled != SETPROFILEROOTCALLED ||
+        CLRConfig::GetConfigValue(CLRConfig::INTERNAL_MultiCoreJitProfileWriteOnTieringIdle) == 0)
+    {
+        return;
+    }
+
+    CrstHolder hold(& m_playerLock);
+
+    if (m_pMulticoreJitRecorder != NULL)
+    {
+        m_pMulticoreJitRecorder->WriteSnapshot();
+    }
+}
+
 #ifndef TARGET_UNIX
 void MulticoreJitManager::WriteMulticoreJitProfiler()
 {
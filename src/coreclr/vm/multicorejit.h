@@ -270,6 +270,9 @@ public:
 
     static void StopProfileAll();
 
+    // Writes the profile being recorded without stopping the recording
+    void WriteProfileSnapshot();
+
 #ifndef TARGET_UNIX
     void WriteMulticoreJitProfiler();
 #endif // !TARGET_UNIX
@@ -281,7 +284,7 @@ public:
 
     MulticoreJitCodeInfo RequestMethodCode(MethodDesc * pMethod);
 
-    void RecordMethodJitOrLoad(MethodDesc * pMethod);
+    void RecordMethodJitOrLoad(MethodDesc * pMethod, bool readyToRunRejected);
 
     MulticoreJitPlayerStat & GetStats()
     {
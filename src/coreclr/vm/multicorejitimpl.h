@@ -20,10 +20,12 @@
 
 #endif
 
-// Bits 0xff0000 are reserved method flags. Currently only first bit is used.
+// Bits 0xff0000 are reserved method flags. Currently only first three bits are used.
 const unsigned METHOD_FLAGS_MASK       = 0xff0000;
 const unsigned JIT_BY_APP_THREAD_TAG   = 0x10000;   // tag, that indicates whether method is jitted by application thread(1) or background thread(0)
-// Tags 0xfe0000 are currently free
+const unsigned JIT_OPTIMIZED_TAG       = 0x20000;   // tag, that indicates whether method was running optimized code when the profile was written
+const unsigned R2R_REJECTED_TAG        = 0x40000;   // tag, that indicates whether method was jitted because its ReadyToRun code was rejected or missing
+// Tags 0xf80000 are currently free
 
 const unsigned RECORD_TYPE_OFFSET      = 24;        // offset of type of record
 
@@ -43,6 +45,9 @@ const int      HEADER_D_COUNTER  = 3;               // Extra 32-bit counters in
 const int      MULTICOREJITLIFE  = 60 * 1000;       // 60 seconds
 const int      MAX_WALKBACK      = 128;
 
+const unsigned MAX_PLAYBACK_THREADS    = 4;         // Maximum number of threads jitting methods during playback, including the playback thread
+const unsigned MAX_QUEUED_METHODS      = 256;       // Maximum number of methods waiting for a playback worker thread
+
 enum
 {
     MULTICOREJIT_PROFILE_VERSION   = 102,
@@ -72,6 +77,8 @@ inline unsigned Pack8_24(unsigned up, unsigned low)
 //  5. Maximum number of methods supported is MAX_METHODS
 //  6. Simple module name stored
 //  7. Method flag JIT_BY_APP_THREAD is for diagnosis only
+//  8. Method flags JIT_OPTIMIZED and R2R_REJECTED let playback jit the method optimized, and skip looking for ReadyToRun code.
+//     Older profiles have these bits cleared, so they play back as before.
 //
 // <HeaderRecord>::=     <recordType=MULTICOREJIT_HEADER_RECORD_ID> <3byte_recordSize> <version> <timeStamp> <moduleCount> <methodCount> <DependencyCount> <unsigned short counter>*14 <unsigned counter>*3
 // <ModuleRecord>::=     <recordType=MULTICOREJIT_MODULE_RECORD_ID> <3byte_recordSize> <ModuleVersion> <JitMethodCount> <loadLevel> <lenModuleName> char*lenModuleName <padding>
@@ -108,7 +115,8 @@ inline unsigned Pack8_24(unsigned up, unsigned low)
 //
 // II. Profile in file
 //
-//   Preprocessing is performed right before profile saving to file.
+//   Preprocessing is performed right before profile saving to file, on a copy of m_JitInfoArray so that the profile can be
+//   saved more than once.
 //
 //   1. Modules.
 //     For modules, no preprocessing of RecorderInfo is required, RecorderInfo::data1 is written to file as JifInfRecord.
@@ -285,13 +293,33 @@ private:
     unsigned                           m_moduleCount;
     PlayerModuleInfo                 * m_pModules;
 
+    // Methods to compile are handed to worker threads through a bounded queue, the playback thread compiles a method itself
+    // when the queue is full. Modules are only loaded by the playback thread, before any method that depends on them is queued.
+    struct MethodToCompile
+    {
+        MethodDesc * pMD;
+        unsigned     methodFlags;
+    };
+
+    CrstExplicitInit                   m_crstQueue;            // protecting the fields below
+    CLREvent                           m_queueEvent;           // set when methods are queued or playback is done
+    CLREvent                           m_workersExitedEvent;   // set when the last worker thread exits
+    MethodToCompile                    m_queue[MAX_QUEUED_METHODS];
+    unsigned                           m_queueHead;
+    unsigned                           m_queueCount;
+    unsigned                           m_nWorkerCount;
+    unsigned                           m_nActiveWorkerCount;
+    bool                               m_fQueueInitialized;
+    bool                               m_fPlaybackDone;
+
     HRESULT HandleModuleRecord(const ModuleRecord * pMod);
     HRESULT HandleModuleInfoRecord(unsigned moduleTo, unsigned level);
-    HRESULT HandleNonGenericMethodInfoRecord(unsigned moduleIndex, unsigned token);
-    HRESULT HandleGenericMethodInfoRecord(unsigned moduleIndex, BYTE * signature, unsigned length);
-    void CompileMethodInfoRecord(Module *pModule, MethodDesc *pMethod, bool isGeneric);
+    HRESULT HandleNonGenericMethodInfoRecord(unsigned moduleIndex, unsigned token, unsigned methodFlags);
+    HRESULT HandleGenericMethodInfoRecord(unsigned moduleIndex, BYTE * signature, unsigned length, unsigned methodFlags);
+    void CompileMethodInfoRecord(Module *pModule, MethodDesc *pMethod, bool isGeneric, unsigned methodFlags);
 
-    bool CompileMethodDesc(Module * pModule, MethodDesc * pMD);
+    bool CompileMethodDesc(Module * pModule, MethodDesc * pMD, unsigned methodFlags);
+    void PrepareMethodCode(MethodDesc * pMD, unsigned methodFlags);
     HRESULT PlayProfile();
 
     bool ShouldAbort(bool fast) const;
@@ -300,6 +328,14 @@ private:
 
     static DWORD WINAPI StaticJITThreadProc(void *args);
 
+    void StartWorkers();
+    void StopWorkers(bool discardQueuedMethods);
+    bool TryQueueMethod(MethodDesc * pMD, unsigned methodFlags);
+    bool DequeueMethod(MethodToCompile * pMethod);
+    void WorkerThreadProc();
+
+    static DWORD WINAPI StaticWorkerThreadProc(void *args);
+
     void TraceSummary();
 
     HRESULT UpdateModuleInfo();
@@ -549,7 +585,7 @@ struct RecorderInfo
         _ASSERTE(IsFullyInitialized());
     }
 
-    void PackMethod(unsigned moduleIndex, MethodDesc * pMethod, bool application)
+    void PackMethod(unsigned moduleIndex, MethodDesc * pMethod, bool application, bool readyToRunRejected)
     {
         LIMITED_METHOD_CONTRACT;
 
@@ -576,6 +612,11 @@ struct RecorderInfo
             data1 |= JIT_BY_APP_THREAD_TAG;
         }
 
+        if (readyToRunRejected)
+        {
+            data1 |= R2R_REJECTED_TAG;
+        }
+
         data2 = 0;
         // To avoid recording overhead, records only pointer to MethodDesc.
         ptr = (BYTE *) pMethod;
@@ -583,6 +624,15 @@ struct RecorderInfo
         _ASSERTE(IsMethodInfo());
     }
 
+    void MarkMethodOptimized()
+    {
+        LIMITED_METHOD_CONTRACT;
+
+        _ASSERTE(IsMethodInfo());
+
+        data1 |= JIT_OPTIMIZED_TAG;
+    }
+
     void PackModule(FileLoadLevel needLevel, unsigned moduleIndex)
     {
         LIMITED_METHOD_CONTRACT;
@@ -628,7 +678,7 @@ private:
 
     HRESULT WriteModuleRecord(IStream * pStream,  const RecorderModuleInfo & module);
 
-    void RecordMethodInfo(unsigned moduleIndex, MethodDesc * pMethod, bool application);
+    void RecordMethodInfo(unsigned moduleIndex, MethodDesc * pMethod, bool application, bool readyToRunRejected);
     unsigned RecordModuleInfo(Module * pModule);
     void RecordOrUpdateModuleInfo(FileLoadLevel needLevel, unsigned moduleIndex);
 
@@ -713,7 +763,7 @@ public:
         m_JitInfoArray = new (nothrow) RecorderInfo[MAX_METHODS];
     }
 
-    void RecordMethodJitOrLoad(MethodDesc * pMethod, bool application);
+    void RecordMethodJitOrLoad(MethodDesc * pMethod, bool application, bool readyToRunRejected);
 
     MulticoreJitCodeInfo RequestMethodCode(MethodDesc * pMethod, MulticoreJitManager * pManager);
 
@@ -721,6 +771,8 @@ public:
 
     HRESULT StopProfile(bool appDomainShutdown);
 
+    HRESULT WriteSnapshot();
+
     void AbortProfile();
 
     void RecordModuleLoad(Module * pModule, FileLoadLevel loadLevel);
@@ -382,6 +382,13 @@ MulticoreJitProfilePlayer::MulticoreJitProfilePlayer(AssemblyBinder * pBinder, L
     m_pFileBuffer        = NULL;
     m_nFileSize          = 0;
 
+    m_queueHead          = 0;
+    m_queueCount         = 0;
+    m_nWorkerCount       = 0;
+    m_nActiveWorkerCount = 0;
+    m_fQueueInitialized  = false;
+    m_fPlaybackDone      = false;
+
     m_nStartTime         = GetTickCount();
 }
 
@@ -400,6 +407,13 @@ MulticoreJitProfilePlayer::~MulticoreJitProfilePlayer()
     {
         delete [] m_pFileBuffer;
     }
+
+    if (m_fQueueInitialized)
+    {
+        _ASSERTE(m_nActiveWorkerCount == 0);
+
+        m_crstQueue.Destroy();
+    }
 }
 
 
@@ -508,10 +522,11 @@ HRESULT MulticoreJitProfilePlayer::HandleModuleRecord(const ModuleRecord * pMod)
 }
 
 #ifndef DACCESS_COMPILE
-MulticoreJitPrepareCodeConfig::MulticoreJitPrepareCodeConfig(MethodDesc* pMethod) :
+MulticoreJitPrepareCodeConfig::MulticoreJitPrepareCodeConfig(MethodDesc* pMethod, bool mayUsePrecompiledCode, bool jitOptimized) :
     // Method code that was pregenerated and loaded is recorded in the multi-core JIT profile, so enable multi-core JIT to also
-    // look up pregenerated code to help parallelize the work
-    PrepareCodeConfig(NativeCodeVersion(pMethod), FALSE, TRUE), m_wasTier0(false)
+    // look up pregenerated code to help parallelize the work, unless the profile recorded that the pregenerated code was not
+    // used
+    PrepareCodeConfig(NativeCodeVersion(pMethod), FALSE, mayUsePrecompiledCode), m_wasTier0(false), m_jitOptimized(jitOptimized)
 {
     WRAPPER_NO_CONTRACT;
 
@@ -559,7 +574,7 @@ void MulticoreJitCodeInfo::VerifyIsNotNull() const
 
 // Call JIT to compile a method
 
-bool MulticoreJitProfilePlayer::CompileMethodDesc(Module * pModule, MethodDesc * pMD)
+bool MulticoreJitProfilePlayer::CompileMethodDesc(Module * pModule, MethodDesc * pMD, unsigned methodFlags)
 {
     STANDARD_VM_CONTRACT;
 
@@ -576,12 +591,10 @@ bool MulticoreJitProfilePlayer::CompileMethodDesc(Module * pModule, MethodDesc *
 
         m_stats.m_nTryCompiling ++;
 
-        // Reset the flag to allow managed code to be called in multicore JIT background thread from this routine
-        ThreadStateNCStackHolder holder(-1, Thread::TSNC_CallingManagedCodeDisabled);
-
-        // PrepareCode calls back to MulticoreJitCodeStorage::StoreMethodCode under MethodDesc lock
-        MulticoreJitPrepareCodeConfig config(pMD);
-        pMD->PrepareCode(&config);
+        if (!TryQueueMethod(pMD, methodFlags))
+        {
+            PrepareMethodCode(pMD, methodFlags);
+        }
 
         return true;
     }
@@ -589,6 +602,23 @@ bool MulticoreJitProfilePlayer::CompileMethodDesc(Module * pModule, MethodDesc *
     return false;
 }
 
+// Compile a method on the playback thread or a worker thread
+void MulticoreJitProfilePlayer::PrepareMethodCode(MethodDesc * pMD, unsigned methodFlags)
+{
+    STANDARD_VM_CONTRACT;
+
+    // Reset the flag to allow managed code to be called in multicore JIT background thread from this routine
+    ThreadStateNCStackHolder holder(-1, Thread::TSNC_CallingManagedCodeDisabled);
+
+    // Code that is to be optimized is jitted even if there is pregenerated code, which would otherwise be used at tier 0
+    bool jitOptimized = (methodFlags & JIT_OPTIMIZED_TAG) != 0;
+    bool mayUsePrecompiledCode = !jitOptimized && (methodFlags & R2R_REJECTED_TAG) == 0;
+
+    // PrepareCode calls back to MulticoreJitCodeStorage::StoreMethodCode under MethodDesc lock
+    MulticoreJitPrepareCodeConfig config(pMD, mayUsePrecompiledCode, jitOptimized);
+    pMD->PrepareCode(&config);
+}
+
 class MulticoreJitPlayerModuleEnumerator : public MulticoreJitModuleEnumerator
 {
     MulticoreJitProfilePlayer * m_pPlayer;
@@ -844,7 +874,7 @@ DomainAssembly * MulticoreJitProfilePlayer::LoadAssembly(SString & assemblyName)
         FALSE); // Don't throw on FileNotFound.
 }
 
-HRESULT MulticoreJitProfilePlayer::HandleNonGenericMethodInfoRecord(unsigned moduleIndex, unsigned token)
+HRESULT MulticoreJitProfilePlayer::HandleNonGenericMethodInfoRecord(unsigned moduleIndex, unsigned token, unsigned methodFlags)
 {
     STANDARD_VM_CONTRACT;
 
@@ -869,7 +899,7 @@ HRESULT MulticoreJitProfilePlayer::HandleNonGenericMethodInfoRecord(unsigned mod
             // Similar to Module::FindMethod + Module::FindMethodThrowing,
             // except it calls GetMethodDescFromMemberDefOrRefOrSpec with strictMetadataChecks=FALSE to allow generic instantiation
             MethodDesc * pMethod = MemberLoader::GetMethodDescFromMemberDefOrRefOrSpec(pModule, token, NULL, FALSE, FALSE);
-            CompileMethodInfoRecord(pModule, pMethod, false);
+            CompileMethodInfoRecord(pModule, pMethod, false, methodFlags);
         }
         else
         {
@@ -889,7 +919,7 @@ HRESULT MulticoreJitProfilePlayer::HandleNonGenericMethodInfoRecord(unsigned mod
     return hr;
 }
 
-HRESULT MulticoreJitProfilePlayer::HandleGenericMethodInfoRecord(unsigned moduleIndex, BYTE * signature, unsigned length)
+HRESULT MulticoreJitProfilePlayer::HandleGenericMethodInfoRecord(unsigned moduleIndex, BYTE * signature, unsigned length, unsigned methodFlags)
 {
     STANDARD_VM_CONTRACT;
 
@@ -923,7 +953,7 @@ HRESULT MulticoreJitProfilePlayer::HandleGenericMethodInfoRecord(unsigned module
             }
             EX_END_CATCH(SwallowAllExceptions);
 
-            CompileMethodInfoRecord(pModule, pMethod, true);
+            CompileMethodInfoRecord(pModule, pMethod, true, methodFlags);
         }
         else
         {
@@ -943,7 +973,7 @@ HRESULT MulticoreJitProfilePlayer::HandleGenericMethodInfoRecord(unsigned module
     return hr;
 }
 
-void MulticoreJitProfilePlayer::CompileMethodInfoRecord(Module *pModule, MethodDesc *pMethod, bool isGeneric)
+void MulticoreJitProfilePlayer::CompileMethodInfoRecord(Module *pModule, MethodDesc *pMethod, bool isGeneric, unsigned methodFlags)
 {
     STANDARD_VM_CONTRACT;
 
@@ -968,7 +998,7 @@ void MulticoreJitProfilePlayer::CompileMethodInfoRecord(Module *pModule, MethodD
 
         if (pMethod->GetNativeCode() == NULL && !GetAppDomain()->GetMulticoreJitManager().GetMulticoreJitCodeStorage().LookupMethodCode(pMethod))
         {
-            if (CompileMethodDesc(pModule, pMethod))
+            if (CompileMethodDesc(pModule, pMethod, methodFlags))
             {
                 return;
             }
@@ -1134,6 +1164,8 @@ HRESULT MulticoreJitProfilePlayer::PlayProfile()
         nSize,
         GetAppDomain()->GetFriendlyNameForLogging()));
 
+    StartWorkers();
+
     while ((SUCCEEDED(hr)) && (nSize > sizeof(unsigned)))
     {
         unsigned data1 = * (const unsigned *) pBuffer;
@@ -1270,12 +1302,13 @@ HRESULT MulticoreJitProfilePlayer::PlayProfile()
                 unsigned curdata1 = * (const unsigned *) pCurBuf;
                 unsigned currcdTyp = curdata1 >> RECORD_TYPE_OFFSET;
                 unsigned curmoduleIndex = curdata1 & MODULE_MASK;
+                unsigned curmethodFlags = curdata1 & METHOD_FLAGS_MASK;
 
                 if (currcdTyp == MULTICOREJIT_METHOD_RECORD_ID)
                 {
                     unsigned token = * (((const unsigned *) pCurBuf) + 1);
 
-                    hr = HandleNonGenericMethodInfoRecord(curmoduleIndex, token);
+                    hr = HandleNonGenericMethodInfoRecord(curmoduleIndex, token, curmethodFlags);
                 }
                 else
                 {
@@ -1283,7 +1316,7 @@ HRESULT MulticoreJitProfilePlayer::PlayProfile()
 
                     unsigned cursignatureLength = * (const unsigned short *) (((const unsigned *) pCurBuf) + 1);
 
-                    hr = HandleGenericMethodInfoRecord(curmoduleIndex, (BYTE *) (pCurBuf + sizeof(unsigned) + sizeof(unsigned short)), cursignatureLength);
+                    hr = HandleGenericMethodInfoRecord(curmoduleIndex, (BYTE *) (pCurBuf + sizeof(unsigned) + sizeof(unsigned short)), cursignatureLength, curmethodFlags);
                 }
 
                 if (SUCCEEDED(hr) && ShouldAbort(false))
@@ -1356,6 +1389,13 @@ HRESULT MulticoreJitProfilePlayer::JITThreadProc(Thread * pThread)
     }
     EX_END_CATCH(SwallowAllExceptions);
 
+    {
+        // Worker threads use the player, wait for them to finish before it is deleted
+        GCX_PREEMP();
+
+        StopWorkers(FAILED(m_stats.m_hr));
+    }
+
     return (DWORD) m_stats.m_hr;
 }
 
@@ -1413,6 +1453,257 @@ DWORD WINAPI MulticoreJitProfilePlayer::StaticJITThreadProc(void *args)
 }
 
 
+struct MulticoreJitWorkerArgs
+{
+    MulticoreJitProfilePlayer * pPlayer;
+    Thread                    * pThread;
+};
+
+// Start the worker threads that compile methods alongside the playback thread. Failing to start a worker is not an error,
+// playback continues with the workers that were started.
+void MulticoreJitProfilePlayer::StartWorkers()
+{
+    STANDARD_VM_CONTRACT;
+
+    unsigned threadCount = CLRConfig::GetConfigValue(CLRConfig::INTERNAL_MultiCoreJitPlaybackThreads);
+    if (threadCount == 0)
+    {
+        threadCount = GetCurrentProcessCpuCount() / 4;
+    }
+    threadCount = min(max(threadCount, 1u), MAX_PLAYBACK_THREADS);
+
+    if (threadCount == 1)
+    {
+        return;
+    }
+
+    // The queue lock is a leaf lock like the code storage lock and is never held together with it
+    m_crstQueue.Init(CrstMulticoreJitHash);
+    m_fQueueInitialized = true;
+
+    EX_TRY
+    {
+        m_queueEvent.CreateManualEvent(FALSE);
+        m_workersExitedEvent.CreateManualEvent(FALSE);
+
+        for (unsigned i = 1; i < threadCount; i ++)
+        {
+            NewHolder<MulticoreJitWorkerArgs> pArgs = new MulticoreJitWorkerArgs;
+
+            Thread * pWorker = SetupUnstartedThread();
+            _ASSERTE(pWorker != NULL);
+
+            pArgs->pPlayer = this;
+            pArgs->pThread = pWorker;
+
+            if (!pWorker->CreateNewThread(0, StaticWorkerThreadProc, pArgs, W(".NET MultiCoreJit Worker")))
+            {
+                pWorker->DecExternalCount(FALSE);
+                break;
+            }
+
+            {
+                CrstHolder holder(& m_crstQueue);
+
+                m_nActiveWorkerCount ++;
+            }
+
+            if (pWorker->StartThread() == 0)
+            {
+                // The thread didn't start and will not run the worker, so it won't exit either
+                CrstHolder holder(& m_crstQueue);
+
+                m_nActiveWorkerCount --;
+                break;
+            }
+
+            pArgs.SuppressRelease();
+            m_nWorkerCount ++;
+        }
+    }
+    EX_CATCH
+    {
+    }
+    EX_END_CATCH(SwallowAllExceptions);
+
+    MulticoreJitTrace(("Started %d playback worker threads", m_nWorkerCount));
+}
+
+// Tell the worker threads that playback is done, and wait for them to exit after draining the queue
+void MulticoreJitProfilePlayer::StopWorkers(bool discardQueuedMethods)
+{
+    STANDARD_VM_CONTRACT;
+
+    if (!m_fQueueInitialized)
+    {
+        return;
+    }
+
+    unsigned activeWorkerCount;
+
+    {
+        CrstHolder holder(& m_crstQueue);
+
+        if (discardQueuedMethods)
+        {
+            m_queueCount = 0;
+        }
+
+        m_fPlaybackDone = true;
+        activeWorkerCount = m_nActiveWorkerCount;
+
+        if (m_queueEvent.IsValid())
+        {
+            m_queueEvent.Set();
+        }
+    }
+
+    if (activeWorkerCount > 0)
+    {
+        m_workersExitedEvent.Wait(INFINITE, FALSE);
+    }
+}
+
+// Hand a method to the worker threads, returns false if it has to be compiled by the caller
+bool MulticoreJitProfilePlayer::TryQueueMethod(MethodDesc * pMD, unsigned methodFlags)
+{
+    STANDARD_VM_CONTRACT;
+
+    if (m_nWorkerCount == 0)
+    {
+        return false;
+    }
+
+    CrstHolder holder(& m_crstQueue);
+
+    if (m_queueCount == MAX_QUEUED_METHODS)
+    {
+        return false;
+    }
+
+    MethodToCompile & method = m_queue[(m_queueHead + m_queueCount) % MAX_QUEUED_METHODS];
+    method.pMD = pMD;
+    method.methodFlags = methodFlags;
+    m_queueCount ++;
+
+    m_queueEvent.Set();
+
+    return true;
+}
+
+// Wait for a queued method, returns false once playback is done and the queue is drained
+bool MulticoreJitProfilePlayer::DequeueMethod(MethodToCompile * pMethod)
+{
+    STANDARD_VM_CONTRACT;
+
+    while (true)
+    {
+        {
+            CrstHolder holder(& m_crstQueue);
+
+            if (m_queueCount > 0)
+            {
+                * pMethod = m_queue[m_queueHead];
+                m_queueHead = (m_queueHead + 1) % MAX_QUEUED_METHODS;
+                m_queueCount --;
+
+                return true;
+            }
+
+            if (m_fPlaybackDone)
+            {
+                return false;
+            }
+
+            m_queueEvent.Reset();
+        }
+
+        m_queueEvent.Wait(INFINITE, FALSE);
+    }
+}
+
+void MulticoreJitProfilePlayer::WorkerThreadProc()
+{
+    STANDARD_VM_CONTRACT;
+
+    MethodToCompile method;
+
+    while (DequeueMethod(& method))
+    {
+        // Keep draining the queue after the session is over, without compiling
+        if (ShouldAbort(true))
+        {
+            continue;
+        }
+
+        EX_TRY
+        {
+            PrepareMethodCode(method.pMD, method.methodFlags);
+        }
+        EX_CATCH
+        {
+        }
+        EX_END_CATCH(SwallowAllExceptions);
+    }
+}
+
+DWORD WINAPI MulticoreJitProfilePlayer::StaticWorkerThreadProc(void *args)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_TRIGGERS;
+        MODE_ANY;
+        ENTRY_POINT;
+    }
+    CONTRACTL_END;
+
+    _ASSERTE(args != NULL);
+
+    MulticoreJitWorkerArgs * pArgs = (MulticoreJitWorkerArgs *) args;
+    MulticoreJitProfilePlayer * pPlayer = pArgs->pPlayer;
+    Thread * pThread = pArgs->pThread;
+    delete pArgs;
+
+    if (pThread->HasStarted())
+    {
+        // Disable calling managed code in worker threads, as in the playback thread
+        ThreadStateNCStackHolder holder(TRUE, Thread::TSNC_CallingManagedCodeDisabled);
+
+        pThread->SetBackground(TRUE);
+
+        EX_TRY
+        {
+            GCX_PREEMP();
+
+            pPlayer->WorkerThreadProc();
+        }
+        EX_CATCH
+        {
+        }
+        EX_END_CATCH(SwallowAllExceptions);
+    }
+
+    bool fLastWorker;
+
+    {
+        CrstHolder holder(& pPlayer->m_crstQueue);
+
+        fLastWorker = (-- pPlayer->m_nActiveWorkerCount == 0);
+    }
+
+    // The playback thread deletes the player once the last worker exits, so the player is not used after this
+    if (fLastWorker)
+    {
+        pPlayer->m_workersExitedEvent.Set();
+    }
+
+    DestroyThread(pThread);
+
+    return 0;
+}
+
+
 HRESULT MulticoreJitProfilePlayer::ProcessProfile(const WCHAR * pFileName)
 {
     STANDARD_VM_CONTRACT;
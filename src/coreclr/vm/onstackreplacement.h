@@ -23,7 +23,8 @@ struct PerPatchpointInfo
     PerPatchpointInfo() : 
         m_osrMethodCode(0),
         m_patchpointCount(0),
-        m_flags(0)
+        m_flags(0),
+        m_firstHitMs(0)
 #if _DEBUG
         , m_patchpointId(0)
 #endif
@@ -44,6 +45,9 @@ struct PerPatchpointInfo
     LONG m_patchpointCount;
     // Status of this patchpoint
     LONG m_flags;
+    // Tick count (ms) of the first time jitted code called the helper at this patchpoint, 0 until then.
+    // Only used as a heuristic, so it's accessed without synchronization.
+    ULONGLONG m_firstHitMs;
 
 #if _DEBUG
     int m_patchpointId;
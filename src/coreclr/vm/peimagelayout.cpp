@@ -523,6 +523,8 @@ LoadedImageLayout::LoadedImageLayout(PEImage* pOwner, HRESULT* loadFailure)
     IfFailThrow(Init(m_Module, true));
     LOG((LF_LOADER, LL_INFO1000, "PEImage: Opened HMODULE %S\n", (LPCWSTR)pOwner->GetPath()));
 
+    PrefetchHotSections();
+
 #else
     HANDLE hFile = pOwner->GetFileHandle();
     INT64 offset = pOwner->GetOffset();
@@ -561,9 +563,58 @@ LoadedImageLayout::LoadedImageLayout(PEImage* pOwner, HRESULT* loadFailure)
         ApplyBaseRelocations(/* relocationMustWriteCopy*/ false);
         SetRelocated();
     }
+
+    PrefetchHotSections();
 #endif
 }
 
+// The metadata and the Ready to Run sections are read as soon as the image is opened and while its types and methods are
+// loaded, mostly in an order that faults the pages in one at a time. When ReadyToRunPrefetchSections is set, the OS is asked to
+// read those ranges in ahead of use. The request only starts asynchronous reads, so it does not delay the load, and failures are
+// ignored, the pages are then faulted in on first access as before. Code is left to be paged in on demand, as only part of it
+// is usually used.
+void LoadedImageLayout::PrefetchHotSections()
+{
+    STANDARD_VM_CONTRACT;
+
+    static ConfigDWORD prefetchSections;
+    if (prefetchSections.val(CLRConfig::EXTERNAL_ReadyToRunPrefetchSections) == 0 || !HasCorHeader())
+    {
+        return;
+    }
+
+    const COUNT_T MaxRanges = 32;
+    WIN32_MEMORY_RANGE_ENTRY ranges[MaxRanges];
+    COUNT_T rangeCount = 0;
+
+    COUNT_T metadataSize;
+    PTR_CVOID pMetadata = GetMetadata(&metadataSize);
+    ranges[rangeCount].VirtualAddress = (PVOID)pMetadata;
+    ranges[rangeCount].NumberOfBytes = metadataSize;
+    rangeCount++;
+
+    if (HasReadyToRunHeader())
+    {
+        READYTORUN_HEADER *pHeader = GetReadyToRunHeader();
+        READYTORUN_SECTION *pSections = (READYTORUN_SECTION*)(pHeader + 1);
+        for (DWORD i = 0; i < pHeader->CoreHeader.NumberOfSections && rangeCount < MaxRanges; i++)
+        {
+            if (pSections[i].Section.Size == 0)
+                continue;
+
+            ranges[rangeCount].VirtualAddress = (PVOID)GetRvaData(pSections[i].Section.VirtualAddress);
+            ranges[rangeCount].NumberOfBytes = pSections[i].Section.Size;
+            rangeCount++;
+        }
+    }
+
+    if (!PrefetchVirtualMemory(GetCurrentProcess(), rangeCount, ranges, 0))
+    {
+        LOG((LF_LOADER, LL_INFO100, "PEImage: prefetching sections of %S failed with %d\n",
+            (LPCWSTR)m_pOwner->GetPath(), GetLastError()));
+    }
+}
+
 #if !defined(TARGET_UNIX)
 LoadedImageLayout::LoadedImageLayout(PEImage* pOwner, HMODULE hModule)
 {
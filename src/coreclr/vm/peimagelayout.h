@@ -130,6 +130,9 @@ public:
     LoadedImageLayout(PEImage* pOwner, HMODULE hModule);
 #endif // !TARGET_UNIX
     ~LoadedImageLayout();
+
+private:
+    void PrefetchHotSections();
 #endif // !DACCESS_COMPILE
 };
 
@@ -70,7 +70,8 @@ PendingTypeLoadTable::TableEntry *PendingTypeLoadTable::AllocNewEntry()
     CONTRACTL_END
 
 #ifdef _DEBUG
-    m_dwDebugMemory += (DWORD) (sizeof(PendingTypeLoadTable::TableEntry));
+    // Buckets protected by different locks are updated concurrently
+    InterlockedExchangeAdd((LONG *)&m_dwDebugMemory, (LONG)sizeof(PendingTypeLoadTable::TableEntry));
 #endif
 
     return (PendingTypeLoadTable::TableEntry *) new (nothrow) BYTE[sizeof(PendingTypeLoadTable::TableEntry)];
@@ -91,7 +92,7 @@ void PendingTypeLoadTable::FreeEntry(PendingTypeLoadTable::TableEntry * pEntry)
     delete[] ((BYTE*)pEntry);
 
 #ifdef _DEBUG
-    m_dwDebugMemory -= (DWORD) (sizeof(PendingTypeLoadTable::TableEntry));
+    InterlockedExchangeAdd((LONG *)&m_dwDebugMemory, -(LONG)sizeof(PendingTypeLoadTable::TableEntry));
 #endif
 }
 
@@ -199,7 +200,7 @@ PendingTypeLoadTable::TableEntry *PendingTypeLoadTable::FindItem(TypeKey *pKey)
 
 
 #ifdef _DEBUG
-void PendingTypeLoadTable::Dump()
+void PendingTypeLoadTable::Dump(DWORD dwLockIndex, DWORD dwLockCount)
 {
     CONTRACTL
     {
@@ -210,7 +211,7 @@ void PendingTypeLoadTable::Dump()
     CONTRACTL_END
 
     LOG((LF_CLASSLOADER, LL_INFO10000, "PHASEDLOAD: table contains:\n"));
-    for (DWORD i = 0; i < m_dwNumBuckets; i++)
+    for (DWORD i = dwLockIndex; i < m_dwNumBuckets; i += dwLockCount)
     {
         for (TableEntry *pSearch = m_pBuckets[i]; pSearch; pSearch = pSearch->pNext)
         {
@@ -253,7 +253,8 @@ public:
     TableEntry* AllocNewEntry();
     void FreeEntry(TableEntry* pEntry);
 #ifdef _DEBUG
-    void            Dump();
+    // Dumps the buckets protected by the given one of the dwLockCount locks of the table's owner
+    void            Dump(DWORD dwLockIndex, DWORD dwLockCount);
 #endif
 
 private:
@@ -21,6 +21,7 @@
 Volatile<bool> PerfMap::s_enabled = false;
 PerfMap * PerfMap::s_Current = nullptr;
 bool PerfMap::s_ShowOptimizationTiers = false;
+bool PerfMap::s_JitDumpEnabled = false;
 
 // Initialize the map for the process - called from EEStartupHelper.
 void PerfMap::Initialize()
@@ -28,13 +29,14 @@ void PerfMap::Initialize()
     LIMITED_METHOD_CONTRACT;
 
     // Only enable the map if requested.
-    if (CLRConfig::GetConfigValue(CLRConfig::EXTERNAL_PerfMapEnabled))
+    PerfMapType perfMapType = (PerfMapType)CLRConfig::GetConfigValue(CLRConfig::EXTERNAL_PerfMapEnabled);
+    if (perfMapType != PerfMapType::DISABLED)
     {
         // Get the current process id.
         int currentPid = GetCurrentProcessId();
 
-        // Create the map.
-        s_Current = new PerfMap(currentPid);
+        // Create the map, without the perf map and perfinfo files if only the jitdump file is requested.
+        s_Current = perfMapType == PerfMapType::JITDUMP ? new PerfMap() : new PerfMap(currentPid);
 
         int signalNum = (int) CLRConfig::GetConfigValue(CLRConfig::EXTERNAL_PerfMapIgnoreSignal);
 
@@ -48,23 +50,26 @@ void PerfMap::Initialize()
             s_ShowOptimizationTiers = true;
         }
 
-        s_enabled = true;
+        if (perfMapType != PerfMapType::PERFMAP)
+        {
+            const char* jitdumpPath;
+            char jitdumpPathBuffer[4096];
 
-        const char* jitdumpPath;
-        char jitdumpPathBuffer[4096];
+            CLRConfigNoCache value = CLRConfigNoCache::Get("PerfMapJitDumpPath");
+            if (value.IsSet())
+            {
+                jitdumpPath = value.AsString();
+            }
+            else
+            {
+                GetTempPathA(sizeof(jitdumpPathBuffer) - 1, jitdumpPathBuffer);
+                jitdumpPath = jitdumpPathBuffer;
+            }
 
-        CLRConfigNoCache value = CLRConfigNoCache::Get("PerfMapJitDumpPath");
-        if (value.IsSet())
-        {
-            jitdumpPath = value.AsString();
-        }
-        else
-        {
-            GetTempPathA(sizeof(jitdumpPathBuffer) - 1, jitdumpPathBuffer);
-            jitdumpPath = jitdumpPathBuffer;
+            s_JitDumpEnabled = PAL_PerfJitDump_Start(jitdumpPath) == 0;
         }
 
-        PAL_PerfJitDump_Start(jitdumpPath);
+        s_enabled = true;
     }
 }
 
@@ -188,9 +193,10 @@ void PerfMap::LogMethod(MethodDesc * pMethod, PCODE pCode, size_t codeSize, cons
         PRECONDITION(codeSize > 0);
     } CONTRACTL_END;
 
-    if (m_FileStream == nullptr || m_ErrorEncountered)
+    bool writeMapFile = m_FileStream != nullptr && !m_ErrorEncountered;
+    if (!writeMapFile && !s_JitDumpEnabled)
     {
-        // A failure occurred, do not log.
+        // A failure occurred, or there is no file to log to.
         return;
     }
 
@@ -201,17 +207,25 @@ void PerfMap::LogMethod(MethodDesc * pMethod, PCODE pCode, size_t codeSize, cons
         SString name;
         pMethod->GetFullMethodInfo(name);
 
-        // Build the map file line.
         if (optimizationTier != nullptr && s_ShowOptimizationTiers)
         {
             name.AppendPrintf("[%s]", optimizationTier);
         }
-        SString line;
-        line.Printf(FMT_CODE_ADDR " %x %s\n", pCode, codeSize, name.GetUTF8());
 
-        // Write the line.
-        WriteLine(line);
-        PAL_PerfJitDump_LogMethod((void*)pCode, codeSize, name.GetUTF8(), nullptr, nullptr);
+        if (writeMapFile)
+        {
+            // Build the map file line.
+            SString line;
+            line.Printf(FMT_CODE_ADDR " %x %s\n", pCode, codeSize, name.GetUTF8());
+
+            // Write the line.
+            WriteLine(line);
+        }
+
+        if (s_JitDumpEnabled)
+        {
+            PAL_PerfJitDump_LogMethod((void*)pCode, codeSize, name.GetUTF8(), nullptr, nullptr);
+        }
     }
     EX_CATCH{} EX_END_CATCH(SwallowAllExceptions);
 }
@@ -277,7 +291,7 @@ void PerfMap::LogPreCompiledMethod(MethodDesc * pMethod, PCODE pCode)
 {
     LIMITED_METHOD_CONTRACT;
 
-    if (!s_enabled)
+    if (!s_enabled || !s_JitDumpEnabled)
     {
         return;
     }
@@ -326,7 +340,13 @@ void PerfMap::LogStubs(const char* stubType, const char* stubOwner, PCODE pCode,
 {
     LIMITED_METHOD_CONTRACT;
 
-    if (!s_enabled || s_Current->m_FileStream == nullptr)
+    if (!s_enabled)
+    {
+        return;
+    }
+
+    bool writeMapFile = s_Current->m_FileStream != nullptr;
+    if (!writeMapFile && !s_JitDumpEnabled)
     {
         return;
     }
@@ -346,12 +366,20 @@ void PerfMap::LogStubs(const char* stubType, const char* stubOwner, PCODE pCode,
         SString name;
         // Build the map file line.
         name.Printf("stub<%d> %s<%s>", ++(s_Current->m_StubsMapped), stubType, stubOwner);
-        SString line;
-        line.Printf(FMT_CODE_ADDR " %x %s\n", pCode, codeSize, name.GetUTF8());
 
-        // Write the line.
-        s_Current->WriteLine(line);
-        PAL_PerfJitDump_LogMethod((void*)pCode, codeSize, name.GetUTF8(), nullptr, nullptr);
+        if (writeMapFile)
+        {
+            SString line;
+            line.Printf(FMT_CODE_ADDR " %x %s\n", pCode, codeSize, name.GetUTF8());
+
+            // Write the line.
+            s_Current->WriteLine(line);
+        }
+
+        if (s_JitDumpEnabled)
+        {
+            PAL_PerfJitDump_LogMethod((void*)pCode, codeSize, name.GetUTF8(), nullptr, nullptr);
+        }
     }
     EX_CATCH{} EX_END_CATCH(SwallowAllExceptions);
 }
@@ -12,6 +12,15 @@
 
 class PerfInfo;
 
+// Values of PerfMapEnabled, selecting which files are written
+enum class PerfMapType
+{
+    DISABLED = 0,
+    ALL      = 1,
+    JITDUMP  = 2,
+    PERFMAP  = 3
+};
+
 // Generates a perfmap file.
 class PerfMap
 {
@@ -24,6 +33,9 @@ private:
     // Indicates whether optimization tiers should be shown for methods in perf maps
     static bool s_ShowOptimizationTiers;
 
+    // Indicates whether methods are logged to the jitdump file
+    static bool s_JitDumpEnabled;
+
     // The file stream to write the map to.
     CFileStream * m_FileStream;
 
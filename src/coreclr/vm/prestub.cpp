@@ -476,7 +476,7 @@ PCODE MethodDesc::GetPrecompiledCode(PrepareCodeConfig* pConfig, bool shouldTier
                 {
                     if (MulticoreJitManager::IsMethodSupported(this))
                     {
-                        mcJitManager.RecordMethodJitOrLoad(this);
+                        mcJitManager.RecordMethodJitOrLoad(this, false);
                     }
                 }
             }
@@ -1008,7 +1008,11 @@ PCODE MethodDesc::JitCompileCodeLocked(PrepareCodeConfig* pConfig, JitListLockEn
 
 #ifdef FEATURE_TIERED_COMPILATION
     // Finalize the optimization tier before SetNativeCode() is called
-    bool shouldCountCalls = pFlags->IsSet(CORJIT_FLAGS::CORJIT_FLAG_TIER0) && pConfig->FinalizeOptimizationTierForTier0LoadOrJit();
+    // Multi-core JIT may jit a tier 0 code version optimized (see TieredCompilationManager::GetJitFlags()), the tier is finalized
+    // in the same way as when the JIT switches to optimizing
+    bool shouldCountCalls =
+        (pFlags->IsSet(CORJIT_FLAGS::CORJIT_FLAG_TIER0) || (pConfig->IsForMulticoreJit() && pConfig->JitSwitchedToOptimized())) &&
+        pConfig->FinalizeOptimizationTierForTier0LoadOrJit();
 #endif
 
     // Aside from rejit, performing a SetNativeCodeInterlocked at this point
@@ -1055,7 +1059,8 @@ PCODE MethodDesc::JitCompileCodeLocked(PrepareCodeConfig* pConfig, JitListLockEn
         {
             if (MulticoreJitManager::IsMethodSupported(this))
             {
-                mcJitManager.RecordMethodJitOrLoad(this); // Tell multi-core JIT manager to record method on successful JITting
+                // Tell multi-core JIT manager to record method on successful JITting
+                mcJitManager.RecordMethodJitOrLoad(this, !!pConfig->ReadyToRunRejectedPrecompiledCode());
             }
         }
     }
@@ -0,0 +1,316 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+// ===========================================================================
+// File: ReadyToRunFixupResolver.CPP
+//
+// ===========================================================================
+
+#include "common.h"
+#include "readytorunfixupresolver.h"
+
+// # Overall workflow
+//
+// Fixup cells of Ready to Run code are normally resolved lazily. Before a method's code is used, Module::FixupDelayList()
+// resolves each cell in the method's fixup list that is still null, one at a time, which adds up to a large part of startup for
+// big applications. When ReadyToRunFixupResolverThreads is set, DomainAssembly::FinishLoad() queues the import sections of the
+// module in batches of cells once it is ready for type loads, and up to that many background threads resolve the batches with
+// LoadDynamicInfoEntry(), just as the lazy path would. Methods that are compiled or loaded later find most of their cells already
+// resolved. Methods listed in a multi-core JIT profile are already prepared, fixups included, by the playback workers.
+//
+// Only cells that resolve to type, method, and field handles are resolved ahead of use. Other kinds of fixups either have side
+// effects (strings are interned, statics are allocated) or are checks that may reject code or fail fast, which must only happen
+// for code that is actually used. Cells whose signature refers to a module that is not loaded yet are skipped as well, so that
+// resolving ahead of use does not load assemblies.
+//
+// # Publishing resolved cells
+//
+// No lock is taken around the resolution of a cell. LoadDynamicInfoEntry() publishes the resolved value with a single store
+// after a barrier, and a cell only ever goes from null to the one value that its signature resolves to, so a background thread
+// and a thread running FixupDelayList() that race on the same cell store the same value and readers see either null, in which
+// case they resolve the cell themselves, or the resolved value.
+//
+// # Error handling
+//
+// Cells that fail to resolve are left null and the failure is swallowed, the lazy path resolves them again when the code using
+// them is needed and reports the failure there as before.
+
+#if defined(FEATURE_READYTORUN) && !defined(DACCESS_COMPILE)
+
+static ReadyToRunFixupResolver *g_pReadyToRunFixupResolver = nullptr;
+
+void ReadyToRunFixupResolver::Init()
+{
+    STANDARD_VM_CONTRACT;
+
+    UINT32 maxThreadCount = CLRConfig::GetConfigValue(CLRConfig::INTERNAL_ReadyToRunFixupResolverThreads);
+    if (maxThreadCount == 0)
+    {
+        return;
+    }
+
+    _ASSERTE(g_pReadyToRunFixupResolver == nullptr);
+    g_pReadyToRunFixupResolver = new ReadyToRunFixupResolver(min(maxThreadCount, (UINT32)GetCurrentProcessCpuCount()));
+}
+
+ReadyToRunFixupResolver::ReadyToRunFixupResolver(UINT32 maxThreadCount)
+    : m_lock(CrstLeafLock)
+    , m_nextBatchIndex(0)
+    , m_maxThreadCount(maxThreadCount)
+    , m_threadCount(0)
+{
+    LIMITED_METHOD_CONTRACT;
+}
+
+void ReadyToRunFixupResolver::QueueModule(Module *pModule)
+{
+    STANDARD_VM_CONTRACT;
+    _ASSERTE(pModule != nullptr);
+
+    if (g_pReadyToRunFixupResolver == nullptr || !pModule->IsReadyToRun())
+    {
+        return;
+    }
+
+    // Collectible modules may be unloaded while their batches are queued. The import sections of a composite image are shared by
+    // its component modules and are resolved lazily as usual.
+    ReadyToRunInfo *pReadyToRunInfo = pModule->GetReadyToRunInfo();
+    if (pModule->IsCollectible() || pReadyToRunInfo->IsComponentAssembly() || pReadyToRunInfo->ReadyToRunCodeDisabled())
+    {
+        return;
+    }
+
+    EX_TRY
+    {
+        g_pReadyToRunFixupResolver->QueueModuleCells(pModule);
+    }
+    EX_CATCH
+    {
+        STRESS_LOG1(LF_ZAP, LL_WARNING, "ReadyToRunFixupResolver::QueueModule: "
+            "Exception while queuing fixups, hr=0x%x\n",
+            GET_EXCEPTION()->GetHR());
+    }
+    EX_END_CATCH(RethrowTerminalExceptions);
+}
+
+void ReadyToRunFixupResolver::QueueModuleCells(Module *pModule)
+{
+    STANDARD_VM_CONTRACT;
+
+    COUNT_T nSections;
+    PTR_READYTORUN_IMPORT_SECTION pSections = pModule->GetImportSections(&nSections);
+
+    UINT32 workerCount = 0;
+    {
+        CrstHolder lockHolder(&m_lock);
+
+        for (COUNT_T iSection = 0; iSection < nSections; iSection++)
+        {
+            PTR_READYTORUN_IMPORT_SECTION pSection = pSections + iSection;
+
+            // Eager cells are already resolved, cells of code sections and of other types of sections are bound through
+            // delay load helpers rather than fixup lists
+            if (pSection->Flags != ReadyToRunImportSectionFlags::None ||
+                pSection->Type != ReadyToRunImportSectionType::Unknown ||
+                pSection->EntrySize != sizeof(TADDR) ||
+                pSection->Signatures == 0)
+            {
+                continue;
+            }
+
+            COUNT_T cellCount = pSection->Section.Size / sizeof(TADDR);
+            for (COUNT_T firstIndex = 0; firstIndex < cellCount; firstIndex += CellsPerBatch)
+            {
+                FixupBatch batch;
+                batch.pModule = pModule;
+                batch.pSection = pSection;
+                batch.firstIndex = firstIndex;
+                batch.endIndex = min(firstIndex + CellsPerBatch, cellCount);
+                m_batches.Append(batch);
+            }
+        }
+
+        COUNT_T queuedBatchCount = m_batches.GetCount() - m_nextBatchIndex;
+        if (m_threadCount < m_maxThreadCount && queuedBatchCount != 0)
+        {
+            workerCount = min(m_maxThreadCount - m_threadCount, (UINT32)queuedBatchCount);
+            m_threadCount += workerCount;
+        }
+    }
+
+    if (workerCount != 0)
+    {
+        CreateWorkers(workerCount);
+    }
+}
+
+void ReadyToRunFixupResolver::CreateWorkers(UINT32 workerCount)
+{
+    STANDARD_VM_CONTRACT;
+
+    UINT32 createdWorkerCount = 0;
+
+    EX_TRY
+    {
+        for (; createdWorkerCount < workerCount; createdWorkerCount++)
+        {
+            Thread *newThread = SetupUnstartedThread();
+            _ASSERTE(newThread != nullptr);
+            newThread->SetBackground(true);
+
+            if (!newThread->CreateNewThread(0, WorkerThreadProc, newThread, W(".NET ReadyToRun Fixup Resolver")))
+            {
+                newThread->DecExternalCount(false);
+                break;
+            }
+
+            if (newThread->StartThread() == 0)
+            {
+                break;
+            }
+        }
+    }
+    EX_CATCH
+    {
+    }
+    EX_END_CATCH(SwallowAllExceptions);
+
+    if (createdWorkerCount != workerCount)
+    {
+        // Queued batches are left to the workers that did start, or to the next module that is queued
+        CrstHolder lockHolder(&m_lock);
+
+        m_threadCount -= workerCount - createdWorkerCount;
+    }
+}
+
+DWORD WINAPI ReadyToRunFixupResolver::WorkerThreadProc(void *args)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_TRIGGERS;
+        MODE_ANY;
+        ENTRY_POINT;
+    }
+    CONTRACTL_END;
+
+    _ASSERTE(args != nullptr);
+    Thread *pThread = (Thread *)args;
+
+    ReadyToRunFixupResolver *pResolver = g_pReadyToRunFixupResolver;
+    _ASSERTE(pResolver != nullptr);
+
+    if (pThread->HasStarted())
+    {
+        // Resolving a cell must not run managed code, such as assembly resolution handlers, on behalf of code that may never run
+        ThreadStateNCStackHolder holder(TRUE, Thread::TSNC_CallingManagedCodeDisabled);
+
+        GCX_PREEMP();
+
+        Module *pModule;
+        PTR_READYTORUN_IMPORT_SECTION pSection;
+        COUNT_T firstIndex;
+        COUNT_T endIndex;
+        while (pResolver->TryDequeueBatch(&pModule, &pSection, &firstIndex, &endIndex))
+        {
+            ResolveBatch(pModule, pSection, firstIndex, endIndex);
+        }
+    }
+    else
+    {
+        CrstHolder lockHolder(&pResolver->m_lock);
+
+        pResolver->m_threadCount--;
+    }
+
+    // It needs to be deleted after GCX_PREEMP ends
+    DestroyThread(pThread);
+
+    return 0;
+}
+
+bool ReadyToRunFixupResolver::TryDequeueBatch(
+    Module **ppModule,
+    PTR_READYTORUN_IMPORT_SECTION *ppSection,
+    COUNT_T *pFirstIndex,
+    COUNT_T *pEndIndex)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_PREEMPTIVE;
+    }
+    CONTRACTL_END;
+
+    CrstHolder lockHolder(&m_lock);
+
+    if (m_nextBatchIndex == m_batches.GetCount())
+    {
+        // The worker exits under the lock, so that a module queued concurrently either sees it running or creates a new one
+        m_batches.Clear();
+        m_nextBatchIndex = 0;
+        m_threadCount--;
+        return false;
+    }
+
+    const FixupBatch &batch = m_batches[m_nextBatchIndex++];
+    *ppModule = batch.pModule;
+    *ppSection = batch.pSection;
+    *pFirstIndex = batch.firstIndex;
+    *pEndIndex = batch.endIndex;
+    return true;
+}
+
+void ReadyToRunFixupResolver::ResolveBatch(
+    Module *pModule,
+    PTR_READYTORUN_IMPORT_SECTION pSection,
+    COUNT_T firstIndex,
+    COUNT_T endIndex)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_TRIGGERS;
+        MODE_PREEMPTIVE;
+    }
+    CONTRACTL_END;
+
+    PEImageLayout *pNativeImage = pModule->GetReadyToRunImage();
+    SIZE_T *pCells = (SIZE_T *)pNativeImage->GetRvaData(pSection->Section.VirtualAddress);
+    PTR_DWORD pSignatures = dac_cast<PTR_DWORD>(pNativeImage->GetRvaData(pSection->Signatures));
+
+    for (COUNT_T fixupIndex = firstIndex; fixupIndex < endIndex; fixupIndex++)
+    {
+        SIZE_T *fixupCell = pCells + fixupIndex;
+        if (VolatileLoadWithoutBarrier(fixupCell) != NULL)
+        {
+            continue;
+        }
+
+        EX_TRY
+        {
+            PCCOR_SIGNATURE pBlob = pModule->GetNativeFixupBlobData(pSignatures[fixupIndex]);
+
+            BYTE kind = *pBlob++;
+            bool canResolve = true;
+
+            if (kind & ENCODE_MODULE_OVERRIDE)
+            {
+                canResolve = pModule->GetModuleFromIndexIfLoaded(CorSigUncompressData(pBlob)) != NULL;
+                kind &= ~ENCODE_MODULE_OVERRIDE;
+            }
+
+            if (canResolve && (kind == ENCODE_TYPE_HANDLE || kind == ENCODE_METHOD_HANDLE || kind == ENCODE_FIELD_HANDLE))
+            {
+                LoadDynamicInfoEntry(pModule, pSignatures[fixupIndex], fixupCell);
+            }
+        }
+        EX_CATCH
+        {
+        }
+        EX_END_CATCH(SwallowAllExceptions);
+    }
+}
+
+#endif // FEATURE_READYTORUN && !DACCESS_COMPILE
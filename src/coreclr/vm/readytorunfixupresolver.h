@@ -0,0 +1,56 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+// ===========================================================================
+// File: ReadyToRunFixupResolver.h
+//
+// ===========================================================================
+
+#ifndef READYTORUN_FIXUP_RESOLVER_H
+#define READYTORUN_FIXUP_RESOLVER_H
+
+#if defined(FEATURE_READYTORUN) && !defined(DACCESS_COMPILE)
+
+// ReadyToRunFixupResolver resolves the fixup cells of Ready to Run images in batches on background threads once the images are
+// loaded (see ReadyToRunFixupResolverThreads), so that the first calls to the methods using them find them already resolved
+// instead of resolving them one at a time through Module::FixupDelayList().
+class ReadyToRunFixupResolver
+{
+public:
+    static void Init();
+
+    // Queues the fixup cells of the module's import sections to be resolved, called once the module is ready for type loads
+    static void QueueModule(Module *pModule);
+
+private:
+    ReadyToRunFixupResolver(UINT32 maxThreadCount);
+
+    void QueueModuleCells(Module *pModule);
+    void CreateWorkers(UINT32 workerCount);
+
+    static DWORD WINAPI WorkerThreadProc(void *args);
+    bool TryDequeueBatch(Module **ppModule, PTR_READYTORUN_IMPORT_SECTION *ppSection, COUNT_T *pFirstIndex, COUNT_T *pEndIndex);
+    static void ResolveBatch(Module *pModule, PTR_READYTORUN_IMPORT_SECTION pSection, COUNT_T firstIndex, COUNT_T endIndex);
+
+private:
+    // Number of fixup cells in a batch, large enough that workers rarely contend on the queue lock
+    static const COUNT_T CellsPerBatch = 256;
+
+private:
+    struct FixupBatch
+    {
+        Module *pModule;
+        PTR_READYTORUN_IMPORT_SECTION pSection;
+        COUNT_T firstIndex;
+        COUNT_T endIndex;
+    };
+
+    Crst m_lock;
+    SArray<FixupBatch> m_batches;
+    COUNT_T m_nextBatchIndex;
+    UINT32 m_maxThreadCount;
+    UINT32 m_threadCount;
+};
+
+#endif // FEATURE_READYTORUN && !DACCESS_COMPILE
+
+#endif // READYTORUN_FIXUP_RESOLVER_H
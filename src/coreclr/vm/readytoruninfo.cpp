@@ -16,6 +16,7 @@
 #include "method.hpp"
 #include "wellknownattributes.h"
 #include "nativeimage.h"
+#include "frozenobjectheap.h"
 
 using namespace NativeFormat;
 
@@ -719,7 +720,8 @@ ReadyToRunInfo::ReadyToRunInfo(Module * pModule, LoaderAllocator* pLoaderAllocat
     m_readyToRunCodeDisabled(FALSE),
     m_Crst(CrstReadyToRunEntryPointToMethodDescMap),
     m_pPersistentInlineTrackingMap(NULL),
-    m_pNextR2RForUnrelatedCode(NULL)
+    m_pNextR2RForUnrelatedCode(NULL),
+    m_frozenObjectsSegment(NULL)
 {
     STANDARD_VM_CONTRACT;
 
@@ -920,6 +922,73 @@ ReadyToRunInfo::ReadyToRunInfo(Module * pModule, LoaderAllocator* pLoaderAllocat
 
         m_attributesPresence = newFilter;
     }
+
+    // For format version 8.1 and later, there is an optional section of preinitialized objects
+    m_pFrozenObjectsSection = IsImageVersionAtLeast(8, 1) ? m_component.FindSection(ReadyToRunSectionType::FrozenObjects) : NULL;
+}
+
+// Returns the object at the given offset in the FrozenObjects section, registering the section with the GC
+// as a frozen segment the first time any of them is asked for. The types of the objects can't be loaded
+// while the module is being loaded, so this happens from the FrozenObject fixups rather than at image load.
+// Returns NULL if the objects can't be used, in which case the code that refers to them must not be used
+// either.
+Object* ReadyToRunInfo::GetFrozenObject(DWORD offset)
+{
+    STANDARD_VM_CONTRACT;
+
+#ifndef FEATURE_BASICFREEZE
+    // GC is required to support frozen segments
+    return NULL;
+#else // FEATURE_BASICFREEZE
+    IMAGE_DATA_DIRECTORY * pFrozenObjectsDir = m_pFrozenObjectsSection;
+    if (pFrozenObjectsDir == NULL || m_pModule->IsCollectible())
+    {
+        // Frozen segments are never unregistered so they can't live in an image that can be unloaded
+        return NULL;
+    }
+
+    BYTE * pSection = (BYTE *)m_pComposite->GetLayout()->GetDirectoryData(pFrozenObjectsDir);
+    READYTORUN_FROZEN_OBJECTS_HEADER * pHeader = (READYTORUN_FROZEN_OBJECTS_HEADER *)pSection;
+    if ((pFrozenObjectsDir->Size < sizeof(READYTORUN_FROZEN_OBJECTS_HEADER)) ||
+        ((pFrozenObjectsDir->Size - sizeof(READYTORUN_FROZEN_OBJECTS_HEADER)) / sizeof(mdToken) < pHeader->NumberOfTypes) ||
+        ((uint64_t)pHeader->ObjectsOffset + pHeader->ObjectsSize > pFrozenObjectsDir->Size))
+    {
+        COMPlusThrowHR(COR_E_BADIMAGEFORMAT);
+    }
+
+    if (VolatileLoad(&m_frozenObjectsSegment) == NULL)
+    {
+        // Load all the types before taking the frozen object heap lock
+        DWORD numTypes = pHeader->NumberOfTypes;
+        mdToken * pTypeTokens = (mdToken *)(pHeader + 1);
+        NewArrayHolder<MethodTable *> pTypes = new MethodTable * [numTypes];
+        for (DWORD i = 0; i < numTypes; i++)
+        {
+            TypeHandle th = ClassLoader::LoadTypeDefOrRefOrSpecThrowing(m_pModule, pTypeTokens[i], NULL);
+            if (th.IsTypeDesc() || th.ContainsGenericVariables())
+            {
+                COMPlusThrowHR(COR_E_BADIMAGEFORMAT);
+            }
+
+            MethodTable * pMT = th.AsMethodTable();
+            pMT->EnsureInstanceActive();
+            pTypes[i] = pMT;
+        }
+
+        GCX_COOP();
+        SystemDomain::GetFrozenObjectHeapManager()->RegisterPreinitializedObjects(
+            pSection + pHeader->ObjectsOffset, pHeader->ObjectsSize, pTypes, numTypes, &m_frozenObjectsSegment);
+    }
+
+    if ((offset < (uint64_t)pHeader->ObjectsOffset + sizeof(ObjHeader)) ||
+        (offset >= (uint64_t)pHeader->ObjectsOffset + pHeader->ObjectsSize) ||
+        !IS_ALIGNED(offset, DATA_ALIGNMENT))
+    {
+        COMPlusThrowHR(COR_E_BADIMAGEFORMAT);
+    }
+
+    return (Object *)(pSection + offset);
+#endif // !FEATURE_BASICFREEZE
 }
 
 static bool SigMatchesMethodDesc(MethodDesc* pMD, SigPointer &sig, ModuleBase * pModule)
@@ -24,6 +24,8 @@
 
 #include "dbginterface.h"
 #include "argdestination.h"
+#include "ilstubcache.h"
+#include "dllimport.h"
 
 FCIMPL5(Object*, RuntimeFieldHandle::GetValue, ReflectFieldObject *pFieldUNSAFE, Object *instanceUNSAFE, ReflectClassBaseObject *pFieldTypeUNSAFE, ReflectClassBaseObject *pDeclaringTypeUNSAFE, CLR_BOOL *pDomainInitialized) {
     CONTRACTL {
@@ -469,6 +471,265 @@ public:
     }
 };
 
+// # Reflection invoke stubs
+//
+// When ReflectionInvokeStubThreshold is set, a method that has been invoked through reflection that many times is invoked through
+// an IL stub specialized to it instead of through the generic path below. The stub has the signature object(object, void**), it
+// loads the arguments from the byrefs passed by the managed caller, calls the method and boxes its return value, so the signature
+// walk, the argument copies and the boxing decisions are made once when the stub is jitted rather than on every call.
+//
+// Only the common cases are handled by stubs: static methods and instance methods of reference types, whose arguments and return
+// value are not pointers or byref-like, and whose return value is not a byref. Constructors and methods of collectible assemblies,
+// whose stubs would have to be freed with them, always use the generic path.
+
+CrstStatic ReflectionInvokeStubs::s_lock;
+PtrHashMap *ReflectionInvokeStubs::s_pStubInfos = NULL;
+
+void ReflectionInvokeStubs::Init()
+{
+    CONTRACTL
+    {
+        THROWS;
+        GC_NOTRIGGER;
+        MODE_ANY;
+    }
+    CONTRACTL_END;
+
+    if (g_pConfig->ReflectionInvokeStubThreshold() == 0)
+    {
+        return;
+    }
+
+    s_lock.Init(CrstLeafLock, CRST_UNSAFE_COOPGC);
+
+    s_pStubInfos = ::new PtrHashMap();
+
+    LockOwner lock = {&s_lock, IsOwnerOfCrst};
+    s_pStubInfos->Init(TRUE, &lock);
+}
+
+MethodDesc *ReflectionInvokeStubs::GetStub(MethodDesc *pMD, SIGNATURENATIVEREF *ppSig)
+{
+    CONTRACTL
+    {
+        THROWS;
+        GC_TRIGGERS;
+        MODE_COOPERATIVE;
+        PRECONDITION(CheckPointer(pMD));
+        PRECONDITION(CheckPointer(ppSig));
+    }
+    CONTRACTL_END;
+
+    if (s_pStubInfos == NULL)
+    {
+        return NULL;
+    }
+
+    StubInfo *pInfo = (StubInfo *)s_pStubInfos->LookupValue((UPTR)pMD, NULL);
+    if (pInfo == (StubInfo *)INVALIDENTRY)
+    {
+        NewHolder<StubInfo> pNewInfo(new StubInfo());
+        pNewInfo->m_invokeCount = 0;
+        pNewInfo->m_canUseStub = CanUseStub(pMD, ppSig);
+        pNewInfo->m_pStubMD = NULL;
+
+        CrstHolder lockHolder(&s_lock);
+
+        pInfo = (StubInfo *)s_pStubInfos->LookupValue((UPTR)pMD, NULL);
+        if (pInfo == (StubInfo *)INVALIDENTRY)
+        {
+            s_pStubInfos->InsertValue((UPTR)pMD, pNewInfo);
+            pInfo = pNewInfo.Extract();
+        }
+    }
+
+    if (!pInfo->m_canUseStub)
+    {
+        return NULL;
+    }
+
+    MethodDesc *pStubMD = VolatileLoad(&pInfo->m_pStubMD);
+    if (pStubMD != NULL)
+    {
+        return pStubMD;
+    }
+
+    // Only the thread that reaches the threshold creates the stub, the others keep using the generic path until it is published
+    if ((DWORD)InterlockedIncrement(&pInfo->m_invokeCount) != g_pConfig->ReflectionInvokeStubThreshold())
+    {
+        return NULL;
+    }
+
+    EX_TRY
+    {
+        pStubMD = CreateStub(pMD, ppSig);
+    }
+    EX_CATCH
+    {
+        STRESS_LOG1(LF_STUBS, LL_WARNING, "ReflectionInvokeStubs::GetStub: "
+            "Exception while creating the stub, hr=0x%x\n",
+            GET_EXCEPTION()->GetHR());
+    }
+    EX_END_CATCH(RethrowTerminalExceptions);
+
+    if (pStubMD == NULL)
+    {
+        pInfo->m_canUseStub = false;
+        return NULL;
+    }
+
+    VolatileStore(&pInfo->m_pStubMD, pStubMD);
+    return pStubMD;
+}
+
+bool ReflectionInvokeStubs::CanUseStub(MethodDesc *pMD, SIGNATURENATIVEREF *ppSig)
+{
+    CONTRACTL
+    {
+        THROWS;
+        GC_TRIGGERS;
+        MODE_COOPERATIVE;
+    }
+    CONTRACTL_END;
+
+    if (pMD->GetLoaderAllocator()->IsCollectible() ||
+        pMD->IsSharedByGenericInstantiations() ||
+        pMD->RequiresInstArg() ||
+        pMD->IsUnboxingStub() ||
+        pMD->IsVarArg())
+    {
+        return false;
+    }
+
+    // Value type instance methods need the boxed target to be unboxed, or rebuilt for Nullable<T>, and static virtual methods
+    // need a constrained call
+    MethodTable *pMT = pMD->GetMethodTable();
+    if (pMD->IsStatic() ? pMT->IsInterface() : pMT->IsValueType())
+    {
+        return false;
+    }
+
+    INT32 numArgs = (*ppSig)->NumFixedArgs();
+    for (INT32 i = 0; i < numArgs; i++)
+    {
+        TypeHandle thArg = (*ppSig)->GetArgumentAt(i);
+        CorElementType argType = thArg.GetSignatureCorElementType();
+        if (argType == ELEMENT_TYPE_PTR || argType == ELEMENT_TYPE_FNPTR || thArg.IsByRefLike())
+        {
+            return false;
+        }
+    }
+
+    TypeHandle thRet = (*ppSig)->GetReturnTypeHandle();
+    CorElementType retType = thRet.GetSignatureCorElementType();
+    if (retType == ELEMENT_TYPE_BYREF || retType == ELEMENT_TYPE_PTR || retType == ELEMENT_TYPE_FNPTR || thRet.IsByRefLike())
+    {
+        return false;
+    }
+
+    return true;
+}
+
+MethodDesc *ReflectionInvokeStubs::CreateStub(MethodDesc *pMD, SIGNATURENATIVEREF *ppSig)
+{
+    CONTRACT(MethodDesc *)
+    {
+        THROWS;
+        GC_TRIGGERS;
+        MODE_COOPERATIVE;
+        POSTCONDITION(CheckPointer(RETVAL));
+    }
+    CONTRACT_END;
+
+    // object Stub(object target, void** args)
+    static const BYTE s_stubSig[] =
+    {
+        IMAGE_CEE_CS_CALLCONV_DEFAULT,
+        2,
+        ELEMENT_TYPE_OBJECT,
+        ELEMENT_TYPE_OBJECT,
+        ELEMENT_TYPE_I
+    };
+
+    if (pMD->IsStatic() || pMD->HasMethodInstantiation() || pMD->IsInterface())
+    {
+        pMD->EnsureActive();
+    }
+
+    SigTypeContext emptyCtx;
+
+    ILStubLinker sl(pMD->GetModule(),
+                    Signature(s_stubSig, sizeof(s_stubSig)),
+                    &emptyCtx,
+                    NULL,
+                    ILSTUB_LINKER_FLAG_NONE);
+
+    ILCodeStream *pCode = sl.NewCodeStream(ILStubLinker::kDispatch);
+
+    if (!pMD->IsStatic())
+    {
+        pCode->EmitLDARG(0);
+    }
+
+    INT32 numArgs = (*ppSig)->NumFixedArgs();
+    for (INT32 i = 0; i < numArgs; i++)
+    {
+        TypeHandle thArg = (*ppSig)->GetArgumentAt(i);
+
+        pCode->EmitLDARG(1);
+        pCode->EmitLDC(i * sizeof(PVOID));
+        pCode->EmitADD();
+        pCode->EmitLDIND_I();
+
+        // Byref arguments are passed the byref itself, other arguments are loaded from it
+        if (!thArg.IsByRef())
+        {
+            pCode->EmitLDOBJ(pCode->GetToken(thArg));
+        }
+    }
+
+    TypeHandle thRet = (*ppSig)->GetReturnTypeHandle();
+    bool isReturnTypeVoid = thRet.GetSignatureCorElementType() == ELEMENT_TYPE_VOID;
+
+    int numInArgs = numArgs + (pMD->IsStatic() ? 0 : 1);
+    if (pMD->IsVtableMethod())
+    {
+        pCode->EmitCALLVIRT(pCode->GetToken(pMD), numInArgs, isReturnTypeVoid ? 0 : 1);
+    }
+    else
+    {
+        pCode->EmitCALL(pCode->GetToken(pMD), numInArgs, isReturnTypeVoid ? 0 : 1);
+    }
+
+    if (isReturnTypeVoid)
+    {
+        pCode->EmitLDNULL();
+    }
+    else if (thRet.IsValueType())
+    {
+        // Boxing a Nullable<T> produces a boxed T or null, like Nullable::NormalizeBox() does in the generic path
+        pCode->EmitBOX(pCode->GetToken(thRet));
+    }
+
+    pCode->EmitRET();
+
+    Module *pLoaderModule = pMD->GetLoaderModule();
+    MethodDesc *pStubMD = ILStubCache::CreateAndLinkNewILStubMethodDesc(pMD->GetLoaderAllocator(),
+                                                                        pLoaderModule->GetILStubCache()->GetOrCreateStubMethodTable(pLoaderModule),
+                                                                        ILSTUB_REFLECTION_INVOKE,
+                                                                        pMD->GetModule(),
+                                                                        s_stubSig, sizeof(s_stubSig),
+                                                                        &emptyCtx,
+                                                                        &sl);
+
+#ifdef _DEBUG
+    LOG((LF_STUBS, LL_INFO1000, "REFLECTIONINVOKE: Stub created for %s::%s\n", pMD->m_pszDebugClassName, pMD->m_pszDebugMethodName));
+    sl.LogILStub(CORJIT_FLAGS());
+#endif
+
+    RETURN pStubMD;
+}
+
 FCIMPL4(Object*, RuntimeMethodHandle::InvokeMethod,
     Object *target,
     PVOID* args, // An array of byrefs
@@ -506,6 +767,24 @@ FCIMPL4(Object*, RuntimeMethodHandle::InvokeMethod,
 
     BOOL fCtorOfVariableSizedObject = FALSE;
 
+    if (!fConstructor)
+    {
+        MethodDesc *pStubMD = ReflectionInvokeStubs::GetStub(pMeth, &gc.pSig);
+        if (pStubMD != NULL)
+        {
+            MethodDescCallSite invokeStub(pStubMD);
+
+            ARG_SLOT invokeStubArgs[] =
+            {
+                ObjToArgSlot(gc.target),
+                PtrToArgSlot(args)
+            };
+
+            gc.retVal = invokeStub.Call_RetOBJECTREF(invokeStubArgs);
+            goto Done;
+        }
+    }
+
     if (fConstructor)
     {
         // If we are invoking a constructor on an array then we must
@@ -64,6 +64,35 @@ public:
     static FCDECL2(Object*, AllocateValueType, ReflectClassBaseObject *targetType, Object *valueUNSAFE);
 };
 
+// ReflectionInvokeStubs creates the IL stubs that RuntimeMethodHandle::InvokeMethod uses instead of its generic path to invoke
+// methods that are invoked often through reflection (see ReflectionInvokeStubThreshold).
+class ReflectionInvokeStubs
+{
+public:
+    static void Init();
+
+    // Returns the stub to invoke the method with, or NULL if the method is invoked through the generic path. Counts the invokes of
+    // the method and creates its stub once the threshold is reached.
+    static MethodDesc *GetStub(MethodDesc *pMD, SIGNATURENATIVEREF *ppSig);
+
+private:
+    static bool CanUseStub(MethodDesc *pMD, SIGNATURENATIVEREF *ppSig);
+    static MethodDesc *CreateStub(MethodDesc *pMD, SIGNATURENATIVEREF *ppSig);
+
+private:
+    struct StubInfo
+    {
+        LONG m_invokeCount;
+        bool m_canUseStub;
+        MethodDesc *m_pStubMD;
+    };
+
+    static CrstStatic s_lock;
+
+    // Maps the invoked MethodDescs to their StubInfo, read without taking the lock
+    static PtrHashMap *s_pStubInfos;
+};
+
 extern "C" void QCALLTYPE ReflectionInvocation_CompileMethod(MethodDesc * pMD);
 
 extern "C" void QCALLTYPE ReflectionInvocation_RunClassConstructor(QCall::TypeHandle pType);
@@ -68,6 +68,25 @@
 // The prestub tells us at JITting time using "RecordJittingInfo" to record the parameters used to JIT
 // originally. We use these parameters to JIT in the background when we decide to JIT the method.
 //
+// Profiling:
+// ==========
+// When StackSamplingProfile is set, the sampler also serves as a continuous CPU profiler (re-JITting hot methods
+// is only done when StackSamplingEnabled is set as well). The top StackSamplingMaxFrames frames of each running
+// thread are recorded into a preallocated buffer while the runtime is suspended, so that the suspension lasts only
+// as long as the stack walks. Once the runtime is restarted, the recorded stacks are merged into a trie of call
+// paths, where each node counts the samples whose innermost frame it is, so repeated stacks cost no memory.
+//
+// Every StackSamplingReportEvery samples, the nodes added since the last report are reported with
+// StackSamplingNodes events (parent node and method of each node) and the counts gained since the last report with
+// StackSamplingCounts events, under the StackSampling keyword, which are also delivered through EventPipe. The
+// trie is reset when it grows too large, and nodes are reported from the first one again in that case.
+//
+// Note:
+// =====
+// o The overhead is proportional to the sampling rate (StackSamplingEvery) and the number of running threads,
+//   since each sample suspends the runtime. Threads blocked in a sleep, wait or join are not walked.
+// o Frames of methods in collectible assemblies are left out of the recorded stacks.
+//
 
 
 #include "common.h"
@@ -85,7 +104,8 @@ void StackSampler::Init()
 {
     STANDARD_VM_CONTRACT;
 
-    bool samplingEnabled = (CLRConfig::GetConfigValue(CLRConfig::UNSUPPORTED_StackSamplingEnabled) != 0);
+    bool samplingEnabled = (CLRConfig::GetConfigValue(CLRConfig::UNSUPPORTED_StackSamplingEnabled) != 0) ||
+                           (CLRConfig::GetConfigValue(CLRConfig::UNSUPPORTED_StackSamplingProfile) != 0);
     if (samplingEnabled)
     {
         g_pStackSampler = new (nothrow) StackSampler();
@@ -109,7 +129,18 @@ StackSampler::StackSampler()
     , m_nSampleEvery(s_knDefaultSamplingIntervalMsec)
     , m_nSampleAfter(0)
     , m_nNumMethods(s_knDefaultNumMethods)
+    , m_fJitHotMethods(false)
+    , m_fProfile(false)
+    , m_nMaxFrames(s_knDefaultMaxFrames)
+    , m_nReportEvery(s_knDefaultReportEvery)
+    , m_uSampledFrameCount(0)
+    , m_uReportedNodeCount(0)
+    , m_nSamplesSinceReport(0)
+    , m_fReporting(false)
 {
+    m_fJitHotMethods = (CLRConfig::GetConfigValue(CLRConfig::UNSUPPORTED_StackSamplingEnabled) != 0);
+    m_fProfile = (CLRConfig::GetConfigValue(CLRConfig::UNSUPPORTED_StackSamplingProfile) != 0);
+
     // When to start sampling after the thread launch.
     int nSampleAfter = CLRConfig::GetConfigValue(CLRConfig::UNSUPPORTED_StackSamplingAfter);
     if (nSampleAfter != INT_MAX && nSampleAfter >= 0)
@@ -131,6 +162,25 @@ StackSampler::StackSampler()
         m_nNumMethods = nNumMethods;
     }
 
+    // Max number of frames to record from the top of each thread's stack.
+    int nMaxFrames = CLRConfig::GetConfigValue(CLRConfig::UNSUPPORTED_StackSamplingMaxFrames);
+    if (nMaxFrames != INT_MAX && nMaxFrames > 0)
+    {
+        m_nMaxFrames = nMaxFrames;
+    }
+
+    // How many samples to take between reports of the stack trie.
+    int nReportEvery = CLRConfig::GetConfigValue(CLRConfig::UNSUPPORTED_StackSamplingReportEvery);
+    if (nReportEvery != INT_MAX && nReportEvery > 0)
+    {
+        m_nReportEvery = nReportEvery;
+    }
+
+    if (m_fProfile)
+    {
+        ResetStackTrie();
+    }
+
     // Launch the thread.
     m_pThread = SetupUnstartedThread();
     m_pThread->SetBackground(TRUE);
@@ -156,7 +206,7 @@ bool IsGoodMethodDesc(MethodDesc* pMD)
 void StackSampler::RecordJittingInfo(MethodDesc* pMD, CORJIT_FLAGS flags)
 {
     WRAPPER_NO_CONTRACT;
-    if (g_pStackSampler == nullptr)
+    if (g_pStackSampler == nullptr || !g_pStackSampler->m_fJitHotMethods)
     {
         return;
     }
@@ -185,23 +235,96 @@ struct WalkInfo
 {
     StackSampler* pThis;
 
-    // The thread in which the walk is happening and the method is executing.
-    // Used to obtain the app domain.
-    Thread* pMdThread;
+    // Number of frames walked on the current thread.
+    unsigned nFrameCount;
 };
 
-// Visitor for stack walk callback.
+// Stack walk callback recording the frames of a thread into the current sample. Nothing is allocated here since the runtime
+// is suspended, the frames are processed after it is restarted.
 StackWalkAction StackSampler::StackWalkCallback(CrawlFrame* pCf, VOID* data)
 {
-    WRAPPER_NO_CONTRACT;
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_ANY;
+    }
+    CONTRACTL_END;
 
     WalkInfo* info = (WalkInfo*) data;
-    return ((StackSampler*) info->pThis)->CrawlFrameVisitor(pCf, info->pMdThread);
+    StackSampler* pThis = info->pThis;
+
+    MethodDesc* pMD = pCf->GetFunction();
+
+    // Methods of collectible types are left out, as they may be unloaded before the sample is processed.
+    if (pMD != nullptr && !pMD->GetMethodTable()->Collectible())
+    {
+        // Leave room for the null entry that ends the frames of the thread.
+        if (pThis->m_uSampledFrameCount + 1 >= s_kuMaxFramesPerSample)
+        {
+            return SWA_ABORT;
+        }
+        pThis->m_sampledFrames[pThis->m_uSampledFrameCount++] = pMD;
+
+        // Only the top good method is needed to find hot methods.
+        if (!pThis->m_fProfile && IsGoodMethodDesc(pMD))
+        {
+            return SWA_ABORT;
+        }
+    }
+
+    return ++info->nFrameCount < pThis->m_nMaxFrames ? SWA_CONTINUE : SWA_ABORT;
 }
 
-// Stack walk visitor helper to maintain the hash map of method desc, their count
-// and the thread's domain in which the method is executing.
-StackWalkAction StackSampler::CrawlFrameVisitor(CrawlFrame* pCf, Thread* pMdThread)
+// Suspends the runtime and records the top frames of the other threads' stacks into the current sample.
+void StackSampler::TakeSample()
+{
+    CONTRACTL
+    {
+        THROWS;
+        GC_TRIGGERS;
+        MODE_ANY;
+    }
+    CONTRACTL_END;
+
+    m_uSampledFrameCount = 0;
+
+    // Suspend the runtime.
+    ThreadSuspend::SuspendEE(ThreadSuspend::SUSPEND_OTHER);
+
+    // Walk all other threads.
+    Thread* pThread = nullptr;
+    while ((pThread = ThreadStore::GetThreadList(pThread)) != nullptr && m_uSampledFrameCount + 1 < s_kuMaxFramesPerSample)
+    {
+        if (pThread == m_pThread)
+        {
+            continue;
+        }
+
+        // Threads that are not running, or are blocked in a sleep, wait, or join are not spending time in the methods on
+        // their stacks.
+        if ((pThread->GetSnapshotState() & (Thread::TS_Unstarted | Thread::TS_Dead | Thread::TS_Interruptible)) != 0)
+        {
+            continue;
+        }
+
+        // Walk the frames.
+        WalkInfo info = { this, 0 };
+        UINT32 uFirstFrameIndex = m_uSampledFrameCount;
+        pThread->StackWalkFrames(StackWalkCallback, &info, FUNCTIONSONLY | ALLOW_ASYNC_STACK_WALK);
+
+        if (m_uSampledFrameCount != uFirstFrameIndex)
+        {
+            m_sampledFrames[m_uSampledFrameCount++] = nullptr;
+        }
+    }
+
+    // Restart the runtime.
+    ThreadSuspend::RestartEE(FALSE, TRUE);
+}
+
+// Counts the top good method of each thread in the current sample.
+void StackSampler::CountTopMethodsInSample()
 {
     CONTRACTL
     {
@@ -211,32 +334,192 @@ StackWalkAction StackSampler::CrawlFrameVisitor(CrawlFrame* pCf, Thread* pMdThre
     }
     CONTRACTL_END;
 
-    MethodDesc* pMD = pCf->GetFunction();
+    bool fCounted = false;
+    for (UINT32 i = 0; i < m_uSampledFrameCount; ++i)
+    {
+        MethodDesc* pMD = m_sampledFrames[i];
+        if (pMD == nullptr)
+        {
+            // Next thread.
+            fCounted = false;
+            continue;
+        }
 
-    // Filter out methods we don't care about
-    if (!IsGoodMethodDesc(pMD))
+        if (fCounted || !IsGoodMethodDesc(pMD))
+        {
+            continue;
+        }
+
+        // Lookup the method desc and obtain info.
+        CountInfo info;
+        m_countInfo.Lookup(pMD, &info);
+
+        info.uCount++;
+
+        // Put the info back.
+        m_countInfo.AddOrReplace(CountInfoHashEntry(pMD, info));
+
+        // We got the top good one, skip the rest of the thread's frames.
+        fCounted = true;
+    }
+}
+
+// Adds the stacks of the current sample to the stack trie.
+void StackSampler::AddSampleToStackTrie()
+{
+    CONTRACTL
     {
-        return SWA_CONTINUE;
+        THROWS;
+        GC_NOTRIGGER;
+        MODE_ANY;
+    }
+    CONTRACTL_END;
+
+    UINT32 uFirstFrameIndex = 0;
+    for (UINT32 i = 0; i < m_uSampledFrameCount; ++i)
+    {
+        if (m_sampledFrames[i] != nullptr)
+        {
+            continue;
+        }
+
+        // Frames are recorded innermost first, add them from the outermost one so that stacks with common callers share
+        // nodes.
+        if (m_stackTrieNodes.GetCount() + (i - uFirstFrameIndex) > s_kuMaxStackTrieNodes)
+        {
+            ResetStackTrie();
+        }
+
+        UINT32 uNodeIndex = 0;
+        for (UINT32 j = i; j > uFirstFrameIndex; --j)
+        {
+            uNodeIndex = GetOrAddStackTrieNode(uNodeIndex, m_sampledFrames[j - 1]);
+        }
+        m_stackTrieNodes[uNodeIndex].uSampleCount++;
+
+        uFirstFrameIndex = i + 1;
+    }
+}
+
+UINT32 StackSampler::GetOrAddStackTrieNode(UINT32 parentIndex, MethodDesc* pMD)
+{
+    CONTRACTL
+    {
+        THROWS;
+        GC_NOTRIGGER;
+        MODE_ANY;
+    }
+    CONTRACTL_END;
+
+    StackTrieChild key = { parentIndex, pMD, 0 };
+    const StackTrieChild* pChild = m_stackTrieChildren.LookupPtr(key);
+    if (pChild != nullptr)
+    {
+        return pChild->uNodeIndex;
+    }
+
+    StackTrieNode node = { pMD, parentIndex, 0, 0 };
+    key.uNodeIndex = m_stackTrieNodes.GetCount();
+    m_stackTrieNodes.Append(node);
+    m_stackTrieChildren.Add(key);
+    return key.uNodeIndex;
+}
+
+// Drops all nodes and counts of the stack trie. Node IDs are reused afterwards, listeners see the reset as nodes being reported
+// again starting from the first node ID.
+void StackSampler::ResetStackTrie()
+{
+    CONTRACTL
+    {
+        THROWS;
+        GC_NOTRIGGER;
+        MODE_ANY;
+    }
+    CONTRACTL_END;
+
+    m_stackTrieChildren.RemoveAll();
+    m_stackTrieNodes.Clear();
+
+    StackTrieNode root = { nullptr, 0, 0, 0 };
+    m_stackTrieNodes.Append(root);
+    m_uReportedNodeCount = 1;
+}
+
+// Reports the nodes of the stack trie that were added since the last report, and the samples that were counted for each node
+// since the last report, with StackSamplingNodes and StackSamplingCounts events. Nodes are only reported once, so all of them are
+// reported again when the events are enabled again after being disabled, for the benefit of new listeners.
+void StackSampler::ReportStackTrie()
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_ANY;
     }
+    CONTRACTL_END;
 
-    // Lookup the method desc and obtain info.
-    CountInfo info;
-    m_countInfo.Lookup(pMD, &info);
+    if (!ETW_EVENT_ENABLED(MICROSOFT_WINDOWS_DOTNETRUNTIME_PROVIDER_DOTNET_Context, StackSamplingNodes))
+    {
+        m_fReporting = false;
+        return;
+    }
 
-    // Record the current domain ID of the method's thread, i.e.,
-    // the method is last known to be executing.
-    info.uCount++;
+    if (!m_fReporting)
+    {
+        m_uReportedNodeCount = 1;
+        m_fReporting = true;
+    }
 
-    // Put the info back.
-    m_countInfo.AddOrReplace(CountInfoHashEntry(pMD, info));
+    UINT32 parentNodeIds[s_kuMaxNodesPerEvent];
+    UINT64 methodIds[s_kuMaxNodesPerEvent];
+    UINT32 uNodeCount = m_stackTrieNodes.GetCount();
+    while (m_uReportedNodeCount < uNodeCount)
+    {
+        UINT32 uFirstNodeId = m_uReportedNodeCount;
+        UINT32 uCount = min(uNodeCount - uFirstNodeId, s_kuMaxNodesPerEvent);
+        for (UINT32 i = 0; i < uCount; ++i)
+        {
+            const StackTrieNode& node = m_stackTrieNodes[uFirstNodeId + i];
+            parentNodeIds[i] = node.uParentIndex;
+            methodIds[i] = (UINT64)node.pMD;
+        }
 
-    // We got the top good one, skip.
-    return SWA_ABORT;
+        FireEtwStackSamplingNodes(GetClrInstanceId(), uFirstNodeId, (UINT16)uCount, parentNodeIds, methodIds);
+        m_uReportedNodeCount += uCount;
+    }
+
+    UINT32 nodeIds[s_kuMaxNodesPerEvent];
+    UINT32 sampleCounts[s_kuMaxNodesPerEvent];
+    UINT32 uCount = 0;
+    for (UINT32 i = 1; i < uNodeCount; ++i)
+    {
+        StackTrieNode& node = m_stackTrieNodes[i];
+        if (node.uSampleCount == node.uReportedSampleCount)
+        {
+            continue;
+        }
+
+        nodeIds[uCount] = i;
+        sampleCounts[uCount] = node.uSampleCount - node.uReportedSampleCount;
+        node.uReportedSampleCount = node.uSampleCount;
+
+        if (++uCount == s_kuMaxNodesPerEvent)
+        {
+            FireEtwStackSamplingCounts(GetClrInstanceId(), (UINT16)uCount, nodeIds, sampleCounts);
+            uCount = 0;
+        }
+    }
+
+    if (uCount != 0)
+    {
+        FireEtwStackSamplingCounts(GetClrInstanceId(), (UINT16)uCount, nodeIds, sampleCounts);
+    }
 }
 
-// Thread routine that suspends the runtime, walks the other threads' stacks to get the
-// top managed method. Restarts the runtime after samples are collected. Identifies top
-// methods from the samples and re-JITs them in the background.
+// Thread routine that suspends the runtime, walks the other threads' stacks to get their
+// top managed methods. Restarts the runtime after samples are collected. Identifies top
+// methods from the samples and re-JITs them in the background, and/or adds the sampled
+// stacks to the stack trie and reports it periodically.
 void StackSampler::ThreadProc()
 {
     CONTRACTL
@@ -256,36 +539,30 @@ void StackSampler::ThreadProc()
     // User asked us to sample after certain time.
     m_pThread->UserSleep(m_nSampleAfter);
 
-    WalkInfo info = { this, nullptr };
-
     while (true)
     {
         EX_TRY
         {
-            // Suspend the runtime.
-            ThreadSuspend::SuspendEE(ThreadSuspend::SUSPEND_OTHER);
+            TakeSample();
 
-            // Walk all other threads.
-            Thread* pThread = nullptr;
-            while ((pThread = ThreadStore::GetThreadList(pThread)) != nullptr)
+            if (m_fProfile)
             {
-                if (pThread == m_pThread)
+                AddSampleToStackTrie();
+
+                if (++m_nSamplesSinceReport >= m_nReportEvery)
                 {
-                    continue;
+                    ReportStackTrie();
+                    m_nSamplesSinceReport = 0;
                 }
-                // TODO: Detect if thread is suspended by user before we suspended and skip.
-
-                info.pMdThread = pThread;
-
-                // Walk the frames.
-                pThread->StackWalkFrames(StackWalkCallback, &info, FUNCTIONSONLY | ALLOW_ASYNC_STACK_WALK);
             }
 
-            // Restart the runtime.
-            ThreadSuspend::RestartEE(FALSE, TRUE);
+            if (m_fJitHotMethods)
+            {
+                CountTopMethodsInSample();
 
-            // JIT the methods that frequently occur in samples.
-            JitFrequentMethodsInSamples();
+                // JIT the methods that frequently occur in samples.
+                JitFrequentMethodsInSamples();
+            }
         }
         EX_CATCH
         {
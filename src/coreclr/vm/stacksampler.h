@@ -32,10 +32,20 @@ private:
 
     static StackWalkAction StackWalkCallback(CrawlFrame* pCf, VOID* data);
 
-    StackWalkAction CrawlFrameVisitor(CrawlFrame* pCf, Thread* pMdThread);
-
     void ThreadProc();
 
+    void TakeSample();
+
+    void CountTopMethodsInSample();
+
+    void AddSampleToStackTrie();
+
+    UINT32 GetOrAddStackTrieNode(UINT32 parentIndex, MethodDesc* pMD);
+
+    void ResetStackTrie();
+
+    void ReportStackTrie();
+
     void JitFrequentMethodsInSamples();
 
     void JitAndCollectTrace(MethodDesc* pMD);
@@ -47,6 +57,17 @@ private:
     static const int s_knDefaultSamplingIntervalMsec = 100;
     static const int s_knDefaultNumMethods = 32;
     static const int s_knDefaultCountForImportance = 0;    // TODO: Set to some reasonable value.
+    static const int s_knDefaultMaxFrames = 64;
+    static const int s_knDefaultReportEvery = 10;
+
+    // Number of frames that may be recorded per sample, bounds the work done while the runtime is suspended.
+    static const UINT32 s_kuMaxFramesPerSample = 4096;
+
+    // Number of nodes after which the stack trie is reset, bounds the memory used by the trie.
+    static const UINT32 s_kuMaxStackTrieNodes = 64 * 1024;
+
+    // Number of nodes or counts reported in a single event, keeps the events well under the maximum event size.
+    static const UINT32 s_kuMaxNodesPerEvent = 1024;
 
     // Typedefs
     struct CountInfo;
@@ -64,6 +85,45 @@ private:
         CountInfo() : uCount(0), fJitted(false) {}
     };
 
+    // A node of the stack trie stands for the stacks that start with the methods on the path from the root to the node.
+    // Stacks are added from the outermost frame, so children of a node are its callees. The root (index 0) has no method.
+    struct StackTrieNode
+    {
+        MethodDesc* pMD;
+        UINT32 uParentIndex;
+        UINT32 uSampleCount;            // Samples whose innermost recorded frame is this node
+        UINT32 uReportedSampleCount;    // Value of uSampleCount when counts were last reported
+    };
+
+    struct StackTrieChild
+    {
+        UINT32 uParentIndex;
+        MethodDesc* pMD;
+        UINT32 uNodeIndex;
+    };
+
+    class StackTrieChildTraits : public NoRemoveSHashTraits< DefaultSHashTraits<StackTrieChild> >
+    {
+    public:
+        typedef StackTrieChild key_t;
+
+        static key_t GetKey(const element_t& e) { LIMITED_METHOD_CONTRACT; return e; }
+        static BOOL Equals(const key_t& k1, const key_t& k2)
+        {
+            LIMITED_METHOD_CONTRACT;
+            return k1.uParentIndex == k2.uParentIndex && k1.pMD == k2.pMD;
+        }
+        static count_t Hash(const key_t& k)
+        {
+            LIMITED_METHOD_CONTRACT;
+            return (count_t)(size_t)k.pMD ^ (k.uParentIndex * 0x9E3779B9);
+        }
+
+        // The root is never a child, so a node index of 0 identifies an empty entry
+        static element_t Null() { LIMITED_METHOD_CONTRACT; StackTrieChild e = { 0, nullptr, 0 }; return e; }
+        static bool IsNull(const element_t& e) { LIMITED_METHOD_CONTRACT; return e.uNodeIndex == 0; }
+    };
+
     // Fields
     Crst m_crstJitInfo;
     CountInfoHash m_countInfo;
@@ -72,6 +132,23 @@ private:
     unsigned m_nSampleEvery;
     unsigned m_nSampleAfter;
     unsigned m_nNumMethods;
+
+    // Whether hot methods are re-JITted in the background (StackSamplingEnabled) and whether sampled stacks are recorded in
+    // the stack trie and reported (StackSamplingProfile)
+    bool m_fJitHotMethods;
+    bool m_fProfile;
+    unsigned m_nMaxFrames;
+    unsigned m_nReportEvery;
+
+    // Frames of the current sample, innermost first, with a null entry after the frames of each thread
+    MethodDesc* m_sampledFrames[s_kuMaxFramesPerSample];
+    UINT32 m_uSampledFrameCount;
+
+    SArray<StackTrieNode> m_stackTrieNodes;
+    SHash<StackTrieChildTraits> m_stackTrieChildren;
+    UINT32 m_uReportedNodeCount;
+    unsigned m_nSamplesSinceReport;
+    bool m_fReporting;
 };
 #endif // FEATURE_STACK_SAMPLING
 
@@ -2738,7 +2738,11 @@ void StackFrameIterator::ProcessIp(PCODE Ip)
     } CONTRACTL_END;
 
     // Re-initialize codeInfo with new IP
+#ifndef DACCESS_COMPILE
+    CodeInfoCache::InitCodeInfo(&m_crawl.codeInfo, Ip, m_scanFlag);
+#else
     m_crawl.codeInfo.Init(Ip, m_scanFlag);
+#endif // !DACCESS_COMPILE
 
     m_crawl.isFrameless = !!m_crawl.codeInfo.IsValid();
 } // StackFrameIterator::ProcessIp()
@@ -3407,6 +3411,154 @@ void StackwalkCache::Invalidate(LoaderAllocator * pLoaderAllocator)
     ZeroMemory(PVOID(&g_StackwalkCache), sizeof(g_StackwalkCache));
 }
 
+#ifndef DACCESS_COMPILE
+
+/*
+============================================================
+CodeInfoCache caches the EECodeInfo of an IP in g_CodeInfoCache[], a direct
+mapped table indexed like g_StackwalkCache[]. EECodeInfo does not fit in a
+word, so each entry is guarded by a version that is odd while the entry is
+written: a writer takes the entry with InterlockedCompareExchange (and gives
+up if another writer holds it), and a reader copies the entry and only uses
+the copy if the version is even and unchanged afterwards.
+
+Entries also record the epoch at which the lookup that produced them started.
+Invalidate() bumps the epoch rather than clearing the table, so that a lookup
+racing with the release of the code it found cannot publish a stale entry.
+Rejitted code lives at a new address and the old code is not freed until its
+loader allocator is unloaded, so nothing else needs to be invalidated.
+============================================================
+*/
+
+#define LOG_NUM_OF_CODE_INFO_CACHE_ENTRIES 10
+#define NUM_OF_CODE_INFO_CACHE_ENTRIES (1 << LOG_NUM_OF_CODE_INFO_CACHE_ENTRIES)
+
+struct CodeInfoCacheEntry
+{
+    LONG        m_version;
+    LONG        m_epoch;
+    PCODE       m_ip;
+    EECodeInfo  m_codeInfo;
+};
+
+static CodeInfoCacheEntry g_CodeInfoCache[NUM_OF_CODE_INFO_CACHE_ENTRIES];
+
+BOOL CodeInfoCache::s_Enabled = FALSE;
+LONG CodeInfoCache::s_Epoch = 0;
+
+// static
+void CodeInfoCache::Init()
+{
+    LIMITED_METHOD_CONTRACT;
+
+    s_Enabled = (g_pConfig->DisableStackwalkCache() == 0);
+}
+
+inline unsigned CodeInfoCache::GetKey(PCODE ip)
+{
+    LIMITED_METHOD_CONTRACT;
+    return (unsigned)(((ip >> LOG_NUM_OF_CODE_INFO_CACHE_ENTRIES) ^ ip) & (NUM_OF_CODE_INFO_CACHE_ENTRIES-1));
+}
+
+// static
+void CodeInfoCache::InitCodeInfo(EECodeInfo *pCodeInfo, PCODE ip, ExecutionManager::ScanFlag scanFlag)
+{
+    CONTRACTL {
+       NOTHROW;
+       GC_NOTRIGGER;
+    } CONTRACTL_END;
+
+    if (!s_Enabled)
+    {
+        pCodeInfo->Init(ip, scanFlag);
+        return;
+    }
+
+    if (Lookup(pCodeInfo, ip))
+    {
+        return;
+    }
+
+    LONG epoch = VolatileLoad(&s_Epoch);
+    pCodeInfo->Init(ip, scanFlag);
+
+    // Only managed code is cached, the IPs of stubs and native code are rarely walked twice in a row
+    if (pCodeInfo->IsValid())
+    {
+        Insert(pCodeInfo, ip, epoch);
+    }
+}
+
+// static
+BOOL CodeInfoCache::Lookup(EECodeInfo *pCodeInfo, PCODE ip)
+{
+    CONTRACTL {
+       NOTHROW;
+       GC_NOTRIGGER;
+    } CONTRACTL_END;
+
+    CodeInfoCacheEntry *pEntry = &g_CodeInfoCache[GetKey(ip)];
+
+    LONG version = VolatileLoad(&pEntry->m_version);
+    if ((version & 1) != 0)
+    {
+        return FALSE;
+    }
+
+    if (pEntry->m_ip != ip || pEntry->m_epoch != VolatileLoad(&s_Epoch))
+    {
+        return FALSE;
+    }
+
+    EECodeInfo codeInfo = pEntry->m_codeInfo;
+
+    // The copy is torn if a writer took the entry in the meantime
+    VolatileLoadBarrier();
+    if (VolatileLoadWithoutBarrier(&pEntry->m_version) != version)
+    {
+        return FALSE;
+    }
+
+    *pCodeInfo = codeInfo;
+    return TRUE;
+}
+
+// static
+void CodeInfoCache::Insert(EECodeInfo *pCodeInfo, PCODE ip, LONG epoch)
+{
+    CONTRACTL {
+       NOTHROW;
+       GC_NOTRIGGER;
+    } CONTRACTL_END;
+
+    CodeInfoCacheEntry *pEntry = &g_CodeInfoCache[GetKey(ip)];
+
+    LONG version = VolatileLoad(&pEntry->m_version);
+    if ((version & 1) != 0 || InterlockedCompareExchange(&pEntry->m_version, version + 1, version) != version)
+    {
+        return;
+    }
+
+    pEntry->m_ip = ip;
+    pEntry->m_epoch = epoch;
+    pEntry->m_codeInfo = *pCodeInfo;
+
+    VolatileStore(&pEntry->m_version, version + 2);
+}
+
+// static
+void CodeInfoCache::Invalidate()
+{
+    CONTRACTL {
+       NOTHROW;
+       GC_NOTRIGGER;
+    } CONTRACTL_END;
+
+    InterlockedIncrement(&s_Epoch);
+}
+
+#endif // !DACCESS_COMPILE
+
 //----------------------------------------------------------------------------
 //
 // SetUpRegdisplayForStackWalk - set up Regdisplay for a stack walk
@@ -503,6 +503,38 @@ private:
 void GcEnumObject(LPVOID pData, OBJECTREF *pObj);
 StackWalkAction GcStackCrawlCallBack(CrawlFrame* pCF, VOID* pData);
 
+#ifndef DACCESS_COMPILE
+//******************************************************************************
+// CodeInfoCache remembers the EECodeInfo of recently walked IPs, so that walking
+// the same call sites again (GC root scanning of deep stacks, exception stack
+// traces, sampling) does not repeat the range section and nibble map lookups
+// done by EECodeInfo::Init. It is a fixed-size table shared by all threads that
+// is read without locks, and everything in it is dropped when code is freed.
+//******************************************************************************
+class CodeInfoCache
+{
+public:
+    static void Init();
+
+    // Same as pCodeInfo->Init(ip, scanFlag), going through the cache
+    static void InitCodeInfo(EECodeInfo *pCodeInfo, PCODE ip, ExecutionManager::ScanFlag scanFlag);
+
+    // Drops all the entries, called when code is freed so that another method
+    // allocated at the same address is not mistaken for the freed one
+    static void Invalidate();
+
+private:
+    static BOOL Lookup(EECodeInfo *pCodeInfo, PCODE ip);
+    static void Insert(EECodeInfo *pCodeInfo, PCODE ip, LONG epoch);
+    static unsigned GetKey(PCODE ip);
+
+    static BOOL s_Enabled;
+
+    // Entries inserted at an older epoch than the current one are ignored
+    static LONG s_Epoch;
+};
+#endif // !DACCESS_COMPILE
+
 #if defined(ELIMINATE_FEF)
 //******************************************************************************
 // This class is used to help use exception context records to resync a
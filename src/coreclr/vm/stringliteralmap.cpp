@@ -39,6 +39,12 @@
     will all come before destruction of the map, the hash table is safe for multiple readers,
     and we know the StringLiteralEntry so found 1) can't be destroyed because that table keeps
     an AddRef on it and 2) isn't internally modified once created.
+
+    The same holds for the immortal hash table of the GlobalStringLiteralMap. Entries that are
+    referenced by a loader allocator that is never unloaded are marked immortal instead of being
+    AddRef'd, are never released, and are published to that table, which is never deleted from.
+    Loading string literals and interning strings on behalf of such loader allocators, which is
+    by far the most common case, only takes the lock the first time a given string is seen.
 */
 
 #define GLOBAL_STRING_TABLE_BUCKET_SIZE 128
@@ -158,6 +164,25 @@ STRINGREF *StringLiteralMap::GetStringLiteral(EEStringData *pStringData, BOOL bA
     HashDatum Data;
 
     DWORD dwHash = m_StringToEntryHashTable->GetHash(pStringData);
+
+    // Don't use FOH for collectible modules to avoid potential memory leaks
+    const bool preferFrozenObjectHeap = !bIsCollectible;
+
+    if (!bIsCollectible)
+    {
+        // Look for a string literal that is already referenced by a loader allocator that is never unloaded, without taking the lock
+        StringLiteralEntry *pImmortalEntry = SystemDomain::GetGlobalStringLiteralMap()->GetImmortalStringLiteral(pStringData, dwHash);
+        if (pImmortalEntry != NULL)
+        {
+            STRINGREF *pStrObj = pImmortalEntry->GetStringObject();
+            if (ppPinnedString != nullptr && pImmortalEntry->IsStringFrozen())
+            {
+                *ppPinnedString = *reinterpret_cast<void**>(pStrObj);
+            }
+            return pStrObj;
+        }
+    }
+
     // Retrieve the string literal from the global string literal map.
     CrstHolder gch(&(SystemDomain::GetGlobalStringLiteralMap()->m_HashTableCrstGlobal));
 
@@ -165,9 +190,7 @@ STRINGREF *StringLiteralMap::GetStringLiteral(EEStringData *pStringData, BOOL bA
     // someone beat us to inserting it. (m_StringToEntryHashTable->GetValue(pStringData, &Data))
     // (Rather than waiting until after we look the string up in the global map)
 
-    // Don't use FOH for collectible modules to avoid potential memory leaks
-    const bool preferFrozenObjectHeap = !bIsCollectible;
-    StringLiteralEntryHolder pEntry(SystemDomain::GetGlobalStringLiteralMap()->GetStringLiteral(pStringData, dwHash, bAddIfNotFound, preferFrozenObjectHeap));
+    StringLiteralEntryHolder pEntry(SystemDomain::GetGlobalStringLiteralMap()->GetStringLiteral(pStringData, dwHash, bAddIfNotFound, bIsCollectible));
 
     _ASSERTE(pEntry || !bAddIfNotFound);
 
@@ -175,9 +198,7 @@ STRINGREF *StringLiteralMap::GetStringLiteral(EEStringData *pStringData, BOOL bA
     if (pEntry)
     {
         // If the entry exists in the Global map and the appdomain wont ever unload then we really don't need to add a
-        // hashentry in the appdomain specific map.
-        // TODO: except that by not inserting into our local table we always take the global map lock
-        // and come into this path, when we could succeed at a lock free lookup above.
+        // hashentry in the appdomain specific map, the entry is immortal and found by the lock free lookup above.
 
         if (bIsCollectible)
         {
@@ -233,6 +254,7 @@ STRINGREF *StringLiteralMap::GetInternedString(STRINGREF *pString, BOOL bAddIfNo
     EEStringData StringData = EEStringData((*pString)->GetStringLength(), (*pString)->GetBuffer());
 
     DWORD dwHash = m_StringToEntryHashTable->GetHash(&StringData);
+    StringLiteralEntry *pImmortalEntry = NULL;
     if (m_StringToEntryHashTable->GetValue(&StringData, &Data, dwHash))
     {
         STRINGREF *pStrObj = NULL;
@@ -241,6 +263,11 @@ STRINGREF *StringLiteralMap::GetInternedString(STRINGREF *pString, BOOL bAddIfNo
         return pStrObj;
 
     }
+    else if (!bIsCollectible &&
+        (pImmortalEntry = SystemDomain::GetGlobalStringLiteralMap()->GetImmortalStringLiteral(&StringData, dwHash)) != NULL)
+    {
+        return pImmortalEntry->GetStringObject();
+    }
     else
     {
         CrstHolder gch(&(SystemDomain::GetGlobalStringLiteralMap()->m_HashTableCrstGlobal));
@@ -251,7 +278,7 @@ STRINGREF *StringLiteralMap::GetInternedString(STRINGREF *pString, BOOL bAddIfNo
 
         // Retrieve the string literal from the global string literal map.
 
-        StringLiteralEntryHolder pEntry(SystemDomain::GetGlobalStringLiteralMap()->GetInternedString(pString, dwHash, bAddIfNotFound));
+        StringLiteralEntryHolder pEntry(SystemDomain::GetGlobalStringLiteralMap()->GetInternedString(pString, dwHash, bAddIfNotFound, bIsCollectible));
 
         _ASSERTE(pEntry || !bAddIfNotFound);
 
@@ -259,9 +286,7 @@ STRINGREF *StringLiteralMap::GetInternedString(STRINGREF *pString, BOOL bAddIfNo
         if (pEntry)
         {
             // If the entry exists in the Global map and the appdomain wont ever unload then we really don't need to add a
-            // hashentry in the appdomain specific map.
-            // TODO: except that by not inserting into our local table we always take the global map lock
-            // and come into this path, when we could succeed at a lock free lookup above.
+            // hashentry in the appdomain specific map, the entry is immortal and found by the lock free lookup above.
 
             if (bIsCollectible)
             {
@@ -296,6 +321,7 @@ STRINGREF *StringLiteralMap::GetInternedString(STRINGREF *pString, BOOL bAddIfNo
 
 GlobalStringLiteralMap::GlobalStringLiteralMap()
 : m_StringToEntryHashTable(NULL)
+, m_ImmortalStringToEntryHashTable(NULL)
 , m_MemoryPool(NULL)
 , m_HashTableCrstGlobal(CrstGlobalStrLiteralMap)
 , m_PinnedHeapHandleTable(SystemDomain::System(), GLOBAL_STRING_TABLE_BUCKET_SIZE)
@@ -331,16 +357,18 @@ GlobalStringLiteralMap::~GlobalStringLiteralMap()
     {
         // if this isn't the real global table then it must be empty
         _ASSERTE(m_StringToEntryHashTable->IsEmpty());
+        _ASSERTE(m_ImmortalStringToEntryHashTable->IsEmpty());
 
-        // Delete the hash table first. The dtor of the hash table would clean up all the entries.
+        // Delete the hash tables first. The dtor of the hash tables would clean up all the entries.
         delete m_StringToEntryHashTable;
+        delete m_ImmortalStringToEntryHashTable;
         // Delete the pool later, since the dtor above would need it.
         delete m_MemoryPool;
     }
     else
     {
         // We are shutting down, the OS will reclaim the memory from the StringLiteralEntries,
-        // m_MemoryPool and m_StringToEntryHashTable.
+        // m_MemoryPool, m_StringToEntryHashTable and m_ImmortalStringToEntryHashTable.
         _ASSERTE(g_fProcessDetach);
     }
 }
@@ -361,12 +389,16 @@ void GlobalStringLiteralMap::Init()
 
     m_StringToEntryHashTable =  new EEUnicodeStringLiteralHashTable ();
 
+    m_ImmortalStringToEntryHashTable =  new EEUnicodeStringLiteralHashTable ();
+
     LockOwner lock = {&m_HashTableCrstGlobal, IsOwnerOfCrst};
     if (!m_StringToEntryHashTable->Init(INIT_NUM_GLOBAL_STRING_BUCKETS, &lock, m_MemoryPool))
         ThrowOutOfMemory();
+    if (!m_ImmortalStringToEntryHashTable->Init(INIT_NUM_GLOBAL_STRING_BUCKETS, &lock, m_MemoryPool))
+        ThrowOutOfMemory();
 }
 
-StringLiteralEntry *GlobalStringLiteralMap::GetStringLiteral(EEStringData *pStringData, DWORD dwHash, BOOL bAddIfNotFound, BOOL bPreferFrozenObjectHeap)
+StringLiteralEntry *GlobalStringLiteralMap::GetStringLiteral(EEStringData *pStringData, DWORD dwHash, BOOL bAddIfNotFound, BOOL bIsCollectible)
 {
     CONTRACTL
     {
@@ -387,20 +419,30 @@ StringLiteralEntry *GlobalStringLiteralMap::GetStringLiteral(EEStringData *pStri
         pEntry = (StringLiteralEntry*)Data;
         // If the entry is already in the table then addref it before we return it.
         if (pEntry)
-            pEntry->AddRef();
+        {
+            if (bIsCollectible)
+                pEntry->AddRef();
+            else
+                MakeEntryImmortal(pEntry, pStringData);
+        }
     }
     else
     {
         if (bAddIfNotFound)
         {
-            pEntry = AddStringLiteral(pStringData, bPreferFrozenObjectHeap);
+            // Don't use FOH for collectible modules to avoid potential memory leaks
+            StringLiteralEntryHolder pNewEntry(AddStringLiteral(pStringData, !bIsCollectible));
+            if (!bIsCollectible)
+                MakeEntryImmortal(pNewEntry, pStringData);
+            pNewEntry.SuppressRelease();
+            pEntry = pNewEntry;
         }
     }
 
     return pEntry;
 }
 
-StringLiteralEntry *GlobalStringLiteralMap::GetInternedString(STRINGREF *pString, DWORD dwHash, BOOL bAddIfNotFound)
+StringLiteralEntry *GlobalStringLiteralMap::GetInternedString(STRINGREF *pString, DWORD dwHash, BOOL bAddIfNotFound, BOOL bIsCollectible)
 {
     CONTRACTL
     {
@@ -423,17 +465,76 @@ StringLiteralEntry *GlobalStringLiteralMap::GetInternedString(STRINGREF *pString
         pEntry = (StringLiteralEntry*)Data;
         // If the entry is already in the table then addref it before we return it.
         if (pEntry)
-            pEntry->AddRef();
+        {
+            if (bIsCollectible)
+                pEntry->AddRef();
+            else
+                MakeEntryImmortal(pEntry, &StringData);
+        }
     }
     else
     {
         if (bAddIfNotFound)
-            pEntry = AddInternedString(pString);
+        {
+            StringLiteralEntryHolder pNewEntry(AddInternedString(pString));
+            if (!bIsCollectible)
+            {
+                // Since AddInternedString() could have caused a GC, we need to recreate the string data.
+                StringData = EEStringData((*pString)->GetStringLength(), (*pString)->GetBuffer());
+                MakeEntryImmortal(pNewEntry, &StringData);
+            }
+            pNewEntry.SuppressRelease();
+            pEntry = pNewEntry;
+        }
     }
 
     return pEntry;
 }
 
+StringLiteralEntry *GlobalStringLiteralMap::GetImmortalStringLiteral(EEStringData *pStringData, DWORD dwHash)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_COOPERATIVE;
+        PRECONDITION(CheckPointer(this));
+        PRECONDITION(CheckPointer(pStringData));
+    }
+    CONTRACTL_END;
+
+    // Entries are never removed from the immortal hash table, and the table is safe for readers racing with the writer
+    HashDatum Data;
+    if (m_ImmortalStringToEntryHashTable->GetValue(pStringData, &Data, dwHash))
+    {
+        return (StringLiteralEntry*)Data;
+    }
+
+    return NULL;
+}
+
+void GlobalStringLiteralMap::MakeEntryImmortal(StringLiteralEntry *pEntry, EEStringData *pStringData)
+{
+    CONTRACTL
+    {
+        THROWS;
+        GC_NOTRIGGER;
+        MODE_COOPERATIVE;
+        PRECONDITION(CheckPointer(this));
+        PRECONDITION(CheckPointer(pEntry));
+        PRECONDITION(m_HashTableCrstGlobal.OwnedByCurrentThread());
+    }
+    CONTRACTL_END;
+
+    if (pEntry->IsImmortal())
+        return;
+
+    // Loader allocators that are never unloaded never release their references, so the entry is marked
+    // immortal rather than AddRef'd, and it is published only once so that it is never removed from the map.
+    m_ImmortalStringToEntryHashTable->InsertValue(pStringData, pEntry, FALSE);
+    pEntry->SetImmortal();
+}
+
 #ifdef LOGGING
 static void LogStringLiteral(_In_z_ const char* action, EEStringData *pStringData)
 {
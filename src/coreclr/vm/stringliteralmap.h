@@ -71,10 +71,14 @@ public:
     void Init();
 
     // Method to retrieve a string from the map. Takes a precomputed hash (for perf).
-    StringLiteralEntry *GetStringLiteral(EEStringData *pStringData, DWORD dwHash, BOOL bAddIfNotFound, BOOL bPreferFrozenObjectHeap);
+    StringLiteralEntry *GetStringLiteral(EEStringData *pStringData, DWORD dwHash, BOOL bAddIfNotFound, BOOL bIsCollectible);
 
     // Method to explicitly intern a string object. Takes a precomputed hash (for perf).
-    StringLiteralEntry *GetInternedString(STRINGREF *pString, DWORD dwHash, BOOL bAddIfNotFound);
+    StringLiteralEntry *GetInternedString(STRINGREF *pString, DWORD dwHash, BOOL bAddIfNotFound, BOOL bIsCollectible);
+
+    // Method to retrieve a string from the map without taking the lock. Only finds the entries that are referenced by loader
+    // allocators that are never unloaded, which are never removed from the map.
+    StringLiteralEntry *GetImmortalStringLiteral(EEStringData *pStringData, DWORD dwHash);
 
     // Method to calculate the hash
     DWORD GetHash(EEStringData* pData)
@@ -100,9 +104,17 @@ private:
     // Called by StringLiteralEntry when its RefCount falls to 0.
     void RemoveStringLiteralEntry(StringLiteralEntry *pEntry);
 
+    // Called when a loader allocator that is never unloaded takes a reference on an entry, publishes the entry to
+    // m_ImmortalStringToEntryHashTable.
+    void MakeEntryImmortal(StringLiteralEntry *pEntry, EEStringData *pStringData);
+
     // Hash tables that maps a Unicode string to a LiteralStringEntry.
     EEUnicodeStringLiteralHashTable    *m_StringToEntryHashTable;
 
+    // Hash table of the entries that are never removed, so that it can be read without taking the lock. It is only
+    // written to under the lock, like m_StringToEntryHashTable.
+    EEUnicodeStringLiteralHashTable    *m_ImmortalStringToEntryHashTable;
+
     // The memorypool for hash entries for this hash table.
     MemoryPool                  *m_MemoryPool;
 
@@ -125,7 +137,8 @@ class StringLiteralEntry
 {
     #define SLE_IS_FROZEN      (1u << 31)
     #define SLE_IS_OVERFLOWED  (1u << 30)
-    #define SLE_REFCOUNT_MASK  (SLE_IS_FROZEN | SLE_IS_OVERFLOWED)
+    #define SLE_IS_IMMORTAL    (1u << 29)
+    #define SLE_REFCOUNT_MASK  (SLE_IS_FROZEN | SLE_IS_OVERFLOWED | SLE_IS_IMMORTAL)
 
 private:
     StringLiteralEntry(EEStringData *pStringData, STRINGREF *pStringObj)
@@ -176,7 +189,7 @@ public:
         if (IsAlwaysAlive())
             return;
 
-        if ((GetRefCount() + 1) & SLE_IS_OVERFLOWED)
+        if ((GetRefCount() + 1) & SLE_REFCOUNT_MASK)
         {
             VolatileStore(&m_dwRefCount, VolatileLoad(&m_dwRefCount) | SLE_IS_OVERFLOWED);
         }
@@ -291,11 +304,29 @@ public:
         return VolatileLoad(&m_dwRefCount) & SLE_IS_FROZEN;
     }
 
+    bool IsImmortal()
+    {
+        return VolatileLoad(&m_dwRefCount) & SLE_IS_IMMORTAL;
+    }
+
+    void SetImmortal()
+    {
+        CONTRACTL
+        {
+            NOTHROW;
+            GC_NOTRIGGER;
+            PRECONDITION(SystemDomain::GetGlobalStringLiteralMapNoCreate()->m_HashTableCrstGlobal.OwnedByCurrentThread());
+        }
+        CONTRACTL_END;
+
+        VolatileStore(&m_dwRefCount, VolatileLoad(&m_dwRefCount) | SLE_IS_IMMORTAL);
+    }
+
     bool IsAlwaysAlive()
     {
-        // If string literal is either frozen or its counter overflowed
-        // we'll keep it always alive
-        return VolatileLoad(&m_dwRefCount) & (SLE_IS_OVERFLOWED | SLE_IS_FROZEN);
+        // If string literal is either frozen, referenced by a loader allocator that is
+        // never unloaded or its counter overflowed we'll keep it always alive
+        return VolatileLoad(&m_dwRefCount) & SLE_REFCOUNT_MASK;
     }
 
 private:
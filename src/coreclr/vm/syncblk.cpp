@@ -1602,21 +1602,32 @@ AwareLock::EnterHelperResult ObjHeader::EnterObjMonitorHelperSpin(Thread* pCurTh
             _ASSERTE(syncBlock != NULL);
             AwareLock *awareLock = &syncBlock->m_Monitor;
 
+            // Spin only for as long as spinning has recently been able to acquire this lock
+            const DWORD lockSpinCount = min(spinCount, awareLock->GetSpinCount());
+            if (spinIteration >= lockSpinCount)
+            {
+                return AwareLock::EnterHelperResult_Contention;
+            }
+
             AwareLock::EnterHelperResult result = awareLock->TryEnterBeforeSpinLoopHelper(pCurThread);
             if (result != AwareLock::EnterHelperResult_Contention)
             {
+                if (result == AwareLock::EnterHelperResult_Entered)
+                {
+                    awareLock->RecordSpinResult(true /* acquiredLock */);
+                }
                 return result;
             }
 
             ++spinIteration;
-            if (spinIteration < spinCount)
+            if (spinIteration < lockSpinCount)
             {
                 while (true)
                 {
                     AwareLock::SpinWait(normalizationInfo, spinIteration);
 
                     ++spinIteration;
-                    if (spinIteration >= spinCount)
+                    if (spinIteration >= lockSpinCount)
                     {
                         // The last lock attempt for this spin will be done after the loop
                         break;
@@ -1625,6 +1636,7 @@ AwareLock::EnterHelperResult ObjHeader::EnterObjMonitorHelperSpin(Thread* pCurTh
                     result = awareLock->TryEnterInsideSpinLoopHelper(pCurThread);
                     if (result == AwareLock::EnterHelperResult_Entered)
                     {
+                        awareLock->RecordSpinResult(true /* acquiredLock */);
                         return AwareLock::EnterHelperResult_Entered;
                     }
                     if (result == AwareLock::EnterHelperResult_UseSlowPath)
@@ -1634,7 +1646,13 @@ AwareLock::EnterHelperResult ObjHeader::EnterObjMonitorHelperSpin(Thread* pCurTh
                 }
             }
 
-            if (awareLock->TryEnterAfterSpinLoopHelper(pCurThread))
+            bool acquiredLock = awareLock->TryEnterAfterSpinLoopHelper(pCurThread);
+            if (result != AwareLock::EnterHelperResult_UseSlowPath)
+            {
+                // Spinning that was cut short to avoid preempting waiters says nothing about how long the lock is held for
+                awareLock->RecordSpinResult(acquiredLock);
+            }
+            if (acquiredLock)
             {
                 return AwareLock::EnterHelperResult_Entered;
             }
@@ -2533,6 +2551,50 @@ double ComputeElapsedTimeInNanosecond(LARGE_INTEGER startTicks, LARGE_INTEGER en
     return (elapsedTicks * NsPerSecond) / freq.QuadPart;
 }
 
+// Histogram of the durations of contentions on Monitor locks that ended with the lock being acquired, recorded while the
+// contention keyword is enabled and reported with a ContentionDurationHistogram event every ContentionsPerDurationHistogram
+// contentions. Bucket i counts durations of [2^i, 2^(i+1)) microseconds, except that the first bucket also counts shorter
+// durations and the last bucket also counts longer durations. A contending thread waits for roughly as long as the lock is
+// still held for, so this approximates how long contended locks are held without timing uncontended enters.
+static const UINT32 ContentionDurationHistogramBucketCount = 16;
+static const ULONG ContentionsPerDurationHistogram = 1000;
+static LONG s_contentionDurationHistogram[ContentionDurationHistogramBucketCount];
+static LONG s_contentionDurationHistogramCount;
+
+static void RecordContentionDuration(double elapsedTimeInNanosecond)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_ANY;
+    }
+    CONTRACTL_END;
+
+    UINT64 elapsedTimeInMicrosecond = (UINT64)(elapsedTimeInNanosecond / 1000);
+    UINT32 bucketIndex = 0;
+    while (elapsedTimeInMicrosecond > 1 && bucketIndex < ContentionDurationHistogramBucketCount - 1)
+    {
+        elapsedTimeInMicrosecond >>= 1;
+        ++bucketIndex;
+    }
+
+    InterlockedIncrement(&s_contentionDurationHistogram[bucketIndex]);
+    if ((ULONG)InterlockedIncrement(&s_contentionDurationHistogramCount) % ContentionsPerDurationHistogram != 0)
+    {
+        return;
+    }
+
+    // Contentions that are recorded while the buckets are being collected may be reported with this histogram or the next one
+    UINT32 buckets[ContentionDurationHistogramBucketCount];
+    for (UINT32 i = 0; i < ContentionDurationHistogramBucketCount; ++i)
+    {
+        buckets[i] = (UINT32)InterlockedExchange(&s_contentionDurationHistogram[i], 0);
+    }
+
+    FireEtwContentionDurationHistogram(GetClrInstanceId(), (UINT16)ContentionDurationHistogramBucketCount, buckets);
+}
+
 BOOL AwareLock::EnterEpilogHelper(Thread* pCurThread, INT32 timeOut)
 {
     STATIC_CONTRACT_THROWS;
@@ -2712,6 +2774,11 @@ BOOL AwareLock::EnterEpilogHelper(Thread* pCurThread, INT32 timeOut)
 
         // Fire a contention end event for a managed contention
         FireEtwContentionStop_V1(ETW::ContentionLog::ContentionStructs::ManagedContention, GetClrInstanceId(), elapsedTimeInNanosecond);
+
+        if (ret != WAIT_TIMEOUT)
+        {
+            RecordContentionDuration(elapsedTimeInNanosecond);
+        }
     }
 
 
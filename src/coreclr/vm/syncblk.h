@@ -450,8 +450,22 @@ private:
     DWORD m_waiterStarvationStartTimeMs;
     int m_emittedLockCreatedEvent;
 
+    // Number of spin iterations that a contending thread currently spins for before waiting, adjusted based on whether recent
+    // spins acquired the lock (see GetSpinCount()). A negative value is the number of contending threads that will skip spinning
+    // before spinning is tried again.
+    INT16 m_spinCount;
+
     static const DWORD WaiterStarvationDurationMsBeforeStoppingPreemptingWaiters = 100;
 
+    static const INT16 SpinCountNotInitialized = INT16_MIN;
+
+    // Spin count below which spinning is skipped rather than reduced further. The first few spin iterations back off
+    // exponentially and are short, spinning for fewer of them is unlikely to acquire the lock.
+    static const INT16 MinSpinCount = 4;
+
+    // Number of contending threads that skip spinning after spinning with the minimum spin count failed to acquire the lock
+    static const INT16 ContentionsBeforeSpinProbe = 100;
+
     // Only SyncBlocks can create AwareLocks.  Hence this private constructor.
     AwareLock(DWORD indx)
         : m_Recursion(0),
@@ -463,7 +477,8 @@ private:
           m_TransientPrecious(0),
           m_dwSyncIndex(indx),
           m_waiterStarvationStartTimeMs(0),
-          m_emittedLockCreatedEvent(0)
+          m_emittedLockCreatedEvent(0),
+          m_spinCount(SpinCountNotInitialized)
     {
         LIMITED_METHOD_CONTRACT;
     }
@@ -542,6 +557,11 @@ private: // friend access is required for this unsafe function
 public:
     static void SpinWait(const YieldProcessorNormalizationInfo &normalizationInfo, DWORD spinIteration);
 
+    // Number of spin iterations that a thread contending for this lock should spin for before waiting, and the outcome of the
+    // spin, which adjusts the spin count for later contending threads
+    DWORD GetSpinCount();
+    void RecordSpinResult(bool acquiredLock);
+
     // Helper encapsulating the fast path entering monitor. Returns what kind of result was achieved.
     bool TryEnterHelper(Thread* pCurThread);
 
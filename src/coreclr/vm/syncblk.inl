@@ -467,6 +467,77 @@ FORCEINLINE void AwareLock::SpinWait(const YieldProcessorNormalizationInfo &norm
     YieldProcessorWithBackOffNormalized(normalizationInfo, spinIteration);
 }
 
+FORCEINLINE DWORD AwareLock::GetSpinCount()
+{
+    WRAPPER_NO_CONTRACT;
+
+    DWORD maxSpinCount = min(g_SpinConstants.dwMonitorSpinCount, (DWORD)INT16_MAX);
+    if (!g_pConfig->MonitorAdaptiveSpin())
+    {
+        return maxSpinCount;
+    }
+
+    // The spin count is updated without synchronization, races only affect how quickly it adapts
+    INT16 spinCount = VolatileLoadWithoutBarrier(&m_spinCount);
+    if (spinCount == SpinCountNotInitialized)
+    {
+        return maxSpinCount;
+    }
+
+    if (spinCount < 0)
+    {
+        // Spinning has not been acquiring the lock recently, the lock is likely held for longer than a spin. Skip spinning, and
+        // once enough contending threads have skipped it, probe with the minimum spin count in case the lock is now held for
+        // shorter durations.
+        ++spinCount;
+        VolatileStoreWithoutBarrier(&m_spinCount, spinCount == 0 ? (INT16)min((DWORD)MinSpinCount, maxSpinCount) : spinCount);
+        return 0;
+    }
+
+    return min((DWORD)spinCount, maxSpinCount);
+}
+
+FORCEINLINE void AwareLock::RecordSpinResult(bool acquiredLock)
+{
+    WRAPPER_NO_CONTRACT;
+
+    if (!g_pConfig->MonitorAdaptiveSpin())
+    {
+        return;
+    }
+
+    INT16 maxSpinCount = (INT16)min(g_SpinConstants.dwMonitorSpinCount, (DWORD)INT16_MAX);
+    INT16 spinCount = VolatileLoadWithoutBarrier(&m_spinCount);
+    if (spinCount == SpinCountNotInitialized)
+    {
+        spinCount = maxSpinCount;
+    }
+    else if (spinCount < 0)
+    {
+        // Another thread started skipping spinning after this thread began to spin
+        return;
+    }
+
+    // Each spin iteration is normalized to a similar duration across processors (see YieldProcessorWithBackOffNormalized()), so
+    // the spin count tracks the duration for which the lock is typically held when a contending thread is able to acquire it
+    // by spinning. Grow it slowly when spinning succeeds, and shrink it slowly when it fails so that occasional long holds do
+    // not stop spinning for a lock that is usually held briefly.
+    INT16 newSpinCount;
+    if (acquiredLock)
+    {
+        newSpinCount = spinCount < maxSpinCount ? (INT16)(spinCount + 1) : maxSpinCount;
+    }
+    else
+    {
+        newSpinCount = spinCount > MinSpinCount ? (INT16)(spinCount - 1) : (INT16)-ContentionsBeforeSpinProbe;
+    }
+
+    if (newSpinCount != spinCount)
+    {
+        VolatileStoreWithoutBarrier(&m_spinCount, newSpinCount);
+    }
+}
+
 FORCEINLINE bool AwareLock::TryEnterHelper(Thread* pCurThread)
 {
     CONTRACTL{
@@ -172,6 +172,7 @@ typedef DPTR(struct ThreadLocalModule) PTR_ThreadLocalModule;
 
 class ThreadStaticHandleTable;
 struct ThreadLocalModule;
+struct ThreadStaticBlock;
 class Module;
 
 struct ThreadLocalBlock
@@ -196,6 +197,12 @@ private:
     // so they can be cleaned up when the thread dies
     ObjectHandleList          m_PinningHandleList;
 
+    // Table of the thread static bases of the types that are accessed through the optimized thread static base helpers,
+    // indexed by the types' thread static block indices (see ThreadStatics::GetThreadStaticBlockIndex). The owning thread
+    // reads it through t_ThreadStaticBlockInfo.
+    ThreadStaticBlock *       m_pThreadStaticBlocks;
+    UINT32                    m_cThreadStaticBlocks;
+
 public:
 
 #ifndef DACCESS_COMPILE
@@ -206,6 +213,9 @@ public:
     void InitThreadStaticHandleTable();
 
     void AllocateThreadStaticBoxes(MethodTable* pMT);
+
+    void SetThreadStaticBlock(UINT32 index, ThreadLocalModule * pThreadLocalModule);
+    void FreeThreadStaticBlocks();
 #endif
 
 public: // used by code generators
@@ -215,7 +225,8 @@ public:
 
 #ifndef DACCESS_COMPILE
     ThreadLocalBlock()
-      : m_pTLMTable(NULL), m_TLMTableSize(0), m_pThreadStaticHandleTable(NULL)
+      : m_pTLMTable(NULL), m_TLMTableSize(0), m_pThreadStaticHandleTable(NULL),
+        m_pThreadStaticBlocks(NULL), m_cThreadStaticBlocks(0)
     {
         m_TLMTableLock.Init(LOCK_TYPE_DEFAULT);
     }
@@ -4473,6 +4484,10 @@ private:
 
 private:
     bool m_hasPendingActivation;
+
+    // Instruction pointer at which the thread was last interrupted to be redirected or hijacked for a runtime suspension, reported
+    // for threads that are slow to reach a safe point
+    PCODE m_suspendInterruptedIP;
 };
 
 // End of class Thread
@@ -16,6 +16,13 @@
 
 #ifndef DACCESS_COMPILE
 
+thread_local ThreadStaticBlockInfo t_ThreadStaticBlockInfo THREAD_STATIC_BLOCK_INFO_TLS_MODEL;
+
+// Thread static block indices are assigned process-wide, an index refers to the same type in the tables of all threads
+static CrstStatic g_ThreadStaticBlockIndexLock;
+static MapSHash<MethodTable *, UINT32> * g_pThreadStaticBlockIndices;
+static SArray<MethodTable *> * g_pThreadStaticBlockTypes;
+
 void ThreadLocalBlock::FreeTLM(SIZE_T i, BOOL isThreadShuttingdown)
 {
     CONTRACTL
@@ -113,6 +120,8 @@ void ThreadLocalBlock::FreeTable()
 
     // Free any pinning handles we may have created
     FreePinningHandles();
+
+    FreeThreadStaticBlocks();
 }
 
 void ThreadLocalBlock::EnsureModuleIndex(ModuleIndex index)
@@ -433,6 +442,74 @@ void ThreadLocalBlock::AllocateThreadStaticBoxes(MethodTable * pMT)
     }
 }
 
+void ThreadLocalBlock::SetThreadStaticBlock(UINT32 index, ThreadLocalModule * pThreadLocalModule)
+{
+    CONTRACTL
+    {
+        THROWS;
+        GC_NOTRIGGER;
+        MODE_ANY;
+        PRECONDITION(this == ThreadStatics::GetCurrentTLB());
+        INJECT_FAULT(COMPlusThrowOM(););
+    }
+    CONTRACTL_END;
+
+    if (index >= m_cThreadStaticBlocks)
+    {
+        UINT32 cNewThreadStaticBlocks = max(16, m_cThreadStaticBlocks);
+        while (cNewThreadStaticBlocks <= index)
+        {
+            cNewThreadStaticBlocks *= 2;
+        }
+
+        ThreadStaticBlock * pNewThreadStaticBlocks = new ThreadStaticBlock[cNewThreadStaticBlocks];
+        memset(pNewThreadStaticBlocks, 0, cNewThreadStaticBlocks * sizeof(ThreadStaticBlock));
+        if (m_pThreadStaticBlocks != NULL)
+        {
+            memcpy(pNewThreadStaticBlocks, m_pThreadStaticBlocks, m_cThreadStaticBlocks * sizeof(ThreadStaticBlock));
+        }
+
+        // Only the owning thread reads the table, it is not in a helper while the table is replaced
+        delete[] m_pThreadStaticBlocks;
+        m_pThreadStaticBlocks = pNewThreadStaticBlocks;
+        m_cThreadStaticBlocks = cNewThreadStaticBlocks;
+
+        t_ThreadStaticBlockInfo.pThreadStaticBlocks = m_pThreadStaticBlocks;
+        t_ThreadStaticBlockInfo.cThreadStaticBlocks = m_cThreadStaticBlocks;
+    }
+
+    m_pThreadStaticBlocks[index].pNonGCStaticsBase = pThreadLocalModule->GetPrecomputedNonGCStaticsBasePointer();
+    m_pThreadStaticBlocks[index].hGCStatics = pThreadLocalModule->GetPrecomputedGCStaticsBaseHandle();
+}
+
+void ThreadLocalBlock::FreeThreadStaticBlocks()
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_ANY;
+    }
+    CONTRACTL_END;
+
+    if (m_pThreadStaticBlocks == NULL)
+    {
+        return;
+    }
+
+    // The table may be freed by another thread once the owning thread is dead, in which case there is no copy to clear
+    Thread * pThread = GetThreadNULLOk();
+    if (pThread != NULL && this == ThreadStatics::GetCurrentTLB(pThread))
+    {
+        t_ThreadStaticBlockInfo.pThreadStaticBlocks = NULL;
+        t_ThreadStaticBlockInfo.cThreadStaticBlocks = 0;
+    }
+
+    delete[] m_pThreadStaticBlocks;
+    m_pThreadStaticBlocks = NULL;
+    m_cThreadStaticBlocks = 0;
+}
+
 #endif
 
 #ifndef DACCESS_COMPILE
@@ -690,6 +767,59 @@ PTR_ThreadLocalModule ThreadStatics::GetTLM(MethodTable * pMT) //static
     return GetTLM(pModule->GetModuleIndex(), pModule);
 }
 
+void ThreadStatics::Init()
+{
+    STANDARD_VM_CONTRACT;
+
+    // Taken by the optimized thread static base helpers, which run in cooperative mode
+    g_ThreadStaticBlockIndexLock.Init(CrstLeafLock, CRST_UNSAFE_ANYMODE);
+    g_pThreadStaticBlockIndices = new MapSHash<MethodTable *, UINT32>();
+    g_pThreadStaticBlockTypes = new SArray<MethodTable *>();
+}
+
+UINT32 ThreadStatics::GetThreadStaticBlockIndex(MethodTable * pMT)
+{
+    CONTRACTL
+    {
+        THROWS;
+        GC_NOTRIGGER;
+        MODE_ANY;
+        PRECONDITION(!pMT->Collectible());
+        PRECONDITION(!pMT->IsDynamicStatics());
+        INJECT_FAULT(COMPlusThrowOM(););
+    }
+    CONTRACTL_END;
+
+    CrstHolder lock(&g_ThreadStaticBlockIndexLock);
+
+    UINT32 index;
+    if (!g_pThreadStaticBlockIndices->Lookup(pMT, &index))
+    {
+        // The type is appended first, if adding it to the map fails the index is simply never used
+        index = g_pThreadStaticBlockTypes->GetCount();
+        g_pThreadStaticBlockTypes->Append(pMT);
+        g_pThreadStaticBlockIndices->Add(MapSHash<MethodTable *, UINT32>::element_t(pMT, index));
+    }
+
+    return index;
+}
+
+MethodTable * ThreadStatics::GetThreadStaticBlockType(UINT32 index)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_ANY;
+    }
+    CONTRACTL_END;
+
+    CrstHolder lock(&g_ThreadStaticBlockIndexLock);
+
+    _ASSERTE(index < g_pThreadStaticBlockTypes->GetCount());
+    return (*g_pThreadStaticBlockTypes)[index];
+}
+
 PTR_ThreadLocalModule ThreadStatics::AllocateTLM(Module * pModule)
 {
     CONTRACTL
@@ -526,11 +526,51 @@ struct TLMTableEntry
 typedef DPTR(struct ThreadLocalBlock) PTR_ThreadLocalBlock;
 typedef DPTR(PTR_ThreadLocalBlock) PTR_PTR_ThreadLocalBlock;
 
+#ifndef DACCESS_COMPILE
+
+// Entry of the per-thread table of thread static bases read by the optimized thread static base helpers
+// (CORINFO_HELP_GETSHARED_GCTHREADSTATIC_BASE_NOCTOR_OPTIMIZED and CORINFO_HELP_GETSHARED_NONGCTHREADSTATIC_BASE_NOCTOR_OPTIMIZED).
+// The entry of a type is only set once the type is initialized on the thread, so the helpers return the base without checking
+// the class init flags when it is set, and take the slow path when it is null.
+struct ThreadStaticBlock
+{
+    TADDR        pNonGCStaticsBase;  // ThreadLocalModule::GetPrecomputedNonGCStaticsBasePointer() of the type's module
+    OBJECTHANDLE hGCStatics;         // ThreadLocalModule::GetPrecomputedGCStaticsBaseHandle() of the type's module
+};
+
+struct ThreadStaticBlockInfo
+{
+    UINT32              cThreadStaticBlocks;
+    ThreadStaticBlock * pThreadStaticBlocks;
+};
+
+#ifdef TARGET_LINUX
+// The runtime is not loaded at startup, but the initial-exec model lets the helpers read the table with a load relative to the
+// thread pointer rather than through __tls_get_addr, the few bytes it needs fit in the static TLS space reserved for dlopen
+#define THREAD_STATIC_BLOCK_INFO_TLS_MODEL __attribute__((tls_model("initial-exec")))
+#else
+#define THREAD_STATIC_BLOCK_INFO_TLS_MODEL
+#endif
+
+// The current thread's table of thread static bases, a copy of the pointer and size kept in the ThreadLocalBlock of the
+// current thread so that the helpers do not need to go through the Thread
+extern thread_local ThreadStaticBlockInfo t_ThreadStaticBlockInfo THREAD_STATIC_BLOCK_INFO_TLS_MODEL;
+
+#endif // !DACCESS_COMPILE
+
 class ThreadStatics
 {
   public:
 
 #ifndef DACCESS_COMPILE
+    static void Init();
+
+    // Returns the index of the type's entry in the per-thread tables of thread static bases, assigning one the first time the
+    // type is asked for. Only non-collectible types whose thread statics are not dynamic are looked up this way, their modules
+    // and ThreadLocalModules are never freed while the thread is alive.
+    static UINT32 GetThreadStaticBlockIndex(MethodTable * pMT);
+    static MethodTable * GetThreadStaticBlockType(UINT32 index);
+
     static PTR_ThreadLocalModule AllocateTLM(Module * pModule);
     static PTR_ThreadLocalModule AllocateAndInitTLM(ModuleIndex index, PTR_ThreadLocalBlock pThreadLocalBlock, Module * pModule);
 
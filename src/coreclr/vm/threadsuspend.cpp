@@ -3204,6 +3204,81 @@ COR_PRF_SUSPEND_REASON GCSuspendReasonToProfSuspendReason(ThreadSuspend::SUSPEND
 }
 #endif // PROFILING_SUPPORTED
 
+// Threads that took the longest to reach a safe point in a runtime suspension, reported with a GCSuspendEESlowThreads event when
+// the suspension had to wait for threads. The time a thread took is measured until the suspending thread observes it in
+// preemptive mode, and its instruction pointer is the one at which it was last interrupted to be redirected or hijacked, which is
+// zero if it was not interrupted in managed code. Threads that stay in long loops without GC polls show up with the same
+// instruction pointers across suspensions.
+class SlowSuspendingThreads
+{
+public:
+    static const UINT16 MaxCount = 8;
+
+    void Start()
+    {
+        LIMITED_METHOD_CONTRACT;
+
+        m_count = 0;
+        QueryPerformanceCounter(&m_startTicks);
+    }
+
+    void Record(SIZE_T osThreadId, PCODE interruptedIP)
+    {
+        LIMITED_METHOD_CONTRACT;
+
+        UINT32 durationUs = GetElapsedMicroseconds();
+
+        // Keep the slowest threads, sorted by decreasing duration
+        UINT16 index = m_count < MaxCount ? m_count++ : MaxCount;
+        for (; index > 0 && m_durationsUs[index - 1] < durationUs; index--)
+        {
+            if (index < MaxCount)
+            {
+                m_osThreadIds[index] = m_osThreadIds[index - 1];
+                m_durationsUs[index] = m_durationsUs[index - 1];
+                m_ips[index] = m_ips[index - 1];
+            }
+        }
+
+        if (index < MaxCount)
+        {
+            m_osThreadIds[index] = (UINT32)osThreadId;
+            m_durationsUs[index] = durationUs;
+            m_ips[index] = (UINT64)interruptedIP;
+        }
+    }
+
+    void Fire()
+    {
+        LIMITED_METHOD_CONTRACT;
+
+        if (m_count != 0)
+        {
+            FireEtwGCSuspendEESlowThreads(GetClrInstanceId(), GetElapsedMicroseconds(), m_count, m_osThreadIds, m_durationsUs, m_ips);
+        }
+    }
+
+private:
+    UINT32 GetElapsedMicroseconds()
+    {
+        LIMITED_METHOD_CONTRACT;
+
+        static LARGE_INTEGER freq;
+        if (freq.QuadPart == 0)
+            QueryPerformanceFrequency(&freq);
+
+        LARGE_INTEGER nowTicks;
+        QueryPerformanceCounter(&nowTicks);
+        return (UINT32)min((nowTicks.QuadPart - m_startTicks.QuadPart) * 1000000 / freq.QuadPart, (LONGLONG)UINT32_MAX);
+    }
+
+    LARGE_INTEGER m_startTicks;
+    UINT16 m_count;
+    UINT32 m_osThreadIds[MaxCount];
+    UINT32 m_durationsUs[MaxCount];
+    UINT64 m_ips[MaxCount];
+};
+
 //************************************************************************************
 //
 // SuspendRuntime is responsible for ensuring that all managed threads reach a
@@ -3334,6 +3409,13 @@ void ThreadSuspend::SuspendRuntime(ThreadSuspend::SUSPEND_REASON reason)
     // we do not on uniprocessor though (spin-checking is pointless on uniprocessor)
     bool observeOnly = false;
 
+    bool reportSlowThreads = ETW_EVENT_ENABLED(MICROSOFT_WINDOWS_DOTNETRUNTIME_PROVIDER_DOTNET_Context, GCSuspendEESlowThreads);
+    SlowSuspendingThreads slowThreads;
+    if (reportSlowThreads)
+    {
+        slowThreads.Start();
+    }
+
     _ASSERTE(!pCurThread || !pCurThread->HasThreadState(Thread::TS_GCSuspendFlags));
 #ifdef _DEBUG
     DWORD dbgStartTimeout = GetTickCount();
@@ -3372,6 +3454,7 @@ void ThreadSuspend::SuspendRuntime(ThreadSuspend::SUSPEND_REASON reason)
                 else
                 {
                     countThreads++;
+                    thread->m_suspendInterruptedIP = (PCODE)NULL;
                     thread->SetThreadState(Thread::TS_GCSuspendPending);
                 }
             }
@@ -3386,6 +3469,10 @@ void ThreadSuspend::SuspendRuntime(ThreadSuspend::SUSPEND_REASON reason)
                 STRESS_LOG1(LF_SYNC, LL_INFO1000, "    Thread %x went preemptive it is at a GC safe point\n", thread);
                 countThreads--;
                 thread->ResetThreadState(Thread::TS_GCSuspendFlags);
+                if (reportSlowThreads)
+                {
+                    slowThreads.Record(thread->GetOSThreadId64(), thread->m_suspendInterruptedIP);
+                }
                 continue;
             }
 
@@ -3491,6 +3578,10 @@ void ThreadSuspend::SuspendRuntime(ThreadSuspend::SUSPEND_REASON reason)
                 countThreads--;
                 thread->ResetThreadState(Thread::TS_GCSuspendFlags);
                 thread->ResumeThread();
+                if (reportSlowThreads)
+                {
+                    slowThreads.Record(thread->GetOSThreadId64(), thread->m_suspendInterruptedIP);
+                }
                 continue;
             }
 
@@ -3649,6 +3740,11 @@ void ThreadSuspend::SuspendRuntime(ThreadSuspend::SUSPEND_REASON reason)
         g_pGCSuspendEvent->Reset();
     }
 
+    if (reportSlowThreads)
+    {
+        slowThreads.Fire();
+    }
+
 #ifdef PROFILING_SUPPORTED
     // If a profiler is keeping track of GC events, notify it
     {
@@ -5415,6 +5511,7 @@ BOOL Thread::HandledJITCase()
     }
 
     PCODE ip = GetIP(&ctx);
+    m_suspendInterruptedIP = ip;
     if (!ExecutionManager::IsManagedCode(ip))
     {
         return FALSE;
@@ -5851,6 +5948,7 @@ void HandleSuspensionForInterruptedThread(CONTEXT *interruptedContext)
         return;
 
     PCODE ip = GetIP(interruptedContext);
+    pThread->m_suspendInterruptedIP = ip;
 
     // This function can only be called when the interrupted thread is in
     // an activation safe point.
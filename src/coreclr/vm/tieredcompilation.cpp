@@ -40,6 +40,18 @@
 // queue. For each method we jit it, then update the precode so that future
 // entrypoint callers will run the new code.
 //
+// When the queue backs up, for instance after a deployment on a machine with many
+// cores, the background worker recruits helper workers (up to
+// TC_BackgroundWorkerMaxCount workers in all, one per TC_BackgroundWorkerBacklogPerWorker
+// queued methods) as long as yielding its thread suggests that processors are idle.
+// Helpers only jit queued methods; the tiering delay, call counting completion and
+// call counting stub cleanup remain with the background worker. Helpers exit as the
+// backlog drains.
+//
+// With TC_SamplingTierUp, calls are not counted. Instead, TieringSampler periodically
+// samples the stacks of running threads and calls TryPromoteSampledMethod() for methods
+// that show up often, which queues them in the same way.
+//
 // # Error handling
 //
 // The overall principle is don't swallow terminal failures that may have corrupted the
@@ -58,6 +70,7 @@ Thread *TieredCompilationManager::s_backgroundWorkerThread = nullptr;
 CLREvent TieredCompilationManager::s_backgroundWorkAvailableEvent;
 bool TieredCompilationManager::s_isBackgroundWorkerRunning = false;
 bool TieredCompilationManager::s_isBackgroundWorkerProcessingWork = false;
+UINT32 TieredCompilationManager::s_backgroundHelperWorkerCount = 0;
 
 // Called at AppDomain construction
 TieredCompilationManager::TieredCompilationManager() :
@@ -319,7 +332,17 @@ void TieredCompilationManager::AsyncPromoteToTier1(
 
     // Insert the method into the optimization queue and trigger a thread to service
     // the queue if needed.
-    SListElem<NativeCodeVersion>* pMethodListItem = new SListElem<NativeCodeVersion>(t1NativeCodeVersion);
+    MethodToOptimize methodToOptimize;
+    methodToOptimize.nativeCodeVersion = t1NativeCodeVersion;
+    methodToOptimize.queuedTicks = 0;
+    if (ETW::CompilationLog::TieredCompilation::Runtime::IsEnabled())
+    {
+        LARGE_INTEGER li;
+        QueryPerformanceCounter(&li);
+        methodToOptimize.queuedTicks = li.QuadPart;
+    }
+
+    SListElem<MethodToOptimize>* pMethodListItem = new SListElem<MethodToOptimize>(methodToOptimize);
     {
         LockHolder tieredCompilationLockHolder;
 
@@ -345,6 +368,50 @@ void TieredCompilationManager::AsyncPromoteToTier1(
     *createTieringBackgroundWorkerRef = true;
 }
 
+// Called by the tiering sampler (see TC_SamplingTierUp) for a method that was seen often enough in stack samples. Returns true
+// if the method's active code version was queued for promotion.
+bool TieredCompilationManager::TryPromoteSampledMethod(MethodDesc *pMethodDesc, bool *createTieringBackgroundWorkerRef)
+{
+    CONTRACTL
+    {
+        THROWS;
+        GC_NOTRIGGER;
+        MODE_ANY;
+    }
+    CONTRACTL_END;
+
+    _ASSERTE(pMethodDesc != nullptr);
+    _ASSERTE(pMethodDesc->IsEligibleForTieredCompilation());
+    _ASSERTE(g_pConfig->TieredCompilation_SamplingTierUp());
+    _ASSERTE(createTieringBackgroundWorkerRef != nullptr);
+
+    // Startup-like activity is not sampled into promotions, similarly to call counting being delayed
+    if (IsTieringDelayActive())
+    {
+        return false;
+    }
+
+    if (!pMethodDesc->GetLoaderAllocator()->GetCallCountingManager()->IsCallCountingEnabled(NativeCodeVersion(pMethodDesc)))
+    {
+        return false;
+    }
+
+    CodeVersionManager::LockHolder codeVersioningLockHolder;
+
+    NativeCodeVersion activeCodeVersion =
+        pMethodDesc->GetCodeVersionManager()->GetActiveILCodeVersion(pMethodDesc).GetActiveNativeCodeVersion(pMethodDesc);
+    if (activeCodeVersion.IsNull() ||
+        activeCodeVersion.GetNativeCode() == NULL ||
+        activeCodeVersion.IsFinalTier() ||
+        activeCodeVersion.GetILCodeVersion().HasAnyOptimizedNativeCodeVersion(activeCodeVersion))
+    {
+        return false;
+    }
+
+    AsyncPromoteToTier1(activeCodeVersion, createTieringBackgroundWorkerRef);
+    return true;
+}
+
 bool TieredCompilationManager::TryScheduleBackgroundWorkerWithoutGCTrigger_Locked()
 {
     CONTRACTL
@@ -501,6 +568,7 @@ void TieredCompilationManager::BackgroundWorkerStart()
     UINT64 maxWorkDurationTicks = ticksPerS * 50 / 1000; // 50 ms
     UINT64 minWorkDurationTicks = min(ticksPerS * processorCount / 1000, maxWorkDurationTicks); // <proc count> ms (capped)
     UINT64 workDurationTicks = minWorkDurationTicks;
+    UINT64 idleYieldTicks = ticksPerS / 10000; // 100 us
 
     while (true)
     {
@@ -526,7 +594,7 @@ void TieredCompilationManager::BackgroundWorkerStart()
         }
 
         if ((m_isPendingCallCountingCompletion || m_countOfMethodsToOptimize != 0) &&
-            !DoBackgroundWork(&workDurationTicks, minWorkDurationTicks, maxWorkDurationTicks))
+            !DoBackgroundWork(&workDurationTicks, minWorkDurationTicks, maxWorkDurationTicks, idleYieldTicks))
         {
             // Background work was interrupted due to the tiering delay being activated
             _ASSERTE(IsTieringDelayActive());
@@ -554,6 +622,12 @@ void TieredCompilationManager::BackgroundWorkerStart()
         // The wait timed out, see if the worker can exit. When using the PAL, it may be possible to get WAIT_FAILED in some
         // shutdown scenarios, treat that as a timeout too since a signal would not have been observed anyway.
 
+    #ifdef FEATURE_MULTICOREJIT
+        // Tiering has settled, persist which methods are running optimized code so that the next run can jit them optimized
+        // from the start
+        GetAppDomain()->GetMulticoreJitManager().WriteProfileSnapshot();
+    #endif
+
         LockHolder tieredCompilationLockHolder;
 
         if (s_isBackgroundWorkerProcessingWork)
@@ -570,6 +644,180 @@ void TieredCompilationManager::BackgroundWorkerStart()
     }
 }
 
+void TieredCompilationManager::TryCreateBackgroundHelperWorker(bool hasIdleProcessors)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_TRIGGERS;
+        MODE_PREEMPTIVE;
+    }
+    CONTRACTL_END;
+
+    _ASSERTE(GetThread() == s_backgroundWorkerThread);
+
+    if (!hasIdleProcessors)
+    {
+        return;
+    }
+
+    {
+        LockHolder tieredCompilationLockHolder;
+
+        // The background worker counts as one of the workers. At most one helper is added per yield of the background worker
+        // so that each new helper's effect on the idle processors is observed before deciding to add another.
+        UINT32 maxHelperWorkerCount = g_pConfig->TieredCompilation_BackgroundWorkerMaxCount() - 1;
+        UINT32 backlogHelperWorkerCount =
+            m_countOfMethodsToOptimize / g_pConfig->TieredCompilation_BackgroundWorkerBacklogPerWorker();
+        if (s_backgroundHelperWorkerCount >= min(maxHelperWorkerCount, backlogHelperWorkerCount))
+        {
+            return;
+        }
+
+        ++s_backgroundHelperWorkerCount;
+    }
+
+    bool created = false;
+    EX_TRY
+    {
+        Thread *newThread = SetupUnstartedThread();
+        _ASSERTE(newThread != nullptr);
+    #ifdef FEATURE_COMINTEROP
+        newThread->SetApartment(Thread::AS_InMTA);
+    #endif
+        newThread->SetBackground(true);
+
+        if (!newThread->CreateNewThread(0, BackgroundHelperWorkerBootstrapper0, newThread, W(".NET Tiered Compilation Worker")))
+        {
+            newThread->DecExternalCount(false);
+            ThrowOutOfMemory();
+        }
+
+        newThread->StartThread();
+        created = true;
+    }
+    EX_CATCH
+    {
+        // The background worker continues on its own, another helper may be created at its next yield
+        STRESS_LOG1(LF_TIEREDCOMPILATION, LL_WARNING, "TieredCompilationManager::TryCreateBackgroundHelperWorker: "
+            "Exception creating a helper worker, hr=0x%x\n",
+            GET_EXCEPTION()->GetHR());
+    }
+    EX_END_CATCH(RethrowTerminalExceptions);
+
+    if (!created)
+    {
+        LockHolder tieredCompilationLockHolder;
+
+        _ASSERTE(s_backgroundHelperWorkerCount != 0);
+        --s_backgroundHelperWorkerCount;
+        return;
+    }
+
+    SendBackgroundWorkersEvent();
+}
+
+DWORD WINAPI TieredCompilationManager::BackgroundHelperWorkerBootstrapper0(LPVOID args)
+{
+    CONTRACTL
+    {
+        THROWS;
+        GC_TRIGGERS;
+        MODE_PREEMPTIVE;
+    }
+    CONTRACTL_END;
+
+    _ASSERTE(args != nullptr);
+    Thread *thread = (Thread *)args;
+
+    if (!thread->HasStarted())
+    {
+        LockHolder tieredCompilationLockHolder;
+
+        _ASSERTE(s_backgroundHelperWorkerCount != 0);
+        --s_backgroundHelperWorkerCount;
+        return 0;
+    }
+
+    _ASSERTE(GetThread() == thread);
+    ManagedThreadBase::KickOff(BackgroundHelperWorkerBootstrapper1, nullptr);
+
+    GCX_PREEMP_NO_DTOR();
+
+    DestroyThread(thread);
+    return 0;
+}
+
+void TieredCompilationManager::BackgroundHelperWorkerBootstrapper1(LPVOID)
+{
+    CONTRACTL
+    {
+        THROWS;
+        GC_TRIGGERS;
+        MODE_COOPERATIVE;
+    }
+    CONTRACTL_END;
+
+    GCX_PREEMP();
+    GetAppDomain()->GetTieredCompilationManager()->BackgroundHelperWorkerStart();
+}
+
+void TieredCompilationManager::BackgroundHelperWorkerStart()
+{
+    CONTRACTL
+    {
+        THROWS;
+        GC_TRIGGERS;
+        MODE_PREEMPTIVE;
+    }
+    CONTRACTL_END;
+
+    _ASSERTE(GetThread() != s_backgroundWorkerThread);
+
+    while (true)
+    {
+        NativeCodeVersion nativeCodeVersionToOptimize;
+        UINT64 queuedTicks = 0;
+        {
+            LockHolder tieredCompilationLockHolder;
+
+            // Retire as soon as the backlog no longer justifies this many helpers. Methods are not jitted in the background
+            // while the tiering delay is active, and the background worker handles the delay by itself.
+            _ASSERTE(s_backgroundHelperWorkerCount != 0);
+            UINT32 backlogHelperWorkerCount =
+                m_countOfMethodsToOptimize / g_pConfig->TieredCompilation_BackgroundWorkerBacklogPerWorker();
+            if (IsTieringDelayActive() || backlogHelperWorkerCount < s_backgroundHelperWorkerCount)
+            {
+                --s_backgroundHelperWorkerCount;
+                break;
+            }
+
+            nativeCodeVersionToOptimize = GetNextMethodToOptimize(&queuedTicks);
+            _ASSERTE(!nativeCodeVersionToOptimize.IsNull());
+        }
+
+        OptimizeMethod(nativeCodeVersionToOptimize, queuedTicks);
+
+        // Give preference to possibly more important work, as the background worker does
+        ClrSleepEx(0, false);
+    }
+
+    SendBackgroundWorkersEvent();
+}
+
+void TieredCompilationManager::SendBackgroundWorkersEvent()
+{
+    WRAPPER_NO_CONTRACT;
+
+    if (ETW::CompilationLog::TieredCompilation::Runtime::IsEnabled())
+    {
+        // The counts are read without the lock, they are only informational
+        ETW::CompilationLog::TieredCompilation::Runtime::SendBackgroundWorkers(
+            m_countOfMethodsToOptimize,
+            s_backgroundHelperWorkerCount + 1);
+    }
+}
+
 bool TieredCompilationManager::IsTieringDelayActive()
 {
     LIMITED_METHOD_CONTRACT;
@@ -703,7 +951,8 @@ void TieredCompilationManager::AsyncCompleteCallCounting()
 bool TieredCompilationManager::DoBackgroundWork(
     UINT64 *workDurationTicksRef,
     UINT64 minWorkDurationTicks,
-    UINT64 maxWorkDurationTicks)
+    UINT64 maxWorkDurationTicks,
+    UINT64 idleYieldTicks)
 {
     WRAPPER_NO_CONTRACT;
     _ASSERTE(GetThread() == s_backgroundWorkerThread);
@@ -737,6 +986,7 @@ bool TieredCompilationManager::DoBackgroundWork(
     {
         bool completeCallCounting = false;
         NativeCodeVersion nativeCodeVersionToOptimize;
+        UINT64 queuedTicks = 0;
         {
             LockHolder tieredCompilationLockHolder;
 
@@ -766,7 +1016,7 @@ bool TieredCompilationManager::DoBackgroundWork(
 
             if (!completeCallCounting)
             {
-                nativeCodeVersionToOptimize = GetNextMethodToOptimize();
+                nativeCodeVersionToOptimize = GetNextMethodToOptimize(&queuedTicks);
                 if (nativeCodeVersionToOptimize.IsNull())
                 {
                     // Ran out of methods to JIT
@@ -805,7 +1055,7 @@ bool TieredCompilationManager::DoBackgroundWork(
             continue;
         }
 
-        OptimizeMethod(nativeCodeVersionToOptimize);
+        OptimizeMethod(nativeCodeVersionToOptimize, queuedTicks);
         ++jittedMethodCount;
 
         // Yield the thread periodically to give preference to possibly more important work
@@ -870,6 +1120,10 @@ bool TieredCompilationManager::DoBackgroundWork(
             break;
         }
 
+        // If the yield returned almost immediately, no other thread was waiting to run, which suggests that there are idle
+        // processors to give to a helper worker if the backlog calls for one
+        TryCreateBackgroundHelperWorker(currentTicks - beforeSleepTicks <= idleYieldTicks);
+
         if (ETW::CompilationLog::TieredCompilation::Runtime::IsEnabled())
         {
             UINT32 countOfMethodsToOptimize = m_countOfMethodsToOptimize;
@@ -915,14 +1169,39 @@ bool TieredCompilationManager::DoBackgroundWork(
 
 // Jit compiles and installs new optimized code for a method.
 // Called on a background thread.
-void TieredCompilationManager::OptimizeMethod(NativeCodeVersion nativeCodeVersion)
+void TieredCompilationManager::OptimizeMethod(NativeCodeVersion nativeCodeVersion, UINT64 queuedTicks)
 {
     STANDARD_VM_CONTRACT;
 
     _ASSERTE(nativeCodeVersion.GetMethodDesc()->IsEligibleForTieredCompilation());
-    if (CompileCodeVersion(nativeCodeVersion))
+
+    LARGE_INTEGER li;
+    UINT64 startTicks = 0;
+    if (queuedTicks != 0)
+    {
+        QueryPerformanceCounter(&li);
+        startTicks = li.QuadPart;
+    }
+
+    if (!CompileCodeVersion(nativeCodeVersion))
     {
-        ActivateCodeVersion(nativeCodeVersion);
+        return;
+    }
+
+    ActivateCodeVersion(nativeCodeVersion);
+
+    if (queuedTicks != 0 && ETW::CompilationLog::TieredCompilation::Runtime::IsEnabled())
+    {
+        QueryPerformanceCounter(&li);
+        UINT64 endTicks = li.QuadPart;
+        QueryPerformanceFrequency(&li);
+        UINT64 ticksPerS = li.QuadPart;
+
+        ETW::CompilationLog::TieredCompilation::Runtime::SendMethodPromoted(
+            nativeCodeVersion.GetMethodDesc(),
+            (UINT16)nativeCodeVersion.GetOptimizationTier(),
+            (startTicks - queuedTicks) * 1000000 / ticksPerS,
+            (endTicks - startTicks) * 1000000 / ticksPerS);
     }
 }
 
@@ -1007,8 +1286,8 @@ void TieredCompilationManager::ActivateCodeVersion(NativeCodeVersion nativeCodeV
 }
 
 // Dequeues the next method in the optimization queue.
-// This runs on the background thread.
-NativeCodeVersion TieredCompilationManager::GetNextMethodToOptimize()
+// This runs on the background worker or a helper worker.
+NativeCodeVersion TieredCompilationManager::GetNextMethodToOptimize(UINT64 *queuedTicksRef)
 {
     CONTRACTL
     {
@@ -1019,11 +1298,13 @@ NativeCodeVersion TieredCompilationManager::GetNextMethodToOptimize()
     CONTRACTL_END;
 
     _ASSERTE(IsLockOwnedByCurrentThread());
+    _ASSERTE(queuedTicksRef != nullptr);
 
-    SListElem<NativeCodeVersion>* pElem = m_methodsToOptimize.RemoveHead();
+    SListElem<MethodToOptimize>* pElem = m_methodsToOptimize.RemoveHead();
     if (pElem != NULL)
     {
-        NativeCodeVersion nativeCodeVersion = pElem->GetValue();
+        NativeCodeVersion nativeCodeVersion = pElem->GetValue().nativeCodeVersion;
+        *queuedTicksRef = pElem->GetValue().queuedTicks;
         delete pElem;
         _ASSERTE(m_countOfMethodsToOptimize != 0);
         --m_countOfMethodsToOptimize;
@@ -1081,6 +1362,15 @@ CORJIT_FLAGS TieredCompilationManager::GetJitFlags(PrepareCodeConfig *config)
                 }
 
                 _ASSERTE(!nativeCodeVersion.IsFinalTier());
+            #ifdef FEATURE_MULTICOREJIT
+                if (config->IsForMulticoreJit() && ((MulticoreJitPrepareCodeConfig *)config)->ShouldJitOptimized())
+                {
+                    // The multi-core JIT profile recorded that the method was running optimized code, so skip tier 0. The
+                    // optimization tier is only finalized once the code is used, as though the JIT had switched to optimizing.
+                    config->SetJitSwitchedToOptimized();
+                    return flags;
+                }
+            #endif
                 flags.Set(CORJIT_FLAGS::CORJIT_FLAG_TIER0);
                 return flags;
             }
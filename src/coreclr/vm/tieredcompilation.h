@@ -43,6 +43,7 @@ public:
     void HandleCallCountingForFirstCall(MethodDesc* pMethodDesc);
     bool TrySetCodeEntryPointAndRecordMethodForCallCounting(MethodDesc* pMethodDesc, PCODE codeEntryPoint);
     void AsyncPromoteToTier1(NativeCodeVersion currentNativeCodeVersion, bool *createTieringBackgroundWorkerRef);
+    bool TryPromoteSampledMethod(MethodDesc *pMethodDesc, bool *createTieringBackgroundWorkerRef);
     static CORJIT_FLAGS GetJitFlags(PrepareCodeConfig *config);
 
 #if !defined(DACCESS_COMPILE) && defined(_DEBUG)
@@ -62,6 +63,14 @@ private:
     static void BackgroundWorkerBootstrapper1(LPVOID args);
     void BackgroundWorkerStart();
 
+private:
+    // Helper workers only drain the queue of methods to optimize, alongside the background worker, while the backlog is deep
+    void TryCreateBackgroundHelperWorker(bool hasIdleProcessors);
+    static DWORD WINAPI BackgroundHelperWorkerBootstrapper0(LPVOID args);
+    static void BackgroundHelperWorkerBootstrapper1(LPVOID args);
+    void BackgroundHelperWorkerStart();
+    void SendBackgroundWorkersEvent();
+
 private:
     bool IsTieringDelayActive();
     bool TryDeactivateTieringDelay();
@@ -71,11 +80,15 @@ public:
 
 private:
     static DWORD StaticBackgroundWorkCallback(void* args);
-    bool DoBackgroundWork(UINT64 *workDurationTicksRef, UINT64 minWorkDurationTicks, UINT64 maxWorkDurationTicks);
+    bool DoBackgroundWork(
+        UINT64 *workDurationTicksRef,
+        UINT64 minWorkDurationTicks,
+        UINT64 maxWorkDurationTicks,
+        UINT64 idleYieldTicks);
 
 private:
-    void OptimizeMethod(NativeCodeVersion nativeCodeVersion);
-    NativeCodeVersion GetNextMethodToOptimize();
+    void OptimizeMethod(NativeCodeVersion nativeCodeVersion, UINT64 queuedTicks);
+    NativeCodeVersion GetNextMethodToOptimize(UINT64 *queuedTicksRef);
     BOOL CompileCodeVersion(NativeCodeVersion nativeCodeVersion);
     void ActivateCodeVersion(NativeCodeVersion nativeCodeVersion);
 
@@ -119,10 +132,17 @@ private:
     static CLREvent s_backgroundWorkAvailableEvent;
     static bool s_isBackgroundWorkerRunning;
     static bool s_isBackgroundWorkerProcessingWork;
+    static UINT32 s_backgroundHelperWorkerCount;
 #endif // !DACCESS_COMPILE
 
 private:
-    SList<SListElem<NativeCodeVersion>> m_methodsToOptimize;
+    struct MethodToOptimize
+    {
+        NativeCodeVersion nativeCodeVersion;
+        UINT64 queuedTicks; // performance counter value when the method was queued, 0 if events were disabled then
+    };
+
+    SList<SListElem<MethodToOptimize>> m_methodsToOptimize;
     UINT32 m_countOfMethodsToOptimize;
     UINT32 m_countOfNewMethodsCalledDuringDelay;
     SArray<MethodDesc*>* m_methodsPendingCountingForTier1;
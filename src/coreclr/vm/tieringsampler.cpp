@@ -0,0 +1,252 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+// ===========================================================================
+// File: TieringSampler.CPP
+//
+// ===========================================================================
+
+#include "common.h"
+#include "threadsuspend.h"
+#include "tieredcompilation.h"
+#include "tieringsampler.h"
+
+// TieringSampler replaces call counting stubs as the trigger for promoting tier 0 methods when TC_SamplingTierUp is enabled.
+//
+// # Overall workflow
+//
+// Call counting is left enabled so that methods still start at tier 0, but CallCountingManager::SetCodeEntryPoint() publishes
+// the tier 0 code directly instead of a call counting stub. Every TC_SamplingIntervalMs, the sampling thread suspends the
+// runtime and walks the stacks of the threads that are not blocked in a managed wait, recording the first few frames of each
+// into a fixed-size buffer. Once the runtime is restarted, the recorded methods are counted, and a method that is seen in
+// TC_SampleThreshold samples is queued for promotion with TieredCompilationManager::AsyncPromoteToTier1(), just as if its call
+// count threshold had been reached. Counts are reset periodically so that they reflect recent activity.
+//
+// Sampling approximates where time is spent rather than how often methods are called. Short methods that are called very often
+// but are inlined into their callers at tier 1 may no longer be promoted on their own, which is usually fine since the callers
+// are promoted. The tiering delay is honored, no methods are promoted while it is active.
+//
+// # Error handling
+//
+// Exceptions in an iteration of sampling (OOM) are caught and the iteration is abandoned, the affected methods would be
+// promoted in a later iteration.
+
+#if defined(FEATURE_TIERED_COMPILATION) && !defined(DACCESS_COMPILE)
+
+static TieringSampler *g_pTieringSampler = nullptr;
+
+void TieringSampler::Init()
+{
+    STANDARD_VM_CONTRACT;
+
+    if (!g_pConfig->TieredCompilation() || !g_pConfig->TieredCompilation_SamplingTierUp())
+    {
+        return;
+    }
+
+    _ASSERTE(g_pTieringSampler == nullptr);
+    g_pTieringSampler = new TieringSampler();
+}
+
+TieringSampler::TieringSampler()
+    : m_pThread(nullptr)
+    , m_sampledMethodCount(0)
+    , m_sampleCountInPeriod(0)
+{
+    STANDARD_VM_CONTRACT;
+
+    Thread *newThread = SetupUnstartedThread();
+    _ASSERTE(newThread != nullptr);
+    newThread->SetBackground(true);
+
+    if (!newThread->CreateNewThread(0, SamplingThreadProc, this, W(".NET Tiering Sampler")))
+    {
+        newThread->DecExternalCount(false);
+        ThrowOutOfMemory();
+    }
+
+    m_pThread = newThread;
+    newThread->StartThread();
+}
+
+DWORD WINAPI TieringSampler::SamplingThreadProc(void *args)
+{
+    WRAPPER_NO_CONTRACT;
+    _ASSERTE(args != nullptr);
+
+    ((TieringSampler *)args)->ThreadProc();
+    return 0;
+}
+
+void TieringSampler::ThreadProc()
+{
+    CONTRACTL
+    {
+        THROWS;
+        GC_TRIGGERS;
+        MODE_ANY;
+    }
+    CONTRACTL_END;
+
+    if (!m_pThread->HasStarted())
+    {
+        return;
+    }
+
+    GCX_PREEMP();
+
+    DWORD intervalMs = g_pConfig->TieredCompilation_SamplingIntervalMs();
+    while (true)
+    {
+        m_pThread->UserSleep(intervalMs);
+
+        EX_TRY
+        {
+            TakeSample();
+            PromoteSampledMethods();
+        }
+        EX_CATCH
+        {
+            STRESS_LOG1(LF_TIEREDCOMPILATION, LL_WARNING, "TieringSampler::ThreadProc: "
+                "Exception while sampling, hr=0x%x\n",
+                GET_EXCEPTION()->GetHR());
+        }
+        EX_END_CATCH(RethrowTerminalExceptions);
+    }
+}
+
+struct TieringSamplerWalkInfo
+{
+    MethodDesc **sampledMethods;
+    UINT32 *sampledMethodCountRef;
+    UINT32 sampledMethodCountLimit;
+    UINT32 firstSampledMethodIndex;
+    UINT32 frameCount;
+};
+
+StackWalkAction TieringSampler::StackWalkCallback(CrawlFrame *pCf, VOID *data)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_ANY;
+    }
+    CONTRACTL_END;
+
+    TieringSamplerWalkInfo *info = (TieringSamplerWalkInfo *)data;
+
+    MethodDesc *pMD = pCf->GetFunction();
+
+    // Methods in collectible assemblies are skipped, as they may be unloaded before they are counted
+    if (pMD != nullptr && pMD->IsEligibleForTieredCompilation() && !pMD->GetLoaderAllocator()->IsCollectible())
+    {
+        UINT32 &sampledMethodCount = *info->sampledMethodCountRef;
+
+        // Recursion would otherwise count a method several times in the same thread's sample
+        if (sampledMethodCount == info->firstSampledMethodIndex || info->sampledMethods[sampledMethodCount - 1] != pMD)
+        {
+            info->sampledMethods[sampledMethodCount++] = pMD;
+            if (sampledMethodCount >= info->sampledMethodCountLimit)
+            {
+                return SWA_ABORT;
+            }
+        }
+    }
+
+    return ++info->frameCount < MaxFramesPerThread ? SWA_CONTINUE : SWA_ABORT;
+}
+
+void TieringSampler::TakeSample()
+{
+    CONTRACTL
+    {
+        THROWS;
+        GC_TRIGGERS;
+        MODE_PREEMPTIVE;
+    }
+    CONTRACTL_END;
+
+    m_sampledMethodCount = 0;
+
+    // Nothing is allocated while the runtime is suspended, the sampled methods are only recorded and they are counted after the
+    // runtime is restarted
+    ThreadSuspend::SuspendEE(ThreadSuspend::SUSPEND_OTHER);
+
+    Thread *pThread = nullptr;
+    while ((pThread = ThreadStore::GetThreadList(pThread)) != nullptr && m_sampledMethodCount < MaxFramesPerSample)
+    {
+        if (pThread == m_pThread)
+        {
+            continue;
+        }
+
+        // Threads that are not running, or are blocked in a sleep, wait, or join are not spending time in the methods on their
+        // stacks
+        if ((pThread->GetSnapshotState() & (Thread::TS_Unstarted | Thread::TS_Dead | Thread::TS_Interruptible)) != 0)
+        {
+            continue;
+        }
+
+        TieringSamplerWalkInfo info;
+        info.sampledMethods = m_sampledMethods;
+        info.sampledMethodCountRef = &m_sampledMethodCount;
+        info.sampledMethodCountLimit = MaxFramesPerSample;
+        info.firstSampledMethodIndex = m_sampledMethodCount;
+        info.frameCount = 0;
+        pThread->StackWalkFrames(StackWalkCallback, &info, FUNCTIONSONLY | ALLOW_ASYNC_STACK_WALK);
+    }
+
+    ThreadSuspend::RestartEE(FALSE, TRUE);
+}
+
+void TieringSampler::PromoteSampledMethods()
+{
+    CONTRACTL
+    {
+        THROWS;
+        GC_TRIGGERS;
+        MODE_PREEMPTIVE;
+    }
+    CONTRACTL_END;
+
+    if (++m_sampleCountInPeriod >= SamplesPerCountingPeriod)
+    {
+        m_sampleCounts.RemoveAll();
+        m_sampleCountInPeriod = 0;
+    }
+
+    UINT32 sampleThreshold = g_pConfig->TieredCompilation_SampleThreshold();
+    TieredCompilationManager *tieredCompilationManager = GetAppDomain()->GetTieredCompilationManager();
+    bool createTieringBackgroundWorker = false;
+
+    for (UINT32 i = 0; i < m_sampledMethodCount; ++i)
+    {
+        MethodDesc *pMD = m_sampledMethods[i];
+
+        UINT32 sampleCount = 0;
+        m_sampleCounts.Lookup(pMD, &sampleCount);
+        if (++sampleCount < sampleThreshold)
+        {
+            m_sampleCounts.AddOrReplace(SampleCountHash::element_t(pMD, sampleCount));
+            continue;
+        }
+
+        // Counting starts over for the new code version, which may itself be promoted later, for instance from an instrumented
+        // tier
+        if (tieredCompilationManager->TryPromoteSampledMethod(pMD, &createTieringBackgroundWorker))
+        {
+            m_sampleCounts.Remove(pMD);
+        }
+        else
+        {
+            m_sampleCounts.AddOrReplace(SampleCountHash::element_t(pMD, sampleCount));
+        }
+    }
+
+    if (createTieringBackgroundWorker)
+    {
+        TieredCompilationManager::CreateBackgroundWorker(); // requires GC_TRIGGERS
+    }
+}
+
+#endif // FEATURE_TIERED_COMPILATION && !DACCESS_COMPILE
@@ -0,0 +1,56 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+// ===========================================================================
+// File: TieringSampler.h
+//
+// ===========================================================================
+
+#ifndef TIERING_SAMPLER_H
+#define TIERING_SAMPLER_H
+
+#if defined(FEATURE_TIERED_COMPILATION) && !defined(DACCESS_COMPILE)
+
+// TieringSampler is an alternative to call counting stubs for deciding when a tier 0 method should be promoted (see
+// TC_SamplingTierUp). It periodically suspends the runtime, records the managed methods at the top of the stacks of running
+// threads, and promotes methods that are seen in enough samples. Unlike call counting, no per-method stubs are installed and
+// methods that are called rarely but run for long are promoted, while methods that are called often but are cheap are not.
+class TieringSampler
+{
+public:
+    static void Init();
+
+private:
+    TieringSampler();
+
+    static DWORD WINAPI SamplingThreadProc(void *args);
+    void ThreadProc();
+
+    void TakeSample();
+    static StackWalkAction StackWalkCallback(CrawlFrame *pCf, VOID *data);
+    void PromoteSampledMethods();
+
+private:
+    // Number of managed frames recorded from the top of each thread's stack. Callers of a hot method running at tier 0 slow
+    // it down as well, so a few frames are recorded rather than only the top one.
+    static const UINT32 MaxFramesPerThread = 4;
+
+    // Number of frames that may be recorded per sample, bounds the work done while the runtime is suspended
+    static const UINT32 MaxFramesPerSample = 256;
+
+    // Number of samples after which counts are reset, so that methods that were warm long ago do not accumulate enough samples
+    // to be promoted
+    static const UINT32 SamplesPerCountingPeriod = 1024;
+
+private:
+    typedef MapSHash<MethodDesc *, UINT32> SampleCountHash;
+
+    Thread *m_pThread;
+    MethodDesc *m_sampledMethods[MaxFramesPerSample];
+    UINT32 m_sampledMethodCount;
+    UINT32 m_sampleCountInPeriod;
+    SampleCountHash m_sampleCounts;
+};
+
+#endif // FEATURE_TIERED_COMPILATION && !DACCESS_COMPILE
+
+#endif // TIERING_SAMPLER_H
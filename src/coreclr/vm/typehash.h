@@ -24,6 +24,10 @@
 // - for an instantiated type, the typedef module, typedef token, and instantiation
 // - for an array/pointer type, the CorElementType, rank, and type parameter
 //
+// The table is safe for multiple readers and a single writer i.e. only one thread
+// can be in InsertValue (under the class loader's m_AvailableTypesLock) but multiple
+// threads can be in GetValue without taking any lock, including while the table grows.
+//
 //========================================================================================
 
 DWORD HashTypeKey(TypeKey* pKey);
@@ -28,6 +28,7 @@ UINT32 g_site_counter = 0;              //# of call sites
 UINT32 g_site_write = 0;                //# of call site backpatch writes
 UINT32 g_site_write_poly = 0;           //# of call site backpatch writes to point to resolve stubs
 UINT32 g_site_write_mono = 0;           //# of call site backpatch writes to point to dispatch stubs
+UINT32 g_site_write_pic = 0;            //# of call site writes to add a type to a polymorphic site
 
 UINT32 g_stub_lookup_counter = 0;       //# of lookup stubs
 UINT32 g_stub_mono_counter = 0;         //# of dispatch stubs
@@ -111,6 +112,8 @@ DispatchCache *g_resolveCache = NULL;    //cache of dispatch stubs for in line l
 
 size_t g_dispatch_cache_chain_success_counter = CALL_STUB_CACHE_INITIAL_SUCCESS_COUNT;
 
+UINT32 VirtualCallStubManager::s_maxPolymorphicTypes = 4;
+
 #ifdef STUB_LOGGING
 UINT32 g_resetCacheCounter;
 UINT32 g_resetCacheIncr;
@@ -227,6 +230,8 @@ void VirtualCallStubManager::LoggingDump()
         WriteFile (g_hStubLogFile, szPrintStr, (DWORD) strlen(szPrintStr), &dwWriteByte, NULL);
         sprintf_s(szPrintStr, ARRAY_SIZE(szPrintStr), OUTPUT_FORMAT_INT, "site_write_poly", g_site_write_poly);
         WriteFile (g_hStubLogFile, szPrintStr, (DWORD) strlen(szPrintStr), &dwWriteByte, NULL);
+        sprintf_s(szPrintStr, ARRAY_SIZE(szPrintStr), OUTPUT_FORMAT_INT, "site_write_pic", g_site_write_pic);
+        WriteFile (g_hStubLogFile, szPrintStr, (DWORD) strlen(szPrintStr), &dwWriteByte, NULL);
 
         sprintf_s(szPrintStr, ARRAY_SIZE(szPrintStr), "\r\n%-30s %d\r\n", "reclaim_counter", g_reclaim_counter);
         WriteFile (g_hStubLogFile, szPrintStr, (DWORD) strlen(szPrintStr), &dwWriteByte, NULL);
@@ -858,6 +863,11 @@ void VirtualCallStubManager::InitStatic()
     g_resetCacheIncr       = (INT32) CLRConfig::GetConfigValue(CLRConfig::INTERNAL_VirtualCallStubResetCacheIncr);
 #endif // STUB_LOGGING
 
+    // Every type checked inline costs a compare and a branch on the calls to the types after it, past four
+    // types the hash lookup of the resolve stub is about as fast.
+    s_maxPolymorphicTypes = CLRConfig::GetConfigValue(CLRConfig::INTERNAL_VirtualCallStubPolymorphicTypes);
+    s_maxPolymorphicTypes = min(max(s_maxPolymorphicTypes, (UINT32)1), (UINT32)4);
+
 #ifndef STUB_DISPATCH_PORTABLE
     DispatchHolder::InitializeStatic();
     ResolveHolder::InitializeStatic();
@@ -1340,7 +1350,8 @@ size_t VirtualCallStubManager::GetTokenFromStubQuick(VirtualCallStubManager * pM
     if (kind == SK_DISPATCH)
     {
         _ASSERTE(pMgr->isDispatchingStub(stub));
-        DispatchStub  * dispatchStub  = (DispatchStub *) PCODEToPINSTR(stub);
+        UINT32          typeCount;
+        DispatchStub  * dispatchStub  = pMgr->GetLastDispatchStubInChain(stub, &typeCount);
         ResolveHolder * resolveHolder = ResolveHolder::FromFailEntry(dispatchStub->failTarget());
         _ASSERTE(pMgr->isResolvingStub(resolveHolder->stub()->resolveEntryPoint()));
         return resolveHolder->stub()->token();
@@ -1462,7 +1473,7 @@ PCODE VSD_ResolveWorker(TransitionBlock * pTransitionBlock,
         {
             PCODE stubAddr = callSite.GetSiteTarget();
             VirtualCallStubManager * pMgr = VirtualCallStubManager::FindStubManager(stubAddr);
-            pMgr->BackPatchWorker(&callSite);
+            pMgr->BackPatchWorker(&callSite, FALSE /* fCanExtendSite */);
         }
 
         return target;
@@ -1499,10 +1510,11 @@ PCODE VSD_ResolveWorker(TransitionBlock * pTransitionBlock,
     PREFIX_ASSUME(pMgr != NULL);
 
 #ifndef TARGET_X86
-    // Have we failed the dispatch stub too many times?
+    // Have we failed the dispatch stub too many times? If the site has room for more types,
+    // ResolveWorker adds the one that missed to it instead.
     if (flags & SDF_ResolveBackPatch)
     {
-        pMgr->BackPatchWorker(&callSite);
+        pMgr->BackPatchWorker(&callSite, TRUE /* fCanExtendSite */);
     }
 #endif
 
@@ -1543,7 +1555,9 @@ void VirtualCallStubManager::BackPatchWorkerStatic(PCODE returnAddress, TADDR si
     VirtualCallStubManager *pMgr = VirtualCallStubManager::FindStubManager(callSiteTarget);
     PREFIX_ASSUME(pMgr != NULL);
 
-    pMgr->BackPatchWorker(&callSite);
+    // We are called from the resolve stub, which does not go through ResolveWorker on a cache hit,
+    // so nothing would extend the site.
+    pMgr->BackPatchWorker(&callSite, FALSE /* fCanExtendSite */);
 }
 
 #if defined(TARGET_X86) && defined(TARGET_UNIX)
@@ -1857,6 +1871,13 @@ PCODE VirtualCallStubManager::ResolveWorker(StubCallSite* pCallSite,
             }
         }
 
+        // A dispatch stub of the site failed for this type. Check the type inline as well while the site has
+        // room for it, rather than leaving it to the hash lookup of the resolve stub.
+        if (patch && (stubKind == SK_DISPATCH) && bCreateDispatchStub)
+        {
+            TryExtendPolymorphicSite(pCallSite, objectType, token, target);
+        }
+
         // When we get here, target is where to go to
         // and patch is TRUE, telling us that we may have to back patch the call site with stub
         if (stub != CALL_STUB_EMPTY_ENTRY)
@@ -2455,7 +2476,7 @@ VirtualCallStubManager::TraceResolver(
 /* Change the call site.  It is failing the expected MT test in the dispatcher stub
 too often.
 */
-void VirtualCallStubManager::BackPatchWorker(StubCallSite* pCallSite)
+void VirtualCallStubManager::BackPatchWorker(StubCallSite* pCallSite, BOOL fCanExtendSite)
 {
     CONTRACTL {
         NOTHROW;
@@ -2467,20 +2488,26 @@ void VirtualCallStubManager::BackPatchWorker(StubCallSite* pCallSite)
 
     if (isDispatchingStub(callSiteTarget))
     {
-        DispatchHolder * dispatchHolder = DispatchHolder::FromDispatchEntry(callSiteTarget);
-        DispatchStub *   dispatchStub   = dispatchHolder->stub();
+        UINT32           typeCount;
+        DispatchStub *   dispatchStub   = GetLastDispatchStubInChain(callSiteTarget, &typeCount);
 
-        //yes, patch it to point to the resolve stub
-        //We can ignore the races now since we now know that the call site does go thru our
-        //stub mechanisms, hence no matter who wins the race, we are correct.
-        //We find the correct resolve stub by following the failure path in the dispatcher stub itself
+        //We find the correct resolve stub by following the failure path of the last dispatcher stub
         PCODE failEntry    = dispatchStub->failTarget();
         ResolveStub* resolveStub  = ResolveHolder::FromFailEntry(failEntry)->stub();
-        PCODE resolveEntry = resolveStub->resolveEntryPoint();
-        BackPatchSite(pCallSite, resolveEntry);
 
-        LOG((LF_STUBS, LL_INFO10000, "BackPatchWorker call-site" FMT_ADDR "dispatchStub" FMT_ADDR "\n",
-             DBG_ADDR(pCallSite->GetReturnAddress()), DBG_ADDR(dispatchHolder->stub())));
+        //Only give up on the inline type checks once the site checks as many types as it may.
+        //Until then our caller adds the type that missed to the site.
+        if (!fCanExtendSite || (typeCount >= s_maxPolymorphicTypes))
+        {
+            //yes, patch it to point to the resolve stub
+            //We can ignore the races now since we now know that the call site does go thru our
+            //stub mechanisms, hence no matter who wins the race, we are correct.
+            PCODE resolveEntry = resolveStub->resolveEntryPoint();
+            BackPatchSite(pCallSite, resolveEntry);
+
+            LOG((LF_STUBS, LL_INFO10000, "BackPatchWorker call-site" FMT_ADDR "dispatchStub" FMT_ADDR "\n",
+                 DBG_ADDR(pCallSite->GetReturnAddress()), DBG_ADDR(callSiteTarget)));
+        }
 
         //Add back the default miss count to the counter being used by this resolve stub
         //Since resolve stub are shared among many dispatch stubs each dispatch stub
@@ -2491,6 +2518,141 @@ void VirtualCallStubManager::BackPatchWorker(StubCallSite* pCallSite)
     }
 }
 
+//----------------------------------------------------------------------------
+DispatchStub *VirtualCallStubManager::GetLastDispatchStubInChain(PCODE dispatchEntry, UINT32 *pTypeCount)
+{
+    CONTRACTL {
+        NOTHROW;
+        GC_NOTRIGGER;
+        FORBID_FAULT;
+        PRECONDITION(isDispatchingStub(dispatchEntry));
+        PRECONDITION(CheckPointer(pTypeCount));
+    } CONTRACTL_END
+
+    DispatchStub * dispatchStub = DispatchHolder::FromDispatchEntry(dispatchEntry)->stub();
+    UINT32         typeCount    = 1;
+
+    while (isDispatchingStub(dispatchStub->failTarget()))
+    {
+        dispatchStub = DispatchHolder::FromDispatchEntry(dispatchStub->failTarget())->stub();
+        typeCount++;
+    }
+
+    *pTypeCount = typeCount;
+    return dispatchStub;
+}
+
+//----------------------------------------------------------------------------
+/* The call site failed its dispatch stubs for pMT. Generate a dispatch stub for pMT that fails over
+to the stub the call site points to now, and point the call site to it. These dispatch stubs are private
+to the call site, unlike the ones in the dispatchers table, which always fail over to the resolve stub.
+*/
+BOOL VirtualCallStubManager::TryExtendPolymorphicSite(StubCallSite* pCallSite,
+                                                      MethodTable*  pMT,
+                                                      DispatchToken token,
+                                                      PCODE         target)
+{
+    CONTRACTL {
+        THROWS;
+        GC_TRIGGERS;
+        MODE_COOPERATIVE;
+        INJECT_FAULT(COMPlusThrowOM(););
+        PRECONDITION(CheckPointer(pCallSite));
+        PRECONDITION(CheckPointer(pMT));
+        PRECONDITION(target != NULL);
+    } CONTRACTL_END
+
+    PCODE prior = pCallSite->GetSiteTarget();
+
+    // The site may have become megamorphic in the meantime
+    if (!isDispatchingStub(prior))
+    {
+        return FALSE;
+    }
+
+    UINT32 typeCount = 0;
+    for (PCODE entry = prior; isDispatchingStub(entry); typeCount++)
+    {
+        DispatchStub * dispatchStub = DispatchHolder::FromDispatchEntry(entry)->stub();
+        if (dispatchStub->expectedMT() == (size_t)pMT)
+        {
+            // Another thread already added the type
+            return FALSE;
+        }
+
+        entry = dispatchStub->failTarget();
+    }
+
+    if (typeCount >= s_maxPolymorphicTypes)
+    {
+        return FALSE;
+    }
+
+    bool reenteredCooperativeGCMode = false;
+    DispatchHolder * pDispatchHolder = GenerateDispatchStub(
+        target, prior, pMT, token.To_SIZE_T(), &reenteredCooperativeGCMode);
+    PCODE stub = pDispatchHolder->stub()->entryPoint();
+
+    // If another thread changed the site meanwhile, keep its change. The new stub just goes unused.
+    if (InterlockedCompareExchangeT(pCallSite->GetIndirectCell(), stub, prior) != prior)
+    {
+        return FALSE;
+    }
+
+    stats.site_write++;
+    stats.site_write_pic++;
+
+    LOG((LF_STUBS, LL_INFO10000, "TryExtendPolymorphicSite call-site" FMT_ADDR "dispatchStub" FMT_ADDR "types %d\n",
+         DBG_ADDR(pCallSite->GetReturnAddress()), DBG_ADDR(stub), typeCount + 1));
+
+    ReportSiteTransition(pCallSite, prior, stub);
+    return TRUE;
+}
+
+//----------------------------------------------------------------------------
+void VirtualCallStubManager::ReportSiteTransition(StubCallSite* pCallSite, PCODE prior, PCODE stub)
+{
+    CONTRACTL {
+        NOTHROW;
+        GC_NOTRIGGER;
+        FORBID_FAULT;
+    } CONTRACTL_END
+
+    if (!ETW_EVENT_ENABLED(MICROSOFT_WINDOWS_DOTNETRUNTIME_PROVIDER_DOTNET_Context, VirtualStubDispatchSiteTransition))
+    {
+        return;
+    }
+
+    UINT32    typeCount  = 0;
+    SiteShape priorShape = SS_LOOKUP;
+    if (isDispatchingStub(prior))
+    {
+        GetLastDispatchStubInChain(prior, &typeCount);
+        priorShape = (typeCount > 1) ? SS_POLYMORPHIC : SS_MONOMORPHIC;
+    }
+    else if (isResolvingStub(prior))
+    {
+        priorShape = SS_MEGAMORPHIC;
+    }
+
+    // Sites are only ever patched to dispatch or resolve stubs
+    StubKind  stubKind = SK_RESOLVE;
+    SiteShape shape    = SS_MEGAMORPHIC;
+    if (isDispatchingStub(stub))
+    {
+        stubKind = SK_DISPATCH;
+        GetLastDispatchStubInChain(stub, &typeCount);
+        shape = (typeCount > 1) ? SS_POLYMORPHIC : SS_MONOMORPHIC;
+    }
+
+    FireEtwVirtualStubDispatchSiteTransition((const void *)pCallSite->GetIndirectCell(),
+                                             (ULONGLONG)GetTokenFromStubQuick(this, stub, stubKind),
+                                             (USHORT)priorShape,
+                                             (USHORT)shape,
+                                             (USHORT)typeCount,
+                                             GetClrInstanceId());
+}
+
 //----------------------------------------------------------------------------
 /* consider changing the call site to point to stub, if appropriate do it
 */
@@ -2541,6 +2703,8 @@ void VirtualCallStubManager::BackPatchSite(StubCallSite* pCallSite, PCODE stub)
     pCallSite->SetSiteTarget(patch);
 
     stats.site_write++;
+
+    ReportSiteTransition(pCallSite, prior, patch);
 }
 
 //----------------------------------------------------------------------------
@@ -2972,6 +3136,8 @@ void VirtualCallStubManager::LogStats()
         WriteFile (g_hStubLogFile, szPrintStr, (DWORD) strlen(szPrintStr), &dwWriteByte, NULL);
         sprintf_s(szPrintStr, ARRAY_SIZE(szPrintStr), OUTPUT_FORMAT_INT, "site_write_poly", stats.site_write_poly);
         WriteFile (g_hStubLogFile, szPrintStr, (DWORD) strlen(szPrintStr), &dwWriteByte, NULL);
+        sprintf_s(szPrintStr, ARRAY_SIZE(szPrintStr), OUTPUT_FORMAT_INT, "site_write_pic", stats.site_write_pic);
+        WriteFile (g_hStubLogFile, szPrintStr, (DWORD) strlen(szPrintStr), &dwWriteByte, NULL);
 
         sprintf_s(szPrintStr, ARRAY_SIZE(szPrintStr), "\r\nstub data\r\n");
         WriteFile (g_hStubLogFile, szPrintStr, (DWORD) strlen(szPrintStr), &dwWriteByte, NULL);
@@ -3014,6 +3180,7 @@ void VirtualCallStubManager::LogStats()
     g_site_write += stats.site_write;
     g_site_write_poly += stats.site_write_poly;
     g_site_write_mono += stats.site_write_mono;
+    g_site_write_pic += stats.site_write_pic;
     g_worker_call += stats.worker_call;
     g_worker_call_no_patch += stats.worker_call_no_patch;
     g_worker_collide_to_mono += stats.worker_collide_to_mono;
@@ -3029,6 +3196,7 @@ void VirtualCallStubManager::LogStats()
     stats.site_write = 0;
     stats.site_write_poly = 0;
     stats.site_write_mono = 0;
+    stats.site_write_pic = 0;
     stats.worker_call = 0;
     stats.worker_call_no_patch = 0;
     stats.worker_collide_to_mono = 0;
@@ -181,6 +181,9 @@ typedef VPTR(class VirtualCallStubManager) PTR_VirtualCallStubManager;
 //             seems unlikely).
 //         * Calls a resolve stub (Whenever a dispatch stub is created, it always has a corresponding resolve
 //             stub (but the resolve stubs are shared among many dispatch stubs).
+//     * Polymorphic dispatch: a chain of up to code:VirtualCallStubManager.s_maxPolymorphicTypes dispatch
+//         stubs private to one call site. Each one checks one Method Table and fails over to the next one,
+//         the last one fails over to the resolve stub like any other dispatch stub.
 //     * Resolve: see code:ResolveStub. This looks up the Method table in a process wide cache (see
 //         code:ResolveCacheElem, and if found, jumps to it. This code path is about 17 instructions long (so
 //         pretty fast, but certainly much slower than a normal call). If the method table is not found in
@@ -191,9 +194,14 @@ typedef VPTR(class VirtualCallStubManager) PTR_VirtualCallStubManager;
 //     * On first call they get updated into a dispatch stub. When this misses, it calls a resolve stub,
 //         which populates a resovle stub's cache, but does not update the call site' cell (thus it is still
 //         pointing at the dispatch cell.
-//     * After code:STUB_MISS_COUNT_VALUE misses, we update the call site's cell to point directly at the
-//         resolve stub (thus avoiding the overhead of the quick check that always seems to be failing and
-//         the miss count update).
+//     * Whenever a miss reaches code:VirtualCallStubManager.ResolveWorker, the type that missed is put in
+//         front of the call site's dispatch stubs (see code:VirtualCallStubManager.TryExtendPolymorphicSite),
+//         so that sites seeing a handful of types keep dispatching without a hash lookup.
+//     * After code:STUB_MISS_COUNT_VALUE misses on a site whose chain of dispatch stubs is full, we update
+//         the call site's cell to point directly at the resolve stub (thus avoiding the overhead of the quick
+//         checks that always seem to be failing and the miss count update).
+//
+// Every change of a call site's cell is reported by the VirtualStubDispatchSiteTransition event.
 //
 // QUESTION: What is the lifetimes of the various stubs and hash table entries?
 //
@@ -485,6 +493,14 @@ private:
                                          size_t dispatchToken,
                                          bool *pMayHaveReenteredCooperativeGCMode);
 
+    // Put a dispatch stub for pMT in front of the dispatch stubs the call site points to. Returns FALSE
+    // when the call site is not a dispatching site, or already checks pMT or s_maxPolymorphicTypes types.
+    BOOL TryExtendPolymorphicSite(StubCallSite* pCallSite, MethodTable* pMT, DispatchToken token, PCODE target);
+
+    // Follows the fail targets of a polymorphic call site to its last dispatch stub, whose fail target is
+    // the resolve stub. Returns the number of dispatch stubs in the chain in pTypeCount.
+    DispatchStub *GetLastDispatchStubInChain(PCODE dispatchEntry, UINT32 *pTypeCount);
+
 #ifdef TARGET_AMD64
     // Used to allocate a long jump dispatch stub. See comment around
     // m_fShouldAllocateLongJumpDispatchStubs for explanation.
@@ -596,11 +612,27 @@ private:
 
 public:
     PCODE ResolveWorker(StubCallSite* pCallSite, OBJECTREF *protectedObj, DispatchToken token, StubKind stubKind);
-    void BackPatchWorker(StubCallSite* pCallSite);
+    void BackPatchWorker(StubCallSite* pCallSite, BOOL fCanExtendSite);
 
     //Change the callsite to point to stub
     void BackPatchSite(StubCallSite* pCallSite, PCODE stub);
 
+private:
+    // The shapes of call sites reported by the VirtualStubDispatchSiteTransition event
+    enum SiteShape
+    {
+        SS_LOOKUP       = 0,
+        SS_MONOMORPHIC  = 1,
+        SS_POLYMORPHIC  = 2,
+        SS_MEGAMORPHIC  = 3,
+    };
+
+    // Fires the VirtualStubDispatchSiteTransition event for a call site that was changed from prior to stub
+    void ReportSiteTransition(StubCallSite* pCallSite, PCODE prior, PCODE stub);
+
+    // The number of types a polymorphic call site checks before it goes to the resolve stub
+    static UINT32 s_maxPolymorphicTypes;
+
 public:
     /* the following two public functions are to support tracing or stepping thru
     stubs via the debugger. */
@@ -800,6 +832,7 @@ public:
         UINT32 site_write;              //# of call site backpatch writes
         UINT32 site_write_poly;         //# of call site backpatch writes to point to resolve stubs
         UINT32 site_write_mono;         //# of call site backpatch writes to point to dispatch stubs
+        UINT32 site_write_pic;          //# of call site writes to add a type to a polymorphic site
         UINT32 worker_call;             //# of calls into ResolveWorker
         UINT32 worker_call_no_patch;    //# of times call_worker resulted in no patch
         UINT32 worker_collide_to_mono;  //# of times we converted a poly stub to a mono stub instead of writing the cache entry
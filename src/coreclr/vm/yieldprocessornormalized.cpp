@@ -27,6 +27,13 @@ static double s_nsPerYieldMeasurements[NsPerYieldMeasurementCount];
 static int s_nextMeasurementIndex;
 static double s_establishedNsPerYield = YieldProcessorNormalization::TargetNsPerNormalizedYield;
 
+// Lowest measurement of each processor, 0 when the processor has not been measured
+static double s_perProcessorNsPerYield[YieldProcessorNormalization::MaxPerProcessorNormalizationCount];
+
+// Processors are normalized separately once a processor's yields are measured to take at least this many times as long as the
+// established value, which is the lowest measured on any processor
+static const double PerProcessorNormalizationMinNsPerYieldRatio = 2;
+
 static unsigned int DetermineMeasureDurationUs()
 {
     CONTRACTL
@@ -108,6 +115,77 @@ static double MeasureNsPerYield(unsigned int measureDurationUs)
     return Max(MinNsPerYield, Min((double)elapsedTicks * NsPerS / ((double)yieldCount * ticksPerS), MaxNsPerYield));
 }
 
+static double MeasureNsPerYieldOnProcessor(unsigned int measureDurationUs, DWORD *processorNumberRef)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_PREEMPTIVE;
+    }
+    CONTRACTL_END;
+
+    // The measurement is attributed to a processor only if the thread appears to have run on that processor throughout
+    DWORD processorNumber = GetCurrentProcessorNumber();
+    double nsPerYield = MeasureNsPerYield(measureDurationUs);
+    *processorNumberRef = GetCurrentProcessorNumber() == processorNumber ? processorNumber : (DWORD)-1;
+    return nsPerYield;
+}
+
+static unsigned int CalculateYieldsPerNormalizedYield(double nsPerYield)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    // Calculate the number of yields required to span the duration of a normalized yield
+    unsigned int yieldsPerNormalizedYield =
+        Max(1u, (unsigned int)(YieldProcessorNormalization::TargetNsPerNormalizedYield / nsPerYield + 0.5));
+    _ASSERTE(yieldsPerNormalizedYield <= YieldProcessorNormalization::MaxYieldsPerNormalizedYield);
+    return yieldsPerNormalizedYield;
+}
+
+static unsigned int CalculateOptimalMaxNormalizedYieldsPerSpinIteration(double nsPerYield, unsigned int yieldsPerNormalizedYield)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    // Calculate the maximum number of yields that would be optimal for a late spin iteration. Typically, we would not want to
+    // spend excessive amounts of time (thousands of cycles) doing only YieldProcessor, as SwitchToThread/Sleep would do a
+    // better job of allowing other work to run.
+    unsigned int optimalMaxNormalizedYieldsPerSpinIteration =
+        Max(1u,
+            (unsigned int)(YieldProcessorNormalization::TargetMaxNsPerSpinIteration / (yieldsPerNormalizedYield * nsPerYield) + 0.5));
+    _ASSERTE(
+        optimalMaxNormalizedYieldsPerSpinIteration <= YieldProcessorNormalization::MaxOptimalMaxNormalizedYieldsPerSpinIteration);
+    return optimalMaxNormalizedYieldsPerSpinIteration;
+}
+
+void YieldProcessorNormalization::RecordPerProcessorMeasurement(DWORD processorNumber, double nsPerYield)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_PREEMPTIVE;
+    }
+    CONTRACTL_END;
+
+    if (processorNumber >= MaxPerProcessorNormalizationCount)
+    {
+        return;
+    }
+
+    double previousNsPerYield = s_perProcessorNsPerYield[processorNumber];
+    if (previousNsPerYield != 0 && previousNsPerYield <= nsPerYield)
+    {
+        return;
+    }
+    s_perProcessorNsPerYield[processorNumber] = nsPerYield;
+
+    unsigned int yieldsPerNormalizedYield = CalculateYieldsPerNormalizedYield(nsPerYield);
+    unsigned int optimalMaxNormalizedYieldsPerSpinIteration =
+        CalculateOptimalMaxNormalizedYieldsPerSpinIteration(nsPerYield, yieldsPerNormalizedYield);
+    s_perProcessorNormalization[processorNumber] = yieldsPerNormalizedYield | (optimalMaxNormalizedYieldsPerSpinIteration << 16);
+}
+
 void YieldProcessorNormalization::PerformMeasurement()
 {
     CONTRACTL
@@ -129,7 +207,9 @@ void YieldProcessorNormalization::PerformMeasurement()
         }
 
         int nextMeasurementIndex = s_nextMeasurementIndex;
-        latestNsPerYield = MeasureNsPerYield(DetermineMeasureDurationUs());
+        DWORD processorNumber;
+        latestNsPerYield = MeasureNsPerYieldOnProcessor(DetermineMeasureDurationUs(), &processorNumber);
+        RecordPerProcessorMeasurement(processorNumber, latestNsPerYield);
         AtomicStore(&s_nsPerYieldMeasurements[nextMeasurementIndex], latestNsPerYield);
         if (++nextMeasurementIndex >= NsPerYieldMeasurementCount)
         {
@@ -151,7 +231,9 @@ void YieldProcessorNormalization::PerformMeasurement()
         unsigned int measureDurationUs = DetermineMeasureDurationUs();
         for (int i = 0; i < NsPerYieldMeasurementCount; ++i)
         {
-            latestNsPerYield = MeasureNsPerYield(measureDurationUs);
+            DWORD processorNumber;
+            latestNsPerYield = MeasureNsPerYieldOnProcessor(measureDurationUs, &processorNumber);
+            RecordPerProcessorMeasurement(processorNumber, latestNsPerYield);
             AtomicStore(&s_nsPerYieldMeasurements[i], latestNsPerYield);
             if (i == 0 || latestNsPerYield < s_establishedNsPerYield)
             {
@@ -186,18 +268,26 @@ void YieldProcessorNormalization::PerformMeasurement()
 
     FireEtwYieldProcessorMeasurement(GetClrInstanceId(), latestNsPerYield, s_establishedNsPerYield);
 
-    // Calculate the number of yields required to span the duration of a normalized yield
-    unsigned int yieldsPerNormalizedYield = Max(1u, (unsigned int)(TargetNsPerNormalizedYield / establishedNsPerYield + 0.5));
-    _ASSERTE(yieldsPerNormalizedYield <= MaxYieldsPerNormalizedYield);
+    unsigned int yieldsPerNormalizedYield = CalculateYieldsPerNormalizedYield(establishedNsPerYield);
     s_yieldsPerNormalizedYield = yieldsPerNormalizedYield;
-
-    // Calculate the maximum number of yields that would be optimal for a late spin iteration. Typically, we would not want to
-    // spend excessive amounts of time (thousands of cycles) doing only YieldProcessor, as SwitchToThread/Sleep would do a
-    // better job of allowing other work to run.
     s_optimalMaxNormalizedYieldsPerSpinIteration =
-        Max(1u, (unsigned int)(TargetMaxNsPerSpinIteration / (yieldsPerNormalizedYield * establishedNsPerYield) + 0.5));
-    _ASSERTE(s_optimalMaxNormalizedYieldsPerSpinIteration <= MaxOptimalMaxNormalizedYieldsPerSpinIteration);
+        CalculateOptimalMaxNormalizedYieldsPerSpinIteration(establishedNsPerYield, yieldsPerNormalizedYield);
+
+    // The established value is the lowest measured on any processor. Processors that take much longer per yield would spin for
+    // too long with it, so switch to per-processor values once such a processor is found.
+    if (!s_hasPerProcessorNormalization)
+    {
+        for (unsigned int i = 0; i < MaxPerProcessorNormalizationCount; ++i)
+        {
+            if (s_perProcessorNsPerYield[i] >= establishedNsPerYield * PerProcessorNormalizationMinNsPerYieldRatio)
+            {
+                s_hasPerProcessorNormalization = true;
+                break;
+            }
+        }
+    }
 
+    // The GC only supports one scaling factor, it uses the one for the processors with the lowest latency as before
     GCHeapUtilities::GetGCHeap()->SetYieldProcessorScalingFactor((float)yieldsPerNormalizedYield);
 
     s_previousNormalizationTimeMs = GetTickCount();
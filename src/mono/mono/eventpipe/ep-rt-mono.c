@@ -5,7 +5,12 @@
 #include <eventpipe/ep-types.h>
 #include <eventpipe/ep-rt.h>
 #include <eventpipe/ep.h>
+#include <eventpipe/ep-counters.h>
 #include <eventpipe/ep-event.h>
+#include <eventpipe/ep-provider.h>
+#include <eventpipe/ep-sample-profiler.h>
+#include <eventpipe/ep-session.h>
+#include <eventpipe/ep-thread.h>
 
 #include <eglib/gmodule.h>
 #include <mono/utils/mono-lazy-init.h>
@@ -20,6 +25,7 @@
 #include <mono/metadata/class-internals.h>
 #include <mono/metadata/debug-internals.h>
 #include <mono/metadata/gc-internals.h>
+#include <mono/metadata/mono-gc.h>
 #include <mono/metadata/profiler-private.h>
 #include <mono/metadata/cil-coff.h>
 #include <mono/metadata/mono-endian.h>
@@ -31,6 +37,20 @@
 #include <runtime_version.h>
 #include <clretwallmain.h>
 
+#if defined(HOST_LINUX) && !defined(HOST_ANDROID)
+#include <signal.h>
+#include <time.h>
+#include <mono/utils/hazard-pointer.h>
+#include <mono/utils/mono-errno.h>
+#include <mono/utils/mono-signal-handler.h>
+#ifdef SIGEV_THREAD_ID
+#define EP_RT_MONO_SIGNAL_SAMPLING
+#ifndef sigev_notify_thread_id
+#define sigev_notify_thread_id _sigev_un._tid
+#endif
+#endif
+#endif
+
 extern void InitProvidersAndEvents (void);
 
 // EventPipe rt init state.
@@ -137,8 +157,46 @@ typedef struct _EventPipeFireMethodEventsData {
 	uint8_t *buffer;
 	size_t buffer_size;
 	ep_rt_mono_fire_method_rundown_events_func method_events_func;
+	// Session the rundown is written to, methods whose load events already reached it are skipped.
+	uint64_t session_mask;
+	ep_timestamp_t session_start_timestamp;
+	// Methods are split between rundown threads by code address.
+	uint32_t partition;
+	uint32_t partition_count;
 } EventPipeFireMethodEventsData;
 
+typedef struct _EventPipeRundownWorkerData {
+	EventPipeFireMethodEventsData events_data;
+	EventPipeSession *session;
+	ep_rt_wait_event_handle_t done_event;
+	// Only written by the thread that starts the worker.
+	bool created;
+	// Only written by the worker, read once done_event is set.
+	bool fired;
+} EventPipeRundownWorkerData;
+
+// Load of a method written to the sessions in session_mask, lets rundown of those sessions skip it.
+typedef struct _EventPipeMethodLoadRecord {
+	uint64_t code_start;
+	uint64_t session_mask;
+	ep_timestamp_t timestamp;
+	bool verbose;
+} EventPipeMethodLoadRecord;
+
+// Event ids of MethodLoad_V1 and MethodLoadVerbose_V1 in the runtime provider.
+#define METHOD_LOAD_EVENT_ID 141
+#define METHOD_LOAD_VERBOSE_EVENT_ID 143
+
+static EventPipeEvent *_ep_rt_mono_method_load_event = NULL;
+static EventPipeEvent *_ep_rt_mono_method_load_verbose_event = NULL;
+
+// MonoJitInfo * -> EventPipeMethodLoadRecord *.
+static GHashTable *_ep_rt_mono_method_load_records = NULL;
+static ep_rt_spin_lock_handle_t _ep_rt_mono_method_load_records_lock = {0};
+
+// Upper bound of threads used by rundown, unless overridden by DOTNET_EventPipeRundownThreads.
+#define RUNDOWN_MAX_DEFAULT_THREAD_COUNT 4
+
 typedef struct _EventPipeStackWalkData {
 	EventPipeStackContents *stack_contents;
 	bool top_frame;
@@ -155,6 +213,40 @@ typedef struct _EventPipeSampleProfileStackWalkData {
 	uint32_t payload_data;
 } EventPipeSampleProfileStackWalkData;
 
+#ifdef EP_RT_MONO_SIGNAL_SAMPLING
+// Samples a thread can hold before the sampling thread drains them.
+#define SIGNAL_SAMPLED_THREAD_RING_SIZE 4
+
+typedef enum {
+	SIGNAL_SAMPLED_THREAD_STATE_FREE = 0,
+	SIGNAL_SAMPLED_THREAD_STATE_REGISTERING = 1,
+	SIGNAL_SAMPLED_THREAD_STATE_ACTIVE = 2
+} EventPipeSignalSampledThreadState;
+
+// Sampling state of a thread sampled by its own timer signal. Samples are written by the thread
+// from the signal handler and read by the sampling thread, a single producer/consumer ring.
+typedef struct _EventPipeSignalSampledThread EventPipeSignalSampledThread;
+struct _EventPipeSignalSampledThread {
+	EventPipeSampleProfileStackWalkData samples [SIGNAL_SAMPLED_THREAD_RING_SIZE];
+	EventPipeSignalSampledThread *next;
+	MonoNativeThreadId thread_id;
+	timer_t timer;
+	volatile gint32 state;
+	volatile gint32 os_thread_id;
+	volatile gint32 write_index;
+	volatile gint32 read_index;
+	uint32_t epoch;
+	bool timer_created;
+};
+
+static bool _ep_rt_mono_signal_sampling_initialized = false;
+static int _ep_rt_mono_signal_sampling_signal = -1;
+static volatile gint32 _ep_rt_mono_signal_sampling_enabled = 0;
+static uint32_t _ep_rt_mono_signal_sampling_epoch = 0;
+static EventPipeSignalSampledThread *_ep_rt_mono_signal_sampled_threads = NULL;
+static GHashTable *_ep_rt_mono_signal_sampled_thread_map = NULL;
+#endif
+
 // Rundown flags.
 #define RUNTIME_SKU_MONO 0x4
 #define METHOD_FLAGS_DYNAMIC_METHOD 0x1
@@ -371,6 +463,43 @@ eventpipe_fire_method_events_func (
 	MonoJitInfo *ji,
 	void *user_data);
 
+static
+void
+eventpipe_fire_partition_method_events (EventPipeFireMethodEventsData *events_data);
+
+static
+void
+method_load_record_add (
+	MonoJitInfo *ji,
+	bool verbose);
+
+static
+bool
+method_load_record_is_emitted (
+	MonoJitInfo *ji,
+	const EventPipeFireMethodEventsData *events_data,
+	bool verbose);
+
+static
+void
+method_load_records_remove_session (uint64_t session_mask);
+
+static
+int64_t
+counter_read_gc_heap_size (void);
+
+static
+int64_t
+counter_read_gen_0_gc_count (void);
+
+static
+int64_t
+counter_read_methods_jitted_count (void);
+
+static
+int64_t
+counter_read_exception_count (void);
+
 static
 void
 eventpipe_fire_assembly_events (
@@ -406,6 +535,20 @@ eventpipe_sample_profiler_walk_managed_stack_for_thread_func (
 	MonoContext *ctx,
 	void *data);
 
+static
+void
+sample_profiler_walk_thread_state (
+	MonoThreadUnwindState *thread_state,
+	EventPipeSampleProfileStackWalkData *data);
+
+static
+void
+sample_profiler_write_sample (
+	ep_rt_thread_handle_t sampling_thread,
+	EventPipeEvent *sampling_event,
+	THREAD_INFO_TYPE *adapter,
+	EventPipeSampleProfileStackWalkData *data);
+
 static
 void
 profiler_eventpipe_runtime_initialized (MonoProfiler *prof);
@@ -558,6 +701,14 @@ runtime_profiler_jit_code_buffer (
 	MonoProfilerCodeBufferType type,
 	const void *data);
 
+static
+void
+runtime_profiler_gc_event (
+	MonoProfiler *prof,
+	MonoProfilerGCEvent gc_event,
+	uint32_t generation,
+	mono_bool serial);
+
 static
 void
 mono_profiler_get_class_data (
@@ -1569,12 +1720,143 @@ eventpipe_fire_method_events_func (
 	EP_ASSERT (events_data != NULL);
 
 	if (ji && !ji->is_trampoline && !ji->async) {
+		// Every rundown thread walks the whole table, but only formats the methods of its partition.
+		if (events_data->partition_count > 1 && ((((uintptr_t)ji->code_start) >> 4) % events_data->partition_count) != events_data->partition)
+			return;
+
+		bool verbose = (MICROSOFT_WINDOWS_DOTNETRUNTIME_RUNDOWN_PROVIDER_EVENTPIPE_Context.Level >= (uint8_t)EP_EVENT_LEVEL_VERBOSE);
+		if (method_load_record_is_emitted (ji, events_data, verbose))
+			return;
+
 		MonoMethod *method = jinfo_get_method (ji);
 		if (include_method (method))
 			eventpipe_fire_method_events (ji, method, events_data);
 	}
 }
 
+static
+void
+eventpipe_fire_partition_method_events (EventPipeFireMethodEventsData *events_data)
+{
+	EP_ASSERT (events_data != NULL);
+
+	// All called JIT/AOT methods should be included in jit info table.
+	mono_jit_info_table_foreach_internal (eventpipe_fire_method_events_func, events_data);
+
+	// All called interpreted methods should be included in interpreter jit info table.
+	if (mono_get_runtime_callbacks ()->is_interpreter_enabled())
+		mono_get_runtime_callbacks ()->interp_jit_info_foreach (eventpipe_fire_method_events_func, events_data);
+}
+
+EP_RT_DEFINE_THREAD_FUNC (rundown_worker_thread)
+{
+	EP_ASSERT (data != NULL);
+	if (data == NULL)
+		return 1;
+
+	ep_rt_thread_params_t *thread_params = (ep_rt_thread_params_t *)data;
+	EventPipeRundownWorkerData *worker_data = (EventPipeRundownWorkerData *)thread_params->thread_params;
+
+	// Events written by a rundown thread only go to the session being rundown.
+	EventPipeThread *thread = ep_thread_get_or_create ();
+	if (thread) {
+		ep_thread_set_as_rundown_thread (thread, worker_data->session);
+		eventpipe_fire_partition_method_events (&worker_data->events_data);
+		ep_thread_set_as_rundown_thread (thread, NULL);
+		worker_data->fired = true;
+	}
+
+	// If the partition wasn't fired, the rundown thread takes it once done_event is set.
+	ep_rt_wait_event_set (&worker_data->done_event);
+	return (ep_rt_thread_start_func_return_t)0;
+}
+
+static
+uint32_t
+rundown_get_thread_count (void)
+{
+	uint32_t thread_count = ep_rt_processors_get_count ();
+	if (thread_count > RUNDOWN_MAX_DEFAULT_THREAD_COUNT)
+		thread_count = RUNDOWN_MAX_DEFAULT_THREAD_COUNT;
+
+	gchar *value = g_getenv ("DOTNET_EventPipeRundownThreads");
+	if (value && atoi (value) > 0)
+		thread_count = (uint32_t)atoi (value);
+	g_free (value);
+
+	return thread_count > 0 ? thread_count : 1;
+}
+
+static
+void
+method_load_record_add (
+	MonoJitInfo *ji,
+	bool verbose)
+{
+	EventPipeEvent *load_event = verbose ? _ep_rt_mono_method_load_verbose_event : _ep_rt_mono_method_load_event;
+	if (!ji || !load_event || !_ep_rt_mono_method_load_records)
+		return;
+
+	uint64_t session_mask = (uint64_t)ep_rt_volatile_load_int64_t (ep_event_get_enabled_mask_cref (load_event));
+	if (!session_mask)
+		return;
+
+	EventPipeMethodLoadRecord *record = g_new (EventPipeMethodLoadRecord, 1);
+	record->code_start = (uint64_t)ji->code_start;
+	record->session_mask = session_mask;
+	record->timestamp = ep_perf_timestamp_get ();
+	record->verbose = verbose;
+
+	ep_rt_spin_lock_acquire (&_ep_rt_mono_method_load_records_lock);
+	g_hash_table_replace (_ep_rt_mono_method_load_records, ji, record);
+	ep_rt_spin_lock_release (&_ep_rt_mono_method_load_records_lock);
+}
+
+static
+bool
+method_load_record_is_emitted (
+	MonoJitInfo *ji,
+	const EventPipeFireMethodEventsData *events_data,
+	bool verbose)
+{
+	if (!events_data->session_mask || !_ep_rt_mono_method_load_records)
+		return false;
+
+	bool emitted = false;
+
+	ep_rt_spin_lock_acquire (&_ep_rt_mono_method_load_records_lock);
+	EventPipeMethodLoadRecord *record = (EventPipeMethodLoadRecord *)g_hash_table_lookup (_ep_rt_mono_method_load_records, ji);
+	// A session index can be reused, only loads written after the session started count. A non verbose load
+	// lacks the method names a verbose rundown would add.
+	if (record && record->code_start == (uint64_t)ji->code_start && (record->session_mask & events_data->session_mask) &&
+		record->timestamp >= events_data->session_start_timestamp && (record->verbose || !verbose))
+		emitted = true;
+	ep_rt_spin_lock_release (&_ep_rt_mono_method_load_records_lock);
+
+	return emitted;
+}
+
+static
+void
+method_load_records_remove_session (uint64_t session_mask)
+{
+	if (!session_mask || !_ep_rt_mono_method_load_records)
+		return;
+
+	GHashTableIter iter;
+	gpointer value;
+
+	ep_rt_spin_lock_acquire (&_ep_rt_mono_method_load_records_lock);
+	g_hash_table_iter_init (&iter, _ep_rt_mono_method_load_records);
+	while (g_hash_table_iter_next (&iter, NULL, &value)) {
+		EventPipeMethodLoadRecord *record = (EventPipeMethodLoadRecord *)value;
+		record->session_mask &= ~session_mask;
+		if (!record->session_mask)
+			g_hash_table_iter_remove (&iter);
+	}
+	ep_rt_spin_lock_release (&_ep_rt_mono_method_load_records_lock);
+}
+
 static
 void
 eventpipe_fire_assembly_events (
@@ -1646,17 +1928,60 @@ eventpipe_execute_rundown (
 
 		// Emit all functions in use (JIT, AOT and Interpreter).
 		EventPipeFireMethodEventsData events_data;
+		memset (&events_data, 0, sizeof (events_data));
 		events_data.domain = root_domain;
 		events_data.buffer_size = 1024 * sizeof(uint32_t);
 		events_data.buffer = g_new (uint8_t, events_data.buffer_size);
 		events_data.method_events_func = method_events_func;
+		events_data.partition_count = 1;
+
+		// Rundown runs on a thread marked with the session it is written to.
+		EventPipeThread *current_thread = ep_thread_get ();
+		EventPipeSession *session = current_thread ? ep_thread_get_rundown_session (current_thread) : NULL;
+		if (session) {
+			events_data.session_mask = ep_session_get_mask (session);
+			events_data.session_start_timestamp = ep_session_get_session_start_timestamp (session);
+		}
+
+		// Formatting method names and IL maps dominates rundown of large applications, split it between threads.
+		uint32_t worker_count = session ? rundown_get_thread_count () - 1 : 0;
+		EventPipeRundownWorkerData *workers = worker_count > 0 ? g_new0 (EventPipeRundownWorkerData, worker_count) : NULL;
+		if (!workers)
+			worker_count = 0;
+
+		events_data.partition_count = worker_count + 1;
+		for (uint32_t i = 0; i < worker_count; ++i) {
+			EventPipeRundownWorkerData *worker_data = &workers [i];
+			worker_data->events_data = events_data;
+			worker_data->events_data.partition = i + 1;
+			worker_data->events_data.buffer = g_new (uint8_t, events_data.buffer_size);
+			worker_data->session = session;
+			ep_rt_wait_event_alloc (&worker_data->done_event, true, false);
+
+			ep_rt_thread_id_t thread_id = 0;
+			worker_data->created = ep_rt_wait_event_is_valid (&worker_data->done_event) &&
+				ep_rt_thread_create ((void *)rundown_worker_thread, worker_data, EP_THREAD_TYPE_SESSION, &thread_id);
+		}
+
+		eventpipe_fire_partition_method_events (&events_data);
+
+		for (uint32_t i = 0; i < worker_count; ++i) {
+			EventPipeRundownWorkerData *worker_data = &workers [i];
+			if (worker_data->created)
+				ep_rt_wait_event_wait (&worker_data->done_event, EP_INFINITE_WAIT, false);
 
-		// All called JIT/AOT methods should be included in jit info table.
-		mono_jit_info_table_foreach_internal (eventpipe_fire_method_events_func, &events_data);
+			// Partitions of workers that didn't run are done here.
+			if (!worker_data->created || !worker_data->fired)
+				eventpipe_fire_partition_method_events (&worker_data->events_data);
 
-		// All called interpreted methods should be included in interpreter jit info table.
-		if (mono_get_runtime_callbacks ()->is_interpreter_enabled())
-			mono_get_runtime_callbacks ()->interp_jit_info_foreach (eventpipe_fire_method_events_func, &events_data);
+			g_free (worker_data->events_data.buffer);
+			ep_rt_wait_event_free (&worker_data->done_event);
+		}
+
+		g_free (workers);
+
+		// The session is stopping, its load records are no longer needed.
+		method_load_records_remove_session (events_data.session_mask);
 
 		// Phantom methods injected in callstacks representing runtime functions.
 		if (_ep_rt_mono_runtime_helper_compile_method_jitinfo && _ep_rt_mono_runtime_helper_compile_method)
@@ -1981,6 +2306,9 @@ ep_rt_mono_init (void)
 
 	ep_rt_spin_lock_alloc (&_ep_rt_mono_profiler_gc_state_lock);
 
+	ep_rt_spin_lock_alloc (&_ep_rt_mono_method_load_records_lock);
+	_ep_rt_mono_method_load_records = g_hash_table_new_full (NULL, NULL, NULL, g_free);
+
 	mono_profiler_set_runtime_initialized_callback (_ep_rt_default_profiler, profiler_eventpipe_runtime_initialized);
 	mono_profiler_set_thread_stopped_callback (_ep_rt_default_profiler, profiler_eventpipe_thread_exited);
 
@@ -2103,6 +2431,14 @@ ep_rt_mono_fini (void)
 
 	ep_rt_spin_lock_free (&_ep_rt_mono_profiler_gc_state_lock);
 
+	if (_ep_rt_mono_method_load_records)
+		g_hash_table_destroy (_ep_rt_mono_method_load_records);
+	_ep_rt_mono_method_load_records = NULL;
+	ep_rt_spin_lock_free (&_ep_rt_mono_method_load_records_lock);
+
+	_ep_rt_mono_method_load_event = NULL;
+	_ep_rt_mono_method_load_verbose_event = NULL;
+
 	_ep_rt_mono_sampled_thread_callstacks = NULL;
 	_ep_rt_mono_rand_provider = NULL;
 	_ep_rt_mono_initialized = FALSE;
@@ -2640,10 +2976,51 @@ ep_rt_mono_os_environment_get_utf16 (ep_rt_env_array_utf16_t *env_array)
 #endif
 }
 
+static
+int64_t
+counter_read_gc_heap_size (void)
+{
+	return mono_gc_get_used_size ();
+}
+
+static
+int64_t
+counter_read_gen_0_gc_count (void)
+{
+	return mono_gc_collection_count (0);
+}
+
+static
+int64_t
+counter_read_methods_jitted_count (void)
+{
+	return mono_atomic_load_i32 (&mono_jit_stats.methods_compiled);
+}
+
+static
+int64_t
+counter_read_exception_count (void)
+{
+	return mono_get_exception_count ();
+}
+
 void
 ep_rt_mono_init_providers_and_events (void)
 {
 	InitProvidersAndEvents ();
+
+	// Method loads written while a session is running don't need to be repeated by its rundown.
+	EventPipeProvider *runtime_provider = ep_get_provider (ep_config_get_public_provider_name_utf8 ());
+	if (runtime_provider) {
+		_ep_rt_mono_method_load_event = ep_provider_find_event (runtime_provider, METHOD_LOAD_EVENT_ID, 1);
+		_ep_rt_mono_method_load_verbose_event = ep_provider_find_event (runtime_provider, METHOD_LOAD_VERBOSE_EVENT_ID, 1);
+	}
+
+	// Native counters, read by the counters thread when a session samples them.
+	ep_counter_register ("gc-heap-size", EP_COUNTER_TYPE_GAUGE, counter_read_gc_heap_size);
+	ep_counter_register ("gen-0-gc-count", EP_COUNTER_TYPE_INCREMENTING, counter_read_gen_0_gc_count);
+	ep_counter_register ("methods-jitted-count", EP_COUNTER_TYPE_INCREMENTING, counter_read_methods_jitted_count);
+	ep_counter_register ("exception-count", EP_COUNTER_TYPE_INCREMENTING, counter_read_exception_count);
 }
 
 void
@@ -2755,13 +3132,294 @@ ep_rt_mono_method_get_full_name (
 	return true;
 }
 
+static
+void
+sample_profiler_walk_thread_state (
+	MonoThreadUnwindState *thread_state,
+	EventPipeSampleProfileStackWalkData *data)
+{
+	data->payload_data = EP_SAMPLE_PROFILER_SAMPLE_TYPE_ERROR;
+	data->stack_walk_data.stack_contents = &data->stack_contents;
+	data->stack_walk_data.top_frame = true;
+	data->stack_walk_data.async_frame = false;
+	data->stack_walk_data.safe_point_frame = false;
+	data->stack_walk_data.runtime_invoke_frame = false;
+	ep_stack_contents_reset (&data->stack_contents);
+	if (thread_state->valid)
+		mono_get_eh_callbacks ()->mono_walk_stack_with_state (eventpipe_sample_profiler_walk_managed_stack_for_thread_func, thread_state, MONO_UNWIND_SIGNAL_SAFE, data);
+	if (data->payload_data == EP_SAMPLE_PROFILER_SAMPLE_TYPE_EXTERNAL && (data->stack_walk_data.safe_point_frame || data->stack_walk_data.runtime_invoke_frame)) {
+		// If classified as external code (managed->native frame on top of stack), but have a safe point or runtime invoke frame
+		// as second, re-classify current callstack to be executing managed code.
+		data->payload_data = EP_SAMPLE_PROFILER_SAMPLE_TYPE_MANAGED;
+	}
+	if (data->stack_walk_data.top_frame && ep_stack_contents_get_length (&data->stack_contents) == 0) {
+		// If no managed frames (including helper frames) are located on stack, mark sample as beginning in external code.
+		// This can happen on attached embedding threads returning to native code between runtime invokes.
+		// Make sure sample is still written into EventPipe for all attached threads even if they are currently not having
+		// any managed frames on stack. Prevents some tools applying thread time heuristics to prolong duration of last sample
+		// when embedding thread returns to native code. It also opens ability to visualize number of samples in unmanaged code
+		// on attached threads when executing outside of runtime. If tooling is not interested in these sample events, they are easy
+		// to identify and filter out.
+		data->payload_data = EP_SAMPLE_PROFILER_SAMPLE_TYPE_EXTERNAL;
+	}
+}
+
+static
+void
+sample_profiler_write_sample (
+	ep_rt_thread_handle_t sampling_thread,
+	EventPipeEvent *sampling_event,
+	THREAD_INFO_TYPE *adapter,
+	EventPipeSampleProfileStackWalkData *data)
+{
+	if ((data->stack_walk_data.top_frame && data->payload_data == EP_SAMPLE_PROFILER_SAMPLE_TYPE_EXTERNAL) || (data->payload_data != EP_SAMPLE_PROFILER_SAMPLE_TYPE_ERROR && ep_stack_contents_get_length (&data->stack_contents) > 0)) {
+		// Check if we have an async frame, if so we will need to make sure all frames are registered in regular jit info table.
+		// TODO: An async frame can contain wrapper methods (no way to check during stackwalk), we could skip writing profile event
+		// for this specific stackwalk or we could cleanup stack_frames before writing profile event.
+		if (data->stack_walk_data.async_frame) {
+			for (uint32_t frame_count = 0; frame_count < data->stack_contents.next_available_frame; ++frame_count)
+				mono_jit_info_table_find_internal ((gpointer)data->stack_contents.stack_frames [frame_count], TRUE, FALSE);
+		}
+		mono_thread_info_set_tid (adapter, ep_rt_uint64_t_to_thread_id_t (data->thread_id));
+		uint32_t payload_data = ep_rt_val_uint32_t (data->payload_data);
+		ep_write_sample_profile_event (sampling_thread, sampling_event, adapter, &data->stack_contents, (uint8_t *)&payload_data, sizeof (payload_data));
+	}
+}
+
+#ifdef EP_RT_MONO_SIGNAL_SAMPLING
+static
+void
+sample_profiler_signal_sample_current_thread (
+	EventPipeSignalSampledThread *sampled_thread,
+	void *sigctx)
+{
+	if (!sampled_thread || !mono_atomic_load_i32 (&_ep_rt_mono_signal_sampling_enabled))
+		return;
+
+	// The first signal a thread gets is sent by the sampling thread to learn its kernel thread id,
+	// needed to direct the sampling timer at it.
+	gint32 os_thread_id = (gint32)mono_native_thread_os_id_get ();
+	gint32 state = mono_atomic_load_i32 (&sampled_thread->state);
+	if (state == SIGNAL_SAMPLED_THREAD_STATE_REGISTERING && mono_native_thread_id_equals (sampled_thread->thread_id, mono_native_thread_id_get ()))
+		mono_atomic_cas_i32 (&sampled_thread->os_thread_id, os_thread_id, 0);
+
+	// Signals raised for a thread that has since been unregistered, or its slot reused, are dropped.
+	if (state == SIGNAL_SAMPLED_THREAD_STATE_FREE || mono_atomic_load_i32 (&sampled_thread->os_thread_id) != os_thread_id)
+		return;
+
+	// Did a detaching thread get the signal?
+	if (mono_thread_info_get_small_id () == -1)
+		return;
+
+	// Drop the sample if the sampling thread hasn't drained the previous ones yet.
+	gint32 write_index = sampled_thread->write_index;
+	if ((guint32)(write_index - mono_atomic_load_i32 (&sampled_thread->read_index)) >= SIGNAL_SAMPLED_THREAD_RING_SIZE)
+		return;
+
+	EventPipeSampleProfileStackWalkData *data = &sampled_thread->samples [(guint32)write_index % SIGNAL_SAMPLED_THREAD_RING_SIZE];
+
+	int hp_save_index = mono_hazard_pointer_save_for_signal_handler ();
+
+	bool restore_async_context = false;
+	if (!mono_thread_info_is_async_context ()) {
+		mono_thread_info_set_is_async_context (TRUE);
+		restore_async_context = true;
+	}
+
+	MonoThreadUnwindState thread_state;
+	thread_state.valid = FALSE;
+	mono_threads_get_runtime_callbacks ()->thread_state_init_from_sigctx (&thread_state, sigctx);
+
+	data->thread_id = ep_rt_thread_id_t_to_uint64_t (mono_native_thread_id_get ());
+	data->thread_ip = thread_state.valid ? (uintptr_t)MONO_CONTEXT_GET_IP (&thread_state.ctx) : 0;
+	sample_profiler_walk_thread_state (&thread_state, data);
+
+	if (restore_async_context)
+		mono_thread_info_set_is_async_context (FALSE);
+
+	mono_hazard_pointer_restore_for_signal_handler (hp_save_index);
+
+	// Publish the sample to the sampling thread.
+	mono_atomic_store_i32 (&sampled_thread->write_index, write_index + 1);
+}
+
+MONO_SIG_HANDLER_FUNC (static, sample_profiler_signal_handler)
+{
+	int old_errno = errno;
+
+	MONO_SIG_HANDLER_INFO_TYPE *info = MONO_SIG_HANDLER_GET_INFO ();
+	MONO_SIG_HANDLER_GET_CONTEXT;
+
+	sample_profiler_signal_sample_current_thread ((EventPipeSignalSampledThread *)info->si_value.sival_ptr, ctx);
+
+	mono_set_errno (old_errno);
+}
+
+static
+bool
+sample_profiler_signal_sampling_init (void)
+{
+	if (_ep_rt_mono_signal_sampling_initialized)
+		return _ep_rt_mono_signal_sampling_signal != -1;
+
+	_ep_rt_mono_signal_sampling_initialized = true;
+
+	gchar *value = g_getenv ("DOTNET_EventPipeSignalSampling");
+	bool enable = value && atoi (value) != 0;
+	g_free (value);
+
+	if (!enable)
+		return false;
+
+	// Just take the first real-time signal we can get, same as the stat profiler.
+	int signal = mono_threads_suspend_search_alternative_signal ();
+
+	struct sigaction sa;
+	memset (&sa, 0, sizeof (sa));
+	sa.sa_sigaction = sample_profiler_signal_handler;
+	sigemptyset (&sa.sa_mask);
+	sa.sa_flags = SA_SIGINFO | SA_RESTART;
+	if (sigaction (signal, &sa, NULL) != 0) {
+		mono_trace (G_LOG_LEVEL_WARNING, MONO_TRACE_DIAGNOSTICS, "Failed to install EventPipe sampling signal handler, falling back to suspending sample profiler.");
+		return false;
+	}
+
+	_ep_rt_mono_signal_sampling_signal = signal;
+	_ep_rt_mono_signal_sampled_thread_map = g_hash_table_new (NULL, NULL);
+	return true;
+}
+
+static
+EventPipeSignalSampledThread *
+sample_profiler_signal_sampled_thread_alloc (MonoNativeThreadId thread_id)
+{
+	// Slots are never freed, signals still in flight for an exited thread can reference them.
+	EventPipeSignalSampledThread *sampled_thread = _ep_rt_mono_signal_sampled_threads;
+	while (sampled_thread && mono_atomic_load_i32 (&sampled_thread->state) != SIGNAL_SAMPLED_THREAD_STATE_FREE)
+		sampled_thread = sampled_thread->next;
+
+	if (!sampled_thread) {
+		sampled_thread = g_new0 (EventPipeSignalSampledThread, 1);
+		sampled_thread->next = _ep_rt_mono_signal_sampled_threads;
+		_ep_rt_mono_signal_sampled_threads = sampled_thread;
+	}
+
+	sampled_thread->thread_id = thread_id;
+	sampled_thread->timer_created = false;
+	mono_atomic_store_i32 (&sampled_thread->read_index, sampled_thread->write_index);
+	mono_atomic_store_i32 (&sampled_thread->os_thread_id, 0);
+	mono_atomic_store_i32 (&sampled_thread->state, SIGNAL_SAMPLED_THREAD_STATE_REGISTERING);
+
+	return sampled_thread;
+}
+
+static
+void
+sample_profiler_signal_sampled_thread_free (EventPipeSignalSampledThread *sampled_thread)
+{
+	mono_atomic_store_i32 (&sampled_thread->state, SIGNAL_SAMPLED_THREAD_STATE_FREE);
+	if (sampled_thread->timer_created)
+		timer_delete (sampled_thread->timer);
+	sampled_thread->timer_created = false;
+	mono_atomic_store_i32 (&sampled_thread->os_thread_id, 0);
+}
+
+static
+void
+sample_profiler_signal_sampled_thread_start_timer (EventPipeSignalSampledThread *sampled_thread)
+{
+	struct sigevent sev;
+	memset (&sev, 0, sizeof (sev));
+	sev.sigev_notify = SIGEV_THREAD_ID;
+	sev.sigev_signo = _ep_rt_mono_signal_sampling_signal;
+	sev.sigev_value.sival_ptr = sampled_thread;
+	sev.sigev_notify_thread_id = mono_atomic_load_i32 (&sampled_thread->os_thread_id);
+
+	// Wall clock timer, like the suspending sample profiler threads blocked outside of the runtime are sampled as well.
+	if (timer_create (CLOCK_MONOTONIC, &sev, &sampled_thread->timer) == 0) {
+		uint64_t sampling_rate_in_ns = ep_sample_profiler_get_sampling_rate ();
+		struct itimerspec spec;
+		spec.it_interval.tv_sec = (time_t)(sampling_rate_in_ns / 1000000000);
+		spec.it_interval.tv_nsec = (long)(sampling_rate_in_ns % 1000000000);
+		spec.it_value = spec.it_interval;
+		timer_settime (sampled_thread->timer, 0, &spec, NULL);
+		sampled_thread->timer_created = true;
+	}
+
+	// Out of timers (RLIMIT_SIGPENDING), the thread stays registered but won't be sampled.
+	mono_atomic_store_i32 (&sampled_thread->state, SIGNAL_SAMPLED_THREAD_STATE_ACTIVE);
+}
+
+static
+void
+sample_profiler_signal_sampling_write_sampling_events (
+	ep_rt_thread_handle_t sampling_thread,
+	EventPipeEvent *sampling_event)
+{
+	// Sample profiler only runs on one thread, no need to synchronize with anything but the signal handler.
+	uint32_t epoch = ++_ep_rt_mono_signal_sampling_epoch;
+	mono_atomic_store_i32 (&_ep_rt_mono_signal_sampling_enabled, 1);
+
+	// Pick up new threads. A thread publishes its kernel thread id when handling the registration signal,
+	// its sampling timer is created on the following tick.
+	MonoNativeThreadId current_thread_id = mono_native_thread_id_get ();
+	FOREACH_THREAD_SAFE_EXCLUDE (thread_info, MONO_THREAD_INFO_FLAGS_NO_GC | MONO_THREAD_INFO_FLAGS_NO_SAMPLE) {
+		MonoNativeThreadId thread_id = mono_thread_info_get_tid (thread_info);
+		if (!mono_native_thread_id_equals (thread_id, current_thread_id)) {
+			gpointer key = GSIZE_TO_POINTER (MONO_NATIVE_THREAD_ID_TO_UINT (thread_id));
+			EventPipeSignalSampledThread *sampled_thread = (EventPipeSignalSampledThread *)g_hash_table_lookup (_ep_rt_mono_signal_sampled_thread_map, key);
+			if (!sampled_thread) {
+				sampled_thread = sample_profiler_signal_sampled_thread_alloc (thread_id);
+				g_hash_table_insert (_ep_rt_mono_signal_sampled_thread_map, key, sampled_thread);
+
+				union sigval value;
+				value.sival_ptr = sampled_thread;
+				pthread_sigqueue (thread_id, _ep_rt_mono_signal_sampling_signal, value);
+			} else if (mono_atomic_load_i32 (&sampled_thread->state) == SIGNAL_SAMPLED_THREAD_STATE_REGISTERING && mono_atomic_load_i32 (&sampled_thread->os_thread_id) != 0) {
+				sample_profiler_signal_sampled_thread_start_timer (sampled_thread);
+			}
+			sampled_thread->epoch = epoch;
+		}
+	} FOREACH_THREAD_SAFE_END
+
+	// Write the samples taken since the last tick, stack frames are resolved here and not in the signal handler.
+	// Threads no longer in the thread list have exited, their slot is released once drained.
+	THREAD_INFO_TYPE adapter = { { 0 } };
+	GHashTableIter iter;
+	gpointer value;
+	g_hash_table_iter_init (&iter, _ep_rt_mono_signal_sampled_thread_map);
+	while (g_hash_table_iter_next (&iter, NULL, &value)) {
+		EventPipeSignalSampledThread *sampled_thread = (EventPipeSignalSampledThread *)value;
+
+		gint32 read_index = sampled_thread->read_index;
+		gint32 write_index = mono_atomic_load_i32 (&sampled_thread->write_index);
+		for (; read_index != write_index; ++read_index)
+			sample_profiler_write_sample (sampling_thread, sampling_event, &adapter, &sampled_thread->samples [(guint32)read_index % SIGNAL_SAMPLED_THREAD_RING_SIZE]);
+		mono_atomic_store_i32 (&sampled_thread->read_index, read_index);
+
+		if (sampled_thread->epoch != epoch) {
+			sample_profiler_signal_sampled_thread_free (sampled_thread);
+			g_hash_table_iter_remove (&iter);
+		}
+	}
+}
+#endif /* EP_RT_MONO_SIGNAL_SAMPLING */
+
 bool
 ep_rt_mono_sample_profiler_write_sampling_event_for_threads (
 	ep_rt_thread_handle_t sampling_thread,
 	EventPipeEvent *sampling_event)
 {
+#ifdef EP_RT_MONO_SIGNAL_SAMPLING
+	// Opt-in sampling without suspending the runtime, every thread samples itself from a timer signal.
+	if (sample_profiler_signal_sampling_init ()) {
+		sample_profiler_signal_sampling_write_sampling_events (sampling_thread, sampling_event);
+		return true;
+	}
+#endif
+
 	// Follows CoreClr implementation of sample profiler. Generic invasive/expensive way to do CPU sample profiling relying on STW and stackwalks.
-	// TODO: Investigate alternatives on platforms supporting Signals/SuspendThread (see Mono profiler) or CPU PMU's (see ETW/perf_event_open).
+	// TODO: Investigate alternatives on platforms supporting SuspendThread (see Mono profiler) or CPU PMU's (see ETW/perf_event_open).
 
 	// Sample profiler only runs on one thread, no need to synchorinize.
 	if (!_ep_rt_mono_sampled_thread_callstacks)
@@ -2792,29 +3450,7 @@ ep_rt_mono_sample_profiler_write_sampling_event_for_threads (
 					EventPipeSampleProfileStackWalkData *data = &g_array_index (_ep_rt_mono_sampled_thread_callstacks, EventPipeSampleProfileStackWalkData, sampled_thread_count);
 					data->thread_id = ep_rt_thread_id_t_to_uint64_t (mono_thread_info_get_tid (thread_info));
 					data->thread_ip = (uintptr_t)MONO_CONTEXT_GET_IP (&thread_state->ctx);
-					data->payload_data = EP_SAMPLE_PROFILER_SAMPLE_TYPE_ERROR;
-					data->stack_walk_data.stack_contents = &data->stack_contents;
-					data->stack_walk_data.top_frame = true;
-					data->stack_walk_data.async_frame = false;
-					data->stack_walk_data.safe_point_frame = false;
-					data->stack_walk_data.runtime_invoke_frame = false;
-					ep_stack_contents_reset (&data->stack_contents);
-					mono_get_eh_callbacks ()->mono_walk_stack_with_state (eventpipe_sample_profiler_walk_managed_stack_for_thread_func, thread_state, MONO_UNWIND_SIGNAL_SAFE, data);
-					if (data->payload_data == EP_SAMPLE_PROFILER_SAMPLE_TYPE_EXTERNAL && (data->stack_walk_data.safe_point_frame || data->stack_walk_data.runtime_invoke_frame)) {
-						// If classified as external code (managed->native frame on top of stack), but have a safe point or runtime invoke frame
-						// as second, re-classify current callstack to be executing managed code.
-						data->payload_data = EP_SAMPLE_PROFILER_SAMPLE_TYPE_MANAGED;
-					}
-					if (data->stack_walk_data.top_frame && ep_stack_contents_get_length (&data->stack_contents) == 0) {
-						// If no managed frames (including helper frames) are located on stack, mark sample as beginning in external code.
-						// This can happen on attached embedding threads returning to native code between runtime invokes.
-						// Make sure sample is still written into EventPipe for all attached threads even if they are currently not having
-						// any managed frames on stack. Prevents some tools applying thread time heuristics to prolong duration of last sample
-						// when embedding thread returns to native code. It also opens ability to visualize number of samples in unmanaged code
-						// on attached threads when executing outside of runtime. If tooling is not interested in these sample events, they are easy
-						// to identify and filter out.
-						data->payload_data = EP_SAMPLE_PROFILER_SAMPLE_TYPE_EXTERNAL;
-					}
+					sample_profiler_walk_thread_state (thread_state, data);
 
 					sampled_thread_count++;
 				}
@@ -2832,21 +3468,8 @@ ep_rt_mono_sample_profiler_write_sampling_event_for_threads (
 	// Since we can't keep thread info around after runtime as been suspended, use an empty
 	// adapter instance and only set recorded tid as parameter inside adapter.
 	THREAD_INFO_TYPE adapter = { { 0 } };
-	for (uint32_t thread_count = 0; thread_count < sampled_thread_count; ++thread_count) {
-		EventPipeSampleProfileStackWalkData *data = &g_array_index (_ep_rt_mono_sampled_thread_callstacks, EventPipeSampleProfileStackWalkData, thread_count);
-		if ((data->stack_walk_data.top_frame && data->payload_data == EP_SAMPLE_PROFILER_SAMPLE_TYPE_EXTERNAL) || (data->payload_data != EP_SAMPLE_PROFILER_SAMPLE_TYPE_ERROR && ep_stack_contents_get_length (&data->stack_contents) > 0)) {
-			// Check if we have an async frame, if so we will need to make sure all frames are registered in regular jit info table.
-			// TODO: An async frame can contain wrapper methods (no way to check during stackwalk), we could skip writing profile event
-			// for this specific stackwalk or we could cleanup stack_frames before writing profile event.
-			if (data->stack_walk_data.async_frame) {
-				for (uint32_t frame_count = 0; frame_count < data->stack_contents.next_available_frame; ++frame_count)
-					mono_jit_info_table_find_internal ((gpointer)data->stack_contents.stack_frames [frame_count], TRUE, FALSE);
-			}
-			mono_thread_info_set_tid (&adapter, ep_rt_uint64_t_to_thread_id_t (data->thread_id));
-			uint32_t payload_data = ep_rt_val_uint32_t (data->payload_data);
-			ep_write_sample_profile_event (sampling_thread, sampling_event, &adapter, &data->stack_contents, (uint8_t *)&payload_data, sizeof (payload_data));
-		}
-	}
+	for (uint32_t thread_count = 0; thread_count < sampled_thread_count; ++thread_count)
+		sample_profiler_write_sample (sampling_thread, sampling_event, &adapter, &g_array_index (_ep_rt_mono_sampled_thread_callstacks, EventPipeSampleProfileStackWalkData, thread_count));
 
 	// Current thread count will be our next maximum sampled threads.
 	_ep_rt_mono_max_sampled_thread_count = filtered_thread_count;
@@ -2854,6 +3477,25 @@ ep_rt_mono_sample_profiler_write_sampling_event_for_threads (
 	return true;
 }
 
+void
+ep_rt_mono_sample_profiler_stop_sampling (void)
+{
+#ifdef EP_RT_MONO_SIGNAL_SAMPLING
+	if (!_ep_rt_mono_signal_sampled_thread_map)
+		return;
+
+	// Signals still pending are ignored by the handler, undrained samples are dropped.
+	mono_atomic_store_i32 (&_ep_rt_mono_signal_sampling_enabled, 0);
+
+	GHashTableIter iter;
+	gpointer value;
+	g_hash_table_iter_init (&iter, _ep_rt_mono_signal_sampled_thread_map);
+	while (g_hash_table_iter_next (&iter, NULL, &value))
+		sample_profiler_signal_sampled_thread_free ((EventPipeSignalSampledThread *)value);
+	g_hash_table_remove_all (_ep_rt_mono_signal_sampled_thread_map);
+#endif
+}
+
 void
 ep_rt_mono_execute_rundown (ep_rt_execution_checkpoint_array_t *execution_checkpoints)
 {
@@ -3748,6 +4390,8 @@ ep_rt_mono_write_event_method_load (
 
 		g_free (method_namespace);
 		g_free (method_signature);
+
+		method_load_record_add (ji, verbose);
 	}
 
 	return true;
@@ -4279,6 +4923,104 @@ ep_rt_mono_write_event_monitor_contention_stop (MonoObject *obj)
 	return true;
 }
 
+// Number of collections reported through GCStart/GCEnd, mirrors GCHeap::GcCount on CoreCLR.
+// Only updated while the world is stopped, so no atomics are needed.
+static uint32_t _ep_rt_mono_gc_count = 0;
+
+static
+uint32_t
+gc_depth_from_generation (uint32_t generation)
+{
+	// SGen only has a nursery and a major heap, report them as gen0 and gen2.
+	return generation == 0 ? 0 : 2;
+}
+
+bool
+ep_rt_mono_write_event_gc (
+	MonoProfilerGCEvent gc_event,
+	uint32_t generation)
+{
+	switch (gc_event) {
+	case MONO_GC_EVENT_PRE_STOP_WORLD:
+		if (EventEnabledGCSuspendEEBegin_V1 ())
+			FireEtwGCSuspendEEBegin_V1 (
+				1 /* SuspendForGC */,
+				_ep_rt_mono_gc_count,
+				clr_instance_get_id (),
+				NULL,
+				NULL);
+		break;
+	case MONO_GC_EVENT_POST_STOP_WORLD:
+		if (EventEnabledGCSuspendEEEnd_V1 ())
+			FireEtwGCSuspendEEEnd_V1 (
+				clr_instance_get_id (),
+				NULL,
+				NULL);
+		break;
+	case MONO_GC_EVENT_START:
+		_ep_rt_mono_gc_count++;
+		if (EventEnabledGCStart_V2 ())
+			FireEtwGCStart_V2 (
+				_ep_rt_mono_gc_count,
+				gc_depth_from_generation (generation),
+				0 /* AllocSmall */,
+				0 /* NonConcurrentGC */,
+				clr_instance_get_id (),
+				0,
+				NULL,
+				NULL);
+		break;
+	case MONO_GC_EVENT_END:
+		if (EventEnabledGCEnd_V1 ())
+			FireEtwGCEnd_V1 (
+				_ep_rt_mono_gc_count,
+				gc_depth_from_generation (generation),
+				clr_instance_get_id (),
+				NULL,
+				NULL);
+
+		if (EventEnabledGCHeapStats_V2 ())
+			FireEtwGCHeapStats_V2 (
+				(uint64_t)mono_gc_get_generation_size (0),
+				0,
+				0,
+				0,
+				(uint64_t)mono_gc_get_generation_size (1),
+				0,
+				(uint64_t)mono_gc_get_generation_size (3),
+				0,
+				0,
+				0,
+				0,
+				0,
+				0,
+				clr_instance_get_id (),
+				0,
+				0,
+				NULL,
+				NULL);
+		break;
+	case MONO_GC_EVENT_PRE_START_WORLD:
+		if (EventEnabledGCRestartEEBegin_V1 ())
+			FireEtwGCRestartEEBegin_V1 (
+				clr_instance_get_id (),
+				NULL,
+				NULL);
+		break;
+	case MONO_GC_EVENT_POST_START_WORLD:
+		if (EventEnabledGCRestartEEEnd_V1 ())
+			FireEtwGCRestartEEEnd_V1 (
+				clr_instance_get_id (),
+				NULL,
+				NULL);
+		break;
+	default:
+		break;
+	}
+
+	return true;
+}
+
 bool
 ep_rt_mono_write_event_method_jit_memory_allocated_for_code (
 	const uint8_t *buffer,
@@ -4663,6 +5405,17 @@ runtime_profiler_monitor_failed (
 	ep_rt_mono_write_event_monitor_contention_stop (obj);
 }
 
+static
+void
+runtime_profiler_gc_event (
+	MonoProfiler *prof,
+	MonoProfilerGCEvent gc_event,
+	uint32_t generation,
+	mono_bool serial)
+{
+	ep_rt_mono_write_event_gc (gc_event, generation);
+}
+
 static
 void
 runtime_profiler_jit_code_buffer (
@@ -4777,6 +5530,14 @@ EventPipeEtwCallbackDotNETRuntime (
 			}
 		}
 
+		if (profiler_callback_is_enabled(match_any_keywords, GC_KEYWORD)) {
+			if (!profiler_callback_is_enabled(enabled_keywords, GC_KEYWORD))
+				mono_profiler_set_gc_event_callback (_ep_rt_dotnet_runtime_profiler_provider, runtime_profiler_gc_event);
+		} else {
+			if (profiler_callback_is_enabled (enabled_keywords, GC_KEYWORD))
+				mono_profiler_set_gc_event_callback (_ep_rt_dotnet_runtime_profiler_provider, NULL);
+		}
+
 		MICROSOFT_WINDOWS_DOTNETRUNTIME_PROVIDER_EVENTPIPE_Context.Level = level;
 		MICROSOFT_WINDOWS_DOTNETRUNTIME_PROVIDER_EVENTPIPE_Context.EnabledKeywordsBitmask = match_any_keywords;
 		MICROSOFT_WINDOWS_DOTNETRUNTIME_PROVIDER_EVENTPIPE_Context.IsEnabled = (is_enabled == 1 ? true : false);
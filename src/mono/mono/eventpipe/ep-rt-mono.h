@@ -372,6 +372,7 @@ extern void ep_rt_mono_provider_config_init (EventPipeProviderConfiguration *pro
 extern void ep_rt_mono_init_providers_and_events (void);
 extern bool ep_rt_mono_providers_validate_all_disabled (void);
 extern bool ep_rt_mono_sample_profiler_write_sampling_event_for_threads (ep_rt_thread_handle_t sampling_thread, EventPipeEvent *sampling_event);
+extern void ep_rt_mono_sample_profiler_stop_sampling (void);
 extern bool ep_rt_mono_rand_try_get_bytes (uint8_t *buffer,size_t buffer_size);
 extern void ep_rt_mono_execute_rundown (ep_rt_execution_checkpoint_array_t *execution_checkpoints);
 extern int64_t ep_rt_mono_perf_counter_query (void);
@@ -658,6 +659,14 @@ ep_rt_atomic_dec_int64_t (volatile int64_t *value)
 	return (int64_t)mono_atomic_dec_i64 ((volatile gint64 *)value);
 }
 
+static
+inline
+int64_t
+ep_rt_atomic_add_int64_t (volatile int64_t *value, int64_t add)
+{
+	return (int64_t)mono_atomic_add_i64 ((volatile gint64 *)value, (gint64)add);
+}
+
 static
 inline
 size_t
@@ -1002,6 +1011,21 @@ ep_rt_config_value_get_output_streaming (void)
 	return enable;
 }
 
+static
+inline
+bool
+ep_rt_config_value_get_output_user_events (void)
+{
+	bool enable = false;
+	gchar *value = g_getenv ("DOTNET_EventPipeOutputUserEvents");
+	if (!value)
+		value = g_getenv ("COMPlus_EventPipeOutputUserEvents");
+	if (value && atoi (value) == 1)
+		enable = true;
+	g_free (value);
+	return enable;
+}
+
 static
 inline
 uint32_t
@@ -1028,6 +1052,13 @@ ep_rt_sample_profiler_write_sampling_event_for_threads (ep_rt_thread_handle_t sa
 	ep_rt_mono_sample_profiler_write_sampling_event_for_threads (sampling_thread, sampling_event);
 }
 
+static
+void
+ep_rt_sample_profiler_stop_sampling (void)
+{
+	ep_rt_mono_sample_profiler_stop_sampling ();
+}
+
 static
 void
 ep_rt_notify_profiler_provider_created (EventPipeProvider *provider)
@@ -2357,6 +2388,11 @@ ep_rt_mono_write_event_monitor_contention_start (MonoObject *obj);
 bool
 ep_rt_mono_write_event_monitor_contention_stop (MonoObject *obj);
 
+bool
+ep_rt_mono_write_event_gc (
+	MonoProfilerGCEvent gc_event,
+	uint32_t generation);
+
 bool
 ep_rt_mono_write_event_method_jit_memory_allocated_for_code (
 	const uint8_t *buffer,
@@ -139,6 +139,12 @@ test_create_file_nettrace_v4 (void)
 	return test_create_file (EP_SERIALIZATION_FORMAT_NETTRACE_V4);
 }
 
+static RESULT
+test_create_file_nettrace_v5 (void)
+{
+	return test_create_file (EP_SERIALIZATION_FORMAT_NETTRACE_V5);
+}
+
 static RESULT
 test_file_write_event_netperf_v3 (void)
 {
@@ -151,6 +157,12 @@ test_file_write_event_nettrace_v4 (void)
 	return test_file_write_event (EP_SERIALIZATION_FORMAT_NETTRACE_V4, true, false);
 }
 
+static RESULT
+test_file_write_event_nettrace_v5 (void)
+{
+	return test_file_write_event (EP_SERIALIZATION_FORMAT_NETTRACE_V5, true, false);
+}
+
 static RESULT
 test_file_write_sequence_point_netperf_v3 (void)
 {
@@ -163,13 +175,22 @@ test_file_write_sequence_point_nettrace_v4 (void)
 	return test_file_write_event (EP_SERIALIZATION_FORMAT_NETTRACE_V4, false, true);
 }
 
+static RESULT
+test_file_write_sequence_point_nettrace_v5 (void)
+{
+	return test_file_write_event (EP_SERIALIZATION_FORMAT_NETTRACE_V5, false, true);
+}
+
 static Test ep_file_tests [] = {
 	{"test_create_file_netperf_v3", test_create_file_netperf_v3},
 	{"test_create_file_nettrace_v4", test_create_file_nettrace_v4},
+	{"test_create_file_nettrace_v5", test_create_file_nettrace_v5},
 	{"test_file_write_event_netperf_v3", test_file_write_event_netperf_v3},
 	{"test_file_write_event_nettrace_v4", test_file_write_event_nettrace_v4},
+	{"test_file_write_event_nettrace_v5", test_file_write_event_nettrace_v5},
 	{"test_file_write_sequence_point_netperf_v3", test_file_write_sequence_point_netperf_v3},
 	{"test_file_write_sequence_point_nettrace_v4", test_file_write_sequence_point_nettrace_v4},
+	{"test_file_write_sequence_point_nettrace_v5", test_file_write_sequence_point_nettrace_v5},
 	{NULL, NULL}
 };
 
@@ -4,6 +4,7 @@
 
 #include <eventpipe/ep.h>
 #include <eventpipe/ep-config.h>
+#include <eventpipe/ep-counters.h>
 #include <eventpipe/ep-event.h>
 #include <eventpipe/ep-session.h>
 #include <eventpipe/ep-event-instance.h>
@@ -148,6 +149,51 @@ ep_on_error:
 	ep_exit_error_handler ();
 }
 
+static RESULT
+test_register_counter (void)
+{
+	RESULT result = NULL;
+	uint32_t test_location = 0;
+
+	EventPipeCounter *counter = ep_counter_register ("test-counter", EP_COUNTER_TYPE_INCREMENTING, NULL);
+	if (!counter) {
+		result = FAILED ("Failed to register counter, ep_counter_register returned NULL");
+		ep_raise_error ();
+	}
+
+	test_location = 1;
+
+	ep_counter_add (counter, 5);
+	ep_counter_add (counter, 2);
+	if (ep_rt_volatile_load_int64_t (ep_counter_get_value_cref (counter)) != 7) {
+		result = FAILED ("Unexpected counter value after ep_counter_add");
+		ep_raise_error ();
+	}
+
+	test_location = 2;
+
+	ep_counter_set (counter, 42);
+	if (ep_rt_volatile_load_int64_t (ep_counter_get_value_cref (counter)) != 42) {
+		result = FAILED ("Unexpected counter value after ep_counter_set");
+		ep_raise_error ();
+	}
+
+	test_location = 3;
+
+	if (ep_counter_register ("test-counter", EP_COUNTER_TYPE_INCREMENTING, NULL) != counter) {
+		result = FAILED ("Registering the same counter name twice returned a different counter");
+		ep_raise_error ();
+	}
+
+ep_on_exit:
+	return result;
+
+ep_on_error:
+	if (!result)
+		result = FAILED ("Failed at test location=%i", test_location);
+	ep_exit_error_handler ();
+}
+
 static RESULT
 test_create_same_provider_twice (void)
 {
@@ -1122,6 +1168,84 @@ ep_on_error:
 	ep_exit_error_handler ();
 }
 
+static RESULT
+test_write_event_filter (void)
+{
+	RESULT result = NULL;
+	uint32_t test_location = 0;
+	EventPipeProvider *provider = NULL;
+	EventPipeEvent *enabled_event = NULL;
+	EventPipeEvent *disabled_event = NULL;
+	EventPipeSessionID session_id = 0;
+	EventPipeProviderConfiguration provider_config;
+	EventPipeProviderConfiguration *current_provider_config = NULL;
+	EventPipeProviderEventFilter event_filter;
+	const uint32_t event_ids [] = { 2 };
+	const uint32_t sampling_rates [] = { 1, 10 };
+
+	current_provider_config = ep_provider_config_init (&provider_config, TEST_PROVIDER_NAME, 1, EP_EVENT_LEVEL_LOGALWAYS, "");
+	ep_raise_error_if_nok (current_provider_config != NULL);
+	ep_provider_config_set_event_filter (current_provider_config, ep_provider_event_filter_init (&event_filter, false, event_ids, ARRAY_SIZE (event_ids), sampling_rates, 1));
+
+	test_location = 1;
+
+	provider = ep_create_provider (TEST_PROVIDER_NAME, NULL, NULL, NULL);
+	ep_raise_error_if_nok (provider != NULL);
+
+	test_location = 2;
+
+	enabled_event = ep_provider_add_event (provider, 1, 1, 1, EP_EVENT_LEVEL_LOGALWAYS, false, NULL, 0);
+	ep_raise_error_if_nok (enabled_event != NULL);
+
+	disabled_event = ep_provider_add_event (provider, 2, 1, 1, EP_EVENT_LEVEL_LOGALWAYS, false, NULL, 0);
+	ep_raise_error_if_nok (disabled_event != NULL);
+
+	test_location = 3;
+
+	session_id = ep_enable (TEST_FILE, 1, current_provider_config, 1, EP_SESSION_TYPE_FILE, EP_SERIALIZATION_FORMAT_NETTRACE_V4, false, NULL, NULL, NULL);
+	ep_raise_error_if_nok (session_id != 0);
+
+	test_location = 4;
+
+	if (!ep_event_is_enabled (enabled_event)) {
+		result = FAILED ("Event 1 not enabled");
+		ep_raise_error ();
+	}
+
+	test_location = 5;
+
+	if (ep_event_is_enabled (disabled_event)) {
+		result = FAILED ("Event 2 enabled although its id is filtered out");
+		ep_raise_error ();
+	}
+
+	test_location = 6;
+
+	if (*ep_event_get_sampled_mask_cref (enabled_event) == 0) {
+		result = FAILED ("Event 1 not sampled");
+		ep_raise_error ();
+	}
+
+	ep_start_streaming (session_id);
+
+	EventData data[1];
+	ep_event_data_init (&data[0], 0, 0, 0);
+	for (int i = 0; i < 20; ++i)
+		ep_write_event_2 (enabled_event, data, ARRAY_SIZE (data), NULL, NULL);
+	ep_event_data_fini (data);
+
+ep_on_exit:
+	ep_disable (session_id);
+	ep_delete_provider (provider);
+	ep_provider_config_fini (current_provider_config);
+	return result;
+
+ep_on_error:
+	if (!result)
+		result = FAILED ("Failed at test location=%i", test_location);
+	ep_exit_error_handler ();
+}
+
 static RESULT
 test_write_get_next_event (void)
 {
@@ -1398,6 +1522,7 @@ static Test ep_tests [] = {
 	{"test_stress_create_delete_provider", test_stress_create_delete_provider},
 	{"test_get_provider", test_get_provider},
 	{"test_create_same_provider_twice", test_create_same_provider_twice},
+	{"test_register_counter", test_register_counter},
 	{"test_enable_disable", test_enable_disable},
 	{"test_enable_disable_provider_config", test_enable_disable_provider_config},
 	{"test_create_delete_provider_with_callback", test_create_delete_provider_with_callback},
@@ -1409,6 +1534,7 @@ static Test ep_tests [] = {
 	{"test_session_write_wait_get_next_event", test_session_write_wait_get_next_event},
 	{"test_session_write_suspend_event", test_session_write_suspend_event},
 	{"test_write_event", test_write_event},
+	{"test_write_event_filter", test_write_event_filter},
 	{"test_write_get_next_event", test_write_get_next_event},
 	{"test_write_wait_get_next_event", test_write_wait_get_next_event},
 #ifdef TEST_PERF
@@ -440,6 +440,15 @@ test_thread_session_state (void)
 		ep_raise_error ();
 	}
 
+	test_location = 6;
+
+	current_session_state = ep_thread_get_volatile_session_state (thread, session);
+
+	if (current_session_state != session_state) {
+		result = FAILED ("Call to get_volatile_session_state returned unexpected session");
+		ep_raise_error ();
+	}
+
 ep_on_exit:
 	if (thread && session_state) {
 		ep_rt_spin_lock_acquire (ep_thread_get_rt_lock_ref (thread));
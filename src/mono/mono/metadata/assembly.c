@@ -86,6 +86,14 @@ static const MonoBundledAssembly **bundles;
 
 static const MonoBundledSatelliteAssembly **satellite_bundles;
 
+/*
+ * Indexes over BUNDLES and SATELLITE_BUNDLES, keyed by name and by "culture/name" respectively,
+ * so opening an image from a bundle doesn't scan every registered assembly.
+ * They are built when the bundles are registered and are read-only afterwards.
+ */
+static GHashTable *bundles_by_name;
+static GHashTable *satellite_bundles_by_name;
+
 /* Class lazy loading functions */
 static GENERATE_TRY_GET_CLASS_WITH_CACHE (debuggable_attribute, "System.Diagnostics", "DebuggableAttribute")
 
@@ -1458,12 +1466,10 @@ open_from_bundle_internal (MonoAssemblyLoadContext *alc, const char *filename, M
 
 	MonoImage *image = NULL;
 	char *name = is_satellite ? g_strdup (filename) : g_path_get_basename (filename);
-	for (int i = 0; !image && bundles [i]; ++i) {
-		if (strcmp (bundles [i]->name, name) == 0) {
-			// Since bundled images don't exist on disk, don't give them a legit filename
-			image = mono_image_open_from_data_internal (alc, (char*)bundles [i]->data, bundles [i]->size, FALSE, status, FALSE, name, NULL);
-			break;
-		}
+	const MonoBundledAssembly *bundle = (const MonoBundledAssembly *)g_hash_table_lookup (bundles_by_name, name);
+	if (bundle) {
+		// Since bundled images don't exist on disk, don't give them a legit filename
+		image = mono_image_open_from_data_internal (alc, (char*)bundle->data, bundle->size, FALSE, status, FALSE, name, NULL);
 	}
 
 	g_free (name);
@@ -1477,18 +1483,12 @@ open_from_satellite_bundle (MonoAssemblyLoadContext *alc, const char *filename,
 		return NULL;
 
 	MonoImage *image = NULL;
-	char *name = g_strdup (filename);
+	char *bundle_name = g_strconcat (culture, "/", filename, (const char *)NULL);
+	const MonoBundledSatelliteAssembly *bundle = (const MonoBundledSatelliteAssembly *)g_hash_table_lookup (satellite_bundles_by_name, bundle_name);
+	if (bundle)
+		image = mono_image_open_from_data_internal (alc, (char *)bundle->data, bundle->size, FALSE, status, FALSE, bundle_name, NULL);
 
-	for (int i = 0; !image && satellite_bundles [i]; ++i) {
-		if (strcmp (satellite_bundles [i]->name, name) == 0 && strcmp (satellite_bundles [i]->culture, culture) == 0) {
-			char *bundle_name = g_strconcat (culture, "/", name, (const char *)NULL);
-			image = mono_image_open_from_data_internal (alc, (char *)satellite_bundles [i]->data, satellite_bundles [i]->size, FALSE, status, FALSE, bundle_name, NULL);
-			g_free (bundle_name);
-			break;
-		}
-	}
-
-	g_free (name);
+	g_free (bundle_name);
 	return image;
 }
 
@@ -3133,6 +3133,14 @@ mono_assembly_get_name_internal (MonoAssembly *assembly)
 void
 mono_register_bundled_assemblies (const MonoBundledAssembly **assemblies)
 {
+	if (bundles_by_name)
+		g_hash_table_destroy (bundles_by_name);
+	bundles_by_name = g_hash_table_new (g_str_hash, g_str_equal);
+	/* Keep the first entry for a name, like the linear lookup this replaces */
+	for (int i = 0; assemblies && assemblies [i]; ++i) {
+		if (!g_hash_table_lookup (bundles_by_name, assemblies [i]->name))
+			g_hash_table_insert (bundles_by_name, (gpointer)assemblies [i]->name, (gpointer)assemblies [i]);
+	}
 	bundles = assemblies;
 }
 
@@ -3156,6 +3164,16 @@ mono_create_new_bundled_satellite_assembly (const char *name, const char *cultur
 void
 mono_register_bundled_satellite_assemblies (const MonoBundledSatelliteAssembly **assemblies)
 {
+	if (satellite_bundles_by_name)
+		g_hash_table_destroy (satellite_bundles_by_name);
+	satellite_bundles_by_name = g_hash_table_new_full (g_str_hash, g_str_equal, g_free, NULL);
+	for (int i = 0; assemblies && assemblies [i]; ++i) {
+		char *key = g_strconcat (assemblies [i]->culture, "/", assemblies [i]->name, (const char *)NULL);
+		if (!g_hash_table_lookup (satellite_bundles_by_name, key))
+			g_hash_table_insert (satellite_bundles_by_name, key, (gpointer)assemblies [i]);
+		else
+			g_free (key);
+	}
 	satellite_bundles = assemblies;
 }
 
@@ -1626,6 +1626,12 @@ mono_gc_get_gcmemoryinfo (
 	*fragmented_bytes = 0;
 }
 
+gint64
+mono_gc_get_los_fragmented_bytes (void)
+{
+	return 0;
+}
+
 void mono_gc_get_gctimeinfo (
 	guint64 *time_last_gc_100ns,
 	guint64 *time_since_last_gc_100ns,
@@ -2838,6 +2838,24 @@ mono_get_unique_iid (MonoClass *klass)
 	return iid;
 }
 
+/*
+ * class_needs_first_iface_slot:
+ *
+ *   Return whenever mono_class_setup_interface_offsets_internal () needs the first
+ * interface slot of KLASS, i.e. the vtable size of its parent, to compute the offsets
+ * of the interfaces of KLASS.
+ */
+static gboolean
+class_needs_first_iface_slot (MonoClass *klass)
+{
+	if (mono_class_is_ginst (klass))
+		return FALSE;
+	if (klass->rank || MONO_CLASS_IS_INTERFACE_INTERNAL (klass) || image_is_dynamic (klass->image))
+		return TRUE;
+	/* Typedefs have their interfaces set up when they are created */
+	return !klass->interfaces_inited || klass->interface_count > 0;
+}
+
 /**
  * mono_class_init_internal:
  * \param klass the class to initialize
@@ -3023,7 +3041,17 @@ mono_class_init_internal (MonoClass *klass)
 		}
 	}
 
-	if (klass->parent) {
+	/*
+	 * The parent vtable size is only needed to assign slots to the interfaces declared by
+	 * KLASS itself, interfaces inherited from the parent reuse the parent's offsets, and
+	 * generic instances take theirs from the gtd. Many classes are only touched for
+	 * typeof, static access or as a base class, so avoid building the parent vtable for them,
+	 * it is built by mono_class_setup_vtable () when the vtable of KLASS is needed.
+	 */
+	if (klass->parent && !class_needs_first_iface_slot (klass)) {
+		/* Not used by mono_class_setup_interface_offsets_internal () */
+		first_iface_slot = 0;
+	} else if (klass->parent) {
 		if (!klass->parent->vtable_size)
 			mono_class_setup_vtable (klass->parent);
 		if (mono_class_set_type_load_failure_causedby_class (klass, klass->parent, "Parent class vtable failed to initialize"))
@@ -3565,7 +3593,8 @@ mono_class_setup_properties (MonoClass *klass)
 			return;
 
 		MonoClassPropertyInfo *ginfo = mono_class_get_property_info (gklass);
-		properties = mono_class_new0 (klass, MonoProperty, ginfo->count + 1);
+		/* Most instances have no properties, don't allocate anything for them */
+		properties = ginfo->count ? mono_class_new0 (klass, MonoProperty, ginfo->count + 1) : NULL;
 
 		for (guint32 i = 0; i < ginfo->count; i++) {
 			ERROR_DECL (error);
@@ -3602,7 +3631,7 @@ mono_class_setup_properties (MonoClass *klass)
 				return;
 		}
 
-		properties = (MonoProperty *)mono_class_alloc0 (klass, sizeof (MonoProperty) * count);
+		properties = count ? (MonoProperty *)mono_class_alloc0 (klass, sizeof (MonoProperty) * count) : NULL;
 		for (guint32 i = first; i < last; ++i) {
 			mono_metadata_decode_table_row (klass->image, MONO_TABLE_PROPERTY, i, cols, MONO_PROPERTY_SIZE);
 			properties [i - first].parent = klass;
@@ -3695,7 +3724,7 @@ mono_class_setup_events (MonoClass *klass)
 		first = ginfo->first;
 		count = ginfo->count;
 
-		events = mono_class_new0 (klass, MonoEvent, count);
+		events = count ? mono_class_new0 (klass, MonoEvent, count) : NULL;
 
 		if (count)
 			context = mono_class_get_context (klass);
@@ -3731,7 +3760,7 @@ mono_class_setup_events (MonoClass *klass)
 			}
 		}
 
-		events = (MonoEvent *)mono_class_alloc0 (klass, sizeof (MonoEvent) * count);
+		events = count ? (MonoEvent *)mono_class_alloc0 (klass, sizeof (MonoEvent) * count) : NULL;
 		for (guint32 i = first; i < last; ++i) {
 			MonoEvent *event = &events [i - first];
 
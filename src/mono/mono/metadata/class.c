@@ -1209,11 +1209,16 @@ mono_class_inflate_generic_method_full_checked (MonoMethod *method, MonoClass *k
 	MonoMemoryManager *mm = mono_metadata_get_mem_manager_for_method (iresult);
 
 	// check cache
-	mono_mem_manager_lock (mm);
-	if (!mm->gmethod_cache)
-		mm->gmethod_cache = g_hash_table_new_full (inflated_method_hash, inflated_method_equal, NULL, (GDestroyNotify)free_inflated_method);
-	cached = (MonoMethodInflated *)g_hash_table_lookup (mm->gmethod_cache, iresult);
-	mono_mem_manager_unlock (mm);
+	if (!mm->gmethod_cache) {
+		mono_mem_manager_lock (mm);
+		if (!mm->gmethod_cache) {
+			MonoConcurrentHashTable *cache = mono_conc_hashtable_new_full (inflated_method_hash, inflated_method_equal, NULL, (GDestroyNotify)free_inflated_method);
+			mono_memory_barrier ();
+			mm->gmethod_cache = cache;
+		}
+		mono_mem_manager_unlock (mm);
+	}
+	cached = (MonoMethodInflated *)mono_conc_hashtable_lookup (mm->gmethod_cache, iresult);
 
 	if (cached) {
 		g_free (iresult);
@@ -1305,14 +1310,12 @@ mono_class_inflate_generic_method_full_checked (MonoMethod *method, MonoClass *k
 	 * is_generic_method_definition().
 	 */
 
-	// check cache
+	// check cache, iresult is visible to lock free lookups as soon as it is inserted
+	iresult->owner = mm;
 	mono_mem_manager_lock (mm);
-	cached = (MonoMethodInflated *)g_hash_table_lookup (mm->gmethod_cache, iresult);
-	if (!cached) {
-		g_hash_table_insert (mm->gmethod_cache, iresult, iresult);
-		iresult->owner = mm;
+	cached = (MonoMethodInflated *)mono_conc_hashtable_insert (mm->gmethod_cache, iresult, iresult);
+	if (!cached)
 		cached = iresult;
-	}
 	mono_mem_manager_unlock (mm);
 
 	return (MonoMethod*)cached;
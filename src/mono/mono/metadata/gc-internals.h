@@ -330,6 +330,8 @@ void mono_gc_get_gcmemoryinfo (
 	gint64 *heap_size_bytes,
 	gint64 *fragmented_bytes);
 
+gint64 mono_gc_get_los_fragmented_bytes (void);
+
 void mono_gc_get_gctimeinfo (
 	guint64 *time_last_gc_100ns,
 	guint64 *time_since_last_gc_100ns,
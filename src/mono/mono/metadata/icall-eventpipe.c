@@ -6,6 +6,7 @@
 #if defined(ENABLE_PERFTRACING) && !defined(DISABLE_EVENTPIPE)
 #include <mono/metadata/components.h>
 #include <mono/metadata/assembly-internals.h>
+#include <mono/metadata/gc-internals.h>
 
 /*
  * Forward declares of all static functions.
@@ -246,7 +247,8 @@ typedef enum {
 	EP_RT_COUNTERS_GC_LAST_PERCENT_TIME_IN_GC,
 	EP_RT_COUNTERS_JIT_IL_BYTES_JITTED,
 	EP_RT_COUNTERS_JIT_METHODS_JITTED,
-	EP_RT_COUNTERS_JIT_TICKS_IN_JIT
+	EP_RT_COUNTERS_JIT_TICKS_IN_JIT,
+	EP_RT_COUNTERS_GC_LARGE_OBJECT_FRAGMENTED_BYTES
 } EventPipeRuntimeCounters;
 
 static
@@ -344,6 +346,8 @@ guint64 ves_icall_System_Diagnostics_Tracing_EventPipeInternal_GetRuntimeCounter
 		return (guint64)get_methods_jitted ();
 	case EP_RT_COUNTERS_JIT_TICKS_IN_JIT :
 		return (gint64)get_ticks_in_jit ();
+	case EP_RT_COUNTERS_GC_LARGE_OBJECT_FRAGMENTED_BYTES :
+		return (guint64)mono_gc_get_los_fragmented_bytes ();
 	default:
 		return 0;
 	}
@@ -37,11 +37,13 @@
 #include <mono/utils/mono-mmap.h>
 #include <mono/utils/atomic.h>
 #include <mono/utils/mono-proclib.h>
+#include <mono/utils/options.h>
 #include <mono/metadata/class-internals.h>
 #include <mono/metadata/assembly.h>
 #include <mono/metadata/object-internals.h>
 #include <mono/metadata/verify.h>
 #include <mono/metadata/image-internals.h>
+#include <mono/metadata/mempool-internals.h>
 #include <mono/metadata/loaded-images-internals.h>
 #include <mono/metadata/metadata-update.h>
 #include <mono/metadata/debug-internals.h>
@@ -751,10 +753,14 @@ mono_image_init (MonoImage *image)
 	mono_os_mutex_init_recursive (&image->szarray_cache_lock);
 
 	image->mempool = mono_mempool_new_size (INITIAL_IMAGE_SIZE);
+	if (mono_opt_mempool_huge_pages)
+		mono_mempool_enable_huge_pages (image->mempool);
 	mono_internal_hash_table_init (&image->class_cache,
 				       g_direct_hash,
 				       class_key_extract,
 				       class_next_value);
+	image->method_cache = mono_conc_hashtable_new (NULL, NULL);
+	image->methodref_cache = mono_conc_hashtable_new (NULL, NULL);
 	image->field_cache = mono_conc_hashtable_new (NULL, NULL);
 
 	image->typespec_cache = mono_conc_hashtable_new (NULL, NULL);
@@ -2181,10 +2187,8 @@ mono_image_close_except_pools (MonoImage *image)
 		g_free (image->version);
 	}
 
-	if (image->method_cache)
-		g_hash_table_destroy (image->method_cache);
-	if (image->methodref_cache)
-		g_hash_table_destroy (image->methodref_cache);
+	mono_conc_hashtable_destroy (image->method_cache);
+	mono_conc_hashtable_destroy (image->methodref_cache);
 	mono_internal_hash_table_destroy (&image->class_cache);
 	mono_conc_hashtable_destroy (image->field_cache);
 	if (image->array_cache) {
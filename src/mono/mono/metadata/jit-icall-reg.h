@@ -145,6 +145,7 @@ MONO_JIT_ICALL (mini_llvmonly_throw_exception) \
 MONO_JIT_ICALL (mini_llvmonly_rethrow_exception) \
 MONO_JIT_ICALL (mini_llvmonly_throw_corlib_exception) \
 MONO_JIT_ICALL (mini_llvmonly_resume_exception_il_state) \
+MONO_JIT_ICALL (mini_tiered_inc) \
 MONO_JIT_ICALL (mono_amd64_resume_unwind)	\
 MONO_JIT_ICALL (mono_amd64_start_gsharedvt_call)	\
 MONO_JIT_ICALL (mono_amd64_throw_corlib_exception)	\
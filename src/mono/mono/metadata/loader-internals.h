@@ -177,8 +177,8 @@ struct _MonoMemoryManager {
 	MonoAssemblyLoadContext **alcs;
 
 	// Generic-specific caches
-	GHashTable *ginst_cache, *gmethod_cache, *gsignature_cache;
-	MonoConcurrentHashTable *gclass_cache;
+	GHashTable *gsignature_cache;
+	MonoConcurrentHashTable *ginst_cache, *gmethod_cache, *gclass_cache;
 
 	/* mirror caches of ones already on MonoImage. These ones contain generics */
 	GHashTable *szarray_cache, *array_cache, *ptr_cache;
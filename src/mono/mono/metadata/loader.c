@@ -1170,22 +1170,13 @@ mono_get_method_checked (MonoImage *image, guint32 token, MonoClass *klass, Mono
 
 	/* FIXME: method definition lookups for metadata-update probably end up here */
 
-	/* We do everything inside the lock to prevent creation races */
-
 	error_init (error);
 
-	mono_image_lock (image);
-
-	if (mono_metadata_token_table (token) == MONO_TABLE_METHOD) {
-		if (!image->method_cache)
-			image->method_cache = g_hash_table_new (NULL, NULL);
-		result = (MonoMethod *)g_hash_table_lookup (image->method_cache, GINT_TO_POINTER (mono_metadata_token_index (token)));
-	} else if (!image_is_dynamic (image)) {
-		if (!image->methodref_cache)
-			image->methodref_cache = g_hash_table_new (NULL, NULL);
-		result = (MonoMethod *)g_hash_table_lookup (image->methodref_cache, GINT_TO_POINTER (token));
-	}
-	mono_image_unlock (image);
+	/* Lookups are lock free, insertions are done inside the image lock to prevent creation races */
+	if (mono_metadata_token_table (token) == MONO_TABLE_METHOD)
+		result = (MonoMethod *)mono_conc_hashtable_lookup (image->method_cache, GINT_TO_POINTER (mono_metadata_token_index (token)));
+	else if (!image_is_dynamic (image))
+		result = (MonoMethod *)mono_conc_hashtable_lookup (image->methodref_cache, GINT_TO_POINTER (token));
 
 	if (result)
 		return result;
@@ -1199,20 +1190,14 @@ mono_get_method_checked (MonoImage *image, guint32 token, MonoClass *klass, Mono
 	if (!used_context && !result->is_inflated) {
 		MonoMethod *result2 = NULL;
 
+		/* Insertion returns the existing entry if another thread won the race */
 		if (mono_metadata_token_table (token) == MONO_TABLE_METHOD)
-			result2 = (MonoMethod *)g_hash_table_lookup (image->method_cache, GINT_TO_POINTER (mono_metadata_token_index (token)));
+			result2 = (MonoMethod *)mono_conc_hashtable_insert (image->method_cache, GINT_TO_POINTER (mono_metadata_token_index (token)), result);
 		else if (!image_is_dynamic (image))
-			result2 = (MonoMethod *)g_hash_table_lookup (image->methodref_cache, GINT_TO_POINTER (token));
+			result2 = (MonoMethod *)mono_conc_hashtable_insert (image->methodref_cache, GINT_TO_POINTER (token), result);
 
-		if (result2) {
-			mono_image_unlock (image);
-			return result2;
-		}
-
-		if (mono_metadata_token_table (token) == MONO_TABLE_METHOD)
-			g_hash_table_insert (image->method_cache, GINT_TO_POINTER (mono_metadata_token_index (token)), result);
-		else if (!image_is_dynamic (image))
-			g_hash_table_insert (image->methodref_cache, GINT_TO_POINTER (token), result);
+		if (result2)
+			result = result2;
 	}
 
 	mono_image_unlock (image);
@@ -84,4 +84,7 @@ mono_mempool_strdup_printf (MonoMemPool *pool, const char *format, ...) MONO_ATT
 long
 mono_mempool_get_bytes_allocated (void);
 
+void
+mono_mempool_enable_huge_pages (MonoMemPool *pool);
+
 #endif
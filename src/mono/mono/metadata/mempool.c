@@ -21,6 +21,7 @@
 #include "mempool.h"
 #include "mempool-internals.h"
 #include "utils/unlocked.h"
+#include "utils/mono-mmap.h"
 
 /*
  * MonoMemPool is for fast allocation of memory. We free
@@ -36,11 +37,23 @@
 #if MONO_SMALL_CONFIG
 #define MONO_MEMPOOL_PAGESIZE 4096
 #define MONO_MEMPOOL_MINSIZE 256
+#define MONO_MEMPOOL_MAX_BLOCKSIZE (32 * 1024)
 #else
 #define MONO_MEMPOOL_PAGESIZE 8192
 #define MONO_MEMPOOL_MINSIZE 512
+#define MONO_MEMPOOL_MAX_BLOCKSIZE (128 * 1024)
 #endif
 
+// Block size used by mempools which are backed by huge pages, see mono_mempool_enable_huge_pages ()
+#define MONO_MEMPOOL_HUGE_PAGE_SIZE (2 * 1024 * 1024)
+
+enum {
+	// Used in "initial block" only: new blocks should be allocated as huge pages once the pool is big enough
+	MEMPOOL_FLAG_HUGE_PAGES = 1 << 0,
+	// This block was allocated with mono_valloc_aligned () and must be freed with mono_vfree ()
+	MEMPOOL_FLAG_VALLOC = 1 << 1,
+};
+
 // The USE_MALLOC_FOR_MEMPOOLS debug-build flag causes mempools to be allocated in single-element blocks, so tools like Valgrind can run better.
 #if USE_MALLOC_FOR_MEMPOOLS
 #define INDIVIDUAL_ALLOCATIONS
@@ -63,6 +76,9 @@ struct _MonoMemPool {
 	// Size of this memory block only
 	guint32 size;
 
+	// MEMPOOL_FLAG_ values
+	guint32 flags;
+
 	// Used in "initial block" only: Beginning of current free space in mempool (may be in some block other than the first one)
 	guint8 *pos;
 
@@ -112,6 +128,7 @@ mono_mempool_new_size (int initial_size)
 	pool = (MonoMemPool *)g_malloc (initial_size);
 
 	pool->next = NULL;
+	pool->flags = 0;
 	pool->pos = (guint8*)pool + SIZEOF_MEM_POOL; // Start after header
 	pool->end = (guint8*)pool + initial_size;    // End at end of allocated space
 	pool->d.allocated = pool->size = initial_size;
@@ -135,7 +152,10 @@ mono_mempool_destroy (MonoMemPool *pool)
 	p = pool;
 	while (p) {
 		n = p->next;
-		g_free (p);
+		if (p->flags & MEMPOOL_FLAG_VALLOC)
+			mono_vfree (p, p->size, MONO_MEM_ACCOUNT_OTHER);
+		else
+			g_free (p);
 		p = n;
 	}
 }
@@ -224,6 +244,44 @@ mono_backtrace (int size)
 
 #endif
 
+/**
+ * mono_mempool_enable_huge_pages:
+ * \param pool the memory pool to use
+ *
+ * Once \p pool has grown past the size of a huge page, allocate its
+ * remaining blocks as huge page sized, huge page aligned mappings so
+ * the kernel can back them with transparent huge pages. This is meant
+ * for long lived pools which grow big, like the ones of images.
+ */
+void
+mono_mempool_enable_huge_pages (MonoMemPool *pool)
+{
+#if !defined(INDIVIDUAL_ALLOCATIONS) && !defined(HOST_WIN32) && !defined(HOST_WASM)
+	pool->flags |= MEMPOOL_FLAG_HUGE_PAGES;
+#endif
+}
+
+/*
+ * get_max_block_size:
+ *
+ *   Return the maximum size of a block used for small allocations. It grows
+ * with the pool, so pools which allocate a lot (images loading thousands of
+ * classes) end up with fewer, larger blocks and waste less space at the end
+ * of each one.
+ */
+static guint
+get_max_block_size (MonoMemPool *pool)
+{
+	guint max_size = pool->d.allocated / 8;
+
+	max_size = (max_size + MONO_MEMPOOL_PAGESIZE - 1) & ~(MONO_MEMPOOL_PAGESIZE - 1);
+	if (max_size < MONO_MEMPOOL_PAGESIZE)
+		max_size = MONO_MEMPOOL_PAGESIZE;
+	else if (max_size > MONO_MEMPOOL_MAX_BLOCKSIZE)
+		max_size = MONO_MEMPOOL_MAX_BLOCKSIZE;
+	return max_size;
+}
+
 /**
  * get_next_size:
  * @pool: the memory pool to use
@@ -239,17 +297,44 @@ static guint
 get_next_size (MonoMemPool *pool, int size)
 {
 	int target = pool->next? pool->next->size: pool->size;
+	guint max_size = get_max_block_size (pool);
 	size += SIZEOF_MEM_POOL;
 	/* increase the size */
 	target += target / 2;
 	while (target < size) {
 		target += target / 2;
 	}
-	if (target > MONO_MEMPOOL_PAGESIZE && size <= MONO_MEMPOOL_PAGESIZE)
-		target = MONO_MEMPOOL_PAGESIZE;
+	if (target > max_size && size <= max_size)
+		target = max_size;
 	return target;
 }
 
+/*
+ * alloc_block:
+ *
+ *   Allocate a new block of NEW_SIZE bytes for POOL. NEW_SIZE might be increased.
+ */
+static MonoMemPool *
+alloc_block (MonoMemPool *pool, guint *new_size)
+{
+	MonoMemPool *np;
+
+	if ((pool->flags & MEMPOOL_FLAG_HUGE_PAGES) && pool->d.allocated >= MONO_MEMPOOL_HUGE_PAGE_SIZE && *new_size <= MONO_MEMPOOL_HUGE_PAGE_SIZE) {
+		np = (MonoMemPool *)mono_valloc_aligned (MONO_MEMPOOL_HUGE_PAGE_SIZE, MONO_MEMPOOL_HUGE_PAGE_SIZE, MONO_MMAP_READ | MONO_MMAP_WRITE | MONO_MMAP_HUGEPAGES, MONO_MEM_ACCOUNT_OTHER);
+		if (np) {
+			np->flags = MEMPOOL_FLAG_VALLOC;
+			*new_size = MONO_MEMPOOL_HUGE_PAGE_SIZE;
+			return np;
+		}
+		/* Don't retry on every block */
+		pool->flags &= ~MEMPOOL_FLAG_HUGE_PAGES;
+	}
+
+	np = (MonoMemPool *)g_malloc (*new_size);
+	np->flags = 0;
+	return np;
+}
+
 /**
  * mono_mempool_alloc:
  * \param pool the memory pool to use
@@ -284,6 +369,7 @@ gpointer
 			guint new_size = SIZEOF_MEM_POOL + size;
 			MonoMemPool *np = (MonoMemPool *)g_malloc (new_size);
 
+			np->flags = 0;
 			np->next = pool->next;
 			np->size = new_size;
 			pool->next = np;
@@ -294,7 +380,7 @@ gpointer
 		} else {
 			// Notice: any unused memory at the end of the old head becomes simply abandoned in this case until the mempool is freed (see Bugzilla #35136)
 			guint new_size = get_next_size (pool, size);
-			MonoMemPool *np = (MonoMemPool *)g_malloc (new_size);
+			MonoMemPool *np = alloc_block (pool, &new_size);
 
 			np->next = pool->next;
 			np->size = new_size;
@@ -3404,12 +3404,24 @@ mono_metadata_get_canonical_generic_inst (MonoGenericInst *candidate)
 	MonoMemoryManager *mm = mono_mem_manager_get_generic (data.images, data.nimages);
 	collect_data_free (&data);
 
-	mono_mem_manager_lock (mm);
+	if (!mm->ginst_cache) {
+		mono_mem_manager_lock (mm);
+		if (!mm->ginst_cache) {
+			MonoConcurrentHashTable *cache = mono_conc_hashtable_new_full (mono_metadata_generic_inst_hash, mono_metadata_generic_inst_equal, NULL, (GDestroyNotify)free_generic_inst);
+			mono_memory_barrier ();
+			mm->ginst_cache = cache;
+		}
+		mono_mem_manager_unlock (mm);
+	}
+
+	MonoGenericInst *ginst = (MonoGenericInst *)mono_conc_hashtable_lookup (mm->ginst_cache, candidate);
+	if (ginst)
+		return ginst;
 
-	if (!mm->ginst_cache)
-		mm->ginst_cache = g_hash_table_new_full (mono_metadata_generic_inst_hash, mono_metadata_generic_inst_equal, NULL, (GDestroyNotify)free_generic_inst);
+	mono_mem_manager_lock (mm);
 
-	MonoGenericInst *ginst = (MonoGenericInst *)g_hash_table_lookup (mm->ginst_cache, candidate);
+	/* Check again under the lock, so the inst is only created once */
+	ginst = (MonoGenericInst *)mono_conc_hashtable_lookup (mm->ginst_cache, candidate);
 	if (!ginst) {
 		int size = MONO_SIZEOF_GENERIC_INST + type_argc * sizeof (MonoType *);
 		ginst = (MonoGenericInst *)mono_mem_manager_alloc0 (mm, size);
@@ -3423,7 +3435,7 @@ mono_metadata_get_canonical_generic_inst (MonoGenericInst *candidate)
 		for (int i = 0; i < type_argc; ++i)
 			ginst->type_argv [i] = mono_metadata_type_dup (NULL, candidate->type_argv [i]);
 
-		g_hash_table_insert (mm->ginst_cache, ginst, ginst);
+		mono_conc_hashtable_insert (mm->ginst_cache, ginst, ginst);
 	}
 
 	mono_mem_manager_unlock (mm);
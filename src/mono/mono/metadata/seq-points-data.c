@@ -271,27 +271,38 @@ mono_seq_point_find_by_il_offset (MonoSeqPointInfo* info, int il_offset, SeqPoin
 void
 mono_seq_point_init_next (MonoSeqPointInfo* info, SeqPoint sp, SeqPoint* next)
 {
-	int i;
+	int i, index, found;
 	guint8* ptr;
+	int *next_indexes;
 	SeqPointIterator it;
-	GArray* seq_points = g_array_new (FALSE, TRUE, sizeof (SeqPoint));
 	SeqPointInfoInflated info_inflated = seq_point_info_inflate (info);
 
 	g_assert (info_inflated.has_debug_data);
 
-	mono_seq_point_iterator_init (&it, info);
-	while (mono_seq_point_iterator_next (&it))
-		g_array_append_vals (seq_points, &it.seq_point, 1);
+	if (!sp.next_len)
+		return;
 
+	next_indexes = g_new (int, sp.next_len);
 	ptr = info_inflated.data + sp.next_offset;
-	for (i = 0; i < sp.next_len; i++) {
-		int next_index;
-		next_index = decode_var_int (ptr, &ptr);
-		g_assert (next_index < seq_points->len);
-		memcpy (&next[i], seq_points->data + next_index * sizeof (SeqPoint), sizeof (SeqPoint));
+	for (i = 0; i < sp.next_len; i++)
+		next_indexes [i] = decode_var_int (ptr, &ptr);
+
+	/* Decode the table only up to the successors instead of materializing all of it */
+	index = 0;
+	found = 0;
+	mono_seq_point_iterator_init (&it, info);
+	while (found < sp.next_len && mono_seq_point_iterator_next (&it)) {
+		for (i = 0; i < sp.next_len; i++) {
+			if (next_indexes [i] == index) {
+				memcpy (&next [i], &it.seq_point, sizeof (SeqPoint));
+				found++;
+			}
+		}
+		index++;
 	}
 
-	g_array_free (seq_points, TRUE);
+	g_assert (found == sp.next_len);
+	g_free (next_indexes);
 }
 
 gboolean
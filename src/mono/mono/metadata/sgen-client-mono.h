@@ -684,6 +684,16 @@ sgen_client_binary_protocol_ephemeron_ref (gpointer list, gpointer key, gpointer
 {
 }
 
+static void G_GNUC_UNUSED
+sgen_client_binary_protocol_card_scan_stats (long long clear_time, long long major_scan, long long los_scan, long long wbroots_scan)
+{
+}
+
+static void G_GNUC_UNUSED
+sgen_client_binary_protocol_worker_steal_stats (int worker_index, int generation, int steal_attempts, int steals, long long idle_time)
+{
+}
+
 #define TLAB_ACCESS_INIT	SgenThreadInfo *__thread_info__ = mono_tls_get_sgen_thread_info ()
 #define IN_CRITICAL_REGION (__thread_info__->client_info.in_critical_region)
 
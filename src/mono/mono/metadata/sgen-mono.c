@@ -2624,6 +2624,12 @@ mono_gc_get_gcmemoryinfo (
 	*total_committed_bytes = sgen_gc_info.total_committed_bytes;
 }
 
+gint64
+mono_gc_get_los_fragmented_bytes (void)
+{
+	return (gint64)sgen_gc_info.total_los_fragmented_bytes;
+}
+
 void mono_gc_get_gctimeinfo (
 	guint64 *time_last_gc_100ns,
 	guint64 *time_since_last_gc_100ns,
@@ -319,9 +319,12 @@ get_relation_from_ins (MonoVariableRelationsEvaluationArea *area, MonoInst *ins,
 		value_kind = MONO_UNSIGNED_INTEGER_VALUE_SIZE_4;
 		break;
 	case OP_LDLEN:
+	case OP_STRLEN:
 		/*
 		 * We represent arrays by their length, so r1<-ldlen r2 is stored
-		 * as r1 == r2 in the evaluation graph.
+		 * as r1 == r2 in the evaluation graph. Strings are immutable and
+		 * their bounds checks are done against the string object too, so
+		 * they are handled the same way.
 		 */
 		value->type = MONO_VARIABLE_SUMMARIZED_VALUE;
 		value->value.variable.variable = ins->sreg1;
@@ -329,6 +332,42 @@ get_relation_from_ins (MonoVariableRelationsEvaluationArea *area, MonoInst *ins,
 		value->value.variable.nullness = MONO_VALUE_MAYBE_NULL;
 		value_kind = MONO_UNSIGNED_INTEGER_VALUE_SIZE_4;
 		break;
+	case OP_IAND_IMM:
+		/* The result of masking with a non negative constant is 0 <= x <= mask */
+		if (ins->inst_imm >= 0 && ins->inst_imm <= G_MAXINT32) {
+			result->relation = MONO_LE_RELATION;
+			value->type = MONO_CONSTANT_SUMMARIZED_VALUE;
+			value->value.constant.value = GTMREG_TO_INT (ins->inst_imm);
+			value->value.constant.nullness = MONO_VALUE_MAYBE_NULL;
+			value_kind = MONO_UNSIGNED_INTEGER_VALUE_SIZE_4;
+		}
+		break;
+	case OP_ISHR_UN_IMM:
+		/* An unsigned right shift by a non zero amount clears the sign bit */
+		if ((ins->inst_imm & 0x1f) != 0) {
+			result->relation = MONO_LE_RELATION;
+			value->type = MONO_CONSTANT_SUMMARIZED_VALUE;
+			value->value.constant.value = (int)(G_MAXUINT32 >> (ins->inst_imm & 0x1f));
+			value->value.constant.nullness = MONO_VALUE_MAYBE_NULL;
+			value_kind = MONO_UNSIGNED_INTEGER_VALUE_SIZE_4;
+		}
+		break;
+	case OP_ICONV_TO_U1:
+	case OP_LOADU1_MEMBASE:
+		value_kind = MONO_UNSIGNED_INTEGER_VALUE_SIZE_1;
+		break;
+	case OP_ICONV_TO_U2:
+	case OP_LOADU2_MEMBASE:
+		value_kind = MONO_UNSIGNED_INTEGER_VALUE_SIZE_2;
+		break;
+	case OP_ICONV_TO_I1:
+	case OP_LOADI1_MEMBASE:
+		value_kind = MONO_INTEGER_VALUE_SIZE_1;
+		break;
+	case OP_ICONV_TO_I2:
+	case OP_LOADI2_MEMBASE:
+		value_kind = MONO_INTEGER_VALUE_SIZE_2;
+		break;
 	case OP_NEWARR:
 		value->type = MONO_VARIABLE_SUMMARIZED_VALUE;
 		value->value.variable.variable = ins->sreg1;
@@ -163,8 +163,16 @@ typedef struct {
 	MonoMethod *method;
 } MethodProfileData;
 
+typedef struct {
+	int id;
+	AotProfWrapperKind kind;
+	MethodProfileData *method;
+} WrapperProfileData;
+
 typedef struct {
 	GHashTable *images, *classes, *ginsts, *methods;
+	/* WrapperProfileData, in file order */
+	GPtrArray *wrappers;
 } ProfileData;
 
 /* predefined values for static readonly fields without needed to run the .cctor */
@@ -248,6 +256,7 @@ typedef struct MonoAotOptions {
 	gboolean use_current_cpu;
 	gboolean dump_json;
 	gboolean profile_only;
+	gboolean profile_cold_mini;
 	gboolean no_opt;
 	char *clangxx;
 	char *depfile;
@@ -395,6 +404,9 @@ typedef struct MonoAotCompile {
 	GHashTable *objc_selector_to_index;
 	GList *profile_data;
 	GHashTable *profile_methods;
+	/* Maps MonoMethod* -> 1 + the position of its first execution in the profile */
+	GHashTable *profile_method_ranks;
+	guint32 profile_method_count;
 	GHashTable *blob_hash;
 	/* Maps MonoMethod*->GPtrArray* */
 	GHashTable *gshared_instances;
@@ -4322,16 +4334,35 @@ is_open_method (MonoMethod *method)
 	return FALSE;
 }
 
+static guint32
+get_profile_rank (MonoAotCompile *acfg, MonoMethod *method)
+{
+	return GPOINTER_TO_UINT (g_hash_table_lookup (acfg->profile_method_ranks, method));
+}
+
+/* A method keeps the rank of its earliest execution, shared methods inherit it from their instances */
+static void
+set_profile_rank (MonoAotCompile *acfg, MonoMethod *method, guint32 rank)
+{
+	guint32 old_rank = get_profile_rank (acfg, method);
+
+	if (rank && (!old_rank || rank < old_rank))
+		g_hash_table_insert (acfg->profile_method_ranks, method, GUINT_TO_POINTER (rank));
+}
+
 static void
 add_extra_method_full (MonoAotCompile *acfg, MonoMethod *method, gboolean prefer_gshared, int depth)
 {
 	ERROR_DECL (error);
 
 	if (method->is_generic && acfg->aot_opts.profile_only) {
+		MonoMethod *orig = method;
+
 		// Add the fully shared version to its home image
 		// This has already been added just need to add it to profile_methods so its not skipped
 		method = mini_get_shared_method_full (method, SHARE_MODE_NONE, error);
 		g_hash_table_insert (acfg->profile_methods, method, method);
+		set_profile_rank (acfg, method, get_profile_rank (acfg, orig));
 		return;
 	}
 
@@ -4352,6 +4383,7 @@ add_extra_method_full (MonoAotCompile *acfg, MonoMethod *method, gboolean prefer
 		/* Add it to profile_methods so its not skipped later */
 		if (acfg->aot_opts.profile_only && g_hash_table_lookup (acfg->profile_methods, orig))
 			g_hash_table_insert (acfg->profile_methods, method, method);
+		set_profile_rank (acfg, method, get_profile_rank (acfg, orig));
 
 		if (!is_open_method (orig) && !mono_method_is_generic_sharable_full (orig, TRUE, FALSE, FALSE)) {
 			GPtrArray *instances = g_hash_table_lookup (acfg->gshared_instances, method);
@@ -8576,6 +8608,8 @@ mono_aot_parse_options (const char *aot_options, MonoAotOptions *opts)
 			opts->profile_files = g_list_append (opts->profile_files, g_strdup (arg + strlen ("profile=")));
 		} else if (!strcmp (arg, "profile-only")) {
 			opts->profile_only = TRUE;
+		} else if (!strcmp (arg, "profile-cold-mini")) {
+			opts->profile_cold_mini = TRUE;
 		} else if (str_begins_with (arg, "mibc-profile=")) {
 			opts->mibc_profile_files = g_list_append (opts->mibc_profile_files, g_strdup (arg + strlen ("mibc-profile=")));
 		} else if (!strcmp (arg, "verbose")) {
@@ -8654,6 +8688,7 @@ mono_aot_parse_options (const char *aot_options, MonoAotOptions *opts)
 			printf ("    outfile=\n");
 			printf ("    profile=\n");
 			printf ("    profile-only\n");
+			printf ("    profile-cold-mini\n");
 			printf ("    print-skipped-methods\n");
 			printf ("    readonly-value=\n");
 			printf ("    save-temps\n");
@@ -9054,6 +9089,7 @@ compile_method (MonoAotCompile *acfg, MonoMethod *method)
 	MonoMethod *wrapped;
 	gint64 jit_time_start;
 	JitFlags flags;
+	guint32 opts;
 
 	if (acfg->aot_opts.metadata_only)
 		return;
@@ -9151,8 +9187,16 @@ compile_method (MonoAotCompile *acfg, MonoMethod *method)
 	if (acfg->flags & MONO_AOT_FILE_FLAG_CODE_EXEC_ONLY)
 		flags = (JitFlags)(flags | JIT_FLAG_CODE_EXEC_ONLY);
 
+	opts = acfg->jit_opts;
+	if (acfg->aot_opts.profile_cold_mini && acfg->profile_method_count && !get_profile_rank (acfg, method)) {
+		/* Methods the profile never saw run are compiled for size: no inlining and no LLVM */
+		opts &= ~MONO_OPT_INLINE;
+		if (!acfg->aot_opts.llvm_only)
+			flags = (JitFlags)(flags & ~JIT_FLAG_LLVM);
+	}
+
 	jit_time_start = mono_time_track_start ();
-	cfg = mini_method_compile (method, acfg->jit_opts, flags, 0, index);
+	cfg = mini_method_compile (method, opts, flags, 0, index);
 	mono_time_track_end (&mono_jit_stats.jit_time, jit_time_start);
 
 	if (cfg->exception_type == MONO_EXCEPTION_GENERIC_SHARING_FAILED) {
@@ -10496,6 +10540,54 @@ dedup_skip_methods (MonoAotCompile *acfg)
 	}
 }
 
+static int
+compare_guint64 (const void *a, const void *b)
+{
+	guint64 v1 = *(const guint64*)a;
+	guint64 v2 = *(const guint64*)b;
+
+	return v1 < v2 ? -1 : (v1 > v2 ? 1 : 0);
+}
+
+/*
+ * sort_method_order_by_profile:
+ *
+ *   Move the methods which ran in the profile to the start of the method order, in the order
+ * they first ran, so the code executed at startup is packed into as few pages as possible.
+ * The runtime sorts method addresses itself, so the order is free to change.
+ */
+static void
+sort_method_order_by_profile (MonoAotCompile *acfg)
+{
+	GPtrArray *cold = g_ptr_array_new ();
+	guint64 *hot = g_new (guint64, acfg->method_order->len);
+	guint nhot = 0;
+
+	for (guint oindex = 0; oindex < acfg->method_order->len; ++oindex) {
+		guint32 index = GPOINTER_TO_UINT (g_ptr_array_index (acfg->method_order, oindex));
+		MonoCompile *cfg = acfg->cfgs [index];
+		guint32 rank = cfg ? get_profile_rank (acfg, cfg->orig_method) : 0;
+
+		if (rank)
+			hot [nhot ++] = ((guint64)rank << 32) | index;
+		else
+			g_ptr_array_add (cold, GUINT_TO_POINTER (index));
+	}
+
+	qsort (hot, nhot, sizeof (guint64), compare_guint64);
+
+	g_ptr_array_set_size (acfg->method_order, 0);
+	for (guint i = 0; i < nhot; ++i)
+		g_ptr_array_add (acfg->method_order, GUINT_TO_POINTER ((guint32)hot [i]));
+	for (guint i = 0; i < cold->len; ++i)
+		g_ptr_array_add (acfg->method_order, g_ptr_array_index (cold, i));
+
+	aot_printf (acfg, "Placed %u profiled methods at the start of the image.\n", nhot);
+
+	g_free (hot);
+	g_ptr_array_free (cold, TRUE);
+}
+
 static void
 emit_code (MonoAotCompile *acfg)
 {
@@ -12938,6 +13030,33 @@ profread_string (FILE *infile)
 	return pbuf;
 }
 
+/* Read the method description shared by AOTPROF_RECORD_METHOD and AOTPROF_RECORD_WRAPPER */
+static MethodProfileData*
+profread_method (FILE *infile, ProfileData *data, int id)
+{
+	int class_id = profread_int (infile);
+	int ginst_id = profread_int (infile);
+	int param_count = profread_int (infile);
+	char *method_name = profread_string (infile);
+	char *sig = profread_string (infile);
+
+	ClassProfileData *klass = (ClassProfileData*)g_hash_table_lookup (data->classes, GINT_TO_POINTER (class_id));
+	g_assert (klass);
+
+	MethodProfileData *mdata = g_new0 (MethodProfileData, 1);
+	mdata->id = id;
+	mdata->klass = klass;
+	mdata->name = method_name;
+	mdata->signature = sig;
+	mdata->param_count = param_count;
+
+	if (ginst_id != -1) {
+		mdata->inst = (GInstProfileData*)g_hash_table_lookup (data->ginsts, GINT_TO_POINTER (ginst_id));
+		g_assert (mdata->inst);
+	}
+	return mdata;
+}
+
 static void
 load_profile_file (MonoAotCompile *acfg, char *filename)
 {
@@ -12967,7 +13086,8 @@ load_profile_file (MonoAotCompile *acfg, char *filename)
 	}
 	guint32 expected_version = (AOT_PROFILER_MAJOR_VERSION << 16) | AOT_PROFILER_MINOR_VERSION;
 	version = profread_int (infile);
-	if (version != expected_version) {
+	/* Newer minor versions only add record types */
+	if ((version >> 16) != AOT_PROFILER_MAJOR_VERSION || version > expected_version) {
 		printf ("Profile file has wrong version 0x%4x, expected 0x%4x.\n", version, expected_version);
 		fclose (infile);
 		exit (1);
@@ -12978,6 +13098,7 @@ load_profile_file (MonoAotCompile *acfg, char *filename)
 	data->classes = g_hash_table_new (NULL, NULL);
 	data->ginsts = g_hash_table_new (NULL, NULL);
 	data->methods = g_hash_table_new (NULL, NULL);
+	data->wrappers = g_ptr_array_new ();
 
 	while (TRUE) {
 		int type = profread_byte (infile);
@@ -13052,29 +13173,20 @@ load_profile_file (MonoAotCompile *acfg, char *filename)
 			break;
 		}
 		case AOTPROF_RECORD_METHOD: {
-			int class_id = profread_int (infile);
-			int ginst_id = profread_int (infile);
-			int param_count = profread_int (infile);
-			char *method_name = profread_string (infile);
-			char *sig = profread_string (infile);
-
-			ClassProfileData *klass = (ClassProfileData*)g_hash_table_lookup (data->classes, GINT_TO_POINTER (class_id));
-			g_assert (klass);
-
-			MethodProfileData *mdata = g_new0 (MethodProfileData, 1);
-			mdata->id = id;
-			mdata->klass = klass;
-			mdata->name = method_name;
-			mdata->signature = sig;
-			mdata->param_count = param_count;
-
-			if (ginst_id != -1) {
-				mdata->inst = (GInstProfileData*)g_hash_table_lookup (data->ginsts, GINT_TO_POINTER (ginst_id));
-				g_assert (mdata->inst);
-			}
+			MethodProfileData *mdata = profread_method (infile, data, id);
+
 			g_hash_table_insert (data->methods, GINT_TO_POINTER (id), mdata);
 			break;
 		}
+		case AOTPROF_RECORD_WRAPPER: {
+			WrapperProfileData *wdata = g_new0 (WrapperProfileData, 1);
+			wdata->id = id;
+			wdata->kind = (AotProfWrapperKind)profread_byte (infile);
+			wdata->method = profread_method (infile, data, id);
+
+			g_ptr_array_add (data->wrappers, wdata);
+			break;
+		}
 		default:
 			printf ("%d\n", type);
 			g_assert_not_reached ();
@@ -13144,6 +13256,76 @@ resolve_class (ClassProfileData *cdata)
 	}
 }
 
+static void
+resolve_method (MonoAotCompile *acfg, MethodProfileData *mdata)
+{
+	MonoClass *klass;
+	MonoMethod *m;
+	gpointer miter;
+
+	resolve_class (mdata->klass);
+	klass = mdata->klass->klass;
+	if (!klass) {
+		if (acfg->aot_opts.verbose)
+			printf ("Unable to load method '%s' because its class '%s.%s' is not loaded.\n", mdata->name, mdata->klass->ns, mdata->klass->name);
+		return;
+	}
+
+	miter = NULL;
+	while ((m = mono_class_get_methods (klass, &miter))) {
+		ERROR_DECL (error);
+
+		if (strcmp (m->name, mdata->name))
+			continue;
+
+		MonoMethodSignature *sig = mono_method_signature_internal (m);
+		if (!sig)
+			continue;
+		if (sig->param_count != mdata->param_count)
+			continue;
+		if (mdata->inst) {
+			resolve_ginst (mdata->inst);
+			if (mdata->inst->inst) {
+				MonoGenericContext ctx;
+
+				if (m->is_generic && mono_method_get_generic_container (m)->context.method_inst->type_argc != mdata->inst->inst->type_argc)
+					continue;
+
+				memset (&ctx, 0, sizeof (ctx));
+				ctx.method_inst = mdata->inst->inst;
+
+				m = mono_class_inflate_generic_method_checked (m, &ctx, error);
+				if (!m)
+					continue;
+				sig = mono_method_signature_checked (m, error);
+				if (!is_ok (error)) {
+					mono_error_cleanup (error);
+					continue;
+				}
+			} else {
+				/* Use the generic definition */
+				mdata->method = m;
+				break;
+			}
+		}
+		char *sig_str = mono_signature_full_name (sig);
+		gboolean match = !strcmp (sig_str, mdata->signature);
+		g_free (sig_str);
+		if (!match) {
+			// The signature might not match for methods on gtds
+			if (!mono_class_is_gtd (klass))
+				continue;
+		}
+		//printf ("%s\n", mono_method_full_name (m, 1));
+		mdata->method = m;
+		break;
+	}
+	if (!mdata->method) {
+		if (acfg->aot_opts.verbose)
+			printf ("Unable to load method '%s' from class '%s', not found.\n", mdata->name, mono_class_full_name (klass));
+	}
+}
+
 /*
  * Resolve the profile data to the corresponding loaded classes/methods etc. if possible.
  */
@@ -13198,74 +13380,12 @@ resolve_profile_data (MonoAotCompile *acfg, ProfileData *data, MonoAssembly* cur
 
 	/* Methods */
 	g_hash_table_iter_init (&iter, data->methods);
-	while (g_hash_table_iter_next (&iter, &key, &value)) {
-		MethodProfileData *mdata = (MethodProfileData*)value;
-		MonoClass *klass;
-		MonoMethod *m;
-		gpointer miter;
-
-		resolve_class (mdata->klass);
-		klass = mdata->klass->klass;
-		if (!klass) {
-			if (acfg->aot_opts.verbose)
-				printf ("Unable to load method '%s' because its class '%s.%s' is not loaded.\n", mdata->name, mdata->klass->ns, mdata->klass->name);
-			continue;
-		}
-
-		miter = NULL;
-		while ((m = mono_class_get_methods (klass, &miter))) {
-			ERROR_DECL (error);
-
-			if (strcmp (m->name, mdata->name))
-				continue;
+	while (g_hash_table_iter_next (&iter, &key, &value))
+		resolve_method (acfg, (MethodProfileData*)value);
 
-			MonoMethodSignature *sig = mono_method_signature_internal (m);
-			if (!sig)
-				continue;
-			if (sig->param_count != mdata->param_count)
-				continue;
-			if (mdata->inst) {
-				resolve_ginst (mdata->inst);
-				if (mdata->inst->inst) {
-					MonoGenericContext ctx;
-
-					if (m->is_generic && mono_method_get_generic_container (m)->context.method_inst->type_argc != mdata->inst->inst->type_argc)
-						continue;
-
-					memset (&ctx, 0, sizeof (ctx));
-					ctx.method_inst = mdata->inst->inst;
-
-					m = mono_class_inflate_generic_method_checked (m, &ctx, error);
-					if (!m)
-						continue;
-					sig = mono_method_signature_checked (m, error);
-					if (!is_ok (error)) {
-						mono_error_cleanup (error);
-						continue;
-					}
-				} else {
-					/* Use the generic definition */
-					mdata->method = m;
-					break;
-				}
-			}
-			char *sig_str = mono_signature_full_name (sig);
-			gboolean match = !strcmp (sig_str, mdata->signature);
-			g_free (sig_str);
-			if (!match) {
-				// The signature might not match for methods on gtds
-				if (!mono_class_is_gtd (klass))
-					continue;
-			}
-			//printf ("%s\n", mono_method_full_name (m, 1));
-			mdata->method = m;
-			break;
-		}
-		if (!mdata->method) {
-			if (acfg->aot_opts.verbose)
-				printf ("Unable to load method '%s' from class '%s', not found.\n", mdata->name, mono_class_full_name (klass));
-		}
-	}
+	/* Wrappers */
+	for (guint i = 0; i < data->wrappers->len; ++i)
+		resolve_method (acfg, ((WrapperProfileData*)g_ptr_array_index (data->wrappers, i))->method);
 }
 
 static gboolean
@@ -13299,6 +13419,7 @@ static void
 add_profile_method (MonoAotCompile *acfg, MonoMethod *m)
 {
 	g_hash_table_insert (acfg->profile_methods, m, m);
+	set_profile_rank (acfg, m, ++acfg->profile_method_count);
 	add_extra_method (acfg, m);
 }
 
@@ -13366,24 +13487,99 @@ add_single_profile_method (MonoAotCompile *acfg, MonoMethod *method)
 	return 0;
 }
 
+/*
+ * add_profile_wrapper:
+ *
+ *   Prebuild a wrapper the profiled app had to generate at runtime. Like instances,
+ * wrappers are added to the image of the wrapped method, or to an image referenced by
+ * its instantiation.
+ */
+static int
+add_profile_wrapper (MonoAotCompile *acfg, WrapperProfileData *wdata)
+{
+	MonoMethod *method = wdata->method->method;
+	MonoMethod *wrapper;
+
+	if (!method || method->is_generic || mono_class_is_open_constructed_type (m_class_get_byval_arg (method->klass)))
+		return 0;
+
+	if (m_class_get_image (method->klass) != acfg->image) {
+		MonoGenericContext *ctx = method->is_inflated ? mono_method_get_context (method) : NULL;
+
+		if (!ctx)
+			return 0;
+		if (!((ctx->class_inst && inst_references_image (ctx->class_inst, acfg->image)) ||
+			  (ctx->method_inst && inst_references_image (ctx->method_inst, acfg->image))))
+			return 0;
+	}
+
+	switch (wdata->kind) {
+	case AOTPROF_WRAPPER_RUNTIME_INVOKE:
+		if (acfg->aot_opts.llvm_only)
+			/* Supported by the gsharedvt based runtime-invoke wrapper */
+			return 0;
+		wrapper = get_runtime_invoke (acfg, method, FALSE);
+		break;
+	case AOTPROF_WRAPPER_DELEGATE_INVOKE:
+		if (!m_class_is_delegate (method->klass))
+			return 0;
+		wrapper = mono_marshal_get_delegate_invoke (method, NULL);
+		break;
+	case AOTPROF_WRAPPER_MANAGED_TO_NATIVE:
+		if (!(method->flags & METHOD_ATTRIBUTE_PINVOKE_IMPL))
+			return 0;
+		wrapper = mono_marshal_get_native_wrapper (method, TRUE, TRUE);
+		break;
+	default:
+		return 0;
+	}
+
+	add_profile_method (acfg, wrapper);
+	return 1;
+}
+
+static int
+compare_method_profile_data (gconstpointer a, gconstpointer b)
+{
+	const MethodProfileData *mdata1 = *(const MethodProfileData**)a;
+	const MethodProfileData *mdata2 = *(const MethodProfileData**)b;
+
+	return mdata1->id - mdata2->id;
+}
+
 static void
 add_profile_instances (MonoAotCompile *acfg, ProfileData *data)
 {
 	GHashTableIter iter;
 	gpointer key, value;
+	GPtrArray *methods;
 	int count = 0;
 
 	if (!data)
 		return;
 
+	/* Record ids follow the order in which the profiled app JITted the methods */
+	methods = g_ptr_array_new ();
 	g_hash_table_iter_init (&iter, data->methods);
-	while (g_hash_table_iter_next (&iter, &key, &value)) {
-		MethodProfileData *mdata = (MethodProfileData*)value;
+	while (g_hash_table_iter_next (&iter, &key, &value))
+		g_ptr_array_add (methods, value);
+	g_ptr_array_sort (methods, compare_method_profile_data);
+
+	for (guint i = 0; i < methods->len; ++i) {
+		MethodProfileData *mdata = (MethodProfileData*)g_ptr_array_index (methods, i);
 		MonoMethod *m = mdata->method;
 		count += add_single_profile_method (acfg, m);
 	}
+	g_ptr_array_free (methods, TRUE);
 
 	printf ("Added %d methods from profile.\n", count);
+
+	if (data->wrappers->len) {
+		count = 0;
+		for (guint i = 0; i < data->wrappers->len; ++i)
+			count += add_profile_wrapper (acfg, (WrapperProfileData*)g_ptr_array_index (data->wrappers, i));
+		printf ("Added %d wrappers from profile.\n", count);
+	}
 }
 
 typedef enum {
@@ -13695,6 +13891,7 @@ acfg_create (MonoAssembly *ass, guint32 jit_opts)
 	acfg->gsharedvt_in_signatures = g_hash_table_new ((GHashFunc)mono_signature_hash, (GEqualFunc)mono_metadata_signature_equal);
 	acfg->gsharedvt_out_signatures = g_hash_table_new ((GHashFunc)mono_signature_hash, (GEqualFunc)mono_metadata_signature_equal);
 	acfg->profile_methods = g_hash_table_new (NULL, NULL);
+	acfg->profile_method_ranks = g_hash_table_new (NULL, NULL);
 	acfg->gshared_instances = g_hash_table_new (NULL, NULL);
 	acfg->prefer_instances = g_hash_table_new (NULL, NULL);
 	mono_os_mutex_init_recursive (&acfg->mutex);
@@ -14707,6 +14904,9 @@ mono_compile_assembly (MonoAssembly *ass, guint32 opts, const char *aot_options,
 
 	dedup_skip_methods (acfg);
 
+	if (acfg->profile_method_count)
+		sort_method_order_by_profile (acfg);
+
 	if (acfg->aot_opts.dedup_include && !is_dedup_dummy)
 		/* We only collected methods from this assembly */
 		return 0;
@@ -1,5 +1,6 @@
 using System;
 using System.Reflection;
+using System.Runtime.CompilerServices;
 
 /*
  * Regression tests for the mono JIT.
@@ -342,4 +343,38 @@ public static unsafe int test_0_ptr_return ()
 	    int res = arm64_stack_arg_reg_sbyte (null, null, null, null, null, null, null, -4, -7);
 		return res == -22 ? 0 : 1;
 	}
+
+	unsafe static class LdlocaGlobalVar {
+		static int *saved;
+
+		[MethodImplAttribute (MethodImplOptions.NoInlining)]
+		static void Save (ref int v) {
+			saved = (int*)Unsafe.AsPointer (ref v);
+		}
+
+		[MethodImplAttribute (MethodImplOptions.NoInlining)]
+		static int Load () {
+			return *saved;
+		}
+
+		// Once inlined, x is a var used in several basic blocks before its address is taken, and y is
+		// only used after the last direct use of x. x must keep its own offset since it is still
+		// read through the saved pointer while y is alive.
+		[MethodImplAttribute (MethodImplOptions.AggressiveInlining)]
+		public static int Escape (int n) {
+			int x = n * 3;
+			if (n > 1)
+				x += 1;
+			Save (ref x);
+			int y = n + 100;
+			for (int i = 0; i < n; i++)
+				y += i;
+			return Load () * 1000 + y;
+		}
+	}
+
+	// interp regression test for the offset allocation of global vars
+	public static int test_16115_ldloca_global_var_disjoint_live_range () {
+		return LdlocaGlobalVar.Escape (5);
+	}
 }
@@ -1,6 +1,7 @@
 using System;
 using System.Numerics;
 using System.Runtime.CompilerServices;
+using System.Runtime.Intrinsics;
 
 /*
  * Tests for the SIMD intrinsics in the System.Numerics.Vectors assembly.
@@ -1420,4 +1421,258 @@ public class VectorTests {
 		}
 		return 0;
 	}
+
+	//
+	// Vector128 tests, the interpreter replaces most of these operations with MINT_SIMD_* opcodes
+	//
+
+	static bool v128_check<T> (Vector128<T> v, params T[] expected) where T: struct {
+		for (int i = 0; i < Vector128<T>.Count; ++i)
+			if (!v.GetElement (i).Equals (expected [i]))
+				return false;
+		return true;
+	}
+
+	public static int test_0_vector128_create () {
+		if (!v128_check<byte> (Vector128.Create ((byte)7), 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7))
+			return 1;
+		if (!v128_check<short> (Vector128.Create ((short)-3), -3, -3, -3, -3, -3, -3, -3, -3))
+			return 2;
+		if (!v128_check (Vector128.Create (5u), 5u, 5u, 5u, 5u))
+			return 3;
+		if (!v128_check (Vector128.Create (-9L), -9L, -9L))
+			return 4;
+		if (!v128_check (Vector128.Create (1.5f), 1.5f, 1.5f, 1.5f, 1.5f))
+			return 5;
+		if (!v128_check (Vector128.Create (-2.25), -2.25, -2.25))
+			return 6;
+		return 0;
+	}
+
+	public static int test_0_vector128_zero_all_bits_set () {
+		if (!v128_check (Vector128<int>.Zero, 0, 0, 0, 0))
+			return 1;
+		if (!v128_check (Vector128<int>.AllBitsSet, -1, -1, -1, -1))
+			return 2;
+		if (!v128_check (Vector128<ulong>.AllBitsSet, ulong.MaxValue, ulong.MaxValue))
+			return 3;
+		return 0;
+	}
+
+	public static int test_0_vector128_to_scalar () {
+		if (Vector128.Create (1, 2, 3, 4).ToScalar () != 1)
+			return 1;
+		if (Vector128.Create ((sbyte)-5).ToScalar () != -5)
+			return 2;
+		if (Vector128.Create (3.5, 4.5).ToScalar () != 3.5)
+			return 3;
+		if (Vector128.Create (ulong.MaxValue, 0).ToScalar () != ulong.MaxValue)
+			return 4;
+		return 0;
+	}
+
+	public static int test_0_vector128_int_arithmetic () {
+		var v1 = Vector128.Create (1, -2, int.MaxValue, 40);
+		var v2 = Vector128.Create (3, 5, 1, -4);
+
+		if (!v128_check (v1 + v2, 4, 3, int.MinValue, 36))
+			return 1;
+		if (!v128_check (v1 - v2, -2, -7, int.MaxValue - 1, 44))
+			return 2;
+		if (!v128_check (v1 * v2, 3, -10, int.MaxValue, -160))
+			return 3;
+		if (!v128_check (-v1, -1, 2, -int.MaxValue, -40))
+			return 4;
+		if (!v128_check (~v1, -2, 1, int.MinValue, -41))
+			return 5;
+		return 0;
+	}
+
+	public static int test_0_vector128_byte_wraparound () {
+		var v1 = Vector128.Create ((byte)250);
+		var v2 = Vector128.Create ((byte)10);
+
+		if (!v128_check<byte> (v1 + v2, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4))
+			return 1;
+		if (!v128_check<byte> (v2 - v1, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16))
+			return 2;
+		if (!v128_check<byte> (v1 * v2, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196))
+			return 3;
+		return 0;
+	}
+
+	public static int test_0_vector128_long_arithmetic () {
+		var v1 = Vector128.Create (long.MinValue, 1L << 40);
+		var v2 = Vector128.Create (-1L, 3L);
+
+		if (!v128_check (v1 + v2, long.MaxValue, (1L << 40) + 3))
+			return 1;
+		if (!v128_check (v1 * v2, long.MinValue, 3L << 40))
+			return 2;
+		if (!v128_check (-v2, 1L, -3L))
+			return 3;
+		return 0;
+	}
+
+	public static int test_0_vector128_float_arithmetic () {
+		var v1 = Vector128.Create (1.0f, -2.5f, 8.0f, 0.0f);
+		var v2 = Vector128.Create (0.5f, 2.0f, -4.0f, 3.0f);
+
+		if (!v128_check (v1 + v2, 1.5f, -0.5f, 4.0f, 3.0f))
+			return 1;
+		if (!v128_check (v1 - v2, 0.5f, -4.5f, 12.0f, -3.0f))
+			return 2;
+		if (!v128_check (v1 * v2, 0.5f, -5.0f, -32.0f, 0.0f))
+			return 3;
+		if (!v128_check (v1 / v2, 2.0f, -1.25f, -2.0f, 0.0f))
+			return 4;
+		if (!v128_check (-v1, -1.0f, 2.5f, -8.0f, -0.0f))
+			return 5;
+		if (!float.IsNegative ((-v1).GetElement (3)))
+			return 6;
+		var d = Vector128.Create (1.0, -6.0) / Vector128.Create (4.0, 0.0);
+		if (!v128_check (d, 0.25, double.NegativeInfinity))
+			return 7;
+		return 0;
+	}
+
+	public static int test_0_vector128_bitwise () {
+		var v1 = Vector128.Create (0x0f0f0f0fu, 0xffffffffu, 0u, 0x12345678u);
+		var v2 = Vector128.Create (0x00ff00ffu, 0x0000ffffu, 0xffffffffu, 0x12345678u);
+
+		if (!v128_check (v1 & v2, 0x000f000fu, 0x0000ffffu, 0u, 0x12345678u))
+			return 1;
+		if (!v128_check (v1 | v2, 0x0fff0fffu, 0xffffffffu, 0xffffffffu, 0x12345678u))
+			return 2;
+		if (!v128_check (v1 ^ v2, 0x0ff00ff0u, 0xffff0000u, 0xffffffffu, 0u))
+			return 3;
+		if (!v128_check (Vector128.AndNot (v1, v2), 0x0f000f00u, 0xffff0000u, 0u, 0u))
+			return 4;
+		// Bitwise operations on floats work on the bits of the elements
+		var f = Vector128.Create (-1.0f, 2.0f, -3.0f, 4.0f) & Vector128.Create (0x7fffffff).AsSingle ();
+		if (!v128_check (f, 1.0f, 2.0f, 3.0f, 4.0f))
+			return 5;
+		return 0;
+	}
+
+	public static int test_0_vector128_min_max () {
+		var s1 = Vector128.Create ((sbyte)-1, 2, -128, 127, 0, 5, -5, 1, 1, 1, 1, 1, 1, 1, 1, 1);
+		var s2 = Vector128.Create ((sbyte)1, -2, 127, -128, 0, 6, -6, 1, 1, 1, 1, 1, 1, 1, 1, 1);
+		if (!v128_check<sbyte> (Vector128.Min (s1, s2), -1, -2, -128, -128, 0, 5, -6, 1, 1, 1, 1, 1, 1, 1, 1, 1))
+			return 1;
+		if (!v128_check<sbyte> (Vector128.Max (s1, s2), 1, 2, 127, 127, 0, 6, -5, 1, 1, 1, 1, 1, 1, 1, 1, 1))
+			return 2;
+		// The same bits compare differently as unsigned elements
+		var u1 = s1.AsByte ();
+		var u2 = s2.AsByte ();
+		if (Vector128.Min (u1, u2).GetElement (0) != 1 || Vector128.Max (u1, u2).GetElement (0) != 255)
+			return 3;
+		if (Vector128.Min (u1, u2).GetElement (2) != 127 || Vector128.Max (u1, u2).GetElement (2) != 128)
+			return 4;
+		var l = Vector128.Min (Vector128.Create (ulong.MaxValue, 3UL), Vector128.Create (1UL, 4UL));
+		if (!v128_check (l, 1UL, 3UL))
+			return 5;
+		return 0;
+	}
+
+	public static int test_0_vector128_comparisons () {
+		var v1 = Vector128.Create (1, -1, 3, 4);
+		var v2 = Vector128.Create (1, 1, 2, 5);
+
+		if (!v128_check (Vector128.Equals (v1, v2), -1, 0, 0, 0))
+			return 1;
+		if (!v128_check (Vector128.GreaterThan (v1, v2), 0, 0, -1, 0))
+			return 2;
+		if (!v128_check (Vector128.GreaterThanOrEqual (v1, v2), -1, 0, -1, 0))
+			return 3;
+		if (!v128_check (Vector128.LessThan (v1, v2), 0, -1, 0, -1))
+			return 4;
+		if (!v128_check (Vector128.LessThanOrEqual (v1, v2), -1, -1, 0, -1))
+			return 5;
+		// -1 is the largest value as an unsigned element
+		if (!v128_check (Vector128.GreaterThan (v1.AsUInt32 (), v2.AsUInt32 ()), 0u, uint.MaxValue, uint.MaxValue, 0u))
+			return 6;
+		var f = Vector128.LessThan (Vector128.Create (1.0f, float.NaN, -0.0f, 2.0f), Vector128.Create (2.0f, 1.0f, 0.0f, 1.0f));
+		if (!v128_check (f.AsInt32 (), -1, 0, 0, 0))
+			return 7;
+		return 0;
+	}
+
+	public static int test_0_vector128_equals_all_any () {
+		var v1 = Vector128.Create ((short)1, 2, 3, 4, 5, 6, 7, 8);
+		var v2 = Vector128.Create ((short)1, 2, 3, 4, 5, 6, 7, 9);
+
+		if (!Vector128.EqualsAll (v1, v1) || Vector128.EqualsAll (v1, v2))
+			return 1;
+		if (!Vector128.EqualsAny (v1, v2) || Vector128.EqualsAny (v1, Vector128<short>.Zero))
+			return 2;
+		if (v1 == v2 || !(v1 != v2) || v1 != v1)
+			return 3;
+		// NaN is not equal to itself
+		var nan = Vector128.Create (double.NaN, 1.0);
+		if (Vector128.EqualsAll (nan, nan) || !Vector128.EqualsAny (nan, nan))
+			return 4;
+		return 0;
+	}
+
+	public static int test_0_vector128_extract_msb () {
+		if (Vector128.Create ((sbyte)-1, 1, -1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -128).ExtractMostSignificantBits () != 0x8005u)
+			return 1;
+		if (Vector128.Create ((ushort)0x8000, 0, 0, 0xffff, 0, 0, 0, 1).ExtractMostSignificantBits () != 0x9u)
+			return 2;
+		if (Vector128.Create (-1.0f, 1.0f, -0.0f, 0.0f).ExtractMostSignificantBits () != 0x5u)
+			return 3;
+		if (Vector128.Create (0L, long.MinValue).ExtractMostSignificantBits () != 0x2u)
+			return 4;
+		return 0;
+	}
+
+	public static int test_0_vector128_shuffle () {
+		var b = Vector128.Create ((byte)0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+		var bi = Vector128.Create ((byte)15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 16);
+		// Out of range indices select 0
+		if (!v128_check<byte> (Vector128.Shuffle (b, bi), 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0))
+			return 1;
+		var i = Vector128.Create (10, 20, 30, 40);
+		if (!v128_check (Vector128.Shuffle (i, Vector128.Create (3, 3, 0, -1)), 40, 40, 10, 0))
+			return 2;
+		var d = Vector128.Create (1.5, 2.5);
+		if (!v128_check (Vector128.Shuffle (d, Vector128.Create (1L, 0L)), 2.5, 1.5))
+			return 3;
+		return 0;
+	}
+
+	public static int test_0_vector128_conditional_select () {
+		var mask = Vector128.Create (-1, 0, 0x0000ffff, 0);
+		var v = Vector128.ConditionalSelect (mask, Vector128.Create (0x11111111), Vector128.Create (0x22222222));
+		if (!v128_check (v, 0x11111111, 0x22222222, 0x22221111, 0x22222222))
+			return 1;
+		var f = Vector128.ConditionalSelect (Vector128.GreaterThan (Vector128.Create (1.0f, 5.0f, 2.0f, 8.0f), Vector128.Create (3.0f)),
+			Vector128.Create (1.0f), Vector128.Create (-1.0f));
+		if (!v128_check (f, -1.0f, 1.0f, -1.0f, 1.0f))
+			return 2;
+		return 0;
+	}
+
+	[MethodImplAttribute (MethodImplOptions.NoInlining)]
+	static int v128_sum (int[] arr) {
+		var acc = Vector128<int>.Zero;
+		int i = 0;
+		for (; i + Vector128<int>.Count <= arr.Length; i += Vector128<int>.Count)
+			acc += Vector128.Create (arr [i], arr [i + 1], arr [i + 2], arr [i + 3]);
+		int sum = 0;
+		for (int j = 0; j < Vector128<int>.Count; ++j)
+			sum += acc.GetElement (j);
+		for (; i < arr.Length; ++i)
+			sum += arr [i];
+		return sum;
+	}
+
+	public static int test_0_vector128_loop () {
+		var arr = new int [19];
+		for (int i = 0; i < arr.Length; ++i)
+			arr [i] = i * 3 - 7;
+		// sum of 3i - 7 for i in 0..18
+		return v128_sum (arr) == 3 * 171 - 7 * 19 ? 0 : 1;
+	}
 }
@@ -1611,6 +1611,7 @@ mini_usage (void)
 		"    --attach=OPTIONS       Pass OPTIONS to the attach agent in the runtime.\n"
 		"                           Currently the only supported option is 'disable'.\n"
 		"    --llvm, --nollvm       Controls whenever the runtime uses LLVM to compile code.\n"
+		"    --llvm-tiered          JIT methods with the mini JIT first and recompile hot ones with LLVM.\n"
 	        "    --gc=[sgen,boehm]      Select SGen or Boehm GC (runs mono or mono-sgen)\n"
 #ifdef TARGET_OSX
 		"    --arch=[32,64]         Select architecture (runs mono32 or mono64)\n"
@@ -1841,6 +1842,14 @@ mono_jit_parse_options (int argc, char * argv[])
 			fprintf (stderr, "Mono Warning: --llvm not enabled in this runtime.\n");
 #else
 			mono_use_llvm = TRUE;
+#endif
+		} else if (strcmp (argv [i], "--llvm-tiered") == 0) {
+#ifndef MONO_ARCH_LLVM_SUPPORTED
+			fprintf (stderr, "Mono Warning: --llvm-tiered not supported on this platform.\n");
+#elif !defined(ENABLE_LLVM) || !defined(ENABLE_EXPERIMENT_TIERED)
+			fprintf (stderr, "Mono Warning: --llvm-tiered not enabled in this runtime.\n");
+#else
+			mono_llvm_tiered = TRUE;
 #endif
 		} else if (strcmp (argv [i], "--profile") == 0) {
 			mini_add_profiler_argument (NULL);
@@ -2407,6 +2416,14 @@ mono_main (int argc, char* argv[])
 			fprintf (stderr, "Mono Warning: --llvm not enabled in this runtime.\n");
 #else
 			mono_use_llvm = TRUE;
+#endif
+		} else if (strcmp (argv [i], "--llvm-tiered") == 0) {
+#ifndef MONO_ARCH_LLVM_SUPPORTED
+			fprintf (stderr, "Mono Warning: --llvm-tiered not supported on this platform.\n");
+#elif !defined(ENABLE_LLVM) || !defined(ENABLE_EXPERIMENT_TIERED)
+			fprintf (stderr, "Mono Warning: --llvm-tiered not enabled in this runtime.\n");
+#else
+			mono_llvm_tiered = TRUE;
 #endif
 		} else if (strcmp (argv [i], "--nollvm") == 0){
 			mono_use_llvm = FALSE;
@@ -58,6 +58,12 @@ typedef gint64  mono_i;
 #define INTERP_NO_STACK_SCAN 1
 #endif
 
+// The MINT_SIMD_* opcodes are left out, like the rest of the SIMD support, when the runtime is configured
+// with DISABLE_SIMD. They are implemented with the vector extensions of gcc and clang, which MSVC lacks.
+#if !defined(DISABLE_SIMD) && (!defined(_MSC_VER) || defined(__clang__))
+#define INTERP_ENABLE_SIMD 1
+#endif
+
 /*
  * Value types are represented on the eval stack as pointers to the
  * actual storage. A value type cannot be larger than 16 MB.
@@ -165,6 +171,11 @@ struct InterpMethod {
 	//
 	// Since we have both positive and negative keys in this array, we use G_MAXINTRE as terminator.
 	int *patchpoint_data;
+	// Pairs of (il_offset, data item index) of the inline caches of MINT_CALLVIRT_FAST call
+	// sites, terminated by G_MAXINT32. When the method is tiered up, the caches of the optimized
+	// method are seeded with the receiver types seen by the unoptimized method at the same IL
+	// offset, so they don't have to be warmed up again.
+	int *callvirt_cache_sites;
 	unsigned int init_locals : 1;
 	unsigned int vararg : 1;
 	unsigned int optimized : 1;
@@ -175,6 +186,22 @@ struct InterpMethod {
 #endif
 };
 
+#define INTERP_CALLVIRT_CACHE_SIZE 4
+
+/*
+ * Inline cache of a MINT_CALLVIRT_FAST call site, mapping the receiver vtables seen at the site
+ * to the called methods. A cache is not modified once published, except for the targets which
+ * are registered as tiering patch sites. A miss publishes a copy with one more entry, until the
+ * cache is full.
+ */
+typedef struct {
+	int count;
+	struct {
+		MonoVTable *vtable;
+		gpointer target;
+	} entries [INTERP_CALLVIRT_CACHE_SIZE];
+} InterpCallVirtCache;
+
 /* Used for localloc memory allocation */
 typedef struct _FrameDataFragment FrameDataFragment;
 struct _FrameDataFragment {
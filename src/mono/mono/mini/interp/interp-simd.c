@@ -0,0 +1,266 @@
+/*
+ * Implementation of the Vector128 operations executed by the MINT_SIMD_INTRINS_* opcodes.
+ *
+ * Vectors live in interpreter locals, which are only aligned to MINT_VT_ALIGNMENT, so they
+ * are copied in and out of vector typed temporaries. Compilers turn these copies into
+ * unaligned vector loads and stores and the operations themselves into the vector
+ * instructions of the target, like wasm SIMD128 when building with -msimd128.
+ */
+
+#include "config.h"
+#include <string.h>
+
+#include "interp-simd.h"
+
+#ifdef INTERP_ENABLE_SIMD
+
+#ifdef __wasm_simd128__
+#include <wasm_simd128.h>
+#endif
+
+typedef gint8 v128_i1 __attribute__ ((vector_size (SIZEOF_V128)));
+typedef guint8 v128_u1 __attribute__ ((vector_size (SIZEOF_V128)));
+typedef gint16 v128_i2 __attribute__ ((vector_size (SIZEOF_V128)));
+typedef guint16 v128_u2 __attribute__ ((vector_size (SIZEOF_V128)));
+typedef gint32 v128_i4 __attribute__ ((vector_size (SIZEOF_V128)));
+typedef guint32 v128_u4 __attribute__ ((vector_size (SIZEOF_V128)));
+typedef gint64 v128_i8 __attribute__ ((vector_size (SIZEOF_V128)));
+typedef guint64 v128_u8 __attribute__ ((vector_size (SIZEOF_V128)));
+typedef float v128_r4 __attribute__ ((vector_size (SIZEOF_V128)));
+typedef double v128_r8 __attribute__ ((vector_size (SIZEOF_V128)));
+
+#define V128_LOAD(v,ptr) memcpy (&(v), (ptr), SIZEOF_V128)
+#define V128_STORE(ptr,v) memcpy ((ptr), &(v), SIZEOF_V128)
+
+#define V128_UNOP(name,vtype,rtype,expr) \
+static void \
+interp_v128_ ## name (gpointer res, gpointer v1) \
+{ \
+	vtype a; \
+	rtype r; \
+	V128_LOAD (a, v1); \
+	r = (rtype)(expr); \
+	V128_STORE (res, r); \
+}
+
+#define V128_BINOP(name,vtype,rtype,expr) \
+static void \
+interp_v128_ ## name (gpointer res, gpointer v1, gpointer v2) \
+{ \
+	vtype a, b; \
+	rtype r; \
+	V128_LOAD (a, v1); \
+	V128_LOAD (b, v2); \
+	r = (rtype)(expr); \
+	V128_STORE (res, r); \
+}
+
+// Ops on the bits of the vector, used for all element types
+
+V128_UNOP (ones_complement, v128_u8, v128_u8, ~a)
+V128_BINOP (and, v128_u8, v128_u8, a & b)
+V128_BINOP (or, v128_u8, v128_u8, a | b)
+V128_BINOP (xor, v128_u8, v128_u8, a ^ b)
+V128_BINOP (and_not, v128_u8, v128_u8, a & ~b)
+
+static void
+interp_v128_conditional_select (gpointer res, gpointer v1, gpointer v2, gpointer v3)
+{
+	v128_u8 mask, a, b, r;
+	V128_LOAD (mask, v1);
+	V128_LOAD (a, v2);
+	V128_LOAD (b, v3);
+	r = (a & mask) | (b & ~mask);
+	V128_STORE (res, r);
+}
+
+// Comparisons produce vectors of signed integers with all bits set in the matching elements
+
+#define V128_EQUALS_ALL(t,vtype,mtype,count) \
+static void \
+interp_v128_ ## t ## _equals_all (gpointer res, gpointer v1, gpointer v2) \
+{ \
+	vtype a, b; \
+	V128_LOAD (a, v1); \
+	V128_LOAD (b, v2); \
+	mtype m = (mtype)(a == b); \
+	gint32 r = 1; \
+	for (int i = 0; i < count; i++) \
+		r &= m [i] != 0; \
+	*(gint32*)res = r; \
+} \
+\
+static void \
+interp_v128_ ## t ## _not_equals_all (gpointer res, gpointer v1, gpointer v2) \
+{ \
+	interp_v128_ ## t ## _equals_all (res, v1, v2); \
+	*(gint32*)res = !*(gint32*)res; \
+} \
+\
+static void \
+interp_v128_ ## t ## _equals_any (gpointer res, gpointer v1, gpointer v2) \
+{ \
+	vtype a, b; \
+	V128_LOAD (a, v1); \
+	V128_LOAD (b, v2); \
+	mtype m = (mtype)(a == b); \
+	gint32 r = 0; \
+	for (int i = 0; i < count; i++) \
+		r |= m [i] != 0; \
+	*(gint32*)res = r; \
+}
+
+#ifdef __wasm_simd128__
+#define V128_EXTRACT_MSB(t,mtype,count,wasm_bitmask) \
+static void \
+interp_v128_ ## t ## _extract_msb (gpointer res, gpointer v1) \
+{ \
+	*(guint32*)res = wasm_bitmask (wasm_v128_load (v1)); \
+}
+#else
+#define V128_EXTRACT_MSB(t,mtype,count,wasm_bitmask) \
+static void \
+interp_v128_ ## t ## _extract_msb (gpointer res, gpointer v1) \
+{ \
+	mtype a; \
+	V128_LOAD (a, v1); \
+	guint32 r = 0; \
+	for (int i = 0; i < count; i++) \
+		r |= (guint32)(a [i] < 0) << i; \
+	*(guint32*)res = r; \
+}
+#endif
+
+// Elements whose index is out of range are set to zero
+#define V128_SHUFFLE(t,vtype,itype,count) \
+static void \
+interp_v128_ ## t ## _shuffle (gpointer res, gpointer v1, gpointer v2) \
+{ \
+	vtype a, r; \
+	itype indices; \
+	V128_LOAD (a, v1); \
+	V128_LOAD (indices, v2); \
+	for (int i = 0; i < count; i++) \
+		r [i] = indices [i] < count ? a [indices [i]] : 0; \
+	V128_STORE (res, r); \
+}
+
+#ifdef __wasm_simd128__
+#define V128_SHUFFLE_BYTES(t,vtype,itype,count) \
+static void \
+interp_v128_ ## t ## _shuffle (gpointer res, gpointer v1, gpointer v2) \
+{ \
+	wasm_v128_store (res, wasm_i8x16_swizzle (wasm_v128_load (v1), wasm_v128_load (v2))); \
+}
+#else
+#define V128_SHUFFLE_BYTES V128_SHUFFLE
+#endif
+
+// Scalars are read from and written to locals of the stack type of the element type, so
+// small integers are widened to 32 bits
+#define V128_SCALAR_OPS(t,ctype,vtype,stype,count) \
+static void \
+interp_v128_ ## t ## _create (gpointer res, gpointer v1) \
+{ \
+	ctype s = (ctype)*(stype*)v1; \
+	vtype r; \
+	for (int i = 0; i < count; i++) \
+		r [i] = s; \
+	V128_STORE (res, r); \
+} \
+\
+static void \
+interp_v128_ ## t ## _to_scalar (gpointer res, gpointer v1) \
+{ \
+	vtype a; \
+	V128_LOAD (a, v1); \
+	*(stype*)res = (stype)a [0]; \
+}
+
+// Integer arithmetic is done on unsigned elements, so that overflow wraps around
+#define V128_COMMON_OPS(t,ctype,vtype,atype,mtype,stype,count) \
+	V128_UNOP (t ## _negate, atype, atype, -a) \
+	V128_BINOP (t ## _add, atype, atype, a + b) \
+	V128_BINOP (t ## _sub, atype, atype, a - b) \
+	V128_BINOP (t ## _mul, atype, atype, a * b) \
+	V128_BINOP (t ## _equals, vtype, mtype, a == b) \
+	V128_BINOP (t ## _greater_than, vtype, mtype, a > b) \
+	V128_BINOP (t ## _greater_than_or_equal, vtype, mtype, a >= b) \
+	V128_BINOP (t ## _less_than, vtype, mtype, a < b) \
+	V128_BINOP (t ## _less_than_or_equal, vtype, mtype, a <= b) \
+	V128_EQUALS_ALL (t, vtype, mtype, count) \
+	V128_SCALAR_OPS (t, ctype, vtype, stype, count)
+
+#define V128_INTEGER_OPS(t,ctype,vtype,atype,mtype,stype,count) \
+	V128_COMMON_OPS (t, ctype, vtype, atype, mtype, stype, count) \
+	V128_BINOP (t ## _min, vtype, vtype, ((mtype)a & (mtype)(a < b)) | ((mtype)b & ~(mtype)(a < b))) \
+	V128_BINOP (t ## _max, vtype, vtype, ((mtype)a & (mtype)(a > b)) | ((mtype)b & ~(mtype)(a > b)))
+
+#define V128_FLOAT_OPS(t,ctype,vtype,mtype,stype,count) \
+	V128_COMMON_OPS (t, ctype, vtype, vtype, mtype, stype, count) \
+	V128_BINOP (t ## _div, vtype, vtype, a / b)
+
+V128_INTEGER_OPS (i1, gint8, v128_i1, v128_u1, v128_i1, gint32, 16)
+V128_INTEGER_OPS (u1, guint8, v128_u1, v128_u1, v128_i1, gint32, 16)
+V128_INTEGER_OPS (i2, gint16, v128_i2, v128_u2, v128_i2, gint32, 8)
+V128_INTEGER_OPS (u2, guint16, v128_u2, v128_u2, v128_i2, gint32, 8)
+V128_INTEGER_OPS (i4, gint32, v128_i4, v128_u4, v128_i4, gint32, 4)
+V128_INTEGER_OPS (u4, guint32, v128_u4, v128_u4, v128_i4, guint32, 4)
+V128_INTEGER_OPS (i8, gint64, v128_i8, v128_u8, v128_i8, gint64, 2)
+V128_INTEGER_OPS (u8, guint64, v128_u8, v128_u8, v128_i8, guint64, 2)
+V128_FLOAT_OPS (r4, float, v128_r4, v128_i4, float, 4)
+V128_FLOAT_OPS (r8, double, v128_r8, v128_i8, double, 2)
+
+V128_EXTRACT_MSB (i1, v128_i1, 16, wasm_i8x16_bitmask)
+V128_EXTRACT_MSB (u1, v128_i1, 16, wasm_i8x16_bitmask)
+V128_EXTRACT_MSB (i2, v128_i2, 8, wasm_i16x8_bitmask)
+V128_EXTRACT_MSB (u2, v128_i2, 8, wasm_i16x8_bitmask)
+V128_EXTRACT_MSB (i4, v128_i4, 4, wasm_i32x4_bitmask)
+V128_EXTRACT_MSB (u4, v128_i4, 4, wasm_i32x4_bitmask)
+V128_EXTRACT_MSB (i8, v128_i8, 2, wasm_i64x2_bitmask)
+V128_EXTRACT_MSB (u8, v128_i8, 2, wasm_i64x2_bitmask)
+V128_EXTRACT_MSB (r4, v128_i4, 4, wasm_i32x4_bitmask)
+V128_EXTRACT_MSB (r8, v128_i8, 2, wasm_i64x2_bitmask)
+
+V128_SHUFFLE_BYTES (i1, v128_i1, v128_u1, 16)
+V128_SHUFFLE_BYTES (u1, v128_u1, v128_u1, 16)
+V128_SHUFFLE (i2, v128_i2, v128_u2, 8)
+V128_SHUFFLE (u2, v128_u2, v128_u2, 8)
+V128_SHUFFLE (i4, v128_i4, v128_u4, 4)
+V128_SHUFFLE (u4, v128_u4, v128_u4, 4)
+V128_SHUFFLE (i8, v128_i8, v128_u8, 2)
+V128_SHUFFLE (u8, v128_u8, v128_u8, 2)
+V128_SHUFFLE (r4, v128_r4, v128_u4, 4)
+V128_SHUFFLE (r8, v128_r8, v128_u8, 2)
+
+#define INTERP_SIMD_INTRINSIC_P_P(id,func,op,type) func,
+#define INTERP_SIMD_INTRINSIC_P_PP(id,func,op,type)
+#define INTERP_SIMD_INTRINSIC_P_PPP(id,func,op,type)
+PP_SIMD_Method interp_simd_p_p_table [] = {
+#include "interp-simd-intrins.def"
+};
+#undef INTERP_SIMD_INTRINSIC_P_P
+#undef INTERP_SIMD_INTRINSIC_P_PP
+#undef INTERP_SIMD_INTRINSIC_P_PPP
+
+#define INTERP_SIMD_INTRINSIC_P_P(id,func,op,type)
+#define INTERP_SIMD_INTRINSIC_P_PP(id,func,op,type) func,
+#define INTERP_SIMD_INTRINSIC_P_PPP(id,func,op,type)
+PPP_SIMD_Method interp_simd_p_pp_table [] = {
+#include "interp-simd-intrins.def"
+};
+#undef INTERP_SIMD_INTRINSIC_P_P
+#undef INTERP_SIMD_INTRINSIC_P_PP
+#undef INTERP_SIMD_INTRINSIC_P_PPP
+
+#define INTERP_SIMD_INTRINSIC_P_P(id,func,op,type)
+#define INTERP_SIMD_INTRINSIC_P_PP(id,func,op,type)
+#define INTERP_SIMD_INTRINSIC_P_PPP(id,func,op,type) func,
+PPPP_SIMD_Method interp_simd_p_ppp_table [] = {
+#include "interp-simd-intrins.def"
+};
+#undef INTERP_SIMD_INTRINSIC_P_P
+#undef INTERP_SIMD_INTRINSIC_P_PP
+#undef INTERP_SIMD_INTRINSIC_P_PPP
+
+#endif /* INTERP_ENABLE_SIMD */
@@ -0,0 +1,85 @@
+#ifndef __MONO_MINI_INTERP_SIMD_H__
+#define __MONO_MINI_INTERP_SIMD_H__
+
+#include <glib.h>
+
+#include "interp-internals.h"
+
+#define SIZEOF_V128 16
+
+// Operations on Vector128 that the transform can replace with a MINT_SIMD_INTRINS_* opcode. Each
+// operation is implemented for one or more element types, see interp-simd-intrins.def.
+typedef enum {
+	INTERP_SIMD_OP_ONES_COMPLEMENT,
+	INTERP_SIMD_OP_NEGATE,
+	INTERP_SIMD_OP_CREATE,
+	INTERP_SIMD_OP_TO_SCALAR,
+	INTERP_SIMD_OP_EXTRACT_MSB,
+	INTERP_SIMD_OP_AND,
+	INTERP_SIMD_OP_OR,
+	INTERP_SIMD_OP_XOR,
+	INTERP_SIMD_OP_AND_NOT,
+	INTERP_SIMD_OP_ADD,
+	INTERP_SIMD_OP_SUB,
+	INTERP_SIMD_OP_MUL,
+	INTERP_SIMD_OP_DIV,
+	INTERP_SIMD_OP_MIN,
+	INTERP_SIMD_OP_MAX,
+	INTERP_SIMD_OP_EQUALS,
+	INTERP_SIMD_OP_GREATER_THAN,
+	INTERP_SIMD_OP_GREATER_THAN_OR_EQUAL,
+	INTERP_SIMD_OP_LESS_THAN,
+	INTERP_SIMD_OP_LESS_THAN_OR_EQUAL,
+	INTERP_SIMD_OP_EQUALS_ALL,
+	INTERP_SIMD_OP_EQUALS_ANY,
+	INTERP_SIMD_OP_NOT_EQUALS_ALL,
+	INTERP_SIMD_OP_SHUFFLE,
+	INTERP_SIMD_OP_CONDITIONAL_SELECT
+} InterpSimdOp;
+
+#define INTERP_SIMD_INTRINSIC_P_P(id,func,op,type) id,
+#define INTERP_SIMD_INTRINSIC_P_PP(id,func,op,type)
+#define INTERP_SIMD_INTRINSIC_P_PPP(id,func,op,type)
+typedef enum {
+#include "interp-simd-intrins.def"
+	INTERP_SIMD_INTRINSIC_P_P_COUNT
+} InterpSimdIntrinsicP_P;
+#undef INTERP_SIMD_INTRINSIC_P_P
+#undef INTERP_SIMD_INTRINSIC_P_PP
+#undef INTERP_SIMD_INTRINSIC_P_PPP
+
+#define INTERP_SIMD_INTRINSIC_P_P(id,func,op,type)
+#define INTERP_SIMD_INTRINSIC_P_PP(id,func,op,type) id,
+#define INTERP_SIMD_INTRINSIC_P_PPP(id,func,op,type)
+typedef enum {
+#include "interp-simd-intrins.def"
+	INTERP_SIMD_INTRINSIC_P_PP_COUNT
+} InterpSimdIntrinsicP_PP;
+#undef INTERP_SIMD_INTRINSIC_P_P
+#undef INTERP_SIMD_INTRINSIC_P_PP
+#undef INTERP_SIMD_INTRINSIC_P_PPP
+
+#define INTERP_SIMD_INTRINSIC_P_P(id,func,op,type)
+#define INTERP_SIMD_INTRINSIC_P_PP(id,func,op,type)
+#define INTERP_SIMD_INTRINSIC_P_PPP(id,func,op,type) id,
+typedef enum {
+#include "interp-simd-intrins.def"
+	INTERP_SIMD_INTRINSIC_P_PPP_COUNT
+} InterpSimdIntrinsicP_PPP;
+#undef INTERP_SIMD_INTRINSIC_P_P
+#undef INTERP_SIMD_INTRINSIC_P_PP
+#undef INTERP_SIMD_INTRINSIC_P_PPP
+
+#ifdef INTERP_ENABLE_SIMD
+
+typedef void (*PP_SIMD_Method) (gpointer res, gpointer v1);
+typedef void (*PPP_SIMD_Method) (gpointer res, gpointer v1, gpointer v2);
+typedef void (*PPPP_SIMD_Method) (gpointer res, gpointer v1, gpointer v2, gpointer v3);
+
+extern PP_SIMD_Method interp_simd_p_p_table [];
+extern PPP_SIMD_Method interp_simd_p_pp_table [];
+extern PPPP_SIMD_Method interp_simd_p_ppp_table [];
+
+#endif
+
+#endif /* __MONO_MINI_INTERP_SIMD_H__ */
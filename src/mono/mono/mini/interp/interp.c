@@ -64,6 +64,7 @@
 #include "interp-internals.h"
 #include "mintops.h"
 #include "interp-intrins.h"
+#include "interp-simd.h"
 #include "tiering.h"
 
 #include <mono/mini/mini.h>
@@ -759,6 +760,48 @@ get_virtual_method_fast (InterpMethod *imethod, MonoVTable *vtable, int offset)
 	}
 }
 
+/*
+ * Same as get_virtual_method_fast, but looks up the vtable in the inline cache of the call site
+ * first, which saves the method table lookup and, for interface and generic virtual calls, the
+ * search of the slot's list.
+ */
+static InterpMethod* // Inlining causes additional stack use in caller.
+get_virtual_method_cached (InterpMethod *imethod, MonoVTable *vtable, int offset, InterpCallVirtCache **cache_ptr, InterpMethod *caller)
+{
+	InterpCallVirtCache *cache = *(InterpCallVirtCache* volatile*)cache_ptr;
+	int count = cache ? cache->count : 0;
+
+	for (int i = 0; i < count; i++) {
+		// Tiering may patch the target with the tag bit set, see mono_interp_register_imethod_patch_site
+		if (cache->entries [i].vtable == vtable)
+			return INTERP_IMETHOD_UNTAG_1 (cache->entries [i].target);
+	}
+
+	InterpMethod *target_imethod = get_virtual_method_fast (imethod, vtable, offset);
+
+	// Vtables of collectible classes could be freed and their address reused while the cache is alive
+	if (count < INTERP_CALLVIRT_CACHE_SIZE && !m_class_get_mem_manager (vtable->klass)->collectible) {
+		InterpCallVirtCache *new_cache = (InterpCallVirtCache*)m_method_alloc0 (caller->method, sizeof (InterpCallVirtCache));
+		if (count)
+			memcpy (new_cache->entries, cache->entries, count * sizeof (new_cache->entries [0]));
+		new_cache->entries [count].vtable = vtable;
+		new_cache->entries [count].target = target_imethod;
+		new_cache->count = count + 1;
+
+		// Nobody else can see the new cache yet, so the targets can be registered without holding a lock
+		for (int i = 0; i < new_cache->count; i++) {
+			new_cache->entries [i].target = INTERP_IMETHOD_UNTAG_1 (new_cache->entries [i].target);
+			mono_interp_register_imethod_patch_site (&new_cache->entries [i].target);
+		}
+
+		mono_memory_barrier ();
+		// If another thread updated the cache first, the new cache is leaked to the mempool
+		mono_atomic_cas_ptr ((gpointer*)cache_ptr, new_cache, cache);
+	}
+
+	return target_imethod;
+}
+
 // Returns the size it uses on the interpreter stack
 static int
 stackval_size (MonoType *type, gboolean pinvoke)
@@ -4086,9 +4129,10 @@ main_loop:
 			this_arg = LOCAL_VAR (call_args_offset, MonoObject*);
 
 			slot = (gint16)ip [4];
-			ip += 5;
+			InterpCallVirtCache **cache_ptr = (InterpCallVirtCache**)&frame->imethod->data_items [ip [5]];
+			ip += 6;
 			// FIXME push/pop LMF
-			cmethod = get_virtual_method_fast (cmethod, this_arg->vtable, slot);
+			cmethod = get_virtual_method_cached (cmethod, this_arg->vtable, slot, cache_ptr, frame->imethod);
 			if (m_class_is_valuetype (this_arg->vtable->klass) && m_class_is_valuetype (cmethod->method->klass)) {
 				/* unbox */
 				gpointer unboxed = mono_object_unbox_internal (this_arg);
@@ -4855,6 +4899,23 @@ MINT_IN_CASE(MINT_BRTRUE_I8_SP) ZEROP_SP(gint64, !=); MINT_IN_BREAK;
 		MINT_IN_CASE(MINT_BLT_UN_I4_IMM_SP) BRELOP_IMM_SP(guint32, <); MINT_IN_BREAK;
 		MINT_IN_CASE(MINT_BLT_UN_I8_IMM_SP) BRELOP_IMM_SP(guint64, <); MINT_IN_BREAK;
 
+#define ADD_IMM_BRELOP_SP(datatype, op) { \
+	gint32 sum = LOCAL_VAR (ip [2], gint32) + (gint16)ip [4]; \
+	LOCAL_VAR (ip [1], gint32) = sum; \
+	if ((datatype)sum op LOCAL_VAR (ip [3], datatype)) { \
+		gint16 br_offset = (gint16) ip [5]; \
+		BACK_BRANCH_PROFILE (br_offset); \
+		SAFEPOINT; \
+		ip += br_offset; \
+	} else \
+		ip += 6; \
+}
+
+		MINT_IN_CASE(MINT_ADD_I4_IMM_BLT_I4_SP) ADD_IMM_BRELOP_SP(gint32, <); MINT_IN_BREAK;
+		MINT_IN_CASE(MINT_ADD_I4_IMM_BLE_I4_SP) ADD_IMM_BRELOP_SP(gint32, <=); MINT_IN_BREAK;
+		MINT_IN_CASE(MINT_ADD_I4_IMM_BLT_UN_I4_SP) ADD_IMM_BRELOP_SP(guint32, <); MINT_IN_BREAK;
+		MINT_IN_CASE(MINT_ADD_I4_IMM_BNE_UN_I4_SP) ADD_IMM_BRELOP_SP(guint32, !=); MINT_IN_BREAK;
+
 		MINT_IN_CASE(MINT_SWITCH) {
 			guint32 val = LOCAL_VAR (ip [1], guint32);
 			guint32 n = READ32 (ip + 2);
@@ -5772,6 +5833,35 @@ MINT_IN_CASE(MINT_BRTRUE_I8_SP) ZEROP_SP(gint64, !=); MINT_IN_BREAK;
 			ip += 5;
 			MINT_IN_BREAK;
 		}
+#ifdef INTERP_ENABLE_SIMD
+		MINT_IN_CASE(MINT_SIMD_V128_LDC) {
+			memcpy (locals + ip [1], frame->imethod->data_items [ip [2]], SIZEOF_V128);
+			ip += 3;
+			MINT_IN_BREAK;
+		}
+		MINT_IN_CASE(MINT_SIMD_INTRINS_P_P) {
+			interp_simd_p_p_table [ip [3]] (locals + ip [1], locals + ip [2]);
+			ip += 4;
+			MINT_IN_BREAK;
+		}
+		MINT_IN_CASE(MINT_SIMD_INTRINS_P_PP) {
+			interp_simd_p_pp_table [ip [4]] (locals + ip [1], locals + ip [2], locals + ip [3]);
+			ip += 5;
+			MINT_IN_BREAK;
+		}
+		MINT_IN_CASE(MINT_SIMD_INTRINS_P_PPP) {
+			interp_simd_p_ppp_table [ip [5]] (locals + ip [1], locals + ip [2], locals + ip [3], locals + ip [4]);
+			ip += 6;
+			MINT_IN_BREAK;
+		}
+#else
+		MINT_IN_CASE(MINT_SIMD_V128_LDC)
+		MINT_IN_CASE(MINT_SIMD_INTRINS_P_P)
+		MINT_IN_CASE(MINT_SIMD_INTRINS_P_PP)
+		MINT_IN_CASE(MINT_SIMD_INTRINS_P_PPP)
+			g_assert_not_reached ();
+			MINT_IN_BREAK;
+#endif
 		MINT_IN_CASE(MINT_INTRINS_UNSAFE_BYTE_OFFSET) {
 			LOCAL_VAR (ip [1], mono_u) = LOCAL_VAR (ip [3], guint8*) - LOCAL_VAR (ip [2], guint8*);
 			ip += 4;
@@ -7728,12 +7818,16 @@ interp_parse_options (const char *options)
 				opt = INTERP_OPT_INLINE;
 			else if (strncmp (arg, "cprop", 5) == 0)
 				opt = INTERP_OPT_CPROP;
+			else if (strncmp (arg, "superblocks", 11) == 0)
+				opt = INTERP_OPT_SUPERBLOCKS;
 			else if (strncmp (arg, "super", 5) == 0)
 				opt = INTERP_OPT_SUPER_INSTRUCTIONS;
 			else if (strncmp (arg, "bblocks", 7) == 0)
 				opt = INTERP_OPT_BBLOCKS;
 			else if (strncmp (arg, "tiering", 7) == 0)
 				opt = INTERP_OPT_TIERING;
+			else if (strncmp (arg, "simd", 4) == 0)
+				opt = INTERP_OPT_SIMD;
 			else if (strncmp (arg, "all", 3) == 0)
 				opt = ~INTERP_OPT_NONE;
 
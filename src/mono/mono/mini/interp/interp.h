@@ -35,7 +35,9 @@ enum {
 	INTERP_OPT_SUPER_INSTRUCTIONS = 4,
 	INTERP_OPT_BBLOCKS = 8,
 	INTERP_OPT_TIERING = 16,
-	INTERP_OPT_DEFAULT = INTERP_OPT_INLINE | INTERP_OPT_CPROP | INTERP_OPT_SUPER_INSTRUCTIONS | INTERP_OPT_BBLOCKS | INTERP_OPT_TIERING
+	INTERP_OPT_SIMD = 32,
+	INTERP_OPT_SUPERBLOCKS = 64,
+	INTERP_OPT_DEFAULT = INTERP_OPT_INLINE | INTERP_OPT_CPROP | INTERP_OPT_SUPER_INSTRUCTIONS | INTERP_OPT_BBLOCKS | INTERP_OPT_TIERING | INTERP_OPT_SIMD | INTERP_OPT_SUPERBLOCKS
 };
 
 typedef struct _InterpMethodArguments InterpMethodArguments;
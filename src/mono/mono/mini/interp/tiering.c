@@ -67,6 +67,36 @@ patch_interp_data_items (InterpMethod *old_imethod, InterpMethod *new_imethod)
 	g_slist_free (sites);
 }
 
+static int
+lookup_callvirt_cache_site (int *sites, int il_offset)
+{
+	while (*sites != G_MAXINT32) {
+		if (*sites == il_offset)
+			return *(sites + 1);
+		sites += 2;
+	}
+	return -1;
+}
+
+// Seed the inline caches of the optimized method with the receiver types that the unoptimized
+// method already observed. Caches are immutable once published, so they can be shared between
+// both methods and the optimized method only starts with a new cache once it misses.
+static void
+seed_callvirt_caches (InterpMethod *imethod, InterpMethod *new_imethod)
+{
+	if (!imethod->callvirt_cache_sites || !new_imethod->callvirt_cache_sites)
+		return;
+
+	for (int *site = new_imethod->callvirt_cache_sites; *site != G_MAXINT32; site += 2) {
+		int index = lookup_callvirt_cache_site (imethod->callvirt_cache_sites, *site);
+		if (index == -1)
+			continue;
+		gpointer cache = imethod->data_items [index];
+		if (cache)
+			mono_atomic_cas_ptr (&new_imethod->data_items [*(site + 1)], cache, NULL);
+	}
+}
+
 static InterpMethod*
 tier_up_method (InterpMethod *imethod, ThreadContext *context)
 {
@@ -81,6 +111,8 @@ tier_up_method (InterpMethod *imethod, ThreadContext *context)
 	// Unoptimized method compiled fine, optimized method should also compile without error
 	mono_error_assert_ok (error);
 
+	seed_callvirt_caches (imethod, new_imethod);
+
 	mono_os_mutex_lock (&tiering_mutex);
 
 	if (!imethod->optimized_imethod) {
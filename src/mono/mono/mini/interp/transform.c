@@ -32,6 +32,7 @@
 #include "mintops.h"
 #include "interp-internals.h"
 #include "interp.h"
+#include "interp-simd.h"
 #include "transform.h"
 #include "tiering.h"
 
@@ -1215,6 +1216,16 @@ get_data_item_index_nonshared (TransformData *td, void *ptr)
 	return GUINT_TO_UINT16 (index);
 }
 
+static void
+add_callvirt_cache_site (TransformData *td, int il_offset, guint16 data_item_index)
+{
+	if (!td->callvirt_cache_sites)
+		td->callvirt_cache_sites = g_array_new (FALSE, FALSE, sizeof (int));
+	int item = data_item_index;
+	g_array_append_val (td->callvirt_cache_sites, il_offset);
+	g_array_append_val (td->callvirt_cache_sites, item);
+}
+
 gboolean
 mono_interp_jit_call_supported (MonoMethod *method, MonoMethodSignature *sig)
 {
@@ -1940,6 +1951,255 @@ interp_emit_metadata_update_ldflda (TransformData *td, MonoClassField *field, Mo
 }
 
 
+#ifdef INTERP_ENABLE_SIMD
+
+typedef struct {
+	guint8 op;
+	guint8 element_type;
+	guint16 id;
+} InterpSimdIntrinsicInfo;
+
+#define INTERP_SIMD_INTRINSIC_P_P(id,func,op,type) { op, type, id },
+#define INTERP_SIMD_INTRINSIC_P_PP(id,func,op,type)
+#define INTERP_SIMD_INTRINSIC_P_PPP(id,func,op,type)
+static const InterpSimdIntrinsicInfo simd_p_p_infos [] = {
+#include "interp-simd-intrins.def"
+};
+#undef INTERP_SIMD_INTRINSIC_P_P
+#undef INTERP_SIMD_INTRINSIC_P_PP
+#undef INTERP_SIMD_INTRINSIC_P_PPP
+
+#define INTERP_SIMD_INTRINSIC_P_P(id,func,op,type)
+#define INTERP_SIMD_INTRINSIC_P_PP(id,func,op,type) { op, type, id },
+#define INTERP_SIMD_INTRINSIC_P_PPP(id,func,op,type)
+static const InterpSimdIntrinsicInfo simd_p_pp_infos [] = {
+#include "interp-simd-intrins.def"
+};
+#undef INTERP_SIMD_INTRINSIC_P_P
+#undef INTERP_SIMD_INTRINSIC_P_PP
+#undef INTERP_SIMD_INTRINSIC_P_PPP
+
+#define INTERP_SIMD_INTRINSIC_P_P(id,func,op,type)
+#define INTERP_SIMD_INTRINSIC_P_PP(id,func,op,type)
+#define INTERP_SIMD_INTRINSIC_P_PPP(id,func,op,type) { op, type, id },
+static const InterpSimdIntrinsicInfo simd_p_ppp_infos [] = {
+#include "interp-simd-intrins.def"
+};
+#undef INTERP_SIMD_INTRINSIC_P_P
+#undef INTERP_SIMD_INTRINSIC_P_PP
+#undef INTERP_SIMD_INTRINSIC_P_PPP
+
+static const guint8 v128_zero [SIZEOF_V128];
+static const guint8 v128_all_bits_set [SIZEOF_V128] = {
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+};
+
+static int
+get_simd_element_type (MonoType *type)
+{
+	switch (type->type) {
+	case MONO_TYPE_I1:
+	case MONO_TYPE_U1:
+	case MONO_TYPE_I2:
+	case MONO_TYPE_U2:
+	case MONO_TYPE_I4:
+	case MONO_TYPE_U4:
+	case MONO_TYPE_I8:
+	case MONO_TYPE_U8:
+	case MONO_TYPE_R4:
+	case MONO_TYPE_R8:
+		return type->type;
+#if SIZEOF_VOID_P == 8
+	case MONO_TYPE_I:
+		return MONO_TYPE_I8;
+	case MONO_TYPE_U:
+		return MONO_TYPE_U8;
+#else
+	case MONO_TYPE_I:
+		return MONO_TYPE_I4;
+	case MONO_TYPE_U:
+		return MONO_TYPE_U4;
+#endif
+	default:
+		return -1;
+	}
+}
+
+// Returns the element type of a Vector128<T>, or -1 if the type is not a Vector128 of a
+// primitive numeric type
+static int
+get_vector128_element_type (MonoType *type)
+{
+	if (m_type_is_byref (type) || type->type != MONO_TYPE_GENERICINST)
+		return -1;
+	MonoClass *klass = mono_class_from_mono_type_internal (type);
+	if (m_class_get_image (klass) != mono_defaults.corlib ||
+			strcmp (m_class_get_name_space (klass), "System.Runtime.Intrinsics") ||
+			strcmp (m_class_get_name (klass), "Vector128`1"))
+		return -1;
+	return get_simd_element_type (mono_class_get_context (klass)->class_inst->type_argv [0]);
+}
+
+static int
+get_vector128_op (const char *name)
+{
+	if (!strcmp (name, "Add")) return INTERP_SIMD_OP_ADD;
+	if (!strcmp (name, "Subtract")) return INTERP_SIMD_OP_SUB;
+	if (!strcmp (name, "Multiply")) return INTERP_SIMD_OP_MUL;
+	if (!strcmp (name, "Divide")) return INTERP_SIMD_OP_DIV;
+	if (!strcmp (name, "BitwiseAnd")) return INTERP_SIMD_OP_AND;
+	if (!strcmp (name, "BitwiseOr")) return INTERP_SIMD_OP_OR;
+	if (!strcmp (name, "Xor")) return INTERP_SIMD_OP_XOR;
+	if (!strcmp (name, "AndNot")) return INTERP_SIMD_OP_AND_NOT;
+	if (!strcmp (name, "OnesComplement")) return INTERP_SIMD_OP_ONES_COMPLEMENT;
+	if (!strcmp (name, "Negate")) return INTERP_SIMD_OP_NEGATE;
+	if (!strcmp (name, "Min")) return INTERP_SIMD_OP_MIN;
+	if (!strcmp (name, "Max")) return INTERP_SIMD_OP_MAX;
+	if (!strcmp (name, "Equals")) return INTERP_SIMD_OP_EQUALS;
+	if (!strcmp (name, "GreaterThan")) return INTERP_SIMD_OP_GREATER_THAN;
+	if (!strcmp (name, "GreaterThanOrEqual")) return INTERP_SIMD_OP_GREATER_THAN_OR_EQUAL;
+	if (!strcmp (name, "LessThan")) return INTERP_SIMD_OP_LESS_THAN;
+	if (!strcmp (name, "LessThanOrEqual")) return INTERP_SIMD_OP_LESS_THAN_OR_EQUAL;
+	if (!strcmp (name, "EqualsAll")) return INTERP_SIMD_OP_EQUALS_ALL;
+	if (!strcmp (name, "EqualsAny")) return INTERP_SIMD_OP_EQUALS_ANY;
+	if (!strcmp (name, "ConditionalSelect")) return INTERP_SIMD_OP_CONDITIONAL_SELECT;
+	if (!strcmp (name, "Create")) return INTERP_SIMD_OP_CREATE;
+	if (!strcmp (name, "ToScalar")) return INTERP_SIMD_OP_TO_SCALAR;
+	if (!strcmp (name, "ExtractMostSignificantBits")) return INTERP_SIMD_OP_EXTRACT_MSB;
+	if (!strcmp (name, "Shuffle")) return INTERP_SIMD_OP_SHUFFLE;
+	return -1;
+}
+
+static int
+get_vector128_t_op (const char *name)
+{
+	if (!strcmp (name, "op_Addition")) return INTERP_SIMD_OP_ADD;
+	if (!strcmp (name, "op_Subtraction")) return INTERP_SIMD_OP_SUB;
+	if (!strcmp (name, "op_Multiply")) return INTERP_SIMD_OP_MUL;
+	if (!strcmp (name, "op_Division")) return INTERP_SIMD_OP_DIV;
+	if (!strcmp (name, "op_BitwiseAnd")) return INTERP_SIMD_OP_AND;
+	if (!strcmp (name, "op_BitwiseOr")) return INTERP_SIMD_OP_OR;
+	if (!strcmp (name, "op_ExclusiveOr")) return INTERP_SIMD_OP_XOR;
+	if (!strcmp (name, "op_OnesComplement")) return INTERP_SIMD_OP_ONES_COMPLEMENT;
+	if (!strcmp (name, "op_UnaryNegation")) return INTERP_SIMD_OP_NEGATE;
+	if (!strcmp (name, "op_Equality")) return INTERP_SIMD_OP_EQUALS_ALL;
+	if (!strcmp (name, "op_Inequality")) return INTERP_SIMD_OP_NOT_EQUALS_ALL;
+	return -1;
+}
+
+static int
+lookup_simd_intrinsic (const InterpSimdIntrinsicInfo *infos, int count, int op, int element_type)
+{
+	for (int i = 0; i < count; i++) {
+		if (infos [i].op == op && (infos [i].element_type == MONO_TYPE_END || infos [i].element_type == element_type))
+			return infos [i].id;
+	}
+	return -1;
+}
+
+static void
+interp_emit_simd_v128_ldc (TransformData *td, MonoMethodSignature *csignature, const guint8 *value)
+{
+	interp_add_ins (td, MINT_SIMD_V128_LDC);
+	push_type_vt (td, mono_class_from_mono_type_internal (csignature->ret), SIZEOF_V128);
+	interp_ins_set_dreg (td->last_ins, td->sp [-1].local);
+	td->last_ins->data [0] = get_data_item_index (td, (gpointer)value);
+}
+
+/* Return TRUE if the call to a Vector128 method was replaced with a MINT_SIMD_* opcode */
+static gboolean
+interp_emit_simd_intrinsics (TransformData *td, MonoMethod *cmethod, MonoMethodSignature *csignature)
+{
+	const char *name = cmethod->name;
+	gboolean is_vector128_t = !strcmp (m_class_get_name (cmethod->klass), "Vector128`1");
+
+	if (!(mono_interp_opt & INTERP_OPT_SIMD))
+		return FALSE;
+
+	if (is_vector128_t && csignature->param_count == 0 && !csignature->hasthis) {
+		MonoType *element_type = mono_class_get_context (cmethod->klass)->class_inst->type_argv [0];
+		if (get_simd_element_type (element_type) == -1)
+			return FALSE;
+		if (!strcmp (name, "get_Count")) {
+			int element_size = mono_class_value_size (mono_class_from_mono_type_internal (element_type), NULL);
+			push_simple_type (td, STACK_TYPE_I4);
+			interp_get_ldc_i4_from_const (td, NULL, SIZEOF_V128 / element_size, td->sp [-1].local);
+		} else if (!strcmp (name, "get_Zero")) {
+			interp_emit_simd_v128_ldc (td, csignature, v128_zero);
+		} else if (!strcmp (name, "get_AllBitsSet")) {
+			interp_emit_simd_v128_ldc (td, csignature, v128_all_bits_set);
+		} else {
+			return FALSE;
+		}
+		td->ip += 5;
+		return TRUE;
+	}
+
+	if (csignature->hasthis || csignature->param_count < 1 || csignature->param_count > 3)
+		return FALSE;
+
+	int op = is_vector128_t ? get_vector128_t_op (name) : get_vector128_op (name);
+	if (op == -1)
+		return FALSE;
+
+	// Overloads that take scalars, like Multiply (Vector128<T>, T), are left to the managed implementation
+	int element_type;
+	if (op == INTERP_SIMD_OP_CREATE) {
+		element_type = get_vector128_element_type (csignature->ret);
+		if (element_type == -1 || get_simd_element_type (csignature->params [0]) != element_type)
+			return FALSE;
+	} else {
+		element_type = get_vector128_element_type (csignature->params [0]);
+		if (element_type == -1)
+			return FALSE;
+		for (int i = 1; i < csignature->param_count; i++) {
+			int param_element_type = get_vector128_element_type (csignature->params [i]);
+			// The indices of a shuffle are integers of the same size as the elements
+			if (param_element_type == -1 || (op != INTERP_SIMD_OP_SHUFFLE && param_element_type != element_type))
+				return FALSE;
+		}
+	}
+
+	int opcode, id;
+	switch (csignature->param_count) {
+	case 1:
+		opcode = MINT_SIMD_INTRINS_P_P;
+		id = lookup_simd_intrinsic (simd_p_p_infos, G_N_ELEMENTS (simd_p_p_infos), op, element_type);
+		break;
+	case 2:
+		opcode = MINT_SIMD_INTRINS_P_PP;
+		id = lookup_simd_intrinsic (simd_p_pp_infos, G_N_ELEMENTS (simd_p_pp_infos), op, element_type);
+		break;
+	default:
+		opcode = MINT_SIMD_INTRINS_P_PPP;
+		id = lookup_simd_intrinsic (simd_p_ppp_infos, G_N_ELEMENTS (simd_p_ppp_infos), op, element_type);
+		break;
+	}
+	if (id == -1)
+		return FALSE;
+
+	td->sp -= csignature->param_count;
+	interp_add_ins (td, opcode);
+	if (csignature->param_count == 1)
+		interp_ins_set_sreg (td->last_ins, td->sp [0].local);
+	else if (csignature->param_count == 2)
+		interp_ins_set_sregs2 (td->last_ins, td->sp [0].local, td->sp [1].local);
+	else
+		interp_ins_set_sregs3 (td->last_ins, td->sp [0].local, td->sp [1].local, td->sp [2].local);
+
+	if (get_vector128_element_type (csignature->ret) != -1)
+		push_type_vt (td, mono_class_from_mono_type_internal (csignature->ret), SIZEOF_V128);
+	else
+		push_simple_type (td, stack_type [mint_type (csignature->ret)]);
+	interp_ins_set_dreg (td->last_ins, td->sp [-1].local);
+	td->last_ins->data [0] = GINT_TO_UINT16 (id);
+
+	td->ip += 5;
+	return TRUE;
+}
+
+#endif /* INTERP_ENABLE_SIMD */
+
 /* Return TRUE if call transformation is finished */
 static gboolean
 interp_handle_intrinsics (TransformData *td, MonoMethod *target_method, MonoClass *constrained_class, MonoMethodSignature *csignature, gboolean readonly, int *op)
@@ -2563,8 +2823,21 @@ interp_handle_intrinsics (TransformData *td, MonoMethod *target_method, MonoClas
 			   (!strncmp ("System.Runtime.Intrinsics", klass_name_space, 25) &&
 				!strncmp ("Vector", klass_name, 6) &&
 				!strcmp (tm, "get_IsHardwareAccelerated"))) {
-		*op = MINT_LDC_I4_0;
+#ifdef INTERP_ENABLE_SIMD
+		// Only Vector128 operations are implemented with SIMD opcodes
+		if (!strcmp (klass_name, "Vector128") && (mono_interp_opt & INTERP_OPT_SIMD))
+			*op = MINT_LDC_I4_1;
+		else
+#endif
+			*op = MINT_LDC_I4_0;
 	}
+#ifdef INTERP_ENABLE_SIMD
+	else if (in_corlib &&
+			!strcmp ("System.Runtime.Intrinsics", klass_name_space) &&
+			(!strcmp ("Vector128", klass_name) || !strcmp ("Vector128`1", klass_name))) {
+		return interp_emit_simd_intrinsics (td, target_method, csignature);
+	}
+#endif
 
 	return FALSE;
 }
@@ -3532,6 +3805,10 @@ interp_transform_call (TransformData *td, MonoMethod *method, MonoMethod *target
 			} else if (is_virtual) {
 				interp_add_ins (td, MINT_CALLVIRT_FAST);
 				td->last_ins->data [1] = get_virt_method_slot (target_method);
+				/* Inline cache */
+				td->last_ins->data [2] = get_data_item_index_nonshared (td, NULL);
+				if (mono_interp_tiering_enabled () && !td->inline_depth)
+					add_callvirt_cache_site (td, GPTRDIFF_TO_INT (td->ip - td->il_code), td->last_ins->data [2]);
 			} else if (is_virtual) {
 				interp_add_ins (td, MINT_CALLVIRT);
 			} else {
@@ -7977,7 +8254,9 @@ emit_compacted_instruction (TransformData *td, guint16* start_ip, InterpInst *in
 		}
 	} else if (MINT_IS_UNCONDITIONAL_BRANCH (opcode) || MINT_IS_CONDITIONAL_BRANCH (opcode) || MINT_IS_SUPER_BRANCH (opcode)) {
 		const int br_offset = GPTRDIFF_TO_INT (start_ip - td->new_code);
-		gboolean has_imm = opcode >= MINT_BEQ_I4_IMM_SP && opcode <= MINT_BLT_UN_I8_IMM_SP;
+		gboolean has_imm = (opcode >= MINT_BEQ_I4_IMM_SP && opcode <= MINT_BLT_UN_I8_IMM_SP) || MINT_IS_ADD_IMM_SUPER_BRANCH (opcode);
+		if (mono_interp_op_dregs [opcode])
+			*ip++ = GINT_TO_UINT16 (get_local_offset (td, ins->dreg));
 		for (int i = 0; i < mono_interp_op_sregs [opcode]; i++)
 			*ip++ = GINT_TO_UINT16 (get_local_offset (td, ins->sregs [i]));
 		if (has_imm)
@@ -8005,7 +8284,7 @@ emit_compacted_instruction (TransformData *td, guint16* start_ip, InterpInst *in
 			// We don't know the in_offset of the target, add a reloc
 			Reloc *reloc = (Reloc*)mono_mempool_alloc0 (td->mempool, sizeof (Reloc));
 			reloc->type = is_short ? RELOC_SHORT_BRANCH : RELOC_LONG_BRANCH;
-			reloc->skip = mono_interp_op_sregs [opcode] + has_imm;
+			reloc->skip = mono_interp_op_dregs [opcode] + mono_interp_op_sregs [opcode] + has_imm;
 			reloc->offset = br_offset;
 			reloc->target_bb = ins->info.target_bb;
 			g_ptr_array_add (td->relocs, reloc);
@@ -8239,6 +8518,149 @@ interp_optimize_bblocks (TransformData *td)
 	return needs_cprop;
 }
 
+#define INTERP_LOOP_TEST_MAX_INS 8
+
+// Checks whether bb is the test at the bottom of a loop that is small enough to be duplicated.
+// The test can only load vars and constants onto the execution stack and consume them with a
+// conditional branch back into the loop, so the copy doesn't define any vars that live past it.
+static InterpInst*
+get_duplicable_loop_test (TransformData *td, InterpBasicBlock *bb, InterpBasicBlock *latch_bb)
+{
+	int defs [INTERP_LOOP_TEST_MAX_INS];
+	int num_defs = 0;
+	int num_ins = 0;
+	InterpInst *branch = NULL;
+
+	if (bb->eh_block || bb->stack_height != 0 || !bb->next_bb)
+		return NULL;
+
+	for (InterpInst *ins = bb->first_ins; ins != NULL; ins = ins->next) {
+		int opcode = ins->opcode;
+		if (opcode == MINT_NOP || opcode == MINT_IL_SEQ_POINT)
+			continue;
+		// The branch must be the last instruction
+		if (branch || ++num_ins > INTERP_LOOP_TEST_MAX_INS)
+			return NULL;
+
+		if (MINT_IS_CONDITIONAL_BRANCH (opcode)) {
+			branch = ins;
+		} else if (!MINT_IS_MOV (opcode) && !MINT_IS_LDC_I4 (opcode) && !MINT_IS_LDC_I8 (opcode) &&
+				opcode != MINT_LDLEN && opcode != MINT_SAFEPOINT) {
+			return NULL;
+		}
+
+		for (int i = 0; i < mono_interp_op_sregs [opcode]; i++) {
+			for (int j = 0; j < num_defs; j++) {
+				if (defs [j] == ins->sregs [i])
+					defs [j] = -1;
+			}
+		}
+		if (mono_interp_op_dregs [opcode]) {
+			InterpLocal *local = &td->locals [ins->dreg];
+			if (!(local->flags & INTERP_LOCAL_FLAG_EXECUTION_STACK) || local->indirects)
+				return NULL;
+			defs [num_defs++] = ins->dreg;
+		}
+	}
+	if (!branch)
+		return NULL;
+
+	// Every value pushed by the test must also be consumed by it
+	for (int i = 0; i < num_defs; i++) {
+		if (defs [i] != -1)
+			return NULL;
+	}
+
+	// The branch must go back to a bblock that reaches the latch through fallthrough code
+	InterpBasicBlock *target_bb = branch->info.target_bb;
+	for (InterpBasicBlock *loop_bb = target_bb; loop_bb != bb && loop_bb != NULL; loop_bb = loop_bb->next_bb) {
+		if (loop_bb == latch_bb)
+			return branch;
+	}
+	return NULL;
+}
+
+static int
+get_remapped_var (int var, int *old_vars, int *new_vars, int num_vars)
+{
+	for (int i = 0; i < num_vars; i++) {
+		if (old_vars [i] == var)
+			return new_vars [i];
+	}
+	return var;
+}
+
+/*
+ * Loops are laid out by the IL compiler with the test at the bottom, reached by a branch
+ * from the loop entry and by falling through from the end of the body. Copying the test at
+ * the end of the body, followed by a branch to the loop exit, makes the last bblock of the
+ * body a superblock that ends with the backward branch. The super instruction pass can then
+ * fuse the induction variable update with the test.
+ */
+static void
+interp_rotate_loops (TransformData *td)
+{
+	for (InterpBasicBlock *bb = td->entry_bb; bb != NULL; bb = bb->next_bb) {
+		InterpBasicBlock *test_bb = bb->next_bb;
+		// The test must remain reachable from the loop entry
+		if (!test_bb || test_bb->in_count < 2 || bb->eh_block)
+			continue;
+
+		// bb must fall through into the test
+		gboolean falls_through = FALSE;
+		for (int i = 0; i < bb->out_count; i++) {
+			if (bb->out_bb [i] == test_bb)
+				falls_through = TRUE;
+		}
+		if (!falls_through)
+			continue;
+		InterpInst *last_ins = bb->last_ins;
+		if (last_ins && MINT_IS_NOP (last_ins->opcode))
+			last_ins = interp_prev_ins (last_ins);
+		if (last_ins && (MINT_IS_CONDITIONAL_BRANCH (last_ins->opcode) ||
+				MINT_IS_UNCONDITIONAL_BRANCH (last_ins->opcode) || last_ins->opcode == MINT_SWITCH))
+			continue;
+
+		InterpInst *branch = get_duplicable_loop_test (td, test_bb, bb);
+		if (!branch)
+			continue;
+
+		int old_vars [INTERP_LOOP_TEST_MAX_INS];
+		int new_vars [INTERP_LOOP_TEST_MAX_INS];
+		int num_vars = 0;
+		for (InterpInst *ins = test_bb->first_ins; ins != NULL; ins = ins->next) {
+			int opcode = ins->opcode;
+			if (opcode == MINT_NOP || opcode == MINT_IL_SEQ_POINT)
+				continue;
+			InterpInst *new_ins = interp_insert_ins_bb (td, bb, bb->last_ins, opcode);
+			new_ins->il_offset = ins->il_offset;
+			new_ins->flags = ins->flags;
+			new_ins->info = ins->info;
+			memcpy (new_ins->data, ins->data, (mono_interp_oplen [opcode] - 1) * sizeof (guint16));
+			for (int i = 0; i < mono_interp_op_sregs [opcode]; i++)
+				new_ins->sregs [i] = get_remapped_var (ins->sregs [i], old_vars, new_vars, num_vars);
+			if (mono_interp_op_dregs [opcode]) {
+				InterpLocal *local = &td->locals [ins->dreg];
+				int new_var = create_interp_local_explicit (td, local->type, local->size);
+				td->locals [new_var].flags |= INTERP_LOCAL_FLAG_EXECUTION_STACK;
+				old_vars [num_vars] = ins->dreg;
+				new_vars [num_vars++] = new_var;
+				new_ins->dreg = new_var;
+			}
+		}
+		InterpInst *exit_br = interp_insert_ins_bb (td, bb, bb->last_ins, MINT_BR);
+		exit_br->il_offset = branch->il_offset;
+		exit_br->info.target_bb = test_bb->next_bb;
+
+		interp_unlink_bblocks (bb, test_bb);
+		interp_link_bblocks (td, bb, branch->info.target_bb);
+		interp_link_bblocks (td, bb, test_bb->next_bb);
+
+		if (td->verbose_level)
+			g_print ("Copied loop test BB%d into BB%d\n", test_bb->index, bb->index);
+	}
+}
+
 static gboolean
 interp_local_deadce (TransformData *td)
 {
@@ -9213,6 +9635,53 @@ get_unop_condbr_sp (int opcode)
 	}
 }
 
+static int
+get_add_imm_condbr_sp (int opcode)
+{
+	switch (opcode) {
+		case MINT_BLT_I4_SP: return MINT_ADD_I4_IMM_BLT_I4_SP;
+		case MINT_BLE_I4_SP: return MINT_ADD_I4_IMM_BLE_I4_SP;
+		case MINT_BLT_UN_I4_SP: return MINT_ADD_I4_IMM_BLT_UN_I4_SP;
+		case MINT_BNE_UN_I4_SP: return MINT_ADD_I4_IMM_BNE_UN_I4_SP;
+		default: return MINT_NOP;
+	}
+}
+
+// add.i4.imm + condbr.sp -> add.i4.imm.condbr.sp, for the induction variable update and the test
+// at the end of a rotated loop. Saves a dispatch on every iteration.
+static void
+fuse_add_imm_condbr_sp (TransformData *td, InterpInst *ins)
+{
+#if HOST_BROWSER
+	// The jiterpreter compiles these loops to wasm, keep them made of opcodes it knows
+	if (mono_opt_jiterpreter_traces_enabled)
+		return;
+#endif
+	int fused_op = get_add_imm_condbr_sp (ins->opcode);
+	if (fused_op == MINT_NOP)
+		return;
+	InterpInst *add_ins = interp_prev_ins (ins);
+	if (!add_ins || (add_ins->opcode != MINT_ADD_I4_IMM && add_ins->opcode != MINT_ADD1_I4))
+		return;
+	if (add_ins->dreg != ins->sregs [0])
+		return;
+
+	InterpInst *new_ins = interp_insert_ins (td, ins, fused_op);
+	new_ins->dreg = add_ins->dreg;
+	new_ins->sregs [0] = add_ins->sregs [0];
+	new_ins->sregs [1] = ins->sregs [1];
+	new_ins->data [0] = add_ins->opcode == MINT_ADD1_I4 ? 1 : add_ins->data [0];
+	new_ins->info.target_bb = ins->info.target_bb;
+	interp_clear_ins (add_ins);
+	interp_clear_ins (ins);
+	td->local_ref_count [new_ins->dreg]--;
+	mono_interp_stats.super_instructions++;
+	if (td->verbose_level) {
+		g_print ("superins: ");
+		dump_interp_inst (new_ins);
+	}
+}
+
 static void
 interp_super_instructions (TransformData *td)
 {
@@ -9432,6 +9901,7 @@ interp_super_instructions (TransformData *td)
 								g_print ("superins: ");
 								dump_interp_inst (ins);
 							}
+							fuse_add_imm_condbr_sp (td, ins);
 						}
 					}
 				}
@@ -9463,6 +9933,9 @@ interp_optimize_code (TransformData *td)
 	if (mono_interp_opt & INTERP_OPT_BBLOCKS)
 		interp_optimize_bblocks (td);
 
+	if (mono_interp_opt & INTERP_OPT_SUPERBLOCKS)
+		interp_rotate_loops (td);
+
 	if (mono_interp_opt & INTERP_OPT_CPROP)
 		MONO_TIME_TRACK (mono_interp_stats.cprop_time, interp_cprop (td));
 
@@ -9503,10 +9976,9 @@ initialize_global_var (TransformData *td, int var, int bb_index)
 	if (td->locals [var].bb_index == -1) {
 		td->locals [var].bb_index = bb_index;
 	} else if (td->locals [var].bb_index != bb_index) {
-		// var used in multiple basic blocks
+		// var used in multiple basic blocks, its offset is allocated by interp_alloc_global_var_offsets
 		if (td->verbose_level)
-			g_print ("alloc global var %d to offset %d\n", var, td->total_locals_size);
-		alloc_global_var_offset (td, var);
+			g_print ("global var %d\n", var);
 		td->locals [var].flags |= INTERP_LOCAL_FLAG_GLOBAL;
 	}
 }
@@ -9531,8 +10003,9 @@ initialize_global_vars (TransformData *td)
 				continue;
 			} else if (opcode == MINT_LDLOCA_S) {
 				int var = ins->sregs [0];
-				// If global flag is set, it means its offset was already allocated
-				if (!(td->locals [var].flags & INTERP_LOCAL_FLAG_GLOBAL)) {
+				// Vars whose address is taken always get their own offset. Other global vars
+				// don't have an offset yet, they are allocated by interp_alloc_global_var_offsets
+				if (td->locals [var].offset == -1) {
 					if (td->verbose_level)
 						g_print ("alloc ldloca global var %d to offset %d\n", var, td->total_locals_size);
 					alloc_global_var_offset (td, var);
@@ -9736,6 +10209,249 @@ dump_active_vars (TransformData *td, ActiveVars *av)
 	}
 }
 
+// Global vars whose live ranges span more than this many bits of liveness sets are given their own offsets
+#define INTERP_GLOBAL_VAR_LIVENESS_LIMIT (64 * 1024 * 1024)
+
+typedef struct {
+	int var;
+	// Positions of the first and last instruction, in basic block order, where the var is alive
+	int start;
+	int end;
+} GlobalVarRange;
+
+typedef struct {
+	int *var_to_index;
+	GlobalVarRange *ranges;
+	MonoBitSet *use;
+	MonoBitSet *def;
+	int pos;
+} GlobalVarScan;
+
+static void
+scan_global_var_use (GlobalVarScan *scan, int var)
+{
+	int index = scan->var_to_index [var];
+	if (index == -1)
+		return;
+	if (!mono_bitset_test_fast (scan->def, index))
+		mono_bitset_set_fast (scan->use, index);
+	scan->ranges [index].start = MIN (scan->ranges [index].start, scan->pos);
+	scan->ranges [index].end = MAX (scan->ranges [index].end, scan->pos);
+}
+
+static void
+scan_global_var_def (GlobalVarScan *scan, int var)
+{
+	int index = scan->var_to_index [var];
+	if (index == -1)
+		return;
+	mono_bitset_set_fast (scan->def, index);
+	scan->ranges [index].start = MIN (scan->ranges [index].start, scan->pos);
+	scan->ranges [index].end = MAX (scan->ranges [index].end, scan->pos);
+}
+
+static void
+scan_global_vars_ins (GlobalVarScan *scan, InterpInst *ins)
+{
+	int opcode = ins->opcode;
+	for (int i = 0; i < mono_interp_op_sregs [opcode]; i++) {
+		int sreg = ins->sregs [i];
+		if (sreg == MINT_CALL_ARGS_SREG) {
+			int *call_args = ins->info.call_args;
+			if (call_args) {
+				while (*call_args != -1) {
+					scan_global_var_use (scan, *call_args);
+					call_args++;
+				}
+			}
+		} else {
+			scan_global_var_use (scan, sreg);
+		}
+	}
+	if (opcode >= MINT_MOV_8_2 && opcode <= MINT_MOV_8_4) {
+		// Moves to the param area keep their vars in the data slots, as (dreg, sreg) pairs
+		int num_pairs = opcode - MINT_MOV_8_2 + 2;
+		for (int i = 0; i < num_pairs; i++)
+			scan_global_var_use (scan, ins->data [2 * i + 1]);
+		for (int i = 0; i < num_pairs; i++)
+			scan_global_var_def (scan, ins->data [2 * i]);
+	}
+	if (mono_interp_op_dregs [opcode])
+		scan_global_var_def (scan, ins->dreg);
+}
+
+static int
+compare_global_var_ranges (const void *a, const void *b)
+{
+	const GlobalVarRange *ra = (const GlobalVarRange*)a;
+	const GlobalVarRange *rb = (const GlobalVarRange*)b;
+	if (ra->start != rb->start)
+		return ra->start < rb->start ? -1 : 1;
+	return ra->var - rb->var;
+}
+
+/*
+ * Allocates the offsets of the global vars that don't have one yet. A liveness analysis over the
+ * control flow graph gives the range of instructions, in basic block order, where each var is alive
+ * and a linear scan over these ranges lets vars that are never alive at the same time share their
+ * offset, so large methods don't need a separate slot for every var used across basic blocks.
+ */
+static void
+interp_alloc_global_var_offsets (TransformData *td)
+{
+	int num_vars = 0;
+	int *var_to_index = (int*)mono_mempool_alloc (td->mempool, td->locals_size * sizeof (int));
+	for (unsigned int i = 0; i < td->locals_size; i++) {
+		if ((td->locals [i].flags & INTERP_LOCAL_FLAG_GLOBAL) && td->locals [i].offset == -1)
+			var_to_index [i] = num_vars++;
+		else
+			var_to_index [i] = -1;
+	}
+	if (!num_vars)
+		return;
+
+	// Exception handlers are not successors of the basic blocks in their protected regions, so
+	// liveness doesn't tell which vars are alive when a handler is entered.
+	if (td->header->num_clauses || num_vars == 1 || (gint64)num_vars * td->bb_count > INTERP_GLOBAL_VAR_LIVENESS_LIMIT) {
+		for (unsigned int i = 0; i < td->locals_size; i++) {
+			if (var_to_index [i] != -1) {
+				if (td->verbose_level)
+					g_print ("alloc global var %d to offset %d\n", i, td->total_locals_size);
+				alloc_global_var_offset (td, i);
+			}
+		}
+		return;
+	}
+
+	GlobalVarRange *ranges = (GlobalVarRange*)mono_mempool_alloc (td->mempool, num_vars * sizeof (GlobalVarRange));
+	for (unsigned int i = 0; i < td->locals_size; i++) {
+		int index = var_to_index [i];
+		if (index != -1) {
+			ranges [index].var = i;
+			ranges [index].start = G_MAXINT32;
+			ranges [index].end = -1;
+		}
+	}
+
+	InterpBasicBlock **bbs = (InterpBasicBlock**)mono_mempool_alloc0 (td->mempool, td->bb_count * sizeof (InterpBasicBlock*));
+	MonoBitSet **use = (MonoBitSet**)mono_mempool_alloc0 (td->mempool, td->bb_count * sizeof (MonoBitSet*));
+	MonoBitSet **def = (MonoBitSet**)mono_mempool_alloc0 (td->mempool, td->bb_count * sizeof (MonoBitSet*));
+	MonoBitSet **live_in = (MonoBitSet**)mono_mempool_alloc0 (td->mempool, td->bb_count * sizeof (MonoBitSet*));
+	MonoBitSet **live_out = (MonoBitSet**)mono_mempool_alloc0 (td->mempool, td->bb_count * sizeof (MonoBitSet*));
+	int *bb_start = (int*)mono_mempool_alloc0 (td->mempool, td->bb_count * sizeof (int));
+	int *bb_end = (int*)mono_mempool_alloc0 (td->mempool, td->bb_count * sizeof (int));
+	guint32 bitset_size = mono_bitset_alloc_size (num_vars, 0);
+
+	GlobalVarScan scan;
+	scan.var_to_index = var_to_index;
+	scan.ranges = ranges;
+	scan.pos = 0;
+
+	int num_bbs = 0;
+	for (InterpBasicBlock *bb = td->entry_bb; bb != NULL; bb = bb->next_bb) {
+		int index = bb->index;
+		bbs [num_bbs++] = bb;
+		use [index] = mono_bitset_mem_new (mono_mempool_alloc0 (td->mempool, bitset_size), num_vars, 0);
+		def [index] = mono_bitset_mem_new (mono_mempool_alloc0 (td->mempool, bitset_size), num_vars, 0);
+		live_in [index] = mono_bitset_mem_new (mono_mempool_alloc0 (td->mempool, bitset_size), num_vars, 0);
+		live_out [index] = mono_bitset_mem_new (mono_mempool_alloc0 (td->mempool, bitset_size), num_vars, 0);
+
+		scan.use = use [index];
+		scan.def = def [index];
+		bb_start [index] = scan.pos;
+		for (InterpInst *ins = bb->first_ins; ins != NULL; ins = ins->next) {
+			if (ins->opcode == MINT_NOP)
+				continue;
+			scan_global_vars_ins (&scan, ins);
+			scan.pos++;
+		}
+		// Empty basic blocks still get a position, so vars alive through them have a range
+		if (scan.pos == bb_start [index])
+			scan.pos++;
+		bb_end [index] = scan.pos - 1;
+	}
+
+	// Backwards dataflow, visiting the basic blocks in reverse order makes it converge faster
+	MonoBitSet *new_live_in = mono_bitset_mem_new (mono_mempool_alloc0 (td->mempool, bitset_size), num_vars, 0);
+	gboolean changed = TRUE;
+	while (changed) {
+		changed = FALSE;
+		for (int i = num_bbs - 1; i >= 0; i--) {
+			InterpBasicBlock *bb = bbs [i];
+			int index = bb->index;
+			for (int j = 0; j < bb->out_count; j++)
+				mono_bitset_union (live_out [index], live_in [bb->out_bb [j]->index]);
+
+			mono_bitset_copyto (live_out [index], new_live_in);
+			mono_bitset_sub (new_live_in, def [index]);
+			mono_bitset_union (new_live_in, use [index]);
+			if (!mono_bitset_equal (new_live_in, live_in [index])) {
+				mono_bitset_copyto (new_live_in, live_in [index]);
+				changed = TRUE;
+			}
+		}
+	}
+
+	// Extend the ranges to the basic blocks that the vars are alive through
+	for (int i = 0; i < num_bbs; i++) {
+		int index = bbs [i]->index;
+		for (int j = mono_bitset_find_first (live_in [index], -1); j != -1; j = mono_bitset_find_first (live_in [index], j)) {
+			ranges [j].start = MIN (ranges [j].start, bb_start [index]);
+			ranges [j].end = MAX (ranges [j].end, bb_start [index]);
+		}
+		for (int j = mono_bitset_find_first (live_out [index], -1); j != -1; j = mono_bitset_find_first (live_out [index], j)) {
+			ranges [j].start = MIN (ranges [j].start, bb_end [index]);
+			ranges [j].end = MAX (ranges [j].end, bb_end [index]);
+		}
+	}
+
+	qsort (ranges, num_vars, sizeof (GlobalVarRange), compare_global_var_ranges);
+
+	// Linear scan. A var can reuse the offset of a var of the same size whose range ended before
+	// its own range starts. Ranges that end and start at the same instruction conflict, since the
+	// dreg of an instruction can be written before all its sregs are read.
+	GlobalVarRange **active = (GlobalVarRange**)mono_mempool_alloc (td->mempool, num_vars * sizeof (GlobalVarRange*));
+	int *free_vars = (int*)mono_mempool_alloc (td->mempool, num_vars * sizeof (int));
+	int num_active = 0;
+	int num_free = 0;
+	for (int i = 0; i < num_vars; i++) {
+		GlobalVarRange *range = &ranges [i];
+		int var = range->var;
+
+		int k = 0;
+		for (int j = 0; j < num_active; j++) {
+			if (active [j]->end < range->start)
+				free_vars [num_free++] = active [j]->var;
+			else
+				active [k++] = active [j];
+		}
+		num_active = k;
+
+		int size = ALIGN_TO (td->locals [var].size, MINT_STACK_SLOT_SIZE);
+		int free_index = -1;
+		if (range->end != -1) {
+			for (int j = 0; j < num_free; j++) {
+				if (ALIGN_TO (td->locals [free_vars [j]].size, MINT_STACK_SLOT_SIZE) == size) {
+					free_index = j;
+					break;
+				}
+			}
+		}
+
+		if (free_index != -1) {
+			td->locals [var].offset = td->locals [free_vars [free_index]].offset;
+			free_vars [free_index] = free_vars [--num_free];
+			if (td->verbose_level)
+				g_print ("alloc global var %d to shared offset %d (range %d-%d)\n", var, td->locals [var].offset, range->start, range->end);
+		} else {
+			if (td->verbose_level)
+				g_print ("alloc global var %d to offset %d (range %d-%d)\n", var, td->total_locals_size, range->start, range->end);
+			alloc_global_var_offset (td, var);
+		}
+		active [num_active++] = range;
+	}
+}
+
 static void
 interp_alloc_offsets (TransformData *td)
 {
@@ -9751,16 +10467,10 @@ interp_alloc_offsets (TransformData *td)
 	init_active_vars (td, &av);
 	init_active_calls (td, &ac);
 
-	int final_total_locals_size = td->total_locals_size;
-	// We now have the top of stack offset. All local regs are allocated after this offset, with each basic block
+	// Copy global vars passed to calls into local vars and compute the live ranges of local vars
 	for (bb = td->entry_bb; bb != NULL; bb = bb->next_bb) {
 		InterpInst *ins;
 		int ins_index = 0;
-		if (td->verbose_level)
-			g_print ("BB%d\n", bb->index);
-
-		reinit_active_calls (td, &ac);
-		reinit_active_vars (td, &av);
 
 		for (ins = bb->first_ins; ins != NULL; ins = ins->next) {
 			if (ins->opcode == MINT_NOP)
@@ -9851,9 +10561,22 @@ interp_alloc_offsets (TransformData *td)
 			foreach_local_var (td, ins, (gpointer)(gsize)ins_index, set_var_live_range_cb);
 			ins_index++;
 		}
+	}
+
+	interp_alloc_global_var_offsets (td);
+
+	int final_total_locals_size = td->total_locals_size;
+	// We now have the top of stack offset. All local regs are allocated after this offset, with each basic block
+	for (bb = td->entry_bb; bb != NULL; bb = bb->next_bb) {
+		InterpInst *ins;
+		int ins_index = 0;
 		gint32 current_offset = td->total_locals_size;
+		if (td->verbose_level)
+			g_print ("BB%d\n", bb->index);
+
+		reinit_active_calls (td, &ac);
+		reinit_active_vars (td, &av);
 
-		ins_index = 0;
 		for (ins = bb->first_ins; ins != NULL; ins = ins->next) {
 			int opcode = ins->opcode;
 			gboolean is_call = ins->flags & INTERP_INST_FLAG_CALL;
@@ -10138,6 +10861,12 @@ retry:
 
 	mono_interp_register_imethod_data_items (rtm->data_items, td->imethod_items);
 	rtm->patchpoint_data = td->patchpoint_data;
+	if (td->callvirt_cache_sites) {
+		int terminator = G_MAXINT32;
+		g_array_append_val (td->callvirt_cache_sites, terminator);
+		rtm->callvirt_cache_sites = (int*)mono_mem_manager_alloc0 (td->mem_manager, td->callvirt_cache_sites->len * sizeof (int));
+		memcpy (rtm->callvirt_cache_sites, td->callvirt_cache_sites->data, td->callvirt_cache_sites->len * sizeof (int));
+	}
 
 	/* Save debug info */
 	interp_save_debug_info (rtm, header, td, td->line_numbers);
@@ -10188,6 +10917,8 @@ exit:
 	g_ptr_array_free (td->seq_points, TRUE);
 	if (td->line_numbers)
 		g_array_free (td->line_numbers, TRUE);
+	if (td->callvirt_cache_sites)
+		g_array_free (td->callvirt_cache_sites, TRUE);
 	g_slist_free (td->imethod_items);
 	mono_mempool_destroy (td->mempool);
 	if (retry_compilation)
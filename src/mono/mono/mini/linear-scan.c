@@ -281,6 +281,27 @@ regalloc_cost (MonoCompile *cfg, MonoMethodVar *vmv)
 	return (ins->opcode == OP_ARG) ? 1 : 0;
 }
 
+/*
+ * reg_free_for_interval:
+ *
+ *   Return whether none of the inactive intervals assigned to REG intersect CURRENT,
+ * i.e. whether REG is available for the whole of CURRENT once its active owner is
+ * spilled.
+ */
+static gboolean
+reg_free_for_interval (GList *inactive, int reg, MonoMethodVar *current)
+{
+	GList *l;
+
+	for (l = inactive; l != NULL; l = l->next) {
+		MonoMethodVar *v = (MonoMethodVar*)l->data;
+
+		if (v->reg == reg && mono_linterval_get_intersect_pos (current->interval, v->interval) != -1)
+			return FALSE;
+	}
+	return TRUE;
+}
+
 void
 mono_linear_scan2 (MonoCompile *cfg, GList *vars, GList *regs, regmask_t *used_mask)
 {
@@ -420,44 +441,40 @@ mono_linear_scan2 (MonoCompile *cfg, GList *vars, GList *regs, regmask_t *used_m
 			 * supported, so we spill in this case too.
 			 */
 
-			/* Spill an interval */
+			/*
+			 * Spill an interval. Evict the cheapest active interval whose register
+			 * would then be free for the whole of CURRENT, and give that register to
+			 * CURRENT. Spill costs are weighted by loop nesting, so this keeps loop
+			 * carried values in registers at the expense of values used outside loops.
+			 */
+			MonoMethodVar *spill_candidate = NULL;
 
-			/* FIXME: Optimize the selection of the interval */
+			for (l = active; l != NULL; l = l->next) {
+				vmv = (MonoMethodVar*)l->data;
+
+				if (vmv->reg < 0 || vmv->spill_costs >= current->spill_costs)
+					continue;
+				if (spill_candidate && vmv->spill_costs >= spill_candidate->spill_costs)
+					continue;
+				if (!reg_free_for_interval (inactive, vmv->reg, current))
+					continue;
+				spill_candidate = vmv;
+			}
 
-			if (active) {
-				GList *min_spill_pos;
-#if 0
-				/*
-				 * This favors registers with big spill costs, thus larger liveness ranges,
-				 * thus actually leading to worse code size.
-				 */
-				guint32 min_spill_value = G_MAXINT32;
-
-				for (l = active; l != NULL; l = l->next) {
-					vmv = (MonoMethodVar*)l->data;
-
-					if (vmv->spill_costs < min_spill_value) {
-						min_spill_pos = l;
-						min_spill_value = vmv->spill_costs;
-					}
-				}
-#else
-				/* Spill either the first active or the current interval */
-				min_spill_pos = active;
-#endif
-				vmv = (MonoMethodVar*)min_spill_pos->data;
-				if (vmv->spill_costs < current->spill_costs) {
-				//				if (vmv->interval->last_range->to < current->interval->last_range->to) {
-					gains [vmv->reg] -= vmv->spill_costs;
-					vmv->reg = -1;
-					LSCAN_DEBUG (printf ("\tSpilled R%d\n", cfg->varinfo [vmv->idx]->dreg));
-					active = g_list_delete_link (active, min_spill_pos);
-				}
-				else
-					LSCAN_DEBUG (printf ("\tSpilled current (cost %d)\n", current->spill_costs));
+			if (spill_candidate) {
+				reg = spill_candidate->reg;
+				gains [reg] -= spill_candidate->spill_costs;
+				spill_candidate->reg = -1;
+				active = g_list_remove (active, spill_candidate);
+				LSCAN_DEBUG (printf ("\tSpilled R%d\n", cfg->varinfo [spill_candidate->idx]->dreg));
+
+				current->reg = reg;
+				active = g_list_append (active, current);
+				gains [reg] += current->spill_costs;
+				LSCAN_DEBUG (printf ("\tAssigned hreg %d to R%d\n", reg, cfg->varinfo [current->idx]->dreg));
+			} else {
+				LSCAN_DEBUG (printf ("\tSpilled current (cost %d)\n", current->spill_costs));
 			}
-			else
-				LSCAN_DEBUG (printf ("\tSpilled current\n"));
 		}
 	}
 
@@ -263,6 +263,12 @@ INTRINS_OVR(WASM_BITMASK_V4, wasm_bitmask, Wasm, sse_i4_t)
 INTRINS_OVR(WASM_BITMASK_V2, wasm_bitmask, Wasm, sse_i8_t)
 INTRINS_OVR(WASM_FABS_V4, fabs, Generic, sse_r4_t)
 INTRINS_OVR(WASM_FABS_V2, fabs, Generic, sse_r8_t)
+INTRINS_OVR(WASM_SQRT_V4, sqrt, Generic, sse_r4_t)
+INTRINS_OVR(WASM_SQRT_V2, sqrt, Generic, sse_r8_t)
+INTRINS_OVR(WASM_CEIL_V4, ceil, Generic, sse_r4_t)
+INTRINS_OVR(WASM_CEIL_V2, ceil, Generic, sse_r8_t)
+INTRINS_OVR(WASM_FLOOR_V4, floor, Generic, sse_r4_t)
+INTRINS_OVR(WASM_FLOOR_V2, floor, Generic, sse_r8_t)
 INTRINS(WASM_DOT, wasm_dot, Wasm)
 INTRINS(WASM_SHUFFLE, wasm_shuffle, Wasm)
 INTRINS(WASM_SWIZZLE, wasm_swizzle, Wasm)
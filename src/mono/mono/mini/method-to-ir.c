@@ -3036,6 +3036,45 @@ emit_class_init (MonoCompile *cfg, MonoClass *klass, gboolean for_field_access)
 	}
 }
 
+#if defined(ENABLE_EXPERIMENT_TIERED) && defined(ENABLE_LLVM)
+/*
+ * emit_tiered_counter:
+ *
+ *   Count the calls to METHOD, and queue it for recompilation with LLVM once
+ * it reaches the threshold of the LLVM tier. The increment is racy, the count
+ * only needs to be approximate.
+ */
+static void
+emit_tiered_counter (MonoCompile *cfg, MonoMethod *method)
+{
+	MiniTieredCounter *tcnt;
+	MonoBasicBlock *done_bb;
+	MonoInst *args [3];
+	int hotness_reg;
+
+	tcnt = (MiniTieredCounter *)mono_mem_manager_alloc0 (cfg->mem_manager, sizeof (MiniTieredCounter));
+
+	EMIT_NEW_METHODCONST (cfg, args [0], method);
+	EMIT_NEW_PCONST (cfg, args [1], tcnt);
+	EMIT_NEW_ICONST (cfg, args [2], TIERED_PATCH_KIND_JIT);
+
+	hotness_reg = alloc_ireg (cfg);
+	MONO_EMIT_NEW_LOAD_MEMBASE_OP (cfg, OP_LOADI4_MEMBASE, hotness_reg, args [1]->dreg, MONO_STRUCT_OFFSET (MiniTieredCounter, hotness));
+	MONO_EMIT_NEW_BIALU_IMM (cfg, OP_IADD_IMM, hotness_reg, hotness_reg, 1);
+	MONO_EMIT_NEW_STORE_MEMBASE (cfg, OP_STOREI4_MEMBASE_REG, args [1]->dreg, MONO_STRUCT_OFFSET (MiniTieredCounter, hotness), hotness_reg);
+
+	NEW_BBLOCK (cfg, done_bb);
+
+	MONO_EMIT_NEW_BIALU_IMM (cfg, OP_ICOMPARE_IMM, -1, hotness_reg, mini_tiered_get_threshold (TIERED_PATCH_KIND_JIT));
+	MONO_EMIT_NEW_BRANCH_BLOCK (cfg, OP_IBNE_UN, done_bb);
+
+	cfg->cbb->out_of_line = TRUE;
+	mono_emit_jit_icall (cfg, mini_tiered_inc, args);
+
+	MONO_START_BB (cfg, done_bb);
+}
+#endif
+
 static void
 emit_seq_point (MonoCompile *cfg, MonoMethod *method, guint8* ip, gboolean intr_loc, gboolean nonempty_stack)
 {
@@ -6800,6 +6839,14 @@ mono_method_to_ir (MonoCompile *cfg, MonoMethod *method, MonoBasicBlock *start_b
 			emit_llvmonly_interp_entry (cfg, header);
 	}
 
+#if defined(ENABLE_EXPERIMENT_TIERED) && defined(ENABLE_LLVM)
+	if (mono_llvm_tiered && cfg->method == method && !cfg->compile_llvm && !cfg->compile_aot && !cfg->gshared && method->wrapper_type == MONO_WRAPPER_NONE) {
+		emit_tiered_counter (cfg, method);
+		init_localsbb = cfg->cbb;
+		init_localsbb2 = cfg->cbb;
+	}
+#endif
+
 	/* FIRST CODE BLOCK */
 	NEW_BBLOCK (cfg, tblock);
 	tblock->cil_code = ip;
@@ -125,6 +125,12 @@ int mini_verbose = 0;
  */
 gboolean mono_use_llvm = FALSE;
 
+/*
+ * When set, methods are first compiled by the JIT and then recompiled with LLVM in
+ * the background once they become hot. Requires ENABLE_EXPERIMENT_TIERED.
+ */
+gboolean mono_llvm_tiered = FALSE;
+
 gboolean mono_use_fast_math = FALSE;
 
 // Lists of allowlisted and blocklisted CPU features
@@ -4425,6 +4431,30 @@ mini_is_interpreter_enabled (void)
 	return mono_use_interpreter;
 }
 
+#if defined(ENABLE_EXPERIMENT_TIERED) && defined(ENABLE_LLVM)
+/* Runs on the tiered compilation thread once a JITted method became hot */
+static gpointer
+llvm_tier_compiler (MiniTieredPatchPointContext *ctx)
+{
+	MonoMethod *method = ctx->target_method;
+
+	return mono_jit_recompile_method_llvm (method, mono_get_optimizations_for_method (method, default_opt));
+}
+
+static gboolean
+llvm_tier_patcher (MiniTieredPatchPointContext *ctx, gpointer patchsite)
+{
+	MonoJitInfo *ji = mini_jit_info_table_find (patchsite);
+
+	/* LLVM code doesn't make direct calls */
+	if (!ji || ji->from_llvm)
+		return FALSE;
+
+	mono_arch_patch_callsite ((guint8 *)ji->code_start, (guint8 *)patchsite, (guint8 *)MINI_FTNPTR_TO_ADDR (ctx->target_code));
+	return TRUE;
+}
+#endif
+
 static const char*
 mono_get_runtime_build_version (void);
 
@@ -4709,6 +4739,12 @@ mini_init (const char *filename)
 
 #ifdef ENABLE_EXPERIMENT_TIERED
 	if (!mono_compile_aot) {
+#ifdef ENABLE_LLVM
+		if (mono_llvm_tiered) {
+			mini_tiered_register_tier_compiler (llvm_tier_compiler, TIERED_PATCH_KIND_JIT);
+			mini_tiered_register_callsite_patcher (llvm_tier_patcher, TIERED_PATCH_KIND_JIT);
+		}
+#endif
 		/* create compilation thread in background */
 		mini_tiered_init ();
 	}
@@ -4971,6 +5007,9 @@ register_icalls (void)
 	register_icall_no_wrapper (mono_dummy_jit_icall, mono_icall_sig_void);
 	//register_icall_no_wrapper (mono_dummy_jit_icall_val, mono_icall_sig_void_ptr);
 	register_icall_no_wrapper (mini_init_method_rgctx, mono_icall_sig_void_ptr_ptr);
+#ifdef ENABLE_EXPERIMENT_TIERED
+	register_icall (mini_tiered_inc, mono_icall_sig_void_ptr_ptr_int32, FALSE);
+#endif
 
 	register_icall_with_wrapper (mono_monitor_enter_internal, mono_icall_sig_int32_obj);
 	register_icall_with_wrapper (mono_monitor_enter_v4_internal, mono_icall_sig_void_obj_ptr);
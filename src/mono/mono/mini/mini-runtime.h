@@ -455,6 +455,7 @@ MONO_API_DATA const char *mono_build_date;
 MONO_END_DECLS
 extern gboolean mono_do_signal_chaining;
 extern gboolean mono_do_crash_chaining;
+extern gboolean mono_llvm_tiered;
 MONO_BEGIN_DECLS
 MONO_API_DATA gboolean mono_use_llvm;
 MONO_API_DATA gboolean mono_use_fast_math;
@@ -733,6 +733,11 @@ common_call_trampoline (host_mgreg_t *regs, guint8 *code, MonoMethod *m, MonoVTa
 				no_patch = TRUE;
 			if (!no_patch && ji)
 				mono_arch_patch_callsite ((guint8 *)ji->code_start, code, (guint8 *)addr);
+#if defined(ENABLE_EXPERIMENT_TIERED) && defined(ENABLE_LLVM)
+			/* Repatched to the LLVM code once the callee becomes hot, gshared code has no counters */
+			if (!no_patch && ji && mono_llvm_tiered && target_ji && !target_ji->from_llvm && !target_ji->has_generic_jit_info)
+				mini_tiered_record_callsite (code, m, TIERED_PATCH_KIND_JIT);
+#endif
 		}
 	}
 
@@ -4263,6 +4263,64 @@ mono_jit_compile_method_inner (MonoMethod *method, int opt, MonoError *error)
 	return MINI_ADDR_TO_FTNPTR (code);
 }
 
+#if defined(ENABLE_EXPERIMENT_TIERED) && defined(ENABLE_LLVM)
+/*
+ * mono_jit_recompile_method_llvm:
+ *
+ *   Recompile METHOD, which already has JITted code, with the LLVM backend, and make
+ * the result the code returned by future lookups of METHOD. Code which already
+ * called into the old code keeps doing so until its callsites are patched.
+ * Returns NULL if LLVM can't compile METHOD.
+ */
+gpointer
+mono_jit_recompile_method_llvm (MonoMethod *method, int opt)
+{
+	MonoCompile *cfg;
+	MonoJitInfo *jinfo;
+	gpointer code;
+	gint64 start;
+
+	start = mono_time_track_start ();
+	cfg = mini_method_compile (method, opt, (JitFlags)(JIT_FLAG_RUN_CCTORS | JIT_FLAG_LLVM), 0, -1);
+	gint64 jit_time = 0;
+	mono_time_track_end (&jit_time, start);
+	UnlockedAdd64 (&mono_jit_stats.jit_time, jit_time);
+
+	/* If LLVM failed, mini_method_compile () fell back to the JIT, keep the existing code */
+	if (cfg->exception_type != MONO_EXCEPTION_NONE || !cfg->compile_llvm) {
+		mono_destroy_compile (cfg);
+		return NULL;
+	}
+
+	mono_loader_lock ();
+
+	MonoJitMemoryManager *jit_mm = (MonoJitMemoryManager*)cfg->jit_mm;
+
+	jit_code_hash_lock (jit_mm);
+	mono_internal_hash_table_remove (&jit_mm->jit_code_hash, cfg->jit_info->d.method);
+	mono_internal_hash_table_insert (&jit_mm->jit_code_hash, cfg->jit_info->d.method, cfg->jit_info);
+	jit_code_hash_unlock (jit_mm);
+
+	code = cfg->native_code;
+	jinfo = cfg->jit_info;
+
+	mono_update_jit_stats (cfg);
+
+	mono_destroy_compile (cfg);
+
+	mini_patch_llvm_jit_callees (method, code);
+#ifndef DISABLE_JIT
+	mono_emit_jit_map (jinfo);
+	mono_emit_jit_dump (jinfo, code);
+#endif
+	mono_loader_unlock ();
+
+	MONO_PROFILER_RAISE (jit_done, (method, jinfo));
+
+	return MINI_ADDR_TO_FTNPTR (code);
+}
+#endif
+
 /*
  * mini_get_underlying_type:
  *
@@ -2187,6 +2187,7 @@ void mono_add_patch_info (MonoCompile *cfg, int ip, MonoJumpInfoType type, gcons
 void mono_add_patch_info_rel (MonoCompile *cfg, int ip, MonoJumpInfoType type, gconstpointer target, int relocation);
 void      mono_remove_patch_info            (MonoCompile *cfg, int ip);
 gpointer  mono_jit_compile_method_inner     (MonoMethod *method, int opt, MonoError *error);
+gpointer  mono_jit_recompile_method_llvm    (MonoMethod *method, int opt);
 GList    *mono_varlist_insert_sorted        (MonoCompile *cfg, GList *list, MonoMethodVar *mv, int sort_type);
 GList    *mono_varlist_sort                 (MonoCompile *cfg, GList *list, int sort_type);
 void      mono_analyze_liveness             (MonoCompile *cfg);
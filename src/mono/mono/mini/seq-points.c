@@ -25,7 +25,7 @@ insert_pred_seq_point (MonoInst *last_seq_ins, MonoInst *ins, GSList **next)
 		if (GPOINTER_TO_UINT (l->data) == dst_index)
 			break;
 	if (!l)
-		next [src_index] = g_slist_append (next [src_index], GUINT_TO_POINTER (dst_index));
+		next [src_index] = g_slist_prepend (next [src_index], GUINT_TO_POINTER (dst_index));
 }
 
 static void
@@ -148,7 +148,7 @@ mono_save_seq_point_info (MonoCompile *cfg, MonoJitInfo *jinfo)
 
 				if (last != NULL) {
 					/* Link with the previous seq point in the same bb */
-					next [last->backend.size] = g_slist_append (next [last->backend.size], GUINT_TO_POINTER (ins->backend.size));
+					next [last->backend.size] = g_slist_prepend (next [last->backend.size], GUINT_TO_POINTER (ins->backend.size));
 				} else {
 					/* Link with the last bb in the previous bblocks */
 					collect_pred_seq_points (cfg, bb, ins, next);
@@ -175,13 +175,17 @@ mono_save_seq_point_info (MonoCompile *cfg, MonoJitInfo *jinfo)
 							MonoInst *ins = (MonoInst *)l->data;
 
 							if (!(ins->inst_imm == METHOD_ENTRY_IL_OFFSET || ins->inst_imm == METHOD_EXIT_IL_OFFSET) && ins != endfinally_seq_point)
-								next [endfinally_seq_point->backend.size] = g_slist_append (next [endfinally_seq_point->backend.size], GUINT_TO_POINTER (ins->backend.size));
+								next [endfinally_seq_point->backend.size] = g_slist_prepend (next [endfinally_seq_point->backend.size], GUINT_TO_POINTER (ins->backend.size));
 						}
 					}
 				}
 			}
 		}
 
+		/* The lists are built with prepend to avoid quadratic appends, restore the insertion order */
+		for (guint i = 0; i < cfg->seq_points->len; ++i)
+			next [i] = g_slist_reverse (next [i]);
+
 		if (cfg->verbose_level > 2) {
 			printf ("\nSEQ POINT MAP: \n");
 
@@ -201,7 +205,8 @@ mono_save_seq_point_info (MonoCompile *cfg, MonoJitInfo *jinfo)
 		}
 	}
 
-	array = g_byte_array_new ();
+	/* Most entries encode each delta in a single byte */
+	array = g_byte_array_sized_new (cfg->seq_points->len * (has_debug_data ? 6 : 2));
 
 	{ /* Add sequence points to seq_point_info */
 		SeqPoint zero_seq_point = {0};
@@ -17,6 +17,7 @@ static MonoCoopMutex compilation_mutex;
 
 static GSList *compilation_queue [NUM_TIERS];
 static CallsitePatcher patchers [NUM_TIERS] = { NULL };
+static TierCompiler compilers [NUM_TIERS] = { NULL };
 
 static const char* const patch_kind_str[] = {
 	"INTERP",
@@ -31,6 +32,42 @@ static const int threshold [NUM_TIERS] = {
 	3000, /* tier 1 */
 };
 
+static gboolean
+compilation_queued (void)
+{
+	for (int tier_level = 0; tier_level < NUM_TIERS; tier_level++)
+		if (compilation_queue [tier_level])
+			return TRUE;
+	return FALSE;
+}
+
+static void
+patch_callsites (MiniTieredPatchPointContext *ppc)
+{
+	/* A tier only replaces the callsites that call into the code of the tier below it */
+	int patch_kind = ppc->tier_level;
+
+	if (!callsites_hash [patch_kind] || !patchers [patch_kind])
+		return;
+
+	GSList *patchsites = g_hash_table_lookup (callsites_hash [patch_kind], ppc->target_method);
+
+	for (GSList *l = patchsites; l != NULL; l = l->next) {
+		gpointer patchsite = (gpointer) l->data;
+
+		mono_trace (G_LOG_LEVEL_DEBUG, MONO_TRACE_TIERED, "tiered: patching %p with patch_kind=%s @ tier_level=%d", patchsite, patch_kind_str [patch_kind], ppc->tier_level);
+		mono_trace (G_LOG_LEVEL_DEBUG, MONO_TRACE_TIERED, "\t-> caller=%s", mono_pmip (patchsite));
+		mono_trace (G_LOG_LEVEL_DEBUG, MONO_TRACE_TIERED, "\t-> callee=%s", mono_method_full_name (ppc->target_method, TRUE));
+
+		gboolean success = patchers [patch_kind] (ppc, patchsite);
+
+		if (!success)
+			mono_trace (G_LOG_LEVEL_WARNING, MONO_TRACE_TIERED, "tiered: couldn't patch %p with target %s, dropping it.", patchsite, mono_method_full_name (ppc->target_method, TRUE));
+	}
+	g_hash_table_remove (callsites_hash [patch_kind], ppc->target_method);
+	g_slist_free (patchsites);
+}
+
 static void
 compiler_thread (void)
 {
@@ -40,8 +77,10 @@ compiler_thread (void)
 
 	mono_native_thread_set_name (mono_native_thread_id_get (), "Tiered Compilation Thread");
 
+	mono_coop_mutex_lock (&compilation_mutex);
 	while (TRUE) {
-		mono_coop_cond_wait (&compilation_wait, &compilation_mutex);
+		while (!compilation_queued ())
+			mono_coop_cond_wait (&compilation_wait, &compilation_mutex);
 
 		for (int tier_level = 0; tier_level < NUM_TIERS; tier_level++) {
 			GSList *ppcs = compilation_queue [tier_level];
@@ -50,32 +89,24 @@ compiler_thread (void)
 			for (GSList *ppc_= ppcs; ppc_ != NULL; ppc_ = ppc_->next) {
 				MiniTieredPatchPointContext *ppc = (MiniTieredPatchPointContext *) ppc_->data;
 
-				for (int patch_kind = 0; patch_kind < TIERED_PATCH_KIND_NUM; patch_kind++) {
-					if (!callsites_hash [patch_kind])
-						continue;
-
-					GSList *patchsites = g_hash_table_lookup (callsites_hash [patch_kind], ppc->target_method);
-
-					for (; patchsites != NULL; patchsites = patchsites->next) {
-						gpointer patchsite = (gpointer) patchsites->data;
+				if (compilers [tier_level]) {
+					/* Compilation can take a while, don't block callsite recording meanwhile */
+					mono_coop_mutex_unlock (&compilation_mutex);
+					ppc->target_code = compilers [tier_level] (ppc);
+					mono_coop_mutex_lock (&compilation_mutex);
 
-						mono_trace (G_LOG_LEVEL_DEBUG, MONO_TRACE_TIERED, "tiered: patching %p with patch_kind=%s @ tier_level=%d", patchsite, patch_kind_str [patch_kind], tier_level);
-						mono_trace (G_LOG_LEVEL_DEBUG, MONO_TRACE_TIERED, "\t-> caller=%s", mono_pmip (patchsite));
-						mono_trace (G_LOG_LEVEL_DEBUG, MONO_TRACE_TIERED, "\t-> callee=%s", mono_method_full_name (ppc->target_method, TRUE));
-
-						gboolean success = patchers [patch_kind] (ppc, patchsite);
-
-						if (!success)
-							mono_trace (G_LOG_LEVEL_WARNING, MONO_TRACE_TIERED, "tiered: couldn't patch %p with target %s, dropping it.", patchsite, mono_method_full_name (ppc->target_method, TRUE));
+					if (!ppc->target_code) {
+						mono_trace (G_LOG_LEVEL_DEBUG, MONO_TRACE_TIERED, "tiered: couldn't compile %s @ tier_level=%d", mono_method_full_name (ppc->target_method, TRUE), tier_level);
+						g_free (ppc);
+						continue;
 					}
-					g_hash_table_remove (callsites_hash [patch_kind], ppc->target_method);
-					g_slist_free (patchsites);
 				}
+
+				patch_callsites (ppc);
 				g_free (ppc);
 			}
 			g_slist_free (ppcs);
 		}
-		mono_coop_mutex_unlock (&compilation_mutex);
 	}
 }
 
@@ -102,15 +133,33 @@ mini_tiered_register_callsite_patcher (CallsitePatcher func, int level)
 	patchers [level] = func;
 }
 
+void
+mini_tiered_register_tier_compiler (TierCompiler func, int level)
+{
+	g_assert (level < NUM_TIERS);
+
+	compilers [level] = func;
+}
+
+int
+mini_tiered_get_threshold (int level)
+{
+	g_assert (level < NUM_TIERS);
+
+	return threshold [level];
+}
+
 void
 mini_tiered_record_callsite (gpointer ip, MonoMethod *target_method, int patch_kind)
 {
+	mono_coop_mutex_lock (&compilation_mutex);
 	if (!callsites_hash [patch_kind])
 		callsites_hash [patch_kind] = g_hash_table_new (NULL, NULL);
 
 	GSList *patchsites = g_hash_table_lookup (callsites_hash [patch_kind], target_method);
 	patchsites = g_slist_prepend (patchsites, ip);
 	g_hash_table_insert (callsites_hash [patch_kind], target_method, patchsites);
+	mono_coop_mutex_unlock (&compilation_mutex);
 }
 
 void
@@ -19,10 +19,15 @@ typedef struct {
 typedef struct {
 	MonoMethod *target_method;
 	int tier_level;
+	/* Code produced by the tier compiler, NULL if the tier has none */
+	gpointer target_code;
 } MiniTieredPatchPointContext;
 
 typedef gboolean (*CallsitePatcher)(MiniTieredPatchPointContext *context, gpointer patchsite);
 
+/* Returns the code callsites are patched to, or NULL to drop the request */
+typedef gpointer (*TierCompiler)(MiniTieredPatchPointContext *context);
+
 void
 mini_tiered_init (void);
 
@@ -35,5 +40,11 @@ mini_tiered_record_callsite (gpointer callsite, MonoMethod *target_method, int l
 void
 mini_tiered_register_callsite_patcher (CallsitePatcher func, int level);
 
+void
+mini_tiered_register_tier_compiler (TierCompiler func, int level);
+
+int
+mini_tiered_get_threshold (int level);
+
 #endif /* __MONO_MINI_TIERED_H__ */
 #endif /* ENABLE_EXPERIMENT_TIERED */
@@ -18,6 +18,7 @@
 #include <mono/metadata/debug-helpers.h>
 #include <mono/metadata/assembly.h>
 #include <mono/metadata/class-internals.h>
+#include <mono/metadata/marshal.h>
 #include <mono/metadata/debug-helpers.h>
 #include <mono/utils/mono-publib.h>
 #include <mono/jit/jit.h>
@@ -39,6 +40,7 @@ struct _MonoProfiler {
 	GHashTable *classes;
 	GHashTable *images;
 	GPtrArray *methods;
+	GPtrArray *wrappers;
 	FILE *outfile;
 	int id;
 	char *outfile_name;
@@ -66,7 +68,19 @@ prof_jit_done (MonoProfiler *prof, MonoMethod *method, MonoJitInfo *jinfo)
 {
 	MonoImage *image = mono_class_get_image (mono_method_get_class (method));
 
-	if (!image->assembly || method->wrapper_type || !prof->methods || prof->disable)
+	if (!prof->methods || prof->disable)
+		return;
+
+	if (method->wrapper_type) {
+		/* Wrappers are saved in terms of the method they wrap, see get_wrapped_method () */
+		mono_os_mutex_lock (&prof->mutex);
+		if (prof->wrappers)
+			g_ptr_array_add (prof->wrappers, method);
+		mono_os_mutex_unlock (&prof->mutex);
+		return;
+	}
+
+	if (!image->assembly)
 		return;
 
 	if (prof->write_at && mono_method_desc_match (prof->write_at, method)) {
@@ -396,6 +410,7 @@ mono_profiler_init_aot (const char *desc)
 	aot_profiler.images = g_hash_table_new (NULL, NULL);
 	aot_profiler.classes = g_hash_table_new (NULL, NULL);
 	aot_profiler.methods = g_ptr_array_new ();
+	aot_profiler.wrappers = g_ptr_array_new ();
 
 	mono_os_mutex_init (&aot_profiler.mutex);
 
@@ -587,8 +602,30 @@ add_class (MonoProfiler *prof, MonoClass *klass)
 	return id;
 }
 
+/*
+ * add_method_refs:
+ *
+ *   Emit the records referenced by the description of M. Return FALSE if M
+ * can't be described in the profile.
+ */
+static gboolean
+add_method_refs (MonoProfiler *prof, MonoMethod *m, int *class_id, int *inst_id)
+{
+	*class_id = add_class (prof, m->klass);
+	if (*class_id == -1)
+		return FALSE;
+	*inst_id = -1;
+
+	if (m->is_inflated) {
+		MonoGenericContext *ctx = mono_method_get_context (m);
+		if (ctx->method_inst)
+			*inst_id = add_ginst (prof, ctx->method_inst);
+	}
+	return TRUE;
+}
+
 static void
-add_method (MonoProfiler *prof, MonoMethod *m)
+emit_method_data (MonoProfiler *prof, MonoMethod *m, int class_id, int inst_id)
 {
 	ERROR_DECL (error);
 	MonoMethodSignature *sig;
@@ -597,18 +634,6 @@ add_method (MonoProfiler *prof, MonoMethod *m)
 	sig = mono_method_signature_checked (m, error);
 	g_assert (is_ok (error));
 
-	int class_id = add_class (prof, m->klass);
-	if (class_id == -1)
-		return;
-	int inst_id = -1;
-
-	if (m->is_inflated) {
-		MonoGenericContext *ctx = mono_method_get_context (m);
-		if (ctx->method_inst)
-			inst_id = add_ginst (prof, ctx->method_inst);
-	}
-	int id = prof->id ++;
-	emit_record (prof, AOTPROF_RECORD_METHOD, id);
 	emit_int32 (prof, class_id);
 	emit_int32 (prof, inst_id);
 	emit_int32 (prof, sig->param_count);
@@ -616,11 +641,83 @@ add_method (MonoProfiler *prof, MonoMethod *m)
 	s = mono_signature_full_name (sig);
 	emit_string (prof, s);
 	g_free (s);
+}
+
+static void
+add_method (MonoProfiler *prof, MonoMethod *m)
+{
+	int class_id, inst_id;
+
+	if (!add_method_refs (prof, m, &class_id, &inst_id))
+		return;
+
+	int id = prof->id ++;
+	emit_record (prof, AOTPROF_RECORD_METHOD, id);
+	emit_method_data (prof, m, class_id, inst_id);
 
 	if (prof->verbose)
 		mono_profiler_printf ("%s %d", mono_method_full_name (m, 1), id);
 }
 
+/*
+ * get_wrapped_method:
+ *
+ *   Return the method WRAPPER was created for if the AOT compiler can recreate
+ * WRAPPER from it, NULL otherwise.
+ */
+static MonoMethod*
+get_wrapped_method (MonoMethod *wrapper, AotProfWrapperKind *kind)
+{
+	WrapperInfo *info = mono_marshal_get_wrapper_info (wrapper);
+
+	if (!info)
+		return NULL;
+
+	switch (wrapper->wrapper_type) {
+	case MONO_WRAPPER_RUNTIME_INVOKE:
+		/* Normal runtime invoke wrappers are shared between methods with the same signature */
+		if (info->subtype != WRAPPER_SUBTYPE_RUNTIME_INVOKE_DIRECT)
+			return NULL;
+		*kind = AOTPROF_WRAPPER_RUNTIME_INVOKE;
+		return info->d.runtime_invoke.method;
+	case MONO_WRAPPER_DELEGATE_INVOKE:
+		if (info->subtype != WRAPPER_SUBTYPE_NONE)
+			return NULL;
+		*kind = AOTPROF_WRAPPER_DELEGATE_INVOKE;
+		return info->d.delegate_invoke.method;
+	case MONO_WRAPPER_MANAGED_TO_NATIVE:
+		if (info->subtype != WRAPPER_SUBTYPE_NONE && info->subtype != WRAPPER_SUBTYPE_PINVOKE)
+			return NULL;
+		*kind = AOTPROF_WRAPPER_MANAGED_TO_NATIVE;
+		return info->d.managed_to_native.method;
+	default:
+		return NULL;
+	}
+}
+
+static void
+add_wrapper (MonoProfiler *prof, MonoMethod *wrapper)
+{
+	AotProfWrapperKind kind;
+	int class_id, inst_id;
+	MonoMethod *m;
+
+	m = get_wrapped_method (wrapper, &kind);
+	if (!m || m->wrapper_type || !mono_method_get_token (m))
+		return;
+
+	if (!add_method_refs (prof, m, &class_id, &inst_id))
+		return;
+
+	int id = prof->id ++;
+	emit_record (prof, AOTPROF_RECORD_WRAPPER, id);
+	emit_byte (prof, (guint8)kind);
+	emit_method_data (prof, m, class_id, inst_id);
+
+	if (prof->verbose)
+		mono_profiler_printf ("%s %d", mono_method_full_name (wrapper, 1), id);
+}
+
 static void
 prof_save (MonoProfiler *prof, FILE* file)
 {
@@ -656,6 +753,15 @@ prof_save (MonoProfiler *prof, FILE* file)
 
 		add_method (prof, m);
 	}
+	for (guint windex = 0; windex < prof->wrappers->len; ++windex) {
+		MonoMethod *m = (MonoMethod*)g_ptr_array_index (prof->wrappers, windex);
+
+		if (g_hash_table_lookup (all_methods, m))
+			continue;
+		g_hash_table_insert (all_methods, m, m);
+
+		add_wrapper (prof, m);
+	}
 	emit_record (prof, AOTPROF_RECORD_NONE, 0);
 
 	if (prof->send_to) {
@@ -736,8 +842,10 @@ prof_shutdown (MonoProfiler *prof)
 	g_hash_table_destroy (prof->classes);
 	g_hash_table_destroy (prof->images);
 	g_ptr_array_free (prof->methods, TRUE);
+	g_ptr_array_free (prof->wrappers, TRUE);
 	g_free (prof->outfile_name);
 
 	prof->methods = NULL;
+	prof->wrappers = NULL;
 	mono_os_mutex_unlock (&prof->mutex);
 }
@@ -53,12 +53,28 @@ typedef enum {
 	 * - string: method name
 	 * - string: method signature
 	 */
-	AOTPROF_RECORD_METHOD
+	AOTPROF_RECORD_METHOD,
+	/*
+	 * Contains info about a wrapper generated by the runtime, so it can be
+	 * prebuilt by the AOT compiler. Added in version 1.1.
+	 * - byte: wrapper kind (AotProfWrapperKind)
+	 * - followed by the data of an AOTPROF_RECORD_METHOD record for the wrapped method
+	 */
+	AOTPROF_RECORD_WRAPPER
 } AotProfRecordType;
 
+typedef enum {
+	/* Runtime invoke wrapper specific to the wrapped method */
+	AOTPROF_WRAPPER_RUNTIME_INVOKE,
+	/* Delegate invoke wrapper, the wrapped method is the Invoke method of the delegate */
+	AOTPROF_WRAPPER_DELEGATE_INVOKE,
+	/* Managed to native wrapper of a pinvoke method */
+	AOTPROF_WRAPPER_MANAGED_TO_NATIVE
+} AotProfWrapperKind;
+
 #define AOT_PROFILER_MAGIC "AOTPROFILE"
 
 #define AOT_PROFILER_MAJOR_VERSION 1
-#define AOT_PROFILER_MINOR_VERSION 0
+#define AOT_PROFILER_MINOR_VERSION 1
 
 #endif /* __MONO_PROFILER_AOT_H__ */
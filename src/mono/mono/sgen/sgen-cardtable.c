@@ -38,6 +38,53 @@
 #endif
 #include <sys/types.h>
 
+/*
+ * Where the target has 128-bit vectors, cards are tested for being dirty 16 at a
+ * time. Only the search for dirty cards is vectorized: the cards are written back
+ * one by one, since mutators can mark cards concurrently and storing a whole vector
+ * could undo their marks.
+ */
+#if defined(__GNUC__) && defined(__SSE2__)
+#include <emmintrin.h>
+
+#define SGEN_CARD_VECTOR_SIZE 16
+
+/* Returns the index of the first dirty card in the vector or SGEN_CARD_VECTOR_SIZE */
+static inline int
+card_vector_find_dirty (const guint8 *cards)
+{
+	__m128i v = _mm_loadu_si128 ((const __m128i*)cards);
+	int mask = _mm_movemask_epi8 (_mm_cmpeq_epi8 (v, _mm_setzero_si128 ())) ^ 0xffff;
+	return mask ? __builtin_ctz (mask) : SGEN_CARD_VECTOR_SIZE;
+}
+#elif defined(__GNUC__) && defined(__wasm_simd128__)
+#include <wasm_simd128.h>
+
+#define SGEN_CARD_VECTOR_SIZE 16
+
+static inline int
+card_vector_find_dirty (const guint8 *cards)
+{
+	v128_t v = wasm_v128_load (cards);
+	int mask = wasm_i8x16_bitmask (wasm_i8x16_ne (v, wasm_i8x16_splat (0)));
+	return mask ? __builtin_ctz (mask) : SGEN_CARD_VECTOR_SIZE;
+}
+#elif defined(__GNUC__) && defined(__aarch64__) && defined(__ARM_NEON)
+#include <arm_neon.h>
+
+#define SGEN_CARD_VECTOR_SIZE 16
+
+static inline int
+card_vector_find_dirty (const guint8 *cards)
+{
+	uint8x16_t v = vld1q_u8 (cards);
+	/* NEON has no movemask, narrow every byte to a nibble of a 64-bit mask instead */
+	uint8x8_t nibbles = vshrn_n_u16 (vreinterpretq_u16_u8 (vtstq_u8 (v, v)), 4);
+	guint64 mask = vget_lane_u64 (vreinterpret_u64_u8 (nibbles), 0);
+	return mask ? __builtin_ctzll (mask) / 4 : SGEN_CARD_VECTOR_SIZE;
+}
+#endif
+
 guint8 *sgen_cardtable;
 
 static gboolean need_mod_union;
@@ -191,17 +238,9 @@ sgen_card_table_region_begin_scanning (mword start, mword size)
 static gboolean
 sgen_card_table_region_begin_scanning (mword start, mword size)
 {
-	gboolean res = FALSE;
 	guint8 *card = sgen_card_table_get_card_address (start);
 	guint8 *end = card + sgen_card_table_number_of_cards_in_range (start, size);
-
-	/*XXX this can be improved to work on words and have a branchless body */
-	while (card != end) {
-		if (*card++) {
-			res = TRUE;
-			break;
-		}
-	}
+	gboolean res = sgen_find_next_card (card, end) != end;
 
 	memset (sgen_card_table_get_card_address (start), 0, size >> CARD_BITS);
 
@@ -267,12 +306,7 @@ sgen_card_table_is_range_marked (guint8 *cards, mword address, mword size)
 	guint8 *end = cards + sgen_card_table_number_of_cards_in_range (address, size);
 
 	/*This is safe since this function is only called by code that only passes continuous card blocks*/
-	while (cards != end) {
-		if (*cards++)
-			return TRUE;
-	}
-	return FALSE;
-
+	return sgen_find_next_card (cards, end) != end;
 }
 
 static void
@@ -297,10 +331,13 @@ sgen_card_table_find_address_with_cards (char *cards_start, guint8 *cards, char
 static void
 update_mod_union (guint8 *dest, guint8 *start_card, size_t num_cards)
 {
+	guint8 *card = start_card;
+	guint8 *end = start_card + num_cards;
+
 	/* Marking from another thread can happen while we mark here */
-	for (gsize i = 0; i < num_cards; ++i) {
-		if (start_card [i])
-			dest [i] = 1;
+	while ((card = sgen_find_next_card (card, end)) != end) {
+		dest [card - start_card] = 1;
+		++card;
 	}
 }
 
@@ -363,13 +400,13 @@ sgen_card_table_update_mod_union (guint8 *dest, char *obj, mword obj_size, size_
 void
 sgen_card_table_preclean_mod_union (guint8 *cards, guint8 *cards_preclean, size_t num_cards)
 {
-	size_t i;
+	guint8 *card = cards_preclean;
+	guint8 *end = cards_preclean + num_cards;
 
 	memcpy (cards_preclean, cards, num_cards);
-	for (i = 0; i < num_cards; i++) {
-		if (cards_preclean [i]) {
-			cards [i] = 0;
-		}
+	while ((card = sgen_find_next_card (card, end)) != end) {
+		cards [card - cards_preclean] = 0;
+		++card;
 	}
 	/*
 	 * When precleaning we need to make sure the card cleaning
@@ -529,6 +566,8 @@ sgen_card_table_dump_obj_card (GCObject *object, size_t size, void *dummy)
  * Cardtable scanning
  */
 
+#ifndef SGEN_CARD_VECTOR_SIZE
+
 #define MWORD_MASK (sizeof (mword) - 1)
 
 static int
@@ -552,9 +591,19 @@ find_card_offset (mword card)
 #endif
 }
 
+#endif
+
 guint8*
 sgen_find_next_card (guint8 *card_data, guint8 *end)
 {
+#ifdef SGEN_CARD_VECTOR_SIZE
+	while (end - card_data >= SGEN_CARD_VECTOR_SIZE) {
+		int offset = card_vector_find_dirty (card_data);
+		if (offset < SGEN_CARD_VECTOR_SIZE)
+			return card_data + offset;
+		card_data += SGEN_CARD_VECTOR_SIZE;
+	}
+#else
 	mword *cards, *cards_end;
 	mword card;
 
@@ -577,6 +626,7 @@ sgen_find_next_card (guint8 *card_data, guint8 *end)
 	}
 
 	card_data = (guint8*)cards_end;
+#endif
 	while (card_data < end) {
 		if (*card_data)
 			return card_data;
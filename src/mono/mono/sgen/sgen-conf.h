@@ -257,6 +257,19 @@ typedef target_mword SgenDescriptor;
 
 #define SGEN_PAUSE_MODE_MAX_PAUSE_MARGIN 0.5f
 
+/*
+ * The dynamic nursery grows when more than this fraction of it survives minor collections,
+ * on average. Objects don't have time to die in a nursery that small and are promoted.
+ */
+#define SGEN_NURSERY_HIGH_SURVIVAL_RATE 0.1
+/*
+ * The dynamic nursery shrinks when less than this fraction of it survives. A smaller
+ * nursery would collect as much garbage while having better cache locality.
+ */
+#define SGEN_NURSERY_LOW_SURVIVAL_RATE 0.01
+/* The weight of the last minor collection in the average survival rate of the nursery */
+#define SGEN_NURSERY_SURVIVAL_RATE_WEIGHT 0.5
+
 /*
  * In practice, for nurseries smaller than this, the parallel minor tends to be
  * ineffective, even leading to regressions. Avoid using it for smaller nurseries.
@@ -282,6 +282,8 @@ static guint64 time_minor_pinning = 0;
 static guint64 time_minor_scan_remsets = 0;
 static guint64 time_minor_scan_major_blocks = 0;
 static guint64 time_minor_scan_los = 0;
+static guint64 time_minor_scan_wbroots = 0;
+static guint64 time_minor_clear_remsets = 0;
 static guint64 time_minor_scan_pinned = 0;
 static guint64 time_minor_scan_roots = 0;
 static guint64 time_minor_finish_gray_stack = 0;
@@ -1310,6 +1312,8 @@ init_stats (void)
 	mono_counters_register ("Minor scan remembered set", MONO_COUNTER_GC | MONO_COUNTER_ULONG | MONO_COUNTER_TIME, &time_minor_scan_remsets);
 	mono_counters_register ("Minor scan major blocks", MONO_COUNTER_GC | MONO_COUNTER_ULONG | MONO_COUNTER_TIME, &time_minor_scan_major_blocks);
 	mono_counters_register ("Minor scan los", MONO_COUNTER_GC | MONO_COUNTER_ULONG | MONO_COUNTER_TIME, &time_minor_scan_los);
+	mono_counters_register ("Minor scan wbroots", MONO_COUNTER_GC | MONO_COUNTER_ULONG | MONO_COUNTER_TIME, &time_minor_scan_wbroots);
+	mono_counters_register ("Minor clear remembered set", MONO_COUNTER_GC | MONO_COUNTER_ULONG | MONO_COUNTER_TIME, &time_minor_clear_remsets);
 	mono_counters_register ("Minor scan pinned", MONO_COUNTER_GC | MONO_COUNTER_ULONG | MONO_COUNTER_TIME, &time_minor_scan_pinned);
 	mono_counters_register ("Minor scan roots", MONO_COUNTER_GC | MONO_COUNTER_ULONG | MONO_COUNTER_TIME, &time_minor_scan_roots);
 	mono_counters_register ("Minor fragment creation", MONO_COUNTER_GC | MONO_COUNTER_ULONG | MONO_COUNTER_TIME, &time_minor_fragment_creation);
@@ -1479,10 +1483,16 @@ job_scan_finalizer_entries (void *worker_data_untyped, SgenThreadPoolJob *job)
 static void
 job_scan_wbroots (void *worker_data_untyped, SgenThreadPoolJob *job)
 {
+	SGEN_TV_DECLARE (atv);
+	SGEN_TV_DECLARE (btv);
 	ScanJob *job_data = (ScanJob*)job;
 	ScanCopyContext ctx = scan_copy_context_for_scan_job (worker_data_untyped, job_data);
 
+	SGEN_TV_GETTIME (atv);
 	sgen_wbroots_scan_card_table (ctx);
+	SGEN_TV_GETTIME (btv);
+
+	SGEN_ATOMIC_ADD_I64 (time_minor_scan_wbroots, SGEN_TV_ELAPSED (atv, btv));
 }
 
 static void
@@ -1797,6 +1807,7 @@ collect_nursery (const char *reason, gboolean is_overflow)
 	SGEN_TV_DECLARE (last_minor_collection_end_tv);
 	guint64 major_scan_start = time_minor_scan_major_blocks;
 	guint64 los_scan_start = time_minor_scan_los;
+	guint64 wbroots_scan_start = time_minor_scan_wbroots;
 	guint64 finish_gray_start = time_minor_finish_gray_stack;
 
 	if (disable_minor_collections)
@@ -1886,7 +1897,9 @@ collect_nursery (const char *reason, gboolean is_overflow)
 	remset.start_scan_remsets (remset_copy_clear_par);
 	TV_GETTIME (btv);
 
-	SGEN_LOG (2, "Minor scan copy/clear remsets: %lld usecs", (long long)(TV_ELAPSED (atv, btv) / 10));
+	guint64 clear_remsets_time = TV_ELAPSED (atv, btv);
+	time_minor_clear_remsets += clear_remsets_time;
+	SGEN_LOG (2, "Minor scan copy/clear remsets: %lld usecs", (long long)(clear_remsets_time / 10));
 
 	TV_GETTIME (atv);
 	enqueue_scan_remembered_set_jobs (&gc_thread_gray_queue, is_parallel ? NULL : object_ops_nopar, is_parallel);
@@ -1948,17 +1961,12 @@ collect_nursery (const char *reason, gboolean is_overflow)
 		sgen_check_remset_consistency ();
 
 
-	if (sgen_max_pause_time) {
+	if (sgen_nursery_min_size != sgen_nursery_max_size) {
 		int duration;
 
 		TV_GETTIME (btv);
 		duration = (int)(TV_ELAPSED (last_minor_collection_start_tv, btv) / 10000);
-		if (duration > (sgen_max_pause_time * sgen_max_pause_margin))
-			sgen_resize_nursery (TRUE);
-		else
-			sgen_resize_nursery (FALSE);
-	} else {
-			sgen_resize_nursery (FALSE);
+		sgen_memgov_resize_nursery (duration, (int)(sgen_max_pause_time * sgen_max_pause_margin));
 	}
 
 	/*
@@ -2025,6 +2033,13 @@ collect_nursery (const char *reason, gboolean is_overflow)
 			time_minor_scan_los - los_scan_start,
 			time_minor_finish_gray_stack - finish_gray_start);
 
+	/* Scan times are accumulated over all workers for parallel collections */
+	sgen_binary_protocol_card_scan_stats (
+		clear_remsets_time,
+		time_minor_scan_major_blocks - major_scan_start,
+		time_minor_scan_los - los_scan_start,
+		time_minor_scan_wbroots - wbroots_scan_start);
+
 	sgen_binary_protocol_collection_end (mono_atomic_load_i32 (&mono_gc_stats.minor_gc_count) - 1, GENERATION_NURSERY, 0, 0);
 
 	if (check_nursery_objects_untag)
@@ -3421,8 +3436,9 @@ init_sgen_mode (SgenMode mode)
 		/*
 		 * Use a dynamic parallel nursery with a major concurrent collector.
 		 * This uses the default values for max pause time and nursery size.
+		 * The nursery is collected in parallel only once it grows large enough.
 		 */
-		minor = SGEN_MINOR_SIMPLE;
+		minor = SGEN_MINOR_SIMPLE_PARALLEL;
 		major = SGEN_MAJOR_CONCURRENT;
 		dynamic_nursery = TRUE;
 		break;
@@ -3464,6 +3480,7 @@ sgen_gc_init (void)
 	SgenMajor sgen_major = SGEN_MAJOR_DEFAULT;
 	SgenMinor sgen_minor = SGEN_MINOR_DEFAULT;
 	SgenMode sgen_mode = SGEN_MODE_NONE;
+	gboolean dynamic_nursery_requested = FALSE;
 	char *params_opts = NULL;
 	char *debug_opts = NULL;
 	size_t max_heap = 0;
@@ -3521,6 +3538,10 @@ sgen_gc_init (void)
 			} else if (g_str_has_prefix (opt, "mode=")) {
 				opt = strchr (opt, '=') + 1;
 				sgen_mode = parse_sgen_mode (opt);
+			} else if (!strcmp (opt, "dynamic-nursery")) {
+				dynamic_nursery_requested = TRUE;
+			} else if (!strcmp (opt, "no-dynamic-nursery") || g_str_has_prefix (opt, "nursery-size=")) {
+				dynamic_nursery_requested = FALSE;
 			}
 		}
 	} else {
@@ -3547,6 +3568,14 @@ sgen_gc_init (void)
 			sgen_env_var_error (MONO_GC_PARAMS_NAME, "Ignoring major/minor configuration", "Major/minor configurations cannot be used with sgen modes");
 		init_sgen_mode (sgen_mode);
 	} else {
+#ifndef DISABLE_SGEN_MAJOR_MARKSWEEP_CONC
+		/*
+		 * A dynamic nursery can grow past SGEN_PARALLEL_MINOR_MIN_NURSERY_SIZE, at which
+		 * point the parallel minor collector starts collecting it in parallel.
+		 */
+		if (sgen_minor == SGEN_MINOR_DEFAULT && dynamic_nursery_requested)
+			sgen_minor = SGEN_MINOR_SIMPLE_PARALLEL;
+#endif
 		init_sgen_minor (sgen_minor);
 		init_sgen_major (sgen_major);
 	}
@@ -194,6 +194,7 @@ sgen_aligned_addr_hash (gconstpointer ptr)
 #define SGEN_PTR_IN_NURSERY(p,bits,start,end)	(((mword)(p) & ~(((mword)1 << (bits)) - 1)) == (mword)(start))
 
 extern size_t sgen_nursery_size;
+extern size_t sgen_nursery_min_size;
 extern size_t sgen_nursery_max_size;
 extern int sgen_nursery_bits;
 
@@ -771,6 +772,7 @@ typedef struct _SgenGCInfo {
 	guint64 total_major_size_in_use_bytes;
 	guint64 total_los_size_bytes;
 	guint64 total_los_size_in_use_bytes;
+	guint64 total_los_fragmented_bytes;
 } SgenGCInfo;
 
 extern SgenGCInfo sgen_gc_info;
@@ -989,7 +991,7 @@ void sgen_los_mark_mod_union_card (GCObject *mono_obj, void **ptr);
 void sgen_clear_nursery_fragments (void);
 void sgen_nursery_allocator_prepare_for_pinning (void);
 void sgen_nursery_allocator_set_nursery_bounds (char *nursery_start, size_t min_size, size_t max_size);
-void sgen_resize_nursery (gboolean need_shrink);
+void sgen_resize_nursery (gboolean grow);
 mword sgen_build_nursery_fragments (GCMemSection *nursery_section);
 void sgen_init_nursery_allocator (void);
 void sgen_nursery_allocator_init_heavy_stats (void);
@@ -50,7 +50,13 @@
 #define LOS_SECTION_FOR_OBJ(obj)	((LOSSection*)((mword)(obj) & ~(mword)(LOS_SECTION_SIZE - 1)))
 #define LOS_CHUNK_INDEX(obj,section)	(((char*)(obj) - (char*)(section)) >> LOS_CHUNK_BITS)
 
+/*
+ * Free runs of less than LOS_NUM_FAST_SIZES chunks are kept on a list per size. Larger
+ * runs are binned in power of two size classes, starting at LOS_NUM_FAST_SIZES chunks.
+ */
 #define LOS_NUM_FAST_SIZES		32
+#define LOS_NUM_SIZE_CLASSES		3
+#define LOS_NUM_FREE_LISTS		(LOS_NUM_FAST_SIZES + LOS_NUM_SIZE_CLASSES)
 
 typedef struct _LOSFreeChunks LOSFreeChunks;
 struct _LOSFreeChunks {
@@ -126,7 +132,9 @@ mword sgen_los_memory_usage = 0;
 mword sgen_los_memory_usage_total = 0;
 
 static LOSSection *los_sections = NULL;
-static LOSFreeChunks *los_fast_free_lists [LOS_NUM_FAST_SIZES]; /* 0 is for larger sizes */
+static LOSFreeChunks *los_free_lists [LOS_NUM_FREE_LISTS]; /* 0 is unused */
+/* Bit i is set if los_free_lists [i] is not empty */
+static guint64 los_free_lists_map = 0;
 static mword los_num_objects = 0;
 static int los_num_sections = 0;
 
@@ -147,6 +155,39 @@ sgen_los_object_size (LOSObject *obj)
 	return obj->size & ~1L;
 }
 
+static int
+free_list_index (size_t num_chunks)
+{
+	int index = LOS_NUM_FAST_SIZES;
+
+	if (num_chunks < LOS_NUM_FAST_SIZES)
+		return (int)num_chunks;
+
+	while (num_chunks >= 2 * LOS_NUM_FAST_SIZES) {
+		num_chunks >>= 1;
+		++index;
+	}
+	g_assert (index < LOS_NUM_FREE_LISTS);
+	return index;
+}
+
+/* Returns the first non empty free list at or after index, or -1 if there is none. */
+static int
+find_free_list (int index)
+{
+	guint64 map = los_free_lists_map & ~(((guint64)1 << index) - 1);
+
+	if (!map)
+		return -1;
+#ifdef __GNUC__
+	return __builtin_ctzll (map);
+#else
+	while (!(map & ((guint64)1 << index)))
+		++index;
+	return index;
+#endif
+}
+
 #ifdef LOS_CONSISTENCY_CHECK
 static void
 los_consistency_check (void)
@@ -176,18 +217,18 @@ los_consistency_check (void)
 			g_assert (!section->free_chunk_map [i]);
 	} END_FOREACH_LOS_OBJECT_NO_LOCK;
 
-	for (i = 0; i < LOS_NUM_FAST_SIZES; ++i) {
+	for (i = 0; i < LOS_NUM_FREE_LISTS; ++i) {
 		LOSFreeChunks *size_chunks;
-		for (size_chunks = los_fast_free_lists [i]; size_chunks; size_chunks = size_chunks->next_size) {
+
+		g_assert (!los_free_lists [i] == !(los_free_lists_map & ((guint64)1 << i)));
+
+		for (size_chunks = los_free_lists [i]; size_chunks; size_chunks = size_chunks->next_size) {
 			LOSSection *section = LOS_SECTION_FOR_OBJ (size_chunks);
 			int j, num_chunks, start_index;
 
-			if (i == 0)
-				g_assert (size_chunks->size >= LOS_NUM_FAST_SIZES * LOS_CHUNK_SIZE);
-			else
-				g_assert (size_chunks->size == i * LOS_CHUNK_SIZE);
-
 			num_chunks = size_chunks->size >> LOS_CHUNK_BITS;
+			g_assert (free_list_index (num_chunks) == i);
+
 			start_index = LOS_CHUNK_INDEX (size_chunks, section);
 			for (j = start_index; j < start_index + num_chunks; ++j)
 				g_assert (section->free_chunk_map [j]);
@@ -201,19 +242,22 @@ los_consistency_check (void)
 static void
 add_free_chunk (LOSFreeChunks *free_chunks, size_t size)
 {
-	size_t num_chunks = size >> LOS_CHUNK_BITS;
+	int index = free_list_index (size >> LOS_CHUNK_BITS);
 
 	free_chunks->size = size;
-
-	if (num_chunks >= LOS_NUM_FAST_SIZES)
-		num_chunks = 0;
-	free_chunks->next_size = los_fast_free_lists [num_chunks];
-	los_fast_free_lists [num_chunks] = free_chunks;
+	free_chunks->next_size = los_free_lists [index];
+	los_free_lists [index] = free_chunks;
+	los_free_lists_map |= (guint64)1 << index;
 }
 
+/*
+ * Takes the first free run of at least size bytes from the free list. On the lists
+ * past the one for size, that is always the first run of the list.
+ */
 static LOSFreeChunks*
-get_from_size_list (LOSFreeChunks **list, size_t size)
+get_from_size_list (int index, size_t size)
 {
+	LOSFreeChunks **list = &los_free_lists [index];
 	LOSFreeChunks *free_chunks = NULL;
 	LOSSection *section;
 	size_t i, num_chunks, start_index;
@@ -232,6 +276,8 @@ get_from_size_list (LOSFreeChunks **list, size_t size)
 		return NULL;
 
 	*list = free_chunks->next_size;
+	if (!los_free_lists [index])
+		los_free_lists_map &= ~((guint64)1 << index);
 
 	if (free_chunks->size > size)
 		add_free_chunk ((LOSFreeChunks*)((char*)free_chunks + size), free_chunks->size - size);
@@ -278,6 +324,7 @@ get_los_section_memory (size_t size)
 	LOSFreeChunks *free_chunks = NULL;
 	size_t num_chunks;
 	size_t obj_size = size;
+	int index, list;
 
 	size = SGEN_ALIGN_UP_TO (size, LOS_CHUNK_SIZE);
 
@@ -286,19 +333,19 @@ get_los_section_memory (size_t size)
 	g_assert (size > 0 && size - sizeof (LOSObject) <= LOS_SECTION_OBJECT_LIMIT);
 	g_assert (num_chunks > 0);
 
+	index = free_list_index (num_chunks);
+
  retry:
-	if (num_chunks >= LOS_NUM_FAST_SIZES) {
-		free_chunks = get_from_size_list (&los_fast_free_lists [0], size);
-	} else {
-		size_t i;
-		for (i = num_chunks; i < LOS_NUM_FAST_SIZES; ++i) {
-			free_chunks = get_from_size_list (&los_fast_free_lists [i], size);
-			if (free_chunks)
-				break;
-		}
-		if (!free_chunks)
-			free_chunks = get_from_size_list (&los_fast_free_lists [0], size);
-	}
+	/*
+	 * Every run on the exact size list and on the lists after ours fits, so those
+	 * are allocated from in constant time. Only if there are none we search our
+	 * size class for a run that is large enough.
+	 */
+	list = find_free_list (num_chunks < LOS_NUM_FAST_SIZES ? index : index + 1);
+	if (list >= 0)
+		free_chunks = get_from_size_list (list, size);
+	else if (num_chunks >= LOS_NUM_FAST_SIZES)
+		free_chunks = get_from_size_list (index, size);
 
 	if (free_chunks) {
 		return randomize_los_object_start (free_chunks, obj_size, size, LOS_CHUNK_SIZE);
@@ -319,10 +366,7 @@ get_los_section_memory (size_t size)
 	if (!section)
 		return NULL;
 
-	free_chunks = (LOSFreeChunks*)((char*)section + LOS_CHUNK_SIZE);
-	free_chunks->size = LOS_SECTION_SIZE - LOS_CHUNK_SIZE;
-	free_chunks->next_size = los_fast_free_lists [0];
-	los_fast_free_lists [0] = free_chunks;
+	add_free_chunk ((LOSFreeChunks*)((char*)section + LOS_CHUNK_SIZE), LOS_SECTION_SIZE - LOS_CHUNK_SIZE);
 
 	section->num_free_chunks = LOS_SECTION_NUM_CHUNKS;
 
@@ -525,9 +569,13 @@ sgen_los_sweep (void)
 		compact_los_objects = FALSE;
 	}
 
-	/* Try to free memory */
-	for (i = 0; i < LOS_NUM_FAST_SIZES; ++i)
-		los_fast_free_lists [i] = NULL;
+	/*
+	 * Try to free memory. The free lists are rebuilt from the chunk maps, which
+	 * coalesces adjacent free runs.
+	 */
+	for (i = 0; i < LOS_NUM_FREE_LISTS; ++i)
+		los_free_lists [i] = NULL;
+	los_free_lists_map = 0;
 
 	prev = NULL;
 	section = los_sections;
@@ -568,10 +616,10 @@ sgen_los_sweep (void)
 
 	/*
 	g_print ("LOS sections: %d  objects: %d  usage: %d\n", num_sections, los_num_objects, sgen_los_memory_usage);
-	for (i = 0; i < LOS_NUM_FAST_SIZES; ++i) {
+	for (i = 0; i < LOS_NUM_FREE_LISTS; ++i) {
 		int num_chunks = 0;
 		LOSFreeChunks *free_chunks;
-		for (free_chunks = los_fast_free_lists [i]; free_chunks; free_chunks = free_chunks->next_size)
+		for (free_chunks = los_free_lists [i]; free_chunks; free_chunks = free_chunks->next_size)
 			++num_chunks;
 		g_print ("  %d: %d\n", i, num_chunks);
 	}
@@ -2501,42 +2501,6 @@ extern guint64 scanned_objects;
 extern guint64 remarked_cards;
 #endif
 
-#define CARD_WORDS_PER_BLOCK (CARDS_PER_BLOCK / SIZEOF_VOID_P)
-/*
- * MS blocks are 16K aligned.
- * Cardtables are 4K aligned, at least.
- * This means that the cardtable of a given block is 32 bytes aligned.
- */
-static guint8*
-initial_skip_card (guint8 *card_data)
-{
-	mword *cards = (mword*)card_data;
-	mword card = 0;
-	int i;
-	for (i = 0; i < CARD_WORDS_PER_BLOCK; ++i) {
-		card = cards [i];
-		if (card)
-			break;
-	}
-
-	if (i == CARD_WORDS_PER_BLOCK)
-		return card_data + CARDS_PER_BLOCK;
-
-#if defined(__i386__) && defined(__GNUC__)
-	return card_data + i * 4 +  (__builtin_ffs (card) - 1) / 8;
-#elif defined(__x86_64__) && defined(__GNUC__)
-	return card_data + i * 8 +  (__builtin_ffsll (card) - 1) / 8;
-#elif defined(__s390x__) && defined(__GNUC__)
-	return card_data + i * 8 +  (__builtin_ffsll (GUINT64_TO_LE(card)) - 1) / 8;
-#else
-	for (i = i * SIZEOF_VOID_P; i < CARDS_PER_BLOCK; ++i) {
-		if (card_data [i])
-			return &card_data [i];
-	}
-	return card_data;
-#endif
-}
-
 #define MS_BLOCK_OBJ_INDEX_FAST(o,b,os)	(((char*)(o) - ((b) + MS_BLOCK_SKIP)) / (os))
 #define MS_BLOCK_OBJ_FAST(b,os,i)			((b) + MS_BLOCK_SKIP + (os) * (i))
 #define MS_OBJ_ALLOCED_FAST(o,b)		(*(void**)(o) && (*(char**)(o) < (b) || *(char**)(o) >= (b) + ms_block_size))
@@ -2604,24 +2568,32 @@ scan_card_table_for_block (MSBlockInfo *block, CardTableScanType scan_type, Scan
 
 	card_data += MS_BLOCK_SKIP >> CARD_BITS;
 
-	card_data = initial_skip_card (card_data);
 	while (card_data < card_data_end) {
 		size_t card_index, first_object_index;
 		char *start;
 		char *end;
 		char *first_obj, *obj;
+		guint8 *dirty_card = sgen_find_next_card (card_data, card_data_end);
 
-		HEAVY_STAT (++scanned_cards);
+		HEAVY_STAT (scanned_cards += MIN (dirty_card + 1, card_data_end) - card_data);
 
-		if (!*card_data) {
-			++card_data;
-			continue;
-		}
+		card_data = dirty_card;
+		if (card_data == card_data_end)
+			break;
 
 		card_index = card_data - card_base;
 		start = (char*)(block_start + card_index * CARD_SIZE_IN_BYTES);
 		end = start + CARD_SIZE_IN_BYTES;
 
+#ifdef PREFETCH_CARDS
+		/* Pull in the objects under the next dirty card while we scan this one */
+		if (small_objects) {
+			guint8 *next_dirty_card = sgen_find_next_card (card_data + 1, card_data_end);
+			if (next_dirty_card != card_data_end)
+				PREFETCH_READ (block_start + (next_dirty_card - card_base) * CARD_SIZE_IN_BYTES);
+		}
+#endif
+
 		if (!block_is_swept_or_marking (block))
 			sweep_block (block);
 
@@ -2719,15 +2691,8 @@ MONO_RESTORE_WARNING
 		skip_scan = FALSE;
 
 		if (scan_type == CARDTABLE_SCAN_GLOBAL) {
-			gpointer *card_start = (gpointer*) sgen_card_table_get_card_scan_address ((mword)MS_BLOCK_FOR_BLOCK_INFO (block));
-			gboolean has_dirty_cards = FALSE;
-			for (guint i = 0; i < CARDS_PER_BLOCK / sizeof(gpointer); i++) {
-				if (card_start [i]) {
-					has_dirty_cards = TRUE;
-					break;
-				}
-			}
-			if (!has_dirty_cards) {
+			guint8 *card_start = sgen_card_table_get_card_scan_address ((mword)MS_BLOCK_FOR_BLOCK_INFO (block));
+			if (sgen_find_next_card (card_start, card_start + CARDS_PER_BLOCK) == card_start + CARDS_PER_BLOCK) {
 				skip_scan = TRUE;
 			} else {
 				/*
@@ -2787,15 +2752,8 @@ update_cardtable_mod_union (void)
 	MSBlockInfo *block;
 
 	FOREACH_BLOCK_NO_LOCK (block) {
-		gpointer *card_start = (gpointer*) sgen_card_table_get_card_address ((mword)MS_BLOCK_FOR_BLOCK_INFO (block));
-		gboolean has_dirty_cards = FALSE;
-		for (guint i = 0; i < CARDS_PER_BLOCK / sizeof(gpointer); i++) {
-			if (card_start [i]) {
-				has_dirty_cards = TRUE;
-				break;
-			}
-		}
-		if (has_dirty_cards) {
+		guint8 *card_start = sgen_card_table_get_card_address ((mword)MS_BLOCK_FOR_BLOCK_INFO (block));
+		if (sgen_find_next_card (card_start, card_start + CARDS_PER_BLOCK) != card_start + CARDS_PER_BLOCK) {
 			size_t num_cards;
 			guint8 *mod_union = get_cardtable_mod_union_for_block (block, TRUE);
 			sgen_card_table_update_mod_union (mod_union, MS_BLOCK_FOR_BLOCK_INFO (block), ms_block_size, &num_cards);
@@ -49,6 +49,10 @@ static double save_target_ratio = SGEN_DEFAULT_SAVE_TARGET_RATIO;
 
 /**/
 static mword allocated_heap;
+#ifdef HOST_WASI
+/* The largest ALLOCATED_HEAP seen so far, linear memory has grown to at least this much */
+static mword allocated_heap_high_water;
+#endif
 static mword total_alloc = 0;
 static mword total_alloc_max = 0;
 
@@ -68,6 +72,9 @@ static mword major_start_heap_size;
 
 static gboolean need_calculate_minor_collection_allowance;
 
+/* The average fraction of the nursery that survives minor collections, -1 before the first one. */
+static double nursery_survival_rate = -1;
+
 /* The size of the LOS after the last major collection, after sweeping. */
 static mword last_collection_los_memory_usage = 0;
 static mword last_used_slots_size = 0;
@@ -108,6 +115,21 @@ sgen_memgov_calculate_minor_collection_allowance (void)
 		decrease = allowance;
 	allowance -= decrease;
 
+#ifdef HOST_WASI
+	/*
+	 * Linear memory never shrinks: memory freed by the GC only goes back to the malloc
+	 * heap which wasi-libc backs mmap with, so growing up to the high water mark is free
+	 * while growing past it costs a memory.grow which the instance never gets back.
+	 * Grant only half of the allowance past the high water mark, so major collections
+	 * run, and evacuate sparse blocks, before the instance grows.
+	 */
+	if (new_heap_size + allowance > allocated_heap_high_water) {
+		size_t below_high_water = allocated_heap_high_water > new_heap_size ? allocated_heap_high_water - new_heap_size : 0;
+		allowance = below_high_water + (allowance - below_high_water) / 2;
+		allowance = MAX (allowance, GDOUBLE_TO_SIZE (MIN_MINOR_COLLECTION_ALLOWANCE));
+	}
+#endif
+
 	if (new_heap_size + allowance > soft_heap_limit) {
 		if (new_heap_size > soft_heap_limit)
 			allowance = GDOUBLE_TO_SIZE (MIN_MINOR_COLLECTION_ALLOWANCE);
@@ -150,6 +172,7 @@ update_gc_info (mword used_slots_size)
 	sgen_gc_info.total_major_size_in_use_bytes = major_size_in_use;
 	sgen_gc_info.total_los_size_bytes = sgen_los_memory_usage_total;
 	sgen_gc_info.total_los_size_in_use_bytes = sgen_los_memory_usage;
+	sgen_gc_info.total_los_fragmented_bytes = sgen_los_memory_usage_total - sgen_los_memory_usage;
 }
 
 static void
@@ -238,6 +261,41 @@ sgen_memgov_minor_collection_end (const char *reason, gboolean is_overflow)
 	}
 }
 
+/*
+ * Resizes the dynamic nursery after a minor collection, which took pause_time ms. We aim
+ * for a survival rate between SGEN_NURSERY_LOW_SURVIVAL_RATE and SGEN_NURSERY_HIGH_SURVIVAL_RATE,
+ * while keeping pauses under max_pause_time ms and the nursery smaller than a fraction of the
+ * major heap. Once the nursery grows past SGEN_PARALLEL_MINOR_MIN_NURSERY_SIZE, a parallel
+ * minor collector starts collecting it in parallel.
+ */
+void
+sgen_memgov_resize_nursery (int pause_time, int max_pause_time)
+{
+	mword promoted_size = sgen_total_promoted_size - total_promoted_size_start;
+	double survival_rate = MIN ((double)promoted_size / sgen_nursery_size, 1.0);
+	size_t max_size = MIN (sgen_nursery_max_size, (size_t)(get_heap_size () / SGEN_DEFAULT_ALLOWANCE_NURSERY_SIZE_RATIO));
+	gboolean can_grow, can_shrink;
+
+	if (nursery_survival_rate < 0)
+		nursery_survival_rate = survival_rate;
+	else
+		nursery_survival_rate = nursery_survival_rate * (1 - SGEN_NURSERY_SURVIVAL_RATE_WEIGHT) + survival_rate * SGEN_NURSERY_SURVIVAL_RATE_WEIGHT;
+
+	/* The pause time of a minor collection is mostly proportional to the amount of surviving objects */
+	can_grow = sgen_nursery_size * 2 <= max_size && (!max_pause_time || pause_time * 2 <= max_pause_time);
+	can_shrink = sgen_nursery_size / 2 >= sgen_nursery_min_size;
+
+	if (can_shrink && ((max_pause_time && pause_time > max_pause_time) || sgen_nursery_size > max_size || nursery_survival_rate < SGEN_NURSERY_LOW_SURVIVAL_RATE))
+		sgen_resize_nursery (FALSE);
+	else if (can_grow && nursery_survival_rate > SGEN_NURSERY_HIGH_SURVIVAL_RATE)
+		sgen_resize_nursery (TRUE);
+	else
+		return;
+
+	if (debug_print_allowance)
+		SGEN_LOG (0, "Nursery resized to %" G_GSIZE_FORMAT "u bytes, survival rate %.3f, pause %d ms", sgen_nursery_size, nursery_survival_rate, pause_time);
+}
+
 void
 sgen_memgov_major_pre_sweep (void)
 {
@@ -504,6 +562,11 @@ sgen_memgov_try_alloc_space (mword size, int space)
 	}
 
 	SGEN_ATOMIC_ADD_P (allocated_heap, size);
+#ifdef HOST_WASI
+	/* Racy, but this is only a heuristic */
+	if (allocated_heap > allocated_heap_high_water)
+		allocated_heap_high_water = allocated_heap;
+#endif
 	sgen_client_total_allocated_heap_changed (allocated_heap);
 	return TRUE;
 }
@@ -16,6 +16,7 @@ gboolean sgen_memgov_try_alloc_space (mword size, int space);
 /* GC trigger heuristics */
 void sgen_memgov_minor_collection_start (void);
 void sgen_memgov_minor_collection_end (const char *reason, gboolean is_overflow);
+void sgen_memgov_resize_nursery (int pause_time, int max_pause_time);
 
 void sgen_memgov_major_pre_sweep (void);
 void sgen_memgov_major_post_sweep (mword used_slots_size);
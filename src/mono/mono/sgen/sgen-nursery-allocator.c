@@ -915,31 +915,26 @@ sgen_nursery_allocator_set_nursery_bounds (char *start, size_t min_size, size_t
 	sgen_minor_collector.init_nursery (&mutator_allocator, sgen_nursery_start, sgen_nursery_end);
 }
 
+/*
+ * Doubles or halves the size of the nursery. The memory reserved for the nursery
+ * doesn't change, only the part of it that we allocate from. When to resize is
+ * decided by the memory governor.
+ *
+ * FIXME
+ * Commit memory when expanding and release it when shrinking (which
+ * would only be possible if there aren't any pinned objects in the
+ * section).
+ */
 void
-sgen_resize_nursery (gboolean need_shrink)
+sgen_resize_nursery (gboolean grow)
 {
-	size_t major_size;
-
-	if (sgen_nursery_min_size == sgen_nursery_max_size)
-		return;
-
-	major_size = sgen_major_collector.get_num_major_sections () * sgen_major_collector.section_size + sgen_los_memory_usage;
-	/*
-	 * We attempt to use a larger nursery size, as long as it doesn't
-	 * exceed a certain percentage of the major heap.
-	 *
-	 * FIXME
-	 * Commit memory when expanding and release it when shrinking (which
-	 * would only be possible if there aren't any pinned objects in the
-	 * section).
-	 */
-	if ((sgen_nursery_size * 2) < (major_size / SGEN_DEFAULT_ALLOWANCE_NURSERY_SIZE_RATIO) &&
-			(sgen_nursery_size * 2) <= sgen_nursery_max_size && !need_shrink) {
+	if (grow) {
+		SGEN_ASSERT (0, sgen_nursery_size * 2 <= sgen_nursery_max_size, "Can't grow the nursery past its maximum size");
 		if ((sgen_nursery_section->end_data - sgen_nursery_section->data) == sgen_nursery_size)
 			sgen_nursery_section->end_data += sgen_nursery_size;
 		sgen_nursery_size *= 2;
-	} else if ((sgen_nursery_size > (major_size / SGEN_DEFAULT_ALLOWANCE_NURSERY_SIZE_RATIO) || need_shrink) &&
-			(sgen_nursery_size / 2) >= sgen_nursery_min_size) {
+	} else {
+		SGEN_ASSERT (0, sgen_nursery_size / 2 >= sgen_nursery_min_size, "Can't shrink the nursery below its minimum size");
 		sgen_nursery_size /= 2;
 	}
 }
@@ -98,6 +98,77 @@ sgen_pointer_queue_remove_nulls (SgenPointerQueue *queue)
 	queue->next_slot = start - queue->data;
 }
 
+/*
+ * Below this many pointers the heap sort is faster than allocating the
+ * scratch buffer and doing the counting passes of the radix sort.
+ */
+#define RADIX_SORT_MIN_POINTERS	512
+#define RADIX_BITS		8
+#define RADIX_BUCKETS		(1 << RADIX_BITS)
+
+/*
+ * LSD radix sort of the pointers, keyed on their offset from the lowest one.
+ * Pinning candidates all lie in the nursery or the heap, so they only differ
+ * in their low bits and most digits need no pass. Returns FALSE if the
+ * scratch buffer can't be allocated.
+ */
+static gboolean
+radix_sort_addresses (void **array, size_t size, int mem_type)
+{
+	size_t counts [RADIX_BUCKETS];
+	mword min = (mword)-1, max = 0, diff = 0;
+	void **scratch, **from, **to;
+	int shift;
+	size_t i;
+
+	for (i = 0; i < size; ++i) {
+		mword addr = (mword)array [i];
+		min = MIN (min, addr);
+		max = MAX (max, addr);
+	}
+	if (min == max)
+		return TRUE;
+
+	/* Skip the low bits that are the same in all pointers, like those below the alignment */
+	for (i = 0; i < size; ++i)
+		diff |= (mword)array [i] - min;
+	for (shift = 0; !((diff >> shift) & 1); ++shift)
+		;
+
+	scratch = (void **)sgen_alloc_internal_dynamic (sizeof (void*) * size, mem_type, FALSE);
+	if (!scratch)
+		return FALSE;
+
+	from = array;
+	to = scratch;
+	for (; shift < SIZEOF_VOID_P * 8 && ((max - min) >> shift); shift += RADIX_BITS) {
+		size_t sum = 0;
+
+		memset (counts, 0, sizeof (counts));
+		for (i = 0; i < size; ++i)
+			++counts [(((mword)from [i] - min) >> shift) & (RADIX_BUCKETS - 1)];
+
+		for (i = 0; i < RADIX_BUCKETS; ++i) {
+			size_t count = counts [i];
+			counts [i] = sum;
+			sum += count;
+		}
+
+		for (i = 0; i < size; ++i)
+			to [counts [(((mword)from [i] - min) >> shift) & (RADIX_BUCKETS - 1)]++] = from [i];
+
+		void **tmp = from;
+		from = to;
+		to = tmp;
+	}
+
+	if (from != array)
+		memcpy (array, from, sizeof (void*) * size);
+
+	sgen_free_internal_dynamic (scratch, sizeof (void*) * size, mem_type);
+	return TRUE;
+}
+
 /*
  * Sorts the pointers in the queue, then removes duplicates.
  */
@@ -108,8 +179,12 @@ sgen_pointer_queue_sort_uniq (SgenPointerQueue *queue)
 	/* sort and uniq pin_queue: we just sort and we let the rest discard multiple values */
 	/* it may be better to keep ranges of pinned memory instead of individually pinning objects */
 	SGEN_LOG (5, "Sorting pointer queue, size: %lu", (unsigned long)queue->next_slot);
-	if (queue->next_slot > 1)
+	if (queue->next_slot >= RADIX_SORT_MIN_POINTERS) {
+		if (!radix_sort_addresses (queue->data, queue->next_slot, queue->mem_type))
+			sgen_sort_addresses (queue->data, queue->next_slot);
+	} else if (queue->next_slot > 1) {
 		sgen_sort_addresses (queue->data, queue->next_slot);
+	}
 	start = cur = queue->data;
 	end = queue->data + queue->next_slot;
 	while (cur < end) {
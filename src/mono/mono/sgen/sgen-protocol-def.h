@@ -478,6 +478,20 @@ MATCH_INDEX (ptr == entry->list ? 0 : ptr == entry->key ? 1 : ptr == entry->valu
 IS_VTABLE_MATCH (FALSE)
 END_PROTOCOL_ENTRY_HEAVY
 
+BEGIN_PROTOCOL_ENTRY4 (binary_protocol_card_scan_stats, TYPE_LONGLONG, clear_time, TYPE_LONGLONG, major_scan, TYPE_LONGLONG, los_scan, TYPE_LONGLONG, wbroots_scan)
+DEFAULT_PRINT ()
+IS_ALWAYS_MATCH (TRUE)
+MATCH_INDEX (BINARY_PROTOCOL_MATCH)
+IS_VTABLE_MATCH (FALSE)
+END_PROTOCOL_ENTRY
+
+BEGIN_PROTOCOL_ENTRY5 (binary_protocol_worker_steal_stats, TYPE_INT, worker_index, TYPE_INT, generation, TYPE_INT, steal_attempts, TYPE_INT, steals, TYPE_LONGLONG, idle_time)
+DEFAULT_PRINT ()
+IS_ALWAYS_MATCH (TRUE)
+MATCH_INDEX (BINARY_PROTOCOL_MATCH)
+IS_VTABLE_MATCH (FALSE)
+END_PROTOCOL_ENTRY
+
 #undef BEGIN_PROTOCOL_ENTRY0
 #undef BEGIN_PROTOCOL_ENTRY1
 #undef BEGIN_PROTOCOL_ENTRY2
@@ -96,8 +96,14 @@ sgen_workers_ensure_awake (WorkerContext *context)
 
 			did_set_state = set_state (&context->workers_data [i], old_state, STATE_WORK_ENQUEUED);
 
-			if (did_set_state && old_state == STATE_NOT_WORKING)
-				context->workers_data [i].last_start = sgen_timestamp ();
+			if (did_set_state && old_state == STATE_NOT_WORKING) {
+				WorkerData *data = &context->workers_data [i];
+				data->last_start = sgen_timestamp ();
+				if (data->last_finish) {
+					data->idle_time += data->last_start - data->last_finish;
+					data->last_finish = 0;
+				}
+			}
 		} while (!did_set_state);
 
 		if (!state_is_working_or_enqueued (old_state))
@@ -164,10 +170,14 @@ worker_try_finish (WorkerData *data)
 	if (working == 2)
 		context->idle_func_object_ops = context->idle_func_object_ops_nopar;
 
+	data->last_finish = sgen_timestamp ();
+	if (working == 1)
+		context->last_finish = data->last_finish;
+
 	context->workers_finished = TRUE;
 	mono_os_mutex_unlock (&context->finished_lock);
 
-	data->total_time += (sgen_timestamp () - last_start);
+	data->total_time += (data->last_finish - last_start);
 	sgen_binary_protocol_worker_finish_stats (GPTRDIFF_TO_INT (data - &context->workers_data [0] + 1), context->generation, context->forced_stop, data->major_scan_time, data->los_scan_time, data->total_time);
 
 	sgen_gray_object_queue_trim_free_list (&data->private_gray_queue);
@@ -244,7 +254,8 @@ workers_steal_work (WorkerData *data)
 	int generation = sgen_get_current_collection_generation ();
 	GrayQueueSection *section = NULL;
 	WorkerContext *context = data->context;
-	int i, current_worker;
+	int i, current_worker, victim = -1;
+	gint32 max_sections = 1;
 
 	if ((generation == GENERATION_OLD && !major->is_parallel) ||
 			(generation == GENERATION_NURSERY && !minor->is_parallel))
@@ -254,14 +265,33 @@ workers_steal_work (WorkerData *data)
 	g_assert (sgen_gray_object_queue_is_empty (&data->private_gray_queue));
 
 	current_worker = (int) (data - context->workers_data);
+	data->steal_attempts++;
+
+	/*
+	 * Try the worker with the most sections first, since it is the least likely
+	 * to run out of work before the stolen section is processed. The section
+	 * counts are read racily, which only affects the choice of victim.
+	 */
+	for (i = 1; i < context->active_workers_num; i++) {
+		int steal_worker = (current_worker + i) % context->active_workers_num;
+		if (state_is_working_or_enqueued (context->workers_data [steal_worker].state) &&
+				context->workers_data [steal_worker].private_gray_queue.num_sections > max_sections) {
+			victim = steal_worker;
+			max_sections = context->workers_data [steal_worker].private_gray_queue.num_sections;
+		}
+	}
+
+	if (victim >= 0)
+		section = sgen_gray_object_steal_section (&context->workers_data [victim].private_gray_queue);
 
 	for (i = 1; i < context->active_workers_num && !section; i++) {
 		int steal_worker = (current_worker + i) % context->active_workers_num;
-		if (state_is_working_or_enqueued (context->workers_data [steal_worker].state))
+		if (steal_worker != victim && state_is_working_or_enqueued (context->workers_data [steal_worker].state))
 			section = sgen_gray_object_steal_section (&context->workers_data [steal_worker].private_gray_queue);
 	}
 
 	if (section) {
+		data->steals++;
 		sgen_gray_object_enqueue_section (&data->private_gray_queue, section, TRUE);
 		return TRUE;
 	}
@@ -511,7 +541,12 @@ sgen_workers_start_all_workers (int generation, SgenObjectOperations *object_ops
 		context->workers_data [i].los_scan_time = 0;
 		context->workers_data [i].total_time = 0;
 		context->workers_data [i].last_start = 0;
+		context->workers_data [i].last_finish = 0;
+		context->workers_data [i].idle_time = 0;
+		context->workers_data [i].steal_attempts = 0;
+		context->workers_data [i].steals = 0;
 	}
+	context->last_finish = 0;
 	mono_memory_write_barrier ();
 
 	/*
@@ -541,6 +576,14 @@ sgen_workers_join (int generation)
 	for (i = 0; i < context->active_workers_num; ++i)
 		SGEN_ASSERT (0, sgen_gray_object_queue_is_empty (&context->workers_data [i].private_gray_queue), "Why is there still work left to do?");
 
+	for (i = 0; i < context->active_workers_num; ++i) {
+		WorkerData *data = &context->workers_data [i];
+		/* Workers that finished before the last one were idle until the end of the phase */
+		if (data->last_finish && context->last_finish > data->last_finish)
+			data->idle_time += context->last_finish - data->last_finish;
+		sgen_binary_protocol_worker_steal_stats (i + 1, generation, data->steal_attempts, data->steals, data->idle_time);
+	}
+
 	context->started = FALSE;
 }
 
@@ -41,6 +41,13 @@ struct _WorkerData {
 	 * work during the phase
 	 */
 	gint64 last_start;
+	/*
+	 * Set when the worker runs out of work, so we can account the time it
+	 * spent idle while the other workers were still marking.
+	 */
+	gint64 last_finish, idle_time;
+	/* Number of times we looked for work in other workers' queues and how many sections we got. */
+	int steal_attempts, steals;
 };
 
 struct _WorkerContext {
@@ -59,6 +66,8 @@ struct _WorkerContext {
 	mono_mutex_t finished_lock;
 	volatile gboolean workers_finished;
 	int worker_awakenings;
+	/* When the last working worker ran out of work */
+	gint64 last_finish;
 
 	SgenSectionGrayQueue workers_distribute_gray_queue;
 
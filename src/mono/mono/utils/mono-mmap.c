@@ -309,6 +309,12 @@ mono_valloc (void *addr, size_t length, int flags, MonoMemAccountType type)
 	if (ptr == MAP_FAILED)
 		return NULL;
 
+#if defined(HAVE_MADVISE) && defined(MADV_HUGEPAGE)
+	/* This is only a hint, the kernel is free to ignore it */
+	if (flags & MONO_MMAP_HUGEPAGES)
+		madvise (ptr, length, MADV_HUGEPAGE);
+#endif
+
 	mono_account_mem (type, (ssize_t)length);
 
 	return ptr;
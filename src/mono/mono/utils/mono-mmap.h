@@ -22,7 +22,9 @@ enum {
 	MONO_MMAP_ANON    = 1 << 6,
 	MONO_MMAP_FIXED   = 1 << 7,
 	MONO_MMAP_32BIT   = 1 << 8,
-	MONO_MMAP_JIT     = 1 << 9
+	MONO_MMAP_JIT     = 1 << 9,
+	/* hint that the mapping should be backed by transparent huge pages */
+	MONO_MMAP_HUGEPAGES = 1 << 10
 };
 
 typedef enum {
@@ -13,6 +13,12 @@
 
 #include <glib.h>
 
+/* Browser builds with emscripten pthreads, and WASI builds targeting wasi-threads, have real pthreads */
+#if defined(__EMSCRIPTEN_PTHREADS__) || (defined(HOST_WASI) && !defined(DISABLE_THREADS))
+#define WASM_USE_PTHREADS 1
+#include <sched.h>
+#endif
+
 #ifdef HOST_BROWSER
 
 #include <mono/utils/mono-threads-wasm.h>
@@ -122,7 +128,7 @@ mono_native_thread_id_equals (MonoNativeThreadId id1, MonoNativeThreadId id2)
 MonoNativeThreadId
 mono_native_thread_id_get (void)
 {
-#ifdef __EMSCRIPTEN_PTHREADS__
+#ifdef WASM_USE_PTHREADS
 	return pthread_self ();
 #else
 	return (MonoNativeThreadId)1;
@@ -132,7 +138,7 @@ mono_native_thread_id_get (void)
 guint64
 mono_native_thread_os_id_get (void)
 {
-#ifdef __EMSCRIPTEN_PTHREADS__
+#ifdef WASM_USE_PTHREADS
 	return (guint64)pthread_self ();
 #else
 	return 1;
@@ -148,7 +154,11 @@ mono_native_thread_processor_id_get (void)
 MONO_API gboolean
 mono_native_thread_create (MonoNativeThreadId *tid, gpointer func, gpointer arg)
 {
+#if defined(HOST_WASI) && defined(WASM_USE_PTHREADS)
+	return pthread_create (tid, NULL, (void *(*)(void *)) func, arg) == 0;
+#else
 	g_error ("WASM doesn't support threading");
+#endif
 }
 
 static const char *thread_name;
@@ -162,7 +172,7 @@ mono_native_thread_set_name (MonoNativeThreadId tid, const char *name)
 gboolean
 mono_native_thread_join (MonoNativeThreadId tid)
 {
-#ifdef __EMSCRIPTEN_PTHREADS__
+#ifdef WASM_USE_PTHREADS
 	void *res;
 
 	return !pthread_join (tid, &res);
@@ -174,7 +184,11 @@ mono_native_thread_join (MonoNativeThreadId tid)
 gboolean
 mono_threads_platform_yield (void)
 {
+#if defined(HOST_WASI) && defined(WASM_USE_PTHREADS)
+	return sched_yield () == 0;
+#else
 	return TRUE;
+#endif
 }
 
 void
@@ -183,7 +197,7 @@ mono_threads_platform_get_stack_bounds (guint8 **staddr, size_t *stsize)
 #ifndef HOST_WASI
 	int tmp;
 #endif	
-#ifdef __EMSCRIPTEN_PTHREADS__
+#ifdef WASM_USE_PTHREADS
 	pthread_attr_t attr;
 	gint res;
 
@@ -227,7 +241,7 @@ mono_threads_platform_get_stack_bounds (guint8 **staddr, size_t *stsize)
 gboolean
 mono_thread_platform_create_thread (MonoThreadStart thread_fn, gpointer thread_data, gsize* const stack_size, MonoNativeThreadId *tid)
 {
-#ifdef __EMSCRIPTEN_PTHREADS__
+#ifdef WASM_USE_PTHREADS
 	pthread_attr_t attr;
 	pthread_t thread;
 	gint res;
@@ -307,7 +321,7 @@ void mono_threads_platform_init (void)
 void
 mono_threads_platform_exit (gsize exit_code)
 {
-#ifdef __EMSCRIPTEN_PTHREADS__
+#ifdef WASM_USE_PTHREADS
 	pthread_exit ((gpointer) exit_code);
 #else
 	g_assert_not_reached ();
@@ -9,7 +9,13 @@
 #include <errno.h>
 #include <sys/stat.h>
 #include <sys/time.h>
+#include <sys/uio.h>
 #include <fcntl.h>
+#include <poll.h>
+#include <sys/socket.h>
+#ifdef WASI_THREADS
+#include <pthread.h>
+#endif
 #include <unistd.h>
 
 #define INVARIANT_GLOBALIZATION 1
@@ -68,6 +74,10 @@ void mono_trace_init (void);
 #define g_new0(type, size) ((type *) calloc (sizeof (type), (size)))
 
 static MonoDomain *root_domain;
+/* Set when the runtime was loaded while pre-initializing the module, e.g. by Wizer */
+static int runtime_preinitialized;
+/* Registers the AOT images linked into the module, see mono_wasi_enable_aot () */
+static void (*aot_modules_register) (void);
 
 #define RUNTIMECONFIG_BIN_FILE "runtimeconfig.bin"
 
@@ -82,6 +92,31 @@ wasm_trace_logger (const char *log_domain, const char *log_level, const char *me
 typedef uint32_t target_mword;
 typedef target_mword SgenDescriptor;
 typedef SgenDescriptor MonoGCDescriptor;
+int mono_gc_register_root (char *start, size_t size, MonoGCDescriptor descr, MonoGCRootSource source, void *key, const char *msg);
+void mono_gc_deregister_root (char* addr);
+MonoGCDescriptor mono_gc_make_root_descr_all_refs (int numbits);
+
+/*
+ * mono_wasm_register_root:
+ *
+ *   Register the area START..START+SIZE, which must only contain object references or NULL,
+ * as a GC root. Unlike the browser driver, the area is registered with a precise descriptor,
+ * so the objects it references can be moved and don't pin nursery or major heap blocks.
+ * Long running WASI instances keep roots like these for their whole life, and pinning from
+ * them would fragment the heap.
+ */
+int
+mono_wasm_register_root (char *start, size_t size, const char *name)
+{
+	assert (size % sizeof (void*) == 0);
+	return mono_gc_register_root (start, size, mono_gc_make_root_descr_all_refs ((int)(size / sizeof (void*))), MONO_ROOT_SOURCE_EXTERNAL, NULL, name ? name : "mono_wasm_register_root");
+}
+
+void
+mono_wasm_deregister_root (char *addr)
+{
+	mono_gc_deregister_root (addr);
+}
 
 typedef struct WasmAssembly_ WasmAssembly;
 
@@ -93,6 +128,35 @@ struct WasmAssembly_ {
 static WasmAssembly *assemblies;
 static int assembly_count;
 
+/* NULL terminated tables emitted at build time, see mono_wasi_register_bundle_tables () */
+static const MonoBundledAssembly **assembly_table;
+static const MonoBundledSatelliteAssembly **satellite_assembly_table;
+
+/*
+ * mono_wasi_register_bundle_tables:
+ *
+ *   Register NULL terminated tables of bundled assemblies and satellite assemblies whose
+ * data lives in the module's data segments, e.g. generated by the app bundler. The images
+ * are used in place, and the runtime indexes them by name when they are registered, so
+ * assemblies which are never loaded cost nothing beyond their table entry.
+ * Either table can be NULL. Must be called before mono_wasm_load_runtime ().
+ */
+void
+mono_wasi_register_bundle_tables (const MonoBundledAssembly **assemblies, const MonoBundledSatelliteAssembly **satellites)
+{
+	assembly_table = assemblies;
+	satellite_assembly_table = satellites;
+}
+
+static int
+bundle_table_length (const void **table)
+{
+	int len = 0;
+	while (table && table [len])
+		++len;
+	return len;
+}
+
 int
 mono_wasm_add_assembly (const char *name, const unsigned char *data, unsigned int size)
 {
@@ -277,6 +341,349 @@ int64_t SystemNative_GetTimestamp2() {
 		: 0;
 }
 
+/*
+ * File I/O shims. libSystem.Native is built with Emscripten, where preadv/pwritev are avoided and
+ * every vector becomes its own pread/pwrite call. wasi-libc maps preadv/pwritev onto a single
+ * fd_pread/fd_pwrite taking the whole iovec array, and posix_fadvise onto fd_advise, so implement
+ * these directly here. Buffering is left to FileStream, which already reads ahead in managed code.
+ */
+typedef struct
+{
+	uint8_t* Base;
+	uintptr_t Count;
+} IOVector;
+
+_Static_assert (sizeof (IOVector) == sizeof (struct iovec), "IOVector must match struct iovec");
+
+int32_t SystemNative_Read2(intptr_t fd, void* buffer, int32_t bufferSize) {
+	ssize_t count;
+	while ((count = read ((int)fd, buffer, (size_t)bufferSize)) < 0 && errno == EINTR);
+	return (int32_t)count;
+}
+
+int32_t SystemNative_PWrite2(intptr_t fd, void* buffer, int32_t bufferSize, int64_t fileOffset) {
+	ssize_t count;
+	while ((count = pwrite ((int)fd, buffer, (size_t)bufferSize, (off_t)fileOffset)) < 0 && errno == EINTR);
+	return (int32_t)count;
+}
+
+int64_t SystemNative_PReadV2(intptr_t fd, IOVector* vectors, int32_t vectorCount, int64_t fileOffset) {
+	ssize_t count;
+	while ((count = preadv ((int)fd, (struct iovec*)vectors, vectorCount, (off_t)fileOffset)) < 0 && errno == EINTR);
+	return count;
+}
+
+int64_t SystemNative_PWriteV2(intptr_t fd, IOVector* vectors, int32_t vectorCount, int64_t fileOffset) {
+	ssize_t count;
+	while ((count = pwritev ((int)fd, (struct iovec*)vectors, vectorCount, (off_t)fileOffset)) < 0 && errno == EINTR);
+	return count;
+}
+
+int32_t SystemNative_PosixFAdvise2(intptr_t fd, int64_t offset, int64_t length, int32_t advice) {
+	int posix_advice;
+	// Values of the PAL FileAdvice enum
+	switch (advice) {
+	case 0: posix_advice = POSIX_FADV_NORMAL; break;
+	case 1: posix_advice = POSIX_FADV_RANDOM; break;
+	case 2: posix_advice = POSIX_FADV_SEQUENTIAL; break;
+	case 3: posix_advice = POSIX_FADV_WILLNEED; break;
+	case 4: posix_advice = POSIX_FADV_DONTNEED; break;
+	case 5: posix_advice = POSIX_FADV_NOREUSE; break;
+	default: return EINVAL;
+	}
+	int32_t result;
+	while ((result = posix_fadvise ((int)fd, (off_t)offset, (off_t)length, posix_advice)) == EINTR);
+	return result;
+}
+
+/*
+ * Sockets. WASI preview 1 only has sock_accept/sock_recv/sock_send/sock_shutdown on sockets
+ * handed to the module by the host, plus poll_oneoff, so that is what is implemented here.
+ * The socket event port emulates the edge triggered epoll backend of pal_networking.c with
+ * poll (poll_oneoff in wasi-libc): a readiness bit is reported once and is only polled for
+ * again after the Receive/Send/Accept shims below saw EAGAIN for it, so a socket which stays
+ * writable doesn't make WaitForSocketEvents spin.
+ */
+typedef struct
+{
+	uintptr_t Data;
+	int32_t Events;
+	uint32_t Padding;
+} SocketEvent;
+
+enum {
+	SocketEvents_SA_NONE = 0x00,
+	SocketEvents_SA_READ = 0x01,
+	SocketEvents_SA_WRITE = 0x02,
+	SocketEvents_SA_READCLOSE = 0x04,
+	SocketEvents_SA_CLOSE = 0x08,
+	SocketEvents_SA_ERROR = 0x10,
+};
+
+typedef struct {
+	intptr_t port;
+	int32_t events;
+	/* Readiness already reported and not consumed yet */
+	int32_t ready;
+	uintptr_t data;
+} SocketRegistration;
+
+/* Indexed by file descriptor, port == 0 means unused */
+static SocketRegistration *socket_registrations;
+static int socket_registrations_size;
+static intptr_t socket_event_port_next = 1;
+
+#ifdef WASI_THREADS
+static pthread_mutex_t socket_registrations_lock = PTHREAD_MUTEX_INITIALIZER;
+#define SOCKET_REGISTRATIONS_LOCK() pthread_mutex_lock (&socket_registrations_lock)
+#define SOCKET_REGISTRATIONS_UNLOCK() pthread_mutex_unlock (&socket_registrations_lock)
+/*
+ * There is no pipe () to wake a thread blocked in poll when registrations change,
+ * so poll with a timeout and pick the changes up on the next iteration.
+ */
+#define SOCKET_POLL_TIMEOUT_MS 50
+#else
+#define SOCKET_REGISTRATIONS_LOCK()
+#define SOCKET_REGISTRATIONS_UNLOCK()
+/* Single threaded, the caller pumps the port, so never block */
+#define SOCKET_POLL_TIMEOUT_MS 0
+#endif
+
+static void
+socket_rearm (int fd, int32_t events)
+{
+	SOCKET_REGISTRATIONS_LOCK ();
+	if (fd >= 0 && fd < socket_registrations_size)
+		socket_registrations [fd].ready &= ~events;
+	SOCKET_REGISTRATIONS_UNLOCK ();
+}
+
+int32_t SystemNative_CreateSocketEventPort2(intptr_t* port) {
+	if (port == NULL)
+		return SystemNative_ConvertErrorPlatformToPal (EFAULT);
+	SOCKET_REGISTRATIONS_LOCK ();
+	*port = socket_event_port_next++;
+	SOCKET_REGISTRATIONS_UNLOCK ();
+	return 0;
+}
+
+int32_t SystemNative_CloseSocketEventPort2(intptr_t port) {
+	SOCKET_REGISTRATIONS_LOCK ();
+	for (int fd = 0; fd < socket_registrations_size; ++fd) {
+		if (socket_registrations [fd].port == port)
+			memset (&socket_registrations [fd], 0, sizeof (SocketRegistration));
+	}
+	SOCKET_REGISTRATIONS_UNLOCK ();
+	return 0;
+}
+
+int32_t SystemNative_CreateSocketEventBuffer2(int32_t count, SocketEvent** buffer) {
+	if (buffer == NULL || count < 0)
+		return SystemNative_ConvertErrorPlatformToPal (EFAULT);
+	*buffer = (SocketEvent*)malloc (sizeof (SocketEvent) * (size_t)count);
+	return *buffer ? 0 : SystemNative_ConvertErrorPlatformToPal (ENOMEM);
+}
+
+int32_t SystemNative_FreeSocketEventBuffer2(SocketEvent* buffer) {
+	free (buffer);
+	return 0;
+}
+
+int32_t SystemNative_TryChangeSocketEventRegistration2(intptr_t port, intptr_t socket, int32_t currentEvents, int32_t newEvents, uintptr_t data) {
+	const int32_t supported_events = SocketEvents_SA_READ | SocketEvents_SA_WRITE | SocketEvents_SA_READCLOSE | SocketEvents_SA_CLOSE | SocketEvents_SA_ERROR;
+	int fd = (int)socket;
+
+	if ((currentEvents & ~supported_events) != 0 || (newEvents & ~supported_events) != 0 || fd < 0)
+		return SystemNative_ConvertErrorPlatformToPal (EINVAL);
+	if (currentEvents == newEvents)
+		return 0;
+
+	SOCKET_REGISTRATIONS_LOCK ();
+	if (fd >= socket_registrations_size) {
+		int new_size = socket_registrations_size ? socket_registrations_size : 16;
+		while (new_size <= fd)
+			new_size *= 2;
+		SocketRegistration *new_registrations = g_new0 (SocketRegistration, new_size);
+		if (!new_registrations) {
+			SOCKET_REGISTRATIONS_UNLOCK ();
+			return SystemNative_ConvertErrorPlatformToPal (ENOMEM);
+		}
+		if (socket_registrations)
+			memcpy (new_registrations, socket_registrations, sizeof (SocketRegistration) * socket_registrations_size);
+		free (socket_registrations);
+		socket_registrations = new_registrations;
+		socket_registrations_size = new_size;
+	}
+	SocketRegistration *reg = &socket_registrations [fd];
+	if (newEvents == SocketEvents_SA_NONE) {
+		memset (reg, 0, sizeof (SocketRegistration));
+	} else {
+		if (currentEvents == SocketEvents_SA_NONE)
+			reg->ready = 0;
+		reg->port = port;
+		reg->events = newEvents;
+		reg->ready &= newEvents;
+		reg->data = data;
+	}
+	SOCKET_REGISTRATIONS_UNLOCK ();
+	return 0;
+}
+
+int32_t SystemNative_WaitForSocketEvents2(intptr_t port, SocketEvent* buffer, int32_t* count) {
+	if (buffer == NULL || count == NULL || *count < 0)
+		return SystemNative_ConvertErrorPlatformToPal (EFAULT);
+
+	struct pollfd *fds;
+	int nfds = 0;
+
+	SOCKET_REGISTRATIONS_LOCK ();
+	fds = g_new (struct pollfd, socket_registrations_size + 1);
+	for (int fd = 0; fd < socket_registrations_size; ++fd) {
+		SocketRegistration *reg = &socket_registrations [fd];
+		short wanted = 0;
+		if (reg->port != port)
+			continue;
+		if ((reg->events & SocketEvents_SA_READ) && !(reg->ready & SocketEvents_SA_READ))
+			wanted |= POLLIN;
+		if ((reg->events & SocketEvents_SA_WRITE) && !(reg->ready & SocketEvents_SA_WRITE))
+			wanted |= POLLOUT;
+		if (!wanted)
+			continue;
+		fds [nfds].fd = fd;
+		fds [nfds].events = wanted;
+		fds [nfds].revents = 0;
+		++nfds;
+	}
+	SOCKET_REGISTRATIONS_UNLOCK ();
+
+	int res;
+	while ((res = poll (fds, nfds, SOCKET_POLL_TIMEOUT_MS)) < 0 && errno == EINTR);
+	if (res < 0) {
+		int err = errno;
+		free (fds);
+		*count = 0;
+		return SystemNative_ConvertErrorPlatformToPal (err);
+	}
+
+	int32_t n = 0;
+	SOCKET_REGISTRATIONS_LOCK ();
+	for (int i = 0; i < nfds && n < *count; ++i) {
+		SocketRegistration *reg = &socket_registrations [fds [i].fd];
+		int32_t events = 0;
+		if (!fds [i].revents || reg->port != port)
+			continue;
+		if (fds [i].revents & POLLNVAL) {
+			// The socket was closed without unregistering it, which the epoll backend allows
+			memset (reg, 0, sizeof (SocketRegistration));
+			continue;
+		}
+		if (fds [i].revents & (POLLHUP | POLLERR)) {
+			// Same as the epoll backend, let the reads and writes surface the error
+			events = SocketEvents_SA_READ | SocketEvents_SA_WRITE;
+		} else {
+			if (fds [i].revents & POLLIN)
+				events |= SocketEvents_SA_READ;
+			if (fds [i].revents & POLLOUT)
+				events |= SocketEvents_SA_WRITE;
+		}
+		events &= reg->events;
+		if (!events)
+			continue;
+		reg->ready |= events;
+		buffer [n].Data = reg->data;
+		buffer [n].Events = events;
+		buffer [n].Padding = 0;
+		++n;
+	}
+	SOCKET_REGISTRATIONS_UNLOCK ();
+
+	free (fds);
+	*count = n;
+	return 0;
+}
+
+static int
+socket_flags_pal_to_platform (int32_t flags, int *platform_flags)
+{
+	// Only SocketFlags.Peek can be expressed with sock_recv
+	if (flags & ~0x0002)
+		return 0;
+	*platform_flags = (flags & 0x0002) ? MSG_PEEK : 0;
+	return 1;
+}
+
+int32_t SystemNative_Receive2(intptr_t socket, void* buffer, int32_t bufferLen, int32_t flags, int32_t* received) {
+	int platform_flags;
+	ssize_t res;
+
+	if (buffer == NULL || bufferLen < 0 || received == NULL)
+		return SystemNative_ConvertErrorPlatformToPal (EFAULT);
+	if (!socket_flags_pal_to_platform (flags, &platform_flags))
+		return SystemNative_ConvertErrorPlatformToPal (ENOTSUP);
+
+	while ((res = recv ((int)socket, buffer, (size_t)bufferLen, platform_flags)) < 0 && errno == EINTR);
+	if (res != -1) {
+		*received = (int32_t)res;
+		return 0;
+	}
+	int err = errno;
+	if (err == EAGAIN || err == EWOULDBLOCK)
+		socket_rearm ((int)socket, SocketEvents_SA_READ);
+	*received = 0;
+	return SystemNative_ConvertErrorPlatformToPal (err);
+}
+
+int32_t SystemNative_Send2(intptr_t socket, void* buffer, int32_t bufferLen, int32_t flags, int32_t* sent) {
+	ssize_t res;
+
+	if (buffer == NULL || bufferLen < 0 || sent == NULL)
+		return SystemNative_ConvertErrorPlatformToPal (EFAULT);
+	if (flags != 0)
+		return SystemNative_ConvertErrorPlatformToPal (ENOTSUP);
+
+	while ((res = send ((int)socket, buffer, (size_t)bufferLen, 0)) < 0 && errno == EINTR);
+	if (res != -1) {
+		*sent = (int32_t)res;
+		return 0;
+	}
+	int err = errno;
+	if (err == EAGAIN || err == EWOULDBLOCK)
+		socket_rearm ((int)socket, SocketEvents_SA_WRITE);
+	*sent = 0;
+	return SystemNative_ConvertErrorPlatformToPal (err);
+}
+
+int32_t SystemNative_Accept2(intptr_t socket, uint8_t* socketAddress, int32_t* socketAddressLen, intptr_t* acceptedSocket) {
+	int fd;
+
+	if (socketAddressLen == NULL || acceptedSocket == NULL || *socketAddressLen < 0)
+		return SystemNative_ConvertErrorPlatformToPal (EFAULT);
+
+	// sock_accept doesn't report the peer address
+	while ((fd = accept ((int)socket, NULL, NULL)) < 0 && errno == EINTR);
+	if (fd == -1) {
+		int err = errno;
+		if (err == EAGAIN || err == EWOULDBLOCK)
+			socket_rearm ((int)socket, SocketEvents_SA_READ);
+		*acceptedSocket = -1;
+		return SystemNative_ConvertErrorPlatformToPal (err);
+	}
+	*socketAddressLen = 0;
+	*acceptedSocket = fd;
+	return 0;
+}
+
+int32_t SystemNative_Shutdown2(intptr_t socket, int32_t socketShutdown) {
+	int how;
+	switch (socketShutdown) {
+	case 0: how = SHUT_RD; break;
+	case 1: how = SHUT_WR; break;
+	case 2: how = SHUT_RDWR; break;
+	default: return SystemNative_ConvertErrorPlatformToPal (EINVAL);
+	}
+	return shutdown ((int)socket, how) == 0 ? 0 : SystemNative_ConvertErrorPlatformToPal (errno);
+}
+
 static PinvokeImport SystemNativeImports [] = {
 	{"SystemNative_GetEnv", SystemNative_GetEnv },
 	{"SystemNative_GetEnviron", SystemNative_GetEnviron },
@@ -305,6 +712,21 @@ static PinvokeImport SystemNativeImports [] = {
 	{"SystemNative_ConvertErrorPalToPlatform", SystemNative_ConvertErrorPalToPlatform},
 	{"SystemNative_StrErrorR", SystemNative_StrErrorR},
 	{"SystemNative_PRead", SystemNative_PRead},
+	{"SystemNative_Read", SystemNative_Read2},
+	{"SystemNative_PWrite", SystemNative_PWrite2},
+	{"SystemNative_PReadV", SystemNative_PReadV2},
+	{"SystemNative_PWriteV", SystemNative_PWriteV2},
+	{"SystemNative_PosixFAdvise", SystemNative_PosixFAdvise2},
+	{"SystemNative_CreateSocketEventPort", SystemNative_CreateSocketEventPort2},
+	{"SystemNative_CloseSocketEventPort", SystemNative_CloseSocketEventPort2},
+	{"SystemNative_CreateSocketEventBuffer", SystemNative_CreateSocketEventBuffer2},
+	{"SystemNative_FreeSocketEventBuffer", SystemNative_FreeSocketEventBuffer2},
+	{"SystemNative_TryChangeSocketEventRegistration", SystemNative_TryChangeSocketEventRegistration2},
+	{"SystemNative_WaitForSocketEvents", SystemNative_WaitForSocketEvents2},
+	{"SystemNative_Receive", SystemNative_Receive2},
+	{"SystemNative_Send", SystemNative_Send2},
+	{"SystemNative_Accept", SystemNative_Accept2},
+	{"SystemNative_Shutdown", SystemNative_Shutdown2},
 	{"SystemNative_CanGetHiddenFlag", SystemNative_CanGetHiddenFlag},
 	{"SystemNative_GetTimestamp", SystemNative_GetTimestamp2},
 	{"SystemNative_Access", SystemNative_Access},
@@ -335,28 +757,138 @@ wasm_dl_load (const char *name, int flags, char **err, void *user_data)
     return 0;
 }
 
+/*
+ * The import tables are small and fixed, so instead of scanning them with strcmp on every
+ * lookup, an open addressed hash index is built for each table the first time it is used.
+ * The index is sized to at least twice the number of entries so probe chains stay short.
+ */
+typedef struct {
+	PinvokeImport *table;
+	int *slots;
+	uint32_t mask;
+} PinvokeImportIndex;
+
+static PinvokeImportIndex pinvoke_import_indexes [2];
+
+static uint32_t
+pinvoke_hash (const char *name)
+{
+	/* FNV-1a */
+	uint32_t h = 2166136261u;
+	for (; *name; ++name)
+		h = (h ^ (uint8_t)*name) * 16777619u;
+	return h;
+}
+
+static PinvokeImportIndex*
+pinvoke_import_index_get (PinvokeImport *table)
+{
+	PinvokeImportIndex *index = NULL;
+	int i, count;
+	uint32_t size;
+
+	for (i = 0; i < sizeof (pinvoke_import_indexes) / sizeof (pinvoke_import_indexes [0]); ++i) {
+		if (pinvoke_import_indexes [i].table == table)
+			return &pinvoke_import_indexes [i];
+		if (!pinvoke_import_indexes [i].table) {
+			index = &pinvoke_import_indexes [i];
+			break;
+		}
+	}
+	assert (index);
+
+	for (count = 0; table [count].name; ++count)
+		;
+	for (size = 4; size < count * 2; size <<= 1)
+		;
+	index->slots = g_new (int, size);
+	memset (index->slots, 0xff, sizeof (int) * size);
+	index->mask = size - 1;
+	for (i = 0; i < count; ++i) {
+		uint32_t slot = pinvoke_hash (table [i].name) & index->mask;
+		while (index->slots [slot] != -1)
+			slot = (slot + 1) & index->mask;
+		index->slots [slot] = i;
+	}
+	index->table = table;
+	return index;
+}
+
 static void*
 wasm_dl_symbol (void *handle, const char *name, char **err, void *user_data)
 {
 	if (handle == sysglobal_native_handle)
 		assert (0);
 
-	PinvokeImport *table = (PinvokeImport*)handle;
-	for (int i = 0; table [i].name; ++i) {
-		if (!strcmp (table [i].name, name))
-			return table [i].func;
+	PinvokeImportIndex *index = pinvoke_import_index_get ((PinvokeImport*)handle);
+	uint32_t slot = pinvoke_hash (name) & index->mask;
+	while (index->slots [slot] != -1) {
+		PinvokeImport *entry = &index->table [index->slots [slot]];
+		if (!strcmp (entry->name, name))
+			return entry->func;
+		slot = (slot + 1) & index->mask;
 	}
 	return NULL;
 }
 
 #define NEED_INTERP 1
 
+typedef struct {
+	const char *key;
+	void *func;
+	InterpFtnDesc *ftndesc;
+} NativeToInterpEntry;
+
+static NativeToInterpEntry *native_to_interp_entries;
+static uint32_t native_to_interp_size, native_to_interp_count;
+
+static void
+native_to_interp_insert (NativeToInterpEntry *entries, uint32_t size, NativeToInterpEntry *entry)
+{
+	uint32_t slot = pinvoke_hash (entry->key) & (size - 1);
+	while (entries [slot].key && strcmp (entries [slot].key, entry->key))
+		slot = (slot + 1) & (size - 1);
+	entries [slot] = *entry;
+}
+
+/*
+ * mono_wasi_register_native_to_interp:
+ *
+ *   Register FUNC as the entry thunk used by native code to call into the interpreter for
+ * the method identified by KEY ("<assembly>_<class>_<method>" with '.' replaced by '_', the
+ * same key the browser pinvoke table generator uses for UnmanagedCallersOnly methods).
+ * FUNC must have the native signature of the method and call FTNDESC->func with the address
+ * of each argument, the address of the return value and FTNDESC->arg. FTNDESC is filled in
+ * by the runtime when a function pointer to the method is first requested; it points to an
+ * InterpFtnDesc, a { func, arg } pair of pointers.
+ */
+void
+mono_wasi_register_native_to_interp (const char *key, void *func, void *ftndesc)
+{
+	NativeToInterpEntry entry = { key, func, (InterpFtnDesc*)ftndesc };
+
+	if ((native_to_interp_count + 1) * 2 > native_to_interp_size) {
+		uint32_t new_size = native_to_interp_size ? native_to_interp_size * 2 : 16;
+		NativeToInterpEntry *new_entries = g_new0 (NativeToInterpEntry, new_size);
+		for (uint32_t i = 0; i < native_to_interp_size; ++i) {
+			if (native_to_interp_entries [i].key)
+				native_to_interp_insert (new_entries, new_size, &native_to_interp_entries [i]);
+		}
+		free (native_to_interp_entries);
+		native_to_interp_entries = new_entries;
+		native_to_interp_size = new_size;
+	}
+	native_to_interp_insert (native_to_interp_entries, native_to_interp_size, &entry);
+	native_to_interp_count ++;
+}
+
 /*
  * get_native_to_interp:
  *
  *   Return a pointer to a wasm function which can be used to enter the interpreter to
  * execute METHOD from native code.
  * EXTRA_ARG is the argument passed to the interp entry functions in the runtime.
+ * The result is cached by the interpreter, so this is only called once per method.
  */
 void*
 get_native_to_interp (MonoMethod *method, void *extra_arg)
@@ -371,6 +903,9 @@ get_native_to_interp (MonoMethod *method, void *extra_arg)
 	char key [128];
 	int len;
 
+	if (!native_to_interp_count)
+		return NULL;
+
 	assert (strlen (name) < 100);
 	snprintf (key, sizeof(key), "%s_%s_%s", name, class_name, method_name);
 	len = strlen (key);
@@ -379,26 +914,42 @@ get_native_to_interp (MonoMethod *method, void *extra_arg)
 			key [i] = '_';
 	}
 
-    assert(0); return 0;
-	//void *addr = wasm_dl_get_native_to_interp (key, extra_arg);
-	//return addr;
+	uint32_t slot = pinvoke_hash (key) & (native_to_interp_size - 1);
+	while (native_to_interp_entries [slot].key) {
+		NativeToInterpEntry *entry = &native_to_interp_entries [slot];
+		if (!strcmp (entry->key, key)) {
+			*entry->ftndesc = *(InterpFtnDesc*)extra_arg;
+			return entry->func;
+		}
+		slot = (slot + 1) & (native_to_interp_size - 1);
+	}
+	/* The interpreter reports a missing UnmanagedCallersOnly wrapper */
+	return NULL;
 }
 
 void
 mono_wasm_register_bundled_satellite_assemblies (void)
 {
 	/* In legacy satellite_assembly_count is always false */
-	if (satellite_assembly_count) {
-		MonoBundledSatelliteAssembly **satellite_bundle_array =  g_new0 (MonoBundledSatelliteAssembly *, satellite_assembly_count + 1);
-		WasmSatelliteAssembly *cur = satellite_assemblies;
-		int i = 0;
-		while (cur) {
-			satellite_bundle_array [i] = cur->assembly;
-			cur = cur->next;
-			++i;
-		}
-		mono_register_bundled_satellite_assemblies ((const MonoBundledSatelliteAssembly **)satellite_bundle_array);
+	if (!satellite_assembly_count) {
+		/* The build time table can be handed to the runtime as is */
+		if (satellite_assembly_table)
+			mono_register_bundled_satellite_assemblies (satellite_assembly_table);
+		return;
+	}
+
+	int table_len = bundle_table_length ((const void **)satellite_assembly_table);
+	MonoBundledSatelliteAssembly **satellite_bundle_array =  g_new0 (MonoBundledSatelliteAssembly *, satellite_assembly_count + table_len + 1);
+	WasmSatelliteAssembly *cur = satellite_assemblies;
+	int i = 0;
+	while (cur) {
+		satellite_bundle_array [i] = cur->assembly;
+		cur = cur->next;
+		++i;
 	}
+	for (int j = 0; j < table_len; ++j)
+		satellite_bundle_array [i++] = (MonoBundledSatelliteAssembly *)satellite_assembly_table [j];
+	mono_register_bundled_satellite_assemblies ((const MonoBundledSatelliteAssembly **)satellite_bundle_array);
 }
 
 void
@@ -413,6 +964,10 @@ mono_wasm_load_runtime (const char *argv, int debug_level)
 {
 	const char *interp_opts = "";
 
+	/* The linear memory snapshot already contains an initialized runtime */
+	if (runtime_preinitialized)
+		return;
+
 #ifndef INVARIANT_GLOBALIZATION
 	mono_wasm_link_icu_shim ();
 #else
@@ -438,6 +993,11 @@ mono_wasm_load_runtime (const char *argv, int debug_level)
 		// Disable optimizations which interfere with debugging
 		interp_opts = "-all";
 		free (debugger_str_with_fd);
+	} else {
+		/* Interpreter optimization flags, e.g. "-tiering", mostly useful to compare configurations */
+		char *env_interp_opts = monoeg_g_getenv ("MONO_WASI_INTERP_OPTS");
+		if (env_interp_opts)
+			interp_opts = env_interp_opts;
 	}
 	// When the list of app context properties changes, please update RuntimeConfigReservedProperties for
 	// target _WasmGenerateRuntimeConfig in WasmApp.targets file
@@ -477,7 +1037,14 @@ mono_wasm_load_runtime (const char *argv, int debug_level)
 	mono_wasm_install_interp_to_native_callback (mono_wasm_interp_to_native_callback);
 #endif
 
-	mono_jit_set_aot_mode (MONO_AOT_MODE_INTERP_ONLY);
+	if (aot_modules_register) {
+		monoeg_g_setenv ("MONO_AOT_MODE", "aot", 1);
+		aot_modules_register ();
+		/* Methods which weren't AOT compiled still run on the interpreter */
+		mono_jit_set_aot_mode (MONO_AOT_MODE_LLVMONLY_INTERP);
+	} else {
+		mono_jit_set_aot_mode (MONO_AOT_MODE_INTERP_ONLY);
+	}
 
 	mono_ee_interp_init (interp_opts);
 	mono_marshal_ilgen_init ();
@@ -485,7 +1052,8 @@ mono_wasm_load_runtime (const char *argv, int debug_level)
 	mono_sgen_mono_ilgen_init ();
 
 	if (assembly_count) {
-		MonoBundledAssembly **bundle_array = g_new0 (MonoBundledAssembly*, assembly_count + 1);
+		int table_len = bundle_table_length ((const void **)assembly_table);
+		MonoBundledAssembly **bundle_array = g_new0 (MonoBundledAssembly*, assembly_count + table_len + 1);
 		WasmAssembly *cur = assemblies;
 		int i = 0;
 		while (cur) {
@@ -493,7 +1061,12 @@ mono_wasm_load_runtime (const char *argv, int debug_level)
 			cur = cur->next;
 			++i;
 		}
+		/* Assemblies added at runtime take precedence over the build time table */
+		for (int j = 0; j < table_len; ++j)
+			bundle_array [i++] = (MonoBundledAssembly *)assembly_table [j];
 		mono_register_bundled_assemblies ((const MonoBundledAssembly **)bundle_array);
+	} else if (assembly_table) {
+		mono_register_bundled_assemblies (assembly_table);
 	}
 
 	mono_wasm_register_bundled_satellite_assemblies ();
@@ -504,6 +1077,43 @@ mono_wasm_load_runtime (const char *argv, int debug_level)
 	mono_thread_set_main (mono_thread_current ());
 }
 
+/*
+ * mono_wasi_enable_aot:
+ *
+ *   Run the runtime in llvmonly+interp mode. REGISTER_MODULES is called while the runtime is
+ * loaded and should call mono_aot_register_module () for each AOT image linked into the
+ * module, see the 'aot' target of the console sample. Must be called before
+ * mono_wasm_load_runtime ().
+ */
+void
+mono_wasi_enable_aot (void (*register_modules) (void))
+{
+	aot_modules_register = register_modules;
+}
+
+/*
+ * mono_wasi_preinitialize:
+ *
+ *   Load the runtime and run WARMUP, if any, so the initialized linear memory can be
+ * snapshotted into the module at build time (e.g. from a function exported as
+ * 'wizer.initialize'). Instances created from the snapshot skip mono_wasm_load_runtime ().
+ * Environment variables and preopened directories are the ones seen at build time.
+ */
+void
+mono_wasi_preinitialize (const char *argv, int debug_level, void (*warmup) (void))
+{
+	mono_wasm_load_runtime (argv, debug_level);
+	if (warmup)
+		warmup ();
+	runtime_preinitialized = 1;
+}
+
+int
+mono_wasi_is_preinitialized (void)
+{
+	return runtime_preinitialized;
+}
+
 MonoAssembly*
 mono_wasm_assembly_load (const char *name)
 {
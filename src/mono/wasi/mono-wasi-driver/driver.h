@@ -4,8 +4,12 @@
 #include <mono/metadata/assembly.h>
 #include <mono/metadata/object.h>
 #include <mono/metadata/loader.h>
+#include <mono/metadata/mono-private-unstable.h>
 
 void mono_wasm_load_runtime (const char *unused, int debug_level);
+void mono_wasi_preinitialize (const char *unused, int debug_level, void (*warmup) (void));
+int mono_wasi_is_preinitialized (void);
+void mono_wasi_enable_aot (void (*register_modules) (void));
 int mono_wasm_add_assembly (const char *name, const unsigned char *data, unsigned int size);
 MonoAssembly* mono_wasm_assembly_load(const char *name);
 MonoMethod* mono_wasm_assembly_get_entry_point (MonoAssembly *assembly);
@@ -15,6 +19,8 @@ MonoObject* mono_wasm_invoke_method (MonoMethod *method, MonoObject *this_arg, v
 int mono_unbox_int (MonoObject *obj);
 void mono_wasm_setenv (const char *name, const char *value);
 void add_assembly(const char* base_dir, const char *name);
+void mono_wasi_register_bundle_tables (const MonoBundledAssembly **assemblies, const MonoBundledSatelliteAssembly **satellites);
+void mono_wasi_register_native_to_interp (const char *key, void *func, void *ftndesc);
 
 MonoArray* mono_wasm_obj_array_new (int size);
 void mono_wasm_obj_array_set (MonoArray *array, int idx, MonoObject *obj);
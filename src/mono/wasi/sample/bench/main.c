@@ -0,0 +1,70 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "../../mono-wasi-driver/driver.h"
+
+// Runs one workload of WasiBenchApp.dll and prints a single result line:
+//   bench <workload> <iterations>
+// The workloads are static methods 'int WasiBenchApp.Benchmarks.<workload> (int iterations)':
+// Startup, Json, Alloc, InterpLoop and FileIO.
+
+static const char* app_base_dir = "./WasiBenchApp/bin/Release/net7.0";
+
+#ifdef WASI_AOT
+// Generated by the 'aot' target of the console sample Makefile
+void register_aot_modules(void);
+#endif
+
+static double now_ms() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000.0 + ts.tv_nsec / 1000000.0;
+}
+
+static const char* config_name() {
+#ifdef WASI_AOT
+    return "aot";
+#else
+    const char* opts = getenv("MONO_WASI_INTERP_OPTS");
+    return opts && strstr(opts, "-tiering") ? "interp-notiering" : "interp";
+#endif
+}
+
+int main(int argc, char** argv) {
+    const char* workload = argc > 1 ? argv[1] : "Startup";
+    int iterations = argc > 2 ? atoi(argv[2]) : 1;
+
+    double start = now_ms();
+
+    char* assemblies_path;
+    asprintf(&assemblies_path, "%s:%s/runtime/native:%s/runtime/lib/net7.0", app_base_dir, app_base_dir, app_base_dir);
+    add_assembly(app_base_dir, "WasiBenchApp.dll");
+    mono_set_assemblies_path(assemblies_path);
+#ifdef WASI_AOT
+    mono_wasi_enable_aot(register_aot_modules);
+#endif
+    mono_wasm_load_runtime("", 0);
+    MonoMethod* method = lookup_dotnet_method("WasiBenchApp.dll", "WasiBenchApp", "Benchmarks", workload, 1);
+
+    double startup_end = now_ms();
+
+    void* params[] = { &iterations };
+    MonoObject* out_exc = NULL;
+    MonoObject* result = mono_wasm_invoke_method(method, NULL, params, &out_exc);
+    if (out_exc) {
+        fprintf(stderr, "%s threw an exception\n", workload);
+        return 1;
+    }
+
+    double run_end = now_ms();
+    double run_ms = run_end - startup_end;
+
+    // Linear memory never shrinks, so its current size is the peak
+    unsigned long linear_memory_kb = (unsigned long)__builtin_wasm_memory_size(0) * 64;
+
+    printf("workload=%s config=%s startup_ms=%.2f run_ms=%.2f iterations=%d ops_per_sec=%.1f linear_memory_kb=%lu checksum=%d\n",
+        workload, config_name(), startup_end - start, run_ms, iterations,
+        run_ms > 0 ? iterations * 1000.0 / run_ms : 0.0, linear_memory_kb, mono_unbox_int(result));
+    return 0;
+}
@@ -1,17 +1,45 @@
 #include <string.h>
 #include "../../mono-wasi-driver/driver.h"
 
-int main() {
-    // Assume the runtime pack has been copied into the output directory as 'runtime'
-    // Otherwise we have to mount an unrelated part of the filesystem within the WASM environment
-    const char* app_base_dir = "./WasiConsoleApp/bin/Debug/net7.0";
+// Assume the runtime pack has been copied into the output directory as 'runtime'
+// Otherwise we have to mount an unrelated part of the filesystem within the WASM environment
+static const char* app_base_dir = "./WasiConsoleApp/bin/Debug/net7.0";
+
+static void setup_assemblies() {
     char* assemblies_path;
     asprintf(&assemblies_path, "%s:%s/runtime/native:%s/runtime/lib/net7.0", app_base_dir, app_base_dir, app_base_dir);
 
     add_assembly(app_base_dir, "WasiConsoleApp.dll");
     mono_set_assemblies_path(assemblies_path);
+#ifdef WASI_AOT
+    mono_wasi_enable_aot(register_aot_modules);
+#endif
+}
 
-    mono_wasm_load_runtime("", 0);
+#ifdef WASI_AOT
+// Generated by the 'aot' target of the Makefile
+void register_aot_modules(void);
+#endif
+
+#ifdef WASI_PREINIT
+static void warmup() {
+    // Load the app assembly as part of the snapshot, so only running it is left for each instance
+    mono_wasm_assembly_load ("WasiConsoleApp.dll");
+}
+
+// Called by Wizer at build time, the resulting module starts with the runtime already loaded
+__attribute__((export_name("wizer.initialize")))
+void wizer_initialize() {
+    setup_assemblies();
+    mono_wasi_preinitialize("", 0, warmup);
+}
+#endif
+
+int main() {
+    if (!mono_wasi_is_preinitialized()) {
+        setup_assemblies();
+        mono_wasm_load_runtime("", 0);
+    }
 
     MonoAssembly* assembly = mono_wasm_assembly_load ("WasiConsoleApp.dll");
     MonoMethod* entry_method = mono_wasm_assembly_get_entry_point (assembly);
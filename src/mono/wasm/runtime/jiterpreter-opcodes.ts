@@ -332,6 +332,11 @@ export const enum MintOpcode {
     MINT_BLT_UN_I4_IMM_SP,
     MINT_BLT_UN_I8_IMM_SP,
 
+    MINT_ADD_I4_IMM_BLT_I4_SP,
+    MINT_ADD_I4_IMM_BLE_I4_SP,
+    MINT_ADD_I4_IMM_BLT_UN_I4_SP,
+    MINT_ADD_I4_IMM_BNE_UN_I4_SP,
+
 
     MINT_SWITCH,
 
@@ -795,6 +800,10 @@ export const enum MintOpcode {
     MINT_INTRINS_64ORDINAL_IGNORE_CASE_ASCII,
     MINT_INTRINS_U32_TO_DECSTR,
     MINT_INTRINS_WIDEN_ASCII_TO_UTF16,
+    MINT_SIMD_V128_LDC,
+    MINT_SIMD_INTRINS_P_P,
+    MINT_SIMD_INTRINS_P_PP,
+    MINT_SIMD_INTRINS_P_PPP,
 
     // TODO: Make this wasm only
     MINT_TIER_PREPARE_JITERPRETER,
@@ -1160,6 +1169,11 @@ export const OpcodeInfo : OpcodeInfoTable = {
     [MintOpcode.MINT_BLT_UN_I4_IMM_SP]: [ "blt.un.i4.imm.sp", 4, 0, 1, MintOpArgType.MintOpShortAndShortBranch],
     [MintOpcode.MINT_BLT_UN_I8_IMM_SP]: [ "blt.un.i8.imm.sp", 4, 0, 1, MintOpArgType.MintOpShortAndShortBranch],
 
+    [MintOpcode.MINT_ADD_I4_IMM_BLT_I4_SP]: [ "add.i4.imm.blt.i4.sp", 6, 1, 2, MintOpArgType.MintOpShortAndShortBranch],
+    [MintOpcode.MINT_ADD_I4_IMM_BLE_I4_SP]: [ "add.i4.imm.ble.i4.sp", 6, 1, 2, MintOpArgType.MintOpShortAndShortBranch],
+    [MintOpcode.MINT_ADD_I4_IMM_BLT_UN_I4_SP]: [ "add.i4.imm.blt.un.i4.sp", 6, 1, 2, MintOpArgType.MintOpShortAndShortBranch],
+    [MintOpcode.MINT_ADD_I4_IMM_BNE_UN_I4_SP]: [ "add.i4.imm.bne.un.i4.sp", 6, 1, 2, MintOpArgType.MintOpShortAndShortBranch],
+
 
     [MintOpcode.MINT_SWITCH]: [ "switch", 0, 0, 1, MintOpArgType.MintOpSwitch],
 
@@ -1498,7 +1512,7 @@ export const OpcodeInfo : OpcodeInfoTable = {
     /* Calls */
     [MintOpcode.MINT_CALL]: [ "call", 4, 1, 1, MintOpArgType.MintOpMethodToken],
     [MintOpcode.MINT_CALLVIRT]: [ "callvirt", 4, 1, 1, MintOpArgType.MintOpMethodToken],
-    [MintOpcode.MINT_CALLVIRT_FAST]: [ "callvirt.fast", 5, 1, 1, MintOpArgType.MintOpMethodToken],
+    [MintOpcode.MINT_CALLVIRT_FAST]: [ "callvirt.fast", 6, 1, 1, MintOpArgType.MintOpMethodToken],
     [MintOpcode.MINT_CALL_DELEGATE]: [ "call.delegate", 5, 1, 1, MintOpArgType.MintOpTwoShorts],
     [MintOpcode.MINT_CALLI]: [ "calli", 4, 1, 2, MintOpArgType.MintOpNoArgs],
     [MintOpcode.MINT_CALLI_NAT]: [ "calli.nat", 8, 1, 2, MintOpArgType.MintOpMethodToken],
@@ -1623,6 +1637,10 @@ export const OpcodeInfo : OpcodeInfoTable = {
     [MintOpcode.MINT_INTRINS_64ORDINAL_IGNORE_CASE_ASCII]: [ "intrins_64ordinal_ignore_case_ascii", 4, 1, 2, MintOpArgType.MintOpNoArgs],
     [MintOpcode.MINT_INTRINS_U32_TO_DECSTR]: [ "intrins_u32_to_decstr", 5, 1, 1, MintOpArgType.MintOpTwoShorts],
     [MintOpcode.MINT_INTRINS_WIDEN_ASCII_TO_UTF16]: [ "intrins_widen_ascii_to_utf16", 5, 1, 3, MintOpArgType.MintOpNoArgs],
+    [MintOpcode.MINT_SIMD_V128_LDC]: [ "simd_v128_ldc", 3, 1, 0, MintOpArgType.MintOpShortInt],
+    [MintOpcode.MINT_SIMD_INTRINS_P_P]: [ "simd_intrins_p_p", 4, 1, 1, MintOpArgType.MintOpShortInt],
+    [MintOpcode.MINT_SIMD_INTRINS_P_PP]: [ "simd_intrins_p_pp", 5, 1, 2, MintOpArgType.MintOpShortInt],
+    [MintOpcode.MINT_SIMD_INTRINS_P_PPP]: [ "simd_intrins_p_ppp", 6, 1, 3, MintOpArgType.MintOpShortInt],
 
     // TODO: Make this wasm only
     [MintOpcode.MINT_TIER_PREPARE_JITERPRETER]: [ "tier_prepare_jiterpreter", 3, 0, 0, MintOpArgType.MintOpInt],
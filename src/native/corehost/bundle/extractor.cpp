@@ -6,7 +6,11 @@
 #include "dir_utils.h"
 #include "pal.h"
 #include "utils.h"
+#include <algorithm>
+#include <atomic>
 #include <cinttypes>
+#include <system_error>
+#include <thread>
 
 #ifdef __sun
 #include <alloca.h>
@@ -187,6 +191,75 @@ void extractor_t::extract(const file_entry_t &entry, reader_t &reader)
     fclose(file);
 }
 
+// Extract several files from the bundle to disk.
+// Inflating compressed files dominates the extraction, so files are spread across one thread per core.
+void extractor_t::extract(std::vector<const file_entry_t*>& entries, reader_t& reader)
+{
+    size_t thread_count = std::min(static_cast<size_t>(std::max(std::thread::hardware_concurrency(), 1u)), entries.size());
+    if (thread_count <= 1)
+    {
+        for (const file_entry_t* entry : entries)
+        {
+            extract(*entry, reader);
+        }
+
+        return;
+    }
+
+    // Hand out the largest files first so that a big file picked up last doesn't leave the other threads idle.
+    std::sort(entries.begin(), entries.end(), [](const file_entry_t* a, const file_entry_t* b)
+        {
+            return a->size() > b->size();
+        });
+
+    std::atomic<size_t> next_entry(0);
+    std::atomic<int> failure(StatusCode::Success);
+
+    // Each thread reads the bundle through its own reader since extracting moves the reader's offset.
+    auto extract_worker = [&](reader_t worker_reader)
+        {
+            try
+            {
+                for (size_t i = next_entry++; i < entries.size() && failure == StatusCode::Success; i = next_entry++)
+                {
+                    extract(*entries[i], worker_reader);
+                }
+            }
+            catch (StatusCode e)
+            {
+                int expected = StatusCode::Success;
+                failure.compare_exchange_strong(expected, e);
+            }
+        };
+
+    std::vector<std::thread> threads;
+    for (size_t i = 1; i < thread_count; i++)
+    {
+        try
+        {
+            threads.emplace_back(extract_worker, reader);
+        }
+        catch (const std::system_error&)
+        {
+            // Continue with the threads started so far, the current thread extracts too.
+            break;
+        }
+    }
+
+    trace::info(_X("Extracting %zu files using %zu threads."), entries.size(), threads.size() + 1);
+
+    extract_worker(reader);
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    if (failure != StatusCode::Success)
+    {
+        throw static_cast<StatusCode>(failure.load());
+    }
+}
+
 void extractor_t::begin()
 {
     // Files are extracted to a specific deterministic location on disk
@@ -279,14 +352,17 @@ void extractor_t::commit_file(const pal::string_t& relative_path)
 
 void extractor_t::extract_new(reader_t& reader)
 {
-    begin();
+    std::vector<const file_entry_t*> entries;
     for (const file_entry_t& entry : m_manifest.files)
     {
         if (entry.needs_extraction())
         {
-            extract(entry, reader);
+            entries.push_back(&entry);
         }
     }
+
+    begin();
+    extract(entries, reader);
     commit_dir();
 }
 
@@ -295,7 +371,7 @@ void extractor_t::extract_new(reader_t& reader)
 void extractor_t::verify_recover_extraction(reader_t& reader)
 {
     pal::string_t& ext_dir = extraction_dir();
-    bool recovered = false;
+    std::vector<const file_entry_t*> missing_entries;
 
     for (const file_entry_t& entry : m_manifest.files)
     {
@@ -309,21 +385,23 @@ void extractor_t::verify_recover_extraction(reader_t& reader)
 
         if (!pal::file_exists(file_path))
         {
-            if (!recovered)
-            {
-                recovered = true;
-                begin();
-            }
-
-            extract(entry, reader);
-            commit_file(entry.relative_path());
+            missing_entries.push_back(&entry);
         }
     }
 
-    if (recovered)
+    if (missing_entries.empty())
     {
-        clean();
+        return;
     }
+
+    begin();
+    extract(missing_entries, reader);
+    for (const file_entry_t* entry : missing_entries)
+    {
+        commit_file(entry->relative_path());
+    }
+
+    clean();
 }
 
 pal::string_t& extractor_t::extract(reader_t& reader)
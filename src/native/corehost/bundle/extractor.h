@@ -34,6 +34,7 @@ namespace bundle
 
         FILE* create_extraction_file(const pal::string_t& relative_path);
         void extract(const file_entry_t& entry, reader_t& reader);
+        void extract(std::vector<const file_entry_t*>& entries, reader_t& reader);
 
         void begin();
         void commit_file(const pal::string_t& relative_path);
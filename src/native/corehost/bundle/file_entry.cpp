@@ -14,7 +14,7 @@ bool file_entry_t::is_valid() const
         static_cast<file_type_t>(m_type) < file_type_t::__last;
 }
 
-file_entry_t file_entry_t::read(reader_t &reader, uint32_t bundle_major_version, bool force_extraction)
+file_entry_t file_entry_t::read(reader_t &reader, uint32_t bundle_major_version, bool force_extraction, bool lazy_assemblies)
 {
     // First read the fixed-sized portion of file-entry
     file_entry_fixed_t fixed_data;
@@ -32,6 +32,11 @@ file_entry_t file_entry_t::read(reader_t &reader, uint32_t bundle_major_version,
 
     fixed_data.type   = (file_type_t)reader.read_byte();
 
+    if (lazy_assemblies && fixed_data.type == file_type_t::assembly)
+    {
+        force_extraction = false;
+    }
+
     file_entry_t entry(&fixed_data, force_extraction);
 
     if (!entry.is_valid())
@@ -73,7 +73,8 @@ namespace bundle
         bool needs_extraction() const;
         bool matches(const pal::string_t& path) const { return (pal::pathcmp(relative_path(), path) == 0) && !is_disabled(); }
 
-        static file_entry_t read(reader_t &reader, uint32_t bundle_major_version, bool force_extraction);
+        // With lazy_assemblies, managed assemblies are loaded from the bundle even if force_extraction is set.
+        static file_entry_t read(reader_t &reader, uint32_t bundle_major_version, bool force_extraction, bool lazy_assemblies);
 
     private:
         int64_t m_offset;
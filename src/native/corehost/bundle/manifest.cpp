@@ -2,6 +2,7 @@
 // The .NET Foundation licenses this file to you under the MIT license.
 
 #include "manifest.h"
+#include "trace.h"
 
 using namespace bundle;
 
@@ -9,9 +10,22 @@ manifest_t manifest_t::read(reader_t& reader, const header_t& header)
 {
     manifest_t manifest;
 
+    // In .NET Core 3 compat mode all files are extracted. DOTNET_BUNDLE_LAZY_ASSEMBLIES=1 opts out of extracting
+    // the managed assemblies: they are loaded from the bundle instead, and compressed ones are inflated in memory
+    // by the runtime when first loaded. Assembly.Location is empty for them, as in regular single-file apps.
+    bool force_extraction = header.is_netcoreapp3_compat_mode();
+    pal::string_t lazy_assemblies_value;
+    bool lazy_assemblies = force_extraction
+        && pal::getenv(_X("DOTNET_BUNDLE_LAZY_ASSEMBLIES"), &lazy_assemblies_value)
+        && pal::xtoi(lazy_assemblies_value.c_str()) == 1;
+    if (lazy_assemblies)
+    {
+        trace::info(_X("Managed assemblies are loaded from the bundle without extraction."));
+    }
+
     for (int32_t i = 0; i < header.num_embedded_files(); i++)
     {
-        file_entry_t entry = file_entry_t::read(reader, header.major_version(), header.is_netcoreapp3_compat_mode());
+        file_entry_t entry = file_entry_t::read(reader, header.major_version(), force_extraction, lazy_assemblies);
         manifest.files.push_back(std::move(entry));
         manifest.m_files_need_extraction |= entry.needs_extraction();
     }
@@ -13,6 +13,7 @@ list(APPEND SOURCES
     ${CMAKE_CURRENT_LIST_DIR}/fx_muxer.cpp
     ${CMAKE_CURRENT_LIST_DIR}/fx_resolver.cpp
     ${CMAKE_CURRENT_LIST_DIR}/fx_resolver.messages.cpp
+    ${CMAKE_CURRENT_LIST_DIR}/framework_index.cpp
     ${CMAKE_CURRENT_LIST_DIR}/framework_info.cpp
     ${CMAKE_CURRENT_LIST_DIR}/host_context.cpp
     ${CMAKE_CURRENT_LIST_DIR}/install_info.cpp
@@ -30,6 +31,7 @@ list(APPEND HEADERS
     ${CMAKE_CURRENT_LIST_DIR}/corehost_init.h
     ${CMAKE_CURRENT_LIST_DIR}/fx_muxer.h
     ${CMAKE_CURRENT_LIST_DIR}/fx_resolver.h
+    ${CMAKE_CURRENT_LIST_DIR}/framework_index.h
     ${CMAKE_CURRENT_LIST_DIR}/framework_info.h
     ${CMAKE_CURRENT_LIST_DIR}/host_context.h
     ${CMAKE_CURRENT_LIST_DIR}/install_info.h
@@ -0,0 +1,200 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+#include "framework_index.h"
+#include "trace.h"
+#include "utils.h"
+
+namespace
+{
+    // The index is a UTF-8 text file: a header line followed by one line per framework
+    //   <name>\t<last write time of the framework directory>\t<version>;<version>;...
+    const char index_header[] = "dotnet-framework-index 1";
+    const pal::char_t index_file_name[] = _X(".fxindex");
+
+    struct index_entry_t
+    {
+        uint64_t last_write_time;
+        std::vector<pal::string_t> versions;
+    };
+
+    typedef std::unordered_map<pal::string_t, index_entry_t> index_t;
+
+    bool read_index(const pal::string_t& index_path, index_t* index)
+    {
+        pal::ifstream_t file{ index_path };
+        if (!file.good())
+        {
+            return false;
+        }
+
+        std::string line;
+        if (!std::getline(file, line) || line != index_header)
+        {
+            return false;
+        }
+
+        while (std::getline(file, line))
+        {
+            size_t name_end = line.find('\t');
+            size_t time_end = name_end == std::string::npos ? std::string::npos : line.find('\t', name_end + 1);
+            if (time_end == std::string::npos)
+            {
+                return false;
+            }
+
+            pal::string_t name;
+            if (!pal::clr_palstring(line.substr(0, name_end).c_str(), &name))
+            {
+                return false;
+            }
+
+            index_entry_t entry;
+            entry.last_write_time = std::strtoull(line.c_str() + name_end + 1, nullptr, 10);
+
+            size_t start = time_end + 1;
+            while (start < line.size())
+            {
+                size_t end = line.find(';', start);
+                if (end == std::string::npos)
+                {
+                    end = line.size();
+                }
+
+                pal::string_t version;
+                if (!pal::clr_palstring(line.substr(start, end - start).c_str(), &version))
+                {
+                    return false;
+                }
+
+                entry.versions.push_back(std::move(version));
+                start = end + 1;
+            }
+
+            (*index)[name] = std::move(entry);
+        }
+
+        return true;
+    }
+
+    bool append_utf8(const pal::string_t& value, std::string* out)
+    {
+        // Names containing the separators of the index can't be stored.
+        if (value.empty() || value.find_first_of(_X("\t\r\n;")) != pal::string_t::npos)
+        {
+            return false;
+        }
+
+        std::vector<char> utf8;
+        if (!pal::pal_utf8string(value, &utf8))
+        {
+            return false;
+        }
+
+        out->append(utf8.data());
+        return true;
+    }
+
+    void write_index(const pal::string_t& index_path, const index_t& index)
+    {
+        std::string contents = index_header;
+        contents.push_back('\n');
+        for (const auto& fx : index)
+        {
+            std::string line;
+            if (!append_utf8(fx.first, &line))
+            {
+                continue;
+            }
+
+            line.push_back('\t');
+            line.append(std::to_string(fx.second.last_write_time));
+            line.push_back('\t');
+
+            bool valid = true;
+            for (size_t i = 0; i < fx.second.versions.size() && valid; i++)
+            {
+                if (i != 0)
+                {
+                    line.push_back(';');
+                }
+
+                valid = append_utf8(fx.second.versions[i], &line);
+            }
+
+            if (valid)
+            {
+                contents.append(line);
+                contents.push_back('\n');
+            }
+        }
+
+        // Write to a process specific file first so that concurrent launches never read a partial index.
+        pal::char_t pid[32];
+        pal::snwprintf(pid, 32, _X("%x"), pal::get_pid());
+        pal::string_t temp_path = index_path + _X(".") + pid + _X(".tmp");
+
+        FILE* file = pal::file_open(temp_path, _X("wb"));
+        if (file == nullptr)
+        {
+            // Installations are commonly read-only for the user running the app.
+            trace::verbose(_X("Failed to write framework index [%s]"), index_path.c_str());
+            return;
+        }
+
+        bool written = fwrite(contents.data(), 1, contents.size(), file) == contents.size();
+        written = (fclose(file) == 0) && written;
+
+        // Renaming over an existing file fails on Windows.
+        if (written && pal::rename(temp_path.c_str(), index_path.c_str()) != 0)
+        {
+            pal::remove(index_path.c_str());
+            written = pal::rename(temp_path.c_str(), index_path.c_str()) == 0;
+        }
+
+        if (!written)
+        {
+            trace::verbose(_X("Failed to write framework index [%s]"), index_path.c_str());
+            pal::remove(temp_path.c_str());
+        }
+    }
+}
+
+void framework_index_t::get_versions(const pal::string_t& shared_dir, const pal::string_t& fx_name, std::vector<pal::string_t>* versions)
+{
+    pal::string_t fx_dir = shared_dir;
+    append_path(&fx_dir, fx_name.c_str());
+
+    // Stamped before the directory is enumerated, so that a version installed concurrently makes the entry stale.
+    uint64_t size;
+    uint64_t last_write_time;
+    if (!pal::get_file_stamp(fx_dir, &size, &last_write_time))
+    {
+        return;
+    }
+
+    pal::string_t index_path = shared_dir;
+    append_path(&index_path, index_file_name);
+
+    index_t index;
+    if (!read_index(index_path, &index))
+    {
+        index.clear();
+    }
+
+    const auto& existing = index.find(fx_name);
+    if (existing != index.end() && existing->second.last_write_time == last_write_time)
+    {
+        trace::verbose(_X("Using framework index [%s] for [%s]"), index_path.c_str(), fx_name.c_str());
+        versions->insert(versions->end(), existing->second.versions.begin(), existing->second.versions.end());
+        return;
+    }
+
+    std::vector<pal::string_t> fx_versions;
+    pal::readdir_onlydirectories(fx_dir, &fx_versions);
+    versions->insert(versions->end(), fx_versions.begin(), fx_versions.end());
+
+    trace::verbose(_X("Updating framework index [%s] for [%s]"), index_path.c_str(), fx_name.c_str());
+    index[fx_name] = index_entry_t { last_write_time, std::move(fx_versions) };
+    write_index(index_path, index);
+}
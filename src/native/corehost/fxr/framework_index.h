@@ -0,0 +1,23 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+#ifndef __FRAMEWORK_INDEX_H_
+#define __FRAMEWORK_INDEX_H_
+
+#include "pal.h"
+
+// Index of the framework versions installed in a dotnet root, stored in <dotnet root>/shared/.fxindex.
+//
+// The versions of each framework are recorded along with the last write time of the framework
+// directory (shared/<name>), which changes whenever a version is installed or removed. Resolving
+// a framework then stats that directory and reads the index instead of enumerating the directory,
+// which has to stat every entry on file systems that don't report entry types (network, overlay).
+// Missing or stale entries are rebuilt from the directory and written back if the installation
+// is writable, so the index is created by the first launch after an install.
+struct framework_index_t
+{
+    // Gets the names of the version directories of framework fx_name in shared_dir (<dotnet root>/shared).
+    static void get_versions(const pal::string_t& shared_dir, const pal::string_t& fx_name, std::vector<pal::string_t>* versions);
+};
+
+#endif // __FRAMEWORK_INDEX_H_
@@ -2,6 +2,7 @@
 // The .NET Foundation licenses this file to you under the MIT license.
 
 #include "fx_resolver.h"
+#include "framework_index.h"
 #include "host_startup_info.h"
 #include "trace.h"
 
@@ -218,6 +219,7 @@ namespace
             trace::verbose(_X("Searching FX directory in [%s]"), fx_dir.c_str());
 
             append_path(&fx_dir, _X("shared"));
+            pal::string_t fx_shared_dir = fx_dir;
             append_path(&fx_dir, fx_ref.get_fx_name().c_str());
 
             // Roll forward is disabled when:
@@ -247,7 +249,7 @@ namespace
             {
                 std::vector<pal::string_t> list;
                 std::vector<fx_ver_t> version_list;
-                pal::readdir_onlydirectories(fx_dir, &list);
+                framework_index_t::get_versions(fx_shared_dir, fx_ref.get_fx_name(), &list);
 
                 for (const auto& version : list)
                 {
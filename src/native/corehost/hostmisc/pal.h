@@ -277,6 +277,8 @@ namespace pal
     bool realpath(string_t* path, bool skip_error_logging = false);
     bool file_exists(const string_t& path);
     inline bool directory_exists(const string_t& path) { return file_exists(path); }
+    // Gets the size and last write time of a file or directory, used to detect changes to inputs of cached state.
+    bool get_file_stamp(const string_t& path, uint64_t* size, uint64_t* last_write_time);
     void readdir(const string_t& path, const string_t& pattern, std::vector<string_t>* list);
     void readdir(const string_t& path, std::vector<string_t>* list);
     void readdir_onlydirectories(const string_t& path, const string_t& pattern, std::vector<string_t>* list);
@@ -968,6 +968,23 @@ bool pal::file_exists(const pal::string_t& path)
     return (::access(path.c_str(), F_OK) == 0);
 }
 
+bool pal::get_file_stamp(const pal::string_t& path, uint64_t* size, uint64_t* last_write_time)
+{
+    struct stat buf;
+    if (::stat(path.c_str(), &buf) != 0)
+    {
+        return false;
+    }
+
+    *size = static_cast<uint64_t>(buf.st_size);
+#if defined(__APPLE__)
+    *last_write_time = static_cast<uint64_t>(buf.st_mtimespec.tv_sec) * 1000000000 + static_cast<uint64_t>(buf.st_mtimespec.tv_nsec);
+#else
+    *last_write_time = static_cast<uint64_t>(buf.st_mtim.tv_sec) * 1000000000 + static_cast<uint64_t>(buf.st_mtim.tv_nsec);
+#endif
+    return true;
+}
+
 static void readdir(const pal::string_t& path, const pal::string_t& pattern, bool onlydirectories, std::vector<pal::string_t>* list)
 {
     assert(list != nullptr);
@@ -792,6 +792,19 @@ bool pal::file_exists(const string_t& path)
     return pal::realpath(&tmp, true);
 }
 
+bool pal::get_file_stamp(const string_t& path, uint64_t* size, uint64_t* last_write_time)
+{
+    WIN32_FILE_ATTRIBUTE_DATA data;
+    if (GetFileAttributesExW(path.c_str(), GetFileExInfoStandard, &data) == 0)
+    {
+        return false;
+    }
+
+    *size = (static_cast<uint64_t>(data.nFileSizeHigh) << 32) | data.nFileSizeLow;
+    *last_write_time = (static_cast<uint64_t>(data.ftLastWriteTime.dwHighDateTime) << 32) | data.ftLastWriteTime.dwLowDateTime;
+    return true;
+}
+
 static void readdir(const pal::string_t& path, const pal::string_t& pattern, bool onlydirectories, std::vector<pal::string_t>* list)
 {
     assert(list != nullptr);
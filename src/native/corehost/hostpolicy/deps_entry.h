@@ -47,14 +47,17 @@ struct deps_entry_t
 
     static const std::array<const pal::char_t*, deps_entry_t::asset_types::count> s_known_asset_types;
 
-    pal::string_t deps_file;
+    // The following strings are shared by all the entries of a deps file and point into the
+    // deps_json_t the entry comes from, they are only valid for the lifetime of the deps_json_t.
+    const pal::char_t* deps_file = _X("");
+    const pal::char_t* library_hash = _X("");
+    const pal::char_t* library_hash_path = _X(""); // As written in the deps file, with '/' separators
+    const pal::char_t* runtime_store_manifest_list = _X("");
+
     pal::string_t library_type;
     pal::string_t library_name;
     pal::string_t library_version;
-    pal::string_t library_hash;
     pal::string_t library_path;
-    pal::string_t library_hash_path;
-    pal::string_t runtime_store_manifest_list;
     asset_types asset_type;
     deps_asset_t asset;
     bool is_serviceable;
@@ -18,6 +18,14 @@ const std::array<const pal::char_t*, deps_entry_t::asset_types::count> deps_entr
 
 namespace
 {
+    const pal::char_t* get_optional_string(
+        const json_parser_t::value_t& properties,
+        const pal::char_t* key)
+    {
+        const auto& prop = properties.FindMember(key);
+        return (prop != properties.MemberEnd() && prop->value.IsString()) ? prop->value.GetString() : _X("");
+    }
+
     pal::string_t get_optional_property(
         const json_parser_t::value_t& properties,
         const pal::string_t& key)
@@ -47,7 +55,7 @@ void deps_json_t::reconcile_libraries_with_targets(
     const std::function<bool(const pal::string_t&)>& library_exists_fn,
     const std::function<const vec_asset_t&(const pal::string_t&, size_t, bool*)>& get_assets_fn)
 {
-    pal::string_t deps_file = get_filename(deps_path);
+    m_deps_file_name = get_filename(deps_path);
 
     for (const auto& library : json[_X("libraries")].GetObject())
     {
@@ -60,12 +68,13 @@ void deps_json_t::reconcile_libraries_with_targets(
             continue;
         }
 
-        const pal::string_t& hash = library.value[_X("sha512")].GetString();
+        // Strings used as-is point into the parsed document rather than being copied into every entry of the library.
+        const pal::char_t* hash = library.value[_X("sha512")].GetString();
         bool serviceable = library.value[_X("serviceable")].GetBool();
 
         pal::string_t library_path = get_optional_path(library.value, _X("path"));
-        pal::string_t library_hash_path = get_optional_path(library.value, _X("hashPath"));
-        pal::string_t runtime_store_manifest_list = get_optional_path(library.value, _X("runtimeStoreManifestName"));
+        const pal::char_t* library_hash_path = get_optional_string(library.value, _X("hashPath"));
+        const pal::char_t* runtime_store_manifest_list = get_optional_string(library.value, _X("runtimeStoreManifestName"));
 
         for (size_t i = 0; i < deps_entry_t::s_known_asset_types.size(); ++i)
         {
@@ -92,7 +101,7 @@ void deps_json_t::reconcile_libraries_with_targets(
                 entry.asset_type = static_cast<deps_entry_t::asset_types>(i);
                 entry.is_serviceable = serviceable;
                 entry.is_rid_specific = rid_specific;
-                entry.deps_file = deps_file;
+                entry.deps_file = m_deps_file_name.c_str();
                 entry.asset = asset;
                 entry.asset.name = asset_name;
 
@@ -423,7 +432,7 @@ void deps_json_t::load(bool is_framework_dependent, const pal::string_t& deps_pa
     m_deps_file = deps_path;
     m_file_exists = bundle::info_t::config_t::probe(deps_path) || pal::realpath(&m_deps_file, true);
 
-    json_parser_t json;
+    json_parser_t& json = m_json;
     if (!m_file_exists)
     {
         // If file doesn't exist, then assume parsed.
@@ -87,6 +87,10 @@ private:
     bool m_valid;
 
     pal::string_t m_deps_file;
+    pal::string_t m_deps_file_name;
+
+    // Kept alive with the deps entries, which reference strings of the parsed document.
+    json_parser_t m_json;
 };
 
 #endif // __DEPS_FORMAT_H_
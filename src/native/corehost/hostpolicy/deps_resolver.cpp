@@ -377,7 +377,7 @@ bool deps_resolver_t::probe_deps_entry(const deps_entry_t& entry, const pal::str
 
 bool report_missing_assembly_in_manifest(const deps_entry_t& entry, bool continueResolving = false)
 {
-    bool showManifestListMessage = !entry.runtime_store_manifest_list.empty();
+    bool showManifestListMessage = entry.runtime_store_manifest_list[0] != _X('\0');
 
     if (entry.asset_type == deps_entry_t::asset_types::resources)
     {
@@ -385,31 +385,31 @@ bool report_missing_assembly_in_manifest(const deps_entry_t& entry, bool continu
         continueResolving = true;
 
         trace::info(MissingAssemblyMessage, _X("Info"),
-            entry.deps_file.c_str(), entry.library_name.c_str(), entry.library_version.c_str(), entry.asset.relative_path.c_str());
+            entry.deps_file, entry.library_name.c_str(), entry.library_version.c_str(), entry.asset.relative_path.c_str());
 
         if (showManifestListMessage)
         {
-            trace::info(ManifestListMessage, entry.runtime_store_manifest_list.c_str());
+            trace::info(ManifestListMessage, entry.runtime_store_manifest_list);
         }
     }
     else if (continueResolving)
     {
         trace::warning(MissingAssemblyMessage, _X("Warning"),
-            entry.deps_file.c_str(), entry.library_name.c_str(), entry.library_version.c_str(), entry.asset.relative_path.c_str());
+            entry.deps_file, entry.library_name.c_str(), entry.library_version.c_str(), entry.asset.relative_path.c_str());
 
         if (showManifestListMessage)
         {
-            trace::warning(ManifestListMessage, entry.runtime_store_manifest_list.c_str());
+            trace::warning(ManifestListMessage, entry.runtime_store_manifest_list);
         }
     }
     else
     {
         trace::error(MissingAssemblyMessage, _X("Error"),
-            entry.deps_file.c_str(), entry.library_name.c_str(), entry.library_version.c_str(), entry.asset.relative_path.c_str());
+            entry.deps_file, entry.library_name.c_str(), entry.library_version.c_str(), entry.asset.relative_path.c_str());
 
         if (showManifestListMessage)
         {
-            trace::error(ManifestListMessage, entry.runtime_store_manifest_list.c_str());
+            trace::error(ManifestListMessage, entry.runtime_store_manifest_list);
         }
     }
 
@@ -469,7 +469,7 @@ bool deps_resolver_t::resolve_tpa_list(
             {
                 trace::error(
                     DuplicateAssemblyWithDifferentExtensionMessage,
-                    entry.deps_file.c_str(),
+                    entry.deps_file,
                     entry.library_name.c_str(),
                     entry.library_version.c_str(),
                     entry.asset.relative_path.c_str(),
@@ -750,6 +750,30 @@ void deps_resolver_t::enum_app_context_deps_files(std::function<void(const pal::
     }
 }
 
+void deps_resolver_t::enum_resolution_inputs(std::function<void(const pal::string_t&)> callback) const
+{
+    callback(m_app_dir);
+
+    for (const auto& deps : m_fx_deps)
+    {
+        callback(deps->get_deps_file());
+    }
+
+    for (const auto& additional_deps : m_additional_deps)
+    {
+        callback(additional_deps->get_deps_file());
+    }
+
+    // Files added to or removed from a probed directory update its last write time.
+    for (const auto& probe : m_probes)
+    {
+        if (!probe.probe_dir.empty())
+        {
+            callback(probe.probe_dir);
+        }
+    }
+}
+
 /**
  *  Resolve native and culture assembly directories based on "asset_type" parameter.
  */
@@ -135,6 +135,9 @@ public:
 
     void enum_app_context_deps_files(std::function<void(const pal::string_t&)> callback);
 
+    // Enumerates the files and directories the resolution depends on: the deps files and the probed directories.
+    void enum_resolution_inputs(std::function<void(const pal::string_t&)> callback) const;
+
     bool is_framework_dependent() const
     {
         return m_is_framework_dependent;
@@ -16,6 +16,7 @@ list(APPEND SOURCES
     ${CMAKE_CURRENT_LIST_DIR}/hostpolicy_context.cpp
     ${CMAKE_CURRENT_LIST_DIR}/hostpolicy.cpp
     ${CMAKE_CURRENT_LIST_DIR}/hostpolicy_init.cpp
+    ${CMAKE_CURRENT_LIST_DIR}/startup_cache.cpp
     ${CMAKE_CURRENT_LIST_DIR}/../bundle/dir_utils.cpp
     ${CMAKE_CURRENT_LIST_DIR}/../bundle/extractor.cpp
     ${CMAKE_CURRENT_LIST_DIR}/../bundle/file_entry.cpp
@@ -32,6 +33,7 @@ list(APPEND HEADERS
     ${CMAKE_CURRENT_LIST_DIR}/deps_resolver.h
     ${CMAKE_CURRENT_LIST_DIR}/hostpolicy_context.h
     ${CMAKE_CURRENT_LIST_DIR}/hostpolicy_init.h
+    ${CMAKE_CURRENT_LIST_DIR}/startup_cache.h
     ${CMAKE_CURRENT_LIST_DIR}/../hostpolicy.h
     ${CMAKE_CURRENT_LIST_DIR}/../corehost_context_contract.h
     ${CMAKE_CURRENT_LIST_DIR}/../bundle/dir_utils.h
@@ -5,6 +5,7 @@
 #include "hostpolicy.h"
 
 #include "deps_resolver.h"
+#include "startup_cache.h"
 #include <error_codes.h>
 #include <trace.h>
 #include "bundle/runner.h"
@@ -44,6 +45,78 @@ namespace
         return bundle::runner_t::app()->probe(file_path, offset, size, compressedSize);
     }
 
+    // Resolves the dependencies of the app from its deps files and the frameworks' by probing for their assets.
+    // inputs receives the files and directories the resolution depends on if not null.
+    int resolve_dependencies(
+        const hostpolicy_init_t &hostpolicy_init,
+        const arguments_t &args,
+        std::unordered_set<pal::string_t> *breadcrumbs,
+        startup_cache_t::resolution_t *resolution,
+        std::vector<pal::string_t> *inputs)
+    {
+        deps_resolver_t resolver
+            {
+                args,
+                hostpolicy_init.fx_definitions,
+                /* root_framework_rid_fallback_graph */ nullptr, // This means that the fx_definitions contains the root framework
+                hostpolicy_init.is_framework_dependent
+            };
+
+        pal::string_t resolver_errors;
+        if (!resolver.valid(&resolver_errors))
+        {
+            trace::error(_X("Error initializing the dependency resolver: %s"), resolver_errors.c_str());
+            return StatusCode::ResolverInitFailure;
+        }
+
+        resolution->root_rid_fallback_graph = resolver.get_root_deps().get_rid_fallback_graph();
+
+        if (!resolver.resolve_probe_paths(&resolution->probe_paths, breadcrumbs))
+        {
+            return StatusCode::ResolverResolveFailure;
+        }
+
+        if (resolver.is_framework_dependent())
+        {
+            // Use the root fx to define FX_DEPS_FILE
+            resolution->fx_deps_file = resolver.get_root_deps().get_deps_file();
+        }
+
+        pal::string_t &app_context_deps_str = resolution->app_context_deps_files;
+        resolver.enum_app_context_deps_files([&](const pal::string_t& deps_file)
+        {
+            if (!app_context_deps_str.empty())
+                app_context_deps_str += _X(';');
+
+            // For the application's .deps.json if this is single file, 3.1 backward compat
+            // then the path used internally is the bundle path, but externally we need to report
+            // the path to the extraction folder.
+            if (app_context_deps_str.empty() && bundle::info_t::is_single_file_bundle() && bundle::runner_t::app()->is_netcoreapp3_compat_mode())
+            {
+                pal::string_t deps_path = bundle::runner_t::app()->extraction_path();
+                append_path(&deps_path, get_filename(deps_file).c_str());
+                app_context_deps_str += deps_path;
+            }
+            else
+            {
+                app_context_deps_str += deps_file;
+            }
+        });
+
+        resolver.get_app_dir(&resolution->app_base);
+        resolution->probe_directories = resolver.get_lookup_probe_directories();
+
+        if (inputs != nullptr)
+        {
+            resolver.enum_resolution_inputs([&](const pal::string_t& input)
+            {
+                inputs->push_back(input);
+            });
+        }
+
+        return StatusCode::Success;
+    }
+
 #if defined(NATIVE_LIBS_EMBEDDED)
     extern "C" const void* CompressionResolveDllImport(const char* name);
     extern "C" const void* SecurityResolveDllImport(const char* name);
@@ -112,27 +185,6 @@ int hostpolicy_context_t::initialize(hostpolicy_init_t &hostpolicy_init, const a
     host_path = args.host_path;
     breadcrumbs_enabled = enable_breadcrumbs;
 
-    deps_resolver_t resolver
-        {
-            args,
-            hostpolicy_init.fx_definitions,
-            /* root_framework_rid_fallback_graph */ nullptr, // This means that the fx_definitions contains the root framework
-            hostpolicy_init.is_framework_dependent
-        };
-
-    pal::string_t resolver_errors;
-    if (!resolver.valid(&resolver_errors))
-    {
-        trace::error(_X("Error initializing the dependency resolver: %s"), resolver_errors.c_str());
-        return StatusCode::ResolverInitFailure;
-    }
-
-    // Store the root framework's rid fallback graph so that we can
-    // use it for future dependency resolutions
-    hostpolicy_init.root_rid_fallback_graph = resolver.get_root_deps().get_rid_fallback_graph();
-
-    probe_paths_t probe_paths;
-
     // Setup breadcrumbs.
     if (breadcrumbs_enabled)
     {
@@ -142,20 +194,49 @@ int hostpolicy_context_t::initialize(hostpolicy_init_t &hostpolicy_init, const a
         // Always insert the hostpolicy that the code is running on.
         breadcrumbs.insert(policy_name);
         breadcrumbs.insert(policy_name + _X(",") + policy_version);
+    }
 
-        if (!resolver.resolve_probe_paths(&probe_paths, &breadcrumbs))
+    startup_cache_t::resolution_t resolution;
+    pal::string_t startup_cache_path;
+    if (!bundle::info_t::is_single_file_bundle() && startup_cache_t::get_cache_path(&startup_cache_path))
+    {
+        startup_cache_t startup_cache { args, hostpolicy_init.fx_definitions, breadcrumbs_enabled };
+        if (startup_cache.try_read(startup_cache_path, &resolution))
         {
-            return StatusCode::ResolverResolveFailure;
+            breadcrumbs.insert(resolution.breadcrumbs.begin(), resolution.breadcrumbs.end());
+        }
+        else
+        {
+            std::vector<pal::string_t> inputs;
+            int rc = resolve_dependencies(hostpolicy_init, args, breadcrumbs_enabled ? &breadcrumbs : nullptr, &resolution, &inputs);
+            if (rc != StatusCode::Success)
+            {
+                return rc;
+            }
+
+            if (breadcrumbs_enabled)
+            {
+                resolution.breadcrumbs = breadcrumbs;
+            }
+
+            startup_cache.write(startup_cache_path, resolution, inputs);
         }
     }
     else
     {
-        if (!resolver.resolve_probe_paths(&probe_paths, nullptr))
+        int rc = resolve_dependencies(hostpolicy_init, args, breadcrumbs_enabled ? &breadcrumbs : nullptr, &resolution, nullptr);
+        if (rc != StatusCode::Success)
         {
-            return StatusCode::ResolverResolveFailure;
+            return rc;
         }
     }
 
+    // Store the root framework's rid fallback graph so that we can
+    // use it for future dependency resolutions
+    hostpolicy_init.root_rid_fallback_graph = std::move(resolution.root_rid_fallback_graph);
+
+    probe_paths_t &probe_paths = resolution.probe_paths;
+
     clr_path = probe_paths.coreclr;
     if (clr_path.empty() || !pal::realpath(&clr_path))
     {
@@ -195,44 +276,15 @@ int hostpolicy_context_t::initialize(hostpolicy_init_t &hostpolicy_init, const a
         probe_paths.tpa.append(corelib_path);
     }
 
-    pal::string_t fx_deps_str;
-    if (resolver.is_framework_dependent())
-    {
-        // Use the root fx to define FX_DEPS_FILE
-        fx_deps_str = resolver.get_root_deps().get_deps_file();
-    }
-
-    pal::string_t app_context_deps_str;
-    resolver.enum_app_context_deps_files([&](const pal::string_t& deps_file)
-    {
-        if (!app_context_deps_str.empty())
-            app_context_deps_str += _X(';');
-
-        // For the application's .deps.json if this is single file, 3.1 backward compat
-        // then the path used internally is the bundle path, but externally we need to report
-        // the path to the extraction folder.
-        if (app_context_deps_str.empty() && bundle::info_t::is_single_file_bundle() && bundle::runner_t::app()->is_netcoreapp3_compat_mode())
-        {
-            pal::string_t deps_path = bundle::runner_t::app()->extraction_path();
-            append_path(&deps_path, get_filename(deps_file).c_str());
-            app_context_deps_str += deps_path;
-        }
-        else
-        {
-            app_context_deps_str += deps_file;
-        }
-    });
-
     // Build properties for CoreCLR instantiation
-    pal::string_t app_base;
-    resolver.get_app_dir(&app_base);
+    const pal::string_t &app_base = resolution.app_base;
     coreclr_properties.add(common_property::TrustedPlatformAssemblies, probe_paths.tpa.c_str());
     coreclr_properties.add(common_property::NativeDllSearchDirectories, probe_paths.native.c_str());
     coreclr_properties.add(common_property::PlatformResourceRoots, probe_paths.resources.c_str());
     coreclr_properties.add(common_property::AppContextBaseDirectory, app_base.c_str());
-    coreclr_properties.add(common_property::AppContextDepsFiles, app_context_deps_str.c_str());
-    coreclr_properties.add(common_property::FxDepsFile, fx_deps_str.c_str());
-    coreclr_properties.add(common_property::ProbingDirectories, resolver.get_lookup_probe_directories().c_str());
+    coreclr_properties.add(common_property::AppContextDepsFiles, resolution.app_context_deps_files.c_str());
+    coreclr_properties.add(common_property::FxDepsFile, resolution.fx_deps_file.c_str());
+    coreclr_properties.add(common_property::ProbingDirectories, resolution.probe_directories.c_str());
     coreclr_properties.add(common_property::RuntimeIdentifier, get_current_runtime_id(true /*use_fallback*/).c_str());
 
     bool set_app_paths = false;
@@ -0,0 +1,388 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+#include "startup_cache.h"
+#include <trace.h>
+#include <utils.h>
+
+namespace
+{
+    // The cache is only read by the host that wrote it, so values are stored in native byte order
+    // and strings as pal::char_t code units.
+    const uint32_t cache_signature = 0x43534844; // 'DHSC'
+    const uint32_t cache_version = 1;
+
+    // Stamp of an input that doesn't exist, so that creating it invalidates the cache.
+    const uint64_t missing_input_size = UINT64_MAX;
+
+    class cache_writer_t
+    {
+    public:
+        void write(uint32_t value)
+        {
+            append(&value, sizeof(value));
+        }
+
+        void write(uint64_t value)
+        {
+            append(&value, sizeof(value));
+        }
+
+        void write(const pal::string_t& value)
+        {
+            write(static_cast<uint32_t>(value.size()));
+            append(value.data(), value.size() * sizeof(pal::char_t));
+        }
+
+        void write(const std::vector<pal::string_t>& values)
+        {
+            write(static_cast<uint32_t>(values.size()));
+            for (const auto& value : values)
+            {
+                write(value);
+            }
+        }
+
+        const std::vector<char>& data() const
+        {
+            return m_data;
+        }
+
+    private:
+        void append(const void* data, size_t size)
+        {
+            const char* bytes = static_cast<const char*>(data);
+            m_data.insert(m_data.end(), bytes, bytes + size);
+        }
+
+        std::vector<char> m_data;
+    };
+
+    class cache_reader_t
+    {
+    public:
+        cache_reader_t(const char* data, size_t size)
+            : m_data(data)
+            , m_size(size)
+            , m_offset(0)
+        {
+        }
+
+        bool read(uint32_t* value)
+        {
+            return read_bytes(value, sizeof(*value));
+        }
+
+        bool read(uint64_t* value)
+        {
+            return read_bytes(value, sizeof(*value));
+        }
+
+        bool read(pal::string_t* value)
+        {
+            uint32_t length;
+            if (!read(&length) || length > (m_size - m_offset) / sizeof(pal::char_t))
+            {
+                return false;
+            }
+
+            value->resize(length);
+            return length == 0 || read_bytes(&(*value)[0], length * sizeof(pal::char_t));
+        }
+
+        bool read(std::vector<pal::string_t>* values)
+        {
+            uint32_t count;
+            if (!read(&count))
+            {
+                return false;
+            }
+
+            values->clear();
+            for (uint32_t i = 0; i < count; ++i)
+            {
+                pal::string_t value;
+                if (!read(&value))
+                {
+                    return false;
+                }
+
+                values->push_back(std::move(value));
+            }
+
+            return true;
+        }
+
+        bool at_end() const
+        {
+            return m_offset == m_size;
+        }
+
+    private:
+        bool read_bytes(void* value, size_t size)
+        {
+            if (size > m_size - m_offset)
+            {
+                return false;
+            }
+
+            memcpy(value, m_data + m_offset, size);
+            m_offset += size;
+            return true;
+        }
+
+        const char* m_data;
+        size_t m_size;
+        size_t m_offset;
+    };
+
+    void get_input_stamp(const pal::string_t& path, uint64_t* size, uint64_t* last_write_time)
+    {
+        if (!pal::get_file_stamp(path, size, last_write_time))
+        {
+            *size = missing_input_size;
+            *last_write_time = 0;
+        }
+    }
+
+    bool read_inputs_unchanged(cache_reader_t& reader)
+    {
+        uint32_t count;
+        if (!reader.read(&count))
+        {
+            return false;
+        }
+
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            pal::string_t path;
+            uint64_t size;
+            uint64_t last_write_time;
+            if (!reader.read(&path) || !reader.read(&size) || !reader.read(&last_write_time))
+            {
+                return false;
+            }
+
+            uint64_t current_size;
+            uint64_t current_last_write_time;
+            get_input_stamp(path, &current_size, &current_last_write_time);
+            if (current_size != size || current_last_write_time != last_write_time)
+            {
+                trace::verbose(_X("Startup cache input [%s] changed"), path.c_str());
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    bool read_resolution(cache_reader_t& reader, startup_cache_t::resolution_t* resolution)
+    {
+        if (!reader.read(&resolution->probe_paths.tpa)
+            || !reader.read(&resolution->probe_paths.native)
+            || !reader.read(&resolution->probe_paths.resources)
+            || !reader.read(&resolution->probe_paths.coreclr)
+            || !reader.read(&resolution->app_base)
+            || !reader.read(&resolution->fx_deps_file)
+            || !reader.read(&resolution->app_context_deps_files)
+            || !reader.read(&resolution->probe_directories))
+        {
+            return false;
+        }
+
+        std::vector<pal::string_t> breadcrumbs;
+        if (!reader.read(&breadcrumbs))
+        {
+            return false;
+        }
+
+        resolution->breadcrumbs.clear();
+        resolution->breadcrumbs.insert(breadcrumbs.begin(), breadcrumbs.end());
+
+        uint32_t rid_count;
+        if (!reader.read(&rid_count))
+        {
+            return false;
+        }
+
+        resolution->root_rid_fallback_graph.clear();
+        for (uint32_t i = 0; i < rid_count; ++i)
+        {
+            pal::string_t rid;
+            std::vector<pal::string_t> fallbacks;
+            if (!reader.read(&rid) || !reader.read(&fallbacks))
+            {
+                return false;
+            }
+
+            resolution->root_rid_fallback_graph.emplace(std::move(rid), std::move(fallbacks));
+        }
+
+        return reader.at_end();
+    }
+
+    bool write_file(const pal::string_t& path, const std::vector<char>& data)
+    {
+        FILE* file = pal::file_open(path, _X("wb"));
+        if (file == nullptr)
+        {
+            return false;
+        }
+
+        bool written = fwrite(data.data(), 1, data.size(), file) == data.size();
+        return (fclose(file) == 0) && written;
+    }
+}
+
+startup_cache_t::startup_cache_t(
+    const arguments_t& args,
+    const fx_definition_vector_t& fx_definitions,
+    bool breadcrumbs_enabled)
+{
+    m_configuration.push_back(_STRINGIFY(HOST_POLICY_PKG_VER));
+    m_configuration.push_back(pal::to_string(static_cast<int>(args.host_mode)));
+    m_configuration.push_back(args.managed_application);
+    m_configuration.push_back(args.app_root);
+    m_configuration.push_back(args.deps_path);
+    m_configuration.push_back(args.core_servicing);
+    m_configuration.push_back(args.additional_deps_serialized);
+    m_configuration.push_back(args.dotnet_shared_store);
+    m_configuration.push_back(get_current_runtime_id(true /*use_fallback*/));
+    m_configuration.push_back(breadcrumbs_enabled ? _X("breadcrumbs") : _X(""));
+
+    // Lists are prefixed with their length so that values can't move from one list to another.
+    auto push_back_list = [&](const std::vector<pal::string_t>& values)
+    {
+        m_configuration.push_back(pal::to_string(static_cast<int>(values.size())));
+        m_configuration.insert(m_configuration.end(), values.begin(), values.end());
+    };
+    push_back_list(args.probe_paths);
+    push_back_list(args.env_shared_store);
+    push_back_list(args.global_shared_stores);
+
+    m_configuration.push_back(pal::to_string(static_cast<int>(fx_definitions.size())));
+    for (const auto& fx : fx_definitions)
+    {
+        m_configuration.push_back(fx->get_name());
+        m_configuration.push_back(fx->get_found_version());
+        m_configuration.push_back(fx->get_dir());
+    }
+}
+
+bool startup_cache_t::get_cache_path(pal::string_t* recv)
+{
+    return pal::getenv(_X("DOTNET_HOST_STARTUP_CACHE"), recv) && !recv->empty();
+}
+
+bool startup_cache_t::try_read(const pal::string_t& cache_path, resolution_t* resolution) const
+{
+    if (!pal::file_exists(cache_path))
+    {
+        trace::verbose(_X("Startup cache [%s] not found"), cache_path.c_str());
+        return false;
+    }
+
+    size_t size;
+    const void* data = pal::mmap_read(cache_path, &size);
+    if (data == nullptr)
+    {
+        return false;
+    }
+
+    cache_reader_t reader(static_cast<const char*>(data), size);
+    uint32_t signature;
+    uint32_t version;
+    std::vector<pal::string_t> configuration;
+    bool valid = reader.read(&signature) && signature == cache_signature
+        && reader.read(&version) && version == cache_version
+        && reader.read(&configuration);
+
+    if (!valid)
+    {
+        trace::verbose(_X("Startup cache [%s] is not valid"), cache_path.c_str());
+    }
+    else if (configuration != m_configuration)
+    {
+        trace::verbose(_X("Startup cache [%s] was written for a different configuration"), cache_path.c_str());
+        valid = false;
+    }
+    else if (!read_inputs_unchanged(reader))
+    {
+        valid = false;
+    }
+    else if (!read_resolution(reader, resolution))
+    {
+        trace::verbose(_X("Startup cache [%s] is not valid"), cache_path.c_str());
+        valid = false;
+    }
+
+    pal::munmap(const_cast<void*>(data), size);
+
+    if (valid)
+    {
+        trace::info(_X("Using startup cache [%s]"), cache_path.c_str());
+    }
+
+    return valid;
+}
+
+void startup_cache_t::write(const pal::string_t& cache_path, const resolution_t& resolution, const std::vector<pal::string_t>& inputs) const
+{
+    cache_writer_t writer;
+    writer.write(cache_signature);
+    writer.write(cache_version);
+    writer.write(m_configuration);
+
+    // The inputs are stamped after the resolution, a change racing with it is only detected by the next write.
+    writer.write(static_cast<uint32_t>(inputs.size()));
+    for (const auto& input : inputs)
+    {
+        uint64_t size;
+        uint64_t last_write_time;
+        get_input_stamp(input, &size, &last_write_time);
+        writer.write(input);
+        writer.write(size);
+        writer.write(last_write_time);
+    }
+
+    writer.write(resolution.probe_paths.tpa);
+    writer.write(resolution.probe_paths.native);
+    writer.write(resolution.probe_paths.resources);
+    writer.write(resolution.probe_paths.coreclr);
+    writer.write(resolution.app_base);
+    writer.write(resolution.fx_deps_file);
+    writer.write(resolution.app_context_deps_files);
+    writer.write(resolution.probe_directories);
+    writer.write(std::vector<pal::string_t>(resolution.breadcrumbs.begin(), resolution.breadcrumbs.end()));
+    writer.write(static_cast<uint32_t>(resolution.root_rid_fallback_graph.size()));
+    for (const auto& rid : resolution.root_rid_fallback_graph)
+    {
+        writer.write(rid.first);
+        writer.write(rid.second);
+    }
+
+    // Write to a process specific file first so that concurrent launches never read a partial cache.
+    pal::char_t pid[32];
+    pal::snwprintf(pid, 32, _X("%x"), pal::get_pid());
+    pal::string_t temp_path = cache_path + _X(".") + pid + _X(".tmp");
+    if (!write_file(temp_path, writer.data()))
+    {
+        trace::verbose(_X("Failed to write startup cache [%s]"), temp_path.c_str());
+        pal::remove(temp_path.c_str());
+        return;
+    }
+
+    // Renaming over an existing file fails on Windows.
+    if (pal::rename(temp_path.c_str(), cache_path.c_str()) != 0)
+    {
+        pal::remove(cache_path.c_str());
+        if (pal::rename(temp_path.c_str(), cache_path.c_str()) != 0)
+        {
+            trace::verbose(_X("Failed to write startup cache [%s]"), cache_path.c_str());
+            pal::remove(temp_path.c_str());
+            return;
+        }
+    }
+
+    trace::info(_X("Wrote startup cache [%s]"), cache_path.c_str());
+}
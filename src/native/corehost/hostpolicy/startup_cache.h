@@ -0,0 +1,52 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+#ifndef __STARTUP_CACHE_H__
+#define __STARTUP_CACHE_H__
+
+#include <pal.h>
+#include "deps_resolver.h"
+
+// Resolved startup cache
+//
+// Stores the result of the dependency resolution (TPA, native search paths, probe results) so later
+// launches of the same app skip parsing the .deps.json files and probing for assets. It is opt-in,
+// enabled by setting DOTNET_HOST_STARTUP_CACHE to the path of the cache file.
+//
+// The cache is only used if it was written for the same host configuration (app, frameworks,
+// probe paths, additional deps, RID) and none of the deps files or probed directories changed
+// size or last write time since. Changes nested below a probed directory are not detected.
+class startup_cache_t
+{
+public:
+    struct resolution_t
+    {
+        probe_paths_t probe_paths;
+        pal::string_t app_base;
+        pal::string_t fx_deps_file;
+        pal::string_t app_context_deps_files;
+        pal::string_t probe_directories;
+        std::unordered_set<pal::string_t> breadcrumbs;
+        deps_json_t::rid_fallback_graph_t root_rid_fallback_graph;
+    };
+
+    startup_cache_t(
+        const arguments_t& args,
+        const fx_definition_vector_t& fx_definitions,
+        bool breadcrumbs_enabled);
+
+    // Returns false if the cache isn't enabled.
+    static bool get_cache_path(pal::string_t* recv);
+
+    // Returns false if the cache doesn't exist, is malformed or out of date.
+    bool try_read(const pal::string_t& cache_path, resolution_t* resolution) const;
+
+    // inputs are the files and directories to validate the cache against, see deps_resolver_t::enum_resolution_inputs.
+    void write(const pal::string_t& cache_path, const resolution_t& resolution, const std::vector<pal::string_t>& inputs) const;
+
+private:
+    // Everything the resolution depends on besides the inputs, the cache is only used if it matches exactly.
+    std::vector<pal::string_t> m_configuration;
+};
+
+#endif // __STARTUP_CACHE_H__
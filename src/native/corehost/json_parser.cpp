@@ -68,6 +68,38 @@ void get_line_column_from_offset(const char* data, uint64_t size, size_t offset,
 
 } // empty namespace
 
+bool json_parser_t::try_map_file(const pal::string_t& path)
+{
+    uint64_t file_size;
+    uint64_t last_write_time;
+    if (!pal::get_file_stamp(path, &file_size, &last_write_time))
+    {
+        return false;
+    }
+
+    // The parser reads up to a null terminator, which the mapping only provides if the file doesn't end
+    // on a page boundary: the rest of the last page is zero filled. Pages are multiples of 4KB everywhere.
+    if (file_size == 0 || file_size % 4096 == 0 || file_size > SIZE_MAX)
+    {
+        return false;
+    }
+
+#ifdef _WIN32
+    m_mapped_data = const_cast<void*>(pal::mmap_read(path, &m_mapped_size));
+#else // _WIN32
+    m_mapped_data = pal::mmap_copy_on_write(path, &m_mapped_size);
+#endif // _WIN32
+
+    // The file may have changed since its size was read.
+    if (m_mapped_data != nullptr && (m_mapped_size == 0 || m_mapped_size % 4096 == 0))
+    {
+        pal::munmap(m_mapped_data, m_mapped_size);
+        m_mapped_data = nullptr;
+    }
+
+    return m_mapped_data != nullptr;
+}
+
 void json_parser_t::realloc_buffer(size_t size)
 {
     m_json.resize(size + 1);
@@ -132,6 +164,21 @@ bool json_parser_t::parse_file(const pal::string_t& path)
         }
     }
 
+    if (try_map_file(path))
+    {
+        char* data = static_cast<char*>(m_mapped_data);
+        size_t size = m_mapped_size;
+
+        // Skip the UTF-8 BOM
+        if (size >= 3 && static_cast<unsigned char>(data[0]) == 0xEF && static_cast<unsigned char>(data[1]) == 0xBB && static_cast<unsigned char>(data[2]) == 0xBF)
+        {
+            data += 3;
+            size -= 3;
+        }
+
+        return parse_raw_data(data, size, path);
+    }
+
     pal::ifstream_t file{ path };
     if (!file.good())
     {
@@ -162,4 +209,9 @@ json_parser_t::~json_parser_t()
     {
         bundle::info_t::config_t::unmap(m_bundle_data, m_bundle_location);
     }
+
+    if (m_mapped_data != nullptr)
+    {
+        pal::munmap(m_mapped_data, m_mapped_size);
+    }
 }
@@ -31,7 +31,9 @@ class json_parser_t {
 
         json_parser_t()
             : m_bundle_data(nullptr)
-            , m_bundle_location(nullptr) {}
+            , m_bundle_location(nullptr)
+            , m_mapped_data(nullptr)
+            , m_mapped_size(0) {}
 
         ~json_parser_t();
 
@@ -47,6 +49,12 @@ class json_parser_t {
         char* m_bundle_data; // The memory mapped bytes of the application bundle.
         const bundle::location_t* m_bundle_location; // Location of this json file within the bundle.
 
+        // If a json file is parsed from disk, its memory mapped bytes. Except on Windows, the file is
+        // mapped copy-on-write for in-situ parsing and the strings of m_document point into it.
+        void* m_mapped_data;
+        size_t m_mapped_size;
+
+        bool try_map_file(const pal::string_t& path);
         void realloc_buffer(size_t size);
 };
 
@@ -1,10 +1,15 @@
 include(CheckSymbolExists)
+include(CheckIncludeFile)
 
 check_symbol_exists(
     accept4
     sys/socket.h
     HAVE_ACCEPT4)
 
+check_include_file(
+    linux/user_events.h
+    HAVE_LINUX_USER_EVENTS_H)
+
 if (NOT DEFINED EP_GENERATED_HEADER_PATH)
     message(FATAL_ERROR "Required configuration EP_GENERATED_HEADER_PATH not set.")
 endif (NOT DEFINED EP_GENERATED_HEADER_PATH)
@@ -27,7 +27,8 @@ struct _DiagnosticsGenerateCoreDumpCommandPayload_Internal {
 	// The protocol buffer is defined as:
 	//   string - dumpName (UTF16)
 	//   int - dumpType
-	//   uint32 - flags
+	//   uint32 - flags (GenerateDumpFlags*, 0x10 dumps a copy-on-write fork of the
+	//            process on Linux so the process only pauses for the fork)
 	// returns
 	//   ulong - status
 
@@ -46,11 +46,23 @@ eventpipe_collect_tracing_command_try_parse_rundown_requested (
 	uint32_t *buffer_len,
 	bool *rundown_requested);
 
+static
+bool
+eventpipe_collect_tracing_command_try_parse_event_filter (
+	uint8_t **buffer,
+	uint32_t *buffer_len,
+	EventPipeProviderEventFilter **result);
+
+static
+void
+eventpipe_collect_tracing_command_free_event_filter (EventPipeProviderEventFilter *event_filter);
+
 static
 bool
 eventpipe_collect_tracing_command_try_parse_config (
 	uint8_t **buffer,
 	uint32_t *buffer_len,
+	bool parse_event_filter,
 	ep_rt_provider_config_array_t *result);
 
 static
@@ -65,6 +77,18 @@ eventpipe_collect_tracing2_command_try_parse_payload (
 	uint8_t *buffer,
 	uint16_t buffer_len);
 
+static
+uint8_t *
+eventpipe_collect_tracing3_command_try_parse_payload (
+	uint8_t *buffer,
+	uint16_t buffer_len);
+
+static
+uint8_t *
+eventpipe_collect_tracing_shared_memory_command_try_parse_payload (
+	uint8_t *buffer,
+	uint16_t buffer_len);
+
 static
 bool
 eventpipe_protocol_helper_stop_tracing (
@@ -81,7 +105,8 @@ static
 bool
 eventpipe_protocol_helper_collect_tracing_2 (
 	DiagnosticsIpcMessage *message,
-	DiagnosticsIpcStream *stream);
+	DiagnosticsIpcStream *stream,
+	ds_ipc_parse_payload_func parse_func);
 
 static
 bool
@@ -143,11 +168,81 @@ eventpipe_collect_tracing_command_try_parse_rundown_requested (
 	return ds_ipc_message_try_parse_value (buffer, buffer_len, (uint8_t *)rundown_requested, 1);
 }
 
+static
+bool
+eventpipe_collect_tracing_command_try_parse_event_filter (
+	uint8_t **buffer,
+	uint32_t *buffer_len,
+	EventPipeProviderEventFilter **result)
+{
+	EP_ASSERT (buffer != NULL);
+	EP_ASSERT (buffer_len != NULL);
+	EP_ASSERT (result != NULL);
+
+	// Same arbitrary upper bound as the number of provider configs.
+	const uint32_t max_count_event_ids = 1000;
+
+	uint32_t enable = 0;
+	uint32_t event_ids_len = 0;
+	uint32_t sampling_rates_len = 0;
+	uint32_t *event_ids = NULL;
+	uint32_t *sampling_rates = NULL;
+	EventPipeProviderEventFilter *instance = NULL;
+
+	ep_raise_error_if_nok (ds_ipc_message_try_parse_uint32_t (buffer, buffer_len, &enable));
+
+	ep_raise_error_if_nok (ds_ipc_message_try_parse_uint32_t (buffer, buffer_len, &event_ids_len));
+	ep_raise_error_if_nok (event_ids_len <= max_count_event_ids);
+	if (event_ids_len > 0) {
+		event_ids = ep_rt_object_array_alloc (uint32_t, event_ids_len);
+		ep_raise_error_if_nok (event_ids != NULL);
+		for (uint32_t i = 0; i < event_ids_len; ++i)
+			ep_raise_error_if_nok (ds_ipc_message_try_parse_uint32_t (buffer, buffer_len, &event_ids [i]));
+	}
+
+	ep_raise_error_if_nok (ds_ipc_message_try_parse_uint32_t (buffer, buffer_len, &sampling_rates_len));
+	ep_raise_error_if_nok (sampling_rates_len <= max_count_event_ids);
+	if (sampling_rates_len > 0) {
+		sampling_rates = ep_rt_object_array_alloc (uint32_t, sampling_rates_len * 2);
+		ep_raise_error_if_nok (sampling_rates != NULL);
+		for (uint32_t i = 0; i < sampling_rates_len * 2; ++i)
+			ep_raise_error_if_nok (ds_ipc_message_try_parse_uint32_t (buffer, buffer_len, &sampling_rates [i]));
+		for (uint32_t i = 0; i < sampling_rates_len; ++i)
+			ep_raise_error_if_nok (sampling_rates [i * 2 + 1] > 0);
+	}
+
+	instance = ep_rt_object_alloc (EventPipeProviderEventFilter);
+	ep_raise_error_if_nok (instance != NULL);
+
+	*result = ep_provider_event_filter_init (instance, enable != 0, event_ids, event_ids_len, sampling_rates, sampling_rates_len);
+
+ep_on_exit:
+	return (*result != NULL);
+
+ep_on_error:
+	ep_rt_object_array_free (event_ids);
+	ep_rt_object_array_free (sampling_rates);
+	ep_rt_object_free (instance);
+	*result = NULL;
+	ep_exit_error_handler ();
+}
+
+static
+void
+eventpipe_collect_tracing_command_free_event_filter (EventPipeProviderEventFilter *event_filter)
+{
+	ep_return_void_if_nok (event_filter != NULL);
+	ep_rt_object_array_free ((uint32_t *)ep_provider_event_filter_get_event_ids (event_filter));
+	ep_rt_object_array_free ((uint32_t *)ep_provider_event_filter_get_sampling_rates (event_filter));
+	ep_rt_object_free (event_filter);
+}
+
 static
 bool
 eventpipe_collect_tracing_command_try_parse_config (
 	uint8_t **buffer,
 	uint32_t *buffer_len,
+	bool parse_event_filter,
 	ep_rt_provider_config_array_t *result)
 {
 	EP_ASSERT (buffer != NULL);
@@ -165,6 +260,7 @@ eventpipe_collect_tracing_command_try_parse_config (
 
 	ep_char8_t *provider_name_utf8 = NULL;
 	ep_char8_t *filter_data_utf8 = NULL;
+	EventPipeProviderEventFilter *event_filter = NULL;
 
 	ep_raise_error_if_nok (ds_ipc_message_try_parse_uint32_t (buffer, buffer_len, &count_configs));
 	ep_raise_error_if_nok (count_configs <= max_count_configs);
@@ -202,16 +298,21 @@ eventpipe_collect_tracing_command_try_parse_config (
 			filter_data_byte_array = NULL;
 		}
 
+		if (parse_event_filter)
+			ep_raise_error_if_nok (eventpipe_collect_tracing_command_try_parse_event_filter (buffer, buffer_len, &event_filter));
+
 		EventPipeProviderConfiguration provider_config;
 		if (ep_provider_config_init (&provider_config, provider_name_utf8, keywords, (EventPipeEventLevel)log_level, filter_data_utf8)) {
+			ep_provider_config_set_event_filter (&provider_config, event_filter);
 			if (ep_rt_provider_config_array_append (result, provider_config)) {
 				// Ownership transferred.
 				provider_name_utf8 = NULL;
 				filter_data_utf8 = NULL;
+				event_filter = NULL;
 			}
 			ep_provider_config_fini (&provider_config);
 		}
-		ep_raise_error_if_nok (provider_name_utf8 == NULL && filter_data_utf8 == NULL);
+		ep_raise_error_if_nok (provider_name_utf8 == NULL && filter_data_utf8 == NULL && event_filter == NULL);
 	}
 
 ep_on_exit:
@@ -223,6 +324,7 @@ ep_on_error:
 	ep_rt_utf8_string_free (provider_name_utf8);
 	ep_rt_byte_array_free (filter_data_byte_array);
 	ep_rt_utf8_string_free (filter_data_utf8);
+	eventpipe_collect_tracing_command_free_event_filter (event_filter);
 	ep_exit_error_handler ();
 }
 
@@ -244,7 +346,7 @@ eventpipe_collect_tracing_command_try_parse_payload (
 
 	if (!eventpipe_collect_tracing_command_try_parse_circular_buffer_size (&buffer_cursor, &buffer_cursor_len, &instance->circular_buffer_size_in_mb ) ||
 		!eventpipe_collect_tracing_command_try_parse_serialization_format (&buffer_cursor, &buffer_cursor_len, &instance->serialization_format) ||
-		!eventpipe_collect_tracing_command_try_parse_config (&buffer_cursor, &buffer_cursor_len, &instance->provider_configs))
+		!eventpipe_collect_tracing_command_try_parse_config (&buffer_cursor, &buffer_cursor_len, false, &instance->provider_configs))
 		ep_raise_error ();
 
 ep_on_exit:
@@ -273,6 +375,7 @@ ds_eventpipe_collect_tracing_command_payload_free (EventPipeCollectTracingComman
 	for (size_t i = 0; i < config_len; ++i) {
 		ep_rt_utf8_string_free ((ep_char8_t *)ep_provider_config_get_provider_name (&config [i]));
 		ep_rt_utf8_string_free ((ep_char8_t *)ep_provider_config_get_filter_data (&config [i]));
+		eventpipe_collect_tracing_command_free_event_filter ((EventPipeProviderEventFilter *)ep_provider_config_get_event_filter (&config [i]));
 	}
 
 	ep_rt_object_free (payload);
@@ -301,7 +404,71 @@ eventpipe_collect_tracing2_command_try_parse_payload (
 	if (!eventpipe_collect_tracing_command_try_parse_circular_buffer_size (&buffer_cursor, &buffer_cursor_len, &instance->circular_buffer_size_in_mb ) ||
 		!eventpipe_collect_tracing_command_try_parse_serialization_format (&buffer_cursor, &buffer_cursor_len, &instance->serialization_format) ||
 		!eventpipe_collect_tracing_command_try_parse_rundown_requested (&buffer_cursor, &buffer_cursor_len, &instance->rundown_requested) ||
-		!eventpipe_collect_tracing_command_try_parse_config (&buffer_cursor, &buffer_cursor_len, &instance->provider_configs))
+		!eventpipe_collect_tracing_command_try_parse_config (&buffer_cursor, &buffer_cursor_len, false, &instance->provider_configs))
+		ep_raise_error ();
+
+ep_on_exit:
+	return (uint8_t *)instance;
+
+ep_on_error:
+	ds_eventpipe_collect_tracing2_command_payload_free (instance);
+	instance = NULL;
+	ep_exit_error_handler ();
+}
+
+static
+uint8_t *
+eventpipe_collect_tracing3_command_try_parse_payload (
+	uint8_t *buffer,
+	uint16_t buffer_len)
+{
+	EP_ASSERT (buffer != NULL);
+
+	uint8_t * buffer_cursor = buffer;
+	uint32_t buffer_cursor_len = buffer_len;
+
+	EventPipeCollectTracing2CommandPayload *instance = ds_eventpipe_collect_tracing2_command_payload_alloc ();
+	ep_raise_error_if_nok (instance != NULL);
+
+	instance->incoming_buffer = buffer;
+
+	if (!eventpipe_collect_tracing_command_try_parse_circular_buffer_size (&buffer_cursor, &buffer_cursor_len, &instance->circular_buffer_size_in_mb ) ||
+		!eventpipe_collect_tracing_command_try_parse_serialization_format (&buffer_cursor, &buffer_cursor_len, &instance->serialization_format) ||
+		!eventpipe_collect_tracing_command_try_parse_rundown_requested (&buffer_cursor, &buffer_cursor_len, &instance->rundown_requested) ||
+		!eventpipe_collect_tracing_command_try_parse_config (&buffer_cursor, &buffer_cursor_len, true, &instance->provider_configs))
+		ep_raise_error ();
+
+ep_on_exit:
+	return (uint8_t *)instance;
+
+ep_on_error:
+	ds_eventpipe_collect_tracing2_command_payload_free (instance);
+	instance = NULL;
+	ep_exit_error_handler ();
+}
+
+static
+uint8_t *
+eventpipe_collect_tracing_shared_memory_command_try_parse_payload (
+	uint8_t *buffer,
+	uint16_t buffer_len)
+{
+	EP_ASSERT (buffer != NULL);
+
+	uint8_t * buffer_cursor = buffer;
+	uint32_t buffer_cursor_len = buffer_len;
+
+	EventPipeCollectTracing2CommandPayload *instance = ds_eventpipe_collect_tracing2_command_payload_alloc ();
+	ep_raise_error_if_nok (instance != NULL);
+
+	instance->incoming_buffer = buffer;
+
+	if (!eventpipe_collect_tracing_command_try_parse_circular_buffer_size (&buffer_cursor, &buffer_cursor_len, &instance->circular_buffer_size_in_mb ) ||
+		!eventpipe_collect_tracing_command_try_parse_serialization_format (&buffer_cursor, &buffer_cursor_len, &instance->serialization_format) ||
+		!eventpipe_collect_tracing_command_try_parse_rundown_requested (&buffer_cursor, &buffer_cursor_len, &instance->rundown_requested) ||
+		!eventpipe_collect_tracing_command_try_parse_config (&buffer_cursor, &buffer_cursor_len, false, &instance->provider_configs) ||
+		!ds_ipc_message_try_parse_uint32_t (&buffer_cursor, &buffer_cursor_len, &instance->shared_memory_ring_size_in_mb) ||
+		instance->shared_memory_ring_size_in_mb == 0)
 		ep_raise_error ();
 
 ep_on_exit:
@@ -330,6 +497,7 @@ ds_eventpipe_collect_tracing2_command_payload_free (EventPipeCollectTracing2Comm
 	for (size_t i = 0; i < config_len; ++i) {
 		ep_rt_utf8_string_free ((ep_char8_t *)ep_provider_config_get_provider_name (&config [i]));
 		ep_rt_utf8_string_free ((ep_char8_t *)ep_provider_config_get_filter_data (&config [i]));
+		eventpipe_collect_tracing_command_free_event_filter ((EventPipeProviderEventFilter *)ep_provider_config_get_event_filter (&config [i]));
 	}
 
 	ep_rt_object_free (payload);
@@ -465,13 +633,14 @@ static
 bool
 eventpipe_protocol_helper_collect_tracing_2 (
 	DiagnosticsIpcMessage *message,
-	DiagnosticsIpcStream *stream)
+	DiagnosticsIpcStream *stream,
+	ds_ipc_parse_payload_func parse_func)
 {
 	ep_return_false_if_nok (message != NULL && stream != NULL);
 
 	bool result = false;
 	EventPipeCollectTracing2CommandPayload *payload;
-	payload = (EventPipeCollectTracing2CommandPayload *)ds_ipc_message_try_parse_payload (message, eventpipe_collect_tracing2_command_try_parse_payload);
+	payload = (EventPipeCollectTracing2CommandPayload *)ds_ipc_message_try_parse_payload (message, parse_func);
 
 	if (!payload) {
 		ds_ipc_message_send_error (stream, DS_IPC_E_BAD_ENCODING);
@@ -511,6 +680,74 @@ ep_on_error:
 	ep_exit_error_handler ();
 }
 
+static
+bool
+eventpipe_protocol_helper_collect_tracing_shared_memory (
+	DiagnosticsIpcMessage *message,
+	DiagnosticsIpcStream *stream)
+{
+	ep_return_false_if_nok (message != NULL && stream != NULL);
+
+	bool result = false;
+	DiagnosticsIpcSharedMemoryStream *shared_memory_stream = NULL;
+	EventPipeCollectTracing2CommandPayload *payload;
+	payload = (EventPipeCollectTracing2CommandPayload *)ds_ipc_message_try_parse_payload (message, eventpipe_collect_tracing_shared_memory_command_try_parse_payload);
+
+	if (!payload || payload->shared_memory_ring_size_in_mb > 1024) {
+		ds_ipc_message_send_error (stream, DS_IPC_E_BAD_ENCODING);
+		ep_raise_error ();
+	}
+
+	// Same session as CollectTracing2, but the nettrace stream goes through a ring buffer mapped by the
+	// client instead of the socket. The socket stays open to detect the client going away.
+	shared_memory_stream = ds_ipc_shared_memory_stream_alloc (stream, payload->shared_memory_ring_size_in_mb * 1024 * 1024, NULL);
+	if (!shared_memory_stream) {
+		ds_ipc_message_send_error (stream, DS_IPC_E_NOTSUPPORTED);
+		ep_raise_error ();
+	}
+
+	EventPipeSessionID session_id;
+	session_id = ep_enable (
+		NULL,
+		payload->circular_buffer_size_in_mb,
+		ep_rt_provider_config_array_data (&payload->provider_configs),
+		(uint32_t)ep_rt_provider_config_array_size (&payload->provider_configs),
+		EP_SESSION_TYPE_IPCSTREAM,
+		payload->serialization_format,
+		payload->rundown_requested,
+		ds_ipc_shared_memory_stream_get_stream_ref (shared_memory_stream),
+		NULL,
+		NULL);
+
+	if (session_id == 0) {
+		ds_ipc_message_send_error (stream, DS_IPC_E_FAIL);
+		ds_ipc_shared_memory_stream_free (shared_memory_stream);
+		shared_memory_stream = NULL;
+		stream = NULL;
+		ep_raise_error ();
+	}
+
+	// The session owns the shared memory stream, and through it stream, from here on.
+	if (!eventpipe_protocol_helper_send_start_tracing_success (stream, session_id) || !ds_ipc_shared_memory_stream_send_handle (shared_memory_stream)) {
+		ep_disable (session_id);
+		stream = NULL;
+		ep_raise_error ();
+	}
+
+	ep_start_streaming (session_id);
+
+	result = true;
+
+ep_on_exit:
+	ds_eventpipe_collect_tracing2_command_payload_free (payload);
+	return result;
+
+ep_on_error:
+	EP_ASSERT (!result);
+	ds_ipc_stream_free (stream);
+	ep_exit_error_handler ();
+}
+
 static
 bool
 eventpipe_protocol_helper_unknown_command (
@@ -544,7 +781,13 @@ ds_eventpipe_protocol_helper_handle_ipc_message (
 		result = eventpipe_protocol_helper_collect_tracing (message, stream);
 		break;
 	case EP_COMMANDID_COLLECT_TRACING_2:
-		result = eventpipe_protocol_helper_collect_tracing_2 (message, stream);
+		result = eventpipe_protocol_helper_collect_tracing_2 (message, stream, eventpipe_collect_tracing2_command_try_parse_payload);
+		break;
+	case EP_COMMANDID_COLLECT_TRACING_3:
+		result = eventpipe_protocol_helper_collect_tracing_2 (message, stream, eventpipe_collect_tracing3_command_try_parse_payload);
+		break;
+	case EP_COMMANDID_COLLECT_TRACING_SHARED_MEMORY:
+		result = eventpipe_protocol_helper_collect_tracing_shared_memory (message, stream);
 		break;
 	case EP_COMMANDID_STOP_TRACING:
 		result = eventpipe_protocol_helper_stop_tracing (message, stream);
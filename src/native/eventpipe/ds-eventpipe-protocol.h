@@ -68,12 +68,22 @@ struct _EventPipeCollectTracing2CommandPayload_Internal {
 	// array<T> = uint length, length # of Ts
 	// string = (array<char> where the last char must = 0) or (length = 0)
 	// provider_config = ulong keywords, uint logLevel, string provider_name, string filter_data
+	//
+	// Command = 0x0204 (CollectTracing3) appends event_filter to every provider_config:
+	// event_filter = uint enable, array<uint> eventIds, array<sampling_rate> samplingRates
+	// sampling_rate = uint eventId, uint rate
+	// With enable != 0 only the listed event ids are enabled, otherwise the listed ids are disabled.
+	// Only every rate-th write of a sampled event is recorded.
+	//
+	// Command = 0x0210 (CollectTracingSharedMemory) appends uint sharedMemoryRingMB to the message. The
+	// response is followed by the ring buffer file descriptor passed as SCM_RIGHTS ancillary data.
 
 	uint8_t *incoming_buffer;
 	ep_rt_provider_config_array_t provider_configs;
 	uint32_t circular_buffer_size_in_mb;
 	EventPipeSerializationFormat serialization_format;
 	bool rundown_requested;
+	uint32_t shared_memory_ring_size_in_mb;
 };
 
 #if !defined(DS_INLINE_GETTER_SETTER) && !defined(DS_IMPL_EVENTPIPE_PROTOCOL_GETTER_SETTER)
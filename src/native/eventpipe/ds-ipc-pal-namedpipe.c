@@ -903,6 +903,40 @@ ds_ipc_stream_to_string (
 	int32_t result = sprintf_s (buffer, buffer_len, "{ _hPipe = %d, _oOverlap.hEvent = %d }", (int32_t)(size_t)ipc_stream->pipe, (int32_t)(size_t)ipc_stream->overlap.hEvent);
 	return (result > 0 && result < (int32_t)buffer_len) ? result : 0;
 }
+
+/*
+ * DiagnosticsIpcSharedMemoryStream.
+ */
+
+DiagnosticsIpcSharedMemoryStream *
+ds_ipc_shared_memory_stream_alloc (
+	DiagnosticsIpcStream *ipc_stream,
+	uint32_t ring_size,
+	ds_ipc_error_callback_func callback)
+{
+	// Not supported over named pipes.
+	return NULL;
+}
+
+void
+ds_ipc_shared_memory_stream_free (DiagnosticsIpcSharedMemoryStream *shared_memory_stream)
+{
+	EP_ASSERT (shared_memory_stream == NULL);
+}
+
+IpcStream *
+ds_ipc_shared_memory_stream_get_stream_ref (DiagnosticsIpcSharedMemoryStream *shared_memory_stream)
+{
+	EP_ASSERT (shared_memory_stream == NULL);
+	return NULL;
+}
+
+bool
+ds_ipc_shared_memory_stream_send_handle (DiagnosticsIpcSharedMemoryStream *shared_memory_stream)
+{
+	EP_ASSERT (shared_memory_stream == NULL);
+	return false;
+}
 #endif /* HOST_WIN32 */
 #endif /* ENABLE_PERFTRACING */
 
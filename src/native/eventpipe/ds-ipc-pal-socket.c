@@ -42,6 +42,14 @@
 #include <netinet/tcp.h>
 #include <netdb.h>
 #endif
+
+#ifdef DS_IPC_PAL_AF_UNIX
+#include <sys/mman.h>
+#include <sys/uio.h>
+#ifdef __linux__
+#include <sys/syscall.h>
+#endif
+#endif
 #endif
 
 #ifdef HOST_WIN32
@@ -211,6 +219,46 @@ static
 bool
 ipc_stream_close_func (void *object);
 
+#if defined(DS_IPC_PAL_AF_UNIX) && !defined(HOST_WIN32)
+static
+int
+shared_memory_stream_create_fd (size_t size);
+
+static
+bool
+shared_memory_stream_client_disconnected (DiagnosticsIpcSharedMemoryStream *shared_memory_stream);
+
+static
+void
+shared_memory_stream_free_func (void *object);
+
+static
+bool
+shared_memory_stream_read_func (
+	void *object,
+	uint8_t *buffer,
+	uint32_t bytes_to_read,
+	uint32_t *bytes_read,
+	uint32_t timeout_ms);
+
+static
+bool
+shared_memory_stream_write_func (
+	void *object,
+	const uint8_t *buffer,
+	uint32_t bytes_to_write,
+	uint32_t *bytes_written,
+	uint32_t timeout_ms);
+
+static
+bool
+shared_memory_stream_flush_func (void *object);
+
+static
+bool
+shared_memory_stream_close_func (void *object);
+#endif
+
 static
 DiagnosticsIpcStream *
 ipc_stream_alloc (
@@ -1584,6 +1632,362 @@ ds_ipc_stream_to_string (
 	return (result > 0 && result < (int32_t)buffer_len) ? result : 0;
 }
 
+/*
+ * DiagnosticsIpcSharedMemoryStream.
+ */
+
+#if defined(DS_IPC_PAL_AF_UNIX) && !defined(HOST_WIN32)
+#define DS_IPC_SHARED_MEMORY_MAGIC 0x524D5344 // "DSMR"
+#define DS_IPC_SHARED_MEMORY_VERSION 1
+#define DS_IPC_SHARED_MEMORY_MAX_RING_SIZE (1024 * 1024 * 1024)
+#define DS_IPC_SHARED_MEMORY_POLL_INTERVAL_MS 1
+
+// Layout of the start of the shared mapping, the ring data follows at header_size. Positions count
+// bytes written/read since the start of the session; the ring offset is position & (data_size - 1).
+// The runtime only writes write_position, the client only writes read_position.
+typedef struct _DiagnosticsIpcSharedMemoryHeader {
+	uint32_t magic;
+	uint32_t version;
+	uint32_t header_size;
+	uint32_t data_size;
+	uint8_t padding0 [48];
+	uint64_t write_position;
+	uint8_t padding1 [56];
+	uint64_t read_position;
+	uint8_t padding2 [56];
+	// Set when the session ends, no more data will be written.
+	uint32_t writer_closed;
+} DiagnosticsIpcSharedMemoryHeader;
+
+static
+int
+shared_memory_stream_create_fd (size_t size)
+{
+	int fd = -1;
+
+#ifdef __linux__
+#ifdef SYS_memfd_create
+	do {
+		fd = (int)syscall (SYS_memfd_create, "dotnet-diagnostic-ring", 1U /* MFD_CLOEXEC */);
+	} while (ipc_retry_syscall (fd));
+#endif
+#else
+	// Anonymous shared memory object, only reachable through the fd passed to the client.
+	static volatile uint32_t shared_memory_id = 0;
+	ep_char8_t name [64];
+	snprintf (name, sizeof (name), "/dotnet-diagnostic-%d-%u", (int)getpid (), (uint32_t)__atomic_add_fetch (&shared_memory_id, 1, __ATOMIC_RELAXED));
+	fd = shm_open (name, O_RDWR | O_CREAT | O_EXCL, S_IRUSR | S_IWUSR);
+	if (fd != -1) {
+		shm_unlink (name);
+		fcntl (fd, F_SETFD, FD_CLOEXEC);
+	}
+#endif
+
+	if (fd != -1 && ftruncate (fd, (off_t)size) == -1) {
+		close (fd);
+		fd = -1;
+	}
+
+	return fd;
+}
+
+static
+bool
+shared_memory_stream_client_disconnected (DiagnosticsIpcSharedMemoryStream *shared_memory_stream)
+{
+	ds_ipc_pollfd_t pfd;
+	pfd.fd = shared_memory_stream->ipc_stream->client_socket;
+	pfd.events = POLLIN;
+	pfd.revents = 0;
+
+	// Waits out the poll interval, the client isn't expected to send anything so readable means closed.
+	int result_poll = ipc_poll_fds (&pfd, 1, DS_IPC_SHARED_MEMORY_POLL_INTERVAL_MS);
+	if (result_poll < 0 || (pfd.revents & (POLLHUP | POLLERR | POLLNVAL)))
+		return true;
+
+	if (pfd.revents & POLLIN) {
+		uint8_t byte;
+		ssize_t result_recv;
+		do {
+			result_recv = recv (pfd.fd, &byte, sizeof (byte), MSG_PEEK | MSG_DONTWAIT);
+		} while (ipc_retry_syscall (result_recv));
+		if (result_recv == 0)
+			return true;
+		if (result_recv > 0) {
+			// Not part of the protocol, drop it so the next wait doesn't return immediately.
+			do {
+				result_recv = recv (pfd.fd, &byte, sizeof (byte), MSG_DONTWAIT);
+			} while (ipc_retry_syscall (result_recv));
+		}
+	}
+
+	return false;
+}
+
+static
+void
+shared_memory_stream_free_func (void *object)
+{
+	EP_ASSERT (object != NULL);
+	ds_ipc_shared_memory_stream_free ((DiagnosticsIpcSharedMemoryStream *)object);
+}
+
+static
+bool
+shared_memory_stream_read_func (
+	void *object,
+	uint8_t *buffer,
+	uint32_t bytes_to_read,
+	uint32_t *bytes_read,
+	uint32_t timeout_ms)
+{
+	EP_ASSERT (bytes_read != NULL);
+
+	// Write only, the client reads the ring directly.
+	*bytes_read = 0;
+	return false;
+}
+
+static
+bool
+shared_memory_stream_write_func (
+	void *object,
+	const uint8_t *buffer,
+	uint32_t bytes_to_write,
+	uint32_t *bytes_written,
+	uint32_t timeout_ms)
+{
+	EP_ASSERT (object != NULL);
+	EP_ASSERT (buffer != NULL);
+	EP_ASSERT (bytes_written != NULL);
+
+	DiagnosticsIpcSharedMemoryStream *shared_memory_stream = (DiagnosticsIpcSharedMemoryStream *)object;
+	DiagnosticsIpcSharedMemoryHeader *header = (DiagnosticsIpcSharedMemoryHeader *)shared_memory_stream->mapping;
+	uint8_t *data = shared_memory_stream->mapping + header->header_size;
+	uint32_t data_size = header->data_size;
+
+	uint32_t total_bytes_written = 0;
+	uint32_t waited_ms = 0;
+	bool success = shared_memory_stream->ipc_stream->client_socket != DS_IPC_INVALID_SOCKET;
+
+	while (success && total_bytes_written < bytes_to_write) {
+		uint64_t write_position = header->write_position;
+		uint64_t read_position = __atomic_load_n (&header->read_position, __ATOMIC_ACQUIRE);
+		uint32_t available = data_size - (uint32_t)(write_position - read_position);
+
+		if (available == 0) {
+			// Ring is full, wait for the client to catch up unless it went away.
+			if (shared_memory_stream_client_disconnected (shared_memory_stream))
+				success = false;
+
+			waited_ms += DS_IPC_SHARED_MEMORY_POLL_INTERVAL_MS;
+			if (timeout_ms != DS_IPC_TIMEOUT_INFINITE && waited_ms > timeout_ms)
+				success = false;
+
+			continue;
+		}
+
+		uint32_t offset = (uint32_t)write_position & (data_size - 1);
+		uint32_t chunk = bytes_to_write - total_bytes_written;
+		if (chunk > available)
+			chunk = available;
+		if (chunk > data_size - offset)
+			chunk = data_size - offset;
+
+		memcpy (data + offset, buffer + total_bytes_written, chunk);
+		__atomic_store_n (&header->write_position, write_position + chunk, __ATOMIC_RELEASE);
+
+		total_bytes_written += chunk;
+		waited_ms = 0;
+	}
+
+	*bytes_written = total_bytes_written;
+	return success;
+}
+
+static
+bool
+shared_memory_stream_flush_func (void *object)
+{
+	// Data is visible to the client as soon as write_position is published.
+	return true;
+}
+
+static
+bool
+shared_memory_stream_close_func (void *object)
+{
+	EP_ASSERT (object != NULL);
+	DiagnosticsIpcSharedMemoryStream *shared_memory_stream = (DiagnosticsIpcSharedMemoryStream *)object;
+
+	if (shared_memory_stream->mapping)
+		__atomic_store_n (&((DiagnosticsIpcSharedMemoryHeader *)shared_memory_stream->mapping)->writer_closed, 1, __ATOMIC_RELEASE);
+
+	return ds_ipc_stream_close (shared_memory_stream->ipc_stream, NULL);
+}
+
+static IpcStreamVtable shared_memory_stream_vtable = {
+	shared_memory_stream_free_func,
+	shared_memory_stream_read_func,
+	shared_memory_stream_write_func,
+	shared_memory_stream_flush_func,
+	shared_memory_stream_close_func };
+
+DiagnosticsIpcSharedMemoryStream *
+ds_ipc_shared_memory_stream_alloc (
+	DiagnosticsIpcStream *ipc_stream,
+	uint32_t ring_size,
+	ds_ipc_error_callback_func callback)
+{
+	EP_ASSERT (ipc_stream != NULL);
+
+	DiagnosticsIpcSharedMemoryStream *instance = NULL;
+	DiagnosticsIpcSharedMemoryHeader *header = NULL;
+	void *mapping = MAP_FAILED;
+	size_t header_size = 0;
+	size_t mapping_size = 0;
+	uint32_t data_size = 1;
+	int fd = -1;
+
+	// Ring offsets are masked, round the size up to a power of two.
+	ep_raise_error_if_nok (ring_size != 0 && ring_size <= DS_IPC_SHARED_MEMORY_MAX_RING_SIZE);
+	while (data_size < ring_size)
+		data_size <<= 1;
+
+	header_size = (size_t)sysconf (_SC_PAGESIZE);
+	if (header_size < sizeof (DiagnosticsIpcSharedMemoryHeader))
+		header_size = sizeof (DiagnosticsIpcSharedMemoryHeader);
+
+	mapping_size = header_size + data_size;
+
+	fd = shared_memory_stream_create_fd (mapping_size);
+	ep_raise_error_if_nok (fd != -1);
+
+	mapping = mmap (NULL, mapping_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	ep_raise_error_if_nok (mapping != MAP_FAILED);
+
+	header = (DiagnosticsIpcSharedMemoryHeader *)mapping;
+	header->header_size = (uint32_t)header_size;
+	header->data_size = data_size;
+	header->version = DS_IPC_SHARED_MEMORY_VERSION;
+	__atomic_store_n (&header->magic, DS_IPC_SHARED_MEMORY_MAGIC, __ATOMIC_RELEASE);
+
+	instance = ep_rt_object_alloc (DiagnosticsIpcSharedMemoryStream);
+	ep_raise_error_if_nok (instance != NULL);
+
+	instance->stream.vtable = &shared_memory_stream_vtable;
+	instance->ipc_stream = ipc_stream;
+	instance->mapping = (uint8_t *)mapping;
+	instance->mapping_size = mapping_size;
+	instance->fd = fd;
+
+ep_on_exit:
+	return instance;
+
+ep_on_error:
+	if (callback)
+		callback (strerror (ipc_get_last_error ()), ipc_get_last_error ());
+	if (mapping != MAP_FAILED)
+		munmap (mapping, mapping_size);
+	if (fd != -1)
+		close (fd);
+	ep_rt_object_free (instance);
+	instance = NULL;
+	ep_exit_error_handler ();
+}
+
+void
+ds_ipc_shared_memory_stream_free (DiagnosticsIpcSharedMemoryStream *shared_memory_stream)
+{
+	if (!shared_memory_stream)
+		return;
+
+	shared_memory_stream_close_func (shared_memory_stream);
+	ds_ipc_stream_free (shared_memory_stream->ipc_stream);
+
+	munmap (shared_memory_stream->mapping, shared_memory_stream->mapping_size);
+	close (shared_memory_stream->fd);
+
+	ep_rt_object_free (shared_memory_stream);
+}
+
+IpcStream *
+ds_ipc_shared_memory_stream_get_stream_ref (DiagnosticsIpcSharedMemoryStream *shared_memory_stream)
+{
+	return &shared_memory_stream->stream;
+}
+
+bool
+ds_ipc_shared_memory_stream_send_handle (DiagnosticsIpcSharedMemoryStream *shared_memory_stream)
+{
+	EP_ASSERT (shared_memory_stream != NULL);
+
+	union {
+		struct cmsghdr header;
+		uint8_t buffer [CMSG_SPACE (sizeof (int))];
+	} control;
+	memset (&control, 0, sizeof (control));
+
+	// Ancillary data needs at least one byte of regular data to travel with.
+	uint8_t payload = 0;
+	struct iovec iov;
+	iov.iov_base = &payload;
+	iov.iov_len = sizeof (payload);
+
+	struct msghdr message;
+	memset (&message, 0, sizeof (message));
+	message.msg_iov = &iov;
+	message.msg_iovlen = 1;
+	message.msg_control = control.buffer;
+	message.msg_controllen = sizeof (control.buffer);
+
+	struct cmsghdr *control_message = CMSG_FIRSTHDR (&message);
+	control_message->cmsg_level = SOL_SOCKET;
+	control_message->cmsg_type = SCM_RIGHTS;
+	control_message->cmsg_len = CMSG_LEN (sizeof (int));
+	memcpy (CMSG_DATA (control_message), &shared_memory_stream->fd, sizeof (int));
+
+	ssize_t result_send;
+	DS_ENTER_BLOCKING_PAL_SECTION;
+	do {
+		result_send = sendmsg (shared_memory_stream->ipc_stream->client_socket, &message, 0);
+	} while (ipc_retry_syscall (result_send));
+	DS_EXIT_BLOCKING_PAL_SECTION;
+
+	return result_send == (ssize_t)sizeof (payload);
+}
+#else
+DiagnosticsIpcSharedMemoryStream *
+ds_ipc_shared_memory_stream_alloc (
+	DiagnosticsIpcStream *ipc_stream,
+	uint32_t ring_size,
+	ds_ipc_error_callback_func callback)
+{
+	// File descriptors can only be passed over Unix domain sockets.
+	return NULL;
+}
+
+void
+ds_ipc_shared_memory_stream_free (DiagnosticsIpcSharedMemoryStream *shared_memory_stream)
+{
+	EP_ASSERT (shared_memory_stream == NULL);
+}
+
+IpcStream *
+ds_ipc_shared_memory_stream_get_stream_ref (DiagnosticsIpcSharedMemoryStream *shared_memory_stream)
+{
+	EP_ASSERT (shared_memory_stream == NULL);
+	return NULL;
+}
+
+bool
+ds_ipc_shared_memory_stream_send_handle (DiagnosticsIpcSharedMemoryStream *shared_memory_stream)
+{
+	EP_ASSERT (shared_memory_stream == NULL);
+	return false;
+}
+#endif /* defined(DS_IPC_PAL_AF_UNIX) && !defined(HOST_WIN32) */
+
 #endif /* ENABLE_PERFTRACING */
 
 #ifndef DS_INCLUDE_SOURCE_FILES
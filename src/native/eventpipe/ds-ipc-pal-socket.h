@@ -71,5 +71,27 @@ struct _DiagnosticsIpcStream {
 };
 #endif
 
+/*
+ * DiagnosticsIpcSharedMemoryStream.
+ */
+
+#if defined(DS_INLINE_GETTER_SETTER) || defined(DS_IMPL_IPC_PAL_SOCKET_GETTER_SETTER)
+struct _DiagnosticsIpcSharedMemoryStream {
+#else
+struct _DiagnosticsIpcSharedMemoryStream_Internal {
+#endif
+	IpcStream stream;
+	DiagnosticsIpcStream *ipc_stream;
+	uint8_t *mapping;
+	size_t mapping_size;
+	int fd;
+};
+
+#if !defined(DS_INLINE_GETTER_SETTER) && !defined(DS_IMPL_IPC_PAL_SOCKET_GETTER_SETTER)
+struct _DiagnosticsIpcSharedMemoryStream {
+	uint8_t _internal [sizeof (struct _DiagnosticsIpcSharedMemoryStream_Internal)];
+};
+#endif
+
 #endif /* ENABLE_PERFTRACING */
 #endif /* __DIAGNOSTICS_IPC_PAL_SOCKET_H__ */
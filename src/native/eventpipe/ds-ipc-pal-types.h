@@ -17,6 +17,7 @@
 typedef struct _DiagnosticsIpc DiagnosticsIpc;
 typedef struct _DiagnosticsIpcPollHandle DiagnosticsIpcPollHandle;
 typedef struct _DiagnosticsIpcStream DiagnosticsIpcStream;
+typedef struct _DiagnosticsIpcSharedMemoryStream DiagnosticsIpcSharedMemoryStream;
 
 /*
  * Diagnostics IPC PAL Enums.
@@ -132,5 +132,27 @@ ds_ipc_stream_to_string (
 	ep_char8_t *buffer,
 	uint32_t buffer_len);
 
+/*
+ * DiagnosticsIpcSharedMemoryStream.
+ */
+
+// Stream writing into a ring buffer shared with the client connected on ipc_stream. Takes ownership
+// of ipc_stream on success, returns NULL if the transport can't share memory with the client.
+DiagnosticsIpcSharedMemoryStream *
+ds_ipc_shared_memory_stream_alloc (
+	DiagnosticsIpcStream *ipc_stream,
+	uint32_t ring_size,
+	ds_ipc_error_callback_func callback);
+
+void
+ds_ipc_shared_memory_stream_free (DiagnosticsIpcSharedMemoryStream *shared_memory_stream);
+
+IpcStream *
+ds_ipc_shared_memory_stream_get_stream_ref (DiagnosticsIpcSharedMemoryStream *shared_memory_stream);
+
+// Passes the ring buffer handle to the client over the IPC connection.
+bool
+ds_ipc_shared_memory_stream_send_handle (DiagnosticsIpcSharedMemoryStream *shared_memory_stream);
+
 #endif /* ENABLE_PERFTRACING */
 #endif /* __DIAGNOSTICS_IPC_PAL_H__ */
@@ -97,6 +97,9 @@ typedef enum {
 	EP_COMMANDID_STOP_TRACING = 0x01,
 	EP_COMMANDID_COLLECT_TRACING  = 0x02,
 	EP_COMMANDID_COLLECT_TRACING_2 = 0x03,
+	EP_COMMANDID_COLLECT_TRACING_3 = 0x04,
+	// Kept apart from the sequential ids so it can't collide with newer CollectTracing versions.
+	EP_COMMANDID_COLLECT_TRACING_SHARED_MEMORY = 0x10,
 	// future
 } EventPipeCommandId;
 
@@ -27,6 +27,14 @@ block_fast_serialize_func (
 	void *object,
 	FastSerializer *fast_serializer);
 
+static
+uint32_t
+block_compress (
+	const uint8_t *source,
+	uint32_t source_len,
+	uint8_t *dest,
+	uint32_t *hash_table);
+
 static
 void
 block_clear_func (void *object);
@@ -129,6 +137,132 @@ stack_block_serialize_header_func (void *object, FastSerializer *fast_serializer
  * EventPipeBlock
  */
 
+// LZ4 block format, see https://github.com/lz4/lz4/blob/dev/doc/lz4_Block_format.md.
+#define BLOCK_LZ4_MIN_MATCH 4
+#define BLOCK_LZ4_LAST_LITERALS 5
+#define BLOCK_LZ4_MATCH_FIND_LIMIT 12
+#define BLOCK_LZ4_MAX_DISTANCE 65535
+#define BLOCK_LZ4_HASH_LOG 12
+#define BLOCK_LZ4_HASH_TABLE_SIZE (1 << BLOCK_LZ4_HASH_LOG)
+#define BLOCK_LZ4_COMPRESS_BOUND(size) ((size) + ((size) / 255) + 16)
+
+static
+inline
+uint32_t
+block_lz4_read_uint32_t (const uint8_t *source)
+{
+	uint32_t value;
+	memcpy (&value, source, sizeof (value));
+	return value;
+}
+
+static
+inline
+uint32_t
+block_lz4_hash (uint32_t value)
+{
+	return (value * 2654435761U) >> (32 - BLOCK_LZ4_HASH_LOG);
+}
+
+static
+inline
+uint8_t *
+block_lz4_write_length (
+	uint8_t *dest,
+	uint32_t length)
+{
+	for (; length >= 255; length -= 255)
+		*dest++ = 255;
+	*dest++ = (uint8_t)length;
+	return dest;
+}
+
+static
+inline
+uint8_t *
+block_lz4_write_literals (
+	uint8_t *dest,
+	uint8_t *token,
+	const uint8_t *literals,
+	uint32_t literals_len)
+{
+	*token = (uint8_t)((literals_len >= 15 ? 15 : literals_len) << 4);
+	if (literals_len >= 15)
+		dest = block_lz4_write_length (dest, literals_len - 15);
+	memcpy (dest, literals, literals_len);
+	return dest + literals_len;
+}
+
+static
+uint32_t
+block_compress (
+	const uint8_t *source,
+	uint32_t source_len,
+	uint8_t *dest,
+	uint32_t *hash_table)
+{
+	// Greedy single pass compression with a hash table of the last position of every 4 byte
+	// prefix. Blocks are at most a few hundred KB of repetitive event headers, which gets
+	// most of the gain of a full compressor at a fraction of the flush thread time.
+	const uint8_t *source_end = source + source_len;
+	const uint8_t *anchor = source;
+	uint8_t *dest_start = dest;
+	uint8_t *token;
+
+	memset (hash_table, 0, BLOCK_LZ4_HASH_TABLE_SIZE * sizeof (uint32_t));
+
+	if (source_len > BLOCK_LZ4_MATCH_FIND_LIMIT) {
+		const uint8_t *match_find_limit = source_end - BLOCK_LZ4_MATCH_FIND_LIMIT;
+		const uint8_t *match_end_limit = source_end - BLOCK_LZ4_LAST_LITERALS;
+		const uint8_t *current = source;
+
+		while (current < match_find_limit) {
+			uint32_t sequence = block_lz4_read_uint32_t (current);
+			uint32_t hash = block_lz4_hash (sequence);
+			const uint8_t *match = source + hash_table [hash];
+			hash_table [hash] = (uint32_t)(current - source);
+
+			if (match >= current || current - match > BLOCK_LZ4_MAX_DISTANCE || block_lz4_read_uint32_t (match) != sequence) {
+				current++;
+				continue;
+			}
+
+			while (current > anchor && match > source && current [-1] == match [-1]) {
+				current--;
+				match--;
+			}
+
+			const uint8_t *match_end = current + BLOCK_LZ4_MIN_MATCH;
+			const uint8_t *reference = match + BLOCK_LZ4_MIN_MATCH;
+			while (match_end < match_end_limit && *match_end == *reference) {
+				match_end++;
+				reference++;
+			}
+
+			token = dest++;
+			dest = block_lz4_write_literals (dest, token, anchor, (uint32_t)(current - anchor));
+
+			uint32_t offset = (uint32_t)(current - match);
+			*dest++ = (uint8_t)offset;
+			*dest++ = (uint8_t)(offset >> 8);
+
+			uint32_t match_len = (uint32_t)(match_end - current) - BLOCK_LZ4_MIN_MATCH;
+			*token |= (uint8_t)(match_len >= 15 ? 15 : match_len);
+			if (match_len >= 15)
+				dest = block_lz4_write_length (dest, match_len - 15);
+
+			current = match_end;
+			anchor = current;
+		}
+	}
+
+	// The last sequence only has literals.
+	token = dest++;
+	dest = block_lz4_write_literals (dest, token, anchor, (uint32_t)(source_end - anchor));
+
+	return (uint32_t)(dest - dest_start);
+}
+
 static
 uint32_t
 block_get_block_version (EventPipeSerializationFormat format)
@@ -138,6 +272,8 @@ block_get_block_version (EventPipeSerializationFormat format)
 		return 1;
 	case EP_SERIALIZATION_FORMAT_NETTRACE_V4 :
 		return 2;
+	case EP_SERIALIZATION_FORMAT_NETTRACE_V5 :
+		return 3;
 	default :
 		EP_ASSERT (!"Unrecognized EventPipeSerializationFormat");
 		return 0;
@@ -153,6 +289,8 @@ block_get_block_minimum_version (EventPipeSerializationFormat format)
 		return 0;
 	case EP_SERIALIZATION_FORMAT_NETTRACE_V4 :
 		return 2;
+	case EP_SERIALIZATION_FORMAT_NETTRACE_V5 :
+		return 3;
 	default :
 		EP_ASSERT (!"Unrecognized EventPipeSerializationFormat");
 		return 0;
@@ -222,6 +360,14 @@ ep_block_init (
 	block->end_of_the_buffer = block->block + max_block_size;
 	block->format = format;
 
+	if (format >= EP_SERIALIZATION_FORMAT_NETTRACE_V5) {
+		block->compressed_block = ep_rt_byte_array_alloc (BLOCK_LZ4_COMPRESS_BOUND (max_block_size));
+		ep_raise_error_if_nok (block->compressed_block != NULL);
+
+		block->compression_hash_table = (uint32_t *)ep_rt_byte_array_alloc (BLOCK_LZ4_HASH_TABLE_SIZE * sizeof (uint32_t));
+		ep_raise_error_if_nok (block->compression_hash_table != NULL);
+	}
+
 ep_on_exit:
 	return block;
 
@@ -236,6 +382,8 @@ ep_block_fini (EventPipeBlock *block)
 {
 	ep_return_void_if_nok (block != NULL);
 	ep_rt_byte_array_free (block->block);
+	ep_rt_byte_array_free (block->compressed_block);
+	ep_rt_byte_array_free ((uint8_t *)block->compression_hash_table);
 }
 
 void
@@ -325,8 +473,23 @@ ep_block_fast_serialize (
 	uint32_t data_size = ep_block_get_bytes_written (block);
 	EP_ASSERT (data_size != 0);
 
+	// Compressed formats store the uncompressed size after the header, followed by the LZ4
+	// compressed data. Data that doesn't compress is stored as is, in which case the
+	// stored size matches the uncompressed size.
+	const uint8_t *data = block->block;
+	uint32_t stored_size = data_size;
+	uint32_t compression_header_size = 0;
+	if (block->format >= EP_SERIALIZATION_FORMAT_NETTRACE_V5) {
+		compression_header_size = sizeof (uint32_t);
+		uint32_t compressed_size = block_compress (block->block, data_size, block->compressed_block, block->compression_hash_table);
+		if (compressed_size < data_size) {
+			data = block->compressed_block;
+			stored_size = compressed_size;
+		}
+	}
+
 	uint32_t header_size =  ep_block_get_header_size_vcall (block);
-	uint32_t total_size = data_size + header_size;
+	uint32_t total_size = stored_size + compression_header_size + header_size;
 	ep_fast_serializer_write_uint32_t (fast_serializer, total_size);
 
 	uint32_t required_padding = ep_fast_serializer_get_required_padding (fast_serializer);
@@ -340,7 +503,9 @@ ep_block_fast_serialize (
 	}
 
 	ep_block_serialize_header_vcall (block, fast_serializer);
-	ep_fast_serializer_write_buffer (fast_serializer, block->block, data_size);
+	if (compression_header_size != 0)
+		ep_fast_serializer_write_uint32_t (fast_serializer, data_size);
+	ep_fast_serializer_write_buffer (fast_serializer, data, stored_size);
 }
 
 /*
@@ -547,7 +712,7 @@ ep_event_block_base_write_event (
 		if (block->format == EP_SERIALIZATION_FORMAT_NETPERF_V3) {
 			uint32_t thread_id = (uint32_t)ep_event_instance_get_thread_id (event_instance);
 			ep_write_buffer_uint32_t (&write_pointer, thread_id);
-		} else if (block->format == EP_SERIALIZATION_FORMAT_NETTRACE_V4) {
+		} else if (block->format >= EP_SERIALIZATION_FORMAT_NETTRACE_V4) {
 			ep_write_buffer_uint32_t (&write_pointer, sequence_number);
 
 			uint64_t thread_id = ep_event_instance_get_thread_id (event_instance);
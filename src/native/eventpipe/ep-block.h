@@ -44,6 +44,10 @@ struct _EventPipeBlock_Internal {
 	uint8_t *write_pointer;
 	uint8_t *end_of_the_buffer;
 	EventPipeSerializationFormat format;
+	// Scratch space to LZ4 compress the block into when serializing,
+	// only allocated for formats that compress blocks.
+	uint8_t *compressed_block;
+	uint32_t *compression_hash_table;
 };
 
 #if !defined(EP_INLINE_GETTER_SETTER) && !defined(EP_IMPL_BLOCK_GETTER_SETTER)
@@ -26,6 +26,17 @@ static
 void
 buffer_list_fini (EventPipeBufferList *buffer_list);
 
+static
+void
+buffer_list_push_pending_buffer (
+	EventPipeBufferList *buffer_list,
+	EventPipeBuffer *buffer);
+
+// _Requires_lock_held (buffer_manager)
+static
+void
+buffer_list_insert_pending_buffers (EventPipeBufferList *buffer_list);
+
 // _Requires_lock_held (buffer_manager)
 static
 bool
@@ -52,6 +63,14 @@ buffer_manager_try_peek_sequence_point (
 	EventPipeBufferManager *buffer_manager,
 	EventPipeSequencePoint **sequence_point);
 
+// Returns the session state of the current thread, only taking the thread lock the first
+// time the thread writes into the session.
+static
+EventPipeThreadSessionState *
+buffer_manager_get_or_create_current_thread_session_state (
+	EventPipeThread *current_thread,
+	EventPipeSession *session);
+
 // Allocate a new buffer for the specified thread.
 // This function will store the buffer in the thread's buffer list for future use and also return it here.
 // A NULL return value means that a buffer could not be allocated.
@@ -83,6 +102,12 @@ buffer_manager_release_buffer(
 	EventPipeBufferManager *buffer_manager,
 	uint32_t size);
 
+static
+bool
+buffer_manager_consume_sequence_point_alloc_budget (
+	EventPipeBufferManager *buffer_manager,
+	uint32_t buffer_size);
+
 // An iterator that can enumerate all the events which have been written into this buffer manager.
 // Initially the iterator starts uninitialized and get_current_event () returns NULL. Calling move_next_xxx ()
 // attempts to advance the cursor to the next event. If there is no event prior to stop_timestamp then
@@ -173,6 +198,8 @@ ep_buffer_list_init (
 	buffer_list->head_buffer = NULL;
 	buffer_list->tail_buffer = NULL;
 	buffer_list->buffer_count = 0;
+	buffer_list->pending_buffers = NULL;
+	buffer_list->pending_buffer_count = 0;
 	buffer_list->last_read_sequence_number = 0;
 
 	return buffer_list;
@@ -262,6 +289,71 @@ ep_buffer_list_get_and_remove_head (EventPipeBufferList *buffer_list)
 	return ret_buffer;
 }
 
+static
+inline
+EventPipeBuffer *
+buffer_list_compare_exchange_pending_buffers (
+	EventPipeBufferList *buffer_list,
+	EventPipeBuffer *expected,
+	EventPipeBuffer *value)
+{
+	return (EventPipeBuffer *)ep_rt_atomic_compare_exchange_size_t ((volatile size_t *)&buffer_list->pending_buffers, (size_t)expected, (size_t)value);
+}
+
+void
+buffer_list_push_pending_buffer (
+	EventPipeBufferList *buffer_list,
+	EventPipeBuffer *buffer)
+{
+	EP_ASSERT (buffer_list != NULL);
+	EP_ASSERT (buffer != NULL);
+	EP_ASSERT ((ep_buffer_get_next_buffer (buffer) == NULL) && (ep_buffer_get_prev_buffer (buffer) == NULL));
+
+	// Only the writer thread pushes, so the CAS can only fail when the reader took the
+	// pending buffers in between and there is no ABA problem. The count goes up first
+	// so that inserting the pending buffers never underflows it.
+	ep_rt_atomic_inc_uint32_t (&buffer_list->pending_buffer_count);
+
+	EventPipeBuffer *pending_buffers;
+	do {
+		pending_buffers = buffer_list->pending_buffers;
+		ep_buffer_set_prev_buffer (buffer, pending_buffers);
+	} while (buffer_list_compare_exchange_pending_buffers (buffer_list, pending_buffers, buffer) != pending_buffers);
+}
+
+void
+buffer_list_insert_pending_buffers (EventPipeBufferList *buffer_list)
+{
+	EP_ASSERT (buffer_list != NULL);
+
+	ep_buffer_manager_requires_lock_held (buffer_list->manager);
+
+	EventPipeBuffer *pending_buffers;
+	do {
+		pending_buffers = buffer_list->pending_buffers;
+		if (pending_buffers == NULL)
+			return;
+	} while (buffer_list_compare_exchange_pending_buffers (buffer_list, pending_buffers, NULL) != pending_buffers);
+
+	// Pending buffers are linked newest first, relink them oldest first through next_buffer.
+	EventPipeBuffer *oldest_buffer = NULL;
+	while (pending_buffers) {
+		EventPipeBuffer *prev_buffer = ep_buffer_get_prev_buffer (pending_buffers);
+		ep_buffer_set_prev_buffer (pending_buffers, NULL);
+		ep_buffer_set_next_buffer (pending_buffers, oldest_buffer);
+		oldest_buffer = pending_buffers;
+		pending_buffers = prev_buffer;
+	}
+
+	while (oldest_buffer) {
+		EventPipeBuffer *buffer = oldest_buffer;
+		oldest_buffer = ep_buffer_get_next_buffer (buffer);
+		ep_buffer_set_next_buffer (buffer, NULL);
+		ep_buffer_list_insert_tail (buffer_list, buffer);
+		ep_rt_atomic_dec_uint32_t (&buffer_list->pending_buffer_count);
+	}
+}
+
 bool
 buffer_manager_try_reserve_buffer(
 	EventPipeBufferManager *buffer_manager,
@@ -300,6 +392,25 @@ buffer_manager_release_buffer(
 	} while (new_size_of_all_buffers >= 0 && ep_rt_atomic_compare_exchange_size_t (&buffer_manager->size_of_all_buffers, old_size_of_all_buffers, new_size_of_all_buffers) != old_size_of_all_buffers);
 }
 
+bool
+buffer_manager_consume_sequence_point_alloc_budget (
+	EventPipeBufferManager *buffer_manager,
+	uint32_t buffer_size)
+{
+	// Returns true for the one allocation that exhausts the budget, which then
+	// has to enqueue the sequence point.
+	bool budget_exhausted;
+	size_t old_remaining_budget;
+	size_t new_remaining_budget;
+	do {
+		old_remaining_budget = buffer_manager->remaining_sequence_point_alloc_budget;
+		budget_exhausted = buffer_size >= old_remaining_budget;
+		new_remaining_budget = budget_exhausted ? buffer_manager->sequence_point_alloc_budget : old_remaining_budget - buffer_size;
+	} while (ep_rt_atomic_compare_exchange_size_t (&buffer_manager->remaining_sequence_point_alloc_budget, old_remaining_budget, new_remaining_budget) != old_remaining_budget);
+
+	return budget_exhausted;
+}
+
 #ifdef EP_CHECKED_BUILD
 bool
 ep_buffer_list_ensure_consistency (EventPipeBufferList *buffer_list)
@@ -452,6 +563,32 @@ buffer_manager_try_peek_sequence_point (
 	return *sequence_point != NULL;
 }
 
+static
+EventPipeThreadSessionState *
+buffer_manager_get_or_create_current_thread_session_state (
+	EventPipeThread *current_thread,
+	EventPipeSession *session)
+{
+	EP_ASSERT (current_thread != NULL);
+	EP_ASSERT (session != NULL);
+
+	// Only the current thread creates its session states, so once published the slot
+	// stays valid until writes into the session are suspended.
+	EventPipeThreadSessionState *session_state = ep_thread_get_volatile_session_state (current_thread, session);
+	if (!session_state) {
+		EP_SPIN_LOCK_ENTER (ep_thread_get_rt_lock_ref (current_thread), section1)
+			session_state = ep_thread_get_or_create_session_state (current_thread, session);
+		EP_SPIN_LOCK_EXIT (ep_thread_get_rt_lock_ref (current_thread), section1)
+	}
+
+ep_on_exit:
+	return session_state;
+
+ep_on_error:
+	session_state = NULL;
+	ep_exit_error_handler ();
+}
+
 static
 EventPipeBuffer *
 buffer_manager_allocate_buffer_for_thread (
@@ -468,6 +605,7 @@ buffer_manager_allocate_buffer_for_thread (
 	EventPipeBufferList *thread_buffer_list = NULL;
 	EventPipeSequencePoint* sequence_point = NULL;
 	uint32_t sequence_number = 0;
+	bool sequence_point_needed = false;
 
 	// Pick a buffer size by multiplying the base buffer size by the number of buffers already allocated for this thread.
 	uint32_t size_multiplier = ep_thread_session_state_get_buffer_count_estimate(thread_session_state) + 1;
@@ -506,41 +644,41 @@ buffer_manager_allocate_buffer_for_thread (
 	new_buffer = ep_buffer_alloc (buffer_size, ep_thread_session_state_get_thread (thread_session_state), sequence_number);
 	ep_raise_error_if_nok (new_buffer != NULL);
 
-	// Adding a buffer to the buffer list requires us to take the lock.
-	EP_SPIN_LOCK_ENTER (&buffer_manager->rt_lock, section1)
-		thread_buffer_list = ep_thread_session_state_get_buffer_list (thread_session_state);
-		if (thread_buffer_list == NULL) {
-			thread_buffer_list = ep_buffer_list_alloc (buffer_manager, ep_thread_session_state_get_thread (thread_session_state));
-			ep_raise_error_if_nok_holding_spin_lock (thread_buffer_list != NULL, section1);
-
-			ep_raise_error_if_nok_holding_spin_lock (ep_rt_thread_session_state_list_append (&buffer_manager->thread_session_state_list, thread_session_state), section1);
-			ep_thread_session_state_set_buffer_list (thread_session_state, thread_buffer_list);
-			thread_buffer_list = NULL;
-		}
+	if (buffer_manager->sequence_point_alloc_budget != 0)
+		sequence_point_needed = buffer_manager_consume_sequence_point_alloc_budget (buffer_manager, buffer_size);
 
-		if (buffer_manager->sequence_point_alloc_budget != 0) {
-			// sequence point bookkeeping
-			if (buffer_size >= buffer_manager->remaining_sequence_point_alloc_budget) {
-				sequence_point = ep_sequence_point_alloc ();
-				if (sequence_point) {
-					buffer_manager_init_sequence_point_thread_list (buffer_manager, sequence_point);
-					ep_raise_error_if_nok_holding_spin_lock (buffer_manager_enqueue_sequence_point (buffer_manager, sequence_point), section1);
-					sequence_point = NULL;
-				}
-				buffer_manager->remaining_sequence_point_alloc_budget = buffer_manager->sequence_point_alloc_budget;
-			} else {
-				buffer_manager->remaining_sequence_point_alloc_budget -= buffer_size;
+	// The lock is only needed the first time this thread allocates a buffer for the session
+	// and for the allocation that triggers a sequence point. Otherwise the buffer is handed
+	// off to the reader through the thread's pending buffers.
+	thread_buffer_list = ep_thread_session_state_get_volatile_buffer_list (thread_session_state);
+	if (thread_buffer_list == NULL || sequence_point_needed) {
+		if (sequence_point_needed)
+			sequence_point = ep_sequence_point_alloc ();
+
+		EP_SPIN_LOCK_ENTER (&buffer_manager->rt_lock, section1)
+			if (thread_buffer_list == NULL) {
+				thread_buffer_list = ep_buffer_list_alloc (buffer_manager, ep_thread_session_state_get_thread (thread_session_state));
+				ep_raise_error_if_nok_holding_spin_lock (thread_buffer_list != NULL, section1);
+
+				ep_raise_error_if_nok_holding_spin_lock (ep_rt_thread_session_state_list_append (&buffer_manager->thread_session_state_list, thread_session_state), section1);
+				ep_thread_session_state_set_buffer_list (thread_session_state, thread_buffer_list);
 			}
-		}
+
+			if (sequence_point) {
+				// sequence point bookkeeping
+				buffer_manager_init_sequence_point_thread_list (buffer_manager, sequence_point);
+				ep_raise_error_if_nok_holding_spin_lock (buffer_manager_enqueue_sequence_point (buffer_manager, sequence_point), section1);
+				sequence_point = NULL;
+			}
+		EP_SPIN_LOCK_EXIT (&buffer_manager->rt_lock, section1)
+	}
+
 #ifdef EP_CHECKED_BUILD
-		buffer_manager->num_buffers_allocated++;
+	ep_rt_atomic_inc_uint32_t (&buffer_manager->num_buffers_allocated);
 #endif // EP_CHECKED_BUILD
 
-		// Set the buffer on the thread.
-		if (new_buffer != NULL)
-			ep_buffer_list_insert_tail (ep_thread_session_state_get_buffer_list (thread_session_state), new_buffer);
-
-	EP_SPIN_LOCK_EXIT (&buffer_manager->rt_lock, section1)
+	// Set the buffer on the thread.
+	buffer_list_push_pending_buffer (thread_buffer_list, new_buffer);
 
 ep_on_exit:
 
@@ -550,7 +688,8 @@ ep_on_error:
 	ep_sequence_point_free (sequence_point);
 	sequence_point = NULL;
 
-	ep_buffer_list_free (thread_buffer_list);
+	if (thread_buffer_list != ep_thread_session_state_get_volatile_buffer_list (thread_session_state))
+		ep_buffer_list_free (thread_buffer_list);
 	thread_buffer_list = NULL;
 
 	ep_buffer_free (new_buffer);
@@ -573,7 +712,7 @@ buffer_manager_deallocate_buffer (
 		buffer_manager_release_buffer(buffer_manager, ep_buffer_get_size (buffer));
 		ep_buffer_free (buffer);
 #ifdef EP_CHECKED_BUILD
-		buffer_manager->num_buffers_allocated--;
+		ep_rt_atomic_dec_uint32_t (&buffer_manager->num_buffers_allocated);
 #endif
 	}
 }
@@ -610,6 +749,7 @@ buffer_manager_move_next_event_any_thread (
 		ep_rt_thread_session_state_list_iterator_t iterator = ep_rt_thread_session_state_list_iterator_begin (&buffer_manager->thread_session_state_list);
 		while (!ep_rt_thread_session_state_list_iterator_end (&buffer_manager->thread_session_state_list, &iterator)) {
 			buffer_list = ep_thread_session_state_get_buffer_list (ep_rt_thread_session_state_list_iterator_value (&iterator));
+			buffer_list_insert_pending_buffers (buffer_list);
 			buffer = buffer_list->head_buffer;
 			if (buffer && ep_buffer_get_creation_timestamp (buffer) < stop_timestamp) {
 				ep_rt_buffer_list_array_append (&buffer_list_array, buffer_list);
@@ -750,6 +890,7 @@ buffer_manager_advance_to_non_empty_buffer (
 				buffer_manager_deallocate_buffer (buffer_manager, removed_buffer);
 
 				// get the next buffer
+				buffer_list_insert_pending_buffers (buffer_list);
 				current_buffer = buffer_list->head_buffer;
 				if (!current_buffer || ep_buffer_get_creation_timestamp (current_buffer) >= before_timestamp) {
 					// no more buffers in the list before this timestamp, we're done
@@ -957,11 +1098,13 @@ ep_buffer_manager_write_event (
 	{
 		ep_rt_atomic_inc_int64_t (&buffer_manager->num_oversized_events_dropped);
 		EventPipeThread *current_thread = ep_thread_get();
-		ep_rt_spin_lock_handle_t *thread_lock = ep_thread_get_rt_lock_ref (current_thread);
-		EP_SPIN_LOCK_ENTER (thread_lock, section1)
-			session_state = ep_thread_get_or_create_session_state (current_thread, session);
-			ep_thread_session_state_increment_sequence_number (session_state);
-		EP_SPIN_LOCK_EXIT (thread_lock, section1)
+		session_state = buffer_manager_get_or_create_current_thread_session_state (current_thread, session);
+		if (session_state) {
+			ep_rt_spin_lock_handle_t *thread_lock = ep_thread_get_rt_lock_ref (current_thread);
+			EP_SPIN_LOCK_ENTER (thread_lock, section1)
+				ep_thread_session_state_increment_sequence_number (session_state);
+			EP_SPIN_LOCK_EXIT (thread_lock, section1)
+		}
 		return false;
 	}
 
@@ -980,13 +1123,14 @@ ep_buffer_manager_write_event (
 	current_thread = ep_thread_get ();
 	ep_raise_error_if_nok (current_thread != NULL);
 
+	session_state = buffer_manager_get_or_create_current_thread_session_state (current_thread, session);
+	ep_raise_error_if_nok (session_state != NULL);
+
 	ep_rt_spin_lock_handle_t *thread_lock;
 	thread_lock = ep_thread_get_rt_lock_ref (current_thread);
 
+	// The thread lock is only needed to synchronize the write buffer with a reader converting it to read only.
 	EP_SPIN_LOCK_ENTER (thread_lock, section2)
-		session_state = ep_thread_get_or_create_session_state (current_thread, session);
-		ep_raise_error_if_nok_holding_spin_lock (session_state != NULL, section2);
-
 		buffer = ep_thread_session_state_get_write_buffer (session_state);
 		if (!buffer) {
 			alloc_new_buffer = true;
@@ -1289,6 +1433,7 @@ ep_buffer_manager_write_all_buffers_to_file_v4 (
 					ep_rt_thread_session_state_list_iterator_next (&thread_session_state_list_iterator);
 
 					// if a session_state was exhausted during this sequence point, mark it for deletion
+					buffer_list_insert_pending_buffers (ep_thread_session_state_get_buffer_list (session_state));
 					if (ep_thread_session_state_get_buffer_list (session_state)->head_buffer == NULL) {
 
 						// We don't hold the thread lock here, so it technically races with a thread getting unregistered. This is okay,
@@ -1418,6 +1563,7 @@ ep_buffer_manager_deallocate_buffers (EventPipeBufferManager *buffer_manager)
 			ep_thread_session_state_set_buffer_list (thread_session_state, NULL);
 
 			// Iterate over all nodes in the buffer list and deallocate them.
+			buffer_list_insert_pending_buffers (buffer_list);
 			EventPipeBuffer *buffer = ep_buffer_list_get_and_remove_head (buffer_list);
 			while (buffer) {
 				buffer_manager_deallocate_buffer (buffer_manager, buffer);
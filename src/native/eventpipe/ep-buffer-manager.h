@@ -31,6 +31,13 @@ struct _EventPipeBufferList_Internal {
 	EventPipeBuffer *tail_buffer;
 	// The number of buffers in the list.
 	uint32_t buffer_count;
+	// Buffers the writer thread has handed off but the reader has not yet
+	// moved into the list, newest first and linked through prev_buffer.
+	// Only the writer thread pushes and pushing doesn't take the buffer
+	// manager lock; they are moved into the list while holding it.
+	EventPipeBuffer *volatile pending_buffers;
+	// The number of buffers in pending_buffers.
+	volatile uint32_t pending_buffer_count;
 	// The sequence number of the last event that was read, only
 	// updated/read by the reader thread.
 	uint32_t last_read_sequence_number;
@@ -120,8 +127,8 @@ struct _EventPipeBufferManager_Internal {
 	// dropped events.
 	size_t max_size_of_all_buffers;
 	// The amount of allocations we can do at this moment before
-	// triggering a sequence point
-	size_t remaining_sequence_point_alloc_budget;
+	// triggering a sequence point. Updated without holding rt_lock.
+	volatile size_t remaining_sequence_point_alloc_budget;
 	// The total amount of allocations we can do after one sequence
 	// point before triggering the next one
 	size_t sequence_point_alloc_budget;
@@ -133,7 +140,7 @@ struct _EventPipeBufferManager_Internal {
 	volatile int64_t num_events_stored;
 	volatile int64_t num_events_dropped;
 	int64_t num_events_written;
-	uint32_t num_buffers_allocated;
+	volatile uint32_t num_buffers_allocated;
 	uint32_t num_buffers_stolen;
 	uint32_t num_buffers_leaked;
 #endif
@@ -39,6 +39,7 @@ ep_buffer_alloc (
 	instance->current_read_event = NULL;
 	instance->prev_buffer = NULL;
 	instance->next_buffer = NULL;
+	memset (instance->recent_stacks, 0, sizeof (instance->recent_stacks));
 
 	ep_rt_volatile_store_uint32_t (&instance->state, (uint32_t)EP_BUFFER_STATE_WRITABLE);
 
@@ -63,6 +64,40 @@ ep_buffer_free (EventPipeBuffer *buffer)
 	ep_rt_object_free (buffer);
 }
 
+static
+uint32_t
+buffer_hash_stack (EventPipeStackContents *stack)
+{
+	const uintptr_t *frames = ep_stack_contents_get_stack_frames_cref (stack);
+	uint32_t length = ep_stack_contents_get_length (stack);
+
+	uint64_t hash = length;
+	for (uint32_t i = 0; i < length; ++i)
+		hash = (hash ^ (uint64_t)frames [i]) * 0x100000001B3ULL;
+	return (uint32_t)(hash ^ (hash >> 32));
+}
+
+static
+bool
+buffer_stack_equals (
+	EventPipeStackContentsInstance *recent_stack,
+	EventPipeStackContents *stack)
+{
+	uint32_t length = ep_stack_contents_get_length (stack);
+	if (ep_stack_contents_instance_get_length (recent_stack) != length)
+		return false;
+
+	if (memcmp (ep_stack_contents_instance_get_stack_frames_cref (recent_stack), ep_stack_contents_get_stack_frames_cref (stack), length * sizeof (uintptr_t)) != 0)
+		return false;
+
+#ifdef EP_CHECKED_BUILD
+	if (memcmp (ep_stack_contents_instance_get_methods_cref (recent_stack), ep_stack_contents_get_methods_cref (stack), length * sizeof (ep_rt_method_desc_t *)) != 0)
+		return false;
+#endif
+
+	return true;
+}
+
 bool
 ep_buffer_write_event (
 	EventPipeBuffer *buffer,
@@ -84,12 +119,25 @@ ep_buffer_write_event (
 	bool success = true;
 	EventPipeEventInstance *instance = NULL;
 
+	// Sampling and allocation events tend to repeat the same stacks, so share the
+	// stack of a recent event in this buffer when it is identical instead of copying it.
+	EventPipeStackContentsInstance **recent_stack = NULL;
+	EventPipeStackContentsInstance *shared_stack = NULL;
+	if (stack != NULL && !ep_stack_contents_is_empty (stack)) {
+		recent_stack = &buffer->recent_stacks [buffer_hash_stack (stack) & (EP_BUFFER_RECENT_STACKS_COUNT - 1)];
+		if (*recent_stack != NULL && buffer_stack_equals (*recent_stack, stack))
+			shared_stack = *recent_stack;
+	}
+
+	uint32_t stack_size;
+	stack_size = shared_stack ? 0 : ep_stack_contents_get_full_size (stack);
+
 	// Calculate the location of the data payload.
 	uint8_t *data_dest;
-	data_dest = (ep_event_payload_get_size (payload) == 0 ? NULL : buffer->current + sizeof (*instance) - sizeof (instance->stack_contents_instance.stack_frames) + ep_stack_contents_get_full_size (stack));
+	data_dest = (ep_event_payload_get_size (payload) == 0 ? NULL : buffer->current + sizeof (*instance) - sizeof (instance->inline_stack_contents_instance.stack_frames) + stack_size);
 
 	// Calculate the size of the event.
-	uint32_t event_size = sizeof (*instance) - sizeof (instance->stack_contents_instance.stack_frames) + ep_stack_contents_get_full_size (stack) + ep_event_payload_get_size (payload);
+	uint32_t event_size = sizeof (*instance) - sizeof (instance->inline_stack_contents_instance.stack_frames) + stack_size + ep_event_payload_get_size (payload);
 
 	// Make sure we have enough space to write the event.
 	if(buffer->current + event_size > buffer->limit)
@@ -109,8 +157,14 @@ ep_buffer_write_event (
 	ep_raise_error_if_nok (instance != NULL);
 
 	// Copy the stack if a separate stack trace was provided.
-	if (stack != NULL)
-		ep_stack_contents_flatten (stack, ep_event_instance_get_stack_contents_instance_ref (instance));
+	if (shared_stack != NULL) {
+		ep_stack_contents_instance_set_next_available_frame (ep_event_instance_get_inline_stack_contents_instance_ref (instance), 0);
+		ep_event_instance_set_shared_stack_contents_instance (instance, shared_stack);
+	} else if (stack != NULL) {
+		ep_stack_contents_flatten (stack, ep_event_instance_get_inline_stack_contents_instance_ref (instance));
+		if (recent_stack != NULL)
+			*recent_stack = ep_event_instance_get_inline_stack_contents_instance_ref (instance);
+	}
 
 	// Write the event payload data to the buffer.
 	if (ep_event_payload_get_size (payload) > 0)
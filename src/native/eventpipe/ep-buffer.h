@@ -34,6 +34,9 @@
 // It is OK for the data payloads to be unaligned because they are opaque blobs that are copied via memcpy.
 #define EP_BUFFER_ALIGNMENT_SIZE 8
 
+// Number of recently written stacks an event can share its stack with instead of copying it, must be a power of 2.
+#define EP_BUFFER_RECENT_STACKS_COUNT 32
+
 #if defined(EP_INLINE_GETTER_SETTER) || defined(EP_IMPL_BUFFER_GETTER_SETTER)
 struct _EventPipeBuffer {
 #else
@@ -63,6 +66,10 @@ struct _EventPipeBuffer_Internal {
 	// The sequence number corresponding to current_read_event
 	// Prior to read iteration it is the sequence number of the first event in the buffer
 	uint32_t event_sequence_number;
+	// Stacks of events already in this buffer, indexed by stack hash. Only used
+	// by the writer thread, an event with the same stack as one of these points
+	// to it rather than storing a copy.
+	EventPipeStackContentsInstance *recent_stacks [EP_BUFFER_RECENT_STACKS_COUNT];
 };
 
 #if !defined(EP_INLINE_GETTER_SETTER) && !defined(EP_IMPL_BUFFER_GETTER_SETTER)
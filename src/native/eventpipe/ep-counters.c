@@ -0,0 +1,424 @@
+#include "ep-rt-config.h"
+
+#ifdef ENABLE_PERFTRACING
+#if !defined(EP_INCLUDE_SOURCE_FILES) || defined(EP_FORCE_INCLUDE_SOURCE_FILES)
+
+#define EP_IMPL_COUNTERS_GETTER_SETTER
+#include "ep.h"
+#include "ep-counters.h"
+#include "ep-event.h"
+#include "ep-provider-internals.h"
+#include "ep-session.h"
+#include "ep-rt.h"
+
+#define COUNTERS_DEFAULT_INTERVAL_MS 1000
+#define COUNTERS_MIN_INTERVAL_MS 10
+
+// Event ids of the native counters provider.
+// CounterDefinition: uint32 id, uint32 type, NUL terminated UTF16 name. Written for every counter when a session starts.
+// CounterBlock: uint32 interval in ms, uint32 count, int64 value of counter id 0 .. count - 1.
+#define COUNTER_DEFINITION_EVENT_ID 1
+#define COUNTER_BLOCK_EVENT_ID 2
+
+static EventPipeCounter _counters [EP_MAX_NUMBER_OF_COUNTERS];
+static ep_char16_t *_counter_names_utf16 [EP_MAX_NUMBER_OF_COUNTERS];
+static volatile uint32_t _counters_len = 0;
+
+static EventPipeProvider *_counters_provider = NULL;
+static EventPipeEvent *_counter_definition_event = NULL;
+static EventPipeEvent *_counter_block_event = NULL;
+
+// Sessions sampling counters, and the interval each of them asked for.
+static uint64_t _sessions_mask = 0;
+static uint32_t _session_interval_ms [EP_MAX_NUMBER_OF_SESSIONS];
+
+static volatile uint32_t _sampling_enabled = (uint32_t)false;
+static volatile uint32_t _interval_ms = COUNTERS_DEFAULT_INTERVAL_MS;
+// Bumped when a session starts, the sampling thread then writes all definitions again.
+static volatile uint32_t _definitions_generation = 0;
+static bool _can_start_sampling = false;
+
+// Set to wake the sampling thread early, when it should stop.
+static ep_rt_wait_event_handle_t _thread_wake_event;
+static ep_rt_wait_event_handle_t _thread_shutdown_event;
+
+/*
+ * Forward declares of all static functions.
+ */
+
+EP_RT_DEFINE_THREAD_FUNC (counters_thread);
+
+static
+uint32_t
+counters_parse_interval (const ep_char8_t *filter_data);
+
+static
+uint32_t
+counters_write_definitions (uint32_t defined_len);
+
+static
+void
+counters_write_block (void);
+
+static
+void
+counters_start_sampling (void);
+
+static
+void
+counters_stop_sampling (void);
+
+/*
+ * EventPipeCounters.
+ */
+
+static
+inline
+bool
+counters_load_sampling_enabled (void)
+{
+	return (ep_rt_volatile_load_uint32_t (&_sampling_enabled) != 0) ? true : false;
+}
+
+static
+inline
+void
+counters_store_sampling_enabled (bool enabled)
+{
+	ep_rt_volatile_store_uint32_t (&_sampling_enabled, enabled ? 1 : 0);
+}
+
+EP_RT_DEFINE_THREAD_FUNC (counters_thread)
+{
+	EP_ASSERT (data != NULL);
+	if (data == NULL)
+		return 1;
+
+	ep_rt_thread_params_t *thread_params = (ep_rt_thread_params_t *)data;
+
+	if (thread_params->thread && ep_rt_thread_has_started (thread_params->thread)) {
+		uint32_t generation = ep_rt_volatile_load_uint32_t (&_definitions_generation);
+		uint32_t defined_len = 0;
+		EP_GCX_PREEMP_ENTER
+			while (counters_load_sampling_enabled ()) {
+				uint32_t current_generation = ep_rt_volatile_load_uint32_t (&_definitions_generation);
+				if (current_generation != generation) {
+					generation = current_generation;
+					defined_len = 0;
+				}
+				defined_len = counters_write_definitions (defined_len);
+				counters_write_block ();
+				ep_rt_wait_event_wait (&_thread_wake_event, ep_rt_volatile_load_uint32_t (&_interval_ms), false);
+			}
+		EP_GCX_PREEMP_EXIT
+	}
+
+	// Signal disable () that the thread has been destroyed.
+	ep_rt_wait_event_set (&_thread_shutdown_event);
+
+	return (ep_rt_thread_start_func_return_t)0;
+}
+
+static
+uint32_t
+counters_parse_interval (const ep_char8_t *filter_data)
+{
+	// Same key EventCounters use, seconds as a decimal number.
+	const ep_char8_t *key = "EventCounterIntervalSec=";
+	const ep_char8_t *value = filter_data ? strstr (filter_data, key) : NULL;
+	if (!value)
+		return COUNTERS_DEFAULT_INTERVAL_MS;
+
+	double interval_sec = strtod (value + strlen (key), NULL);
+	if (interval_sec <= 0)
+		return COUNTERS_DEFAULT_INTERVAL_MS;
+	if (interval_sec * 1000 < COUNTERS_MIN_INTERVAL_MS)
+		return COUNTERS_MIN_INTERVAL_MS;
+	if (interval_sec * 1000 > UINT32_MAX)
+		return UINT32_MAX;
+
+	return (uint32_t)(interval_sec * 1000);
+}
+
+static
+uint32_t
+counters_write_definitions (uint32_t defined_len)
+{
+	uint32_t counters_len = ep_rt_volatile_load_uint32_t (&_counters_len);
+
+	for (uint32_t i = defined_len; i < counters_len; ++i) {
+		EventPipeCounter *counter = &_counters [i];
+		uint32_t type = (uint32_t)counter->type;
+		const ep_char16_t *name = _counter_names_utf16 [i];
+
+		EventData event_data [3];
+		ep_event_data_init (&event_data [0], (uint64_t)&counter->id, sizeof (counter->id), 0);
+		ep_event_data_init (&event_data [1], (uint64_t)&type, sizeof (type), 0);
+		ep_event_data_init (&event_data [2], (uint64_t)name, (uint32_t)((ep_rt_utf16_string_len (name) + 1) * sizeof (ep_char16_t)), 0);
+		ep_write_event_2 (_counter_definition_event, event_data, (uint32_t)ARRAY_SIZE (event_data), NULL, NULL);
+
+		ep_event_data_fini (&event_data [0]);
+		ep_event_data_fini (&event_data [1]);
+		ep_event_data_fini (&event_data [2]);
+	}
+
+	return counters_len;
+}
+
+static
+void
+counters_write_block (void)
+{
+	uint32_t counters_len = ep_rt_volatile_load_uint32_t (&_counters_len);
+	if (counters_len == 0)
+		return;
+
+	uint8_t block [sizeof (uint32_t) * 2 + sizeof (int64_t) * EP_MAX_NUMBER_OF_COUNTERS];
+	uint8_t *current = block;
+
+	uint32_t interval_ms = ep_rt_volatile_load_uint32_t (&_interval_ms);
+	memcpy (current, &interval_ms, sizeof (interval_ms));
+	current += sizeof (interval_ms);
+	memcpy (current, &counters_len, sizeof (counters_len));
+	current += sizeof (counters_len);
+
+	for (uint32_t i = 0; i < counters_len; ++i) {
+		EventPipeCounter *counter = &_counters [i];
+		int64_t value = counter->read_func ? counter->read_func () : ep_rt_volatile_load_int64_t (&counter->value);
+		memcpy (current, &value, sizeof (value));
+		current += sizeof (value);
+	}
+
+	ep_write_event (_counter_block_event, block, (uint32_t)(current - block), NULL, NULL);
+}
+
+static
+void
+counters_start_sampling (void)
+{
+	ep_requires_lock_held ();
+
+	if (counters_load_sampling_enabled ())
+		return;
+
+	counters_store_sampling_enabled (true);
+
+	EP_ASSERT (!ep_rt_wait_event_is_valid (&_thread_wake_event));
+	EP_ASSERT (!ep_rt_wait_event_is_valid (&_thread_shutdown_event));
+	ep_rt_wait_event_alloc (&_thread_wake_event, false, false);
+	ep_rt_wait_event_alloc (&_thread_shutdown_event, true, false);
+	if (!ep_rt_wait_event_is_valid (&_thread_wake_event) || !ep_rt_wait_event_is_valid (&_thread_shutdown_event))
+		EP_UNREACHABLE ("Unable to create counters events.");
+
+	ep_rt_thread_id_t thread_id = ep_rt_uint64_t_to_thread_id_t (0);
+	if (!ep_rt_thread_create ((void *)counters_thread, NULL, EP_THREAD_TYPE_SAMPLING, &thread_id))
+		EP_UNREACHABLE ("Unable to create counters thread.");
+}
+
+static
+void
+counters_stop_sampling (void)
+{
+	ep_requires_lock_held ();
+
+	if (!counters_load_sampling_enabled ())
+		return;
+
+	EP_ASSERT (!ep_rt_process_detach ());
+
+	// The sampling thread will watch this value and exit when sampling is disabled.
+	counters_store_sampling_enabled (false);
+	ep_rt_wait_event_set (&_thread_wake_event);
+
+	// Wait for the sampling thread to clean itself up.
+	ep_rt_wait_event_wait (&_thread_shutdown_event, EP_INFINITE_WAIT, false);
+	ep_rt_wait_event_free (&_thread_shutdown_event);
+	ep_rt_wait_event_free (&_thread_wake_event);
+}
+
+EventPipeCounter *
+ep_counter_register (
+	const ep_char8_t *name,
+	EventPipeCounterType type,
+	EventPipeCounterReadFunc read_func)
+{
+	ep_return_null_if_nok (name != NULL);
+
+	ep_requires_lock_not_held ();
+
+	EventPipeCounter *counter = NULL;
+	ep_char8_t *name_copy = NULL;
+	ep_char16_t *name_utf16 = NULL;
+	uint32_t counters_len = 0;
+
+	EP_LOCK_ENTER (section1)
+		counters_len = ep_rt_volatile_load_uint32_t (&_counters_len);
+		for (uint32_t i = 0; i < counters_len && !counter; ++i) {
+			if (!ep_rt_utf8_string_compare (_counters [i].name, name))
+				counter = &_counters [i];
+		}
+
+		if (!counter) {
+			ep_raise_error_if_nok_holding_lock (counters_len < EP_MAX_NUMBER_OF_COUNTERS, section1);
+
+			name_copy = ep_rt_utf8_string_dup (name);
+			ep_raise_error_if_nok_holding_lock (name_copy != NULL, section1);
+			name_utf16 = ep_rt_utf8_to_utf16le_string (name, -1);
+			ep_raise_error_if_nok_holding_lock (name_utf16 != NULL, section1);
+
+			counter = &_counters [counters_len];
+			counter->name = name_copy;
+			counter->type = type;
+			counter->read_func = read_func;
+			counter->value = 0;
+			counter->id = counters_len;
+			_counter_names_utf16 [counters_len] = name_utf16;
+			name_copy = NULL;
+			name_utf16 = NULL;
+
+			// Published last, the sampling thread reads counters below _counters_len without the lock.
+			ep_rt_volatile_store_uint32_t (&_counters_len, counters_len + 1);
+		}
+	EP_LOCK_EXIT (section1)
+
+ep_on_exit:
+	ep_requires_lock_not_held ();
+	return counter;
+
+ep_on_error:
+	ep_rt_utf8_string_free (name_copy);
+	ep_rt_utf16_string_free (name_utf16);
+	counter = NULL;
+	ep_exit_error_handler ();
+}
+
+void
+ep_counters_init (EventPipeProviderCallbackDataQueue *provider_callback_data_queue)
+{
+	ep_requires_lock_held ();
+
+	if (!_counters_provider) {
+		_counters_provider = provider_create_register (ep_config_get_native_counters_provider_name_utf8 (), NULL, NULL, NULL, provider_callback_data_queue);
+		ep_raise_error_if_nok (_counters_provider != NULL);
+		_counter_definition_event = provider_add_event (
+			_counters_provider,
+			COUNTER_DEFINITION_EVENT_ID, /* eventID */
+			0, /* keywords */
+			0, /* eventVersion */
+			EP_EVENT_LEVEL_INFORMATIONAL,
+			false /* NeedStack */,
+			NULL,
+			0);
+		ep_raise_error_if_nok (_counter_definition_event != NULL);
+		_counter_block_event = provider_add_event (
+			_counters_provider,
+			COUNTER_BLOCK_EVENT_ID, /* eventID */
+			0, /* keywords */
+			0, /* eventVersion */
+			EP_EVENT_LEVEL_INFORMATIONAL,
+			false /* NeedStack */,
+			NULL,
+			0);
+		ep_raise_error_if_nok (_counter_block_event != NULL);
+	}
+
+ep_on_exit:
+	ep_requires_lock_held ();
+	return;
+
+ep_on_error:
+
+	ep_exit_error_handler ();
+}
+
+void
+ep_counters_shutdown (void)
+{
+	ep_requires_lock_held ();
+
+	EP_ASSERT (_sessions_mask == 0);
+
+	provider_unregister_delete (_counters_provider);
+
+	_counters_provider = NULL;
+	_counter_definition_event = NULL;
+	_counter_block_event = NULL;
+
+	_can_start_sampling = false;
+}
+
+void
+ep_counters_enable (
+	EventPipeSession *session,
+	const ep_char8_t *filter_data)
+{
+	EP_ASSERT (session != NULL);
+	EP_ASSERT (_counter_block_event != NULL);
+
+	ep_requires_lock_held ();
+
+	// Check to see if the session enabled the counter events. If it did not, do not spin up the sampling thread.
+	if (!ep_event_is_enabled_by_mask (_counter_block_event, ep_session_get_mask (session)))
+		return;
+
+	uint32_t interval_ms = counters_parse_interval (filter_data);
+	_session_interval_ms [ep_session_get_index (session)] = interval_ms;
+	if (_sessions_mask == 0 || interval_ms < ep_rt_volatile_load_uint32_t (&_interval_ms))
+		ep_rt_volatile_store_uint32_t (&_interval_ms, interval_ms);
+
+	_sessions_mask |= ep_session_get_mask (session);
+
+	// The new session needs the definitions too.
+	ep_rt_volatile_store_uint32_t (&_definitions_generation, ep_rt_volatile_load_uint32_t (&_definitions_generation) + 1);
+
+	if (!_can_start_sampling)
+		return;
+
+	if (counters_load_sampling_enabled ())
+		ep_rt_wait_event_set (&_thread_wake_event);
+	else
+		counters_start_sampling ();
+}
+
+void
+ep_counters_disable (EventPipeSession *session)
+{
+	EP_ASSERT (session != NULL);
+
+	ep_requires_lock_held ();
+
+	if (!(_sessions_mask & ep_session_get_mask (session)))
+		return;
+
+	_sessions_mask &= ~ep_session_get_mask (session);
+	if (_sessions_mask == 0) {
+		counters_stop_sampling ();
+		return;
+	}
+
+	// Sample at the shortest interval any remaining session asked for.
+	uint32_t interval_ms = UINT32_MAX;
+	for (uint32_t i = 0; i < EP_MAX_NUMBER_OF_SESSIONS; ++i) {
+		if ((_sessions_mask & ((uint64_t)1 << i)) && _session_interval_ms [i] < interval_ms)
+			interval_ms = _session_interval_ms [i];
+	}
+	ep_rt_volatile_store_uint32_t (&_interval_ms, interval_ms);
+}
+
+void
+ep_counters_can_start_sampling (void)
+{
+	ep_requires_lock_held ();
+
+	_can_start_sampling = true;
+	if (_sessions_mask != 0)
+		counters_start_sampling ();
+}
+
+#endif /* !defined(EP_INCLUDE_SOURCE_FILES) || defined(EP_FORCE_INCLUDE_SOURCE_FILES) */
+#endif /* ENABLE_PERFTRACING */
+
+#if !defined(ENABLE_PERFTRACING) || (defined(EP_INCLUDE_SOURCE_FILES) && !defined(EP_FORCE_INCLUDE_SOURCE_FILES))
+extern const char quiet_linker_empty_file_warning_eventpipe_counters;
+const char quiet_linker_empty_file_warning_eventpipe_counters = 0;
+#endif
@@ -0,0 +1,110 @@
+#ifndef __EVENTPIPE_COUNTERS_H__
+#define __EVENTPIPE_COUNTERS_H__
+
+#include "ep-rt-config.h"
+
+#ifdef ENABLE_PERFTRACING
+#include "ep-types.h"
+#include "ep-rt.h"
+
+#undef EP_IMPL_GETTER_SETTER
+#ifdef EP_IMPL_COUNTERS_GETTER_SETTER
+#define EP_IMPL_GETTER_SETTER
+#endif
+#include "ep-getter-setter.h"
+
+#define EP_MAX_NUMBER_OF_COUNTERS 64
+
+typedef enum {
+	// Current value, e.g. heap size or queue length.
+	EP_COUNTER_TYPE_GAUGE,
+	// Monotonically increasing total, consumers compute the rate from consecutive samples.
+	EP_COUNTER_TYPE_INCREMENTING
+} EventPipeCounterType;
+
+// Reads the value of a counter maintained by its owner, called on the counters thread.
+typedef int64_t (*EventPipeCounterReadFunc)(void);
+
+/*
+ * EventPipeCounter.
+ */
+
+#if defined(EP_INLINE_GETTER_SETTER) || defined(EP_IMPL_COUNTERS_GETTER_SETTER)
+struct _EventPipeCounter {
+#else
+struct _EventPipeCounter_Internal {
+#endif
+	ep_char8_t *name;
+	EventPipeCounterReadFunc read_func;
+	volatile int64_t value;
+	EventPipeCounterType type;
+	uint32_t id;
+};
+
+#if !defined(EP_INLINE_GETTER_SETTER) && !defined(EP_IMPL_COUNTERS_GETTER_SETTER)
+struct _EventPipeCounter {
+	uint8_t _internal [sizeof (struct _EventPipeCounter_Internal)];
+};
+#endif
+
+EP_DEFINE_GETTER(EventPipeCounter *, counter, const ep_char8_t *, name)
+EP_DEFINE_GETTER(EventPipeCounter *, counter, EventPipeCounterType, type)
+EP_DEFINE_GETTER(EventPipeCounter *, counter, uint32_t, id)
+EP_DEFINE_GETTER_REF(EventPipeCounter *, counter, volatile int64_t *, value)
+
+// Registers a counter sampled by sessions enabling the native counters provider. Counters live until shutdown,
+// registering an existing name returns the existing counter. With a read_func the counter is read when sampled,
+// otherwise its owner updates it with ep_counter_add/ep_counter_set.
+// Returns NULL when EP_MAX_NUMBER_OF_COUNTERS counters are registered.
+EventPipeCounter *
+ep_counter_register (
+	const ep_char8_t *name,
+	EventPipeCounterType type,
+	EventPipeCounterReadFunc read_func);
+
+static
+inline
+void
+ep_counter_add (
+	EventPipeCounter *counter,
+	int64_t value)
+{
+	ep_rt_atomic_add_int64_t (ep_counter_get_value_ref (counter), value);
+}
+
+static
+inline
+void
+ep_counter_set (
+	EventPipeCounter *counter,
+	int64_t value)
+{
+	ep_rt_volatile_store_int64_t (ep_counter_get_value_ref (counter), value);
+}
+
+/*
+ * EventPipeCounters.
+ */
+
+// Samples registered counters at the interval requested by the sessions (EventCounterIntervalSec in the
+// provider filter data, default 1 second) and writes them as blocks of values on a dedicated thread.
+
+void
+ep_counters_init (EventPipeProviderCallbackDataQueue *provider_callback_data_queue);
+
+void
+ep_counters_shutdown (void);
+
+void
+ep_counters_enable (
+	EventPipeSession *session,
+	const ep_char8_t *filter_data);
+
+void
+ep_counters_disable (EventPipeSession *session);
+
+void
+ep_counters_can_start_sampling (void);
+
+#endif /* ENABLE_PERFTRACING */
+#endif /* __EVENTPIPE_COUNTERS_H__ */
@@ -84,6 +84,7 @@ ep_event_instance_init (
 
 	event_instance->data = data;
 	event_instance->data_len = data_len;
+	event_instance->shared_stack_contents_instance = NULL;
 
 	event_instance->timestamp = ep_perf_timestamp_get ();
 	EP_ASSERT (event_instance->timestamp > 0);
@@ -148,8 +149,8 @@ ep_event_instance_get_aligned_total_size (
 			// Prepended stack payload size in bytes
 			sizeof (uint32_t) +
 			// Stack payload size
-			ep_stack_contents_instance_get_size (&ep_event_instance->stack_contents_instance);
-	} else if (format == EP_SERIALIZATION_FORMAT_NETTRACE_V4) {
+			ep_stack_contents_instance_get_size (ep_event_instance_get_stack_contents_instance_cref (ep_event_instance));
+	} else if (format >= EP_SERIALIZATION_FORMAT_NETTRACE_V4) {
 		payload_len =
 			// Metadata ID
 			sizeof (ep_event_instance->metadata_id) +
@@ -207,7 +208,7 @@ ep_event_instance_serialize_to_json_file (
 		ep_event_get_event_version (ep_event_instance->ep_event));
 
 	if (characters_written > 0 && characters_written < (int32_t)ARRAY_SIZE (buffer))
-		ep_json_file_write_event_data (json_file, ep_event_instance->timestamp, ep_rt_uint64_t_to_thread_id_t (ep_event_instance->thread_id), buffer, &ep_event_instance->stack_contents_instance);
+		ep_json_file_write_event_data (json_file, ep_event_instance->timestamp, ep_rt_uint64_t_to_thread_id_t (ep_event_instance->thread_id), buffer, ep_event_instance_get_stack_contents_instance_ref (ep_event_instance));
 }
 #else
 void
@@ -35,7 +35,11 @@ struct _EventPipeEventInstance_Internal {
 	uint32_t debug_event_start;
 	uint32_t debug_event_end;
 #endif
-	EventPipeStackContentsInstance stack_contents_instance;
+	// Set when the event has the same stack as an earlier event in the same buffer,
+	// the stack is then not copied into inline_stack_contents_instance.
+	EventPipeStackContentsInstance *shared_stack_contents_instance;
+	// Must be last, the stack frames are stored in place.
+	EventPipeStackContentsInstance inline_stack_contents_instance;
 };
 
 #if !defined(EP_INLINE_GETTER_SETTER) && !defined(EP_IMPL_EVENT_INSTANCE_GETTER_SETTER)
@@ -55,7 +59,27 @@ EP_DEFINE_GETTER_ARRAY_REF(EventPipeEventInstance *, event_instance, uint8_t *,
 EP_DEFINE_GETTER_ARRAY_REF(EventPipeEventInstance *, event_instance, uint8_t *, const uint8_t *, related_activity_id, related_activity_id[0])
 EP_DEFINE_GETTER(EventPipeEventInstance *, event_instance, const uint8_t *, data)
 EP_DEFINE_GETTER(EventPipeEventInstance *, event_instance, uint32_t, data_len)
-EP_DEFINE_GETTER_REF(EventPipeEventInstance *, event_instance, EventPipeStackContentsInstance *, stack_contents_instance)
+EP_DEFINE_GETTER(EventPipeEventInstance *, event_instance, EventPipeStackContentsInstance *, shared_stack_contents_instance)
+EP_DEFINE_SETTER(EventPipeEventInstance *, event_instance, EventPipeStackContentsInstance *, shared_stack_contents_instance)
+EP_DEFINE_GETTER_REF(EventPipeEventInstance *, event_instance, EventPipeStackContentsInstance *, inline_stack_contents_instance)
+
+static
+inline
+EventPipeStackContentsInstance *
+ep_event_instance_get_stack_contents_instance_ref (EventPipeEventInstance *ep_event_instance)
+{
+	EventPipeStackContentsInstance *shared_stack_contents_instance = ep_event_instance_get_shared_stack_contents_instance (ep_event_instance);
+	return shared_stack_contents_instance ? shared_stack_contents_instance : ep_event_instance_get_inline_stack_contents_instance_ref (ep_event_instance);
+}
+
+static
+inline
+EventPipeStackContentsInstance *
+ep_event_instance_get_stack_contents_instance_cref (const EventPipeEventInstance *ep_event_instance)
+{
+	EventPipeStackContentsInstance *shared_stack_contents_instance = ep_event_instance_get_shared_stack_contents_instance (ep_event_instance);
+	return shared_stack_contents_instance ? shared_stack_contents_instance : ep_event_instance_get_inline_stack_contents_instance_cref (ep_event_instance);
+}
 
 EventPipeEventInstance *
 ep_event_instance_alloc (
@@ -104,8 +128,8 @@ ep_event_instance_get_flattened_size (const EventPipeEventInstance *ep_event_ins
 {
 	EP_ASSERT (ep_event_instance != NULL);
 	return ep_event_instance_get_data (ep_event_instance) ?
-		sizeof (*ep_event_instance) - sizeof (ep_event_instance->stack_contents_instance.stack_frames) + ep_stack_contents_instance_get_full_size (ep_event_instance_get_stack_contents_instance_cref (ep_event_instance)) + ep_event_instance_get_data_len (ep_event_instance) :
-		sizeof (*ep_event_instance) - sizeof (ep_event_instance->stack_contents_instance.stack_frames) + ep_stack_contents_instance_get_full_size (ep_event_instance_get_stack_contents_instance_cref (ep_event_instance));
+		sizeof (*ep_event_instance) - sizeof (ep_event_instance->inline_stack_contents_instance.stack_frames) + ep_stack_contents_instance_get_full_size (ep_event_instance_get_inline_stack_contents_instance_cref (ep_event_instance)) + ep_event_instance_get_data_len (ep_event_instance) :
+		sizeof (*ep_event_instance) - sizeof (ep_event_instance->inline_stack_contents_instance.stack_frames) + ep_stack_contents_instance_get_full_size (ep_event_instance_get_inline_stack_contents_instance_cref (ep_event_instance));
 }
 
 /*
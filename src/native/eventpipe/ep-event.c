@@ -72,6 +72,7 @@ ep_event_alloc (
 	instance->level = level;
 	instance->need_stack = need_stack;
 	instance->enabled_mask = 0;
+	instance->sampled_mask = 0;
 
 	if (metadata != NULL) {
 		instance->metadata = ep_rt_byte_array_alloc (metadata_len);
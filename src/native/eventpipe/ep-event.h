@@ -26,6 +26,8 @@ struct _EventPipeEvent_Internal {
 	uint64_t keywords;
 	// The ith bit is 1 iff the event is enabled for the ith session.
 	volatile int64_t enabled_mask;
+	// The ith bit is 1 iff writes of the event are sampled in the ith session.
+	volatile int64_t sampled_mask;
 	// Metadata
 	uint8_t *metadata;
 	// The provider that contains the event.
@@ -51,6 +53,7 @@ struct _EventPipeEvent {
 EP_DEFINE_GETTER(EventPipeEvent *, event, uint64_t, keywords)
 EP_DEFINE_GETTER_REF(EventPipeEvent *, event, volatile int64_t *, enabled_mask)
 EP_DEFINE_SETTER(EventPipeEvent *, event, int64_t, enabled_mask)
+EP_DEFINE_GETTER_REF(EventPipeEvent *, event, volatile int64_t *, sampled_mask)
 EP_DEFINE_GETTER(EventPipeEvent *, event, uint8_t *, metadata)
 EP_DEFINE_GETTER(EventPipeEvent *, event, EventPipeProvider *, provider)
 EP_DEFINE_GETTER(EventPipeEvent *, event, uint32_t, event_id)
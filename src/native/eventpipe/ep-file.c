@@ -278,6 +278,8 @@ file_get_file_version (EventPipeSerializationFormat format)
 		return 3;
 	case EP_SERIALIZATION_FORMAT_NETTRACE_V4 :
 		return 4;
+	case EP_SERIALIZATION_FORMAT_NETTRACE_V5 :
+		return 5;
 	default :
 		EP_ASSERT (!"Unrecognized EventPipeSerializationFormat");
 		return 0;
@@ -293,6 +295,8 @@ file_get_file_minimum_version (EventPipeSerializationFormat format)
 		return 0;
 	case EP_SERIALIZATION_FORMAT_NETTRACE_V4 :
 		return 4;
+	case EP_SERIALIZATION_FORMAT_NETTRACE_V5 :
+		return 5;
 	default :
 		EP_ASSERT (!"Unrecognized EventPipeSerializationFormat");
 		return 0;
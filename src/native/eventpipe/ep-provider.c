@@ -41,7 +41,8 @@ void
 provider_refresh_event_state (EventPipeEvent *ep_event);
 
 // Compute the enabled bit mask, the ith bit is 1 iff an event with the
-// given (provider, keywords, eventLevel) is enabled for the ith session.
+// given (provider, keywords, eventLevel, eventId) is enabled for the ith session.
+// The ith bit of sampled_mask is set when the ith session samples the event.
 // _Requires_lock_held (ep)
 static
 int64_t
@@ -49,7 +50,9 @@ provider_compute_event_enable_mask (
 	const EventPipeConfiguration *config,
 	const EventPipeProvider *provider,
 	int64_t keywords,
-	EventPipeEventLevel event_level);
+	EventPipeEventLevel event_level,
+	uint32_t event_id,
+	int64_t *sampled_mask);
 
 /*
  * EventPipeProvider.
@@ -116,8 +119,12 @@ provider_refresh_event_state (EventPipeEvent *ep_event)
 	EventPipeConfiguration *config = provider->config;
 	EP_ASSERT (config != NULL);
 
-	int64_t enable_mask = provider_compute_event_enable_mask (config, provider, ep_event_get_keywords (ep_event), ep_event_get_level (ep_event));
-	ep_event_set_enabled_mask (ep_event, enable_mask);
+	int64_t sampled_mask = 0;
+	int64_t enable_mask = provider_compute_event_enable_mask (config, provider, ep_event_get_keywords (ep_event), ep_event_get_level (ep_event), ep_event_get_event_id (ep_event), &sampled_mask);
+
+	// Publish the sampled sessions first, a writer seeing the enabled bit must also see the sampling.
+	ep_rt_volatile_store_int64_t (ep_event_get_sampled_mask_ref (ep_event), sampled_mask);
+	ep_rt_volatile_store_int64_t (ep_event_get_enabled_mask_ref (ep_event), enable_mask);
 
 	ep_requires_lock_held ();
 	return;
@@ -129,13 +136,17 @@ provider_compute_event_enable_mask (
 	const EventPipeConfiguration *config,
 	const EventPipeProvider *provider,
 	int64_t keywords,
-	EventPipeEventLevel event_level)
+	EventPipeEventLevel event_level,
+	uint32_t event_id,
+	int64_t *sampled_mask)
 {
 	EP_ASSERT (provider != NULL);
+	EP_ASSERT (sampled_mask != NULL);
 
 	ep_requires_lock_held ();
 
 	int64_t result = 0;
+	*sampled_mask = 0;
 	bool provider_enabled = ep_provider_get_enabled (provider);
 	for (int i = 0; i < EP_MAX_NUMBER_OF_SESSIONS; i++) {
 		// Entering EventPipe lock gave us a barrier, we don't need more of them.
@@ -149,10 +160,15 @@ provider_compute_event_enable_mask (
 				//  - The provider is enabled.
 				//  - The event keywords are unspecified in the manifest (== 0) or when masked with the enabled config are != 0.
 				//  - The event level is LogAlways or the provider's verbosity level is set to greater than the event's verbosity level in the manifest.
+				//  - The event id passes the event filter of the session provider, if any.
 				bool keyword_enabled = (keywords == 0) || ((session_keyword & keywords) != 0);
 				bool level_enabled = ((event_level == EP_EVENT_LEVEL_LOGALWAYS) || (session_level >= event_level));
-				if (provider_enabled && keyword_enabled && level_enabled)
+				if (provider_enabled && keyword_enabled && level_enabled && ep_session_provider_is_event_id_enabled (session_provider, event_id)) {
 					result = result | ep_session_get_mask (session);
+					ep_session_bind_user_events_provider (session, session_provider, provider);
+					if (ep_session_bind_event_sampler (session, session_provider, provider, event_id))
+						*sampled_mask = *sampled_mask | ep_session_get_mask (session);
+				}
 			}
 		}
 	}
@@ -283,6 +299,37 @@ ep_on_error:
 	ep_exit_error_handler ();
 }
 
+EventPipeEvent *
+ep_provider_find_event (
+	EventPipeProvider *provider,
+	uint32_t event_id,
+	uint32_t event_version)
+{
+	EP_ASSERT (provider != NULL);
+
+	ep_requires_lock_not_held ();
+
+	EventPipeEvent *result = NULL;
+
+	EP_LOCK_ENTER (section1)
+		for (ep_rt_event_list_iterator_t iterator = ep_rt_event_list_iterator_begin (&provider->event_list); !ep_rt_event_list_iterator_end (&provider->event_list, &iterator); ep_rt_event_list_iterator_next (&iterator)) {
+			EventPipeEvent *ep_event = ep_rt_event_list_iterator_value (&iterator);
+			if (ep_event_get_event_id (ep_event) == event_id && ep_event_get_event_version (ep_event) == event_version) {
+				result = ep_event;
+				break;
+			}
+		}
+	EP_LOCK_EXIT (section1)
+
+ep_on_exit:
+	ep_requires_lock_not_held ();
+	return result;
+
+ep_on_error:
+	result = NULL;
+	ep_exit_error_handler ();
+}
+
 void
 ep_provider_set_delete_deferred (
 	EventPipeProvider *provider,
@@ -114,6 +114,13 @@ ep_provider_add_event (
 	const uint8_t *metadata,
 	uint32_t metadata_len);
 
+// Find a previously added event, NULL if the provider has no event with that id and version.
+EventPipeEvent *
+ep_provider_find_event (
+	EventPipeProvider *provider,
+	uint32_t event_id,
+	uint32_t event_version);
+
 void
 ep_provider_set_delete_deferred (
 	EventPipeProvider *provider,
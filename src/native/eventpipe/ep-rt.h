@@ -222,6 +222,10 @@ static
 int64_t
 ep_rt_atomic_dec_int64_t (volatile int64_t *value);
 
+static
+int64_t
+ep_rt_atomic_add_int64_t (volatile int64_t *value, int64_t add);
+
 static
 size_t
 ep_rt_atomic_compare_exchange_size_t (volatile size_t *target, size_t expected, size_t value);
@@ -402,6 +406,11 @@ inline
 bool
 ep_rt_config_value_get_output_streaming (void);
 
+static
+inline
+bool
+ep_rt_config_value_get_output_user_events (void);
+
 /*
  * EventPipeSampleProfiler.
  */
@@ -410,6 +419,10 @@ static
 void
 ep_rt_sample_profiler_write_sampling_event_for_threads (ep_rt_thread_handle_t sampling_thread, EventPipeEvent *sampling_event);
 
+static
+void
+ep_rt_sample_profiler_stop_sampling (void);
+
 static
 void
 ep_rt_notify_profiler_provider_created (EventPipeProvider *provider);
@@ -100,6 +100,8 @@ EP_RT_DEFINE_THREAD_FUNC (sampling_thread)
 				// Wait until it's time to sample again.
 				ep_rt_thread_sleep (_sampling_rate_in_ns);
 			}
+			// Let runtimes sampling asynchronously tear down their per thread sampling state.
+			ep_rt_sample_profiler_stop_sampling ();
 		EP_GCX_PREEMP_EXIT
 	}
 
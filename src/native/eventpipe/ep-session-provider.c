@@ -31,7 +31,8 @@ ep_session_provider_alloc (
 	const ep_char8_t *provider_name,
 	uint64_t keywords,
 	EventPipeEventLevel logging_level,
-	const ep_char8_t *filter_data)
+	const ep_char8_t *filter_data,
+	const EventPipeProviderEventFilter *event_filter)
 {
 	EventPipeSessionProvider *instance = ep_rt_object_alloc (EventPipeSessionProvider);
 	ep_raise_error_if_nok (instance != NULL);
@@ -46,6 +47,29 @@ ep_session_provider_alloc (
 		ep_raise_error_if_nok (instance->filter_data != NULL);
 	}
 
+	if (event_filter) {
+		instance->event_ids_enable = ep_provider_event_filter_get_enable (event_filter);
+
+		uint32_t event_ids_len = ep_provider_event_filter_get_event_ids_len (event_filter);
+		if (event_ids_len > 0) {
+			instance->event_ids = ep_rt_object_array_alloc (uint32_t, event_ids_len);
+			ep_raise_error_if_nok (instance->event_ids != NULL);
+			memcpy (instance->event_ids, ep_provider_event_filter_get_event_ids (event_filter), event_ids_len * sizeof (uint32_t));
+			instance->event_ids_len = event_ids_len;
+		}
+
+		uint32_t sampling_rates_len = ep_provider_event_filter_get_sampling_rates_len (event_filter);
+		if (sampling_rates_len > 0) {
+			instance->sampling_rates = ep_rt_object_array_alloc (uint32_t, sampling_rates_len * 2);
+			ep_raise_error_if_nok (instance->sampling_rates != NULL);
+			memcpy (instance->sampling_rates, ep_provider_event_filter_get_sampling_rates (event_filter), sampling_rates_len * 2 * sizeof (uint32_t));
+			instance->sampling_rates_len = sampling_rates_len;
+		}
+	} else {
+		// Without a filter every event selected by keywords and level is enabled, same as an empty deny list.
+		instance->event_ids_enable = false;
+	}
+
 	instance->keywords = keywords;
 	instance->logging_level = logging_level;
 
@@ -63,11 +87,29 @@ ep_session_provider_free (EventPipeSessionProvider * session_provider)
 {
 	ep_return_void_if_nok (session_provider != NULL);
 
+	ep_rt_object_array_free (session_provider->sampling_rates);
+	ep_rt_object_array_free (session_provider->event_ids);
 	ep_rt_utf8_string_free (session_provider->filter_data);
 	ep_rt_utf8_string_free (session_provider->provider_name);
 	ep_rt_object_free (session_provider);
 }
 
+bool
+ep_session_provider_is_event_id_enabled (
+	const EventPipeSessionProvider *session_provider,
+	uint32_t event_id)
+{
+	EP_ASSERT (session_provider != NULL);
+
+	// Only evaluated when event enable masks are refreshed, a linear search is good enough.
+	for (uint32_t i = 0; i < session_provider->event_ids_len; ++i) {
+		if (session_provider->event_ids [i] == event_id)
+			return session_provider->event_ids_enable;
+	}
+
+	return !session_provider->event_ids_enable;
+}
+
 /*
  * EventPipeSessionProviderList.
  */
@@ -95,7 +137,7 @@ ep_session_provider_list_alloc (
 		if ((ep_rt_utf8_string_compare(ep_provider_get_wildcard_name_utf8 (), ep_provider_config_get_provider_name (config)) == 0) &&
 			(ep_provider_config_get_keywords (config) == 0xFFFFFFFFFFFFFFFF) &&
 			((ep_provider_config_get_logging_level (config) == EP_EVENT_LEVEL_VERBOSE) && (instance->catch_all_provider == NULL))) {
-			instance->catch_all_provider = ep_session_provider_alloc (NULL, 0xFFFFFFFFFFFFFFFF, EP_EVENT_LEVEL_VERBOSE, NULL );
+			instance->catch_all_provider = ep_session_provider_alloc (NULL, 0xFFFFFFFFFFFFFFFF, EP_EVENT_LEVEL_VERBOSE, NULL, NULL);
 			ep_raise_error_if_nok (instance->catch_all_provider != NULL);
 		}
 		else {
@@ -103,7 +145,8 @@ ep_session_provider_list_alloc (
 				ep_provider_config_get_provider_name (config),
 				ep_provider_config_get_keywords (config),
 				ep_provider_config_get_logging_level (config),
-				ep_provider_config_get_filter_data (config));
+				ep_provider_config_get_filter_data (config),
+				ep_provider_config_get_event_filter (config));
 			ep_raise_error_if_nok (ep_rt_session_provider_list_append (&instance->providers, session_provider));
 		}
 	}
@@ -24,6 +24,12 @@ struct _EventPipeSessionProvider_Internal {
 	uint64_t keywords;
 	EventPipeEventLevel logging_level;
 	ep_char8_t *filter_data;
+	// Copy of the configured EventPipeProviderEventFilter, the arrays are NULL when empty.
+	uint32_t *event_ids;
+	uint32_t *sampling_rates;
+	uint32_t event_ids_len;
+	uint32_t sampling_rates_len;
+	bool event_ids_enable;
 };
 
 #if !defined(EP_INLINE_GETTER_SETTER) && !defined(EP_IMPL_SESSION_PROVIDER_GETTER_SETTER)
@@ -36,17 +42,26 @@ EP_DEFINE_GETTER(EventPipeSessionProvider *, session_provider, const ep_char8_t
 EP_DEFINE_GETTER(EventPipeSessionProvider *, session_provider, uint64_t, keywords)
 EP_DEFINE_GETTER(EventPipeSessionProvider *, session_provider, EventPipeEventLevel, logging_level)
 EP_DEFINE_GETTER(EventPipeSessionProvider *, session_provider, const ep_char8_t *, filter_data)
+EP_DEFINE_GETTER(EventPipeSessionProvider *, session_provider, const uint32_t *, sampling_rates)
+EP_DEFINE_GETTER(EventPipeSessionProvider *, session_provider, uint32_t, sampling_rates_len)
 
 EventPipeSessionProvider *
 ep_session_provider_alloc (
 	const ep_char8_t *provider_name,
 	uint64_t keywords,
 	EventPipeEventLevel logging_level,
-	const ep_char8_t *filter_data);
+	const ep_char8_t *filter_data,
+	const EventPipeProviderEventFilter *event_filter);
 
 void
 ep_session_provider_free (EventPipeSessionProvider * session_provider);
 
+// True unless the event id filter of the session provider excludes the event.
+bool
+ep_session_provider_is_event_id_enabled (
+	const EventPipeSessionProvider *session_provider,
+	uint32_t event_id);
+
 /*
 * EventPipeSessionProviderList.
  */
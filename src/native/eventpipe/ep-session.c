@@ -11,6 +11,7 @@
 #include "ep-file.h"
 #include "ep-session.h"
 #include "ep-event-payload.h"
+#include "ep-user-events.h"
 #include "ep-rt.h"
 
 /*
@@ -26,6 +27,29 @@ static
 void
 session_create_streaming_thread (EventPipeSession *session);
 
+static
+bool
+session_alloc_event_samplers (EventPipeSession *session);
+
+static
+bool
+session_sample_event (
+	EventPipeSession *session,
+	const EventPipeEvent *ep_event);
+
+/*
+ * EventPipeSessionEventSampler.
+ */
+
+struct _EventPipeSessionEventSampler {
+	const EventPipeSessionProvider *session_provider;
+	// Set under the lock before the event gets its sampled_mask bit, compared without the lock on write.
+	const EventPipeProvider *provider;
+	uint32_t event_id;
+	uint32_t rate;
+	volatile uint32_t count;
+};
+
 /*
  * EventPipeSession.
  */
@@ -136,7 +160,7 @@ ep_session_alloc (
 {
 	EP_ASSERT (index < EP_MAX_NUMBER_OF_SESSIONS);
 	EP_ASSERT (format < EP_SERIALIZATION_FORMAT_COUNT);
-	EP_ASSERT (session_type == EP_SESSION_TYPE_SYNCHRONOUS || circular_buffer_size_in_mb > 0);
+	EP_ASSERT (session_type == EP_SESSION_TYPE_SYNCHRONOUS || session_type == EP_SESSION_TYPE_USEREVENTS || circular_buffer_size_in_mb > 0);
 	EP_ASSERT (providers_len > 0);
 	EP_ASSERT (providers != NULL);
 	EP_ASSERT ((sync_callback != NULL) == (session_type == EP_SESSION_TYPE_SYNCHRONOUS));
@@ -153,6 +177,8 @@ ep_session_alloc (
 	instance->providers = ep_session_provider_list_alloc (providers, providers_len);
 	ep_raise_error_if_nok (instance->providers != NULL);
 
+	ep_raise_error_if_nok (session_alloc_event_samplers (instance));
+
 	instance->index = index;
 	instance->rundown_enabled = 0;
 	instance->session_type = session_type;
@@ -167,7 +193,7 @@ ep_session_alloc (
 		sequence_point_alloc_budget = 10 * 1024 * 1024;
 	}
 
-	if (session_type != EP_SESSION_TYPE_SYNCHRONOUS) {
+	if (session_type != EP_SESSION_TYPE_SYNCHRONOUS && session_type != EP_SESSION_TYPE_USEREVENTS) {
 		instance->buffer_manager = ep_buffer_manager_alloc (instance, ((size_t)circular_buffer_size_in_mb) << 20, sequence_point_alloc_budget);
 		ep_raise_error_if_nok (instance->buffer_manager != NULL);
 	}
@@ -195,6 +221,11 @@ ep_session_alloc (
 		ipc_stream_writer = NULL;
 		break;
 
+	case EP_SESSION_TYPE_USEREVENTS:
+		instance->user_events = ep_user_events_alloc (instance->providers);
+		ep_raise_error_if_nok (instance->user_events != NULL);
+		break;
+
 	default:
 		break;
 	}
@@ -225,10 +256,12 @@ ep_session_free (EventPipeSession *session)
 
 	ep_rt_wait_event_free (&session->rt_thread_shutdown_event);
 
+	ep_rt_object_array_free (session->event_samplers);
 	ep_session_provider_list_free (session->providers);
 
 	ep_buffer_manager_free (session->buffer_manager);
 	ep_file_free (session->file);
+	ep_user_events_free (session->user_events);
 
 	ep_rt_object_free (session);
 }
@@ -256,6 +289,99 @@ ep_session_get_session_provider (
 	return session_provider;
 }
 
+static
+bool
+session_alloc_event_samplers (EventPipeSession *session)
+{
+	EP_ASSERT (session != NULL);
+
+	ep_rt_session_provider_list_t *providers = ep_session_provider_list_get_providers_ref (session->providers);
+
+	uint32_t samplers_len = 0;
+	for (ep_rt_session_provider_list_iterator_t iterator = ep_rt_session_provider_list_iterator_begin (providers); !ep_rt_session_provider_list_iterator_end (providers, &iterator); ep_rt_session_provider_list_iterator_next (&iterator))
+		samplers_len += ep_session_provider_get_sampling_rates_len (ep_rt_session_provider_list_iterator_value (&iterator));
+
+	if (samplers_len == 0)
+		return true;
+
+	session->event_samplers = ep_rt_object_array_alloc (EventPipeSessionEventSampler, samplers_len);
+	ep_return_false_if_nok (session->event_samplers != NULL);
+
+	for (ep_rt_session_provider_list_iterator_t iterator = ep_rt_session_provider_list_iterator_begin (providers); !ep_rt_session_provider_list_iterator_end (providers, &iterator); ep_rt_session_provider_list_iterator_next (&iterator)) {
+		EventPipeSessionProvider *session_provider = ep_rt_session_provider_list_iterator_value (&iterator);
+		const uint32_t *sampling_rates = ep_session_provider_get_sampling_rates (session_provider);
+		for (uint32_t i = 0; i < ep_session_provider_get_sampling_rates_len (session_provider); ++i) {
+			EventPipeSessionEventSampler *sampler = &session->event_samplers [session->event_samplers_len++];
+			sampler->session_provider = session_provider;
+			sampler->provider = NULL;
+			sampler->event_id = sampling_rates [i * 2];
+			sampler->rate = sampling_rates [i * 2 + 1] > 0 ? sampling_rates [i * 2 + 1] : 1;
+			sampler->count = 0;
+		}
+	}
+
+	return true;
+}
+
+static
+bool
+session_sample_event (
+	EventPipeSession *session,
+	const EventPipeEvent *ep_event)
+{
+	EP_ASSERT (session != NULL);
+	EP_ASSERT (ep_event != NULL);
+
+	const EventPipeProvider *provider = ep_event_get_provider (ep_event);
+	uint32_t event_id = ep_event_get_event_id (ep_event);
+
+	for (uint32_t i = 0; i < session->event_samplers_len; ++i) {
+		EventPipeSessionEventSampler *sampler = &session->event_samplers [i];
+		if (sampler->event_id == event_id && ep_rt_volatile_load_ptr ((volatile void **)&sampler->provider) == provider)
+			return ((ep_rt_atomic_inc_uint32_t (&sampler->count) - 1) % sampler->rate) == 0;
+	}
+
+	return true;
+}
+
+bool
+ep_session_bind_event_sampler (
+	EventPipeSession *session,
+	const EventPipeSessionProvider *session_provider,
+	const EventPipeProvider *provider,
+	uint32_t event_id)
+{
+	EP_ASSERT (session != NULL);
+	EP_ASSERT (session_provider != NULL);
+	EP_ASSERT (provider != NULL);
+
+	ep_requires_lock_held ();
+
+	for (uint32_t i = 0; i < session->event_samplers_len; ++i) {
+		EventPipeSessionEventSampler *sampler = &session->event_samplers [i];
+		if (sampler->session_provider == session_provider && sampler->event_id == event_id) {
+			ep_rt_volatile_store_ptr ((volatile void **)&sampler->provider, (void *)provider);
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void
+ep_session_bind_user_events_provider (
+	EventPipeSession *session,
+	const EventPipeSessionProvider *session_provider,
+	const EventPipeProvider *provider)
+{
+	EP_ASSERT (session != NULL);
+
+	ep_requires_lock_held ();
+
+	if (session->user_events)
+		ep_user_events_bind_provider (session->user_events, session_provider, provider);
+}
+
 bool
 ep_session_enable_rundown (EventPipeSession *session)
 {
@@ -290,7 +416,8 @@ ep_session_enable_rundown (EventPipeSession *session)
 			ep_provider_config_get_provider_name (config),
 			ep_provider_config_get_keywords (config),
 			ep_provider_config_get_logging_level (config),
-			ep_provider_config_get_filter_data (config));
+			ep_provider_config_get_filter_data (config),
+			ep_provider_config_get_event_filter (config));
 
 		ep_raise_error_if_nok (ep_session_add_session_provider (session, session_provider));
 	}
@@ -462,7 +589,13 @@ ep_session_write_event (
 
 	// Filter events specific to "this" session based on precomputed flag on provider/events.
 	if (ep_event_is_enabled_by_mask (ep_event, ep_session_get_mask (session))) {
-		if (session->synchronous_callback) {
+		// Sampled events are dropped before the stack walk and buffer reservation.
+		if ((ep_rt_volatile_load_int64_t (ep_event_get_sampled_mask_cref (ep_event)) & ep_session_get_mask (session)) != 0 && !session_sample_event (session, ep_event))
+			return false;
+
+		if (session->user_events) {
+			result = ep_user_events_write (session->user_events, ep_event, payload, activity_id, related_activity_id);
+		} else if (session->synchronous_callback) {
 			session->synchronous_callback (
 				ep_event_get_provider (ep_event),
 				ep_event_get_event_id (ep_event),
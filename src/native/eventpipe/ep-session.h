@@ -29,10 +29,14 @@ struct _EventPipeSession_Internal {
 	ep_rt_wait_event_handle_t rt_thread_shutdown_event;
 	// The set of configurations for each provider in the session.
 	EventPipeSessionProviderList *providers;
+	// Write counters for the event sampling rates of the session providers, fixed at session creation.
+	EventPipeSessionEventSampler *event_samplers;
 	// Session buffer manager.
 	EventPipeBufferManager *buffer_manager;
 	// Object used to flush event data (File, IPC stream, etc.).
 	EventPipeFile *file;
+	// Tracepoints written to by user_events sessions, replaces buffer manager and file.
+	EventPipeUserEvents *user_events;
 	// For synchoronous sessions.
 	EventPipeSessionSynchronousCallback synchronous_callback;
 	// Additional data to pass to the callback
@@ -42,6 +46,7 @@ struct _EventPipeSession_Internal {
 	// Start timestamp.
 	ep_timestamp_t session_start_timestamp;
 	uint32_t index;
+	uint32_t event_samplers_len;
 	// True if rundown is enabled.
 	volatile uint32_t rundown_enabled;
 	// Data members used when an streaming thread is used.
@@ -99,6 +104,24 @@ ep_session_get_session_provider (
 	const EventPipeSession *session,
 	const EventPipeProvider *provider);
 
+// Binds the sampling rate session_provider configures for event_id, if any, to the provider that owns the event.
+// Returns true when writes of the event are sampled in this session.
+// _Requires_lock_held (ep)
+bool
+ep_session_bind_event_sampler (
+	EventPipeSession *session,
+	const EventPipeSessionProvider *session_provider,
+	const EventPipeProvider *provider,
+	uint32_t event_id);
+
+// Binds the user_events tracepoint of session_provider to the provider that owns its events, if the session writes to user_events.
+// _Requires_lock_held (ep)
+void
+ep_session_bind_user_events_provider (
+	EventPipeSession *session,
+	const EventPipeSessionProvider *session_provider,
+	const EventPipeProvider *provider);
+
 // _Requires_lock_held (ep)
 bool
 ep_session_enable_rundown (EventPipeSession *session);
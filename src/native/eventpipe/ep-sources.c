@@ -12,6 +12,7 @@
 #include "ep-buffer.c"
 #include "ep-buffer-manager.c"
 #include "ep-config.c"
+#include "ep-counters.c"
 #include "ep-event.c"
 #include "ep-event-instance.c"
 #include "ep-event-payload.c"
@@ -26,6 +27,7 @@
 #include "ep-stack-contents.c"
 #include "ep-stream.c"
 #include "ep-thread.c"
+#include "ep-user-events.c"
 #endif
 
 #endif /* ENABLE_PERFTRACING */
@@ -230,7 +230,8 @@ ep_thread_get_or_create_session_state (
 	EventPipeThreadSessionState *state = thread->session_state [ep_session_get_index (session)];
 	if (!state) {
 		state = ep_thread_session_state_alloc (thread, session, ep_session_get_buffer_manager (session));
-		thread->session_state [ep_session_get_index (session)] = state;
+		// Publish the fully initialized state to lock free readers.
+		ep_rt_volatile_store_ptr ((volatile void **)&thread->session_state [ep_session_get_index (session)], state);
 	}
 
 	return state;
@@ -251,6 +252,18 @@ ep_thread_get_session_state (
 	return thread->session_state [ep_session_get_index (session)];
 }
 
+EventPipeThreadSessionState *
+ep_thread_get_volatile_session_state (
+	const EventPipeThread *thread,
+	EventPipeSession *session)
+{
+	EP_ASSERT (thread != NULL);
+	EP_ASSERT (session != NULL);
+	EP_ASSERT (ep_session_get_index (session) < EP_MAX_NUMBER_OF_SESSIONS);
+
+	return (EventPipeThreadSessionState *)ep_rt_volatile_load_ptr ((volatile void **)&thread->session_state [ep_session_get_index (session)]);
+}
+
 void
 ep_thread_delete_session_state (
 	EventPipeThread *thread,
@@ -264,9 +277,10 @@ ep_thread_delete_session_state (
 	uint32_t index = ep_session_get_index (session);
 	EP_ASSERT (index < EP_MAX_NUMBER_OF_SESSIONS);
 
-	EP_ASSERT (thread->session_state [index] != NULL);
-	ep_thread_session_state_free (thread->session_state [index]);
-	thread->session_state [index] = NULL;
+	EventPipeThreadSessionState *state = thread->session_state [index];
+	EP_ASSERT (state != NULL);
+	ep_rt_volatile_store_ptr ((volatile void **)&thread->session_state [index], NULL);
+	ep_thread_session_state_free (state);
 }
 
 #ifdef EP_CHECKED_BUILD
@@ -385,7 +399,7 @@ ep_thread_session_state_get_buffer_count_estimate(const EventPipeThreadSessionSt
 	// buffer_list is only set to NULL when the session is being freed
 	// when this code won't be called.
 	EventPipeBufferList *buffer_list = thread_session_state->buffer_list;
-	return buffer_list == NULL ? 0 : buffer_list->buffer_count;
+	return buffer_list == NULL ? 0 : buffer_list->buffer_count + buffer_list->pending_buffer_count;
 }
 
 void
@@ -453,6 +467,13 @@ ep_thread_session_state_set_buffer_list (
 	thread_session_state->buffer_list = new_buffer_list;
 }
 
+EventPipeBufferList *
+ep_thread_session_state_get_volatile_buffer_list (const EventPipeThreadSessionState *thread_session_state)
+{
+	EP_ASSERT (thread_session_state != NULL);
+	return thread_session_state->buffer_list;
+}
+
 uint32_t
 ep_thread_session_state_get_volatile_sequence_number (const EventPipeThreadSessionState *thread_session_state)
 {
@@ -21,8 +21,9 @@ struct _EventPipeThread {
 #else
 struct _EventPipeThread_Internal {
 #endif
-	// Per-session state.
-	// The pointers in this array are only read/written under rt_lock
+	// Per-session state, indexed by session index.
+	// The pointers in this array are only written under rt_lock, but the owning thread
+	// reads them without rt_lock (see ep_thread_get_volatile_session_state).
 	// Some of the data within the ThreadSessionState object can be accessed
 	// without rt_lock however, see the fields of that type for details.
 	EventPipeThreadSessionState *session_state [EP_MAX_NUMBER_OF_SESSIONS];
@@ -201,6 +202,14 @@ ep_thread_get_session_state (
 	const EventPipeThread *thread,
 	EventPipeSession *session);
 
+// Lock free lookup, returns NULL if the thread has no state for session yet.
+// Only valid on the thread owning the state while it writes events into session,
+// the state is only deleted once writes into the session have been suspended.
+EventPipeThreadSessionState *
+ep_thread_get_volatile_session_state (
+	const EventPipeThread *thread,
+	EventPipeSession *session);
+
 // _Requires_lock_held (thread)
 void
 ep_thread_delete_session_state (
@@ -337,6 +346,10 @@ ep_thread_session_state_set_buffer_list (
 	EventPipeThreadSessionState *thread_session_state,
 	EventPipeBufferList *new_buffer_list);
 
+// Only valid on the thread that owns the session state, which is the one that sets the buffer list.
+EventPipeBufferList *
+ep_thread_session_state_get_volatile_buffer_list (const EventPipeThreadSessionState *thread_session_state);
+
 uint32_t
 ep_thread_session_state_get_volatile_sequence_number (const EventPipeThreadSessionState *thread_session_state);
 
@@ -31,8 +31,12 @@ typedef struct _EventPipeProvider EventPipeProvider;
 typedef struct _EventPipeProviderCallbackData EventPipeProviderCallbackData;
 typedef struct _EventPipeProviderCallbackDataQueue EventPipeProviderCallbackDataQueue;
 typedef struct _EventPipeProviderConfiguration EventPipeProviderConfiguration;
+typedef struct _EventPipeProviderEventFilter EventPipeProviderEventFilter;
 typedef struct _EventPipeExecutionCheckpoint EventPipeExecutionCheckpoint;
 typedef struct _EventPipeSession EventPipeSession;
+typedef struct _EventPipeSessionEventSampler EventPipeSessionEventSampler;
+typedef struct _EventPipeUserEvents EventPipeUserEvents;
+typedef struct _EventPipeCounter EventPipeCounter;
 typedef struct _EventPipeSessionProvider EventPipeSessionProvider;
 typedef struct _EventPipeSessionProviderList EventPipeSessionProviderList;
 typedef struct _EventPipeSequencePoint EventPipeSequencePoint;
@@ -139,6 +143,9 @@ typedef enum {
 	// Default format we plan to use in .Net Core 3 Preview7+
 	// for most if not all scenarios.
 	EP_SERIALIZATION_FORMAT_NETTRACE_V4,
+	// NETTRACE_V4 with the contents of every block LZ4 compressed,
+	// for long running collection where trace size matters.
+	EP_SERIALIZATION_FORMAT_NETTRACE_V5,
 	EP_SERIALIZATION_FORMAT_COUNT
 } EventPipeSerializationFormat;
 
@@ -147,7 +154,9 @@ typedef enum {
 	EP_SESSION_TYPE_LISTENER,
 	EP_SESSION_TYPE_IPCSTREAM,
 	EP_SESSION_TYPE_SYNCHRONOUS,
-	EP_SESSION_TYPE_FILESTREAM
+	EP_SESSION_TYPE_FILESTREAM,
+	// Events are written to Linux user_events tracepoints instead of EventPipe buffers.
+	EP_SESSION_TYPE_USEREVENTS
 } EventPipeSessionType ;
 
 typedef enum {
@@ -172,6 +172,8 @@ struct _EventPipeProviderConfiguration_Internal {
 #endif
 	const ep_char8_t *provider_name;
 	const ep_char8_t *filter_data;
+	// Optional, NULL when only keywords and level select the events.
+	const EventPipeProviderEventFilter *event_filter;
 	uint64_t keywords;
 	EventPipeEventLevel logging_level;
 };
@@ -187,6 +189,8 @@ EP_DEFINE_GETTER(EventPipeProviderConfiguration *, provider_config, const ep_cha
 EP_DEFINE_GETTER(EventPipeProviderConfiguration *, provider_config, const ep_char8_t *, filter_data)
 EP_DEFINE_GETTER(EventPipeProviderConfiguration *, provider_config, uint64_t, keywords)
 EP_DEFINE_GETTER(EventPipeProviderConfiguration *, provider_config, EventPipeEventLevel, logging_level)
+EP_DEFINE_GETTER(EventPipeProviderConfiguration *, provider_config, const EventPipeProviderEventFilter *, event_filter)
+EP_DEFINE_SETTER(EventPipeProviderConfiguration *, provider_config, const EventPipeProviderEventFilter *, event_filter)
 
 EventPipeProviderConfiguration *
 ep_provider_config_init (
@@ -199,6 +203,46 @@ ep_provider_config_init (
 void
 ep_provider_config_fini (EventPipeProviderConfiguration *provider_config);
 
+/*
+ * EventPipeProviderEventFilter.
+ */
+
+#if defined(EP_INLINE_GETTER_SETTER) || defined(EP_IMPL_EP_GETTER_SETTER)
+struct _EventPipeProviderEventFilter {
+#else
+struct _EventPipeProviderEventFilter_Internal {
+#endif
+	// Event ids that are the only ones enabled (enable == true) or that are disabled (enable == false)
+	// among the events selected by the provider keywords and level.
+	const uint32_t *event_ids;
+	// sampling_rates_len pairs of event id and rate N, only every Nth write of the event is recorded.
+	const uint32_t *sampling_rates;
+	uint32_t event_ids_len;
+	uint32_t sampling_rates_len;
+	bool enable;
+};
+
+#if !defined(EP_INLINE_GETTER_SETTER) && !defined(EP_IMPL_EP_GETTER_SETTER)
+struct _EventPipeProviderEventFilter {
+	uint8_t _internal [sizeof (struct _EventPipeProviderEventFilter_Internal)];
+};
+#endif
+
+EP_DEFINE_GETTER(EventPipeProviderEventFilter *, provider_event_filter, const uint32_t *, event_ids)
+EP_DEFINE_GETTER(EventPipeProviderEventFilter *, provider_event_filter, const uint32_t *, sampling_rates)
+EP_DEFINE_GETTER(EventPipeProviderEventFilter *, provider_event_filter, uint32_t, event_ids_len)
+EP_DEFINE_GETTER(EventPipeProviderEventFilter *, provider_event_filter, uint32_t, sampling_rates_len)
+EP_DEFINE_GETTER(EventPipeProviderEventFilter *, provider_event_filter, bool, enable)
+
+EventPipeProviderEventFilter *
+ep_provider_event_filter_init (
+	EventPipeProviderEventFilter *event_filter,
+	bool enable,
+	const uint32_t *event_ids,
+	uint32_t event_ids_len,
+	const uint32_t *sampling_rates,
+	uint32_t sampling_rates_len);
+
 /*
  * EventPipeExecutionCheckpoint.
  */
@@ -269,6 +313,14 @@ ep_config_get_sample_profiler_provider_name_utf8 (void)
 	return "Microsoft-DotNETCore-SampleProfiler";
 }
 
+static
+inline
+const ep_char8_t *
+ep_config_get_native_counters_provider_name_utf8 (void)
+{
+	return "Microsoft-DotNETCore-NativeCounters";
+}
+
 /*
  * EventPipeSystemTime.
  */
@@ -0,0 +1,364 @@
+#include "ep-rt-config.h"
+
+#ifdef ENABLE_PERFTRACING
+#if !defined(EP_INCLUDE_SOURCE_FILES) || defined(EP_FORCE_INCLUDE_SOURCE_FILES)
+
+#define EP_IMPL_USER_EVENTS_GETTER_SETTER
+#include "ep.h"
+#include "ep-event.h"
+#include "ep-event-payload.h"
+#include "ep-provider.h"
+#include "ep-session-provider.h"
+#include "ep-user-events.h"
+#include "ep-rt.h"
+
+#if HAVE_LINUX_USER_EVENTS_H
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <sys/uio.h>
+#include <linux/user_events.h>
+
+#define USER_EVENTS_MAX_NAME_ARGS_LEN 512
+// __rel_loc sizes are 16 bit, larger payloads can't be written.
+#define USER_EVENTS_MAX_PAYLOAD_SIZE UINT16_MAX
+
+typedef struct _EventPipeUserEventsTracepoint {
+	const EventPipeSessionProvider *session_provider;
+	// Provider the tracepoint writes events of, bound under the EventPipe lock. Unused by the catch all tracepoint.
+	const EventPipeProvider *provider;
+	// Bit 0 is set by the kernel while at least one tracer has the tracepoint enabled.
+	volatile uint32_t enabled;
+	uint32_t write_index;
+	bool catch_all;
+	bool registered;
+} EventPipeUserEventsTracepoint;
+
+struct _EventPipeUserEvents {
+	EventPipeUserEventsTracepoint *tracepoints;
+	uint32_t tracepoints_len;
+	int data_fd;
+};
+
+// Fixed fields of every tracepoint, followed by the payload.
+typedef struct _EventPipeUserEventsHeader {
+	uint32_t event_id;
+	uint32_t event_version;
+	uint8_t activity_id [EP_ACTIVITY_ID_SIZE];
+	uint8_t related_activity_id [EP_ACTIVITY_ID_SIZE];
+	// Payload size in the high 16 bits, offset from the end of this field in the low 16 bits.
+	uint32_t payload_rel_loc;
+} EventPipeUserEventsHeader;
+
+/*
+ * Forward declares of all static functions.
+ */
+
+static
+int
+user_events_open_data_file (void);
+
+static
+bool
+user_events_register_tracepoint (
+	int data_fd,
+	EventPipeUserEventsTracepoint *tracepoint,
+	const ep_char8_t *provider_name);
+
+static
+void
+user_events_unregister_tracepoint (
+	int data_fd,
+	EventPipeUserEventsTracepoint *tracepoint);
+
+static
+EventPipeUserEventsTracepoint *
+user_events_find_tracepoint (
+	EventPipeUserEvents *user_events,
+	const EventPipeProvider *provider);
+
+/*
+ * EventPipeUserEvents.
+ */
+
+static
+int
+user_events_open_data_file (void)
+{
+	// tracefs is mounted at /sys/kernel/tracing on current kernels, older ones only have it under debugfs.
+	int fd = open ("/sys/kernel/tracing/user_events_data", O_RDWR | O_CLOEXEC);
+	if (fd == -1)
+		fd = open ("/sys/kernel/debug/tracing/user_events_data", O_RDWR | O_CLOEXEC);
+	return fd;
+}
+
+static
+bool
+user_events_register_tracepoint (
+	int data_fd,
+	EventPipeUserEventsTracepoint *tracepoint,
+	const ep_char8_t *provider_name)
+{
+	EP_ASSERT (tracepoint != NULL);
+	EP_ASSERT (provider_name != NULL);
+
+	// Tracepoint names are limited to C identifier characters.
+	ep_char8_t name [USER_EVENTS_MAX_NAME_ARGS_LEN / 2];
+	size_t name_len = 0;
+	for (const ep_char8_t *c = provider_name; *c && name_len < ARRAY_SIZE (name) - 1; ++c)
+		name [name_len++] = ((*c >= 'a' && *c <= 'z') || (*c >= 'A' && *c <= 'Z') || (*c >= '0' && *c <= '9')) ? *c : '_';
+	name [name_len] = '\0';
+
+	ep_char8_t name_args [USER_EVENTS_MAX_NAME_ARGS_LEN];
+	int32_t name_args_len = ep_rt_utf8_string_snprintf (
+		name_args,
+		ARRAY_SIZE (name_args),
+		"DotNET_%s u32 event_id; u32 event_version; u8 activity_id[%d]; u8 related_activity_id[%d]; __rel_loc u8[] payload",
+		name,
+		EP_ACTIVITY_ID_SIZE,
+		EP_ACTIVITY_ID_SIZE);
+	if (name_args_len <= 0 || name_args_len >= (int32_t)ARRAY_SIZE (name_args))
+		return false;
+
+	struct user_reg reg;
+	memset (&reg, 0, sizeof (reg));
+	reg.size = sizeof (reg);
+	reg.enable_bit = 0;
+	reg.enable_size = sizeof (tracepoint->enabled);
+	reg.enable_addr = (uint64_t)(uintptr_t)&tracepoint->enabled;
+	reg.name_args = (uint64_t)(uintptr_t)name_args;
+
+	if (ioctl (data_fd, DIAG_IOCSREG, &reg) == -1)
+		return false;
+
+	tracepoint->write_index = reg.write_index;
+	tracepoint->registered = true;
+	return true;
+}
+
+static
+void
+user_events_unregister_tracepoint (
+	int data_fd,
+	EventPipeUserEventsTracepoint *tracepoint)
+{
+	EP_ASSERT (tracepoint != NULL);
+
+	if (!tracepoint->registered)
+		return;
+
+	// Stops the kernel from updating the enable bit before the memory holding it goes away.
+	struct user_unreg unreg;
+	memset (&unreg, 0, sizeof (unreg));
+	unreg.size = sizeof (unreg);
+	unreg.disable_bit = 0;
+	unreg.disable_addr = (uint64_t)(uintptr_t)&tracepoint->enabled;
+
+	ioctl (data_fd, DIAG_IOCSUNREG, &unreg);
+	tracepoint->registered = false;
+}
+
+static
+EventPipeUserEventsTracepoint *
+user_events_find_tracepoint (
+	EventPipeUserEvents *user_events,
+	const EventPipeProvider *provider)
+{
+	EP_ASSERT (user_events != NULL);
+
+	for (uint32_t i = 0; i < user_events->tracepoints_len; ++i) {
+		EventPipeUserEventsTracepoint *tracepoint = &user_events->tracepoints [i];
+		if (tracepoint->catch_all || ep_rt_volatile_load_ptr ((volatile void **)&tracepoint->provider) == provider)
+			return tracepoint;
+	}
+
+	return NULL;
+}
+
+EventPipeUserEvents *
+ep_user_events_alloc (EventPipeSessionProviderList *providers)
+{
+	EP_ASSERT (providers != NULL);
+
+	ep_rt_session_provider_list_t *provider_list = ep_session_provider_list_get_providers_ref (providers);
+	EventPipeSessionProvider *catch_all = ep_session_provider_list_get_catch_all_provider (providers);
+	uint32_t registered_len = 0;
+
+	EventPipeUserEvents *instance = ep_rt_object_alloc (EventPipeUserEvents);
+	ep_raise_error_if_nok (instance != NULL);
+
+	instance->data_fd = user_events_open_data_file ();
+	ep_raise_error_if_nok (instance->data_fd != -1);
+
+	if (catch_all) {
+		instance->tracepoints_len = 1;
+	} else {
+		for (ep_rt_session_provider_list_iterator_t iterator = ep_rt_session_provider_list_iterator_begin (provider_list); !ep_rt_session_provider_list_iterator_end (provider_list, &iterator); ep_rt_session_provider_list_iterator_next (&iterator))
+			instance->tracepoints_len++;
+	}
+
+	ep_raise_error_if_nok (instance->tracepoints_len > 0);
+
+	instance->tracepoints = ep_rt_object_array_alloc (EventPipeUserEventsTracepoint, instance->tracepoints_len);
+	ep_raise_error_if_nok (instance->tracepoints != NULL);
+
+	if (catch_all) {
+		instance->tracepoints [0].session_provider = catch_all;
+		instance->tracepoints [0].catch_all = true;
+		if (user_events_register_tracepoint (instance->data_fd, &instance->tracepoints [0], "All"))
+			registered_len++;
+	} else {
+		uint32_t i = 0;
+		for (ep_rt_session_provider_list_iterator_t iterator = ep_rt_session_provider_list_iterator_begin (provider_list); !ep_rt_session_provider_list_iterator_end (provider_list, &iterator); ep_rt_session_provider_list_iterator_next (&iterator)) {
+			EventPipeSessionProvider *session_provider = ep_rt_session_provider_list_iterator_value (&iterator);
+			EventPipeUserEventsTracepoint *tracepoint = &instance->tracepoints [i++];
+			tracepoint->session_provider = session_provider;
+			if (user_events_register_tracepoint (instance->data_fd, tracepoint, ep_session_provider_get_provider_name (session_provider)))
+				registered_len++;
+		}
+	}
+
+	// Providers whose tracepoint couldn't be registered are skipped, fail only if there is nothing to write to.
+	ep_raise_error_if_nok (registered_len > 0);
+
+ep_on_exit:
+	return instance;
+
+ep_on_error:
+	ep_user_events_free (instance);
+
+	instance = NULL;
+	ep_exit_error_handler ();
+}
+
+void
+ep_user_events_free (EventPipeUserEvents *user_events)
+{
+	ep_return_void_if_nok (user_events != NULL);
+
+	if (user_events->data_fd != -1) {
+		for (uint32_t i = 0; i < user_events->tracepoints_len; ++i)
+			user_events_unregister_tracepoint (user_events->data_fd, &user_events->tracepoints [i]);
+		close (user_events->data_fd);
+	}
+
+	ep_rt_object_array_free (user_events->tracepoints);
+	ep_rt_object_free (user_events);
+}
+
+void
+ep_user_events_bind_provider (
+	EventPipeUserEvents *user_events,
+	const EventPipeSessionProvider *session_provider,
+	const EventPipeProvider *provider)
+{
+	EP_ASSERT (user_events != NULL);
+	EP_ASSERT (session_provider != NULL);
+	EP_ASSERT (provider != NULL);
+
+	ep_requires_lock_held ();
+
+	for (uint32_t i = 0; i < user_events->tracepoints_len; ++i) {
+		EventPipeUserEventsTracepoint *tracepoint = &user_events->tracepoints [i];
+		if (tracepoint->session_provider == session_provider && !tracepoint->catch_all) {
+			ep_rt_volatile_store_ptr ((volatile void **)&tracepoint->provider, (void *)provider);
+			return;
+		}
+	}
+}
+
+bool
+ep_user_events_write (
+	EventPipeUserEvents *user_events,
+	EventPipeEvent *ep_event,
+	EventPipeEventPayload *payload,
+	const uint8_t *activity_id,
+	const uint8_t *related_activity_id)
+{
+	EP_ASSERT (user_events != NULL);
+	EP_ASSERT (ep_event != NULL);
+
+	EventPipeUserEventsTracepoint *tracepoint = user_events_find_tracepoint (user_events, ep_event_get_provider (ep_event));
+
+	// Nothing is formatted unless a tracer listens, checking the enable bit is all the cost otherwise.
+	if (!tracepoint || !tracepoint->registered || !(ep_rt_volatile_load_uint32_t (&tracepoint->enabled) & 1))
+		return false;
+
+	uint32_t payload_size = payload ? ep_event_payload_get_size (payload) : 0;
+	uint8_t *payload_data = payload_size > 0 ? ep_event_payload_get_flat_data (payload) : NULL;
+	if (payload_size > USER_EVENTS_MAX_PAYLOAD_SIZE || (payload_size > 0 && !payload_data))
+		return false;
+
+	EventPipeUserEventsHeader header;
+	header.event_id = ep_event_get_event_id (ep_event);
+	header.event_version = ep_event_get_event_version (ep_event);
+	if (activity_id)
+		memcpy (header.activity_id, activity_id, EP_ACTIVITY_ID_SIZE);
+	else
+		memset (header.activity_id, 0, EP_ACTIVITY_ID_SIZE);
+	if (related_activity_id)
+		memcpy (header.related_activity_id, related_activity_id, EP_ACTIVITY_ID_SIZE);
+	else
+		memset (header.related_activity_id, 0, EP_ACTIVITY_ID_SIZE);
+	header.payload_rel_loc = payload_size << 16;
+
+	struct iovec io [3];
+	io [0].iov_base = &tracepoint->write_index;
+	io [0].iov_len = sizeof (tracepoint->write_index);
+	io [1].iov_base = &header;
+	io [1].iov_len = sizeof (header);
+	io [2].iov_base = payload_data;
+	io [2].iov_len = payload_size;
+
+	ssize_t written;
+	do {
+		written = writev (user_events->data_fd, io, payload_size > 0 ? 3 : 2);
+	} while (written == -1 && errno == EINTR);
+
+	return written != -1;
+}
+
+#else /* HAVE_LINUX_USER_EVENTS_H */
+
+EventPipeUserEvents *
+ep_user_events_alloc (EventPipeSessionProviderList *providers)
+{
+	return NULL;
+}
+
+void
+ep_user_events_free (EventPipeUserEvents *user_events)
+{
+	;
+}
+
+void
+ep_user_events_bind_provider (
+	EventPipeUserEvents *user_events,
+	const EventPipeSessionProvider *session_provider,
+	const EventPipeProvider *provider)
+{
+	;
+}
+
+bool
+ep_user_events_write (
+	EventPipeUserEvents *user_events,
+	EventPipeEvent *ep_event,
+	EventPipeEventPayload *payload,
+	const uint8_t *activity_id,
+	const uint8_t *related_activity_id)
+{
+	return false;
+}
+
+#endif /* HAVE_LINUX_USER_EVENTS_H */
+
+#endif /* !defined(EP_INCLUDE_SOURCE_FILES) || defined(EP_FORCE_INCLUDE_SOURCE_FILES) */
+#endif /* ENABLE_PERFTRACING */
+
+#if !defined(ENABLE_PERFTRACING) || (defined(EP_INCLUDE_SOURCE_FILES) && !defined(EP_FORCE_INCLUDE_SOURCE_FILES))
+extern const char quiet_linker_empty_file_warning_eventpipe_user_events;
+const char quiet_linker_empty_file_warning_eventpipe_user_events = 0;
+#endif
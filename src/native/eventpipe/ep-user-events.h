@@ -0,0 +1,47 @@
+#ifndef __EVENTPIPE_USER_EVENTS_H__
+#define __EVENTPIPE_USER_EVENTS_H__
+
+#include "ep-rt-config.h"
+
+#ifdef ENABLE_PERFTRACING
+#include "ep-types.h"
+
+#undef EP_IMPL_GETTER_SETTER
+#ifdef EP_IMPL_USER_EVENTS_GETTER_SETTER
+#define EP_IMPL_GETTER_SETTER
+#endif
+#include "ep-getter-setter.h"
+
+/*
+ * EventPipeUserEvents.
+ */
+
+// Writes the events of a session to Linux user_events tracepoints, one tracepoint per session provider.
+// Tracepoints are named DotNET_<provider name> and shared by every process registering them, so perf/ftrace
+// can collect them system wide without an EventPipe session per process.
+
+// Registers the tracepoints, NULL when user_events isn't available (non Linux, kernel or tracefs missing).
+EventPipeUserEvents *
+ep_user_events_alloc (EventPipeSessionProviderList *providers);
+
+void
+ep_user_events_free (EventPipeUserEvents *user_events);
+
+// Binds the tracepoint of session_provider to provider, called when event state of provider is refreshed.
+void
+ep_user_events_bind_provider (
+	EventPipeUserEvents *user_events,
+	const EventPipeSessionProvider *session_provider,
+	const EventPipeProvider *provider);
+
+// Returns false if the event wasn't written, either because no tracer enabled its tracepoint or the write failed.
+bool
+ep_user_events_write (
+	EventPipeUserEvents *user_events,
+	EventPipeEvent *ep_event,
+	EventPipeEventPayload *payload,
+	const uint8_t *activity_id,
+	const uint8_t *related_activity_id);
+
+#endif /* ENABLE_PERFTRACING */
+#endif /* __EVENTPIPE_USER_EVENTS_H__ */
@@ -7,6 +7,7 @@
 #include "ep.h"
 #include "ep-config.h"
 #include "ep-config-internals.h"
+#include "ep-counters.h"
 #include "ep-event.h"
 #include "ep-event-payload.h"
 #include "ep-event-source.h"
@@ -117,6 +118,10 @@ static
 bool
 session_requested_sampling (EventPipeSession *session);
 
+static
+void
+session_enable_counters (EventPipeSession *session);
+
 static
 bool
 ipc_stream_factory_any_suspended_ports (void);
@@ -362,6 +367,7 @@ ep_provider_config_init (
 	provider_config->keywords = keywords;
 	provider_config->logging_level = logging_level;
 	provider_config->filter_data = filter_data;
+	provider_config->event_filter = NULL;
 
 	// Runtime specific rundown provider configuration.
 	ep_rt_provider_config_init (provider_config);
@@ -375,6 +381,32 @@ ep_provider_config_fini (EventPipeProviderConfiguration *provider_config)
 	;
 }
 
+/*
+ * EventPipeProviderEventFilter.
+ */
+
+EventPipeProviderEventFilter *
+ep_provider_event_filter_init (
+	EventPipeProviderEventFilter *event_filter,
+	bool enable,
+	const uint32_t *event_ids,
+	uint32_t event_ids_len,
+	const uint32_t *sampling_rates,
+	uint32_t sampling_rates_len)
+{
+	EP_ASSERT (event_filter != NULL);
+	EP_ASSERT (event_ids_len == 0 || event_ids != NULL);
+	EP_ASSERT (sampling_rates_len == 0 || sampling_rates != NULL);
+
+	event_filter->enable = enable;
+	event_filter->event_ids = event_ids;
+	event_filter->event_ids_len = event_ids_len;
+	event_filter->sampling_rates = sampling_rates;
+	event_filter->sampling_rates_len = sampling_rates_len;
+
+	return event_filter;
+}
+
 /*
  * EventPipeExecutionCheckpoint.
  */
@@ -466,7 +498,7 @@ enable (
 	void *callback_additional_data)
 {
 	EP_ASSERT (format < EP_SERIALIZATION_FORMAT_COUNT);
-	EP_ASSERT (session_type == EP_SESSION_TYPE_SYNCHRONOUS || circular_buffer_size_in_mb > 0);
+	EP_ASSERT (session_type == EP_SESSION_TYPE_SYNCHRONOUS || session_type == EP_SESSION_TYPE_USEREVENTS || circular_buffer_size_in_mb > 0);
 	EP_ASSERT (providers_len > 0 && providers != NULL);
 
 	ep_requires_lock_held ();
@@ -511,6 +543,9 @@ enable (
 	// Register the SampleProfiler the very first time (if supported).
 	ep_sample_profiler_init (provider_callback_data_queue);
 
+	// Register the native counters provider the very first time.
+	ep_counters_init (provider_callback_data_queue);
+
 	// Enable the EventPipe EventSource.
 	ep_raise_error_if_nok (ep_event_source_enable (ep_event_source_get (), session));
 
@@ -531,6 +566,8 @@ enable (
 	if (session_requested_sampling (session))
 		ep_sample_profiler_enable ();
 
+	session_enable_counters (session);
+
 ep_on_exit:
 	ep_requires_lock_held ();
 	return session_id;
@@ -571,6 +608,9 @@ disable_holding_lock (
 			ep_sample_profiler_disable ();
 		}
 
+		// Stop sampling native counters for the session, if it did.
+		ep_counters_disable (session);
+
 		// Log the process information event.
 		log_process_info_event (ep_event_source_get ());
 
@@ -893,13 +933,23 @@ enable_default_session_via_env_variables (void)
 		output_path = ep_config_output_path ? ep_config_output_path : "trace.nettrace";
 		ep_circular_mb = ep_circular_mb > 0 ? ep_circular_mb : 1;
 
+		EventPipeSessionType session_type = ep_rt_config_value_get_output_streaming () ? EP_SESSION_TYPE_FILESTREAM : EP_SESSION_TYPE_FILE;
+		bool rundown_requested = true;
+
+		// Events go to the kernel tracepoints as they are written, there is no trace file to rundown into.
+		if (ep_rt_config_value_get_output_user_events ()) {
+			session_type = EP_SESSION_TYPE_USEREVENTS;
+			output_path = NULL;
+			rundown_requested = false;
+		}
+
 		uint64_t session_id = ep_enable_2 (
 			output_path,
 			ep_circular_mb,
 			ep_config,
-			ep_rt_config_value_get_output_streaming () ? EP_SESSION_TYPE_FILESTREAM : EP_SESSION_TYPE_FILE,
+			session_type,
 			EP_SERIALIZATION_FORMAT_NETTRACE_V4,
-			true,
+			rundown_requested,
 			NULL,
 			NULL,
 			NULL);
@@ -921,6 +971,19 @@ session_requested_sampling (EventPipeSession *session)
 	return ep_rt_session_provider_list_find_by_name (ep_session_provider_list_get_providers_cref (ep_session_get_providers (session)), ep_config_get_sample_profiler_provider_name_utf8 ());
 }
 
+static
+void
+session_enable_counters (EventPipeSession *session)
+{
+	EP_ASSERT (session != NULL);
+
+	ep_requires_lock_held ();
+
+	EventPipeSessionProvider *session_provider = ep_rt_session_provider_list_find_by_name (ep_session_provider_list_get_providers_cref (ep_session_get_providers (session)), ep_config_get_native_counters_provider_name_utf8 ());
+	if (session_provider)
+		ep_counters_enable (session, ep_session_provider_get_filter_data (session_provider));
+}
+
 static
 bool
 ipc_stream_factory_any_suspended_ports (void)
@@ -956,7 +1019,7 @@ ep_enable (
 	void *callback_additional_data)
 {
 	ep_return_zero_if_nok (format < EP_SERIALIZATION_FORMAT_COUNT);
-	ep_return_zero_if_nok (session_type == EP_SESSION_TYPE_SYNCHRONOUS || circular_buffer_size_in_mb > 0);
+	ep_return_zero_if_nok (session_type == EP_SESSION_TYPE_SYNCHRONOUS || session_type == EP_SESSION_TYPE_USEREVENTS || circular_buffer_size_in_mb > 0);
 	ep_return_zero_if_nok (providers_len > 0 && providers != NULL);
 
 	ep_requires_lock_not_held ();
@@ -1388,6 +1451,7 @@ ep_finish_init (void)
 		}
 
 		ep_sample_profiler_can_start_sampling ();
+		ep_counters_can_start_sampling ();
 	EP_LOCK_EXIT (section1)
 
 	// release lock in case someone tried to disable while we held it
@@ -1453,6 +1517,7 @@ ep_shutdown (void)
 
 	/*EP_LOCK_ENTER (section1)
 		ep_sample_profiler_shutdown ();
+		ep_counters_shutdown ();
 	EP_LOCK_EXIT (section1)*/
 
 	// // Remove EventPipeEventSource first since it tries to use the data structures that we remove below.
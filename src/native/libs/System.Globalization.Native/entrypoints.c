@@ -20,6 +20,7 @@ typedef uint16_t UChar;
 static const Entry s_globalizationNative[] =
 {
     DllImportEntry(GlobalizationNative_ChangeCase)
+    DllImportEntry(GlobalizationNative_ChangeCaseBulk)
     DllImportEntry(GlobalizationNative_ChangeCaseInvariant)
     DllImportEntry(GlobalizationNative_ChangeCaseTurkish)
     DllImportEntry(GlobalizationNative_CloseSortHandle)
@@ -15,6 +15,118 @@
 #pragma clang diagnostic ignored "-Wsign-conversion"
 #endif
 
+// Code units per block in the ASCII loops below, sized so the compiler turns each block into vector code.
+#define ASCII_BLOCK_LENGTH 16
+
+/*
+Upper cases the leading code units of lpSrc whose simple upper case mapping stays within Latin-1
+without calling into ICU, and returns how many were processed. That's all of Latin-1 except
+U+00B5 MICRO SIGN and U+00FF LATIN SMALL LETTER Y WITH DIAERESIS. With turkish set, 'i' is
+left to the caller as well.
+*/
+static inline int32_t ToUpperLatin1(const UChar* lpSrc, UChar* lpDst, int32_t length, bool turkish)
+{
+    int32_t i = 0;
+
+    for (; i + ASCII_BLOCK_LENGTH <= length; i += ASCII_BLOCK_LENGTH)
+    {
+        uint32_t bits = 0;
+        bool hasStop = false;
+
+        for (int32_t j = 0; j < ASCII_BLOCK_LENGTH; j++)
+        {
+            bits |= lpSrc[i + j];
+            hasStop |= turkish && lpSrc[i + j] == (UChar)0x0069;
+        }
+
+        if (bits >= 0x80 || hasStop)
+        {
+            break;
+        }
+
+        for (int32_t j = 0; j < ASCII_BLOCK_LENGTH; j++)
+        {
+            UChar c = lpSrc[i + j];
+            lpDst[i + j] = (UChar)((UChar)(c - 0x61) < 26 ? c - 0x20 : c);
+        }
+    }
+
+    for (; i < length; i++)
+    {
+        UChar c = lpSrc[i];
+
+        if (c >= 0x100 || c == 0xB5 || c == 0xFF || (turkish && c == 0x69))
+        {
+            break;
+        }
+
+        // a-z and U+00E0-U+00FE but U+00F7 DIVISION SIGN
+        lpDst[i] = (UChar)((UChar)(c - 0x61) < 26 || (c >= 0xE0 && c != 0xF7) ? c - 0x20 : c);
+    }
+
+    return i;
+}
+
+/*
+Lower cases the leading Latin-1 code units of lpSrc without calling into ICU, and returns how many
+were processed. With turkish set, 'I' is left to the caller.
+*/
+static inline int32_t ToLowerLatin1(const UChar* lpSrc, UChar* lpDst, int32_t length, bool turkish)
+{
+    int32_t i = 0;
+
+    for (; i + ASCII_BLOCK_LENGTH <= length; i += ASCII_BLOCK_LENGTH)
+    {
+        uint32_t bits = 0;
+        bool hasStop = false;
+
+        for (int32_t j = 0; j < ASCII_BLOCK_LENGTH; j++)
+        {
+            bits |= lpSrc[i + j];
+            hasStop |= turkish && lpSrc[i + j] == (UChar)0x0049;
+        }
+
+        if (bits >= 0x80 || hasStop)
+        {
+            break;
+        }
+
+        for (int32_t j = 0; j < ASCII_BLOCK_LENGTH; j++)
+        {
+            UChar c = lpSrc[i + j];
+            lpDst[i + j] = (UChar)((UChar)(c - 0x41) < 26 ? c + 0x20 : c);
+        }
+    }
+
+    for (; i < length; i++)
+    {
+        UChar c = lpSrc[i];
+
+        if (c >= 0x100 || (turkish && c == 0x49))
+        {
+            break;
+        }
+
+        // A-Z and U+00C0-U+00DE but U+00D7 MULTIPLICATION SIGN
+        lpDst[i] = (UChar)((UChar)(c - 0x41) < 26 || (c >= 0xC0 && c <= 0xDE && c != 0xD7) ? c + 0x20 : c);
+    }
+
+    return i;
+}
+
+// Runs the Latin-1 fast path at the current position of one of the casing loops below, and leaves
+// the loop once the whole string is done.
+#define CHANGE_CASE_LATIN1(fastPath, turkish)                                                    \
+    {                                                                                             \
+        int32_t latin1Length = fastPath(lpSrc + srcIdx, lpDst + dstIdx, cwSrcLength - srcIdx, turkish); \
+        srcIdx += latin1Length;                                                                   \
+        dstIdx += latin1Length;                                                                   \
+        if (srcIdx == cwSrcLength)                                                                \
+        {                                                                                         \
+            break;                                                                                \
+        }                                                                                         \
+    }
+
 /*
 Function:
 ChangeCase
@@ -44,6 +156,8 @@ void GlobalizationNative_ChangeCase(
     {
         while (srcIdx < cwSrcLength)
         {
+            CHANGE_CASE_LATIN1(ToUpperLatin1, false);
+
             U16_NEXT(lpSrc, srcIdx, cwSrcLength, srcCodepoint);
             dstCodepoint = u_toupper(srcCodepoint);
             U16_APPEND(lpDst, dstIdx, cwDstLength, dstCodepoint, isError);
@@ -54,6 +168,8 @@ void GlobalizationNative_ChangeCase(
     {
         while (srcIdx < cwSrcLength)
         {
+            CHANGE_CASE_LATIN1(ToLowerLatin1, false);
+
             U16_NEXT(lpSrc, srcIdx, cwSrcLength, srcCodepoint);
             dstCodepoint = u_tolower(srcCodepoint);
             U16_APPEND(lpDst, dstIdx, cwDstLength, dstCodepoint, isError);
@@ -84,6 +200,8 @@ void GlobalizationNative_ChangeCaseInvariant(
     {
         while (srcIdx < cwSrcLength)
         {
+            CHANGE_CASE_LATIN1(ToUpperLatin1, false);
+
             // On Windows with InvariantCulture, the LATIN SMALL LETTER DOTLESS I (U+0131)
             // capitalizes to itself, whereas with ICU it capitalizes to LATIN CAPITAL LETTER I (U+0049).
             // We special case it to match the Windows invariant behavior.
@@ -97,6 +215,8 @@ void GlobalizationNative_ChangeCaseInvariant(
     {
         while (srcIdx < cwSrcLength)
         {
+            CHANGE_CASE_LATIN1(ToLowerLatin1, false);
+
             // On Windows with InvariantCulture, the LATIN CAPITAL LETTER I WITH DOT ABOVE (U+0130)
             // lower cases to itself, whereas with ICU it lower cases to LATIN SMALL LETTER I (U+0069).
             // We special case it to match the Windows invariant behavior.
@@ -129,6 +249,8 @@ void GlobalizationNative_ChangeCaseTurkish(
     {
         while (srcIdx < cwSrcLength)
         {
+            CHANGE_CASE_LATIN1(ToUpperLatin1, true);
+
             // In turkish casing, LATIN SMALL LETTER I (U+0069) upper cases to LATIN
             // CAPITAL LETTER I WITH DOT ABOVE (U+0130).
             U16_NEXT(lpSrc, srcIdx, cwSrcLength, srcCodepoint);
@@ -141,6 +263,8 @@ void GlobalizationNative_ChangeCaseTurkish(
     {
         while (srcIdx < cwSrcLength)
         {
+            CHANGE_CASE_LATIN1(ToLowerLatin1, true);
+
             // In turkish casing, LATIN CAPITAL LETTER I (U+0049) lower cases to
             // LATIN SMALL LETTER DOTLESS I (U+0131).
             U16_NEXT(lpSrc, srcIdx, cwSrcLength, srcCodepoint);
@@ -151,6 +275,45 @@ void GlobalizationNative_ChangeCaseTurkish(
     }
 }
 
+/*
+Function:
+ChangeCaseBulk
+
+Performs upper or lower casing of segmentCount strings laid out back to back in lpSrc, the length of
+each given by pSegmentLengths, into the same layout in lpDst. This saves a call per string when
+managed code cases many short ones. Segments are cased separately so that a surrogate pair is never
+formed across two of them. casing is one of the CasingKind values.
+*/
+void GlobalizationNative_ChangeCaseBulk(const UChar* lpSrc,
+                                        const int32_t* pSegmentLengths,
+                                        int32_t segmentCount,
+                                        UChar* lpDst,
+                                        int32_t casing,
+                                        int32_t bToUpper)
+{
+    for (int32_t i = 0; i < segmentCount; i++)
+    {
+        int32_t length = pSegmentLengths[i];
+
+        switch (casing)
+        {
+            case CasingKind_Invariant:
+                GlobalizationNative_ChangeCaseInvariant(lpSrc, length, lpDst, length, bToUpper);
+                break;
+            case CasingKind_Turkish:
+                GlobalizationNative_ChangeCaseTurkish(lpSrc, length, lpDst, length, bToUpper);
+                break;
+            default:
+                assert(casing == CasingKind_Default);
+                GlobalizationNative_ChangeCase(lpSrc, length, lpDst, length, bToUpper);
+                break;
+        }
+
+        lpSrc += length;
+        lpDst += length;
+    }
+}
+
 void GlobalizationNative_InitOrdinalCasingPage(int32_t pageNumber, UChar* pTarget)
 {
     pageNumber <<= 8;
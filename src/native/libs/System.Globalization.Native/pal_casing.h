@@ -4,6 +4,13 @@
 #include "pal_locale.h"
 #include "pal_compiler.h"
 
+typedef enum
+{
+    CasingKind_Default = 0,
+    CasingKind_Invariant = 1,
+    CasingKind_Turkish = 2,
+} CasingKind;
+
 PALEXPORT void GlobalizationNative_ChangeCase(const UChar* lpSrc,
                                               int32_t cwSrcLength,
                                               UChar* lpDst,
@@ -22,4 +29,11 @@ PALEXPORT void GlobalizationNative_ChangeCaseTurkish(const UChar* lpSrc,
                                                      int32_t cwDstLength,
                                                      int32_t bToUpper);
 
+PALEXPORT void GlobalizationNative_ChangeCaseBulk(const UChar* lpSrc,
+                                                  const int32_t* pSegmentLengths,
+                                                  int32_t segmentCount,
+                                                  UChar* lpDst,
+                                                  int32_t casing,
+                                                  int32_t bToUpper);
+
 PALEXPORT void GlobalizationNative_InitOrdinalCasingPage(int32_t pageNumber, UChar* pTarget);
@@ -12,6 +12,11 @@
 #include "pal_collation.h"
 #include "pal_atomic.h"
 
+#if !defined(TARGET_WINDOWS)
+#include <pthread.h>
+#define USE_SORT_KEY_CACHE 1
+#endif
+
 c_static_assert_msg(UCOL_EQUAL == 0, "managed side requires 0 for equal strings");
 c_static_assert_msg(UCOL_LESS < 0, "managed side requires less than zero for a < b");
 c_static_assert_msg(UCOL_GREATER > 0, "managed side requires greater than zero for a > b");
@@ -57,8 +62,41 @@ struct SortHandle
 {
     UCollator* collatorsPerOption[CompareOptionsMask + 1];
     SearchIteratorNode searchIteratorList[CompareOptionsMask + 1];
+    uint64_t id; // Never reused, unlike the address, so per-thread caches can't confuse handles
 };
 
+#if USE_SORT_KEY_CACHE
+/*
+ * Managed code usually asks for a sort key twice, once for its length and once to fill the
+ * buffer, and hashing the same strings repeatedly is common. Each thread keeps the last few
+ * short sort keys so these calls don't need a lock and don't go back to ICU.
+ */
+#define SORT_KEY_CACHE_ENTRIES 4
+#define SORT_KEY_CACHE_MAX_STRING_LENGTH 128
+#define SORT_KEY_CACHE_MAX_KEY_LENGTH 512
+
+typedef struct
+{
+    uint64_t sortHandleId; // 0 for an unused entry
+    int32_t options;
+    int32_t stringLength;
+    int32_t sortKeyLength;
+    UChar string[SORT_KEY_CACHE_MAX_STRING_LENGTH];
+    uint8_t sortKey[SORT_KEY_CACHE_MAX_KEY_LENGTH];
+} SortKeyCacheEntry;
+
+typedef struct
+{
+    SortKeyCacheEntry entries[SORT_KEY_CACHE_ENTRIES];
+    int32_t next;
+} SortKeyCache;
+
+static uint64_t s_nextSortHandleId = 1;
+static pthread_once_t s_sortKeyCacheKeyOnce = PTHREAD_ONCE_INIT;
+static pthread_key_t s_sortKeyCacheKey;
+static int s_sortKeyCacheKeyCreated;
+#endif
+
 // Hiragana character range
 static const UChar hiraganaStart = 0x3041;
 static const UChar hiraganaEnd = 0x309e;
@@ -462,6 +500,10 @@ static void CreateSortHandle(SortHandle** ppSortHandle)
     }
 
     memset(*ppSortHandle, 0, sizeof(SortHandle));
+
+#if USE_SORT_KEY_CACHE
+    (*ppSortHandle)->id = __atomic_fetch_add(&s_nextSortHandleId, 1, __ATOMIC_RELAXED);
+#endif
 }
 
 ResultCode GlobalizationNative_GetSortHandle(const char* lpLocaleName, SortHandle** ppSortHandle)
@@ -924,6 +966,14 @@ int32_t GlobalizationNative_CompareString(
             lpStr2 = &dummyChar;
         }
 
+        // Canonically identical strings are equal under every collation, so code unit identical ones
+        // can skip ICU. Anything else, even plain ASCII, depends on the locale's tailoring.
+        if (cwStr1Length == cwStr2Length &&
+            (lpStr1 == lpStr2 || memcmp(lpStr1, lpStr2, (size_t)cwStr1Length * sizeof(UChar)) == 0))
+        {
+            return UCOL_EQUAL;
+        }
+
         result = ucol_strcoll(pColl, lpStr1, cwStr1Length, lpStr2, cwStr2Length);
     }
 
@@ -1341,6 +1391,97 @@ int32_t GlobalizationNative_EndsWith(
     return SimpleAffix(pCollator, &err, lpTarget, cwTargetLength, lpSource, cwSourceLength, false, pMatchedLength);
 }
 
+#if USE_SORT_KEY_CACHE
+static void FreeSortKeyCache(void* pCache)
+{
+    free(pCache);
+}
+
+static void CreateSortKeyCacheKey(void)
+{
+    s_sortKeyCacheKeyCreated = pthread_key_create(&s_sortKeyCacheKey, FreeSortKeyCache) == 0;
+}
+
+static SortKeyCache* GetSortKeyCache(void)
+{
+    pthread_once(&s_sortKeyCacheKeyOnce, CreateSortKeyCacheKey);
+
+    if (!s_sortKeyCacheKeyCreated)
+    {
+        return NULL;
+    }
+
+    SortKeyCache* pCache = (SortKeyCache*)pthread_getspecific(s_sortKeyCacheKey);
+
+    if (pCache == NULL)
+    {
+        pCache = (SortKeyCache*)calloc(1, sizeof(SortKeyCache));
+
+        if (pCache != NULL && pthread_setspecific(s_sortKeyCacheKey, pCache) != 0)
+        {
+            free(pCache);
+            pCache = NULL;
+        }
+    }
+
+    return pCache;
+}
+
+static int32_t GetCachedSortKey(
+    SortHandle* pSortHandle, const UCollator* pColl, const UChar* lpStr, int32_t cwStrLength, uint8_t* sortKey, int32_t cbSortKeyLength, int32_t options)
+{
+    SortKeyCache* pCache = GetSortKeyCache();
+
+    if (pCache == NULL)
+    {
+        return -1;
+    }
+
+    SortKeyCacheEntry* pEntry = NULL;
+
+    for (int32_t i = 0; i < SORT_KEY_CACHE_ENTRIES; i++)
+    {
+        SortKeyCacheEntry* pCandidate = &pCache->entries[i];
+
+        if (pCandidate->sortHandleId == pSortHandle->id &&
+            pCandidate->options == options &&
+            pCandidate->stringLength == cwStrLength &&
+            memcmp(pCandidate->string, lpStr, (size_t)cwStrLength * sizeof(UChar)) == 0)
+        {
+            pEntry = pCandidate;
+            break;
+        }
+    }
+
+    if (pEntry == NULL)
+    {
+        pEntry = &pCache->entries[pCache->next];
+
+        pEntry->sortHandleId = 0;
+        int32_t sortKeyLength = ucol_getSortKey(pColl, lpStr, cwStrLength, pEntry->sortKey, SORT_KEY_CACHE_MAX_KEY_LENGTH);
+
+        if (sortKeyLength <= 0 || sortKeyLength > SORT_KEY_CACHE_MAX_KEY_LENGTH)
+        {
+            return -1;
+        }
+
+        pEntry->sortHandleId = pSortHandle->id;
+        pEntry->options = options;
+        pEntry->stringLength = cwStrLength;
+        pEntry->sortKeyLength = sortKeyLength;
+        memcpy(pEntry->string, lpStr, (size_t)cwStrLength * sizeof(UChar));
+        pCache->next = (pCache->next + 1) % SORT_KEY_CACHE_ENTRIES;
+    }
+
+    if (sortKey != NULL && cbSortKeyLength > 0)
+    {
+        memcpy(sortKey, pEntry->sortKey, (size_t)(cbSortKeyLength < pEntry->sortKeyLength ? cbSortKeyLength : pEntry->sortKeyLength));
+    }
+
+    return pEntry->sortKeyLength;
+}
+#endif
+
 int32_t GlobalizationNative_GetSortKey(
                         SortHandle* pSortHandle,
                         const UChar* lpStr,
@@ -1355,6 +1496,18 @@ int32_t GlobalizationNative_GetSortKey(
 
     if (U_SUCCESS(err))
     {
+#if USE_SORT_KEY_CACHE
+        if (lpStr != NULL && cwStrLength >= 0 && cwStrLength <= SORT_KEY_CACHE_MAX_STRING_LENGTH)
+        {
+            result = GetCachedSortKey(pSortHandle, pColl, lpStr, cwStrLength, sortKey, cbSortKeyLength, options);
+
+            if (result >= 0)
+            {
+                return result;
+            }
+        }
+#endif
+
         result = ucol_getSortKey(pColl, lpStr, cwStrLength, sortKey, cbSortKeyLength);
     }
 
@@ -42,12 +42,6 @@ ucol_safeClone_func ucol_safeClone_ptr = NULL;
 
 #if defined (TARGET_UNIX)
 
-#define PER_FUNCTION_BLOCK(fn, lib, required) \
-    c_static_assert_msg((sizeof(#fn) + MaxICUVersionStringWithSuffixLength + 1) <= sizeof(symbolName), "The symbolName is too small for symbol " #fn); \
-    sprintf(symbolName, #fn "%s", symbolVersion); \
-    fn##_ptr = (TYPEOF(fn)*)dlsym(lib, symbolName); \
-    if (fn##_ptr == NULL && required) { fprintf(stderr, "Cannot get symbol %s from " #lib "\nError: %s\n", symbolName, dlerror()); abort(); }
-
 static int FindSymbolVersion(int majorVer, int minorVer, int subVer, char* symbolName, char* symbolVersion, char* suffix)
 {
     // Find out the format of the version string added to each symbol
@@ -90,11 +84,6 @@ static int FindSymbolVersion(int majorVer, int minorVer, int subVer, char* symbo
 
 #define sscanf sscanf_s
 
-#define PER_FUNCTION_BLOCK(fn, lib, required) \
-    sprintf_s(symbolName, SYMBOL_NAME_SIZE, #fn "%s", symbolVersion); \
-    fn##_ptr = (TYPEOF(fn)*)GetProcAddress((HMODULE)lib, symbolName); \
-    if (fn##_ptr == NULL && required) { fprintf(stderr, "Cannot get symbol %s from " #lib "\nError: %u\n", symbolName, GetLastError()); abort(); }
-
 static int FindICULibs(void)
 {
     libicuuc = LoadLibraryExW(L"icu.dll", NULL, LOAD_LIBRARY_SEARCH_SYSTEM32);
@@ -379,6 +368,47 @@ static int FindICULibs(const char* versionPrefix, char* symbolName, char* symbol
 
 #endif
 
+// Version suffix of the symbols in the loaded ICU libraries, e.g. "_72"
+static char s_symbolVersion[MaxICUVersionStringWithSuffixLength + 1];
+
+// Result of GlobalizationNative_LoadICU, -1 until the libraries were probed
+static int32_t s_loadICUResult = -1;
+
+// Set once the ICU functions can be resolved
+static bool s_icuFunctionsInitialized = false;
+
+static void* BindICUFunction(void* lib, const char* libName, const char* fn, bool required)
+{
+    char symbolName[SYMBOL_NAME_SIZE];
+    void* ptr;
+
+    assert(lib != NULL);
+
+#if defined(TARGET_WINDOWS)
+    sprintf_s(symbolName, SYMBOL_NAME_SIZE, "%s%s", fn, s_symbolVersion);
+    ptr = (void*)GetProcAddress((HMODULE)lib, symbolName);
+    if (ptr == NULL && required) { fprintf(stderr, "Cannot get symbol %s from %s\nError: %u\n", symbolName, libName, GetLastError()); abort(); }
+#else
+    sprintf(symbolName, "%s%s", fn, s_symbolVersion);
+    ptr = dlsym(lib, symbolName);
+    if (ptr == NULL && required) { fprintf(stderr, "Cannot get symbol %s from %s\nError: %s\n", symbolName, libName, dlerror()); abort(); }
+#endif
+
+    return ptr;
+}
+
+// Define the functions resolving each ICU function. Racing threads resolve the same address, so
+// the pointer is simply stored by each of them.
+#define PER_FUNCTION_BLOCK(fn, lib, required) \
+    TYPEOF(fn)* fn##_bind(void) \
+    { \
+        c_static_assert_msg((sizeof(#fn) + MaxICUVersionStringWithSuffixLength + 1) <= SYMBOL_NAME_SIZE, "The symbolName is too small for symbol " #fn); \
+        fn##_ptr = (TYPEOF(fn)*)BindICUFunction(lib, #lib, #fn, required); \
+        return fn##_ptr; \
+    }
+FOR_ALL_ICU_FUNCTIONS
+#undef PER_FUNCTION_BLOCK
+
 static void ValidateICUDataCanLoad(void)
 {
     UVersionInfo version;
@@ -444,13 +474,33 @@ static void InitializeVariableMaxAndTopPointers(char* symbolVersion)
     }
 }
 
+// Records the symbol version for the lazily resolved functions and resolves the optional
+// ones, whose pointers callers check before use.
+static void InitICUFunctionPointers(const char* symbolVersion)
+{
+    assert(strlen(symbolVersion) < sizeof(s_symbolVersion));
+    strcpy(s_symbolVersion, symbolVersion);
+
+#define PER_FUNCTION_BLOCK(fn, lib, required) fn##_bind();
+    FOR_ALL_OPTIONAL_ICU_FUNCTIONS
+#undef PER_FUNCTION_BLOCK
+
+    s_icuFunctionsInitialized = true;
+}
+
 // GlobalizationNative_LoadICU
 // This method get called from the managed side during the globalization initialization.
 // This method shouldn't get called at all if we are running in globalization invariant mode
 // return 0 if failed to load ICU and 1 otherwise
 int32_t GlobalizationNative_LoadICU(void)
 {
-    char symbolName[SYMBOL_NAME_SIZE];
+    if (s_loadICUResult != -1)
+    {
+        return s_loadICUResult;
+    }
+
+    s_loadICUResult = false;
+
     char symbolVersion[MaxICUVersionStringLength + 1]="";
 
 #if defined(TARGET_WINDOWS) || defined(TARGET_OSX)
@@ -461,11 +511,13 @@ int32_t GlobalizationNative_LoadICU(void)
     }
 
 #elif defined(TARGET_ANDROID)
+    char symbolName[SYMBOL_NAME_SIZE];
     if (!FindICULibs(symbolName, symbolVersion))
     {
         return false;
     }
 #else
+    char symbolName[SYMBOL_NAME_SIZE];
     if (!FindICULibs(VERSION_PREFIX_NONE, symbolName, symbolVersion))
     {
         if (!FindICULibs(VERSION_PREFIX_SUSE, symbolName, symbolVersion))
@@ -478,12 +530,13 @@ int32_t GlobalizationNative_LoadICU(void)
 #if defined(ANDROID_FORCE_ICU_DATA_DIR)
     setenv ("ICU_DATA", "/system/usr/icu/", 0);
 #endif
-    FOR_ALL_ICU_FUNCTIONS
+    InitICUFunctionPointers(symbolVersion);
     ValidateICUDataCanLoad();
 
     InitializeVariableMaxAndTopPointers(symbolVersion);
     InitializeUColClonePointers(symbolVersion);
 
+    s_loadICUResult = true;
     return true;
 }
 
@@ -535,24 +588,29 @@ void GlobalizationNative_InitICUFunctions(void* icuuc, void* icuin, const char*
         abort();
     }
 
-    FOR_ALL_ICU_FUNCTIONS
+    InitICUFunctionPointers(symbolVersion);
     ValidateICUDataCanLoad();
 
     InitializeVariableMaxAndTopPointers(symbolVersion);
     InitializeUColClonePointers(symbolVersion);
 }
 
-#undef PER_FUNCTION_BLOCK
-
 // GlobalizationNative_GetICUVersion
 // return the current loaded ICU version
 int32_t GlobalizationNative_GetICUVersion(void)
 {
-    if (u_getVersion_ptr == NULL)
+    static int32_t s_icuVersion = 0;
+
+    if (!s_icuFunctionsInitialized)
         return 0;
 
-    UVersionInfo versionInfo;
-    u_getVersion(versionInfo);
+    if (s_icuVersion == 0)
+    {
+        UVersionInfo versionInfo;
+        u_getVersion(versionInfo);
+
+        s_icuVersion = (versionInfo[0] << 24) + (versionInfo[1] << 16) + (versionInfo[2] << 8) + versionInfo[3];
+    }
 
-    return (versionInfo[0] << 24) + (versionInfo[1] << 16) + (versionInfo[2] << 8) + versionInfo[3];
+    return s_icuVersion;
 }
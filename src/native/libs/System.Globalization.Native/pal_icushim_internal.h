@@ -219,121 +219,127 @@ extern ucol_safeClone_func ucol_safeClone_ptr;
     FOR_ALL_OPTIONAL_ICU_FUNCTIONS \
     FOR_ALL_OS_CONDITIONAL_ICU_FUNCTIONS
 
-// Declare pointers to all the used ICU functions
-#define PER_FUNCTION_BLOCK(fn, lib, required) EXTERN_C TYPEOF(fn)* fn##_ptr;
+// Declare pointers to all the used ICU functions, and the functions that resolve them
+// in the loaded ICU libraries
+#define PER_FUNCTION_BLOCK(fn, lib, required) EXTERN_C TYPEOF(fn)* fn##_ptr; EXTERN_C TYPEOF(fn)* fn##_bind(void);
 FOR_ALL_ICU_FUNCTIONS
 #undef PER_FUNCTION_BLOCK
 
+// Only the optional functions are resolved during the initialization, so that apps which
+// never touch culture data don't pay for looking up every symbol at startup. The others
+// are resolved by the first call.
+#define ICU_FUNCTION(fn) (fn##_ptr != NULL ? fn##_ptr : fn##_bind())
+
 // Redefine all calls to ICU functions as calls through pointers that are set
-// to the functions of the selected version of ICU in the initialization.
-#define u_charsToUChars(...) u_charsToUChars_ptr(__VA_ARGS__)
-#define u_getVersion(...) u_getVersion_ptr(__VA_ARGS__)
-#define u_strcmp(...) u_strcmp_ptr(__VA_ARGS__)
-#define u_strcpy(...) u_strcpy_ptr(__VA_ARGS__)
-#define u_strlen(...) u_strlen_ptr(__VA_ARGS__)
-#define u_strncpy(...) u_strncpy_ptr(__VA_ARGS__)
-#define u_tolower(...) u_tolower_ptr(__VA_ARGS__)
-#define u_toupper(...) u_toupper_ptr(__VA_ARGS__)
-#define u_uastrncpy(...) u_uastrncpy_ptr(__VA_ARGS__)
-#define ubrk_close(...) ubrk_close_ptr(__VA_ARGS__)
-#define ubrk_openRules(...) ubrk_openRules_ptr(__VA_ARGS__)
-#define ucal_add(...) ucal_add_ptr(__VA_ARGS__)
-#define ucal_close(...) ucal_close_ptr(__VA_ARGS__)
-#define ucal_get(...) ucal_get_ptr(__VA_ARGS__)
-#define ucal_getAttribute(...) ucal_getAttribute_ptr(__VA_ARGS__)
-#define ucal_getKeywordValuesForLocale(...) ucal_getKeywordValuesForLocale_ptr(__VA_ARGS__)
-#define ucal_getLimit(...) ucal_getLimit_ptr(__VA_ARGS__)
-#define ucal_getNow(...) ucal_getNow_ptr(__VA_ARGS__)
-#define ucal_getTimeZoneDisplayName(...) ucal_getTimeZoneDisplayName_ptr(__VA_ARGS__)
-#define ucal_getTimeZoneIDForWindowsID(...) ucal_getTimeZoneIDForWindowsID_ptr(__VA_ARGS__)
-#define ucal_getWindowsTimeZoneID(...) ucal_getWindowsTimeZoneID_ptr(__VA_ARGS__)
-#define ucal_open(...) ucal_open_ptr(__VA_ARGS__)
-#define ucal_openTimeZoneIDEnumeration(...) ucal_openTimeZoneIDEnumeration_ptr(__VA_ARGS__)
-#define ucal_set(...) ucal_set_ptr(__VA_ARGS__)
-#define ucal_setMillis(...) ucal_setMillis_ptr(__VA_ARGS__)
-#define ucol_clone(...) ucol_clone_ptr(__VA_ARGS__)
-#define ucol_close(...) ucol_close_ptr(__VA_ARGS__)
-#define ucol_closeElements(...) ucol_closeElements_ptr(__VA_ARGS__)
-#define ucol_getOffset(...) ucol_getOffset_ptr(__VA_ARGS__)
-#define ucol_getRules(...) ucol_getRules_ptr(__VA_ARGS__)
-#define ucol_getSortKey(...) ucol_getSortKey_ptr(__VA_ARGS__)
-#define ucol_getStrength(...) ucol_getStrength_ptr(__VA_ARGS__)
-#define ucol_getVersion(...) ucol_getVersion_ptr(__VA_ARGS__)
-#define ucol_next(...) ucol_next_ptr(__VA_ARGS__)
-#define ucol_previous(...) ucol_previous_ptr(__VA_ARGS__)
-#define ucol_open(...) ucol_open_ptr(__VA_ARGS__)
-#define ucol_openElements(...) ucol_openElements_ptr(__VA_ARGS__)
-#define ucol_openRules(...) ucol_openRules_ptr(__VA_ARGS__)
-#define ucol_setAttribute(...) ucol_setAttribute_ptr(__VA_ARGS__)
-#define ucol_setMaxVariable(...) ucol_setMaxVariable_ptr(__VA_ARGS__)
-#define ucol_strcoll(...) ucol_strcoll_ptr(__VA_ARGS__)
-#define ucurr_forLocale(...) ucurr_forLocale_ptr(__VA_ARGS__)
-#define ucurr_getName(...) ucurr_getName_ptr(__VA_ARGS__)
-#define udat_close(...) udat_close_ptr(__VA_ARGS__)
-#define udat_countSymbols(...) udat_countSymbols_ptr(__VA_ARGS__)
-#define udat_format(...) udat_format_ptr(__VA_ARGS__)
-#define udat_getSymbols(...) udat_getSymbols_ptr(__VA_ARGS__)
-#define udat_open(...) udat_open_ptr(__VA_ARGS__)
-#define udat_setCalendar(...) udat_setCalendar_ptr(__VA_ARGS__)
-#define udat_toPattern(...) udat_toPattern_ptr(__VA_ARGS__)
-#define udatpg_close(...) udatpg_close_ptr(__VA_ARGS__)
-#define udatpg_getBestPattern(...) udatpg_getBestPattern_ptr(__VA_ARGS__)
-#define udatpg_open(...) udatpg_open_ptr(__VA_ARGS__)
-#define uenum_close(...) uenum_close_ptr(__VA_ARGS__)
-#define uenum_count(...) uenum_count_ptr(__VA_ARGS__)
-#define uenum_next(...) uenum_next_ptr(__VA_ARGS__)
-#define uidna_close(...) uidna_close_ptr(__VA_ARGS__)
-#define uidna_nameToASCII(...) uidna_nameToASCII_ptr(__VA_ARGS__)
-#define uidna_nameToUnicode(...) uidna_nameToUnicode_ptr(__VA_ARGS__)
-#define uidna_openUTS46(...) uidna_openUTS46_ptr(__VA_ARGS__)
-#define uldn_close(...) uldn_close_ptr(__VA_ARGS__)
-#define uldn_keyValueDisplayName(...) uldn_keyValueDisplayName_ptr(__VA_ARGS__)
-#define uldn_open(...) uldn_open_ptr(__VA_ARGS__)
-#define uloc_canonicalize(...) uloc_canonicalize_ptr(__VA_ARGS__)
-#define uloc_countAvailable(...) uloc_countAvailable_ptr(__VA_ARGS__)
-#define uloc_getAvailable(...) uloc_getAvailable_ptr(__VA_ARGS__)
-#define uloc_getBaseName(...) uloc_getBaseName_ptr(__VA_ARGS__)
-#define uloc_getCharacterOrientation(...) uloc_getCharacterOrientation_ptr(__VA_ARGS__)
-#define uloc_getCountry(...) uloc_getCountry_ptr(__VA_ARGS__)
-#define uloc_getDefault(...) uloc_getDefault_ptr(__VA_ARGS__)
-#define uloc_getDisplayCountry(...) uloc_getDisplayCountry_ptr(__VA_ARGS__)
-#define uloc_getDisplayLanguage(...) uloc_getDisplayLanguage_ptr(__VA_ARGS__)
-#define uloc_getDisplayName(...) uloc_getDisplayName_ptr(__VA_ARGS__)
-#define uloc_getISO3Country(...) uloc_getISO3Country_ptr(__VA_ARGS__)
-#define uloc_getISO3Language(...) uloc_getISO3Language_ptr(__VA_ARGS__)
-#define uloc_getKeywordValue(...) uloc_getKeywordValue_ptr(__VA_ARGS__)
-#define uloc_getLanguage(...) uloc_getLanguage_ptr(__VA_ARGS__)
-#define uloc_getLCID(...) uloc_getLCID_ptr(__VA_ARGS__)
-#define uloc_getName(...) uloc_getName_ptr(__VA_ARGS__)
-#define uloc_getParent(...) uloc_getParent_ptr(__VA_ARGS__)
-#define uloc_setKeywordValue(...) uloc_setKeywordValue_ptr(__VA_ARGS__)
-#define ulocdata_getCLDRVersion(...) ulocdata_getCLDRVersion_ptr(__VA_ARGS__)
-#define ulocdata_getMeasurementSystem(...) ulocdata_getMeasurementSystem_ptr(__VA_ARGS__)
-#define unorm2_getNFCInstance(...) unorm2_getNFCInstance_ptr(__VA_ARGS__)
-#define unorm2_getNFDInstance(...) unorm2_getNFDInstance_ptr(__VA_ARGS__)
-#define unorm2_getNFKCInstance(...) unorm2_getNFKCInstance_ptr(__VA_ARGS__)
-#define unorm2_getNFKDInstance(...) unorm2_getNFKDInstance_ptr(__VA_ARGS__)
-#define unorm2_isNormalized(...) unorm2_isNormalized_ptr(__VA_ARGS__)
-#define unorm2_normalize(...) unorm2_normalize_ptr(__VA_ARGS__)
-#define unum_close(...) unum_close_ptr(__VA_ARGS__)
-#define unum_getAttribute(...) unum_getAttribute_ptr(__VA_ARGS__)
-#define unum_getSymbol(...) unum_getSymbol_ptr(__VA_ARGS__)
-#define unum_open(...) unum_open_ptr(__VA_ARGS__)
-#define unum_toPattern(...) unum_toPattern_ptr(__VA_ARGS__)
-#define ures_close(...) ures_close_ptr(__VA_ARGS__)
-#define ures_getByKey(...) ures_getByKey_ptr(__VA_ARGS__)
-#define ures_getSize(...) ures_getSize_ptr(__VA_ARGS__)
-#define ures_getStringByIndex(...) ures_getStringByIndex_ptr(__VA_ARGS__)
-#define ures_open(...) ures_open_ptr(__VA_ARGS__)
-#define usearch_close(...) usearch_close_ptr(__VA_ARGS__)
-#define usearch_first(...) usearch_first_ptr(__VA_ARGS__)
-#define usearch_getBreakIterator(...) usearch_getBreakIterator_ptr(__VA_ARGS__)
-#define usearch_getMatchedLength(...) usearch_getMatchedLength_ptr(__VA_ARGS__)
-#define usearch_last(...) usearch_last_ptr(__VA_ARGS__)
-#define usearch_openFromCollator(...) usearch_openFromCollator_ptr(__VA_ARGS__)
-#define usearch_reset(...) usearch_reset_ptr(__VA_ARGS__)
-#define usearch_setPattern(...) usearch_setPattern_ptr(__VA_ARGS__)
-#define usearch_setText(...) usearch_setText_ptr(__VA_ARGS__)
+// to the functions of the selected version of ICU.
+#define u_charsToUChars(...) ICU_FUNCTION(u_charsToUChars)(__VA_ARGS__)
+#define u_getVersion(...) ICU_FUNCTION(u_getVersion)(__VA_ARGS__)
+#define u_strcmp(...) ICU_FUNCTION(u_strcmp)(__VA_ARGS__)
+#define u_strcpy(...) ICU_FUNCTION(u_strcpy)(__VA_ARGS__)
+#define u_strlen(...) ICU_FUNCTION(u_strlen)(__VA_ARGS__)
+#define u_strncpy(...) ICU_FUNCTION(u_strncpy)(__VA_ARGS__)
+#define u_tolower(...) ICU_FUNCTION(u_tolower)(__VA_ARGS__)
+#define u_toupper(...) ICU_FUNCTION(u_toupper)(__VA_ARGS__)
+#define u_uastrncpy(...) ICU_FUNCTION(u_uastrncpy)(__VA_ARGS__)
+#define ubrk_close(...) ICU_FUNCTION(ubrk_close)(__VA_ARGS__)
+#define ubrk_openRules(...) ICU_FUNCTION(ubrk_openRules)(__VA_ARGS__)
+#define ucal_add(...) ICU_FUNCTION(ucal_add)(__VA_ARGS__)
+#define ucal_close(...) ICU_FUNCTION(ucal_close)(__VA_ARGS__)
+#define ucal_get(...) ICU_FUNCTION(ucal_get)(__VA_ARGS__)
+#define ucal_getAttribute(...) ICU_FUNCTION(ucal_getAttribute)(__VA_ARGS__)
+#define ucal_getKeywordValuesForLocale(...) ICU_FUNCTION(ucal_getKeywordValuesForLocale)(__VA_ARGS__)
+#define ucal_getLimit(...) ICU_FUNCTION(ucal_getLimit)(__VA_ARGS__)
+#define ucal_getNow(...) ICU_FUNCTION(ucal_getNow)(__VA_ARGS__)
+#define ucal_getTimeZoneDisplayName(...) ICU_FUNCTION(ucal_getTimeZoneDisplayName)(__VA_ARGS__)
+#define ucal_getTimeZoneIDForWindowsID(...) ICU_FUNCTION(ucal_getTimeZoneIDForWindowsID)(__VA_ARGS__)
+#define ucal_getWindowsTimeZoneID(...) ICU_FUNCTION(ucal_getWindowsTimeZoneID)(__VA_ARGS__)
+#define ucal_open(...) ICU_FUNCTION(ucal_open)(__VA_ARGS__)
+#define ucal_openTimeZoneIDEnumeration(...) ICU_FUNCTION(ucal_openTimeZoneIDEnumeration)(__VA_ARGS__)
+#define ucal_set(...) ICU_FUNCTION(ucal_set)(__VA_ARGS__)
+#define ucal_setMillis(...) ICU_FUNCTION(ucal_setMillis)(__VA_ARGS__)
+#define ucol_clone(...) ICU_FUNCTION(ucol_clone)(__VA_ARGS__)
+#define ucol_close(...) ICU_FUNCTION(ucol_close)(__VA_ARGS__)
+#define ucol_closeElements(...) ICU_FUNCTION(ucol_closeElements)(__VA_ARGS__)
+#define ucol_getOffset(...) ICU_FUNCTION(ucol_getOffset)(__VA_ARGS__)
+#define ucol_getRules(...) ICU_FUNCTION(ucol_getRules)(__VA_ARGS__)
+#define ucol_getSortKey(...) ICU_FUNCTION(ucol_getSortKey)(__VA_ARGS__)
+#define ucol_getStrength(...) ICU_FUNCTION(ucol_getStrength)(__VA_ARGS__)
+#define ucol_getVersion(...) ICU_FUNCTION(ucol_getVersion)(__VA_ARGS__)
+#define ucol_next(...) ICU_FUNCTION(ucol_next)(__VA_ARGS__)
+#define ucol_previous(...) ICU_FUNCTION(ucol_previous)(__VA_ARGS__)
+#define ucol_open(...) ICU_FUNCTION(ucol_open)(__VA_ARGS__)
+#define ucol_openElements(...) ICU_FUNCTION(ucol_openElements)(__VA_ARGS__)
+#define ucol_openRules(...) ICU_FUNCTION(ucol_openRules)(__VA_ARGS__)
+#define ucol_setAttribute(...) ICU_FUNCTION(ucol_setAttribute)(__VA_ARGS__)
+#define ucol_setMaxVariable(...) ICU_FUNCTION(ucol_setMaxVariable)(__VA_ARGS__)
+#define ucol_strcoll(...) ICU_FUNCTION(ucol_strcoll)(__VA_ARGS__)
+#define ucurr_forLocale(...) ICU_FUNCTION(ucurr_forLocale)(__VA_ARGS__)
+#define ucurr_getName(...) ICU_FUNCTION(ucurr_getName)(__VA_ARGS__)
+#define udat_close(...) ICU_FUNCTION(udat_close)(__VA_ARGS__)
+#define udat_countSymbols(...) ICU_FUNCTION(udat_countSymbols)(__VA_ARGS__)
+#define udat_format(...) ICU_FUNCTION(udat_format)(__VA_ARGS__)
+#define udat_getSymbols(...) ICU_FUNCTION(udat_getSymbols)(__VA_ARGS__)
+#define udat_open(...) ICU_FUNCTION(udat_open)(__VA_ARGS__)
+#define udat_setCalendar(...) ICU_FUNCTION(udat_setCalendar)(__VA_ARGS__)
+#define udat_toPattern(...) ICU_FUNCTION(udat_toPattern)(__VA_ARGS__)
+#define udatpg_close(...) ICU_FUNCTION(udatpg_close)(__VA_ARGS__)
+#define udatpg_getBestPattern(...) ICU_FUNCTION(udatpg_getBestPattern)(__VA_ARGS__)
+#define udatpg_open(...) ICU_FUNCTION(udatpg_open)(__VA_ARGS__)
+#define uenum_close(...) ICU_FUNCTION(uenum_close)(__VA_ARGS__)
+#define uenum_count(...) ICU_FUNCTION(uenum_count)(__VA_ARGS__)
+#define uenum_next(...) ICU_FUNCTION(uenum_next)(__VA_ARGS__)
+#define uidna_close(...) ICU_FUNCTION(uidna_close)(__VA_ARGS__)
+#define uidna_nameToASCII(...) ICU_FUNCTION(uidna_nameToASCII)(__VA_ARGS__)
+#define uidna_nameToUnicode(...) ICU_FUNCTION(uidna_nameToUnicode)(__VA_ARGS__)
+#define uidna_openUTS46(...) ICU_FUNCTION(uidna_openUTS46)(__VA_ARGS__)
+#define uldn_close(...) ICU_FUNCTION(uldn_close)(__VA_ARGS__)
+#define uldn_keyValueDisplayName(...) ICU_FUNCTION(uldn_keyValueDisplayName)(__VA_ARGS__)
+#define uldn_open(...) ICU_FUNCTION(uldn_open)(__VA_ARGS__)
+#define uloc_canonicalize(...) ICU_FUNCTION(uloc_canonicalize)(__VA_ARGS__)
+#define uloc_countAvailable(...) ICU_FUNCTION(uloc_countAvailable)(__VA_ARGS__)
+#define uloc_getAvailable(...) ICU_FUNCTION(uloc_getAvailable)(__VA_ARGS__)
+#define uloc_getBaseName(...) ICU_FUNCTION(uloc_getBaseName)(__VA_ARGS__)
+#define uloc_getCharacterOrientation(...) ICU_FUNCTION(uloc_getCharacterOrientation)(__VA_ARGS__)
+#define uloc_getCountry(...) ICU_FUNCTION(uloc_getCountry)(__VA_ARGS__)
+#define uloc_getDefault(...) ICU_FUNCTION(uloc_getDefault)(__VA_ARGS__)
+#define uloc_getDisplayCountry(...) ICU_FUNCTION(uloc_getDisplayCountry)(__VA_ARGS__)
+#define uloc_getDisplayLanguage(...) ICU_FUNCTION(uloc_getDisplayLanguage)(__VA_ARGS__)
+#define uloc_getDisplayName(...) ICU_FUNCTION(uloc_getDisplayName)(__VA_ARGS__)
+#define uloc_getISO3Country(...) ICU_FUNCTION(uloc_getISO3Country)(__VA_ARGS__)
+#define uloc_getISO3Language(...) ICU_FUNCTION(uloc_getISO3Language)(__VA_ARGS__)
+#define uloc_getKeywordValue(...) ICU_FUNCTION(uloc_getKeywordValue)(__VA_ARGS__)
+#define uloc_getLanguage(...) ICU_FUNCTION(uloc_getLanguage)(__VA_ARGS__)
+#define uloc_getLCID(...) ICU_FUNCTION(uloc_getLCID)(__VA_ARGS__)
+#define uloc_getName(...) ICU_FUNCTION(uloc_getName)(__VA_ARGS__)
+#define uloc_getParent(...) ICU_FUNCTION(uloc_getParent)(__VA_ARGS__)
+#define uloc_setKeywordValue(...) ICU_FUNCTION(uloc_setKeywordValue)(__VA_ARGS__)
+#define ulocdata_getCLDRVersion(...) ICU_FUNCTION(ulocdata_getCLDRVersion)(__VA_ARGS__)
+#define ulocdata_getMeasurementSystem(...) ICU_FUNCTION(ulocdata_getMeasurementSystem)(__VA_ARGS__)
+#define unorm2_getNFCInstance(...) ICU_FUNCTION(unorm2_getNFCInstance)(__VA_ARGS__)
+#define unorm2_getNFDInstance(...) ICU_FUNCTION(unorm2_getNFDInstance)(__VA_ARGS__)
+#define unorm2_getNFKCInstance(...) ICU_FUNCTION(unorm2_getNFKCInstance)(__VA_ARGS__)
+#define unorm2_getNFKDInstance(...) ICU_FUNCTION(unorm2_getNFKDInstance)(__VA_ARGS__)
+#define unorm2_isNormalized(...) ICU_FUNCTION(unorm2_isNormalized)(__VA_ARGS__)
+#define unorm2_normalize(...) ICU_FUNCTION(unorm2_normalize)(__VA_ARGS__)
+#define unum_close(...) ICU_FUNCTION(unum_close)(__VA_ARGS__)
+#define unum_getAttribute(...) ICU_FUNCTION(unum_getAttribute)(__VA_ARGS__)
+#define unum_getSymbol(...) ICU_FUNCTION(unum_getSymbol)(__VA_ARGS__)
+#define unum_open(...) ICU_FUNCTION(unum_open)(__VA_ARGS__)
+#define unum_toPattern(...) ICU_FUNCTION(unum_toPattern)(__VA_ARGS__)
+#define ures_close(...) ICU_FUNCTION(ures_close)(__VA_ARGS__)
+#define ures_getByKey(...) ICU_FUNCTION(ures_getByKey)(__VA_ARGS__)
+#define ures_getSize(...) ICU_FUNCTION(ures_getSize)(__VA_ARGS__)
+#define ures_getStringByIndex(...) ICU_FUNCTION(ures_getStringByIndex)(__VA_ARGS__)
+#define ures_open(...) ICU_FUNCTION(ures_open)(__VA_ARGS__)
+#define usearch_close(...) ICU_FUNCTION(usearch_close)(__VA_ARGS__)
+#define usearch_first(...) ICU_FUNCTION(usearch_first)(__VA_ARGS__)
+#define usearch_getBreakIterator(...) ICU_FUNCTION(usearch_getBreakIterator)(__VA_ARGS__)
+#define usearch_getMatchedLength(...) ICU_FUNCTION(usearch_getMatchedLength)(__VA_ARGS__)
+#define usearch_last(...) ICU_FUNCTION(usearch_last)(__VA_ARGS__)
+#define usearch_openFromCollator(...) ICU_FUNCTION(usearch_openFromCollator)(__VA_ARGS__)
+#define usearch_reset(...) ICU_FUNCTION(usearch_reset)(__VA_ARGS__)
+#define usearch_setPattern(...) ICU_FUNCTION(usearch_setPattern)(__VA_ARGS__)
+#define usearch_setText(...) ICU_FUNCTION(usearch_setText)(__VA_ARGS__)
 
 #else // !defined(STATIC_ICU)
 
@@ -5,14 +5,47 @@
 #include <stdbool.h>
 #include <stdint.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "pal_errors_internal.h"
 #include "pal_locale_internal.h"
 #include "pal_timeZoneInfo.h"
 
+#if !defined(TARGET_WINDOWS)
+#include <limits.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <sys/stat.h>
+#include <time.h>
+#define USE_DISPLAY_NAME_CACHE 1
+#endif
+
 #define DISPLAY_NAME_LENGTH 256  // arbitrarily large, to be safe
 #define TZID_LENGTH 64           // arbitrarily large, to be safe
 
+#if defined(USE_DISPLAY_NAME_CACHE)
+// Process-wide cache of display names keyed by locale, zone and name type. ICU builds each name from the
+// zone and metazone resources, and the generic name fixup enumerates every zone with the same offset, so
+// listing or converting across many zones pays for this over and over.
+#define DISPLAY_NAME_CACHE_SIZE 256          // direct mapped, a new name replaces the one in its slot
+#define TZDATA_CHECK_INTERVAL_SECONDS 60     // how often the time zone database is checked for updates
+
+typedef struct
+{
+    uint32_t hash;                           // 0 for an empty slot
+    int32_t type;
+    char locale[ULOC_FULLNAME_CAPACITY];
+    UChar timeZoneId[TZID_LENGTH];
+    UChar name[DISPLAY_NAME_LENGTH];
+} DisplayNameCacheEntry;
+
+static DisplayNameCacheEntry* s_displayNameCache;
+static pthread_mutex_t s_displayNameCacheLock = PTHREAD_MUTEX_INITIALIZER;
+static time_t s_tzdataLastChecked;
+static time_t s_tzdataModified;
+static off_t s_tzdataSize;
+#endif
+
 // For descriptions of the following patterns, see https://unicode-org.github.io/icu/userguide/format_parse/datetime/#date-field-symbol-table
 static const UChar GENERIC_PATTERN_UCHAR[] = {'v', 'v', 'v', 'v', '\0'};           // u"vvvv"
 static const UChar GENERIC_LOCATION_PATTERN_UCHAR[] = {'V', 'V', 'V', 'V', '\0'};  // u"VVVV"
@@ -279,6 +312,124 @@ static void FixupTimeZoneGenericDisplayName(const char* locale, const UChar* tim
     ucal_close(calendar);
 }
 
+#if defined(USE_DISPLAY_NAME_CACHE)
+static uint32_t HashDisplayNameKey(const char* locale, const UChar* timeZoneId, int32_t timeZoneIdLength, int32_t type)
+{
+    // FNV-1a
+    uint32_t hash = 2166136261u ^ (uint32_t)type;
+
+    for (const char* p = locale; *p != '\0'; p++)
+    {
+        hash = (hash ^ (uint8_t)*p) * 16777619u;
+    }
+
+    for (int32_t i = 0; i < timeZoneIdLength; i++)
+    {
+        hash = (hash ^ timeZoneId[i]) * 16777619u;
+    }
+
+    return hash != 0 ? hash : 1;
+}
+
+/*
+Flushes the cache when the time zone database was updated, which is checked at most every
+TZDATA_CHECK_INTERVAL_SECONDS. Called with s_displayNameCacheLock held.
+*/
+static void CheckTzdataUpdated(void)
+{
+    time_t now = time(NULL);
+    if (now - s_tzdataLastChecked < TZDATA_CHECK_INTERVAL_SECONDS)
+    {
+        return;
+    }
+
+    s_tzdataLastChecked = now;
+
+    // Package updates rewrite tzdata.zi along with the zone files; fall back to the directory itself
+    // on systems which don't ship it.
+    const char* tzdir = getenv("TZDIR");
+    if (tzdir == NULL || tzdir[0] == '\0')
+    {
+        tzdir = "/usr/share/zoneinfo";
+    }
+
+    char path[PATH_MAX];
+    struct stat st;
+    snprintf(path, sizeof(path), "%s/tzdata.zi", tzdir);
+    if (stat(path, &st) != 0 && stat(tzdir, &st) != 0)
+    {
+        return;
+    }
+
+    if (st.st_mtime != s_tzdataModified || st.st_size != s_tzdataSize)
+    {
+        if (s_tzdataModified != 0 && s_displayNameCache != NULL)
+        {
+            memset(s_displayNameCache, 0, DISPLAY_NAME_CACHE_SIZE * sizeof(DisplayNameCacheEntry));
+        }
+
+        s_tzdataModified = st.st_mtime;
+        s_tzdataSize = st.st_size;
+    }
+}
+
+static int32_t GetCachedDisplayName(uint32_t hash, const char* locale, const UChar* timeZoneId, int32_t type, UChar* result, int32_t resultLength)
+{
+    int32_t found = false;
+
+    pthread_mutex_lock(&s_displayNameCacheLock);
+
+    CheckTzdataUpdated();
+
+    if (s_displayNameCache != NULL)
+    {
+        DisplayNameCacheEntry* pEntry = &s_displayNameCache[hash % DISPLAY_NAME_CACHE_SIZE];
+
+        if (pEntry->hash == hash &&
+            pEntry->type == type &&
+            strcmp(pEntry->locale, locale) == 0 &&
+            u_strcmp(pEntry->timeZoneId, timeZoneId) == 0 &&
+            u_strlen(pEntry->name) < resultLength)
+        {
+            u_strcpy(result, pEntry->name);
+            found = true;
+        }
+    }
+
+    pthread_mutex_unlock(&s_displayNameCacheLock);
+
+    return found;
+}
+
+static void AddCachedDisplayName(uint32_t hash, const char* locale, const UChar* timeZoneId, int32_t type, const UChar* name)
+{
+    if (strlen(locale) >= ULOC_FULLNAME_CAPACITY || u_strlen(name) >= DISPLAY_NAME_LENGTH)
+    {
+        return;
+    }
+
+    pthread_mutex_lock(&s_displayNameCacheLock);
+
+    if (s_displayNameCache == NULL)
+    {
+        s_displayNameCache = (DisplayNameCacheEntry*)calloc(DISPLAY_NAME_CACHE_SIZE, sizeof(DisplayNameCacheEntry));
+    }
+
+    if (s_displayNameCache != NULL)
+    {
+        DisplayNameCacheEntry* pEntry = &s_displayNameCache[hash % DISPLAY_NAME_CACHE_SIZE];
+
+        pEntry->hash = hash;
+        pEntry->type = type;
+        strcpy(pEntry->locale, locale);
+        u_strcpy(pEntry->timeZoneId, timeZoneId);
+        u_strcpy(pEntry->name, name);
+    }
+
+    pthread_mutex_unlock(&s_displayNameCacheLock);
+}
+#endif
+
 /*
 Gets the localized display name that is currently in effect for the specified time zone.
 */
@@ -308,6 +459,22 @@ ResultCode GlobalizationNative_GetTimeZoneDisplayName(const UChar* localeName, c
     //              For now, since TimeZoneInfo presently uses only a single set of display names, we will
     //              use the names associated with the *current* date and time.
 
+#if defined(USE_DISPLAY_NAME_CACHE)
+    // Zone IDs too long for the cache are looked up every time
+    int32_t timeZoneIdLength = u_strlen(timeZoneId);
+    uint32_t hash = 0;
+
+    if (timeZoneIdLength < TZID_LENGTH)
+    {
+        hash = HashDisplayNameKey(locale, timeZoneId, timeZoneIdLength, type);
+
+        if (GetCachedDisplayName(hash, locale, timeZoneId, type, result, resultLength))
+        {
+            return Success;
+        }
+    }
+#endif
+
     UDate timestamp = ucal_getNow();
 
     switch (type)
@@ -340,5 +507,12 @@ ResultCode GlobalizationNative_GetTimeZoneDisplayName(const UChar* localeName, c
             return UnknownError;
     }
 
+#if defined(USE_DISPLAY_NAME_CACHE)
+    if (hash != 0 && U_SUCCESS(err) && err != U_STRING_NOT_TERMINATED_WARNING)
+    {
+        AddCachedDisplayName(hash, locale, timeZoneId, type, result);
+    }
+#endif
+
     return GetResultCode(err);
 }
@@ -5,6 +5,7 @@
 
 // Include System.IO.Compression.Native headers
 #include "pal_zlib.h"
+#include "pal_zstd.h"
 #include <brotli/decode.h>
 #include <brotli/encode.h>
 #include <brotli/port.h>
@@ -24,6 +25,7 @@ static const Entry s_compressionNative[] =
     DllImportEntry(BrotliEncoderHasMoreOutput)
     DllImportEntry(BrotliEncoderSetParameter)
     DllImportEntry(CompressionNative_Crc32)
+    DllImportEntry(CompressionNative_Crc32Combine)
     DllImportEntry(CompressionNative_Deflate)
     DllImportEntry(CompressionNative_DeflateEnd)
     DllImportEntry(CompressionNative_DeflateReset)
@@ -32,6 +34,23 @@ static const Entry s_compressionNative[] =
     DllImportEntry(CompressionNative_InflateEnd)
     DllImportEntry(CompressionNative_InflateReset)
     DllImportEntry(CompressionNative_InflateInit2_)
+    DllImportEntry(CompressionNative_ParallelDeflate)
+    DllImportEntry(CompressionNative_ParallelDeflateBound)
+    DllImportEntry(CompressionNative_ParallelDeflateCreate)
+    DllImportEntry(CompressionNative_ParallelDeflateFree)
+    DllImportEntry(CompressionNative_ZstdCompressBound)
+    DllImportEntry(CompressionNative_ZstdCompressStream)
+    DllImportEntry(CompressionNative_ZstdCreateCompressor)
+    DllImportEntry(CompressionNative_ZstdCreateDecompressor)
+    DllImportEntry(CompressionNative_ZstdDecompressStream)
+    DllImportEntry(CompressionNative_ZstdFreeCompressor)
+    DllImportEntry(CompressionNative_ZstdFreeDecompressor)
+    DllImportEntry(CompressionNative_ZstdLoadCompressorDictionary)
+    DllImportEntry(CompressionNative_ZstdLoadDecompressorDictionary)
+    DllImportEntry(CompressionNative_ZstdResetCompressor)
+    DllImportEntry(CompressionNative_ZstdResetDecompressor)
+    DllImportEntry(CompressionNative_ZstdSetCompressorParameter)
+    DllImportEntry(CompressionNative_ZstdSetDecompressorParameter)
 };
 
 EXTERN_C const void* CompressionResolveDllImport(const char* name);
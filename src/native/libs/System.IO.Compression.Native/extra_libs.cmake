@@ -8,16 +8,30 @@ macro(append_extra_compression_libs NativeLibsExtra)
       set(ZLIB_LIBRARIES z)
   elseif (CLR_CMAKE_TARGET_SUNOS OR HOST_SOLARIS)
       set(ZLIB_LIBRARIES z m)
+  elseif (CLR_CMAKE_USE_SYSTEM_ZLIB_NG)
+      find_library(ZLIB_NG z-ng REQUIRED)
+      set(ZLIB_LIBRARIES ${ZLIB_NG} m)
   else ()
       find_package(ZLIB REQUIRED)
       set(ZLIB_LIBRARIES ${ZLIB_LIBRARIES} m)
   endif ()
   list(APPEND ${NativeLibsExtra} ${ZLIB_LIBRARIES})
 
+  # CompressionNative_ParallelDeflate
+  if (CLR_CMAKE_TARGET_FREEBSD OR HOST_FREEBSD)
+    list(APPEND ${NativeLibsExtra} pthread)
+  endif ()
+
   if (CLR_CMAKE_USE_SYSTEM_BROTLI)
     find_library(BROTLIDEC brotlidec REQUIRED)
     find_library(BROTLIENC brotlienc REQUIRED)
 
     list(APPEND ${NativeLibsExtra} ${BROTLIDEC} ${BROTLIENC})
   endif ()
+
+  if (CLR_CMAKE_USE_SYSTEM_ZSTD)
+    find_library(ZSTD zstd REQUIRED)
+
+    list(APPEND ${NativeLibsExtra} ${ZSTD})
+  endif ()
 endmacro()
@@ -3,13 +3,37 @@
 
 #include <assert.h>
 #include <stdlib.h>
+#include <string.h>
 #include "pal_zlib.h"
 
+#ifndef _WIN32
+    #include <pthread.h>
+#endif
+
 #ifdef INTERNAL_ZLIB
     #ifdef  _WIN32
         #define c_static_assert(e) static_assert((e),"")
     #endif
     #include <external/zlib/zlib.h>
+#elif defined(FEATURE_ZLIB_NG)
+    // zlib-ng's native API: the same semantics and constants as zlib behind zng_ prefixed names,
+    // with SIMD crc32/adler32/longest-match implementations picked at runtime from the CPU features.
+    #include "pal_utilities.h"
+    #include <zlib-ng.h>
+    #define z_stream zng_stream
+    #define deflateInit2 zng_deflateInit2
+    #define deflate zng_deflate
+    #define deflateReset zng_deflateReset
+    #define deflateEnd zng_deflateEnd
+    #define inflateInit2 zng_inflateInit2
+    #define inflate zng_inflate
+    #define inflateReset zng_inflateReset
+    #define inflateEnd zng_inflateEnd
+    #define crc32 zng_crc32
+    #define crc32_combine zng_crc32_combine
+    #define adler32 zng_adler32
+    #define adler32_combine zng_adler32_combine
+    #define deflateSetDictionary zng_deflateSetDictionary
 #else
     #include "pal_utilities.h"
     #include <zlib.h>
@@ -74,13 +98,14 @@ Transfers the output values from the underlying z_stream to the PAL_ZStream.
 */
 static void TransferStateToPalZStream(z_stream* from, PAL_ZStream* to)
 {
-    to->nextIn = from->next_in;
+    // zlib-ng declares next_in and msg const, the PAL_ZStream fields never write through them
+    to->nextIn = (uint8_t*)from->next_in;
     to->availIn = from->avail_in;
 
     to->nextOut = from->next_out;
     to->availOut = from->avail_out;
 
-    to->msg = from->msg;
+    to->msg = (char*)from->msg;
 }
 
 /*
@@ -215,3 +240,448 @@ uint32_t CompressionNative_Crc32(uint32_t crc, uint8_t* buffer, int32_t len)
     assert(result <= UINT32_MAX);
     return (uint32_t)result;
 }
+
+uint32_t CompressionNative_Crc32Combine(uint32_t crc1, uint32_t crc2, int64_t len2)
+{
+    assert(len2 >= 0);
+
+    // z_off_t is a 32-bit long on some platforms. Combining with the CRC of nothing shifts crc1
+    // over that many zero bytes, so long lengths are applied in steps.
+    const int64_t MaxStep = 0x40000000;
+    while (len2 > MaxStep)
+    {
+        crc1 = (uint32_t)crc32_combine(crc1, 0, (z_off_t)MaxStep);
+        len2 -= MaxStep;
+    }
+
+    return (uint32_t)crc32_combine(crc1, crc2, (z_off_t)len2);
+}
+
+/*
+Parallel deflate, in the manner of pigz: every block is compressed by its own raw deflate stream
+primed with the preceding 32K of input, and ended with a sync flush so that it finishes on a byte
+boundary, which lets the compressed blocks be concatenated into a single deflate stream. The
+checksums of the blocks are computed alongside and combined.
+*/
+
+enum
+{
+    ParallelDeflateFormatRaw = 0,
+    ParallelDeflateFormatZLib = 1,
+    ParallelDeflateFormatGZip = 2,
+
+    ParallelDeflateMaxDictionary = 32768,
+    ParallelDeflateMinBlockSize = 32768,
+    ParallelDeflateMaxThreads = 64,
+};
+
+typedef struct ParallelDeflate
+{
+    int32_t level;
+    int32_t windowBits; // of the raw deflate streams, 8..15
+    int32_t format;
+    int32_t threadCount;
+    int32_t blockSize;
+    int32_t headerWritten;
+    int32_t finished;
+
+    uint32_t check; // running CRC-32 (gzip) or Adler-32 (zlib)
+    uint64_t totalIn;
+
+    uint32_t dictionaryLength;
+    uint8_t dictionary[ParallelDeflateMaxDictionary];
+} ParallelDeflate;
+
+typedef struct ParallelDeflateBlock
+{
+    const uint8_t* input;
+    const uint8_t* dictionary;
+    uint8_t* output;
+    size_t outputCapacity;
+    size_t outputLength;
+    uint32_t inputLength;
+    uint32_t dictionaryLength;
+    uint32_t check;
+    int32_t last;
+    int32_t result;
+} ParallelDeflateBlock;
+
+typedef struct ParallelDeflateJob
+{
+    ParallelDeflate* compressor;
+    ParallelDeflateBlock* blocks;
+    int32_t blockCount;
+    volatile int32_t nextBlock;
+} ParallelDeflateJob;
+
+/*
+Worst case size of one compressed block: zlib's conservative deflateBound plus the sync flush marker.
+*/
+static size_t ParallelDeflateBlockBound(size_t length)
+{
+    return length + ((length + 7) >> 3) + ((length + 63) >> 6) + 5 + 6;
+}
+
+static void CompressParallelDeflateBlock(ParallelDeflate* compressor, ParallelDeflateBlock* block)
+{
+    z_stream zStream;
+    memset(&zStream, 0, sizeof(zStream));
+
+    int32_t result = deflateInit2(&zStream, compressor->level, Z_DEFLATED, -compressor->windowBits, 8, Z_DEFAULT_STRATEGY);
+    if (result == Z_OK && block->dictionaryLength != 0)
+    {
+        result = deflateSetDictionary(&zStream, block->dictionary, block->dictionaryLength);
+    }
+
+    if (result == Z_OK)
+    {
+        zStream.next_in = (uint8_t*)block->input;
+        zStream.avail_in = block->inputLength;
+        zStream.next_out = block->output;
+        zStream.avail_out = (uint32_t)block->outputCapacity;
+
+        result = deflate(&zStream, block->last ? Z_FINISH : Z_SYNC_FLUSH);
+
+        // A block must be fully flushed, running out of output space means the bound is wrong
+        if (block->last ? result == Z_STREAM_END : (result == Z_OK && zStream.avail_in == 0 && zStream.avail_out != 0))
+        {
+            result = Z_OK;
+            block->outputLength = block->outputCapacity - zStream.avail_out;
+        }
+        else if (result == Z_OK || result == Z_STREAM_END)
+        {
+            result = Z_BUF_ERROR;
+        }
+    }
+
+    deflateEnd(&zStream);
+
+    if (compressor->format == ParallelDeflateFormatGZip)
+    {
+        block->check = (uint32_t)crc32(0, block->input, block->inputLength);
+    }
+    else if (compressor->format == ParallelDeflateFormatZLib)
+    {
+        block->check = (uint32_t)adler32(1, block->input, block->inputLength);
+    }
+
+    block->result = result;
+}
+
+static void* ParallelDeflateWorker(void* arg)
+{
+    ParallelDeflateJob* job = (ParallelDeflateJob*)arg;
+
+    for (;;)
+    {
+#ifdef _WIN32
+        int32_t index = job->nextBlock++;
+#else
+        int32_t index = __atomic_fetch_add(&job->nextBlock, 1, __ATOMIC_RELAXED);
+#endif
+        if (index >= job->blockCount)
+        {
+            return NULL;
+        }
+
+        CompressParallelDeflateBlock(job->compressor, &job->blocks[index]);
+    }
+}
+
+static void RunParallelDeflateJob(ParallelDeflateJob* job, int32_t threadCount)
+{
+#ifndef _WIN32
+    pthread_t threads[ParallelDeflateMaxThreads];
+    int32_t started = 0;
+
+    // The calling thread is one of the workers. Where threads can't be created (e.g. single-threaded
+    // WebAssembly) it simply compresses every block itself.
+    for (int32_t i = 1; i < threadCount && i < job->blockCount; i++)
+    {
+        if (pthread_create(&threads[started], NULL, ParallelDeflateWorker, job) != 0)
+        {
+            break;
+        }
+        started++;
+    }
+
+    ParallelDeflateWorker(job);
+
+    for (int32_t i = 0; i < started; i++)
+    {
+        pthread_join(threads[i], NULL);
+    }
+#else
+    (void)threadCount;
+    ParallelDeflateWorker(job);
+#endif
+}
+
+static size_t WriteParallelDeflateHeader(ParallelDeflate* compressor, uint8_t* output)
+{
+    if (compressor->format == ParallelDeflateFormatGZip)
+    {
+        // No file name, modification time or extra fields; XFL as deflate writes it; OS unknown
+        uint8_t xfl = compressor->level == 9 ? 2 : compressor->level == 1 ? 4 : 0;
+        const uint8_t header[10] = { 0x1f, 0x8b, Z_DEFLATED, 0, 0, 0, 0, 0, xfl, 255 };
+        memcpy(output, header, sizeof(header));
+        return sizeof(header);
+    }
+
+    if (compressor->format == ParallelDeflateFormatZLib)
+    {
+        int32_t level = compressor->level;
+        uint32_t levelFlags = level >= 0 && level < 2 ? 0 : level >= 2 && level < 6 ? 1 : level == 6 || level == Z_DEFAULT_COMPRESSION ? 2 : 3;
+        uint32_t header = ((uint32_t)(Z_DEFLATED + ((compressor->windowBits - 8) << 4)) << 8) | (levelFlags << 6);
+        header += 31 - (header % 31);
+        output[0] = (uint8_t)(header >> 8);
+        output[1] = (uint8_t)header;
+        return 2;
+    }
+
+    return 0;
+}
+
+static size_t WriteParallelDeflateTrailer(ParallelDeflate* compressor, uint8_t* output)
+{
+    uint32_t check = compressor->check;
+
+    if (compressor->format == ParallelDeflateFormatGZip)
+    {
+        uint32_t size = (uint32_t)compressor->totalIn;
+        const uint8_t trailer[8] =
+        {
+            (uint8_t)check, (uint8_t)(check >> 8), (uint8_t)(check >> 16), (uint8_t)(check >> 24),
+            (uint8_t)size, (uint8_t)(size >> 8), (uint8_t)(size >> 16), (uint8_t)(size >> 24),
+        };
+        memcpy(output, trailer, sizeof(trailer));
+        return sizeof(trailer);
+    }
+
+    if (compressor->format == ParallelDeflateFormatZLib)
+    {
+        output[0] = (uint8_t)(check >> 24);
+        output[1] = (uint8_t)(check >> 16);
+        output[2] = (uint8_t)(check >> 8);
+        output[3] = (uint8_t)check;
+        return 4;
+    }
+
+    return 0;
+}
+
+void* CompressionNative_ParallelDeflateCreate(int32_t level, int32_t windowBits, int32_t threadCount, int32_t blockSize)
+{
+    int32_t format;
+    if (windowBits >= -15 && windowBits <= -8)
+    {
+        format = ParallelDeflateFormatRaw;
+        windowBits = -windowBits;
+    }
+    else if (windowBits >= 8 && windowBits <= 15)
+    {
+        format = ParallelDeflateFormatZLib;
+    }
+    else if (windowBits >= 24 && windowBits <= 31)
+    {
+        format = ParallelDeflateFormatGZip;
+        windowBits -= 16;
+    }
+    else
+    {
+        return NULL;
+    }
+
+    if (level < Z_DEFAULT_COMPRESSION || level > Z_BEST_COMPRESSION || threadCount <= 0)
+    {
+        return NULL;
+    }
+
+    ParallelDeflate* compressor = (ParallelDeflate*)calloc(1, sizeof(ParallelDeflate));
+    if (compressor == NULL)
+    {
+        return NULL;
+    }
+
+    compressor->level = level;
+    // Raw deflate streams reject a window of 8, zlib itself bumps it to 9 as well
+    compressor->windowBits = windowBits == 8 ? 9 : windowBits;
+    compressor->format = format;
+    compressor->threadCount = threadCount < ParallelDeflateMaxThreads ? threadCount : ParallelDeflateMaxThreads;
+    compressor->blockSize = blockSize > ParallelDeflateMinBlockSize ? blockSize : ParallelDeflateMinBlockSize;
+    compressor->check = format == ParallelDeflateFormatZLib ? 1 : 0;
+    return compressor;
+}
+
+int64_t CompressionNative_ParallelDeflateBound(void* compressor, int32_t inputLength)
+{
+    ParallelDeflate* parallelDeflate = (ParallelDeflate*)compressor;
+    assert(parallelDeflate != NULL);
+    assert(inputLength >= 0);
+
+    int64_t blockSize = parallelDeflate->blockSize;
+    int64_t fullBlocks = inputLength / blockSize;
+    int64_t bound = fullBlocks * (int64_t)ParallelDeflateBlockBound((size_t)blockSize) +
+                    (int64_t)ParallelDeflateBlockBound((size_t)(inputLength - fullBlocks * blockSize));
+
+    // Header and trailer
+    return bound + 10 + 8;
+}
+
+int32_t CompressionNative_ParallelDeflate(
+    void* compressor, uint8_t* input, int32_t inputLength, int32_t finish, uint8_t* output, int64_t outputLength, int64_t* written)
+{
+    ParallelDeflate* parallelDeflate = (ParallelDeflate*)compressor;
+    assert(parallelDeflate != NULL);
+    assert(written != NULL);
+
+    *written = 0;
+
+    if (parallelDeflate->finished || inputLength < 0 || (input == NULL && inputLength != 0) || output == NULL)
+    {
+        return PAL_Z_STREAMERROR;
+    }
+    if (outputLength < CompressionNative_ParallelDeflateBound(compressor, inputLength))
+    {
+        return PAL_Z_BUFERROR;
+    }
+
+    uint32_t blockSize = (uint32_t)parallelDeflate->blockSize;
+    int32_t blockCount = (int32_t)(((uint32_t)inputLength + blockSize - 1) / blockSize);
+    if (blockCount == 0 && finish)
+    {
+        // The final empty block
+        blockCount = 1;
+    }
+
+    ParallelDeflateBlock* blocks = NULL;
+    uint8_t* scratch = NULL;
+    size_t blockBound = ParallelDeflateBlockBound(blockSize);
+    if (blockCount != 0)
+    {
+        blocks = (ParallelDeflateBlock*)calloc((size_t)blockCount, sizeof(ParallelDeflateBlock));
+        scratch = (uint8_t*)malloc((size_t)blockCount * blockBound);
+        if (blocks == NULL || scratch == NULL)
+        {
+            free(blocks);
+            free(scratch);
+            return PAL_Z_MEMERROR;
+        }
+    }
+
+    uint32_t maxDictionary = 1u << parallelDeflate->windowBits;
+    if (maxDictionary > ParallelDeflateMaxDictionary)
+    {
+        maxDictionary = ParallelDeflateMaxDictionary;
+    }
+
+    for (int32_t i = 0; i < blockCount; i++)
+    {
+        ParallelDeflateBlock* block = &blocks[i];
+        uint32_t offset = (uint32_t)i * blockSize;
+
+        block->input = input != NULL ? input + offset : NULL;
+        block->inputLength = (uint32_t)inputLength - offset < blockSize ? (uint32_t)inputLength - offset : blockSize;
+        if (inputLength == 0)
+        {
+            block->inputLength = 0;
+        }
+        block->output = scratch + (size_t)i * blockBound;
+        block->outputCapacity = blockBound;
+        block->last = finish && i == blockCount - 1;
+
+        if (i == 0)
+        {
+            // The tail of the previous call's input
+            block->dictionary = parallelDeflate->dictionary + (parallelDeflate->dictionaryLength > maxDictionary ? parallelDeflate->dictionaryLength - maxDictionary : 0);
+            block->dictionaryLength = parallelDeflate->dictionaryLength < maxDictionary ? parallelDeflate->dictionaryLength : maxDictionary;
+        }
+        else
+        {
+            // Blocks are at least as large as the largest dictionary
+            block->dictionary = block->input - maxDictionary;
+            block->dictionaryLength = maxDictionary;
+        }
+    }
+
+    ParallelDeflateJob job;
+    job.compressor = parallelDeflate;
+    job.blocks = blocks;
+    job.blockCount = blockCount;
+    job.nextBlock = 0;
+    RunParallelDeflateJob(&job, parallelDeflate->threadCount);
+
+    int32_t result = PAL_Z_OK;
+    size_t position = 0;
+
+    if (!parallelDeflate->headerWritten)
+    {
+        position += WriteParallelDeflateHeader(parallelDeflate, output);
+        parallelDeflate->headerWritten = 1;
+    }
+
+    for (int32_t i = 0; i < blockCount && result == PAL_Z_OK; i++)
+    {
+        ParallelDeflateBlock* block = &blocks[i];
+        if (block->result != Z_OK)
+        {
+            result = block->result;
+            break;
+        }
+
+        memcpy(output + position, block->output, block->outputLength);
+        position += block->outputLength;
+
+        if (parallelDeflate->format == ParallelDeflateFormatGZip)
+        {
+            parallelDeflate->check = (uint32_t)crc32_combine(parallelDeflate->check, block->check, (z_off_t)block->inputLength);
+        }
+        else if (parallelDeflate->format == ParallelDeflateFormatZLib)
+        {
+            parallelDeflate->check = (uint32_t)adler32_combine(parallelDeflate->check, block->check, (z_off_t)block->inputLength);
+        }
+        parallelDeflate->totalIn += block->inputLength;
+    }
+
+    free(blocks);
+    free(scratch);
+
+    if (result != PAL_Z_OK)
+    {
+        // The stream can't be continued after a partial write
+        parallelDeflate->finished = 1;
+        return result;
+    }
+
+    // Keep the tail of the input to prime the first block of the next call
+    if (inputLength >= ParallelDeflateMaxDictionary)
+    {
+        memcpy(parallelDeflate->dictionary, input + inputLength - ParallelDeflateMaxDictionary, ParallelDeflateMaxDictionary);
+        parallelDeflate->dictionaryLength = ParallelDeflateMaxDictionary;
+    }
+    else if (inputLength > 0)
+    {
+        uint32_t keep = ParallelDeflateMaxDictionary - (uint32_t)inputLength;
+        if (keep > parallelDeflate->dictionaryLength)
+        {
+            keep = parallelDeflate->dictionaryLength;
+        }
+        memmove(parallelDeflate->dictionary, parallelDeflate->dictionary + parallelDeflate->dictionaryLength - keep, keep);
+        memcpy(parallelDeflate->dictionary + keep, input, (size_t)inputLength);
+        parallelDeflate->dictionaryLength = keep + (uint32_t)inputLength;
+    }
+
+    if (finish)
+    {
+        position += WriteParallelDeflateTrailer(parallelDeflate, output + position);
+        parallelDeflate->finished = 1;
+    }
+
+    *written = (int64_t)position;
+    return PAL_Z_OK;
+}
+
+void CompressionNative_ParallelDeflateFree(void* compressor)
+{
+    free(compressor);
+}
@@ -147,3 +147,41 @@ updated CRC-32.
 Returns the updated CRC-32.
 */
 FUNCTIONEXPORT uint32_t FUNCTIONCALLINGCONVENCTION CompressionNative_Crc32(uint32_t crc, uint8_t* buffer, int32_t len);
+
+/*
+Combines the CRC-32 crc1 of a first buffer with the CRC-32 crc2 of a second buffer of len2 bytes
+into the CRC-32 of both buffers, in O(log len2) time.
+
+Returns the combined CRC-32.
+*/
+FUNCTIONEXPORT uint32_t FUNCTIONCALLINGCONVENCTION CompressionNative_Crc32Combine(uint32_t crc1, uint32_t crc2, int64_t len2);
+
+/*
+Creates a parallel deflate compressor, which splits its input into blockSize byte blocks and compresses
+them on up to threadCount threads, each block primed with the last 32K of the preceding input. The blocks
+are stitched into a single stream whose format follows windowBits as in DeflateInit2_: raw deflate (-8..-15),
+zlib (8..15) or gzip (24..31).
+
+Returns NULL on invalid arguments or when out of memory.
+*/
+FUNCTIONEXPORT void* FUNCTIONCALLINGCONVENCTION CompressionNative_ParallelDeflateCreate(
+    int32_t level, int32_t windowBits, int32_t threadCount, int32_t blockSize);
+
+/*
+Returns an upper bound of the bytes CompressionNative_ParallelDeflate writes for inputLength bytes of input,
+including the header and trailer.
+*/
+FUNCTIONEXPORT int64_t FUNCTIONCALLINGCONVENCTION CompressionNative_ParallelDeflateBound(void* compressor, int32_t inputLength);
+
+/*
+Compresses inputLength bytes into output, which must hold CompressionNative_ParallelDeflateBound bytes.
+The compressed data of consecutive calls concatenates into one stream; the stream header is written by
+the first call and the trailer by the call with a non-zero finish, after which the compressor can't be used.
+Larger inputs (a few blocks per thread) make better use of the threads.
+
+Returns a PAL_ErrorCode indicating success or an error number on failure.
+*/
+FUNCTIONEXPORT int32_t FUNCTIONCALLINGCONVENCTION CompressionNative_ParallelDeflate(
+    void* compressor, uint8_t* input, int32_t inputLength, int32_t finish, uint8_t* output, int64_t outputLength, int64_t* written);
+
+FUNCTIONEXPORT void FUNCTIONCALLINGCONVENCTION CompressionNative_ParallelDeflateFree(void* compressor);
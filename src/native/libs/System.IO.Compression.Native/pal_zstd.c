@@ -0,0 +1,263 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+#include <assert.h>
+#include <stdlib.h>
+#include "pal_zstd.h"
+
+#ifdef FEATURE_ZSTD
+
+#include "pal_utilities.h"
+#include <zstd.h>
+#include <zstd_errors.h>
+
+c_static_assert((int)PAL_ZSTD_CONTINUE == (int)ZSTD_e_continue);
+c_static_assert((int)PAL_ZSTD_FLUSH == (int)ZSTD_e_flush);
+c_static_assert((int)PAL_ZSTD_END == (int)ZSTD_e_end);
+
+c_static_assert((int)PAL_ZSTD_C_COMPRESSIONLEVEL == (int)ZSTD_c_compressionLevel);
+c_static_assert((int)PAL_ZSTD_C_WINDOWLOG == (int)ZSTD_c_windowLog);
+c_static_assert((int)PAL_ZSTD_C_ENABLELONGDISTANCEMATCHING == (int)ZSTD_c_enableLongDistanceMatching);
+c_static_assert((int)PAL_ZSTD_C_CONTENTSIZEFLAG == (int)ZSTD_c_contentSizeFlag);
+c_static_assert((int)PAL_ZSTD_C_CHECKSUMFLAG == (int)ZSTD_c_checksumFlag);
+c_static_assert((int)PAL_ZSTD_C_NBWORKERS == (int)ZSTD_c_nbWorkers);
+c_static_assert((int)PAL_ZSTD_C_JOBSIZE == (int)ZSTD_c_jobSize);
+
+c_static_assert((int)PAL_ZSTD_D_WINDOWLOGMAX == (int)ZSTD_d_windowLogMax);
+
+/*
+Maps the result of a zstd function to a PAL_ZstdErrorCode.
+*/
+static int32_t ConvertResult(size_t result)
+{
+    if (!ZSTD_isError(result))
+    {
+        return PAL_ZSTD_OK;
+    }
+
+    switch (ZSTD_getErrorCode(result))
+    {
+        case ZSTD_error_parameter_unsupported:
+        case ZSTD_error_parameter_outOfBound:
+        case ZSTD_error_parameter_combination_unsupported:
+        case ZSTD_error_stage_wrong:
+            return PAL_ZSTD_PARAMETERERROR;
+        case ZSTD_error_prefix_unknown:
+        case ZSTD_error_version_unsupported:
+        case ZSTD_error_frameParameter_unsupported:
+        case ZSTD_error_frameParameter_windowTooLarge:
+        case ZSTD_error_corruption_detected:
+        case ZSTD_error_checksum_wrong:
+        case ZSTD_error_srcSize_wrong:
+            return PAL_ZSTD_DATAERROR;
+        case ZSTD_error_memory_allocation:
+            return PAL_ZSTD_MEMERROR;
+        case ZSTD_error_dictionary_corrupted:
+        case ZSTD_error_dictionary_wrong:
+        case ZSTD_error_dictionaryCreation_failed:
+            return PAL_ZSTD_DICTIONARYERROR;
+        default:
+            return PAL_ZSTD_ERROR;
+    }
+}
+
+void* CompressionNative_ZstdCreateCompressor(void)
+{
+    return ZSTD_createCCtx();
+}
+
+void CompressionNative_ZstdFreeCompressor(void* compressor)
+{
+    ZSTD_freeCCtx((ZSTD_CCtx*)compressor);
+}
+
+int32_t CompressionNative_ZstdSetCompressorParameter(void* compressor, int32_t parameter, int32_t value)
+{
+    assert(compressor != NULL);
+
+    size_t result = ZSTD_CCtx_setParameter((ZSTD_CCtx*)compressor, (ZSTD_cParameter)parameter, value);
+
+    // libzstd built without ZSTD_MULTITHREAD only accepts 0 workers
+    if (parameter == PAL_ZSTD_C_NBWORKERS && value != 0 && ZSTD_isError(result))
+    {
+        return PAL_ZSTD_NOTSUPPORTED;
+    }
+
+    return ConvertResult(result);
+}
+
+int32_t CompressionNative_ZstdLoadCompressorDictionary(void* compressor, uint8_t* dictionary, int32_t dictionaryLength)
+{
+    assert(compressor != NULL);
+    assert(dictionaryLength >= 0);
+
+    return ConvertResult(ZSTD_CCtx_loadDictionary((ZSTD_CCtx*)compressor, dictionary, dictionary != NULL ? (size_t)dictionaryLength : 0));
+}
+
+int32_t CompressionNative_ZstdCompressStream(void* compressor, PAL_ZstdBuffers* buffers, int32_t endDirective, uint32_t* remaining)
+{
+    assert(compressor != NULL);
+    assert(buffers != NULL);
+    assert(remaining != NULL);
+
+    ZSTD_inBuffer input = { buffers->nextIn, buffers->availIn, 0 };
+    ZSTD_outBuffer output = { buffers->nextOut, buffers->availOut, 0 };
+
+    size_t result = ZSTD_compressStream2((ZSTD_CCtx*)compressor, &output, &input, (ZSTD_EndDirective)endDirective);
+
+    buffers->nextIn += input.pos;
+    buffers->availIn -= (uint32_t)input.pos;
+    buffers->nextOut += output.pos;
+    buffers->availOut -= (uint32_t)output.pos;
+
+    *remaining = ZSTD_isError(result) ? 0 : (result > UINT32_MAX ? UINT32_MAX : (uint32_t)result);
+    return ConvertResult(result);
+}
+
+int32_t CompressionNative_ZstdResetCompressor(void* compressor)
+{
+    assert(compressor != NULL);
+
+    return ConvertResult(ZSTD_CCtx_reset((ZSTD_CCtx*)compressor, ZSTD_reset_session_only));
+}
+
+void* CompressionNative_ZstdCreateDecompressor(void)
+{
+    return ZSTD_createDCtx();
+}
+
+void CompressionNative_ZstdFreeDecompressor(void* decompressor)
+{
+    ZSTD_freeDCtx((ZSTD_DCtx*)decompressor);
+}
+
+int32_t CompressionNative_ZstdSetDecompressorParameter(void* decompressor, int32_t parameter, int32_t value)
+{
+    assert(decompressor != NULL);
+
+    return ConvertResult(ZSTD_DCtx_setParameter((ZSTD_DCtx*)decompressor, (ZSTD_dParameter)parameter, value));
+}
+
+int32_t CompressionNative_ZstdLoadDecompressorDictionary(void* decompressor, uint8_t* dictionary, int32_t dictionaryLength)
+{
+    assert(decompressor != NULL);
+    assert(dictionaryLength >= 0);
+
+    return ConvertResult(ZSTD_DCtx_loadDictionary((ZSTD_DCtx*)decompressor, dictionary, dictionary != NULL ? (size_t)dictionaryLength : 0));
+}
+
+int32_t CompressionNative_ZstdDecompressStream(void* decompressor, PAL_ZstdBuffers* buffers)
+{
+    assert(decompressor != NULL);
+    assert(buffers != NULL);
+
+    ZSTD_inBuffer input = { buffers->nextIn, buffers->availIn, 0 };
+    ZSTD_outBuffer output = { buffers->nextOut, buffers->availOut, 0 };
+
+    size_t result = ZSTD_decompressStream((ZSTD_DCtx*)decompressor, &output, &input);
+
+    buffers->nextIn += input.pos;
+    buffers->availIn -= (uint32_t)input.pos;
+    buffers->nextOut += output.pos;
+    buffers->availOut -= (uint32_t)output.pos;
+
+    // 0 means a frame was completely decoded and flushed
+    return result == 0 ? PAL_ZSTD_STREAMEND : ConvertResult(result);
+}
+
+int32_t CompressionNative_ZstdResetDecompressor(void* decompressor)
+{
+    assert(decompressor != NULL);
+
+    return ConvertResult(ZSTD_DCtx_reset((ZSTD_DCtx*)decompressor, ZSTD_reset_session_only));
+}
+
+uint64_t CompressionNative_ZstdCompressBound(uint64_t sourceLength)
+{
+    return ZSTD_compressBound((size_t)sourceLength);
+}
+
+#else // FEATURE_ZSTD
+
+// Built without libzstd: the entry points exist so the export lists stay the same on every
+// platform, and callers detect the missing support from the NULL contexts.
+
+void* CompressionNative_ZstdCreateCompressor(void)
+{
+    return NULL;
+}
+
+void CompressionNative_ZstdFreeCompressor(void* compressor)
+{
+    (void)compressor;
+}
+
+int32_t CompressionNative_ZstdSetCompressorParameter(void* compressor, int32_t parameter, int32_t value)
+{
+    (void)compressor, (void)parameter, (void)value;
+    return PAL_ZSTD_NOTSUPPORTED;
+}
+
+int32_t CompressionNative_ZstdLoadCompressorDictionary(void* compressor, uint8_t* dictionary, int32_t dictionaryLength)
+{
+    (void)compressor, (void)dictionary, (void)dictionaryLength;
+    return PAL_ZSTD_NOTSUPPORTED;
+}
+
+int32_t CompressionNative_ZstdCompressStream(void* compressor, PAL_ZstdBuffers* buffers, int32_t endDirective, uint32_t* remaining)
+{
+    (void)compressor, (void)buffers, (void)endDirective;
+    if (remaining != NULL)
+    {
+        *remaining = 0;
+    }
+    return PAL_ZSTD_NOTSUPPORTED;
+}
+
+int32_t CompressionNative_ZstdResetCompressor(void* compressor)
+{
+    (void)compressor;
+    return PAL_ZSTD_NOTSUPPORTED;
+}
+
+void* CompressionNative_ZstdCreateDecompressor(void)
+{
+    return NULL;
+}
+
+void CompressionNative_ZstdFreeDecompressor(void* decompressor)
+{
+    (void)decompressor;
+}
+
+int32_t CompressionNative_ZstdSetDecompressorParameter(void* decompressor, int32_t parameter, int32_t value)
+{
+    (void)decompressor, (void)parameter, (void)value;
+    return PAL_ZSTD_NOTSUPPORTED;
+}
+
+int32_t CompressionNative_ZstdLoadDecompressorDictionary(void* decompressor, uint8_t* dictionary, int32_t dictionaryLength)
+{
+    (void)decompressor, (void)dictionary, (void)dictionaryLength;
+    return PAL_ZSTD_NOTSUPPORTED;
+}
+
+int32_t CompressionNative_ZstdDecompressStream(void* decompressor, PAL_ZstdBuffers* buffers)
+{
+    (void)decompressor, (void)buffers;
+    return PAL_ZSTD_NOTSUPPORTED;
+}
+
+int32_t CompressionNative_ZstdResetDecompressor(void* decompressor)
+{
+    (void)decompressor;
+    return PAL_ZSTD_NOTSUPPORTED;
+}
+
+uint64_t CompressionNative_ZstdCompressBound(uint64_t sourceLength)
+{
+    (void)sourceLength;
+    return 0;
+}
+
+#endif // FEATURE_ZSTD
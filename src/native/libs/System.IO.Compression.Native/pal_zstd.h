@@ -0,0 +1,160 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+#pragma once
+
+#ifdef _WIN32
+    #include <stdint.h>
+    #include <windows.h>
+    #ifndef FUNCTIONEXPORT
+        #define FUNCTIONEXPORT
+        #define FUNCTIONCALLINGCONVENCTION WINAPI
+    #endif
+#else
+    #include "pal_types.h"
+    #include "pal_compiler.h"
+    #ifndef FUNCTIONEXPORT
+        #define FUNCTIONEXPORT PALEXPORT
+        #define FUNCTIONCALLINGCONVENCTION
+    #endif
+#endif
+
+/*
+A structure that holds the input and output buffers of a streaming zstd operation,
+laid out like the buffer fields of PAL_ZStream.
+*/
+typedef struct PAL_ZstdBuffers
+{
+    uint8_t* nextIn;  // next input byte
+    uint8_t* nextOut; // next output byte should be put there
+
+    uint32_t availIn;  // number of bytes available at nextIn
+    uint32_t availOut; // remaining free space at nextOut
+} PAL_ZstdBuffers;
+
+/*
+Error codes from the zstd functions.
+*/
+enum PAL_ZstdErrorCode
+{
+    PAL_ZSTD_OK = 0,
+    PAL_ZSTD_STREAMEND = 1,       // a frame was fully decompressed
+    PAL_ZSTD_ERROR = -1,          // any error not listed below
+    PAL_ZSTD_PARAMETERERROR = -2,
+    PAL_ZSTD_DATAERROR = -3,      // corrupted input or checksum mismatch
+    PAL_ZSTD_MEMERROR = -4,
+    PAL_ZSTD_DICTIONARYERROR = -5,
+    PAL_ZSTD_NOTSUPPORTED = -6,   // built without zstd, or without multithreading for ZSTD_c_nbWorkers
+};
+
+/*
+End directives for CompressionNative_ZstdCompressStream, the values of ZSTD_EndDirective.
+*/
+enum PAL_ZstdEndDirective
+{
+    PAL_ZSTD_CONTINUE = 0,
+    PAL_ZSTD_FLUSH = 1,
+    PAL_ZSTD_END = 2,
+};
+
+/*
+Compression parameters, the values of the corresponding ZSTD_cParameter.
+*/
+enum PAL_ZstdCompressionParameter
+{
+    PAL_ZSTD_C_COMPRESSIONLEVEL = 100,
+    PAL_ZSTD_C_WINDOWLOG = 101,
+    PAL_ZSTD_C_ENABLELONGDISTANCEMATCHING = 160,
+    PAL_ZSTD_C_CONTENTSIZEFLAG = 200,
+    PAL_ZSTD_C_CHECKSUMFLAG = 201,
+    PAL_ZSTD_C_NBWORKERS = 400,
+    PAL_ZSTD_C_JOBSIZE = 401,
+};
+
+/*
+Decompression parameters, the values of the corresponding ZSTD_dParameter.
+*/
+enum PAL_ZstdDecompressionParameter
+{
+    PAL_ZSTD_D_WINDOWLOGMAX = 100,
+};
+
+/*
+Creates a compression context. Returns NULL if out of memory or when built without zstd.
+*/
+FUNCTIONEXPORT void* FUNCTIONCALLINGCONVENCTION CompressionNative_ZstdCreateCompressor(void);
+
+FUNCTIONEXPORT void FUNCTIONCALLINGCONVENCTION CompressionNative_ZstdFreeCompressor(void* compressor);
+
+/*
+Sets a PAL_ZstdCompressionParameter for the next frame. A non-zero PAL_ZSTD_C_NBWORKERS compresses
+on that many background threads, CompressionNative_ZstdCompressStream then returns without waiting
+for all of the input to be compressed.
+
+Returns a PAL_ZstdErrorCode indicating success or an error number on failure.
+*/
+FUNCTIONEXPORT int32_t FUNCTIONCALLINGCONVENCTION CompressionNative_ZstdSetCompressorParameter(void* compressor, int32_t parameter, int32_t value);
+
+/*
+Loads a dictionary used by all following frames, a NULL dictionary removes it. The dictionary is copied.
+
+Returns a PAL_ZstdErrorCode indicating success or an error number on failure.
+*/
+FUNCTIONEXPORT int32_t FUNCTIONCALLINGCONVENCTION CompressionNative_ZstdLoadCompressorDictionary(void* compressor, uint8_t* dictionary, int32_t dictionaryLength);
+
+/*
+Compresses the bytes in nextIn into nextOut. With PAL_ZSTD_FLUSH or PAL_ZSTD_END, *remaining is set to
+the number of bytes still buffered in the context; the call must be repeated until it reaches 0.
+
+Returns a PAL_ZstdErrorCode indicating success or an error number on failure.
+*/
+FUNCTIONEXPORT int32_t FUNCTIONCALLINGCONVENCTION CompressionNative_ZstdCompressStream(
+    void* compressor, PAL_ZstdBuffers* buffers, int32_t endDirective, uint32_t* remaining);
+
+/*
+Abandons the current frame, keeping the parameters and dictionary.
+
+Returns a PAL_ZstdErrorCode indicating success or an error number on failure.
+*/
+FUNCTIONEXPORT int32_t FUNCTIONCALLINGCONVENCTION CompressionNative_ZstdResetCompressor(void* compressor);
+
+/*
+Creates a decompression context. Returns NULL if out of memory or when built without zstd.
+*/
+FUNCTIONEXPORT void* FUNCTIONCALLINGCONVENCTION CompressionNative_ZstdCreateDecompressor(void);
+
+FUNCTIONEXPORT void FUNCTIONCALLINGCONVENCTION CompressionNative_ZstdFreeDecompressor(void* decompressor);
+
+/*
+Sets a PAL_ZstdDecompressionParameter.
+
+Returns a PAL_ZstdErrorCode indicating success or an error number on failure.
+*/
+FUNCTIONEXPORT int32_t FUNCTIONCALLINGCONVENCTION CompressionNative_ZstdSetDecompressorParameter(void* decompressor, int32_t parameter, int32_t value);
+
+/*
+Loads the dictionary frames were compressed with, a NULL dictionary removes it. The dictionary is copied.
+
+Returns a PAL_ZstdErrorCode indicating success or an error number on failure.
+*/
+FUNCTIONEXPORT int32_t FUNCTIONCALLINGCONVENCTION CompressionNative_ZstdLoadDecompressorDictionary(void* decompressor, uint8_t* dictionary, int32_t dictionaryLength);
+
+/*
+Decompresses the bytes in nextIn into nextOut.
+
+Returns PAL_ZSTD_STREAMEND when a frame was completed and flushed, PAL_ZSTD_OK when more input or
+output space is needed, or an error number on failure.
+*/
+FUNCTIONEXPORT int32_t FUNCTIONCALLINGCONVENCTION CompressionNative_ZstdDecompressStream(void* decompressor, PAL_ZstdBuffers* buffers);
+
+/*
+Abandons the current frame, keeping the parameters and dictionary.
+
+Returns a PAL_ZstdErrorCode indicating success or an error number on failure.
+*/
+FUNCTIONEXPORT int32_t FUNCTIONCALLINGCONVENCTION CompressionNative_ZstdResetDecompressor(void* decompressor);
+
+/*
+Returns the maximum compressed size of a single frame of sourceLength bytes, or 0 when built without zstd.
+*/
+FUNCTIONEXPORT uint64_t FUNCTIONCALLINGCONVENCTION CompressionNative_ZstdCompressBound(uint64_t sourceLength);
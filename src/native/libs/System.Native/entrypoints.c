@@ -13,6 +13,7 @@
 #include "pal_interfaceaddresses.h"
 #include "pal_io.h"
 #include "pal_iossupportversion.h"
+#include "pal_iouring.h"
 #include "pal_log.h"
 #include "pal_memory.h"
 #include "pal_mount.h"
@@ -126,6 +127,9 @@ static const Entry s_sysNative[] =
     DllImportEntry(SystemNative_Free)
     DllImportEntry(SystemNative_Malloc)
     DllImportEntry(SystemNative_Realloc)
+    DllImportEntry(SystemNative_AllocLargePages)
+    DllImportEntry(SystemNative_FreeLargePages)
+    DllImportEntry(SystemNative_GetCurrentNumaNode)
     DllImportEntry(SystemNative_GetSpaceInfoForMountPoint)
     DllImportEntry(SystemNative_GetFormatInfoForMountPoint)
     DllImportEntry(SystemNative_GetAllMountPoints)
@@ -159,6 +163,12 @@ static const Entry s_sysNative[] =
     DllImportEntry(SystemNative_ReceiveMessage)
     DllImportEntry(SystemNative_Send)
     DllImportEntry(SystemNative_SendMessage)
+    DllImportEntry(SystemNative_ReceiveMessages)
+    DllImportEntry(SystemNative_SendMessages)
+    DllImportEntry(SystemNative_SetUdpSendSegmentSize)
+    DllImportEntry(SystemNative_SetUdpReceiveOffload)
+    DllImportEntry(SystemNative_GetUdpReceiveSegmentSize)
+    DllImportEntry(SystemNative_GetUdpReceiveSegmentSizeBufferSize)
     DllImportEntry(SystemNative_Accept)
     DllImportEntry(SystemNative_Bind)
     DllImportEntry(SystemNative_Connect)
@@ -186,6 +196,10 @@ static const Entry s_sysNative[] =
     DllImportEntry(SystemNative_GetDomainSocketSizes)
     DllImportEntry(SystemNative_GetMaximumAddressSize)
     DllImportEntry(SystemNative_SendFile)
+    DllImportEntry(SystemNative_SetZeroCopySend)
+    DllImportEntry(SystemNative_SendMessageZeroCopy)
+    DllImportEntry(SystemNative_ReadZeroCopyCompletion)
+    DllImportEntry(SystemNative_Splice)
     DllImportEntry(SystemNative_Disconnect)
     DllImportEntry(SystemNative_InterfaceNameToIndex)
     DllImportEntry(SystemNative_GetTcpGlobalStatistics)
@@ -246,6 +260,13 @@ static const Entry s_sysNative[] =
     DllImportEntry(SystemNative_UTimensat)
     DllImportEntry(SystemNative_FUTimens)
     DllImportEntry(SystemNative_GetTimestamp)
+    DllImportEntry(SystemNative_GetCoarseTimestamp)
+    DllImportEntry(SystemNative_GetCoarseSystemTimeAsTicks)
+    DllImportEntry(SystemNative_GetTimeStampCounterFrequency)
+    DllImportEntry(SystemNative_ReadTimeStampCounter)
+    DllImportEntry(SystemNative_StartCachedClock)
+    DllImportEntry(SystemNative_GetCachedTimestamp)
+    DllImportEntry(SystemNative_GetCachedSystemTimeAsTicks)
     DllImportEntry(SystemNative_GetBootTimeTicks)
     DllImportEntry(SystemNative_GetCpuUtilization)
     DllImportEntry(SystemNative_GetPwUidR)
@@ -263,6 +284,13 @@ static const Entry s_sysNative[] =
     DllImportEntry(SystemNative_PWrite)
     DllImportEntry(SystemNative_PReadV)
     DllImportEntry(SystemNative_PWriteV)
+    DllImportEntry(SystemNative_IoRingCreate)
+    DllImportEntry(SystemNative_IoRingClose)
+    DllImportEntry(SystemNative_IoRingRegisterFiles)
+    DllImportEntry(SystemNative_IoRingUpdateFiles)
+    DllImportEntry(SystemNative_IoRingRegisterBuffers)
+    DllImportEntry(SystemNative_IoRingEnqueue)
+    DllImportEntry(SystemNative_IoRingSubmitAndWait)
     DllImportEntry(SystemNative_CreateThread)
     DllImportEntry(SystemNative_EnablePosixSignalHandling)
     DllImportEntry(SystemNative_DisablePosixSignalHandling)
@@ -5,6 +5,7 @@
 #include "pal_config.h"
 #include "pal_errno.h"
 #include "pal_io.h"
+#include "pal_networking.h"
 #include "pal_utilities.h"
 #include "pal_safecrt.h"
 #include "pal_types.h"
@@ -333,6 +334,7 @@ intptr_t SystemNative_Open(const char* path, int32_t flags, int32_t mode)
 
 int32_t SystemNative_Close(intptr_t fd)
 {
+    UnregisterSocketFromEventPorts(ToFileDescriptor(fd));
     return close(ToFileDescriptor(fd));
 }
 
@@ -979,14 +981,38 @@ int32_t SystemNative_MAdvise(void* address, uint64_t length, int32_t advice)
 #ifdef MADV_DONTFORK
             return madvise(address, (size_t)length, MADV_DONTFORK);
 #else
-            (void)address, (void)length, (void)advice;
-            errno = ENOTSUP;
-            return -1;
+            break;
+#endif
+        case PAL_MADV_HUGEPAGE:
+#ifdef MADV_HUGEPAGE
+            return madvise(address, (size_t)length, MADV_HUGEPAGE);
+#else
+            break;
+#endif
+        case PAL_MADV_NOHUGEPAGE:
+#ifdef MADV_NOHUGEPAGE
+            return madvise(address, (size_t)length, MADV_NOHUGEPAGE);
+#else
+            break;
 #endif
+        case PAL_MADV_WILLNEED:
+            return madvise(address, (size_t)length, MADV_WILLNEED);
+        case PAL_MADV_DONTNEED:
+            return madvise(address, (size_t)length, MADV_DONTNEED);
+        case PAL_MADV_DONTDUMP:
+#ifdef MADV_DONTDUMP
+            return madvise(address, (size_t)length, MADV_DONTDUMP);
+#else
+            break;
+#endif
+        default:
+            assert_msg(false, "Unknown MemoryAdvice", (int)advice);
+            errno = EINVAL;
+            return -1;
     }
 
-    assert_msg(false, "Unknown MemoryAdvice", (int)advice);
-    errno = EINVAL;
+    // The advice isn't available on this platform
+    errno = ENOTSUP;
     return -1;
 }
 
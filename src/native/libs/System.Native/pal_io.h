@@ -263,7 +263,12 @@ enum
  */
 typedef enum
 {
-    PAL_MADV_DONTFORK = 1, // don't map pages in to forked process
+    PAL_MADV_DONTFORK = 1,    // don't map pages in to forked process
+    PAL_MADV_HUGEPAGE = 2,    // back the range with transparent huge pages
+    PAL_MADV_NOHUGEPAGE = 3,  // don't back the range with transparent huge pages
+    PAL_MADV_WILLNEED = 4,    // the range will be accessed soon, read it ahead
+    PAL_MADV_DONTNEED = 5,    // the range won't be accessed soon, its pages can be freed
+    PAL_MADV_DONTDUMP = 6,    // exclude the range from core dumps
 } MemoryAdvice;
 
 /**
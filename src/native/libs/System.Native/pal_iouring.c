@@ -0,0 +1,550 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+#include "pal_config.h"
+#include "pal_iouring.h"
+#include "pal_utilities.h"
+
+#include <minipal/utils.h>
+
+#include <assert.h>
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if HAVE_LINUX_IO_URING_H
+#include <linux/io_uring.h>
+#if defined(IORING_FEAT_FAST_POLL)
+#define HAVE_IO_URING_FILE_IO 1
+#endif
+#endif
+
+#ifdef HAVE_IO_URING_FILE_IO
+
+#include <fcntl.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+// io_uring based asynchronous file I/O. Unlike the socket event port in pal_networking.c, which
+// only uses io_uring for readiness, the ring here performs the reads and writes, so RandomAccess
+// can keep a deep queue in flight without parking a thread pool thread per operation.
+//
+// Submission and completion sides are independent: enqueuing happens under SubmitLock, reaping
+// under CompletionLock, and a thread blocked waiting for completions holds neither.
+
+enum
+{
+    MaxIoRingEntries = 32768,
+};
+
+typedef struct
+{
+    int RingFd;
+    pthread_mutex_t SubmitLock;
+    pthread_mutex_t CompletionLock;
+
+    uint32_t* SqHead;
+    uint32_t* SqTail;
+    uint32_t SqMask;
+    uint32_t SqEntries;
+    uint32_t* SqArray;
+    struct io_uring_sqe* Sqes;
+    uint32_t SqLocalTail;
+    uint32_t SqPending;
+
+    uint32_t* CqHead;
+    uint32_t* CqTail;
+    uint32_t CqMask;
+    struct io_uring_cqe* Cqes;
+
+    void* SqRing;
+    size_t SqRingSize;
+    void* CqRing;
+    size_t CqRingSize;
+    size_t SqesSize;
+} IoRing;
+
+c_static_assert_msg(sizeof(int32_t) == sizeof(int), "io_uring expects file tables as int arrays");
+c_static_assert_msg(sizeof(IOVector) == sizeof(struct iovec), "IOVector must match struct iovec");
+
+// -1: not probed yet, 0: unavailable or disabled, 1: available
+static volatile int32_t g_ioRingSupported = -1;
+
+static void FreeIoRing(IoRing* ring)
+{
+    if (ring->Sqes != NULL && ring->Sqes != MAP_FAILED)
+    {
+        munmap(ring->Sqes, ring->SqesSize);
+    }
+    if (ring->CqRing != NULL && ring->CqRing != MAP_FAILED && ring->CqRing != ring->SqRing)
+    {
+        munmap(ring->CqRing, ring->CqRingSize);
+    }
+    if (ring->SqRing != NULL && ring->SqRing != MAP_FAILED)
+    {
+        munmap(ring->SqRing, ring->SqRingSize);
+    }
+    if (ring->RingFd != -1)
+    {
+        close(ring->RingFd);
+    }
+    pthread_mutex_destroy(&ring->SubmitLock);
+    pthread_mutex_destroy(&ring->CompletionLock);
+    free(ring);
+}
+
+// Checks that the kernel implements the opcodes used here, IORING_OP_READ/WRITE need 5.6.
+static int ProbeIoRingOpcodes(int ringFd)
+{
+    size_t probeSize = sizeof(struct io_uring_probe) + IORING_OP_LAST * sizeof(struct io_uring_probe_op);
+    struct io_uring_probe* probe = (struct io_uring_probe*)calloc(1, probeSize);
+    if (probe == NULL)
+    {
+        return 0;
+    }
+
+    int supported = 0;
+    if (syscall(__NR_io_uring_register, ringFd, IORING_REGISTER_PROBE, probe, IORING_OP_LAST) == 0)
+    {
+        static const uint8_t RequiredOpcodes[] =
+        {
+            IORING_OP_READ, IORING_OP_WRITE, IORING_OP_READV, IORING_OP_WRITEV,
+            IORING_OP_READ_FIXED, IORING_OP_WRITE_FIXED, IORING_OP_FSYNC,
+        };
+
+        supported = 1;
+        for (size_t i = 0; i < ARRAY_SIZE(RequiredOpcodes); i++)
+        {
+            uint8_t opcode = RequiredOpcodes[i];
+            if (opcode > probe->last_op || (probe->ops[opcode].flags & IO_URING_OP_SUPPORTED) == 0)
+            {
+                supported = 0;
+                break;
+            }
+        }
+    }
+
+    free(probe);
+    return supported;
+}
+
+static int32_t MapIoRing(IoRing* ring, const struct io_uring_params* params)
+{
+    ring->SqRingSize = params->sq_off.array + params->sq_entries * sizeof(uint32_t);
+    ring->CqRingSize = params->cq_off.cqes + params->cq_entries * sizeof(struct io_uring_cqe);
+    if ((params->features & IORING_FEAT_SINGLE_MMAP) != 0 && ring->CqRingSize > ring->SqRingSize)
+    {
+        ring->SqRingSize = ring->CqRingSize;
+    }
+    ring->SqRing = mmap(NULL, ring->SqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring->RingFd, IORING_OFF_SQ_RING);
+    if (ring->SqRing == MAP_FAILED)
+    {
+        return SystemNative_ConvertErrorPlatformToPal(errno);
+    }
+    if ((params->features & IORING_FEAT_SINGLE_MMAP) != 0)
+    {
+        ring->CqRing = ring->SqRing;
+    }
+    else
+    {
+        ring->CqRing = mmap(NULL, ring->CqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring->RingFd, IORING_OFF_CQ_RING);
+        if (ring->CqRing == MAP_FAILED)
+        {
+            return SystemNative_ConvertErrorPlatformToPal(errno);
+        }
+    }
+    ring->SqesSize = params->sq_entries * sizeof(struct io_uring_sqe);
+    ring->Sqes = (struct io_uring_sqe*)mmap(NULL, ring->SqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring->RingFd, IORING_OFF_SQES);
+    if (ring->Sqes == MAP_FAILED)
+    {
+        return SystemNative_ConvertErrorPlatformToPal(errno);
+    }
+
+    uint8_t* sqRing = (uint8_t*)ring->SqRing;
+    ring->SqHead = (uint32_t*)(sqRing + params->sq_off.head);
+    ring->SqTail = (uint32_t*)(sqRing + params->sq_off.tail);
+    ring->SqMask = *(uint32_t*)(sqRing + params->sq_off.ring_mask);
+    ring->SqEntries = params->sq_entries;
+    ring->SqArray = (uint32_t*)(sqRing + params->sq_off.array);
+    ring->SqLocalTail = *ring->SqTail;
+
+    uint8_t* cqRing = (uint8_t*)ring->CqRing;
+    ring->CqHead = (uint32_t*)(cqRing + params->cq_off.head);
+    ring->CqTail = (uint32_t*)(cqRing + params->cq_off.tail);
+    ring->CqMask = *(uint32_t*)(cqRing + params->cq_off.ring_mask);
+    ring->Cqes = (struct io_uring_cqe*)(cqRing + params->cq_off.cqes);
+    return Error_SUCCESS;
+}
+
+int32_t SystemNative_IoRingCreate(int32_t entries, intptr_t* ring)
+{
+    if (ring == NULL || entries <= 0)
+    {
+        return Error_EINVAL;
+    }
+
+    *ring = 0;
+
+    if (g_ioRingSupported == 0)
+    {
+        return Error_ENOTSUP;
+    }
+    if (g_ioRingSupported == -1)
+    {
+        const char* setting = getenv("DOTNET_SYSTEM_IO_URING");
+        if (setting != NULL && strcmp(setting, "0") == 0)
+        {
+            g_ioRingSupported = 0;
+            return Error_ENOTSUP;
+        }
+    }
+
+    IoRing* ioRing = (IoRing*)calloc(1, sizeof(IoRing));
+    if (ioRing == NULL)
+    {
+        return Error_ENOMEM;
+    }
+    ioRing->RingFd = -1;
+    pthread_mutex_init(&ioRing->SubmitLock, NULL);
+    pthread_mutex_init(&ioRing->CompletionLock, NULL);
+
+    // Completions are reaped in batches, a completion queue twice the submission queue (the kernel default)
+    // plus IORING_FEAT_NODROP keeps a slow reaper from losing completions.
+    struct io_uring_params params;
+    memset(&params, 0, sizeof(params));
+    ioRing->RingFd = (int)syscall(__NR_io_uring_setup, (unsigned)(entries < MaxIoRingEntries ? entries : MaxIoRingEntries), &params);
+    if (ioRing->RingFd == -1)
+    {
+        int32_t error = errno == ENOSYS || errno == EPERM ? Error_ENOTSUP : SystemNative_ConvertErrorPlatformToPal(errno);
+        if (error == Error_ENOTSUP)
+        {
+            g_ioRingSupported = 0;
+        }
+        FreeIoRing(ioRing);
+        return error;
+    }
+    fcntl(ioRing->RingFd, F_SETFD, FD_CLOEXEC);
+
+    if ((params.features & IORING_FEAT_NODROP) == 0 || !ProbeIoRingOpcodes(ioRing->RingFd))
+    {
+        g_ioRingSupported = 0;
+        FreeIoRing(ioRing);
+        return Error_ENOTSUP;
+    }
+
+    int32_t error = MapIoRing(ioRing, &params);
+    if (error != Error_SUCCESS)
+    {
+        FreeIoRing(ioRing);
+        return error;
+    }
+
+    g_ioRingSupported = 1;
+    *ring = (intptr_t)ioRing;
+    return Error_SUCCESS;
+}
+
+void SystemNative_IoRingClose(intptr_t ring)
+{
+    IoRing* ioRing = (IoRing*)ring;
+    if (ioRing != NULL)
+    {
+        // Closing the ring file descriptor cancels and waits for outstanding requests.
+        FreeIoRing(ioRing);
+    }
+}
+
+static int32_t IoRingRegister(IoRing* ring, unsigned opcode, void* arg, unsigned count)
+{
+    int result;
+    while ((result = (int)syscall(__NR_io_uring_register, ring->RingFd, opcode, arg, count)) < 0 && errno == EINTR);
+    return result < 0 ? SystemNative_ConvertErrorPlatformToPal(errno) : Error_SUCCESS;
+}
+
+int32_t SystemNative_IoRingRegisterFiles(intptr_t ring, int32_t* fds, int32_t count)
+{
+    IoRing* ioRing = (IoRing*)ring;
+    if (ioRing == NULL || fds == NULL || count <= 0)
+    {
+        return Error_EINVAL;
+    }
+
+    return IoRingRegister(ioRing, IORING_REGISTER_FILES, fds, (unsigned)count);
+}
+
+int32_t SystemNative_IoRingUpdateFiles(intptr_t ring, int32_t offset, int32_t* fds, int32_t count)
+{
+    IoRing* ioRing = (IoRing*)ring;
+    if (ioRing == NULL || fds == NULL || count <= 0 || offset < 0)
+    {
+        return Error_EINVAL;
+    }
+
+    struct io_uring_files_update update;
+    memset(&update, 0, sizeof(update));
+    update.offset = (uint32_t)offset;
+    update.fds = (uint64_t)(uintptr_t)fds;
+    return IoRingRegister(ioRing, IORING_REGISTER_FILES_UPDATE, &update, (unsigned)count);
+}
+
+int32_t SystemNative_IoRingRegisterBuffers(intptr_t ring, IOVector* buffers, int32_t count)
+{
+    IoRing* ioRing = (IoRing*)ring;
+    if (ioRing == NULL || buffers == NULL || count <= 0)
+    {
+        return Error_EINVAL;
+    }
+
+    return IoRingRegister(ioRing, IORING_REGISTER_BUFFERS, buffers, (unsigned)count);
+}
+
+static int32_t PrepareIoRingSqe(struct io_uring_sqe* sqe, const IoRingOperation* operation)
+{
+    int fixedBuffer = (operation->Flags & IoRingFlags_FixedBuffer) != 0;
+
+    switch (operation->Opcode)
+    {
+        case IoRingOpcode_Read:
+            sqe->opcode = fixedBuffer ? IORING_OP_READ_FIXED : IORING_OP_READ;
+            break;
+        case IoRingOpcode_Write:
+            sqe->opcode = fixedBuffer ? IORING_OP_WRITE_FIXED : IORING_OP_WRITE;
+            break;
+        case IoRingOpcode_ReadV:
+            sqe->opcode = IORING_OP_READV;
+            break;
+        case IoRingOpcode_WriteV:
+            sqe->opcode = IORING_OP_WRITEV;
+            break;
+        case IoRingOpcode_Fsync:
+            sqe->opcode = IORING_OP_FSYNC;
+            sqe->fsync_flags = (operation->Flags & IoRingFlags_DataSync) != 0 ? IORING_FSYNC_DATASYNC : 0;
+            break;
+        default:
+            return Error_EINVAL;
+    }
+
+    if (fixedBuffer && operation->Opcode != IoRingOpcode_Read && operation->Opcode != IoRingOpcode_Write)
+    {
+        return Error_EINVAL;
+    }
+    if (operation->Length < 0 || operation->FileOffset < 0)
+    {
+        return Error_EINVAL;
+    }
+
+    sqe->fd = operation->Fd;
+    sqe->flags = (operation->Flags & IoRingFlags_FixedFile) != 0 ? IOSQE_FIXED_FILE : 0;
+    if (operation->Opcode != IoRingOpcode_Fsync)
+    {
+        sqe->off = (uint64_t)operation->FileOffset;
+        sqe->addr = (uint64_t)(uintptr_t)operation->Buffer;
+        sqe->len = (uint32_t)operation->Length;
+    }
+    if (fixedBuffer)
+    {
+        sqe->buf_index = (uint16_t)operation->BufferIndex;
+    }
+    sqe->user_data = operation->UserData;
+    return Error_SUCCESS;
+}
+
+int32_t SystemNative_IoRingEnqueue(intptr_t ring, IoRingOperation* operations, int32_t count, int32_t* enqueued)
+{
+    IoRing* ioRing = (IoRing*)ring;
+    if (ioRing == NULL || operations == NULL || enqueued == NULL || count < 0)
+    {
+        return Error_EINVAL;
+    }
+
+    int32_t error = Error_SUCCESS;
+    int32_t i = 0;
+
+    pthread_mutex_lock(&ioRing->SubmitLock);
+
+    for (; i < count; i++)
+    {
+        if (ioRing->SqLocalTail - __atomic_load_n(ioRing->SqHead, __ATOMIC_ACQUIRE) >= ioRing->SqEntries)
+        {
+            break;
+        }
+
+        uint32_t index = ioRing->SqLocalTail & ioRing->SqMask;
+        struct io_uring_sqe* sqe = &ioRing->Sqes[index];
+        memset(sqe, 0, sizeof(struct io_uring_sqe));
+        error = PrepareIoRingSqe(sqe, &operations[i]);
+        if (error != Error_SUCCESS)
+        {
+            break;
+        }
+
+        ioRing->SqArray[index] = index;
+        ioRing->SqLocalTail++;
+        ioRing->SqPending++;
+    }
+
+    pthread_mutex_unlock(&ioRing->SubmitLock);
+
+    *enqueued = i;
+    // Report an invalid operation only when it is the first one, so the caller retries the remaining ones.
+    return i == 0 ? error : Error_SUCCESS;
+}
+
+static int32_t SubmitIoRing(IoRing* ring)
+{
+    pthread_mutex_lock(&ring->SubmitLock);
+
+    __atomic_store_n(ring->SqTail, ring->SqLocalTail, __ATOMIC_RELEASE);
+
+    int32_t error = Error_SUCCESS;
+    while (ring->SqPending != 0)
+    {
+        int result = (int)syscall(__NR_io_uring_enter, ring->RingFd, ring->SqPending, 0, 0, NULL, 0);
+        if (result < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+
+            // EBUSY/EAGAIN: the completion queue is backed up, the caller reaps and submits again
+            error = SystemNative_ConvertErrorPlatformToPal(errno);
+            break;
+        }
+
+        ring->SqPending -= (uint32_t)result < ring->SqPending ? (uint32_t)result : ring->SqPending;
+        if (result == 0)
+        {
+            break;
+        }
+    }
+
+    pthread_mutex_unlock(&ring->SubmitLock);
+    return error;
+}
+
+static int32_t ReapIoRing(IoRing* ring, IoRingCompletion* completions, int32_t maxCompletions)
+{
+    int32_t count = 0;
+
+    pthread_mutex_lock(&ring->CompletionLock);
+
+    uint32_t head = *ring->CqHead;
+    uint32_t tail = __atomic_load_n(ring->CqTail, __ATOMIC_ACQUIRE);
+    for (; head != tail && count < maxCompletions; head++, count++)
+    {
+        struct io_uring_cqe* cqe = &ring->Cqes[head & ring->CqMask];
+        IoRingCompletion* completion = &completions[count];
+        completion->UserData = cqe->user_data;
+        if (cqe->res >= 0)
+        {
+            completion->BytesTransferred = cqe->res;
+            completion->Error = Error_SUCCESS;
+        }
+        else
+        {
+            completion->BytesTransferred = 0;
+            completion->Error = SystemNative_ConvertErrorPlatformToPal(-cqe->res);
+        }
+    }
+    __atomic_store_n(ring->CqHead, head, __ATOMIC_RELEASE);
+
+    pthread_mutex_unlock(&ring->CompletionLock);
+    return count;
+}
+
+int32_t SystemNative_IoRingSubmitAndWait(intptr_t ring,
+                                         int32_t wait,
+                                         IoRingCompletion* completions,
+                                         int32_t maxCompletions,
+                                         int32_t* completed)
+{
+    IoRing* ioRing = (IoRing*)ring;
+    if (ioRing == NULL || completions == NULL || completed == NULL || maxCompletions <= 0)
+    {
+        return Error_EINVAL;
+    }
+
+    *completed = 0;
+
+    int32_t submitError = SubmitIoRing(ioRing);
+
+    int32_t count = ReapIoRing(ioRing, completions, maxCompletions);
+    while (count == 0 && wait != 0 && submitError == Error_SUCCESS)
+    {
+        if (syscall(__NR_io_uring_enter, ioRing->RingFd, 0, 1, IORING_ENTER_GETEVENTS, NULL, 0) < 0 && errno != EINTR)
+        {
+            return SystemNative_ConvertErrorPlatformToPal(errno);
+        }
+
+        count = ReapIoRing(ioRing, completions, maxCompletions);
+    }
+
+    *completed = count;
+    // A backed up completion queue is not an error once completions were reaped to make room
+    return count > 0 ? Error_SUCCESS : submitError;
+}
+
+#else // HAVE_IO_URING_FILE_IO
+
+int32_t SystemNative_IoRingCreate(int32_t entries, intptr_t* ring)
+{
+    (void)entries;
+    if (ring != NULL)
+    {
+        *ring = 0;
+    }
+    return Error_ENOTSUP;
+}
+
+void SystemNative_IoRingClose(intptr_t ring)
+{
+    (void)ring;
+}
+
+int32_t SystemNative_IoRingRegisterFiles(intptr_t ring, int32_t* fds, int32_t count)
+{
+    (void)ring, (void)fds, (void)count;
+    return Error_ENOTSUP;
+}
+
+int32_t SystemNative_IoRingUpdateFiles(intptr_t ring, int32_t offset, int32_t* fds, int32_t count)
+{
+    (void)ring, (void)offset, (void)fds, (void)count;
+    return Error_ENOTSUP;
+}
+
+int32_t SystemNative_IoRingRegisterBuffers(intptr_t ring, IOVector* buffers, int32_t count)
+{
+    (void)ring, (void)buffers, (void)count;
+    return Error_ENOTSUP;
+}
+
+int32_t SystemNative_IoRingEnqueue(intptr_t ring, IoRingOperation* operations, int32_t count, int32_t* enqueued)
+{
+    (void)ring, (void)operations, (void)count;
+    if (enqueued != NULL)
+    {
+        *enqueued = 0;
+    }
+    return Error_ENOTSUP;
+}
+
+int32_t SystemNative_IoRingSubmitAndWait(intptr_t ring,
+                                         int32_t wait,
+                                         IoRingCompletion* completions,
+                                         int32_t maxCompletions,
+                                         int32_t* completed)
+{
+    (void)ring, (void)wait, (void)completions, (void)maxCompletions;
+    if (completed != NULL)
+    {
+        *completed = 0;
+    }
+    return Error_ENOTSUP;
+}
+
+#endif // HAVE_IO_URING_FILE_IO
@@ -0,0 +1,91 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+#pragma once
+
+#include "pal_compiler.h"
+#include "pal_types.h"
+#include "pal_errno.h"
+#include "pal_io.h"
+
+/**
+ * Operations supported by SystemNative_IoRingEnqueue.
+ */
+typedef enum
+{
+    IoRingOpcode_Read = 0,   // Buffer/Length
+    IoRingOpcode_Write = 1,  // Buffer/Length
+    IoRingOpcode_ReadV = 2,  // Buffer is an IOVector array, Length the vector count
+    IoRingOpcode_WriteV = 3, // Buffer is an IOVector array, Length the vector count
+    IoRingOpcode_Fsync = 4,
+} IoRingOpcode;
+
+typedef enum
+{
+    IoRingFlags_None = 0x00,
+    IoRingFlags_FixedFile = 0x01,   // Fd is an index into the files registered with SystemNative_IoRingRegisterFiles
+    IoRingFlags_FixedBuffer = 0x02, // Buffer lies within the registered buffer BufferIndex, Read and Write only
+    IoRingFlags_DataSync = 0x04,    // Fsync only: fdatasync semantics
+} IoRingFlags;
+
+typedef struct
+{
+    uint64_t UserData;  // Returned unchanged in the completion
+    int64_t FileOffset;
+    uint8_t* Buffer;
+    int32_t Length;
+    int32_t Fd;
+    int32_t Opcode;     // IoRingOpcode
+    int32_t Flags;      // IoRingFlags
+    int32_t BufferIndex;
+    int32_t Padding;    // Pad out to 8-byte alignment
+} IoRingOperation;
+
+typedef struct
+{
+    uint64_t UserData;
+    int32_t BytesTransferred;
+    int32_t Error;      // Error_SUCCESS or the PAL error the operation failed with
+} IoRingCompletion;
+
+/**
+ * Creates an io_uring instance for file I/O with room for at least entries in-flight submissions.
+ * Returns Error_ENOTSUP when io_uring is unavailable (old kernel, seccomp) or disabled with
+ * DOTNET_SYSTEM_IO_URING=0; callers then fall back to SystemNative_PRead and friends.
+ */
+PALEXPORT int32_t SystemNative_IoRingCreate(int32_t entries, intptr_t* ring);
+
+/**
+ * Destroys the ring. Operations still in flight are canceled, their buffers must stay valid until this returns.
+ */
+PALEXPORT void SystemNative_IoRingClose(intptr_t ring);
+
+/**
+ * Registers a fixed file table, which saves the per-operation file reference counting. Entries may be -1 and
+ * filled in later with SystemNative_IoRingUpdateFiles.
+ */
+PALEXPORT int32_t SystemNative_IoRingRegisterFiles(intptr_t ring, int32_t* fds, int32_t count);
+
+PALEXPORT int32_t SystemNative_IoRingUpdateFiles(intptr_t ring, int32_t offset, int32_t* fds, int32_t count);
+
+/**
+ * Registers buffers that stay pinned for the lifetime of the ring, which saves mapping them on every operation.
+ */
+PALEXPORT int32_t SystemNative_IoRingRegisterBuffers(intptr_t ring, IOVector* buffers, int32_t count);
+
+/**
+ * Queues up to count operations without submitting them. *enqueued is less than count when the submission
+ * queue is full; SystemNative_IoRingSubmitAndWait makes room.
+ */
+PALEXPORT int32_t SystemNative_IoRingEnqueue(intptr_t ring, IoRingOperation* operations, int32_t count, int32_t* enqueued);
+
+/**
+ * Submits the queued operations and reaps up to maxCompletions completions. When none are available and
+ * wait is non-zero, blocks until at least one operation completes. May be called concurrently with
+ * SystemNative_IoRingEnqueue.
+ */
+PALEXPORT int32_t SystemNative_IoRingSubmitAndWait(intptr_t ring,
+                                                   int32_t wait,
+                                                   IoRingCompletion* completions,
+                                                   int32_t maxCompletions,
+                                                   int32_t* completed);
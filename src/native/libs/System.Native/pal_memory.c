@@ -5,8 +5,15 @@
 #include "pal_memory.h"
 
 #include <assert.h>
+#include <errno.h>
+#include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#if defined(TARGET_LINUX) || defined(TARGET_ANDROID)
+#include <sys/syscall.h>
+#endif
 
 #if HAVE_MALLOC_SIZE
     #include <malloc/malloc.h>
@@ -79,3 +86,197 @@ void* SystemNative_Realloc(void* ptr, uintptr_t new_size)
 {
     return realloc(ptr, new_size);
 }
+
+#if defined(TARGET_LINUX) || defined(TARGET_ANDROID)
+// Memory policies from linux/mempolicy.h, which isn't installed everywhere
+#define PAL_MPOL_PREFERRED 1
+#define PAL_MPOL_BIND 2
+#define PAL_MAX_NUMA_NODES 1024
+#define PAL_DEFAULT_HUGE_PAGE_SIZE (2 * 1024 * 1024)
+
+// Size of the pages MAP_HUGETLB takes from, the Hugepagesize line of /proc/meminfo
+static uintptr_t GetHugePageSize(void)
+{
+    static uintptr_t s_hugePageSize;
+
+    uintptr_t hugePageSize = __atomic_load_n(&s_hugePageSize, __ATOMIC_RELAXED);
+    if (hugePageSize != 0)
+    {
+        return hugePageSize;
+    }
+
+    hugePageSize = PAL_DEFAULT_HUGE_PAGE_SIZE;
+
+    FILE* meminfo = fopen("/proc/meminfo", "re");
+    if (meminfo != NULL)
+    {
+        char line[128];
+        unsigned long kilobytes;
+
+        while (fgets(line, sizeof(line), meminfo) != NULL)
+        {
+            if (sscanf(line, "Hugepagesize: %lu kB", &kilobytes) == 1 && kilobytes != 0)
+            {
+                hugePageSize = (uintptr_t)kilobytes * 1024;
+                break;
+            }
+        }
+
+        fclose(meminfo);
+    }
+
+    __atomic_store_n(&s_hugePageSize, hugePageSize, __ATOMIC_RELAXED);
+    return hugePageSize;
+}
+#endif
+
+void* SystemNative_AllocLargePages(uintptr_t size, uintptr_t alignment, int32_t numaNode, int32_t flags, uintptr_t* allocatedSize)
+{
+    assert(allocatedSize != NULL);
+    *allocatedSize = 0;
+
+    if (size > UINTPTR_MAX / 2)
+    {
+        errno = ENOMEM;
+        return NULL;
+    }
+
+    if (size == 0 || (alignment & (alignment - 1)) != 0 || numaNode < -1 ||
+        (flags & ~(PAL_LARGE_PAGES_TRANSPARENT | PAL_LARGE_PAGES_HUGETLB | PAL_LARGE_PAGES_POPULATE | PAL_LARGE_PAGES_NUMA_STRICT)) != 0)
+    {
+        errno = EINVAL;
+        return NULL;
+    }
+
+    uintptr_t pageSize = (uintptr_t)sysconf(_SC_PAGESIZE);
+    uintptr_t mapAlignment = pageSize;   // what mmap aligns the mapping to
+    int mapFlags = MAP_PRIVATE | MAP_ANONYMOUS;
+
+#if defined(TARGET_LINUX) || defined(TARGET_ANDROID)
+    if ((flags & PAL_LARGE_PAGES_HUGETLB) != 0)
+    {
+        mapAlignment = GetHugePageSize();
+        mapFlags |= MAP_HUGETLB;
+    }
+    else if ((flags & PAL_LARGE_PAGES_TRANSPARENT) != 0)
+    {
+        // Transparent huge pages are only used for aligned huge page sized extents
+        alignment = alignment > PAL_DEFAULT_HUGE_PAGE_SIZE ? alignment : PAL_DEFAULT_HUGE_PAGE_SIZE;
+        size = (size + PAL_DEFAULT_HUGE_PAGE_SIZE - 1) & ~(uintptr_t)(PAL_DEFAULT_HUGE_PAGE_SIZE - 1);
+    }
+#else
+    if ((flags & PAL_LARGE_PAGES_HUGETLB) != 0 || numaNode != -1)
+    {
+        errno = ENOTSUP;
+        return NULL;
+    }
+#endif
+
+    if (alignment < mapAlignment)
+    {
+        alignment = mapAlignment;
+    }
+
+    if (size > UINTPTR_MAX - 2 * alignment)
+    {
+        errno = ENOMEM;
+        return NULL;
+    }
+
+    size = (size + mapAlignment - 1) & ~(mapAlignment - 1);
+
+    // Map enough to find an aligned range in, then give back the ends around it
+    uintptr_t reservedSize = size + alignment - mapAlignment;
+    uint8_t* reserved = (uint8_t*)mmap(NULL, reservedSize, PROT_READ | PROT_WRITE, mapFlags, -1, 0);
+    if (reserved == MAP_FAILED)
+    {
+        return NULL;
+    }
+
+    uint8_t* result = (uint8_t*)(((uintptr_t)reserved + alignment - 1) & ~(alignment - 1));
+    uintptr_t headSize = (uintptr_t)(result - reserved);
+    uintptr_t tailSize = reservedSize - headSize - size;
+
+    if (headSize != 0)
+    {
+        munmap(reserved, headSize);
+    }
+
+    if (tailSize != 0)
+    {
+        munmap(result + size, tailSize);
+    }
+
+#if defined(TARGET_LINUX) || defined(TARGET_ANDROID)
+#ifdef MADV_HUGEPAGE
+    if ((flags & (PAL_LARGE_PAGES_TRANSPARENT | PAL_LARGE_PAGES_HUGETLB)) == PAL_LARGE_PAGES_TRANSPARENT)
+    {
+        // Only a hint, THP may be disabled system-wide
+        madvise(result, size, MADV_HUGEPAGE);
+    }
+#endif
+
+    if (numaNode != -1)
+    {
+        unsigned long nodeMask[PAL_MAX_NUMA_NODES / (8 * sizeof(unsigned long))] = { 0 };
+
+        if (numaNode >= PAL_MAX_NUMA_NODES)
+        {
+            munmap(result, size);
+            errno = EINVAL;
+            return NULL;
+        }
+
+        nodeMask[(size_t)numaNode / (8 * sizeof(unsigned long))] |= 1UL << ((size_t)numaNode % (8 * sizeof(unsigned long)));
+
+        // Nothing has been faulted in yet, so every page is allocated under the policy
+        int mode = (flags & PAL_LARGE_PAGES_NUMA_STRICT) != 0 ? PAL_MPOL_BIND : PAL_MPOL_PREFERRED;
+        if (syscall(SYS_mbind, result, size, mode, nodeMask, PAL_MAX_NUMA_NODES + 1, 0) != 0)
+        {
+            int error = errno;
+            munmap(result, size);
+            errno = error;
+            return NULL;
+        }
+    }
+#endif
+
+    if ((flags & PAL_LARGE_PAGES_POPULATE) != 0)
+    {
+#ifdef MADV_POPULATE_WRITE
+        if (madvise(result, size, MADV_POPULATE_WRITE) != 0)
+#endif
+        {
+            // Kernels before 5.14; touch a byte of every page
+            uintptr_t touchStride = (flags & PAL_LARGE_PAGES_HUGETLB) != 0 ? mapAlignment : pageSize;
+            for (uintptr_t offset = 0; offset < size; offset += touchStride)
+            {
+                ((volatile uint8_t*)result)[offset] = 0;
+            }
+        }
+    }
+
+    *allocatedSize = size;
+    return result;
+}
+
+int32_t SystemNative_FreeLargePages(void* ptr, uintptr_t allocatedSize)
+{
+    return munmap(ptr, allocatedSize);
+}
+
+int32_t SystemNative_GetCurrentNumaNode(void)
+{
+#if (defined(TARGET_LINUX) || defined(TARGET_ANDROID)) && defined(SYS_getcpu)
+    unsigned int cpu, node;
+    if (syscall(SYS_getcpu, &cpu, &node, NULL) == 0)
+    {
+        return (int32_t)node;
+    }
+
+    return -1;
+#else
+    errno = ENOTSUP;
+    return -1;
+#endif
+}
@@ -40,3 +40,41 @@ PALEXPORT void* SystemNative_Malloc(uintptr_t size);
  * C runtime realloc
  */
 PALEXPORT void* SystemNative_Realloc(void* ptr, uintptr_t new_size);
+
+/**
+ * Flags for SystemNative_AllocLargePages.
+ */
+typedef enum
+{
+    PAL_LARGE_PAGES_TRANSPARENT = 0x01, // ask for transparent huge pages, falls back to normal pages
+    PAL_LARGE_PAGES_HUGETLB = 0x02,     // take explicit huge pages from the reserved pool, fails when it is exhausted
+    PAL_LARGE_PAGES_POPULATE = 0x04,    // fault all pages in before returning
+    PAL_LARGE_PAGES_NUMA_STRICT = 0x08, // only allocate on numaNode (MPOL_BIND) instead of preferring it (MPOL_PREFERRED)
+} LargePagesFlags;
+
+/**
+ * Maps size bytes of zeroed anonymous memory aligned to alignment, a power of two, for large off-heap
+ * data structures. flags is a combination of LargePagesFlags. When numaNode is not -1, the pages are
+ * placed on that NUMA node (Linux only).
+ *
+ * The size is rounded up to the page size in use, and *allocatedSize receives the size that has to
+ * be passed to SystemNative_FreeLargePages.
+ *
+ * Returns NULL and sets errno on failure; ENOTSUP when huge pages or NUMA placement are requested
+ * on a platform without them.
+ */
+PALEXPORT void* SystemNative_AllocLargePages(uintptr_t size, uintptr_t alignment, int32_t numaNode, int32_t flags, uintptr_t* allocatedSize);
+
+/**
+ * Unmaps memory from SystemNative_AllocLargePages.
+ *
+ * Returns 0 for success, -1 for failure. Sets errno on failure.
+ */
+PALEXPORT int32_t SystemNative_FreeLargePages(void* ptr, uintptr_t allocatedSize);
+
+/**
+ * Gets the NUMA node the calling thread is running on.
+ *
+ * Returns -1 and sets errno when it can't be determined.
+ */
+PALEXPORT int32_t SystemNative_GetCurrentNumaNode(void);
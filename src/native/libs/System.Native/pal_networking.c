@@ -16,6 +16,12 @@
 #include <sys/time.h>
 #if HAVE_EPOLL
 #include <sys/epoll.h>
+#if HAVE_LINUX_IO_URING_H
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#endif
 #elif HAVE_KQUEUE
 #include <sys/types.h>
 #include <sys/event.h>
@@ -30,6 +36,7 @@
 #include <netdb.h>
 #include <netinet/in.h>
 #include <netinet/tcp.h>
+#include <netinet/udp.h>
 #include <net/if.h>
 #include <stdlib.h>
 #include <string.h>
@@ -59,6 +66,9 @@
 #if HAVE_LINUX_CAN_H
 #include <linux/can.h>
 #endif
+#if HAVE_LINUX_ERRQUEUE_H
+#include <linux/errqueue.h>
+#endif
 #if HAVE_SYS_FILIO_H
 #include <sys/filio.h>
 #endif
@@ -1496,6 +1506,272 @@ int32_t SystemNative_SendMessage(intptr_t socket, MessageHeader* messageHeader,
     return SystemNative_ConvertErrorPlatformToPal(errno);
 }
 
+// Upper bound on the number of datagrams handled per batched call; callers loop for more.
+// This keeps the mmsghdr array on the stack and well below UIO_MAXIOV.
+#define MaxBatchedMessages 64
+
+static int32_t ValidateMessageHeaders(const MessageHeader* messageHeaders, int32_t messageCount)
+{
+    for (int32_t i = 0; i < messageCount; i++)
+    {
+        const MessageHeader* messageHeader = &messageHeaders[i];
+        if (messageHeader->SocketAddressLen < 0 || messageHeader->ControlBufferLen < 0 || messageHeader->IOVectorCount < 0)
+        {
+            return Error_EFAULT;
+        }
+    }
+
+    return Error_SUCCESS;
+}
+
+static void UpdateReceivedMessageHeader(MessageHeader* messageHeader, const struct msghdr* header)
+{
+    assert(header->msg_name == messageHeader->SocketAddress);
+    assert(header->msg_control == messageHeader->ControlBuffer);
+
+    assert((int32_t)header->msg_namelen <= messageHeader->SocketAddressLen);
+    messageHeader->SocketAddressLen = Min((int32_t)header->msg_namelen, messageHeader->SocketAddressLen);
+
+    assert(header->msg_controllen <= (size_t)messageHeader->ControlBufferLen);
+    messageHeader->ControlBufferLen = Min((int32_t)header->msg_controllen, messageHeader->ControlBufferLen);
+
+    messageHeader->Flags = ConvertSocketFlagsPlatformToPal(header->msg_flags);
+}
+
+int32_t SystemNative_ReceiveMessages(intptr_t socket,
+                                     MessageHeader* messageHeaders,
+                                     int64_t* received,
+                                     int32_t messageCount,
+                                     int32_t flags,
+                                     int32_t* messagesReceived)
+{
+    if (messageHeaders == NULL || received == NULL || messagesReceived == NULL || messageCount <= 0)
+    {
+        return Error_EFAULT;
+    }
+
+    *messagesReceived = 0;
+    messageCount = Min(messageCount, MaxBatchedMessages);
+
+    int32_t result = ValidateMessageHeaders(messageHeaders, messageCount);
+    if (result != Error_SUCCESS)
+    {
+        return result;
+    }
+
+    int fd = ToFileDescriptor(socket);
+
+    int socketFlags;
+    if (!ConvertSocketFlagsPalToPlatform(flags, &socketFlags))
+    {
+        return Error_ENOTSUP;
+    }
+
+#if HAVE_RECVMMSG
+    struct mmsghdr headers[MaxBatchedMessages];
+    for (int32_t i = 0; i < messageCount; i++)
+    {
+        ConvertMessageHeaderToMsghdr(&headers[i].msg_hdr, &messageHeaders[i], fd);
+        headers[i].msg_len = 0;
+    }
+
+    // MSG_WAITFORONE: only the first datagram may block, the rest are whatever is already queued.
+    int res;
+    while ((res = recvmmsg(fd, headers, (unsigned int)messageCount, socketFlags | MSG_WAITFORONE, NULL)) < 0 && errno == EINTR);
+
+    if (res < 0)
+    {
+        return SystemNative_ConvertErrorPlatformToPal(errno);
+    }
+
+    for (int i = 0; i < res; i++)
+    {
+        UpdateReceivedMessageHeader(&messageHeaders[i], &headers[i].msg_hdr);
+        received[i] = (int64_t)headers[i].msg_len;
+    }
+
+    *messagesReceived = res;
+    return Error_SUCCESS;
+#else
+    // Emulate MSG_WAITFORONE: the first receive honors the socket mode, the remaining ones stop once the queue is empty.
+    for (int32_t i = 0; i < messageCount; i++)
+    {
+        struct msghdr header;
+        ConvertMessageHeaderToMsghdr(&header, &messageHeaders[i], fd);
+
+        ssize_t res;
+        while ((res = recvmsg(fd, &header, i == 0 ? socketFlags : socketFlags | MSG_DONTWAIT)) < 0 && errno == EINTR);
+
+        if (res < 0)
+        {
+            if (i == 0)
+            {
+                return SystemNative_ConvertErrorPlatformToPal(errno);
+            }
+
+            break;
+        }
+
+        UpdateReceivedMessageHeader(&messageHeaders[i], &header);
+        received[i] = res;
+        *messagesReceived = i + 1;
+    }
+
+    return Error_SUCCESS;
+#endif
+}
+
+int32_t SystemNative_SendMessages(intptr_t socket,
+                                  MessageHeader* messageHeaders,
+                                  int64_t* sent,
+                                  int32_t messageCount,
+                                  int32_t flags,
+                                  int32_t* messagesSent)
+{
+    if (messageHeaders == NULL || sent == NULL || messagesSent == NULL || messageCount <= 0)
+    {
+        return Error_EFAULT;
+    }
+
+    *messagesSent = 0;
+    messageCount = Min(messageCount, MaxBatchedMessages);
+
+    int32_t result = ValidateMessageHeaders(messageHeaders, messageCount);
+    if (result != Error_SUCCESS)
+    {
+        return result;
+    }
+
+    int fd = ToFileDescriptor(socket);
+
+    int socketFlags;
+    if (!ConvertSocketFlagsPalToPlatform(flags, &socketFlags))
+    {
+        return Error_ENOTSUP;
+    }
+
+#if HAVE_SENDMMSG
+    struct mmsghdr headers[MaxBatchedMessages];
+    for (int32_t i = 0; i < messageCount; i++)
+    {
+        ConvertMessageHeaderToMsghdr(&headers[i].msg_hdr, &messageHeaders[i], fd);
+        headers[i].msg_len = 0;
+    }
+
+    int res;
+    while ((res = sendmmsg(fd, headers, (unsigned int)messageCount, socketFlags)) < 0 && errno == EINTR);
+
+    if (res < 0)
+    {
+        return SystemNative_ConvertErrorPlatformToPal(errno);
+    }
+
+    for (int i = 0; i < res; i++)
+    {
+        sent[i] = (int64_t)headers[i].msg_len;
+    }
+
+    *messagesSent = res;
+    return Error_SUCCESS;
+#else
+    for (int32_t i = 0; i < messageCount; i++)
+    {
+        struct msghdr header;
+        ConvertMessageHeaderToMsghdr(&header, &messageHeaders[i], fd);
+
+        ssize_t res;
+#if defined(__APPLE__) && __APPLE__
+        // See SystemNative_SendMessage.
+        int maxProtoRetry = 4;
+        while ((res = sendmsg(fd, &header, socketFlags)) < 0 && (errno == EINTR || (errno == EPROTOTYPE && --maxProtoRetry > 0)));
+#else
+        while ((res = sendmsg(fd, &header, socketFlags)) < 0 && errno == EINTR);
+#endif
+        if (res < 0)
+        {
+            // Like sendmmsg, report an error only when nothing was sent.
+            if (i == 0)
+            {
+                return SystemNative_ConvertErrorPlatformToPal(errno);
+            }
+
+            break;
+        }
+
+        sent[i] = res;
+        *messagesSent = i + 1;
+    }
+
+    return Error_SUCCESS;
+#endif
+}
+
+int32_t SystemNative_SetUdpSendSegmentSize(intptr_t socket, int32_t segmentSize)
+{
+    if (segmentSize < 0 || segmentSize > UINT16_MAX)
+    {
+        return Error_EINVAL;
+    }
+
+#ifdef UDP_SEGMENT
+    int fd = ToFileDescriptor(socket);
+    int value = segmentSize;
+    return setsockopt(fd, IPPROTO_UDP, UDP_SEGMENT, &value, sizeof(value)) == 0 ? Error_SUCCESS : SystemNative_ConvertErrorPlatformToPal(errno);
+#else
+    (void)socket;
+    return Error_ENOTSUP;
+#endif
+}
+
+int32_t SystemNative_SetUdpReceiveOffload(intptr_t socket, int32_t enabled)
+{
+#ifdef UDP_GRO
+    int fd = ToFileDescriptor(socket);
+    int value = enabled != 0 ? 1 : 0;
+    return setsockopt(fd, IPPROTO_UDP, UDP_GRO, &value, sizeof(value)) == 0 ? Error_SUCCESS : SystemNative_ConvertErrorPlatformToPal(errno);
+#else
+    (void)socket;
+    (void)enabled;
+    return Error_ENOTSUP;
+#endif
+}
+
+int32_t SystemNative_GetUdpReceiveSegmentSize(MessageHeader* messageHeader)
+{
+#ifdef UDP_GRO
+    if (messageHeader == NULL)
+    {
+        return 0;
+    }
+
+    struct msghdr header;
+    ConvertMessageHeaderToMsghdr(&header, messageHeader, -1);
+
+    for (struct cmsghdr* controlMessage = CMSG_FIRSTHDR(&header); controlMessage != NULL && controlMessage->cmsg_len > 0;
+         controlMessage = GET_CMSG_NXTHDR(&header, controlMessage))
+    {
+        if (controlMessage->cmsg_level == IPPROTO_UDP && controlMessage->cmsg_type == UDP_GRO)
+        {
+            int segmentSize;
+            memcpy(&segmentSize, CMSG_DATA(controlMessage), sizeof(segmentSize));
+            return segmentSize;
+        }
+    }
+#else
+    (void)messageHeader;
+#endif
+    return 0;
+}
+
+int32_t SystemNative_GetUdpReceiveSegmentSizeBufferSize(void)
+{
+#ifdef UDP_GRO
+    return (int32_t)CMSG_SPACE(sizeof(int));
+#else
+    return 0;
+#endif
+}
+
 int32_t SystemNative_Accept(intptr_t socket, uint8_t* socketAddress, int32_t* socketAddressLen, intptr_t* acceptedSocket)
 {
     if (socketAddress == NULL || socketAddressLen == NULL || acceptedSocket == NULL || *socketAddressLen < 0)
@@ -2652,10 +2928,511 @@ static uint32_t GetEPollEvents(SocketEvents events)
            (((events & SocketEvents_SA_ERROR) != 0) ? EPOLLERR : 0);
 }
 
+#if HAVE_LINUX_IO_URING_H && defined(IORING_POLL_ADD_MULTI) && defined(IORING_FEAT_RSRC_TAGS)
+#define HAVE_IO_URING_SOCKET_EVENT_PORT 1
+
+// io_uring based socket event port, used instead of epoll when it is enabled and the kernel
+// supports multishot poll (5.13+). SocketAsyncEngine is readiness based, so the port keeps the
+// contract of the epoll backend: every registration is a multishot IORING_OP_POLL_ADD, which posts
+// a completion per wakeup like EPOLLET, and WaitForSocketEvents reaps completions straight from
+// the shared completion ring, only entering the kernel when none are pending. Re-arming
+// terminated multishot polls is batched into that same io_uring_enter call.
+//
+// Unlike epoll, a pending poll request holds a reference to the socket, so sockets have to be
+// removed from the port before they are closed, see UnregisterSocketFromEventPorts.
+//
+// The port is opt-in through DOTNET_SYSTEM_NET_SOCKETS_IO_URING=1, epoll stays the default.
+
+enum
+{
+    IoUringEntries = 4096,
+    MaxIoUringPorts = 64,
+};
+
+// user_data of requests whose completions are ignored, poll requests use the socket + 1
+#define IoUringIgnoredUserData 0
+
+typedef struct
+{
+    uintptr_t Data;
+    SocketEvents Events;
+} IoUringRegistration;
+
+typedef struct
+{
+    int RingFd;
+    pthread_mutex_t Lock;
+
+    uint32_t* SqHead;
+    uint32_t* SqTail;
+    uint32_t SqMask;
+    uint32_t SqEntries;
+    uint32_t* SqArray;
+    struct io_uring_sqe* Sqes;
+    uint32_t SqLocalTail;
+    uint32_t SqPending;
+
+    uint32_t* CqHead;
+    uint32_t* CqTail;
+    uint32_t CqMask;
+    struct io_uring_cqe* Cqes;
+
+    void* SqRing;
+    size_t SqRingSize;
+    void* CqRing;
+    size_t CqRingSize;
+    size_t SqesSize;
+
+    // Indexed by socket file descriptor
+    IoUringRegistration* Registrations;
+    int32_t RegistrationsLength;
+} IoUringPort;
+
+static pthread_mutex_t g_ioUringPortsLock = PTHREAD_MUTEX_INITIALIZER;
+static IoUringPort* volatile g_ioUringPorts[MaxIoUringPorts];
+static volatile int32_t g_ioUringPortCount = 0;
+// -1: not probed yet, 0: unavailable or disabled, 1: available
+static volatile int32_t g_ioUringSupported = -1;
+// Indexed by file descriptor, non-zero while the descriptor is registered with an io_uring port.
+// Sized once from RLIMIT_NOFILE and never freed so SystemNative_Close can check it without locking,
+// descriptors past its end always take the locked path.
+static uint8_t* g_ioUringRegisteredFds;
+static int32_t g_ioUringRegisteredFdsLength;
+
+static IoUringPort* FindIoUringPort(int32_t port)
+{
+    if (g_ioUringPortCount == 0)
+    {
+        return NULL;
+    }
+
+    for (int i = 0; i < MaxIoUringPorts; i++)
+    {
+        IoUringPort* ioUringPort = g_ioUringPorts[i];
+        if (ioUringPort != NULL && ioUringPort->RingFd == port)
+        {
+            return ioUringPort;
+        }
+    }
+
+    return NULL;
+}
+
+static void FreeIoUringPort(IoUringPort* port)
+{
+    if (port->Sqes != NULL && port->Sqes != MAP_FAILED)
+    {
+        munmap(port->Sqes, port->SqesSize);
+    }
+    if (port->CqRing != NULL && port->CqRing != MAP_FAILED && port->CqRing != port->SqRing)
+    {
+        munmap(port->CqRing, port->CqRingSize);
+    }
+    if (port->SqRing != NULL && port->SqRing != MAP_FAILED)
+    {
+        munmap(port->SqRing, port->SqRingSize);
+    }
+    if (port->RingFd != -1)
+    {
+        close(port->RingFd);
+    }
+    pthread_mutex_destroy(&port->Lock);
+    free(port->Registrations);
+    free(port);
+}
+
+static IoUringPort* CreateIoUringPort(void)
+{
+    if (g_ioUringSupported == 0)
+    {
+        return NULL;
+    }
+    if (g_ioUringSupported == -1)
+    {
+        const char* setting = getenv("DOTNET_SYSTEM_NET_SOCKETS_IO_URING");
+        if (setting == NULL || strcmp(setting, "1") != 0)
+        {
+            g_ioUringSupported = 0;
+            return NULL;
+        }
+    }
+
+    IoUringPort* port = (IoUringPort*)calloc(1, sizeof(IoUringPort));
+    if (port == NULL)
+    {
+        return NULL;
+    }
+    port->RingFd = -1;
+    pthread_mutex_init(&port->Lock, NULL);
+
+    struct io_uring_params params;
+    memset(&params, 0, sizeof(params));
+    port->RingFd = (int)syscall(__NR_io_uring_setup, IoUringEntries, &params);
+    if (port->RingFd == -1 || (params.features & IORING_FEAT_RSRC_TAGS) == 0)
+    {
+        // Either io_uring is unavailable (old kernel, seccomp, disabled by sysctl) or it doesn't support multishot poll
+        g_ioUringSupported = 0;
+        FreeIoUringPort(port);
+        return NULL;
+    }
+    fcntl(port->RingFd, F_SETFD, FD_CLOEXEC);
+
+    port->SqRingSize = params.sq_off.array + params.sq_entries * sizeof(uint32_t);
+    port->CqRingSize = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+    if ((params.features & IORING_FEAT_SINGLE_MMAP) != 0 && port->CqRingSize > port->SqRingSize)
+    {
+        port->SqRingSize = port->CqRingSize;
+    }
+    port->SqRing = mmap(NULL, port->SqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, port->RingFd, IORING_OFF_SQ_RING);
+    if (port->SqRing == MAP_FAILED)
+    {
+        FreeIoUringPort(port);
+        return NULL;
+    }
+    if ((params.features & IORING_FEAT_SINGLE_MMAP) != 0)
+    {
+        port->CqRing = port->SqRing;
+    }
+    else
+    {
+        port->CqRing = mmap(NULL, port->CqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, port->RingFd, IORING_OFF_CQ_RING);
+        if (port->CqRing == MAP_FAILED)
+        {
+            FreeIoUringPort(port);
+            return NULL;
+        }
+    }
+    port->SqesSize = params.sq_entries * sizeof(struct io_uring_sqe);
+    port->Sqes = (struct io_uring_sqe*)mmap(NULL, port->SqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, port->RingFd, IORING_OFF_SQES);
+    if (port->Sqes == MAP_FAILED)
+    {
+        FreeIoUringPort(port);
+        return NULL;
+    }
+
+    uint8_t* sqRing = (uint8_t*)port->SqRing;
+    port->SqHead = (uint32_t*)(sqRing + params.sq_off.head);
+    port->SqTail = (uint32_t*)(sqRing + params.sq_off.tail);
+    port->SqMask = *(uint32_t*)(sqRing + params.sq_off.ring_mask);
+    port->SqEntries = params.sq_entries;
+    port->SqArray = (uint32_t*)(sqRing + params.sq_off.array);
+    port->SqLocalTail = *port->SqTail;
+
+    uint8_t* cqRing = (uint8_t*)port->CqRing;
+    port->CqHead = (uint32_t*)(cqRing + params.cq_off.head);
+    port->CqTail = (uint32_t*)(cqRing + params.cq_off.tail);
+    port->CqMask = *(uint32_t*)(cqRing + params.cq_off.ring_mask);
+    port->Cqes = (struct io_uring_cqe*)(cqRing + params.cq_off.cqes);
+
+    pthread_mutex_lock(&g_ioUringPortsLock);
+    int slot = -1;
+    if (g_ioUringRegisteredFds == NULL)
+    {
+        struct rlimit limit;
+        rlim_t length = getrlimit(RLIMIT_NOFILE, &limit) == 0 ? limit.rlim_cur : 1024;
+        if (length == RLIM_INFINITY || length > (1 << 20))
+        {
+            length = 1 << 20;
+        }
+        g_ioUringRegisteredFds = (uint8_t*)calloc((size_t)length, sizeof(uint8_t));
+        g_ioUringRegisteredFdsLength = g_ioUringRegisteredFds != NULL ? (int32_t)length : 0;
+    }
+    for (int i = 0; g_ioUringRegisteredFds != NULL && i < MaxIoUringPorts; i++)
+    {
+        if (g_ioUringPorts[i] == NULL)
+        {
+            slot = i;
+            break;
+        }
+    }
+    if (slot != -1)
+    {
+        g_ioUringPorts[slot] = port;
+        g_ioUringPortCount++;
+    }
+    pthread_mutex_unlock(&g_ioUringPortsLock);
+
+    if (slot == -1)
+    {
+        FreeIoUringPort(port);
+        return NULL;
+    }
+
+    g_ioUringSupported = 1;
+    return port;
+}
+
+// Submits the queued requests, WAIT makes it block for at least one completion. Called with the port lock held.
+static int32_t IoUringEnter(IoUringPort* port, int wait)
+{
+    __atomic_store_n(port->SqTail, port->SqLocalTail, __ATOMIC_RELEASE);
+
+    uint32_t toSubmit = port->SqPending;
+    port->SqPending = 0;
+    unsigned flags = wait ? IORING_ENTER_GETEVENTS : 0;
+    if (toSubmit == 0 && !wait)
+    {
+        return Error_SUCCESS;
+    }
+
+    int result;
+    while ((result = (int)syscall(__NR_io_uring_enter, port->RingFd, toSubmit, wait ? 1 : 0, flags, NULL, 0)) < 0 && errno == EINTR)
+    {
+        // The requests were consumed before the wait was interrupted, only wait again
+        toSubmit = 0;
+    }
+    return result < 0 ? SystemNative_ConvertErrorPlatformToPal(errno) : Error_SUCCESS;
+}
+
+// Returns a zeroed submission queue entry, submitting the queued ones if the ring is full. Called with the port lock held.
+static struct io_uring_sqe* GetIoUringSqe(IoUringPort* port)
+{
+    if (port->SqLocalTail - __atomic_load_n(port->SqHead, __ATOMIC_ACQUIRE) >= port->SqEntries)
+    {
+        IoUringEnter(port, 0);
+        if (port->SqLocalTail - __atomic_load_n(port->SqHead, __ATOMIC_ACQUIRE) >= port->SqEntries)
+        {
+            return NULL;
+        }
+    }
+
+    uint32_t index = port->SqLocalTail & port->SqMask;
+    struct io_uring_sqe* sqe = &port->Sqes[index];
+    memset(sqe, 0, sizeof(struct io_uring_sqe));
+    port->SqArray[index] = index;
+    port->SqLocalTail++;
+    port->SqPending++;
+    return sqe;
+}
+
+static int32_t QueueIoUringPollAdd(IoUringPort* port, int32_t socket, SocketEvents events)
+{
+    struct io_uring_sqe* sqe = GetIoUringSqe(port);
+    if (sqe == NULL)
+    {
+        return Error_EAGAIN;
+    }
+
+    sqe->opcode = IORING_OP_POLL_ADD;
+    sqe->fd = socket;
+    sqe->len = IORING_POLL_ADD_MULTI;
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    sqe->poll32_events = __builtin_bswap32(GetEPollEvents(events));
+#else
+    sqe->poll32_events = GetEPollEvents(events);
+#endif
+    sqe->user_data = (uint64_t)socket + 1;
+    return Error_SUCCESS;
+}
+
+static int32_t QueueIoUringPollRemove(IoUringPort* port, int32_t socket)
+{
+    struct io_uring_sqe* sqe = GetIoUringSqe(port);
+    if (sqe == NULL)
+    {
+        return Error_EAGAIN;
+    }
+
+    sqe->opcode = IORING_OP_POLL_REMOVE;
+    sqe->fd = -1;
+    sqe->addr = (uint64_t)socket + 1;
+    sqe->user_data = IoUringIgnoredUserData;
+    return Error_SUCCESS;
+}
+
+static int32_t TryChangeIoUringRegistration(IoUringPort* port, int32_t socket, SocketEvents currentEvents, SocketEvents newEvents, uintptr_t data)
+{
+    int32_t error = Error_SUCCESS;
+
+    pthread_mutex_lock(&port->Lock);
+
+    if (socket >= port->RegistrationsLength)
+    {
+        int32_t newLength = port->RegistrationsLength == 0 ? 1024 : port->RegistrationsLength;
+        while (newLength <= socket)
+        {
+            newLength *= 2;
+        }
+        IoUringRegistration* registrations = (IoUringRegistration*)realloc(port->Registrations, (size_t)newLength * sizeof(IoUringRegistration));
+        if (registrations == NULL)
+        {
+            pthread_mutex_unlock(&port->Lock);
+            return Error_ENOMEM;
+        }
+        memset(registrations + port->RegistrationsLength, 0, (size_t)(newLength - port->RegistrationsLength) * sizeof(IoUringRegistration));
+        port->Registrations = registrations;
+        port->RegistrationsLength = newLength;
+    }
+
+    // The remove is processed before the add since both are issued inline in submission order
+    if (currentEvents != SocketEvents_SA_NONE)
+    {
+        error = QueueIoUringPollRemove(port, socket);
+    }
+    if (error == Error_SUCCESS && newEvents != SocketEvents_SA_NONE)
+    {
+        error = QueueIoUringPollAdd(port, socket, newEvents);
+    }
+    if (error == Error_SUCCESS)
+    {
+        port->Registrations[socket].Data = data;
+        port->Registrations[socket].Events = newEvents;
+        if (socket < g_ioUringRegisteredFdsLength)
+        {
+            __atomic_store_n(&g_ioUringRegisteredFds[socket], newEvents != SocketEvents_SA_NONE ? 1 : 0, __ATOMIC_RELEASE);
+        }
+        error = IoUringEnter(port, 0);
+    }
+
+    pthread_mutex_unlock(&port->Lock);
+    return error;
+}
+
+static int32_t WaitForIoUringEvents(IoUringPort* port, SocketEvent* buffer, int32_t* count)
+{
+    int32_t numEvents = 0;
+
+    pthread_mutex_lock(&port->Lock);
+
+    for (;;)
+    {
+        uint32_t head = *port->CqHead;
+        uint32_t tail = __atomic_load_n(port->CqTail, __ATOMIC_ACQUIRE);
+
+        for (; head != tail && numEvents < *count; head++)
+        {
+            struct io_uring_cqe* cqe = &port->Cqes[head & port->CqMask];
+            if (cqe->user_data == IoUringIgnoredUserData)
+            {
+                continue;
+            }
+
+            int32_t socket = (int32_t)(cqe->user_data - 1);
+            if (socket >= port->RegistrationsLength)
+            {
+                continue;
+            }
+
+            IoUringRegistration* registration = &port->Registrations[socket];
+            if (registration->Events == SocketEvents_SA_NONE || cqe->res == -ECANCELED)
+            {
+                // A completion of a poll which was removed
+                continue;
+            }
+
+            if ((cqe->flags & IORING_CQE_F_MORE) == 0)
+            {
+                // The kernel terminated the multishot poll, e.g. on completion queue overflow, arm it again
+                QueueIoUringPollAdd(port, socket, registration->Events);
+            }
+
+            if (cqe->res < 0)
+            {
+                continue;
+            }
+
+            // Same as the epoll backend, EPOLLHUP is handled as EPOLLIN | EPOLLOUT
+            uint32_t events = (uint32_t)cqe->res;
+            if ((events & EPOLLHUP) != 0)
+            {
+                events = (events & ((uint32_t)~EPOLLHUP)) | EPOLLIN | EPOLLOUT;
+            }
+
+            memset(&buffer[numEvents], 0, sizeof(SocketEvent));
+            buffer[numEvents].Data = registration->Data;
+            buffer[numEvents].Events = GetSocketEvents(events);
+            numEvents++;
+        }
+
+        __atomic_store_n(port->CqHead, head, __ATOMIC_RELEASE);
+
+        if (numEvents > 0)
+        {
+            IoUringEnter(port, 0);
+            break;
+        }
+
+        // Nothing pending, block in the kernel. Registrations from other threads submit their own
+        // requests, so the lock isn't held while waiting.
+        __atomic_store_n(port->SqTail, port->SqLocalTail, __ATOMIC_RELEASE);
+        uint32_t toSubmit = port->SqPending;
+        port->SqPending = 0;
+        pthread_mutex_unlock(&port->Lock);
+
+        int result;
+        while ((result = (int)syscall(__NR_io_uring_enter, port->RingFd, toSubmit, 1, IORING_ENTER_GETEVENTS, NULL, 0)) < 0 && errno == EINTR)
+        {
+            toSubmit = 0;
+        }
+        if (result < 0)
+        {
+            *count = 0;
+            return SystemNative_ConvertErrorPlatformToPal(errno);
+        }
+
+        pthread_mutex_lock(&port->Lock);
+    }
+
+    pthread_mutex_unlock(&port->Lock);
+
+    *count = numEvents;
+    return Error_SUCCESS;
+}
+
+void UnregisterSocketFromEventPorts(int fd)
+{
+    // Most descriptors closed here are files, or sockets that were never registered
+    if (g_ioUringPortCount == 0 || fd < 0)
+    {
+        return;
+    }
+    if (fd < g_ioUringRegisteredFdsLength)
+    {
+        if (__atomic_load_n(&g_ioUringRegisteredFds[fd], __ATOMIC_ACQUIRE) == 0)
+        {
+            return;
+        }
+        __atomic_store_n(&g_ioUringRegisteredFds[fd], 0, __ATOMIC_RELAXED);
+    }
+
+    pthread_mutex_lock(&g_ioUringPortsLock);
+    for (int i = 0; i < MaxIoUringPorts; i++)
+    {
+        IoUringPort* port = g_ioUringPorts[i];
+        if (port == NULL)
+        {
+            continue;
+        }
+
+        pthread_mutex_lock(&port->Lock);
+        if (fd < port->RegistrationsLength && port->Registrations[fd].Events != SocketEvents_SA_NONE)
+        {
+            port->Registrations[fd].Events = SocketEvents_SA_NONE;
+            if (QueueIoUringPollRemove(port, fd) == Error_SUCCESS)
+            {
+                IoUringEnter(port, 0);
+            }
+        }
+        pthread_mutex_unlock(&port->Lock);
+    }
+    pthread_mutex_unlock(&g_ioUringPortsLock);
+}
+
+#endif // HAVE_LINUX_IO_URING_H && defined(IORING_POLL_ADD_MULTI) && defined(IORING_FEAT_RSRC_TAGS)
+
 static int32_t CreateSocketEventPortInner(int32_t* port)
 {
     assert(port != NULL);
 
+#ifdef HAVE_IO_URING_SOCKET_EVENT_PORT
+    IoUringPort* ioUringPort = CreateIoUringPort();
+    if (ioUringPort != NULL)
+    {
+        *port = ioUringPort->RingFd;
+        return Error_SUCCESS;
+    }
+#endif
+
     int epollFd = epoll_create1(EPOLL_CLOEXEC);
     if (epollFd == -1)
     {
@@ -2669,6 +3446,25 @@ static int32_t CreateSocketEventPortInner(int32_t* port)
 
 static int32_t CloseSocketEventPortInner(int32_t port)
 {
+#ifdef HAVE_IO_URING_SOCKET_EVENT_PORT
+    IoUringPort* ioUringPort = FindIoUringPort(port);
+    if (ioUringPort != NULL)
+    {
+        pthread_mutex_lock(&g_ioUringPortsLock);
+        for (int i = 0; i < MaxIoUringPorts; i++)
+        {
+            if (g_ioUringPorts[i] == ioUringPort)
+            {
+                g_ioUringPorts[i] = NULL;
+                g_ioUringPortCount--;
+            }
+        }
+        pthread_mutex_unlock(&g_ioUringPortsLock);
+        FreeIoUringPort(ioUringPort);
+        return Error_SUCCESS;
+    }
+#endif
+
     int err = close(port);
     return err == 0 || (err < 0 && errno == EINTR) ? Error_SUCCESS : SystemNative_ConvertErrorPlatformToPal(errno);
 }
@@ -2678,6 +3474,14 @@ static int32_t TryChangeSocketEventRegistrationInner(
 {
     assert(currentEvents != newEvents);
 
+#ifdef HAVE_IO_URING_SOCKET_EVENT_PORT
+    IoUringPort* ioUringPort = FindIoUringPort(port);
+    if (ioUringPort != NULL)
+    {
+        return TryChangeIoUringRegistration(ioUringPort, socket, currentEvents, newEvents, data);
+    }
+#endif
+
     int op = EPOLL_CTL_MOD;
     if (currentEvents == SocketEvents_SA_NONE)
     {
@@ -2722,6 +3526,14 @@ static int32_t WaitForSocketEventsInner(int32_t port, SocketEvent* buffer, int32
     assert(count != NULL);
     assert(*count >= 0);
 
+#ifdef HAVE_IO_URING_SOCKET_EVENT_PORT
+    IoUringPort* ioUringPort = FindIoUringPort(port);
+    if (ioUringPort != NULL)
+    {
+        return WaitForIoUringEvents(ioUringPort, buffer, count);
+    }
+#endif
+
     struct epoll_event* events = (struct epoll_event*)buffer;
     int numEvents;
     while ((numEvents = epoll_wait(port, events, *count, -1)) < 0 && errno == EINTR);
@@ -2952,6 +3764,14 @@ static int32_t WaitForSocketEventsInner(int32_t port, SocketEvent* buffer, int32
 
 #endif
 
+#ifndef HAVE_IO_URING_SOCKET_EVENT_PORT
+void UnregisterSocketFromEventPorts(int fd)
+{
+    // Only io_uring ports hold references to the registered sockets
+    (void)fd;
+}
+#endif
+
 int32_t SystemNative_CreateSocketEventPort(intptr_t* port)
 {
     if (port == NULL)
@@ -3263,6 +4083,156 @@ error:
 #endif
 }
 
+#if HAVE_LINUX_ERRQUEUE_H && defined(MSG_ZEROCOPY) && defined(SO_ZEROCOPY) && defined(SO_EE_ORIGIN_ZEROCOPY)
+#define HAVE_ZEROCOPY_SEND 1
+#endif
+
+int32_t SystemNative_SetZeroCopySend(intptr_t socket, int32_t enabled)
+{
+#ifdef HAVE_ZEROCOPY_SEND
+    int fd = ToFileDescriptor(socket);
+    int value = enabled != 0 ? 1 : 0;
+    return setsockopt(fd, SOL_SOCKET, SO_ZEROCOPY, &value, sizeof(value)) == 0 ? Error_SUCCESS : SystemNative_ConvertErrorPlatformToPal(errno);
+#else
+    (void)socket;
+    (void)enabled;
+    return Error_ENOTSUP;
+#endif
+}
+
+int32_t SystemNative_SendMessageZeroCopy(intptr_t socket, MessageHeader* messageHeader, int32_t flags, int64_t* sent)
+{
+#ifdef HAVE_ZEROCOPY_SEND
+    if (messageHeader == NULL || sent == NULL || messageHeader->SocketAddressLen < 0 ||
+        messageHeader->ControlBufferLen < 0 || messageHeader->IOVectorCount < 0)
+    {
+        return Error_EFAULT;
+    }
+
+    int fd = ToFileDescriptor(socket);
+
+    int socketFlags;
+    if (!ConvertSocketFlagsPalToPlatform(flags, &socketFlags))
+    {
+        return Error_ENOTSUP;
+    }
+
+    struct msghdr header;
+    ConvertMessageHeaderToMsghdr(&header, messageHeader, fd);
+
+    ssize_t res;
+    while ((res = sendmsg(fd, &header, socketFlags | MSG_ZEROCOPY)) < 0 && errno == EINTR);
+
+    if (res != -1)
+    {
+        *sent = res;
+        return Error_SUCCESS;
+    }
+
+    *sent = 0;
+    return SystemNative_ConvertErrorPlatformToPal(errno);
+#else
+    (void)socket;
+    (void)messageHeader;
+    (void)flags;
+    if (sent != NULL)
+    {
+        *sent = 0;
+    }
+    return Error_ENOTSUP;
+#endif
+}
+
+int32_t SystemNative_ReadZeroCopyCompletion(intptr_t socket, uint32_t* firstId, uint32_t* lastId, int32_t* copied)
+{
+    if (firstId == NULL || lastId == NULL || copied == NULL)
+    {
+        return Error_EFAULT;
+    }
+
+    *firstId = 0;
+    *lastId = 0;
+    *copied = 0;
+
+#ifdef HAVE_ZEROCOPY_SEND
+    int fd = ToFileDescriptor(socket);
+
+    // Completions are queued on the socket error queue; reading it never blocks.
+    uint8_t control[CMSG_SPACE(sizeof(struct sock_extended_err) + sizeof(struct sockaddr_in6))];
+    struct msghdr header;
+    memset(&header, 0, sizeof(header));
+    header.msg_control = control;
+    header.msg_controllen = sizeof(control);
+
+    ssize_t res;
+    while ((res = recvmsg(fd, &header, MSG_ERRQUEUE | MSG_DONTWAIT)) < 0 && errno == EINTR);
+
+    if (res < 0)
+    {
+        return SystemNative_ConvertErrorPlatformToPal(errno);
+    }
+
+    for (struct cmsghdr* controlMessage = CMSG_FIRSTHDR(&header); controlMessage != NULL && controlMessage->cmsg_len > 0;
+         controlMessage = GET_CMSG_NXTHDR(&header, controlMessage))
+    {
+        if (!((controlMessage->cmsg_level == SOL_IP && controlMessage->cmsg_type == IP_RECVERR) ||
+              (controlMessage->cmsg_level == SOL_IPV6 && controlMessage->cmsg_type == IPV6_RECVERR)))
+        {
+            continue;
+        }
+
+        struct sock_extended_err error;
+        memcpy(&error, CMSG_DATA(controlMessage), sizeof(error));
+        if (error.ee_errno != 0 || error.ee_origin != SO_EE_ORIGIN_ZEROCOPY)
+        {
+            continue;
+        }
+
+        // The notification covers the inclusive range of zero-copy sends [ee_info, ee_data].
+        *firstId = error.ee_info;
+        *lastId = error.ee_data;
+        *copied = (error.ee_code & SO_EE_CODE_ZEROCOPY_COPIED) != 0;
+        return Error_SUCCESS;
+    }
+
+    // Something other than a zero-copy completion was queued.
+    return Error_EAGAIN;
+#else
+    (void)socket;
+    return Error_ENOTSUP;
+#endif
+}
+
+int32_t SystemNative_Splice(intptr_t in_fd, intptr_t out_fd, int64_t count, int64_t* spliced)
+{
+    if (spliced == NULL || count < 0)
+    {
+        return Error_EFAULT;
+    }
+
+    *spliced = 0;
+
+#if HAVE_SPLICE
+    int infd = ToFileDescriptor(in_fd);
+    int outfd = ToFileDescriptor(out_fd);
+
+    ssize_t res;
+    while ((res = splice(infd, NULL, outfd, NULL, (size_t)count, SPLICE_F_MOVE | SPLICE_F_NONBLOCK)) < 0 && errno == EINTR);
+
+    if (res != -1)
+    {
+        *spliced = res;
+        return Error_SUCCESS;
+    }
+
+    return SystemNative_ConvertErrorPlatformToPal(errno);
+#else
+    (void)in_fd;
+    (void)out_fd;
+    return Error_ENOTSUP;
+#endif
+}
+
 uint32_t SystemNative_InterfaceNameToIndex(char* interfaceName)
 {
     assert(interfaceName != NULL);
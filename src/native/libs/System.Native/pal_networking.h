@@ -360,6 +360,52 @@ PALEXPORT int32_t SystemNative_Send(intptr_t socket, void* buffer, int32_t buffe
 
 PALEXPORT int32_t SystemNative_SendMessage(intptr_t socket, MessageHeader* messageHeader, int32_t flags, int64_t* sent);
 
+/**
+ * Receives up to messageCount datagrams with a single call where the platform supports it (recvmmsg).
+ * Blocks (subject to the socket mode) only for the first datagram; the call returns as soon as no more
+ * are queued. On success, *messagesReceived holds the number of headers filled in and received[i] the
+ * byte count of each; the address, control buffer lengths and flags of those headers are updated.
+ */
+PALEXPORT int32_t SystemNative_ReceiveMessages(intptr_t socket,
+                                               MessageHeader* messageHeaders,
+                                               int64_t* received,
+                                               int32_t messageCount,
+                                               int32_t flags,
+                                               int32_t* messagesReceived);
+
+/**
+ * Sends up to messageCount datagrams with a single call where the platform supports it (sendmmsg).
+ * On success, *messagesSent holds the number of datagrams sent, which may be less than messageCount,
+ * and sent[i] the byte count of each. An error is only returned when no datagram could be sent.
+ */
+PALEXPORT int32_t SystemNative_SendMessages(intptr_t socket,
+                                            MessageHeader* messageHeaders,
+                                            int64_t* sent,
+                                            int32_t messageCount,
+                                            int32_t flags,
+                                            int32_t* messagesSent);
+
+/**
+ * Enables UDP generic segmentation offload: datagrams sent on the socket are split by the kernel (or the NIC)
+ * into segments of segmentSize bytes. Zero disables it. Returns Error_ENOTSUP where the platform lacks UDP_SEGMENT.
+ */
+PALEXPORT int32_t SystemNative_SetUdpSendSegmentSize(intptr_t socket, int32_t segmentSize);
+
+/**
+ * Enables UDP generic receive offload: the kernel may coalesce consecutive datagrams from the same flow into
+ * one receive, see SystemNative_GetUdpReceiveSegmentSize. Returns Error_ENOTSUP where the platform lacks UDP_GRO.
+ */
+PALEXPORT int32_t SystemNative_SetUdpReceiveOffload(intptr_t socket, int32_t enabled);
+
+/**
+ * Returns the size of the segments coalesced into a message received with UDP_GRO enabled, or 0 when the message
+ * holds a single datagram. The control buffer must have room for SystemNative_GetUdpReceiveSegmentSizeBufferSize bytes
+ * in addition to any other control messages requested.
+ */
+PALEXPORT int32_t SystemNative_GetUdpReceiveSegmentSize(MessageHeader* messageHeader);
+
+PALEXPORT int32_t SystemNative_GetUdpReceiveSegmentSizeBufferSize(void);
+
 PALEXPORT int32_t SystemNative_Accept(intptr_t socket, uint8_t* socketAddress, int32_t* socketAddressLen, intptr_t* acceptedSocket);
 
 PALEXPORT int32_t SystemNative_Bind(intptr_t socket, int32_t protocolType, uint8_t* socketAddress, int32_t socketAddressLen);
@@ -409,6 +455,12 @@ PALEXPORT int32_t SystemNative_TryChangeSocketEventRegistration(
 
 PALEXPORT int32_t SystemNative_WaitForSocketEvents(intptr_t port, SocketEvent* buffer, int32_t* count);
 
+/**
+ * Removes a socket from the socket event ports before it is closed. Called by SystemNative_Close,
+ * the io_uring based ports would otherwise keep the socket open through their pending poll requests.
+ */
+void UnregisterSocketFromEventPorts(int fd);
+
 PALEXPORT int32_t SystemNative_PlatformSupportsDualModeIPv4PacketInfo(void);
 
 PALEXPORT char* SystemNative_GetPeerUserName(intptr_t socket);
@@ -419,6 +471,34 @@ PALEXPORT int32_t SystemNative_GetMaximumAddressSize(void);
 
 PALEXPORT int32_t SystemNative_SendFile(intptr_t out_fd, intptr_t in_fd, int64_t offset, int64_t count, int64_t* sent);
 
+/**
+ * Enables SO_ZEROCOPY on the socket, a prerequisite for SystemNative_SendMessageZeroCopy.
+ * Returns Error_ENOTSUP where the platform has no zero-copy sends.
+ */
+PALEXPORT int32_t SystemNative_SetZeroCopySend(intptr_t socket, int32_t enabled);
+
+/**
+ * Sends with MSG_ZEROCOPY: the kernel pins the buffers instead of copying them, so they must stay unchanged
+ * until the send is reported complete by SystemNative_ReadZeroCopyCompletion. Each successful call is assigned
+ * the next 32-bit id, starting at 0 for the socket. Only worthwhile for large (multi-kilobyte) payloads.
+ */
+PALEXPORT int32_t SystemNative_SendMessageZeroCopy(intptr_t socket, MessageHeader* messageHeader, int32_t flags, int64_t* sent);
+
+/**
+ * Reads one completion notification from the socket error queue without blocking. On success the sends with
+ * ids in [*firstId, *lastId] are complete and their buffers may be reused; *copied is non-zero when the kernel
+ * fell back to copying, in which case zero-copy is not paying off for this socket. Returns Error_EAGAIN when
+ * no notification is queued. The socket reports POLLERR while notifications are pending.
+ */
+PALEXPORT int32_t SystemNative_ReadZeroCopyCompletion(intptr_t socket, uint32_t* firstId, uint32_t* lastId, int32_t* copied);
+
+/**
+ * Moves up to count bytes between two descriptors, one of which must be a pipe, without copying through
+ * user space. Forwarding between sockets goes through an intermediate pipe. Never blocks on the pipe end.
+ * Returns Error_ENOTSUP where the platform has no splice.
+ */
+PALEXPORT int32_t SystemNative_Splice(intptr_t in_fd, intptr_t out_fd, int64_t count, int64_t* spliced);
+
 PALEXPORT int32_t SystemNative_Disconnect(intptr_t socket);
 
 PALEXPORT uint32_t SystemNative_InterfaceNameToIndex(char* interfaceName);
@@ -10,6 +10,7 @@
 #include <unistd.h>
 #include <time.h>
 #include <errno.h>
+#include <string.h>
 #if defined(__APPLE__) && __APPLE__
 #include <CommonCrypto/CommonRandom.h>
 #endif
@@ -17,6 +18,20 @@
 #include "pal_config.h"
 #include "pal_random.h"
 
+#if defined(__linux__)
+#include <sys/syscall.h>
+#endif
+
+#if !defined(__EMSCRIPTEN__) && !(defined(__APPLE__) && __APPLE__)
+#include <pthread.h>
+#include <sys/mman.h>
+
+// Small requests, e.g. for Guid.NewGuid or tokens, are served from a per-thread buffer of ChaCha20
+// output instead of doing one system call each. Larger ones go to the kernel directly, where the
+// call is amortized over the size.
+#define USE_BUFFERED_RANDOM 1
+#endif
+
 /*
 
 Generate random bytes. The generated bytes are not cryptographically strong.
@@ -58,39 +73,50 @@ void SystemNative_GetNonCryptographicallySecureRandomBytes(uint8_t* buffer, int3
 #endif // HAVE_ARC4RANDOM_BUF
 }
 
+#if !defined(__EMSCRIPTEN__) && !(defined(__APPLE__) && __APPLE__)
 /*
-
-Generate cryptographically strong random bytes.
+Reads random bytes from the kernel, with getrandom when available and /dev/urandom otherwise.
+getrandom is called through syscall because older C libraries have no wrapper for it.
 
 Return 0 on success, -1 on failure.
 */
-int32_t SystemNative_GetCryptographicallySecureRandomBytes(uint8_t* buffer, int32_t bufferLength)
+static int32_t GetKernelRandomBytes(uint8_t* buffer, int32_t bufferLength)
 {
-    assert(buffer != NULL);
+#if defined(__linux__) && defined(SYS_getrandom)
+    static bool sMissingGetRandom;
 
-#ifdef __EMSCRIPTEN__
-    extern int32_t dotnet_browser_entropy(uint8_t* buffer, int32_t bufferLength);
-    static bool sMissingBrowserCrypto;
-    if (!sMissingBrowserCrypto)
+    if (!sMissingGetRandom)
     {
-        int32_t bff = dotnet_browser_entropy(buffer, bufferLength);
-        if (bff == -1)
-            sMissingBrowserCrypto = true;
-        else
-            return 0;
-    }
-#elif defined(__APPLE__) && __APPLE__
-    CCRNGStatus status = CCRandomGenerateBytes(buffer, bufferLength);
+        int32_t offset = 0;
+        while (offset != bufferLength)
+        {
+            long n = syscall(SYS_getrandom, buffer + offset, (size_t)(bufferLength - offset), 0);
+            if (n == -1)
+            {
+                if (errno == EINTR)
+                {
+                    continue;
+                }
 
-    if (status == kCCSuccess)
-    {
-        return 0;
-    }
-    else
-    {
-        return -1;
+                if (errno == ENOSYS)
+                {
+                    // Kernels before 3.17
+                    sMissingGetRandom = true;
+                    break;
+                }
+
+                return -1;
+            }
+
+            offset += (int32_t)n;
+        }
+
+        if (offset == bufferLength)
+        {
+            return 0;
+        }
     }
-#else
+#endif
 
     static volatile int rand_des = -1;
     static bool sMissingDevURandom;
@@ -148,6 +174,259 @@ int32_t SystemNative_GetCryptographicallySecureRandomBytes(uint8_t* buffer, int3
             return 0;
         }
     }
+
+    return -1;
+}
+#endif
+
+#if defined(USE_BUFFERED_RANDOM)
+#define CHACHA20_KEY_SIZE 32
+#define CHACHA20_BLOCK_SIZE 64
+#define BUFFERED_RANDOM_BLOCKS 16
+#define BUFFERED_RANDOM_MAX_REQUEST 256
+#define BUFFERED_RANDOM_RESEED_BYTES (1024 * 1024)
+
+/*
+A fast-key-erasure generator: each refill runs ChaCha20 over the buffer and immediately replaces the
+key with the first output bytes, and bytes are wiped as they are handed out, so the state never holds
+anything that reveals output already returned.
+*/
+typedef struct
+{
+    uint32_t key[CHACHA20_KEY_SIZE / 4];
+    uint8_t buffer[CHACHA20_BLOCK_SIZE * BUFFERED_RANDOM_BLOCKS];
+    uint32_t available;           // unread bytes at the end of buffer
+    uint32_t generation;          // s_forkGeneration when the key was seeded
+    uint64_t bytesSinceSeed;
+    bool seeded;                  // cleared by the kernel in a forked child with MADV_WIPEONFORK
+} BufferedRandom;
+
+static pthread_once_t s_bufferedRandomOnce = PTHREAD_ONCE_INIT;
+static pthread_key_t s_bufferedRandomKey;
+static bool s_bufferedRandomKeyCreated;
+
+// Bumped in the child after fork, which otherwise would continue with a copy of the parent's state
+static uint32_t s_forkGeneration;
+
+// Called through a volatile pointer so the compiler can't drop the wipe of memory that is not read again
+static void* (*const volatile s_memset)(void*, int, size_t) = memset;
+
+#define ROTL32(v, n) (((v) << (n)) | ((v) >> (32 - (n))))
+
+#define CHACHA20_QUARTERROUND(a, b, c, d) \
+    a += b; d ^= a; d = ROTL32(d, 16); \
+    c += d; b ^= c; b = ROTL32(b, 12); \
+    a += b; d ^= a; d = ROTL32(d, 8); \
+    c += d; b ^= c; b = ROTL32(b, 7);
+
+static void ChaCha20Block(const uint32_t* key, uint64_t counter, uint8_t* output)
+{
+    // "expand 32-byte k", key, 64-bit block counter and zero nonce
+    uint32_t input[16] =
+    {
+        0x61707865, 0x3320646e, 0x79622d32, 0x6b206574,
+        key[0], key[1], key[2], key[3], key[4], key[5], key[6], key[7],
+        (uint32_t)counter, (uint32_t)(counter >> 32), 0, 0
+    };
+    uint32_t x[16];
+
+    memcpy(x, input, sizeof(x));
+
+    for (int i = 0; i < 10; i++)
+    {
+        CHACHA20_QUARTERROUND(x[0], x[4], x[8], x[12])
+        CHACHA20_QUARTERROUND(x[1], x[5], x[9], x[13])
+        CHACHA20_QUARTERROUND(x[2], x[6], x[10], x[14])
+        CHACHA20_QUARTERROUND(x[3], x[7], x[11], x[15])
+        CHACHA20_QUARTERROUND(x[0], x[5], x[10], x[15])
+        CHACHA20_QUARTERROUND(x[1], x[6], x[11], x[12])
+        CHACHA20_QUARTERROUND(x[2], x[7], x[8], x[13])
+        CHACHA20_QUARTERROUND(x[3], x[4], x[9], x[14])
+    }
+
+    for (int i = 0; i < 16; i++)
+    {
+        uint32_t v = x[i] + input[i];
+        output[i * 4] = (uint8_t)v;
+        output[i * 4 + 1] = (uint8_t)(v >> 8);
+        output[i * 4 + 2] = (uint8_t)(v >> 16);
+        output[i * 4 + 3] = (uint8_t)(v >> 24);
+    }
+
+    s_memset(x, 0, sizeof(x));
+    s_memset(input, 0, sizeof(input));
+}
+
+static void RefillBufferedRandom(BufferedRandom* pState)
+{
+    for (uint32_t i = 0; i < BUFFERED_RANDOM_BLOCKS; i++)
+    {
+        ChaCha20Block(pState->key, i, pState->buffer + i * CHACHA20_BLOCK_SIZE);
+    }
+
+    memcpy(pState->key, pState->buffer, CHACHA20_KEY_SIZE);
+    s_memset(pState->buffer, 0, CHACHA20_KEY_SIZE);
+    pState->available = sizeof(pState->buffer) - CHACHA20_KEY_SIZE;
+}
+
+static int32_t SeedBufferedRandom(BufferedRandom* pState)
+{
+    if (GetKernelRandomBytes((uint8_t*)pState->key, CHACHA20_KEY_SIZE) != 0)
+    {
+        pState->seeded = false;
+        return -1;
+    }
+
+    pState->seeded = true;
+    pState->generation = __atomic_load_n(&s_forkGeneration, __ATOMIC_ACQUIRE);
+    pState->bytesSinceSeed = 0;
+
+    // Drop output derived from the previous key
+    RefillBufferedRandom(pState);
+    return 0;
+}
+
+static void OnForkChild(void)
+{
+    __atomic_fetch_add(&s_forkGeneration, 1, __ATOMIC_RELEASE);
+}
+
+static void FreeBufferedRandom(void* pState)
+{
+    s_memset(pState, 0, sizeof(BufferedRandom));
+    munmap(pState, sizeof(BufferedRandom));
+}
+
+static void CreateBufferedRandomKey(void)
+{
+    s_bufferedRandomKeyCreated = pthread_key_create(&s_bufferedRandomKey, FreeBufferedRandom) == 0 &&
+                                 pthread_atfork(NULL, NULL, OnForkChild) == 0;
+}
+
+static BufferedRandom* GetBufferedRandom(void)
+{
+    pthread_once(&s_bufferedRandomOnce, CreateBufferedRandomKey);
+
+    if (!s_bufferedRandomKeyCreated)
+    {
+        return NULL;
+    }
+
+    BufferedRandom* pState = (BufferedRandom*)pthread_getspecific(s_bufferedRandomKey);
+
+    if (pState == NULL)
+    {
+        // Mapped separately so that it can be excluded from core dumps and wiped in forked children
+        void* mem = mmap(NULL, sizeof(BufferedRandom), PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (mem == MAP_FAILED)
+        {
+            return NULL;
+        }
+
+#ifdef MADV_WIPEONFORK
+        madvise(mem, sizeof(BufferedRandom), MADV_WIPEONFORK);
+#endif
+#ifdef MADV_DONTDUMP
+        madvise(mem, sizeof(BufferedRandom), MADV_DONTDUMP);
+#endif
+
+        if (pthread_setspecific(s_bufferedRandomKey, mem) != 0)
+        {
+            munmap(mem, sizeof(BufferedRandom));
+            return NULL;
+        }
+
+        pState = (BufferedRandom*)mem;
+    }
+
+    return pState;
+}
+
+static int32_t GetBufferedRandomBytes(uint8_t* buffer, int32_t bufferLength)
+{
+    BufferedRandom* pState = GetBufferedRandom();
+
+    if (pState == NULL)
+    {
+        return -1;
+    }
+
+    if (!pState->seeded ||
+        pState->generation != __atomic_load_n(&s_forkGeneration, __ATOMIC_ACQUIRE) ||
+        pState->bytesSinceSeed >= BUFFERED_RANDOM_RESEED_BYTES)
+    {
+        if (SeedBufferedRandom(pState) != 0)
+        {
+            return -1;
+        }
+    }
+
+    uint32_t remaining = (uint32_t)bufferLength;
+
+    while (remaining != 0)
+    {
+        if (pState->available == 0)
+        {
+            RefillBufferedRandom(pState);
+        }
+
+        uint32_t count = remaining < pState->available ? remaining : pState->available;
+        uint8_t* source = pState->buffer + sizeof(pState->buffer) - pState->available;
+
+        memcpy(buffer, source, count);
+        s_memset(source, 0, count);
+
+        buffer += count;
+        remaining -= count;
+        pState->available -= count;
+    }
+
+    pState->bytesSinceSeed += (uint32_t)bufferLength;
+    return 0;
+}
+#endif // USE_BUFFERED_RANDOM
+
+/*
+
+Generate cryptographically strong random bytes.
+
+Return 0 on success, -1 on failure.
+*/
+int32_t SystemNative_GetCryptographicallySecureRandomBytes(uint8_t* buffer, int32_t bufferLength)
+{
+    assert(buffer != NULL);
+
+#ifdef __EMSCRIPTEN__
+    extern int32_t dotnet_browser_entropy(uint8_t* buffer, int32_t bufferLength);
+    static bool sMissingBrowserCrypto;
+    if (!sMissingBrowserCrypto)
+    {
+        int32_t bff = dotnet_browser_entropy(buffer, bufferLength);
+        if (bff == -1)
+            sMissingBrowserCrypto = true;
+        else
+            return 0;
+    }
+#elif defined(__APPLE__) && __APPLE__
+    CCRNGStatus status = CCRandomGenerateBytes(buffer, bufferLength);
+
+    if (status == kCCSuccess)
+    {
+        return 0;
+    }
+    else
+    {
+        return -1;
+    }
+#else
+#if defined(USE_BUFFERED_RANDOM)
+    if (bufferLength <= BUFFERED_RANDOM_MAX_REQUEST && GetBufferedRandomBytes(buffer, bufferLength) == 0)
+    {
+        return 0;
+    }
+#endif
+
+    return GetKernelRandomBytes(buffer, bufferLength);
 #endif
     return -1;
 }
@@ -3,9 +3,12 @@
 
 #include "pal_config.h"
 #include "pal_time.h"
+#include "pal_datetime.h"
 #include "pal_utilities.h"
 
 #include <assert.h>
+#include <errno.h>
+#include <pthread.h>
 #include <utime.h>
 #include <time.h>
 #include <sys/stat.h>
@@ -15,15 +18,36 @@
 #if HAVE_CLOCK_GETTIME_NSEC_NP
 #include <time.h>
 #endif
+#if defined(__x86_64__) || defined(__i386__)
+#include <cpuid.h>
+#include <x86intrin.h>
+#endif
+
+#if defined(CLOCK_MONOTONIC_COARSE)
+#define COARSE_MONOTONIC_CLOCK CLOCK_MONOTONIC_COARSE
+#define COARSE_REALTIME_CLOCK CLOCK_REALTIME_COARSE
+#elif defined(CLOCK_MONOTONIC_FAST)
+#define COARSE_MONOTONIC_CLOCK CLOCK_MONOTONIC_FAST
+#define COARSE_REALTIME_CLOCK CLOCK_REALTIME_FAST
+#endif
 
 enum
 {
     MicroSecondsToNanoSeconds = 1000,   // 10^3
+    MilliSecondsToNanoSeconds = 1000000, // 10^6
     SecondsToNanoSeconds = 1000000000,  // 10^9
     SecondsToTicks = 10000000,          // 10^7
     TicksToNanoSeconds = 100,           // 10^2
 };
 
+// Values stored by the cached clock thread, 0 while it isn't running
+static uint64_t s_cachedTimestamp;
+static int64_t s_cachedSystemTimeTicks;
+static int32_t s_cachedClockIntervalMilliseconds;
+
+// 0 until computed, UINT64_MAX when there is no usable counter
+static uint64_t s_timeStampCounterFrequency;
+
 int32_t SystemNative_UTimensat(const char* path, TimeSpec* times)
 {
     int32_t result;
@@ -96,6 +120,211 @@ uint64_t SystemNative_GetTimestamp(void)
 #endif
 }
 
+uint64_t SystemNative_GetCoarseTimestamp(void)
+{
+#if HAVE_CLOCK_GETTIME_NSEC_NP
+    return clock_gettime_nsec_np(CLOCK_UPTIME_RAW_APPROX);
+#elif defined(COARSE_MONOTONIC_CLOCK)
+    struct timespec ts;
+
+    int result = clock_gettime(COARSE_MONOTONIC_CLOCK, &ts);
+    assert(result == 0);
+    (void)result; // suppress unused parameter warning in release builds
+
+    return ((uint64_t)(ts.tv_sec) * SecondsToNanoSeconds) + (uint64_t)(ts.tv_nsec);
+#else
+    return SystemNative_GetTimestamp();
+#endif
+}
+
+int64_t SystemNative_GetCoarseSystemTimeAsTicks(void)
+{
+#if defined(COARSE_REALTIME_CLOCK)
+    struct timespec ts;
+
+    if (clock_gettime(COARSE_REALTIME_CLOCK, &ts) == 0)
+    {
+        return ((int64_t)ts.tv_sec * SecondsToTicks) + (ts.tv_nsec / TicksToNanoSeconds);
+    }
+#endif
+
+    return SystemNative_GetSystemTimeAsTicks();
+}
+
+uint64_t SystemNative_ReadTimeStampCounter(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#elif defined(__aarch64__)
+    uint64_t value;
+    __asm__ volatile("isb; mrs %0, cntvct_el0" : "=r"(value));
+    return value;
+#else
+    return 0;
+#endif
+}
+
+#if defined(__x86_64__) || defined(__i386__)
+// Reads the TSC along with CLOCK_MONOTONIC_RAW, retrying to get the clock reads as close around the
+// counter read as possible. Returns the clock in nanoseconds.
+static uint64_t SampleTimeStampCounter(uint64_t* tsc)
+{
+    uint64_t bestWindow = UINT64_MAX;
+    uint64_t bestTime = 0;
+
+    for (int i = 0; i < 8; i++)
+    {
+        struct timespec before, after;
+        clock_gettime(CLOCK_MONOTONIC_RAW, &before);
+        uint64_t counter = __rdtsc();
+        clock_gettime(CLOCK_MONOTONIC_RAW, &after);
+
+        uint64_t beforeNs = ((uint64_t)before.tv_sec * SecondsToNanoSeconds) + (uint64_t)before.tv_nsec;
+        uint64_t afterNs = ((uint64_t)after.tv_sec * SecondsToNanoSeconds) + (uint64_t)after.tv_nsec;
+
+        if (afterNs - beforeNs < bestWindow)
+        {
+            bestWindow = afterNs - beforeNs;
+            bestTime = beforeNs + (afterNs - beforeNs) / 2;
+            *tsc = counter;
+        }
+    }
+
+    return bestTime;
+}
+
+static uint64_t ComputeTimeStampCounterFrequency(void)
+{
+    unsigned int eax, ebx, ecx, edx;
+
+    // CPUID.80000007H:EDX[8] is the invariant TSC, which runs at a constant rate in all ACPI P-, C- and T-states
+    if (!__get_cpuid(0x80000007, &eax, &ebx, &ecx, &edx) || (edx & (1u << 8)) == 0)
+    {
+        return 0;
+    }
+
+    // CPUID.15H reports the TSC to core crystal clock ratio and, on newer processors, the crystal frequency
+    if (__get_cpuid_max(0, NULL) >= 0x15 && __get_cpuid(0x15, &eax, &ebx, &ecx, &edx) && eax != 0 && ebx != 0 && ecx != 0)
+    {
+        return (uint64_t)ecx * ebx / eax;
+    }
+
+    uint64_t startTsc, endTsc;
+    uint64_t startNs = SampleTimeStampCounter(&startTsc);
+
+    struct timespec delay = { 0, 20 * MilliSecondsToNanoSeconds };
+    while (nanosleep(&delay, &delay) == -1 && errno == EINTR);
+
+    uint64_t endNs = SampleTimeStampCounter(&endTsc);
+
+    if (endNs <= startNs || endTsc <= startTsc)
+    {
+        return 0;
+    }
+
+    return (uint64_t)((double)(endTsc - startTsc) * SecondsToNanoSeconds / (double)(endNs - startNs));
+}
+#endif
+
+uint64_t SystemNative_GetTimeStampCounterFrequency(void)
+{
+    uint64_t frequency = __atomic_load_n(&s_timeStampCounterFrequency, __ATOMIC_RELAXED);
+
+    if (frequency == 0)
+    {
+#if defined(__x86_64__) || defined(__i386__)
+        frequency = ComputeTimeStampCounterFrequency();
+#elif defined(__aarch64__)
+        // The generic timer counts at a constant rate on all cores by architecture
+        __asm__ volatile("mrs %0, cntfrq_el0" : "=r"(frequency));
+#endif
+        if (frequency == 0)
+        {
+            frequency = UINT64_MAX;
+        }
+
+        __atomic_store_n(&s_timeStampCounterFrequency, frequency, __ATOMIC_RELAXED);
+    }
+
+    return frequency != UINT64_MAX ? frequency : 0;
+}
+
+static void* CachedClockThread(void* context)
+{
+    (void)context;
+
+    while (true)
+    {
+        int32_t intervalMilliseconds = __atomic_load_n(&s_cachedClockIntervalMilliseconds, __ATOMIC_RELAXED);
+        struct timespec delay = { intervalMilliseconds / 1000, (intervalMilliseconds % 1000) * MilliSecondsToNanoSeconds };
+        nanosleep(&delay, NULL);
+
+        __atomic_store_n(&s_cachedTimestamp, SystemNative_GetTimestamp(), __ATOMIC_RELAXED);
+        __atomic_store_n(&s_cachedSystemTimeTicks, SystemNative_GetSystemTimeAsTicks(), __ATOMIC_RELAXED);
+    }
+
+    return NULL;
+}
+
+int32_t SystemNative_StartCachedClock(int32_t intervalMilliseconds)
+{
+    static pthread_mutex_t startLock = PTHREAD_MUTEX_INITIALIZER;
+
+    if (intervalMilliseconds <= 0)
+    {
+        errno = EINVAL;
+        return -1;
+    }
+
+    pthread_mutex_lock(&startLock);
+
+    int32_t result = 0;
+    bool started = __atomic_load_n(&s_cachedClockIntervalMilliseconds, __ATOMIC_RELAXED) != 0;
+
+    __atomic_store_n(&s_cachedClockIntervalMilliseconds, intervalMilliseconds, __ATOMIC_RELAXED);
+
+    if (!started)
+    {
+        // Store the values first so readers never see them go from the coarse clock back in time
+        __atomic_store_n(&s_cachedTimestamp, SystemNative_GetTimestamp(), __ATOMIC_RELAXED);
+        __atomic_store_n(&s_cachedSystemTimeTicks, SystemNative_GetSystemTimeAsTicks(), __ATOMIC_RELAXED);
+
+        pthread_attr_t attr;
+        pthread_t thread;
+        int error = pthread_attr_init(&attr);
+        if (error == 0)
+        {
+            pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_DETACHED);
+            error = pthread_create(&thread, &attr, CachedClockThread, NULL);
+            pthread_attr_destroy(&attr);
+        }
+
+        if (error != 0)
+        {
+            __atomic_store_n(&s_cachedClockIntervalMilliseconds, 0, __ATOMIC_RELAXED);
+            __atomic_store_n(&s_cachedTimestamp, 0, __ATOMIC_RELAXED);
+            __atomic_store_n(&s_cachedSystemTimeTicks, 0, __ATOMIC_RELAXED);
+            errno = error;
+            result = -1;
+        }
+    }
+
+    pthread_mutex_unlock(&startLock);
+    return result;
+}
+
+uint64_t SystemNative_GetCachedTimestamp(void)
+{
+    uint64_t timestamp = __atomic_load_n(&s_cachedTimestamp, __ATOMIC_RELAXED);
+    return timestamp != 0 ? timestamp : SystemNative_GetCoarseTimestamp();
+}
+
+int64_t SystemNative_GetCachedSystemTimeAsTicks(void)
+{
+    int64_t ticks = __atomic_load_n(&s_cachedSystemTimeTicks, __ATOMIC_RELAXED);
+    return ticks != 0 ? ticks : SystemNative_GetCoarseSystemTimeAsTicks();
+}
+
 int64_t SystemNative_GetBootTimeTicks(void)
 {
 #if defined(TARGET_LINUX) || defined(TARGET_ANDROID)
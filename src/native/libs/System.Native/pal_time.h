@@ -39,6 +39,54 @@ PALEXPORT int32_t SystemNative_FUTimens(intptr_t fd, TimeSpec* times);
  */
 PALEXPORT uint64_t SystemNative_GetTimestamp(void);
 
+/**
+ * Gets a timestamp in the same units and time base as SystemNative_GetTimestamp from the coarse
+ * monotonic clock, which is cheaper to read but only advances once per scheduler tick (1-10ms).
+ * Same as SystemNative_GetTimestamp on platforms without a coarse clock.
+ */
+PALEXPORT uint64_t SystemNative_GetCoarseTimestamp(void);
+
+/**
+ * Gets the system time as ticks (100 nanoseconds) since the Unix epoch from the coarse real time
+ * clock, with the same resolution as SystemNative_GetCoarseTimestamp.
+ * Same as SystemNative_GetSystemTimeAsTicks on platforms without a coarse clock.
+ */
+PALEXPORT int64_t SystemNative_GetCoarseSystemTimeAsTicks(void);
+
+/**
+ * Gets the frequency in Hz of the counter read by SystemNative_ReadTimeStampCounter, or 0 when
+ * there is no counter running at a constant rate on all cores and it must not be used.
+ *
+ * On x86 this requires an invariant TSC; the frequency comes from CPUID where the processor reports
+ * it and is otherwise calibrated against CLOCK_MONOTONIC_RAW on the first call, which takes 20ms.
+ */
+PALEXPORT uint64_t SystemNative_GetTimeStampCounterFrequency(void);
+
+/**
+ * Reads the processor's time stamp counter (RDTSC on x86, CNTVCT_EL0 on arm64).
+ */
+PALEXPORT uint64_t SystemNative_ReadTimeStampCounter(void);
+
+/**
+ * Starts a process-wide thread storing the current SystemNative_GetTimestamp and
+ * SystemNative_GetSystemTimeAsTicks values every intervalMilliseconds, which are then returned by
+ * SystemNative_GetCachedTimestamp and SystemNative_GetCachedSystemTimeAsTicks. Further calls only
+ * change the interval.
+ *
+ * Returns 0 on success; otherwise, returns -1 and errno is set.
+ */
+PALEXPORT int32_t SystemNative_StartCachedClock(int32_t intervalMilliseconds);
+
+/**
+ * Gets the timestamp stored by the cached clock thread, or the coarse timestamp when it isn't running.
+ */
+PALEXPORT uint64_t SystemNative_GetCachedTimestamp(void);
+
+/**
+ * Gets the system time stored by the cached clock thread, or the coarse system time when it isn't running.
+ */
+PALEXPORT int64_t SystemNative_GetCachedSystemTimeAsTicks(void);
+
 /**
  * Gets system boot time ticks. (Linux only)
  */
@@ -0,0 +1,124 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+// Built from the source so that the ChaCha20 block function, which is not exported, can be checked
+#include "../pal_random.c"
+
+#include <stdio.h>
+#include <sys/wait.h>
+
+#define TEST_ASSERT(a) \
+  if (!(a)) \
+  { \
+    fprintf(stderr, "TEST_ASSERT failed '%s' at %d\n", #a, __LINE__); \
+    exit(1); \
+  }
+
+#if defined(USE_BUFFERED_RANDOM)
+typedef struct
+{
+    uint8_t key[CHACHA20_KEY_SIZE];
+    uint64_t counter;
+    uint8_t expected[CHACHA20_BLOCK_SIZE];
+} ChaCha20TestCase;
+
+// RFC 7539, appendix A.1, test vectors 1 to 3. The nonce is zero in all of them.
+static const ChaCha20TestCase chaCha20Cases[] =
+{
+    {
+        { 0 },
+        0,
+        {
+            0x76, 0xb8, 0xe0, 0xad, 0xa0, 0xf1, 0x3d, 0x90, 0x40, 0x5d, 0x6a, 0xe5, 0x53, 0x86, 0xbd, 0x28,
+            0xbd, 0xd2, 0x19, 0xb8, 0xa0, 0x8d, 0xed, 0x1a, 0xa8, 0x36, 0xef, 0xcc, 0x8b, 0x77, 0x0d, 0xc7,
+            0xda, 0x41, 0x59, 0x7c, 0x51, 0x57, 0x48, 0x8d, 0x77, 0x24, 0xe0, 0x3f, 0xb8, 0xd8, 0x4a, 0x37,
+            0x6a, 0x43, 0xb8, 0xf4, 0x15, 0x18, 0xa1, 0x1c, 0xc3, 0x87, 0xb6, 0x69, 0xb2, 0xee, 0x65, 0x86,
+        },
+    },
+    {
+        { 0 },
+        1,
+        {
+            0x9f, 0x07, 0xe7, 0xbe, 0x55, 0x51, 0x38, 0x7a, 0x98, 0xba, 0x97, 0x7c, 0x73, 0x2d, 0x08, 0x0d,
+            0xcb, 0x0f, 0x29, 0xa0, 0x48, 0xe3, 0x65, 0x69, 0x12, 0xc6, 0x53, 0x3e, 0x32, 0xee, 0x7a, 0xed,
+            0x29, 0xb7, 0x21, 0x76, 0x9c, 0xe6, 0x4e, 0x43, 0xd5, 0x71, 0x33, 0xb0, 0x74, 0xd8, 0x39, 0xd5,
+            0x31, 0xed, 0x1f, 0x28, 0x51, 0x0a, 0xfb, 0x45, 0xac, 0xe1, 0x0a, 0x1f, 0x4b, 0x79, 0x4d, 0x6f,
+        },
+    },
+    {
+        { [31] = 0x01 },
+        1,
+        {
+            0x3a, 0xeb, 0x52, 0x24, 0xec, 0xf8, 0x49, 0x92, 0x9b, 0x9d, 0x82, 0x8d, 0xb1, 0xce, 0xd4, 0xdd,
+            0x83, 0x20, 0x25, 0xe8, 0x01, 0x8b, 0x81, 0x60, 0xb8, 0x22, 0x84, 0xf3, 0xc9, 0x49, 0xaa, 0x5a,
+            0x8e, 0xca, 0x00, 0xbb, 0xb4, 0xa7, 0x3b, 0xda, 0xd1, 0x92, 0xb5, 0xc4, 0x2f, 0x73, 0xf2, 0xfd,
+            0x4e, 0x27, 0x36, 0x44, 0xc8, 0xb3, 0x61, 0x25, 0xa6, 0x4a, 0xdd, 0xeb, 0x00, 0x6c, 0x13, 0xa0,
+        },
+    },
+};
+
+static void TestChaCha20Block(void)
+{
+    for (size_t i = 0; i < sizeof(chaCha20Cases) / sizeof(chaCha20Cases[0]); i++)
+    {
+        const ChaCha20TestCase* pCase = &chaCha20Cases[i];
+
+        // The key words are read little-endian
+        uint32_t key[CHACHA20_KEY_SIZE / 4];
+        for (int j = 0; j < CHACHA20_KEY_SIZE / 4; j++)
+        {
+            const uint8_t* p = pCase->key + j * 4;
+            key[j] = (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+        }
+
+        uint8_t output[CHACHA20_BLOCK_SIZE];
+        ChaCha20Block(key, pCase->counter, output);
+        TEST_ASSERT(memcmp(output, pCase->expected, sizeof(output)) == 0);
+    }
+}
+#endif // USE_BUFFERED_RANDOM
+
+static void TestReseedAfterFork(void)
+{
+    // Seed this thread's buffer before forking, so a child that didn't reseed would continue with the same
+    // bytes as the parent
+    uint8_t parentBytes[32];
+    TEST_ASSERT(SystemNative_GetCryptographicallySecureRandomBytes(parentBytes, sizeof(parentBytes)) == 0);
+
+    int pipeFds[2];
+    TEST_ASSERT(pipe(pipeFds) == 0);
+
+    pid_t pid = fork();
+    TEST_ASSERT(pid != -1);
+
+    if (pid == 0)
+    {
+        uint8_t childBytes[32];
+        int result = SystemNative_GetCryptographicallySecureRandomBytes(childBytes, sizeof(childBytes));
+        _exit(result == 0 && write(pipeFds[1], childBytes, sizeof(childBytes)) == (ssize_t)sizeof(childBytes) ? 0 : 1);
+    }
+
+    TEST_ASSERT(SystemNative_GetCryptographicallySecureRandomBytes(parentBytes, sizeof(parentBytes)) == 0);
+
+    int status;
+    TEST_ASSERT(waitpid(pid, &status, 0) == pid);
+    TEST_ASSERT(WIFEXITED(status) && WEXITSTATUS(status) == 0);
+
+    uint8_t childBytes[32];
+    TEST_ASSERT(read(pipeFds[0], childBytes, sizeof(childBytes)) == (ssize_t)sizeof(childBytes));
+    TEST_ASSERT(memcmp(parentBytes, childBytes, sizeof(parentBytes)) != 0);
+
+    close(pipeFds[0]);
+    close(pipeFds[1]);
+}
+
+int main(void)
+{
+#if defined(USE_BUFFERED_RANDOM)
+    TestChaCha20Block();
+#endif
+    TestReseedAfterFork();
+
+    printf("PASSED\n");
+    return 0;
+}
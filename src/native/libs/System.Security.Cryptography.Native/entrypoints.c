@@ -93,6 +93,7 @@ static const Entry s_cryptoNative[] =
     DllImportEntry(CryptoNative_ErrPeekError)
     DllImportEntry(CryptoNative_ErrPeekLastError)
     DllImportEntry(CryptoNative_ErrReasonErrorString)
+    DllImportEntry(CryptoNative_EvpAeadBatch)
     DllImportEntry(CryptoNative_EvpAes128Cbc)
     DllImportEntry(CryptoNative_EvpAes128Ccm)
     DllImportEntry(CryptoNative_EvpAes128Cfb128)
@@ -135,6 +136,7 @@ static const Entry s_cryptoNative[] =
     DllImportEntry(CryptoNative_EvpDesCbc)
     DllImportEntry(CryptoNative_EvpDesCfb8)
     DllImportEntry(CryptoNative_EvpDesEcb)
+    DllImportEntry(CryptoNative_EvpDigestBatch)
     DllImportEntry(CryptoNative_EvpDigestCurrent)
     DllImportEntry(CryptoNative_EvpDigestFinalEx)
     DllImportEntry(CryptoNative_EvpDigestOneShot)
@@ -200,6 +202,7 @@ static const Entry s_cryptoNative[] =
     DllImportEntry(CryptoNative_GetX509SubjectPublicKeyInfoDerSize)
     DllImportEntry(CryptoNative_GetX509Thumbprint)
     DllImportEntry(CryptoNative_GetX509Version)
+    DllImportEntry(CryptoNative_HmacBatch)
     DllImportEntry(CryptoNative_HmacCreate)
     DllImportEntry(CryptoNative_HmacCurrent)
     DllImportEntry(CryptoNative_HmacDestroy)
@@ -294,6 +297,10 @@ static const Entry s_cryptoNative[] =
     DllImportEntry(CryptoNative_SslCtxSetEncryptionPolicy)
     DllImportEntry(CryptoNative_SetCiphers)
     DllImportEntry(CryptoNative_SslCreate)
+    DllImportEntry(CryptoNative_SslCtxCacheAcquire)
+    DllImportEntry(CryptoNative_SslCtxCacheAdd)
+    DllImportEntry(CryptoNative_SslCtxCacheGetStatistics)
+    DllImportEntry(CryptoNative_SslCtxCacheSetSession)
     DllImportEntry(CryptoNative_SslCtxCheckPrivateKey)
     DllImportEntry(CryptoNative_SslCtxCreate)
     DllImportEntry(CryptoNative_SslCtxDestroy)
@@ -313,12 +320,14 @@ static const Entry s_cryptoNative[] =
     DllImportEntry(CryptoNative_SslGetData)
     DllImportEntry(CryptoNative_SslGetError)
     DllImportEntry(CryptoNative_SslGetFinished)
+    DllImportEntry(CryptoNative_SslGetKtlsStatus)
     DllImportEntry(CryptoNative_SslGetPeerCertChain)
     DllImportEntry(CryptoNative_SslGetPeerCertificate)
     DllImportEntry(CryptoNative_SslGetPeerFinished)
     DllImportEntry(CryptoNative_SslGetServerName)
     DllImportEntry(CryptoNative_SslGetVersion)
     DllImportEntry(CryptoNative_SslRead)
+    DllImportEntry(CryptoNative_SslSendFile)
     DllImportEntry(CryptoNative_SslSessionFree)
     DllImportEntry(CryptoNative_SslSessionGetHostname)
     DllImportEntry(CryptoNative_SslSessionSetHostname)
@@ -332,6 +341,7 @@ static const Entry s_cryptoNative[] =
     DllImportEntry(CryptoNative_SslSetData)
     DllImportEntry(CryptoNative_SslSetQuietShutdown)
     DllImportEntry(CryptoNative_SslSetSession)
+    DllImportEntry(CryptoNative_SslSetSocket)
     DllImportEntry(CryptoNative_SslSetTlsExtHostName)
     DllImportEntry(CryptoNative_SslSetVerifyPeer)
     DllImportEntry(CryptoNative_SslShutdown)
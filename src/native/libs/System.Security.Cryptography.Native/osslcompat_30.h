@@ -5,6 +5,7 @@
 
 #pragma once
 #include "pal_types.h"
+#include <sys/types.h>
 
 #undef EVP_PKEY_CTX_set_rsa_keygen_bits
 #undef EVP_PKEY_CTX_set_rsa_oaep_md
@@ -19,6 +20,7 @@ void ERR_new(void);
 void ERR_set_debug(const char *file, int line, const char *func);
 void ERR_set_error(int lib, int reason, const char *fmt, ...);
 int EVP_CIPHER_get_nid(const EVP_CIPHER *e);
+EVP_MD* EVP_MD_fetch(OSSL_LIB_CTX* ctx, const char* algorithm, const char* properties);
 int EVP_MD_get_size(const EVP_MD* md);
 int EVP_PKEY_CTX_set_rsa_keygen_bits(EVP_PKEY_CTX* ctx, int bits);
 int EVP_PKEY_CTX_set_rsa_oaep_md(EVP_PKEY_CTX* ctx, const EVP_MD* md);
@@ -29,3 +31,4 @@ int EVP_PKEY_get_base_id(const EVP_PKEY* pkey);
 int EVP_PKEY_get_size(const EVP_PKEY* pkey);
 OSSL_PROVIDER* OSSL_PROVIDER_try_load(OSSL_LIB_CTX* , const char* name, int retain_fallbacks);
 X509* SSL_get1_peer_certificate(const SSL* ssl);
+ssize_t SSL_sendfile(SSL* s, int fd, off_t offset, size_t size, int flags);
@@ -4,9 +4,65 @@
 #include "pal_evp.h"
 
 #include <assert.h>
+#include <pthread.h>
 
 #define SUCCESS 1
 
+// Digest contexts reused by the one-shot functions on the calling thread, freed when the thread exits.
+static pthread_once_t g_threadMdCtxKeyOnce = PTHREAD_ONCE_INIT;
+static pthread_key_t g_threadMdCtxKey;
+static int g_threadMdCtxKeyCreated;
+
+static void FreeThreadMdCtx(void* ctx)
+{
+    EVP_MD_CTX_free((EVP_MD_CTX*)ctx);
+}
+
+static void CreateThreadMdCtxKey(void)
+{
+    g_threadMdCtxKeyCreated = pthread_key_create(&g_threadMdCtxKey, FreeThreadMdCtx) == 0;
+}
+
+/*
+Returns this thread's digest context initialized for type, or NULL on failure. The context must not be
+freed and must not be kept past the current call.
+*/
+static EVP_MD_CTX* GetThreadMdCtx(const EVP_MD* type)
+{
+    pthread_once(&g_threadMdCtxKeyOnce, CreateThreadMdCtxKey);
+
+    if (!g_threadMdCtxKeyCreated)
+    {
+        return NULL;
+    }
+
+    EVP_MD_CTX* ctx = (EVP_MD_CTX*)pthread_getspecific(g_threadMdCtxKey);
+
+    if (ctx == NULL)
+    {
+        ctx = EVP_MD_CTX_new();
+
+        if (ctx == NULL)
+        {
+            ERR_put_error(ERR_LIB_EVP, 0, ERR_R_MALLOC_FAILURE, __FILE__, __LINE__);
+            return NULL;
+        }
+
+        if (pthread_setspecific(g_threadMdCtxKey, ctx) != 0)
+        {
+            EVP_MD_CTX_free(ctx);
+            return NULL;
+        }
+    }
+
+    if (!EVP_DigestInit_ex(ctx, type, NULL))
+    {
+        return NULL;
+    }
+
+    return ctx;
+}
+
 EVP_MD_CTX* CryptoNative_EvpMdCtxCreate(const EVP_MD* type)
 {
     ERR_clear_error();
@@ -118,7 +174,7 @@ int32_t CryptoNative_EvpDigestOneShot(const EVP_MD* type, const void* source, in
         return 0;
     }
 
-    EVP_MD_CTX* ctx = CryptoNative_EvpMdCtxCreate(type);
+    EVP_MD_CTX* ctx = GetThreadMdCtx(type);
 
     if (ctx == NULL)
     {
@@ -129,14 +185,43 @@ int32_t CryptoNative_EvpDigestOneShot(const EVP_MD* type, const void* source, in
 
     if (ret != SUCCESS)
     {
-        CryptoNative_EvpMdCtxDestroy(ctx);
         return 0;
     }
 
-    ret = CryptoNative_EvpDigestFinalEx(ctx, md, mdSize);
+    return CryptoNative_EvpDigestFinalEx(ctx, md, mdSize);
+}
 
-    CryptoNative_EvpMdCtxDestroy(ctx);
-    return ret;
+int32_t CryptoNative_EvpDigestBatch(
+    const EVP_MD* type, const uint8_t** sources, const int32_t* sourceSizes, int32_t count, uint8_t* md)
+{
+    ERR_clear_error();
+
+    if (type == NULL || count < 0 || (count > 0 && (sources == NULL || sourceSizes == NULL || md == NULL)))
+    {
+        return -1;
+    }
+
+    int mdSize = EVP_MD_get_size(type);
+
+    for (int32_t i = 0; i < count; i++)
+    {
+        if (sourceSizes[i] < 0 || (sources[i] == NULL && sourceSizes[i] != 0))
+        {
+            return -1;
+        }
+
+        EVP_MD_CTX* ctx = GetThreadMdCtx(type);
+        unsigned int size;
+
+        if (ctx == NULL ||
+            EVP_DigestUpdate(ctx, sources[i], (size_t)sourceSizes[i]) != SUCCESS ||
+            EVP_DigestFinal_ex(ctx, md + (size_t)i * (size_t)mdSize, &size) != SUCCESS)
+        {
+            return 0;
+        }
+    }
+
+    return 1;
 }
 
 int32_t CryptoNative_EvpMdSize(const EVP_MD* md)
@@ -145,34 +230,72 @@ int32_t CryptoNative_EvpMdSize(const EVP_MD* md)
     return EVP_MD_get_size(md);
 }
 
+#ifdef NEED_OPENSSL_3_0
+// On OpenSSL 3.0 the EVP_sha256() style objects are placeholders, every EVP_DigestInit_ex or
+// HMAC_Init_ex with one of them looks the implementation up in the provider again. Fetching
+// them once up front skips that lookup, the fetched objects are kept for the process lifetime.
+static pthread_once_t g_fetchDigestsOnce = PTHREAD_ONCE_INIT;
+static const EVP_MD* g_fetchedMd5;
+static const EVP_MD* g_fetchedSha1;
+static const EVP_MD* g_fetchedSha256;
+static const EVP_MD* g_fetchedSha384;
+static const EVP_MD* g_fetchedSha512;
+
+static void FetchDigestsOnce(void)
+{
+    if (API_EXISTS(EVP_MD_fetch))
+    {
+        // MD5 is not available from the FIPS provider, the NULL result falls back to EVP_md5().
+        g_fetchedMd5 = EVP_MD_fetch(NULL, "MD5", NULL);
+        g_fetchedSha1 = EVP_MD_fetch(NULL, "SHA1", NULL);
+        g_fetchedSha256 = EVP_MD_fetch(NULL, "SHA256", NULL);
+        g_fetchedSha384 = EVP_MD_fetch(NULL, "SHA384", NULL);
+        g_fetchedSha512 = EVP_MD_fetch(NULL, "SHA512", NULL);
+
+        // Don't leave a failed fetch in the error queue of whichever caller came first.
+        ERR_clear_error();
+    }
+}
+
+static const EVP_MD* GetDigest(const EVP_MD** fetched, const EVP_MD* (*legacy)(void))
+{
+    pthread_once(&g_fetchDigestsOnce, FetchDigestsOnce);
+    return *fetched != NULL ? *fetched : legacy();
+}
+
+#define GET_DIGEST(fetched, legacy) GetDigest(&fetched, legacy)
+#else
+#define GET_DIGEST(fetched, legacy) legacy()
+#endif
+
 const EVP_MD* CryptoNative_EvpMd5(void)
 {
     // No error queue impact.
-    return EVP_md5();
+    return GET_DIGEST(g_fetchedMd5, EVP_md5);
 }
 
 const EVP_MD* CryptoNative_EvpSha1(void)
 {
     // No error queue impact.
-    return EVP_sha1();
+    return GET_DIGEST(g_fetchedSha1, EVP_sha1);
 }
 
 const EVP_MD* CryptoNative_EvpSha256(void)
 {
     // No error queue impact.
-    return EVP_sha256();
+    return GET_DIGEST(g_fetchedSha256, EVP_sha256);
 }
 
 const EVP_MD* CryptoNative_EvpSha384(void)
 {
     // No error queue impact.
-    return EVP_sha384();
+    return GET_DIGEST(g_fetchedSha384, EVP_sha384);
 }
 
 const EVP_MD* CryptoNative_EvpSha512(void)
 {
     // No error queue impact.
-    return EVP_sha512();
+    return GET_DIGEST(g_fetchedSha512, EVP_sha512);
 }
 
 int32_t CryptoNative_GetMaxMdSize(void)
@@ -61,10 +61,22 @@ PALEXPORT int32_t CryptoNative_EvpDigestCurrent(const EVP_MD_CTX* ctx, uint8_t*
 Function:
 EvpDigestOneShot
 
-Combines EVP_MD_CTX_create, EVP_DigestUpdate, and EVP_DigestFinal_ex in to a single operation.
+Combines EVP_DigestInit_ex, EVP_DigestUpdate, and EVP_DigestFinal_ex in to a single operation,
+on a digest context that is kept for the calling thread.
 */
 PALEXPORT int32_t CryptoNative_EvpDigestOneShot(const EVP_MD* type, const void* source, int32_t sourceSize, uint8_t* md, uint32_t* mdSize);
 
+/*
+Function:
+EvpDigestBatch
+
+Hashes count independent inputs in one call, writing the digest of sources[i] to md + i * EvpMdSize(type).
+
+Returns -1 on invalid input, 0 on failure, and 1 on success.
+*/
+PALEXPORT int32_t CryptoNative_EvpDigestBatch(
+    const EVP_MD* type, const uint8_t** sources, const int32_t* sourceSizes, int32_t count, uint8_t* md);
+
 /*
 Function:
 EvpMdSize
@@ -77,7 +89,7 @@ PALEXPORT int32_t CryptoNative_EvpMdSize(const EVP_MD* md);
 Function:
 EvpMd5
 
-Direct shim to EVP_md5.
+Shims EVP_md5, returning the implementation fetched from the default provider on OpenSSL 3.0.
 */
 PALEXPORT const EVP_MD* CryptoNative_EvpMd5(void);
 
@@ -85,7 +97,7 @@ PALEXPORT const EVP_MD* CryptoNative_EvpMd5(void);
 Function:
 EvpSha1
 
-Direct shim to EVP_sha1.
+Shims EVP_sha1, returning the implementation fetched from the default provider on OpenSSL 3.0.
 */
 PALEXPORT const EVP_MD* CryptoNative_EvpSha1(void);
 
@@ -93,7 +105,7 @@ PALEXPORT const EVP_MD* CryptoNative_EvpSha1(void);
 Function:
 EvpSha256
 
-Direct shim to EVP_sha256.
+Shims EVP_sha256, returning the implementation fetched from the default provider on OpenSSL 3.0.
 */
 PALEXPORT const EVP_MD* CryptoNative_EvpSha256(void);
 
@@ -101,7 +113,7 @@ PALEXPORT const EVP_MD* CryptoNative_EvpSha256(void);
 Function:
 EvpSha384
 
-Direct shim to EVP_sha384.
+Shims EVP_sha384, returning the implementation fetched from the default provider on OpenSSL 3.0.
 */
 PALEXPORT const EVP_MD* CryptoNative_EvpSha384(void);
 
@@ -109,7 +121,7 @@ PALEXPORT const EVP_MD* CryptoNative_EvpSha384(void);
 Function:
 EvpSha512
 
-Direct shim to EVP_sha512.
+Shims EVP_sha512, returning the implementation fetched from the default provider on OpenSSL 3.0.
 */
 PALEXPORT const EVP_MD* CryptoNative_EvpSha512(void);
 
@@ -233,6 +233,59 @@ int32_t CryptoNative_EvpCipherSetAeadTag(EVP_CIPHER_CTX* ctx, uint8_t* tag, int3
 #endif
 }
 
+int32_t CryptoNative_EvpAeadBatch(EVP_CIPHER_CTX* ctx, EvpAeadRecord* records, int32_t count, int32_t enc, int32_t* processed)
+{
+    assert(ctx != NULL);
+    assert(records != NULL || count == 0);
+    assert(processed != NULL);
+
+    ERR_clear_error();
+
+    *processed = 0;
+    int32_t nonceLength = -1;
+
+    for (int32_t i = 0; i < count; i++)
+    {
+        EvpAeadRecord* record = &records[i];
+
+        if (record->NonceLength <= 0 || record->AssociatedDataLength < 0 || record->InputLength < 0 || record->TagLength <= 0 ||
+            record->Nonce == NULL || record->Tag == NULL ||
+            (record->AssociatedData == NULL && record->AssociatedDataLength != 0) ||
+            ((record->Input == NULL || record->Output == NULL) && record->InputLength != 0))
+        {
+            return -1;
+        }
+
+        int outLength;
+
+        // Only the nonce changes between records, the key schedule set up on ctx stays in place.
+        if ((record->NonceLength != nonceLength &&
+             EVP_CIPHER_CTX_ctrl(ctx, EVP_CTRL_GCM_SET_IVLEN, record->NonceLength, NULL) != SUCCESS) ||
+            EVP_CipherInit_ex(ctx, NULL, NULL, NULL, record->Nonce, enc) != SUCCESS ||
+            (!enc && EVP_CIPHER_CTX_ctrl(ctx, EVP_CTRL_GCM_SET_TAG, record->TagLength, record->Tag) != SUCCESS) ||
+            (record->AssociatedDataLength > 0 &&
+             EVP_CipherUpdate(ctx, NULL, &outLength, record->AssociatedData, record->AssociatedDataLength) != SUCCESS) ||
+            (record->InputLength > 0 &&
+             EVP_CipherUpdate(ctx, record->Output, &outLength, record->Input, record->InputLength) != SUCCESS) ||
+            EVP_CipherFinal_ex(ctx, record->Output + (record->InputLength > 0 ? outLength : 0), &outLength) != SUCCESS ||
+            (enc && EVP_CIPHER_CTX_ctrl(ctx, EVP_CTRL_GCM_GET_TAG, record->TagLength, record->Tag) != SUCCESS))
+        {
+            // Don't hand out plaintext that failed authentication.
+            if (!enc && record->InputLength > 0)
+            {
+                OPENSSL_cleanse(record->Output, (size_t)record->InputLength);
+            }
+
+            return 0;
+        }
+
+        nonceLength = record->NonceLength;
+        *processed = i + 1;
+    }
+
+    return 1;
+}
+
 const EVP_CIPHER* CryptoNative_EvpAes128Ecb(void)
 {
     // No error queue impact.
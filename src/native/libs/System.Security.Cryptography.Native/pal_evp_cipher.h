@@ -16,6 +16,23 @@ PALEXPORT int32_t CryptoNative_EvpCipherSetKeyAndIV(EVP_CIPHER_CTX* ctx, uint8_t
 PALEXPORT int32_t CryptoNative_EvpCipherSetGcmNonceLength(EVP_CIPHER_CTX* ctx, int32_t ivLength);
 PALEXPORT int32_t CryptoNative_EvpCipherSetCcmNonceLength(EVP_CIPHER_CTX* ctx, int32_t ivLength);
 
+/*
+One record of CryptoNative_EvpAeadBatch. Output has room for InputLength bytes and may be the same
+buffer as Input. Tag receives the tag when encrypting and holds the expected tag when decrypting.
+*/
+typedef struct
+{
+    uint8_t* Nonce;
+    uint8_t* AssociatedData;
+    uint8_t* Input;
+    uint8_t* Output;
+    uint8_t* Tag;
+    int32_t NonceLength;
+    int32_t AssociatedDataLength;
+    int32_t InputLength;
+    int32_t TagLength;
+} EvpAeadRecord;
+
 /*
 Cleans up and deletes an EVP_CIPHER_CTX instance created by EvpCipherCreate.
 
@@ -110,6 +127,20 @@ Sets tag for authenticated decryption
 */
 PALEXPORT int32_t CryptoNative_EvpCipherSetAeadTag(EVP_CIPHER_CTX* ctx, uint8_t* tag, int32_t tagLength);
 
+/*
+Function:
+EvpAeadBatch
+
+Encrypts (enc = 1) or decrypts (enc = 0) count independent AES-GCM or ChaCha20-Poly1305 records with the
+key already set on ctx, re-initializing only the nonce for each record. CCM is not supported, it needs
+the message length up front.
+
+Returns 1 when all records were processed, 0 when a record failed (for decryption typically a tag
+mismatch, its output is cleared), and -1 on invalid input. *processed is the number of records that
+completed successfully, so on failure records[*processed] is the failing one.
+*/
+PALEXPORT int32_t CryptoNative_EvpAeadBatch(EVP_CIPHER_CTX* ctx, EvpAeadRecord* records, int32_t count, int32_t enc, int32_t* processed);
+
 /*
 Function:
 EvpAes128Ecb
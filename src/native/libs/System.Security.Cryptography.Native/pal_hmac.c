@@ -6,6 +6,65 @@
 #include "pal_hmac.h"
 
 #include <assert.h>
+#include <pthread.h>
+
+// HMAC contexts reused by the one-shot functions on the calling thread, freed when the thread exits.
+static pthread_once_t g_threadHmacCtxKeyOnce = PTHREAD_ONCE_INIT;
+static pthread_key_t g_threadHmacCtxKey;
+static int g_threadHmacCtxKeyCreated;
+
+static void FreeThreadHmacCtx(void* ctx)
+{
+    HMAC_CTX_free((HMAC_CTX*)ctx);
+}
+
+static void CreateThreadHmacCtxKey(void)
+{
+    g_threadHmacCtxKeyCreated = pthread_key_create(&g_threadHmacCtxKey, FreeThreadHmacCtx) == 0;
+}
+
+/*
+Returns this thread's HMAC context keyed with key and md, or NULL on failure. The context must not be
+freed and must not be kept past the current call.
+*/
+static HMAC_CTX* GetThreadHmacCtx(const uint8_t* key, int32_t keyLen, const EVP_MD* md)
+{
+    pthread_once(&g_threadHmacCtxKeyOnce, CreateThreadHmacCtxKey);
+
+    if (!g_threadHmacCtxKeyCreated)
+    {
+        return NULL;
+    }
+
+    HMAC_CTX* ctx = (HMAC_CTX*)pthread_getspecific(g_threadHmacCtxKey);
+
+    if (ctx == NULL)
+    {
+        ctx = HMAC_CTX_new();
+
+        if (ctx == NULL)
+        {
+            ERR_put_error(ERR_LIB_EVP, 0, ERR_R_MALLOC_FAILURE, __FILE__, __LINE__);
+            return NULL;
+        }
+
+        if (pthread_setspecific(g_threadHmacCtxKey, ctx) != 0)
+        {
+            HMAC_CTX_free(ctx);
+            return NULL;
+        }
+    }
+
+    // The key is never NULL here, a NULL key would keep the one of the previous caller on this thread.
+    assert(key != NULL);
+
+    if (!HMAC_Init_ex(ctx, key, keyLen, md, NULL))
+    {
+        return NULL;
+    }
+
+    return ctx;
+}
 
 HMAC_CTX* CryptoNative_HmacCreate(const uint8_t* key, int32_t keyLen, const EVP_MD* md)
 {
@@ -177,10 +236,69 @@ int32_t CryptoNative_HmacOneShot(const EVP_MD* type,
         key = &empty;
     }
 
-    unsigned int unsignedSource = Int32ToUint32(sourceSize);
+    HMAC_CTX* ctx = GetThreadHmacCtx(key, keySize, type);
+
+    if (ctx == NULL)
+    {
+        return 0;
+    }
+
     unsigned int unsignedSize = Int32ToUint32(*mdSize);
-    unsigned char* result = HMAC(type, key, keySize, source, unsignedSource, md, &unsignedSize);
+    int ret = HMAC_Update(ctx, source, Int32ToSizeT(sourceSize)) && HMAC_Final(ctx, md, &unsignedSize);
     *mdSize = Uint32ToInt32(unsignedSize);
 
-    return result == NULL ? 0 : 1;
+    return ret ? 1 : 0;
+}
+
+int32_t CryptoNative_HmacBatch(const EVP_MD* type,
+                               const uint8_t* key,
+                               int32_t keySize,
+                               const uint8_t** sources,
+                               const int32_t* sourceSizes,
+                               int32_t count,
+                               uint8_t* md)
+{
+    ERR_clear_error();
+
+    uint8_t empty = 0;
+
+    if (type == NULL || keySize < 0 || (key == NULL && keySize != 0) || count < 0 ||
+        (count > 0 && (sources == NULL || sourceSizes == NULL || md == NULL)))
+    {
+        return -1;
+    }
+
+    if (key == NULL)
+    {
+        key = &empty;
+    }
+
+    HMAC_CTX* ctx = GetThreadHmacCtx(key, keySize, type);
+
+    if (ctx == NULL)
+    {
+        return 0;
+    }
+
+    size_t mdSize = Int32ToSizeT(EVP_MD_get_size(type));
+
+    for (int32_t i = 0; i < count; i++)
+    {
+        if (sourceSizes[i] < 0 || (sources[i] == NULL && sourceSizes[i] != 0))
+        {
+            return -1;
+        }
+
+        unsigned int size;
+
+        // Re-initializing without a key restarts from the already derived key pads.
+        if ((i > 0 && !HMAC_Init_ex(ctx, NULL, 0, NULL, NULL)) ||
+            !HMAC_Update(ctx, sources[i], Int32ToSizeT(sourceSizes[i])) ||
+            !HMAC_Final(ctx, md + (size_t)i * mdSize, &size))
+        {
+            return 0;
+        }
+    }
+
+    return 1;
 }
@@ -71,7 +71,7 @@ PALEXPORT int32_t CryptoNative_HmacFinal(HMAC_CTX* ctx, uint8_t* md, int32_t* le
 PALEXPORT int32_t CryptoNative_HmacCurrent(const HMAC_CTX* ctx, uint8_t* md, int32_t* len);
 
 /**
- * Computes the HMAC of data using a key in a single operation.
+ * Computes the HMAC of data using a key in a single operation, on an HMAC_CTX that is kept for the calling thread.
  * Returns -1 on invalid input, 0 on failure, and 1 on success.
  */
 PALEXPORT int32_t CryptoNative_HmacOneShot(const EVP_MD* type,
@@ -81,3 +81,16 @@ PALEXPORT int32_t CryptoNative_HmacOneShot(const EVP_MD* type,
                                            int32_t sourceSize,
                                            uint8_t* md,
                                            int32_t* mdSize);
+
+/**
+ * Computes the HMAC of count independent inputs with the same key, writing the HMAC of sources[i] to
+ * md + i * EvpMdSize(type). The key is only processed once.
+ * Returns -1 on invalid input, 0 on failure, and 1 on success.
+ */
+PALEXPORT int32_t CryptoNative_HmacBatch(const EVP_MD* type,
+                                         const uint8_t* key,
+                                         int32_t keySize,
+                                         const uint8_t** sources,
+                                         const int32_t* sourceSizes,
+                                         int32_t count,
+                                         uint8_t* md);
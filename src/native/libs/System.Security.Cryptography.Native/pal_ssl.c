@@ -9,8 +9,11 @@
 #include "pal_x509.h"
 
 #include <assert.h>
+#include <pthread.h>
 #include <string.h>
 #include <stdbool.h>
+#include <stdlib.h>
+#include <time.h>
 
 c_static_assert(PAL_SSL_ERROR_NONE == SSL_ERROR_NONE);
 c_static_assert(PAL_SSL_ERROR_SSL == SSL_ERROR_SSL);
@@ -225,6 +228,14 @@ SSL_CTX* CryptoNative_SslCtxCreate(const SSL_METHOD* method)
 #define SSL_OP_ALLOW_CLIENT_RENEGOTIATION ((uint64_t)1 << (uint64_t)8)
 #endif
             SSL_CTX_set_options(ctx, SSL_OP_ALLOW_CLIENT_RENEGOTIATION);
+
+            // Let OpenSSL hand the record encryption to the kernel when it was built with kTLS
+            // support and the negotiated cipher allows it. This only takes effect for an SSL
+            // attached to a socket (CryptoNative_SslSetSocket), memory BIOs are unaffected.
+#ifndef SSL_OP_ENABLE_KTLS
+#define SSL_OP_ENABLE_KTLS ((uint64_t)1 << (uint64_t)3)
+#endif
+            SSL_CTX_set_options(ctx, SSL_OP_ENABLE_KTLS);
         }
 #endif
 
@@ -1275,3 +1286,502 @@ void CryptoNative_SslStapleOcsp(SSL* ssl, uint8_t* buf, int32_t len)
         OPENSSL_free(copy);
     }
 }
+
+int32_t CryptoNative_SslSetSocket(SSL* ssl, int32_t fd)
+{
+    ERR_clear_error();
+    return SSL_set_fd(ssl, fd);
+}
+
+#ifndef BIO_CTRL_GET_KTLS_SEND
+#define BIO_CTRL_GET_KTLS_SEND 73
+#endif
+#ifndef BIO_CTRL_GET_KTLS_RECV
+#define BIO_CTRL_GET_KTLS_RECV 76
+#endif
+
+int32_t CryptoNative_SslGetKtlsStatus(SSL* ssl)
+{
+    // No error queue impact.
+    int32_t status = 0;
+
+    // Memory BIOs and OpenSSL builds without kTLS answer 0 to these controls.
+    BIO* wbio = SSL_get_wbio(ssl);
+    if (wbio != NULL && BIO_ctrl(wbio, BIO_CTRL_GET_KTLS_SEND, 0, NULL) > 0)
+    {
+        status |= PAL_KtlsSend;
+    }
+
+    BIO* rbio = SSL_get_rbio(ssl);
+    if (rbio != NULL && BIO_ctrl(rbio, BIO_CTRL_GET_KTLS_RECV, 0, NULL) > 0)
+    {
+        status |= PAL_KtlsReceive;
+    }
+
+    return status;
+}
+
+int64_t CryptoNative_SslSendFile(SSL* ssl, int32_t fd, int64_t offset, int64_t size, int32_t* error)
+{
+    assert(error != NULL);
+    ERR_clear_error();
+
+#ifdef NEED_OPENSSL_3_0
+    if (API_EXISTS(SSL_sendfile) && size >= 0)
+    {
+        ssize_t result = SSL_sendfile(ssl, fd, (off_t)offset, (size_t)size, 0);
+        *error = result < 0 ? CryptoNative_SslGetError(ssl, (int32_t)result) : SSL_ERROR_NONE;
+        return (int64_t)result;
+    }
+#else
+    (void)ssl;
+    (void)fd;
+    (void)offset;
+    (void)size;
+#endif
+
+    *error = SSL_ERROR_SSL;
+    return -1;
+}
+
+// Process-wide SSL_CTX cache. Connections created from the same cached SSL_CTX share its client
+// session store and, for servers, the rotating ticket keys below, so reconnects can resume.
+#define SSL_CTX_CACHE_MAX_ENTRIES 64
+#define SSL_CTX_CACHE_MAX_KEY_LENGTH 64
+#define SSL_CTX_CACHE_MAX_CLIENT_SESSIONS 32
+#define TICKET_KEY_LIFETIME_SECONDS 3600
+
+#ifndef SSL_CTRL_SET_TLSEXT_TICKET_KEY_CB
+#define SSL_CTRL_SET_TLSEXT_TICKET_KEY_CB 72
+#endif
+
+typedef struct
+{
+    char* hostName;
+    SSL_SESSION* session;
+} CachedClientSession;
+
+typedef struct
+{
+    SSL_CTX* ctx;
+    uint64_t lastUsed;
+    int32_t isServer;
+    int32_t keyLength;
+    uint8_t key[SSL_CTX_CACHE_MAX_KEY_LENGTH];
+    CachedClientSession sessions[SSL_CTX_CACHE_MAX_CLIENT_SESSIONS];
+    int32_t nextSession;
+} SslCtxCacheEntry;
+
+typedef struct
+{
+    uint8_t name[16];
+    uint8_t aesKey[32];
+    uint8_t hmacKey[32];
+    time_t created;
+} TicketKey;
+
+static pthread_mutex_t g_sslCtxCacheLock = PTHREAD_MUTEX_INITIALIZER;
+static SslCtxCacheEntry* g_sslCtxCache[SSL_CTX_CACHE_MAX_ENTRIES];
+static uint64_t g_sslCtxCacheClock;
+static SslCtxCacheStatistics g_sslCtxCacheStatistics;
+
+// g_ticketKeys[0] encrypts new tickets, g_ticketKeys[1] is the previous key, still accepted for decryption.
+static pthread_mutex_t g_ticketKeyLock = PTHREAD_MUTEX_INITIALIZER;
+static TicketKey g_ticketKeys[2];
+static int32_t g_ticketKeyCount;
+
+static SslCtxCacheEntry* FindCacheEntryByCtx(const SSL_CTX* ctx)
+{
+    for (int i = 0; i < SSL_CTX_CACHE_MAX_ENTRIES; i++)
+    {
+        if (g_sslCtxCache[i] != NULL && g_sslCtxCache[i]->ctx == ctx)
+        {
+            return g_sslCtxCache[i];
+        }
+    }
+
+    return NULL;
+}
+
+static void FreeCacheEntry(SslCtxCacheEntry* entry)
+{
+    for (int i = 0; i < SSL_CTX_CACHE_MAX_CLIENT_SESSIONS; i++)
+    {
+        free(entry->sessions[i].hostName);
+
+        if (entry->sessions[i].session != NULL)
+        {
+            SSL_SESSION_free(entry->sessions[i].session);
+        }
+    }
+
+    // Connections still using the context keep it alive, their callbacks no longer find the entry.
+    SSL_CTX_free(entry->ctx);
+    free(entry);
+}
+
+static int CachedCtxNewSessionCallback(SSL* ssl, SSL_SESSION* session)
+{
+    const char* hostName = SSL_get_servername(ssl, TLSEXT_NAMETYPE_host_name);
+
+    if (hostName == NULL)
+    {
+        return 0;
+    }
+
+    int tookOwnership = 0;
+    pthread_mutex_lock(&g_sslCtxCacheLock);
+
+    SslCtxCacheEntry* entry = FindCacheEntryByCtx(SSL_get_SSL_CTX(ssl));
+
+    if (entry != NULL)
+    {
+        CachedClientSession* slot = NULL;
+
+        for (int i = 0; i < SSL_CTX_CACHE_MAX_CLIENT_SESSIONS; i++)
+        {
+            if (entry->sessions[i].hostName != NULL && strcmp(entry->sessions[i].hostName, hostName) == 0)
+            {
+                slot = &entry->sessions[i];
+                break;
+            }
+        }
+
+        if (slot == NULL)
+        {
+            // Replace the oldest server name.
+            char* hostNameCopy = strdup(hostName);
+
+            if (hostNameCopy != NULL)
+            {
+                slot = &entry->sessions[entry->nextSession];
+                entry->nextSession = (entry->nextSession + 1) % SSL_CTX_CACHE_MAX_CLIENT_SESSIONS;
+                free(slot->hostName);
+                slot->hostName = hostNameCopy;
+            }
+        }
+
+        if (slot != NULL)
+        {
+            if (slot->session != NULL)
+            {
+                SSL_SESSION_free(slot->session);
+            }
+
+            slot->session = session;
+            tookOwnership = 1;
+        }
+    }
+
+    pthread_mutex_unlock(&g_sslCtxCacheLock);
+    return tookOwnership;
+}
+
+static void CachedCtxInfoCallback(const SSL* ssl, int where, int ret)
+{
+    (void)ret;
+
+    if ((where & SSL_CB_HANDSHAKE_DONE) == 0)
+    {
+        return;
+    }
+
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wcast-qual"
+    int reused = SSL_session_reused((SSL*)ssl) == 1;
+#pragma clang diagnostic pop
+
+    pthread_mutex_lock(&g_sslCtxCacheLock);
+
+    SslCtxCacheEntry* entry = FindCacheEntryByCtx(SSL_get_SSL_CTX(ssl));
+
+    if (entry != NULL)
+    {
+        if (entry->isServer)
+        {
+            reused ? g_sslCtxCacheStatistics.ServerResumedHandshakes++ : g_sslCtxCacheStatistics.ServerFullHandshakes++;
+        }
+        else
+        {
+            reused ? g_sslCtxCacheStatistics.ClientResumedHandshakes++ : g_sslCtxCacheStatistics.ClientFullHandshakes++;
+        }
+    }
+
+    pthread_mutex_unlock(&g_sslCtxCacheLock);
+}
+
+static int NewTicketKey(TicketKey* key)
+{
+    if (RAND_bytes(key->name, sizeof(key->name)) != 1 ||
+        RAND_bytes(key->aesKey, sizeof(key->aesKey)) != 1 ||
+        RAND_bytes(key->hmacKey, sizeof(key->hmacKey)) != 1)
+    {
+        return 0;
+    }
+
+    key->created = time(NULL);
+    return 1;
+}
+
+static int TicketKeyCallback(SSL* ssl, uint8_t* keyName, uint8_t* iv, EVP_CIPHER_CTX* cipherCtx, HMAC_CTX* hmacCtx, int enc)
+{
+    TicketKey key;
+    int ret = 0;
+
+    pthread_mutex_lock(&g_ticketKeyLock);
+
+    if (enc)
+    {
+        if (g_ticketKeyCount == 0 || time(NULL) - g_ticketKeys[0].created >= TICKET_KEY_LIFETIME_SECONDS)
+        {
+            TicketKey next;
+
+            if (NewTicketKey(&next))
+            {
+                g_ticketKeys[1] = g_ticketKeys[0];
+                g_ticketKeys[0] = next;
+                g_ticketKeyCount = g_ticketKeyCount == 0 ? 1 : 2;
+            }
+        }
+
+        if (g_ticketKeyCount > 0)
+        {
+            key = g_ticketKeys[0];
+            ret = 1;
+        }
+    }
+    else
+    {
+        for (int32_t i = 0; i < g_ticketKeyCount; i++)
+        {
+            // Tickets under the previous key are still accepted for one more lifetime, and renewed.
+            if (memcmp(keyName, g_ticketKeys[i].name, sizeof(key.name)) == 0 &&
+                time(NULL) - g_ticketKeys[i].created < 2 * TICKET_KEY_LIFETIME_SECONDS)
+            {
+                key = g_ticketKeys[i];
+
+                // TLS 1.3 clients use a ticket only once, they only get a replacement when it's renewed.
+                ret = i == 0 && SSL_version(ssl) != TLS1_3_VERSION ? 1 : 2;
+                break;
+            }
+        }
+    }
+
+    pthread_mutex_unlock(&g_ticketKeyLock);
+
+    if (ret == 0)
+    {
+        // No key for this ticket, fall back to a full handshake.
+        return enc ? -1 : 0;
+    }
+
+    if (enc)
+    {
+        memcpy(keyName, key.name, sizeof(key.name));
+
+        if (RAND_bytes(iv, EVP_MAX_IV_LENGTH) != 1)
+        {
+            ret = -1;
+        }
+    }
+
+    if (ret > 0 &&
+        (EVP_CipherInit_ex(cipherCtx, EVP_aes_256_cbc(), NULL, key.aesKey, iv, enc) != 1 ||
+         HMAC_Init_ex(hmacCtx, key.hmacKey, sizeof(key.hmacKey), EVP_sha256(), NULL) != 1))
+    {
+        ret = enc ? -1 : 0;
+    }
+
+    OPENSSL_cleanse(&key, sizeof(key));
+    return ret;
+}
+
+SSL_CTX* CryptoNative_SslCtxCacheAcquire(const uint8_t* key, int32_t keyLength)
+{
+    // No error queue impact.
+    if (key == NULL || keyLength <= 0 || keyLength > SSL_CTX_CACHE_MAX_KEY_LENGTH)
+    {
+        return NULL;
+    }
+
+    SSL_CTX* ctx = NULL;
+
+#if defined NEED_OPENSSL_1_1 || defined NEED_OPENSSL_3_0
+    if (API_EXISTS(SSL_CTX_up_ref))
+    {
+        pthread_mutex_lock(&g_sslCtxCacheLock);
+
+        for (int i = 0; i < SSL_CTX_CACHE_MAX_ENTRIES; i++)
+        {
+            SslCtxCacheEntry* entry = g_sslCtxCache[i];
+
+            if (entry != NULL && entry->keyLength == keyLength && memcmp(entry->key, key, (size_t)keyLength) == 0)
+            {
+                entry->lastUsed = ++g_sslCtxCacheClock;
+                ctx = entry->ctx;
+                SSL_CTX_up_ref(ctx);
+                break;
+            }
+        }
+
+        if (ctx != NULL)
+        {
+            g_sslCtxCacheStatistics.ContextHits++;
+        }
+        else
+        {
+            g_sslCtxCacheStatistics.ContextMisses++;
+        }
+
+        pthread_mutex_unlock(&g_sslCtxCacheLock);
+    }
+#endif
+
+    return ctx;
+}
+
+int32_t CryptoNative_SslCtxCacheAdd(const uint8_t* key, int32_t keyLength, SSL_CTX* ctx, int32_t isServer)
+{
+    if (key == NULL || keyLength <= 0 || keyLength > SSL_CTX_CACHE_MAX_KEY_LENGTH || ctx == NULL)
+    {
+        return -1;
+    }
+
+#if defined NEED_OPENSSL_1_1 || defined NEED_OPENSSL_3_0
+    if (!API_EXISTS(SSL_CTX_up_ref))
+    {
+        return 0;
+    }
+
+    SslCtxCacheEntry* entry = (SslCtxCacheEntry*)calloc(1, sizeof(SslCtxCacheEntry));
+
+    if (entry == NULL)
+    {
+        return 0;
+    }
+
+    entry->ctx = ctx;
+    entry->isServer = isServer != 0;
+    entry->keyLength = keyLength;
+    memcpy(entry->key, key, (size_t)keyLength);
+
+    ERR_clear_error();
+
+    if (isServer)
+    {
+        // Stateless resumption with process-wide keys, plus the context's own session ID cache.
+        SSL_CTX_ctrl(ctx, SSL_CTRL_SET_SESS_CACHE_MODE, SSL_SESS_CACHE_SERVER, NULL);
+        SSL_CTX_set_session_id_context(ctx, key, (unsigned int)(keyLength <= SSL_MAX_SID_CTX_LENGTH ? keyLength : SSL_MAX_SID_CTX_LENGTH));
+        SSL_CTX_callback_ctrl(ctx, SSL_CTRL_SET_TLSEXT_TICKET_KEY_CB, (void (*)(void))TicketKeyCallback);
+    }
+    else
+    {
+        // Client sessions are kept per server name in the entry, not in OpenSSL's internal store.
+        SSL_CTX_ctrl(ctx, SSL_CTRL_SET_SESS_CACHE_MODE, SSL_SESS_CACHE_CLIENT | SSL_SESS_CACHE_NO_INTERNAL_STORE, NULL);
+        SSL_CTX_sess_set_new_cb(ctx, CachedCtxNewSessionCallback);
+    }
+
+    SSL_CTX_set_info_callback(ctx, CachedCtxInfoCallback);
+
+    int32_t ret = 0;
+    SslCtxCacheEntry* evicted = NULL;
+
+    pthread_mutex_lock(&g_sslCtxCacheLock);
+
+    int freeSlot = -1;
+    int oldestSlot = -1;
+
+    for (int i = 0; i < SSL_CTX_CACHE_MAX_ENTRIES; i++)
+    {
+        SslCtxCacheEntry* existing = g_sslCtxCache[i];
+
+        if (existing == NULL)
+        {
+            if (freeSlot < 0)
+            {
+                freeSlot = i;
+            }
+        }
+        else if (existing->keyLength == keyLength && memcmp(existing->key, key, (size_t)keyLength) == 0)
+        {
+            // Another thread added the same configuration first.
+            freeSlot = -2;
+            break;
+        }
+        else if (oldestSlot < 0 || existing->lastUsed < g_sslCtxCache[oldestSlot]->lastUsed)
+        {
+            oldestSlot = i;
+        }
+    }
+
+    if (freeSlot != -2)
+    {
+        int slot = freeSlot >= 0 ? freeSlot : oldestSlot;
+        evicted = g_sslCtxCache[slot];
+
+        SSL_CTX_up_ref(ctx);
+        entry->lastUsed = ++g_sslCtxCacheClock;
+        g_sslCtxCache[slot] = entry;
+        entry = NULL;
+        ret = 1;
+    }
+
+    pthread_mutex_unlock(&g_sslCtxCacheLock);
+
+    free(entry);
+
+    if (evicted != NULL)
+    {
+        FreeCacheEntry(evicted);
+    }
+
+    return ret;
+#else
+    (void)isServer;
+    return 0;
+#endif
+}
+
+int32_t CryptoNative_SslCtxCacheSetSession(SSL* ssl)
+{
+    ERR_clear_error();
+
+    const char* hostName = SSL_get_servername(ssl, TLSEXT_NAMETYPE_host_name);
+
+    if (hostName == NULL)
+    {
+        return 0;
+    }
+
+    int32_t ret = 0;
+
+    pthread_mutex_lock(&g_sslCtxCacheLock);
+
+    SslCtxCacheEntry* entry = FindCacheEntryByCtx(SSL_get_SSL_CTX(ssl));
+
+    if (entry != NULL && !entry->isServer)
+    {
+        for (int i = 0; i < SSL_CTX_CACHE_MAX_CLIENT_SESSIONS; i++)
+        {
+            if (entry->sessions[i].session != NULL && entry->sessions[i].hostName != NULL &&
+                strcmp(entry->sessions[i].hostName, hostName) == 0)
+            {
+                ret = SSL_set_session(ssl, entry->sessions[i].session);
+                break;
+            }
+        }
+    }
+
+    pthread_mutex_unlock(&g_sslCtxCacheLock);
+    return ret;
+}
+
+void CryptoNative_SslCtxCacheGetStatistics(SslCtxCacheStatistics* statistics)
+{
+    // No error queue impact.
+    assert(statistics != NULL);
+
+    pthread_mutex_lock(&g_sslCtxCacheLock);
+    *statistics = g_sslCtxCacheStatistics;
+    pthread_mutex_unlock(&g_sslCtxCacheLock);
+}
@@ -29,6 +29,16 @@ typedef enum
     NoEncryption
 } EncryptionPolicy;
 
+/*
+Flags returned by CryptoNative_SslGetKtlsStatus.
+*/
+typedef enum
+{
+    PAL_KtlsNone = 0,
+    PAL_KtlsSend = 1,
+    PAL_KtlsReceive = 2,
+} PAL_KtlsStatus;
+
 /*
 These values should be kept in sync with System.Security.Authentication.CipherAlgorithmType.
 */
@@ -124,6 +134,20 @@ typedef int32_t (*SslCtxNewSessionCallback)(SSL* ssl, SSL_SESSION* session);
 // the function pointer used for new  session
 typedef void (*SslCtxRemoveSessionCallback)(SSL_CTX* ctx, SSL_SESSION* session);
 
+/*
+Counters of the process-wide SSL_CTX cache. The handshake counters only cover connections
+created from cached contexts.
+*/
+typedef struct
+{
+    int64_t ContextHits;
+    int64_t ContextMisses;
+    int64_t ClientFullHandshakes;
+    int64_t ClientResumedHandshakes;
+    int64_t ServerFullHandshakes;
+    int64_t ServerResumedHandshakes;
+} SslCtxCacheStatistics;
+
 /*
 Ensures that libssl is correctly initialized and ready to use.
 */
@@ -503,3 +527,59 @@ PALEXPORT int32_t CryptoNative_OpenSslGetProtocolSupport(SslProtocols protocol);
 Staples an encoded OCSP response onto the TLS session
 */
 PALEXPORT void CryptoNative_SslStapleOcsp(SSL* ssl, uint8_t* buf, int32_t len);
+
+/*
+Attaches the SSL to a connected socket instead of a pair of memory BIOs. Must be called before the
+handshake for OpenSSL to offload the record layer to kernel TLS.
+
+Returns 1 upon success, otherwise 0.
+*/
+PALEXPORT int32_t CryptoNative_SslSetSocket(SSL* ssl, int32_t fd);
+
+/*
+Returns a combination of PAL_KtlsStatus flags telling which directions of the connection are
+encrypted by the kernel. With PAL_KtlsSend set, plain writes to the socket, including
+SystemNative_SendFile, are sent as TLS records.
+*/
+PALEXPORT int32_t CryptoNative_SslGetKtlsStatus(SSL* ssl);
+
+/*
+Shims SSL_sendfile, sending size bytes of fd starting at offset without copying them through
+user space. Requires kernel TLS send offload, see CryptoNative_SslGetKtlsStatus.
+
+Returns the number of bytes sent, or -1 with the SSL_get_error code in *error.
+*/
+PALEXPORT int64_t CryptoNative_SslSendFile(SSL* ssl, int32_t fd, int64_t offset, int64_t size, int32_t* error);
+
+/*
+Looks up a cached SSL_CTX by a key identifying its configuration (protocols, ciphers, certificate,
+...), at most 64 bytes. The caller owns a reference to the returned context and frees it with
+CryptoNative_SslCtxDestroy.
+
+Returns NULL if no context is cached for the key.
+*/
+PALEXPORT SSL_CTX* CryptoNative_SslCtxCacheAcquire(const uint8_t* key, int32_t keyLength);
+
+/*
+Adds a fully configured SSL_CTX to the cache, which keeps its own reference. Client contexts get a
+session store shared by all of their connections, server contexts resume with session tickets
+encrypted under process-wide keys that rotate every hour. The cache installs its own session and
+info callbacks, CryptoNative_SslCtxSetCaching must not be used with callbacks on these contexts.
+
+Returns 1 if the context was added, 0 if another context is already cached for the key or caching
+is unavailable (OpenSSL 1.0), and -1 on invalid input.
+*/
+PALEXPORT int32_t CryptoNative_SslCtxCacheAdd(const uint8_t* key, int32_t keyLength, SSL_CTX* ctx, int32_t isServer);
+
+/*
+Offers the session last established with the server name set on ssl, if its context is cached.
+Must be called after CryptoNative_SslSetTlsExtHostName and before the handshake.
+
+Returns 1 if a session was set, otherwise 0.
+*/
+PALEXPORT int32_t CryptoNative_SslCtxCacheSetSession(SSL* ssl);
+
+/*
+Reads the SSL_CTX cache counters, from which context and session resumption hit rates follow.
+*/
+PALEXPORT void CryptoNative_SslCtxCacheGetStatistics(SslCtxCacheStatistics* statistics);
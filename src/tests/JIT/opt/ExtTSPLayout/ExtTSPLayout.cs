@@ -0,0 +1,243 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+using System;
+using System.Runtime.CompilerServices;
+using System.Threading;
+
+// The ext-TSP layout reorders runs of hot blocks using PGO edge weights, then repairs fall-through
+// by reversing conditions or adding jumps. The methods are trained on one set of paths and then
+// checked against unoptimized copies on every path, including the ones that were cold while
+// training, paths through try/finally and catch regions, switches and loops.
+
+public class ExtTSPLayout
+{
+    static int s_failures;
+    static int s_finallyCount;
+
+    static void Check(bool condition, string test, int arg)
+    {
+        if (!condition)
+        {
+            Console.WriteLine($"FAILED: {test}, {arg}");
+            s_failures++;
+        }
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static int Branchy(int x)
+    {
+        int r = 0;
+        if ((x & 1) != 0)
+        {
+            r += 3;
+            if ((x & 2) != 0)
+            {
+                r *= 5;
+            }
+            else
+            {
+                r -= 7;
+            }
+        }
+        else if ((x & 4) != 0)
+        {
+            r = x * 11;
+        }
+        else
+        {
+            r = -x;
+        }
+
+        if (x > 100)
+        {
+            r ^= 0x55;
+        }
+
+        if ((x % 3) == 0)
+        {
+            r += x / 3;
+        }
+        else if ((x % 3) == 1)
+        {
+            r -= 1;
+        }
+        return r;
+    }
+
+    [MethodImpl(MethodImplOptions.NoOptimization)]
+    static int BranchyRef(int x)
+    {
+        int r = 0;
+        if ((x & 1) != 0)
+        {
+            r += 3;
+            if ((x & 2) != 0)
+            {
+                r *= 5;
+            }
+            else
+            {
+                r -= 7;
+            }
+        }
+        else if ((x & 4) != 0)
+        {
+            r = x * 11;
+        }
+        else
+        {
+            r = -x;
+        }
+
+        if (x > 100)
+        {
+            r ^= 0x55;
+        }
+
+        if ((x % 3) == 0)
+        {
+            r += x / 3;
+        }
+        else if ((x % 3) == 1)
+        {
+            r -= 1;
+        }
+        return r;
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static int SwitchLoop(int[] a)
+    {
+        int r = 0;
+        for (int i = 0; i < a.Length; i++)
+        {
+            switch (a[i] & 7)
+            {
+                case 0: r += 1; break;
+                case 1: r *= 3; break;
+                case 2: r -= a[i]; break;
+                case 3: r ^= i; break;
+                case 5: if (r > 1000) { r /= 2; } break;
+                default: r += 7; break;
+            }
+        }
+        return r;
+    }
+
+    [MethodImpl(MethodImplOptions.NoOptimization)]
+    static int SwitchLoopRef(int[] a)
+    {
+        int r = 0;
+        for (int i = 0; i < a.Length; i++)
+        {
+            switch (a[i] & 7)
+            {
+                case 0: r += 1; break;
+                case 1: r *= 3; break;
+                case 2: r -= a[i]; break;
+                case 3: r ^= i; break;
+                case 5: if (r > 1000) { r /= 2; } break;
+                default: r += 7; break;
+            }
+        }
+        return r;
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static int WithEH(int x)
+    {
+        int r = x;
+        if (x > 10)
+        {
+            r += 2;
+        }
+
+        try
+        {
+            if (x == 7)
+            {
+                throw new InvalidOperationException();
+            }
+            r *= 2;
+        }
+        catch (InvalidOperationException)
+        {
+            r = -1;
+        }
+        finally
+        {
+            s_finallyCount++;
+        }
+
+        if (x < 0)
+        {
+            r = 0;
+        }
+        return r;
+    }
+
+    static void Train()
+    {
+        int[] a = new int[64];
+        for (int i = 0; i < a.Length; i++)
+        {
+            a[i] = i * 8;
+        }
+
+        for (int iter = 0; iter < 200; iter++)
+        {
+            // Only even x below 100 that are multiples of 3 while training.
+            for (int x = 0; x < 60; x += 6)
+            {
+                Branchy(x);
+                WithEH(x + 20);
+            }
+            SwitchLoop(a);
+
+            if ((iter % 20) == 0)
+            {
+                Thread.Sleep(20);
+            }
+        }
+    }
+
+    static void Verify()
+    {
+        for (int x = -20; x < 300; x++)
+        {
+            Check(Branchy(x) == BranchyRef(x), "Branchy", x);
+        }
+
+        int[] a = new int[100];
+        for (int i = 0; i < a.Length; i++)
+        {
+            a[i] = i * 37 + 5;
+        }
+        Check(SwitchLoop(a) == SwitchLoopRef(a), "SwitchLoop", 0);
+        Check(SwitchLoop(new int[0]) == 0, "SwitchLoop empty", 0);
+
+        for (int x = -3; x < 15; x++)
+        {
+            int before = s_finallyCount;
+            int expected = (x < 0) ? 0 : ((x == 7) ? -1 : ((x > 10) ? (x + 2) * 2 : x * 2));
+            Check(WithEH(x) == expected, "WithEH", x);
+            Check(s_finallyCount == before + 1, "WithEH finally", x);
+        }
+    }
+
+    public static int Main()
+    {
+        Verify();
+        Train();
+        Verify();
+
+        if (s_failures != 0)
+        {
+            return 101;
+        }
+
+        Console.WriteLine("PASSED");
+        return 100;
+    }
+}
@@ -0,0 +1,214 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+using System;
+using System.Runtime.CompilerServices;
+using System.Threading;
+
+// Guarded devirtualization may test for up to three likely classes at a call site, falling back to
+// the virtual call when all the type tests fail. The call sites are trained on a mix of receivers
+// and then checked with every receiver, including ones that weren't seen while training, null
+// receivers, and guessed targets that throw.
+
+public abstract class Shape
+{
+    public abstract int Area(int scale);
+}
+
+public class Square : Shape
+{
+    public int Side = 2;
+    public override int Area(int scale) => Side * Side * scale;
+}
+
+public class Rect : Shape
+{
+    public int W = 2;
+    public int H = 3;
+    public override int Area(int scale) => W * H * scale;
+}
+
+public sealed class Triangle : Shape
+{
+    public int B = 4;
+    public int H = 5;
+    public override int Area(int scale) => B * H / 2 * scale;
+}
+
+public class BigSquare : Square
+{
+    public BigSquare() { Side = 10; }
+}
+
+public class Circle : Shape
+{
+    public override int Area(int scale) => 3 * scale;
+}
+
+public class Throwing : Shape
+{
+    public override int Area(int scale)
+    {
+        if (scale < 0)
+        {
+            throw new ArgumentOutOfRangeException(nameof(scale));
+        }
+        return scale;
+    }
+}
+
+public interface ICounter
+{
+    int Next(int x);
+}
+
+public struct AddOne : ICounter
+{
+    public int Next(int x) => x + 1;
+}
+
+public class Doubler : ICounter
+{
+    public int Next(int x) => x * 2;
+}
+
+public class Negate : ICounter
+{
+    public int Next(int x) => -x;
+}
+
+public class Square2 : ICounter
+{
+    public int Next(int x) => x * x;
+}
+
+public class MultipleGuesses
+{
+    static int s_failures;
+
+    static void Check(bool condition, string test)
+    {
+        if (!condition)
+        {
+            Console.WriteLine($"FAILED: {test}");
+            s_failures++;
+        }
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static int CallArea(Shape s, int scale) => s.Area(scale);
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static int CallNext(ICounter c, int x) => c.Next(x);
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static int SumAreas(Shape[] shapes, int scale)
+    {
+        int sum = 0;
+        foreach (Shape s in shapes)
+        {
+            sum += s.Area(scale);
+        }
+        return sum;
+    }
+
+    static Shape[] s_training =
+    {
+        new Square(), new Square(), new Square(), new Square(),
+        new Rect(), new Rect(), new Rect(),
+        new Triangle(), new Triangle(),
+        new Throwing(),
+    };
+
+    static ICounter[] s_counters = { new AddOne(), new AddOne(), new AddOne(), new Doubler(), new Doubler(), new Negate(), new Negate() };
+
+    static void Train()
+    {
+        for (int iter = 0; iter < 200; iter++)
+        {
+            foreach (Shape s in s_training)
+            {
+                CallArea(s, 1);
+            }
+            SumAreas(s_training, 1);
+
+            foreach (ICounter c in s_counters)
+            {
+                CallNext(c, iter);
+            }
+
+            if ((iter % 20) == 0)
+            {
+                Thread.Sleep(20);
+            }
+        }
+    }
+
+    static void Verify()
+    {
+        Check(CallArea(new Square(), 3) == 12, "Square");
+        Check(CallArea(new Rect(), 3) == 18, "Rect");
+        Check(CallArea(new Triangle(), 3) == 30, "Triangle");
+        // A subclass of a guessed class must not take the guessed path.
+        Check(CallArea(new BigSquare(), 3) == 300, "BigSquare");
+        // A class that was never seen goes through the fallback call.
+        Check(CallArea(new Circle(), 3) == 9, "Circle");
+        Check(CallArea(new Throwing(), 3) == 3, "Throwing");
+
+        bool threw = false;
+        try
+        {
+            CallArea(new Throwing(), -1);
+        }
+        catch (ArgumentOutOfRangeException)
+        {
+            threw = true;
+        }
+        Check(threw, "Throwing throws");
+
+        threw = false;
+        try
+        {
+            CallArea(null, 1);
+        }
+        catch (NullReferenceException)
+        {
+            threw = true;
+        }
+        Check(threw, "null receiver");
+
+        Shape[] mixed = { new Circle(), new Square(), new BigSquare(), new Triangle(), new Rect() };
+        Check(SumAreas(mixed, 2) == 6 + 8 + 200 + 20 + 12, "SumAreas");
+
+        Check(CallNext(new AddOne(), 5) == 6, "AddOne");
+        Check(CallNext(new Doubler(), 5) == 10, "Doubler");
+        Check(CallNext(new Negate(), 5) == -5, "Negate");
+        Check(CallNext(new Square2(), 5) == 25, "Square2");
+
+        threw = false;
+        try
+        {
+            CallNext(null, 1);
+        }
+        catch (NullReferenceException)
+        {
+            threw = true;
+        }
+        Check(threw, "null interface receiver");
+    }
+
+    public static int Main()
+    {
+        Verify();
+        Train();
+        Verify();
+
+        if (s_failures != 0)
+        {
+            return 101;
+        }
+
+        Console.WriteLine("PASSED");
+        return 100;
+    }
+}
@@ -0,0 +1,223 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+using System;
+using System.Runtime.CompilerServices;
+using System.Runtime.InteropServices;
+
+// Int induction variables of counted loops may be widened to long when the loop sign extends them.
+// Check that the iv keeps its int value everywhere it is observed: after the loop, when passed to
+// calls, in arithmetic that wraps, when it is reassigned outside the loop, when it is the limit of
+// an inner loop, and for limits next to int.MaxValue.
+
+public class IVWidening
+{
+    static int s_failures;
+    static long s_observed;
+
+    static void Check(bool condition, string test, long arg)
+    {
+        if (!condition)
+        {
+            Console.WriteLine($"FAILED: {test}, {arg}");
+            s_failures++;
+        }
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static void Observe(int i)
+    {
+        s_observed += i;
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static long SumArray(int[] a)
+    {
+        long sum = 0;
+        for (int i = 0; i < a.Length; i++)
+        {
+            sum += a[i];
+        }
+        return sum;
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static long SumUnchecked(int[] a, int n)
+    {
+        ref int start = ref MemoryMarshal.GetArrayDataReference(a);
+        long sum = 0;
+        for (int i = 0; i < n; i++)
+        {
+            sum += Unsafe.Add(ref start, i);
+        }
+        return sum;
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static long Extend(int start, int limit)
+    {
+        long sum = 0;
+        for (int i = start; i < limit; i++)
+        {
+            sum += (long)i * 0x1_0000_0001;
+        }
+        return sum;
+    }
+
+    [MethodImpl(MethodImplOptions.NoOptimization)]
+    static long ExtendRef(int start, int limit)
+    {
+        long sum = 0;
+        for (int i = start; i < limit; i++)
+        {
+            sum += (long)i * 0x1_0000_0001;
+        }
+        return sum;
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static int ValueAfterLoop(int[] a, int n)
+    {
+        ref int start = ref MemoryMarshal.GetArrayDataReference(a);
+        int i = 0;
+        for (; i < n; i++)
+        {
+            Unsafe.Add(ref start, i) = i;
+        }
+        return i;
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static int WrappingUses(int n)
+    {
+        int r = 0;
+        for (int i = 0; i < n; i++)
+        {
+            // i * i wraps as an int for large i.
+            r ^= i * i * 65599;
+            s_observed += (long)i;
+        }
+        return r;
+    }
+
+    [MethodImpl(MethodImplOptions.NoOptimization)]
+    static int WrappingUsesRef(int n)
+    {
+        int r = 0;
+        for (int i = 0; i < n; i++)
+        {
+            r ^= i * i * 65599;
+        }
+        return r;
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static long PassedToCall(int n)
+    {
+        long sum = 0;
+        for (int i = 0; i < n; i++)
+        {
+            Observe(i);
+            sum += (long)i;
+        }
+        return sum;
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static long ReassignedOutside(int n, int m)
+    {
+        long sum = 0;
+        int i;
+        for (i = 0; i < n; i++)
+        {
+            sum += (long)i;
+        }
+        i = m - 1;
+        sum += (long)i;
+        i = -5;
+        return sum + i;
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static long Nested(int n)
+    {
+        long sum = 0;
+        for (int i = 0; i < n; i++)
+        {
+            for (int j = 0; j < i; j++)
+            {
+                sum += (long)j + (long)i * 1000;
+            }
+        }
+        return sum;
+    }
+
+    [MethodImpl(MethodImplOptions.NoOptimization)]
+    static long NestedRef(int n)
+    {
+        long sum = 0;
+        for (int i = 0; i < n; i++)
+        {
+            for (int j = 0; j < i; j++)
+            {
+                sum += (long)j + (long)i * 1000;
+            }
+        }
+        return sum;
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static long NegativeStart(int n)
+    {
+        long sum = 0;
+        for (int i = -3; i < n; i++)
+        {
+            sum += (long)i;
+        }
+        return sum;
+    }
+
+    public static int Main()
+    {
+        for (int n = 0; n < 20; n++)
+        {
+            int[] a = new int[n];
+            long expected = 0;
+            for (int i = 0; i < n; i++)
+            {
+                a[i] = i * 7 - 20;
+                expected += a[i];
+            }
+
+            Check(SumArray(a) == expected, "SumArray", n);
+            Check(SumUnchecked(a, n) == expected, "SumUnchecked", n);
+            Check(Extend(0, n) == ExtendRef(0, n), "Extend", n);
+            Check(ValueAfterLoop(new int[n], n) == n, "ValueAfterLoop", n);
+
+            long triangle = (long)n * (n - 1) / 2;
+            s_observed = 0;
+            Check(PassedToCall(n) == triangle, "PassedToCall", n);
+            Check(s_observed == triangle, "PassedToCall observed", n);
+
+            Check(ReassignedOutside(n, 100) == triangle + 99 - 5, "ReassignedOutside", n);
+            Check(Nested(n) == NestedRef(n), "Nested", n);
+            Check(NegativeStart(n) == triangle - 6, "NegativeStart", n);
+        }
+
+        Check(WrappingUses(100000) == WrappingUsesRef(100000), "WrappingUses", 100000);
+
+        // The increment must not overflow past limits next to int.MaxValue.
+        for (int d = 0; d <= 5; d++)
+        {
+            Check(Extend(int.MaxValue - d, int.MaxValue) == ExtendRef(int.MaxValue - d, int.MaxValue), "Extend max", d);
+        }
+
+        if (s_failures != 0)
+        {
+            return 101;
+        }
+
+        Console.WriteLine("PASSED");
+        return 100;
+    }
+}
@@ -0,0 +1,158 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+using System;
+using System.Runtime.CompilerServices;
+
+// Loop hoisting may move loads of a field out of a loop that only stores to other fields. Check that
+// block stores which start at one field but extend into the next are treated as modifying the heap,
+// so loads of the following field stay in the loop. Covers instance fields, fields of static structs
+// and array elements.
+
+public class LoopHoistBlockStore
+{
+    static int s_failures;
+
+    static void Check(long actual, long expected, string test)
+    {
+        if (actual != expected)
+        {
+            Console.WriteLine($"FAILED: {test}, expected {expected}, got {actual}");
+            s_failures++;
+        }
+    }
+
+    struct Pair
+    {
+        public long A;
+        public long B;
+    }
+
+    class Holder
+    {
+        public long A;
+        public long B;
+    }
+
+    static Pair s_pair;
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static long InitBlockField(Holder h, int n)
+    {
+        long sum = 0;
+        for (int i = 0; i < n; i++)
+        {
+            Unsafe.InitBlock(ref Unsafe.As<long, byte>(ref h.A), (byte)i, 16);
+            sum += h.B;
+        }
+        return sum;
+    }
+
+    [MethodImpl(MethodImplOptions.NoOptimization)]
+    static long InitBlockFieldRef(Holder h, int n)
+    {
+        long sum = 0;
+        for (int i = 0; i < n; i++)
+        {
+            Unsafe.InitBlock(ref Unsafe.As<long, byte>(ref h.A), (byte)i, 16);
+            sum += h.B;
+        }
+        return sum;
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static long StructStoreField(Holder h, int n)
+    {
+        long sum = 0;
+        for (int i = 0; i < n; i++)
+        {
+            Unsafe.As<long, Pair>(ref h.A) = new Pair { A = i, B = i * 3 };
+            sum += h.B;
+        }
+        return sum;
+    }
+
+    [MethodImpl(MethodImplOptions.NoOptimization)]
+    static long StructStoreFieldRef(Holder h, int n)
+    {
+        long sum = 0;
+        for (int i = 0; i < n; i++)
+        {
+            Unsafe.As<long, Pair>(ref h.A) = new Pair { A = i, B = i * 3 };
+            sum += h.B;
+        }
+        return sum;
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static long InitBlockStatic(int n)
+    {
+        long sum = 0;
+        for (int i = 0; i < n; i++)
+        {
+            Unsafe.InitBlock(ref Unsafe.As<long, byte>(ref s_pair.A), (byte)(i + 1), 16);
+            sum += s_pair.B;
+        }
+        return sum;
+    }
+
+    [MethodImpl(MethodImplOptions.NoOptimization)]
+    static long InitBlockStaticRef(int n)
+    {
+        long sum = 0;
+        for (int i = 0; i < n; i++)
+        {
+            Unsafe.InitBlock(ref Unsafe.As<long, byte>(ref s_pair.A), (byte)(i + 1), 16);
+            sum += s_pair.B;
+        }
+        return sum;
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static long WideStoreElement(int[] a, int n)
+    {
+        long sum = 0;
+        for (int i = 0; i < n; i++)
+        {
+            Unsafe.As<int, long>(ref a[0]) = (long)i << 32 | (uint)(i * 5);
+            sum += a[1];
+        }
+        return sum;
+    }
+
+    [MethodImpl(MethodImplOptions.NoOptimization)]
+    static long WideStoreElementRef(int[] a, int n)
+    {
+        long sum = 0;
+        for (int i = 0; i < n; i++)
+        {
+            Unsafe.As<int, long>(ref a[0]) = (long)i << 32 | (uint)(i * 5);
+            sum += a[1];
+        }
+        return sum;
+    }
+
+    public static int Main()
+    {
+        foreach (int n in new[] { 0, 1, 2, 17, 300 })
+        {
+            Check(InitBlockField(new Holder(), n), InitBlockFieldRef(new Holder(), n), $"InitBlockField({n})");
+            Check(StructStoreField(new Holder(), n), StructStoreFieldRef(new Holder(), n), $"StructStoreField({n})");
+
+            s_pair = default;
+            long actual = InitBlockStatic(n);
+            s_pair = default;
+            Check(actual, InitBlockStaticRef(n), $"InitBlockStatic({n})");
+
+            Check(WideStoreElement(new int[2], n), WideStoreElementRef(new int[2], n), $"WideStoreElement({n})");
+        }
+
+        if (s_failures != 0)
+        {
+            return 101;
+        }
+
+        Console.WriteLine("PASSED");
+        return 100;
+    }
+}
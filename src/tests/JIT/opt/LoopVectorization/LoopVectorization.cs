@@ -0,0 +1,421 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+using System;
+using System.Runtime.CompilerServices;
+
+// Correctness of loop vectorization: each loop is checked against a copy that is never optimized,
+// for trip counts around the vector length, for arrays and spans that alias or overlap, and for
+// loops that must not be vectorized (non-unit strides, dependencies between iterations).
+
+public class LoopVectorization
+{
+    static int s_failures;
+
+    static readonly int[] s_lengths = { 0, 1, 2, 3, 4, 5, 7, 8, 9, 15, 16, 17, 31, 32, 33, 100 };
+
+    static void Check(bool condition, string test, int length)
+    {
+        if (!condition)
+        {
+            Console.WriteLine($"FAILED: {test}, length {length}");
+            s_failures++;
+        }
+    }
+
+    static int[] IntArray(int length, int seed)
+    {
+        int[] a = new int[length];
+        for (int i = 0; i < a.Length; i++)
+        {
+            a[i] = (i * 7 + seed) % 23 - 11;
+        }
+        return a;
+    }
+
+    static long[] LongArray(int length, int seed)
+    {
+        long[] a = new long[length];
+        for (int i = 0; i < a.Length; i++)
+        {
+            a[i] = ((long)(i * 13 + seed) << 33) - i;
+        }
+        return a;
+    }
+
+    static float[] FloatArray(int length, int seed)
+    {
+        float[] a = new float[length];
+        for (int i = 0; i < a.Length; i++)
+        {
+            a[i] = (i + seed) * 0.5f;
+        }
+        return a;
+    }
+
+    static double[] DoubleArray(int length, int seed)
+    {
+        double[] a = new double[length];
+        for (int i = 0; i < a.Length; i++)
+        {
+            a[i] = (i - seed) * 0.25;
+        }
+        return a;
+    }
+
+    static bool Equal<T>(T[] a, T[] b) where T : IEquatable<T>
+    {
+        if (a.Length != b.Length)
+        {
+            return false;
+        }
+        for (int i = 0; i < a.Length; i++)
+        {
+            if (!a[i].Equals(b[i]))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // Element-wise stores
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static void AddInt(int[] dst, int[] a, int[] b, int n)
+    {
+        for (int i = 0; i < n; i++)
+        {
+            dst[i] = a[i] + b[i];
+        }
+    }
+
+    [MethodImpl(MethodImplOptions.NoOptimization)]
+    static void AddIntRef(int[] dst, int[] a, int[] b, int n)
+    {
+        for (int i = 0; i < n; i++)
+        {
+            dst[i] = a[i] + b[i];
+        }
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static void XorLong(long[] dst, long[] a, long c, int n)
+    {
+        for (int i = 0; i < n; i++)
+        {
+            dst[i] = (a[i] ^ c) - dst[i];
+        }
+    }
+
+    [MethodImpl(MethodImplOptions.NoOptimization)]
+    static void XorLongRef(long[] dst, long[] a, long c, int n)
+    {
+        for (int i = 0; i < n; i++)
+        {
+            dst[i] = (a[i] ^ c) - dst[i];
+        }
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static void MulAddFloat(float[] dst, float[] a, float[] b, float c)
+    {
+        for (int i = 0; i < dst.Length; i++)
+        {
+            dst[i] = a[i] * b[i] + c;
+        }
+    }
+
+    [MethodImpl(MethodImplOptions.NoOptimization)]
+    static void MulAddFloatRef(float[] dst, float[] a, float[] b, float c)
+    {
+        for (int i = 0; i < dst.Length; i++)
+        {
+            dst[i] = a[i] * b[i] + c;
+        }
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static void DivDouble(double[] dst, double[] a, double c)
+    {
+        for (int i = 0; i < dst.Length; i++)
+        {
+            dst[i] = a[i] / c - dst[i];
+        }
+    }
+
+    [MethodImpl(MethodImplOptions.NoOptimization)]
+    static void DivDoubleRef(double[] dst, double[] a, double c)
+    {
+        for (int i = 0; i < dst.Length; i++)
+        {
+            dst[i] = a[i] / c - dst[i];
+        }
+    }
+
+    // Reductions
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static int SumInt(int[] a, int n)
+    {
+        int sum = 0;
+        for (int i = 0; i < n; i++)
+        {
+            sum = sum + a[i];
+        }
+        return sum;
+    }
+
+    [MethodImpl(MethodImplOptions.NoOptimization)]
+    static int SumIntRef(int[] a, int n)
+    {
+        int sum = 0;
+        for (int i = 0; i < n; i++)
+        {
+            sum = sum + a[i];
+        }
+        return sum;
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static long SumLongStart(long[] a, int start)
+    {
+        long sum = 3;
+        for (int i = start; i < a.Length; i++)
+        {
+            sum = sum + (a[i] - 1);
+        }
+        return sum;
+    }
+
+    [MethodImpl(MethodImplOptions.NoOptimization)]
+    static long SumLongStartRef(long[] a, int start)
+    {
+        long sum = 3;
+        for (int i = start; i < a.Length; i++)
+        {
+            sum = sum + (a[i] - 1);
+        }
+        return sum;
+    }
+
+    // Spans, which may overlap at any offset
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static void AddSpan(Span<int> dst, ReadOnlySpan<int> a, ReadOnlySpan<int> b)
+    {
+        for (int i = 0; i < dst.Length; i++)
+        {
+            dst[i] = a[i] + b[i];
+        }
+    }
+
+    [MethodImpl(MethodImplOptions.NoOptimization)]
+    static void AddSpanRef(Span<int> dst, ReadOnlySpan<int> a, ReadOnlySpan<int> b)
+    {
+        for (int i = 0; i < dst.Length; i++)
+        {
+            dst[i] = a[i] + b[i];
+        }
+    }
+
+    // Dependencies between iterations and non-unit strides, which must not be vectorized
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static void PrefixSum(int[] a, int n)
+    {
+        for (int i = 1; i < n; i++)
+        {
+            a[i] = a[i] + a[i - 1];
+        }
+    }
+
+    [MethodImpl(MethodImplOptions.NoOptimization)]
+    static void PrefixSumRef(int[] a, int n)
+    {
+        for (int i = 1; i < n; i++)
+        {
+            a[i] = a[i] + a[i - 1];
+        }
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static void ShiftLeft(int[] a, int n)
+    {
+        for (int i = 0; i < n - 1; i++)
+        {
+            a[i] = a[i + 1] * 2;
+        }
+    }
+
+    [MethodImpl(MethodImplOptions.NoOptimization)]
+    static void ShiftLeftRef(int[] a, int n)
+    {
+        for (int i = 0; i < n - 1; i++)
+        {
+            a[i] = a[i + 1] * 2;
+        }
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static void Stride2(int[] dst, int[] a, int n)
+    {
+        for (int i = 0; i < n; i += 2)
+        {
+            dst[i] = a[i] + 1;
+        }
+    }
+
+    [MethodImpl(MethodImplOptions.NoOptimization)]
+    static void Stride2Ref(int[] dst, int[] a, int n)
+    {
+        for (int i = 0; i < n; i += 2)
+        {
+            dst[i] = a[i] + 1;
+        }
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static int SumStride3(int[] a)
+    {
+        int sum = 0;
+        for (int i = 0; i < a.Length; i += 3)
+        {
+            sum = sum + a[i];
+        }
+        return sum;
+    }
+
+    [MethodImpl(MethodImplOptions.NoOptimization)]
+    static int SumStride3Ref(int[] a)
+    {
+        int sum = 0;
+        for (int i = 0; i < a.Length; i += 3)
+        {
+            sum = sum + a[i];
+        }
+        return sum;
+    }
+
+    static void TestArrays(int n)
+    {
+        int[] a = IntArray(n, 1);
+        int[] b = IntArray(n, 5);
+        int[] dst = new int[n];
+        int[] expected = new int[n];
+        AddInt(dst, a, b, n);
+        AddIntRef(expected, a, b, n);
+        Check(Equal(dst, expected), "AddInt", n);
+
+        // Destination aliases a source, every access is to element i.
+        int[] aliased = IntArray(n, 3);
+        int[] aliasedExpected = IntArray(n, 3);
+        AddInt(aliased, aliased, aliased, n);
+        AddIntRef(aliasedExpected, aliasedExpected, aliasedExpected, n);
+        Check(Equal(aliased, aliasedExpected), "AddInt aliased", n);
+
+        long[] la = LongArray(n, 2);
+        long[] ldst = LongArray(n, 9);
+        long[] lexpected = LongArray(n, 9);
+        XorLong(ldst, la, 0x5555_0000_FFFF, n);
+        XorLongRef(lexpected, la, 0x5555_0000_FFFF, n);
+        Check(Equal(ldst, lexpected), "XorLong", n);
+
+        float[] fa = FloatArray(n, 1);
+        float[] fb = FloatArray(n, 4);
+        float[] fdst = new float[n];
+        float[] fexpected = new float[n];
+        MulAddFloat(fdst, fa, fb, 1.5f);
+        MulAddFloatRef(fexpected, fa, fb, 1.5f);
+        Check(Equal(fdst, fexpected), "MulAddFloat", n);
+
+        double[] da = DoubleArray(n, 3);
+        double[] ddst = DoubleArray(n, 7);
+        double[] dexpected = DoubleArray(n, 7);
+        DivDouble(ddst, da, 3.0);
+        DivDoubleRef(dexpected, da, 3.0);
+        Check(Equal(ddst, dexpected), "DivDouble", n);
+
+        Check(SumInt(a, n) == SumIntRef(a, n), "SumInt", n);
+        Check(SumLongStart(la, 0) == SumLongStartRef(la, 0), "SumLongStart 0", n);
+        Check(SumLongStart(la, 1) == SumLongStartRef(la, 1), "SumLongStart 1", n);
+        Check(SumLongStart(la, n) == SumLongStartRef(la, n), "SumLongStart n", n);
+    }
+
+    static void TestSpans(int n)
+    {
+        // Overlapping at every offset around the vector length, in both directions.
+        for (int offset = -5; offset <= 5; offset++)
+        {
+            int[] buffer = IntArray(n + 10, 2);
+            int[] expectedBuffer = IntArray(n + 10, 2);
+            int dstStart = 5 + offset;
+
+            AddSpan(buffer.AsSpan(dstStart, n), buffer.AsSpan(5, n), buffer.AsSpan(5, n));
+            AddSpanRef(expectedBuffer.AsSpan(dstStart, n), expectedBuffer.AsSpan(5, n), expectedBuffer.AsSpan(5, n));
+            Check(Equal(buffer, expectedBuffer), $"AddSpan offset {offset}", n);
+        }
+
+        int[] a = IntArray(n, 1);
+        int[] b = IntArray(n, 6);
+        int[] dst = new int[n];
+        int[] expected = new int[n];
+        AddSpan(dst, a, b);
+        AddSpanRef(expected, a, b);
+        Check(Equal(dst, expected), "AddSpan disjoint", n);
+    }
+
+    static void TestNotVectorizable(int n)
+    {
+        int[] a = IntArray(n, 4);
+        int[] expected = IntArray(n, 4);
+        PrefixSum(a, n);
+        PrefixSumRef(expected, n);
+        Check(Equal(a, expected), "PrefixSum", n);
+
+        a = IntArray(n, 8);
+        expected = IntArray(n, 8);
+        ShiftLeft(a, n);
+        ShiftLeftRef(expected, n);
+        Check(Equal(a, expected), "ShiftLeft", n);
+
+        int[] src = IntArray(n, 2);
+        int[] dst = new int[n];
+        expected = new int[n];
+        Stride2(dst, src, n);
+        Stride2Ref(expected, src, n);
+        Check(Equal(dst, expected), "Stride2", n);
+
+        Check(SumStride3(src) == SumStride3Ref(src), "SumStride3", n);
+    }
+
+    public static int Main()
+    {
+        foreach (int n in s_lengths)
+        {
+            TestArrays(n);
+            TestSpans(n);
+            TestNotVectorizable(n);
+        }
+
+        // Out of range accesses must still throw.
+        bool threw = false;
+        try
+        {
+            AddInt(new int[8], new int[8], new int[7], 8);
+        }
+        catch (IndexOutOfRangeException)
+        {
+            threw = true;
+        }
+        Check(threw, "AddInt out of range", 8);
+
+        if (s_failures != 0)
+        {
+            return 101;
+        }
+
+        Console.WriteLine("PASSED");
+        return 100;
+    }
+}
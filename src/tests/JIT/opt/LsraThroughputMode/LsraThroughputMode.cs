@@ -0,0 +1,254 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+using System;
+using System.Runtime.CompilerServices;
+
+// LSRA switches to its throughput mode for huge methods, where only the hottest tracked locals are
+// register candidates and the costlier register selection heuristics are skipped. The test forces
+// that mode for every method and leaves only a couple of candidates, then checks methods with more
+// live locals than registers across loops, calls, exception handlers, switches, floating point
+// and struct locals against unoptimized copies.
+
+public class LsraThroughputMode
+{
+    static int s_failures;
+
+    static void Check(long actual, long expected, string test)
+    {
+        if (actual != expected)
+        {
+            Console.WriteLine($"FAILED: {test}, expected {expected}, got {actual}");
+            s_failures++;
+        }
+    }
+
+    struct Pair
+    {
+        public long X;
+        public long Y;
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static long Id(long x) => x;
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static void MaybeThrow(int i)
+    {
+        if (i % 7 == 6)
+        {
+            throw new InvalidOperationException();
+        }
+    }
+
+    // More live locals than registers, updated in a loop and across calls.
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static long ManyLocals(int n)
+    {
+        long a = 1, b = 2, c = 3, d = 4, e = 5, f = 6, g = 7, h = 8;
+        long i0 = 9, j = 10, k = 11, l = 12, m = 13, o = 14, p = 15, q = 16;
+        for (int i = 0; i < n; i++)
+        {
+            a += b ^ i; b += c; c ^= d + i; d += e;
+            e -= f; f += g * 3; g ^= h; h += i0;
+            i0 += Id(j); j ^= k; k += l; l -= m;
+            m += o; o ^= p; p += q; q += a;
+        }
+        return a + b * 3 + c * 5 + d * 7 + e * 11 + f * 13 + g * 17 + h * 19 +
+               i0 * 23 + j * 29 + k * 31 + l * 37 + m * 41 + o * 43 + p * 47 + q * 53;
+    }
+
+    // Locals live into and out of handlers.
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static long Handlers(int n)
+    {
+        long sum = 0, caught = 0, finallies = 0, last = -1;
+        for (int i = 0; i < n; i++)
+        {
+            try
+            {
+                MaybeThrow(i);
+                sum += i;
+                last = i;
+            }
+            catch (InvalidOperationException)
+            {
+                caught += i;
+            }
+            finally
+            {
+                finallies++;
+            }
+        }
+        return sum * 1000003 + caught * 1009 + finallies * 31 + last;
+    }
+
+    // Many blocks with locals that are only live in some of them.
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static long Switch(int n)
+    {
+        long r0 = 0, r1 = 1, r2 = 2, r3 = 3, r4 = 4, r5 = 5;
+        for (int i = 0; i < n; i++)
+        {
+            switch (i % 6)
+            {
+                case 0: r0 += r5 + i; break;
+                case 1: r1 ^= r0 << 1; break;
+                case 2: r2 += Id(r1); break;
+                case 3: r3 -= r2 * 3; break;
+                case 4: r4 += r3 ^ i; break;
+                default: r5 += r4 - r0; break;
+            }
+        }
+        return r0 ^ (r1 * 3) ^ (r2 * 5) ^ (r3 * 7) ^ (r4 * 11) ^ (r5 * 13);
+    }
+
+    // Floating point and integer locals live at the same time.
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static long Mixed(int n)
+    {
+        double x = 0.5, y = 1.5, z = -2.0, w = 3.25;
+        long s = 0, t = 1;
+        for (int i = 0; i < n; i++)
+        {
+            x += y * 0.5;
+            y -= z * 0.25;
+            z += w / 8;
+            w = w * 0.75 + i;
+            s += (long)x ^ i;
+            t += Id((long)w);
+        }
+        return (long)(x * 16) + (long)(y * 16) * 3 + (long)(z * 16) * 5 + (long)(w * 16) * 7 + s * 11 + t * 13;
+    }
+
+    // Struct locals next to primitives.
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static long Structs(int n)
+    {
+        Pair p1 = default, p2 = default;
+        p2.Y = 3;
+        long extra = 7;
+        for (int i = 0; i < n; i++)
+        {
+            p1.X += i;
+            p1.Y ^= p2.Y + extra;
+            p2.X += Id(p1.X);
+            p2.Y += p1.Y & 0xff;
+            extra += p2.X & 3;
+        }
+        return p1.X + p1.Y * 3 + p2.X * 5 + p2.Y * 7 + extra * 11;
+    }
+
+    [MethodImpl(MethodImplOptions.NoOptimization)]
+    static long ManyLocalsRef(int n)
+    {
+        long a = 1, b = 2, c = 3, d = 4, e = 5, f = 6, g = 7, h = 8;
+        long i0 = 9, j = 10, k = 11, l = 12, m = 13, o = 14, p = 15, q = 16;
+        for (int i = 0; i < n; i++)
+        {
+            a += b ^ i; b += c; c ^= d + i; d += e;
+            e -= f; f += g * 3; g ^= h; h += i0;
+            i0 += Id(j); j ^= k; k += l; l -= m;
+            m += o; o ^= p; p += q; q += a;
+        }
+        return a + b * 3 + c * 5 + d * 7 + e * 11 + f * 13 + g * 17 + h * 19 +
+               i0 * 23 + j * 29 + k * 31 + l * 37 + m * 41 + o * 43 + p * 47 + q * 53;
+    }
+
+    [MethodImpl(MethodImplOptions.NoOptimization)]
+    static long HandlersRef(int n)
+    {
+        long sum = 0, caught = 0, finallies = 0, last = -1;
+        for (int i = 0; i < n; i++)
+        {
+            try
+            {
+                MaybeThrow(i);
+                sum += i;
+                last = i;
+            }
+            catch (InvalidOperationException)
+            {
+                caught += i;
+            }
+            finally
+            {
+                finallies++;
+            }
+        }
+        return sum * 1000003 + caught * 1009 + finallies * 31 + last;
+    }
+
+    [MethodImpl(MethodImplOptions.NoOptimization)]
+    static long SwitchRef(int n)
+    {
+        long r0 = 0, r1 = 1, r2 = 2, r3 = 3, r4 = 4, r5 = 5;
+        for (int i = 0; i < n; i++)
+        {
+            switch (i % 6)
+            {
+                case 0: r0 += r5 + i; break;
+                case 1: r1 ^= r0 << 1; break;
+                case 2: r2 += Id(r1); break;
+                case 3: r3 -= r2 * 3; break;
+                case 4: r4 += r3 ^ i; break;
+                default: r5 += r4 - r0; break;
+            }
+        }
+        return r0 ^ (r1 * 3) ^ (r2 * 5) ^ (r3 * 7) ^ (r4 * 11) ^ (r5 * 13);
+    }
+
+    [MethodImpl(MethodImplOptions.NoOptimization)]
+    static long MixedRef(int n)
+    {
+        double x = 0.5, y = 1.5, z = -2.0, w = 3.25;
+        long s = 0, t = 1;
+        for (int i = 0; i < n; i++)
+        {
+            x += y * 0.5;
+            y -= z * 0.25;
+            z += w / 8;
+            w = w * 0.75 + i;
+            s += (long)x ^ i;
+            t += Id((long)w);
+        }
+        return (long)(x * 16) + (long)(y * 16) * 3 + (long)(z * 16) * 5 + (long)(w * 16) * 7 + s * 11 + t * 13;
+    }
+
+    [MethodImpl(MethodImplOptions.NoOptimization)]
+    static long StructsRef(int n)
+    {
+        Pair p1 = default, p2 = default;
+        p2.Y = 3;
+        long extra = 7;
+        for (int i = 0; i < n; i++)
+        {
+            p1.X += i;
+            p1.Y ^= p2.Y + extra;
+            p2.X += Id(p1.X);
+            p2.Y += p1.Y & 0xff;
+            extra += p2.X & 3;
+        }
+        return p1.X + p1.Y * 3 + p2.X * 5 + p2.Y * 7 + extra * 11;
+    }
+
+    public static int Main()
+    {
+        foreach (int n in new[] { 0, 1, 2, 7, 13, 64, 1000 })
+        {
+            Check(ManyLocals(n), ManyLocalsRef(n), $"ManyLocals({n})");
+            Check(Handlers(n), HandlersRef(n), $"Handlers({n})");
+            Check(Switch(n), SwitchRef(n), $"Switch({n})");
+            Check(Mixed(n), MixedRef(n), $"Mixed({n})");
+            Check(Structs(n), StructsRef(n), $"Structs({n})");
+        }
+
+        if (s_failures != 0)
+        {
+            return 101;
+        }
+
+        Console.WriteLine("PASSED");
+        return 100;
+    }
+}
@@ -0,0 +1,140 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+using System;
+using System.Runtime.CompilerServices;
+
+// Ref stores into an object allocated in the same block, with no call in between, are done
+// without a write barrier. Check that the referenced objects survive GCs that happen after the
+// stores, and that stores made after a GC (once the object may have been promoted) still mark
+// cards.
+
+public class Node
+{
+    public object A;
+    public object B;
+    public Node Next;
+    public int Value;
+}
+
+public class NewObjWriteBarriers
+{
+    static object s_old = new object();
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static Node StoreIntoNew(object a, object b)
+    {
+        Node n = new Node();
+        n.A = a;
+        n.B = b;
+        n.Value = 1;
+        return n;
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static Node StoreAcrossGC(object a)
+    {
+        Node n = new Node();
+        n.A = a;
+        GC.Collect();
+        // n may have been promoted by now, so this store needs its card set.
+        n.B = new string('b', 3);
+        return n;
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static Node StoreAfterPublish(Node head)
+    {
+        Node n = new Node();
+        head.Next = n;
+        // n is reachable from head, which may be old.
+        n.A = new string('a', 3);
+        return n;
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static Node Chain(int count)
+    {
+        Node head = null;
+        for (int i = 0; i < count; i++)
+        {
+            Node n = new Node();
+            n.Next = head;
+            n.A = new string('c', 1);
+            n.Value = i;
+            head = n;
+        }
+        return head;
+    }
+
+    static void Churn()
+    {
+        for (int i = 0; i < 10000; i++)
+        {
+            _ = new byte[64];
+        }
+        GC.Collect(0);
+        GC.Collect(1);
+    }
+
+    static bool CheckString(object o, char c)
+    {
+        return (o is string s) && (s.Length >= 1) && (s[0] == c);
+    }
+
+    public static int Main()
+    {
+        GC.Collect();
+
+        Node n1 = StoreIntoNew(s_old, new string('x', 2));
+        Churn();
+        if ((n1.A != s_old) || !CheckString(n1.B, 'x') || (n1.Value != 1))
+        {
+            Console.WriteLine("FAILED: StoreIntoNew");
+            return 101;
+        }
+
+        Node n2 = StoreAcrossGC(new string('y', 2));
+        GC.Collect();
+        Churn();
+        if (!CheckString(n2.A, 'y') || !CheckString(n2.B, 'b'))
+        {
+            Console.WriteLine("FAILED: StoreAcrossGC");
+            return 102;
+        }
+
+        Node head = new Node();
+        GC.Collect();
+        GC.Collect();
+        Node n3 = StoreAfterPublish(head);
+        Churn();
+        if ((head.Next != n3) || !CheckString(n3.A, 'a'))
+        {
+            Console.WriteLine("FAILED: StoreAfterPublish");
+            return 103;
+        }
+
+        Node chain = Chain(1000);
+        GC.Collect();
+        Churn();
+        int expected = 999;
+        for (Node n = chain; n != null; n = n.Next)
+        {
+            if ((n.Value != expected) || !CheckString(n.A, 'c'))
+            {
+                Console.WriteLine("FAILED: Chain");
+                return 104;
+            }
+            expected--;
+        }
+
+        if (expected != -1)
+        {
+            Console.WriteLine("FAILED: Chain length");
+            return 105;
+        }
+
+        Console.WriteLine("PASSED");
+        return 100;
+    }
+}
@@ -0,0 +1,289 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+using System;
+using System.Runtime.CompilerServices;
+
+// Objects, boxes and arrays that don't escape may be allocated on the stack. Check that the ones
+// that do escape (through statics, fields, returns and calls) still live on the heap, that uses
+// which don't make an object escape (length, null checks, inlined instance methods, element
+// addresses) give the right results, and that references held by stack allocated objects are
+// reported to the GC.
+
+public struct Point
+{
+    public int X;
+    public int Y;
+
+    public override string ToString() => $"{X},{Y}";
+}
+
+public interface ISum
+{
+    int Sum();
+}
+
+public struct PointSum : ISum
+{
+    public int X;
+    public int Y;
+
+    public int Sum() => X + Y;
+}
+
+public class Pair
+{
+    public int A;
+    public int B;
+
+    [MethodImpl(MethodImplOptions.AggressiveInlining)]
+    public int Sum() => A + B;
+}
+
+public class Holder
+{
+    public object Value;
+    public int Tag;
+}
+
+public class ObjectStackAllocationTests
+{
+    static object s_escaped;
+    static int[] s_escapedArray;
+    static Holder s_holder = new Holder();
+
+    static int s_failures;
+
+    static void Check(bool condition, string test)
+    {
+        if (!condition)
+        {
+            Console.WriteLine($"FAILED: {test}");
+            s_failures++;
+        }
+    }
+
+    // Uses that don't escape
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static int BoxNotEscaping(int x, int y)
+    {
+        object o = new Point { X = x, Y = y };
+        Point p = (Point)o;
+        return p.X * 10 + p.Y;
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static int ArrayNotEscaping(int x)
+    {
+        int[] a = new int[4];
+        for (int i = 0; i < a.Length; i++)
+        {
+            a[i] = x + i;
+        }
+        return a[0] + a[1] + a[2] + a[3] + a.Length;
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static int ArrayElementAddress(int x)
+    {
+        long[] a = new long[3];
+        ref long r = ref a[1];
+        r = x;
+        a[2] = r + 1;
+        return (int)(a[0] + a[1] + a[2]);
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static int ArrayOutOfRange(int index)
+    {
+        int[] a = new int[2];
+        a[index] = 1;
+        return a[0] + a[1];
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static int InlinedInstanceMethod(int a, int b)
+    {
+        Pair p = new Pair();
+        p.A = a;
+        p.B = b;
+        return p.Sum();
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static int ArrayNullCompare(int x)
+    {
+        byte[] a = new byte[8];
+        a[3] = (byte)x;
+        return (a != null) ? a[3] : -1;
+    }
+
+    // Uses that escape
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static void BoxEscapesToStatic(int x)
+    {
+        object o = new Point { X = x, Y = x + 1 };
+        s_escaped = o;
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static void ArrayEscapesToStatic(int x)
+    {
+        int[] a = new int[4];
+        a[0] = x;
+        a[3] = x + 3;
+        s_escapedArray = a;
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static int[] ArrayEscapesViaReturn(int x)
+    {
+        int[] a = new int[3];
+        a[1] = x;
+        return a;
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static void ArrayEscapesToField(int x)
+    {
+        double[] a = new double[2];
+        a[0] = x;
+        s_holder.Value = a;
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static void Store(object o)
+    {
+        s_escaped = o;
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static void ArrayEscapesViaCall(int x)
+    {
+        int[] a = new int[5];
+        a[4] = x;
+        Store(a);
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static int StoreInterface(ISum s)
+    {
+        s_escaped = s;
+        return s.Sum();
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static int BoxEscapesViaInterfaceCall(int x)
+    {
+        ISum s = new PointSum { X = x, Y = 2 * x };
+        return StoreInterface(s);
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static int[] ArrayAssignedTwice(bool first)
+    {
+        int[] a = new int[2];
+        if (!first)
+        {
+            a = new int[3];
+        }
+        a[0] = 7;
+        s_escapedArray = a;
+        return a;
+    }
+
+    // GC reporting
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static int ReferenceFromStackObject(int length)
+    {
+        Holder h = new Holder();
+        h.Value = new string('z', length);
+        h.Tag = length;
+        GC.Collect();
+        GC.WaitForPendingFinalizers();
+        GC.Collect();
+        return ((string)h.Value).Length + h.Tag;
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static int ArrayAcrossGC(int x)
+    {
+        int[] a = new int[4];
+        a[0] = x;
+        GC.Collect();
+        a[1] = x + 1;
+        GC.Collect();
+        return a[0] + a[1] + a.Length;
+    }
+
+    static void Churn()
+    {
+        for (int i = 0; i < 1000; i++)
+        {
+            _ = new int[16];
+        }
+        GC.Collect();
+    }
+
+    public static int Main()
+    {
+        Check(BoxNotEscaping(3, 4) == 34, "BoxNotEscaping");
+        Check(ArrayNotEscaping(5) == 5 + 6 + 7 + 8 + 4, "ArrayNotEscaping");
+        Check(ArrayElementAddress(9) == 19, "ArrayElementAddress");
+        Check(InlinedInstanceMethod(20, 22) == 42, "InlinedInstanceMethod");
+        Check(ArrayNullCompare(77) == 77, "ArrayNullCompare");
+
+        bool threw = false;
+        try
+        {
+            ArrayOutOfRange(2);
+        }
+        catch (IndexOutOfRangeException)
+        {
+            threw = true;
+        }
+        Check(threw, "ArrayOutOfRange");
+
+        BoxEscapesToStatic(11);
+        Churn();
+        Check((s_escaped is Point p) && (p.X == 11) && (p.Y == 12), "BoxEscapesToStatic");
+
+        ArrayEscapesToStatic(40);
+        Churn();
+        Check((s_escapedArray.Length == 4) && (s_escapedArray[0] == 40) && (s_escapedArray[3] == 43), "ArrayEscapesToStatic");
+
+        int[] returned = ArrayEscapesViaReturn(13);
+        Churn();
+        Check((returned.Length == 3) && (returned[1] == 13), "ArrayEscapesViaReturn");
+
+        ArrayEscapesToField(8);
+        Churn();
+        Check((s_holder.Value is double[] d) && (d.Length == 2) && (d[0] == 8), "ArrayEscapesToField");
+
+        ArrayEscapesViaCall(6);
+        Churn();
+        Check((s_escaped is int[] c) && (c.Length == 5) && (c[4] == 6), "ArrayEscapesViaCall");
+
+        Check(BoxEscapesViaInterfaceCall(5) == 15, "BoxEscapesViaInterfaceCall");
+        Churn();
+        Check((s_escaped is PointSum ps) && (ps.Sum() == 15), "BoxEscapesViaInterfaceCall stored");
+
+        int[] twice = ArrayAssignedTwice(false);
+        Churn();
+        Check((twice.Length == 3) && (twice[0] == 7) && (s_escapedArray == twice), "ArrayAssignedTwice");
+
+        Check(ReferenceFromStackObject(10) == 20, "ReferenceFromStackObject");
+        Check(ArrayAcrossGC(3) == 3 + 4 + 4, "ArrayAcrossGC");
+
+        if (s_failures != 0)
+        {
+            return 101;
+        }
+
+        Console.WriteLine("PASSED");
+        return 100;
+    }
+}
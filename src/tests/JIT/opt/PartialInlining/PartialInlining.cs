@@ -0,0 +1,206 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+using System;
+using System.Runtime.CompilerServices;
+using System.Threading;
+
+// A callee whose profile shows that the side of its first branch is never taken may be inlined
+// without that side, which then calls the callee again with the original arguments. The callers
+// are trained on the fast paths only, and then the slow paths are taken: they must run exactly
+// once, see the original arguments, and their results and exceptions must reach the caller.
+
+public class Cache
+{
+    int[] _items = new int[4];
+    int _count;
+    public int SlowCalls;
+
+    public int Count => _count;
+
+    public void Add(int item)
+    {
+        if (_count < _items.Length)
+        {
+            _items[_count++] = item;
+            return;
+        }
+
+        // Slow path, bigger than the fast one.
+        SlowCalls++;
+        int[] newItems = new int[_items.Length * 2];
+        for (int i = 0; i < _items.Length; i++)
+        {
+            newItems[i] = _items[i];
+        }
+        _items = newItems;
+        _items[_count++] = item;
+    }
+
+    public int Get(int index) => _items[index];
+
+    public void Clear() => _count = 0;
+}
+
+public class PartialInlining
+{
+    static int s_failures;
+    static int s_slowCalls;
+
+    static void Check(bool condition, string test, long arg)
+    {
+        if (!condition)
+        {
+            Console.WriteLine($"FAILED: {test}, {arg}");
+            s_failures++;
+        }
+    }
+
+    static long Scale(int x, long factor)
+    {
+        if (x >= 0)
+        {
+            return x * factor;
+        }
+
+        s_slowCalls++;
+        long r = 0;
+        for (int i = x; i < 0; i++)
+        {
+            r -= factor;
+        }
+        if (r < -1_000_000)
+        {
+            r = -1_000_000;
+        }
+        return r;
+    }
+
+    static double Ratio(double a, double b)
+    {
+        if (b != 0)
+        {
+            return a / b;
+        }
+
+        s_slowCalls++;
+        if (a == 0)
+        {
+            throw new DivideByZeroException("0/0");
+        }
+        double r = (a > 0) ? double.MaxValue : double.MinValue;
+        Console.Write("");
+        return r;
+    }
+
+    static void Accumulate(ref long total, int x)
+    {
+        if (x < 1000)
+        {
+            total += x;
+            return;
+        }
+
+        s_slowCalls++;
+        total += 1000;
+        total += (x - 1000) / 2;
+        Console.Write("");
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static long CallScale(int x, long factor) => Scale(x, factor) + 1;
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static double CallRatio(double a, double b) => Ratio(a, b) * 2;
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static long CallAccumulate(int[] xs)
+    {
+        long total = 0;
+        foreach (int x in xs)
+        {
+            Accumulate(ref total, x);
+        }
+        return total;
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static int FillCache(Cache c, int n)
+    {
+        c.Clear();
+        for (int i = 0; i < n; i++)
+        {
+            c.Add(i * 3);
+        }
+        return c.Count;
+    }
+
+    static void Train()
+    {
+        int[] small = { 1, 2, 3, 4 };
+        Cache cache = new Cache();
+        for (int iter = 0; iter < 200; iter++)
+        {
+            CallScale(iter, 3);
+            CallRatio(iter, 2);
+            CallAccumulate(small);
+            FillCache(cache, 4);
+
+            if ((iter % 20) == 0)
+            {
+                Thread.Sleep(20);
+            }
+        }
+    }
+
+    static void Verify()
+    {
+        s_slowCalls = 0;
+        Check(CallScale(5, 7) == 36, "Scale fast", 5);
+        Check(CallScale(-4, 7) == -27, "Scale slow", -4);
+        Check(s_slowCalls == 1, "Scale slow calls", s_slowCalls);
+
+        s_slowCalls = 0;
+        Check(CallRatio(6, 3) == 4, "Ratio fast", 6);
+        Check(CallRatio(1, 0) == double.PositiveInfinity, "Ratio slow", 1);
+        Check(s_slowCalls == 1, "Ratio slow calls", s_slowCalls);
+
+        bool threw = false;
+        try
+        {
+            CallRatio(0, 0);
+        }
+        catch (DivideByZeroException)
+        {
+            threw = true;
+        }
+        Check(threw, "Ratio throws", 0);
+
+        s_slowCalls = 0;
+        Check(CallAccumulate(new[] { 1, 2, 2000, 3 }) == 1 + 2 + 1000 + 500 + 3, "Accumulate", 0);
+        Check(s_slowCalls == 1, "Accumulate slow calls", s_slowCalls);
+
+        Cache cache = new Cache();
+        Check(FillCache(cache, 9) == 9, "FillCache", 9);
+        Check(cache.SlowCalls == 2, "FillCache slow calls", cache.SlowCalls);
+        for (int i = 0; i < 9; i++)
+        {
+            Check(cache.Get(i) == i * 3, "FillCache item", i);
+        }
+    }
+
+    public static int Main()
+    {
+        Verify();
+        Train();
+        Verify();
+
+        if (s_failures != 0)
+        {
+            return 101;
+        }
+
+        Console.WriteLine("PASSED");
+        return 100;
+    }
+}
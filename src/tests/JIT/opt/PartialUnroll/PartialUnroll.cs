@@ -0,0 +1,172 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+using System;
+using System.Runtime.CompilerServices;
+using System.Threading;
+
+// Hot loops with run time trip counts may be unrolled by 2 or 4 once PGO data shows they run
+// many iterations, with the original loop handling the rest. The loops are trained on long trip
+// counts and then checked against unoptimized copies for trip counts that leave every possible
+// remainder, for limits next to int.MaxValue, and for loops that exit early.
+
+public class PartialUnroll
+{
+    static int s_failures;
+
+    static void Check(bool condition, string test, int arg)
+    {
+        if (!condition)
+        {
+            Console.WriteLine($"FAILED: {test}, {arg}");
+            s_failures++;
+        }
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static int Sum(int[] a, int n)
+    {
+        int sum = 0;
+        for (int i = 0; i < n; i++)
+        {
+            sum += a[i] * (i + 1);
+        }
+        return sum;
+    }
+
+    [MethodImpl(MethodImplOptions.NoOptimization)]
+    static int SumRef(int[] a, int n)
+    {
+        int sum = 0;
+        for (int i = 0; i < n; i++)
+        {
+            sum += a[i] * (i + 1);
+        }
+        return sum;
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static long SumRange(int start, int limit)
+    {
+        long sum = 0;
+        for (int i = start; i < limit; i++)
+        {
+            sum += i;
+        }
+        return sum;
+    }
+
+    [MethodImpl(MethodImplOptions.NoOptimization)]
+    static long SumRangeRef(int start, int limit)
+    {
+        long sum = 0;
+        for (int i = start; i < limit; i++)
+        {
+            sum += i;
+        }
+        return sum;
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static void Fill(int[] a, int start, int value)
+    {
+        for (int i = start; i < a.Length; i++)
+        {
+            a[i] = value + i;
+        }
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static int IndexOf(int[] a, int value)
+    {
+        int i = 0;
+        for (; i < a.Length; i++)
+        {
+            if (a[i] == value)
+            {
+                break;
+            }
+        }
+        return i;
+    }
+
+    static void Train()
+    {
+        int[] a = new int[1000];
+        for (int iter = 0; iter < 200; iter++)
+        {
+            Sum(a, a.Length);
+            SumRange(0, 1000);
+            Fill(a, 0, iter);
+            IndexOf(a, -1);
+
+            if ((iter % 20) == 0)
+            {
+                Thread.Sleep(20);
+            }
+        }
+    }
+
+    static void Verify()
+    {
+        for (int n = 0; n <= 33; n++)
+        {
+            int[] a = new int[n];
+            for (int i = 0; i < n; i++)
+            {
+                a[i] = i * 3 - 7;
+            }
+
+            Check(Sum(a, n) == SumRef(a, n), "Sum", n);
+            Check(SumRange(-5, n - 5) == SumRangeRef(-5, n - 5), "SumRange", n);
+
+            int[] filled = new int[n];
+            Fill(filled, n / 3, 11);
+            for (int i = 0; i < n; i++)
+            {
+                Check(filled[i] == ((i < n / 3) ? 0 : 11 + i), "Fill", n);
+            }
+
+            for (int k = 0; k < n; k++)
+            {
+                Check(IndexOf(a, a[k]) == k, "IndexOf", n);
+            }
+            Check(IndexOf(a, int.MinValue) == n, "IndexOf missing", n);
+        }
+
+        // The unrolled test must not overflow next to int.MaxValue.
+        for (int d = 0; d <= 9; d++)
+        {
+            Check(SumRange(int.MaxValue - d, int.MaxValue) == SumRangeRef(int.MaxValue - d, int.MaxValue), "SumRange max", d);
+        }
+
+        // Out of range accesses must still throw after the same number of iterations.
+        int[] small = new int[5];
+        bool threw = false;
+        try
+        {
+            Sum(small, 9);
+        }
+        catch (IndexOutOfRangeException)
+        {
+            threw = true;
+        }
+        Check(threw, "Sum out of range", 9);
+    }
+
+    public static int Main()
+    {
+        // Check before and after tiering up with profile data.
+        Verify();
+        Train();
+        Verify();
+
+        if (s_failures != 0)
+        {
+            return 101;
+        }
+
+        Console.WriteLine("PASSED");
+        return 100;
+    }
+}
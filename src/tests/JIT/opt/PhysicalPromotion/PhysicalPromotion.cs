@@ -0,0 +1,328 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+using System;
+using System.Runtime.CompilerServices;
+using System.Runtime.InteropServices;
+
+// Hot fields of struct locals that regular promotion leaves alone may be given their own locals.
+// Check that the struct is kept in sync with them: when it is passed or copied as a whole after
+// its fields were updated, when it is redefined as a whole before its fields are read again, when
+// it is a parameter, when fields overlap, and when the hot fields live in a nested struct.
+
+public class PhysicalPromotion
+{
+    static int s_failures;
+
+    static void Check(long actual, long expected, string test)
+    {
+        if (actual != expected)
+        {
+            Console.WriteLine($"FAILED: {test}, expected {expected}, got {actual}");
+            s_failures++;
+        }
+    }
+
+    // Too many fields for regular struct promotion.
+    struct Large
+    {
+        public long A;
+        public long B;
+        public long C;
+        public long D;
+        public long E;
+        public long F;
+    }
+
+    struct Outer
+    {
+        public int Tag;
+        public Large Inner;
+    }
+
+    [StructLayout(LayoutKind.Explicit)]
+    struct Overlapped
+    {
+        [FieldOffset(0)] public long Whole;
+        [FieldOffset(0)] public int Low;
+        [FieldOffset(4)] public int High;
+        [FieldOffset(8)] public long Other;
+        [FieldOffset(16)] public long Pad0;
+        [FieldOffset(24)] public long Pad1;
+        [FieldOffset(32)] public long Pad2;
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static long Sum(Large l) => l.A + 2 * l.B + 3 * l.C + 4 * l.D + 5 * l.E + 6 * l.F;
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static void Bump(ref Large l) => l.A += 1000;
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static Large Make(long seed) => new Large { A = seed, B = seed + 1, C = seed + 2, D = seed + 3, E = seed + 4, F = seed + 5 };
+
+    // Hot fields updated in a loop, then the struct is passed by value to a call.
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static long WriteBackBeforeCall(int n)
+    {
+        Large l = default;
+        l.F = 7;
+        for (int i = 0; i < n; i++)
+        {
+            l.A += i;
+            l.B ^= i;
+        }
+        return Sum(l);
+    }
+
+    // Hot fields updated in a loop that also calls out with the struct by value.
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static long WriteBackInLoop(int n)
+    {
+        Large l = default;
+        long total = 0;
+        for (int i = 0; i < n; i++)
+        {
+            l.A += i;
+            l.C -= 1;
+            if ((i & 15) == 0)
+            {
+                total += Sum(l);
+            }
+        }
+        return total + l.A + l.C;
+    }
+
+    // The struct is redefined as a whole in the loop before its fields are read again.
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static long ReadBackAfterDef(int n)
+    {
+        Large l = Make(0);
+        long total = 0;
+        for (int i = 0; i < n; i++)
+        {
+            total += l.A + l.B;
+            l.A += 3;
+            if ((i & 7) == 7)
+            {
+                l = Make(i);
+            }
+        }
+        return total + l.A + l.B;
+    }
+
+    // The struct is copied as a whole to another local after its fields were updated.
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static long CopyAfterUpdate(int n)
+    {
+        Large l = default;
+        for (int i = 0; i < n; i++)
+        {
+            l.D += i;
+            l.E += 2 * i;
+        }
+        Large copy = l;
+        copy.A = 1;
+        return Sum(copy) + l.D - l.E;
+    }
+
+    // The struct is updated through a reference; its address is exposed.
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static long ExposedLocal(int n)
+    {
+        Large l = default;
+        for (int i = 0; i < n; i++)
+        {
+            l.A += i;
+            if ((i & 31) == 0)
+            {
+                Bump(ref l);
+            }
+        }
+        return l.A;
+    }
+
+    // Struct parameter: replacements are read on entry.
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static long Parameter(Large l, int n)
+    {
+        long total = 0;
+        for (int i = 0; i < n; i++)
+        {
+            total += l.B * i + l.F;
+            l.B++;
+        }
+        return total + Sum(l);
+    }
+
+    // Hot fields in a struct nested in another struct.
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static long Nested(int n)
+    {
+        Outer o = default;
+        o.Tag = 5;
+        for (int i = 0; i < n; i++)
+        {
+            o.Inner.B += o.Tag;
+            o.Inner.E += i;
+        }
+        return Sum(o.Inner) + o.Tag;
+    }
+
+    // Overlapping fields: an update through one view must be seen through the other.
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static long Overlap(int n)
+    {
+        Overlapped s = default;
+        for (int i = 0; i < n; i++)
+        {
+            s.Low += 1;
+            s.Other += s.High;
+            if ((i & 3) == 3)
+            {
+                s.Whole += 1L << 32;
+            }
+        }
+        return s.Whole + s.Other + s.Low;
+    }
+
+    [MethodImpl(MethodImplOptions.NoOptimization)]
+    static long WriteBackBeforeCallRef(int n)
+    {
+        Large l = default;
+        l.F = 7;
+        for (int i = 0; i < n; i++)
+        {
+            l.A += i;
+            l.B ^= i;
+        }
+        return Sum(l);
+    }
+
+    [MethodImpl(MethodImplOptions.NoOptimization)]
+    static long WriteBackInLoopRef(int n)
+    {
+        Large l = default;
+        long total = 0;
+        for (int i = 0; i < n; i++)
+        {
+            l.A += i;
+            l.C -= 1;
+            if ((i & 15) == 0)
+            {
+                total += Sum(l);
+            }
+        }
+        return total + l.A + l.C;
+    }
+
+    [MethodImpl(MethodImplOptions.NoOptimization)]
+    static long ReadBackAfterDefRef(int n)
+    {
+        Large l = Make(0);
+        long total = 0;
+        for (int i = 0; i < n; i++)
+        {
+            total += l.A + l.B;
+            l.A += 3;
+            if ((i & 7) == 7)
+            {
+                l = Make(i);
+            }
+        }
+        return total + l.A + l.B;
+    }
+
+    [MethodImpl(MethodImplOptions.NoOptimization)]
+    static long CopyAfterUpdateRef(int n)
+    {
+        Large l = default;
+        for (int i = 0; i < n; i++)
+        {
+            l.D += i;
+            l.E += 2 * i;
+        }
+        Large copy = l;
+        copy.A = 1;
+        return Sum(copy) + l.D - l.E;
+    }
+
+    [MethodImpl(MethodImplOptions.NoOptimization)]
+    static long ExposedLocalRef(int n)
+    {
+        Large l = default;
+        for (int i = 0; i < n; i++)
+        {
+            l.A += i;
+            if ((i & 31) == 0)
+            {
+                Bump(ref l);
+            }
+        }
+        return l.A;
+    }
+
+    [MethodImpl(MethodImplOptions.NoOptimization)]
+    static long ParameterRef(Large l, int n)
+    {
+        long total = 0;
+        for (int i = 0; i < n; i++)
+        {
+            total += l.B * i + l.F;
+            l.B++;
+        }
+        return total + Sum(l);
+    }
+
+    [MethodImpl(MethodImplOptions.NoOptimization)]
+    static long NestedRef(int n)
+    {
+        Outer o = default;
+        o.Tag = 5;
+        for (int i = 0; i < n; i++)
+        {
+            o.Inner.B += o.Tag;
+            o.Inner.E += i;
+        }
+        return Sum(o.Inner) + o.Tag;
+    }
+
+    [MethodImpl(MethodImplOptions.NoOptimization)]
+    static long OverlapRef(int n)
+    {
+        Overlapped s = default;
+        for (int i = 0; i < n; i++)
+        {
+            s.Low += 1;
+            s.Other += s.High;
+            if ((i & 3) == 3)
+            {
+                s.Whole += 1L << 32;
+            }
+        }
+        return s.Whole + s.Other + s.Low;
+    }
+
+    public static int Main()
+    {
+        foreach (int n in new[] { 0, 1, 7, 8, 17, 100, 1000 })
+        {
+            Check(WriteBackBeforeCall(n), WriteBackBeforeCallRef(n), $"WriteBackBeforeCall({n})");
+            Check(WriteBackInLoop(n), WriteBackInLoopRef(n), $"WriteBackInLoop({n})");
+            Check(ReadBackAfterDef(n), ReadBackAfterDefRef(n), $"ReadBackAfterDef({n})");
+            Check(CopyAfterUpdate(n), CopyAfterUpdateRef(n), $"CopyAfterUpdate({n})");
+            Check(ExposedLocal(n), ExposedLocalRef(n), $"ExposedLocal({n})");
+            Check(Parameter(Make(n), n), ParameterRef(Make(n), n), $"Parameter({n})");
+            Check(Nested(n), NestedRef(n), $"Nested({n})");
+            Check(Overlap(n), OverlapRef(n), $"Overlap({n})");
+        }
+
+        if (s_failures != 0)
+        {
+            return 101;
+        }
+
+        Console.WriteLine("PASSED");
+        return 100;
+    }
+}
@@ -0,0 +1,183 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+using System;
+using System.Runtime.CompilerServices;
+
+// Range check may bound an index "i + cns" by the initial value of an increasing IV "i" and remove
+// its bounds check, like a[i - 1] in a loop that starts at 1. Check that the bounds check stays
+// where the index can be out of range: when the loop starts at 0, when the add overflows for an IV
+// near int.MaxValue, and when the IV itself wraps around.
+
+public class RangeCheckDerivedIV
+{
+    const long OutOfRange = -1;
+
+    static int s_failures;
+
+    static void Check(long actual, long expected, string test)
+    {
+        if (actual != expected)
+        {
+            Console.WriteLine($"FAILED: {test}, expected {expected}, got {actual}");
+            s_failures++;
+        }
+    }
+
+    static long Run(Func<int[], long> test, int[] a)
+    {
+        try
+        {
+            return test(a);
+        }
+        catch (IndexOutOfRangeException)
+        {
+            return OutOfRange;
+        }
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static long StartAtOne(int[] a)
+    {
+        long sum = 0;
+        for (int i = 1; i < a.Length; i++)
+        {
+            sum += a[i - 1] * (long)i;
+        }
+        return sum;
+    }
+
+    [MethodImpl(MethodImplOptions.NoOptimization)]
+    static long StartAtOneRef(int[] a)
+    {
+        long sum = 0;
+        for (int i = 1; i < a.Length; i++)
+        {
+            sum += a[i - 1] * (long)i;
+        }
+        return sum;
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static long StartAtZero(int[] a)
+    {
+        long sum = 0;
+        for (int i = 0; i < a.Length; i++)
+        {
+            sum += a[i - 1];
+        }
+        return sum;
+    }
+
+    [MethodImpl(MethodImplOptions.NoOptimization)]
+    static long StartAtZeroRef(int[] a)
+    {
+        long sum = 0;
+        for (int i = 0; i < a.Length; i++)
+        {
+            sum += a[i - 1];
+        }
+        return sum;
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static long NearMaxValue(int[] a)
+    {
+        long sum = 0;
+        // The loop ends when the IV wraps around.
+        for (int i = int.MaxValue - 3; i >= int.MaxValue - 3; i++)
+        {
+            sum += a[i - (int.MaxValue - 3)];
+        }
+        return sum;
+    }
+
+    [MethodImpl(MethodImplOptions.NoOptimization)]
+    static long NearMaxValueRef(int[] a)
+    {
+        long sum = 0;
+        for (int i = int.MaxValue - 3; i >= int.MaxValue - 3; i++)
+        {
+            sum += a[i - (int.MaxValue - 3)];
+        }
+        return sum;
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static long NearMaxValueOverflow(int[] a)
+    {
+        long sum = 0;
+        for (int i = int.MaxValue - 3; i > 0; i++)
+        {
+            // Wraps to a negative index.
+            sum += a[i + 8];
+        }
+        return sum;
+    }
+
+    [MethodImpl(MethodImplOptions.NoOptimization)]
+    static long NearMaxValueOverflowRef(int[] a)
+    {
+        long sum = 0;
+        for (int i = int.MaxValue - 3; i > 0; i++)
+        {
+            sum += a[i + 8];
+        }
+        return sum;
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static long WrappingIV(int[] a)
+    {
+        long sum = 0;
+        for (int i = 1; i < int.MaxValue; i += 0x40000000)
+        {
+            // The IV wraps to a negative value on the third iteration.
+            sum += a[i - 1];
+        }
+        return sum;
+    }
+
+    [MethodImpl(MethodImplOptions.NoOptimization)]
+    static long WrappingIVRef(int[] a)
+    {
+        long sum = 0;
+        for (int i = 1; i < int.MaxValue; i += 0x40000000)
+        {
+            sum += a[i - 1];
+        }
+        return sum;
+    }
+
+    public static int Main()
+    {
+        foreach (int n in new[] { 0, 1, 2, 5, 100 })
+        {
+            int[] a = new int[n];
+            for (int i = 0; i < n; i++)
+            {
+                a[i] = i * 3 + 1;
+            }
+
+            Check(Run(StartAtOne, a), Run(StartAtOneRef, a), $"StartAtOne({n})");
+            Check(Run(StartAtZero, a), Run(StartAtZeroRef, a), $"StartAtZero({n})");
+        }
+
+        Check(Run(StartAtZero, new int[3]), OutOfRange, "StartAtZero throws");
+        int[] four = new int[] { 1, 20, 300, 4000 };
+        Check(Run(NearMaxValue, four), Run(NearMaxValueRef, four), "NearMaxValue");
+        Check(Run(NearMaxValue, four), 4321, "NearMaxValue sum");
+        Check(Run(NearMaxValueOverflow, new int[16]), Run(NearMaxValueOverflowRef, new int[16]), "NearMaxValueOverflow");
+        Check(Run(NearMaxValueOverflow, new int[16]), OutOfRange, "NearMaxValueOverflow throws");
+        Check(Run(WrappingIV, new int[16]), Run(WrappingIVRef, new int[16]), "WrappingIV");
+        Check(Run(WrappingIV, new int[16]), OutOfRange, "WrappingIV throws");
+
+        if (s_failures != 0)
+        {
+            return 101;
+        }
+
+        Console.WriteLine("PASSED");
+        return 100;
+    }
+}